@@ -0,0 +1,115 @@
+#!/bin/sh
+#
+# Runs the generator on each family of synthetic grammars at growing sizes,
+# printing one line per run with the total time, allocations and peak memory,
+# and the counts of finite states, lexer nodes before and after reducing,
+# parser states and unique action rows.  The grammars, generated code and
+# full reports are kept in the output directory.
+#
+# The code generated for the smallest grammar of each family is then compiled
+# with each lexer and table layout, and parses an input of the family,
+# printing the megabytes parsed each second.
+#
+# Usage: bench.sh [parser] [synth] [output directory]
+
+PARSER=${1:-bin/parser}
+SYNTH=${2:-bin/synth}
+OUT=${3:-build/bench}
+BENCH=$(dirname "$0")
+CXX=${CXX:-g++}
+
+mkdir -p "$OUT"
+
+print_header() {
+    printf "%-9s %5s %9s %9s %8s %7s %7s %7s %7s %7s\n" \
+        family size seconds allocs peak_kb finite solved reduced states actions
+}
+
+print_result() {
+    awk -v family="$1" -v size="$2" -F': ' '
+        /allocations of/ {
+            split($2, parts, "s, ")
+            seconds += parts[1]
+            split(parts[2], words, " ")
+            allocs += words[1]
+            peak = $2
+            sub(/.* peak /, "", peak)
+            sub(/KB/, "", peak)
+        }
+        /^finite states/   { finite = $2 }
+        /^solved nodes/    { solved = $2 }
+        /^reduced nodes/   { reduced = $2 }
+        /^parser states/   { states = $2 }
+        /^unique actions/  { actions = $2 }
+        END {
+            printf "%-9s %5d %9.3f %9d %8d %7d %7d %7d %7d %7d\n", family, size,
+                seconds, allocs, peak, finite, solved, reduced, states, actions
+        }' "$3"
+}
+
+print_header | tee "$OUT/results.txt"
+
+for sizes in "tower 16 32 64 128" \
+             "keywords 100 200 400 800" \
+             "wide 25 50 100 200" \
+             "nested 8 16 32 64" \
+             "unicode 64 128 256 512"
+do
+    set -- $sizes
+    family=$1
+    shift
+    for size in "$@"; do
+        name="$OUT/$family$size"
+        "$SYNTH" "$family" "$size" > "$name.bnf" || exit 1
+        if ! "$PARSER" -t text -o "$name.cpp" "$name.bnf" 2> "$name.txt"; then
+            echo "Failed to generate $name.bnf, see $name.txt."
+            exit 1
+        fi
+        print_result "$family" "$size" "$name.txt" | tee -a "$OUT/results.txt"
+    done
+done
+
+# Compiles the code for a grammar with the given options, and prints the
+# megabytes it parses each second, or why it failed.
+measure_parse() {
+    name=$1
+    shift
+    if ! "$PARSER" "$@" -o "$name.cpp" "$name.bnf" 2> "$name.errors" ||
+       ! $CXX -std=c++14 -O2 -Wall -I "$BENCH" -o "$name.parse" "$name.cpp" \
+             "$name.actions.cpp" "$BENCH/parse.cpp" 2>> "$name.errors"; then
+        echo "Failed to build the parser of $name.bnf with $*, see $name.errors."
+        return 1
+    fi
+    if ! result=$("$name.parse" "$name.input" 2>&1); then
+        echo "$result"
+        return 1
+    fi
+    printf "%9.1f" "${result%% *}"
+}
+
+echo | tee -a "$OUT/results.txt"
+printf "%-9s %5s %9s %9s %9s %9s %9s\n" \
+    family size functions direct table dense comb | tee -a "$OUT/results.txt"
+
+for family in tower keywords wide nested unicode; do
+    case $family in
+        tower)    size=16 ;;
+        keywords) size=100 ;;
+        wide)     size=25 ;;
+        nested)   size=8 ;;
+        unicode)  size=64 ;;
+    esac
+    name="$OUT/$family$size"
+    "$SYNTH" "$family" "$size" actions > "$name.actions.cpp" || exit 1
+    "$SYNTH" "$family" "$size" input > "$name.input" || exit 1
+    
+    line=$(printf "%-9s %5d" "$family" "$size")
+    for options in "-x functions" "-x direct" "-x table" "-g dense" "-g comb"; do
+        if ! speed=$(measure_parse "$name" $options); then
+            echo "$speed"
+            exit 1
+        fi
+        line="$line $speed"
+    done
+    echo "$line" | tee -a "$OUT/results.txt"
+done
@@ -0,0 +1,54 @@
+/**
+ * Measures the code generated from a synthetic grammar, by parsing the input
+ * file repeatedly and printing the megabytes parsed each second, along with
+ * the size of the tree.  Fails if the input is not accepted.
+ */
+
+#include "synth.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        std::cerr << "Usage: parse input\n";
+        return 1;
+    }
+    
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::cerr << "Unable to read '" << argv[1] << "'.\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string input = buffer.str();
+    
+    /** Parses at least 16MB, so the time is not too short to measure. */
+    const size_t total = 16 << 20;
+    size_t runs = total / std::max(input.size(), (size_t)1) + 1;
+    size_t size = 0;
+    
+    Table table;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < runs; i++) {
+        std::unique_ptr<Value> value(parse(input.data(), input.size(), &table));
+        Tree* tree = dynamic_cast<Tree*>(value.get());
+        if (!tree) {
+            std::cerr << "The input '" << argv[1] << "' was not accepted.\n";
+            return 1;
+        }
+        size = tree->size;
+    }
+    std::chrono::duration<double> seconds;
+    seconds = std::chrono::steady_clock::now() - start;
+    
+    double megabytes = (double)input.size() * runs / (1 << 20);
+    std::cout << megabytes / seconds.count() << " " << size << "\n";
+    return 0;
+}
@@ -0,0 +1,335 @@
+/**
+ * Writes synthetic grammars for measuring how the time and memory of the
+ * generator grow with the size of the grammar.  Each family of grammars
+ * stresses a different part of the generator, and the size sets how many
+ * levels, keywords or alternatives the grammar has.
+ *
+ * For measuring the generated parser, the same command also writes the
+ * actions of the grammar's rules, and an input that the grammar accepts.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/******************************************************************************/
+/** Names made only of letters, so they are also matched as identifiers. */
+static std::string
+word(const char* prefix, int index)
+{
+    std::string result = prefix;
+    do {
+        result += (char)('a' + index % 26);
+        index /= 26;
+    } while (index > 0);
+    return result;
+}
+
+/**
+ * The grammar is written to one stream and the definitions of its actions to
+ * the other, so they always match.
+ */
+struct Output {
+    std::ostream& grammar;
+    std::ostream& actions;
+};
+
+/**
+ * Writes the rules of a nonterminal, each with its own action, since the code
+ * is only written for rules that have an action or pass on a typed symbol.
+ * Every nonterminal is a Tree, and each action makes a tree counting the
+ * trees of its nonterminals.  The first rule of the grammar is the one
+ * accepted, so each grammar starts with a nonterminal of a single rule.
+ */
+static void
+write_rules(const std::string& nonterm,
+            const std::vector<std::string>& products,
+            Output& out)
+{
+    for (size_t i = 0; i < products.size(); i++) {
+        std::string action = "reduce_" + nonterm + "_" + std::to_string(i);
+        out.grammar << (i == 0 ? nonterm + "<Tree>:" : "    |");
+        if (!products[i].empty()) {
+            out.grammar << " " << products[i];
+        }
+        out.grammar << "  &" << action << "\n";
+        
+        std::vector<std::string> args;
+        std::stringstream symbols(products[i]);
+        std::string symbol;
+        while (symbols >> symbol) {
+            if (symbol[0] != '\'') {
+                args.push_back("a" + std::to_string(args.size()));
+            }
+        }
+        
+        out.actions << "std::unique_ptr<Tree>\n" << action << "(Table*";
+        for (auto& arg : args) {
+            out.actions << ", std::unique_ptr<Tree>& " << arg;
+        }
+        out.actions << ") {\n";
+        out.actions << "    std::unique_ptr<Tree> tree(new Tree());\n";
+        for (auto& arg : args) {
+            out.actions << "    tree->size += " << arg << "->size;\n";
+        }
+        out.actions << "    return tree;\n}\n\n";
+    }
+    out.grammar << "    ;\n";
+}
+
+/**
+ * Writes the terminals shared by most of the grammars.  The keywords are
+ * written before the identifiers, since the terminal written first is the
+ * one matched when both match the same string.
+ */
+static void
+write_terms(const std::vector<std::string>& keywords, std::ostream& out)
+{
+    out << "#include \"synth.hpp\"\n";
+    for (auto& keyword : keywords) {
+        out << "'" << keyword << "' ;\n";
+    }
+    out << "'num' [0-9]+ ;\n";
+    out << "'ws' (\\s|\\n|\\t)+ ;\n";
+}
+
+/** Number of statements, or terms of an expression, in each input. */
+static const int units = 20000;
+
+/**
+ * A tower of binary operators, one precedence level each, as in the
+ * expressions of most languages.  Stresses the number of parser states.  The
+ * input is a single long expression using every operator.
+ */
+static void
+write_tower(int size, Output& out, std::ostream& input)
+{
+    write_terms({}, out.grammar);
+    out.grammar << "'id' [a-z]+ ;\n";
+    write_rules("expr", {"e0"}, out);
+    for (int i = 0; i < size; i++) {
+        std::string level = "e" + std::to_string(i);
+        std::string next = "e" + std::to_string(i + 1);
+        write_rules(level, {next, level + " '#" + std::to_string(i) + "' " + next},
+                    out);
+    }
+    std::string last = "e" + std::to_string(size);
+    write_rules(last, {"'num'", "'id'", "'(' e0 ')'", "'-' " + last}, out);
+    
+    for (int i = 0; i < units; i++) {
+        if (i > 0) {
+            input << " #" << (i % size) << (i % 8 == 0 ? "\n" : " ");
+        }
+        input << "(x #" << (i * 7 % size) << " -" << i << ")";
+    }
+    input << "\n";
+}
+
+/**
+ * Statements that each start with their own keyword, which the lexer must
+ * tell apart from identifiers.  Stresses the lexer nodes and minimization.
+ */
+static void
+write_keywords(int size, Output& out, std::ostream& input)
+{
+    std::vector<std::string> keywords;
+    std::vector<std::string> stmts;
+    for (int i = 0; i < size; i++) {
+        keywords.push_back(word("k", i));
+        stmts.push_back("'" + keywords.back() + "' 'id' ';'");
+    }
+    
+    write_terms(keywords, out.grammar);
+    out.grammar << "'id' [a-z]([a-z]|[0-9])* ;\n";
+    write_rules("start", {"program"}, out);
+    write_rules("program", {"", "program stmt"}, out);
+    write_rules("stmt", stmts, out);
+    
+    for (int i = 0; i < units; i++) {
+        input << keywords[i % size] << " v" << i << ";\n";
+    }
+}
+
+/**
+ * A long list of statement kinds, each with its own nonterminal and a few
+ * shapes, sharing one expression grammar.  Stresses wide states with many
+ * shifts and the size of the action rows.
+ */
+static void
+write_wide(int size, Output& out, std::ostream& input)
+{
+    std::vector<std::string> keywords;
+    std::vector<std::string> stmts;
+    for (int i = 0; i < size; i++) {
+        keywords.push_back(word("s", i));
+        stmts.push_back("s" + std::to_string(i));
+    }
+    
+    write_terms(keywords, out.grammar);
+    out.grammar << "'id' [a-z]+ ;\n";
+    write_rules("start", {"program"}, out);
+    write_rules("program", {"", "program stmt"}, out);
+    write_rules("stmt", stmts, out);
+    
+    for (int i = 0; i < size; i++) {
+        std::string keyword = "'" + keywords[i] + "'";
+        write_rules("s" + std::to_string(i),
+                    {keyword + " expr ';'",
+                     keyword + " 'id' '=' expr ';'",
+                     keyword + " '{' program '}'"}, out);
+    }
+    write_rules("expr", {"term", "expr '+' term"}, out);
+    write_rules("term", {"'num'", "'id'", "'(' expr ')'"}, out);
+    
+    for (int i = 0; i < units; i++) {
+        const std::string& keyword = keywords[i % size];
+        switch (i % 3) {
+        case 0: input << keyword << " x + (" << i << " + y);\n"; break;
+        case 1: input << keyword << " x = y + " << i << ";\n"; break;
+        default: input << keyword << " { " << keyword << " x; }\n"; break;
+        }
+    }
+}
+
+/** Writes the items of one level of the nested blocks, and those inside. */
+static void
+write_items(const std::vector<std::string>& keywords, size_t level, int depth,
+            std::ostream& input)
+{
+    input << "x; y = z; ";
+    if (depth > 0) {
+        size_t next = (level + 1) % keywords.size();
+        input << keywords[level] << " { ";
+        write_items(keywords, next, depth - 1, input);
+        input << "} f ( ";
+        write_items(keywords, next, depth - 1, input);
+        input << ") ";
+    }
+}
+
+/**
+ * Blocks nested inside each other, where each level has its own items and
+ * the deepest level contains the first again.  Stresses the lookaheads of
+ * canonical states, which differ for each level.
+ */
+static void
+write_nested(int size, Output& out, std::ostream& input)
+{
+    std::vector<std::string> keywords;
+    for (int i = 0; i < size; i++) {
+        keywords.push_back(word("b", i));
+    }
+    
+    write_terms(keywords, out.grammar);
+    out.grammar << "'id' [a-z]+ ;\n";
+    write_rules("program", {"items0"}, out);
+    
+    for (int i = 0; i < size; i++) {
+        std::string items = "items" + std::to_string(i);
+        std::string item = "item" + std::to_string(i);
+        std::string next = "items" + std::to_string((i + 1) % size);
+        write_rules(items, {"", items + " " + item}, out);
+        write_rules(item, {"'id' ';'",
+                           "'id' '=' 'id' ';'",
+                           "'" + keywords[i] + "' '{' " + next + " '}'",
+                           "'id' '(' " + next + " ')'"}, out);
+    }
+    
+    for (int i = 0; i < units / 16; i++) {
+        write_items(keywords, 0, 3, input);
+        input << "\n";
+    }
+}
+
+/** Writes the character as UTF-8. */
+static void
+write_utf8(int c, std::ostream& out)
+{
+    if (c < 0x80) {
+        out << (char)c;
+    } else if (c < 0x800) {
+        out << (char)(0xc0 | (c >> 6));
+        out << (char)(0x80 | (c & 0x3f));
+    } else {
+        out << (char)(0xe0 | (c >> 12));
+        out << (char)(0x80 | ((c >> 6) & 0x3f));
+        out << (char)(0x80 | (c & 0x3f));
+    }
+}
+
+/**
+ * Identifiers made of many separate ranges of unicode letters.  Stresses the
+ * character classes and the ranges of each lexer node.
+ */
+static void
+write_unicode(int size, Output& out, std::ostream& input)
+{
+    std::stringstream letter;
+    letter << std::hex << "([a-z]";
+    for (int i = 0; i < size; i++) {
+        int first = 0x100 + i * 0x40;
+        letter << "|[\\u" << first << "-\\u" << first + 0x20 << "]";
+    }
+    letter << ")";
+    
+    write_terms({}, out.grammar);
+    out.grammar << "'id' " << letter.str() << "(" << letter.str() << "|[0-9])* ;\n";
+    write_rules("start", {"program"}, out);
+    write_rules("program", {"", "program 'id' '=' value ';'"}, out);
+    write_rules("value", {"'num'", "'id'"}, out);
+    
+    for (int i = 0; i < units; i++) {
+        for (int j = 0; j < 6; j++) {
+            write_utf8(0x100 + (i + j) % size * 0x40 + j, input);
+        }
+        input << "x" << i << " = " << (i % 2 == 0 ? "y" : "42") << ";\n";
+    }
+}
+
+/******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    if (argc < 3 || argc > 4 || atoi(argv[2]) < 1) {
+        std::cerr << "Usage: synth tower|keywords|wide|nested|unicode size "
+                     "[grammar|actions|input]\n";
+        return 1;
+    }
+    
+    std::stringstream grammar;
+    std::stringstream actions;
+    std::stringstream input;
+    Output out = {grammar, actions};
+    
+    int size = atoi(argv[2]);
+    if (strcmp(argv[1], "tower") == 0) {
+        write_tower(size, out, input);
+    } else if (strcmp(argv[1], "keywords") == 0) {
+        write_keywords(size, out, input);
+    } else if (strcmp(argv[1], "wide") == 0) {
+        write_wide(size, out, input);
+    } else if (strcmp(argv[1], "nested") == 0) {
+        write_nested(size, out, input);
+    } else if (strcmp(argv[1], "unicode") == 0) {
+        write_unicode(size, out, input);
+    } else {
+        std::cerr << "Unknown family '" << argv[1] << "'.\n";
+        return 1;
+    }
+    
+    const char* part = argc == 4 ? argv[3] : "grammar";
+    if (strcmp(part, "grammar") == 0) {
+        std::cout << grammar.str();
+    } else if (strcmp(part, "actions") == 0) {
+        std::cout << "#include \"synth.hpp\"\n\n" << actions.str();
+    } else if (strcmp(part, "input") == 0) {
+        std::cout << input.str();
+    } else {
+        std::cerr << "Unknown part '" << part << "'.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * Types used by the code generated from the synthetic grammars, which the
+ * generated code expects its grammar's include to declare.  Every nonterminal
+ * is a tree that counts the trees it was reduced from.
+ */
+
+#ifndef synth_hpp
+#define synth_hpp
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct State;
+
+class Table {};
+
+class Value {
+public:
+    virtual ~Value() = default;
+};
+
+class Tree : public Value {
+public:
+    size_t size = 1;
+};
+
+Value* parse(const char* input, size_t length, Table* table);
+
+#endif
@@ -0,0 +1,623 @@
+#include "synth.hpp"
+
+std::unique_ptr<Tree>
+reduce_start_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_2(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_3(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_4(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_5(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_6(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_7(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_8(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_9(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_10(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_11(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_12(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_13(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_14(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_15(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_16(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_17(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_18(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_19(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_20(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_21(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_22(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_23(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_24(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_25(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_26(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_27(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_28(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_29(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_30(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_31(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_32(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_33(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_34(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_35(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_36(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_37(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_38(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_39(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_40(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_41(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_42(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_43(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_44(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_45(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_46(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_47(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_48(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_49(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_50(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_51(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_52(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_53(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_54(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_55(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_56(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_57(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_58(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_59(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_60(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_61(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_62(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_63(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_64(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_65(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_66(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_67(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_68(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_69(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_70(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_71(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_72(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_73(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_74(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_75(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_76(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_77(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_78(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_79(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_80(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_81(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_82(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_83(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_84(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_85(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_86(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_87(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_88(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_89(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_90(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_91(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_92(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_93(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_94(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_95(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_96(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_97(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_98(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_99(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
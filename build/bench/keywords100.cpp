@@ -0,0 +1,2881 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ka", false, 0};
+Symbol term1 = {"kb", false, 1};
+Symbol term2 = {"kc", false, 2};
+Symbol term3 = {"kd", false, 3};
+Symbol term4 = {"ke", false, 4};
+Symbol term5 = {"kf", false, 5};
+Symbol term6 = {"kg", false, 6};
+Symbol term7 = {"kh", false, 7};
+Symbol term8 = {"ki", false, 8};
+Symbol term9 = {"kj", false, 9};
+Symbol term10 = {"kk", false, 10};
+Symbol term11 = {"kl", false, 11};
+Symbol term12 = {"km", false, 12};
+Symbol term13 = {"kn", false, 13};
+Symbol term14 = {"ko", false, 14};
+Symbol term15 = {"kp", false, 15};
+Symbol term16 = {"kq", false, 16};
+Symbol term17 = {"kr", false, 17};
+Symbol term18 = {"ks", false, 18};
+Symbol term19 = {"kt", false, 19};
+Symbol term20 = {"ku", false, 20};
+Symbol term21 = {"kv", false, 21};
+Symbol term22 = {"kw", false, 22};
+Symbol term23 = {"kx", false, 23};
+Symbol term24 = {"ky", false, 24};
+Symbol term25 = {"kz", false, 25};
+Symbol term26 = {"kab", false, 26};
+Symbol term27 = {"kbb", false, 27};
+Symbol term28 = {"kcb", false, 28};
+Symbol term29 = {"kdb", false, 29};
+Symbol term30 = {"keb", false, 30};
+Symbol term31 = {"kfb", false, 31};
+Symbol term32 = {"kgb", false, 32};
+Symbol term33 = {"khb", false, 33};
+Symbol term34 = {"kib", false, 34};
+Symbol term35 = {"kjb", false, 35};
+Symbol term36 = {"kkb", false, 36};
+Symbol term37 = {"klb", false, 37};
+Symbol term38 = {"kmb", false, 38};
+Symbol term39 = {"knb", false, 39};
+Symbol term40 = {"kob", false, 40};
+Symbol term41 = {"kpb", false, 41};
+Symbol term42 = {"kqb", false, 42};
+Symbol term43 = {"krb", false, 43};
+Symbol term44 = {"ksb", false, 44};
+Symbol term45 = {"ktb", false, 45};
+Symbol term46 = {"kub", false, 46};
+Symbol term47 = {"kvb", false, 47};
+Symbol term48 = {"kwb", false, 48};
+Symbol term49 = {"kxb", false, 49};
+Symbol term50 = {"kyb", false, 50};
+Symbol term51 = {"kzb", false, 51};
+Symbol term52 = {"kac", false, 52};
+Symbol term53 = {"kbc", false, 53};
+Symbol term54 = {"kcc", false, 54};
+Symbol term55 = {"kdc", false, 55};
+Symbol term56 = {"kec", false, 56};
+Symbol term57 = {"kfc", false, 57};
+Symbol term58 = {"kgc", false, 58};
+Symbol term59 = {"khc", false, 59};
+Symbol term60 = {"kic", false, 60};
+Symbol term61 = {"kjc", false, 61};
+Symbol term62 = {"kkc", false, 62};
+Symbol term63 = {"klc", false, 63};
+Symbol term64 = {"kmc", false, 64};
+Symbol term65 = {"knc", false, 65};
+Symbol term66 = {"koc", false, 66};
+Symbol term67 = {"kpc", false, 67};
+Symbol term68 = {"kqc", false, 68};
+Symbol term69 = {"krc", false, 69};
+Symbol term70 = {"ksc", false, 70};
+Symbol term71 = {"ktc", false, 71};
+Symbol term72 = {"kuc", false, 72};
+Symbol term73 = {"kvc", false, 73};
+Symbol term74 = {"kwc", false, 74};
+Symbol term75 = {"kxc", false, 75};
+Symbol term76 = {"kyc", false, 76};
+Symbol term77 = {"kzc", false, 77};
+Symbol term78 = {"kad", false, 78};
+Symbol term79 = {"kbd", false, 79};
+Symbol term80 = {"kcd", false, 80};
+Symbol term81 = {"kdd", false, 81};
+Symbol term82 = {"ked", false, 82};
+Symbol term83 = {"kfd", false, 83};
+Symbol term84 = {"kgd", false, 84};
+Symbol term85 = {"khd", false, 85};
+Symbol term86 = {"kid", false, 86};
+Symbol term87 = {"kjd", false, 87};
+Symbol term88 = {"kkd", false, 88};
+Symbol term89 = {"kld", false, 89};
+Symbol term90 = {"kmd", false, 90};
+Symbol term91 = {"knd", false, 91};
+Symbol term92 = {"kod", false, 92};
+Symbol term93 = {"kpd", false, 93};
+Symbol term94 = {"kqd", false, 94};
+Symbol term95 = {"krd", false, 95};
+Symbol term96 = {"ksd", false, 96};
+Symbol term97 = {"ktd", false, 97};
+Symbol term98 = {"kud", false, 98};
+Symbol term99 = {"kvd", false, 99};
+Symbol term100 = {"num", true, 100};
+Symbol term101 = {"ws", true, 101};
+Symbol term102 = {"id", false, 102};
+Symbol term103 = {";", false, 103};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+extern Node node75;
+extern Node node76;
+extern Node node77;
+extern Node node78;
+extern Node node79;
+extern Node node80;
+extern Node node81;
+extern Node node82;
+extern Node node83;
+extern Node node84;
+extern Node node85;
+extern Node node86;
+extern Node node87;
+extern Node node88;
+extern Node node89;
+extern Node node90;
+extern Node node91;
+extern Node node92;
+extern Node node93;
+extern Node node94;
+extern Node node95;
+extern Node node96;
+extern Node node97;
+extern Node node98;
+extern Node node99;
+extern Node node100;
+extern Node node101;
+extern Node node102;
+extern Node node103;
+extern Node node104;
+extern Node node105;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 37 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if ((k >= 10) && (k <= 19)) { return &node4; }
+    if (k == 20) { return &node5; }
+    if ((k >= 21) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node6; }
+    if (k == 11) { return &node7; }
+    if (k == 12) { return &node8; }
+    if (k == 13) { return &node9; }
+    if (k == 14) { return &node10; }
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node103; }
+    if (k == 12) { return &node104; }
+    if (k == 13) { return &node105; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node100; }
+    if (k == 12) { return &node101; }
+    if (k == 13) { return &node102; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node97; }
+    if (k == 12) { return &node98; }
+    if (k == 13) { return &node99; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node94; }
+    if (k == 12) { return &node95; }
+    if (k == 13) { return &node96; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node91; }
+    if (k == 12) { return &node92; }
+    if (k == 13) { return &node93; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node88; }
+    if (k == 12) { return &node89; }
+    if (k == 13) { return &node90; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node85; }
+    if (k == 12) { return &node86; }
+    if (k == 13) { return &node87; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node82; }
+    if (k == 12) { return &node83; }
+    if (k == 13) { return &node84; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node79; }
+    if (k == 12) { return &node80; }
+    if (k == 13) { return &node81; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node76; }
+    if (k == 12) { return &node77; }
+    if (k == 13) { return &node78; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node73; }
+    if (k == 12) { return &node74; }
+    if (k == 13) { return &node75; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node70; }
+    if (k == 12) { return &node71; }
+    if (k == 13) { return &node72; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node67; }
+    if (k == 12) { return &node68; }
+    if (k == 13) { return &node69; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node64; }
+    if (k == 12) { return &node65; }
+    if (k == 13) { return &node66; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node61; }
+    if (k == 12) { return &node62; }
+    if (k == 13) { return &node63; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node58; }
+    if (k == 12) { return &node59; }
+    if (k == 13) { return &node60; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node55; }
+    if (k == 12) { return &node56; }
+    if (k == 13) { return &node57; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node52; }
+    if (k == 12) { return &node53; }
+    if (k == 13) { return &node54; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node49; }
+    if (k == 12) { return &node50; }
+    if (k == 13) { return &node51; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node46; }
+    if (k == 12) { return &node47; }
+    if (k == 13) { return &node48; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node43; }
+    if (k == 12) { return &node44; }
+    if (k == 13) { return &node45; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node40; }
+    if (k == 12) { return &node41; }
+    if (k == 13) { return &node42; }
+    if ((k >= 14) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node38; }
+    if (k == 12) { return &node39; }
+    if ((k >= 13) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node36; }
+    if (k == 12) { return &node37; }
+    if ((k >= 13) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node34; }
+    if (k == 12) { return &node35; }
+    if ((k >= 13) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node32; }
+    if (k == 12) { return &node33; }
+    if ((k >= 13) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next62(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next63(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next64(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next65(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next66(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next67(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next68(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next69(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next70(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next71(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next72(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next73(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next74(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next75(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next76(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next77(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next78(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next79(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next80(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next81(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next82(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next83(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next84(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next85(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next86(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next87(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next88(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next89(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next90(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next91(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next92(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next93(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next94(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next95(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next96(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next97(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next98(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next99(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next100(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next101(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next102(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next103(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next104(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next105(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term101, nullptr};
+Node node2 = {&next2, &term100, nullptr};
+Node node3 = {nullptr, &term103, nullptr};
+Node node4 = {&next4, &term102, nullptr};
+Node node5 = {&next5, &term102, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term1, nullptr};
+Node node8 = {&next8, &term2, nullptr};
+Node node9 = {&next9, &term3, nullptr};
+Node node10 = {&next10, &term4, nullptr};
+Node node11 = {&next11, &term5, nullptr};
+Node node12 = {&next12, &term6, nullptr};
+Node node13 = {&next13, &term7, nullptr};
+Node node14 = {&next14, &term8, nullptr};
+Node node15 = {&next15, &term9, nullptr};
+Node node16 = {&next16, &term10, nullptr};
+Node node17 = {&next17, &term11, nullptr};
+Node node18 = {&next18, &term12, nullptr};
+Node node19 = {&next19, &term13, nullptr};
+Node node20 = {&next20, &term14, nullptr};
+Node node21 = {&next21, &term15, nullptr};
+Node node22 = {&next22, &term16, nullptr};
+Node node23 = {&next23, &term17, nullptr};
+Node node24 = {&next24, &term18, nullptr};
+Node node25 = {&next25, &term19, nullptr};
+Node node26 = {&next26, &term20, nullptr};
+Node node27 = {&next27, &term21, nullptr};
+Node node28 = {&next28, &term22, nullptr};
+Node node29 = {&next29, &term23, nullptr};
+Node node30 = {&next30, &term24, nullptr};
+Node node31 = {&next31, &term25, nullptr};
+Node node32 = {&next32, &term51, nullptr};
+Node node33 = {&next33, &term77, nullptr};
+Node node34 = {&next34, &term50, nullptr};
+Node node35 = {&next35, &term76, nullptr};
+Node node36 = {&next36, &term49, nullptr};
+Node node37 = {&next37, &term75, nullptr};
+Node node38 = {&next38, &term48, nullptr};
+Node node39 = {&next39, &term74, nullptr};
+Node node40 = {&next40, &term47, nullptr};
+Node node41 = {&next41, &term73, nullptr};
+Node node42 = {&next42, &term99, nullptr};
+Node node43 = {&next43, &term46, nullptr};
+Node node44 = {&next44, &term72, nullptr};
+Node node45 = {&next45, &term98, nullptr};
+Node node46 = {&next46, &term45, nullptr};
+Node node47 = {&next47, &term71, nullptr};
+Node node48 = {&next48, &term97, nullptr};
+Node node49 = {&next49, &term44, nullptr};
+Node node50 = {&next50, &term70, nullptr};
+Node node51 = {&next51, &term96, nullptr};
+Node node52 = {&next52, &term43, nullptr};
+Node node53 = {&next53, &term69, nullptr};
+Node node54 = {&next54, &term95, nullptr};
+Node node55 = {&next55, &term42, nullptr};
+Node node56 = {&next56, &term68, nullptr};
+Node node57 = {&next57, &term94, nullptr};
+Node node58 = {&next58, &term41, nullptr};
+Node node59 = {&next59, &term67, nullptr};
+Node node60 = {&next60, &term93, nullptr};
+Node node61 = {&next61, &term40, nullptr};
+Node node62 = {&next62, &term66, nullptr};
+Node node63 = {&next63, &term92, nullptr};
+Node node64 = {&next64, &term39, nullptr};
+Node node65 = {&next65, &term65, nullptr};
+Node node66 = {&next66, &term91, nullptr};
+Node node67 = {&next67, &term38, nullptr};
+Node node68 = {&next68, &term64, nullptr};
+Node node69 = {&next69, &term90, nullptr};
+Node node70 = {&next70, &term37, nullptr};
+Node node71 = {&next71, &term63, nullptr};
+Node node72 = {&next72, &term89, nullptr};
+Node node73 = {&next73, &term36, nullptr};
+Node node74 = {&next74, &term62, nullptr};
+Node node75 = {&next75, &term88, nullptr};
+Node node76 = {&next76, &term35, nullptr};
+Node node77 = {&next77, &term61, nullptr};
+Node node78 = {&next78, &term87, nullptr};
+Node node79 = {&next79, &term34, nullptr};
+Node node80 = {&next80, &term60, nullptr};
+Node node81 = {&next81, &term86, nullptr};
+Node node82 = {&next82, &term33, nullptr};
+Node node83 = {&next83, &term59, nullptr};
+Node node84 = {&next84, &term85, nullptr};
+Node node85 = {&next85, &term32, nullptr};
+Node node86 = {&next86, &term58, nullptr};
+Node node87 = {&next87, &term84, nullptr};
+Node node88 = {&next88, &term31, nullptr};
+Node node89 = {&next89, &term57, nullptr};
+Node node90 = {&next90, &term83, nullptr};
+Node node91 = {&next91, &term30, nullptr};
+Node node92 = {&next92, &term56, nullptr};
+Node node93 = {&next93, &term82, nullptr};
+Node node94 = {&next94, &term29, nullptr};
+Node node95 = {&next95, &term55, nullptr};
+Node node96 = {&next96, &term81, nullptr};
+Node node97 = {&next97, &term28, nullptr};
+Node node98 = {&next98, &term54, nullptr};
+Node node99 = {&next99, &term80, nullptr};
+Node node100 = {&next100, &term27, nullptr};
+Node node101 = {&next101, &term53, nullptr};
+Node node102 = {&next102, &term79, nullptr};
+Node node103 = {&next103, &term26, nullptr};
+Node node104 = {&next104, &term52, nullptr};
+Node node105 = {&next105, &term78, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 104};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_2(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_3(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_4(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_5(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_6(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_7(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_8(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_9(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_10(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_11(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_12(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_13(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_14(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_15(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_16(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_17(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_18(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_19(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_20(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_21(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_22(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_23(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_24(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_25(Table*);
+
+Value*
+reduce_stmt_25(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_25(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_26(Table*);
+
+Value*
+reduce_stmt_26(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_26(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_27(Table*);
+
+Value*
+reduce_stmt_27(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_27(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_28(Table*);
+
+Value*
+reduce_stmt_28(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_28(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_29(Table*);
+
+Value*
+reduce_stmt_29(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_29(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_30(Table*);
+
+Value*
+reduce_stmt_30(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_30(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_31(Table*);
+
+Value*
+reduce_stmt_31(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_31(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_32(Table*);
+
+Value*
+reduce_stmt_32(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_32(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_33(Table*);
+
+Value*
+reduce_stmt_33(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_33(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_34(Table*);
+
+Value*
+reduce_stmt_34(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_34(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_35(Table*);
+
+Value*
+reduce_stmt_35(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_35(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_36(Table*);
+
+Value*
+reduce_stmt_36(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_36(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_37(Table*);
+
+Value*
+reduce_stmt_37(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_37(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_38(Table*);
+
+Value*
+reduce_stmt_38(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_38(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_39(Table*);
+
+Value*
+reduce_stmt_39(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_39(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_40(Table*);
+
+Value*
+reduce_stmt_40(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_40(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_41(Table*);
+
+Value*
+reduce_stmt_41(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_41(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_42(Table*);
+
+Value*
+reduce_stmt_42(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_42(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_43(Table*);
+
+Value*
+reduce_stmt_43(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_43(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_44(Table*);
+
+Value*
+reduce_stmt_44(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_44(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_45(Table*);
+
+Value*
+reduce_stmt_45(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_45(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_46(Table*);
+
+Value*
+reduce_stmt_46(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_46(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_47(Table*);
+
+Value*
+reduce_stmt_47(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_47(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_48(Table*);
+
+Value*
+reduce_stmt_48(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_48(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_49(Table*);
+
+Value*
+reduce_stmt_49(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_49(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_50(Table*);
+
+Value*
+reduce_stmt_50(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_50(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_51(Table*);
+
+Value*
+reduce_stmt_51(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_51(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_52(Table*);
+
+Value*
+reduce_stmt_52(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_52(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_53(Table*);
+
+Value*
+reduce_stmt_53(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_53(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_54(Table*);
+
+Value*
+reduce_stmt_54(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_54(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_55(Table*);
+
+Value*
+reduce_stmt_55(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_55(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_56(Table*);
+
+Value*
+reduce_stmt_56(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_56(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_57(Table*);
+
+Value*
+reduce_stmt_57(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_57(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_58(Table*);
+
+Value*
+reduce_stmt_58(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_58(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_59(Table*);
+
+Value*
+reduce_stmt_59(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_59(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_60(Table*);
+
+Value*
+reduce_stmt_60(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_60(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_61(Table*);
+
+Value*
+reduce_stmt_61(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_61(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_62(Table*);
+
+Value*
+reduce_stmt_62(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_62(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_63(Table*);
+
+Value*
+reduce_stmt_63(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_63(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_64(Table*);
+
+Value*
+reduce_stmt_64(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_64(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_65(Table*);
+
+Value*
+reduce_stmt_65(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_65(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_66(Table*);
+
+Value*
+reduce_stmt_66(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_66(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_67(Table*);
+
+Value*
+reduce_stmt_67(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_67(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_68(Table*);
+
+Value*
+reduce_stmt_68(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_68(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_69(Table*);
+
+Value*
+reduce_stmt_69(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_69(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_70(Table*);
+
+Value*
+reduce_stmt_70(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_70(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_71(Table*);
+
+Value*
+reduce_stmt_71(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_71(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_72(Table*);
+
+Value*
+reduce_stmt_72(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_72(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_73(Table*);
+
+Value*
+reduce_stmt_73(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_73(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_74(Table*);
+
+Value*
+reduce_stmt_74(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_74(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_75(Table*);
+
+Value*
+reduce_stmt_75(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_75(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_76(Table*);
+
+Value*
+reduce_stmt_76(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_76(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_77(Table*);
+
+Value*
+reduce_stmt_77(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_77(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_78(Table*);
+
+Value*
+reduce_stmt_78(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_78(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_79(Table*);
+
+Value*
+reduce_stmt_79(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_79(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_80(Table*);
+
+Value*
+reduce_stmt_80(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_80(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_81(Table*);
+
+Value*
+reduce_stmt_81(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_81(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_82(Table*);
+
+Value*
+reduce_stmt_82(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_82(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_83(Table*);
+
+Value*
+reduce_stmt_83(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_83(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_84(Table*);
+
+Value*
+reduce_stmt_84(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_84(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_85(Table*);
+
+Value*
+reduce_stmt_85(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_85(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_86(Table*);
+
+Value*
+reduce_stmt_86(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_86(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_87(Table*);
+
+Value*
+reduce_stmt_87(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_87(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_88(Table*);
+
+Value*
+reduce_stmt_88(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_88(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_89(Table*);
+
+Value*
+reduce_stmt_89(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_89(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_90(Table*);
+
+Value*
+reduce_stmt_90(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_90(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_91(Table*);
+
+Value*
+reduce_stmt_91(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_91(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_92(Table*);
+
+Value*
+reduce_stmt_92(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_92(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_93(Table*);
+
+Value*
+reduce_stmt_93(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_93(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_94(Table*);
+
+Value*
+reduce_stmt_94(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_94(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_95(Table*);
+
+Value*
+reduce_stmt_95(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_95(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_96(Table*);
+
+Value*
+reduce_stmt_96(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_96(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_97(Table*);
+
+Value*
+reduce_stmt_97(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_97(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_98(Table*);
+
+Value*
+reduce_stmt_98(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_98(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_99(Table*);
+
+Value*
+reduce_stmt_99(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_99(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 3, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 3, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 3, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 3, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 3, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 3, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 3, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 3, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 3, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 3, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 3, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 3, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 3, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 3, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 3, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 3, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 3, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 3, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 3, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 3, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 3, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 3, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 3, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm2, 3, &reduce_stmt_25, -1};
+Rule rule29 = {&nonterm2, 3, &reduce_stmt_26, -1};
+Rule rule30 = {&nonterm2, 3, &reduce_stmt_27, -1};
+Rule rule31 = {&nonterm2, 3, &reduce_stmt_28, -1};
+Rule rule32 = {&nonterm2, 3, &reduce_stmt_29, -1};
+Rule rule33 = {&nonterm2, 3, &reduce_stmt_30, -1};
+Rule rule34 = {&nonterm2, 3, &reduce_stmt_31, -1};
+Rule rule35 = {&nonterm2, 3, &reduce_stmt_32, -1};
+Rule rule36 = {&nonterm2, 3, &reduce_stmt_33, -1};
+Rule rule37 = {&nonterm2, 3, &reduce_stmt_34, -1};
+Rule rule38 = {&nonterm2, 3, &reduce_stmt_35, -1};
+Rule rule39 = {&nonterm2, 3, &reduce_stmt_36, -1};
+Rule rule40 = {&nonterm2, 3, &reduce_stmt_37, -1};
+Rule rule41 = {&nonterm2, 3, &reduce_stmt_38, -1};
+Rule rule42 = {&nonterm2, 3, &reduce_stmt_39, -1};
+Rule rule43 = {&nonterm2, 3, &reduce_stmt_40, -1};
+Rule rule44 = {&nonterm2, 3, &reduce_stmt_41, -1};
+Rule rule45 = {&nonterm2, 3, &reduce_stmt_42, -1};
+Rule rule46 = {&nonterm2, 3, &reduce_stmt_43, -1};
+Rule rule47 = {&nonterm2, 3, &reduce_stmt_44, -1};
+Rule rule48 = {&nonterm2, 3, &reduce_stmt_45, -1};
+Rule rule49 = {&nonterm2, 3, &reduce_stmt_46, -1};
+Rule rule50 = {&nonterm2, 3, &reduce_stmt_47, -1};
+Rule rule51 = {&nonterm2, 3, &reduce_stmt_48, -1};
+Rule rule52 = {&nonterm2, 3, &reduce_stmt_49, -1};
+Rule rule53 = {&nonterm2, 3, &reduce_stmt_50, -1};
+Rule rule54 = {&nonterm2, 3, &reduce_stmt_51, -1};
+Rule rule55 = {&nonterm2, 3, &reduce_stmt_52, -1};
+Rule rule56 = {&nonterm2, 3, &reduce_stmt_53, -1};
+Rule rule57 = {&nonterm2, 3, &reduce_stmt_54, -1};
+Rule rule58 = {&nonterm2, 3, &reduce_stmt_55, -1};
+Rule rule59 = {&nonterm2, 3, &reduce_stmt_56, -1};
+Rule rule60 = {&nonterm2, 3, &reduce_stmt_57, -1};
+Rule rule61 = {&nonterm2, 3, &reduce_stmt_58, -1};
+Rule rule62 = {&nonterm2, 3, &reduce_stmt_59, -1};
+Rule rule63 = {&nonterm2, 3, &reduce_stmt_60, -1};
+Rule rule64 = {&nonterm2, 3, &reduce_stmt_61, -1};
+Rule rule65 = {&nonterm2, 3, &reduce_stmt_62, -1};
+Rule rule66 = {&nonterm2, 3, &reduce_stmt_63, -1};
+Rule rule67 = {&nonterm2, 3, &reduce_stmt_64, -1};
+Rule rule68 = {&nonterm2, 3, &reduce_stmt_65, -1};
+Rule rule69 = {&nonterm2, 3, &reduce_stmt_66, -1};
+Rule rule70 = {&nonterm2, 3, &reduce_stmt_67, -1};
+Rule rule71 = {&nonterm2, 3, &reduce_stmt_68, -1};
+Rule rule72 = {&nonterm2, 3, &reduce_stmt_69, -1};
+Rule rule73 = {&nonterm2, 3, &reduce_stmt_70, -1};
+Rule rule74 = {&nonterm2, 3, &reduce_stmt_71, -1};
+Rule rule75 = {&nonterm2, 3, &reduce_stmt_72, -1};
+Rule rule76 = {&nonterm2, 3, &reduce_stmt_73, -1};
+Rule rule77 = {&nonterm2, 3, &reduce_stmt_74, -1};
+Rule rule78 = {&nonterm2, 3, &reduce_stmt_75, -1};
+Rule rule79 = {&nonterm2, 3, &reduce_stmt_76, -1};
+Rule rule80 = {&nonterm2, 3, &reduce_stmt_77, -1};
+Rule rule81 = {&nonterm2, 3, &reduce_stmt_78, -1};
+Rule rule82 = {&nonterm2, 3, &reduce_stmt_79, -1};
+Rule rule83 = {&nonterm2, 3, &reduce_stmt_80, -1};
+Rule rule84 = {&nonterm2, 3, &reduce_stmt_81, -1};
+Rule rule85 = {&nonterm2, 3, &reduce_stmt_82, -1};
+Rule rule86 = {&nonterm2, 3, &reduce_stmt_83, -1};
+Rule rule87 = {&nonterm2, 3, &reduce_stmt_84, -1};
+Rule rule88 = {&nonterm2, 3, &reduce_stmt_85, -1};
+Rule rule89 = {&nonterm2, 3, &reduce_stmt_86, -1};
+Rule rule90 = {&nonterm2, 3, &reduce_stmt_87, -1};
+Rule rule91 = {&nonterm2, 3, &reduce_stmt_88, -1};
+Rule rule92 = {&nonterm2, 3, &reduce_stmt_89, -1};
+Rule rule93 = {&nonterm2, 3, &reduce_stmt_90, -1};
+Rule rule94 = {&nonterm2, 3, &reduce_stmt_91, -1};
+Rule rule95 = {&nonterm2, 3, &reduce_stmt_92, -1};
+Rule rule96 = {&nonterm2, 3, &reduce_stmt_93, -1};
+Rule rule97 = {&nonterm2, 3, &reduce_stmt_94, -1};
+Rule rule98 = {&nonterm2, 3, &reduce_stmt_95, -1};
+Rule rule99 = {&nonterm2, 3, &reduce_stmt_96, -1};
+Rule rule100 = {&nonterm2, 3, &reduce_stmt_97, -1};
+Rule rule101 = {&nonterm2, 3, &reduce_stmt_98, -1};
+Rule rule102 = {&nonterm2, 3, &reduce_stmt_99, -1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6, &rule7,
+    &rule8, &rule9, &rule10, &rule11, &rule12, &rule13, &rule14, &rule15,
+    &rule16, &rule17, &rule18, &rule19, &rule20, &rule21, &rule22, &rule23,
+    &rule24, &rule25, &rule26, &rule27, &rule28, &rule29, &rule30, &rule31,
+    &rule32, &rule33, &rule34, &rule35, &rule36, &rule37, &rule38, &rule39,
+    &rule40, &rule41, &rule42, &rule43, &rule44, &rule45, &rule46, &rule47,
+    &rule48, &rule49, &rule50, &rule51, &rule52, &rule53, &rule54, &rule55,
+    &rule56, &rule57, &rule58, &rule59, &rule60, &rule61, &rule62, &rule63,
+    &rule64, &rule65, &rule66, &rule67, &rule68, &rule69, &rule70, &rule71,
+    &rule72, &rule73, &rule74, &rule75, &rule76, &rule77, &rule78, &rule79,
+    &rule80, &rule81, &rule82, &rule83, &rule84, &rule85, &rule86, &rule87,
+    &rule88, &rule89, &rule90, &rule91, &rule92, &rule93, &rule94, &rule95,
+    &rule96, &rule97, &rule98, &rule99, &rule100, &rule101, &rule102
+};
+
+State parse_states[303] = {
+    {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7},
+    {8, 8}, {9, 9}, {10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}, {15, 15},
+    {16, 16}, {17, 17}, {18, 18}, {19, 19}, {20, 20}, {21, 21}, {22, 22}, {23, 23},
+    {24, 24}, {25, 25}, {26, 26}, {27, 27}, {28, 28}, {29, 29}, {30, 30}, {31, 31},
+    {32, 32}, {33, 33}, {34, 34}, {35, 35}, {36, 36}, {37, 37}, {38, 38}, {39, 39},
+    {40, 40}, {41, 41}, {42, 42}, {43, 43}, {44, 44}, {45, 45}, {46, 46}, {47, 47},
+    {48, 48}, {49, 49}, {50, 50}, {51, 51}, {52, 52}, {53, 53}, {54, 54}, {55, 55},
+    {56, 56}, {57, 57}, {58, 58}, {59, 59}, {60, 60}, {61, 61}, {62, 62}, {63, 63},
+    {64, 64}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+    {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79},
+    {80, 80}, {81, 81}, {82, 82}, {83, 83}, {84, 84}, {85, 85}, {86, 86}, {87, 87},
+    {88, 88}, {89, 89}, {90, 90}, {91, 91}, {92, 92}, {93, 93}, {94, 94}, {95, 95},
+    {96, 96}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103},
+    {104, 104}, {105, 105}, {106, 106}, {107, 107}, {108, 108}, {109, 109}, {110, 110}, {111, 111},
+    {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+    {120, 120}, {121, 121}, {122, 122}, {123, 123}, {124, 124}, {125, 125}, {126, 126}, {127, 127},
+    {128, 128}, {129, 129}, {130, 130}, {131, 131}, {132, 132}, {133, 133}, {134, 134}, {135, 135},
+    {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+    {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151},
+    {152, 152}, {153, 153}, {154, 154}, {155, 155}, {156, 156}, {157, 157}, {158, 158}, {159, 159},
+    {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+    {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175},
+    {176, 176}, {177, 177}, {178, 178}, {179, 179}, {180, 180}, {181, 181}, {182, 182}, {183, 183},
+    {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+    {192, 192}, {193, 193}, {194, 194}, {195, 195}, {196, 196}, {197, 197}, {198, 198}, {199, 199},
+    {200, 200}, {201, 201}, {202, 202}, {203, 203}, {204, 204}, {205, 205}, {206, 206}, {207, 207},
+    {208, 208}, {209, 209}, {210, 210}, {211, 211}, {212, 212}, {213, 213}, {214, 214}, {215, 215},
+    {216, 216}, {217, 217}, {218, 218}, {219, 219}, {220, 220}, {221, 221}, {222, 222}, {223, 223},
+    {224, 224}, {225, 225}, {226, 226}, {227, 227}, {228, 228}, {229, 229}, {230, 230}, {231, 231},
+    {232, 232}, {233, 233}, {234, 234}, {235, 235}, {236, 236}, {237, 237}, {238, 238}, {239, 239},
+    {240, 240}, {241, 241}, {242, 242}, {243, 243}, {244, 244}, {245, 245}, {246, 246}, {247, 247},
+    {248, 248}, {249, 249}, {250, 250}, {251, 251}, {252, 252}, {253, 253}, {254, 254}, {255, 255},
+    {256, 256}, {257, 257}, {258, 258}, {259, 259}, {260, 260}, {261, 261}, {262, 262}, {263, 263},
+    {264, 264}, {265, 265}, {266, 266}, {267, 267}, {268, 268}, {269, 269}, {270, 270}, {271, 271},
+    {272, 272}, {273, 273}, {274, 274}, {275, 275}, {276, 276}, {277, 277}, {278, 278}, {279, 279},
+    {280, 280}, {281, 281}, {282, 282}, {283, 283}, {284, 284}, {285, 285}, {286, 286}, {287, 287},
+    {288, 288}, {289, 289}, {290, 290}, {291, 291}, {292, 292}, {293, 293}, {294, 294}, {295, 295},
+    {296, 296}, {297, 297}, {298, 298}, {299, 299}, {300, 300}, {301, 301}, {302, 302}
+};
+
+unsigned short action_base[] = {
+    0, 0, 0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+    79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 96, 97, 98, 99, 100, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104,
+    0, 105, 0, 106, 0, 107, 0, 108, 0, 109, 0, 110, 0, 111, 0, 112,
+    0, 113, 0, 114, 0, 115, 0, 116, 0, 117, 0, 118, 0, 119, 0, 120,
+    0, 121, 0, 122, 0, 123, 0, 124, 0, 125, 0, 126, 0, 127, 0, 128,
+    0, 129, 0, 130, 0, 131, 0, 132, 0, 133, 0, 134, 0, 135, 0, 136,
+    0, 137, 0, 138, 0, 139, 0, 140, 0, 141, 0, 142, 0, 143, 0, 144,
+    0, 145, 0, 146, 0, 147, 0, 148, 0, 149, 0, 150, 0, 151, 0, 152,
+    0, 153, 0, 154, 0, 155, 0, 156, 0, 157, 0, 158, 0, 159, 0, 160,
+    0, 161, 0, 162, 0, 163, 0, 164, 0, 165, 0, 166, 0, 167, 0, 168,
+    0, 169, 0, 170, 0, 171, 0, 172, 0, 173, 0, 174, 0, 175, 0, 176,
+    0, 177, 0, 178, 0, 179, 0, 180, 0, 181, 0, 182, 0, 183, 0, 184,
+    0, 185, 0, 186, 0, 187, 0, 188, 0, 189, 0, 190, 0, 191, 0, 192,
+    0, 193, 0, 194, 0, 195, 0, 196, 0, 197, 0, 198, 0, 199, 0
+};
+
+unsigned short action_default[] = {
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 0, 410, 0, 406, 0, 402, 0, 398, 0,
+    394, 0, 390, 0, 386, 0, 382, 0, 378, 0, 374, 0, 370, 0, 366, 0,
+    362, 0, 358, 0, 354, 0, 350, 0, 346, 0, 342, 0, 338, 0, 334, 0,
+    330, 0, 326, 0, 322, 0, 318, 0, 314, 0, 310, 0, 306, 0, 302, 0,
+    298, 0, 294, 0, 290, 0, 286, 0, 282, 0, 278, 0, 274, 0, 270, 0,
+    266, 0, 262, 0, 258, 0, 254, 0, 250, 0, 246, 0, 242, 0, 238, 0,
+    234, 0, 230, 0, 226, 0, 222, 0, 218, 0, 214, 0, 210, 0, 206, 0,
+    202, 0, 198, 0, 194, 0, 190, 0, 186, 0, 182, 0, 178, 0, 174, 0,
+    170, 0, 166, 0, 162, 0, 158, 0, 154, 0, 150, 0, 146, 0, 142, 0,
+    138, 0, 134, 0, 130, 0, 126, 0, 122, 0, 118, 0, 114, 0, 110, 0,
+    106, 0, 102, 0, 98, 0, 94, 0, 90, 0, 86, 0, 82, 0, 78, 0,
+    74, 0, 70, 0, 66, 0, 62, 0, 58, 0, 54, 0, 50, 0, 46, 0,
+    42, 0, 38, 0, 34, 0, 30, 0, 26, 0, 22, 0, 18, 0, 14
+};
+
+unsigned short action_check[] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 303, 303, 2, 3, 1, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+    75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+    91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 103, 105, 107, 109, 111,
+    113, 115, 117, 119, 121, 123, 125, 127, 129, 131, 133, 135, 137, 139, 141, 143,
+    145, 147, 149, 151, 153, 155, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175,
+    177, 179, 181, 183, 185, 187, 189, 191, 193, 195, 197, 199, 201, 203, 205, 207,
+    209, 211, 213, 215, 217, 219, 221, 223, 225, 227, 229, 231, 233, 235, 237, 239,
+    241, 243, 245, 247, 249, 251, 253, 255, 257, 259, 261, 263, 265, 267, 269, 271,
+    273, 275, 277, 279, 281, 283, 285, 287, 289, 291, 293, 295, 297, 299, 301, 303
+};
+
+unsigned short action_next[] = {
+    9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61, 65, 69,
+    73, 77, 81, 85, 89, 93, 97, 101, 105, 109, 113, 117, 121, 125, 129, 133,
+    137, 141, 145, 149, 153, 157, 161, 165, 169, 173, 177, 181, 185, 189, 193, 197,
+    201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 249, 253, 257, 261,
+    265, 269, 273, 277, 281, 285, 289, 293, 297, 301, 305, 309, 313, 317, 321, 325,
+    329, 333, 337, 341, 345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389,
+    393, 397, 401, 405, 0, 0, 1205, 1197, 3, 1189, 1181, 1173, 1165, 1157, 1149, 1141,
+    1133, 1125, 1117, 1109, 1101, 1093, 1085, 1077, 1069, 1061, 1053, 1045, 1037, 1029, 1021, 1013,
+    1005, 997, 989, 981, 973, 965, 957, 949, 941, 933, 925, 917, 909, 901, 893, 885,
+    877, 869, 861, 853, 845, 837, 829, 821, 813, 805, 797, 789, 781, 773, 765, 757,
+    749, 741, 733, 725, 717, 709, 701, 693, 685, 677, 669, 661, 653, 645, 637, 629,
+    621, 613, 605, 597, 589, 581, 573, 565, 557, 549, 541, 533, 525, 517, 509, 501,
+    493, 485, 477, 469, 461, 453, 445, 437, 429, 421, 413, 417, 425, 433, 441, 449,
+    457, 465, 473, 481, 489, 497, 505, 513, 521, 529, 537, 545, 553, 561, 569, 577,
+    585, 593, 601, 609, 617, 625, 633, 641, 649, 657, 665, 673, 681, 689, 697, 705,
+    713, 721, 729, 737, 745, 753, 761, 769, 777, 785, 793, 801, 809, 817, 825, 833,
+    841, 849, 857, 865, 873, 881, 889, 897, 905, 913, 921, 929, 937, 945, 953, 961,
+    969, 977, 985, 993, 1001, 1009, 1017, 1025, 1033, 1041, 1049, 1057, 1065, 1073, 1081, 1089,
+    1097, 1105, 1113, 1121, 1129, 1137, 1145, 1153, 1161, 1169, 1177, 1185, 1193, 1201, 1209, 0
+};
+
+unsigned short goto_base[] = {
+    0, 0, 0
+};
+
+unsigned short goto_default[] = {
+    0, 1, 102
+};
+
+unsigned char goto_check[] = {
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+
+unsigned short goto_next[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/* Comb tables of 5773 bytes, 8.66037% of the 66660 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
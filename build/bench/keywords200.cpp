@@ -0,0 +1,7297 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ka", false, 0};
+Symbol term1 = {"kb", false, 1};
+Symbol term2 = {"kc", false, 2};
+Symbol term3 = {"kd", false, 3};
+Symbol term4 = {"ke", false, 4};
+Symbol term5 = {"kf", false, 5};
+Symbol term6 = {"kg", false, 6};
+Symbol term7 = {"kh", false, 7};
+Symbol term8 = {"ki", false, 8};
+Symbol term9 = {"kj", false, 9};
+Symbol term10 = {"kk", false, 10};
+Symbol term11 = {"kl", false, 11};
+Symbol term12 = {"km", false, 12};
+Symbol term13 = {"kn", false, 13};
+Symbol term14 = {"ko", false, 14};
+Symbol term15 = {"kp", false, 15};
+Symbol term16 = {"kq", false, 16};
+Symbol term17 = {"kr", false, 17};
+Symbol term18 = {"ks", false, 18};
+Symbol term19 = {"kt", false, 19};
+Symbol term20 = {"ku", false, 20};
+Symbol term21 = {"kv", false, 21};
+Symbol term22 = {"kw", false, 22};
+Symbol term23 = {"kx", false, 23};
+Symbol term24 = {"ky", false, 24};
+Symbol term25 = {"kz", false, 25};
+Symbol term26 = {"kab", false, 26};
+Symbol term27 = {"kbb", false, 27};
+Symbol term28 = {"kcb", false, 28};
+Symbol term29 = {"kdb", false, 29};
+Symbol term30 = {"keb", false, 30};
+Symbol term31 = {"kfb", false, 31};
+Symbol term32 = {"kgb", false, 32};
+Symbol term33 = {"khb", false, 33};
+Symbol term34 = {"kib", false, 34};
+Symbol term35 = {"kjb", false, 35};
+Symbol term36 = {"kkb", false, 36};
+Symbol term37 = {"klb", false, 37};
+Symbol term38 = {"kmb", false, 38};
+Symbol term39 = {"knb", false, 39};
+Symbol term40 = {"kob", false, 40};
+Symbol term41 = {"kpb", false, 41};
+Symbol term42 = {"kqb", false, 42};
+Symbol term43 = {"krb", false, 43};
+Symbol term44 = {"ksb", false, 44};
+Symbol term45 = {"ktb", false, 45};
+Symbol term46 = {"kub", false, 46};
+Symbol term47 = {"kvb", false, 47};
+Symbol term48 = {"kwb", false, 48};
+Symbol term49 = {"kxb", false, 49};
+Symbol term50 = {"kyb", false, 50};
+Symbol term51 = {"kzb", false, 51};
+Symbol term52 = {"kac", false, 52};
+Symbol term53 = {"kbc", false, 53};
+Symbol term54 = {"kcc", false, 54};
+Symbol term55 = {"kdc", false, 55};
+Symbol term56 = {"kec", false, 56};
+Symbol term57 = {"kfc", false, 57};
+Symbol term58 = {"kgc", false, 58};
+Symbol term59 = {"khc", false, 59};
+Symbol term60 = {"kic", false, 60};
+Symbol term61 = {"kjc", false, 61};
+Symbol term62 = {"kkc", false, 62};
+Symbol term63 = {"klc", false, 63};
+Symbol term64 = {"kmc", false, 64};
+Symbol term65 = {"knc", false, 65};
+Symbol term66 = {"koc", false, 66};
+Symbol term67 = {"kpc", false, 67};
+Symbol term68 = {"kqc", false, 68};
+Symbol term69 = {"krc", false, 69};
+Symbol term70 = {"ksc", false, 70};
+Symbol term71 = {"ktc", false, 71};
+Symbol term72 = {"kuc", false, 72};
+Symbol term73 = {"kvc", false, 73};
+Symbol term74 = {"kwc", false, 74};
+Symbol term75 = {"kxc", false, 75};
+Symbol term76 = {"kyc", false, 76};
+Symbol term77 = {"kzc", false, 77};
+Symbol term78 = {"kad", false, 78};
+Symbol term79 = {"kbd", false, 79};
+Symbol term80 = {"kcd", false, 80};
+Symbol term81 = {"kdd", false, 81};
+Symbol term82 = {"ked", false, 82};
+Symbol term83 = {"kfd", false, 83};
+Symbol term84 = {"kgd", false, 84};
+Symbol term85 = {"khd", false, 85};
+Symbol term86 = {"kid", false, 86};
+Symbol term87 = {"kjd", false, 87};
+Symbol term88 = {"kkd", false, 88};
+Symbol term89 = {"kld", false, 89};
+Symbol term90 = {"kmd", false, 90};
+Symbol term91 = {"knd", false, 91};
+Symbol term92 = {"kod", false, 92};
+Symbol term93 = {"kpd", false, 93};
+Symbol term94 = {"kqd", false, 94};
+Symbol term95 = {"krd", false, 95};
+Symbol term96 = {"ksd", false, 96};
+Symbol term97 = {"ktd", false, 97};
+Symbol term98 = {"kud", false, 98};
+Symbol term99 = {"kvd", false, 99};
+Symbol term100 = {"kwd", false, 100};
+Symbol term101 = {"kxd", false, 101};
+Symbol term102 = {"kyd", false, 102};
+Symbol term103 = {"kzd", false, 103};
+Symbol term104 = {"kae", false, 104};
+Symbol term105 = {"kbe", false, 105};
+Symbol term106 = {"kce", false, 106};
+Symbol term107 = {"kde", false, 107};
+Symbol term108 = {"kee", false, 108};
+Symbol term109 = {"kfe", false, 109};
+Symbol term110 = {"kge", false, 110};
+Symbol term111 = {"khe", false, 111};
+Symbol term112 = {"kie", false, 112};
+Symbol term113 = {"kje", false, 113};
+Symbol term114 = {"kke", false, 114};
+Symbol term115 = {"kle", false, 115};
+Symbol term116 = {"kme", false, 116};
+Symbol term117 = {"kne", false, 117};
+Symbol term118 = {"koe", false, 118};
+Symbol term119 = {"kpe", false, 119};
+Symbol term120 = {"kqe", false, 120};
+Symbol term121 = {"kre", false, 121};
+Symbol term122 = {"kse", false, 122};
+Symbol term123 = {"kte", false, 123};
+Symbol term124 = {"kue", false, 124};
+Symbol term125 = {"kve", false, 125};
+Symbol term126 = {"kwe", false, 126};
+Symbol term127 = {"kxe", false, 127};
+Symbol term128 = {"kye", false, 128};
+Symbol term129 = {"kze", false, 129};
+Symbol term130 = {"kaf", false, 130};
+Symbol term131 = {"kbf", false, 131};
+Symbol term132 = {"kcf", false, 132};
+Symbol term133 = {"kdf", false, 133};
+Symbol term134 = {"kef", false, 134};
+Symbol term135 = {"kff", false, 135};
+Symbol term136 = {"kgf", false, 136};
+Symbol term137 = {"khf", false, 137};
+Symbol term138 = {"kif", false, 138};
+Symbol term139 = {"kjf", false, 139};
+Symbol term140 = {"kkf", false, 140};
+Symbol term141 = {"klf", false, 141};
+Symbol term142 = {"kmf", false, 142};
+Symbol term143 = {"knf", false, 143};
+Symbol term144 = {"kof", false, 144};
+Symbol term145 = {"kpf", false, 145};
+Symbol term146 = {"kqf", false, 146};
+Symbol term147 = {"krf", false, 147};
+Symbol term148 = {"ksf", false, 148};
+Symbol term149 = {"ktf", false, 149};
+Symbol term150 = {"kuf", false, 150};
+Symbol term151 = {"kvf", false, 151};
+Symbol term152 = {"kwf", false, 152};
+Symbol term153 = {"kxf", false, 153};
+Symbol term154 = {"kyf", false, 154};
+Symbol term155 = {"kzf", false, 155};
+Symbol term156 = {"kag", false, 156};
+Symbol term157 = {"kbg", false, 157};
+Symbol term158 = {"kcg", false, 158};
+Symbol term159 = {"kdg", false, 159};
+Symbol term160 = {"keg", false, 160};
+Symbol term161 = {"kfg", false, 161};
+Symbol term162 = {"kgg", false, 162};
+Symbol term163 = {"khg", false, 163};
+Symbol term164 = {"kig", false, 164};
+Symbol term165 = {"kjg", false, 165};
+Symbol term166 = {"kkg", false, 166};
+Symbol term167 = {"klg", false, 167};
+Symbol term168 = {"kmg", false, 168};
+Symbol term169 = {"kng", false, 169};
+Symbol term170 = {"kog", false, 170};
+Symbol term171 = {"kpg", false, 171};
+Symbol term172 = {"kqg", false, 172};
+Symbol term173 = {"krg", false, 173};
+Symbol term174 = {"ksg", false, 174};
+Symbol term175 = {"ktg", false, 175};
+Symbol term176 = {"kug", false, 176};
+Symbol term177 = {"kvg", false, 177};
+Symbol term178 = {"kwg", false, 178};
+Symbol term179 = {"kxg", false, 179};
+Symbol term180 = {"kyg", false, 180};
+Symbol term181 = {"kzg", false, 181};
+Symbol term182 = {"kah", false, 182};
+Symbol term183 = {"kbh", false, 183};
+Symbol term184 = {"kch", false, 184};
+Symbol term185 = {"kdh", false, 185};
+Symbol term186 = {"keh", false, 186};
+Symbol term187 = {"kfh", false, 187};
+Symbol term188 = {"kgh", false, 188};
+Symbol term189 = {"khh", false, 189};
+Symbol term190 = {"kih", false, 190};
+Symbol term191 = {"kjh", false, 191};
+Symbol term192 = {"kkh", false, 192};
+Symbol term193 = {"klh", false, 193};
+Symbol term194 = {"kmh", false, 194};
+Symbol term195 = {"knh", false, 195};
+Symbol term196 = {"koh", false, 196};
+Symbol term197 = {"kph", false, 197};
+Symbol term198 = {"kqh", false, 198};
+Symbol term199 = {"krh", false, 199};
+Symbol term200 = {"num", true, 200};
+Symbol term201 = {"ws", true, 201};
+Symbol term202 = {"id", false, 202};
+Symbol term203 = {";", false, 203};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+extern Node node75;
+extern Node node76;
+extern Node node77;
+extern Node node78;
+extern Node node79;
+extern Node node80;
+extern Node node81;
+extern Node node82;
+extern Node node83;
+extern Node node84;
+extern Node node85;
+extern Node node86;
+extern Node node87;
+extern Node node88;
+extern Node node89;
+extern Node node90;
+extern Node node91;
+extern Node node92;
+extern Node node93;
+extern Node node94;
+extern Node node95;
+extern Node node96;
+extern Node node97;
+extern Node node98;
+extern Node node99;
+extern Node node100;
+extern Node node101;
+extern Node node102;
+extern Node node103;
+extern Node node104;
+extern Node node105;
+extern Node node106;
+extern Node node107;
+extern Node node108;
+extern Node node109;
+extern Node node110;
+extern Node node111;
+extern Node node112;
+extern Node node113;
+extern Node node114;
+extern Node node115;
+extern Node node116;
+extern Node node117;
+extern Node node118;
+extern Node node119;
+extern Node node120;
+extern Node node121;
+extern Node node122;
+extern Node node123;
+extern Node node124;
+extern Node node125;
+extern Node node126;
+extern Node node127;
+extern Node node128;
+extern Node node129;
+extern Node node130;
+extern Node node131;
+extern Node node132;
+extern Node node133;
+extern Node node134;
+extern Node node135;
+extern Node node136;
+extern Node node137;
+extern Node node138;
+extern Node node139;
+extern Node node140;
+extern Node node141;
+extern Node node142;
+extern Node node143;
+extern Node node144;
+extern Node node145;
+extern Node node146;
+extern Node node147;
+extern Node node148;
+extern Node node149;
+extern Node node150;
+extern Node node151;
+extern Node node152;
+extern Node node153;
+extern Node node154;
+extern Node node155;
+extern Node node156;
+extern Node node157;
+extern Node node158;
+extern Node node159;
+extern Node node160;
+extern Node node161;
+extern Node node162;
+extern Node node163;
+extern Node node164;
+extern Node node165;
+extern Node node166;
+extern Node node167;
+extern Node node168;
+extern Node node169;
+extern Node node170;
+extern Node node171;
+extern Node node172;
+extern Node node173;
+extern Node node174;
+extern Node node175;
+extern Node node176;
+extern Node node177;
+extern Node node178;
+extern Node node179;
+extern Node node180;
+extern Node node181;
+extern Node node182;
+extern Node node183;
+extern Node node184;
+extern Node node185;
+extern Node node186;
+extern Node node187;
+extern Node node188;
+extern Node node189;
+extern Node node190;
+extern Node node191;
+extern Node node192;
+extern Node node193;
+extern Node node194;
+extern Node node195;
+extern Node node196;
+extern Node node197;
+extern Node node198;
+extern Node node199;
+extern Node node200;
+extern Node node201;
+extern Node node202;
+extern Node node203;
+extern Node node204;
+extern Node node205;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 37 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if ((k >= 10) && (k <= 19)) { return &node4; }
+    if (k == 20) { return &node5; }
+    if ((k >= 21) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node6; }
+    if (k == 11) { return &node7; }
+    if (k == 12) { return &node8; }
+    if (k == 13) { return &node9; }
+    if (k == 14) { return &node10; }
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node199; }
+    if (k == 12) { return &node200; }
+    if (k == 13) { return &node201; }
+    if (k == 14) { return &node202; }
+    if (k == 15) { return &node203; }
+    if (k == 16) { return &node204; }
+    if (k == 17) { return &node205; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node192; }
+    if (k == 12) { return &node193; }
+    if (k == 13) { return &node194; }
+    if (k == 14) { return &node195; }
+    if (k == 15) { return &node196; }
+    if (k == 16) { return &node197; }
+    if (k == 17) { return &node198; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node185; }
+    if (k == 12) { return &node186; }
+    if (k == 13) { return &node187; }
+    if (k == 14) { return &node188; }
+    if (k == 15) { return &node189; }
+    if (k == 16) { return &node190; }
+    if (k == 17) { return &node191; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node178; }
+    if (k == 12) { return &node179; }
+    if (k == 13) { return &node180; }
+    if (k == 14) { return &node181; }
+    if (k == 15) { return &node182; }
+    if (k == 16) { return &node183; }
+    if (k == 17) { return &node184; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node171; }
+    if (k == 12) { return &node172; }
+    if (k == 13) { return &node173; }
+    if (k == 14) { return &node174; }
+    if (k == 15) { return &node175; }
+    if (k == 16) { return &node176; }
+    if (k == 17) { return &node177; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node164; }
+    if (k == 12) { return &node165; }
+    if (k == 13) { return &node166; }
+    if (k == 14) { return &node167; }
+    if (k == 15) { return &node168; }
+    if (k == 16) { return &node169; }
+    if (k == 17) { return &node170; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node157; }
+    if (k == 12) { return &node158; }
+    if (k == 13) { return &node159; }
+    if (k == 14) { return &node160; }
+    if (k == 15) { return &node161; }
+    if (k == 16) { return &node162; }
+    if (k == 17) { return &node163; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node150; }
+    if (k == 12) { return &node151; }
+    if (k == 13) { return &node152; }
+    if (k == 14) { return &node153; }
+    if (k == 15) { return &node154; }
+    if (k == 16) { return &node155; }
+    if (k == 17) { return &node156; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node143; }
+    if (k == 12) { return &node144; }
+    if (k == 13) { return &node145; }
+    if (k == 14) { return &node146; }
+    if (k == 15) { return &node147; }
+    if (k == 16) { return &node148; }
+    if (k == 17) { return &node149; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node136; }
+    if (k == 12) { return &node137; }
+    if (k == 13) { return &node138; }
+    if (k == 14) { return &node139; }
+    if (k == 15) { return &node140; }
+    if (k == 16) { return &node141; }
+    if (k == 17) { return &node142; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node129; }
+    if (k == 12) { return &node130; }
+    if (k == 13) { return &node131; }
+    if (k == 14) { return &node132; }
+    if (k == 15) { return &node133; }
+    if (k == 16) { return &node134; }
+    if (k == 17) { return &node135; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node122; }
+    if (k == 12) { return &node123; }
+    if (k == 13) { return &node124; }
+    if (k == 14) { return &node125; }
+    if (k == 15) { return &node126; }
+    if (k == 16) { return &node127; }
+    if (k == 17) { return &node128; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node115; }
+    if (k == 12) { return &node116; }
+    if (k == 13) { return &node117; }
+    if (k == 14) { return &node118; }
+    if (k == 15) { return &node119; }
+    if (k == 16) { return &node120; }
+    if (k == 17) { return &node121; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node108; }
+    if (k == 12) { return &node109; }
+    if (k == 13) { return &node110; }
+    if (k == 14) { return &node111; }
+    if (k == 15) { return &node112; }
+    if (k == 16) { return &node113; }
+    if (k == 17) { return &node114; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node101; }
+    if (k == 12) { return &node102; }
+    if (k == 13) { return &node103; }
+    if (k == 14) { return &node104; }
+    if (k == 15) { return &node105; }
+    if (k == 16) { return &node106; }
+    if (k == 17) { return &node107; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node94; }
+    if (k == 12) { return &node95; }
+    if (k == 13) { return &node96; }
+    if (k == 14) { return &node97; }
+    if (k == 15) { return &node98; }
+    if (k == 16) { return &node99; }
+    if (k == 17) { return &node100; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node87; }
+    if (k == 12) { return &node88; }
+    if (k == 13) { return &node89; }
+    if (k == 14) { return &node90; }
+    if (k == 15) { return &node91; }
+    if (k == 16) { return &node92; }
+    if (k == 17) { return &node93; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node80; }
+    if (k == 12) { return &node81; }
+    if (k == 13) { return &node82; }
+    if (k == 14) { return &node83; }
+    if (k == 15) { return &node84; }
+    if (k == 16) { return &node85; }
+    if (k == 17) { return &node86; }
+    if ((k >= 18) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node74; }
+    if (k == 12) { return &node75; }
+    if (k == 13) { return &node76; }
+    if (k == 14) { return &node77; }
+    if (k == 15) { return &node78; }
+    if (k == 16) { return &node79; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node68; }
+    if (k == 12) { return &node69; }
+    if (k == 13) { return &node70; }
+    if (k == 14) { return &node71; }
+    if (k == 15) { return &node72; }
+    if (k == 16) { return &node73; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node62; }
+    if (k == 12) { return &node63; }
+    if (k == 13) { return &node64; }
+    if (k == 14) { return &node65; }
+    if (k == 15) { return &node66; }
+    if (k == 16) { return &node67; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node56; }
+    if (k == 12) { return &node57; }
+    if (k == 13) { return &node58; }
+    if (k == 14) { return &node59; }
+    if (k == 15) { return &node60; }
+    if (k == 16) { return &node61; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node50; }
+    if (k == 12) { return &node51; }
+    if (k == 13) { return &node52; }
+    if (k == 14) { return &node53; }
+    if (k == 15) { return &node54; }
+    if (k == 16) { return &node55; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node44; }
+    if (k == 12) { return &node45; }
+    if (k == 13) { return &node46; }
+    if (k == 14) { return &node47; }
+    if (k == 15) { return &node48; }
+    if (k == 16) { return &node49; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node38; }
+    if (k == 12) { return &node39; }
+    if (k == 13) { return &node40; }
+    if (k == 14) { return &node41; }
+    if (k == 15) { return &node42; }
+    if (k == 16) { return &node43; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node32; }
+    if (k == 12) { return &node33; }
+    if (k == 13) { return &node34; }
+    if (k == 14) { return &node35; }
+    if (k == 15) { return &node36; }
+    if (k == 16) { return &node37; }
+    if ((k >= 17) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next62(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next63(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next64(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next65(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next66(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next67(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next68(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next69(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next70(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next71(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next72(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next73(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next74(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next75(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next76(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next77(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next78(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next79(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next80(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next81(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next82(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next83(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next84(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next85(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next86(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next87(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next88(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next89(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next90(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next91(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next92(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next93(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next94(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next95(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next96(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next97(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next98(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next99(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next100(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next101(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next102(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next103(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next104(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next105(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next106(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next107(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next108(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next109(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next110(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next111(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next112(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next113(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next114(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next115(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next116(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next117(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next118(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next119(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next120(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next121(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next122(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next123(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next124(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next125(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next126(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next127(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next128(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next129(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next130(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next131(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next132(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next133(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next134(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next135(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next136(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next137(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next138(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next139(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next140(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next141(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next142(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next143(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next144(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next145(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next146(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next147(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next148(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next149(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next150(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next151(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next152(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next153(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next154(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next155(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next156(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next157(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next158(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next159(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next160(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next161(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next162(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next163(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next164(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next165(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next166(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next167(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next168(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next169(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next170(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next171(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next172(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next173(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next174(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next175(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next176(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next177(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next178(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next179(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next180(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next181(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next182(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next183(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next184(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next185(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next186(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next187(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next188(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next189(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next190(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next191(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next192(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next193(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next194(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next195(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next196(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next197(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next198(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next199(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next200(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next201(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next202(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next203(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next204(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next205(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term201, nullptr};
+Node node2 = {&next2, &term200, nullptr};
+Node node3 = {nullptr, &term203, nullptr};
+Node node4 = {&next4, &term202, nullptr};
+Node node5 = {&next5, &term202, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term1, nullptr};
+Node node8 = {&next8, &term2, nullptr};
+Node node9 = {&next9, &term3, nullptr};
+Node node10 = {&next10, &term4, nullptr};
+Node node11 = {&next11, &term5, nullptr};
+Node node12 = {&next12, &term6, nullptr};
+Node node13 = {&next13, &term7, nullptr};
+Node node14 = {&next14, &term8, nullptr};
+Node node15 = {&next15, &term9, nullptr};
+Node node16 = {&next16, &term10, nullptr};
+Node node17 = {&next17, &term11, nullptr};
+Node node18 = {&next18, &term12, nullptr};
+Node node19 = {&next19, &term13, nullptr};
+Node node20 = {&next20, &term14, nullptr};
+Node node21 = {&next21, &term15, nullptr};
+Node node22 = {&next22, &term16, nullptr};
+Node node23 = {&next23, &term17, nullptr};
+Node node24 = {&next24, &term18, nullptr};
+Node node25 = {&next25, &term19, nullptr};
+Node node26 = {&next26, &term20, nullptr};
+Node node27 = {&next27, &term21, nullptr};
+Node node28 = {&next28, &term22, nullptr};
+Node node29 = {&next29, &term23, nullptr};
+Node node30 = {&next30, &term24, nullptr};
+Node node31 = {&next31, &term25, nullptr};
+Node node32 = {&next32, &term51, nullptr};
+Node node33 = {&next33, &term77, nullptr};
+Node node34 = {&next34, &term103, nullptr};
+Node node35 = {&next35, &term129, nullptr};
+Node node36 = {&next36, &term155, nullptr};
+Node node37 = {&next37, &term181, nullptr};
+Node node38 = {&next38, &term50, nullptr};
+Node node39 = {&next39, &term76, nullptr};
+Node node40 = {&next40, &term102, nullptr};
+Node node41 = {&next41, &term128, nullptr};
+Node node42 = {&next42, &term154, nullptr};
+Node node43 = {&next43, &term180, nullptr};
+Node node44 = {&next44, &term49, nullptr};
+Node node45 = {&next45, &term75, nullptr};
+Node node46 = {&next46, &term101, nullptr};
+Node node47 = {&next47, &term127, nullptr};
+Node node48 = {&next48, &term153, nullptr};
+Node node49 = {&next49, &term179, nullptr};
+Node node50 = {&next50, &term48, nullptr};
+Node node51 = {&next51, &term74, nullptr};
+Node node52 = {&next52, &term100, nullptr};
+Node node53 = {&next53, &term126, nullptr};
+Node node54 = {&next54, &term152, nullptr};
+Node node55 = {&next55, &term178, nullptr};
+Node node56 = {&next56, &term47, nullptr};
+Node node57 = {&next57, &term73, nullptr};
+Node node58 = {&next58, &term99, nullptr};
+Node node59 = {&next59, &term125, nullptr};
+Node node60 = {&next60, &term151, nullptr};
+Node node61 = {&next61, &term177, nullptr};
+Node node62 = {&next62, &term46, nullptr};
+Node node63 = {&next63, &term72, nullptr};
+Node node64 = {&next64, &term98, nullptr};
+Node node65 = {&next65, &term124, nullptr};
+Node node66 = {&next66, &term150, nullptr};
+Node node67 = {&next67, &term176, nullptr};
+Node node68 = {&next68, &term45, nullptr};
+Node node69 = {&next69, &term71, nullptr};
+Node node70 = {&next70, &term97, nullptr};
+Node node71 = {&next71, &term123, nullptr};
+Node node72 = {&next72, &term149, nullptr};
+Node node73 = {&next73, &term175, nullptr};
+Node node74 = {&next74, &term44, nullptr};
+Node node75 = {&next75, &term70, nullptr};
+Node node76 = {&next76, &term96, nullptr};
+Node node77 = {&next77, &term122, nullptr};
+Node node78 = {&next78, &term148, nullptr};
+Node node79 = {&next79, &term174, nullptr};
+Node node80 = {&next80, &term43, nullptr};
+Node node81 = {&next81, &term69, nullptr};
+Node node82 = {&next82, &term95, nullptr};
+Node node83 = {&next83, &term121, nullptr};
+Node node84 = {&next84, &term147, nullptr};
+Node node85 = {&next85, &term173, nullptr};
+Node node86 = {&next86, &term199, nullptr};
+Node node87 = {&next87, &term42, nullptr};
+Node node88 = {&next88, &term68, nullptr};
+Node node89 = {&next89, &term94, nullptr};
+Node node90 = {&next90, &term120, nullptr};
+Node node91 = {&next91, &term146, nullptr};
+Node node92 = {&next92, &term172, nullptr};
+Node node93 = {&next93, &term198, nullptr};
+Node node94 = {&next94, &term41, nullptr};
+Node node95 = {&next95, &term67, nullptr};
+Node node96 = {&next96, &term93, nullptr};
+Node node97 = {&next97, &term119, nullptr};
+Node node98 = {&next98, &term145, nullptr};
+Node node99 = {&next99, &term171, nullptr};
+Node node100 = {&next100, &term197, nullptr};
+Node node101 = {&next101, &term40, nullptr};
+Node node102 = {&next102, &term66, nullptr};
+Node node103 = {&next103, &term92, nullptr};
+Node node104 = {&next104, &term118, nullptr};
+Node node105 = {&next105, &term144, nullptr};
+Node node106 = {&next106, &term170, nullptr};
+Node node107 = {&next107, &term196, nullptr};
+Node node108 = {&next108, &term39, nullptr};
+Node node109 = {&next109, &term65, nullptr};
+Node node110 = {&next110, &term91, nullptr};
+Node node111 = {&next111, &term117, nullptr};
+Node node112 = {&next112, &term143, nullptr};
+Node node113 = {&next113, &term169, nullptr};
+Node node114 = {&next114, &term195, nullptr};
+Node node115 = {&next115, &term38, nullptr};
+Node node116 = {&next116, &term64, nullptr};
+Node node117 = {&next117, &term90, nullptr};
+Node node118 = {&next118, &term116, nullptr};
+Node node119 = {&next119, &term142, nullptr};
+Node node120 = {&next120, &term168, nullptr};
+Node node121 = {&next121, &term194, nullptr};
+Node node122 = {&next122, &term37, nullptr};
+Node node123 = {&next123, &term63, nullptr};
+Node node124 = {&next124, &term89, nullptr};
+Node node125 = {&next125, &term115, nullptr};
+Node node126 = {&next126, &term141, nullptr};
+Node node127 = {&next127, &term167, nullptr};
+Node node128 = {&next128, &term193, nullptr};
+Node node129 = {&next129, &term36, nullptr};
+Node node130 = {&next130, &term62, nullptr};
+Node node131 = {&next131, &term88, nullptr};
+Node node132 = {&next132, &term114, nullptr};
+Node node133 = {&next133, &term140, nullptr};
+Node node134 = {&next134, &term166, nullptr};
+Node node135 = {&next135, &term192, nullptr};
+Node node136 = {&next136, &term35, nullptr};
+Node node137 = {&next137, &term61, nullptr};
+Node node138 = {&next138, &term87, nullptr};
+Node node139 = {&next139, &term113, nullptr};
+Node node140 = {&next140, &term139, nullptr};
+Node node141 = {&next141, &term165, nullptr};
+Node node142 = {&next142, &term191, nullptr};
+Node node143 = {&next143, &term34, nullptr};
+Node node144 = {&next144, &term60, nullptr};
+Node node145 = {&next145, &term86, nullptr};
+Node node146 = {&next146, &term112, nullptr};
+Node node147 = {&next147, &term138, nullptr};
+Node node148 = {&next148, &term164, nullptr};
+Node node149 = {&next149, &term190, nullptr};
+Node node150 = {&next150, &term33, nullptr};
+Node node151 = {&next151, &term59, nullptr};
+Node node152 = {&next152, &term85, nullptr};
+Node node153 = {&next153, &term111, nullptr};
+Node node154 = {&next154, &term137, nullptr};
+Node node155 = {&next155, &term163, nullptr};
+Node node156 = {&next156, &term189, nullptr};
+Node node157 = {&next157, &term32, nullptr};
+Node node158 = {&next158, &term58, nullptr};
+Node node159 = {&next159, &term84, nullptr};
+Node node160 = {&next160, &term110, nullptr};
+Node node161 = {&next161, &term136, nullptr};
+Node node162 = {&next162, &term162, nullptr};
+Node node163 = {&next163, &term188, nullptr};
+Node node164 = {&next164, &term31, nullptr};
+Node node165 = {&next165, &term57, nullptr};
+Node node166 = {&next166, &term83, nullptr};
+Node node167 = {&next167, &term109, nullptr};
+Node node168 = {&next168, &term135, nullptr};
+Node node169 = {&next169, &term161, nullptr};
+Node node170 = {&next170, &term187, nullptr};
+Node node171 = {&next171, &term30, nullptr};
+Node node172 = {&next172, &term56, nullptr};
+Node node173 = {&next173, &term82, nullptr};
+Node node174 = {&next174, &term108, nullptr};
+Node node175 = {&next175, &term134, nullptr};
+Node node176 = {&next176, &term160, nullptr};
+Node node177 = {&next177, &term186, nullptr};
+Node node178 = {&next178, &term29, nullptr};
+Node node179 = {&next179, &term55, nullptr};
+Node node180 = {&next180, &term81, nullptr};
+Node node181 = {&next181, &term107, nullptr};
+Node node182 = {&next182, &term133, nullptr};
+Node node183 = {&next183, &term159, nullptr};
+Node node184 = {&next184, &term185, nullptr};
+Node node185 = {&next185, &term28, nullptr};
+Node node186 = {&next186, &term54, nullptr};
+Node node187 = {&next187, &term80, nullptr};
+Node node188 = {&next188, &term106, nullptr};
+Node node189 = {&next189, &term132, nullptr};
+Node node190 = {&next190, &term158, nullptr};
+Node node191 = {&next191, &term184, nullptr};
+Node node192 = {&next192, &term27, nullptr};
+Node node193 = {&next193, &term53, nullptr};
+Node node194 = {&next194, &term79, nullptr};
+Node node195 = {&next195, &term105, nullptr};
+Node node196 = {&next196, &term131, nullptr};
+Node node197 = {&next197, &term157, nullptr};
+Node node198 = {&next198, &term183, nullptr};
+Node node199 = {&next199, &term26, nullptr};
+Node node200 = {&next200, &term52, nullptr};
+Node node201 = {&next201, &term78, nullptr};
+Node node202 = {&next202, &term104, nullptr};
+Node node203 = {&next203, &term130, nullptr};
+Node node204 = {&next204, &term156, nullptr};
+Node node205 = {&next205, &term182, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 204};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_2(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_3(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_4(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_5(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_6(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_7(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_8(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_9(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_10(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_11(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_12(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_13(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_14(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_15(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_16(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_17(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_18(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_19(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_20(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_21(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_22(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_23(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_24(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_25(Table*);
+
+Value*
+reduce_stmt_25(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_25(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_26(Table*);
+
+Value*
+reduce_stmt_26(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_26(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_27(Table*);
+
+Value*
+reduce_stmt_27(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_27(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_28(Table*);
+
+Value*
+reduce_stmt_28(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_28(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_29(Table*);
+
+Value*
+reduce_stmt_29(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_29(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_30(Table*);
+
+Value*
+reduce_stmt_30(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_30(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_31(Table*);
+
+Value*
+reduce_stmt_31(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_31(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_32(Table*);
+
+Value*
+reduce_stmt_32(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_32(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_33(Table*);
+
+Value*
+reduce_stmt_33(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_33(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_34(Table*);
+
+Value*
+reduce_stmt_34(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_34(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_35(Table*);
+
+Value*
+reduce_stmt_35(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_35(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_36(Table*);
+
+Value*
+reduce_stmt_36(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_36(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_37(Table*);
+
+Value*
+reduce_stmt_37(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_37(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_38(Table*);
+
+Value*
+reduce_stmt_38(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_38(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_39(Table*);
+
+Value*
+reduce_stmt_39(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_39(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_40(Table*);
+
+Value*
+reduce_stmt_40(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_40(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_41(Table*);
+
+Value*
+reduce_stmt_41(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_41(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_42(Table*);
+
+Value*
+reduce_stmt_42(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_42(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_43(Table*);
+
+Value*
+reduce_stmt_43(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_43(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_44(Table*);
+
+Value*
+reduce_stmt_44(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_44(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_45(Table*);
+
+Value*
+reduce_stmt_45(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_45(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_46(Table*);
+
+Value*
+reduce_stmt_46(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_46(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_47(Table*);
+
+Value*
+reduce_stmt_47(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_47(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_48(Table*);
+
+Value*
+reduce_stmt_48(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_48(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_49(Table*);
+
+Value*
+reduce_stmt_49(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_49(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_50(Table*);
+
+Value*
+reduce_stmt_50(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_50(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_51(Table*);
+
+Value*
+reduce_stmt_51(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_51(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_52(Table*);
+
+Value*
+reduce_stmt_52(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_52(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_53(Table*);
+
+Value*
+reduce_stmt_53(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_53(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_54(Table*);
+
+Value*
+reduce_stmt_54(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_54(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_55(Table*);
+
+Value*
+reduce_stmt_55(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_55(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_56(Table*);
+
+Value*
+reduce_stmt_56(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_56(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_57(Table*);
+
+Value*
+reduce_stmt_57(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_57(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_58(Table*);
+
+Value*
+reduce_stmt_58(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_58(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_59(Table*);
+
+Value*
+reduce_stmt_59(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_59(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_60(Table*);
+
+Value*
+reduce_stmt_60(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_60(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_61(Table*);
+
+Value*
+reduce_stmt_61(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_61(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_62(Table*);
+
+Value*
+reduce_stmt_62(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_62(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_63(Table*);
+
+Value*
+reduce_stmt_63(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_63(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_64(Table*);
+
+Value*
+reduce_stmt_64(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_64(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_65(Table*);
+
+Value*
+reduce_stmt_65(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_65(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_66(Table*);
+
+Value*
+reduce_stmt_66(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_66(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_67(Table*);
+
+Value*
+reduce_stmt_67(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_67(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_68(Table*);
+
+Value*
+reduce_stmt_68(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_68(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_69(Table*);
+
+Value*
+reduce_stmt_69(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_69(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_70(Table*);
+
+Value*
+reduce_stmt_70(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_70(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_71(Table*);
+
+Value*
+reduce_stmt_71(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_71(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_72(Table*);
+
+Value*
+reduce_stmt_72(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_72(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_73(Table*);
+
+Value*
+reduce_stmt_73(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_73(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_74(Table*);
+
+Value*
+reduce_stmt_74(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_74(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_75(Table*);
+
+Value*
+reduce_stmt_75(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_75(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_76(Table*);
+
+Value*
+reduce_stmt_76(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_76(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_77(Table*);
+
+Value*
+reduce_stmt_77(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_77(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_78(Table*);
+
+Value*
+reduce_stmt_78(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_78(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_79(Table*);
+
+Value*
+reduce_stmt_79(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_79(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_80(Table*);
+
+Value*
+reduce_stmt_80(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_80(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_81(Table*);
+
+Value*
+reduce_stmt_81(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_81(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_82(Table*);
+
+Value*
+reduce_stmt_82(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_82(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_83(Table*);
+
+Value*
+reduce_stmt_83(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_83(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_84(Table*);
+
+Value*
+reduce_stmt_84(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_84(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_85(Table*);
+
+Value*
+reduce_stmt_85(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_85(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_86(Table*);
+
+Value*
+reduce_stmt_86(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_86(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_87(Table*);
+
+Value*
+reduce_stmt_87(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_87(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_88(Table*);
+
+Value*
+reduce_stmt_88(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_88(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_89(Table*);
+
+Value*
+reduce_stmt_89(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_89(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_90(Table*);
+
+Value*
+reduce_stmt_90(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_90(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_91(Table*);
+
+Value*
+reduce_stmt_91(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_91(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_92(Table*);
+
+Value*
+reduce_stmt_92(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_92(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_93(Table*);
+
+Value*
+reduce_stmt_93(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_93(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_94(Table*);
+
+Value*
+reduce_stmt_94(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_94(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_95(Table*);
+
+Value*
+reduce_stmt_95(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_95(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_96(Table*);
+
+Value*
+reduce_stmt_96(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_96(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_97(Table*);
+
+Value*
+reduce_stmt_97(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_97(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_98(Table*);
+
+Value*
+reduce_stmt_98(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_98(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_99(Table*);
+
+Value*
+reduce_stmt_99(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_99(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_100(Table*);
+
+Value*
+reduce_stmt_100(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_100(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_101(Table*);
+
+Value*
+reduce_stmt_101(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_101(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_102(Table*);
+
+Value*
+reduce_stmt_102(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_102(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_103(Table*);
+
+Value*
+reduce_stmt_103(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_103(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_104(Table*);
+
+Value*
+reduce_stmt_104(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_104(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_105(Table*);
+
+Value*
+reduce_stmt_105(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_105(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_106(Table*);
+
+Value*
+reduce_stmt_106(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_106(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_107(Table*);
+
+Value*
+reduce_stmt_107(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_107(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_108(Table*);
+
+Value*
+reduce_stmt_108(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_108(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_109(Table*);
+
+Value*
+reduce_stmt_109(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_109(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_110(Table*);
+
+Value*
+reduce_stmt_110(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_110(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_111(Table*);
+
+Value*
+reduce_stmt_111(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_111(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_112(Table*);
+
+Value*
+reduce_stmt_112(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_112(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_113(Table*);
+
+Value*
+reduce_stmt_113(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_113(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_114(Table*);
+
+Value*
+reduce_stmt_114(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_114(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_115(Table*);
+
+Value*
+reduce_stmt_115(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_115(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_116(Table*);
+
+Value*
+reduce_stmt_116(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_116(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_117(Table*);
+
+Value*
+reduce_stmt_117(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_117(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_118(Table*);
+
+Value*
+reduce_stmt_118(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_118(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_119(Table*);
+
+Value*
+reduce_stmt_119(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_119(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_120(Table*);
+
+Value*
+reduce_stmt_120(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_120(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_121(Table*);
+
+Value*
+reduce_stmt_121(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_121(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_122(Table*);
+
+Value*
+reduce_stmt_122(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_122(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_123(Table*);
+
+Value*
+reduce_stmt_123(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_123(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_124(Table*);
+
+Value*
+reduce_stmt_124(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_124(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_125(Table*);
+
+Value*
+reduce_stmt_125(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_125(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_126(Table*);
+
+Value*
+reduce_stmt_126(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_126(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_127(Table*);
+
+Value*
+reduce_stmt_127(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_127(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_128(Table*);
+
+Value*
+reduce_stmt_128(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_128(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_129(Table*);
+
+Value*
+reduce_stmt_129(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_129(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_130(Table*);
+
+Value*
+reduce_stmt_130(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_130(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_131(Table*);
+
+Value*
+reduce_stmt_131(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_131(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_132(Table*);
+
+Value*
+reduce_stmt_132(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_132(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_133(Table*);
+
+Value*
+reduce_stmt_133(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_133(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_134(Table*);
+
+Value*
+reduce_stmt_134(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_134(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_135(Table*);
+
+Value*
+reduce_stmt_135(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_135(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_136(Table*);
+
+Value*
+reduce_stmt_136(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_136(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_137(Table*);
+
+Value*
+reduce_stmt_137(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_137(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_138(Table*);
+
+Value*
+reduce_stmt_138(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_138(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_139(Table*);
+
+Value*
+reduce_stmt_139(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_139(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_140(Table*);
+
+Value*
+reduce_stmt_140(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_140(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_141(Table*);
+
+Value*
+reduce_stmt_141(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_141(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_142(Table*);
+
+Value*
+reduce_stmt_142(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_142(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_143(Table*);
+
+Value*
+reduce_stmt_143(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_143(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_144(Table*);
+
+Value*
+reduce_stmt_144(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_144(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_145(Table*);
+
+Value*
+reduce_stmt_145(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_145(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_146(Table*);
+
+Value*
+reduce_stmt_146(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_146(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_147(Table*);
+
+Value*
+reduce_stmt_147(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_147(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_148(Table*);
+
+Value*
+reduce_stmt_148(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_148(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_149(Table*);
+
+Value*
+reduce_stmt_149(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_149(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_150(Table*);
+
+Value*
+reduce_stmt_150(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_150(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_151(Table*);
+
+Value*
+reduce_stmt_151(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_151(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_152(Table*);
+
+Value*
+reduce_stmt_152(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_152(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_153(Table*);
+
+Value*
+reduce_stmt_153(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_153(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_154(Table*);
+
+Value*
+reduce_stmt_154(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_154(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_155(Table*);
+
+Value*
+reduce_stmt_155(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_155(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_156(Table*);
+
+Value*
+reduce_stmt_156(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_156(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_157(Table*);
+
+Value*
+reduce_stmt_157(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_157(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_158(Table*);
+
+Value*
+reduce_stmt_158(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_158(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_159(Table*);
+
+Value*
+reduce_stmt_159(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_159(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_160(Table*);
+
+Value*
+reduce_stmt_160(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_160(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_161(Table*);
+
+Value*
+reduce_stmt_161(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_161(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_162(Table*);
+
+Value*
+reduce_stmt_162(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_162(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_163(Table*);
+
+Value*
+reduce_stmt_163(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_163(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_164(Table*);
+
+Value*
+reduce_stmt_164(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_164(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_165(Table*);
+
+Value*
+reduce_stmt_165(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_165(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_166(Table*);
+
+Value*
+reduce_stmt_166(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_166(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_167(Table*);
+
+Value*
+reduce_stmt_167(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_167(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_168(Table*);
+
+Value*
+reduce_stmt_168(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_168(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_169(Table*);
+
+Value*
+reduce_stmt_169(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_169(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_170(Table*);
+
+Value*
+reduce_stmt_170(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_170(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_171(Table*);
+
+Value*
+reduce_stmt_171(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_171(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_172(Table*);
+
+Value*
+reduce_stmt_172(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_172(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_173(Table*);
+
+Value*
+reduce_stmt_173(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_173(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_174(Table*);
+
+Value*
+reduce_stmt_174(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_174(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_175(Table*);
+
+Value*
+reduce_stmt_175(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_175(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_176(Table*);
+
+Value*
+reduce_stmt_176(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_176(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_177(Table*);
+
+Value*
+reduce_stmt_177(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_177(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_178(Table*);
+
+Value*
+reduce_stmt_178(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_178(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_179(Table*);
+
+Value*
+reduce_stmt_179(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_179(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_180(Table*);
+
+Value*
+reduce_stmt_180(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_180(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_181(Table*);
+
+Value*
+reduce_stmt_181(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_181(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_182(Table*);
+
+Value*
+reduce_stmt_182(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_182(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_183(Table*);
+
+Value*
+reduce_stmt_183(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_183(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_184(Table*);
+
+Value*
+reduce_stmt_184(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_184(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_185(Table*);
+
+Value*
+reduce_stmt_185(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_185(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_186(Table*);
+
+Value*
+reduce_stmt_186(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_186(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_187(Table*);
+
+Value*
+reduce_stmt_187(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_187(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_188(Table*);
+
+Value*
+reduce_stmt_188(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_188(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_189(Table*);
+
+Value*
+reduce_stmt_189(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_189(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_190(Table*);
+
+Value*
+reduce_stmt_190(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_190(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_191(Table*);
+
+Value*
+reduce_stmt_191(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_191(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_192(Table*);
+
+Value*
+reduce_stmt_192(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_192(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_193(Table*);
+
+Value*
+reduce_stmt_193(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_193(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_194(Table*);
+
+Value*
+reduce_stmt_194(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_194(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_195(Table*);
+
+Value*
+reduce_stmt_195(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_195(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_196(Table*);
+
+Value*
+reduce_stmt_196(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_196(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_197(Table*);
+
+Value*
+reduce_stmt_197(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_197(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_198(Table*);
+
+Value*
+reduce_stmt_198(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_198(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_199(Table*);
+
+Value*
+reduce_stmt_199(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_199(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 3, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 3, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 3, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 3, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 3, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 3, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 3, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 3, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 3, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 3, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 3, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 3, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 3, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 3, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 3, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 3, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 3, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 3, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 3, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 3, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 3, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 3, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 3, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm2, 3, &reduce_stmt_25, -1};
+Rule rule29 = {&nonterm2, 3, &reduce_stmt_26, -1};
+Rule rule30 = {&nonterm2, 3, &reduce_stmt_27, -1};
+Rule rule31 = {&nonterm2, 3, &reduce_stmt_28, -1};
+Rule rule32 = {&nonterm2, 3, &reduce_stmt_29, -1};
+Rule rule33 = {&nonterm2, 3, &reduce_stmt_30, -1};
+Rule rule34 = {&nonterm2, 3, &reduce_stmt_31, -1};
+Rule rule35 = {&nonterm2, 3, &reduce_stmt_32, -1};
+Rule rule36 = {&nonterm2, 3, &reduce_stmt_33, -1};
+Rule rule37 = {&nonterm2, 3, &reduce_stmt_34, -1};
+Rule rule38 = {&nonterm2, 3, &reduce_stmt_35, -1};
+Rule rule39 = {&nonterm2, 3, &reduce_stmt_36, -1};
+Rule rule40 = {&nonterm2, 3, &reduce_stmt_37, -1};
+Rule rule41 = {&nonterm2, 3, &reduce_stmt_38, -1};
+Rule rule42 = {&nonterm2, 3, &reduce_stmt_39, -1};
+Rule rule43 = {&nonterm2, 3, &reduce_stmt_40, -1};
+Rule rule44 = {&nonterm2, 3, &reduce_stmt_41, -1};
+Rule rule45 = {&nonterm2, 3, &reduce_stmt_42, -1};
+Rule rule46 = {&nonterm2, 3, &reduce_stmt_43, -1};
+Rule rule47 = {&nonterm2, 3, &reduce_stmt_44, -1};
+Rule rule48 = {&nonterm2, 3, &reduce_stmt_45, -1};
+Rule rule49 = {&nonterm2, 3, &reduce_stmt_46, -1};
+Rule rule50 = {&nonterm2, 3, &reduce_stmt_47, -1};
+Rule rule51 = {&nonterm2, 3, &reduce_stmt_48, -1};
+Rule rule52 = {&nonterm2, 3, &reduce_stmt_49, -1};
+Rule rule53 = {&nonterm2, 3, &reduce_stmt_50, -1};
+Rule rule54 = {&nonterm2, 3, &reduce_stmt_51, -1};
+Rule rule55 = {&nonterm2, 3, &reduce_stmt_52, -1};
+Rule rule56 = {&nonterm2, 3, &reduce_stmt_53, -1};
+Rule rule57 = {&nonterm2, 3, &reduce_stmt_54, -1};
+Rule rule58 = {&nonterm2, 3, &reduce_stmt_55, -1};
+Rule rule59 = {&nonterm2, 3, &reduce_stmt_56, -1};
+Rule rule60 = {&nonterm2, 3, &reduce_stmt_57, -1};
+Rule rule61 = {&nonterm2, 3, &reduce_stmt_58, -1};
+Rule rule62 = {&nonterm2, 3, &reduce_stmt_59, -1};
+Rule rule63 = {&nonterm2, 3, &reduce_stmt_60, -1};
+Rule rule64 = {&nonterm2, 3, &reduce_stmt_61, -1};
+Rule rule65 = {&nonterm2, 3, &reduce_stmt_62, -1};
+Rule rule66 = {&nonterm2, 3, &reduce_stmt_63, -1};
+Rule rule67 = {&nonterm2, 3, &reduce_stmt_64, -1};
+Rule rule68 = {&nonterm2, 3, &reduce_stmt_65, -1};
+Rule rule69 = {&nonterm2, 3, &reduce_stmt_66, -1};
+Rule rule70 = {&nonterm2, 3, &reduce_stmt_67, -1};
+Rule rule71 = {&nonterm2, 3, &reduce_stmt_68, -1};
+Rule rule72 = {&nonterm2, 3, &reduce_stmt_69, -1};
+Rule rule73 = {&nonterm2, 3, &reduce_stmt_70, -1};
+Rule rule74 = {&nonterm2, 3, &reduce_stmt_71, -1};
+Rule rule75 = {&nonterm2, 3, &reduce_stmt_72, -1};
+Rule rule76 = {&nonterm2, 3, &reduce_stmt_73, -1};
+Rule rule77 = {&nonterm2, 3, &reduce_stmt_74, -1};
+Rule rule78 = {&nonterm2, 3, &reduce_stmt_75, -1};
+Rule rule79 = {&nonterm2, 3, &reduce_stmt_76, -1};
+Rule rule80 = {&nonterm2, 3, &reduce_stmt_77, -1};
+Rule rule81 = {&nonterm2, 3, &reduce_stmt_78, -1};
+Rule rule82 = {&nonterm2, 3, &reduce_stmt_79, -1};
+Rule rule83 = {&nonterm2, 3, &reduce_stmt_80, -1};
+Rule rule84 = {&nonterm2, 3, &reduce_stmt_81, -1};
+Rule rule85 = {&nonterm2, 3, &reduce_stmt_82, -1};
+Rule rule86 = {&nonterm2, 3, &reduce_stmt_83, -1};
+Rule rule87 = {&nonterm2, 3, &reduce_stmt_84, -1};
+Rule rule88 = {&nonterm2, 3, &reduce_stmt_85, -1};
+Rule rule89 = {&nonterm2, 3, &reduce_stmt_86, -1};
+Rule rule90 = {&nonterm2, 3, &reduce_stmt_87, -1};
+Rule rule91 = {&nonterm2, 3, &reduce_stmt_88, -1};
+Rule rule92 = {&nonterm2, 3, &reduce_stmt_89, -1};
+Rule rule93 = {&nonterm2, 3, &reduce_stmt_90, -1};
+Rule rule94 = {&nonterm2, 3, &reduce_stmt_91, -1};
+Rule rule95 = {&nonterm2, 3, &reduce_stmt_92, -1};
+Rule rule96 = {&nonterm2, 3, &reduce_stmt_93, -1};
+Rule rule97 = {&nonterm2, 3, &reduce_stmt_94, -1};
+Rule rule98 = {&nonterm2, 3, &reduce_stmt_95, -1};
+Rule rule99 = {&nonterm2, 3, &reduce_stmt_96, -1};
+Rule rule100 = {&nonterm2, 3, &reduce_stmt_97, -1};
+Rule rule101 = {&nonterm2, 3, &reduce_stmt_98, -1};
+Rule rule102 = {&nonterm2, 3, &reduce_stmt_99, -1};
+Rule rule103 = {&nonterm2, 3, &reduce_stmt_100, -1};
+Rule rule104 = {&nonterm2, 3, &reduce_stmt_101, -1};
+Rule rule105 = {&nonterm2, 3, &reduce_stmt_102, -1};
+Rule rule106 = {&nonterm2, 3, &reduce_stmt_103, -1};
+Rule rule107 = {&nonterm2, 3, &reduce_stmt_104, -1};
+Rule rule108 = {&nonterm2, 3, &reduce_stmt_105, -1};
+Rule rule109 = {&nonterm2, 3, &reduce_stmt_106, -1};
+Rule rule110 = {&nonterm2, 3, &reduce_stmt_107, -1};
+Rule rule111 = {&nonterm2, 3, &reduce_stmt_108, -1};
+Rule rule112 = {&nonterm2, 3, &reduce_stmt_109, -1};
+Rule rule113 = {&nonterm2, 3, &reduce_stmt_110, -1};
+Rule rule114 = {&nonterm2, 3, &reduce_stmt_111, -1};
+Rule rule115 = {&nonterm2, 3, &reduce_stmt_112, -1};
+Rule rule116 = {&nonterm2, 3, &reduce_stmt_113, -1};
+Rule rule117 = {&nonterm2, 3, &reduce_stmt_114, -1};
+Rule rule118 = {&nonterm2, 3, &reduce_stmt_115, -1};
+Rule rule119 = {&nonterm2, 3, &reduce_stmt_116, -1};
+Rule rule120 = {&nonterm2, 3, &reduce_stmt_117, -1};
+Rule rule121 = {&nonterm2, 3, &reduce_stmt_118, -1};
+Rule rule122 = {&nonterm2, 3, &reduce_stmt_119, -1};
+Rule rule123 = {&nonterm2, 3, &reduce_stmt_120, -1};
+Rule rule124 = {&nonterm2, 3, &reduce_stmt_121, -1};
+Rule rule125 = {&nonterm2, 3, &reduce_stmt_122, -1};
+Rule rule126 = {&nonterm2, 3, &reduce_stmt_123, -1};
+Rule rule127 = {&nonterm2, 3, &reduce_stmt_124, -1};
+Rule rule128 = {&nonterm2, 3, &reduce_stmt_125, -1};
+Rule rule129 = {&nonterm2, 3, &reduce_stmt_126, -1};
+Rule rule130 = {&nonterm2, 3, &reduce_stmt_127, -1};
+Rule rule131 = {&nonterm2, 3, &reduce_stmt_128, -1};
+Rule rule132 = {&nonterm2, 3, &reduce_stmt_129, -1};
+Rule rule133 = {&nonterm2, 3, &reduce_stmt_130, -1};
+Rule rule134 = {&nonterm2, 3, &reduce_stmt_131, -1};
+Rule rule135 = {&nonterm2, 3, &reduce_stmt_132, -1};
+Rule rule136 = {&nonterm2, 3, &reduce_stmt_133, -1};
+Rule rule137 = {&nonterm2, 3, &reduce_stmt_134, -1};
+Rule rule138 = {&nonterm2, 3, &reduce_stmt_135, -1};
+Rule rule139 = {&nonterm2, 3, &reduce_stmt_136, -1};
+Rule rule140 = {&nonterm2, 3, &reduce_stmt_137, -1};
+Rule rule141 = {&nonterm2, 3, &reduce_stmt_138, -1};
+Rule rule142 = {&nonterm2, 3, &reduce_stmt_139, -1};
+Rule rule143 = {&nonterm2, 3, &reduce_stmt_140, -1};
+Rule rule144 = {&nonterm2, 3, &reduce_stmt_141, -1};
+Rule rule145 = {&nonterm2, 3, &reduce_stmt_142, -1};
+Rule rule146 = {&nonterm2, 3, &reduce_stmt_143, -1};
+Rule rule147 = {&nonterm2, 3, &reduce_stmt_144, -1};
+Rule rule148 = {&nonterm2, 3, &reduce_stmt_145, -1};
+Rule rule149 = {&nonterm2, 3, &reduce_stmt_146, -1};
+Rule rule150 = {&nonterm2, 3, &reduce_stmt_147, -1};
+Rule rule151 = {&nonterm2, 3, &reduce_stmt_148, -1};
+Rule rule152 = {&nonterm2, 3, &reduce_stmt_149, -1};
+Rule rule153 = {&nonterm2, 3, &reduce_stmt_150, -1};
+Rule rule154 = {&nonterm2, 3, &reduce_stmt_151, -1};
+Rule rule155 = {&nonterm2, 3, &reduce_stmt_152, -1};
+Rule rule156 = {&nonterm2, 3, &reduce_stmt_153, -1};
+Rule rule157 = {&nonterm2, 3, &reduce_stmt_154, -1};
+Rule rule158 = {&nonterm2, 3, &reduce_stmt_155, -1};
+Rule rule159 = {&nonterm2, 3, &reduce_stmt_156, -1};
+Rule rule160 = {&nonterm2, 3, &reduce_stmt_157, -1};
+Rule rule161 = {&nonterm2, 3, &reduce_stmt_158, -1};
+Rule rule162 = {&nonterm2, 3, &reduce_stmt_159, -1};
+Rule rule163 = {&nonterm2, 3, &reduce_stmt_160, -1};
+Rule rule164 = {&nonterm2, 3, &reduce_stmt_161, -1};
+Rule rule165 = {&nonterm2, 3, &reduce_stmt_162, -1};
+Rule rule166 = {&nonterm2, 3, &reduce_stmt_163, -1};
+Rule rule167 = {&nonterm2, 3, &reduce_stmt_164, -1};
+Rule rule168 = {&nonterm2, 3, &reduce_stmt_165, -1};
+Rule rule169 = {&nonterm2, 3, &reduce_stmt_166, -1};
+Rule rule170 = {&nonterm2, 3, &reduce_stmt_167, -1};
+Rule rule171 = {&nonterm2, 3, &reduce_stmt_168, -1};
+Rule rule172 = {&nonterm2, 3, &reduce_stmt_169, -1};
+Rule rule173 = {&nonterm2, 3, &reduce_stmt_170, -1};
+Rule rule174 = {&nonterm2, 3, &reduce_stmt_171, -1};
+Rule rule175 = {&nonterm2, 3, &reduce_stmt_172, -1};
+Rule rule176 = {&nonterm2, 3, &reduce_stmt_173, -1};
+Rule rule177 = {&nonterm2, 3, &reduce_stmt_174, -1};
+Rule rule178 = {&nonterm2, 3, &reduce_stmt_175, -1};
+Rule rule179 = {&nonterm2, 3, &reduce_stmt_176, -1};
+Rule rule180 = {&nonterm2, 3, &reduce_stmt_177, -1};
+Rule rule181 = {&nonterm2, 3, &reduce_stmt_178, -1};
+Rule rule182 = {&nonterm2, 3, &reduce_stmt_179, -1};
+Rule rule183 = {&nonterm2, 3, &reduce_stmt_180, -1};
+Rule rule184 = {&nonterm2, 3, &reduce_stmt_181, -1};
+Rule rule185 = {&nonterm2, 3, &reduce_stmt_182, -1};
+Rule rule186 = {&nonterm2, 3, &reduce_stmt_183, -1};
+Rule rule187 = {&nonterm2, 3, &reduce_stmt_184, -1};
+Rule rule188 = {&nonterm2, 3, &reduce_stmt_185, -1};
+Rule rule189 = {&nonterm2, 3, &reduce_stmt_186, -1};
+Rule rule190 = {&nonterm2, 3, &reduce_stmt_187, -1};
+Rule rule191 = {&nonterm2, 3, &reduce_stmt_188, -1};
+Rule rule192 = {&nonterm2, 3, &reduce_stmt_189, -1};
+Rule rule193 = {&nonterm2, 3, &reduce_stmt_190, -1};
+Rule rule194 = {&nonterm2, 3, &reduce_stmt_191, -1};
+Rule rule195 = {&nonterm2, 3, &reduce_stmt_192, -1};
+Rule rule196 = {&nonterm2, 3, &reduce_stmt_193, -1};
+Rule rule197 = {&nonterm2, 3, &reduce_stmt_194, -1};
+Rule rule198 = {&nonterm2, 3, &reduce_stmt_195, -1};
+Rule rule199 = {&nonterm2, 3, &reduce_stmt_196, -1};
+Rule rule200 = {&nonterm2, 3, &reduce_stmt_197, -1};
+Rule rule201 = {&nonterm2, 3, &reduce_stmt_198, -1};
+Rule rule202 = {&nonterm2, 3, &reduce_stmt_199, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term1, &state3}, {&term2, &state4}, {&term3, &state5}, {&term4, &state6}, {&term5, &state7}, {&term6, &state8}, {&term7, &state9}, {&term8, &state10}, {&term9, &state11}, {&term10, &state12}, {&term11, &state13}, {&term12, &state14}, {&term13, &state15}, {&term14, &state16}, {&term15, &state17}, {&term16, &state18}, {&term17, &state19}, {&term18, &state20}, {&term19, &state21}, {&term20, &state22}, {&term21, &state23}, {&term22, &state24}, {&term23, &state25}, {&term24, &state26}, {&term25, &state27}, {&term26, &state28}, {&term27, &state29}, {&term28, &state30}, {&term29, &state31}, {&term30, &state32}, {&term31, &state33}, {&term32, &state34}, {&term33, &state35}, {&term34, &state36}, {&term35, &state37}, {&term36, &state38}, {&term37, &state39}, {&term38, &state40}, {&term39, &state41}, {&term40, &state42}, {&term41, &state43}, {&term42, &state44}, {&term43, &state45}, {&term44, &state46}, {&term45, &state47}, {&term46, &state48}, {&term47, &state49}, {&term48, &state50}, {&term49, &state51}, {&term50, &state52}, {&term51, &state53}, {&term52, &state54}, {&term53, &state55}, {&term54, &state56}, {&term55, &state57}, {&term56, &state58}, {&term57, &state59}, {&term58, &state60}, {&term59, &state61}, {&term60, &state62}, {&term61, &state63}, {&term62, &state64}, {&term63, &state65}, {&term64, &state66}, {&term65, &state67}, {&term66, &state68}, {&term67, &state69}, {&term68, &state70}, {&term69, &state71}, {&term70, &state72}, {&term71, &state73}, {&term72, &state74}, {&term73, &state75}, {&term74, &state76}, {&term75, &state77}, {&term76, &state78}, {&term77, &state79}, {&term78, &state80}, {&term79, &state81}, {&term80, &state82}, {&term81, &state83}, {&term82, &state84}, {&term83, &state85}, {&term84, &state86}, {&term85, &state87}, {&term86, &state88}, {&term87, &state89}, {&term88, &state90}, {&term89, &state91}, {&term90, &state92}, {&term91, &state93}, {&term92, &state94}, {&term93, &state95}, {&term94, &state96}, {&term95, &state97}, {&term96, &state98}, {&term97, &state99}, {&term98, &state100}, {&term99, &state101}, {&term100, &state102}, {&term101, &state103}, {&term102, &state104}, {&term103, &state105}, {&term104, &state106}, {&term105, &state107}, {&term106, &state108}, {&term107, &state109}, {&term108, &state110}, {&term109, &state111}, {&term110, &state112}, {&term111, &state113}, {&term112, &state114}, {&term113, &state115}, {&term114, &state116}, {&term115, &state117}, {&term116, &state118}, {&term117, &state119}, {&term118, &state120}, {&term119, &state121}, {&term120, &state122}, {&term121, &state123}, {&term122, &state124}, {&term123, &state125}, {&term124, &state126}, {&term125, &state127}, {&term126, &state128}, {&term127, &state129}, {&term128, &state130}, {&term129, &state131}, {&term130, &state132}, {&term131, &state133}, {&term132, &state134}, {&term133, &state135}, {&term134, &state136}, {&term135, &state137}, {&term136, &state138}, {&term137, &state139}, {&term138, &state140}, {&term139, &state141}, {&term140, &state142}, {&term141, &state143}, {&term142, &state144}, {&term143, &state145}, {&term144, &state146}, {&term145, &state147}, {&term146, &state148}, {&term147, &state149}, {&term148, &state150}, {&term149, &state151}, {&term150, &state152}, {&term151, &state153}, {&term152, &state154}, {&term153, &state155}, {&term154, &state156}, {&term155, &state157}, {&term156, &state158}, {&term157, &state159}, {&term158, &state160}, {&term159, &state161}, {&term160, &state162}, {&term161, &state163}, {&term162, &state164}, {&term163, &state165}, {&term164, &state166}, {&term165, &state167}, {&term166, &state168}, {&term167, &state169}, {&term168, &state170}, {&term169, &state171}, {&term170, &state172}, {&term171, &state173}, {&term172, &state174}, {&term173, &state175}, {&term174, &state176}, {&term175, &state177}, {&term176, &state178}, {&term177, &state179}, {&term178, &state180}, {&term179, &state181}, {&term180, &state182}, {&term181, &state183}, {&term182, &state184}, {&term183, &state185}, {&term184, &state186}, {&term185, &state187}, {&term186, &state188}, {&term187, &state189}, {&term188, &state190}, {&term189, &state191}, {&term190, &state192}, {&term191, &state193}, {&term192, &state194}, {&term193, &state195}, {&term194, &state196}, {&term195, &state197}, {&term196, &state198}, {&term197, &state199}, {&term198, &state200}, {&term199, &state201}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term202, &state601}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term202, &state599}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {{&term202, &state597}};
+std::vector<Reduce> reduce4 = {};
+std::vector<Shift> shift5 = {{&term202, &state595}};
+std::vector<Reduce> reduce5 = {};
+std::vector<Shift> shift6 = {{&term202, &state593}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {{&term202, &state591}};
+std::vector<Reduce> reduce7 = {};
+std::vector<Shift> shift8 = {{&term202, &state589}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term202, &state587}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term202, &state585}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {{&term202, &state583}};
+std::vector<Reduce> reduce11 = {};
+std::vector<Shift> shift12 = {{&term202, &state581}};
+std::vector<Reduce> reduce12 = {};
+std::vector<Shift> shift13 = {{&term202, &state579}};
+std::vector<Reduce> reduce13 = {};
+std::vector<Shift> shift14 = {{&term202, &state577}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {{&term202, &state575}};
+std::vector<Reduce> reduce15 = {};
+std::vector<Shift> shift16 = {{&term202, &state573}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term202, &state571}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term202, &state569}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {{&term202, &state567}};
+std::vector<Reduce> reduce19 = {};
+std::vector<Shift> shift20 = {{&term202, &state565}};
+std::vector<Reduce> reduce20 = {};
+std::vector<Shift> shift21 = {{&term202, &state563}};
+std::vector<Reduce> reduce21 = {};
+std::vector<Shift> shift22 = {{&term202, &state561}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {{&term202, &state559}};
+std::vector<Reduce> reduce23 = {};
+std::vector<Shift> shift24 = {{&term202, &state557}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term202, &state555}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term202, &state553}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {{&term202, &state551}};
+std::vector<Reduce> reduce27 = {};
+std::vector<Shift> shift28 = {{&term202, &state549}};
+std::vector<Reduce> reduce28 = {};
+std::vector<Shift> shift29 = {{&term202, &state547}};
+std::vector<Reduce> reduce29 = {};
+std::vector<Shift> shift30 = {{&term202, &state545}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {{&term202, &state543}};
+std::vector<Reduce> reduce31 = {};
+std::vector<Shift> shift32 = {{&term202, &state541}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term202, &state539}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term202, &state537}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {{&term202, &state535}};
+std::vector<Reduce> reduce35 = {};
+std::vector<Shift> shift36 = {{&term202, &state533}};
+std::vector<Reduce> reduce36 = {};
+std::vector<Shift> shift37 = {{&term202, &state531}};
+std::vector<Reduce> reduce37 = {};
+std::vector<Shift> shift38 = {{&term202, &state529}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {{&term202, &state527}};
+std::vector<Reduce> reduce39 = {};
+std::vector<Shift> shift40 = {{&term202, &state525}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term202, &state523}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term202, &state521}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {{&term202, &state519}};
+std::vector<Reduce> reduce43 = {};
+std::vector<Shift> shift44 = {{&term202, &state517}};
+std::vector<Reduce> reduce44 = {};
+std::vector<Shift> shift45 = {{&term202, &state515}};
+std::vector<Reduce> reduce45 = {};
+std::vector<Shift> shift46 = {{&term202, &state513}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {{&term202, &state511}};
+std::vector<Reduce> reduce47 = {};
+std::vector<Shift> shift48 = {{&term202, &state509}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term202, &state507}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term202, &state505}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {{&term202, &state503}};
+std::vector<Reduce> reduce51 = {};
+std::vector<Shift> shift52 = {{&term202, &state501}};
+std::vector<Reduce> reduce52 = {};
+std::vector<Shift> shift53 = {{&term202, &state499}};
+std::vector<Reduce> reduce53 = {};
+std::vector<Shift> shift54 = {{&term202, &state497}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {{&term202, &state495}};
+std::vector<Reduce> reduce55 = {};
+std::vector<Shift> shift56 = {{&term202, &state493}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term202, &state491}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term202, &state489}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {{&term202, &state487}};
+std::vector<Reduce> reduce59 = {};
+std::vector<Shift> shift60 = {{&term202, &state485}};
+std::vector<Reduce> reduce60 = {};
+std::vector<Shift> shift61 = {{&term202, &state483}};
+std::vector<Reduce> reduce61 = {};
+std::vector<Shift> shift62 = {{&term202, &state481}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {{&term202, &state479}};
+std::vector<Reduce> reduce63 = {};
+std::vector<Shift> shift64 = {{&term202, &state477}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term202, &state475}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term202, &state473}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {{&term202, &state471}};
+std::vector<Reduce> reduce67 = {};
+std::vector<Shift> shift68 = {{&term202, &state469}};
+std::vector<Reduce> reduce68 = {};
+std::vector<Shift> shift69 = {{&term202, &state467}};
+std::vector<Reduce> reduce69 = {};
+std::vector<Shift> shift70 = {{&term202, &state465}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {{&term202, &state463}};
+std::vector<Reduce> reduce71 = {};
+std::vector<Shift> shift72 = {{&term202, &state461}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term202, &state459}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term202, &state457}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {{&term202, &state455}};
+std::vector<Reduce> reduce75 = {};
+std::vector<Shift> shift76 = {{&term202, &state453}};
+std::vector<Reduce> reduce76 = {};
+std::vector<Shift> shift77 = {{&term202, &state451}};
+std::vector<Reduce> reduce77 = {};
+std::vector<Shift> shift78 = {{&term202, &state449}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {{&term202, &state447}};
+std::vector<Reduce> reduce79 = {};
+std::vector<Shift> shift80 = {{&term202, &state445}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term202, &state443}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term202, &state441}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {{&term202, &state439}};
+std::vector<Reduce> reduce83 = {};
+std::vector<Shift> shift84 = {{&term202, &state437}};
+std::vector<Reduce> reduce84 = {};
+std::vector<Shift> shift85 = {{&term202, &state435}};
+std::vector<Reduce> reduce85 = {};
+std::vector<Shift> shift86 = {{&term202, &state433}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {{&term202, &state431}};
+std::vector<Reduce> reduce87 = {};
+std::vector<Shift> shift88 = {{&term202, &state429}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term202, &state427}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term202, &state425}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {{&term202, &state423}};
+std::vector<Reduce> reduce91 = {};
+std::vector<Shift> shift92 = {{&term202, &state421}};
+std::vector<Reduce> reduce92 = {};
+std::vector<Shift> shift93 = {{&term202, &state419}};
+std::vector<Reduce> reduce93 = {};
+std::vector<Shift> shift94 = {{&term202, &state417}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {{&term202, &state415}};
+std::vector<Reduce> reduce95 = {};
+std::vector<Shift> shift96 = {{&term202, &state413}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term202, &state411}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term202, &state409}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {{&term202, &state407}};
+std::vector<Reduce> reduce99 = {};
+std::vector<Shift> shift100 = {{&term202, &state405}};
+std::vector<Reduce> reduce100 = {};
+std::vector<Shift> shift101 = {{&term202, &state403}};
+std::vector<Reduce> reduce101 = {};
+std::vector<Shift> shift102 = {{&term202, &state401}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {{&term202, &state399}};
+std::vector<Reduce> reduce103 = {};
+std::vector<Shift> shift104 = {{&term202, &state397}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term202, &state395}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term202, &state393}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {{&term202, &state391}};
+std::vector<Reduce> reduce107 = {};
+std::vector<Shift> shift108 = {{&term202, &state389}};
+std::vector<Reduce> reduce108 = {};
+std::vector<Shift> shift109 = {{&term202, &state387}};
+std::vector<Reduce> reduce109 = {};
+std::vector<Shift> shift110 = {{&term202, &state385}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {{&term202, &state383}};
+std::vector<Reduce> reduce111 = {};
+std::vector<Shift> shift112 = {{&term202, &state381}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term202, &state379}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term202, &state377}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {{&term202, &state375}};
+std::vector<Reduce> reduce115 = {};
+std::vector<Shift> shift116 = {{&term202, &state373}};
+std::vector<Reduce> reduce116 = {};
+std::vector<Shift> shift117 = {{&term202, &state371}};
+std::vector<Reduce> reduce117 = {};
+std::vector<Shift> shift118 = {{&term202, &state369}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {{&term202, &state367}};
+std::vector<Reduce> reduce119 = {};
+std::vector<Shift> shift120 = {{&term202, &state365}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term202, &state363}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term202, &state361}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {{&term202, &state359}};
+std::vector<Reduce> reduce123 = {};
+std::vector<Shift> shift124 = {{&term202, &state357}};
+std::vector<Reduce> reduce124 = {};
+std::vector<Shift> shift125 = {{&term202, &state355}};
+std::vector<Reduce> reduce125 = {};
+std::vector<Shift> shift126 = {{&term202, &state353}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {{&term202, &state351}};
+std::vector<Reduce> reduce127 = {};
+std::vector<Shift> shift128 = {{&term202, &state349}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term202, &state347}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term202, &state345}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {{&term202, &state343}};
+std::vector<Reduce> reduce131 = {};
+std::vector<Shift> shift132 = {{&term202, &state341}};
+std::vector<Reduce> reduce132 = {};
+std::vector<Shift> shift133 = {{&term202, &state339}};
+std::vector<Reduce> reduce133 = {};
+std::vector<Shift> shift134 = {{&term202, &state337}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {{&term202, &state335}};
+std::vector<Reduce> reduce135 = {};
+std::vector<Shift> shift136 = {{&term202, &state333}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term202, &state331}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term202, &state329}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {{&term202, &state327}};
+std::vector<Reduce> reduce139 = {};
+std::vector<Shift> shift140 = {{&term202, &state325}};
+std::vector<Reduce> reduce140 = {};
+std::vector<Shift> shift141 = {{&term202, &state323}};
+std::vector<Reduce> reduce141 = {};
+std::vector<Shift> shift142 = {{&term202, &state321}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {{&term202, &state319}};
+std::vector<Reduce> reduce143 = {};
+std::vector<Shift> shift144 = {{&term202, &state317}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term202, &state315}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term202, &state313}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {{&term202, &state311}};
+std::vector<Reduce> reduce147 = {};
+std::vector<Shift> shift148 = {{&term202, &state309}};
+std::vector<Reduce> reduce148 = {};
+std::vector<Shift> shift149 = {{&term202, &state307}};
+std::vector<Reduce> reduce149 = {};
+std::vector<Shift> shift150 = {{&term202, &state305}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {{&term202, &state303}};
+std::vector<Reduce> reduce151 = {};
+std::vector<Shift> shift152 = {{&term202, &state301}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term202, &state299}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term202, &state297}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {{&term202, &state295}};
+std::vector<Reduce> reduce155 = {};
+std::vector<Shift> shift156 = {{&term202, &state293}};
+std::vector<Reduce> reduce156 = {};
+std::vector<Shift> shift157 = {{&term202, &state291}};
+std::vector<Reduce> reduce157 = {};
+std::vector<Shift> shift158 = {{&term202, &state289}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {{&term202, &state287}};
+std::vector<Reduce> reduce159 = {};
+std::vector<Shift> shift160 = {{&term202, &state285}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term202, &state283}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term202, &state281}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {{&term202, &state279}};
+std::vector<Reduce> reduce163 = {};
+std::vector<Shift> shift164 = {{&term202, &state277}};
+std::vector<Reduce> reduce164 = {};
+std::vector<Shift> shift165 = {{&term202, &state275}};
+std::vector<Reduce> reduce165 = {};
+std::vector<Shift> shift166 = {{&term202, &state273}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {{&term202, &state271}};
+std::vector<Reduce> reduce167 = {};
+std::vector<Shift> shift168 = {{&term202, &state269}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term202, &state267}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term202, &state265}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {{&term202, &state263}};
+std::vector<Reduce> reduce171 = {};
+std::vector<Shift> shift172 = {{&term202, &state261}};
+std::vector<Reduce> reduce172 = {};
+std::vector<Shift> shift173 = {{&term202, &state259}};
+std::vector<Reduce> reduce173 = {};
+std::vector<Shift> shift174 = {{&term202, &state257}};
+std::vector<Reduce> reduce174 = {};
+std::vector<Shift> shift175 = {{&term202, &state255}};
+std::vector<Reduce> reduce175 = {};
+std::vector<Shift> shift176 = {{&term202, &state253}};
+std::vector<Reduce> reduce176 = {};
+std::vector<Shift> shift177 = {{&term202, &state251}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {{&term202, &state249}};
+std::vector<Reduce> reduce178 = {};
+std::vector<Shift> shift179 = {{&term202, &state247}};
+std::vector<Reduce> reduce179 = {};
+std::vector<Shift> shift180 = {{&term202, &state245}};
+std::vector<Reduce> reduce180 = {};
+std::vector<Shift> shift181 = {{&term202, &state243}};
+std::vector<Reduce> reduce181 = {};
+std::vector<Shift> shift182 = {{&term202, &state241}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {{&term202, &state239}};
+std::vector<Reduce> reduce183 = {};
+std::vector<Shift> shift184 = {{&term202, &state237}};
+std::vector<Reduce> reduce184 = {};
+std::vector<Shift> shift185 = {{&term202, &state235}};
+std::vector<Reduce> reduce185 = {};
+std::vector<Shift> shift186 = {{&term202, &state233}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift187 = {{&term202, &state231}};
+std::vector<Reduce> reduce187 = {};
+std::vector<Shift> shift188 = {{&term202, &state229}};
+std::vector<Reduce> reduce188 = {};
+std::vector<Shift> shift189 = {{&term202, &state227}};
+std::vector<Reduce> reduce189 = {};
+std::vector<Shift> shift190 = {{&term202, &state225}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {{&term202, &state223}};
+std::vector<Reduce> reduce191 = {};
+std::vector<Shift> shift192 = {{&term202, &state221}};
+std::vector<Reduce> reduce192 = {};
+std::vector<Shift> shift193 = {{&term202, &state219}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term202, &state217}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {{&term202, &state215}};
+std::vector<Reduce> reduce195 = {};
+std::vector<Shift> shift196 = {{&term202, &state213}};
+std::vector<Reduce> reduce196 = {};
+std::vector<Shift> shift197 = {{&term202, &state211}};
+std::vector<Reduce> reduce197 = {};
+std::vector<Shift> shift198 = {{&term202, &state209}};
+std::vector<Reduce> reduce198 = {};
+std::vector<Shift> shift199 = {{&term202, &state207}};
+std::vector<Reduce> reduce199 = {};
+std::vector<Shift> shift200 = {{&term202, &state205}};
+std::vector<Reduce> reduce200 = {};
+std::vector<Shift> shift201 = {{&term202, &state203}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift202 = {};
+std::vector<Reduce> reduce202 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift203 = {{&term203, &state204}};
+std::vector<Reduce> reduce203 = {};
+std::vector<Shift> shift204 = {};
+std::vector<Reduce> reduce204 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift205 = {{&term203, &state206}};
+std::vector<Reduce> reduce205 = {};
+std::vector<Shift> shift206 = {};
+std::vector<Reduce> reduce206 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift207 = {{&term203, &state208}};
+std::vector<Reduce> reduce207 = {};
+std::vector<Shift> shift208 = {};
+std::vector<Reduce> reduce208 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift209 = {{&term203, &state210}};
+std::vector<Reduce> reduce209 = {};
+std::vector<Shift> shift210 = {};
+std::vector<Reduce> reduce210 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift211 = {{&term203, &state212}};
+std::vector<Reduce> reduce211 = {};
+std::vector<Shift> shift212 = {};
+std::vector<Reduce> reduce212 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift213 = {{&term203, &state214}};
+std::vector<Reduce> reduce213 = {};
+std::vector<Shift> shift214 = {};
+std::vector<Reduce> reduce214 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift215 = {{&term203, &state216}};
+std::vector<Reduce> reduce215 = {};
+std::vector<Shift> shift216 = {};
+std::vector<Reduce> reduce216 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift217 = {{&term203, &state218}};
+std::vector<Reduce> reduce217 = {};
+std::vector<Shift> shift218 = {};
+std::vector<Reduce> reduce218 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift219 = {{&term203, &state220}};
+std::vector<Reduce> reduce219 = {};
+std::vector<Shift> shift220 = {};
+std::vector<Reduce> reduce220 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift221 = {{&term203, &state222}};
+std::vector<Reduce> reduce221 = {};
+std::vector<Shift> shift222 = {};
+std::vector<Reduce> reduce222 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift223 = {{&term203, &state224}};
+std::vector<Reduce> reduce223 = {};
+std::vector<Shift> shift224 = {};
+std::vector<Reduce> reduce224 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift225 = {{&term203, &state226}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift226 = {};
+std::vector<Reduce> reduce226 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift227 = {{&term203, &state228}};
+std::vector<Reduce> reduce227 = {};
+std::vector<Shift> shift228 = {};
+std::vector<Reduce> reduce228 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift229 = {{&term203, &state230}};
+std::vector<Reduce> reduce229 = {};
+std::vector<Shift> shift230 = {};
+std::vector<Reduce> reduce230 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift231 = {{&term203, &state232}};
+std::vector<Reduce> reduce231 = {};
+std::vector<Shift> shift232 = {};
+std::vector<Reduce> reduce232 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift233 = {{&term203, &state234}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {};
+std::vector<Reduce> reduce234 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift235 = {{&term203, &state236}};
+std::vector<Reduce> reduce235 = {};
+std::vector<Shift> shift236 = {};
+std::vector<Reduce> reduce236 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift237 = {{&term203, &state238}};
+std::vector<Reduce> reduce237 = {};
+std::vector<Shift> shift238 = {};
+std::vector<Reduce> reduce238 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift239 = {{&term203, &state240}};
+std::vector<Reduce> reduce239 = {};
+std::vector<Shift> shift240 = {};
+std::vector<Reduce> reduce240 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift241 = {{&term203, &state242}};
+std::vector<Reduce> reduce241 = {};
+std::vector<Shift> shift242 = {};
+std::vector<Reduce> reduce242 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift243 = {{&term203, &state244}};
+std::vector<Reduce> reduce243 = {};
+std::vector<Shift> shift244 = {};
+std::vector<Reduce> reduce244 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift245 = {{&term203, &state246}};
+std::vector<Reduce> reduce245 = {};
+std::vector<Shift> shift246 = {};
+std::vector<Reduce> reduce246 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift247 = {{&term203, &state248}};
+std::vector<Reduce> reduce247 = {};
+std::vector<Shift> shift248 = {};
+std::vector<Reduce> reduce248 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift249 = {{&term203, &state250}};
+std::vector<Reduce> reduce249 = {};
+std::vector<Shift> shift250 = {};
+std::vector<Reduce> reduce250 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift251 = {{&term203, &state252}};
+std::vector<Reduce> reduce251 = {};
+std::vector<Shift> shift252 = {};
+std::vector<Reduce> reduce252 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift253 = {{&term203, &state254}};
+std::vector<Reduce> reduce253 = {};
+std::vector<Shift> shift254 = {};
+std::vector<Reduce> reduce254 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift255 = {{&term203, &state256}};
+std::vector<Reduce> reduce255 = {};
+std::vector<Shift> shift256 = {};
+std::vector<Reduce> reduce256 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift257 = {{&term203, &state258}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {};
+std::vector<Reduce> reduce258 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift259 = {{&term203, &state260}};
+std::vector<Reduce> reduce259 = {};
+std::vector<Shift> shift260 = {};
+std::vector<Reduce> reduce260 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift261 = {{&term203, &state262}};
+std::vector<Reduce> reduce261 = {};
+std::vector<Shift> shift262 = {};
+std::vector<Reduce> reduce262 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift263 = {{&term203, &state264}};
+std::vector<Reduce> reduce263 = {};
+std::vector<Shift> shift264 = {};
+std::vector<Reduce> reduce264 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift265 = {{&term203, &state266}};
+std::vector<Reduce> reduce265 = {};
+std::vector<Shift> shift266 = {};
+std::vector<Reduce> reduce266 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift267 = {{&term203, &state268}};
+std::vector<Reduce> reduce267 = {};
+std::vector<Shift> shift268 = {};
+std::vector<Reduce> reduce268 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift269 = {{&term203, &state270}};
+std::vector<Reduce> reduce269 = {};
+std::vector<Shift> shift270 = {};
+std::vector<Reduce> reduce270 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift271 = {{&term203, &state272}};
+std::vector<Reduce> reduce271 = {};
+std::vector<Shift> shift272 = {};
+std::vector<Reduce> reduce272 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift273 = {{&term203, &state274}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {};
+std::vector<Reduce> reduce274 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift275 = {{&term203, &state276}};
+std::vector<Reduce> reduce275 = {};
+std::vector<Shift> shift276 = {};
+std::vector<Reduce> reduce276 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift277 = {{&term203, &state278}};
+std::vector<Reduce> reduce277 = {};
+std::vector<Shift> shift278 = {};
+std::vector<Reduce> reduce278 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift279 = {{&term203, &state280}};
+std::vector<Reduce> reduce279 = {};
+std::vector<Shift> shift280 = {};
+std::vector<Reduce> reduce280 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift281 = {{&term203, &state282}};
+std::vector<Reduce> reduce281 = {};
+std::vector<Shift> shift282 = {};
+std::vector<Reduce> reduce282 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift283 = {{&term203, &state284}};
+std::vector<Reduce> reduce283 = {};
+std::vector<Shift> shift284 = {};
+std::vector<Reduce> reduce284 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift285 = {{&term203, &state286}};
+std::vector<Reduce> reduce285 = {};
+std::vector<Shift> shift286 = {};
+std::vector<Reduce> reduce286 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift287 = {{&term203, &state288}};
+std::vector<Reduce> reduce287 = {};
+std::vector<Shift> shift288 = {};
+std::vector<Reduce> reduce288 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift289 = {{&term203, &state290}};
+std::vector<Reduce> reduce289 = {};
+std::vector<Shift> shift290 = {};
+std::vector<Reduce> reduce290 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift291 = {{&term203, &state292}};
+std::vector<Reduce> reduce291 = {};
+std::vector<Shift> shift292 = {};
+std::vector<Reduce> reduce292 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift293 = {{&term203, &state294}};
+std::vector<Reduce> reduce293 = {};
+std::vector<Shift> shift294 = {};
+std::vector<Reduce> reduce294 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift295 = {{&term203, &state296}};
+std::vector<Reduce> reduce295 = {};
+std::vector<Shift> shift296 = {};
+std::vector<Reduce> reduce296 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift297 = {{&term203, &state298}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {};
+std::vector<Reduce> reduce298 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift299 = {{&term203, &state300}};
+std::vector<Reduce> reduce299 = {};
+std::vector<Shift> shift300 = {};
+std::vector<Reduce> reduce300 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift301 = {{&term203, &state302}};
+std::vector<Reduce> reduce301 = {};
+std::vector<Shift> shift302 = {};
+std::vector<Reduce> reduce302 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift303 = {{&term203, &state304}};
+std::vector<Reduce> reduce303 = {};
+std::vector<Shift> shift304 = {};
+std::vector<Reduce> reduce304 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift305 = {{&term203, &state306}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {};
+std::vector<Reduce> reduce306 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift307 = {{&term203, &state308}};
+std::vector<Reduce> reduce307 = {};
+std::vector<Shift> shift308 = {};
+std::vector<Reduce> reduce308 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift309 = {{&term203, &state310}};
+std::vector<Reduce> reduce309 = {};
+std::vector<Shift> shift310 = {};
+std::vector<Reduce> reduce310 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift311 = {{&term203, &state312}};
+std::vector<Reduce> reduce311 = {};
+std::vector<Shift> shift312 = {};
+std::vector<Reduce> reduce312 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift313 = {{&term203, &state314}};
+std::vector<Reduce> reduce313 = {};
+std::vector<Shift> shift314 = {};
+std::vector<Reduce> reduce314 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift315 = {{&term203, &state316}};
+std::vector<Reduce> reduce315 = {};
+std::vector<Shift> shift316 = {};
+std::vector<Reduce> reduce316 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift317 = {{&term203, &state318}};
+std::vector<Reduce> reduce317 = {};
+std::vector<Shift> shift318 = {};
+std::vector<Reduce> reduce318 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift319 = {{&term203, &state320}};
+std::vector<Reduce> reduce319 = {};
+std::vector<Shift> shift320 = {};
+std::vector<Reduce> reduce320 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift321 = {{&term203, &state322}};
+std::vector<Reduce> reduce321 = {};
+std::vector<Shift> shift322 = {};
+std::vector<Reduce> reduce322 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift323 = {{&term203, &state324}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {};
+std::vector<Reduce> reduce324 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift325 = {{&term203, &state326}};
+std::vector<Reduce> reduce325 = {};
+std::vector<Shift> shift326 = {};
+std::vector<Reduce> reduce326 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift327 = {{&term203, &state328}};
+std::vector<Reduce> reduce327 = {};
+std::vector<Shift> shift328 = {};
+std::vector<Reduce> reduce328 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift329 = {{&term203, &state330}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift330 = {};
+std::vector<Reduce> reduce330 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift331 = {{&term203, &state332}};
+std::vector<Reduce> reduce331 = {};
+std::vector<Shift> shift332 = {};
+std::vector<Reduce> reduce332 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift333 = {{&term203, &state334}};
+std::vector<Reduce> reduce333 = {};
+std::vector<Shift> shift334 = {};
+std::vector<Reduce> reduce334 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift335 = {{&term203, &state336}};
+std::vector<Reduce> reduce335 = {};
+std::vector<Shift> shift336 = {};
+std::vector<Reduce> reduce336 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift337 = {{&term203, &state338}};
+std::vector<Reduce> reduce337 = {};
+std::vector<Shift> shift338 = {};
+std::vector<Reduce> reduce338 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift339 = {{&term203, &state340}};
+std::vector<Reduce> reduce339 = {};
+std::vector<Shift> shift340 = {};
+std::vector<Reduce> reduce340 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift341 = {{&term203, &state342}};
+std::vector<Reduce> reduce341 = {};
+std::vector<Shift> shift342 = {};
+std::vector<Reduce> reduce342 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift343 = {{&term203, &state344}};
+std::vector<Reduce> reduce343 = {};
+std::vector<Shift> shift344 = {};
+std::vector<Reduce> reduce344 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift345 = {{&term203, &state346}};
+std::vector<Reduce> reduce345 = {};
+std::vector<Shift> shift346 = {};
+std::vector<Reduce> reduce346 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift347 = {{&term203, &state348}};
+std::vector<Reduce> reduce347 = {};
+std::vector<Shift> shift348 = {};
+std::vector<Reduce> reduce348 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift349 = {{&term203, &state350}};
+std::vector<Reduce> reduce349 = {};
+std::vector<Shift> shift350 = {};
+std::vector<Reduce> reduce350 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift351 = {{&term203, &state352}};
+std::vector<Reduce> reduce351 = {};
+std::vector<Shift> shift352 = {};
+std::vector<Reduce> reduce352 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift353 = {{&term203, &state354}};
+std::vector<Reduce> reduce353 = {};
+std::vector<Shift> shift354 = {};
+std::vector<Reduce> reduce354 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift355 = {{&term203, &state356}};
+std::vector<Reduce> reduce355 = {};
+std::vector<Shift> shift356 = {};
+std::vector<Reduce> reduce356 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift357 = {{&term203, &state358}};
+std::vector<Reduce> reduce357 = {};
+std::vector<Shift> shift358 = {};
+std::vector<Reduce> reduce358 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift359 = {{&term203, &state360}};
+std::vector<Reduce> reduce359 = {};
+std::vector<Shift> shift360 = {};
+std::vector<Reduce> reduce360 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift361 = {{&term203, &state362}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift362 = {};
+std::vector<Reduce> reduce362 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift363 = {{&term203, &state364}};
+std::vector<Reduce> reduce363 = {};
+std::vector<Shift> shift364 = {};
+std::vector<Reduce> reduce364 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift365 = {{&term203, &state366}};
+std::vector<Reduce> reduce365 = {};
+std::vector<Shift> shift366 = {};
+std::vector<Reduce> reduce366 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift367 = {{&term203, &state368}};
+std::vector<Reduce> reduce367 = {};
+std::vector<Shift> shift368 = {};
+std::vector<Reduce> reduce368 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift369 = {{&term203, &state370}};
+std::vector<Reduce> reduce369 = {};
+std::vector<Shift> shift370 = {};
+std::vector<Reduce> reduce370 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift371 = {{&term203, &state372}};
+std::vector<Reduce> reduce371 = {};
+std::vector<Shift> shift372 = {};
+std::vector<Reduce> reduce372 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift373 = {{&term203, &state374}};
+std::vector<Reduce> reduce373 = {};
+std::vector<Shift> shift374 = {};
+std::vector<Reduce> reduce374 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift375 = {{&term203, &state376}};
+std::vector<Reduce> reduce375 = {};
+std::vector<Shift> shift376 = {};
+std::vector<Reduce> reduce376 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift377 = {{&term203, &state378}};
+std::vector<Reduce> reduce377 = {};
+std::vector<Shift> shift378 = {};
+std::vector<Reduce> reduce378 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift379 = {{&term203, &state380}};
+std::vector<Reduce> reduce379 = {};
+std::vector<Shift> shift380 = {};
+std::vector<Reduce> reduce380 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift381 = {{&term203, &state382}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift382 = {};
+std::vector<Reduce> reduce382 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift383 = {{&term203, &state384}};
+std::vector<Reduce> reduce383 = {};
+std::vector<Shift> shift384 = {};
+std::vector<Reduce> reduce384 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift385 = {{&term203, &state386}};
+std::vector<Reduce> reduce385 = {};
+std::vector<Shift> shift386 = {};
+std::vector<Reduce> reduce386 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift387 = {{&term203, &state388}};
+std::vector<Reduce> reduce387 = {};
+std::vector<Shift> shift388 = {};
+std::vector<Reduce> reduce388 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift389 = {{&term203, &state390}};
+std::vector<Reduce> reduce389 = {};
+std::vector<Shift> shift390 = {};
+std::vector<Reduce> reduce390 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift391 = {{&term203, &state392}};
+std::vector<Reduce> reduce391 = {};
+std::vector<Shift> shift392 = {};
+std::vector<Reduce> reduce392 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift393 = {{&term203, &state394}};
+std::vector<Reduce> reduce393 = {};
+std::vector<Shift> shift394 = {};
+std::vector<Reduce> reduce394 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift395 = {{&term203, &state396}};
+std::vector<Reduce> reduce395 = {};
+std::vector<Shift> shift396 = {};
+std::vector<Reduce> reduce396 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift397 = {{&term203, &state398}};
+std::vector<Reduce> reduce397 = {};
+std::vector<Shift> shift398 = {};
+std::vector<Reduce> reduce398 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift399 = {{&term203, &state400}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift400 = {};
+std::vector<Reduce> reduce400 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift401 = {{&term203, &state402}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {};
+std::vector<Reduce> reduce402 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift403 = {{&term203, &state404}};
+std::vector<Reduce> reduce403 = {};
+std::vector<Shift> shift404 = {};
+std::vector<Reduce> reduce404 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift405 = {{&term203, &state406}};
+std::vector<Reduce> reduce405 = {};
+std::vector<Shift> shift406 = {};
+std::vector<Reduce> reduce406 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift407 = {{&term203, &state408}};
+std::vector<Reduce> reduce407 = {};
+std::vector<Shift> shift408 = {};
+std::vector<Reduce> reduce408 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift409 = {{&term203, &state410}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift410 = {};
+std::vector<Reduce> reduce410 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift411 = {{&term203, &state412}};
+std::vector<Reduce> reduce411 = {};
+std::vector<Shift> shift412 = {};
+std::vector<Reduce> reduce412 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift413 = {{&term203, &state414}};
+std::vector<Reduce> reduce413 = {};
+std::vector<Shift> shift414 = {};
+std::vector<Reduce> reduce414 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift415 = {{&term203, &state416}};
+std::vector<Reduce> reduce415 = {};
+std::vector<Shift> shift416 = {};
+std::vector<Reduce> reduce416 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift417 = {{&term203, &state418}};
+std::vector<Reduce> reduce417 = {};
+std::vector<Shift> shift418 = {};
+std::vector<Reduce> reduce418 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift419 = {{&term203, &state420}};
+std::vector<Reduce> reduce419 = {};
+std::vector<Shift> shift420 = {};
+std::vector<Reduce> reduce420 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift421 = {{&term203, &state422}};
+std::vector<Reduce> reduce421 = {};
+std::vector<Shift> shift422 = {};
+std::vector<Reduce> reduce422 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift423 = {{&term203, &state424}};
+std::vector<Reduce> reduce423 = {};
+std::vector<Shift> shift424 = {};
+std::vector<Reduce> reduce424 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift425 = {{&term203, &state426}};
+std::vector<Reduce> reduce425 = {};
+std::vector<Shift> shift426 = {};
+std::vector<Reduce> reduce426 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift427 = {{&term203, &state428}};
+std::vector<Reduce> reduce427 = {};
+std::vector<Shift> shift428 = {};
+std::vector<Reduce> reduce428 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift429 = {{&term203, &state430}};
+std::vector<Reduce> reduce429 = {};
+std::vector<Shift> shift430 = {};
+std::vector<Reduce> reduce430 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift431 = {{&term203, &state432}};
+std::vector<Reduce> reduce431 = {};
+std::vector<Shift> shift432 = {};
+std::vector<Reduce> reduce432 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift433 = {{&term203, &state434}};
+std::vector<Reduce> reduce433 = {};
+std::vector<Shift> shift434 = {};
+std::vector<Reduce> reduce434 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift435 = {{&term203, &state436}};
+std::vector<Reduce> reduce435 = {};
+std::vector<Shift> shift436 = {};
+std::vector<Reduce> reduce436 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift437 = {{&term203, &state438}};
+std::vector<Reduce> reduce437 = {};
+std::vector<Shift> shift438 = {};
+std::vector<Reduce> reduce438 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift439 = {{&term203, &state440}};
+std::vector<Reduce> reduce439 = {};
+std::vector<Shift> shift440 = {};
+std::vector<Reduce> reduce440 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift441 = {{&term203, &state442}};
+std::vector<Reduce> reduce441 = {};
+std::vector<Shift> shift442 = {};
+std::vector<Reduce> reduce442 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift443 = {{&term203, &state444}};
+std::vector<Reduce> reduce443 = {};
+std::vector<Shift> shift444 = {};
+std::vector<Reduce> reduce444 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift445 = {{&term203, &state446}};
+std::vector<Reduce> reduce445 = {};
+std::vector<Shift> shift446 = {};
+std::vector<Reduce> reduce446 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift447 = {{&term203, &state448}};
+std::vector<Reduce> reduce447 = {};
+std::vector<Shift> shift448 = {};
+std::vector<Reduce> reduce448 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift449 = {{&term203, &state450}};
+std::vector<Reduce> reduce449 = {};
+std::vector<Shift> shift450 = {};
+std::vector<Reduce> reduce450 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift451 = {{&term203, &state452}};
+std::vector<Reduce> reduce451 = {};
+std::vector<Shift> shift452 = {};
+std::vector<Reduce> reduce452 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift453 = {{&term203, &state454}};
+std::vector<Reduce> reduce453 = {};
+std::vector<Shift> shift454 = {};
+std::vector<Reduce> reduce454 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift455 = {{&term203, &state456}};
+std::vector<Reduce> reduce455 = {};
+std::vector<Shift> shift456 = {};
+std::vector<Reduce> reduce456 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift457 = {{&term203, &state458}};
+std::vector<Reduce> reduce457 = {};
+std::vector<Shift> shift458 = {};
+std::vector<Reduce> reduce458 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift459 = {{&term203, &state460}};
+std::vector<Reduce> reduce459 = {};
+std::vector<Shift> shift460 = {};
+std::vector<Reduce> reduce460 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift461 = {{&term203, &state462}};
+std::vector<Reduce> reduce461 = {};
+std::vector<Shift> shift462 = {};
+std::vector<Reduce> reduce462 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift463 = {{&term203, &state464}};
+std::vector<Reduce> reduce463 = {};
+std::vector<Shift> shift464 = {};
+std::vector<Reduce> reduce464 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift465 = {{&term203, &state466}};
+std::vector<Reduce> reduce465 = {};
+std::vector<Shift> shift466 = {};
+std::vector<Reduce> reduce466 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift467 = {{&term203, &state468}};
+std::vector<Reduce> reduce467 = {};
+std::vector<Shift> shift468 = {};
+std::vector<Reduce> reduce468 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift469 = {{&term203, &state470}};
+std::vector<Reduce> reduce469 = {};
+std::vector<Shift> shift470 = {};
+std::vector<Reduce> reduce470 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift471 = {{&term203, &state472}};
+std::vector<Reduce> reduce471 = {};
+std::vector<Shift> shift472 = {};
+std::vector<Reduce> reduce472 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift473 = {{&term203, &state474}};
+std::vector<Reduce> reduce473 = {};
+std::vector<Shift> shift474 = {};
+std::vector<Reduce> reduce474 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift475 = {{&term203, &state476}};
+std::vector<Reduce> reduce475 = {};
+std::vector<Shift> shift476 = {};
+std::vector<Reduce> reduce476 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift477 = {{&term203, &state478}};
+std::vector<Reduce> reduce477 = {};
+std::vector<Shift> shift478 = {};
+std::vector<Reduce> reduce478 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift479 = {{&term203, &state480}};
+std::vector<Reduce> reduce479 = {};
+std::vector<Shift> shift480 = {};
+std::vector<Reduce> reduce480 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift481 = {{&term203, &state482}};
+std::vector<Reduce> reduce481 = {};
+std::vector<Shift> shift482 = {};
+std::vector<Reduce> reduce482 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift483 = {{&term203, &state484}};
+std::vector<Reduce> reduce483 = {};
+std::vector<Shift> shift484 = {};
+std::vector<Reduce> reduce484 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift485 = {{&term203, &state486}};
+std::vector<Reduce> reduce485 = {};
+std::vector<Shift> shift486 = {};
+std::vector<Reduce> reduce486 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift487 = {{&term203, &state488}};
+std::vector<Reduce> reduce487 = {};
+std::vector<Shift> shift488 = {};
+std::vector<Reduce> reduce488 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift489 = {{&term203, &state490}};
+std::vector<Reduce> reduce489 = {};
+std::vector<Shift> shift490 = {};
+std::vector<Reduce> reduce490 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift491 = {{&term203, &state492}};
+std::vector<Reduce> reduce491 = {};
+std::vector<Shift> shift492 = {};
+std::vector<Reduce> reduce492 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift493 = {{&term203, &state494}};
+std::vector<Reduce> reduce493 = {};
+std::vector<Shift> shift494 = {};
+std::vector<Reduce> reduce494 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift495 = {{&term203, &state496}};
+std::vector<Reduce> reduce495 = {};
+std::vector<Shift> shift496 = {};
+std::vector<Reduce> reduce496 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift497 = {{&term203, &state498}};
+std::vector<Reduce> reduce497 = {};
+std::vector<Shift> shift498 = {};
+std::vector<Reduce> reduce498 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift499 = {{&term203, &state500}};
+std::vector<Reduce> reduce499 = {};
+std::vector<Shift> shift500 = {};
+std::vector<Reduce> reduce500 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift501 = {{&term203, &state502}};
+std::vector<Reduce> reduce501 = {};
+std::vector<Shift> shift502 = {};
+std::vector<Reduce> reduce502 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift503 = {{&term203, &state504}};
+std::vector<Reduce> reduce503 = {};
+std::vector<Shift> shift504 = {};
+std::vector<Reduce> reduce504 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift505 = {{&term203, &state506}};
+std::vector<Reduce> reduce505 = {};
+std::vector<Shift> shift506 = {};
+std::vector<Reduce> reduce506 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift507 = {{&term203, &state508}};
+std::vector<Reduce> reduce507 = {};
+std::vector<Shift> shift508 = {};
+std::vector<Reduce> reduce508 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift509 = {{&term203, &state510}};
+std::vector<Reduce> reduce509 = {};
+std::vector<Shift> shift510 = {};
+std::vector<Reduce> reduce510 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift511 = {{&term203, &state512}};
+std::vector<Reduce> reduce511 = {};
+std::vector<Shift> shift512 = {};
+std::vector<Reduce> reduce512 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift513 = {{&term203, &state514}};
+std::vector<Reduce> reduce513 = {};
+std::vector<Shift> shift514 = {};
+std::vector<Reduce> reduce514 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift515 = {{&term203, &state516}};
+std::vector<Reduce> reduce515 = {};
+std::vector<Shift> shift516 = {};
+std::vector<Reduce> reduce516 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift517 = {{&term203, &state518}};
+std::vector<Reduce> reduce517 = {};
+std::vector<Shift> shift518 = {};
+std::vector<Reduce> reduce518 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift519 = {{&term203, &state520}};
+std::vector<Reduce> reduce519 = {};
+std::vector<Shift> shift520 = {};
+std::vector<Reduce> reduce520 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift521 = {{&term203, &state522}};
+std::vector<Reduce> reduce521 = {};
+std::vector<Shift> shift522 = {};
+std::vector<Reduce> reduce522 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift523 = {{&term203, &state524}};
+std::vector<Reduce> reduce523 = {};
+std::vector<Shift> shift524 = {};
+std::vector<Reduce> reduce524 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift525 = {{&term203, &state526}};
+std::vector<Reduce> reduce525 = {};
+std::vector<Shift> shift526 = {};
+std::vector<Reduce> reduce526 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift527 = {{&term203, &state528}};
+std::vector<Reduce> reduce527 = {};
+std::vector<Shift> shift528 = {};
+std::vector<Reduce> reduce528 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift529 = {{&term203, &state530}};
+std::vector<Reduce> reduce529 = {};
+std::vector<Shift> shift530 = {};
+std::vector<Reduce> reduce530 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift531 = {{&term203, &state532}};
+std::vector<Reduce> reduce531 = {};
+std::vector<Shift> shift532 = {};
+std::vector<Reduce> reduce532 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift533 = {{&term203, &state534}};
+std::vector<Reduce> reduce533 = {};
+std::vector<Shift> shift534 = {};
+std::vector<Reduce> reduce534 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift535 = {{&term203, &state536}};
+std::vector<Reduce> reduce535 = {};
+std::vector<Shift> shift536 = {};
+std::vector<Reduce> reduce536 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift537 = {{&term203, &state538}};
+std::vector<Reduce> reduce537 = {};
+std::vector<Shift> shift538 = {};
+std::vector<Reduce> reduce538 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift539 = {{&term203, &state540}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {};
+std::vector<Reduce> reduce540 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift541 = {{&term203, &state542}};
+std::vector<Reduce> reduce541 = {};
+std::vector<Shift> shift542 = {};
+std::vector<Reduce> reduce542 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift543 = {{&term203, &state544}};
+std::vector<Reduce> reduce543 = {};
+std::vector<Shift> shift544 = {};
+std::vector<Reduce> reduce544 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift545 = {{&term203, &state546}};
+std::vector<Reduce> reduce545 = {};
+std::vector<Shift> shift546 = {};
+std::vector<Reduce> reduce546 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift547 = {{&term203, &state548}};
+std::vector<Reduce> reduce547 = {};
+std::vector<Shift> shift548 = {};
+std::vector<Reduce> reduce548 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift549 = {{&term203, &state550}};
+std::vector<Reduce> reduce549 = {};
+std::vector<Shift> shift550 = {};
+std::vector<Reduce> reduce550 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift551 = {{&term203, &state552}};
+std::vector<Reduce> reduce551 = {};
+std::vector<Shift> shift552 = {};
+std::vector<Reduce> reduce552 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift553 = {{&term203, &state554}};
+std::vector<Reduce> reduce553 = {};
+std::vector<Shift> shift554 = {};
+std::vector<Reduce> reduce554 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift555 = {{&term203, &state556}};
+std::vector<Reduce> reduce555 = {};
+std::vector<Shift> shift556 = {};
+std::vector<Reduce> reduce556 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift557 = {{&term203, &state558}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift558 = {};
+std::vector<Reduce> reduce558 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift559 = {{&term203, &state560}};
+std::vector<Reduce> reduce559 = {};
+std::vector<Shift> shift560 = {};
+std::vector<Reduce> reduce560 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift561 = {{&term203, &state562}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift562 = {};
+std::vector<Reduce> reduce562 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift563 = {{&term203, &state564}};
+std::vector<Reduce> reduce563 = {};
+std::vector<Shift> shift564 = {};
+std::vector<Reduce> reduce564 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift565 = {{&term203, &state566}};
+std::vector<Reduce> reduce565 = {};
+std::vector<Shift> shift566 = {};
+std::vector<Reduce> reduce566 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift567 = {{&term203, &state568}};
+std::vector<Reduce> reduce567 = {};
+std::vector<Shift> shift568 = {};
+std::vector<Reduce> reduce568 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift569 = {{&term203, &state570}};
+std::vector<Reduce> reduce569 = {};
+std::vector<Shift> shift570 = {};
+std::vector<Reduce> reduce570 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift571 = {{&term203, &state572}};
+std::vector<Reduce> reduce571 = {};
+std::vector<Shift> shift572 = {};
+std::vector<Reduce> reduce572 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift573 = {{&term203, &state574}};
+std::vector<Reduce> reduce573 = {};
+std::vector<Shift> shift574 = {};
+std::vector<Reduce> reduce574 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift575 = {{&term203, &state576}};
+std::vector<Reduce> reduce575 = {};
+std::vector<Shift> shift576 = {};
+std::vector<Reduce> reduce576 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift577 = {{&term203, &state578}};
+std::vector<Reduce> reduce577 = {};
+std::vector<Shift> shift578 = {};
+std::vector<Reduce> reduce578 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift579 = {{&term203, &state580}};
+std::vector<Reduce> reduce579 = {};
+std::vector<Shift> shift580 = {};
+std::vector<Reduce> reduce580 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift581 = {{&term203, &state582}};
+std::vector<Reduce> reduce581 = {};
+std::vector<Shift> shift582 = {};
+std::vector<Reduce> reduce582 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift583 = {{&term203, &state584}};
+std::vector<Reduce> reduce583 = {};
+std::vector<Shift> shift584 = {};
+std::vector<Reduce> reduce584 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift585 = {{&term203, &state586}};
+std::vector<Reduce> reduce585 = {};
+std::vector<Shift> shift586 = {};
+std::vector<Reduce> reduce586 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift587 = {{&term203, &state588}};
+std::vector<Reduce> reduce587 = {};
+std::vector<Shift> shift588 = {};
+std::vector<Reduce> reduce588 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift589 = {{&term203, &state590}};
+std::vector<Reduce> reduce589 = {};
+std::vector<Shift> shift590 = {};
+std::vector<Reduce> reduce590 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift591 = {{&term203, &state592}};
+std::vector<Reduce> reduce591 = {};
+std::vector<Shift> shift592 = {};
+std::vector<Reduce> reduce592 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift593 = {{&term203, &state594}};
+std::vector<Reduce> reduce593 = {};
+std::vector<Shift> shift594 = {};
+std::vector<Reduce> reduce594 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift595 = {{&term203, &state596}};
+std::vector<Reduce> reduce595 = {};
+std::vector<Shift> shift596 = {};
+std::vector<Reduce> reduce596 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift597 = {{&term203, &state598}};
+std::vector<Reduce> reduce597 = {};
+std::vector<Shift> shift598 = {};
+std::vector<Reduce> reduce598 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift599 = {{&term203, &state600}};
+std::vector<Reduce> reduce599 = {};
+std::vector<Shift> shift600 = {};
+std::vector<Reduce> reduce600 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift601 = {{&term203, &state602}};
+std::vector<Reduce> reduce601 = {};
+std::vector<Shift> shift602 = {};
+std::vector<Reduce> reduce602 = {{nullptr, &rule3, false}};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state202}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift40, &reduce40, nullptr};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift48, &reduce48, nullptr};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift72, &reduce72, nullptr};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift80, &reduce80, nullptr};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift88, &reduce88, nullptr};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift96, &reduce96, nullptr};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift104, &reduce104, nullptr};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift120, &reduce120, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift128, &reduce128, nullptr};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift136, &reduce136, nullptr};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift140, &reduce140, nullptr};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift144, &reduce144, nullptr};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift146, &reduce146, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift148, &reduce148, nullptr};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift150, &reduce150, nullptr};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift152, &reduce152, nullptr};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift154, &reduce154, nullptr};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift158, &reduce158, nullptr};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift160, &reduce160, nullptr};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift162, &reduce162, nullptr};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift166, &reduce166, nullptr};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift168, &reduce168, nullptr};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift172, &reduce172, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift176, &reduce176, nullptr};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift180, &reduce180, nullptr};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift184, &reduce184, nullptr};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift188, &reduce188, nullptr};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift192, &reduce192, nullptr};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift200, &reduce200, nullptr};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift202, &reduce202, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift208, &reduce208, nullptr};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, nullptr};
+State state216 = {&shift216, &reduce216, nullptr};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, nullptr};
+State state224 = {&shift224, &reduce224, nullptr};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, nullptr};
+State state232 = {&shift232, &reduce232, nullptr};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, nullptr};
+State state240 = {&shift240, &reduce240, nullptr};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, nullptr};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift263, &reduce263, nullptr};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift268, &reduce268, nullptr};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift272, &reduce272, nullptr};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift276, &reduce276, nullptr};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift278, &reduce278, nullptr};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift280, &reduce280, nullptr};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, nullptr};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift286, &reduce286, nullptr};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift288, &reduce288, nullptr};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift290, &reduce290, nullptr};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift296, &reduce296, nullptr};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift302, &reduce302, nullptr};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift304, &reduce304, nullptr};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift308, &reduce308, nullptr};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift312, &reduce312, nullptr};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift320, &reduce320, nullptr};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift322, &reduce322, nullptr};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift326, &reduce326, nullptr};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift328, &reduce328, nullptr};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift330, &reduce330, nullptr};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift336, &reduce336, nullptr};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, nullptr};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift340, &reduce340, nullptr};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift344, &reduce344, nullptr};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift352, &reduce352, nullptr};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift354, &reduce354, nullptr};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift356, &reduce356, nullptr};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift358, &reduce358, nullptr};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift360, &reduce360, nullptr};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift362, &reduce362, nullptr};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift364, &reduce364, nullptr};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift367, &reduce367, nullptr};
+State state368 = {&shift368, &reduce368, nullptr};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift372, &reduce372, nullptr};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift374, &reduce374, nullptr};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift376, &reduce376, nullptr};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift378, &reduce378, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift380, &reduce380, nullptr};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift382, &reduce382, nullptr};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift384, &reduce384, nullptr};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift392, &reduce392, nullptr};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift394, &reduce394, nullptr};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift399, &reduce399, nullptr};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift403, &reduce403, nullptr};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift407, &reduce407, nullptr};
+State state408 = {&shift408, &reduce408, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift412, &reduce412, nullptr};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift416, &reduce416, nullptr};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, nullptr};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift424, &reduce424, nullptr};
+State state425 = {&shift425, &reduce425, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift430, &reduce430, nullptr};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift432, &reduce432, nullptr};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift434, &reduce434, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, nullptr};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift439, &reduce439, nullptr};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift443, &reduce443, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, nullptr};
+State state447 = {&shift447, &reduce447, nullptr};
+State state448 = {&shift448, &reduce448, nullptr};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, nullptr};
+State state456 = {&shift456, &reduce456, nullptr};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, nullptr};
+State state464 = {&shift464, &reduce464, nullptr};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift471, &reduce471, nullptr};
+State state472 = {&shift472, &reduce472, nullptr};
+State state473 = {&shift473, &reduce473, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, nullptr};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift484, &reduce484, nullptr};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift488, &reduce488, nullptr};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift497, &reduce497, nullptr};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift502, &reduce502, nullptr};
+State state503 = {&shift503, &reduce503, nullptr};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift511, &reduce511, nullptr};
+State state512 = {&shift512, &reduce512, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift515, &reduce515, nullptr};
+State state516 = {&shift516, &reduce516, nullptr};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift520, &reduce520, nullptr};
+State state521 = {&shift521, &reduce521, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift523, &reduce523, nullptr};
+State state524 = {&shift524, &reduce524, nullptr};
+State state525 = {&shift525, &reduce525, nullptr};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift528, &reduce528, nullptr};
+State state529 = {&shift529, &reduce529, nullptr};
+State state530 = {&shift530, &reduce530, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift532, &reduce532, nullptr};
+State state533 = {&shift533, &reduce533, nullptr};
+State state534 = {&shift534, &reduce534, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift536, &reduce536, nullptr};
+State state537 = {&shift537, &reduce537, nullptr};
+State state538 = {&shift538, &reduce538, nullptr};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift542, &reduce542, nullptr};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift545, &reduce545, nullptr};
+State state546 = {&shift546, &reduce546, nullptr};
+State state547 = {&shift547, &reduce547, nullptr};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift550, &reduce550, nullptr};
+State state551 = {&shift551, &reduce551, nullptr};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift554, &reduce554, nullptr};
+State state555 = {&shift555, &reduce555, nullptr};
+State state556 = {&shift556, &reduce556, nullptr};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift558, &reduce558, nullptr};
+State state559 = {&shift559, &reduce559, nullptr};
+State state560 = {&shift560, &reduce560, nullptr};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift562, &reduce562, nullptr};
+State state563 = {&shift563, &reduce563, nullptr};
+State state564 = {&shift564, &reduce564, nullptr};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift568, &reduce568, nullptr};
+State state569 = {&shift569, &reduce569, nullptr};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift572, &reduce572, nullptr};
+State state573 = {&shift573, &reduce573, nullptr};
+State state574 = {&shift574, &reduce574, nullptr};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift576, &reduce576, nullptr};
+State state577 = {&shift577, &reduce577, nullptr};
+State state578 = {&shift578, &reduce578, nullptr};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift580, &reduce580, nullptr};
+State state581 = {&shift581, &reduce581, nullptr};
+State state582 = {&shift582, &reduce582, nullptr};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift584, &reduce584, nullptr};
+State state585 = {&shift585, &reduce585, nullptr};
+State state586 = {&shift586, &reduce586, nullptr};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift588, &reduce588, nullptr};
+State state589 = {&shift589, &reduce589, nullptr};
+State state590 = {&shift590, &reduce590, nullptr};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift592, &reduce592, nullptr};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift594, &reduce594, nullptr};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift596, &reduce596, nullptr};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift598, &reduce598, nullptr};
+State state599 = {&shift599, &reduce599, nullptr};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift601, &reduce601, nullptr};
+State state602 = {&shift602, &reduce602, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,14097 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ka", false, 0};
+Symbol term1 = {"kb", false, 1};
+Symbol term2 = {"kc", false, 2};
+Symbol term3 = {"kd", false, 3};
+Symbol term4 = {"ke", false, 4};
+Symbol term5 = {"kf", false, 5};
+Symbol term6 = {"kg", false, 6};
+Symbol term7 = {"kh", false, 7};
+Symbol term8 = {"ki", false, 8};
+Symbol term9 = {"kj", false, 9};
+Symbol term10 = {"kk", false, 10};
+Symbol term11 = {"kl", false, 11};
+Symbol term12 = {"km", false, 12};
+Symbol term13 = {"kn", false, 13};
+Symbol term14 = {"ko", false, 14};
+Symbol term15 = {"kp", false, 15};
+Symbol term16 = {"kq", false, 16};
+Symbol term17 = {"kr", false, 17};
+Symbol term18 = {"ks", false, 18};
+Symbol term19 = {"kt", false, 19};
+Symbol term20 = {"ku", false, 20};
+Symbol term21 = {"kv", false, 21};
+Symbol term22 = {"kw", false, 22};
+Symbol term23 = {"kx", false, 23};
+Symbol term24 = {"ky", false, 24};
+Symbol term25 = {"kz", false, 25};
+Symbol term26 = {"kab", false, 26};
+Symbol term27 = {"kbb", false, 27};
+Symbol term28 = {"kcb", false, 28};
+Symbol term29 = {"kdb", false, 29};
+Symbol term30 = {"keb", false, 30};
+Symbol term31 = {"kfb", false, 31};
+Symbol term32 = {"kgb", false, 32};
+Symbol term33 = {"khb", false, 33};
+Symbol term34 = {"kib", false, 34};
+Symbol term35 = {"kjb", false, 35};
+Symbol term36 = {"kkb", false, 36};
+Symbol term37 = {"klb", false, 37};
+Symbol term38 = {"kmb", false, 38};
+Symbol term39 = {"knb", false, 39};
+Symbol term40 = {"kob", false, 40};
+Symbol term41 = {"kpb", false, 41};
+Symbol term42 = {"kqb", false, 42};
+Symbol term43 = {"krb", false, 43};
+Symbol term44 = {"ksb", false, 44};
+Symbol term45 = {"ktb", false, 45};
+Symbol term46 = {"kub", false, 46};
+Symbol term47 = {"kvb", false, 47};
+Symbol term48 = {"kwb", false, 48};
+Symbol term49 = {"kxb", false, 49};
+Symbol term50 = {"kyb", false, 50};
+Symbol term51 = {"kzb", false, 51};
+Symbol term52 = {"kac", false, 52};
+Symbol term53 = {"kbc", false, 53};
+Symbol term54 = {"kcc", false, 54};
+Symbol term55 = {"kdc", false, 55};
+Symbol term56 = {"kec", false, 56};
+Symbol term57 = {"kfc", false, 57};
+Symbol term58 = {"kgc", false, 58};
+Symbol term59 = {"khc", false, 59};
+Symbol term60 = {"kic", false, 60};
+Symbol term61 = {"kjc", false, 61};
+Symbol term62 = {"kkc", false, 62};
+Symbol term63 = {"klc", false, 63};
+Symbol term64 = {"kmc", false, 64};
+Symbol term65 = {"knc", false, 65};
+Symbol term66 = {"koc", false, 66};
+Symbol term67 = {"kpc", false, 67};
+Symbol term68 = {"kqc", false, 68};
+Symbol term69 = {"krc", false, 69};
+Symbol term70 = {"ksc", false, 70};
+Symbol term71 = {"ktc", false, 71};
+Symbol term72 = {"kuc", false, 72};
+Symbol term73 = {"kvc", false, 73};
+Symbol term74 = {"kwc", false, 74};
+Symbol term75 = {"kxc", false, 75};
+Symbol term76 = {"kyc", false, 76};
+Symbol term77 = {"kzc", false, 77};
+Symbol term78 = {"kad", false, 78};
+Symbol term79 = {"kbd", false, 79};
+Symbol term80 = {"kcd", false, 80};
+Symbol term81 = {"kdd", false, 81};
+Symbol term82 = {"ked", false, 82};
+Symbol term83 = {"kfd", false, 83};
+Symbol term84 = {"kgd", false, 84};
+Symbol term85 = {"khd", false, 85};
+Symbol term86 = {"kid", false, 86};
+Symbol term87 = {"kjd", false, 87};
+Symbol term88 = {"kkd", false, 88};
+Symbol term89 = {"kld", false, 89};
+Symbol term90 = {"kmd", false, 90};
+Symbol term91 = {"knd", false, 91};
+Symbol term92 = {"kod", false, 92};
+Symbol term93 = {"kpd", false, 93};
+Symbol term94 = {"kqd", false, 94};
+Symbol term95 = {"krd", false, 95};
+Symbol term96 = {"ksd", false, 96};
+Symbol term97 = {"ktd", false, 97};
+Symbol term98 = {"kud", false, 98};
+Symbol term99 = {"kvd", false, 99};
+Symbol term100 = {"kwd", false, 100};
+Symbol term101 = {"kxd", false, 101};
+Symbol term102 = {"kyd", false, 102};
+Symbol term103 = {"kzd", false, 103};
+Symbol term104 = {"kae", false, 104};
+Symbol term105 = {"kbe", false, 105};
+Symbol term106 = {"kce", false, 106};
+Symbol term107 = {"kde", false, 107};
+Symbol term108 = {"kee", false, 108};
+Symbol term109 = {"kfe", false, 109};
+Symbol term110 = {"kge", false, 110};
+Symbol term111 = {"khe", false, 111};
+Symbol term112 = {"kie", false, 112};
+Symbol term113 = {"kje", false, 113};
+Symbol term114 = {"kke", false, 114};
+Symbol term115 = {"kle", false, 115};
+Symbol term116 = {"kme", false, 116};
+Symbol term117 = {"kne", false, 117};
+Symbol term118 = {"koe", false, 118};
+Symbol term119 = {"kpe", false, 119};
+Symbol term120 = {"kqe", false, 120};
+Symbol term121 = {"kre", false, 121};
+Symbol term122 = {"kse", false, 122};
+Symbol term123 = {"kte", false, 123};
+Symbol term124 = {"kue", false, 124};
+Symbol term125 = {"kve", false, 125};
+Symbol term126 = {"kwe", false, 126};
+Symbol term127 = {"kxe", false, 127};
+Symbol term128 = {"kye", false, 128};
+Symbol term129 = {"kze", false, 129};
+Symbol term130 = {"kaf", false, 130};
+Symbol term131 = {"kbf", false, 131};
+Symbol term132 = {"kcf", false, 132};
+Symbol term133 = {"kdf", false, 133};
+Symbol term134 = {"kef", false, 134};
+Symbol term135 = {"kff", false, 135};
+Symbol term136 = {"kgf", false, 136};
+Symbol term137 = {"khf", false, 137};
+Symbol term138 = {"kif", false, 138};
+Symbol term139 = {"kjf", false, 139};
+Symbol term140 = {"kkf", false, 140};
+Symbol term141 = {"klf", false, 141};
+Symbol term142 = {"kmf", false, 142};
+Symbol term143 = {"knf", false, 143};
+Symbol term144 = {"kof", false, 144};
+Symbol term145 = {"kpf", false, 145};
+Symbol term146 = {"kqf", false, 146};
+Symbol term147 = {"krf", false, 147};
+Symbol term148 = {"ksf", false, 148};
+Symbol term149 = {"ktf", false, 149};
+Symbol term150 = {"kuf", false, 150};
+Symbol term151 = {"kvf", false, 151};
+Symbol term152 = {"kwf", false, 152};
+Symbol term153 = {"kxf", false, 153};
+Symbol term154 = {"kyf", false, 154};
+Symbol term155 = {"kzf", false, 155};
+Symbol term156 = {"kag", false, 156};
+Symbol term157 = {"kbg", false, 157};
+Symbol term158 = {"kcg", false, 158};
+Symbol term159 = {"kdg", false, 159};
+Symbol term160 = {"keg", false, 160};
+Symbol term161 = {"kfg", false, 161};
+Symbol term162 = {"kgg", false, 162};
+Symbol term163 = {"khg", false, 163};
+Symbol term164 = {"kig", false, 164};
+Symbol term165 = {"kjg", false, 165};
+Symbol term166 = {"kkg", false, 166};
+Symbol term167 = {"klg", false, 167};
+Symbol term168 = {"kmg", false, 168};
+Symbol term169 = {"kng", false, 169};
+Symbol term170 = {"kog", false, 170};
+Symbol term171 = {"kpg", false, 171};
+Symbol term172 = {"kqg", false, 172};
+Symbol term173 = {"krg", false, 173};
+Symbol term174 = {"ksg", false, 174};
+Symbol term175 = {"ktg", false, 175};
+Symbol term176 = {"kug", false, 176};
+Symbol term177 = {"kvg", false, 177};
+Symbol term178 = {"kwg", false, 178};
+Symbol term179 = {"kxg", false, 179};
+Symbol term180 = {"kyg", false, 180};
+Symbol term181 = {"kzg", false, 181};
+Symbol term182 = {"kah", false, 182};
+Symbol term183 = {"kbh", false, 183};
+Symbol term184 = {"kch", false, 184};
+Symbol term185 = {"kdh", false, 185};
+Symbol term186 = {"keh", false, 186};
+Symbol term187 = {"kfh", false, 187};
+Symbol term188 = {"kgh", false, 188};
+Symbol term189 = {"khh", false, 189};
+Symbol term190 = {"kih", false, 190};
+Symbol term191 = {"kjh", false, 191};
+Symbol term192 = {"kkh", false, 192};
+Symbol term193 = {"klh", false, 193};
+Symbol term194 = {"kmh", false, 194};
+Symbol term195 = {"knh", false, 195};
+Symbol term196 = {"koh", false, 196};
+Symbol term197 = {"kph", false, 197};
+Symbol term198 = {"kqh", false, 198};
+Symbol term199 = {"krh", false, 199};
+Symbol term200 = {"ksh", false, 200};
+Symbol term201 = {"kth", false, 201};
+Symbol term202 = {"kuh", false, 202};
+Symbol term203 = {"kvh", false, 203};
+Symbol term204 = {"kwh", false, 204};
+Symbol term205 = {"kxh", false, 205};
+Symbol term206 = {"kyh", false, 206};
+Symbol term207 = {"kzh", false, 207};
+Symbol term208 = {"kai", false, 208};
+Symbol term209 = {"kbi", false, 209};
+Symbol term210 = {"kci", false, 210};
+Symbol term211 = {"kdi", false, 211};
+Symbol term212 = {"kei", false, 212};
+Symbol term213 = {"kfi", false, 213};
+Symbol term214 = {"kgi", false, 214};
+Symbol term215 = {"khi", false, 215};
+Symbol term216 = {"kii", false, 216};
+Symbol term217 = {"kji", false, 217};
+Symbol term218 = {"kki", false, 218};
+Symbol term219 = {"kli", false, 219};
+Symbol term220 = {"kmi", false, 220};
+Symbol term221 = {"kni", false, 221};
+Symbol term222 = {"koi", false, 222};
+Symbol term223 = {"kpi", false, 223};
+Symbol term224 = {"kqi", false, 224};
+Symbol term225 = {"kri", false, 225};
+Symbol term226 = {"ksi", false, 226};
+Symbol term227 = {"kti", false, 227};
+Symbol term228 = {"kui", false, 228};
+Symbol term229 = {"kvi", false, 229};
+Symbol term230 = {"kwi", false, 230};
+Symbol term231 = {"kxi", false, 231};
+Symbol term232 = {"kyi", false, 232};
+Symbol term233 = {"kzi", false, 233};
+Symbol term234 = {"kaj", false, 234};
+Symbol term235 = {"kbj", false, 235};
+Symbol term236 = {"kcj", false, 236};
+Symbol term237 = {"kdj", false, 237};
+Symbol term238 = {"kej", false, 238};
+Symbol term239 = {"kfj", false, 239};
+Symbol term240 = {"kgj", false, 240};
+Symbol term241 = {"khj", false, 241};
+Symbol term242 = {"kij", false, 242};
+Symbol term243 = {"kjj", false, 243};
+Symbol term244 = {"kkj", false, 244};
+Symbol term245 = {"klj", false, 245};
+Symbol term246 = {"kmj", false, 246};
+Symbol term247 = {"knj", false, 247};
+Symbol term248 = {"koj", false, 248};
+Symbol term249 = {"kpj", false, 249};
+Symbol term250 = {"kqj", false, 250};
+Symbol term251 = {"krj", false, 251};
+Symbol term252 = {"ksj", false, 252};
+Symbol term253 = {"ktj", false, 253};
+Symbol term254 = {"kuj", false, 254};
+Symbol term255 = {"kvj", false, 255};
+Symbol term256 = {"kwj", false, 256};
+Symbol term257 = {"kxj", false, 257};
+Symbol term258 = {"kyj", false, 258};
+Symbol term259 = {"kzj", false, 259};
+Symbol term260 = {"kak", false, 260};
+Symbol term261 = {"kbk", false, 261};
+Symbol term262 = {"kck", false, 262};
+Symbol term263 = {"kdk", false, 263};
+Symbol term264 = {"kek", false, 264};
+Symbol term265 = {"kfk", false, 265};
+Symbol term266 = {"kgk", false, 266};
+Symbol term267 = {"khk", false, 267};
+Symbol term268 = {"kik", false, 268};
+Symbol term269 = {"kjk", false, 269};
+Symbol term270 = {"kkk", false, 270};
+Symbol term271 = {"klk", false, 271};
+Symbol term272 = {"kmk", false, 272};
+Symbol term273 = {"knk", false, 273};
+Symbol term274 = {"kok", false, 274};
+Symbol term275 = {"kpk", false, 275};
+Symbol term276 = {"kqk", false, 276};
+Symbol term277 = {"krk", false, 277};
+Symbol term278 = {"ksk", false, 278};
+Symbol term279 = {"ktk", false, 279};
+Symbol term280 = {"kuk", false, 280};
+Symbol term281 = {"kvk", false, 281};
+Symbol term282 = {"kwk", false, 282};
+Symbol term283 = {"kxk", false, 283};
+Symbol term284 = {"kyk", false, 284};
+Symbol term285 = {"kzk", false, 285};
+Symbol term286 = {"kal", false, 286};
+Symbol term287 = {"kbl", false, 287};
+Symbol term288 = {"kcl", false, 288};
+Symbol term289 = {"kdl", false, 289};
+Symbol term290 = {"kel", false, 290};
+Symbol term291 = {"kfl", false, 291};
+Symbol term292 = {"kgl", false, 292};
+Symbol term293 = {"khl", false, 293};
+Symbol term294 = {"kil", false, 294};
+Symbol term295 = {"kjl", false, 295};
+Symbol term296 = {"kkl", false, 296};
+Symbol term297 = {"kll", false, 297};
+Symbol term298 = {"kml", false, 298};
+Symbol term299 = {"knl", false, 299};
+Symbol term300 = {"kol", false, 300};
+Symbol term301 = {"kpl", false, 301};
+Symbol term302 = {"kql", false, 302};
+Symbol term303 = {"krl", false, 303};
+Symbol term304 = {"ksl", false, 304};
+Symbol term305 = {"ktl", false, 305};
+Symbol term306 = {"kul", false, 306};
+Symbol term307 = {"kvl", false, 307};
+Symbol term308 = {"kwl", false, 308};
+Symbol term309 = {"kxl", false, 309};
+Symbol term310 = {"kyl", false, 310};
+Symbol term311 = {"kzl", false, 311};
+Symbol term312 = {"kam", false, 312};
+Symbol term313 = {"kbm", false, 313};
+Symbol term314 = {"kcm", false, 314};
+Symbol term315 = {"kdm", false, 315};
+Symbol term316 = {"kem", false, 316};
+Symbol term317 = {"kfm", false, 317};
+Symbol term318 = {"kgm", false, 318};
+Symbol term319 = {"khm", false, 319};
+Symbol term320 = {"kim", false, 320};
+Symbol term321 = {"kjm", false, 321};
+Symbol term322 = {"kkm", false, 322};
+Symbol term323 = {"klm", false, 323};
+Symbol term324 = {"kmm", false, 324};
+Symbol term325 = {"knm", false, 325};
+Symbol term326 = {"kom", false, 326};
+Symbol term327 = {"kpm", false, 327};
+Symbol term328 = {"kqm", false, 328};
+Symbol term329 = {"krm", false, 329};
+Symbol term330 = {"ksm", false, 330};
+Symbol term331 = {"ktm", false, 331};
+Symbol term332 = {"kum", false, 332};
+Symbol term333 = {"kvm", false, 333};
+Symbol term334 = {"kwm", false, 334};
+Symbol term335 = {"kxm", false, 335};
+Symbol term336 = {"kym", false, 336};
+Symbol term337 = {"kzm", false, 337};
+Symbol term338 = {"kan", false, 338};
+Symbol term339 = {"kbn", false, 339};
+Symbol term340 = {"kcn", false, 340};
+Symbol term341 = {"kdn", false, 341};
+Symbol term342 = {"ken", false, 342};
+Symbol term343 = {"kfn", false, 343};
+Symbol term344 = {"kgn", false, 344};
+Symbol term345 = {"khn", false, 345};
+Symbol term346 = {"kin", false, 346};
+Symbol term347 = {"kjn", false, 347};
+Symbol term348 = {"kkn", false, 348};
+Symbol term349 = {"kln", false, 349};
+Symbol term350 = {"kmn", false, 350};
+Symbol term351 = {"knn", false, 351};
+Symbol term352 = {"kon", false, 352};
+Symbol term353 = {"kpn", false, 353};
+Symbol term354 = {"kqn", false, 354};
+Symbol term355 = {"krn", false, 355};
+Symbol term356 = {"ksn", false, 356};
+Symbol term357 = {"ktn", false, 357};
+Symbol term358 = {"kun", false, 358};
+Symbol term359 = {"kvn", false, 359};
+Symbol term360 = {"kwn", false, 360};
+Symbol term361 = {"kxn", false, 361};
+Symbol term362 = {"kyn", false, 362};
+Symbol term363 = {"kzn", false, 363};
+Symbol term364 = {"kao", false, 364};
+Symbol term365 = {"kbo", false, 365};
+Symbol term366 = {"kco", false, 366};
+Symbol term367 = {"kdo", false, 367};
+Symbol term368 = {"keo", false, 368};
+Symbol term369 = {"kfo", false, 369};
+Symbol term370 = {"kgo", false, 370};
+Symbol term371 = {"kho", false, 371};
+Symbol term372 = {"kio", false, 372};
+Symbol term373 = {"kjo", false, 373};
+Symbol term374 = {"kko", false, 374};
+Symbol term375 = {"klo", false, 375};
+Symbol term376 = {"kmo", false, 376};
+Symbol term377 = {"kno", false, 377};
+Symbol term378 = {"koo", false, 378};
+Symbol term379 = {"kpo", false, 379};
+Symbol term380 = {"kqo", false, 380};
+Symbol term381 = {"kro", false, 381};
+Symbol term382 = {"kso", false, 382};
+Symbol term383 = {"kto", false, 383};
+Symbol term384 = {"kuo", false, 384};
+Symbol term385 = {"kvo", false, 385};
+Symbol term386 = {"kwo", false, 386};
+Symbol term387 = {"kxo", false, 387};
+Symbol term388 = {"kyo", false, 388};
+Symbol term389 = {"kzo", false, 389};
+Symbol term390 = {"kap", false, 390};
+Symbol term391 = {"kbp", false, 391};
+Symbol term392 = {"kcp", false, 392};
+Symbol term393 = {"kdp", false, 393};
+Symbol term394 = {"kep", false, 394};
+Symbol term395 = {"kfp", false, 395};
+Symbol term396 = {"kgp", false, 396};
+Symbol term397 = {"khp", false, 397};
+Symbol term398 = {"kip", false, 398};
+Symbol term399 = {"kjp", false, 399};
+Symbol term400 = {"num", true, 400};
+Symbol term401 = {"ws", true, 401};
+Symbol term402 = {"id", false, 402};
+Symbol term403 = {";", false, 403};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+extern Node node75;
+extern Node node76;
+extern Node node77;
+extern Node node78;
+extern Node node79;
+extern Node node80;
+extern Node node81;
+extern Node node82;
+extern Node node83;
+extern Node node84;
+extern Node node85;
+extern Node node86;
+extern Node node87;
+extern Node node88;
+extern Node node89;
+extern Node node90;
+extern Node node91;
+extern Node node92;
+extern Node node93;
+extern Node node94;
+extern Node node95;
+extern Node node96;
+extern Node node97;
+extern Node node98;
+extern Node node99;
+extern Node node100;
+extern Node node101;
+extern Node node102;
+extern Node node103;
+extern Node node104;
+extern Node node105;
+extern Node node106;
+extern Node node107;
+extern Node node108;
+extern Node node109;
+extern Node node110;
+extern Node node111;
+extern Node node112;
+extern Node node113;
+extern Node node114;
+extern Node node115;
+extern Node node116;
+extern Node node117;
+extern Node node118;
+extern Node node119;
+extern Node node120;
+extern Node node121;
+extern Node node122;
+extern Node node123;
+extern Node node124;
+extern Node node125;
+extern Node node126;
+extern Node node127;
+extern Node node128;
+extern Node node129;
+extern Node node130;
+extern Node node131;
+extern Node node132;
+extern Node node133;
+extern Node node134;
+extern Node node135;
+extern Node node136;
+extern Node node137;
+extern Node node138;
+extern Node node139;
+extern Node node140;
+extern Node node141;
+extern Node node142;
+extern Node node143;
+extern Node node144;
+extern Node node145;
+extern Node node146;
+extern Node node147;
+extern Node node148;
+extern Node node149;
+extern Node node150;
+extern Node node151;
+extern Node node152;
+extern Node node153;
+extern Node node154;
+extern Node node155;
+extern Node node156;
+extern Node node157;
+extern Node node158;
+extern Node node159;
+extern Node node160;
+extern Node node161;
+extern Node node162;
+extern Node node163;
+extern Node node164;
+extern Node node165;
+extern Node node166;
+extern Node node167;
+extern Node node168;
+extern Node node169;
+extern Node node170;
+extern Node node171;
+extern Node node172;
+extern Node node173;
+extern Node node174;
+extern Node node175;
+extern Node node176;
+extern Node node177;
+extern Node node178;
+extern Node node179;
+extern Node node180;
+extern Node node181;
+extern Node node182;
+extern Node node183;
+extern Node node184;
+extern Node node185;
+extern Node node186;
+extern Node node187;
+extern Node node188;
+extern Node node189;
+extern Node node190;
+extern Node node191;
+extern Node node192;
+extern Node node193;
+extern Node node194;
+extern Node node195;
+extern Node node196;
+extern Node node197;
+extern Node node198;
+extern Node node199;
+extern Node node200;
+extern Node node201;
+extern Node node202;
+extern Node node203;
+extern Node node204;
+extern Node node205;
+extern Node node206;
+extern Node node207;
+extern Node node208;
+extern Node node209;
+extern Node node210;
+extern Node node211;
+extern Node node212;
+extern Node node213;
+extern Node node214;
+extern Node node215;
+extern Node node216;
+extern Node node217;
+extern Node node218;
+extern Node node219;
+extern Node node220;
+extern Node node221;
+extern Node node222;
+extern Node node223;
+extern Node node224;
+extern Node node225;
+extern Node node226;
+extern Node node227;
+extern Node node228;
+extern Node node229;
+extern Node node230;
+extern Node node231;
+extern Node node232;
+extern Node node233;
+extern Node node234;
+extern Node node235;
+extern Node node236;
+extern Node node237;
+extern Node node238;
+extern Node node239;
+extern Node node240;
+extern Node node241;
+extern Node node242;
+extern Node node243;
+extern Node node244;
+extern Node node245;
+extern Node node246;
+extern Node node247;
+extern Node node248;
+extern Node node249;
+extern Node node250;
+extern Node node251;
+extern Node node252;
+extern Node node253;
+extern Node node254;
+extern Node node255;
+extern Node node256;
+extern Node node257;
+extern Node node258;
+extern Node node259;
+extern Node node260;
+extern Node node261;
+extern Node node262;
+extern Node node263;
+extern Node node264;
+extern Node node265;
+extern Node node266;
+extern Node node267;
+extern Node node268;
+extern Node node269;
+extern Node node270;
+extern Node node271;
+extern Node node272;
+extern Node node273;
+extern Node node274;
+extern Node node275;
+extern Node node276;
+extern Node node277;
+extern Node node278;
+extern Node node279;
+extern Node node280;
+extern Node node281;
+extern Node node282;
+extern Node node283;
+extern Node node284;
+extern Node node285;
+extern Node node286;
+extern Node node287;
+extern Node node288;
+extern Node node289;
+extern Node node290;
+extern Node node291;
+extern Node node292;
+extern Node node293;
+extern Node node294;
+extern Node node295;
+extern Node node296;
+extern Node node297;
+extern Node node298;
+extern Node node299;
+extern Node node300;
+extern Node node301;
+extern Node node302;
+extern Node node303;
+extern Node node304;
+extern Node node305;
+extern Node node306;
+extern Node node307;
+extern Node node308;
+extern Node node309;
+extern Node node310;
+extern Node node311;
+extern Node node312;
+extern Node node313;
+extern Node node314;
+extern Node node315;
+extern Node node316;
+extern Node node317;
+extern Node node318;
+extern Node node319;
+extern Node node320;
+extern Node node321;
+extern Node node322;
+extern Node node323;
+extern Node node324;
+extern Node node325;
+extern Node node326;
+extern Node node327;
+extern Node node328;
+extern Node node329;
+extern Node node330;
+extern Node node331;
+extern Node node332;
+extern Node node333;
+extern Node node334;
+extern Node node335;
+extern Node node336;
+extern Node node337;
+extern Node node338;
+extern Node node339;
+extern Node node340;
+extern Node node341;
+extern Node node342;
+extern Node node343;
+extern Node node344;
+extern Node node345;
+extern Node node346;
+extern Node node347;
+extern Node node348;
+extern Node node349;
+extern Node node350;
+extern Node node351;
+extern Node node352;
+extern Node node353;
+extern Node node354;
+extern Node node355;
+extern Node node356;
+extern Node node357;
+extern Node node358;
+extern Node node359;
+extern Node node360;
+extern Node node361;
+extern Node node362;
+extern Node node363;
+extern Node node364;
+extern Node node365;
+extern Node node366;
+extern Node node367;
+extern Node node368;
+extern Node node369;
+extern Node node370;
+extern Node node371;
+extern Node node372;
+extern Node node373;
+extern Node node374;
+extern Node node375;
+extern Node node376;
+extern Node node377;
+extern Node node378;
+extern Node node379;
+extern Node node380;
+extern Node node381;
+extern Node node382;
+extern Node node383;
+extern Node node384;
+extern Node node385;
+extern Node node386;
+extern Node node387;
+extern Node node388;
+extern Node node389;
+extern Node node390;
+extern Node node391;
+extern Node node392;
+extern Node node393;
+extern Node node394;
+extern Node node395;
+extern Node node396;
+extern Node node397;
+extern Node node398;
+extern Node node399;
+extern Node node400;
+extern Node node401;
+extern Node node402;
+extern Node node403;
+extern Node node404;
+extern Node node405;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 37 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if ((k >= 10) && (k <= 19)) { return &node4; }
+    if (k == 20) { return &node5; }
+    if ((k >= 21) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node6; }
+    if (k == 11) { return &node7; }
+    if (k == 12) { return &node8; }
+    if (k == 13) { return &node9; }
+    if (k == 14) { return &node10; }
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node391; }
+    if (k == 12) { return &node392; }
+    if (k == 13) { return &node393; }
+    if (k == 14) { return &node394; }
+    if (k == 15) { return &node395; }
+    if (k == 16) { return &node396; }
+    if (k == 17) { return &node397; }
+    if (k == 18) { return &node398; }
+    if (k == 19) { return &node399; }
+    if (k == 20) { return &node400; }
+    if (k == 21) { return &node401; }
+    if (k == 22) { return &node402; }
+    if (k == 23) { return &node403; }
+    if (k == 24) { return &node404; }
+    if (k == 25) { return &node405; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node376; }
+    if (k == 12) { return &node377; }
+    if (k == 13) { return &node378; }
+    if (k == 14) { return &node379; }
+    if (k == 15) { return &node380; }
+    if (k == 16) { return &node381; }
+    if (k == 17) { return &node382; }
+    if (k == 18) { return &node383; }
+    if (k == 19) { return &node384; }
+    if (k == 20) { return &node385; }
+    if (k == 21) { return &node386; }
+    if (k == 22) { return &node387; }
+    if (k == 23) { return &node388; }
+    if (k == 24) { return &node389; }
+    if (k == 25) { return &node390; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node361; }
+    if (k == 12) { return &node362; }
+    if (k == 13) { return &node363; }
+    if (k == 14) { return &node364; }
+    if (k == 15) { return &node365; }
+    if (k == 16) { return &node366; }
+    if (k == 17) { return &node367; }
+    if (k == 18) { return &node368; }
+    if (k == 19) { return &node369; }
+    if (k == 20) { return &node370; }
+    if (k == 21) { return &node371; }
+    if (k == 22) { return &node372; }
+    if (k == 23) { return &node373; }
+    if (k == 24) { return &node374; }
+    if (k == 25) { return &node375; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node346; }
+    if (k == 12) { return &node347; }
+    if (k == 13) { return &node348; }
+    if (k == 14) { return &node349; }
+    if (k == 15) { return &node350; }
+    if (k == 16) { return &node351; }
+    if (k == 17) { return &node352; }
+    if (k == 18) { return &node353; }
+    if (k == 19) { return &node354; }
+    if (k == 20) { return &node355; }
+    if (k == 21) { return &node356; }
+    if (k == 22) { return &node357; }
+    if (k == 23) { return &node358; }
+    if (k == 24) { return &node359; }
+    if (k == 25) { return &node360; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node331; }
+    if (k == 12) { return &node332; }
+    if (k == 13) { return &node333; }
+    if (k == 14) { return &node334; }
+    if (k == 15) { return &node335; }
+    if (k == 16) { return &node336; }
+    if (k == 17) { return &node337; }
+    if (k == 18) { return &node338; }
+    if (k == 19) { return &node339; }
+    if (k == 20) { return &node340; }
+    if (k == 21) { return &node341; }
+    if (k == 22) { return &node342; }
+    if (k == 23) { return &node343; }
+    if (k == 24) { return &node344; }
+    if (k == 25) { return &node345; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node316; }
+    if (k == 12) { return &node317; }
+    if (k == 13) { return &node318; }
+    if (k == 14) { return &node319; }
+    if (k == 15) { return &node320; }
+    if (k == 16) { return &node321; }
+    if (k == 17) { return &node322; }
+    if (k == 18) { return &node323; }
+    if (k == 19) { return &node324; }
+    if (k == 20) { return &node325; }
+    if (k == 21) { return &node326; }
+    if (k == 22) { return &node327; }
+    if (k == 23) { return &node328; }
+    if (k == 24) { return &node329; }
+    if (k == 25) { return &node330; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node301; }
+    if (k == 12) { return &node302; }
+    if (k == 13) { return &node303; }
+    if (k == 14) { return &node304; }
+    if (k == 15) { return &node305; }
+    if (k == 16) { return &node306; }
+    if (k == 17) { return &node307; }
+    if (k == 18) { return &node308; }
+    if (k == 19) { return &node309; }
+    if (k == 20) { return &node310; }
+    if (k == 21) { return &node311; }
+    if (k == 22) { return &node312; }
+    if (k == 23) { return &node313; }
+    if (k == 24) { return &node314; }
+    if (k == 25) { return &node315; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node286; }
+    if (k == 12) { return &node287; }
+    if (k == 13) { return &node288; }
+    if (k == 14) { return &node289; }
+    if (k == 15) { return &node290; }
+    if (k == 16) { return &node291; }
+    if (k == 17) { return &node292; }
+    if (k == 18) { return &node293; }
+    if (k == 19) { return &node294; }
+    if (k == 20) { return &node295; }
+    if (k == 21) { return &node296; }
+    if (k == 22) { return &node297; }
+    if (k == 23) { return &node298; }
+    if (k == 24) { return &node299; }
+    if (k == 25) { return &node300; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node271; }
+    if (k == 12) { return &node272; }
+    if (k == 13) { return &node273; }
+    if (k == 14) { return &node274; }
+    if (k == 15) { return &node275; }
+    if (k == 16) { return &node276; }
+    if (k == 17) { return &node277; }
+    if (k == 18) { return &node278; }
+    if (k == 19) { return &node279; }
+    if (k == 20) { return &node280; }
+    if (k == 21) { return &node281; }
+    if (k == 22) { return &node282; }
+    if (k == 23) { return &node283; }
+    if (k == 24) { return &node284; }
+    if (k == 25) { return &node285; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node256; }
+    if (k == 12) { return &node257; }
+    if (k == 13) { return &node258; }
+    if (k == 14) { return &node259; }
+    if (k == 15) { return &node260; }
+    if (k == 16) { return &node261; }
+    if (k == 17) { return &node262; }
+    if (k == 18) { return &node263; }
+    if (k == 19) { return &node264; }
+    if (k == 20) { return &node265; }
+    if (k == 21) { return &node266; }
+    if (k == 22) { return &node267; }
+    if (k == 23) { return &node268; }
+    if (k == 24) { return &node269; }
+    if (k == 25) { return &node270; }
+    if ((k >= 26) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node242; }
+    if (k == 12) { return &node243; }
+    if (k == 13) { return &node244; }
+    if (k == 14) { return &node245; }
+    if (k == 15) { return &node246; }
+    if (k == 16) { return &node247; }
+    if (k == 17) { return &node248; }
+    if (k == 18) { return &node249; }
+    if (k == 19) { return &node250; }
+    if (k == 20) { return &node251; }
+    if (k == 21) { return &node252; }
+    if (k == 22) { return &node253; }
+    if (k == 23) { return &node254; }
+    if (k == 24) { return &node255; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node228; }
+    if (k == 12) { return &node229; }
+    if (k == 13) { return &node230; }
+    if (k == 14) { return &node231; }
+    if (k == 15) { return &node232; }
+    if (k == 16) { return &node233; }
+    if (k == 17) { return &node234; }
+    if (k == 18) { return &node235; }
+    if (k == 19) { return &node236; }
+    if (k == 20) { return &node237; }
+    if (k == 21) { return &node238; }
+    if (k == 22) { return &node239; }
+    if (k == 23) { return &node240; }
+    if (k == 24) { return &node241; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node214; }
+    if (k == 12) { return &node215; }
+    if (k == 13) { return &node216; }
+    if (k == 14) { return &node217; }
+    if (k == 15) { return &node218; }
+    if (k == 16) { return &node219; }
+    if (k == 17) { return &node220; }
+    if (k == 18) { return &node221; }
+    if (k == 19) { return &node222; }
+    if (k == 20) { return &node223; }
+    if (k == 21) { return &node224; }
+    if (k == 22) { return &node225; }
+    if (k == 23) { return &node226; }
+    if (k == 24) { return &node227; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node200; }
+    if (k == 12) { return &node201; }
+    if (k == 13) { return &node202; }
+    if (k == 14) { return &node203; }
+    if (k == 15) { return &node204; }
+    if (k == 16) { return &node205; }
+    if (k == 17) { return &node206; }
+    if (k == 18) { return &node207; }
+    if (k == 19) { return &node208; }
+    if (k == 20) { return &node209; }
+    if (k == 21) { return &node210; }
+    if (k == 22) { return &node211; }
+    if (k == 23) { return &node212; }
+    if (k == 24) { return &node213; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node186; }
+    if (k == 12) { return &node187; }
+    if (k == 13) { return &node188; }
+    if (k == 14) { return &node189; }
+    if (k == 15) { return &node190; }
+    if (k == 16) { return &node191; }
+    if (k == 17) { return &node192; }
+    if (k == 18) { return &node193; }
+    if (k == 19) { return &node194; }
+    if (k == 20) { return &node195; }
+    if (k == 21) { return &node196; }
+    if (k == 22) { return &node197; }
+    if (k == 23) { return &node198; }
+    if (k == 24) { return &node199; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node172; }
+    if (k == 12) { return &node173; }
+    if (k == 13) { return &node174; }
+    if (k == 14) { return &node175; }
+    if (k == 15) { return &node176; }
+    if (k == 16) { return &node177; }
+    if (k == 17) { return &node178; }
+    if (k == 18) { return &node179; }
+    if (k == 19) { return &node180; }
+    if (k == 20) { return &node181; }
+    if (k == 21) { return &node182; }
+    if (k == 22) { return &node183; }
+    if (k == 23) { return &node184; }
+    if (k == 24) { return &node185; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node158; }
+    if (k == 12) { return &node159; }
+    if (k == 13) { return &node160; }
+    if (k == 14) { return &node161; }
+    if (k == 15) { return &node162; }
+    if (k == 16) { return &node163; }
+    if (k == 17) { return &node164; }
+    if (k == 18) { return &node165; }
+    if (k == 19) { return &node166; }
+    if (k == 20) { return &node167; }
+    if (k == 21) { return &node168; }
+    if (k == 22) { return &node169; }
+    if (k == 23) { return &node170; }
+    if (k == 24) { return &node171; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node144; }
+    if (k == 12) { return &node145; }
+    if (k == 13) { return &node146; }
+    if (k == 14) { return &node147; }
+    if (k == 15) { return &node148; }
+    if (k == 16) { return &node149; }
+    if (k == 17) { return &node150; }
+    if (k == 18) { return &node151; }
+    if (k == 19) { return &node152; }
+    if (k == 20) { return &node153; }
+    if (k == 21) { return &node154; }
+    if (k == 22) { return &node155; }
+    if (k == 23) { return &node156; }
+    if (k == 24) { return &node157; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node130; }
+    if (k == 12) { return &node131; }
+    if (k == 13) { return &node132; }
+    if (k == 14) { return &node133; }
+    if (k == 15) { return &node134; }
+    if (k == 16) { return &node135; }
+    if (k == 17) { return &node136; }
+    if (k == 18) { return &node137; }
+    if (k == 19) { return &node138; }
+    if (k == 20) { return &node139; }
+    if (k == 21) { return &node140; }
+    if (k == 22) { return &node141; }
+    if (k == 23) { return &node142; }
+    if (k == 24) { return &node143; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node116; }
+    if (k == 12) { return &node117; }
+    if (k == 13) { return &node118; }
+    if (k == 14) { return &node119; }
+    if (k == 15) { return &node120; }
+    if (k == 16) { return &node121; }
+    if (k == 17) { return &node122; }
+    if (k == 18) { return &node123; }
+    if (k == 19) { return &node124; }
+    if (k == 20) { return &node125; }
+    if (k == 21) { return &node126; }
+    if (k == 22) { return &node127; }
+    if (k == 23) { return &node128; }
+    if (k == 24) { return &node129; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node102; }
+    if (k == 12) { return &node103; }
+    if (k == 13) { return &node104; }
+    if (k == 14) { return &node105; }
+    if (k == 15) { return &node106; }
+    if (k == 16) { return &node107; }
+    if (k == 17) { return &node108; }
+    if (k == 18) { return &node109; }
+    if (k == 19) { return &node110; }
+    if (k == 20) { return &node111; }
+    if (k == 21) { return &node112; }
+    if (k == 22) { return &node113; }
+    if (k == 23) { return &node114; }
+    if (k == 24) { return &node115; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node88; }
+    if (k == 12) { return &node89; }
+    if (k == 13) { return &node90; }
+    if (k == 14) { return &node91; }
+    if (k == 15) { return &node92; }
+    if (k == 16) { return &node93; }
+    if (k == 17) { return &node94; }
+    if (k == 18) { return &node95; }
+    if (k == 19) { return &node96; }
+    if (k == 20) { return &node97; }
+    if (k == 21) { return &node98; }
+    if (k == 22) { return &node99; }
+    if (k == 23) { return &node100; }
+    if (k == 24) { return &node101; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node74; }
+    if (k == 12) { return &node75; }
+    if (k == 13) { return &node76; }
+    if (k == 14) { return &node77; }
+    if (k == 15) { return &node78; }
+    if (k == 16) { return &node79; }
+    if (k == 17) { return &node80; }
+    if (k == 18) { return &node81; }
+    if (k == 19) { return &node82; }
+    if (k == 20) { return &node83; }
+    if (k == 21) { return &node84; }
+    if (k == 22) { return &node85; }
+    if (k == 23) { return &node86; }
+    if (k == 24) { return &node87; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node60; }
+    if (k == 12) { return &node61; }
+    if (k == 13) { return &node62; }
+    if (k == 14) { return &node63; }
+    if (k == 15) { return &node64; }
+    if (k == 16) { return &node65; }
+    if (k == 17) { return &node66; }
+    if (k == 18) { return &node67; }
+    if (k == 19) { return &node68; }
+    if (k == 20) { return &node69; }
+    if (k == 21) { return &node70; }
+    if (k == 22) { return &node71; }
+    if (k == 23) { return &node72; }
+    if (k == 24) { return &node73; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node46; }
+    if (k == 12) { return &node47; }
+    if (k == 13) { return &node48; }
+    if (k == 14) { return &node49; }
+    if (k == 15) { return &node50; }
+    if (k == 16) { return &node51; }
+    if (k == 17) { return &node52; }
+    if (k == 18) { return &node53; }
+    if (k == 19) { return &node54; }
+    if (k == 20) { return &node55; }
+    if (k == 21) { return &node56; }
+    if (k == 22) { return &node57; }
+    if (k == 23) { return &node58; }
+    if (k == 24) { return &node59; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node32; }
+    if (k == 12) { return &node33; }
+    if (k == 13) { return &node34; }
+    if (k == 14) { return &node35; }
+    if (k == 15) { return &node36; }
+    if (k == 16) { return &node37; }
+    if (k == 17) { return &node38; }
+    if (k == 18) { return &node39; }
+    if (k == 19) { return &node40; }
+    if (k == 20) { return &node41; }
+    if (k == 21) { return &node42; }
+    if (k == 22) { return &node43; }
+    if (k == 23) { return &node44; }
+    if (k == 24) { return &node45; }
+    if ((k >= 25) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next62(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next63(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next64(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next65(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next66(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next67(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next68(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next69(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next70(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next71(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next72(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next73(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next74(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next75(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next76(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next77(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next78(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next79(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next80(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next81(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next82(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next83(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next84(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next85(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next86(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next87(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next88(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next89(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next90(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next91(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next92(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next93(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next94(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next95(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next96(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next97(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next98(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next99(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next100(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next101(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next102(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next103(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next104(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next105(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next106(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next107(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next108(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next109(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next110(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next111(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next112(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next113(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next114(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next115(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next116(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next117(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next118(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next119(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next120(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next121(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next122(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next123(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next124(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next125(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next126(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next127(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next128(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next129(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next130(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next131(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next132(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next133(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next134(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next135(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next136(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next137(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next138(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next139(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next140(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next141(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next142(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next143(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next144(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next145(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next146(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next147(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next148(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next149(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next150(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next151(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next152(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next153(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next154(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next155(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next156(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next157(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next158(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next159(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next160(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next161(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next162(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next163(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next164(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next165(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next166(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next167(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next168(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next169(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next170(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next171(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next172(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next173(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next174(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next175(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next176(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next177(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next178(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next179(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next180(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next181(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next182(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next183(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next184(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next185(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next186(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next187(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next188(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next189(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next190(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next191(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next192(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next193(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next194(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next195(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next196(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next197(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next198(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next199(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next200(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next201(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next202(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next203(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next204(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next205(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next206(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next207(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next208(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next209(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next210(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next211(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next212(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next213(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next214(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next215(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next216(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next217(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next218(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next219(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next220(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next221(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next222(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next223(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next224(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next225(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next226(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next227(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next228(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next229(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next230(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next231(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next232(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next233(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next234(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next235(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next236(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next237(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next238(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next239(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next240(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next241(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next242(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next243(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next244(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next245(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next246(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next247(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next248(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next249(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next250(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next251(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next252(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next253(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next254(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next255(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next256(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next257(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next258(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next259(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next260(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next261(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next262(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next263(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next264(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next265(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next266(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next267(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next268(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next269(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next270(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next271(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next272(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next273(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next274(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next275(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next276(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next277(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next278(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next279(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next280(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next281(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next282(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next283(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next284(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next285(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next286(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next287(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next288(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next289(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next290(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next291(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next292(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next293(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next294(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next295(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next296(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next297(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next298(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next299(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next300(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next301(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next302(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next303(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next304(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next305(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next306(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next307(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next308(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next309(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next310(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next311(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next312(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next313(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next314(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next315(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next316(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next317(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next318(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next319(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next320(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next321(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next322(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next323(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next324(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next325(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next326(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next327(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next328(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next329(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next330(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next331(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next332(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next333(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next334(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next335(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next336(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next337(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next338(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next339(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next340(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next341(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next342(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next343(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next344(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next345(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next346(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next347(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next348(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next349(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next350(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next351(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next352(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next353(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next354(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next355(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next356(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next357(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next358(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next359(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next360(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next361(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next362(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next363(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next364(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next365(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next366(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next367(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next368(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next369(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next370(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next371(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next372(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next373(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next374(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next375(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next376(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next377(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next378(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next379(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next380(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next381(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next382(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next383(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next384(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next385(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next386(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next387(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next388(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next389(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next390(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next391(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next392(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next393(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next394(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next395(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next396(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next397(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next398(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next399(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next400(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next401(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next402(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next403(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next404(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next405(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term401, nullptr};
+Node node2 = {&next2, &term400, nullptr};
+Node node3 = {nullptr, &term403, nullptr};
+Node node4 = {&next4, &term402, nullptr};
+Node node5 = {&next5, &term402, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term1, nullptr};
+Node node8 = {&next8, &term2, nullptr};
+Node node9 = {&next9, &term3, nullptr};
+Node node10 = {&next10, &term4, nullptr};
+Node node11 = {&next11, &term5, nullptr};
+Node node12 = {&next12, &term6, nullptr};
+Node node13 = {&next13, &term7, nullptr};
+Node node14 = {&next14, &term8, nullptr};
+Node node15 = {&next15, &term9, nullptr};
+Node node16 = {&next16, &term10, nullptr};
+Node node17 = {&next17, &term11, nullptr};
+Node node18 = {&next18, &term12, nullptr};
+Node node19 = {&next19, &term13, nullptr};
+Node node20 = {&next20, &term14, nullptr};
+Node node21 = {&next21, &term15, nullptr};
+Node node22 = {&next22, &term16, nullptr};
+Node node23 = {&next23, &term17, nullptr};
+Node node24 = {&next24, &term18, nullptr};
+Node node25 = {&next25, &term19, nullptr};
+Node node26 = {&next26, &term20, nullptr};
+Node node27 = {&next27, &term21, nullptr};
+Node node28 = {&next28, &term22, nullptr};
+Node node29 = {&next29, &term23, nullptr};
+Node node30 = {&next30, &term24, nullptr};
+Node node31 = {&next31, &term25, nullptr};
+Node node32 = {&next32, &term51, nullptr};
+Node node33 = {&next33, &term77, nullptr};
+Node node34 = {&next34, &term103, nullptr};
+Node node35 = {&next35, &term129, nullptr};
+Node node36 = {&next36, &term155, nullptr};
+Node node37 = {&next37, &term181, nullptr};
+Node node38 = {&next38, &term207, nullptr};
+Node node39 = {&next39, &term233, nullptr};
+Node node40 = {&next40, &term259, nullptr};
+Node node41 = {&next41, &term285, nullptr};
+Node node42 = {&next42, &term311, nullptr};
+Node node43 = {&next43, &term337, nullptr};
+Node node44 = {&next44, &term363, nullptr};
+Node node45 = {&next45, &term389, nullptr};
+Node node46 = {&next46, &term50, nullptr};
+Node node47 = {&next47, &term76, nullptr};
+Node node48 = {&next48, &term102, nullptr};
+Node node49 = {&next49, &term128, nullptr};
+Node node50 = {&next50, &term154, nullptr};
+Node node51 = {&next51, &term180, nullptr};
+Node node52 = {&next52, &term206, nullptr};
+Node node53 = {&next53, &term232, nullptr};
+Node node54 = {&next54, &term258, nullptr};
+Node node55 = {&next55, &term284, nullptr};
+Node node56 = {&next56, &term310, nullptr};
+Node node57 = {&next57, &term336, nullptr};
+Node node58 = {&next58, &term362, nullptr};
+Node node59 = {&next59, &term388, nullptr};
+Node node60 = {&next60, &term49, nullptr};
+Node node61 = {&next61, &term75, nullptr};
+Node node62 = {&next62, &term101, nullptr};
+Node node63 = {&next63, &term127, nullptr};
+Node node64 = {&next64, &term153, nullptr};
+Node node65 = {&next65, &term179, nullptr};
+Node node66 = {&next66, &term205, nullptr};
+Node node67 = {&next67, &term231, nullptr};
+Node node68 = {&next68, &term257, nullptr};
+Node node69 = {&next69, &term283, nullptr};
+Node node70 = {&next70, &term309, nullptr};
+Node node71 = {&next71, &term335, nullptr};
+Node node72 = {&next72, &term361, nullptr};
+Node node73 = {&next73, &term387, nullptr};
+Node node74 = {&next74, &term48, nullptr};
+Node node75 = {&next75, &term74, nullptr};
+Node node76 = {&next76, &term100, nullptr};
+Node node77 = {&next77, &term126, nullptr};
+Node node78 = {&next78, &term152, nullptr};
+Node node79 = {&next79, &term178, nullptr};
+Node node80 = {&next80, &term204, nullptr};
+Node node81 = {&next81, &term230, nullptr};
+Node node82 = {&next82, &term256, nullptr};
+Node node83 = {&next83, &term282, nullptr};
+Node node84 = {&next84, &term308, nullptr};
+Node node85 = {&next85, &term334, nullptr};
+Node node86 = {&next86, &term360, nullptr};
+Node node87 = {&next87, &term386, nullptr};
+Node node88 = {&next88, &term47, nullptr};
+Node node89 = {&next89, &term73, nullptr};
+Node node90 = {&next90, &term99, nullptr};
+Node node91 = {&next91, &term125, nullptr};
+Node node92 = {&next92, &term151, nullptr};
+Node node93 = {&next93, &term177, nullptr};
+Node node94 = {&next94, &term203, nullptr};
+Node node95 = {&next95, &term229, nullptr};
+Node node96 = {&next96, &term255, nullptr};
+Node node97 = {&next97, &term281, nullptr};
+Node node98 = {&next98, &term307, nullptr};
+Node node99 = {&next99, &term333, nullptr};
+Node node100 = {&next100, &term359, nullptr};
+Node node101 = {&next101, &term385, nullptr};
+Node node102 = {&next102, &term46, nullptr};
+Node node103 = {&next103, &term72, nullptr};
+Node node104 = {&next104, &term98, nullptr};
+Node node105 = {&next105, &term124, nullptr};
+Node node106 = {&next106, &term150, nullptr};
+Node node107 = {&next107, &term176, nullptr};
+Node node108 = {&next108, &term202, nullptr};
+Node node109 = {&next109, &term228, nullptr};
+Node node110 = {&next110, &term254, nullptr};
+Node node111 = {&next111, &term280, nullptr};
+Node node112 = {&next112, &term306, nullptr};
+Node node113 = {&next113, &term332, nullptr};
+Node node114 = {&next114, &term358, nullptr};
+Node node115 = {&next115, &term384, nullptr};
+Node node116 = {&next116, &term45, nullptr};
+Node node117 = {&next117, &term71, nullptr};
+Node node118 = {&next118, &term97, nullptr};
+Node node119 = {&next119, &term123, nullptr};
+Node node120 = {&next120, &term149, nullptr};
+Node node121 = {&next121, &term175, nullptr};
+Node node122 = {&next122, &term201, nullptr};
+Node node123 = {&next123, &term227, nullptr};
+Node node124 = {&next124, &term253, nullptr};
+Node node125 = {&next125, &term279, nullptr};
+Node node126 = {&next126, &term305, nullptr};
+Node node127 = {&next127, &term331, nullptr};
+Node node128 = {&next128, &term357, nullptr};
+Node node129 = {&next129, &term383, nullptr};
+Node node130 = {&next130, &term44, nullptr};
+Node node131 = {&next131, &term70, nullptr};
+Node node132 = {&next132, &term96, nullptr};
+Node node133 = {&next133, &term122, nullptr};
+Node node134 = {&next134, &term148, nullptr};
+Node node135 = {&next135, &term174, nullptr};
+Node node136 = {&next136, &term200, nullptr};
+Node node137 = {&next137, &term226, nullptr};
+Node node138 = {&next138, &term252, nullptr};
+Node node139 = {&next139, &term278, nullptr};
+Node node140 = {&next140, &term304, nullptr};
+Node node141 = {&next141, &term330, nullptr};
+Node node142 = {&next142, &term356, nullptr};
+Node node143 = {&next143, &term382, nullptr};
+Node node144 = {&next144, &term43, nullptr};
+Node node145 = {&next145, &term69, nullptr};
+Node node146 = {&next146, &term95, nullptr};
+Node node147 = {&next147, &term121, nullptr};
+Node node148 = {&next148, &term147, nullptr};
+Node node149 = {&next149, &term173, nullptr};
+Node node150 = {&next150, &term199, nullptr};
+Node node151 = {&next151, &term225, nullptr};
+Node node152 = {&next152, &term251, nullptr};
+Node node153 = {&next153, &term277, nullptr};
+Node node154 = {&next154, &term303, nullptr};
+Node node155 = {&next155, &term329, nullptr};
+Node node156 = {&next156, &term355, nullptr};
+Node node157 = {&next157, &term381, nullptr};
+Node node158 = {&next158, &term42, nullptr};
+Node node159 = {&next159, &term68, nullptr};
+Node node160 = {&next160, &term94, nullptr};
+Node node161 = {&next161, &term120, nullptr};
+Node node162 = {&next162, &term146, nullptr};
+Node node163 = {&next163, &term172, nullptr};
+Node node164 = {&next164, &term198, nullptr};
+Node node165 = {&next165, &term224, nullptr};
+Node node166 = {&next166, &term250, nullptr};
+Node node167 = {&next167, &term276, nullptr};
+Node node168 = {&next168, &term302, nullptr};
+Node node169 = {&next169, &term328, nullptr};
+Node node170 = {&next170, &term354, nullptr};
+Node node171 = {&next171, &term380, nullptr};
+Node node172 = {&next172, &term41, nullptr};
+Node node173 = {&next173, &term67, nullptr};
+Node node174 = {&next174, &term93, nullptr};
+Node node175 = {&next175, &term119, nullptr};
+Node node176 = {&next176, &term145, nullptr};
+Node node177 = {&next177, &term171, nullptr};
+Node node178 = {&next178, &term197, nullptr};
+Node node179 = {&next179, &term223, nullptr};
+Node node180 = {&next180, &term249, nullptr};
+Node node181 = {&next181, &term275, nullptr};
+Node node182 = {&next182, &term301, nullptr};
+Node node183 = {&next183, &term327, nullptr};
+Node node184 = {&next184, &term353, nullptr};
+Node node185 = {&next185, &term379, nullptr};
+Node node186 = {&next186, &term40, nullptr};
+Node node187 = {&next187, &term66, nullptr};
+Node node188 = {&next188, &term92, nullptr};
+Node node189 = {&next189, &term118, nullptr};
+Node node190 = {&next190, &term144, nullptr};
+Node node191 = {&next191, &term170, nullptr};
+Node node192 = {&next192, &term196, nullptr};
+Node node193 = {&next193, &term222, nullptr};
+Node node194 = {&next194, &term248, nullptr};
+Node node195 = {&next195, &term274, nullptr};
+Node node196 = {&next196, &term300, nullptr};
+Node node197 = {&next197, &term326, nullptr};
+Node node198 = {&next198, &term352, nullptr};
+Node node199 = {&next199, &term378, nullptr};
+Node node200 = {&next200, &term39, nullptr};
+Node node201 = {&next201, &term65, nullptr};
+Node node202 = {&next202, &term91, nullptr};
+Node node203 = {&next203, &term117, nullptr};
+Node node204 = {&next204, &term143, nullptr};
+Node node205 = {&next205, &term169, nullptr};
+Node node206 = {&next206, &term195, nullptr};
+Node node207 = {&next207, &term221, nullptr};
+Node node208 = {&next208, &term247, nullptr};
+Node node209 = {&next209, &term273, nullptr};
+Node node210 = {&next210, &term299, nullptr};
+Node node211 = {&next211, &term325, nullptr};
+Node node212 = {&next212, &term351, nullptr};
+Node node213 = {&next213, &term377, nullptr};
+Node node214 = {&next214, &term38, nullptr};
+Node node215 = {&next215, &term64, nullptr};
+Node node216 = {&next216, &term90, nullptr};
+Node node217 = {&next217, &term116, nullptr};
+Node node218 = {&next218, &term142, nullptr};
+Node node219 = {&next219, &term168, nullptr};
+Node node220 = {&next220, &term194, nullptr};
+Node node221 = {&next221, &term220, nullptr};
+Node node222 = {&next222, &term246, nullptr};
+Node node223 = {&next223, &term272, nullptr};
+Node node224 = {&next224, &term298, nullptr};
+Node node225 = {&next225, &term324, nullptr};
+Node node226 = {&next226, &term350, nullptr};
+Node node227 = {&next227, &term376, nullptr};
+Node node228 = {&next228, &term37, nullptr};
+Node node229 = {&next229, &term63, nullptr};
+Node node230 = {&next230, &term89, nullptr};
+Node node231 = {&next231, &term115, nullptr};
+Node node232 = {&next232, &term141, nullptr};
+Node node233 = {&next233, &term167, nullptr};
+Node node234 = {&next234, &term193, nullptr};
+Node node235 = {&next235, &term219, nullptr};
+Node node236 = {&next236, &term245, nullptr};
+Node node237 = {&next237, &term271, nullptr};
+Node node238 = {&next238, &term297, nullptr};
+Node node239 = {&next239, &term323, nullptr};
+Node node240 = {&next240, &term349, nullptr};
+Node node241 = {&next241, &term375, nullptr};
+Node node242 = {&next242, &term36, nullptr};
+Node node243 = {&next243, &term62, nullptr};
+Node node244 = {&next244, &term88, nullptr};
+Node node245 = {&next245, &term114, nullptr};
+Node node246 = {&next246, &term140, nullptr};
+Node node247 = {&next247, &term166, nullptr};
+Node node248 = {&next248, &term192, nullptr};
+Node node249 = {&next249, &term218, nullptr};
+Node node250 = {&next250, &term244, nullptr};
+Node node251 = {&next251, &term270, nullptr};
+Node node252 = {&next252, &term296, nullptr};
+Node node253 = {&next253, &term322, nullptr};
+Node node254 = {&next254, &term348, nullptr};
+Node node255 = {&next255, &term374, nullptr};
+Node node256 = {&next256, &term35, nullptr};
+Node node257 = {&next257, &term61, nullptr};
+Node node258 = {&next258, &term87, nullptr};
+Node node259 = {&next259, &term113, nullptr};
+Node node260 = {&next260, &term139, nullptr};
+Node node261 = {&next261, &term165, nullptr};
+Node node262 = {&next262, &term191, nullptr};
+Node node263 = {&next263, &term217, nullptr};
+Node node264 = {&next264, &term243, nullptr};
+Node node265 = {&next265, &term269, nullptr};
+Node node266 = {&next266, &term295, nullptr};
+Node node267 = {&next267, &term321, nullptr};
+Node node268 = {&next268, &term347, nullptr};
+Node node269 = {&next269, &term373, nullptr};
+Node node270 = {&next270, &term399, nullptr};
+Node node271 = {&next271, &term34, nullptr};
+Node node272 = {&next272, &term60, nullptr};
+Node node273 = {&next273, &term86, nullptr};
+Node node274 = {&next274, &term112, nullptr};
+Node node275 = {&next275, &term138, nullptr};
+Node node276 = {&next276, &term164, nullptr};
+Node node277 = {&next277, &term190, nullptr};
+Node node278 = {&next278, &term216, nullptr};
+Node node279 = {&next279, &term242, nullptr};
+Node node280 = {&next280, &term268, nullptr};
+Node node281 = {&next281, &term294, nullptr};
+Node node282 = {&next282, &term320, nullptr};
+Node node283 = {&next283, &term346, nullptr};
+Node node284 = {&next284, &term372, nullptr};
+Node node285 = {&next285, &term398, nullptr};
+Node node286 = {&next286, &term33, nullptr};
+Node node287 = {&next287, &term59, nullptr};
+Node node288 = {&next288, &term85, nullptr};
+Node node289 = {&next289, &term111, nullptr};
+Node node290 = {&next290, &term137, nullptr};
+Node node291 = {&next291, &term163, nullptr};
+Node node292 = {&next292, &term189, nullptr};
+Node node293 = {&next293, &term215, nullptr};
+Node node294 = {&next294, &term241, nullptr};
+Node node295 = {&next295, &term267, nullptr};
+Node node296 = {&next296, &term293, nullptr};
+Node node297 = {&next297, &term319, nullptr};
+Node node298 = {&next298, &term345, nullptr};
+Node node299 = {&next299, &term371, nullptr};
+Node node300 = {&next300, &term397, nullptr};
+Node node301 = {&next301, &term32, nullptr};
+Node node302 = {&next302, &term58, nullptr};
+Node node303 = {&next303, &term84, nullptr};
+Node node304 = {&next304, &term110, nullptr};
+Node node305 = {&next305, &term136, nullptr};
+Node node306 = {&next306, &term162, nullptr};
+Node node307 = {&next307, &term188, nullptr};
+Node node308 = {&next308, &term214, nullptr};
+Node node309 = {&next309, &term240, nullptr};
+Node node310 = {&next310, &term266, nullptr};
+Node node311 = {&next311, &term292, nullptr};
+Node node312 = {&next312, &term318, nullptr};
+Node node313 = {&next313, &term344, nullptr};
+Node node314 = {&next314, &term370, nullptr};
+Node node315 = {&next315, &term396, nullptr};
+Node node316 = {&next316, &term31, nullptr};
+Node node317 = {&next317, &term57, nullptr};
+Node node318 = {&next318, &term83, nullptr};
+Node node319 = {&next319, &term109, nullptr};
+Node node320 = {&next320, &term135, nullptr};
+Node node321 = {&next321, &term161, nullptr};
+Node node322 = {&next322, &term187, nullptr};
+Node node323 = {&next323, &term213, nullptr};
+Node node324 = {&next324, &term239, nullptr};
+Node node325 = {&next325, &term265, nullptr};
+Node node326 = {&next326, &term291, nullptr};
+Node node327 = {&next327, &term317, nullptr};
+Node node328 = {&next328, &term343, nullptr};
+Node node329 = {&next329, &term369, nullptr};
+Node node330 = {&next330, &term395, nullptr};
+Node node331 = {&next331, &term30, nullptr};
+Node node332 = {&next332, &term56, nullptr};
+Node node333 = {&next333, &term82, nullptr};
+Node node334 = {&next334, &term108, nullptr};
+Node node335 = {&next335, &term134, nullptr};
+Node node336 = {&next336, &term160, nullptr};
+Node node337 = {&next337, &term186, nullptr};
+Node node338 = {&next338, &term212, nullptr};
+Node node339 = {&next339, &term238, nullptr};
+Node node340 = {&next340, &term264, nullptr};
+Node node341 = {&next341, &term290, nullptr};
+Node node342 = {&next342, &term316, nullptr};
+Node node343 = {&next343, &term342, nullptr};
+Node node344 = {&next344, &term368, nullptr};
+Node node345 = {&next345, &term394, nullptr};
+Node node346 = {&next346, &term29, nullptr};
+Node node347 = {&next347, &term55, nullptr};
+Node node348 = {&next348, &term81, nullptr};
+Node node349 = {&next349, &term107, nullptr};
+Node node350 = {&next350, &term133, nullptr};
+Node node351 = {&next351, &term159, nullptr};
+Node node352 = {&next352, &term185, nullptr};
+Node node353 = {&next353, &term211, nullptr};
+Node node354 = {&next354, &term237, nullptr};
+Node node355 = {&next355, &term263, nullptr};
+Node node356 = {&next356, &term289, nullptr};
+Node node357 = {&next357, &term315, nullptr};
+Node node358 = {&next358, &term341, nullptr};
+Node node359 = {&next359, &term367, nullptr};
+Node node360 = {&next360, &term393, nullptr};
+Node node361 = {&next361, &term28, nullptr};
+Node node362 = {&next362, &term54, nullptr};
+Node node363 = {&next363, &term80, nullptr};
+Node node364 = {&next364, &term106, nullptr};
+Node node365 = {&next365, &term132, nullptr};
+Node node366 = {&next366, &term158, nullptr};
+Node node367 = {&next367, &term184, nullptr};
+Node node368 = {&next368, &term210, nullptr};
+Node node369 = {&next369, &term236, nullptr};
+Node node370 = {&next370, &term262, nullptr};
+Node node371 = {&next371, &term288, nullptr};
+Node node372 = {&next372, &term314, nullptr};
+Node node373 = {&next373, &term340, nullptr};
+Node node374 = {&next374, &term366, nullptr};
+Node node375 = {&next375, &term392, nullptr};
+Node node376 = {&next376, &term27, nullptr};
+Node node377 = {&next377, &term53, nullptr};
+Node node378 = {&next378, &term79, nullptr};
+Node node379 = {&next379, &term105, nullptr};
+Node node380 = {&next380, &term131, nullptr};
+Node node381 = {&next381, &term157, nullptr};
+Node node382 = {&next382, &term183, nullptr};
+Node node383 = {&next383, &term209, nullptr};
+Node node384 = {&next384, &term235, nullptr};
+Node node385 = {&next385, &term261, nullptr};
+Node node386 = {&next386, &term287, nullptr};
+Node node387 = {&next387, &term313, nullptr};
+Node node388 = {&next388, &term339, nullptr};
+Node node389 = {&next389, &term365, nullptr};
+Node node390 = {&next390, &term391, nullptr};
+Node node391 = {&next391, &term26, nullptr};
+Node node392 = {&next392, &term52, nullptr};
+Node node393 = {&next393, &term78, nullptr};
+Node node394 = {&next394, &term104, nullptr};
+Node node395 = {&next395, &term130, nullptr};
+Node node396 = {&next396, &term156, nullptr};
+Node node397 = {&next397, &term182, nullptr};
+Node node398 = {&next398, &term208, nullptr};
+Node node399 = {&next399, &term234, nullptr};
+Node node400 = {&next400, &term260, nullptr};
+Node node401 = {&next401, &term286, nullptr};
+Node node402 = {&next402, &term312, nullptr};
+Node node403 = {&next403, &term338, nullptr};
+Node node404 = {&next404, &term364, nullptr};
+Node node405 = {&next405, &term390, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 404};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_2(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_3(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_4(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_5(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_6(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_7(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_8(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_9(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_10(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_11(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_12(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_13(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_14(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_15(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_16(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_17(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_18(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_19(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_20(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_21(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_22(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_23(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_24(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_25(Table*);
+
+Value*
+reduce_stmt_25(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_25(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_26(Table*);
+
+Value*
+reduce_stmt_26(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_26(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_27(Table*);
+
+Value*
+reduce_stmt_27(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_27(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_28(Table*);
+
+Value*
+reduce_stmt_28(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_28(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_29(Table*);
+
+Value*
+reduce_stmt_29(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_29(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_30(Table*);
+
+Value*
+reduce_stmt_30(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_30(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_31(Table*);
+
+Value*
+reduce_stmt_31(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_31(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_32(Table*);
+
+Value*
+reduce_stmt_32(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_32(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_33(Table*);
+
+Value*
+reduce_stmt_33(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_33(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_34(Table*);
+
+Value*
+reduce_stmt_34(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_34(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_35(Table*);
+
+Value*
+reduce_stmt_35(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_35(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_36(Table*);
+
+Value*
+reduce_stmt_36(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_36(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_37(Table*);
+
+Value*
+reduce_stmt_37(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_37(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_38(Table*);
+
+Value*
+reduce_stmt_38(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_38(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_39(Table*);
+
+Value*
+reduce_stmt_39(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_39(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_40(Table*);
+
+Value*
+reduce_stmt_40(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_40(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_41(Table*);
+
+Value*
+reduce_stmt_41(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_41(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_42(Table*);
+
+Value*
+reduce_stmt_42(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_42(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_43(Table*);
+
+Value*
+reduce_stmt_43(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_43(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_44(Table*);
+
+Value*
+reduce_stmt_44(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_44(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_45(Table*);
+
+Value*
+reduce_stmt_45(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_45(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_46(Table*);
+
+Value*
+reduce_stmt_46(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_46(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_47(Table*);
+
+Value*
+reduce_stmt_47(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_47(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_48(Table*);
+
+Value*
+reduce_stmt_48(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_48(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_49(Table*);
+
+Value*
+reduce_stmt_49(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_49(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_50(Table*);
+
+Value*
+reduce_stmt_50(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_50(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_51(Table*);
+
+Value*
+reduce_stmt_51(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_51(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_52(Table*);
+
+Value*
+reduce_stmt_52(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_52(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_53(Table*);
+
+Value*
+reduce_stmt_53(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_53(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_54(Table*);
+
+Value*
+reduce_stmt_54(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_54(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_55(Table*);
+
+Value*
+reduce_stmt_55(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_55(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_56(Table*);
+
+Value*
+reduce_stmt_56(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_56(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_57(Table*);
+
+Value*
+reduce_stmt_57(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_57(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_58(Table*);
+
+Value*
+reduce_stmt_58(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_58(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_59(Table*);
+
+Value*
+reduce_stmt_59(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_59(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_60(Table*);
+
+Value*
+reduce_stmt_60(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_60(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_61(Table*);
+
+Value*
+reduce_stmt_61(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_61(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_62(Table*);
+
+Value*
+reduce_stmt_62(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_62(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_63(Table*);
+
+Value*
+reduce_stmt_63(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_63(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_64(Table*);
+
+Value*
+reduce_stmt_64(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_64(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_65(Table*);
+
+Value*
+reduce_stmt_65(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_65(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_66(Table*);
+
+Value*
+reduce_stmt_66(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_66(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_67(Table*);
+
+Value*
+reduce_stmt_67(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_67(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_68(Table*);
+
+Value*
+reduce_stmt_68(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_68(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_69(Table*);
+
+Value*
+reduce_stmt_69(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_69(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_70(Table*);
+
+Value*
+reduce_stmt_70(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_70(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_71(Table*);
+
+Value*
+reduce_stmt_71(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_71(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_72(Table*);
+
+Value*
+reduce_stmt_72(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_72(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_73(Table*);
+
+Value*
+reduce_stmt_73(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_73(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_74(Table*);
+
+Value*
+reduce_stmt_74(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_74(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_75(Table*);
+
+Value*
+reduce_stmt_75(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_75(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_76(Table*);
+
+Value*
+reduce_stmt_76(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_76(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_77(Table*);
+
+Value*
+reduce_stmt_77(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_77(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_78(Table*);
+
+Value*
+reduce_stmt_78(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_78(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_79(Table*);
+
+Value*
+reduce_stmt_79(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_79(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_80(Table*);
+
+Value*
+reduce_stmt_80(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_80(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_81(Table*);
+
+Value*
+reduce_stmt_81(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_81(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_82(Table*);
+
+Value*
+reduce_stmt_82(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_82(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_83(Table*);
+
+Value*
+reduce_stmt_83(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_83(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_84(Table*);
+
+Value*
+reduce_stmt_84(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_84(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_85(Table*);
+
+Value*
+reduce_stmt_85(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_85(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_86(Table*);
+
+Value*
+reduce_stmt_86(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_86(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_87(Table*);
+
+Value*
+reduce_stmt_87(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_87(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_88(Table*);
+
+Value*
+reduce_stmt_88(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_88(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_89(Table*);
+
+Value*
+reduce_stmt_89(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_89(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_90(Table*);
+
+Value*
+reduce_stmt_90(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_90(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_91(Table*);
+
+Value*
+reduce_stmt_91(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_91(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_92(Table*);
+
+Value*
+reduce_stmt_92(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_92(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_93(Table*);
+
+Value*
+reduce_stmt_93(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_93(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_94(Table*);
+
+Value*
+reduce_stmt_94(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_94(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_95(Table*);
+
+Value*
+reduce_stmt_95(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_95(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_96(Table*);
+
+Value*
+reduce_stmt_96(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_96(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_97(Table*);
+
+Value*
+reduce_stmt_97(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_97(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_98(Table*);
+
+Value*
+reduce_stmt_98(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_98(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_99(Table*);
+
+Value*
+reduce_stmt_99(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_99(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_100(Table*);
+
+Value*
+reduce_stmt_100(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_100(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_101(Table*);
+
+Value*
+reduce_stmt_101(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_101(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_102(Table*);
+
+Value*
+reduce_stmt_102(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_102(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_103(Table*);
+
+Value*
+reduce_stmt_103(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_103(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_104(Table*);
+
+Value*
+reduce_stmt_104(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_104(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_105(Table*);
+
+Value*
+reduce_stmt_105(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_105(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_106(Table*);
+
+Value*
+reduce_stmt_106(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_106(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_107(Table*);
+
+Value*
+reduce_stmt_107(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_107(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_108(Table*);
+
+Value*
+reduce_stmt_108(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_108(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_109(Table*);
+
+Value*
+reduce_stmt_109(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_109(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_110(Table*);
+
+Value*
+reduce_stmt_110(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_110(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_111(Table*);
+
+Value*
+reduce_stmt_111(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_111(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_112(Table*);
+
+Value*
+reduce_stmt_112(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_112(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_113(Table*);
+
+Value*
+reduce_stmt_113(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_113(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_114(Table*);
+
+Value*
+reduce_stmt_114(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_114(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_115(Table*);
+
+Value*
+reduce_stmt_115(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_115(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_116(Table*);
+
+Value*
+reduce_stmt_116(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_116(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_117(Table*);
+
+Value*
+reduce_stmt_117(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_117(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_118(Table*);
+
+Value*
+reduce_stmt_118(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_118(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_119(Table*);
+
+Value*
+reduce_stmt_119(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_119(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_120(Table*);
+
+Value*
+reduce_stmt_120(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_120(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_121(Table*);
+
+Value*
+reduce_stmt_121(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_121(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_122(Table*);
+
+Value*
+reduce_stmt_122(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_122(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_123(Table*);
+
+Value*
+reduce_stmt_123(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_123(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_124(Table*);
+
+Value*
+reduce_stmt_124(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_124(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_125(Table*);
+
+Value*
+reduce_stmt_125(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_125(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_126(Table*);
+
+Value*
+reduce_stmt_126(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_126(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_127(Table*);
+
+Value*
+reduce_stmt_127(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_127(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_128(Table*);
+
+Value*
+reduce_stmt_128(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_128(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_129(Table*);
+
+Value*
+reduce_stmt_129(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_129(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_130(Table*);
+
+Value*
+reduce_stmt_130(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_130(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_131(Table*);
+
+Value*
+reduce_stmt_131(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_131(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_132(Table*);
+
+Value*
+reduce_stmt_132(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_132(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_133(Table*);
+
+Value*
+reduce_stmt_133(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_133(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_134(Table*);
+
+Value*
+reduce_stmt_134(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_134(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_135(Table*);
+
+Value*
+reduce_stmt_135(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_135(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_136(Table*);
+
+Value*
+reduce_stmt_136(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_136(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_137(Table*);
+
+Value*
+reduce_stmt_137(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_137(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_138(Table*);
+
+Value*
+reduce_stmt_138(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_138(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_139(Table*);
+
+Value*
+reduce_stmt_139(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_139(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_140(Table*);
+
+Value*
+reduce_stmt_140(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_140(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_141(Table*);
+
+Value*
+reduce_stmt_141(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_141(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_142(Table*);
+
+Value*
+reduce_stmt_142(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_142(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_143(Table*);
+
+Value*
+reduce_stmt_143(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_143(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_144(Table*);
+
+Value*
+reduce_stmt_144(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_144(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_145(Table*);
+
+Value*
+reduce_stmt_145(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_145(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_146(Table*);
+
+Value*
+reduce_stmt_146(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_146(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_147(Table*);
+
+Value*
+reduce_stmt_147(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_147(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_148(Table*);
+
+Value*
+reduce_stmt_148(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_148(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_149(Table*);
+
+Value*
+reduce_stmt_149(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_149(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_150(Table*);
+
+Value*
+reduce_stmt_150(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_150(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_151(Table*);
+
+Value*
+reduce_stmt_151(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_151(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_152(Table*);
+
+Value*
+reduce_stmt_152(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_152(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_153(Table*);
+
+Value*
+reduce_stmt_153(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_153(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_154(Table*);
+
+Value*
+reduce_stmt_154(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_154(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_155(Table*);
+
+Value*
+reduce_stmt_155(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_155(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_156(Table*);
+
+Value*
+reduce_stmt_156(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_156(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_157(Table*);
+
+Value*
+reduce_stmt_157(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_157(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_158(Table*);
+
+Value*
+reduce_stmt_158(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_158(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_159(Table*);
+
+Value*
+reduce_stmt_159(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_159(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_160(Table*);
+
+Value*
+reduce_stmt_160(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_160(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_161(Table*);
+
+Value*
+reduce_stmt_161(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_161(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_162(Table*);
+
+Value*
+reduce_stmt_162(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_162(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_163(Table*);
+
+Value*
+reduce_stmt_163(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_163(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_164(Table*);
+
+Value*
+reduce_stmt_164(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_164(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_165(Table*);
+
+Value*
+reduce_stmt_165(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_165(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_166(Table*);
+
+Value*
+reduce_stmt_166(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_166(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_167(Table*);
+
+Value*
+reduce_stmt_167(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_167(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_168(Table*);
+
+Value*
+reduce_stmt_168(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_168(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_169(Table*);
+
+Value*
+reduce_stmt_169(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_169(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_170(Table*);
+
+Value*
+reduce_stmt_170(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_170(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_171(Table*);
+
+Value*
+reduce_stmt_171(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_171(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_172(Table*);
+
+Value*
+reduce_stmt_172(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_172(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_173(Table*);
+
+Value*
+reduce_stmt_173(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_173(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_174(Table*);
+
+Value*
+reduce_stmt_174(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_174(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_175(Table*);
+
+Value*
+reduce_stmt_175(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_175(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_176(Table*);
+
+Value*
+reduce_stmt_176(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_176(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_177(Table*);
+
+Value*
+reduce_stmt_177(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_177(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_178(Table*);
+
+Value*
+reduce_stmt_178(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_178(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_179(Table*);
+
+Value*
+reduce_stmt_179(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_179(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_180(Table*);
+
+Value*
+reduce_stmt_180(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_180(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_181(Table*);
+
+Value*
+reduce_stmt_181(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_181(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_182(Table*);
+
+Value*
+reduce_stmt_182(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_182(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_183(Table*);
+
+Value*
+reduce_stmt_183(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_183(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_184(Table*);
+
+Value*
+reduce_stmt_184(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_184(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_185(Table*);
+
+Value*
+reduce_stmt_185(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_185(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_186(Table*);
+
+Value*
+reduce_stmt_186(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_186(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_187(Table*);
+
+Value*
+reduce_stmt_187(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_187(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_188(Table*);
+
+Value*
+reduce_stmt_188(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_188(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_189(Table*);
+
+Value*
+reduce_stmt_189(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_189(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_190(Table*);
+
+Value*
+reduce_stmt_190(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_190(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_191(Table*);
+
+Value*
+reduce_stmt_191(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_191(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_192(Table*);
+
+Value*
+reduce_stmt_192(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_192(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_193(Table*);
+
+Value*
+reduce_stmt_193(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_193(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_194(Table*);
+
+Value*
+reduce_stmt_194(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_194(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_195(Table*);
+
+Value*
+reduce_stmt_195(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_195(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_196(Table*);
+
+Value*
+reduce_stmt_196(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_196(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_197(Table*);
+
+Value*
+reduce_stmt_197(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_197(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_198(Table*);
+
+Value*
+reduce_stmt_198(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_198(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_199(Table*);
+
+Value*
+reduce_stmt_199(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_199(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_200(Table*);
+
+Value*
+reduce_stmt_200(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_200(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_201(Table*);
+
+Value*
+reduce_stmt_201(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_201(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_202(Table*);
+
+Value*
+reduce_stmt_202(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_202(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_203(Table*);
+
+Value*
+reduce_stmt_203(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_203(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_204(Table*);
+
+Value*
+reduce_stmt_204(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_204(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_205(Table*);
+
+Value*
+reduce_stmt_205(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_205(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_206(Table*);
+
+Value*
+reduce_stmt_206(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_206(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_207(Table*);
+
+Value*
+reduce_stmt_207(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_207(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_208(Table*);
+
+Value*
+reduce_stmt_208(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_208(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_209(Table*);
+
+Value*
+reduce_stmt_209(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_209(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_210(Table*);
+
+Value*
+reduce_stmt_210(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_210(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_211(Table*);
+
+Value*
+reduce_stmt_211(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_211(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_212(Table*);
+
+Value*
+reduce_stmt_212(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_212(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_213(Table*);
+
+Value*
+reduce_stmt_213(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_213(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_214(Table*);
+
+Value*
+reduce_stmt_214(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_214(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_215(Table*);
+
+Value*
+reduce_stmt_215(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_215(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_216(Table*);
+
+Value*
+reduce_stmt_216(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_216(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_217(Table*);
+
+Value*
+reduce_stmt_217(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_217(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_218(Table*);
+
+Value*
+reduce_stmt_218(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_218(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_219(Table*);
+
+Value*
+reduce_stmt_219(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_219(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_220(Table*);
+
+Value*
+reduce_stmt_220(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_220(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_221(Table*);
+
+Value*
+reduce_stmt_221(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_221(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_222(Table*);
+
+Value*
+reduce_stmt_222(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_222(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_223(Table*);
+
+Value*
+reduce_stmt_223(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_223(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_224(Table*);
+
+Value*
+reduce_stmt_224(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_224(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_225(Table*);
+
+Value*
+reduce_stmt_225(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_225(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_226(Table*);
+
+Value*
+reduce_stmt_226(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_226(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_227(Table*);
+
+Value*
+reduce_stmt_227(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_227(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_228(Table*);
+
+Value*
+reduce_stmt_228(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_228(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_229(Table*);
+
+Value*
+reduce_stmt_229(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_229(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_230(Table*);
+
+Value*
+reduce_stmt_230(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_230(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_231(Table*);
+
+Value*
+reduce_stmt_231(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_231(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_232(Table*);
+
+Value*
+reduce_stmt_232(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_232(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_233(Table*);
+
+Value*
+reduce_stmt_233(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_233(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_234(Table*);
+
+Value*
+reduce_stmt_234(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_234(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_235(Table*);
+
+Value*
+reduce_stmt_235(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_235(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_236(Table*);
+
+Value*
+reduce_stmt_236(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_236(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_237(Table*);
+
+Value*
+reduce_stmt_237(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_237(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_238(Table*);
+
+Value*
+reduce_stmt_238(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_238(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_239(Table*);
+
+Value*
+reduce_stmt_239(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_239(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_240(Table*);
+
+Value*
+reduce_stmt_240(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_240(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_241(Table*);
+
+Value*
+reduce_stmt_241(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_241(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_242(Table*);
+
+Value*
+reduce_stmt_242(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_242(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_243(Table*);
+
+Value*
+reduce_stmt_243(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_243(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_244(Table*);
+
+Value*
+reduce_stmt_244(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_244(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_245(Table*);
+
+Value*
+reduce_stmt_245(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_245(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_246(Table*);
+
+Value*
+reduce_stmt_246(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_246(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_247(Table*);
+
+Value*
+reduce_stmt_247(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_247(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_248(Table*);
+
+Value*
+reduce_stmt_248(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_248(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_249(Table*);
+
+Value*
+reduce_stmt_249(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_249(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_250(Table*);
+
+Value*
+reduce_stmt_250(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_250(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_251(Table*);
+
+Value*
+reduce_stmt_251(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_251(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_252(Table*);
+
+Value*
+reduce_stmt_252(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_252(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_253(Table*);
+
+Value*
+reduce_stmt_253(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_253(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_254(Table*);
+
+Value*
+reduce_stmt_254(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_254(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_255(Table*);
+
+Value*
+reduce_stmt_255(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_255(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_256(Table*);
+
+Value*
+reduce_stmt_256(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_256(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_257(Table*);
+
+Value*
+reduce_stmt_257(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_257(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_258(Table*);
+
+Value*
+reduce_stmt_258(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_258(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_259(Table*);
+
+Value*
+reduce_stmt_259(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_259(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_260(Table*);
+
+Value*
+reduce_stmt_260(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_260(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_261(Table*);
+
+Value*
+reduce_stmt_261(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_261(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_262(Table*);
+
+Value*
+reduce_stmt_262(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_262(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_263(Table*);
+
+Value*
+reduce_stmt_263(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_263(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_264(Table*);
+
+Value*
+reduce_stmt_264(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_264(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_265(Table*);
+
+Value*
+reduce_stmt_265(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_265(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_266(Table*);
+
+Value*
+reduce_stmt_266(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_266(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_267(Table*);
+
+Value*
+reduce_stmt_267(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_267(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_268(Table*);
+
+Value*
+reduce_stmt_268(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_268(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_269(Table*);
+
+Value*
+reduce_stmt_269(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_269(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_270(Table*);
+
+Value*
+reduce_stmt_270(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_270(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_271(Table*);
+
+Value*
+reduce_stmt_271(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_271(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_272(Table*);
+
+Value*
+reduce_stmt_272(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_272(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_273(Table*);
+
+Value*
+reduce_stmt_273(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_273(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_274(Table*);
+
+Value*
+reduce_stmt_274(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_274(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_275(Table*);
+
+Value*
+reduce_stmt_275(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_275(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_276(Table*);
+
+Value*
+reduce_stmt_276(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_276(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_277(Table*);
+
+Value*
+reduce_stmt_277(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_277(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_278(Table*);
+
+Value*
+reduce_stmt_278(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_278(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_279(Table*);
+
+Value*
+reduce_stmt_279(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_279(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_280(Table*);
+
+Value*
+reduce_stmt_280(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_280(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_281(Table*);
+
+Value*
+reduce_stmt_281(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_281(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_282(Table*);
+
+Value*
+reduce_stmt_282(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_282(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_283(Table*);
+
+Value*
+reduce_stmt_283(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_283(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_284(Table*);
+
+Value*
+reduce_stmt_284(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_284(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_285(Table*);
+
+Value*
+reduce_stmt_285(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_285(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_286(Table*);
+
+Value*
+reduce_stmt_286(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_286(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_287(Table*);
+
+Value*
+reduce_stmt_287(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_287(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_288(Table*);
+
+Value*
+reduce_stmt_288(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_288(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_289(Table*);
+
+Value*
+reduce_stmt_289(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_289(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_290(Table*);
+
+Value*
+reduce_stmt_290(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_290(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_291(Table*);
+
+Value*
+reduce_stmt_291(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_291(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_292(Table*);
+
+Value*
+reduce_stmt_292(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_292(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_293(Table*);
+
+Value*
+reduce_stmt_293(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_293(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_294(Table*);
+
+Value*
+reduce_stmt_294(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_294(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_295(Table*);
+
+Value*
+reduce_stmt_295(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_295(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_296(Table*);
+
+Value*
+reduce_stmt_296(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_296(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_297(Table*);
+
+Value*
+reduce_stmt_297(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_297(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_298(Table*);
+
+Value*
+reduce_stmt_298(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_298(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_299(Table*);
+
+Value*
+reduce_stmt_299(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_299(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_300(Table*);
+
+Value*
+reduce_stmt_300(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_300(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_301(Table*);
+
+Value*
+reduce_stmt_301(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_301(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_302(Table*);
+
+Value*
+reduce_stmt_302(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_302(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_303(Table*);
+
+Value*
+reduce_stmt_303(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_303(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_304(Table*);
+
+Value*
+reduce_stmt_304(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_304(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_305(Table*);
+
+Value*
+reduce_stmt_305(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_305(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_306(Table*);
+
+Value*
+reduce_stmt_306(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_306(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_307(Table*);
+
+Value*
+reduce_stmt_307(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_307(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_308(Table*);
+
+Value*
+reduce_stmt_308(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_308(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_309(Table*);
+
+Value*
+reduce_stmt_309(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_309(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_310(Table*);
+
+Value*
+reduce_stmt_310(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_310(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_311(Table*);
+
+Value*
+reduce_stmt_311(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_311(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_312(Table*);
+
+Value*
+reduce_stmt_312(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_312(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_313(Table*);
+
+Value*
+reduce_stmt_313(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_313(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_314(Table*);
+
+Value*
+reduce_stmt_314(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_314(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_315(Table*);
+
+Value*
+reduce_stmt_315(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_315(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_316(Table*);
+
+Value*
+reduce_stmt_316(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_316(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_317(Table*);
+
+Value*
+reduce_stmt_317(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_317(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_318(Table*);
+
+Value*
+reduce_stmt_318(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_318(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_319(Table*);
+
+Value*
+reduce_stmt_319(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_319(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_320(Table*);
+
+Value*
+reduce_stmt_320(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_320(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_321(Table*);
+
+Value*
+reduce_stmt_321(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_321(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_322(Table*);
+
+Value*
+reduce_stmt_322(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_322(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_323(Table*);
+
+Value*
+reduce_stmt_323(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_323(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_324(Table*);
+
+Value*
+reduce_stmt_324(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_324(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_325(Table*);
+
+Value*
+reduce_stmt_325(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_325(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_326(Table*);
+
+Value*
+reduce_stmt_326(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_326(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_327(Table*);
+
+Value*
+reduce_stmt_327(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_327(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_328(Table*);
+
+Value*
+reduce_stmt_328(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_328(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_329(Table*);
+
+Value*
+reduce_stmt_329(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_329(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_330(Table*);
+
+Value*
+reduce_stmt_330(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_330(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_331(Table*);
+
+Value*
+reduce_stmt_331(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_331(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_332(Table*);
+
+Value*
+reduce_stmt_332(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_332(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_333(Table*);
+
+Value*
+reduce_stmt_333(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_333(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_334(Table*);
+
+Value*
+reduce_stmt_334(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_334(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_335(Table*);
+
+Value*
+reduce_stmt_335(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_335(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_336(Table*);
+
+Value*
+reduce_stmt_336(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_336(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_337(Table*);
+
+Value*
+reduce_stmt_337(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_337(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_338(Table*);
+
+Value*
+reduce_stmt_338(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_338(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_339(Table*);
+
+Value*
+reduce_stmt_339(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_339(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_340(Table*);
+
+Value*
+reduce_stmt_340(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_340(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_341(Table*);
+
+Value*
+reduce_stmt_341(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_341(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_342(Table*);
+
+Value*
+reduce_stmt_342(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_342(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_343(Table*);
+
+Value*
+reduce_stmt_343(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_343(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_344(Table*);
+
+Value*
+reduce_stmt_344(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_344(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_345(Table*);
+
+Value*
+reduce_stmt_345(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_345(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_346(Table*);
+
+Value*
+reduce_stmt_346(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_346(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_347(Table*);
+
+Value*
+reduce_stmt_347(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_347(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_348(Table*);
+
+Value*
+reduce_stmt_348(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_348(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_349(Table*);
+
+Value*
+reduce_stmt_349(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_349(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_350(Table*);
+
+Value*
+reduce_stmt_350(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_350(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_351(Table*);
+
+Value*
+reduce_stmt_351(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_351(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_352(Table*);
+
+Value*
+reduce_stmt_352(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_352(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_353(Table*);
+
+Value*
+reduce_stmt_353(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_353(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_354(Table*);
+
+Value*
+reduce_stmt_354(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_354(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_355(Table*);
+
+Value*
+reduce_stmt_355(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_355(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_356(Table*);
+
+Value*
+reduce_stmt_356(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_356(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_357(Table*);
+
+Value*
+reduce_stmt_357(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_357(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_358(Table*);
+
+Value*
+reduce_stmt_358(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_358(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_359(Table*);
+
+Value*
+reduce_stmt_359(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_359(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_360(Table*);
+
+Value*
+reduce_stmt_360(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_360(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_361(Table*);
+
+Value*
+reduce_stmt_361(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_361(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_362(Table*);
+
+Value*
+reduce_stmt_362(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_362(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_363(Table*);
+
+Value*
+reduce_stmt_363(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_363(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_364(Table*);
+
+Value*
+reduce_stmt_364(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_364(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_365(Table*);
+
+Value*
+reduce_stmt_365(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_365(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_366(Table*);
+
+Value*
+reduce_stmt_366(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_366(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_367(Table*);
+
+Value*
+reduce_stmt_367(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_367(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_368(Table*);
+
+Value*
+reduce_stmt_368(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_368(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_369(Table*);
+
+Value*
+reduce_stmt_369(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_369(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_370(Table*);
+
+Value*
+reduce_stmt_370(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_370(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_371(Table*);
+
+Value*
+reduce_stmt_371(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_371(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_372(Table*);
+
+Value*
+reduce_stmt_372(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_372(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_373(Table*);
+
+Value*
+reduce_stmt_373(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_373(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_374(Table*);
+
+Value*
+reduce_stmt_374(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_374(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_375(Table*);
+
+Value*
+reduce_stmt_375(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_375(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_376(Table*);
+
+Value*
+reduce_stmt_376(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_376(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_377(Table*);
+
+Value*
+reduce_stmt_377(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_377(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_378(Table*);
+
+Value*
+reduce_stmt_378(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_378(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_379(Table*);
+
+Value*
+reduce_stmt_379(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_379(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_380(Table*);
+
+Value*
+reduce_stmt_380(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_380(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_381(Table*);
+
+Value*
+reduce_stmt_381(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_381(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_382(Table*);
+
+Value*
+reduce_stmt_382(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_382(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_383(Table*);
+
+Value*
+reduce_stmt_383(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_383(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_384(Table*);
+
+Value*
+reduce_stmt_384(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_384(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_385(Table*);
+
+Value*
+reduce_stmt_385(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_385(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_386(Table*);
+
+Value*
+reduce_stmt_386(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_386(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_387(Table*);
+
+Value*
+reduce_stmt_387(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_387(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_388(Table*);
+
+Value*
+reduce_stmt_388(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_388(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_389(Table*);
+
+Value*
+reduce_stmt_389(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_389(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_390(Table*);
+
+Value*
+reduce_stmt_390(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_390(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_391(Table*);
+
+Value*
+reduce_stmt_391(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_391(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_392(Table*);
+
+Value*
+reduce_stmt_392(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_392(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_393(Table*);
+
+Value*
+reduce_stmt_393(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_393(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_394(Table*);
+
+Value*
+reduce_stmt_394(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_394(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_395(Table*);
+
+Value*
+reduce_stmt_395(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_395(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_396(Table*);
+
+Value*
+reduce_stmt_396(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_396(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_397(Table*);
+
+Value*
+reduce_stmt_397(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_397(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_398(Table*);
+
+Value*
+reduce_stmt_398(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_398(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_399(Table*);
+
+Value*
+reduce_stmt_399(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_399(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 3, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 3, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 3, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 3, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 3, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 3, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 3, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 3, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 3, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 3, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 3, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 3, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 3, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 3, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 3, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 3, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 3, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 3, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 3, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 3, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 3, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 3, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 3, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm2, 3, &reduce_stmt_25, -1};
+Rule rule29 = {&nonterm2, 3, &reduce_stmt_26, -1};
+Rule rule30 = {&nonterm2, 3, &reduce_stmt_27, -1};
+Rule rule31 = {&nonterm2, 3, &reduce_stmt_28, -1};
+Rule rule32 = {&nonterm2, 3, &reduce_stmt_29, -1};
+Rule rule33 = {&nonterm2, 3, &reduce_stmt_30, -1};
+Rule rule34 = {&nonterm2, 3, &reduce_stmt_31, -1};
+Rule rule35 = {&nonterm2, 3, &reduce_stmt_32, -1};
+Rule rule36 = {&nonterm2, 3, &reduce_stmt_33, -1};
+Rule rule37 = {&nonterm2, 3, &reduce_stmt_34, -1};
+Rule rule38 = {&nonterm2, 3, &reduce_stmt_35, -1};
+Rule rule39 = {&nonterm2, 3, &reduce_stmt_36, -1};
+Rule rule40 = {&nonterm2, 3, &reduce_stmt_37, -1};
+Rule rule41 = {&nonterm2, 3, &reduce_stmt_38, -1};
+Rule rule42 = {&nonterm2, 3, &reduce_stmt_39, -1};
+Rule rule43 = {&nonterm2, 3, &reduce_stmt_40, -1};
+Rule rule44 = {&nonterm2, 3, &reduce_stmt_41, -1};
+Rule rule45 = {&nonterm2, 3, &reduce_stmt_42, -1};
+Rule rule46 = {&nonterm2, 3, &reduce_stmt_43, -1};
+Rule rule47 = {&nonterm2, 3, &reduce_stmt_44, -1};
+Rule rule48 = {&nonterm2, 3, &reduce_stmt_45, -1};
+Rule rule49 = {&nonterm2, 3, &reduce_stmt_46, -1};
+Rule rule50 = {&nonterm2, 3, &reduce_stmt_47, -1};
+Rule rule51 = {&nonterm2, 3, &reduce_stmt_48, -1};
+Rule rule52 = {&nonterm2, 3, &reduce_stmt_49, -1};
+Rule rule53 = {&nonterm2, 3, &reduce_stmt_50, -1};
+Rule rule54 = {&nonterm2, 3, &reduce_stmt_51, -1};
+Rule rule55 = {&nonterm2, 3, &reduce_stmt_52, -1};
+Rule rule56 = {&nonterm2, 3, &reduce_stmt_53, -1};
+Rule rule57 = {&nonterm2, 3, &reduce_stmt_54, -1};
+Rule rule58 = {&nonterm2, 3, &reduce_stmt_55, -1};
+Rule rule59 = {&nonterm2, 3, &reduce_stmt_56, -1};
+Rule rule60 = {&nonterm2, 3, &reduce_stmt_57, -1};
+Rule rule61 = {&nonterm2, 3, &reduce_stmt_58, -1};
+Rule rule62 = {&nonterm2, 3, &reduce_stmt_59, -1};
+Rule rule63 = {&nonterm2, 3, &reduce_stmt_60, -1};
+Rule rule64 = {&nonterm2, 3, &reduce_stmt_61, -1};
+Rule rule65 = {&nonterm2, 3, &reduce_stmt_62, -1};
+Rule rule66 = {&nonterm2, 3, &reduce_stmt_63, -1};
+Rule rule67 = {&nonterm2, 3, &reduce_stmt_64, -1};
+Rule rule68 = {&nonterm2, 3, &reduce_stmt_65, -1};
+Rule rule69 = {&nonterm2, 3, &reduce_stmt_66, -1};
+Rule rule70 = {&nonterm2, 3, &reduce_stmt_67, -1};
+Rule rule71 = {&nonterm2, 3, &reduce_stmt_68, -1};
+Rule rule72 = {&nonterm2, 3, &reduce_stmt_69, -1};
+Rule rule73 = {&nonterm2, 3, &reduce_stmt_70, -1};
+Rule rule74 = {&nonterm2, 3, &reduce_stmt_71, -1};
+Rule rule75 = {&nonterm2, 3, &reduce_stmt_72, -1};
+Rule rule76 = {&nonterm2, 3, &reduce_stmt_73, -1};
+Rule rule77 = {&nonterm2, 3, &reduce_stmt_74, -1};
+Rule rule78 = {&nonterm2, 3, &reduce_stmt_75, -1};
+Rule rule79 = {&nonterm2, 3, &reduce_stmt_76, -1};
+Rule rule80 = {&nonterm2, 3, &reduce_stmt_77, -1};
+Rule rule81 = {&nonterm2, 3, &reduce_stmt_78, -1};
+Rule rule82 = {&nonterm2, 3, &reduce_stmt_79, -1};
+Rule rule83 = {&nonterm2, 3, &reduce_stmt_80, -1};
+Rule rule84 = {&nonterm2, 3, &reduce_stmt_81, -1};
+Rule rule85 = {&nonterm2, 3, &reduce_stmt_82, -1};
+Rule rule86 = {&nonterm2, 3, &reduce_stmt_83, -1};
+Rule rule87 = {&nonterm2, 3, &reduce_stmt_84, -1};
+Rule rule88 = {&nonterm2, 3, &reduce_stmt_85, -1};
+Rule rule89 = {&nonterm2, 3, &reduce_stmt_86, -1};
+Rule rule90 = {&nonterm2, 3, &reduce_stmt_87, -1};
+Rule rule91 = {&nonterm2, 3, &reduce_stmt_88, -1};
+Rule rule92 = {&nonterm2, 3, &reduce_stmt_89, -1};
+Rule rule93 = {&nonterm2, 3, &reduce_stmt_90, -1};
+Rule rule94 = {&nonterm2, 3, &reduce_stmt_91, -1};
+Rule rule95 = {&nonterm2, 3, &reduce_stmt_92, -1};
+Rule rule96 = {&nonterm2, 3, &reduce_stmt_93, -1};
+Rule rule97 = {&nonterm2, 3, &reduce_stmt_94, -1};
+Rule rule98 = {&nonterm2, 3, &reduce_stmt_95, -1};
+Rule rule99 = {&nonterm2, 3, &reduce_stmt_96, -1};
+Rule rule100 = {&nonterm2, 3, &reduce_stmt_97, -1};
+Rule rule101 = {&nonterm2, 3, &reduce_stmt_98, -1};
+Rule rule102 = {&nonterm2, 3, &reduce_stmt_99, -1};
+Rule rule103 = {&nonterm2, 3, &reduce_stmt_100, -1};
+Rule rule104 = {&nonterm2, 3, &reduce_stmt_101, -1};
+Rule rule105 = {&nonterm2, 3, &reduce_stmt_102, -1};
+Rule rule106 = {&nonterm2, 3, &reduce_stmt_103, -1};
+Rule rule107 = {&nonterm2, 3, &reduce_stmt_104, -1};
+Rule rule108 = {&nonterm2, 3, &reduce_stmt_105, -1};
+Rule rule109 = {&nonterm2, 3, &reduce_stmt_106, -1};
+Rule rule110 = {&nonterm2, 3, &reduce_stmt_107, -1};
+Rule rule111 = {&nonterm2, 3, &reduce_stmt_108, -1};
+Rule rule112 = {&nonterm2, 3, &reduce_stmt_109, -1};
+Rule rule113 = {&nonterm2, 3, &reduce_stmt_110, -1};
+Rule rule114 = {&nonterm2, 3, &reduce_stmt_111, -1};
+Rule rule115 = {&nonterm2, 3, &reduce_stmt_112, -1};
+Rule rule116 = {&nonterm2, 3, &reduce_stmt_113, -1};
+Rule rule117 = {&nonterm2, 3, &reduce_stmt_114, -1};
+Rule rule118 = {&nonterm2, 3, &reduce_stmt_115, -1};
+Rule rule119 = {&nonterm2, 3, &reduce_stmt_116, -1};
+Rule rule120 = {&nonterm2, 3, &reduce_stmt_117, -1};
+Rule rule121 = {&nonterm2, 3, &reduce_stmt_118, -1};
+Rule rule122 = {&nonterm2, 3, &reduce_stmt_119, -1};
+Rule rule123 = {&nonterm2, 3, &reduce_stmt_120, -1};
+Rule rule124 = {&nonterm2, 3, &reduce_stmt_121, -1};
+Rule rule125 = {&nonterm2, 3, &reduce_stmt_122, -1};
+Rule rule126 = {&nonterm2, 3, &reduce_stmt_123, -1};
+Rule rule127 = {&nonterm2, 3, &reduce_stmt_124, -1};
+Rule rule128 = {&nonterm2, 3, &reduce_stmt_125, -1};
+Rule rule129 = {&nonterm2, 3, &reduce_stmt_126, -1};
+Rule rule130 = {&nonterm2, 3, &reduce_stmt_127, -1};
+Rule rule131 = {&nonterm2, 3, &reduce_stmt_128, -1};
+Rule rule132 = {&nonterm2, 3, &reduce_stmt_129, -1};
+Rule rule133 = {&nonterm2, 3, &reduce_stmt_130, -1};
+Rule rule134 = {&nonterm2, 3, &reduce_stmt_131, -1};
+Rule rule135 = {&nonterm2, 3, &reduce_stmt_132, -1};
+Rule rule136 = {&nonterm2, 3, &reduce_stmt_133, -1};
+Rule rule137 = {&nonterm2, 3, &reduce_stmt_134, -1};
+Rule rule138 = {&nonterm2, 3, &reduce_stmt_135, -1};
+Rule rule139 = {&nonterm2, 3, &reduce_stmt_136, -1};
+Rule rule140 = {&nonterm2, 3, &reduce_stmt_137, -1};
+Rule rule141 = {&nonterm2, 3, &reduce_stmt_138, -1};
+Rule rule142 = {&nonterm2, 3, &reduce_stmt_139, -1};
+Rule rule143 = {&nonterm2, 3, &reduce_stmt_140, -1};
+Rule rule144 = {&nonterm2, 3, &reduce_stmt_141, -1};
+Rule rule145 = {&nonterm2, 3, &reduce_stmt_142, -1};
+Rule rule146 = {&nonterm2, 3, &reduce_stmt_143, -1};
+Rule rule147 = {&nonterm2, 3, &reduce_stmt_144, -1};
+Rule rule148 = {&nonterm2, 3, &reduce_stmt_145, -1};
+Rule rule149 = {&nonterm2, 3, &reduce_stmt_146, -1};
+Rule rule150 = {&nonterm2, 3, &reduce_stmt_147, -1};
+Rule rule151 = {&nonterm2, 3, &reduce_stmt_148, -1};
+Rule rule152 = {&nonterm2, 3, &reduce_stmt_149, -1};
+Rule rule153 = {&nonterm2, 3, &reduce_stmt_150, -1};
+Rule rule154 = {&nonterm2, 3, &reduce_stmt_151, -1};
+Rule rule155 = {&nonterm2, 3, &reduce_stmt_152, -1};
+Rule rule156 = {&nonterm2, 3, &reduce_stmt_153, -1};
+Rule rule157 = {&nonterm2, 3, &reduce_stmt_154, -1};
+Rule rule158 = {&nonterm2, 3, &reduce_stmt_155, -1};
+Rule rule159 = {&nonterm2, 3, &reduce_stmt_156, -1};
+Rule rule160 = {&nonterm2, 3, &reduce_stmt_157, -1};
+Rule rule161 = {&nonterm2, 3, &reduce_stmt_158, -1};
+Rule rule162 = {&nonterm2, 3, &reduce_stmt_159, -1};
+Rule rule163 = {&nonterm2, 3, &reduce_stmt_160, -1};
+Rule rule164 = {&nonterm2, 3, &reduce_stmt_161, -1};
+Rule rule165 = {&nonterm2, 3, &reduce_stmt_162, -1};
+Rule rule166 = {&nonterm2, 3, &reduce_stmt_163, -1};
+Rule rule167 = {&nonterm2, 3, &reduce_stmt_164, -1};
+Rule rule168 = {&nonterm2, 3, &reduce_stmt_165, -1};
+Rule rule169 = {&nonterm2, 3, &reduce_stmt_166, -1};
+Rule rule170 = {&nonterm2, 3, &reduce_stmt_167, -1};
+Rule rule171 = {&nonterm2, 3, &reduce_stmt_168, -1};
+Rule rule172 = {&nonterm2, 3, &reduce_stmt_169, -1};
+Rule rule173 = {&nonterm2, 3, &reduce_stmt_170, -1};
+Rule rule174 = {&nonterm2, 3, &reduce_stmt_171, -1};
+Rule rule175 = {&nonterm2, 3, &reduce_stmt_172, -1};
+Rule rule176 = {&nonterm2, 3, &reduce_stmt_173, -1};
+Rule rule177 = {&nonterm2, 3, &reduce_stmt_174, -1};
+Rule rule178 = {&nonterm2, 3, &reduce_stmt_175, -1};
+Rule rule179 = {&nonterm2, 3, &reduce_stmt_176, -1};
+Rule rule180 = {&nonterm2, 3, &reduce_stmt_177, -1};
+Rule rule181 = {&nonterm2, 3, &reduce_stmt_178, -1};
+Rule rule182 = {&nonterm2, 3, &reduce_stmt_179, -1};
+Rule rule183 = {&nonterm2, 3, &reduce_stmt_180, -1};
+Rule rule184 = {&nonterm2, 3, &reduce_stmt_181, -1};
+Rule rule185 = {&nonterm2, 3, &reduce_stmt_182, -1};
+Rule rule186 = {&nonterm2, 3, &reduce_stmt_183, -1};
+Rule rule187 = {&nonterm2, 3, &reduce_stmt_184, -1};
+Rule rule188 = {&nonterm2, 3, &reduce_stmt_185, -1};
+Rule rule189 = {&nonterm2, 3, &reduce_stmt_186, -1};
+Rule rule190 = {&nonterm2, 3, &reduce_stmt_187, -1};
+Rule rule191 = {&nonterm2, 3, &reduce_stmt_188, -1};
+Rule rule192 = {&nonterm2, 3, &reduce_stmt_189, -1};
+Rule rule193 = {&nonterm2, 3, &reduce_stmt_190, -1};
+Rule rule194 = {&nonterm2, 3, &reduce_stmt_191, -1};
+Rule rule195 = {&nonterm2, 3, &reduce_stmt_192, -1};
+Rule rule196 = {&nonterm2, 3, &reduce_stmt_193, -1};
+Rule rule197 = {&nonterm2, 3, &reduce_stmt_194, -1};
+Rule rule198 = {&nonterm2, 3, &reduce_stmt_195, -1};
+Rule rule199 = {&nonterm2, 3, &reduce_stmt_196, -1};
+Rule rule200 = {&nonterm2, 3, &reduce_stmt_197, -1};
+Rule rule201 = {&nonterm2, 3, &reduce_stmt_198, -1};
+Rule rule202 = {&nonterm2, 3, &reduce_stmt_199, -1};
+Rule rule203 = {&nonterm2, 3, &reduce_stmt_200, -1};
+Rule rule204 = {&nonterm2, 3, &reduce_stmt_201, -1};
+Rule rule205 = {&nonterm2, 3, &reduce_stmt_202, -1};
+Rule rule206 = {&nonterm2, 3, &reduce_stmt_203, -1};
+Rule rule207 = {&nonterm2, 3, &reduce_stmt_204, -1};
+Rule rule208 = {&nonterm2, 3, &reduce_stmt_205, -1};
+Rule rule209 = {&nonterm2, 3, &reduce_stmt_206, -1};
+Rule rule210 = {&nonterm2, 3, &reduce_stmt_207, -1};
+Rule rule211 = {&nonterm2, 3, &reduce_stmt_208, -1};
+Rule rule212 = {&nonterm2, 3, &reduce_stmt_209, -1};
+Rule rule213 = {&nonterm2, 3, &reduce_stmt_210, -1};
+Rule rule214 = {&nonterm2, 3, &reduce_stmt_211, -1};
+Rule rule215 = {&nonterm2, 3, &reduce_stmt_212, -1};
+Rule rule216 = {&nonterm2, 3, &reduce_stmt_213, -1};
+Rule rule217 = {&nonterm2, 3, &reduce_stmt_214, -1};
+Rule rule218 = {&nonterm2, 3, &reduce_stmt_215, -1};
+Rule rule219 = {&nonterm2, 3, &reduce_stmt_216, -1};
+Rule rule220 = {&nonterm2, 3, &reduce_stmt_217, -1};
+Rule rule221 = {&nonterm2, 3, &reduce_stmt_218, -1};
+Rule rule222 = {&nonterm2, 3, &reduce_stmt_219, -1};
+Rule rule223 = {&nonterm2, 3, &reduce_stmt_220, -1};
+Rule rule224 = {&nonterm2, 3, &reduce_stmt_221, -1};
+Rule rule225 = {&nonterm2, 3, &reduce_stmt_222, -1};
+Rule rule226 = {&nonterm2, 3, &reduce_stmt_223, -1};
+Rule rule227 = {&nonterm2, 3, &reduce_stmt_224, -1};
+Rule rule228 = {&nonterm2, 3, &reduce_stmt_225, -1};
+Rule rule229 = {&nonterm2, 3, &reduce_stmt_226, -1};
+Rule rule230 = {&nonterm2, 3, &reduce_stmt_227, -1};
+Rule rule231 = {&nonterm2, 3, &reduce_stmt_228, -1};
+Rule rule232 = {&nonterm2, 3, &reduce_stmt_229, -1};
+Rule rule233 = {&nonterm2, 3, &reduce_stmt_230, -1};
+Rule rule234 = {&nonterm2, 3, &reduce_stmt_231, -1};
+Rule rule235 = {&nonterm2, 3, &reduce_stmt_232, -1};
+Rule rule236 = {&nonterm2, 3, &reduce_stmt_233, -1};
+Rule rule237 = {&nonterm2, 3, &reduce_stmt_234, -1};
+Rule rule238 = {&nonterm2, 3, &reduce_stmt_235, -1};
+Rule rule239 = {&nonterm2, 3, &reduce_stmt_236, -1};
+Rule rule240 = {&nonterm2, 3, &reduce_stmt_237, -1};
+Rule rule241 = {&nonterm2, 3, &reduce_stmt_238, -1};
+Rule rule242 = {&nonterm2, 3, &reduce_stmt_239, -1};
+Rule rule243 = {&nonterm2, 3, &reduce_stmt_240, -1};
+Rule rule244 = {&nonterm2, 3, &reduce_stmt_241, -1};
+Rule rule245 = {&nonterm2, 3, &reduce_stmt_242, -1};
+Rule rule246 = {&nonterm2, 3, &reduce_stmt_243, -1};
+Rule rule247 = {&nonterm2, 3, &reduce_stmt_244, -1};
+Rule rule248 = {&nonterm2, 3, &reduce_stmt_245, -1};
+Rule rule249 = {&nonterm2, 3, &reduce_stmt_246, -1};
+Rule rule250 = {&nonterm2, 3, &reduce_stmt_247, -1};
+Rule rule251 = {&nonterm2, 3, &reduce_stmt_248, -1};
+Rule rule252 = {&nonterm2, 3, &reduce_stmt_249, -1};
+Rule rule253 = {&nonterm2, 3, &reduce_stmt_250, -1};
+Rule rule254 = {&nonterm2, 3, &reduce_stmt_251, -1};
+Rule rule255 = {&nonterm2, 3, &reduce_stmt_252, -1};
+Rule rule256 = {&nonterm2, 3, &reduce_stmt_253, -1};
+Rule rule257 = {&nonterm2, 3, &reduce_stmt_254, -1};
+Rule rule258 = {&nonterm2, 3, &reduce_stmt_255, -1};
+Rule rule259 = {&nonterm2, 3, &reduce_stmt_256, -1};
+Rule rule260 = {&nonterm2, 3, &reduce_stmt_257, -1};
+Rule rule261 = {&nonterm2, 3, &reduce_stmt_258, -1};
+Rule rule262 = {&nonterm2, 3, &reduce_stmt_259, -1};
+Rule rule263 = {&nonterm2, 3, &reduce_stmt_260, -1};
+Rule rule264 = {&nonterm2, 3, &reduce_stmt_261, -1};
+Rule rule265 = {&nonterm2, 3, &reduce_stmt_262, -1};
+Rule rule266 = {&nonterm2, 3, &reduce_stmt_263, -1};
+Rule rule267 = {&nonterm2, 3, &reduce_stmt_264, -1};
+Rule rule268 = {&nonterm2, 3, &reduce_stmt_265, -1};
+Rule rule269 = {&nonterm2, 3, &reduce_stmt_266, -1};
+Rule rule270 = {&nonterm2, 3, &reduce_stmt_267, -1};
+Rule rule271 = {&nonterm2, 3, &reduce_stmt_268, -1};
+Rule rule272 = {&nonterm2, 3, &reduce_stmt_269, -1};
+Rule rule273 = {&nonterm2, 3, &reduce_stmt_270, -1};
+Rule rule274 = {&nonterm2, 3, &reduce_stmt_271, -1};
+Rule rule275 = {&nonterm2, 3, &reduce_stmt_272, -1};
+Rule rule276 = {&nonterm2, 3, &reduce_stmt_273, -1};
+Rule rule277 = {&nonterm2, 3, &reduce_stmt_274, -1};
+Rule rule278 = {&nonterm2, 3, &reduce_stmt_275, -1};
+Rule rule279 = {&nonterm2, 3, &reduce_stmt_276, -1};
+Rule rule280 = {&nonterm2, 3, &reduce_stmt_277, -1};
+Rule rule281 = {&nonterm2, 3, &reduce_stmt_278, -1};
+Rule rule282 = {&nonterm2, 3, &reduce_stmt_279, -1};
+Rule rule283 = {&nonterm2, 3, &reduce_stmt_280, -1};
+Rule rule284 = {&nonterm2, 3, &reduce_stmt_281, -1};
+Rule rule285 = {&nonterm2, 3, &reduce_stmt_282, -1};
+Rule rule286 = {&nonterm2, 3, &reduce_stmt_283, -1};
+Rule rule287 = {&nonterm2, 3, &reduce_stmt_284, -1};
+Rule rule288 = {&nonterm2, 3, &reduce_stmt_285, -1};
+Rule rule289 = {&nonterm2, 3, &reduce_stmt_286, -1};
+Rule rule290 = {&nonterm2, 3, &reduce_stmt_287, -1};
+Rule rule291 = {&nonterm2, 3, &reduce_stmt_288, -1};
+Rule rule292 = {&nonterm2, 3, &reduce_stmt_289, -1};
+Rule rule293 = {&nonterm2, 3, &reduce_stmt_290, -1};
+Rule rule294 = {&nonterm2, 3, &reduce_stmt_291, -1};
+Rule rule295 = {&nonterm2, 3, &reduce_stmt_292, -1};
+Rule rule296 = {&nonterm2, 3, &reduce_stmt_293, -1};
+Rule rule297 = {&nonterm2, 3, &reduce_stmt_294, -1};
+Rule rule298 = {&nonterm2, 3, &reduce_stmt_295, -1};
+Rule rule299 = {&nonterm2, 3, &reduce_stmt_296, -1};
+Rule rule300 = {&nonterm2, 3, &reduce_stmt_297, -1};
+Rule rule301 = {&nonterm2, 3, &reduce_stmt_298, -1};
+Rule rule302 = {&nonterm2, 3, &reduce_stmt_299, -1};
+Rule rule303 = {&nonterm2, 3, &reduce_stmt_300, -1};
+Rule rule304 = {&nonterm2, 3, &reduce_stmt_301, -1};
+Rule rule305 = {&nonterm2, 3, &reduce_stmt_302, -1};
+Rule rule306 = {&nonterm2, 3, &reduce_stmt_303, -1};
+Rule rule307 = {&nonterm2, 3, &reduce_stmt_304, -1};
+Rule rule308 = {&nonterm2, 3, &reduce_stmt_305, -1};
+Rule rule309 = {&nonterm2, 3, &reduce_stmt_306, -1};
+Rule rule310 = {&nonterm2, 3, &reduce_stmt_307, -1};
+Rule rule311 = {&nonterm2, 3, &reduce_stmt_308, -1};
+Rule rule312 = {&nonterm2, 3, &reduce_stmt_309, -1};
+Rule rule313 = {&nonterm2, 3, &reduce_stmt_310, -1};
+Rule rule314 = {&nonterm2, 3, &reduce_stmt_311, -1};
+Rule rule315 = {&nonterm2, 3, &reduce_stmt_312, -1};
+Rule rule316 = {&nonterm2, 3, &reduce_stmt_313, -1};
+Rule rule317 = {&nonterm2, 3, &reduce_stmt_314, -1};
+Rule rule318 = {&nonterm2, 3, &reduce_stmt_315, -1};
+Rule rule319 = {&nonterm2, 3, &reduce_stmt_316, -1};
+Rule rule320 = {&nonterm2, 3, &reduce_stmt_317, -1};
+Rule rule321 = {&nonterm2, 3, &reduce_stmt_318, -1};
+Rule rule322 = {&nonterm2, 3, &reduce_stmt_319, -1};
+Rule rule323 = {&nonterm2, 3, &reduce_stmt_320, -1};
+Rule rule324 = {&nonterm2, 3, &reduce_stmt_321, -1};
+Rule rule325 = {&nonterm2, 3, &reduce_stmt_322, -1};
+Rule rule326 = {&nonterm2, 3, &reduce_stmt_323, -1};
+Rule rule327 = {&nonterm2, 3, &reduce_stmt_324, -1};
+Rule rule328 = {&nonterm2, 3, &reduce_stmt_325, -1};
+Rule rule329 = {&nonterm2, 3, &reduce_stmt_326, -1};
+Rule rule330 = {&nonterm2, 3, &reduce_stmt_327, -1};
+Rule rule331 = {&nonterm2, 3, &reduce_stmt_328, -1};
+Rule rule332 = {&nonterm2, 3, &reduce_stmt_329, -1};
+Rule rule333 = {&nonterm2, 3, &reduce_stmt_330, -1};
+Rule rule334 = {&nonterm2, 3, &reduce_stmt_331, -1};
+Rule rule335 = {&nonterm2, 3, &reduce_stmt_332, -1};
+Rule rule336 = {&nonterm2, 3, &reduce_stmt_333, -1};
+Rule rule337 = {&nonterm2, 3, &reduce_stmt_334, -1};
+Rule rule338 = {&nonterm2, 3, &reduce_stmt_335, -1};
+Rule rule339 = {&nonterm2, 3, &reduce_stmt_336, -1};
+Rule rule340 = {&nonterm2, 3, &reduce_stmt_337, -1};
+Rule rule341 = {&nonterm2, 3, &reduce_stmt_338, -1};
+Rule rule342 = {&nonterm2, 3, &reduce_stmt_339, -1};
+Rule rule343 = {&nonterm2, 3, &reduce_stmt_340, -1};
+Rule rule344 = {&nonterm2, 3, &reduce_stmt_341, -1};
+Rule rule345 = {&nonterm2, 3, &reduce_stmt_342, -1};
+Rule rule346 = {&nonterm2, 3, &reduce_stmt_343, -1};
+Rule rule347 = {&nonterm2, 3, &reduce_stmt_344, -1};
+Rule rule348 = {&nonterm2, 3, &reduce_stmt_345, -1};
+Rule rule349 = {&nonterm2, 3, &reduce_stmt_346, -1};
+Rule rule350 = {&nonterm2, 3, &reduce_stmt_347, -1};
+Rule rule351 = {&nonterm2, 3, &reduce_stmt_348, -1};
+Rule rule352 = {&nonterm2, 3, &reduce_stmt_349, -1};
+Rule rule353 = {&nonterm2, 3, &reduce_stmt_350, -1};
+Rule rule354 = {&nonterm2, 3, &reduce_stmt_351, -1};
+Rule rule355 = {&nonterm2, 3, &reduce_stmt_352, -1};
+Rule rule356 = {&nonterm2, 3, &reduce_stmt_353, -1};
+Rule rule357 = {&nonterm2, 3, &reduce_stmt_354, -1};
+Rule rule358 = {&nonterm2, 3, &reduce_stmt_355, -1};
+Rule rule359 = {&nonterm2, 3, &reduce_stmt_356, -1};
+Rule rule360 = {&nonterm2, 3, &reduce_stmt_357, -1};
+Rule rule361 = {&nonterm2, 3, &reduce_stmt_358, -1};
+Rule rule362 = {&nonterm2, 3, &reduce_stmt_359, -1};
+Rule rule363 = {&nonterm2, 3, &reduce_stmt_360, -1};
+Rule rule364 = {&nonterm2, 3, &reduce_stmt_361, -1};
+Rule rule365 = {&nonterm2, 3, &reduce_stmt_362, -1};
+Rule rule366 = {&nonterm2, 3, &reduce_stmt_363, -1};
+Rule rule367 = {&nonterm2, 3, &reduce_stmt_364, -1};
+Rule rule368 = {&nonterm2, 3, &reduce_stmt_365, -1};
+Rule rule369 = {&nonterm2, 3, &reduce_stmt_366, -1};
+Rule rule370 = {&nonterm2, 3, &reduce_stmt_367, -1};
+Rule rule371 = {&nonterm2, 3, &reduce_stmt_368, -1};
+Rule rule372 = {&nonterm2, 3, &reduce_stmt_369, -1};
+Rule rule373 = {&nonterm2, 3, &reduce_stmt_370, -1};
+Rule rule374 = {&nonterm2, 3, &reduce_stmt_371, -1};
+Rule rule375 = {&nonterm2, 3, &reduce_stmt_372, -1};
+Rule rule376 = {&nonterm2, 3, &reduce_stmt_373, -1};
+Rule rule377 = {&nonterm2, 3, &reduce_stmt_374, -1};
+Rule rule378 = {&nonterm2, 3, &reduce_stmt_375, -1};
+Rule rule379 = {&nonterm2, 3, &reduce_stmt_376, -1};
+Rule rule380 = {&nonterm2, 3, &reduce_stmt_377, -1};
+Rule rule381 = {&nonterm2, 3, &reduce_stmt_378, -1};
+Rule rule382 = {&nonterm2, 3, &reduce_stmt_379, -1};
+Rule rule383 = {&nonterm2, 3, &reduce_stmt_380, -1};
+Rule rule384 = {&nonterm2, 3, &reduce_stmt_381, -1};
+Rule rule385 = {&nonterm2, 3, &reduce_stmt_382, -1};
+Rule rule386 = {&nonterm2, 3, &reduce_stmt_383, -1};
+Rule rule387 = {&nonterm2, 3, &reduce_stmt_384, -1};
+Rule rule388 = {&nonterm2, 3, &reduce_stmt_385, -1};
+Rule rule389 = {&nonterm2, 3, &reduce_stmt_386, -1};
+Rule rule390 = {&nonterm2, 3, &reduce_stmt_387, -1};
+Rule rule391 = {&nonterm2, 3, &reduce_stmt_388, -1};
+Rule rule392 = {&nonterm2, 3, &reduce_stmt_389, -1};
+Rule rule393 = {&nonterm2, 3, &reduce_stmt_390, -1};
+Rule rule394 = {&nonterm2, 3, &reduce_stmt_391, -1};
+Rule rule395 = {&nonterm2, 3, &reduce_stmt_392, -1};
+Rule rule396 = {&nonterm2, 3, &reduce_stmt_393, -1};
+Rule rule397 = {&nonterm2, 3, &reduce_stmt_394, -1};
+Rule rule398 = {&nonterm2, 3, &reduce_stmt_395, -1};
+Rule rule399 = {&nonterm2, 3, &reduce_stmt_396, -1};
+Rule rule400 = {&nonterm2, 3, &reduce_stmt_397, -1};
+Rule rule401 = {&nonterm2, 3, &reduce_stmt_398, -1};
+Rule rule402 = {&nonterm2, 3, &reduce_stmt_399, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+extern State state784;
+extern State state785;
+extern State state786;
+extern State state787;
+extern State state788;
+extern State state789;
+extern State state790;
+extern State state791;
+extern State state792;
+extern State state793;
+extern State state794;
+extern State state795;
+extern State state796;
+extern State state797;
+extern State state798;
+extern State state799;
+extern State state800;
+extern State state801;
+extern State state802;
+extern State state803;
+extern State state804;
+extern State state805;
+extern State state806;
+extern State state807;
+extern State state808;
+extern State state809;
+extern State state810;
+extern State state811;
+extern State state812;
+extern State state813;
+extern State state814;
+extern State state815;
+extern State state816;
+extern State state817;
+extern State state818;
+extern State state819;
+extern State state820;
+extern State state821;
+extern State state822;
+extern State state823;
+extern State state824;
+extern State state825;
+extern State state826;
+extern State state827;
+extern State state828;
+extern State state829;
+extern State state830;
+extern State state831;
+extern State state832;
+extern State state833;
+extern State state834;
+extern State state835;
+extern State state836;
+extern State state837;
+extern State state838;
+extern State state839;
+extern State state840;
+extern State state841;
+extern State state842;
+extern State state843;
+extern State state844;
+extern State state845;
+extern State state846;
+extern State state847;
+extern State state848;
+extern State state849;
+extern State state850;
+extern State state851;
+extern State state852;
+extern State state853;
+extern State state854;
+extern State state855;
+extern State state856;
+extern State state857;
+extern State state858;
+extern State state859;
+extern State state860;
+extern State state861;
+extern State state862;
+extern State state863;
+extern State state864;
+extern State state865;
+extern State state866;
+extern State state867;
+extern State state868;
+extern State state869;
+extern State state870;
+extern State state871;
+extern State state872;
+extern State state873;
+extern State state874;
+extern State state875;
+extern State state876;
+extern State state877;
+extern State state878;
+extern State state879;
+extern State state880;
+extern State state881;
+extern State state882;
+extern State state883;
+extern State state884;
+extern State state885;
+extern State state886;
+extern State state887;
+extern State state888;
+extern State state889;
+extern State state890;
+extern State state891;
+extern State state892;
+extern State state893;
+extern State state894;
+extern State state895;
+extern State state896;
+extern State state897;
+extern State state898;
+extern State state899;
+extern State state900;
+extern State state901;
+extern State state902;
+extern State state903;
+extern State state904;
+extern State state905;
+extern State state906;
+extern State state907;
+extern State state908;
+extern State state909;
+extern State state910;
+extern State state911;
+extern State state912;
+extern State state913;
+extern State state914;
+extern State state915;
+extern State state916;
+extern State state917;
+extern State state918;
+extern State state919;
+extern State state920;
+extern State state921;
+extern State state922;
+extern State state923;
+extern State state924;
+extern State state925;
+extern State state926;
+extern State state927;
+extern State state928;
+extern State state929;
+extern State state930;
+extern State state931;
+extern State state932;
+extern State state933;
+extern State state934;
+extern State state935;
+extern State state936;
+extern State state937;
+extern State state938;
+extern State state939;
+extern State state940;
+extern State state941;
+extern State state942;
+extern State state943;
+extern State state944;
+extern State state945;
+extern State state946;
+extern State state947;
+extern State state948;
+extern State state949;
+extern State state950;
+extern State state951;
+extern State state952;
+extern State state953;
+extern State state954;
+extern State state955;
+extern State state956;
+extern State state957;
+extern State state958;
+extern State state959;
+extern State state960;
+extern State state961;
+extern State state962;
+extern State state963;
+extern State state964;
+extern State state965;
+extern State state966;
+extern State state967;
+extern State state968;
+extern State state969;
+extern State state970;
+extern State state971;
+extern State state972;
+extern State state973;
+extern State state974;
+extern State state975;
+extern State state976;
+extern State state977;
+extern State state978;
+extern State state979;
+extern State state980;
+extern State state981;
+extern State state982;
+extern State state983;
+extern State state984;
+extern State state985;
+extern State state986;
+extern State state987;
+extern State state988;
+extern State state989;
+extern State state990;
+extern State state991;
+extern State state992;
+extern State state993;
+extern State state994;
+extern State state995;
+extern State state996;
+extern State state997;
+extern State state998;
+extern State state999;
+extern State state1000;
+extern State state1001;
+extern State state1002;
+extern State state1003;
+extern State state1004;
+extern State state1005;
+extern State state1006;
+extern State state1007;
+extern State state1008;
+extern State state1009;
+extern State state1010;
+extern State state1011;
+extern State state1012;
+extern State state1013;
+extern State state1014;
+extern State state1015;
+extern State state1016;
+extern State state1017;
+extern State state1018;
+extern State state1019;
+extern State state1020;
+extern State state1021;
+extern State state1022;
+extern State state1023;
+extern State state1024;
+extern State state1025;
+extern State state1026;
+extern State state1027;
+extern State state1028;
+extern State state1029;
+extern State state1030;
+extern State state1031;
+extern State state1032;
+extern State state1033;
+extern State state1034;
+extern State state1035;
+extern State state1036;
+extern State state1037;
+extern State state1038;
+extern State state1039;
+extern State state1040;
+extern State state1041;
+extern State state1042;
+extern State state1043;
+extern State state1044;
+extern State state1045;
+extern State state1046;
+extern State state1047;
+extern State state1048;
+extern State state1049;
+extern State state1050;
+extern State state1051;
+extern State state1052;
+extern State state1053;
+extern State state1054;
+extern State state1055;
+extern State state1056;
+extern State state1057;
+extern State state1058;
+extern State state1059;
+extern State state1060;
+extern State state1061;
+extern State state1062;
+extern State state1063;
+extern State state1064;
+extern State state1065;
+extern State state1066;
+extern State state1067;
+extern State state1068;
+extern State state1069;
+extern State state1070;
+extern State state1071;
+extern State state1072;
+extern State state1073;
+extern State state1074;
+extern State state1075;
+extern State state1076;
+extern State state1077;
+extern State state1078;
+extern State state1079;
+extern State state1080;
+extern State state1081;
+extern State state1082;
+extern State state1083;
+extern State state1084;
+extern State state1085;
+extern State state1086;
+extern State state1087;
+extern State state1088;
+extern State state1089;
+extern State state1090;
+extern State state1091;
+extern State state1092;
+extern State state1093;
+extern State state1094;
+extern State state1095;
+extern State state1096;
+extern State state1097;
+extern State state1098;
+extern State state1099;
+extern State state1100;
+extern State state1101;
+extern State state1102;
+extern State state1103;
+extern State state1104;
+extern State state1105;
+extern State state1106;
+extern State state1107;
+extern State state1108;
+extern State state1109;
+extern State state1110;
+extern State state1111;
+extern State state1112;
+extern State state1113;
+extern State state1114;
+extern State state1115;
+extern State state1116;
+extern State state1117;
+extern State state1118;
+extern State state1119;
+extern State state1120;
+extern State state1121;
+extern State state1122;
+extern State state1123;
+extern State state1124;
+extern State state1125;
+extern State state1126;
+extern State state1127;
+extern State state1128;
+extern State state1129;
+extern State state1130;
+extern State state1131;
+extern State state1132;
+extern State state1133;
+extern State state1134;
+extern State state1135;
+extern State state1136;
+extern State state1137;
+extern State state1138;
+extern State state1139;
+extern State state1140;
+extern State state1141;
+extern State state1142;
+extern State state1143;
+extern State state1144;
+extern State state1145;
+extern State state1146;
+extern State state1147;
+extern State state1148;
+extern State state1149;
+extern State state1150;
+extern State state1151;
+extern State state1152;
+extern State state1153;
+extern State state1154;
+extern State state1155;
+extern State state1156;
+extern State state1157;
+extern State state1158;
+extern State state1159;
+extern State state1160;
+extern State state1161;
+extern State state1162;
+extern State state1163;
+extern State state1164;
+extern State state1165;
+extern State state1166;
+extern State state1167;
+extern State state1168;
+extern State state1169;
+extern State state1170;
+extern State state1171;
+extern State state1172;
+extern State state1173;
+extern State state1174;
+extern State state1175;
+extern State state1176;
+extern State state1177;
+extern State state1178;
+extern State state1179;
+extern State state1180;
+extern State state1181;
+extern State state1182;
+extern State state1183;
+extern State state1184;
+extern State state1185;
+extern State state1186;
+extern State state1187;
+extern State state1188;
+extern State state1189;
+extern State state1190;
+extern State state1191;
+extern State state1192;
+extern State state1193;
+extern State state1194;
+extern State state1195;
+extern State state1196;
+extern State state1197;
+extern State state1198;
+extern State state1199;
+extern State state1200;
+extern State state1201;
+extern State state1202;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term1, &state3}, {&term2, &state4}, {&term3, &state5}, {&term4, &state6}, {&term5, &state7}, {&term6, &state8}, {&term7, &state9}, {&term8, &state10}, {&term9, &state11}, {&term10, &state12}, {&term11, &state13}, {&term12, &state14}, {&term13, &state15}, {&term14, &state16}, {&term15, &state17}, {&term16, &state18}, {&term17, &state19}, {&term18, &state20}, {&term19, &state21}, {&term20, &state22}, {&term21, &state23}, {&term22, &state24}, {&term23, &state25}, {&term24, &state26}, {&term25, &state27}, {&term26, &state28}, {&term27, &state29}, {&term28, &state30}, {&term29, &state31}, {&term30, &state32}, {&term31, &state33}, {&term32, &state34}, {&term33, &state35}, {&term34, &state36}, {&term35, &state37}, {&term36, &state38}, {&term37, &state39}, {&term38, &state40}, {&term39, &state41}, {&term40, &state42}, {&term41, &state43}, {&term42, &state44}, {&term43, &state45}, {&term44, &state46}, {&term45, &state47}, {&term46, &state48}, {&term47, &state49}, {&term48, &state50}, {&term49, &state51}, {&term50, &state52}, {&term51, &state53}, {&term52, &state54}, {&term53, &state55}, {&term54, &state56}, {&term55, &state57}, {&term56, &state58}, {&term57, &state59}, {&term58, &state60}, {&term59, &state61}, {&term60, &state62}, {&term61, &state63}, {&term62, &state64}, {&term63, &state65}, {&term64, &state66}, {&term65, &state67}, {&term66, &state68}, {&term67, &state69}, {&term68, &state70}, {&term69, &state71}, {&term70, &state72}, {&term71, &state73}, {&term72, &state74}, {&term73, &state75}, {&term74, &state76}, {&term75, &state77}, {&term76, &state78}, {&term77, &state79}, {&term78, &state80}, {&term79, &state81}, {&term80, &state82}, {&term81, &state83}, {&term82, &state84}, {&term83, &state85}, {&term84, &state86}, {&term85, &state87}, {&term86, &state88}, {&term87, &state89}, {&term88, &state90}, {&term89, &state91}, {&term90, &state92}, {&term91, &state93}, {&term92, &state94}, {&term93, &state95}, {&term94, &state96}, {&term95, &state97}, {&term96, &state98}, {&term97, &state99}, {&term98, &state100}, {&term99, &state101}, {&term100, &state102}, {&term101, &state103}, {&term102, &state104}, {&term103, &state105}, {&term104, &state106}, {&term105, &state107}, {&term106, &state108}, {&term107, &state109}, {&term108, &state110}, {&term109, &state111}, {&term110, &state112}, {&term111, &state113}, {&term112, &state114}, {&term113, &state115}, {&term114, &state116}, {&term115, &state117}, {&term116, &state118}, {&term117, &state119}, {&term118, &state120}, {&term119, &state121}, {&term120, &state122}, {&term121, &state123}, {&term122, &state124}, {&term123, &state125}, {&term124, &state126}, {&term125, &state127}, {&term126, &state128}, {&term127, &state129}, {&term128, &state130}, {&term257, &state259}, {&term258, &state260}, {&term259, &state261}, {&term260, &state262}, {&term261, &state263}, {&term262, &state264}, {&term263, &state265}, {&term264, &state266}, {&term129, &state131}, {&term130, &state132}, {&term131, &state133}, {&term132, &state134}, {&term133, &state135}, {&term134, &state136}, {&term135, &state137}, {&term136, &state138}, {&term137, &state139}, {&term138, &state140}, {&term139, &state141}, {&term140, &state142}, {&term141, &state143}, {&term142, &state144}, {&term143, &state145}, {&term144, &state146}, {&term145, &state147}, {&term146, &state148}, {&term147, &state149}, {&term148, &state150}, {&term149, &state151}, {&term150, &state152}, {&term151, &state153}, {&term152, &state154}, {&term153, &state155}, {&term154, &state156}, {&term155, &state157}, {&term156, &state158}, {&term157, &state159}, {&term158, &state160}, {&term159, &state161}, {&term160, &state162}, {&term161, &state163}, {&term162, &state164}, {&term163, &state165}, {&term164, &state166}, {&term165, &state167}, {&term166, &state168}, {&term167, &state169}, {&term168, &state170}, {&term169, &state171}, {&term170, &state172}, {&term171, &state173}, {&term172, &state174}, {&term173, &state175}, {&term174, &state176}, {&term175, &state177}, {&term176, &state178}, {&term177, &state179}, {&term178, &state180}, {&term179, &state181}, {&term180, &state182}, {&term181, &state183}, {&term182, &state184}, {&term183, &state185}, {&term184, &state186}, {&term185, &state187}, {&term186, &state188}, {&term187, &state189}, {&term188, &state190}, {&term189, &state191}, {&term190, &state192}, {&term191, &state193}, {&term192, &state194}, {&term193, &state195}, {&term194, &state196}, {&term195, &state197}, {&term196, &state198}, {&term197, &state199}, {&term198, &state200}, {&term199, &state201}, {&term200, &state202}, {&term201, &state203}, {&term202, &state204}, {&term203, &state205}, {&term204, &state206}, {&term205, &state207}, {&term206, &state208}, {&term207, &state209}, {&term208, &state210}, {&term209, &state211}, {&term210, &state212}, {&term211, &state213}, {&term212, &state214}, {&term213, &state215}, {&term214, &state216}, {&term215, &state217}, {&term216, &state218}, {&term217, &state219}, {&term218, &state220}, {&term219, &state221}, {&term220, &state222}, {&term221, &state223}, {&term222, &state224}, {&term223, &state225}, {&term224, &state226}, {&term225, &state227}, {&term226, &state228}, {&term227, &state229}, {&term228, &state230}, {&term229, &state231}, {&term230, &state232}, {&term231, &state233}, {&term232, &state234}, {&term233, &state235}, {&term234, &state236}, {&term235, &state237}, {&term236, &state238}, {&term237, &state239}, {&term238, &state240}, {&term239, &state241}, {&term240, &state242}, {&term241, &state243}, {&term242, &state244}, {&term243, &state245}, {&term244, &state246}, {&term245, &state247}, {&term246, &state248}, {&term247, &state249}, {&term248, &state250}, {&term249, &state251}, {&term250, &state252}, {&term251, &state253}, {&term252, &state254}, {&term253, &state255}, {&term254, &state256}, {&term255, &state257}, {&term256, &state258}, {&term265, &state267}, {&term266, &state268}, {&term267, &state269}, {&term268, &state270}, {&term269, &state271}, {&term270, &state272}, {&term271, &state273}, {&term272, &state274}, {&term273, &state275}, {&term274, &state276}, {&term275, &state277}, {&term276, &state278}, {&term277, &state279}, {&term278, &state280}, {&term279, &state281}, {&term280, &state282}, {&term281, &state283}, {&term282, &state284}, {&term283, &state285}, {&term284, &state286}, {&term285, &state287}, {&term286, &state288}, {&term287, &state289}, {&term288, &state290}, {&term289, &state291}, {&term290, &state292}, {&term291, &state293}, {&term292, &state294}, {&term293, &state295}, {&term294, &state296}, {&term295, &state297}, {&term296, &state298}, {&term297, &state299}, {&term298, &state300}, {&term299, &state301}, {&term300, &state302}, {&term301, &state303}, {&term302, &state304}, {&term303, &state305}, {&term304, &state306}, {&term305, &state307}, {&term306, &state308}, {&term307, &state309}, {&term308, &state310}, {&term309, &state311}, {&term310, &state312}, {&term311, &state313}, {&term312, &state314}, {&term313, &state315}, {&term314, &state316}, {&term315, &state317}, {&term316, &state318}, {&term317, &state319}, {&term318, &state320}, {&term319, &state321}, {&term320, &state322}, {&term321, &state323}, {&term322, &state324}, {&term323, &state325}, {&term324, &state326}, {&term325, &state327}, {&term326, &state328}, {&term327, &state329}, {&term328, &state330}, {&term329, &state331}, {&term330, &state332}, {&term331, &state333}, {&term332, &state334}, {&term333, &state335}, {&term334, &state336}, {&term335, &state337}, {&term336, &state338}, {&term337, &state339}, {&term338, &state340}, {&term339, &state341}, {&term340, &state342}, {&term341, &state343}, {&term342, &state344}, {&term343, &state345}, {&term344, &state346}, {&term345, &state347}, {&term346, &state348}, {&term347, &state349}, {&term348, &state350}, {&term349, &state351}, {&term350, &state352}, {&term351, &state353}, {&term352, &state354}, {&term353, &state355}, {&term354, &state356}, {&term355, &state357}, {&term356, &state358}, {&term357, &state359}, {&term358, &state360}, {&term359, &state361}, {&term360, &state362}, {&term361, &state363}, {&term362, &state364}, {&term363, &state365}, {&term364, &state366}, {&term365, &state367}, {&term366, &state368}, {&term367, &state369}, {&term368, &state370}, {&term369, &state371}, {&term370, &state372}, {&term371, &state373}, {&term372, &state374}, {&term373, &state375}, {&term374, &state376}, {&term375, &state377}, {&term376, &state378}, {&term377, &state379}, {&term378, &state380}, {&term379, &state381}, {&term380, &state382}, {&term381, &state383}, {&term382, &state384}, {&term383, &state385}, {&term384, &state386}, {&term385, &state387}, {&term386, &state388}, {&term387, &state389}, {&term388, &state390}, {&term389, &state391}, {&term390, &state392}, {&term391, &state393}, {&term392, &state394}, {&term393, &state395}, {&term394, &state396}, {&term395, &state397}, {&term396, &state398}, {&term397, &state399}, {&term398, &state400}, {&term399, &state401}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term402, &state1201}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term402, &state1199}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {{&term402, &state1197}};
+std::vector<Reduce> reduce4 = {};
+std::vector<Shift> shift5 = {{&term402, &state1195}};
+std::vector<Reduce> reduce5 = {};
+std::vector<Shift> shift6 = {{&term402, &state1193}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {{&term402, &state1191}};
+std::vector<Reduce> reduce7 = {};
+std::vector<Shift> shift8 = {{&term402, &state1189}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term402, &state1187}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term402, &state1185}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {{&term402, &state1183}};
+std::vector<Reduce> reduce11 = {};
+std::vector<Shift> shift12 = {{&term402, &state1181}};
+std::vector<Reduce> reduce12 = {};
+std::vector<Shift> shift13 = {{&term402, &state1179}};
+std::vector<Reduce> reduce13 = {};
+std::vector<Shift> shift14 = {{&term402, &state1177}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {{&term402, &state1175}};
+std::vector<Reduce> reduce15 = {};
+std::vector<Shift> shift16 = {{&term402, &state1173}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term402, &state1171}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term402, &state1169}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {{&term402, &state1167}};
+std::vector<Reduce> reduce19 = {};
+std::vector<Shift> shift20 = {{&term402, &state1165}};
+std::vector<Reduce> reduce20 = {};
+std::vector<Shift> shift21 = {{&term402, &state1163}};
+std::vector<Reduce> reduce21 = {};
+std::vector<Shift> shift22 = {{&term402, &state1161}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {{&term402, &state1159}};
+std::vector<Reduce> reduce23 = {};
+std::vector<Shift> shift24 = {{&term402, &state1157}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term402, &state1155}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term402, &state1153}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {{&term402, &state1151}};
+std::vector<Reduce> reduce27 = {};
+std::vector<Shift> shift28 = {{&term402, &state1149}};
+std::vector<Reduce> reduce28 = {};
+std::vector<Shift> shift29 = {{&term402, &state1147}};
+std::vector<Reduce> reduce29 = {};
+std::vector<Shift> shift30 = {{&term402, &state1145}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {{&term402, &state1143}};
+std::vector<Reduce> reduce31 = {};
+std::vector<Shift> shift32 = {{&term402, &state1141}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term402, &state1139}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term402, &state1137}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {{&term402, &state1135}};
+std::vector<Reduce> reduce35 = {};
+std::vector<Shift> shift36 = {{&term402, &state1133}};
+std::vector<Reduce> reduce36 = {};
+std::vector<Shift> shift37 = {{&term402, &state1131}};
+std::vector<Reduce> reduce37 = {};
+std::vector<Shift> shift38 = {{&term402, &state1129}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {{&term402, &state1127}};
+std::vector<Reduce> reduce39 = {};
+std::vector<Shift> shift40 = {{&term402, &state1125}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term402, &state1123}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term402, &state1121}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {{&term402, &state1119}};
+std::vector<Reduce> reduce43 = {};
+std::vector<Shift> shift44 = {{&term402, &state1117}};
+std::vector<Reduce> reduce44 = {};
+std::vector<Shift> shift45 = {{&term402, &state1115}};
+std::vector<Reduce> reduce45 = {};
+std::vector<Shift> shift46 = {{&term402, &state1113}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {{&term402, &state1111}};
+std::vector<Reduce> reduce47 = {};
+std::vector<Shift> shift48 = {{&term402, &state1109}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term402, &state1107}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term402, &state1105}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {{&term402, &state1103}};
+std::vector<Reduce> reduce51 = {};
+std::vector<Shift> shift52 = {{&term402, &state1101}};
+std::vector<Reduce> reduce52 = {};
+std::vector<Shift> shift53 = {{&term402, &state1099}};
+std::vector<Reduce> reduce53 = {};
+std::vector<Shift> shift54 = {{&term402, &state1097}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {{&term402, &state1095}};
+std::vector<Reduce> reduce55 = {};
+std::vector<Shift> shift56 = {{&term402, &state1093}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term402, &state1091}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term402, &state1089}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {{&term402, &state1087}};
+std::vector<Reduce> reduce59 = {};
+std::vector<Shift> shift60 = {{&term402, &state1085}};
+std::vector<Reduce> reduce60 = {};
+std::vector<Shift> shift61 = {{&term402, &state1083}};
+std::vector<Reduce> reduce61 = {};
+std::vector<Shift> shift62 = {{&term402, &state1081}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {{&term402, &state1079}};
+std::vector<Reduce> reduce63 = {};
+std::vector<Shift> shift64 = {{&term402, &state1077}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term402, &state1075}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term402, &state1073}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {{&term402, &state1071}};
+std::vector<Reduce> reduce67 = {};
+std::vector<Shift> shift68 = {{&term402, &state1069}};
+std::vector<Reduce> reduce68 = {};
+std::vector<Shift> shift69 = {{&term402, &state1067}};
+std::vector<Reduce> reduce69 = {};
+std::vector<Shift> shift70 = {{&term402, &state1065}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {{&term402, &state1063}};
+std::vector<Reduce> reduce71 = {};
+std::vector<Shift> shift72 = {{&term402, &state1061}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term402, &state1059}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term402, &state1057}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {{&term402, &state1055}};
+std::vector<Reduce> reduce75 = {};
+std::vector<Shift> shift76 = {{&term402, &state1053}};
+std::vector<Reduce> reduce76 = {};
+std::vector<Shift> shift77 = {{&term402, &state1051}};
+std::vector<Reduce> reduce77 = {};
+std::vector<Shift> shift78 = {{&term402, &state1049}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {{&term402, &state1047}};
+std::vector<Reduce> reduce79 = {};
+std::vector<Shift> shift80 = {{&term402, &state1045}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term402, &state1043}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term402, &state1041}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {{&term402, &state1039}};
+std::vector<Reduce> reduce83 = {};
+std::vector<Shift> shift84 = {{&term402, &state1037}};
+std::vector<Reduce> reduce84 = {};
+std::vector<Shift> shift85 = {{&term402, &state1035}};
+std::vector<Reduce> reduce85 = {};
+std::vector<Shift> shift86 = {{&term402, &state1033}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {{&term402, &state1031}};
+std::vector<Reduce> reduce87 = {};
+std::vector<Shift> shift88 = {{&term402, &state1029}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term402, &state1027}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term402, &state1025}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {{&term402, &state1023}};
+std::vector<Reduce> reduce91 = {};
+std::vector<Shift> shift92 = {{&term402, &state1021}};
+std::vector<Reduce> reduce92 = {};
+std::vector<Shift> shift93 = {{&term402, &state1019}};
+std::vector<Reduce> reduce93 = {};
+std::vector<Shift> shift94 = {{&term402, &state1017}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {{&term402, &state1015}};
+std::vector<Reduce> reduce95 = {};
+std::vector<Shift> shift96 = {{&term402, &state1013}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term402, &state1011}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term402, &state1009}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {{&term402, &state1007}};
+std::vector<Reduce> reduce99 = {};
+std::vector<Shift> shift100 = {{&term402, &state1005}};
+std::vector<Reduce> reduce100 = {};
+std::vector<Shift> shift101 = {{&term402, &state1003}};
+std::vector<Reduce> reduce101 = {};
+std::vector<Shift> shift102 = {{&term402, &state1001}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {{&term402, &state999}};
+std::vector<Reduce> reduce103 = {};
+std::vector<Shift> shift104 = {{&term402, &state997}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term402, &state995}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term402, &state993}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {{&term402, &state991}};
+std::vector<Reduce> reduce107 = {};
+std::vector<Shift> shift108 = {{&term402, &state989}};
+std::vector<Reduce> reduce108 = {};
+std::vector<Shift> shift109 = {{&term402, &state987}};
+std::vector<Reduce> reduce109 = {};
+std::vector<Shift> shift110 = {{&term402, &state985}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {{&term402, &state983}};
+std::vector<Reduce> reduce111 = {};
+std::vector<Shift> shift112 = {{&term402, &state981}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term402, &state979}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term402, &state977}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {{&term402, &state975}};
+std::vector<Reduce> reduce115 = {};
+std::vector<Shift> shift116 = {{&term402, &state973}};
+std::vector<Reduce> reduce116 = {};
+std::vector<Shift> shift117 = {{&term402, &state971}};
+std::vector<Reduce> reduce117 = {};
+std::vector<Shift> shift118 = {{&term402, &state969}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {{&term402, &state967}};
+std::vector<Reduce> reduce119 = {};
+std::vector<Shift> shift120 = {{&term402, &state965}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term402, &state963}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term402, &state961}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {{&term402, &state959}};
+std::vector<Reduce> reduce123 = {};
+std::vector<Shift> shift124 = {{&term402, &state957}};
+std::vector<Reduce> reduce124 = {};
+std::vector<Shift> shift125 = {{&term402, &state955}};
+std::vector<Reduce> reduce125 = {};
+std::vector<Shift> shift126 = {{&term402, &state953}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {{&term402, &state951}};
+std::vector<Reduce> reduce127 = {};
+std::vector<Shift> shift128 = {{&term402, &state949}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term402, &state947}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term402, &state945}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {{&term402, &state943}};
+std::vector<Reduce> reduce131 = {};
+std::vector<Shift> shift132 = {{&term402, &state941}};
+std::vector<Reduce> reduce132 = {};
+std::vector<Shift> shift133 = {{&term402, &state939}};
+std::vector<Reduce> reduce133 = {};
+std::vector<Shift> shift134 = {{&term402, &state937}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {{&term402, &state935}};
+std::vector<Reduce> reduce135 = {};
+std::vector<Shift> shift136 = {{&term402, &state933}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term402, &state931}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term402, &state929}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {{&term402, &state927}};
+std::vector<Reduce> reduce139 = {};
+std::vector<Shift> shift140 = {{&term402, &state925}};
+std::vector<Reduce> reduce140 = {};
+std::vector<Shift> shift141 = {{&term402, &state923}};
+std::vector<Reduce> reduce141 = {};
+std::vector<Shift> shift142 = {{&term402, &state921}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {{&term402, &state919}};
+std::vector<Reduce> reduce143 = {};
+std::vector<Shift> shift144 = {{&term402, &state917}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term402, &state915}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term402, &state913}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {{&term402, &state911}};
+std::vector<Reduce> reduce147 = {};
+std::vector<Shift> shift148 = {{&term402, &state909}};
+std::vector<Reduce> reduce148 = {};
+std::vector<Shift> shift149 = {{&term402, &state907}};
+std::vector<Reduce> reduce149 = {};
+std::vector<Shift> shift150 = {{&term402, &state905}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {{&term402, &state903}};
+std::vector<Reduce> reduce151 = {};
+std::vector<Shift> shift152 = {{&term402, &state901}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term402, &state899}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term402, &state897}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {{&term402, &state895}};
+std::vector<Reduce> reduce155 = {};
+std::vector<Shift> shift156 = {{&term402, &state893}};
+std::vector<Reduce> reduce156 = {};
+std::vector<Shift> shift157 = {{&term402, &state891}};
+std::vector<Reduce> reduce157 = {};
+std::vector<Shift> shift158 = {{&term402, &state889}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {{&term402, &state887}};
+std::vector<Reduce> reduce159 = {};
+std::vector<Shift> shift160 = {{&term402, &state885}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term402, &state883}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term402, &state881}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {{&term402, &state879}};
+std::vector<Reduce> reduce163 = {};
+std::vector<Shift> shift164 = {{&term402, &state877}};
+std::vector<Reduce> reduce164 = {};
+std::vector<Shift> shift165 = {{&term402, &state875}};
+std::vector<Reduce> reduce165 = {};
+std::vector<Shift> shift166 = {{&term402, &state873}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {{&term402, &state871}};
+std::vector<Reduce> reduce167 = {};
+std::vector<Shift> shift168 = {{&term402, &state869}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term402, &state867}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term402, &state865}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {{&term402, &state863}};
+std::vector<Reduce> reduce171 = {};
+std::vector<Shift> shift172 = {{&term402, &state861}};
+std::vector<Reduce> reduce172 = {};
+std::vector<Shift> shift173 = {{&term402, &state859}};
+std::vector<Reduce> reduce173 = {};
+std::vector<Shift> shift174 = {{&term402, &state857}};
+std::vector<Reduce> reduce174 = {};
+std::vector<Shift> shift175 = {{&term402, &state855}};
+std::vector<Reduce> reduce175 = {};
+std::vector<Shift> shift176 = {{&term402, &state853}};
+std::vector<Reduce> reduce176 = {};
+std::vector<Shift> shift177 = {{&term402, &state851}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {{&term402, &state849}};
+std::vector<Reduce> reduce178 = {};
+std::vector<Shift> shift179 = {{&term402, &state847}};
+std::vector<Reduce> reduce179 = {};
+std::vector<Shift> shift180 = {{&term402, &state845}};
+std::vector<Reduce> reduce180 = {};
+std::vector<Shift> shift181 = {{&term402, &state843}};
+std::vector<Reduce> reduce181 = {};
+std::vector<Shift> shift182 = {{&term402, &state841}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {{&term402, &state839}};
+std::vector<Reduce> reduce183 = {};
+std::vector<Shift> shift184 = {{&term402, &state837}};
+std::vector<Reduce> reduce184 = {};
+std::vector<Shift> shift185 = {{&term402, &state835}};
+std::vector<Reduce> reduce185 = {};
+std::vector<Shift> shift186 = {{&term402, &state833}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift187 = {{&term402, &state831}};
+std::vector<Reduce> reduce187 = {};
+std::vector<Shift> shift188 = {{&term402, &state829}};
+std::vector<Reduce> reduce188 = {};
+std::vector<Shift> shift189 = {{&term402, &state827}};
+std::vector<Reduce> reduce189 = {};
+std::vector<Shift> shift190 = {{&term402, &state825}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {{&term402, &state823}};
+std::vector<Reduce> reduce191 = {};
+std::vector<Shift> shift192 = {{&term402, &state821}};
+std::vector<Reduce> reduce192 = {};
+std::vector<Shift> shift193 = {{&term402, &state819}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term402, &state817}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {{&term402, &state815}};
+std::vector<Reduce> reduce195 = {};
+std::vector<Shift> shift196 = {{&term402, &state813}};
+std::vector<Reduce> reduce196 = {};
+std::vector<Shift> shift197 = {{&term402, &state811}};
+std::vector<Reduce> reduce197 = {};
+std::vector<Shift> shift198 = {{&term402, &state809}};
+std::vector<Reduce> reduce198 = {};
+std::vector<Shift> shift199 = {{&term402, &state807}};
+std::vector<Reduce> reduce199 = {};
+std::vector<Shift> shift200 = {{&term402, &state805}};
+std::vector<Reduce> reduce200 = {};
+std::vector<Shift> shift201 = {{&term402, &state803}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift202 = {{&term402, &state801}};
+std::vector<Reduce> reduce202 = {};
+std::vector<Shift> shift203 = {{&term402, &state799}};
+std::vector<Reduce> reduce203 = {};
+std::vector<Shift> shift204 = {{&term402, &state797}};
+std::vector<Reduce> reduce204 = {};
+std::vector<Shift> shift205 = {{&term402, &state795}};
+std::vector<Reduce> reduce205 = {};
+std::vector<Shift> shift206 = {{&term402, &state793}};
+std::vector<Reduce> reduce206 = {};
+std::vector<Shift> shift207 = {{&term402, &state791}};
+std::vector<Reduce> reduce207 = {};
+std::vector<Shift> shift208 = {{&term402, &state789}};
+std::vector<Reduce> reduce208 = {};
+std::vector<Shift> shift209 = {{&term402, &state787}};
+std::vector<Reduce> reduce209 = {};
+std::vector<Shift> shift210 = {{&term402, &state785}};
+std::vector<Reduce> reduce210 = {};
+std::vector<Shift> shift211 = {{&term402, &state783}};
+std::vector<Reduce> reduce211 = {};
+std::vector<Shift> shift212 = {{&term402, &state781}};
+std::vector<Reduce> reduce212 = {};
+std::vector<Shift> shift213 = {{&term402, &state779}};
+std::vector<Reduce> reduce213 = {};
+std::vector<Shift> shift214 = {{&term402, &state777}};
+std::vector<Reduce> reduce214 = {};
+std::vector<Shift> shift215 = {{&term402, &state775}};
+std::vector<Reduce> reduce215 = {};
+std::vector<Shift> shift216 = {{&term402, &state773}};
+std::vector<Reduce> reduce216 = {};
+std::vector<Shift> shift217 = {{&term402, &state771}};
+std::vector<Reduce> reduce217 = {};
+std::vector<Shift> shift218 = {{&term402, &state769}};
+std::vector<Reduce> reduce218 = {};
+std::vector<Shift> shift219 = {{&term402, &state767}};
+std::vector<Reduce> reduce219 = {};
+std::vector<Shift> shift220 = {{&term402, &state765}};
+std::vector<Reduce> reduce220 = {};
+std::vector<Shift> shift221 = {{&term402, &state763}};
+std::vector<Reduce> reduce221 = {};
+std::vector<Shift> shift222 = {{&term402, &state761}};
+std::vector<Reduce> reduce222 = {};
+std::vector<Shift> shift223 = {{&term402, &state759}};
+std::vector<Reduce> reduce223 = {};
+std::vector<Shift> shift224 = {{&term402, &state757}};
+std::vector<Reduce> reduce224 = {};
+std::vector<Shift> shift225 = {{&term402, &state755}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift226 = {{&term402, &state753}};
+std::vector<Reduce> reduce226 = {};
+std::vector<Shift> shift227 = {{&term402, &state751}};
+std::vector<Reduce> reduce227 = {};
+std::vector<Shift> shift228 = {{&term402, &state749}};
+std::vector<Reduce> reduce228 = {};
+std::vector<Shift> shift229 = {{&term402, &state747}};
+std::vector<Reduce> reduce229 = {};
+std::vector<Shift> shift230 = {{&term402, &state745}};
+std::vector<Reduce> reduce230 = {};
+std::vector<Shift> shift231 = {{&term402, &state743}};
+std::vector<Reduce> reduce231 = {};
+std::vector<Shift> shift232 = {{&term402, &state741}};
+std::vector<Reduce> reduce232 = {};
+std::vector<Shift> shift233 = {{&term402, &state739}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {{&term402, &state737}};
+std::vector<Reduce> reduce234 = {};
+std::vector<Shift> shift235 = {{&term402, &state735}};
+std::vector<Reduce> reduce235 = {};
+std::vector<Shift> shift236 = {{&term402, &state733}};
+std::vector<Reduce> reduce236 = {};
+std::vector<Shift> shift237 = {{&term402, &state731}};
+std::vector<Reduce> reduce237 = {};
+std::vector<Shift> shift238 = {{&term402, &state729}};
+std::vector<Reduce> reduce238 = {};
+std::vector<Shift> shift239 = {{&term402, &state727}};
+std::vector<Reduce> reduce239 = {};
+std::vector<Shift> shift240 = {{&term402, &state725}};
+std::vector<Reduce> reduce240 = {};
+std::vector<Shift> shift241 = {{&term402, &state723}};
+std::vector<Reduce> reduce241 = {};
+std::vector<Shift> shift242 = {{&term402, &state721}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {{&term402, &state719}};
+std::vector<Reduce> reduce243 = {};
+std::vector<Shift> shift244 = {{&term402, &state717}};
+std::vector<Reduce> reduce244 = {};
+std::vector<Shift> shift245 = {{&term402, &state715}};
+std::vector<Reduce> reduce245 = {};
+std::vector<Shift> shift246 = {{&term402, &state713}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {{&term402, &state711}};
+std::vector<Reduce> reduce247 = {};
+std::vector<Shift> shift248 = {{&term402, &state709}};
+std::vector<Reduce> reduce248 = {};
+std::vector<Shift> shift249 = {{&term402, &state707}};
+std::vector<Reduce> reduce249 = {};
+std::vector<Shift> shift250 = {{&term402, &state705}};
+std::vector<Reduce> reduce250 = {};
+std::vector<Shift> shift251 = {{&term402, &state703}};
+std::vector<Reduce> reduce251 = {};
+std::vector<Shift> shift252 = {{&term402, &state701}};
+std::vector<Reduce> reduce252 = {};
+std::vector<Shift> shift253 = {{&term402, &state699}};
+std::vector<Reduce> reduce253 = {};
+std::vector<Shift> shift254 = {{&term402, &state697}};
+std::vector<Reduce> reduce254 = {};
+std::vector<Shift> shift255 = {{&term402, &state695}};
+std::vector<Reduce> reduce255 = {};
+std::vector<Shift> shift256 = {{&term402, &state693}};
+std::vector<Reduce> reduce256 = {};
+std::vector<Shift> shift257 = {{&term402, &state691}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {{&term402, &state689}};
+std::vector<Reduce> reduce258 = {};
+std::vector<Shift> shift259 = {{&term402, &state687}};
+std::vector<Reduce> reduce259 = {};
+std::vector<Shift> shift260 = {{&term402, &state685}};
+std::vector<Reduce> reduce260 = {};
+std::vector<Shift> shift261 = {{&term402, &state683}};
+std::vector<Reduce> reduce261 = {};
+std::vector<Shift> shift262 = {{&term402, &state681}};
+std::vector<Reduce> reduce262 = {};
+std::vector<Shift> shift263 = {{&term402, &state679}};
+std::vector<Reduce> reduce263 = {};
+std::vector<Shift> shift264 = {{&term402, &state677}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift265 = {{&term402, &state675}};
+std::vector<Reduce> reduce265 = {};
+std::vector<Shift> shift266 = {{&term402, &state673}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift267 = {{&term402, &state671}};
+std::vector<Reduce> reduce267 = {};
+std::vector<Shift> shift268 = {{&term402, &state669}};
+std::vector<Reduce> reduce268 = {};
+std::vector<Shift> shift269 = {{&term402, &state667}};
+std::vector<Reduce> reduce269 = {};
+std::vector<Shift> shift270 = {{&term402, &state665}};
+std::vector<Reduce> reduce270 = {};
+std::vector<Shift> shift271 = {{&term402, &state663}};
+std::vector<Reduce> reduce271 = {};
+std::vector<Shift> shift272 = {{&term402, &state661}};
+std::vector<Reduce> reduce272 = {};
+std::vector<Shift> shift273 = {{&term402, &state659}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {{&term402, &state657}};
+std::vector<Reduce> reduce274 = {};
+std::vector<Shift> shift275 = {{&term402, &state655}};
+std::vector<Reduce> reduce275 = {};
+std::vector<Shift> shift276 = {{&term402, &state653}};
+std::vector<Reduce> reduce276 = {};
+std::vector<Shift> shift277 = {{&term402, &state651}};
+std::vector<Reduce> reduce277 = {};
+std::vector<Shift> shift278 = {{&term402, &state649}};
+std::vector<Reduce> reduce278 = {};
+std::vector<Shift> shift279 = {{&term402, &state647}};
+std::vector<Reduce> reduce279 = {};
+std::vector<Shift> shift280 = {{&term402, &state645}};
+std::vector<Reduce> reduce280 = {};
+std::vector<Shift> shift281 = {{&term402, &state643}};
+std::vector<Reduce> reduce281 = {};
+std::vector<Shift> shift282 = {{&term402, &state641}};
+std::vector<Reduce> reduce282 = {};
+std::vector<Shift> shift283 = {{&term402, &state639}};
+std::vector<Reduce> reduce283 = {};
+std::vector<Shift> shift284 = {{&term402, &state637}};
+std::vector<Reduce> reduce284 = {};
+std::vector<Shift> shift285 = {{&term402, &state635}};
+std::vector<Reduce> reduce285 = {};
+std::vector<Shift> shift286 = {{&term402, &state633}};
+std::vector<Reduce> reduce286 = {};
+std::vector<Shift> shift287 = {{&term402, &state631}};
+std::vector<Reduce> reduce287 = {};
+std::vector<Shift> shift288 = {{&term402, &state629}};
+std::vector<Reduce> reduce288 = {};
+std::vector<Shift> shift289 = {{&term402, &state627}};
+std::vector<Reduce> reduce289 = {};
+std::vector<Shift> shift290 = {{&term402, &state625}};
+std::vector<Reduce> reduce290 = {};
+std::vector<Shift> shift291 = {{&term402, &state623}};
+std::vector<Reduce> reduce291 = {};
+std::vector<Shift> shift292 = {{&term402, &state621}};
+std::vector<Reduce> reduce292 = {};
+std::vector<Shift> shift293 = {{&term402, &state619}};
+std::vector<Reduce> reduce293 = {};
+std::vector<Shift> shift294 = {{&term402, &state617}};
+std::vector<Reduce> reduce294 = {};
+std::vector<Shift> shift295 = {{&term402, &state615}};
+std::vector<Reduce> reduce295 = {};
+std::vector<Shift> shift296 = {{&term402, &state613}};
+std::vector<Reduce> reduce296 = {};
+std::vector<Shift> shift297 = {{&term402, &state611}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {{&term402, &state609}};
+std::vector<Reduce> reduce298 = {};
+std::vector<Shift> shift299 = {{&term402, &state607}};
+std::vector<Reduce> reduce299 = {};
+std::vector<Shift> shift300 = {{&term402, &state605}};
+std::vector<Reduce> reduce300 = {};
+std::vector<Shift> shift301 = {{&term402, &state603}};
+std::vector<Reduce> reduce301 = {};
+std::vector<Shift> shift302 = {{&term402, &state601}};
+std::vector<Reduce> reduce302 = {};
+std::vector<Shift> shift303 = {{&term402, &state599}};
+std::vector<Reduce> reduce303 = {};
+std::vector<Shift> shift304 = {{&term402, &state597}};
+std::vector<Reduce> reduce304 = {};
+std::vector<Shift> shift305 = {{&term402, &state595}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {{&term402, &state593}};
+std::vector<Reduce> reduce306 = {};
+std::vector<Shift> shift307 = {{&term402, &state591}};
+std::vector<Reduce> reduce307 = {};
+std::vector<Shift> shift308 = {{&term402, &state589}};
+std::vector<Reduce> reduce308 = {};
+std::vector<Shift> shift309 = {{&term402, &state587}};
+std::vector<Reduce> reduce309 = {};
+std::vector<Shift> shift310 = {{&term402, &state585}};
+std::vector<Reduce> reduce310 = {};
+std::vector<Shift> shift311 = {{&term402, &state583}};
+std::vector<Reduce> reduce311 = {};
+std::vector<Shift> shift312 = {{&term402, &state581}};
+std::vector<Reduce> reduce312 = {};
+std::vector<Shift> shift313 = {{&term402, &state579}};
+std::vector<Reduce> reduce313 = {};
+std::vector<Shift> shift314 = {{&term402, &state577}};
+std::vector<Reduce> reduce314 = {};
+std::vector<Shift> shift315 = {{&term402, &state575}};
+std::vector<Reduce> reduce315 = {};
+std::vector<Shift> shift316 = {{&term402, &state573}};
+std::vector<Reduce> reduce316 = {};
+std::vector<Shift> shift317 = {{&term402, &state571}};
+std::vector<Reduce> reduce317 = {};
+std::vector<Shift> shift318 = {{&term402, &state569}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift319 = {{&term402, &state567}};
+std::vector<Reduce> reduce319 = {};
+std::vector<Shift> shift320 = {{&term402, &state565}};
+std::vector<Reduce> reduce320 = {};
+std::vector<Shift> shift321 = {{&term402, &state563}};
+std::vector<Reduce> reduce321 = {};
+std::vector<Shift> shift322 = {{&term402, &state561}};
+std::vector<Reduce> reduce322 = {};
+std::vector<Shift> shift323 = {{&term402, &state559}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {{&term402, &state557}};
+std::vector<Reduce> reduce324 = {};
+std::vector<Shift> shift325 = {{&term402, &state555}};
+std::vector<Reduce> reduce325 = {};
+std::vector<Shift> shift326 = {{&term402, &state553}};
+std::vector<Reduce> reduce326 = {};
+std::vector<Shift> shift327 = {{&term402, &state551}};
+std::vector<Reduce> reduce327 = {};
+std::vector<Shift> shift328 = {{&term402, &state549}};
+std::vector<Reduce> reduce328 = {};
+std::vector<Shift> shift329 = {{&term402, &state547}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift330 = {{&term402, &state545}};
+std::vector<Reduce> reduce330 = {};
+std::vector<Shift> shift331 = {{&term402, &state543}};
+std::vector<Reduce> reduce331 = {};
+std::vector<Shift> shift332 = {{&term402, &state541}};
+std::vector<Reduce> reduce332 = {};
+std::vector<Shift> shift333 = {{&term402, &state539}};
+std::vector<Reduce> reduce333 = {};
+std::vector<Shift> shift334 = {{&term402, &state537}};
+std::vector<Reduce> reduce334 = {};
+std::vector<Shift> shift335 = {{&term402, &state535}};
+std::vector<Reduce> reduce335 = {};
+std::vector<Shift> shift336 = {{&term402, &state533}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {{&term402, &state531}};
+std::vector<Reduce> reduce337 = {};
+std::vector<Shift> shift338 = {{&term402, &state529}};
+std::vector<Reduce> reduce338 = {};
+std::vector<Shift> shift339 = {{&term402, &state527}};
+std::vector<Reduce> reduce339 = {};
+std::vector<Shift> shift340 = {{&term402, &state525}};
+std::vector<Reduce> reduce340 = {};
+std::vector<Shift> shift341 = {{&term402, &state523}};
+std::vector<Reduce> reduce341 = {};
+std::vector<Shift> shift342 = {{&term402, &state521}};
+std::vector<Reduce> reduce342 = {};
+std::vector<Shift> shift343 = {{&term402, &state519}};
+std::vector<Reduce> reduce343 = {};
+std::vector<Shift> shift344 = {{&term402, &state517}};
+std::vector<Reduce> reduce344 = {};
+std::vector<Shift> shift345 = {{&term402, &state515}};
+std::vector<Reduce> reduce345 = {};
+std::vector<Shift> shift346 = {{&term402, &state513}};
+std::vector<Reduce> reduce346 = {};
+std::vector<Shift> shift347 = {{&term402, &state511}};
+std::vector<Reduce> reduce347 = {};
+std::vector<Shift> shift348 = {{&term402, &state509}};
+std::vector<Reduce> reduce348 = {};
+std::vector<Shift> shift349 = {{&term402, &state507}};
+std::vector<Reduce> reduce349 = {};
+std::vector<Shift> shift350 = {{&term402, &state505}};
+std::vector<Reduce> reduce350 = {};
+std::vector<Shift> shift351 = {{&term402, &state503}};
+std::vector<Reduce> reduce351 = {};
+std::vector<Shift> shift352 = {{&term402, &state501}};
+std::vector<Reduce> reduce352 = {};
+std::vector<Shift> shift353 = {{&term402, &state499}};
+std::vector<Reduce> reduce353 = {};
+std::vector<Shift> shift354 = {{&term402, &state497}};
+std::vector<Reduce> reduce354 = {};
+std::vector<Shift> shift355 = {{&term402, &state495}};
+std::vector<Reduce> reduce355 = {};
+std::vector<Shift> shift356 = {{&term402, &state493}};
+std::vector<Reduce> reduce356 = {};
+std::vector<Shift> shift357 = {{&term402, &state491}};
+std::vector<Reduce> reduce357 = {};
+std::vector<Shift> shift358 = {{&term402, &state489}};
+std::vector<Reduce> reduce358 = {};
+std::vector<Shift> shift359 = {{&term402, &state487}};
+std::vector<Reduce> reduce359 = {};
+std::vector<Shift> shift360 = {{&term402, &state485}};
+std::vector<Reduce> reduce360 = {};
+std::vector<Shift> shift361 = {{&term402, &state483}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift362 = {{&term402, &state481}};
+std::vector<Reduce> reduce362 = {};
+std::vector<Shift> shift363 = {{&term402, &state479}};
+std::vector<Reduce> reduce363 = {};
+std::vector<Shift> shift364 = {{&term402, &state477}};
+std::vector<Reduce> reduce364 = {};
+std::vector<Shift> shift365 = {{&term402, &state475}};
+std::vector<Reduce> reduce365 = {};
+std::vector<Shift> shift366 = {{&term402, &state473}};
+std::vector<Reduce> reduce366 = {};
+std::vector<Shift> shift367 = {{&term402, &state471}};
+std::vector<Reduce> reduce367 = {};
+std::vector<Shift> shift368 = {{&term402, &state469}};
+std::vector<Reduce> reduce368 = {};
+std::vector<Shift> shift369 = {{&term402, &state467}};
+std::vector<Reduce> reduce369 = {};
+std::vector<Shift> shift370 = {{&term402, &state465}};
+std::vector<Reduce> reduce370 = {};
+std::vector<Shift> shift371 = {{&term402, &state463}};
+std::vector<Reduce> reduce371 = {};
+std::vector<Shift> shift372 = {{&term402, &state461}};
+std::vector<Reduce> reduce372 = {};
+std::vector<Shift> shift373 = {{&term402, &state459}};
+std::vector<Reduce> reduce373 = {};
+std::vector<Shift> shift374 = {{&term402, &state457}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift375 = {{&term402, &state455}};
+std::vector<Reduce> reduce375 = {};
+std::vector<Shift> shift376 = {{&term402, &state453}};
+std::vector<Reduce> reduce376 = {};
+std::vector<Shift> shift377 = {{&term402, &state451}};
+std::vector<Reduce> reduce377 = {};
+std::vector<Shift> shift378 = {{&term402, &state449}};
+std::vector<Reduce> reduce378 = {};
+std::vector<Shift> shift379 = {{&term402, &state447}};
+std::vector<Reduce> reduce379 = {};
+std::vector<Shift> shift380 = {{&term402, &state445}};
+std::vector<Reduce> reduce380 = {};
+std::vector<Shift> shift381 = {{&term402, &state443}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift382 = {{&term402, &state441}};
+std::vector<Reduce> reduce382 = {};
+std::vector<Shift> shift383 = {{&term402, &state439}};
+std::vector<Reduce> reduce383 = {};
+std::vector<Shift> shift384 = {{&term402, &state437}};
+std::vector<Reduce> reduce384 = {};
+std::vector<Shift> shift385 = {{&term402, &state435}};
+std::vector<Reduce> reduce385 = {};
+std::vector<Shift> shift386 = {{&term402, &state433}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift387 = {{&term402, &state431}};
+std::vector<Reduce> reduce387 = {};
+std::vector<Shift> shift388 = {{&term402, &state429}};
+std::vector<Reduce> reduce388 = {};
+std::vector<Shift> shift389 = {{&term402, &state427}};
+std::vector<Reduce> reduce389 = {};
+std::vector<Shift> shift390 = {{&term402, &state425}};
+std::vector<Reduce> reduce390 = {};
+std::vector<Shift> shift391 = {{&term402, &state423}};
+std::vector<Reduce> reduce391 = {};
+std::vector<Shift> shift392 = {{&term402, &state421}};
+std::vector<Reduce> reduce392 = {};
+std::vector<Shift> shift393 = {{&term402, &state419}};
+std::vector<Reduce> reduce393 = {};
+std::vector<Shift> shift394 = {{&term402, &state417}};
+std::vector<Reduce> reduce394 = {};
+std::vector<Shift> shift395 = {{&term402, &state415}};
+std::vector<Reduce> reduce395 = {};
+std::vector<Shift> shift396 = {{&term402, &state413}};
+std::vector<Reduce> reduce396 = {};
+std::vector<Shift> shift397 = {{&term402, &state411}};
+std::vector<Reduce> reduce397 = {};
+std::vector<Shift> shift398 = {{&term402, &state409}};
+std::vector<Reduce> reduce398 = {};
+std::vector<Shift> shift399 = {{&term402, &state407}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift400 = {{&term402, &state405}};
+std::vector<Reduce> reduce400 = {};
+std::vector<Shift> shift401 = {{&term402, &state403}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {};
+std::vector<Reduce> reduce402 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift403 = {{&term403, &state404}};
+std::vector<Reduce> reduce403 = {};
+std::vector<Shift> shift404 = {};
+std::vector<Reduce> reduce404 = {{nullptr, &rule402, false}};
+std::vector<Shift> shift405 = {{&term403, &state406}};
+std::vector<Reduce> reduce405 = {};
+std::vector<Shift> shift406 = {};
+std::vector<Reduce> reduce406 = {{nullptr, &rule401, false}};
+std::vector<Shift> shift407 = {{&term403, &state408}};
+std::vector<Reduce> reduce407 = {};
+std::vector<Shift> shift408 = {};
+std::vector<Reduce> reduce408 = {{nullptr, &rule400, false}};
+std::vector<Shift> shift409 = {{&term403, &state410}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift410 = {};
+std::vector<Reduce> reduce410 = {{nullptr, &rule399, false}};
+std::vector<Shift> shift411 = {{&term403, &state412}};
+std::vector<Reduce> reduce411 = {};
+std::vector<Shift> shift412 = {};
+std::vector<Reduce> reduce412 = {{nullptr, &rule398, false}};
+std::vector<Shift> shift413 = {{&term403, &state414}};
+std::vector<Reduce> reduce413 = {};
+std::vector<Shift> shift414 = {};
+std::vector<Reduce> reduce414 = {{nullptr, &rule397, false}};
+std::vector<Shift> shift415 = {{&term403, &state416}};
+std::vector<Reduce> reduce415 = {};
+std::vector<Shift> shift416 = {};
+std::vector<Reduce> reduce416 = {{nullptr, &rule396, false}};
+std::vector<Shift> shift417 = {{&term403, &state418}};
+std::vector<Reduce> reduce417 = {};
+std::vector<Shift> shift418 = {};
+std::vector<Reduce> reduce418 = {{nullptr, &rule395, false}};
+std::vector<Shift> shift419 = {{&term403, &state420}};
+std::vector<Reduce> reduce419 = {};
+std::vector<Shift> shift420 = {};
+std::vector<Reduce> reduce420 = {{nullptr, &rule394, false}};
+std::vector<Shift> shift421 = {{&term403, &state422}};
+std::vector<Reduce> reduce421 = {};
+std::vector<Shift> shift422 = {};
+std::vector<Reduce> reduce422 = {{nullptr, &rule393, false}};
+std::vector<Shift> shift423 = {{&term403, &state424}};
+std::vector<Reduce> reduce423 = {};
+std::vector<Shift> shift424 = {};
+std::vector<Reduce> reduce424 = {{nullptr, &rule392, false}};
+std::vector<Shift> shift425 = {{&term403, &state426}};
+std::vector<Reduce> reduce425 = {};
+std::vector<Shift> shift426 = {};
+std::vector<Reduce> reduce426 = {{nullptr, &rule391, false}};
+std::vector<Shift> shift427 = {{&term403, &state428}};
+std::vector<Reduce> reduce427 = {};
+std::vector<Shift> shift428 = {};
+std::vector<Reduce> reduce428 = {{nullptr, &rule390, false}};
+std::vector<Shift> shift429 = {{&term403, &state430}};
+std::vector<Reduce> reduce429 = {};
+std::vector<Shift> shift430 = {};
+std::vector<Reduce> reduce430 = {{nullptr, &rule389, false}};
+std::vector<Shift> shift431 = {{&term403, &state432}};
+std::vector<Reduce> reduce431 = {};
+std::vector<Shift> shift432 = {};
+std::vector<Reduce> reduce432 = {{nullptr, &rule388, false}};
+std::vector<Shift> shift433 = {{&term403, &state434}};
+std::vector<Reduce> reduce433 = {};
+std::vector<Shift> shift434 = {};
+std::vector<Reduce> reduce434 = {{nullptr, &rule387, false}};
+std::vector<Shift> shift435 = {{&term403, &state436}};
+std::vector<Reduce> reduce435 = {};
+std::vector<Shift> shift436 = {};
+std::vector<Reduce> reduce436 = {{nullptr, &rule386, false}};
+std::vector<Shift> shift437 = {{&term403, &state438}};
+std::vector<Reduce> reduce437 = {};
+std::vector<Shift> shift438 = {};
+std::vector<Reduce> reduce438 = {{nullptr, &rule385, false}};
+std::vector<Shift> shift439 = {{&term403, &state440}};
+std::vector<Reduce> reduce439 = {};
+std::vector<Shift> shift440 = {};
+std::vector<Reduce> reduce440 = {{nullptr, &rule384, false}};
+std::vector<Shift> shift441 = {{&term403, &state442}};
+std::vector<Reduce> reduce441 = {};
+std::vector<Shift> shift442 = {};
+std::vector<Reduce> reduce442 = {{nullptr, &rule383, false}};
+std::vector<Shift> shift443 = {{&term403, &state444}};
+std::vector<Reduce> reduce443 = {};
+std::vector<Shift> shift444 = {};
+std::vector<Reduce> reduce444 = {{nullptr, &rule382, false}};
+std::vector<Shift> shift445 = {{&term403, &state446}};
+std::vector<Reduce> reduce445 = {};
+std::vector<Shift> shift446 = {};
+std::vector<Reduce> reduce446 = {{nullptr, &rule381, false}};
+std::vector<Shift> shift447 = {{&term403, &state448}};
+std::vector<Reduce> reduce447 = {};
+std::vector<Shift> shift448 = {};
+std::vector<Reduce> reduce448 = {{nullptr, &rule380, false}};
+std::vector<Shift> shift449 = {{&term403, &state450}};
+std::vector<Reduce> reduce449 = {};
+std::vector<Shift> shift450 = {};
+std::vector<Reduce> reduce450 = {{nullptr, &rule379, false}};
+std::vector<Shift> shift451 = {{&term403, &state452}};
+std::vector<Reduce> reduce451 = {};
+std::vector<Shift> shift452 = {};
+std::vector<Reduce> reduce452 = {{nullptr, &rule378, false}};
+std::vector<Shift> shift453 = {{&term403, &state454}};
+std::vector<Reduce> reduce453 = {};
+std::vector<Shift> shift454 = {};
+std::vector<Reduce> reduce454 = {{nullptr, &rule377, false}};
+std::vector<Shift> shift455 = {{&term403, &state456}};
+std::vector<Reduce> reduce455 = {};
+std::vector<Shift> shift456 = {};
+std::vector<Reduce> reduce456 = {{nullptr, &rule376, false}};
+std::vector<Shift> shift457 = {{&term403, &state458}};
+std::vector<Reduce> reduce457 = {};
+std::vector<Shift> shift458 = {};
+std::vector<Reduce> reduce458 = {{nullptr, &rule375, false}};
+std::vector<Shift> shift459 = {{&term403, &state460}};
+std::vector<Reduce> reduce459 = {};
+std::vector<Shift> shift460 = {};
+std::vector<Reduce> reduce460 = {{nullptr, &rule374, false}};
+std::vector<Shift> shift461 = {{&term403, &state462}};
+std::vector<Reduce> reduce461 = {};
+std::vector<Shift> shift462 = {};
+std::vector<Reduce> reduce462 = {{nullptr, &rule373, false}};
+std::vector<Shift> shift463 = {{&term403, &state464}};
+std::vector<Reduce> reduce463 = {};
+std::vector<Shift> shift464 = {};
+std::vector<Reduce> reduce464 = {{nullptr, &rule372, false}};
+std::vector<Shift> shift465 = {{&term403, &state466}};
+std::vector<Reduce> reduce465 = {};
+std::vector<Shift> shift466 = {};
+std::vector<Reduce> reduce466 = {{nullptr, &rule371, false}};
+std::vector<Shift> shift467 = {{&term403, &state468}};
+std::vector<Reduce> reduce467 = {};
+std::vector<Shift> shift468 = {};
+std::vector<Reduce> reduce468 = {{nullptr, &rule370, false}};
+std::vector<Shift> shift469 = {{&term403, &state470}};
+std::vector<Reduce> reduce469 = {};
+std::vector<Shift> shift470 = {};
+std::vector<Reduce> reduce470 = {{nullptr, &rule369, false}};
+std::vector<Shift> shift471 = {{&term403, &state472}};
+std::vector<Reduce> reduce471 = {};
+std::vector<Shift> shift472 = {};
+std::vector<Reduce> reduce472 = {{nullptr, &rule368, false}};
+std::vector<Shift> shift473 = {{&term403, &state474}};
+std::vector<Reduce> reduce473 = {};
+std::vector<Shift> shift474 = {};
+std::vector<Reduce> reduce474 = {{nullptr, &rule367, false}};
+std::vector<Shift> shift475 = {{&term403, &state476}};
+std::vector<Reduce> reduce475 = {};
+std::vector<Shift> shift476 = {};
+std::vector<Reduce> reduce476 = {{nullptr, &rule366, false}};
+std::vector<Shift> shift477 = {{&term403, &state478}};
+std::vector<Reduce> reduce477 = {};
+std::vector<Shift> shift478 = {};
+std::vector<Reduce> reduce478 = {{nullptr, &rule365, false}};
+std::vector<Shift> shift479 = {{&term403, &state480}};
+std::vector<Reduce> reduce479 = {};
+std::vector<Shift> shift480 = {};
+std::vector<Reduce> reduce480 = {{nullptr, &rule364, false}};
+std::vector<Shift> shift481 = {{&term403, &state482}};
+std::vector<Reduce> reduce481 = {};
+std::vector<Shift> shift482 = {};
+std::vector<Reduce> reduce482 = {{nullptr, &rule363, false}};
+std::vector<Shift> shift483 = {{&term403, &state484}};
+std::vector<Reduce> reduce483 = {};
+std::vector<Shift> shift484 = {};
+std::vector<Reduce> reduce484 = {{nullptr, &rule362, false}};
+std::vector<Shift> shift485 = {{&term403, &state486}};
+std::vector<Reduce> reduce485 = {};
+std::vector<Shift> shift486 = {};
+std::vector<Reduce> reduce486 = {{nullptr, &rule361, false}};
+std::vector<Shift> shift487 = {{&term403, &state488}};
+std::vector<Reduce> reduce487 = {};
+std::vector<Shift> shift488 = {};
+std::vector<Reduce> reduce488 = {{nullptr, &rule360, false}};
+std::vector<Shift> shift489 = {{&term403, &state490}};
+std::vector<Reduce> reduce489 = {};
+std::vector<Shift> shift490 = {};
+std::vector<Reduce> reduce490 = {{nullptr, &rule359, false}};
+std::vector<Shift> shift491 = {{&term403, &state492}};
+std::vector<Reduce> reduce491 = {};
+std::vector<Shift> shift492 = {};
+std::vector<Reduce> reduce492 = {{nullptr, &rule358, false}};
+std::vector<Shift> shift493 = {{&term403, &state494}};
+std::vector<Reduce> reduce493 = {};
+std::vector<Shift> shift494 = {};
+std::vector<Reduce> reduce494 = {{nullptr, &rule357, false}};
+std::vector<Shift> shift495 = {{&term403, &state496}};
+std::vector<Reduce> reduce495 = {};
+std::vector<Shift> shift496 = {};
+std::vector<Reduce> reduce496 = {{nullptr, &rule356, false}};
+std::vector<Shift> shift497 = {{&term403, &state498}};
+std::vector<Reduce> reduce497 = {};
+std::vector<Shift> shift498 = {};
+std::vector<Reduce> reduce498 = {{nullptr, &rule355, false}};
+std::vector<Shift> shift499 = {{&term403, &state500}};
+std::vector<Reduce> reduce499 = {};
+std::vector<Shift> shift500 = {};
+std::vector<Reduce> reduce500 = {{nullptr, &rule354, false}};
+std::vector<Shift> shift501 = {{&term403, &state502}};
+std::vector<Reduce> reduce501 = {};
+std::vector<Shift> shift502 = {};
+std::vector<Reduce> reduce502 = {{nullptr, &rule353, false}};
+std::vector<Shift> shift503 = {{&term403, &state504}};
+std::vector<Reduce> reduce503 = {};
+std::vector<Shift> shift504 = {};
+std::vector<Reduce> reduce504 = {{nullptr, &rule352, false}};
+std::vector<Shift> shift505 = {{&term403, &state506}};
+std::vector<Reduce> reduce505 = {};
+std::vector<Shift> shift506 = {};
+std::vector<Reduce> reduce506 = {{nullptr, &rule351, false}};
+std::vector<Shift> shift507 = {{&term403, &state508}};
+std::vector<Reduce> reduce507 = {};
+std::vector<Shift> shift508 = {};
+std::vector<Reduce> reduce508 = {{nullptr, &rule350, false}};
+std::vector<Shift> shift509 = {{&term403, &state510}};
+std::vector<Reduce> reduce509 = {};
+std::vector<Shift> shift510 = {};
+std::vector<Reduce> reduce510 = {{nullptr, &rule349, false}};
+std::vector<Shift> shift511 = {{&term403, &state512}};
+std::vector<Reduce> reduce511 = {};
+std::vector<Shift> shift512 = {};
+std::vector<Reduce> reduce512 = {{nullptr, &rule348, false}};
+std::vector<Shift> shift513 = {{&term403, &state514}};
+std::vector<Reduce> reduce513 = {};
+std::vector<Shift> shift514 = {};
+std::vector<Reduce> reduce514 = {{nullptr, &rule347, false}};
+std::vector<Shift> shift515 = {{&term403, &state516}};
+std::vector<Reduce> reduce515 = {};
+std::vector<Shift> shift516 = {};
+std::vector<Reduce> reduce516 = {{nullptr, &rule346, false}};
+std::vector<Shift> shift517 = {{&term403, &state518}};
+std::vector<Reduce> reduce517 = {};
+std::vector<Shift> shift518 = {};
+std::vector<Reduce> reduce518 = {{nullptr, &rule345, false}};
+std::vector<Shift> shift519 = {{&term403, &state520}};
+std::vector<Reduce> reduce519 = {};
+std::vector<Shift> shift520 = {};
+std::vector<Reduce> reduce520 = {{nullptr, &rule344, false}};
+std::vector<Shift> shift521 = {{&term403, &state522}};
+std::vector<Reduce> reduce521 = {};
+std::vector<Shift> shift522 = {};
+std::vector<Reduce> reduce522 = {{nullptr, &rule343, false}};
+std::vector<Shift> shift523 = {{&term403, &state524}};
+std::vector<Reduce> reduce523 = {};
+std::vector<Shift> shift524 = {};
+std::vector<Reduce> reduce524 = {{nullptr, &rule342, false}};
+std::vector<Shift> shift525 = {{&term403, &state526}};
+std::vector<Reduce> reduce525 = {};
+std::vector<Shift> shift526 = {};
+std::vector<Reduce> reduce526 = {{nullptr, &rule341, false}};
+std::vector<Shift> shift527 = {{&term403, &state528}};
+std::vector<Reduce> reduce527 = {};
+std::vector<Shift> shift528 = {};
+std::vector<Reduce> reduce528 = {{nullptr, &rule340, false}};
+std::vector<Shift> shift529 = {{&term403, &state530}};
+std::vector<Reduce> reduce529 = {};
+std::vector<Shift> shift530 = {};
+std::vector<Reduce> reduce530 = {{nullptr, &rule339, false}};
+std::vector<Shift> shift531 = {{&term403, &state532}};
+std::vector<Reduce> reduce531 = {};
+std::vector<Shift> shift532 = {};
+std::vector<Reduce> reduce532 = {{nullptr, &rule338, false}};
+std::vector<Shift> shift533 = {{&term403, &state534}};
+std::vector<Reduce> reduce533 = {};
+std::vector<Shift> shift534 = {};
+std::vector<Reduce> reduce534 = {{nullptr, &rule337, false}};
+std::vector<Shift> shift535 = {{&term403, &state536}};
+std::vector<Reduce> reduce535 = {};
+std::vector<Shift> shift536 = {};
+std::vector<Reduce> reduce536 = {{nullptr, &rule336, false}};
+std::vector<Shift> shift537 = {{&term403, &state538}};
+std::vector<Reduce> reduce537 = {};
+std::vector<Shift> shift538 = {};
+std::vector<Reduce> reduce538 = {{nullptr, &rule335, false}};
+std::vector<Shift> shift539 = {{&term403, &state540}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {};
+std::vector<Reduce> reduce540 = {{nullptr, &rule334, false}};
+std::vector<Shift> shift541 = {{&term403, &state542}};
+std::vector<Reduce> reduce541 = {};
+std::vector<Shift> shift542 = {};
+std::vector<Reduce> reduce542 = {{nullptr, &rule333, false}};
+std::vector<Shift> shift543 = {{&term403, &state544}};
+std::vector<Reduce> reduce543 = {};
+std::vector<Shift> shift544 = {};
+std::vector<Reduce> reduce544 = {{nullptr, &rule332, false}};
+std::vector<Shift> shift545 = {{&term403, &state546}};
+std::vector<Reduce> reduce545 = {};
+std::vector<Shift> shift546 = {};
+std::vector<Reduce> reduce546 = {{nullptr, &rule331, false}};
+std::vector<Shift> shift547 = {{&term403, &state548}};
+std::vector<Reduce> reduce547 = {};
+std::vector<Shift> shift548 = {};
+std::vector<Reduce> reduce548 = {{nullptr, &rule330, false}};
+std::vector<Shift> shift549 = {{&term403, &state550}};
+std::vector<Reduce> reduce549 = {};
+std::vector<Shift> shift550 = {};
+std::vector<Reduce> reduce550 = {{nullptr, &rule329, false}};
+std::vector<Shift> shift551 = {{&term403, &state552}};
+std::vector<Reduce> reduce551 = {};
+std::vector<Shift> shift552 = {};
+std::vector<Reduce> reduce552 = {{nullptr, &rule328, false}};
+std::vector<Shift> shift553 = {{&term403, &state554}};
+std::vector<Reduce> reduce553 = {};
+std::vector<Shift> shift554 = {};
+std::vector<Reduce> reduce554 = {{nullptr, &rule327, false}};
+std::vector<Shift> shift555 = {{&term403, &state556}};
+std::vector<Reduce> reduce555 = {};
+std::vector<Shift> shift556 = {};
+std::vector<Reduce> reduce556 = {{nullptr, &rule326, false}};
+std::vector<Shift> shift557 = {{&term403, &state558}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift558 = {};
+std::vector<Reduce> reduce558 = {{nullptr, &rule325, false}};
+std::vector<Shift> shift559 = {{&term403, &state560}};
+std::vector<Reduce> reduce559 = {};
+std::vector<Shift> shift560 = {};
+std::vector<Reduce> reduce560 = {{nullptr, &rule324, false}};
+std::vector<Shift> shift561 = {{&term403, &state562}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift562 = {};
+std::vector<Reduce> reduce562 = {{nullptr, &rule323, false}};
+std::vector<Shift> shift563 = {{&term403, &state564}};
+std::vector<Reduce> reduce563 = {};
+std::vector<Shift> shift564 = {};
+std::vector<Reduce> reduce564 = {{nullptr, &rule322, false}};
+std::vector<Shift> shift565 = {{&term403, &state566}};
+std::vector<Reduce> reduce565 = {};
+std::vector<Shift> shift566 = {};
+std::vector<Reduce> reduce566 = {{nullptr, &rule321, false}};
+std::vector<Shift> shift567 = {{&term403, &state568}};
+std::vector<Reduce> reduce567 = {};
+std::vector<Shift> shift568 = {};
+std::vector<Reduce> reduce568 = {{nullptr, &rule320, false}};
+std::vector<Shift> shift569 = {{&term403, &state570}};
+std::vector<Reduce> reduce569 = {};
+std::vector<Shift> shift570 = {};
+std::vector<Reduce> reduce570 = {{nullptr, &rule319, false}};
+std::vector<Shift> shift571 = {{&term403, &state572}};
+std::vector<Reduce> reduce571 = {};
+std::vector<Shift> shift572 = {};
+std::vector<Reduce> reduce572 = {{nullptr, &rule318, false}};
+std::vector<Shift> shift573 = {{&term403, &state574}};
+std::vector<Reduce> reduce573 = {};
+std::vector<Shift> shift574 = {};
+std::vector<Reduce> reduce574 = {{nullptr, &rule317, false}};
+std::vector<Shift> shift575 = {{&term403, &state576}};
+std::vector<Reduce> reduce575 = {};
+std::vector<Shift> shift576 = {};
+std::vector<Reduce> reduce576 = {{nullptr, &rule316, false}};
+std::vector<Shift> shift577 = {{&term403, &state578}};
+std::vector<Reduce> reduce577 = {};
+std::vector<Shift> shift578 = {};
+std::vector<Reduce> reduce578 = {{nullptr, &rule315, false}};
+std::vector<Shift> shift579 = {{&term403, &state580}};
+std::vector<Reduce> reduce579 = {};
+std::vector<Shift> shift580 = {};
+std::vector<Reduce> reduce580 = {{nullptr, &rule314, false}};
+std::vector<Shift> shift581 = {{&term403, &state582}};
+std::vector<Reduce> reduce581 = {};
+std::vector<Shift> shift582 = {};
+std::vector<Reduce> reduce582 = {{nullptr, &rule313, false}};
+std::vector<Shift> shift583 = {{&term403, &state584}};
+std::vector<Reduce> reduce583 = {};
+std::vector<Shift> shift584 = {};
+std::vector<Reduce> reduce584 = {{nullptr, &rule312, false}};
+std::vector<Shift> shift585 = {{&term403, &state586}};
+std::vector<Reduce> reduce585 = {};
+std::vector<Shift> shift586 = {};
+std::vector<Reduce> reduce586 = {{nullptr, &rule311, false}};
+std::vector<Shift> shift587 = {{&term403, &state588}};
+std::vector<Reduce> reduce587 = {};
+std::vector<Shift> shift588 = {};
+std::vector<Reduce> reduce588 = {{nullptr, &rule310, false}};
+std::vector<Shift> shift589 = {{&term403, &state590}};
+std::vector<Reduce> reduce589 = {};
+std::vector<Shift> shift590 = {};
+std::vector<Reduce> reduce590 = {{nullptr, &rule309, false}};
+std::vector<Shift> shift591 = {{&term403, &state592}};
+std::vector<Reduce> reduce591 = {};
+std::vector<Shift> shift592 = {};
+std::vector<Reduce> reduce592 = {{nullptr, &rule308, false}};
+std::vector<Shift> shift593 = {{&term403, &state594}};
+std::vector<Reduce> reduce593 = {};
+std::vector<Shift> shift594 = {};
+std::vector<Reduce> reduce594 = {{nullptr, &rule307, false}};
+std::vector<Shift> shift595 = {{&term403, &state596}};
+std::vector<Reduce> reduce595 = {};
+std::vector<Shift> shift596 = {};
+std::vector<Reduce> reduce596 = {{nullptr, &rule306, false}};
+std::vector<Shift> shift597 = {{&term403, &state598}};
+std::vector<Reduce> reduce597 = {};
+std::vector<Shift> shift598 = {};
+std::vector<Reduce> reduce598 = {{nullptr, &rule305, false}};
+std::vector<Shift> shift599 = {{&term403, &state600}};
+std::vector<Reduce> reduce599 = {};
+std::vector<Shift> shift600 = {};
+std::vector<Reduce> reduce600 = {{nullptr, &rule304, false}};
+std::vector<Shift> shift601 = {{&term403, &state602}};
+std::vector<Reduce> reduce601 = {};
+std::vector<Shift> shift602 = {};
+std::vector<Reduce> reduce602 = {{nullptr, &rule303, false}};
+std::vector<Shift> shift603 = {{&term403, &state604}};
+std::vector<Reduce> reduce603 = {};
+std::vector<Shift> shift604 = {};
+std::vector<Reduce> reduce604 = {{nullptr, &rule302, false}};
+std::vector<Shift> shift605 = {{&term403, &state606}};
+std::vector<Reduce> reduce605 = {};
+std::vector<Shift> shift606 = {};
+std::vector<Reduce> reduce606 = {{nullptr, &rule301, false}};
+std::vector<Shift> shift607 = {{&term403, &state608}};
+std::vector<Reduce> reduce607 = {};
+std::vector<Shift> shift608 = {};
+std::vector<Reduce> reduce608 = {{nullptr, &rule300, false}};
+std::vector<Shift> shift609 = {{&term403, &state610}};
+std::vector<Reduce> reduce609 = {};
+std::vector<Shift> shift610 = {};
+std::vector<Reduce> reduce610 = {{nullptr, &rule299, false}};
+std::vector<Shift> shift611 = {{&term403, &state612}};
+std::vector<Reduce> reduce611 = {};
+std::vector<Shift> shift612 = {};
+std::vector<Reduce> reduce612 = {{nullptr, &rule298, false}};
+std::vector<Shift> shift613 = {{&term403, &state614}};
+std::vector<Reduce> reduce613 = {};
+std::vector<Shift> shift614 = {};
+std::vector<Reduce> reduce614 = {{nullptr, &rule297, false}};
+std::vector<Shift> shift615 = {{&term403, &state616}};
+std::vector<Reduce> reduce615 = {};
+std::vector<Shift> shift616 = {};
+std::vector<Reduce> reduce616 = {{nullptr, &rule296, false}};
+std::vector<Shift> shift617 = {{&term403, &state618}};
+std::vector<Reduce> reduce617 = {};
+std::vector<Shift> shift618 = {};
+std::vector<Reduce> reduce618 = {{nullptr, &rule295, false}};
+std::vector<Shift> shift619 = {{&term403, &state620}};
+std::vector<Reduce> reduce619 = {};
+std::vector<Shift> shift620 = {};
+std::vector<Reduce> reduce620 = {{nullptr, &rule294, false}};
+std::vector<Shift> shift621 = {{&term403, &state622}};
+std::vector<Reduce> reduce621 = {};
+std::vector<Shift> shift622 = {};
+std::vector<Reduce> reduce622 = {{nullptr, &rule293, false}};
+std::vector<Shift> shift623 = {{&term403, &state624}};
+std::vector<Reduce> reduce623 = {};
+std::vector<Shift> shift624 = {};
+std::vector<Reduce> reduce624 = {{nullptr, &rule292, false}};
+std::vector<Shift> shift625 = {{&term403, &state626}};
+std::vector<Reduce> reduce625 = {};
+std::vector<Shift> shift626 = {};
+std::vector<Reduce> reduce626 = {{nullptr, &rule291, false}};
+std::vector<Shift> shift627 = {{&term403, &state628}};
+std::vector<Reduce> reduce627 = {};
+std::vector<Shift> shift628 = {};
+std::vector<Reduce> reduce628 = {{nullptr, &rule290, false}};
+std::vector<Shift> shift629 = {{&term403, &state630}};
+std::vector<Reduce> reduce629 = {};
+std::vector<Shift> shift630 = {};
+std::vector<Reduce> reduce630 = {{nullptr, &rule289, false}};
+std::vector<Shift> shift631 = {{&term403, &state632}};
+std::vector<Reduce> reduce631 = {};
+std::vector<Shift> shift632 = {};
+std::vector<Reduce> reduce632 = {{nullptr, &rule288, false}};
+std::vector<Shift> shift633 = {{&term403, &state634}};
+std::vector<Reduce> reduce633 = {};
+std::vector<Shift> shift634 = {};
+std::vector<Reduce> reduce634 = {{nullptr, &rule287, false}};
+std::vector<Shift> shift635 = {{&term403, &state636}};
+std::vector<Reduce> reduce635 = {};
+std::vector<Shift> shift636 = {};
+std::vector<Reduce> reduce636 = {{nullptr, &rule286, false}};
+std::vector<Shift> shift637 = {{&term403, &state638}};
+std::vector<Reduce> reduce637 = {};
+std::vector<Shift> shift638 = {};
+std::vector<Reduce> reduce638 = {{nullptr, &rule285, false}};
+std::vector<Shift> shift639 = {{&term403, &state640}};
+std::vector<Reduce> reduce639 = {};
+std::vector<Shift> shift640 = {};
+std::vector<Reduce> reduce640 = {{nullptr, &rule284, false}};
+std::vector<Shift> shift641 = {{&term403, &state642}};
+std::vector<Reduce> reduce641 = {};
+std::vector<Shift> shift642 = {};
+std::vector<Reduce> reduce642 = {{nullptr, &rule283, false}};
+std::vector<Shift> shift643 = {{&term403, &state644}};
+std::vector<Reduce> reduce643 = {};
+std::vector<Shift> shift644 = {};
+std::vector<Reduce> reduce644 = {{nullptr, &rule282, false}};
+std::vector<Shift> shift645 = {{&term403, &state646}};
+std::vector<Reduce> reduce645 = {};
+std::vector<Shift> shift646 = {};
+std::vector<Reduce> reduce646 = {{nullptr, &rule281, false}};
+std::vector<Shift> shift647 = {{&term403, &state648}};
+std::vector<Reduce> reduce647 = {};
+std::vector<Shift> shift648 = {};
+std::vector<Reduce> reduce648 = {{nullptr, &rule280, false}};
+std::vector<Shift> shift649 = {{&term403, &state650}};
+std::vector<Reduce> reduce649 = {};
+std::vector<Shift> shift650 = {};
+std::vector<Reduce> reduce650 = {{nullptr, &rule279, false}};
+std::vector<Shift> shift651 = {{&term403, &state652}};
+std::vector<Reduce> reduce651 = {};
+std::vector<Shift> shift652 = {};
+std::vector<Reduce> reduce652 = {{nullptr, &rule278, false}};
+std::vector<Shift> shift653 = {{&term403, &state654}};
+std::vector<Reduce> reduce653 = {};
+std::vector<Shift> shift654 = {};
+std::vector<Reduce> reduce654 = {{nullptr, &rule277, false}};
+std::vector<Shift> shift655 = {{&term403, &state656}};
+std::vector<Reduce> reduce655 = {};
+std::vector<Shift> shift656 = {};
+std::vector<Reduce> reduce656 = {{nullptr, &rule276, false}};
+std::vector<Shift> shift657 = {{&term403, &state658}};
+std::vector<Reduce> reduce657 = {};
+std::vector<Shift> shift658 = {};
+std::vector<Reduce> reduce658 = {{nullptr, &rule275, false}};
+std::vector<Shift> shift659 = {{&term403, &state660}};
+std::vector<Reduce> reduce659 = {};
+std::vector<Shift> shift660 = {};
+std::vector<Reduce> reduce660 = {{nullptr, &rule274, false}};
+std::vector<Shift> shift661 = {{&term403, &state662}};
+std::vector<Reduce> reduce661 = {};
+std::vector<Shift> shift662 = {};
+std::vector<Reduce> reduce662 = {{nullptr, &rule273, false}};
+std::vector<Shift> shift663 = {{&term403, &state664}};
+std::vector<Reduce> reduce663 = {};
+std::vector<Shift> shift664 = {};
+std::vector<Reduce> reduce664 = {{nullptr, &rule272, false}};
+std::vector<Shift> shift665 = {{&term403, &state666}};
+std::vector<Reduce> reduce665 = {};
+std::vector<Shift> shift666 = {};
+std::vector<Reduce> reduce666 = {{nullptr, &rule271, false}};
+std::vector<Shift> shift667 = {{&term403, &state668}};
+std::vector<Reduce> reduce667 = {};
+std::vector<Shift> shift668 = {};
+std::vector<Reduce> reduce668 = {{nullptr, &rule270, false}};
+std::vector<Shift> shift669 = {{&term403, &state670}};
+std::vector<Reduce> reduce669 = {};
+std::vector<Shift> shift670 = {};
+std::vector<Reduce> reduce670 = {{nullptr, &rule269, false}};
+std::vector<Shift> shift671 = {{&term403, &state672}};
+std::vector<Reduce> reduce671 = {};
+std::vector<Shift> shift672 = {};
+std::vector<Reduce> reduce672 = {{nullptr, &rule268, false}};
+std::vector<Shift> shift673 = {{&term403, &state674}};
+std::vector<Reduce> reduce673 = {};
+std::vector<Shift> shift674 = {};
+std::vector<Reduce> reduce674 = {{nullptr, &rule267, false}};
+std::vector<Shift> shift675 = {{&term403, &state676}};
+std::vector<Reduce> reduce675 = {};
+std::vector<Shift> shift676 = {};
+std::vector<Reduce> reduce676 = {{nullptr, &rule266, false}};
+std::vector<Shift> shift677 = {{&term403, &state678}};
+std::vector<Reduce> reduce677 = {};
+std::vector<Shift> shift678 = {};
+std::vector<Reduce> reduce678 = {{nullptr, &rule265, false}};
+std::vector<Shift> shift679 = {{&term403, &state680}};
+std::vector<Reduce> reduce679 = {};
+std::vector<Shift> shift680 = {};
+std::vector<Reduce> reduce680 = {{nullptr, &rule264, false}};
+std::vector<Shift> shift681 = {{&term403, &state682}};
+std::vector<Reduce> reduce681 = {};
+std::vector<Shift> shift682 = {};
+std::vector<Reduce> reduce682 = {{nullptr, &rule263, false}};
+std::vector<Shift> shift683 = {{&term403, &state684}};
+std::vector<Reduce> reduce683 = {};
+std::vector<Shift> shift684 = {};
+std::vector<Reduce> reduce684 = {{nullptr, &rule262, false}};
+std::vector<Shift> shift685 = {{&term403, &state686}};
+std::vector<Reduce> reduce685 = {};
+std::vector<Shift> shift686 = {};
+std::vector<Reduce> reduce686 = {{nullptr, &rule261, false}};
+std::vector<Shift> shift687 = {{&term403, &state688}};
+std::vector<Reduce> reduce687 = {};
+std::vector<Shift> shift688 = {};
+std::vector<Reduce> reduce688 = {{nullptr, &rule260, false}};
+std::vector<Shift> shift689 = {{&term403, &state690}};
+std::vector<Reduce> reduce689 = {};
+std::vector<Shift> shift690 = {};
+std::vector<Reduce> reduce690 = {{nullptr, &rule259, false}};
+std::vector<Shift> shift691 = {{&term403, &state692}};
+std::vector<Reduce> reduce691 = {};
+std::vector<Shift> shift692 = {};
+std::vector<Reduce> reduce692 = {{nullptr, &rule258, false}};
+std::vector<Shift> shift693 = {{&term403, &state694}};
+std::vector<Reduce> reduce693 = {};
+std::vector<Shift> shift694 = {};
+std::vector<Reduce> reduce694 = {{nullptr, &rule257, false}};
+std::vector<Shift> shift695 = {{&term403, &state696}};
+std::vector<Reduce> reduce695 = {};
+std::vector<Shift> shift696 = {};
+std::vector<Reduce> reduce696 = {{nullptr, &rule256, false}};
+std::vector<Shift> shift697 = {{&term403, &state698}};
+std::vector<Reduce> reduce697 = {};
+std::vector<Shift> shift698 = {};
+std::vector<Reduce> reduce698 = {{nullptr, &rule255, false}};
+std::vector<Shift> shift699 = {{&term403, &state700}};
+std::vector<Reduce> reduce699 = {};
+std::vector<Shift> shift700 = {};
+std::vector<Reduce> reduce700 = {{nullptr, &rule254, false}};
+std::vector<Shift> shift701 = {{&term403, &state702}};
+std::vector<Reduce> reduce701 = {};
+std::vector<Shift> shift702 = {};
+std::vector<Reduce> reduce702 = {{nullptr, &rule253, false}};
+std::vector<Shift> shift703 = {{&term403, &state704}};
+std::vector<Reduce> reduce703 = {};
+std::vector<Shift> shift704 = {};
+std::vector<Reduce> reduce704 = {{nullptr, &rule252, false}};
+std::vector<Shift> shift705 = {{&term403, &state706}};
+std::vector<Reduce> reduce705 = {};
+std::vector<Shift> shift706 = {};
+std::vector<Reduce> reduce706 = {{nullptr, &rule251, false}};
+std::vector<Shift> shift707 = {{&term403, &state708}};
+std::vector<Reduce> reduce707 = {};
+std::vector<Shift> shift708 = {};
+std::vector<Reduce> reduce708 = {{nullptr, &rule250, false}};
+std::vector<Shift> shift709 = {{&term403, &state710}};
+std::vector<Reduce> reduce709 = {};
+std::vector<Shift> shift710 = {};
+std::vector<Reduce> reduce710 = {{nullptr, &rule249, false}};
+std::vector<Shift> shift711 = {{&term403, &state712}};
+std::vector<Reduce> reduce711 = {};
+std::vector<Shift> shift712 = {};
+std::vector<Reduce> reduce712 = {{nullptr, &rule248, false}};
+std::vector<Shift> shift713 = {{&term403, &state714}};
+std::vector<Reduce> reduce713 = {};
+std::vector<Shift> shift714 = {};
+std::vector<Reduce> reduce714 = {{nullptr, &rule247, false}};
+std::vector<Shift> shift715 = {{&term403, &state716}};
+std::vector<Reduce> reduce715 = {};
+std::vector<Shift> shift716 = {};
+std::vector<Reduce> reduce716 = {{nullptr, &rule246, false}};
+std::vector<Shift> shift717 = {{&term403, &state718}};
+std::vector<Reduce> reduce717 = {};
+std::vector<Shift> shift718 = {};
+std::vector<Reduce> reduce718 = {{nullptr, &rule245, false}};
+std::vector<Shift> shift719 = {{&term403, &state720}};
+std::vector<Reduce> reduce719 = {};
+std::vector<Shift> shift720 = {};
+std::vector<Reduce> reduce720 = {{nullptr, &rule244, false}};
+std::vector<Shift> shift721 = {{&term403, &state722}};
+std::vector<Reduce> reduce721 = {};
+std::vector<Shift> shift722 = {};
+std::vector<Reduce> reduce722 = {{nullptr, &rule243, false}};
+std::vector<Shift> shift723 = {{&term403, &state724}};
+std::vector<Reduce> reduce723 = {};
+std::vector<Shift> shift724 = {};
+std::vector<Reduce> reduce724 = {{nullptr, &rule242, false}};
+std::vector<Shift> shift725 = {{&term403, &state726}};
+std::vector<Reduce> reduce725 = {};
+std::vector<Shift> shift726 = {};
+std::vector<Reduce> reduce726 = {{nullptr, &rule241, false}};
+std::vector<Shift> shift727 = {{&term403, &state728}};
+std::vector<Reduce> reduce727 = {};
+std::vector<Shift> shift728 = {};
+std::vector<Reduce> reduce728 = {{nullptr, &rule240, false}};
+std::vector<Shift> shift729 = {{&term403, &state730}};
+std::vector<Reduce> reduce729 = {};
+std::vector<Shift> shift730 = {};
+std::vector<Reduce> reduce730 = {{nullptr, &rule239, false}};
+std::vector<Shift> shift731 = {{&term403, &state732}};
+std::vector<Reduce> reduce731 = {};
+std::vector<Shift> shift732 = {};
+std::vector<Reduce> reduce732 = {{nullptr, &rule238, false}};
+std::vector<Shift> shift733 = {{&term403, &state734}};
+std::vector<Reduce> reduce733 = {};
+std::vector<Shift> shift734 = {};
+std::vector<Reduce> reduce734 = {{nullptr, &rule237, false}};
+std::vector<Shift> shift735 = {{&term403, &state736}};
+std::vector<Reduce> reduce735 = {};
+std::vector<Shift> shift736 = {};
+std::vector<Reduce> reduce736 = {{nullptr, &rule236, false}};
+std::vector<Shift> shift737 = {{&term403, &state738}};
+std::vector<Reduce> reduce737 = {};
+std::vector<Shift> shift738 = {};
+std::vector<Reduce> reduce738 = {{nullptr, &rule235, false}};
+std::vector<Shift> shift739 = {{&term403, &state740}};
+std::vector<Reduce> reduce739 = {};
+std::vector<Shift> shift740 = {};
+std::vector<Reduce> reduce740 = {{nullptr, &rule234, false}};
+std::vector<Shift> shift741 = {{&term403, &state742}};
+std::vector<Reduce> reduce741 = {};
+std::vector<Shift> shift742 = {};
+std::vector<Reduce> reduce742 = {{nullptr, &rule233, false}};
+std::vector<Shift> shift743 = {{&term403, &state744}};
+std::vector<Reduce> reduce743 = {};
+std::vector<Shift> shift744 = {};
+std::vector<Reduce> reduce744 = {{nullptr, &rule232, false}};
+std::vector<Shift> shift745 = {{&term403, &state746}};
+std::vector<Reduce> reduce745 = {};
+std::vector<Shift> shift746 = {};
+std::vector<Reduce> reduce746 = {{nullptr, &rule231, false}};
+std::vector<Shift> shift747 = {{&term403, &state748}};
+std::vector<Reduce> reduce747 = {};
+std::vector<Shift> shift748 = {};
+std::vector<Reduce> reduce748 = {{nullptr, &rule230, false}};
+std::vector<Shift> shift749 = {{&term403, &state750}};
+std::vector<Reduce> reduce749 = {};
+std::vector<Shift> shift750 = {};
+std::vector<Reduce> reduce750 = {{nullptr, &rule229, false}};
+std::vector<Shift> shift751 = {{&term403, &state752}};
+std::vector<Reduce> reduce751 = {};
+std::vector<Shift> shift752 = {};
+std::vector<Reduce> reduce752 = {{nullptr, &rule228, false}};
+std::vector<Shift> shift753 = {{&term403, &state754}};
+std::vector<Reduce> reduce753 = {};
+std::vector<Shift> shift754 = {};
+std::vector<Reduce> reduce754 = {{nullptr, &rule227, false}};
+std::vector<Shift> shift755 = {{&term403, &state756}};
+std::vector<Reduce> reduce755 = {};
+std::vector<Shift> shift756 = {};
+std::vector<Reduce> reduce756 = {{nullptr, &rule226, false}};
+std::vector<Shift> shift757 = {{&term403, &state758}};
+std::vector<Reduce> reduce757 = {};
+std::vector<Shift> shift758 = {};
+std::vector<Reduce> reduce758 = {{nullptr, &rule225, false}};
+std::vector<Shift> shift759 = {{&term403, &state760}};
+std::vector<Reduce> reduce759 = {};
+std::vector<Shift> shift760 = {};
+std::vector<Reduce> reduce760 = {{nullptr, &rule224, false}};
+std::vector<Shift> shift761 = {{&term403, &state762}};
+std::vector<Reduce> reduce761 = {};
+std::vector<Shift> shift762 = {};
+std::vector<Reduce> reduce762 = {{nullptr, &rule223, false}};
+std::vector<Shift> shift763 = {{&term403, &state764}};
+std::vector<Reduce> reduce763 = {};
+std::vector<Shift> shift764 = {};
+std::vector<Reduce> reduce764 = {{nullptr, &rule222, false}};
+std::vector<Shift> shift765 = {{&term403, &state766}};
+std::vector<Reduce> reduce765 = {};
+std::vector<Shift> shift766 = {};
+std::vector<Reduce> reduce766 = {{nullptr, &rule221, false}};
+std::vector<Shift> shift767 = {{&term403, &state768}};
+std::vector<Reduce> reduce767 = {};
+std::vector<Shift> shift768 = {};
+std::vector<Reduce> reduce768 = {{nullptr, &rule220, false}};
+std::vector<Shift> shift769 = {{&term403, &state770}};
+std::vector<Reduce> reduce769 = {};
+std::vector<Shift> shift770 = {};
+std::vector<Reduce> reduce770 = {{nullptr, &rule219, false}};
+std::vector<Shift> shift771 = {{&term403, &state772}};
+std::vector<Reduce> reduce771 = {};
+std::vector<Shift> shift772 = {};
+std::vector<Reduce> reduce772 = {{nullptr, &rule218, false}};
+std::vector<Shift> shift773 = {{&term403, &state774}};
+std::vector<Reduce> reduce773 = {};
+std::vector<Shift> shift774 = {};
+std::vector<Reduce> reduce774 = {{nullptr, &rule217, false}};
+std::vector<Shift> shift775 = {{&term403, &state776}};
+std::vector<Reduce> reduce775 = {};
+std::vector<Shift> shift776 = {};
+std::vector<Reduce> reduce776 = {{nullptr, &rule216, false}};
+std::vector<Shift> shift777 = {{&term403, &state778}};
+std::vector<Reduce> reduce777 = {};
+std::vector<Shift> shift778 = {};
+std::vector<Reduce> reduce778 = {{nullptr, &rule215, false}};
+std::vector<Shift> shift779 = {{&term403, &state780}};
+std::vector<Reduce> reduce779 = {};
+std::vector<Shift> shift780 = {};
+std::vector<Reduce> reduce780 = {{nullptr, &rule214, false}};
+std::vector<Shift> shift781 = {{&term403, &state782}};
+std::vector<Reduce> reduce781 = {};
+std::vector<Shift> shift782 = {};
+std::vector<Reduce> reduce782 = {{nullptr, &rule213, false}};
+std::vector<Shift> shift783 = {{&term403, &state784}};
+std::vector<Reduce> reduce783 = {};
+std::vector<Shift> shift784 = {};
+std::vector<Reduce> reduce784 = {{nullptr, &rule212, false}};
+std::vector<Shift> shift785 = {{&term403, &state786}};
+std::vector<Reduce> reduce785 = {};
+std::vector<Shift> shift786 = {};
+std::vector<Reduce> reduce786 = {{nullptr, &rule211, false}};
+std::vector<Shift> shift787 = {{&term403, &state788}};
+std::vector<Reduce> reduce787 = {};
+std::vector<Shift> shift788 = {};
+std::vector<Reduce> reduce788 = {{nullptr, &rule210, false}};
+std::vector<Shift> shift789 = {{&term403, &state790}};
+std::vector<Reduce> reduce789 = {};
+std::vector<Shift> shift790 = {};
+std::vector<Reduce> reduce790 = {{nullptr, &rule209, false}};
+std::vector<Shift> shift791 = {{&term403, &state792}};
+std::vector<Reduce> reduce791 = {};
+std::vector<Shift> shift792 = {};
+std::vector<Reduce> reduce792 = {{nullptr, &rule208, false}};
+std::vector<Shift> shift793 = {{&term403, &state794}};
+std::vector<Reduce> reduce793 = {};
+std::vector<Shift> shift794 = {};
+std::vector<Reduce> reduce794 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift795 = {{&term403, &state796}};
+std::vector<Reduce> reduce795 = {};
+std::vector<Shift> shift796 = {};
+std::vector<Reduce> reduce796 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift797 = {{&term403, &state798}};
+std::vector<Reduce> reduce797 = {};
+std::vector<Shift> shift798 = {};
+std::vector<Reduce> reduce798 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift799 = {{&term403, &state800}};
+std::vector<Reduce> reduce799 = {};
+std::vector<Shift> shift800 = {};
+std::vector<Reduce> reduce800 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift801 = {{&term403, &state802}};
+std::vector<Reduce> reduce801 = {};
+std::vector<Shift> shift802 = {};
+std::vector<Reduce> reduce802 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift803 = {{&term403, &state804}};
+std::vector<Reduce> reduce803 = {};
+std::vector<Shift> shift804 = {};
+std::vector<Reduce> reduce804 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift805 = {{&term403, &state806}};
+std::vector<Reduce> reduce805 = {};
+std::vector<Shift> shift806 = {};
+std::vector<Reduce> reduce806 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift807 = {{&term403, &state808}};
+std::vector<Reduce> reduce807 = {};
+std::vector<Shift> shift808 = {};
+std::vector<Reduce> reduce808 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift809 = {{&term403, &state810}};
+std::vector<Reduce> reduce809 = {};
+std::vector<Shift> shift810 = {};
+std::vector<Reduce> reduce810 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift811 = {{&term403, &state812}};
+std::vector<Reduce> reduce811 = {};
+std::vector<Shift> shift812 = {};
+std::vector<Reduce> reduce812 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift813 = {{&term403, &state814}};
+std::vector<Reduce> reduce813 = {};
+std::vector<Shift> shift814 = {};
+std::vector<Reduce> reduce814 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift815 = {{&term403, &state816}};
+std::vector<Reduce> reduce815 = {};
+std::vector<Shift> shift816 = {};
+std::vector<Reduce> reduce816 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift817 = {{&term403, &state818}};
+std::vector<Reduce> reduce817 = {};
+std::vector<Shift> shift818 = {};
+std::vector<Reduce> reduce818 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift819 = {{&term403, &state820}};
+std::vector<Reduce> reduce819 = {};
+std::vector<Shift> shift820 = {};
+std::vector<Reduce> reduce820 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift821 = {{&term403, &state822}};
+std::vector<Reduce> reduce821 = {};
+std::vector<Shift> shift822 = {};
+std::vector<Reduce> reduce822 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift823 = {{&term403, &state824}};
+std::vector<Reduce> reduce823 = {};
+std::vector<Shift> shift824 = {};
+std::vector<Reduce> reduce824 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift825 = {{&term403, &state826}};
+std::vector<Reduce> reduce825 = {};
+std::vector<Shift> shift826 = {};
+std::vector<Reduce> reduce826 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift827 = {{&term403, &state828}};
+std::vector<Reduce> reduce827 = {};
+std::vector<Shift> shift828 = {};
+std::vector<Reduce> reduce828 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift829 = {{&term403, &state830}};
+std::vector<Reduce> reduce829 = {};
+std::vector<Shift> shift830 = {};
+std::vector<Reduce> reduce830 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift831 = {{&term403, &state832}};
+std::vector<Reduce> reduce831 = {};
+std::vector<Shift> shift832 = {};
+std::vector<Reduce> reduce832 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift833 = {{&term403, &state834}};
+std::vector<Reduce> reduce833 = {};
+std::vector<Shift> shift834 = {};
+std::vector<Reduce> reduce834 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift835 = {{&term403, &state836}};
+std::vector<Reduce> reduce835 = {};
+std::vector<Shift> shift836 = {};
+std::vector<Reduce> reduce836 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift837 = {{&term403, &state838}};
+std::vector<Reduce> reduce837 = {};
+std::vector<Shift> shift838 = {};
+std::vector<Reduce> reduce838 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift839 = {{&term403, &state840}};
+std::vector<Reduce> reduce839 = {};
+std::vector<Shift> shift840 = {};
+std::vector<Reduce> reduce840 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift841 = {{&term403, &state842}};
+std::vector<Reduce> reduce841 = {};
+std::vector<Shift> shift842 = {};
+std::vector<Reduce> reduce842 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift843 = {{&term403, &state844}};
+std::vector<Reduce> reduce843 = {};
+std::vector<Shift> shift844 = {};
+std::vector<Reduce> reduce844 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift845 = {{&term403, &state846}};
+std::vector<Reduce> reduce845 = {};
+std::vector<Shift> shift846 = {};
+std::vector<Reduce> reduce846 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift847 = {{&term403, &state848}};
+std::vector<Reduce> reduce847 = {};
+std::vector<Shift> shift848 = {};
+std::vector<Reduce> reduce848 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift849 = {{&term403, &state850}};
+std::vector<Reduce> reduce849 = {};
+std::vector<Shift> shift850 = {};
+std::vector<Reduce> reduce850 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift851 = {{&term403, &state852}};
+std::vector<Reduce> reduce851 = {};
+std::vector<Shift> shift852 = {};
+std::vector<Reduce> reduce852 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift853 = {{&term403, &state854}};
+std::vector<Reduce> reduce853 = {};
+std::vector<Shift> shift854 = {};
+std::vector<Reduce> reduce854 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift855 = {{&term403, &state856}};
+std::vector<Reduce> reduce855 = {};
+std::vector<Shift> shift856 = {};
+std::vector<Reduce> reduce856 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift857 = {{&term403, &state858}};
+std::vector<Reduce> reduce857 = {};
+std::vector<Shift> shift858 = {};
+std::vector<Reduce> reduce858 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift859 = {{&term403, &state860}};
+std::vector<Reduce> reduce859 = {};
+std::vector<Shift> shift860 = {};
+std::vector<Reduce> reduce860 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift861 = {{&term403, &state862}};
+std::vector<Reduce> reduce861 = {};
+std::vector<Shift> shift862 = {};
+std::vector<Reduce> reduce862 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift863 = {{&term403, &state864}};
+std::vector<Reduce> reduce863 = {};
+std::vector<Shift> shift864 = {};
+std::vector<Reduce> reduce864 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift865 = {{&term403, &state866}};
+std::vector<Reduce> reduce865 = {};
+std::vector<Shift> shift866 = {};
+std::vector<Reduce> reduce866 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift867 = {{&term403, &state868}};
+std::vector<Reduce> reduce867 = {};
+std::vector<Shift> shift868 = {};
+std::vector<Reduce> reduce868 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift869 = {{&term403, &state870}};
+std::vector<Reduce> reduce869 = {};
+std::vector<Shift> shift870 = {};
+std::vector<Reduce> reduce870 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift871 = {{&term403, &state872}};
+std::vector<Reduce> reduce871 = {};
+std::vector<Shift> shift872 = {};
+std::vector<Reduce> reduce872 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift873 = {{&term403, &state874}};
+std::vector<Reduce> reduce873 = {};
+std::vector<Shift> shift874 = {};
+std::vector<Reduce> reduce874 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift875 = {{&term403, &state876}};
+std::vector<Reduce> reduce875 = {};
+std::vector<Shift> shift876 = {};
+std::vector<Reduce> reduce876 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift877 = {{&term403, &state878}};
+std::vector<Reduce> reduce877 = {};
+std::vector<Shift> shift878 = {};
+std::vector<Reduce> reduce878 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift879 = {{&term403, &state880}};
+std::vector<Reduce> reduce879 = {};
+std::vector<Shift> shift880 = {};
+std::vector<Reduce> reduce880 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift881 = {{&term403, &state882}};
+std::vector<Reduce> reduce881 = {};
+std::vector<Shift> shift882 = {};
+std::vector<Reduce> reduce882 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift883 = {{&term403, &state884}};
+std::vector<Reduce> reduce883 = {};
+std::vector<Shift> shift884 = {};
+std::vector<Reduce> reduce884 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift885 = {{&term403, &state886}};
+std::vector<Reduce> reduce885 = {};
+std::vector<Shift> shift886 = {};
+std::vector<Reduce> reduce886 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift887 = {{&term403, &state888}};
+std::vector<Reduce> reduce887 = {};
+std::vector<Shift> shift888 = {};
+std::vector<Reduce> reduce888 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift889 = {{&term403, &state890}};
+std::vector<Reduce> reduce889 = {};
+std::vector<Shift> shift890 = {};
+std::vector<Reduce> reduce890 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift891 = {{&term403, &state892}};
+std::vector<Reduce> reduce891 = {};
+std::vector<Shift> shift892 = {};
+std::vector<Reduce> reduce892 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift893 = {{&term403, &state894}};
+std::vector<Reduce> reduce893 = {};
+std::vector<Shift> shift894 = {};
+std::vector<Reduce> reduce894 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift895 = {{&term403, &state896}};
+std::vector<Reduce> reduce895 = {};
+std::vector<Shift> shift896 = {};
+std::vector<Reduce> reduce896 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift897 = {{&term403, &state898}};
+std::vector<Reduce> reduce897 = {};
+std::vector<Shift> shift898 = {};
+std::vector<Reduce> reduce898 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift899 = {{&term403, &state900}};
+std::vector<Reduce> reduce899 = {};
+std::vector<Shift> shift900 = {};
+std::vector<Reduce> reduce900 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift901 = {{&term403, &state902}};
+std::vector<Reduce> reduce901 = {};
+std::vector<Shift> shift902 = {};
+std::vector<Reduce> reduce902 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift903 = {{&term403, &state904}};
+std::vector<Reduce> reduce903 = {};
+std::vector<Shift> shift904 = {};
+std::vector<Reduce> reduce904 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift905 = {{&term403, &state906}};
+std::vector<Reduce> reduce905 = {};
+std::vector<Shift> shift906 = {};
+std::vector<Reduce> reduce906 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift907 = {{&term403, &state908}};
+std::vector<Reduce> reduce907 = {};
+std::vector<Shift> shift908 = {};
+std::vector<Reduce> reduce908 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift909 = {{&term403, &state910}};
+std::vector<Reduce> reduce909 = {};
+std::vector<Shift> shift910 = {};
+std::vector<Reduce> reduce910 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift911 = {{&term403, &state912}};
+std::vector<Reduce> reduce911 = {};
+std::vector<Shift> shift912 = {};
+std::vector<Reduce> reduce912 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift913 = {{&term403, &state914}};
+std::vector<Reduce> reduce913 = {};
+std::vector<Shift> shift914 = {};
+std::vector<Reduce> reduce914 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift915 = {{&term403, &state916}};
+std::vector<Reduce> reduce915 = {};
+std::vector<Shift> shift916 = {};
+std::vector<Reduce> reduce916 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift917 = {{&term403, &state918}};
+std::vector<Reduce> reduce917 = {};
+std::vector<Shift> shift918 = {};
+std::vector<Reduce> reduce918 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift919 = {{&term403, &state920}};
+std::vector<Reduce> reduce919 = {};
+std::vector<Shift> shift920 = {};
+std::vector<Reduce> reduce920 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift921 = {{&term403, &state922}};
+std::vector<Reduce> reduce921 = {};
+std::vector<Shift> shift922 = {};
+std::vector<Reduce> reduce922 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift923 = {{&term403, &state924}};
+std::vector<Reduce> reduce923 = {};
+std::vector<Shift> shift924 = {};
+std::vector<Reduce> reduce924 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift925 = {{&term403, &state926}};
+std::vector<Reduce> reduce925 = {};
+std::vector<Shift> shift926 = {};
+std::vector<Reduce> reduce926 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift927 = {{&term403, &state928}};
+std::vector<Reduce> reduce927 = {};
+std::vector<Shift> shift928 = {};
+std::vector<Reduce> reduce928 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift929 = {{&term403, &state930}};
+std::vector<Reduce> reduce929 = {};
+std::vector<Shift> shift930 = {};
+std::vector<Reduce> reduce930 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift931 = {{&term403, &state932}};
+std::vector<Reduce> reduce931 = {};
+std::vector<Shift> shift932 = {};
+std::vector<Reduce> reduce932 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift933 = {{&term403, &state934}};
+std::vector<Reduce> reduce933 = {};
+std::vector<Shift> shift934 = {};
+std::vector<Reduce> reduce934 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift935 = {{&term403, &state936}};
+std::vector<Reduce> reduce935 = {};
+std::vector<Shift> shift936 = {};
+std::vector<Reduce> reduce936 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift937 = {{&term403, &state938}};
+std::vector<Reduce> reduce937 = {};
+std::vector<Shift> shift938 = {};
+std::vector<Reduce> reduce938 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift939 = {{&term403, &state940}};
+std::vector<Reduce> reduce939 = {};
+std::vector<Shift> shift940 = {};
+std::vector<Reduce> reduce940 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift941 = {{&term403, &state942}};
+std::vector<Reduce> reduce941 = {};
+std::vector<Shift> shift942 = {};
+std::vector<Reduce> reduce942 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift943 = {{&term403, &state944}};
+std::vector<Reduce> reduce943 = {};
+std::vector<Shift> shift944 = {};
+std::vector<Reduce> reduce944 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift945 = {{&term403, &state946}};
+std::vector<Reduce> reduce945 = {};
+std::vector<Shift> shift946 = {};
+std::vector<Reduce> reduce946 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift947 = {{&term403, &state948}};
+std::vector<Reduce> reduce947 = {};
+std::vector<Shift> shift948 = {};
+std::vector<Reduce> reduce948 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift949 = {{&term403, &state950}};
+std::vector<Reduce> reduce949 = {};
+std::vector<Shift> shift950 = {};
+std::vector<Reduce> reduce950 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift951 = {{&term403, &state952}};
+std::vector<Reduce> reduce951 = {};
+std::vector<Shift> shift952 = {};
+std::vector<Reduce> reduce952 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift953 = {{&term403, &state954}};
+std::vector<Reduce> reduce953 = {};
+std::vector<Shift> shift954 = {};
+std::vector<Reduce> reduce954 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift955 = {{&term403, &state956}};
+std::vector<Reduce> reduce955 = {};
+std::vector<Shift> shift956 = {};
+std::vector<Reduce> reduce956 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift957 = {{&term403, &state958}};
+std::vector<Reduce> reduce957 = {};
+std::vector<Shift> shift958 = {};
+std::vector<Reduce> reduce958 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift959 = {{&term403, &state960}};
+std::vector<Reduce> reduce959 = {};
+std::vector<Shift> shift960 = {};
+std::vector<Reduce> reduce960 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift961 = {{&term403, &state962}};
+std::vector<Reduce> reduce961 = {};
+std::vector<Shift> shift962 = {};
+std::vector<Reduce> reduce962 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift963 = {{&term403, &state964}};
+std::vector<Reduce> reduce963 = {};
+std::vector<Shift> shift964 = {};
+std::vector<Reduce> reduce964 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift965 = {{&term403, &state966}};
+std::vector<Reduce> reduce965 = {};
+std::vector<Shift> shift966 = {};
+std::vector<Reduce> reduce966 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift967 = {{&term403, &state968}};
+std::vector<Reduce> reduce967 = {};
+std::vector<Shift> shift968 = {};
+std::vector<Reduce> reduce968 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift969 = {{&term403, &state970}};
+std::vector<Reduce> reduce969 = {};
+std::vector<Shift> shift970 = {};
+std::vector<Reduce> reduce970 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift971 = {{&term403, &state972}};
+std::vector<Reduce> reduce971 = {};
+std::vector<Shift> shift972 = {};
+std::vector<Reduce> reduce972 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift973 = {{&term403, &state974}};
+std::vector<Reduce> reduce973 = {};
+std::vector<Shift> shift974 = {};
+std::vector<Reduce> reduce974 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift975 = {{&term403, &state976}};
+std::vector<Reduce> reduce975 = {};
+std::vector<Shift> shift976 = {};
+std::vector<Reduce> reduce976 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift977 = {{&term403, &state978}};
+std::vector<Reduce> reduce977 = {};
+std::vector<Shift> shift978 = {};
+std::vector<Reduce> reduce978 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift979 = {{&term403, &state980}};
+std::vector<Reduce> reduce979 = {};
+std::vector<Shift> shift980 = {};
+std::vector<Reduce> reduce980 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift981 = {{&term403, &state982}};
+std::vector<Reduce> reduce981 = {};
+std::vector<Shift> shift982 = {};
+std::vector<Reduce> reduce982 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift983 = {{&term403, &state984}};
+std::vector<Reduce> reduce983 = {};
+std::vector<Shift> shift984 = {};
+std::vector<Reduce> reduce984 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift985 = {{&term403, &state986}};
+std::vector<Reduce> reduce985 = {};
+std::vector<Shift> shift986 = {};
+std::vector<Reduce> reduce986 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift987 = {{&term403, &state988}};
+std::vector<Reduce> reduce987 = {};
+std::vector<Shift> shift988 = {};
+std::vector<Reduce> reduce988 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift989 = {{&term403, &state990}};
+std::vector<Reduce> reduce989 = {};
+std::vector<Shift> shift990 = {};
+std::vector<Reduce> reduce990 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift991 = {{&term403, &state992}};
+std::vector<Reduce> reduce991 = {};
+std::vector<Shift> shift992 = {};
+std::vector<Reduce> reduce992 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift993 = {{&term403, &state994}};
+std::vector<Reduce> reduce993 = {};
+std::vector<Shift> shift994 = {};
+std::vector<Reduce> reduce994 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift995 = {{&term403, &state996}};
+std::vector<Reduce> reduce995 = {};
+std::vector<Shift> shift996 = {};
+std::vector<Reduce> reduce996 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift997 = {{&term403, &state998}};
+std::vector<Reduce> reduce997 = {};
+std::vector<Shift> shift998 = {};
+std::vector<Reduce> reduce998 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift999 = {{&term403, &state1000}};
+std::vector<Reduce> reduce999 = {};
+std::vector<Shift> shift1000 = {};
+std::vector<Reduce> reduce1000 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift1001 = {{&term403, &state1002}};
+std::vector<Reduce> reduce1001 = {};
+std::vector<Shift> shift1002 = {};
+std::vector<Reduce> reduce1002 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift1003 = {{&term403, &state1004}};
+std::vector<Reduce> reduce1003 = {};
+std::vector<Shift> shift1004 = {};
+std::vector<Reduce> reduce1004 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift1005 = {{&term403, &state1006}};
+std::vector<Reduce> reduce1005 = {};
+std::vector<Shift> shift1006 = {};
+std::vector<Reduce> reduce1006 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift1007 = {{&term403, &state1008}};
+std::vector<Reduce> reduce1007 = {};
+std::vector<Shift> shift1008 = {};
+std::vector<Reduce> reduce1008 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift1009 = {{&term403, &state1010}};
+std::vector<Reduce> reduce1009 = {};
+std::vector<Shift> shift1010 = {};
+std::vector<Reduce> reduce1010 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift1011 = {{&term403, &state1012}};
+std::vector<Reduce> reduce1011 = {};
+std::vector<Shift> shift1012 = {};
+std::vector<Reduce> reduce1012 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift1013 = {{&term403, &state1014}};
+std::vector<Reduce> reduce1013 = {};
+std::vector<Shift> shift1014 = {};
+std::vector<Reduce> reduce1014 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift1015 = {{&term403, &state1016}};
+std::vector<Reduce> reduce1015 = {};
+std::vector<Shift> shift1016 = {};
+std::vector<Reduce> reduce1016 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift1017 = {{&term403, &state1018}};
+std::vector<Reduce> reduce1017 = {};
+std::vector<Shift> shift1018 = {};
+std::vector<Reduce> reduce1018 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift1019 = {{&term403, &state1020}};
+std::vector<Reduce> reduce1019 = {};
+std::vector<Shift> shift1020 = {};
+std::vector<Reduce> reduce1020 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift1021 = {{&term403, &state1022}};
+std::vector<Reduce> reduce1021 = {};
+std::vector<Shift> shift1022 = {};
+std::vector<Reduce> reduce1022 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift1023 = {{&term403, &state1024}};
+std::vector<Reduce> reduce1023 = {};
+std::vector<Shift> shift1024 = {};
+std::vector<Reduce> reduce1024 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift1025 = {{&term403, &state1026}};
+std::vector<Reduce> reduce1025 = {};
+std::vector<Shift> shift1026 = {};
+std::vector<Reduce> reduce1026 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift1027 = {{&term403, &state1028}};
+std::vector<Reduce> reduce1027 = {};
+std::vector<Shift> shift1028 = {};
+std::vector<Reduce> reduce1028 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift1029 = {{&term403, &state1030}};
+std::vector<Reduce> reduce1029 = {};
+std::vector<Shift> shift1030 = {};
+std::vector<Reduce> reduce1030 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift1031 = {{&term403, &state1032}};
+std::vector<Reduce> reduce1031 = {};
+std::vector<Shift> shift1032 = {};
+std::vector<Reduce> reduce1032 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift1033 = {{&term403, &state1034}};
+std::vector<Reduce> reduce1033 = {};
+std::vector<Shift> shift1034 = {};
+std::vector<Reduce> reduce1034 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift1035 = {{&term403, &state1036}};
+std::vector<Reduce> reduce1035 = {};
+std::vector<Shift> shift1036 = {};
+std::vector<Reduce> reduce1036 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift1037 = {{&term403, &state1038}};
+std::vector<Reduce> reduce1037 = {};
+std::vector<Shift> shift1038 = {};
+std::vector<Reduce> reduce1038 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift1039 = {{&term403, &state1040}};
+std::vector<Reduce> reduce1039 = {};
+std::vector<Shift> shift1040 = {};
+std::vector<Reduce> reduce1040 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift1041 = {{&term403, &state1042}};
+std::vector<Reduce> reduce1041 = {};
+std::vector<Shift> shift1042 = {};
+std::vector<Reduce> reduce1042 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift1043 = {{&term403, &state1044}};
+std::vector<Reduce> reduce1043 = {};
+std::vector<Shift> shift1044 = {};
+std::vector<Reduce> reduce1044 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift1045 = {{&term403, &state1046}};
+std::vector<Reduce> reduce1045 = {};
+std::vector<Shift> shift1046 = {};
+std::vector<Reduce> reduce1046 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift1047 = {{&term403, &state1048}};
+std::vector<Reduce> reduce1047 = {};
+std::vector<Shift> shift1048 = {};
+std::vector<Reduce> reduce1048 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift1049 = {{&term403, &state1050}};
+std::vector<Reduce> reduce1049 = {};
+std::vector<Shift> shift1050 = {};
+std::vector<Reduce> reduce1050 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift1051 = {{&term403, &state1052}};
+std::vector<Reduce> reduce1051 = {};
+std::vector<Shift> shift1052 = {};
+std::vector<Reduce> reduce1052 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift1053 = {{&term403, &state1054}};
+std::vector<Reduce> reduce1053 = {};
+std::vector<Shift> shift1054 = {};
+std::vector<Reduce> reduce1054 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift1055 = {{&term403, &state1056}};
+std::vector<Reduce> reduce1055 = {};
+std::vector<Shift> shift1056 = {};
+std::vector<Reduce> reduce1056 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift1057 = {{&term403, &state1058}};
+std::vector<Reduce> reduce1057 = {};
+std::vector<Shift> shift1058 = {};
+std::vector<Reduce> reduce1058 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift1059 = {{&term403, &state1060}};
+std::vector<Reduce> reduce1059 = {};
+std::vector<Shift> shift1060 = {};
+std::vector<Reduce> reduce1060 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift1061 = {{&term403, &state1062}};
+std::vector<Reduce> reduce1061 = {};
+std::vector<Shift> shift1062 = {};
+std::vector<Reduce> reduce1062 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift1063 = {{&term403, &state1064}};
+std::vector<Reduce> reduce1063 = {};
+std::vector<Shift> shift1064 = {};
+std::vector<Reduce> reduce1064 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift1065 = {{&term403, &state1066}};
+std::vector<Reduce> reduce1065 = {};
+std::vector<Shift> shift1066 = {};
+std::vector<Reduce> reduce1066 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift1067 = {{&term403, &state1068}};
+std::vector<Reduce> reduce1067 = {};
+std::vector<Shift> shift1068 = {};
+std::vector<Reduce> reduce1068 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift1069 = {{&term403, &state1070}};
+std::vector<Reduce> reduce1069 = {};
+std::vector<Shift> shift1070 = {};
+std::vector<Reduce> reduce1070 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift1071 = {{&term403, &state1072}};
+std::vector<Reduce> reduce1071 = {};
+std::vector<Shift> shift1072 = {};
+std::vector<Reduce> reduce1072 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift1073 = {{&term403, &state1074}};
+std::vector<Reduce> reduce1073 = {};
+std::vector<Shift> shift1074 = {};
+std::vector<Reduce> reduce1074 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift1075 = {{&term403, &state1076}};
+std::vector<Reduce> reduce1075 = {};
+std::vector<Shift> shift1076 = {};
+std::vector<Reduce> reduce1076 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift1077 = {{&term403, &state1078}};
+std::vector<Reduce> reduce1077 = {};
+std::vector<Shift> shift1078 = {};
+std::vector<Reduce> reduce1078 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift1079 = {{&term403, &state1080}};
+std::vector<Reduce> reduce1079 = {};
+std::vector<Shift> shift1080 = {};
+std::vector<Reduce> reduce1080 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift1081 = {{&term403, &state1082}};
+std::vector<Reduce> reduce1081 = {};
+std::vector<Shift> shift1082 = {};
+std::vector<Reduce> reduce1082 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift1083 = {{&term403, &state1084}};
+std::vector<Reduce> reduce1083 = {};
+std::vector<Shift> shift1084 = {};
+std::vector<Reduce> reduce1084 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift1085 = {{&term403, &state1086}};
+std::vector<Reduce> reduce1085 = {};
+std::vector<Shift> shift1086 = {};
+std::vector<Reduce> reduce1086 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift1087 = {{&term403, &state1088}};
+std::vector<Reduce> reduce1087 = {};
+std::vector<Shift> shift1088 = {};
+std::vector<Reduce> reduce1088 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift1089 = {{&term403, &state1090}};
+std::vector<Reduce> reduce1089 = {};
+std::vector<Shift> shift1090 = {};
+std::vector<Reduce> reduce1090 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift1091 = {{&term403, &state1092}};
+std::vector<Reduce> reduce1091 = {};
+std::vector<Shift> shift1092 = {};
+std::vector<Reduce> reduce1092 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift1093 = {{&term403, &state1094}};
+std::vector<Reduce> reduce1093 = {};
+std::vector<Shift> shift1094 = {};
+std::vector<Reduce> reduce1094 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift1095 = {{&term403, &state1096}};
+std::vector<Reduce> reduce1095 = {};
+std::vector<Shift> shift1096 = {};
+std::vector<Reduce> reduce1096 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift1097 = {{&term403, &state1098}};
+std::vector<Reduce> reduce1097 = {};
+std::vector<Shift> shift1098 = {};
+std::vector<Reduce> reduce1098 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift1099 = {{&term403, &state1100}};
+std::vector<Reduce> reduce1099 = {};
+std::vector<Shift> shift1100 = {};
+std::vector<Reduce> reduce1100 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift1101 = {{&term403, &state1102}};
+std::vector<Reduce> reduce1101 = {};
+std::vector<Shift> shift1102 = {};
+std::vector<Reduce> reduce1102 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift1103 = {{&term403, &state1104}};
+std::vector<Reduce> reduce1103 = {};
+std::vector<Shift> shift1104 = {};
+std::vector<Reduce> reduce1104 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift1105 = {{&term403, &state1106}};
+std::vector<Reduce> reduce1105 = {};
+std::vector<Shift> shift1106 = {};
+std::vector<Reduce> reduce1106 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift1107 = {{&term403, &state1108}};
+std::vector<Reduce> reduce1107 = {};
+std::vector<Shift> shift1108 = {};
+std::vector<Reduce> reduce1108 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift1109 = {{&term403, &state1110}};
+std::vector<Reduce> reduce1109 = {};
+std::vector<Shift> shift1110 = {};
+std::vector<Reduce> reduce1110 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift1111 = {{&term403, &state1112}};
+std::vector<Reduce> reduce1111 = {};
+std::vector<Shift> shift1112 = {};
+std::vector<Reduce> reduce1112 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift1113 = {{&term403, &state1114}};
+std::vector<Reduce> reduce1113 = {};
+std::vector<Shift> shift1114 = {};
+std::vector<Reduce> reduce1114 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift1115 = {{&term403, &state1116}};
+std::vector<Reduce> reduce1115 = {};
+std::vector<Shift> shift1116 = {};
+std::vector<Reduce> reduce1116 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift1117 = {{&term403, &state1118}};
+std::vector<Reduce> reduce1117 = {};
+std::vector<Shift> shift1118 = {};
+std::vector<Reduce> reduce1118 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift1119 = {{&term403, &state1120}};
+std::vector<Reduce> reduce1119 = {};
+std::vector<Shift> shift1120 = {};
+std::vector<Reduce> reduce1120 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift1121 = {{&term403, &state1122}};
+std::vector<Reduce> reduce1121 = {};
+std::vector<Shift> shift1122 = {};
+std::vector<Reduce> reduce1122 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift1123 = {{&term403, &state1124}};
+std::vector<Reduce> reduce1123 = {};
+std::vector<Shift> shift1124 = {};
+std::vector<Reduce> reduce1124 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift1125 = {{&term403, &state1126}};
+std::vector<Reduce> reduce1125 = {};
+std::vector<Shift> shift1126 = {};
+std::vector<Reduce> reduce1126 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift1127 = {{&term403, &state1128}};
+std::vector<Reduce> reduce1127 = {};
+std::vector<Shift> shift1128 = {};
+std::vector<Reduce> reduce1128 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift1129 = {{&term403, &state1130}};
+std::vector<Reduce> reduce1129 = {};
+std::vector<Shift> shift1130 = {};
+std::vector<Reduce> reduce1130 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift1131 = {{&term403, &state1132}};
+std::vector<Reduce> reduce1131 = {};
+std::vector<Shift> shift1132 = {};
+std::vector<Reduce> reduce1132 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift1133 = {{&term403, &state1134}};
+std::vector<Reduce> reduce1133 = {};
+std::vector<Shift> shift1134 = {};
+std::vector<Reduce> reduce1134 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift1135 = {{&term403, &state1136}};
+std::vector<Reduce> reduce1135 = {};
+std::vector<Shift> shift1136 = {};
+std::vector<Reduce> reduce1136 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift1137 = {{&term403, &state1138}};
+std::vector<Reduce> reduce1137 = {};
+std::vector<Shift> shift1138 = {};
+std::vector<Reduce> reduce1138 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift1139 = {{&term403, &state1140}};
+std::vector<Reduce> reduce1139 = {};
+std::vector<Shift> shift1140 = {};
+std::vector<Reduce> reduce1140 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift1141 = {{&term403, &state1142}};
+std::vector<Reduce> reduce1141 = {};
+std::vector<Shift> shift1142 = {};
+std::vector<Reduce> reduce1142 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift1143 = {{&term403, &state1144}};
+std::vector<Reduce> reduce1143 = {};
+std::vector<Shift> shift1144 = {};
+std::vector<Reduce> reduce1144 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift1145 = {{&term403, &state1146}};
+std::vector<Reduce> reduce1145 = {};
+std::vector<Shift> shift1146 = {};
+std::vector<Reduce> reduce1146 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift1147 = {{&term403, &state1148}};
+std::vector<Reduce> reduce1147 = {};
+std::vector<Shift> shift1148 = {};
+std::vector<Reduce> reduce1148 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift1149 = {{&term403, &state1150}};
+std::vector<Reduce> reduce1149 = {};
+std::vector<Shift> shift1150 = {};
+std::vector<Reduce> reduce1150 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift1151 = {{&term403, &state1152}};
+std::vector<Reduce> reduce1151 = {};
+std::vector<Shift> shift1152 = {};
+std::vector<Reduce> reduce1152 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift1153 = {{&term403, &state1154}};
+std::vector<Reduce> reduce1153 = {};
+std::vector<Shift> shift1154 = {};
+std::vector<Reduce> reduce1154 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift1155 = {{&term403, &state1156}};
+std::vector<Reduce> reduce1155 = {};
+std::vector<Shift> shift1156 = {};
+std::vector<Reduce> reduce1156 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift1157 = {{&term403, &state1158}};
+std::vector<Reduce> reduce1157 = {};
+std::vector<Shift> shift1158 = {};
+std::vector<Reduce> reduce1158 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift1159 = {{&term403, &state1160}};
+std::vector<Reduce> reduce1159 = {};
+std::vector<Shift> shift1160 = {};
+std::vector<Reduce> reduce1160 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift1161 = {{&term403, &state1162}};
+std::vector<Reduce> reduce1161 = {};
+std::vector<Shift> shift1162 = {};
+std::vector<Reduce> reduce1162 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift1163 = {{&term403, &state1164}};
+std::vector<Reduce> reduce1163 = {};
+std::vector<Shift> shift1164 = {};
+std::vector<Reduce> reduce1164 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift1165 = {{&term403, &state1166}};
+std::vector<Reduce> reduce1165 = {};
+std::vector<Shift> shift1166 = {};
+std::vector<Reduce> reduce1166 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift1167 = {{&term403, &state1168}};
+std::vector<Reduce> reduce1167 = {};
+std::vector<Shift> shift1168 = {};
+std::vector<Reduce> reduce1168 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift1169 = {{&term403, &state1170}};
+std::vector<Reduce> reduce1169 = {};
+std::vector<Shift> shift1170 = {};
+std::vector<Reduce> reduce1170 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift1171 = {{&term403, &state1172}};
+std::vector<Reduce> reduce1171 = {};
+std::vector<Shift> shift1172 = {};
+std::vector<Reduce> reduce1172 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift1173 = {{&term403, &state1174}};
+std::vector<Reduce> reduce1173 = {};
+std::vector<Shift> shift1174 = {};
+std::vector<Reduce> reduce1174 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift1175 = {{&term403, &state1176}};
+std::vector<Reduce> reduce1175 = {};
+std::vector<Shift> shift1176 = {};
+std::vector<Reduce> reduce1176 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift1177 = {{&term403, &state1178}};
+std::vector<Reduce> reduce1177 = {};
+std::vector<Shift> shift1178 = {};
+std::vector<Reduce> reduce1178 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift1179 = {{&term403, &state1180}};
+std::vector<Reduce> reduce1179 = {};
+std::vector<Shift> shift1180 = {};
+std::vector<Reduce> reduce1180 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift1181 = {{&term403, &state1182}};
+std::vector<Reduce> reduce1181 = {};
+std::vector<Shift> shift1182 = {};
+std::vector<Reduce> reduce1182 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift1183 = {{&term403, &state1184}};
+std::vector<Reduce> reduce1183 = {};
+std::vector<Shift> shift1184 = {};
+std::vector<Reduce> reduce1184 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift1185 = {{&term403, &state1186}};
+std::vector<Reduce> reduce1185 = {};
+std::vector<Shift> shift1186 = {};
+std::vector<Reduce> reduce1186 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift1187 = {{&term403, &state1188}};
+std::vector<Reduce> reduce1187 = {};
+std::vector<Shift> shift1188 = {};
+std::vector<Reduce> reduce1188 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift1189 = {{&term403, &state1190}};
+std::vector<Reduce> reduce1189 = {};
+std::vector<Shift> shift1190 = {};
+std::vector<Reduce> reduce1190 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift1191 = {{&term403, &state1192}};
+std::vector<Reduce> reduce1191 = {};
+std::vector<Shift> shift1192 = {};
+std::vector<Reduce> reduce1192 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift1193 = {{&term403, &state1194}};
+std::vector<Reduce> reduce1193 = {};
+std::vector<Shift> shift1194 = {};
+std::vector<Reduce> reduce1194 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift1195 = {{&term403, &state1196}};
+std::vector<Reduce> reduce1195 = {};
+std::vector<Shift> shift1196 = {};
+std::vector<Reduce> reduce1196 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift1197 = {{&term403, &state1198}};
+std::vector<Reduce> reduce1197 = {};
+std::vector<Shift> shift1198 = {};
+std::vector<Reduce> reduce1198 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift1199 = {{&term403, &state1200}};
+std::vector<Reduce> reduce1199 = {};
+std::vector<Shift> shift1200 = {};
+std::vector<Reduce> reduce1200 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift1201 = {{&term403, &state1202}};
+std::vector<Reduce> reduce1201 = {};
+std::vector<Shift> shift1202 = {};
+std::vector<Reduce> reduce1202 = {{nullptr, &rule3, false}};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state402}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift40, &reduce40, nullptr};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift48, &reduce48, nullptr};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift72, &reduce72, nullptr};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift80, &reduce80, nullptr};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift88, &reduce88, nullptr};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift96, &reduce96, nullptr};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift104, &reduce104, nullptr};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift120, &reduce120, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift128, &reduce128, nullptr};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift136, &reduce136, nullptr};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift140, &reduce140, nullptr};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift144, &reduce144, nullptr};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift146, &reduce146, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift148, &reduce148, nullptr};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift150, &reduce150, nullptr};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift152, &reduce152, nullptr};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift154, &reduce154, nullptr};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift158, &reduce158, nullptr};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift160, &reduce160, nullptr};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift162, &reduce162, nullptr};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift166, &reduce166, nullptr};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift168, &reduce168, nullptr};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift172, &reduce172, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift176, &reduce176, nullptr};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift180, &reduce180, nullptr};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift184, &reduce184, nullptr};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift188, &reduce188, nullptr};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift192, &reduce192, nullptr};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift200, &reduce200, nullptr};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift202, &reduce202, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift208, &reduce208, nullptr};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, nullptr};
+State state216 = {&shift216, &reduce216, nullptr};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, nullptr};
+State state224 = {&shift224, &reduce224, nullptr};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, nullptr};
+State state232 = {&shift232, &reduce232, nullptr};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, nullptr};
+State state240 = {&shift240, &reduce240, nullptr};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, nullptr};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift263, &reduce263, nullptr};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift268, &reduce268, nullptr};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift272, &reduce272, nullptr};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift276, &reduce276, nullptr};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift278, &reduce278, nullptr};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift280, &reduce280, nullptr};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, nullptr};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift286, &reduce286, nullptr};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift288, &reduce288, nullptr};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift290, &reduce290, nullptr};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift296, &reduce296, nullptr};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift302, &reduce302, nullptr};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift304, &reduce304, nullptr};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift308, &reduce308, nullptr};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift312, &reduce312, nullptr};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift320, &reduce320, nullptr};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift322, &reduce322, nullptr};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift326, &reduce326, nullptr};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift328, &reduce328, nullptr};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift330, &reduce330, nullptr};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift336, &reduce336, nullptr};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, nullptr};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift340, &reduce340, nullptr};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift344, &reduce344, nullptr};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift352, &reduce352, nullptr};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift354, &reduce354, nullptr};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift356, &reduce356, nullptr};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift358, &reduce358, nullptr};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift360, &reduce360, nullptr};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift362, &reduce362, nullptr};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift364, &reduce364, nullptr};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift367, &reduce367, nullptr};
+State state368 = {&shift368, &reduce368, nullptr};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift372, &reduce372, nullptr};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift374, &reduce374, nullptr};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift376, &reduce376, nullptr};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift378, &reduce378, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift380, &reduce380, nullptr};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift382, &reduce382, nullptr};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift384, &reduce384, nullptr};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift392, &reduce392, nullptr};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift394, &reduce394, nullptr};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift399, &reduce399, nullptr};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift403, &reduce403, nullptr};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift407, &reduce407, nullptr};
+State state408 = {&shift408, &reduce408, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift412, &reduce412, nullptr};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift416, &reduce416, nullptr};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, nullptr};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift424, &reduce424, nullptr};
+State state425 = {&shift425, &reduce425, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift430, &reduce430, nullptr};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift432, &reduce432, nullptr};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift434, &reduce434, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, nullptr};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift439, &reduce439, nullptr};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift443, &reduce443, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, nullptr};
+State state447 = {&shift447, &reduce447, nullptr};
+State state448 = {&shift448, &reduce448, nullptr};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, nullptr};
+State state456 = {&shift456, &reduce456, nullptr};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, nullptr};
+State state464 = {&shift464, &reduce464, nullptr};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift471, &reduce471, nullptr};
+State state472 = {&shift472, &reduce472, nullptr};
+State state473 = {&shift473, &reduce473, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, nullptr};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift484, &reduce484, nullptr};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift488, &reduce488, nullptr};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift497, &reduce497, nullptr};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift502, &reduce502, nullptr};
+State state503 = {&shift503, &reduce503, nullptr};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift511, &reduce511, nullptr};
+State state512 = {&shift512, &reduce512, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift515, &reduce515, nullptr};
+State state516 = {&shift516, &reduce516, nullptr};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift520, &reduce520, nullptr};
+State state521 = {&shift521, &reduce521, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift523, &reduce523, nullptr};
+State state524 = {&shift524, &reduce524, nullptr};
+State state525 = {&shift525, &reduce525, nullptr};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift528, &reduce528, nullptr};
+State state529 = {&shift529, &reduce529, nullptr};
+State state530 = {&shift530, &reduce530, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift532, &reduce532, nullptr};
+State state533 = {&shift533, &reduce533, nullptr};
+State state534 = {&shift534, &reduce534, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift536, &reduce536, nullptr};
+State state537 = {&shift537, &reduce537, nullptr};
+State state538 = {&shift538, &reduce538, nullptr};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift542, &reduce542, nullptr};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift545, &reduce545, nullptr};
+State state546 = {&shift546, &reduce546, nullptr};
+State state547 = {&shift547, &reduce547, nullptr};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift550, &reduce550, nullptr};
+State state551 = {&shift551, &reduce551, nullptr};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift554, &reduce554, nullptr};
+State state555 = {&shift555, &reduce555, nullptr};
+State state556 = {&shift556, &reduce556, nullptr};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift558, &reduce558, nullptr};
+State state559 = {&shift559, &reduce559, nullptr};
+State state560 = {&shift560, &reduce560, nullptr};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift562, &reduce562, nullptr};
+State state563 = {&shift563, &reduce563, nullptr};
+State state564 = {&shift564, &reduce564, nullptr};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift568, &reduce568, nullptr};
+State state569 = {&shift569, &reduce569, nullptr};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift572, &reduce572, nullptr};
+State state573 = {&shift573, &reduce573, nullptr};
+State state574 = {&shift574, &reduce574, nullptr};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift576, &reduce576, nullptr};
+State state577 = {&shift577, &reduce577, nullptr};
+State state578 = {&shift578, &reduce578, nullptr};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift580, &reduce580, nullptr};
+State state581 = {&shift581, &reduce581, nullptr};
+State state582 = {&shift582, &reduce582, nullptr};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift584, &reduce584, nullptr};
+State state585 = {&shift585, &reduce585, nullptr};
+State state586 = {&shift586, &reduce586, nullptr};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift588, &reduce588, nullptr};
+State state589 = {&shift589, &reduce589, nullptr};
+State state590 = {&shift590, &reduce590, nullptr};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift592, &reduce592, nullptr};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift594, &reduce594, nullptr};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift596, &reduce596, nullptr};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift598, &reduce598, nullptr};
+State state599 = {&shift599, &reduce599, nullptr};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift601, &reduce601, nullptr};
+State state602 = {&shift602, &reduce602, nullptr};
+State state603 = {&shift603, &reduce603, nullptr};
+State state604 = {&shift604, &reduce604, nullptr};
+State state605 = {&shift605, &reduce605, nullptr};
+State state606 = {&shift606, &reduce606, nullptr};
+State state607 = {&shift607, &reduce607, nullptr};
+State state608 = {&shift608, &reduce608, nullptr};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift610, &reduce610, nullptr};
+State state611 = {&shift611, &reduce611, nullptr};
+State state612 = {&shift612, &reduce612, nullptr};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift614, &reduce614, nullptr};
+State state615 = {&shift615, &reduce615, nullptr};
+State state616 = {&shift616, &reduce616, nullptr};
+State state617 = {&shift617, &reduce617, nullptr};
+State state618 = {&shift618, &reduce618, nullptr};
+State state619 = {&shift619, &reduce619, nullptr};
+State state620 = {&shift620, &reduce620, nullptr};
+State state621 = {&shift621, &reduce621, nullptr};
+State state622 = {&shift622, &reduce622, nullptr};
+State state623 = {&shift623, &reduce623, nullptr};
+State state624 = {&shift624, &reduce624, nullptr};
+State state625 = {&shift625, &reduce625, nullptr};
+State state626 = {&shift626, &reduce626, nullptr};
+State state627 = {&shift627, &reduce627, nullptr};
+State state628 = {&shift628, &reduce628, nullptr};
+State state629 = {&shift629, &reduce629, nullptr};
+State state630 = {&shift630, &reduce630, nullptr};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift632, &reduce632, nullptr};
+State state633 = {&shift633, &reduce633, nullptr};
+State state634 = {&shift634, &reduce634, nullptr};
+State state635 = {&shift635, &reduce635, nullptr};
+State state636 = {&shift636, &reduce636, nullptr};
+State state637 = {&shift637, &reduce637, nullptr};
+State state638 = {&shift638, &reduce638, nullptr};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift640, &reduce640, nullptr};
+State state641 = {&shift641, &reduce641, nullptr};
+State state642 = {&shift642, &reduce642, nullptr};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift644, &reduce644, nullptr};
+State state645 = {&shift645, &reduce645, nullptr};
+State state646 = {&shift646, &reduce646, nullptr};
+State state647 = {&shift647, &reduce647, nullptr};
+State state648 = {&shift648, &reduce648, nullptr};
+State state649 = {&shift649, &reduce649, nullptr};
+State state650 = {&shift650, &reduce650, nullptr};
+State state651 = {&shift651, &reduce651, nullptr};
+State state652 = {&shift652, &reduce652, nullptr};
+State state653 = {&shift653, &reduce653, nullptr};
+State state654 = {&shift654, &reduce654, nullptr};
+State state655 = {&shift655, &reduce655, nullptr};
+State state656 = {&shift656, &reduce656, nullptr};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift658, &reduce658, nullptr};
+State state659 = {&shift659, &reduce659, nullptr};
+State state660 = {&shift660, &reduce660, nullptr};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift662, &reduce662, nullptr};
+State state663 = {&shift663, &reduce663, nullptr};
+State state664 = {&shift664, &reduce664, nullptr};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift666, &reduce666, nullptr};
+State state667 = {&shift667, &reduce667, nullptr};
+State state668 = {&shift668, &reduce668, nullptr};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift670, &reduce670, nullptr};
+State state671 = {&shift671, &reduce671, nullptr};
+State state672 = {&shift672, &reduce672, nullptr};
+State state673 = {&shift673, &reduce673, nullptr};
+State state674 = {&shift674, &reduce674, nullptr};
+State state675 = {&shift675, &reduce675, nullptr};
+State state676 = {&shift676, &reduce676, nullptr};
+State state677 = {&shift677, &reduce677, nullptr};
+State state678 = {&shift678, &reduce678, nullptr};
+State state679 = {&shift679, &reduce679, nullptr};
+State state680 = {&shift680, &reduce680, nullptr};
+State state681 = {&shift681, &reduce681, nullptr};
+State state682 = {&shift682, &reduce682, nullptr};
+State state683 = {&shift683, &reduce683, nullptr};
+State state684 = {&shift684, &reduce684, nullptr};
+State state685 = {&shift685, &reduce685, nullptr};
+State state686 = {&shift686, &reduce686, nullptr};
+State state687 = {&shift687, &reduce687, nullptr};
+State state688 = {&shift688, &reduce688, nullptr};
+State state689 = {&shift689, &reduce689, nullptr};
+State state690 = {&shift690, &reduce690, nullptr};
+State state691 = {&shift691, &reduce691, nullptr};
+State state692 = {&shift692, &reduce692, nullptr};
+State state693 = {&shift693, &reduce693, nullptr};
+State state694 = {&shift694, &reduce694, nullptr};
+State state695 = {&shift695, &reduce695, nullptr};
+State state696 = {&shift696, &reduce696, nullptr};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift698, &reduce698, nullptr};
+State state699 = {&shift699, &reduce699, nullptr};
+State state700 = {&shift700, &reduce700, nullptr};
+State state701 = {&shift701, &reduce701, nullptr};
+State state702 = {&shift702, &reduce702, nullptr};
+State state703 = {&shift703, &reduce703, nullptr};
+State state704 = {&shift704, &reduce704, nullptr};
+State state705 = {&shift705, &reduce705, nullptr};
+State state706 = {&shift706, &reduce706, nullptr};
+State state707 = {&shift707, &reduce707, nullptr};
+State state708 = {&shift708, &reduce708, nullptr};
+State state709 = {&shift709, &reduce709, nullptr};
+State state710 = {&shift710, &reduce710, nullptr};
+State state711 = {&shift711, &reduce711, nullptr};
+State state712 = {&shift712, &reduce712, nullptr};
+State state713 = {&shift713, &reduce713, nullptr};
+State state714 = {&shift714, &reduce714, nullptr};
+State state715 = {&shift715, &reduce715, nullptr};
+State state716 = {&shift716, &reduce716, nullptr};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift718, &reduce718, nullptr};
+State state719 = {&shift719, &reduce719, nullptr};
+State state720 = {&shift720, &reduce720, nullptr};
+State state721 = {&shift721, &reduce721, nullptr};
+State state722 = {&shift722, &reduce722, nullptr};
+State state723 = {&shift723, &reduce723, nullptr};
+State state724 = {&shift724, &reduce724, nullptr};
+State state725 = {&shift725, &reduce725, nullptr};
+State state726 = {&shift726, &reduce726, nullptr};
+State state727 = {&shift727, &reduce727, nullptr};
+State state728 = {&shift728, &reduce728, nullptr};
+State state729 = {&shift729, &reduce729, nullptr};
+State state730 = {&shift730, &reduce730, nullptr};
+State state731 = {&shift731, &reduce731, nullptr};
+State state732 = {&shift732, &reduce732, nullptr};
+State state733 = {&shift733, &reduce733, nullptr};
+State state734 = {&shift734, &reduce734, nullptr};
+State state735 = {&shift735, &reduce735, nullptr};
+State state736 = {&shift736, &reduce736, nullptr};
+State state737 = {&shift737, &reduce737, nullptr};
+State state738 = {&shift738, &reduce738, nullptr};
+State state739 = {&shift739, &reduce739, nullptr};
+State state740 = {&shift740, &reduce740, nullptr};
+State state741 = {&shift741, &reduce741, nullptr};
+State state742 = {&shift742, &reduce742, nullptr};
+State state743 = {&shift743, &reduce743, nullptr};
+State state744 = {&shift744, &reduce744, nullptr};
+State state745 = {&shift745, &reduce745, nullptr};
+State state746 = {&shift746, &reduce746, nullptr};
+State state747 = {&shift747, &reduce747, nullptr};
+State state748 = {&shift748, &reduce748, nullptr};
+State state749 = {&shift749, &reduce749, nullptr};
+State state750 = {&shift750, &reduce750, nullptr};
+State state751 = {&shift751, &reduce751, nullptr};
+State state752 = {&shift752, &reduce752, nullptr};
+State state753 = {&shift753, &reduce753, nullptr};
+State state754 = {&shift754, &reduce754, nullptr};
+State state755 = {&shift755, &reduce755, nullptr};
+State state756 = {&shift756, &reduce756, nullptr};
+State state757 = {&shift757, &reduce757, nullptr};
+State state758 = {&shift758, &reduce758, nullptr};
+State state759 = {&shift759, &reduce759, nullptr};
+State state760 = {&shift760, &reduce760, nullptr};
+State state761 = {&shift761, &reduce761, nullptr};
+State state762 = {&shift762, &reduce762, nullptr};
+State state763 = {&shift763, &reduce763, nullptr};
+State state764 = {&shift764, &reduce764, nullptr};
+State state765 = {&shift765, &reduce765, nullptr};
+State state766 = {&shift766, &reduce766, nullptr};
+State state767 = {&shift767, &reduce767, nullptr};
+State state768 = {&shift768, &reduce768, nullptr};
+State state769 = {&shift769, &reduce769, nullptr};
+State state770 = {&shift770, &reduce770, nullptr};
+State state771 = {&shift771, &reduce771, nullptr};
+State state772 = {&shift772, &reduce772, nullptr};
+State state773 = {&shift773, &reduce773, nullptr};
+State state774 = {&shift774, &reduce774, nullptr};
+State state775 = {&shift775, &reduce775, nullptr};
+State state776 = {&shift776, &reduce776, nullptr};
+State state777 = {&shift777, &reduce777, nullptr};
+State state778 = {&shift778, &reduce778, nullptr};
+State state779 = {&shift779, &reduce779, nullptr};
+State state780 = {&shift780, &reduce780, nullptr};
+State state781 = {&shift781, &reduce781, nullptr};
+State state782 = {&shift782, &reduce782, nullptr};
+State state783 = {&shift783, &reduce783, nullptr};
+State state784 = {&shift784, &reduce784, nullptr};
+State state785 = {&shift785, &reduce785, nullptr};
+State state786 = {&shift786, &reduce786, nullptr};
+State state787 = {&shift787, &reduce787, nullptr};
+State state788 = {&shift788, &reduce788, nullptr};
+State state789 = {&shift789, &reduce789, nullptr};
+State state790 = {&shift790, &reduce790, nullptr};
+State state791 = {&shift791, &reduce791, nullptr};
+State state792 = {&shift792, &reduce792, nullptr};
+State state793 = {&shift793, &reduce793, nullptr};
+State state794 = {&shift794, &reduce794, nullptr};
+State state795 = {&shift795, &reduce795, nullptr};
+State state796 = {&shift796, &reduce796, nullptr};
+State state797 = {&shift797, &reduce797, nullptr};
+State state798 = {&shift798, &reduce798, nullptr};
+State state799 = {&shift799, &reduce799, nullptr};
+State state800 = {&shift800, &reduce800, nullptr};
+State state801 = {&shift801, &reduce801, nullptr};
+State state802 = {&shift802, &reduce802, nullptr};
+State state803 = {&shift803, &reduce803, nullptr};
+State state804 = {&shift804, &reduce804, nullptr};
+State state805 = {&shift805, &reduce805, nullptr};
+State state806 = {&shift806, &reduce806, nullptr};
+State state807 = {&shift807, &reduce807, nullptr};
+State state808 = {&shift808, &reduce808, nullptr};
+State state809 = {&shift809, &reduce809, nullptr};
+State state810 = {&shift810, &reduce810, nullptr};
+State state811 = {&shift811, &reduce811, nullptr};
+State state812 = {&shift812, &reduce812, nullptr};
+State state813 = {&shift813, &reduce813, nullptr};
+State state814 = {&shift814, &reduce814, nullptr};
+State state815 = {&shift815, &reduce815, nullptr};
+State state816 = {&shift816, &reduce816, nullptr};
+State state817 = {&shift817, &reduce817, nullptr};
+State state818 = {&shift818, &reduce818, nullptr};
+State state819 = {&shift819, &reduce819, nullptr};
+State state820 = {&shift820, &reduce820, nullptr};
+State state821 = {&shift821, &reduce821, nullptr};
+State state822 = {&shift822, &reduce822, nullptr};
+State state823 = {&shift823, &reduce823, nullptr};
+State state824 = {&shift824, &reduce824, nullptr};
+State state825 = {&shift825, &reduce825, nullptr};
+State state826 = {&shift826, &reduce826, nullptr};
+State state827 = {&shift827, &reduce827, nullptr};
+State state828 = {&shift828, &reduce828, nullptr};
+State state829 = {&shift829, &reduce829, nullptr};
+State state830 = {&shift830, &reduce830, nullptr};
+State state831 = {&shift831, &reduce831, nullptr};
+State state832 = {&shift832, &reduce832, nullptr};
+State state833 = {&shift833, &reduce833, nullptr};
+State state834 = {&shift834, &reduce834, nullptr};
+State state835 = {&shift835, &reduce835, nullptr};
+State state836 = {&shift836, &reduce836, nullptr};
+State state837 = {&shift837, &reduce837, nullptr};
+State state838 = {&shift838, &reduce838, nullptr};
+State state839 = {&shift839, &reduce839, nullptr};
+State state840 = {&shift840, &reduce840, nullptr};
+State state841 = {&shift841, &reduce841, nullptr};
+State state842 = {&shift842, &reduce842, nullptr};
+State state843 = {&shift843, &reduce843, nullptr};
+State state844 = {&shift844, &reduce844, nullptr};
+State state845 = {&shift845, &reduce845, nullptr};
+State state846 = {&shift846, &reduce846, nullptr};
+State state847 = {&shift847, &reduce847, nullptr};
+State state848 = {&shift848, &reduce848, nullptr};
+State state849 = {&shift849, &reduce849, nullptr};
+State state850 = {&shift850, &reduce850, nullptr};
+State state851 = {&shift851, &reduce851, nullptr};
+State state852 = {&shift852, &reduce852, nullptr};
+State state853 = {&shift853, &reduce853, nullptr};
+State state854 = {&shift854, &reduce854, nullptr};
+State state855 = {&shift855, &reduce855, nullptr};
+State state856 = {&shift856, &reduce856, nullptr};
+State state857 = {&shift857, &reduce857, nullptr};
+State state858 = {&shift858, &reduce858, nullptr};
+State state859 = {&shift859, &reduce859, nullptr};
+State state860 = {&shift860, &reduce860, nullptr};
+State state861 = {&shift861, &reduce861, nullptr};
+State state862 = {&shift862, &reduce862, nullptr};
+State state863 = {&shift863, &reduce863, nullptr};
+State state864 = {&shift864, &reduce864, nullptr};
+State state865 = {&shift865, &reduce865, nullptr};
+State state866 = {&shift866, &reduce866, nullptr};
+State state867 = {&shift867, &reduce867, nullptr};
+State state868 = {&shift868, &reduce868, nullptr};
+State state869 = {&shift869, &reduce869, nullptr};
+State state870 = {&shift870, &reduce870, nullptr};
+State state871 = {&shift871, &reduce871, nullptr};
+State state872 = {&shift872, &reduce872, nullptr};
+State state873 = {&shift873, &reduce873, nullptr};
+State state874 = {&shift874, &reduce874, nullptr};
+State state875 = {&shift875, &reduce875, nullptr};
+State state876 = {&shift876, &reduce876, nullptr};
+State state877 = {&shift877, &reduce877, nullptr};
+State state878 = {&shift878, &reduce878, nullptr};
+State state879 = {&shift879, &reduce879, nullptr};
+State state880 = {&shift880, &reduce880, nullptr};
+State state881 = {&shift881, &reduce881, nullptr};
+State state882 = {&shift882, &reduce882, nullptr};
+State state883 = {&shift883, &reduce883, nullptr};
+State state884 = {&shift884, &reduce884, nullptr};
+State state885 = {&shift885, &reduce885, nullptr};
+State state886 = {&shift886, &reduce886, nullptr};
+State state887 = {&shift887, &reduce887, nullptr};
+State state888 = {&shift888, &reduce888, nullptr};
+State state889 = {&shift889, &reduce889, nullptr};
+State state890 = {&shift890, &reduce890, nullptr};
+State state891 = {&shift891, &reduce891, nullptr};
+State state892 = {&shift892, &reduce892, nullptr};
+State state893 = {&shift893, &reduce893, nullptr};
+State state894 = {&shift894, &reduce894, nullptr};
+State state895 = {&shift895, &reduce895, nullptr};
+State state896 = {&shift896, &reduce896, nullptr};
+State state897 = {&shift897, &reduce897, nullptr};
+State state898 = {&shift898, &reduce898, nullptr};
+State state899 = {&shift899, &reduce899, nullptr};
+State state900 = {&shift900, &reduce900, nullptr};
+State state901 = {&shift901, &reduce901, nullptr};
+State state902 = {&shift902, &reduce902, nullptr};
+State state903 = {&shift903, &reduce903, nullptr};
+State state904 = {&shift904, &reduce904, nullptr};
+State state905 = {&shift905, &reduce905, nullptr};
+State state906 = {&shift906, &reduce906, nullptr};
+State state907 = {&shift907, &reduce907, nullptr};
+State state908 = {&shift908, &reduce908, nullptr};
+State state909 = {&shift909, &reduce909, nullptr};
+State state910 = {&shift910, &reduce910, nullptr};
+State state911 = {&shift911, &reduce911, nullptr};
+State state912 = {&shift912, &reduce912, nullptr};
+State state913 = {&shift913, &reduce913, nullptr};
+State state914 = {&shift914, &reduce914, nullptr};
+State state915 = {&shift915, &reduce915, nullptr};
+State state916 = {&shift916, &reduce916, nullptr};
+State state917 = {&shift917, &reduce917, nullptr};
+State state918 = {&shift918, &reduce918, nullptr};
+State state919 = {&shift919, &reduce919, nullptr};
+State state920 = {&shift920, &reduce920, nullptr};
+State state921 = {&shift921, &reduce921, nullptr};
+State state922 = {&shift922, &reduce922, nullptr};
+State state923 = {&shift923, &reduce923, nullptr};
+State state924 = {&shift924, &reduce924, nullptr};
+State state925 = {&shift925, &reduce925, nullptr};
+State state926 = {&shift926, &reduce926, nullptr};
+State state927 = {&shift927, &reduce927, nullptr};
+State state928 = {&shift928, &reduce928, nullptr};
+State state929 = {&shift929, &reduce929, nullptr};
+State state930 = {&shift930, &reduce930, nullptr};
+State state931 = {&shift931, &reduce931, nullptr};
+State state932 = {&shift932, &reduce932, nullptr};
+State state933 = {&shift933, &reduce933, nullptr};
+State state934 = {&shift934, &reduce934, nullptr};
+State state935 = {&shift935, &reduce935, nullptr};
+State state936 = {&shift936, &reduce936, nullptr};
+State state937 = {&shift937, &reduce937, nullptr};
+State state938 = {&shift938, &reduce938, nullptr};
+State state939 = {&shift939, &reduce939, nullptr};
+State state940 = {&shift940, &reduce940, nullptr};
+State state941 = {&shift941, &reduce941, nullptr};
+State state942 = {&shift942, &reduce942, nullptr};
+State state943 = {&shift943, &reduce943, nullptr};
+State state944 = {&shift944, &reduce944, nullptr};
+State state945 = {&shift945, &reduce945, nullptr};
+State state946 = {&shift946, &reduce946, nullptr};
+State state947 = {&shift947, &reduce947, nullptr};
+State state948 = {&shift948, &reduce948, nullptr};
+State state949 = {&shift949, &reduce949, nullptr};
+State state950 = {&shift950, &reduce950, nullptr};
+State state951 = {&shift951, &reduce951, nullptr};
+State state952 = {&shift952, &reduce952, nullptr};
+State state953 = {&shift953, &reduce953, nullptr};
+State state954 = {&shift954, &reduce954, nullptr};
+State state955 = {&shift955, &reduce955, nullptr};
+State state956 = {&shift956, &reduce956, nullptr};
+State state957 = {&shift957, &reduce957, nullptr};
+State state958 = {&shift958, &reduce958, nullptr};
+State state959 = {&shift959, &reduce959, nullptr};
+State state960 = {&shift960, &reduce960, nullptr};
+State state961 = {&shift961, &reduce961, nullptr};
+State state962 = {&shift962, &reduce962, nullptr};
+State state963 = {&shift963, &reduce963, nullptr};
+State state964 = {&shift964, &reduce964, nullptr};
+State state965 = {&shift965, &reduce965, nullptr};
+State state966 = {&shift966, &reduce966, nullptr};
+State state967 = {&shift967, &reduce967, nullptr};
+State state968 = {&shift968, &reduce968, nullptr};
+State state969 = {&shift969, &reduce969, nullptr};
+State state970 = {&shift970, &reduce970, nullptr};
+State state971 = {&shift971, &reduce971, nullptr};
+State state972 = {&shift972, &reduce972, nullptr};
+State state973 = {&shift973, &reduce973, nullptr};
+State state974 = {&shift974, &reduce974, nullptr};
+State state975 = {&shift975, &reduce975, nullptr};
+State state976 = {&shift976, &reduce976, nullptr};
+State state977 = {&shift977, &reduce977, nullptr};
+State state978 = {&shift978, &reduce978, nullptr};
+State state979 = {&shift979, &reduce979, nullptr};
+State state980 = {&shift980, &reduce980, nullptr};
+State state981 = {&shift981, &reduce981, nullptr};
+State state982 = {&shift982, &reduce982, nullptr};
+State state983 = {&shift983, &reduce983, nullptr};
+State state984 = {&shift984, &reduce984, nullptr};
+State state985 = {&shift985, &reduce985, nullptr};
+State state986 = {&shift986, &reduce986, nullptr};
+State state987 = {&shift987, &reduce987, nullptr};
+State state988 = {&shift988, &reduce988, nullptr};
+State state989 = {&shift989, &reduce989, nullptr};
+State state990 = {&shift990, &reduce990, nullptr};
+State state991 = {&shift991, &reduce991, nullptr};
+State state992 = {&shift992, &reduce992, nullptr};
+State state993 = {&shift993, &reduce993, nullptr};
+State state994 = {&shift994, &reduce994, nullptr};
+State state995 = {&shift995, &reduce995, nullptr};
+State state996 = {&shift996, &reduce996, nullptr};
+State state997 = {&shift997, &reduce997, nullptr};
+State state998 = {&shift998, &reduce998, nullptr};
+State state999 = {&shift999, &reduce999, nullptr};
+State state1000 = {&shift1000, &reduce1000, nullptr};
+State state1001 = {&shift1001, &reduce1001, nullptr};
+State state1002 = {&shift1002, &reduce1002, nullptr};
+State state1003 = {&shift1003, &reduce1003, nullptr};
+State state1004 = {&shift1004, &reduce1004, nullptr};
+State state1005 = {&shift1005, &reduce1005, nullptr};
+State state1006 = {&shift1006, &reduce1006, nullptr};
+State state1007 = {&shift1007, &reduce1007, nullptr};
+State state1008 = {&shift1008, &reduce1008, nullptr};
+State state1009 = {&shift1009, &reduce1009, nullptr};
+State state1010 = {&shift1010, &reduce1010, nullptr};
+State state1011 = {&shift1011, &reduce1011, nullptr};
+State state1012 = {&shift1012, &reduce1012, nullptr};
+State state1013 = {&shift1013, &reduce1013, nullptr};
+State state1014 = {&shift1014, &reduce1014, nullptr};
+State state1015 = {&shift1015, &reduce1015, nullptr};
+State state1016 = {&shift1016, &reduce1016, nullptr};
+State state1017 = {&shift1017, &reduce1017, nullptr};
+State state1018 = {&shift1018, &reduce1018, nullptr};
+State state1019 = {&shift1019, &reduce1019, nullptr};
+State state1020 = {&shift1020, &reduce1020, nullptr};
+State state1021 = {&shift1021, &reduce1021, nullptr};
+State state1022 = {&shift1022, &reduce1022, nullptr};
+State state1023 = {&shift1023, &reduce1023, nullptr};
+State state1024 = {&shift1024, &reduce1024, nullptr};
+State state1025 = {&shift1025, &reduce1025, nullptr};
+State state1026 = {&shift1026, &reduce1026, nullptr};
+State state1027 = {&shift1027, &reduce1027, nullptr};
+State state1028 = {&shift1028, &reduce1028, nullptr};
+State state1029 = {&shift1029, &reduce1029, nullptr};
+State state1030 = {&shift1030, &reduce1030, nullptr};
+State state1031 = {&shift1031, &reduce1031, nullptr};
+State state1032 = {&shift1032, &reduce1032, nullptr};
+State state1033 = {&shift1033, &reduce1033, nullptr};
+State state1034 = {&shift1034, &reduce1034, nullptr};
+State state1035 = {&shift1035, &reduce1035, nullptr};
+State state1036 = {&shift1036, &reduce1036, nullptr};
+State state1037 = {&shift1037, &reduce1037, nullptr};
+State state1038 = {&shift1038, &reduce1038, nullptr};
+State state1039 = {&shift1039, &reduce1039, nullptr};
+State state1040 = {&shift1040, &reduce1040, nullptr};
+State state1041 = {&shift1041, &reduce1041, nullptr};
+State state1042 = {&shift1042, &reduce1042, nullptr};
+State state1043 = {&shift1043, &reduce1043, nullptr};
+State state1044 = {&shift1044, &reduce1044, nullptr};
+State state1045 = {&shift1045, &reduce1045, nullptr};
+State state1046 = {&shift1046, &reduce1046, nullptr};
+State state1047 = {&shift1047, &reduce1047, nullptr};
+State state1048 = {&shift1048, &reduce1048, nullptr};
+State state1049 = {&shift1049, &reduce1049, nullptr};
+State state1050 = {&shift1050, &reduce1050, nullptr};
+State state1051 = {&shift1051, &reduce1051, nullptr};
+State state1052 = {&shift1052, &reduce1052, nullptr};
+State state1053 = {&shift1053, &reduce1053, nullptr};
+State state1054 = {&shift1054, &reduce1054, nullptr};
+State state1055 = {&shift1055, &reduce1055, nullptr};
+State state1056 = {&shift1056, &reduce1056, nullptr};
+State state1057 = {&shift1057, &reduce1057, nullptr};
+State state1058 = {&shift1058, &reduce1058, nullptr};
+State state1059 = {&shift1059, &reduce1059, nullptr};
+State state1060 = {&shift1060, &reduce1060, nullptr};
+State state1061 = {&shift1061, &reduce1061, nullptr};
+State state1062 = {&shift1062, &reduce1062, nullptr};
+State state1063 = {&shift1063, &reduce1063, nullptr};
+State state1064 = {&shift1064, &reduce1064, nullptr};
+State state1065 = {&shift1065, &reduce1065, nullptr};
+State state1066 = {&shift1066, &reduce1066, nullptr};
+State state1067 = {&shift1067, &reduce1067, nullptr};
+State state1068 = {&shift1068, &reduce1068, nullptr};
+State state1069 = {&shift1069, &reduce1069, nullptr};
+State state1070 = {&shift1070, &reduce1070, nullptr};
+State state1071 = {&shift1071, &reduce1071, nullptr};
+State state1072 = {&shift1072, &reduce1072, nullptr};
+State state1073 = {&shift1073, &reduce1073, nullptr};
+State state1074 = {&shift1074, &reduce1074, nullptr};
+State state1075 = {&shift1075, &reduce1075, nullptr};
+State state1076 = {&shift1076, &reduce1076, nullptr};
+State state1077 = {&shift1077, &reduce1077, nullptr};
+State state1078 = {&shift1078, &reduce1078, nullptr};
+State state1079 = {&shift1079, &reduce1079, nullptr};
+State state1080 = {&shift1080, &reduce1080, nullptr};
+State state1081 = {&shift1081, &reduce1081, nullptr};
+State state1082 = {&shift1082, &reduce1082, nullptr};
+State state1083 = {&shift1083, &reduce1083, nullptr};
+State state1084 = {&shift1084, &reduce1084, nullptr};
+State state1085 = {&shift1085, &reduce1085, nullptr};
+State state1086 = {&shift1086, &reduce1086, nullptr};
+State state1087 = {&shift1087, &reduce1087, nullptr};
+State state1088 = {&shift1088, &reduce1088, nullptr};
+State state1089 = {&shift1089, &reduce1089, nullptr};
+State state1090 = {&shift1090, &reduce1090, nullptr};
+State state1091 = {&shift1091, &reduce1091, nullptr};
+State state1092 = {&shift1092, &reduce1092, nullptr};
+State state1093 = {&shift1093, &reduce1093, nullptr};
+State state1094 = {&shift1094, &reduce1094, nullptr};
+State state1095 = {&shift1095, &reduce1095, nullptr};
+State state1096 = {&shift1096, &reduce1096, nullptr};
+State state1097 = {&shift1097, &reduce1097, nullptr};
+State state1098 = {&shift1098, &reduce1098, nullptr};
+State state1099 = {&shift1099, &reduce1099, nullptr};
+State state1100 = {&shift1100, &reduce1100, nullptr};
+State state1101 = {&shift1101, &reduce1101, nullptr};
+State state1102 = {&shift1102, &reduce1102, nullptr};
+State state1103 = {&shift1103, &reduce1103, nullptr};
+State state1104 = {&shift1104, &reduce1104, nullptr};
+State state1105 = {&shift1105, &reduce1105, nullptr};
+State state1106 = {&shift1106, &reduce1106, nullptr};
+State state1107 = {&shift1107, &reduce1107, nullptr};
+State state1108 = {&shift1108, &reduce1108, nullptr};
+State state1109 = {&shift1109, &reduce1109, nullptr};
+State state1110 = {&shift1110, &reduce1110, nullptr};
+State state1111 = {&shift1111, &reduce1111, nullptr};
+State state1112 = {&shift1112, &reduce1112, nullptr};
+State state1113 = {&shift1113, &reduce1113, nullptr};
+State state1114 = {&shift1114, &reduce1114, nullptr};
+State state1115 = {&shift1115, &reduce1115, nullptr};
+State state1116 = {&shift1116, &reduce1116, nullptr};
+State state1117 = {&shift1117, &reduce1117, nullptr};
+State state1118 = {&shift1118, &reduce1118, nullptr};
+State state1119 = {&shift1119, &reduce1119, nullptr};
+State state1120 = {&shift1120, &reduce1120, nullptr};
+State state1121 = {&shift1121, &reduce1121, nullptr};
+State state1122 = {&shift1122, &reduce1122, nullptr};
+State state1123 = {&shift1123, &reduce1123, nullptr};
+State state1124 = {&shift1124, &reduce1124, nullptr};
+State state1125 = {&shift1125, &reduce1125, nullptr};
+State state1126 = {&shift1126, &reduce1126, nullptr};
+State state1127 = {&shift1127, &reduce1127, nullptr};
+State state1128 = {&shift1128, &reduce1128, nullptr};
+State state1129 = {&shift1129, &reduce1129, nullptr};
+State state1130 = {&shift1130, &reduce1130, nullptr};
+State state1131 = {&shift1131, &reduce1131, nullptr};
+State state1132 = {&shift1132, &reduce1132, nullptr};
+State state1133 = {&shift1133, &reduce1133, nullptr};
+State state1134 = {&shift1134, &reduce1134, nullptr};
+State state1135 = {&shift1135, &reduce1135, nullptr};
+State state1136 = {&shift1136, &reduce1136, nullptr};
+State state1137 = {&shift1137, &reduce1137, nullptr};
+State state1138 = {&shift1138, &reduce1138, nullptr};
+State state1139 = {&shift1139, &reduce1139, nullptr};
+State state1140 = {&shift1140, &reduce1140, nullptr};
+State state1141 = {&shift1141, &reduce1141, nullptr};
+State state1142 = {&shift1142, &reduce1142, nullptr};
+State state1143 = {&shift1143, &reduce1143, nullptr};
+State state1144 = {&shift1144, &reduce1144, nullptr};
+State state1145 = {&shift1145, &reduce1145, nullptr};
+State state1146 = {&shift1146, &reduce1146, nullptr};
+State state1147 = {&shift1147, &reduce1147, nullptr};
+State state1148 = {&shift1148, &reduce1148, nullptr};
+State state1149 = {&shift1149, &reduce1149, nullptr};
+State state1150 = {&shift1150, &reduce1150, nullptr};
+State state1151 = {&shift1151, &reduce1151, nullptr};
+State state1152 = {&shift1152, &reduce1152, nullptr};
+State state1153 = {&shift1153, &reduce1153, nullptr};
+State state1154 = {&shift1154, &reduce1154, nullptr};
+State state1155 = {&shift1155, &reduce1155, nullptr};
+State state1156 = {&shift1156, &reduce1156, nullptr};
+State state1157 = {&shift1157, &reduce1157, nullptr};
+State state1158 = {&shift1158, &reduce1158, nullptr};
+State state1159 = {&shift1159, &reduce1159, nullptr};
+State state1160 = {&shift1160, &reduce1160, nullptr};
+State state1161 = {&shift1161, &reduce1161, nullptr};
+State state1162 = {&shift1162, &reduce1162, nullptr};
+State state1163 = {&shift1163, &reduce1163, nullptr};
+State state1164 = {&shift1164, &reduce1164, nullptr};
+State state1165 = {&shift1165, &reduce1165, nullptr};
+State state1166 = {&shift1166, &reduce1166, nullptr};
+State state1167 = {&shift1167, &reduce1167, nullptr};
+State state1168 = {&shift1168, &reduce1168, nullptr};
+State state1169 = {&shift1169, &reduce1169, nullptr};
+State state1170 = {&shift1170, &reduce1170, nullptr};
+State state1171 = {&shift1171, &reduce1171, nullptr};
+State state1172 = {&shift1172, &reduce1172, nullptr};
+State state1173 = {&shift1173, &reduce1173, nullptr};
+State state1174 = {&shift1174, &reduce1174, nullptr};
+State state1175 = {&shift1175, &reduce1175, nullptr};
+State state1176 = {&shift1176, &reduce1176, nullptr};
+State state1177 = {&shift1177, &reduce1177, nullptr};
+State state1178 = {&shift1178, &reduce1178, nullptr};
+State state1179 = {&shift1179, &reduce1179, nullptr};
+State state1180 = {&shift1180, &reduce1180, nullptr};
+State state1181 = {&shift1181, &reduce1181, nullptr};
+State state1182 = {&shift1182, &reduce1182, nullptr};
+State state1183 = {&shift1183, &reduce1183, nullptr};
+State state1184 = {&shift1184, &reduce1184, nullptr};
+State state1185 = {&shift1185, &reduce1185, nullptr};
+State state1186 = {&shift1186, &reduce1186, nullptr};
+State state1187 = {&shift1187, &reduce1187, nullptr};
+State state1188 = {&shift1188, &reduce1188, nullptr};
+State state1189 = {&shift1189, &reduce1189, nullptr};
+State state1190 = {&shift1190, &reduce1190, nullptr};
+State state1191 = {&shift1191, &reduce1191, nullptr};
+State state1192 = {&shift1192, &reduce1192, nullptr};
+State state1193 = {&shift1193, &reduce1193, nullptr};
+State state1194 = {&shift1194, &reduce1194, nullptr};
+State state1195 = {&shift1195, &reduce1195, nullptr};
+State state1196 = {&shift1196, &reduce1196, nullptr};
+State state1197 = {&shift1197, &reduce1197, nullptr};
+State state1198 = {&shift1198, &reduce1198, nullptr};
+State state1199 = {&shift1199, &reduce1199, nullptr};
+State state1200 = {&shift1200, &reduce1200, nullptr};
+State state1201 = {&shift1201, &reduce1201, nullptr};
+State state1202 = {&shift1202, &reduce1202, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,28055 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ka", false, 0};
+Symbol term1 = {"kb", false, 1};
+Symbol term2 = {"kc", false, 2};
+Symbol term3 = {"kd", false, 3};
+Symbol term4 = {"ke", false, 4};
+Symbol term5 = {"kf", false, 5};
+Symbol term6 = {"kg", false, 6};
+Symbol term7 = {"kh", false, 7};
+Symbol term8 = {"ki", false, 8};
+Symbol term9 = {"kj", false, 9};
+Symbol term10 = {"kk", false, 10};
+Symbol term11 = {"kl", false, 11};
+Symbol term12 = {"km", false, 12};
+Symbol term13 = {"kn", false, 13};
+Symbol term14 = {"ko", false, 14};
+Symbol term15 = {"kp", false, 15};
+Symbol term16 = {"kq", false, 16};
+Symbol term17 = {"kr", false, 17};
+Symbol term18 = {"ks", false, 18};
+Symbol term19 = {"kt", false, 19};
+Symbol term20 = {"ku", false, 20};
+Symbol term21 = {"kv", false, 21};
+Symbol term22 = {"kw", false, 22};
+Symbol term23 = {"kx", false, 23};
+Symbol term24 = {"ky", false, 24};
+Symbol term25 = {"kz", false, 25};
+Symbol term26 = {"kab", false, 26};
+Symbol term27 = {"kbb", false, 27};
+Symbol term28 = {"kcb", false, 28};
+Symbol term29 = {"kdb", false, 29};
+Symbol term30 = {"keb", false, 30};
+Symbol term31 = {"kfb", false, 31};
+Symbol term32 = {"kgb", false, 32};
+Symbol term33 = {"khb", false, 33};
+Symbol term34 = {"kib", false, 34};
+Symbol term35 = {"kjb", false, 35};
+Symbol term36 = {"kkb", false, 36};
+Symbol term37 = {"klb", false, 37};
+Symbol term38 = {"kmb", false, 38};
+Symbol term39 = {"knb", false, 39};
+Symbol term40 = {"kob", false, 40};
+Symbol term41 = {"kpb", false, 41};
+Symbol term42 = {"kqb", false, 42};
+Symbol term43 = {"krb", false, 43};
+Symbol term44 = {"ksb", false, 44};
+Symbol term45 = {"ktb", false, 45};
+Symbol term46 = {"kub", false, 46};
+Symbol term47 = {"kvb", false, 47};
+Symbol term48 = {"kwb", false, 48};
+Symbol term49 = {"kxb", false, 49};
+Symbol term50 = {"kyb", false, 50};
+Symbol term51 = {"kzb", false, 51};
+Symbol term52 = {"kac", false, 52};
+Symbol term53 = {"kbc", false, 53};
+Symbol term54 = {"kcc", false, 54};
+Symbol term55 = {"kdc", false, 55};
+Symbol term56 = {"kec", false, 56};
+Symbol term57 = {"kfc", false, 57};
+Symbol term58 = {"kgc", false, 58};
+Symbol term59 = {"khc", false, 59};
+Symbol term60 = {"kic", false, 60};
+Symbol term61 = {"kjc", false, 61};
+Symbol term62 = {"kkc", false, 62};
+Symbol term63 = {"klc", false, 63};
+Symbol term64 = {"kmc", false, 64};
+Symbol term65 = {"knc", false, 65};
+Symbol term66 = {"koc", false, 66};
+Symbol term67 = {"kpc", false, 67};
+Symbol term68 = {"kqc", false, 68};
+Symbol term69 = {"krc", false, 69};
+Symbol term70 = {"ksc", false, 70};
+Symbol term71 = {"ktc", false, 71};
+Symbol term72 = {"kuc", false, 72};
+Symbol term73 = {"kvc", false, 73};
+Symbol term74 = {"kwc", false, 74};
+Symbol term75 = {"kxc", false, 75};
+Symbol term76 = {"kyc", false, 76};
+Symbol term77 = {"kzc", false, 77};
+Symbol term78 = {"kad", false, 78};
+Symbol term79 = {"kbd", false, 79};
+Symbol term80 = {"kcd", false, 80};
+Symbol term81 = {"kdd", false, 81};
+Symbol term82 = {"ked", false, 82};
+Symbol term83 = {"kfd", false, 83};
+Symbol term84 = {"kgd", false, 84};
+Symbol term85 = {"khd", false, 85};
+Symbol term86 = {"kid", false, 86};
+Symbol term87 = {"kjd", false, 87};
+Symbol term88 = {"kkd", false, 88};
+Symbol term89 = {"kld", false, 89};
+Symbol term90 = {"kmd", false, 90};
+Symbol term91 = {"knd", false, 91};
+Symbol term92 = {"kod", false, 92};
+Symbol term93 = {"kpd", false, 93};
+Symbol term94 = {"kqd", false, 94};
+Symbol term95 = {"krd", false, 95};
+Symbol term96 = {"ksd", false, 96};
+Symbol term97 = {"ktd", false, 97};
+Symbol term98 = {"kud", false, 98};
+Symbol term99 = {"kvd", false, 99};
+Symbol term100 = {"kwd", false, 100};
+Symbol term101 = {"kxd", false, 101};
+Symbol term102 = {"kyd", false, 102};
+Symbol term103 = {"kzd", false, 103};
+Symbol term104 = {"kae", false, 104};
+Symbol term105 = {"kbe", false, 105};
+Symbol term106 = {"kce", false, 106};
+Symbol term107 = {"kde", false, 107};
+Symbol term108 = {"kee", false, 108};
+Symbol term109 = {"kfe", false, 109};
+Symbol term110 = {"kge", false, 110};
+Symbol term111 = {"khe", false, 111};
+Symbol term112 = {"kie", false, 112};
+Symbol term113 = {"kje", false, 113};
+Symbol term114 = {"kke", false, 114};
+Symbol term115 = {"kle", false, 115};
+Symbol term116 = {"kme", false, 116};
+Symbol term117 = {"kne", false, 117};
+Symbol term118 = {"koe", false, 118};
+Symbol term119 = {"kpe", false, 119};
+Symbol term120 = {"kqe", false, 120};
+Symbol term121 = {"kre", false, 121};
+Symbol term122 = {"kse", false, 122};
+Symbol term123 = {"kte", false, 123};
+Symbol term124 = {"kue", false, 124};
+Symbol term125 = {"kve", false, 125};
+Symbol term126 = {"kwe", false, 126};
+Symbol term127 = {"kxe", false, 127};
+Symbol term128 = {"kye", false, 128};
+Symbol term129 = {"kze", false, 129};
+Symbol term130 = {"kaf", false, 130};
+Symbol term131 = {"kbf", false, 131};
+Symbol term132 = {"kcf", false, 132};
+Symbol term133 = {"kdf", false, 133};
+Symbol term134 = {"kef", false, 134};
+Symbol term135 = {"kff", false, 135};
+Symbol term136 = {"kgf", false, 136};
+Symbol term137 = {"khf", false, 137};
+Symbol term138 = {"kif", false, 138};
+Symbol term139 = {"kjf", false, 139};
+Symbol term140 = {"kkf", false, 140};
+Symbol term141 = {"klf", false, 141};
+Symbol term142 = {"kmf", false, 142};
+Symbol term143 = {"knf", false, 143};
+Symbol term144 = {"kof", false, 144};
+Symbol term145 = {"kpf", false, 145};
+Symbol term146 = {"kqf", false, 146};
+Symbol term147 = {"krf", false, 147};
+Symbol term148 = {"ksf", false, 148};
+Symbol term149 = {"ktf", false, 149};
+Symbol term150 = {"kuf", false, 150};
+Symbol term151 = {"kvf", false, 151};
+Symbol term152 = {"kwf", false, 152};
+Symbol term153 = {"kxf", false, 153};
+Symbol term154 = {"kyf", false, 154};
+Symbol term155 = {"kzf", false, 155};
+Symbol term156 = {"kag", false, 156};
+Symbol term157 = {"kbg", false, 157};
+Symbol term158 = {"kcg", false, 158};
+Symbol term159 = {"kdg", false, 159};
+Symbol term160 = {"keg", false, 160};
+Symbol term161 = {"kfg", false, 161};
+Symbol term162 = {"kgg", false, 162};
+Symbol term163 = {"khg", false, 163};
+Symbol term164 = {"kig", false, 164};
+Symbol term165 = {"kjg", false, 165};
+Symbol term166 = {"kkg", false, 166};
+Symbol term167 = {"klg", false, 167};
+Symbol term168 = {"kmg", false, 168};
+Symbol term169 = {"kng", false, 169};
+Symbol term170 = {"kog", false, 170};
+Symbol term171 = {"kpg", false, 171};
+Symbol term172 = {"kqg", false, 172};
+Symbol term173 = {"krg", false, 173};
+Symbol term174 = {"ksg", false, 174};
+Symbol term175 = {"ktg", false, 175};
+Symbol term176 = {"kug", false, 176};
+Symbol term177 = {"kvg", false, 177};
+Symbol term178 = {"kwg", false, 178};
+Symbol term179 = {"kxg", false, 179};
+Symbol term180 = {"kyg", false, 180};
+Symbol term181 = {"kzg", false, 181};
+Symbol term182 = {"kah", false, 182};
+Symbol term183 = {"kbh", false, 183};
+Symbol term184 = {"kch", false, 184};
+Symbol term185 = {"kdh", false, 185};
+Symbol term186 = {"keh", false, 186};
+Symbol term187 = {"kfh", false, 187};
+Symbol term188 = {"kgh", false, 188};
+Symbol term189 = {"khh", false, 189};
+Symbol term190 = {"kih", false, 190};
+Symbol term191 = {"kjh", false, 191};
+Symbol term192 = {"kkh", false, 192};
+Symbol term193 = {"klh", false, 193};
+Symbol term194 = {"kmh", false, 194};
+Symbol term195 = {"knh", false, 195};
+Symbol term196 = {"koh", false, 196};
+Symbol term197 = {"kph", false, 197};
+Symbol term198 = {"kqh", false, 198};
+Symbol term199 = {"krh", false, 199};
+Symbol term200 = {"ksh", false, 200};
+Symbol term201 = {"kth", false, 201};
+Symbol term202 = {"kuh", false, 202};
+Symbol term203 = {"kvh", false, 203};
+Symbol term204 = {"kwh", false, 204};
+Symbol term205 = {"kxh", false, 205};
+Symbol term206 = {"kyh", false, 206};
+Symbol term207 = {"kzh", false, 207};
+Symbol term208 = {"kai", false, 208};
+Symbol term209 = {"kbi", false, 209};
+Symbol term210 = {"kci", false, 210};
+Symbol term211 = {"kdi", false, 211};
+Symbol term212 = {"kei", false, 212};
+Symbol term213 = {"kfi", false, 213};
+Symbol term214 = {"kgi", false, 214};
+Symbol term215 = {"khi", false, 215};
+Symbol term216 = {"kii", false, 216};
+Symbol term217 = {"kji", false, 217};
+Symbol term218 = {"kki", false, 218};
+Symbol term219 = {"kli", false, 219};
+Symbol term220 = {"kmi", false, 220};
+Symbol term221 = {"kni", false, 221};
+Symbol term222 = {"koi", false, 222};
+Symbol term223 = {"kpi", false, 223};
+Symbol term224 = {"kqi", false, 224};
+Symbol term225 = {"kri", false, 225};
+Symbol term226 = {"ksi", false, 226};
+Symbol term227 = {"kti", false, 227};
+Symbol term228 = {"kui", false, 228};
+Symbol term229 = {"kvi", false, 229};
+Symbol term230 = {"kwi", false, 230};
+Symbol term231 = {"kxi", false, 231};
+Symbol term232 = {"kyi", false, 232};
+Symbol term233 = {"kzi", false, 233};
+Symbol term234 = {"kaj", false, 234};
+Symbol term235 = {"kbj", false, 235};
+Symbol term236 = {"kcj", false, 236};
+Symbol term237 = {"kdj", false, 237};
+Symbol term238 = {"kej", false, 238};
+Symbol term239 = {"kfj", false, 239};
+Symbol term240 = {"kgj", false, 240};
+Symbol term241 = {"khj", false, 241};
+Symbol term242 = {"kij", false, 242};
+Symbol term243 = {"kjj", false, 243};
+Symbol term244 = {"kkj", false, 244};
+Symbol term245 = {"klj", false, 245};
+Symbol term246 = {"kmj", false, 246};
+Symbol term247 = {"knj", false, 247};
+Symbol term248 = {"koj", false, 248};
+Symbol term249 = {"kpj", false, 249};
+Symbol term250 = {"kqj", false, 250};
+Symbol term251 = {"krj", false, 251};
+Symbol term252 = {"ksj", false, 252};
+Symbol term253 = {"ktj", false, 253};
+Symbol term254 = {"kuj", false, 254};
+Symbol term255 = {"kvj", false, 255};
+Symbol term256 = {"kwj", false, 256};
+Symbol term257 = {"kxj", false, 257};
+Symbol term258 = {"kyj", false, 258};
+Symbol term259 = {"kzj", false, 259};
+Symbol term260 = {"kak", false, 260};
+Symbol term261 = {"kbk", false, 261};
+Symbol term262 = {"kck", false, 262};
+Symbol term263 = {"kdk", false, 263};
+Symbol term264 = {"kek", false, 264};
+Symbol term265 = {"kfk", false, 265};
+Symbol term266 = {"kgk", false, 266};
+Symbol term267 = {"khk", false, 267};
+Symbol term268 = {"kik", false, 268};
+Symbol term269 = {"kjk", false, 269};
+Symbol term270 = {"kkk", false, 270};
+Symbol term271 = {"klk", false, 271};
+Symbol term272 = {"kmk", false, 272};
+Symbol term273 = {"knk", false, 273};
+Symbol term274 = {"kok", false, 274};
+Symbol term275 = {"kpk", false, 275};
+Symbol term276 = {"kqk", false, 276};
+Symbol term277 = {"krk", false, 277};
+Symbol term278 = {"ksk", false, 278};
+Symbol term279 = {"ktk", false, 279};
+Symbol term280 = {"kuk", false, 280};
+Symbol term281 = {"kvk", false, 281};
+Symbol term282 = {"kwk", false, 282};
+Symbol term283 = {"kxk", false, 283};
+Symbol term284 = {"kyk", false, 284};
+Symbol term285 = {"kzk", false, 285};
+Symbol term286 = {"kal", false, 286};
+Symbol term287 = {"kbl", false, 287};
+Symbol term288 = {"kcl", false, 288};
+Symbol term289 = {"kdl", false, 289};
+Symbol term290 = {"kel", false, 290};
+Symbol term291 = {"kfl", false, 291};
+Symbol term292 = {"kgl", false, 292};
+Symbol term293 = {"khl", false, 293};
+Symbol term294 = {"kil", false, 294};
+Symbol term295 = {"kjl", false, 295};
+Symbol term296 = {"kkl", false, 296};
+Symbol term297 = {"kll", false, 297};
+Symbol term298 = {"kml", false, 298};
+Symbol term299 = {"knl", false, 299};
+Symbol term300 = {"kol", false, 300};
+Symbol term301 = {"kpl", false, 301};
+Symbol term302 = {"kql", false, 302};
+Symbol term303 = {"krl", false, 303};
+Symbol term304 = {"ksl", false, 304};
+Symbol term305 = {"ktl", false, 305};
+Symbol term306 = {"kul", false, 306};
+Symbol term307 = {"kvl", false, 307};
+Symbol term308 = {"kwl", false, 308};
+Symbol term309 = {"kxl", false, 309};
+Symbol term310 = {"kyl", false, 310};
+Symbol term311 = {"kzl", false, 311};
+Symbol term312 = {"kam", false, 312};
+Symbol term313 = {"kbm", false, 313};
+Symbol term314 = {"kcm", false, 314};
+Symbol term315 = {"kdm", false, 315};
+Symbol term316 = {"kem", false, 316};
+Symbol term317 = {"kfm", false, 317};
+Symbol term318 = {"kgm", false, 318};
+Symbol term319 = {"khm", false, 319};
+Symbol term320 = {"kim", false, 320};
+Symbol term321 = {"kjm", false, 321};
+Symbol term322 = {"kkm", false, 322};
+Symbol term323 = {"klm", false, 323};
+Symbol term324 = {"kmm", false, 324};
+Symbol term325 = {"knm", false, 325};
+Symbol term326 = {"kom", false, 326};
+Symbol term327 = {"kpm", false, 327};
+Symbol term328 = {"kqm", false, 328};
+Symbol term329 = {"krm", false, 329};
+Symbol term330 = {"ksm", false, 330};
+Symbol term331 = {"ktm", false, 331};
+Symbol term332 = {"kum", false, 332};
+Symbol term333 = {"kvm", false, 333};
+Symbol term334 = {"kwm", false, 334};
+Symbol term335 = {"kxm", false, 335};
+Symbol term336 = {"kym", false, 336};
+Symbol term337 = {"kzm", false, 337};
+Symbol term338 = {"kan", false, 338};
+Symbol term339 = {"kbn", false, 339};
+Symbol term340 = {"kcn", false, 340};
+Symbol term341 = {"kdn", false, 341};
+Symbol term342 = {"ken", false, 342};
+Symbol term343 = {"kfn", false, 343};
+Symbol term344 = {"kgn", false, 344};
+Symbol term345 = {"khn", false, 345};
+Symbol term346 = {"kin", false, 346};
+Symbol term347 = {"kjn", false, 347};
+Symbol term348 = {"kkn", false, 348};
+Symbol term349 = {"kln", false, 349};
+Symbol term350 = {"kmn", false, 350};
+Symbol term351 = {"knn", false, 351};
+Symbol term352 = {"kon", false, 352};
+Symbol term353 = {"kpn", false, 353};
+Symbol term354 = {"kqn", false, 354};
+Symbol term355 = {"krn", false, 355};
+Symbol term356 = {"ksn", false, 356};
+Symbol term357 = {"ktn", false, 357};
+Symbol term358 = {"kun", false, 358};
+Symbol term359 = {"kvn", false, 359};
+Symbol term360 = {"kwn", false, 360};
+Symbol term361 = {"kxn", false, 361};
+Symbol term362 = {"kyn", false, 362};
+Symbol term363 = {"kzn", false, 363};
+Symbol term364 = {"kao", false, 364};
+Symbol term365 = {"kbo", false, 365};
+Symbol term366 = {"kco", false, 366};
+Symbol term367 = {"kdo", false, 367};
+Symbol term368 = {"keo", false, 368};
+Symbol term369 = {"kfo", false, 369};
+Symbol term370 = {"kgo", false, 370};
+Symbol term371 = {"kho", false, 371};
+Symbol term372 = {"kio", false, 372};
+Symbol term373 = {"kjo", false, 373};
+Symbol term374 = {"kko", false, 374};
+Symbol term375 = {"klo", false, 375};
+Symbol term376 = {"kmo", false, 376};
+Symbol term377 = {"kno", false, 377};
+Symbol term378 = {"koo", false, 378};
+Symbol term379 = {"kpo", false, 379};
+Symbol term380 = {"kqo", false, 380};
+Symbol term381 = {"kro", false, 381};
+Symbol term382 = {"kso", false, 382};
+Symbol term383 = {"kto", false, 383};
+Symbol term384 = {"kuo", false, 384};
+Symbol term385 = {"kvo", false, 385};
+Symbol term386 = {"kwo", false, 386};
+Symbol term387 = {"kxo", false, 387};
+Symbol term388 = {"kyo", false, 388};
+Symbol term389 = {"kzo", false, 389};
+Symbol term390 = {"kap", false, 390};
+Symbol term391 = {"kbp", false, 391};
+Symbol term392 = {"kcp", false, 392};
+Symbol term393 = {"kdp", false, 393};
+Symbol term394 = {"kep", false, 394};
+Symbol term395 = {"kfp", false, 395};
+Symbol term396 = {"kgp", false, 396};
+Symbol term397 = {"khp", false, 397};
+Symbol term398 = {"kip", false, 398};
+Symbol term399 = {"kjp", false, 399};
+Symbol term400 = {"kkp", false, 400};
+Symbol term401 = {"klp", false, 401};
+Symbol term402 = {"kmp", false, 402};
+Symbol term403 = {"knp", false, 403};
+Symbol term404 = {"kop", false, 404};
+Symbol term405 = {"kpp", false, 405};
+Symbol term406 = {"kqp", false, 406};
+Symbol term407 = {"krp", false, 407};
+Symbol term408 = {"ksp", false, 408};
+Symbol term409 = {"ktp", false, 409};
+Symbol term410 = {"kup", false, 410};
+Symbol term411 = {"kvp", false, 411};
+Symbol term412 = {"kwp", false, 412};
+Symbol term413 = {"kxp", false, 413};
+Symbol term414 = {"kyp", false, 414};
+Symbol term415 = {"kzp", false, 415};
+Symbol term416 = {"kaq", false, 416};
+Symbol term417 = {"kbq", false, 417};
+Symbol term418 = {"kcq", false, 418};
+Symbol term419 = {"kdq", false, 419};
+Symbol term420 = {"keq", false, 420};
+Symbol term421 = {"kfq", false, 421};
+Symbol term422 = {"kgq", false, 422};
+Symbol term423 = {"khq", false, 423};
+Symbol term424 = {"kiq", false, 424};
+Symbol term425 = {"kjq", false, 425};
+Symbol term426 = {"kkq", false, 426};
+Symbol term427 = {"klq", false, 427};
+Symbol term428 = {"kmq", false, 428};
+Symbol term429 = {"knq", false, 429};
+Symbol term430 = {"koq", false, 430};
+Symbol term431 = {"kpq", false, 431};
+Symbol term432 = {"kqq", false, 432};
+Symbol term433 = {"krq", false, 433};
+Symbol term434 = {"ksq", false, 434};
+Symbol term435 = {"ktq", false, 435};
+Symbol term436 = {"kuq", false, 436};
+Symbol term437 = {"kvq", false, 437};
+Symbol term438 = {"kwq", false, 438};
+Symbol term439 = {"kxq", false, 439};
+Symbol term440 = {"kyq", false, 440};
+Symbol term441 = {"kzq", false, 441};
+Symbol term442 = {"kar", false, 442};
+Symbol term443 = {"kbr", false, 443};
+Symbol term444 = {"kcr", false, 444};
+Symbol term445 = {"kdr", false, 445};
+Symbol term446 = {"ker", false, 446};
+Symbol term447 = {"kfr", false, 447};
+Symbol term448 = {"kgr", false, 448};
+Symbol term449 = {"khr", false, 449};
+Symbol term450 = {"kir", false, 450};
+Symbol term451 = {"kjr", false, 451};
+Symbol term452 = {"kkr", false, 452};
+Symbol term453 = {"klr", false, 453};
+Symbol term454 = {"kmr", false, 454};
+Symbol term455 = {"knr", false, 455};
+Symbol term456 = {"kor", false, 456};
+Symbol term457 = {"kpr", false, 457};
+Symbol term458 = {"kqr", false, 458};
+Symbol term459 = {"krr", false, 459};
+Symbol term460 = {"ksr", false, 460};
+Symbol term461 = {"ktr", false, 461};
+Symbol term462 = {"kur", false, 462};
+Symbol term463 = {"kvr", false, 463};
+Symbol term464 = {"kwr", false, 464};
+Symbol term465 = {"kxr", false, 465};
+Symbol term466 = {"kyr", false, 466};
+Symbol term467 = {"kzr", false, 467};
+Symbol term468 = {"kas", false, 468};
+Symbol term469 = {"kbs", false, 469};
+Symbol term470 = {"kcs", false, 470};
+Symbol term471 = {"kds", false, 471};
+Symbol term472 = {"kes", false, 472};
+Symbol term473 = {"kfs", false, 473};
+Symbol term474 = {"kgs", false, 474};
+Symbol term475 = {"khs", false, 475};
+Symbol term476 = {"kis", false, 476};
+Symbol term477 = {"kjs", false, 477};
+Symbol term478 = {"kks", false, 478};
+Symbol term479 = {"kls", false, 479};
+Symbol term480 = {"kms", false, 480};
+Symbol term481 = {"kns", false, 481};
+Symbol term482 = {"kos", false, 482};
+Symbol term483 = {"kps", false, 483};
+Symbol term484 = {"kqs", false, 484};
+Symbol term485 = {"krs", false, 485};
+Symbol term486 = {"kss", false, 486};
+Symbol term487 = {"kts", false, 487};
+Symbol term488 = {"kus", false, 488};
+Symbol term489 = {"kvs", false, 489};
+Symbol term490 = {"kws", false, 490};
+Symbol term491 = {"kxs", false, 491};
+Symbol term492 = {"kys", false, 492};
+Symbol term493 = {"kzs", false, 493};
+Symbol term494 = {"kat", false, 494};
+Symbol term495 = {"kbt", false, 495};
+Symbol term496 = {"kct", false, 496};
+Symbol term497 = {"kdt", false, 497};
+Symbol term498 = {"ket", false, 498};
+Symbol term499 = {"kft", false, 499};
+Symbol term500 = {"kgt", false, 500};
+Symbol term501 = {"kht", false, 501};
+Symbol term502 = {"kit", false, 502};
+Symbol term503 = {"kjt", false, 503};
+Symbol term504 = {"kkt", false, 504};
+Symbol term505 = {"klt", false, 505};
+Symbol term506 = {"kmt", false, 506};
+Symbol term507 = {"knt", false, 507};
+Symbol term508 = {"kot", false, 508};
+Symbol term509 = {"kpt", false, 509};
+Symbol term510 = {"kqt", false, 510};
+Symbol term511 = {"krt", false, 511};
+Symbol term512 = {"kst", false, 512};
+Symbol term513 = {"ktt", false, 513};
+Symbol term514 = {"kut", false, 514};
+Symbol term515 = {"kvt", false, 515};
+Symbol term516 = {"kwt", false, 516};
+Symbol term517 = {"kxt", false, 517};
+Symbol term518 = {"kyt", false, 518};
+Symbol term519 = {"kzt", false, 519};
+Symbol term520 = {"kau", false, 520};
+Symbol term521 = {"kbu", false, 521};
+Symbol term522 = {"kcu", false, 522};
+Symbol term523 = {"kdu", false, 523};
+Symbol term524 = {"keu", false, 524};
+Symbol term525 = {"kfu", false, 525};
+Symbol term526 = {"kgu", false, 526};
+Symbol term527 = {"khu", false, 527};
+Symbol term528 = {"kiu", false, 528};
+Symbol term529 = {"kju", false, 529};
+Symbol term530 = {"kku", false, 530};
+Symbol term531 = {"klu", false, 531};
+Symbol term532 = {"kmu", false, 532};
+Symbol term533 = {"knu", false, 533};
+Symbol term534 = {"kou", false, 534};
+Symbol term535 = {"kpu", false, 535};
+Symbol term536 = {"kqu", false, 536};
+Symbol term537 = {"kru", false, 537};
+Symbol term538 = {"ksu", false, 538};
+Symbol term539 = {"ktu", false, 539};
+Symbol term540 = {"kuu", false, 540};
+Symbol term541 = {"kvu", false, 541};
+Symbol term542 = {"kwu", false, 542};
+Symbol term543 = {"kxu", false, 543};
+Symbol term544 = {"kyu", false, 544};
+Symbol term545 = {"kzu", false, 545};
+Symbol term546 = {"kav", false, 546};
+Symbol term547 = {"kbv", false, 547};
+Symbol term548 = {"kcv", false, 548};
+Symbol term549 = {"kdv", false, 549};
+Symbol term550 = {"kev", false, 550};
+Symbol term551 = {"kfv", false, 551};
+Symbol term552 = {"kgv", false, 552};
+Symbol term553 = {"khv", false, 553};
+Symbol term554 = {"kiv", false, 554};
+Symbol term555 = {"kjv", false, 555};
+Symbol term556 = {"kkv", false, 556};
+Symbol term557 = {"klv", false, 557};
+Symbol term558 = {"kmv", false, 558};
+Symbol term559 = {"knv", false, 559};
+Symbol term560 = {"kov", false, 560};
+Symbol term561 = {"kpv", false, 561};
+Symbol term562 = {"kqv", false, 562};
+Symbol term563 = {"krv", false, 563};
+Symbol term564 = {"ksv", false, 564};
+Symbol term565 = {"ktv", false, 565};
+Symbol term566 = {"kuv", false, 566};
+Symbol term567 = {"kvv", false, 567};
+Symbol term568 = {"kwv", false, 568};
+Symbol term569 = {"kxv", false, 569};
+Symbol term570 = {"kyv", false, 570};
+Symbol term571 = {"kzv", false, 571};
+Symbol term572 = {"kaw", false, 572};
+Symbol term573 = {"kbw", false, 573};
+Symbol term574 = {"kcw", false, 574};
+Symbol term575 = {"kdw", false, 575};
+Symbol term576 = {"kew", false, 576};
+Symbol term577 = {"kfw", false, 577};
+Symbol term578 = {"kgw", false, 578};
+Symbol term579 = {"khw", false, 579};
+Symbol term580 = {"kiw", false, 580};
+Symbol term581 = {"kjw", false, 581};
+Symbol term582 = {"kkw", false, 582};
+Symbol term583 = {"klw", false, 583};
+Symbol term584 = {"kmw", false, 584};
+Symbol term585 = {"knw", false, 585};
+Symbol term586 = {"kow", false, 586};
+Symbol term587 = {"kpw", false, 587};
+Symbol term588 = {"kqw", false, 588};
+Symbol term589 = {"krw", false, 589};
+Symbol term590 = {"ksw", false, 590};
+Symbol term591 = {"ktw", false, 591};
+Symbol term592 = {"kuw", false, 592};
+Symbol term593 = {"kvw", false, 593};
+Symbol term594 = {"kww", false, 594};
+Symbol term595 = {"kxw", false, 595};
+Symbol term596 = {"kyw", false, 596};
+Symbol term597 = {"kzw", false, 597};
+Symbol term598 = {"kax", false, 598};
+Symbol term599 = {"kbx", false, 599};
+Symbol term600 = {"kcx", false, 600};
+Symbol term601 = {"kdx", false, 601};
+Symbol term602 = {"kex", false, 602};
+Symbol term603 = {"kfx", false, 603};
+Symbol term604 = {"kgx", false, 604};
+Symbol term605 = {"khx", false, 605};
+Symbol term606 = {"kix", false, 606};
+Symbol term607 = {"kjx", false, 607};
+Symbol term608 = {"kkx", false, 608};
+Symbol term609 = {"klx", false, 609};
+Symbol term610 = {"kmx", false, 610};
+Symbol term611 = {"knx", false, 611};
+Symbol term612 = {"kox", false, 612};
+Symbol term613 = {"kpx", false, 613};
+Symbol term614 = {"kqx", false, 614};
+Symbol term615 = {"krx", false, 615};
+Symbol term616 = {"ksx", false, 616};
+Symbol term617 = {"ktx", false, 617};
+Symbol term618 = {"kux", false, 618};
+Symbol term619 = {"kvx", false, 619};
+Symbol term620 = {"kwx", false, 620};
+Symbol term621 = {"kxx", false, 621};
+Symbol term622 = {"kyx", false, 622};
+Symbol term623 = {"kzx", false, 623};
+Symbol term624 = {"kay", false, 624};
+Symbol term625 = {"kby", false, 625};
+Symbol term626 = {"kcy", false, 626};
+Symbol term627 = {"kdy", false, 627};
+Symbol term628 = {"key", false, 628};
+Symbol term629 = {"kfy", false, 629};
+Symbol term630 = {"kgy", false, 630};
+Symbol term631 = {"khy", false, 631};
+Symbol term632 = {"kiy", false, 632};
+Symbol term633 = {"kjy", false, 633};
+Symbol term634 = {"kky", false, 634};
+Symbol term635 = {"kly", false, 635};
+Symbol term636 = {"kmy", false, 636};
+Symbol term637 = {"kny", false, 637};
+Symbol term638 = {"koy", false, 638};
+Symbol term639 = {"kpy", false, 639};
+Symbol term640 = {"kqy", false, 640};
+Symbol term641 = {"kry", false, 641};
+Symbol term642 = {"ksy", false, 642};
+Symbol term643 = {"kty", false, 643};
+Symbol term644 = {"kuy", false, 644};
+Symbol term645 = {"kvy", false, 645};
+Symbol term646 = {"kwy", false, 646};
+Symbol term647 = {"kxy", false, 647};
+Symbol term648 = {"kyy", false, 648};
+Symbol term649 = {"kzy", false, 649};
+Symbol term650 = {"kaz", false, 650};
+Symbol term651 = {"kbz", false, 651};
+Symbol term652 = {"kcz", false, 652};
+Symbol term653 = {"kdz", false, 653};
+Symbol term654 = {"kez", false, 654};
+Symbol term655 = {"kfz", false, 655};
+Symbol term656 = {"kgz", false, 656};
+Symbol term657 = {"khz", false, 657};
+Symbol term658 = {"kiz", false, 658};
+Symbol term659 = {"kjz", false, 659};
+Symbol term660 = {"kkz", false, 660};
+Symbol term661 = {"klz", false, 661};
+Symbol term662 = {"kmz", false, 662};
+Symbol term663 = {"knz", false, 663};
+Symbol term664 = {"koz", false, 664};
+Symbol term665 = {"kpz", false, 665};
+Symbol term666 = {"kqz", false, 666};
+Symbol term667 = {"krz", false, 667};
+Symbol term668 = {"ksz", false, 668};
+Symbol term669 = {"ktz", false, 669};
+Symbol term670 = {"kuz", false, 670};
+Symbol term671 = {"kvz", false, 671};
+Symbol term672 = {"kwz", false, 672};
+Symbol term673 = {"kxz", false, 673};
+Symbol term674 = {"kyz", false, 674};
+Symbol term675 = {"kzz", false, 675};
+Symbol term676 = {"kaab", false, 676};
+Symbol term677 = {"kbab", false, 677};
+Symbol term678 = {"kcab", false, 678};
+Symbol term679 = {"kdab", false, 679};
+Symbol term680 = {"keab", false, 680};
+Symbol term681 = {"kfab", false, 681};
+Symbol term682 = {"kgab", false, 682};
+Symbol term683 = {"khab", false, 683};
+Symbol term684 = {"kiab", false, 684};
+Symbol term685 = {"kjab", false, 685};
+Symbol term686 = {"kkab", false, 686};
+Symbol term687 = {"klab", false, 687};
+Symbol term688 = {"kmab", false, 688};
+Symbol term689 = {"knab", false, 689};
+Symbol term690 = {"koab", false, 690};
+Symbol term691 = {"kpab", false, 691};
+Symbol term692 = {"kqab", false, 692};
+Symbol term693 = {"krab", false, 693};
+Symbol term694 = {"ksab", false, 694};
+Symbol term695 = {"ktab", false, 695};
+Symbol term696 = {"kuab", false, 696};
+Symbol term697 = {"kvab", false, 697};
+Symbol term698 = {"kwab", false, 698};
+Symbol term699 = {"kxab", false, 699};
+Symbol term700 = {"kyab", false, 700};
+Symbol term701 = {"kzab", false, 701};
+Symbol term702 = {"kabb", false, 702};
+Symbol term703 = {"kbbb", false, 703};
+Symbol term704 = {"kcbb", false, 704};
+Symbol term705 = {"kdbb", false, 705};
+Symbol term706 = {"kebb", false, 706};
+Symbol term707 = {"kfbb", false, 707};
+Symbol term708 = {"kgbb", false, 708};
+Symbol term709 = {"khbb", false, 709};
+Symbol term710 = {"kibb", false, 710};
+Symbol term711 = {"kjbb", false, 711};
+Symbol term712 = {"kkbb", false, 712};
+Symbol term713 = {"klbb", false, 713};
+Symbol term714 = {"kmbb", false, 714};
+Symbol term715 = {"knbb", false, 715};
+Symbol term716 = {"kobb", false, 716};
+Symbol term717 = {"kpbb", false, 717};
+Symbol term718 = {"kqbb", false, 718};
+Symbol term719 = {"krbb", false, 719};
+Symbol term720 = {"ksbb", false, 720};
+Symbol term721 = {"ktbb", false, 721};
+Symbol term722 = {"kubb", false, 722};
+Symbol term723 = {"kvbb", false, 723};
+Symbol term724 = {"kwbb", false, 724};
+Symbol term725 = {"kxbb", false, 725};
+Symbol term726 = {"kybb", false, 726};
+Symbol term727 = {"kzbb", false, 727};
+Symbol term728 = {"kacb", false, 728};
+Symbol term729 = {"kbcb", false, 729};
+Symbol term730 = {"kccb", false, 730};
+Symbol term731 = {"kdcb", false, 731};
+Symbol term732 = {"kecb", false, 732};
+Symbol term733 = {"kfcb", false, 733};
+Symbol term734 = {"kgcb", false, 734};
+Symbol term735 = {"khcb", false, 735};
+Symbol term736 = {"kicb", false, 736};
+Symbol term737 = {"kjcb", false, 737};
+Symbol term738 = {"kkcb", false, 738};
+Symbol term739 = {"klcb", false, 739};
+Symbol term740 = {"kmcb", false, 740};
+Symbol term741 = {"kncb", false, 741};
+Symbol term742 = {"kocb", false, 742};
+Symbol term743 = {"kpcb", false, 743};
+Symbol term744 = {"kqcb", false, 744};
+Symbol term745 = {"krcb", false, 745};
+Symbol term746 = {"kscb", false, 746};
+Symbol term747 = {"ktcb", false, 747};
+Symbol term748 = {"kucb", false, 748};
+Symbol term749 = {"kvcb", false, 749};
+Symbol term750 = {"kwcb", false, 750};
+Symbol term751 = {"kxcb", false, 751};
+Symbol term752 = {"kycb", false, 752};
+Symbol term753 = {"kzcb", false, 753};
+Symbol term754 = {"kadb", false, 754};
+Symbol term755 = {"kbdb", false, 755};
+Symbol term756 = {"kcdb", false, 756};
+Symbol term757 = {"kddb", false, 757};
+Symbol term758 = {"kedb", false, 758};
+Symbol term759 = {"kfdb", false, 759};
+Symbol term760 = {"kgdb", false, 760};
+Symbol term761 = {"khdb", false, 761};
+Symbol term762 = {"kidb", false, 762};
+Symbol term763 = {"kjdb", false, 763};
+Symbol term764 = {"kkdb", false, 764};
+Symbol term765 = {"kldb", false, 765};
+Symbol term766 = {"kmdb", false, 766};
+Symbol term767 = {"kndb", false, 767};
+Symbol term768 = {"kodb", false, 768};
+Symbol term769 = {"kpdb", false, 769};
+Symbol term770 = {"kqdb", false, 770};
+Symbol term771 = {"krdb", false, 771};
+Symbol term772 = {"ksdb", false, 772};
+Symbol term773 = {"ktdb", false, 773};
+Symbol term774 = {"kudb", false, 774};
+Symbol term775 = {"kvdb", false, 775};
+Symbol term776 = {"kwdb", false, 776};
+Symbol term777 = {"kxdb", false, 777};
+Symbol term778 = {"kydb", false, 778};
+Symbol term779 = {"kzdb", false, 779};
+Symbol term780 = {"kaeb", false, 780};
+Symbol term781 = {"kbeb", false, 781};
+Symbol term782 = {"kceb", false, 782};
+Symbol term783 = {"kdeb", false, 783};
+Symbol term784 = {"keeb", false, 784};
+Symbol term785 = {"kfeb", false, 785};
+Symbol term786 = {"kgeb", false, 786};
+Symbol term787 = {"kheb", false, 787};
+Symbol term788 = {"kieb", false, 788};
+Symbol term789 = {"kjeb", false, 789};
+Symbol term790 = {"kkeb", false, 790};
+Symbol term791 = {"kleb", false, 791};
+Symbol term792 = {"kmeb", false, 792};
+Symbol term793 = {"kneb", false, 793};
+Symbol term794 = {"koeb", false, 794};
+Symbol term795 = {"kpeb", false, 795};
+Symbol term796 = {"kqeb", false, 796};
+Symbol term797 = {"kreb", false, 797};
+Symbol term798 = {"kseb", false, 798};
+Symbol term799 = {"kteb", false, 799};
+Symbol term800 = {"num", true, 800};
+Symbol term801 = {"ws", true, 801};
+Symbol term802 = {"id", false, 802};
+Symbol term803 = {";", false, 803};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+extern Node node75;
+extern Node node76;
+extern Node node77;
+extern Node node78;
+extern Node node79;
+extern Node node80;
+extern Node node81;
+extern Node node82;
+extern Node node83;
+extern Node node84;
+extern Node node85;
+extern Node node86;
+extern Node node87;
+extern Node node88;
+extern Node node89;
+extern Node node90;
+extern Node node91;
+extern Node node92;
+extern Node node93;
+extern Node node94;
+extern Node node95;
+extern Node node96;
+extern Node node97;
+extern Node node98;
+extern Node node99;
+extern Node node100;
+extern Node node101;
+extern Node node102;
+extern Node node103;
+extern Node node104;
+extern Node node105;
+extern Node node106;
+extern Node node107;
+extern Node node108;
+extern Node node109;
+extern Node node110;
+extern Node node111;
+extern Node node112;
+extern Node node113;
+extern Node node114;
+extern Node node115;
+extern Node node116;
+extern Node node117;
+extern Node node118;
+extern Node node119;
+extern Node node120;
+extern Node node121;
+extern Node node122;
+extern Node node123;
+extern Node node124;
+extern Node node125;
+extern Node node126;
+extern Node node127;
+extern Node node128;
+extern Node node129;
+extern Node node130;
+extern Node node131;
+extern Node node132;
+extern Node node133;
+extern Node node134;
+extern Node node135;
+extern Node node136;
+extern Node node137;
+extern Node node138;
+extern Node node139;
+extern Node node140;
+extern Node node141;
+extern Node node142;
+extern Node node143;
+extern Node node144;
+extern Node node145;
+extern Node node146;
+extern Node node147;
+extern Node node148;
+extern Node node149;
+extern Node node150;
+extern Node node151;
+extern Node node152;
+extern Node node153;
+extern Node node154;
+extern Node node155;
+extern Node node156;
+extern Node node157;
+extern Node node158;
+extern Node node159;
+extern Node node160;
+extern Node node161;
+extern Node node162;
+extern Node node163;
+extern Node node164;
+extern Node node165;
+extern Node node166;
+extern Node node167;
+extern Node node168;
+extern Node node169;
+extern Node node170;
+extern Node node171;
+extern Node node172;
+extern Node node173;
+extern Node node174;
+extern Node node175;
+extern Node node176;
+extern Node node177;
+extern Node node178;
+extern Node node179;
+extern Node node180;
+extern Node node181;
+extern Node node182;
+extern Node node183;
+extern Node node184;
+extern Node node185;
+extern Node node186;
+extern Node node187;
+extern Node node188;
+extern Node node189;
+extern Node node190;
+extern Node node191;
+extern Node node192;
+extern Node node193;
+extern Node node194;
+extern Node node195;
+extern Node node196;
+extern Node node197;
+extern Node node198;
+extern Node node199;
+extern Node node200;
+extern Node node201;
+extern Node node202;
+extern Node node203;
+extern Node node204;
+extern Node node205;
+extern Node node206;
+extern Node node207;
+extern Node node208;
+extern Node node209;
+extern Node node210;
+extern Node node211;
+extern Node node212;
+extern Node node213;
+extern Node node214;
+extern Node node215;
+extern Node node216;
+extern Node node217;
+extern Node node218;
+extern Node node219;
+extern Node node220;
+extern Node node221;
+extern Node node222;
+extern Node node223;
+extern Node node224;
+extern Node node225;
+extern Node node226;
+extern Node node227;
+extern Node node228;
+extern Node node229;
+extern Node node230;
+extern Node node231;
+extern Node node232;
+extern Node node233;
+extern Node node234;
+extern Node node235;
+extern Node node236;
+extern Node node237;
+extern Node node238;
+extern Node node239;
+extern Node node240;
+extern Node node241;
+extern Node node242;
+extern Node node243;
+extern Node node244;
+extern Node node245;
+extern Node node246;
+extern Node node247;
+extern Node node248;
+extern Node node249;
+extern Node node250;
+extern Node node251;
+extern Node node252;
+extern Node node253;
+extern Node node254;
+extern Node node255;
+extern Node node256;
+extern Node node257;
+extern Node node258;
+extern Node node259;
+extern Node node260;
+extern Node node261;
+extern Node node262;
+extern Node node263;
+extern Node node264;
+extern Node node265;
+extern Node node266;
+extern Node node267;
+extern Node node268;
+extern Node node269;
+extern Node node270;
+extern Node node271;
+extern Node node272;
+extern Node node273;
+extern Node node274;
+extern Node node275;
+extern Node node276;
+extern Node node277;
+extern Node node278;
+extern Node node279;
+extern Node node280;
+extern Node node281;
+extern Node node282;
+extern Node node283;
+extern Node node284;
+extern Node node285;
+extern Node node286;
+extern Node node287;
+extern Node node288;
+extern Node node289;
+extern Node node290;
+extern Node node291;
+extern Node node292;
+extern Node node293;
+extern Node node294;
+extern Node node295;
+extern Node node296;
+extern Node node297;
+extern Node node298;
+extern Node node299;
+extern Node node300;
+extern Node node301;
+extern Node node302;
+extern Node node303;
+extern Node node304;
+extern Node node305;
+extern Node node306;
+extern Node node307;
+extern Node node308;
+extern Node node309;
+extern Node node310;
+extern Node node311;
+extern Node node312;
+extern Node node313;
+extern Node node314;
+extern Node node315;
+extern Node node316;
+extern Node node317;
+extern Node node318;
+extern Node node319;
+extern Node node320;
+extern Node node321;
+extern Node node322;
+extern Node node323;
+extern Node node324;
+extern Node node325;
+extern Node node326;
+extern Node node327;
+extern Node node328;
+extern Node node329;
+extern Node node330;
+extern Node node331;
+extern Node node332;
+extern Node node333;
+extern Node node334;
+extern Node node335;
+extern Node node336;
+extern Node node337;
+extern Node node338;
+extern Node node339;
+extern Node node340;
+extern Node node341;
+extern Node node342;
+extern Node node343;
+extern Node node344;
+extern Node node345;
+extern Node node346;
+extern Node node347;
+extern Node node348;
+extern Node node349;
+extern Node node350;
+extern Node node351;
+extern Node node352;
+extern Node node353;
+extern Node node354;
+extern Node node355;
+extern Node node356;
+extern Node node357;
+extern Node node358;
+extern Node node359;
+extern Node node360;
+extern Node node361;
+extern Node node362;
+extern Node node363;
+extern Node node364;
+extern Node node365;
+extern Node node366;
+extern Node node367;
+extern Node node368;
+extern Node node369;
+extern Node node370;
+extern Node node371;
+extern Node node372;
+extern Node node373;
+extern Node node374;
+extern Node node375;
+extern Node node376;
+extern Node node377;
+extern Node node378;
+extern Node node379;
+extern Node node380;
+extern Node node381;
+extern Node node382;
+extern Node node383;
+extern Node node384;
+extern Node node385;
+extern Node node386;
+extern Node node387;
+extern Node node388;
+extern Node node389;
+extern Node node390;
+extern Node node391;
+extern Node node392;
+extern Node node393;
+extern Node node394;
+extern Node node395;
+extern Node node396;
+extern Node node397;
+extern Node node398;
+extern Node node399;
+extern Node node400;
+extern Node node401;
+extern Node node402;
+extern Node node403;
+extern Node node404;
+extern Node node405;
+extern Node node406;
+extern Node node407;
+extern Node node408;
+extern Node node409;
+extern Node node410;
+extern Node node411;
+extern Node node412;
+extern Node node413;
+extern Node node414;
+extern Node node415;
+extern Node node416;
+extern Node node417;
+extern Node node418;
+extern Node node419;
+extern Node node420;
+extern Node node421;
+extern Node node422;
+extern Node node423;
+extern Node node424;
+extern Node node425;
+extern Node node426;
+extern Node node427;
+extern Node node428;
+extern Node node429;
+extern Node node430;
+extern Node node431;
+extern Node node432;
+extern Node node433;
+extern Node node434;
+extern Node node435;
+extern Node node436;
+extern Node node437;
+extern Node node438;
+extern Node node439;
+extern Node node440;
+extern Node node441;
+extern Node node442;
+extern Node node443;
+extern Node node444;
+extern Node node445;
+extern Node node446;
+extern Node node447;
+extern Node node448;
+extern Node node449;
+extern Node node450;
+extern Node node451;
+extern Node node452;
+extern Node node453;
+extern Node node454;
+extern Node node455;
+extern Node node456;
+extern Node node457;
+extern Node node458;
+extern Node node459;
+extern Node node460;
+extern Node node461;
+extern Node node462;
+extern Node node463;
+extern Node node464;
+extern Node node465;
+extern Node node466;
+extern Node node467;
+extern Node node468;
+extern Node node469;
+extern Node node470;
+extern Node node471;
+extern Node node472;
+extern Node node473;
+extern Node node474;
+extern Node node475;
+extern Node node476;
+extern Node node477;
+extern Node node478;
+extern Node node479;
+extern Node node480;
+extern Node node481;
+extern Node node482;
+extern Node node483;
+extern Node node484;
+extern Node node485;
+extern Node node486;
+extern Node node487;
+extern Node node488;
+extern Node node489;
+extern Node node490;
+extern Node node491;
+extern Node node492;
+extern Node node493;
+extern Node node494;
+extern Node node495;
+extern Node node496;
+extern Node node497;
+extern Node node498;
+extern Node node499;
+extern Node node500;
+extern Node node501;
+extern Node node502;
+extern Node node503;
+extern Node node504;
+extern Node node505;
+extern Node node506;
+extern Node node507;
+extern Node node508;
+extern Node node509;
+extern Node node510;
+extern Node node511;
+extern Node node512;
+extern Node node513;
+extern Node node514;
+extern Node node515;
+extern Node node516;
+extern Node node517;
+extern Node node518;
+extern Node node519;
+extern Node node520;
+extern Node node521;
+extern Node node522;
+extern Node node523;
+extern Node node524;
+extern Node node525;
+extern Node node526;
+extern Node node527;
+extern Node node528;
+extern Node node529;
+extern Node node530;
+extern Node node531;
+extern Node node532;
+extern Node node533;
+extern Node node534;
+extern Node node535;
+extern Node node536;
+extern Node node537;
+extern Node node538;
+extern Node node539;
+extern Node node540;
+extern Node node541;
+extern Node node542;
+extern Node node543;
+extern Node node544;
+extern Node node545;
+extern Node node546;
+extern Node node547;
+extern Node node548;
+extern Node node549;
+extern Node node550;
+extern Node node551;
+extern Node node552;
+extern Node node553;
+extern Node node554;
+extern Node node555;
+extern Node node556;
+extern Node node557;
+extern Node node558;
+extern Node node559;
+extern Node node560;
+extern Node node561;
+extern Node node562;
+extern Node node563;
+extern Node node564;
+extern Node node565;
+extern Node node566;
+extern Node node567;
+extern Node node568;
+extern Node node569;
+extern Node node570;
+extern Node node571;
+extern Node node572;
+extern Node node573;
+extern Node node574;
+extern Node node575;
+extern Node node576;
+extern Node node577;
+extern Node node578;
+extern Node node579;
+extern Node node580;
+extern Node node581;
+extern Node node582;
+extern Node node583;
+extern Node node584;
+extern Node node585;
+extern Node node586;
+extern Node node587;
+extern Node node588;
+extern Node node589;
+extern Node node590;
+extern Node node591;
+extern Node node592;
+extern Node node593;
+extern Node node594;
+extern Node node595;
+extern Node node596;
+extern Node node597;
+extern Node node598;
+extern Node node599;
+extern Node node600;
+extern Node node601;
+extern Node node602;
+extern Node node603;
+extern Node node604;
+extern Node node605;
+extern Node node606;
+extern Node node607;
+extern Node node608;
+extern Node node609;
+extern Node node610;
+extern Node node611;
+extern Node node612;
+extern Node node613;
+extern Node node614;
+extern Node node615;
+extern Node node616;
+extern Node node617;
+extern Node node618;
+extern Node node619;
+extern Node node620;
+extern Node node621;
+extern Node node622;
+extern Node node623;
+extern Node node624;
+extern Node node625;
+extern Node node626;
+extern Node node627;
+extern Node node628;
+extern Node node629;
+extern Node node630;
+extern Node node631;
+extern Node node632;
+extern Node node633;
+extern Node node634;
+extern Node node635;
+extern Node node636;
+extern Node node637;
+extern Node node638;
+extern Node node639;
+extern Node node640;
+extern Node node641;
+extern Node node642;
+extern Node node643;
+extern Node node644;
+extern Node node645;
+extern Node node646;
+extern Node node647;
+extern Node node648;
+extern Node node649;
+extern Node node650;
+extern Node node651;
+extern Node node652;
+extern Node node653;
+extern Node node654;
+extern Node node655;
+extern Node node656;
+extern Node node657;
+extern Node node658;
+extern Node node659;
+extern Node node660;
+extern Node node661;
+extern Node node662;
+extern Node node663;
+extern Node node664;
+extern Node node665;
+extern Node node666;
+extern Node node667;
+extern Node node668;
+extern Node node669;
+extern Node node670;
+extern Node node671;
+extern Node node672;
+extern Node node673;
+extern Node node674;
+extern Node node675;
+extern Node node676;
+extern Node node677;
+extern Node node678;
+extern Node node679;
+extern Node node680;
+extern Node node681;
+extern Node node682;
+extern Node node683;
+extern Node node684;
+extern Node node685;
+extern Node node686;
+extern Node node687;
+extern Node node688;
+extern Node node689;
+extern Node node690;
+extern Node node691;
+extern Node node692;
+extern Node node693;
+extern Node node694;
+extern Node node695;
+extern Node node696;
+extern Node node697;
+extern Node node698;
+extern Node node699;
+extern Node node700;
+extern Node node701;
+extern Node node702;
+extern Node node703;
+extern Node node704;
+extern Node node705;
+extern Node node706;
+extern Node node707;
+extern Node node708;
+extern Node node709;
+extern Node node710;
+extern Node node711;
+extern Node node712;
+extern Node node713;
+extern Node node714;
+extern Node node715;
+extern Node node716;
+extern Node node717;
+extern Node node718;
+extern Node node719;
+extern Node node720;
+extern Node node721;
+extern Node node722;
+extern Node node723;
+extern Node node724;
+extern Node node725;
+extern Node node726;
+extern Node node727;
+extern Node node728;
+extern Node node729;
+extern Node node730;
+extern Node node731;
+extern Node node732;
+extern Node node733;
+extern Node node734;
+extern Node node735;
+extern Node node736;
+extern Node node737;
+extern Node node738;
+extern Node node739;
+extern Node node740;
+extern Node node741;
+extern Node node742;
+extern Node node743;
+extern Node node744;
+extern Node node745;
+extern Node node746;
+extern Node node747;
+extern Node node748;
+extern Node node749;
+extern Node node750;
+extern Node node751;
+extern Node node752;
+extern Node node753;
+extern Node node754;
+extern Node node755;
+extern Node node756;
+extern Node node757;
+extern Node node758;
+extern Node node759;
+extern Node node760;
+extern Node node761;
+extern Node node762;
+extern Node node763;
+extern Node node764;
+extern Node node765;
+extern Node node766;
+extern Node node767;
+extern Node node768;
+extern Node node769;
+extern Node node770;
+extern Node node771;
+extern Node node772;
+extern Node node773;
+extern Node node774;
+extern Node node775;
+extern Node node776;
+extern Node node777;
+extern Node node778;
+extern Node node779;
+extern Node node780;
+extern Node node781;
+extern Node node782;
+extern Node node783;
+extern Node node784;
+extern Node node785;
+extern Node node786;
+extern Node node787;
+extern Node node788;
+extern Node node789;
+extern Node node790;
+extern Node node791;
+extern Node node792;
+extern Node node793;
+extern Node node794;
+extern Node node795;
+extern Node node796;
+extern Node node797;
+extern Node node798;
+extern Node node799;
+extern Node node800;
+extern Node node801;
+extern Node node802;
+extern Node node803;
+extern Node node804;
+extern Node node805;
+extern Node node806;
+extern Node node807;
+extern Node node808;
+extern Node node809;
+extern Node node810;
+extern Node node811;
+extern Node node812;
+extern Node node813;
+extern Node node814;
+extern Node node815;
+extern Node node816;
+extern Node node817;
+extern Node node818;
+extern Node node819;
+extern Node node820;
+extern Node node821;
+extern Node node822;
+extern Node node823;
+extern Node node824;
+extern Node node825;
+extern Node node826;
+extern Node node827;
+extern Node node828;
+extern Node node829;
+extern Node node830;
+extern Node node831;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 37 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if ((k >= 10) && (k <= 19)) { return &node4; }
+    if (k == 20) { return &node5; }
+    if ((k >= 21) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node6; }
+    if (k == 11) { return &node7; }
+    if (k == 12) { return &node8; }
+    if (k == 13) { return &node9; }
+    if (k == 14) { return &node10; }
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node801; }
+    if (k == 11) { return &node802; }
+    if (k == 12) { return &node803; }
+    if (k == 13) { return &node804; }
+    if (k == 14) { return &node805; }
+    if (k == 15) { return &node806; }
+    if (k == 16) { return &node807; }
+    if (k == 17) { return &node808; }
+    if (k == 18) { return &node809; }
+    if (k == 19) { return &node810; }
+    if (k == 20) { return &node811; }
+    if (k == 21) { return &node812; }
+    if (k == 22) { return &node813; }
+    if (k == 23) { return &node814; }
+    if (k == 24) { return &node815; }
+    if (k == 25) { return &node816; }
+    if (k == 26) { return &node817; }
+    if (k == 27) { return &node818; }
+    if (k == 28) { return &node819; }
+    if (k == 29) { return &node820; }
+    if (k == 30) { return &node821; }
+    if (k == 31) { return &node822; }
+    if (k == 32) { return &node823; }
+    if (k == 33) { return &node824; }
+    if (k == 34) { return &node825; }
+    if (k == 35) { return &node826; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node770; }
+    if (k == 11) { return &node771; }
+    if (k == 12) { return &node772; }
+    if (k == 13) { return &node773; }
+    if (k == 14) { return &node774; }
+    if (k == 15) { return &node775; }
+    if (k == 16) { return &node776; }
+    if (k == 17) { return &node777; }
+    if (k == 18) { return &node778; }
+    if (k == 19) { return &node779; }
+    if (k == 20) { return &node780; }
+    if (k == 21) { return &node781; }
+    if (k == 22) { return &node782; }
+    if (k == 23) { return &node783; }
+    if (k == 24) { return &node784; }
+    if (k == 25) { return &node785; }
+    if (k == 26) { return &node786; }
+    if (k == 27) { return &node787; }
+    if (k == 28) { return &node788; }
+    if (k == 29) { return &node789; }
+    if (k == 30) { return &node790; }
+    if (k == 31) { return &node791; }
+    if (k == 32) { return &node792; }
+    if (k == 33) { return &node793; }
+    if (k == 34) { return &node794; }
+    if (k == 35) { return &node795; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node739; }
+    if (k == 11) { return &node740; }
+    if (k == 12) { return &node741; }
+    if (k == 13) { return &node742; }
+    if (k == 14) { return &node743; }
+    if (k == 15) { return &node744; }
+    if (k == 16) { return &node745; }
+    if (k == 17) { return &node746; }
+    if (k == 18) { return &node747; }
+    if (k == 19) { return &node748; }
+    if (k == 20) { return &node749; }
+    if (k == 21) { return &node750; }
+    if (k == 22) { return &node751; }
+    if (k == 23) { return &node752; }
+    if (k == 24) { return &node753; }
+    if (k == 25) { return &node754; }
+    if (k == 26) { return &node755; }
+    if (k == 27) { return &node756; }
+    if (k == 28) { return &node757; }
+    if (k == 29) { return &node758; }
+    if (k == 30) { return &node759; }
+    if (k == 31) { return &node760; }
+    if (k == 32) { return &node761; }
+    if (k == 33) { return &node762; }
+    if (k == 34) { return &node763; }
+    if (k == 35) { return &node764; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node708; }
+    if (k == 11) { return &node709; }
+    if (k == 12) { return &node710; }
+    if (k == 13) { return &node711; }
+    if (k == 14) { return &node712; }
+    if (k == 15) { return &node713; }
+    if (k == 16) { return &node714; }
+    if (k == 17) { return &node715; }
+    if (k == 18) { return &node716; }
+    if (k == 19) { return &node717; }
+    if (k == 20) { return &node718; }
+    if (k == 21) { return &node719; }
+    if (k == 22) { return &node720; }
+    if (k == 23) { return &node721; }
+    if (k == 24) { return &node722; }
+    if (k == 25) { return &node723; }
+    if (k == 26) { return &node724; }
+    if (k == 27) { return &node725; }
+    if (k == 28) { return &node726; }
+    if (k == 29) { return &node727; }
+    if (k == 30) { return &node728; }
+    if (k == 31) { return &node729; }
+    if (k == 32) { return &node730; }
+    if (k == 33) { return &node731; }
+    if (k == 34) { return &node732; }
+    if (k == 35) { return &node733; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node677; }
+    if (k == 11) { return &node678; }
+    if (k == 12) { return &node679; }
+    if (k == 13) { return &node680; }
+    if (k == 14) { return &node681; }
+    if (k == 15) { return &node682; }
+    if (k == 16) { return &node683; }
+    if (k == 17) { return &node684; }
+    if (k == 18) { return &node685; }
+    if (k == 19) { return &node686; }
+    if (k == 20) { return &node687; }
+    if (k == 21) { return &node688; }
+    if (k == 22) { return &node689; }
+    if (k == 23) { return &node690; }
+    if (k == 24) { return &node691; }
+    if (k == 25) { return &node692; }
+    if (k == 26) { return &node693; }
+    if (k == 27) { return &node694; }
+    if (k == 28) { return &node695; }
+    if (k == 29) { return &node696; }
+    if (k == 30) { return &node697; }
+    if (k == 31) { return &node698; }
+    if (k == 32) { return &node699; }
+    if (k == 33) { return &node700; }
+    if (k == 34) { return &node701; }
+    if (k == 35) { return &node702; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node646; }
+    if (k == 11) { return &node647; }
+    if (k == 12) { return &node648; }
+    if (k == 13) { return &node649; }
+    if (k == 14) { return &node650; }
+    if (k == 15) { return &node651; }
+    if (k == 16) { return &node652; }
+    if (k == 17) { return &node653; }
+    if (k == 18) { return &node654; }
+    if (k == 19) { return &node655; }
+    if (k == 20) { return &node656; }
+    if (k == 21) { return &node657; }
+    if (k == 22) { return &node658; }
+    if (k == 23) { return &node659; }
+    if (k == 24) { return &node660; }
+    if (k == 25) { return &node661; }
+    if (k == 26) { return &node662; }
+    if (k == 27) { return &node663; }
+    if (k == 28) { return &node664; }
+    if (k == 29) { return &node665; }
+    if (k == 30) { return &node666; }
+    if (k == 31) { return &node667; }
+    if (k == 32) { return &node668; }
+    if (k == 33) { return &node669; }
+    if (k == 34) { return &node670; }
+    if (k == 35) { return &node671; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node615; }
+    if (k == 11) { return &node616; }
+    if (k == 12) { return &node617; }
+    if (k == 13) { return &node618; }
+    if (k == 14) { return &node619; }
+    if (k == 15) { return &node620; }
+    if (k == 16) { return &node621; }
+    if (k == 17) { return &node622; }
+    if (k == 18) { return &node623; }
+    if (k == 19) { return &node624; }
+    if (k == 20) { return &node625; }
+    if (k == 21) { return &node626; }
+    if (k == 22) { return &node627; }
+    if (k == 23) { return &node628; }
+    if (k == 24) { return &node629; }
+    if (k == 25) { return &node630; }
+    if (k == 26) { return &node631; }
+    if (k == 27) { return &node632; }
+    if (k == 28) { return &node633; }
+    if (k == 29) { return &node634; }
+    if (k == 30) { return &node635; }
+    if (k == 31) { return &node636; }
+    if (k == 32) { return &node637; }
+    if (k == 33) { return &node638; }
+    if (k == 34) { return &node639; }
+    if (k == 35) { return &node640; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node584; }
+    if (k == 11) { return &node585; }
+    if (k == 12) { return &node586; }
+    if (k == 13) { return &node587; }
+    if (k == 14) { return &node588; }
+    if (k == 15) { return &node589; }
+    if (k == 16) { return &node590; }
+    if (k == 17) { return &node591; }
+    if (k == 18) { return &node592; }
+    if (k == 19) { return &node593; }
+    if (k == 20) { return &node594; }
+    if (k == 21) { return &node595; }
+    if (k == 22) { return &node596; }
+    if (k == 23) { return &node597; }
+    if (k == 24) { return &node598; }
+    if (k == 25) { return &node599; }
+    if (k == 26) { return &node600; }
+    if (k == 27) { return &node601; }
+    if (k == 28) { return &node602; }
+    if (k == 29) { return &node603; }
+    if (k == 30) { return &node604; }
+    if (k == 31) { return &node605; }
+    if (k == 32) { return &node606; }
+    if (k == 33) { return &node607; }
+    if (k == 34) { return &node608; }
+    if (k == 35) { return &node609; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node553; }
+    if (k == 11) { return &node554; }
+    if (k == 12) { return &node555; }
+    if (k == 13) { return &node556; }
+    if (k == 14) { return &node557; }
+    if (k == 15) { return &node558; }
+    if (k == 16) { return &node559; }
+    if (k == 17) { return &node560; }
+    if (k == 18) { return &node561; }
+    if (k == 19) { return &node562; }
+    if (k == 20) { return &node563; }
+    if (k == 21) { return &node564; }
+    if (k == 22) { return &node565; }
+    if (k == 23) { return &node566; }
+    if (k == 24) { return &node567; }
+    if (k == 25) { return &node568; }
+    if (k == 26) { return &node569; }
+    if (k == 27) { return &node570; }
+    if (k == 28) { return &node571; }
+    if (k == 29) { return &node572; }
+    if (k == 30) { return &node573; }
+    if (k == 31) { return &node574; }
+    if (k == 32) { return &node575; }
+    if (k == 33) { return &node576; }
+    if (k == 34) { return &node577; }
+    if (k == 35) { return &node578; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node522; }
+    if (k == 11) { return &node523; }
+    if (k == 12) { return &node524; }
+    if (k == 13) { return &node525; }
+    if (k == 14) { return &node526; }
+    if (k == 15) { return &node527; }
+    if (k == 16) { return &node528; }
+    if (k == 17) { return &node529; }
+    if (k == 18) { return &node530; }
+    if (k == 19) { return &node531; }
+    if (k == 20) { return &node532; }
+    if (k == 21) { return &node533; }
+    if (k == 22) { return &node534; }
+    if (k == 23) { return &node535; }
+    if (k == 24) { return &node536; }
+    if (k == 25) { return &node537; }
+    if (k == 26) { return &node538; }
+    if (k == 27) { return &node539; }
+    if (k == 28) { return &node540; }
+    if (k == 29) { return &node541; }
+    if (k == 30) { return &node542; }
+    if (k == 31) { return &node543; }
+    if (k == 32) { return &node544; }
+    if (k == 33) { return &node545; }
+    if (k == 34) { return &node546; }
+    if (k == 35) { return &node547; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node491; }
+    if (k == 11) { return &node492; }
+    if (k == 12) { return &node493; }
+    if (k == 13) { return &node494; }
+    if (k == 14) { return &node495; }
+    if (k == 15) { return &node496; }
+    if (k == 16) { return &node497; }
+    if (k == 17) { return &node498; }
+    if (k == 18) { return &node499; }
+    if (k == 19) { return &node500; }
+    if (k == 20) { return &node501; }
+    if (k == 21) { return &node502; }
+    if (k == 22) { return &node503; }
+    if (k == 23) { return &node504; }
+    if (k == 24) { return &node505; }
+    if (k == 25) { return &node506; }
+    if (k == 26) { return &node507; }
+    if (k == 27) { return &node508; }
+    if (k == 28) { return &node509; }
+    if (k == 29) { return &node510; }
+    if (k == 30) { return &node511; }
+    if (k == 31) { return &node512; }
+    if (k == 32) { return &node513; }
+    if (k == 33) { return &node514; }
+    if (k == 34) { return &node515; }
+    if (k == 35) { return &node516; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node460; }
+    if (k == 11) { return &node461; }
+    if (k == 12) { return &node462; }
+    if (k == 13) { return &node463; }
+    if (k == 14) { return &node464; }
+    if (k == 15) { return &node465; }
+    if (k == 16) { return &node466; }
+    if (k == 17) { return &node467; }
+    if (k == 18) { return &node468; }
+    if (k == 19) { return &node469; }
+    if (k == 20) { return &node470; }
+    if (k == 21) { return &node471; }
+    if (k == 22) { return &node472; }
+    if (k == 23) { return &node473; }
+    if (k == 24) { return &node474; }
+    if (k == 25) { return &node475; }
+    if (k == 26) { return &node476; }
+    if (k == 27) { return &node477; }
+    if (k == 28) { return &node478; }
+    if (k == 29) { return &node479; }
+    if (k == 30) { return &node480; }
+    if (k == 31) { return &node481; }
+    if (k == 32) { return &node482; }
+    if (k == 33) { return &node483; }
+    if (k == 34) { return &node484; }
+    if (k == 35) { return &node485; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node429; }
+    if (k == 11) { return &node430; }
+    if (k == 12) { return &node431; }
+    if (k == 13) { return &node432; }
+    if (k == 14) { return &node433; }
+    if (k == 15) { return &node434; }
+    if (k == 16) { return &node435; }
+    if (k == 17) { return &node436; }
+    if (k == 18) { return &node437; }
+    if (k == 19) { return &node438; }
+    if (k == 20) { return &node439; }
+    if (k == 21) { return &node440; }
+    if (k == 22) { return &node441; }
+    if (k == 23) { return &node442; }
+    if (k == 24) { return &node443; }
+    if (k == 25) { return &node444; }
+    if (k == 26) { return &node445; }
+    if (k == 27) { return &node446; }
+    if (k == 28) { return &node447; }
+    if (k == 29) { return &node448; }
+    if (k == 30) { return &node449; }
+    if (k == 31) { return &node450; }
+    if (k == 32) { return &node451; }
+    if (k == 33) { return &node452; }
+    if (k == 34) { return &node453; }
+    if (k == 35) { return &node454; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node398; }
+    if (k == 11) { return &node399; }
+    if (k == 12) { return &node400; }
+    if (k == 13) { return &node401; }
+    if (k == 14) { return &node402; }
+    if (k == 15) { return &node403; }
+    if (k == 16) { return &node404; }
+    if (k == 17) { return &node405; }
+    if (k == 18) { return &node406; }
+    if (k == 19) { return &node407; }
+    if (k == 20) { return &node408; }
+    if (k == 21) { return &node409; }
+    if (k == 22) { return &node410; }
+    if (k == 23) { return &node411; }
+    if (k == 24) { return &node412; }
+    if (k == 25) { return &node413; }
+    if (k == 26) { return &node414; }
+    if (k == 27) { return &node415; }
+    if (k == 28) { return &node416; }
+    if (k == 29) { return &node417; }
+    if (k == 30) { return &node418; }
+    if (k == 31) { return &node419; }
+    if (k == 32) { return &node420; }
+    if (k == 33) { return &node421; }
+    if (k == 34) { return &node422; }
+    if (k == 35) { return &node423; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node367; }
+    if (k == 11) { return &node368; }
+    if (k == 12) { return &node369; }
+    if (k == 13) { return &node370; }
+    if (k == 14) { return &node371; }
+    if (k == 15) { return &node372; }
+    if (k == 16) { return &node373; }
+    if (k == 17) { return &node374; }
+    if (k == 18) { return &node375; }
+    if (k == 19) { return &node376; }
+    if (k == 20) { return &node377; }
+    if (k == 21) { return &node378; }
+    if (k == 22) { return &node379; }
+    if (k == 23) { return &node380; }
+    if (k == 24) { return &node381; }
+    if (k == 25) { return &node382; }
+    if (k == 26) { return &node383; }
+    if (k == 27) { return &node384; }
+    if (k == 28) { return &node385; }
+    if (k == 29) { return &node386; }
+    if (k == 30) { return &node387; }
+    if (k == 31) { return &node388; }
+    if (k == 32) { return &node389; }
+    if (k == 33) { return &node390; }
+    if (k == 34) { return &node391; }
+    if (k == 35) { return &node392; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node336; }
+    if (k == 11) { return &node337; }
+    if (k == 12) { return &node338; }
+    if (k == 13) { return &node339; }
+    if (k == 14) { return &node340; }
+    if (k == 15) { return &node341; }
+    if (k == 16) { return &node342; }
+    if (k == 17) { return &node343; }
+    if (k == 18) { return &node344; }
+    if (k == 19) { return &node345; }
+    if (k == 20) { return &node346; }
+    if (k == 21) { return &node347; }
+    if (k == 22) { return &node348; }
+    if (k == 23) { return &node349; }
+    if (k == 24) { return &node350; }
+    if (k == 25) { return &node351; }
+    if (k == 26) { return &node352; }
+    if (k == 27) { return &node353; }
+    if (k == 28) { return &node354; }
+    if (k == 29) { return &node355; }
+    if (k == 30) { return &node356; }
+    if (k == 31) { return &node357; }
+    if (k == 32) { return &node358; }
+    if (k == 33) { return &node359; }
+    if (k == 34) { return &node360; }
+    if (k == 35) { return &node361; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node305; }
+    if (k == 11) { return &node306; }
+    if (k == 12) { return &node307; }
+    if (k == 13) { return &node308; }
+    if (k == 14) { return &node309; }
+    if (k == 15) { return &node310; }
+    if (k == 16) { return &node311; }
+    if (k == 17) { return &node312; }
+    if (k == 18) { return &node313; }
+    if (k == 19) { return &node314; }
+    if (k == 20) { return &node315; }
+    if (k == 21) { return &node316; }
+    if (k == 22) { return &node317; }
+    if (k == 23) { return &node318; }
+    if (k == 24) { return &node319; }
+    if (k == 25) { return &node320; }
+    if (k == 26) { return &node321; }
+    if (k == 27) { return &node322; }
+    if (k == 28) { return &node323; }
+    if (k == 29) { return &node324; }
+    if (k == 30) { return &node325; }
+    if (k == 31) { return &node326; }
+    if (k == 32) { return &node327; }
+    if (k == 33) { return &node328; }
+    if (k == 34) { return &node329; }
+    if (k == 35) { return &node330; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node274; }
+    if (k == 11) { return &node275; }
+    if (k == 12) { return &node276; }
+    if (k == 13) { return &node277; }
+    if (k == 14) { return &node278; }
+    if (k == 15) { return &node279; }
+    if (k == 16) { return &node280; }
+    if (k == 17) { return &node281; }
+    if (k == 18) { return &node282; }
+    if (k == 19) { return &node283; }
+    if (k == 20) { return &node284; }
+    if (k == 21) { return &node285; }
+    if (k == 22) { return &node286; }
+    if (k == 23) { return &node287; }
+    if (k == 24) { return &node288; }
+    if (k == 25) { return &node289; }
+    if (k == 26) { return &node290; }
+    if (k == 27) { return &node291; }
+    if (k == 28) { return &node292; }
+    if (k == 29) { return &node293; }
+    if (k == 30) { return &node294; }
+    if (k == 31) { return &node295; }
+    if (k == 32) { return &node296; }
+    if (k == 33) { return &node297; }
+    if (k == 34) { return &node298; }
+    if (k == 35) { return &node299; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node243; }
+    if (k == 11) { return &node244; }
+    if (k == 12) { return &node245; }
+    if (k == 13) { return &node246; }
+    if (k == 14) { return &node247; }
+    if (k == 15) { return &node248; }
+    if (k == 16) { return &node249; }
+    if (k == 17) { return &node250; }
+    if (k == 18) { return &node251; }
+    if (k == 19) { return &node252; }
+    if (k == 20) { return &node253; }
+    if (k == 21) { return &node254; }
+    if (k == 22) { return &node255; }
+    if (k == 23) { return &node256; }
+    if (k == 24) { return &node257; }
+    if (k == 25) { return &node258; }
+    if (k == 26) { return &node259; }
+    if (k == 27) { return &node260; }
+    if (k == 28) { return &node261; }
+    if (k == 29) { return &node262; }
+    if (k == 30) { return &node263; }
+    if (k == 31) { return &node264; }
+    if (k == 32) { return &node265; }
+    if (k == 33) { return &node266; }
+    if (k == 34) { return &node267; }
+    if (k == 35) { return &node268; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node212; }
+    if (k == 11) { return &node213; }
+    if (k == 12) { return &node214; }
+    if (k == 13) { return &node215; }
+    if (k == 14) { return &node216; }
+    if (k == 15) { return &node217; }
+    if (k == 16) { return &node218; }
+    if (k == 17) { return &node219; }
+    if (k == 18) { return &node220; }
+    if (k == 19) { return &node221; }
+    if (k == 20) { return &node222; }
+    if (k == 21) { return &node223; }
+    if (k == 22) { return &node224; }
+    if (k == 23) { return &node225; }
+    if (k == 24) { return &node226; }
+    if (k == 25) { return &node227; }
+    if (k == 26) { return &node228; }
+    if (k == 27) { return &node229; }
+    if (k == 28) { return &node230; }
+    if (k == 29) { return &node231; }
+    if (k == 30) { return &node232; }
+    if (k == 31) { return &node233; }
+    if (k == 32) { return &node234; }
+    if (k == 33) { return &node235; }
+    if (k == 34) { return &node236; }
+    if (k == 35) { return &node237; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node182; }
+    if (k == 11) { return &node183; }
+    if (k == 12) { return &node184; }
+    if (k == 13) { return &node185; }
+    if (k == 14) { return &node186; }
+    if (k == 15) { return &node187; }
+    if (k == 16) { return &node188; }
+    if (k == 17) { return &node189; }
+    if (k == 18) { return &node190; }
+    if (k == 19) { return &node191; }
+    if (k == 20) { return &node192; }
+    if (k == 21) { return &node193; }
+    if (k == 22) { return &node194; }
+    if (k == 23) { return &node195; }
+    if (k == 24) { return &node196; }
+    if (k == 25) { return &node197; }
+    if (k == 26) { return &node198; }
+    if (k == 27) { return &node199; }
+    if (k == 28) { return &node200; }
+    if (k == 29) { return &node201; }
+    if (k == 30) { return &node202; }
+    if (k == 31) { return &node203; }
+    if (k == 32) { return &node204; }
+    if (k == 33) { return &node205; }
+    if (k == 34) { return &node206; }
+    if (k == 35) { return &node207; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node152; }
+    if (k == 11) { return &node153; }
+    if (k == 12) { return &node154; }
+    if (k == 13) { return &node155; }
+    if (k == 14) { return &node156; }
+    if (k == 15) { return &node157; }
+    if (k == 16) { return &node158; }
+    if (k == 17) { return &node159; }
+    if (k == 18) { return &node160; }
+    if (k == 19) { return &node161; }
+    if (k == 20) { return &node162; }
+    if (k == 21) { return &node163; }
+    if (k == 22) { return &node164; }
+    if (k == 23) { return &node165; }
+    if (k == 24) { return &node166; }
+    if (k == 25) { return &node167; }
+    if (k == 26) { return &node168; }
+    if (k == 27) { return &node169; }
+    if (k == 28) { return &node170; }
+    if (k == 29) { return &node171; }
+    if (k == 30) { return &node172; }
+    if (k == 31) { return &node173; }
+    if (k == 32) { return &node174; }
+    if (k == 33) { return &node175; }
+    if (k == 34) { return &node176; }
+    if (k == 35) { return &node177; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node122; }
+    if (k == 11) { return &node123; }
+    if (k == 12) { return &node124; }
+    if (k == 13) { return &node125; }
+    if (k == 14) { return &node126; }
+    if (k == 15) { return &node127; }
+    if (k == 16) { return &node128; }
+    if (k == 17) { return &node129; }
+    if (k == 18) { return &node130; }
+    if (k == 19) { return &node131; }
+    if (k == 20) { return &node132; }
+    if (k == 21) { return &node133; }
+    if (k == 22) { return &node134; }
+    if (k == 23) { return &node135; }
+    if (k == 24) { return &node136; }
+    if (k == 25) { return &node137; }
+    if (k == 26) { return &node138; }
+    if (k == 27) { return &node139; }
+    if (k == 28) { return &node140; }
+    if (k == 29) { return &node141; }
+    if (k == 30) { return &node142; }
+    if (k == 31) { return &node143; }
+    if (k == 32) { return &node144; }
+    if (k == 33) { return &node145; }
+    if (k == 34) { return &node146; }
+    if (k == 35) { return &node147; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node92; }
+    if (k == 11) { return &node93; }
+    if (k == 12) { return &node94; }
+    if (k == 13) { return &node95; }
+    if (k == 14) { return &node96; }
+    if (k == 15) { return &node97; }
+    if (k == 16) { return &node98; }
+    if (k == 17) { return &node99; }
+    if (k == 18) { return &node100; }
+    if (k == 19) { return &node101; }
+    if (k == 20) { return &node102; }
+    if (k == 21) { return &node103; }
+    if (k == 22) { return &node104; }
+    if (k == 23) { return &node105; }
+    if (k == 24) { return &node106; }
+    if (k == 25) { return &node107; }
+    if (k == 26) { return &node108; }
+    if (k == 27) { return &node109; }
+    if (k == 28) { return &node110; }
+    if (k == 29) { return &node111; }
+    if (k == 30) { return &node112; }
+    if (k == 31) { return &node113; }
+    if (k == 32) { return &node114; }
+    if (k == 33) { return &node115; }
+    if (k == 34) { return &node116; }
+    if (k == 35) { return &node117; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node62; }
+    if (k == 11) { return &node63; }
+    if (k == 12) { return &node64; }
+    if (k == 13) { return &node65; }
+    if (k == 14) { return &node66; }
+    if (k == 15) { return &node67; }
+    if (k == 16) { return &node68; }
+    if (k == 17) { return &node69; }
+    if (k == 18) { return &node70; }
+    if (k == 19) { return &node71; }
+    if (k == 20) { return &node72; }
+    if (k == 21) { return &node73; }
+    if (k == 22) { return &node74; }
+    if (k == 23) { return &node75; }
+    if (k == 24) { return &node76; }
+    if (k == 25) { return &node77; }
+    if (k == 26) { return &node78; }
+    if (k == 27) { return &node79; }
+    if (k == 28) { return &node80; }
+    if (k == 29) { return &node81; }
+    if (k == 30) { return &node82; }
+    if (k == 31) { return &node83; }
+    if (k == 32) { return &node84; }
+    if (k == 33) { return &node85; }
+    if (k == 34) { return &node86; }
+    if (k == 35) { return &node87; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node32; }
+    if (k == 11) { return &node33; }
+    if (k == 12) { return &node34; }
+    if (k == 13) { return &node35; }
+    if (k == 14) { return &node36; }
+    if (k == 15) { return &node37; }
+    if (k == 16) { return &node38; }
+    if (k == 17) { return &node39; }
+    if (k == 18) { return &node40; }
+    if (k == 19) { return &node41; }
+    if (k == 20) { return &node42; }
+    if (k == 21) { return &node43; }
+    if (k == 22) { return &node44; }
+    if (k == 23) { return &node45; }
+    if (k == 24) { return &node46; }
+    if (k == 25) { return &node47; }
+    if (k == 26) { return &node48; }
+    if (k == 27) { return &node49; }
+    if (k == 28) { return &node50; }
+    if (k == 29) { return &node51; }
+    if (k == 30) { return &node52; }
+    if (k == 31) { return &node53; }
+    if (k == 32) { return &node54; }
+    if (k == 33) { return &node55; }
+    if (k == 34) { return &node56; }
+    if (k == 35) { return &node57; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node61; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node60; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node59; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node58; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next62(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node91; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next63(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node90; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next64(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node89; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next65(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node88; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next66(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next67(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next68(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next69(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next70(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next71(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next72(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next73(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next74(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next75(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next76(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next77(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next78(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next79(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next80(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next81(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next82(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next83(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next84(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next85(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next86(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next87(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next88(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next89(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next90(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next91(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next92(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node121; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next93(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node120; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next94(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node119; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next95(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node118; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next96(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next97(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next98(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next99(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next100(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next101(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next102(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next103(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next104(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next105(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next106(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next107(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next108(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next109(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next110(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next111(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next112(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next113(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next114(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next115(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next116(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next117(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next118(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next119(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next120(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next121(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next122(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node151; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next123(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node150; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next124(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node149; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next125(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node148; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next126(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next127(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next128(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next129(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next130(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next131(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next132(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next133(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next134(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next135(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next136(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next137(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next138(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next139(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next140(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next141(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next142(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next143(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next144(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next145(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next146(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next147(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next148(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next149(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next150(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next151(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next152(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node181; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next153(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node180; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next154(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node179; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next155(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node178; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next156(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next157(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next158(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next159(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next160(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next161(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next162(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next163(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next164(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next165(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next166(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next167(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next168(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next169(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next170(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next171(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next172(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next173(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next174(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next175(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next176(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next177(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next178(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next179(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next180(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next181(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next182(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node211; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next183(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node210; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next184(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node209; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next185(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node208; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next186(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next187(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next188(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next189(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next190(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next191(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next192(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next193(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next194(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next195(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next196(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next197(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next198(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next199(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next200(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next201(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next202(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next203(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next204(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next205(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next206(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next207(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next208(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next209(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next210(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next211(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next212(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node242; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next213(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node241; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next214(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node240; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next215(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node239; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next216(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node238; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next217(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next218(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next219(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next220(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next221(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next222(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next223(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next224(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next225(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next226(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next227(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next228(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next229(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next230(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next231(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next232(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next233(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next234(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next235(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next236(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next237(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next238(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next239(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next240(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next241(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next242(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next243(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node273; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next244(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node272; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next245(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node271; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next246(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node270; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next247(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node269; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next248(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next249(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next250(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next251(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next252(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next253(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next254(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next255(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next256(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next257(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next258(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next259(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next260(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next261(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next262(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next263(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next264(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next265(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next266(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next267(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next268(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next269(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next270(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next271(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next272(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next273(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next274(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node304; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next275(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node303; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next276(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node302; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next277(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node301; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next278(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node300; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next279(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next280(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next281(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next282(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next283(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next284(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next285(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next286(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next287(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next288(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next289(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next290(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next291(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next292(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next293(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next294(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next295(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next296(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next297(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next298(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next299(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next300(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next301(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next302(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next303(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next304(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next305(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node335; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next306(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node334; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next307(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node333; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next308(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node332; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next309(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node331; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next310(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next311(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next312(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next313(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next314(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next315(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next316(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next317(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next318(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next319(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next320(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next321(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next322(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next323(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next324(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next325(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next326(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next327(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next328(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next329(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next330(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next331(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next332(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next333(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next334(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next335(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next336(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node366; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next337(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node365; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next338(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node364; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next339(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node363; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next340(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node362; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next341(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next342(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next343(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next344(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next345(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next346(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next347(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next348(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next349(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next350(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next351(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next352(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next353(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next354(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next355(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next356(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next357(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next358(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next359(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next360(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next361(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next362(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next363(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next364(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next365(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next366(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next367(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node397; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next368(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node396; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next369(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node395; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next370(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node394; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next371(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node393; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next372(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next373(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next374(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next375(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next376(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next377(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next378(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next379(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next380(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next381(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next382(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next383(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next384(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next385(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next386(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next387(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next388(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next389(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next390(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next391(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next392(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next393(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next394(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next395(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next396(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next397(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next398(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node428; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next399(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node427; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next400(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node426; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next401(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node425; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next402(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node424; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next403(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next404(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next405(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next406(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next407(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next408(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next409(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next410(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next411(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next412(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next413(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next414(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next415(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next416(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next417(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next418(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next419(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next420(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next421(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next422(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next423(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next424(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next425(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next426(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next427(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next428(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next429(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node459; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next430(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node458; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next431(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node457; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next432(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node456; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next433(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node455; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next434(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next435(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next436(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next437(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next438(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next439(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next440(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next441(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next442(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next443(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next444(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next445(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next446(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next447(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next448(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next449(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next450(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next451(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next452(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next453(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next454(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next455(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next456(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next457(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next458(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next459(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next460(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node490; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next461(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node489; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next462(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node488; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next463(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node487; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next464(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node486; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next465(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next466(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next467(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next468(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next469(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next470(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next471(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next472(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next473(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next474(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next475(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next476(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next477(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next478(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next479(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next480(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next481(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next482(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next483(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next484(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next485(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next486(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next487(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next488(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next489(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next490(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next491(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node521; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next492(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node520; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next493(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node519; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next494(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node518; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next495(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node517; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next496(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next497(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next498(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next499(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next500(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next501(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next502(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next503(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next504(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next505(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next506(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next507(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next508(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next509(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next510(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next511(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next512(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next513(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next514(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next515(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next516(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next517(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next518(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next519(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next520(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next521(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next522(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node552; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next523(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node551; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next524(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node550; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next525(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node549; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next526(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node548; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next527(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next528(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next529(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next530(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next531(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next532(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next533(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next534(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next535(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next536(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next537(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next538(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next539(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next540(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next541(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next542(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next543(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next544(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next545(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next546(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next547(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next548(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next549(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next550(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next551(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next552(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next553(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node583; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next554(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node582; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next555(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node581; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next556(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node580; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next557(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node579; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next558(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next559(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next560(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next561(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next562(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next563(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next564(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next565(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next566(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next567(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next568(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next569(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next570(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next571(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next572(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next573(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next574(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next575(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next576(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next577(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next578(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next579(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next580(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next581(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next582(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next583(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next584(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node614; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next585(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node613; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next586(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node612; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next587(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node611; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next588(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node610; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next589(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next590(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next591(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next592(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next593(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next594(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next595(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next596(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next597(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next598(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next599(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next600(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next601(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next602(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next603(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next604(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next605(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next606(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next607(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next608(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next609(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next610(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next611(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next612(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next613(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next614(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next615(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node645; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next616(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node644; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next617(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node643; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next618(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node642; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next619(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node641; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next620(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next621(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next622(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next623(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next624(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next625(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next626(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next627(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next628(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next629(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next630(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next631(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next632(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next633(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next634(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next635(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next636(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next637(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next638(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next639(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next640(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next641(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next642(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next643(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next644(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next645(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next646(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node676; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next647(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node675; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next648(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node674; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next649(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node673; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next650(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node672; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next651(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next652(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next653(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next654(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next655(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next656(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next657(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next658(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next659(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next660(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next661(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next662(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next663(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next664(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next665(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next666(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next667(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next668(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next669(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next670(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next671(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next672(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next673(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next674(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next675(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next676(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next677(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node707; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next678(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node706; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next679(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node705; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next680(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node704; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next681(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node703; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next682(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next683(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next684(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next685(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next686(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next687(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next688(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next689(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next690(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next691(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next692(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next693(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next694(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next695(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next696(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next697(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next698(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next699(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next700(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next701(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next702(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next703(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next704(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next705(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next706(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next707(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next708(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node738; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next709(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node737; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next710(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node736; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next711(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node735; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next712(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node734; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next713(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next714(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next715(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next716(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next717(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next718(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next719(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next720(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next721(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next722(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next723(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next724(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next725(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next726(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next727(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next728(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next729(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next730(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next731(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next732(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next733(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next734(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next735(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next736(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next737(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next738(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next739(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node769; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next740(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node768; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next741(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node767; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next742(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node766; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next743(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node765; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next744(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next745(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next746(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next747(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next748(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next749(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next750(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next751(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next752(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next753(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next754(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next755(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next756(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next757(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next758(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next759(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next760(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next761(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next762(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next763(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next764(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next765(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next766(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next767(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next768(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next769(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next770(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node800; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next771(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node799; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next772(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node798; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next773(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node797; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next774(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node796; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next775(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next776(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next777(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next778(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next779(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next780(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next781(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next782(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next783(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next784(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next785(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next786(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next787(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next788(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next789(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next790(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next791(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next792(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next793(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next794(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next795(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next796(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next797(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next798(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next799(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next800(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next801(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node831; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next802(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node830; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next803(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node829; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next804(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node828; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next805(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if (k == 10) { return &node4; }
+    if (k == 11) { return &node827; }
+    if ((k >= 12) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next806(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next807(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next808(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next809(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next810(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next811(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next812(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next813(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next814(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next815(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next816(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next817(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next818(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next819(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next820(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next821(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next822(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next823(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next824(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next825(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next826(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next827(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next828(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next829(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next830(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next831(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node4; }
+    if ((k >= 10) && (k <= 35)) { return &node4; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term801, nullptr};
+Node node2 = {&next2, &term800, nullptr};
+Node node3 = {nullptr, &term803, nullptr};
+Node node4 = {&next4, &term802, nullptr};
+Node node5 = {&next5, &term802, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term1, nullptr};
+Node node8 = {&next8, &term2, nullptr};
+Node node9 = {&next9, &term3, nullptr};
+Node node10 = {&next10, &term4, nullptr};
+Node node11 = {&next11, &term5, nullptr};
+Node node12 = {&next12, &term6, nullptr};
+Node node13 = {&next13, &term7, nullptr};
+Node node14 = {&next14, &term8, nullptr};
+Node node15 = {&next15, &term9, nullptr};
+Node node16 = {&next16, &term10, nullptr};
+Node node17 = {&next17, &term11, nullptr};
+Node node18 = {&next18, &term12, nullptr};
+Node node19 = {&next19, &term13, nullptr};
+Node node20 = {&next20, &term14, nullptr};
+Node node21 = {&next21, &term15, nullptr};
+Node node22 = {&next22, &term16, nullptr};
+Node node23 = {&next23, &term17, nullptr};
+Node node24 = {&next24, &term18, nullptr};
+Node node25 = {&next25, &term19, nullptr};
+Node node26 = {&next26, &term20, nullptr};
+Node node27 = {&next27, &term21, nullptr};
+Node node28 = {&next28, &term22, nullptr};
+Node node29 = {&next29, &term23, nullptr};
+Node node30 = {&next30, &term24, nullptr};
+Node node31 = {&next31, &term25, nullptr};
+Node node32 = {&next32, &term802, nullptr};
+Node node33 = {&next33, &term51, nullptr};
+Node node34 = {&next34, &term77, nullptr};
+Node node35 = {&next35, &term103, nullptr};
+Node node36 = {&next36, &term129, nullptr};
+Node node37 = {&next37, &term155, nullptr};
+Node node38 = {&next38, &term181, nullptr};
+Node node39 = {&next39, &term207, nullptr};
+Node node40 = {&next40, &term233, nullptr};
+Node node41 = {&next41, &term259, nullptr};
+Node node42 = {&next42, &term285, nullptr};
+Node node43 = {&next43, &term311, nullptr};
+Node node44 = {&next44, &term337, nullptr};
+Node node45 = {&next45, &term363, nullptr};
+Node node46 = {&next46, &term389, nullptr};
+Node node47 = {&next47, &term415, nullptr};
+Node node48 = {&next48, &term441, nullptr};
+Node node49 = {&next49, &term467, nullptr};
+Node node50 = {&next50, &term493, nullptr};
+Node node51 = {&next51, &term519, nullptr};
+Node node52 = {&next52, &term545, nullptr};
+Node node53 = {&next53, &term571, nullptr};
+Node node54 = {&next54, &term597, nullptr};
+Node node55 = {&next55, &term623, nullptr};
+Node node56 = {&next56, &term649, nullptr};
+Node node57 = {&next57, &term675, nullptr};
+Node node58 = {&next58, &term779, nullptr};
+Node node59 = {&next59, &term753, nullptr};
+Node node60 = {&next60, &term727, nullptr};
+Node node61 = {&next61, &term701, nullptr};
+Node node62 = {&next62, &term802, nullptr};
+Node node63 = {&next63, &term50, nullptr};
+Node node64 = {&next64, &term76, nullptr};
+Node node65 = {&next65, &term102, nullptr};
+Node node66 = {&next66, &term128, nullptr};
+Node node67 = {&next67, &term154, nullptr};
+Node node68 = {&next68, &term180, nullptr};
+Node node69 = {&next69, &term206, nullptr};
+Node node70 = {&next70, &term232, nullptr};
+Node node71 = {&next71, &term258, nullptr};
+Node node72 = {&next72, &term284, nullptr};
+Node node73 = {&next73, &term310, nullptr};
+Node node74 = {&next74, &term336, nullptr};
+Node node75 = {&next75, &term362, nullptr};
+Node node76 = {&next76, &term388, nullptr};
+Node node77 = {&next77, &term414, nullptr};
+Node node78 = {&next78, &term440, nullptr};
+Node node79 = {&next79, &term466, nullptr};
+Node node80 = {&next80, &term492, nullptr};
+Node node81 = {&next81, &term518, nullptr};
+Node node82 = {&next82, &term544, nullptr};
+Node node83 = {&next83, &term570, nullptr};
+Node node84 = {&next84, &term596, nullptr};
+Node node85 = {&next85, &term622, nullptr};
+Node node86 = {&next86, &term648, nullptr};
+Node node87 = {&next87, &term674, nullptr};
+Node node88 = {&next88, &term778, nullptr};
+Node node89 = {&next89, &term752, nullptr};
+Node node90 = {&next90, &term726, nullptr};
+Node node91 = {&next91, &term700, nullptr};
+Node node92 = {&next92, &term802, nullptr};
+Node node93 = {&next93, &term49, nullptr};
+Node node94 = {&next94, &term75, nullptr};
+Node node95 = {&next95, &term101, nullptr};
+Node node96 = {&next96, &term127, nullptr};
+Node node97 = {&next97, &term153, nullptr};
+Node node98 = {&next98, &term179, nullptr};
+Node node99 = {&next99, &term205, nullptr};
+Node node100 = {&next100, &term231, nullptr};
+Node node101 = {&next101, &term257, nullptr};
+Node node102 = {&next102, &term283, nullptr};
+Node node103 = {&next103, &term309, nullptr};
+Node node104 = {&next104, &term335, nullptr};
+Node node105 = {&next105, &term361, nullptr};
+Node node106 = {&next106, &term387, nullptr};
+Node node107 = {&next107, &term413, nullptr};
+Node node108 = {&next108, &term439, nullptr};
+Node node109 = {&next109, &term465, nullptr};
+Node node110 = {&next110, &term491, nullptr};
+Node node111 = {&next111, &term517, nullptr};
+Node node112 = {&next112, &term543, nullptr};
+Node node113 = {&next113, &term569, nullptr};
+Node node114 = {&next114, &term595, nullptr};
+Node node115 = {&next115, &term621, nullptr};
+Node node116 = {&next116, &term647, nullptr};
+Node node117 = {&next117, &term673, nullptr};
+Node node118 = {&next118, &term777, nullptr};
+Node node119 = {&next119, &term751, nullptr};
+Node node120 = {&next120, &term725, nullptr};
+Node node121 = {&next121, &term699, nullptr};
+Node node122 = {&next122, &term802, nullptr};
+Node node123 = {&next123, &term48, nullptr};
+Node node124 = {&next124, &term74, nullptr};
+Node node125 = {&next125, &term100, nullptr};
+Node node126 = {&next126, &term126, nullptr};
+Node node127 = {&next127, &term152, nullptr};
+Node node128 = {&next128, &term178, nullptr};
+Node node129 = {&next129, &term204, nullptr};
+Node node130 = {&next130, &term230, nullptr};
+Node node131 = {&next131, &term256, nullptr};
+Node node132 = {&next132, &term282, nullptr};
+Node node133 = {&next133, &term308, nullptr};
+Node node134 = {&next134, &term334, nullptr};
+Node node135 = {&next135, &term360, nullptr};
+Node node136 = {&next136, &term386, nullptr};
+Node node137 = {&next137, &term412, nullptr};
+Node node138 = {&next138, &term438, nullptr};
+Node node139 = {&next139, &term464, nullptr};
+Node node140 = {&next140, &term490, nullptr};
+Node node141 = {&next141, &term516, nullptr};
+Node node142 = {&next142, &term542, nullptr};
+Node node143 = {&next143, &term568, nullptr};
+Node node144 = {&next144, &term594, nullptr};
+Node node145 = {&next145, &term620, nullptr};
+Node node146 = {&next146, &term646, nullptr};
+Node node147 = {&next147, &term672, nullptr};
+Node node148 = {&next148, &term776, nullptr};
+Node node149 = {&next149, &term750, nullptr};
+Node node150 = {&next150, &term724, nullptr};
+Node node151 = {&next151, &term698, nullptr};
+Node node152 = {&next152, &term802, nullptr};
+Node node153 = {&next153, &term47, nullptr};
+Node node154 = {&next154, &term73, nullptr};
+Node node155 = {&next155, &term99, nullptr};
+Node node156 = {&next156, &term125, nullptr};
+Node node157 = {&next157, &term151, nullptr};
+Node node158 = {&next158, &term177, nullptr};
+Node node159 = {&next159, &term203, nullptr};
+Node node160 = {&next160, &term229, nullptr};
+Node node161 = {&next161, &term255, nullptr};
+Node node162 = {&next162, &term281, nullptr};
+Node node163 = {&next163, &term307, nullptr};
+Node node164 = {&next164, &term333, nullptr};
+Node node165 = {&next165, &term359, nullptr};
+Node node166 = {&next166, &term385, nullptr};
+Node node167 = {&next167, &term411, nullptr};
+Node node168 = {&next168, &term437, nullptr};
+Node node169 = {&next169, &term463, nullptr};
+Node node170 = {&next170, &term489, nullptr};
+Node node171 = {&next171, &term515, nullptr};
+Node node172 = {&next172, &term541, nullptr};
+Node node173 = {&next173, &term567, nullptr};
+Node node174 = {&next174, &term593, nullptr};
+Node node175 = {&next175, &term619, nullptr};
+Node node176 = {&next176, &term645, nullptr};
+Node node177 = {&next177, &term671, nullptr};
+Node node178 = {&next178, &term775, nullptr};
+Node node179 = {&next179, &term749, nullptr};
+Node node180 = {&next180, &term723, nullptr};
+Node node181 = {&next181, &term697, nullptr};
+Node node182 = {&next182, &term802, nullptr};
+Node node183 = {&next183, &term46, nullptr};
+Node node184 = {&next184, &term72, nullptr};
+Node node185 = {&next185, &term98, nullptr};
+Node node186 = {&next186, &term124, nullptr};
+Node node187 = {&next187, &term150, nullptr};
+Node node188 = {&next188, &term176, nullptr};
+Node node189 = {&next189, &term202, nullptr};
+Node node190 = {&next190, &term228, nullptr};
+Node node191 = {&next191, &term254, nullptr};
+Node node192 = {&next192, &term280, nullptr};
+Node node193 = {&next193, &term306, nullptr};
+Node node194 = {&next194, &term332, nullptr};
+Node node195 = {&next195, &term358, nullptr};
+Node node196 = {&next196, &term384, nullptr};
+Node node197 = {&next197, &term410, nullptr};
+Node node198 = {&next198, &term436, nullptr};
+Node node199 = {&next199, &term462, nullptr};
+Node node200 = {&next200, &term488, nullptr};
+Node node201 = {&next201, &term514, nullptr};
+Node node202 = {&next202, &term540, nullptr};
+Node node203 = {&next203, &term566, nullptr};
+Node node204 = {&next204, &term592, nullptr};
+Node node205 = {&next205, &term618, nullptr};
+Node node206 = {&next206, &term644, nullptr};
+Node node207 = {&next207, &term670, nullptr};
+Node node208 = {&next208, &term774, nullptr};
+Node node209 = {&next209, &term748, nullptr};
+Node node210 = {&next210, &term722, nullptr};
+Node node211 = {&next211, &term696, nullptr};
+Node node212 = {&next212, &term802, nullptr};
+Node node213 = {&next213, &term45, nullptr};
+Node node214 = {&next214, &term71, nullptr};
+Node node215 = {&next215, &term97, nullptr};
+Node node216 = {&next216, &term123, nullptr};
+Node node217 = {&next217, &term149, nullptr};
+Node node218 = {&next218, &term175, nullptr};
+Node node219 = {&next219, &term201, nullptr};
+Node node220 = {&next220, &term227, nullptr};
+Node node221 = {&next221, &term253, nullptr};
+Node node222 = {&next222, &term279, nullptr};
+Node node223 = {&next223, &term305, nullptr};
+Node node224 = {&next224, &term331, nullptr};
+Node node225 = {&next225, &term357, nullptr};
+Node node226 = {&next226, &term383, nullptr};
+Node node227 = {&next227, &term409, nullptr};
+Node node228 = {&next228, &term435, nullptr};
+Node node229 = {&next229, &term461, nullptr};
+Node node230 = {&next230, &term487, nullptr};
+Node node231 = {&next231, &term513, nullptr};
+Node node232 = {&next232, &term539, nullptr};
+Node node233 = {&next233, &term565, nullptr};
+Node node234 = {&next234, &term591, nullptr};
+Node node235 = {&next235, &term617, nullptr};
+Node node236 = {&next236, &term643, nullptr};
+Node node237 = {&next237, &term669, nullptr};
+Node node238 = {&next238, &term799, nullptr};
+Node node239 = {&next239, &term773, nullptr};
+Node node240 = {&next240, &term747, nullptr};
+Node node241 = {&next241, &term721, nullptr};
+Node node242 = {&next242, &term695, nullptr};
+Node node243 = {&next243, &term802, nullptr};
+Node node244 = {&next244, &term44, nullptr};
+Node node245 = {&next245, &term70, nullptr};
+Node node246 = {&next246, &term96, nullptr};
+Node node247 = {&next247, &term122, nullptr};
+Node node248 = {&next248, &term148, nullptr};
+Node node249 = {&next249, &term174, nullptr};
+Node node250 = {&next250, &term200, nullptr};
+Node node251 = {&next251, &term226, nullptr};
+Node node252 = {&next252, &term252, nullptr};
+Node node253 = {&next253, &term278, nullptr};
+Node node254 = {&next254, &term304, nullptr};
+Node node255 = {&next255, &term330, nullptr};
+Node node256 = {&next256, &term356, nullptr};
+Node node257 = {&next257, &term382, nullptr};
+Node node258 = {&next258, &term408, nullptr};
+Node node259 = {&next259, &term434, nullptr};
+Node node260 = {&next260, &term460, nullptr};
+Node node261 = {&next261, &term486, nullptr};
+Node node262 = {&next262, &term512, nullptr};
+Node node263 = {&next263, &term538, nullptr};
+Node node264 = {&next264, &term564, nullptr};
+Node node265 = {&next265, &term590, nullptr};
+Node node266 = {&next266, &term616, nullptr};
+Node node267 = {&next267, &term642, nullptr};
+Node node268 = {&next268, &term668, nullptr};
+Node node269 = {&next269, &term798, nullptr};
+Node node270 = {&next270, &term772, nullptr};
+Node node271 = {&next271, &term746, nullptr};
+Node node272 = {&next272, &term720, nullptr};
+Node node273 = {&next273, &term694, nullptr};
+Node node274 = {&next274, &term802, nullptr};
+Node node275 = {&next275, &term43, nullptr};
+Node node276 = {&next276, &term69, nullptr};
+Node node277 = {&next277, &term95, nullptr};
+Node node278 = {&next278, &term121, nullptr};
+Node node279 = {&next279, &term147, nullptr};
+Node node280 = {&next280, &term173, nullptr};
+Node node281 = {&next281, &term199, nullptr};
+Node node282 = {&next282, &term225, nullptr};
+Node node283 = {&next283, &term251, nullptr};
+Node node284 = {&next284, &term277, nullptr};
+Node node285 = {&next285, &term303, nullptr};
+Node node286 = {&next286, &term329, nullptr};
+Node node287 = {&next287, &term355, nullptr};
+Node node288 = {&next288, &term381, nullptr};
+Node node289 = {&next289, &term407, nullptr};
+Node node290 = {&next290, &term433, nullptr};
+Node node291 = {&next291, &term459, nullptr};
+Node node292 = {&next292, &term485, nullptr};
+Node node293 = {&next293, &term511, nullptr};
+Node node294 = {&next294, &term537, nullptr};
+Node node295 = {&next295, &term563, nullptr};
+Node node296 = {&next296, &term589, nullptr};
+Node node297 = {&next297, &term615, nullptr};
+Node node298 = {&next298, &term641, nullptr};
+Node node299 = {&next299, &term667, nullptr};
+Node node300 = {&next300, &term797, nullptr};
+Node node301 = {&next301, &term771, nullptr};
+Node node302 = {&next302, &term745, nullptr};
+Node node303 = {&next303, &term719, nullptr};
+Node node304 = {&next304, &term693, nullptr};
+Node node305 = {&next305, &term802, nullptr};
+Node node306 = {&next306, &term42, nullptr};
+Node node307 = {&next307, &term68, nullptr};
+Node node308 = {&next308, &term94, nullptr};
+Node node309 = {&next309, &term120, nullptr};
+Node node310 = {&next310, &term146, nullptr};
+Node node311 = {&next311, &term172, nullptr};
+Node node312 = {&next312, &term198, nullptr};
+Node node313 = {&next313, &term224, nullptr};
+Node node314 = {&next314, &term250, nullptr};
+Node node315 = {&next315, &term276, nullptr};
+Node node316 = {&next316, &term302, nullptr};
+Node node317 = {&next317, &term328, nullptr};
+Node node318 = {&next318, &term354, nullptr};
+Node node319 = {&next319, &term380, nullptr};
+Node node320 = {&next320, &term406, nullptr};
+Node node321 = {&next321, &term432, nullptr};
+Node node322 = {&next322, &term458, nullptr};
+Node node323 = {&next323, &term484, nullptr};
+Node node324 = {&next324, &term510, nullptr};
+Node node325 = {&next325, &term536, nullptr};
+Node node326 = {&next326, &term562, nullptr};
+Node node327 = {&next327, &term588, nullptr};
+Node node328 = {&next328, &term614, nullptr};
+Node node329 = {&next329, &term640, nullptr};
+Node node330 = {&next330, &term666, nullptr};
+Node node331 = {&next331, &term796, nullptr};
+Node node332 = {&next332, &term770, nullptr};
+Node node333 = {&next333, &term744, nullptr};
+Node node334 = {&next334, &term718, nullptr};
+Node node335 = {&next335, &term692, nullptr};
+Node node336 = {&next336, &term802, nullptr};
+Node node337 = {&next337, &term41, nullptr};
+Node node338 = {&next338, &term67, nullptr};
+Node node339 = {&next339, &term93, nullptr};
+Node node340 = {&next340, &term119, nullptr};
+Node node341 = {&next341, &term145, nullptr};
+Node node342 = {&next342, &term171, nullptr};
+Node node343 = {&next343, &term197, nullptr};
+Node node344 = {&next344, &term223, nullptr};
+Node node345 = {&next345, &term249, nullptr};
+Node node346 = {&next346, &term275, nullptr};
+Node node347 = {&next347, &term301, nullptr};
+Node node348 = {&next348, &term327, nullptr};
+Node node349 = {&next349, &term353, nullptr};
+Node node350 = {&next350, &term379, nullptr};
+Node node351 = {&next351, &term405, nullptr};
+Node node352 = {&next352, &term431, nullptr};
+Node node353 = {&next353, &term457, nullptr};
+Node node354 = {&next354, &term483, nullptr};
+Node node355 = {&next355, &term509, nullptr};
+Node node356 = {&next356, &term535, nullptr};
+Node node357 = {&next357, &term561, nullptr};
+Node node358 = {&next358, &term587, nullptr};
+Node node359 = {&next359, &term613, nullptr};
+Node node360 = {&next360, &term639, nullptr};
+Node node361 = {&next361, &term665, nullptr};
+Node node362 = {&next362, &term795, nullptr};
+Node node363 = {&next363, &term769, nullptr};
+Node node364 = {&next364, &term743, nullptr};
+Node node365 = {&next365, &term717, nullptr};
+Node node366 = {&next366, &term691, nullptr};
+Node node367 = {&next367, &term802, nullptr};
+Node node368 = {&next368, &term40, nullptr};
+Node node369 = {&next369, &term66, nullptr};
+Node node370 = {&next370, &term92, nullptr};
+Node node371 = {&next371, &term118, nullptr};
+Node node372 = {&next372, &term144, nullptr};
+Node node373 = {&next373, &term170, nullptr};
+Node node374 = {&next374, &term196, nullptr};
+Node node375 = {&next375, &term222, nullptr};
+Node node376 = {&next376, &term248, nullptr};
+Node node377 = {&next377, &term274, nullptr};
+Node node378 = {&next378, &term300, nullptr};
+Node node379 = {&next379, &term326, nullptr};
+Node node380 = {&next380, &term352, nullptr};
+Node node381 = {&next381, &term378, nullptr};
+Node node382 = {&next382, &term404, nullptr};
+Node node383 = {&next383, &term430, nullptr};
+Node node384 = {&next384, &term456, nullptr};
+Node node385 = {&next385, &term482, nullptr};
+Node node386 = {&next386, &term508, nullptr};
+Node node387 = {&next387, &term534, nullptr};
+Node node388 = {&next388, &term560, nullptr};
+Node node389 = {&next389, &term586, nullptr};
+Node node390 = {&next390, &term612, nullptr};
+Node node391 = {&next391, &term638, nullptr};
+Node node392 = {&next392, &term664, nullptr};
+Node node393 = {&next393, &term794, nullptr};
+Node node394 = {&next394, &term768, nullptr};
+Node node395 = {&next395, &term742, nullptr};
+Node node396 = {&next396, &term716, nullptr};
+Node node397 = {&next397, &term690, nullptr};
+Node node398 = {&next398, &term802, nullptr};
+Node node399 = {&next399, &term39, nullptr};
+Node node400 = {&next400, &term65, nullptr};
+Node node401 = {&next401, &term91, nullptr};
+Node node402 = {&next402, &term117, nullptr};
+Node node403 = {&next403, &term143, nullptr};
+Node node404 = {&next404, &term169, nullptr};
+Node node405 = {&next405, &term195, nullptr};
+Node node406 = {&next406, &term221, nullptr};
+Node node407 = {&next407, &term247, nullptr};
+Node node408 = {&next408, &term273, nullptr};
+Node node409 = {&next409, &term299, nullptr};
+Node node410 = {&next410, &term325, nullptr};
+Node node411 = {&next411, &term351, nullptr};
+Node node412 = {&next412, &term377, nullptr};
+Node node413 = {&next413, &term403, nullptr};
+Node node414 = {&next414, &term429, nullptr};
+Node node415 = {&next415, &term455, nullptr};
+Node node416 = {&next416, &term481, nullptr};
+Node node417 = {&next417, &term507, nullptr};
+Node node418 = {&next418, &term533, nullptr};
+Node node419 = {&next419, &term559, nullptr};
+Node node420 = {&next420, &term585, nullptr};
+Node node421 = {&next421, &term611, nullptr};
+Node node422 = {&next422, &term637, nullptr};
+Node node423 = {&next423, &term663, nullptr};
+Node node424 = {&next424, &term793, nullptr};
+Node node425 = {&next425, &term767, nullptr};
+Node node426 = {&next426, &term741, nullptr};
+Node node427 = {&next427, &term715, nullptr};
+Node node428 = {&next428, &term689, nullptr};
+Node node429 = {&next429, &term802, nullptr};
+Node node430 = {&next430, &term38, nullptr};
+Node node431 = {&next431, &term64, nullptr};
+Node node432 = {&next432, &term90, nullptr};
+Node node433 = {&next433, &term116, nullptr};
+Node node434 = {&next434, &term142, nullptr};
+Node node435 = {&next435, &term168, nullptr};
+Node node436 = {&next436, &term194, nullptr};
+Node node437 = {&next437, &term220, nullptr};
+Node node438 = {&next438, &term246, nullptr};
+Node node439 = {&next439, &term272, nullptr};
+Node node440 = {&next440, &term298, nullptr};
+Node node441 = {&next441, &term324, nullptr};
+Node node442 = {&next442, &term350, nullptr};
+Node node443 = {&next443, &term376, nullptr};
+Node node444 = {&next444, &term402, nullptr};
+Node node445 = {&next445, &term428, nullptr};
+Node node446 = {&next446, &term454, nullptr};
+Node node447 = {&next447, &term480, nullptr};
+Node node448 = {&next448, &term506, nullptr};
+Node node449 = {&next449, &term532, nullptr};
+Node node450 = {&next450, &term558, nullptr};
+Node node451 = {&next451, &term584, nullptr};
+Node node452 = {&next452, &term610, nullptr};
+Node node453 = {&next453, &term636, nullptr};
+Node node454 = {&next454, &term662, nullptr};
+Node node455 = {&next455, &term792, nullptr};
+Node node456 = {&next456, &term766, nullptr};
+Node node457 = {&next457, &term740, nullptr};
+Node node458 = {&next458, &term714, nullptr};
+Node node459 = {&next459, &term688, nullptr};
+Node node460 = {&next460, &term802, nullptr};
+Node node461 = {&next461, &term37, nullptr};
+Node node462 = {&next462, &term63, nullptr};
+Node node463 = {&next463, &term89, nullptr};
+Node node464 = {&next464, &term115, nullptr};
+Node node465 = {&next465, &term141, nullptr};
+Node node466 = {&next466, &term167, nullptr};
+Node node467 = {&next467, &term193, nullptr};
+Node node468 = {&next468, &term219, nullptr};
+Node node469 = {&next469, &term245, nullptr};
+Node node470 = {&next470, &term271, nullptr};
+Node node471 = {&next471, &term297, nullptr};
+Node node472 = {&next472, &term323, nullptr};
+Node node473 = {&next473, &term349, nullptr};
+Node node474 = {&next474, &term375, nullptr};
+Node node475 = {&next475, &term401, nullptr};
+Node node476 = {&next476, &term427, nullptr};
+Node node477 = {&next477, &term453, nullptr};
+Node node478 = {&next478, &term479, nullptr};
+Node node479 = {&next479, &term505, nullptr};
+Node node480 = {&next480, &term531, nullptr};
+Node node481 = {&next481, &term557, nullptr};
+Node node482 = {&next482, &term583, nullptr};
+Node node483 = {&next483, &term609, nullptr};
+Node node484 = {&next484, &term635, nullptr};
+Node node485 = {&next485, &term661, nullptr};
+Node node486 = {&next486, &term791, nullptr};
+Node node487 = {&next487, &term765, nullptr};
+Node node488 = {&next488, &term739, nullptr};
+Node node489 = {&next489, &term713, nullptr};
+Node node490 = {&next490, &term687, nullptr};
+Node node491 = {&next491, &term802, nullptr};
+Node node492 = {&next492, &term36, nullptr};
+Node node493 = {&next493, &term62, nullptr};
+Node node494 = {&next494, &term88, nullptr};
+Node node495 = {&next495, &term114, nullptr};
+Node node496 = {&next496, &term140, nullptr};
+Node node497 = {&next497, &term166, nullptr};
+Node node498 = {&next498, &term192, nullptr};
+Node node499 = {&next499, &term218, nullptr};
+Node node500 = {&next500, &term244, nullptr};
+Node node501 = {&next501, &term270, nullptr};
+Node node502 = {&next502, &term296, nullptr};
+Node node503 = {&next503, &term322, nullptr};
+Node node504 = {&next504, &term348, nullptr};
+Node node505 = {&next505, &term374, nullptr};
+Node node506 = {&next506, &term400, nullptr};
+Node node507 = {&next507, &term426, nullptr};
+Node node508 = {&next508, &term452, nullptr};
+Node node509 = {&next509, &term478, nullptr};
+Node node510 = {&next510, &term504, nullptr};
+Node node511 = {&next511, &term530, nullptr};
+Node node512 = {&next512, &term556, nullptr};
+Node node513 = {&next513, &term582, nullptr};
+Node node514 = {&next514, &term608, nullptr};
+Node node515 = {&next515, &term634, nullptr};
+Node node516 = {&next516, &term660, nullptr};
+Node node517 = {&next517, &term790, nullptr};
+Node node518 = {&next518, &term764, nullptr};
+Node node519 = {&next519, &term738, nullptr};
+Node node520 = {&next520, &term712, nullptr};
+Node node521 = {&next521, &term686, nullptr};
+Node node522 = {&next522, &term802, nullptr};
+Node node523 = {&next523, &term35, nullptr};
+Node node524 = {&next524, &term61, nullptr};
+Node node525 = {&next525, &term87, nullptr};
+Node node526 = {&next526, &term113, nullptr};
+Node node527 = {&next527, &term139, nullptr};
+Node node528 = {&next528, &term165, nullptr};
+Node node529 = {&next529, &term191, nullptr};
+Node node530 = {&next530, &term217, nullptr};
+Node node531 = {&next531, &term243, nullptr};
+Node node532 = {&next532, &term269, nullptr};
+Node node533 = {&next533, &term295, nullptr};
+Node node534 = {&next534, &term321, nullptr};
+Node node535 = {&next535, &term347, nullptr};
+Node node536 = {&next536, &term373, nullptr};
+Node node537 = {&next537, &term399, nullptr};
+Node node538 = {&next538, &term425, nullptr};
+Node node539 = {&next539, &term451, nullptr};
+Node node540 = {&next540, &term477, nullptr};
+Node node541 = {&next541, &term503, nullptr};
+Node node542 = {&next542, &term529, nullptr};
+Node node543 = {&next543, &term555, nullptr};
+Node node544 = {&next544, &term581, nullptr};
+Node node545 = {&next545, &term607, nullptr};
+Node node546 = {&next546, &term633, nullptr};
+Node node547 = {&next547, &term659, nullptr};
+Node node548 = {&next548, &term789, nullptr};
+Node node549 = {&next549, &term763, nullptr};
+Node node550 = {&next550, &term737, nullptr};
+Node node551 = {&next551, &term711, nullptr};
+Node node552 = {&next552, &term685, nullptr};
+Node node553 = {&next553, &term802, nullptr};
+Node node554 = {&next554, &term34, nullptr};
+Node node555 = {&next555, &term60, nullptr};
+Node node556 = {&next556, &term86, nullptr};
+Node node557 = {&next557, &term112, nullptr};
+Node node558 = {&next558, &term138, nullptr};
+Node node559 = {&next559, &term164, nullptr};
+Node node560 = {&next560, &term190, nullptr};
+Node node561 = {&next561, &term216, nullptr};
+Node node562 = {&next562, &term242, nullptr};
+Node node563 = {&next563, &term268, nullptr};
+Node node564 = {&next564, &term294, nullptr};
+Node node565 = {&next565, &term320, nullptr};
+Node node566 = {&next566, &term346, nullptr};
+Node node567 = {&next567, &term372, nullptr};
+Node node568 = {&next568, &term398, nullptr};
+Node node569 = {&next569, &term424, nullptr};
+Node node570 = {&next570, &term450, nullptr};
+Node node571 = {&next571, &term476, nullptr};
+Node node572 = {&next572, &term502, nullptr};
+Node node573 = {&next573, &term528, nullptr};
+Node node574 = {&next574, &term554, nullptr};
+Node node575 = {&next575, &term580, nullptr};
+Node node576 = {&next576, &term606, nullptr};
+Node node577 = {&next577, &term632, nullptr};
+Node node578 = {&next578, &term658, nullptr};
+Node node579 = {&next579, &term788, nullptr};
+Node node580 = {&next580, &term762, nullptr};
+Node node581 = {&next581, &term736, nullptr};
+Node node582 = {&next582, &term710, nullptr};
+Node node583 = {&next583, &term684, nullptr};
+Node node584 = {&next584, &term802, nullptr};
+Node node585 = {&next585, &term33, nullptr};
+Node node586 = {&next586, &term59, nullptr};
+Node node587 = {&next587, &term85, nullptr};
+Node node588 = {&next588, &term111, nullptr};
+Node node589 = {&next589, &term137, nullptr};
+Node node590 = {&next590, &term163, nullptr};
+Node node591 = {&next591, &term189, nullptr};
+Node node592 = {&next592, &term215, nullptr};
+Node node593 = {&next593, &term241, nullptr};
+Node node594 = {&next594, &term267, nullptr};
+Node node595 = {&next595, &term293, nullptr};
+Node node596 = {&next596, &term319, nullptr};
+Node node597 = {&next597, &term345, nullptr};
+Node node598 = {&next598, &term371, nullptr};
+Node node599 = {&next599, &term397, nullptr};
+Node node600 = {&next600, &term423, nullptr};
+Node node601 = {&next601, &term449, nullptr};
+Node node602 = {&next602, &term475, nullptr};
+Node node603 = {&next603, &term501, nullptr};
+Node node604 = {&next604, &term527, nullptr};
+Node node605 = {&next605, &term553, nullptr};
+Node node606 = {&next606, &term579, nullptr};
+Node node607 = {&next607, &term605, nullptr};
+Node node608 = {&next608, &term631, nullptr};
+Node node609 = {&next609, &term657, nullptr};
+Node node610 = {&next610, &term787, nullptr};
+Node node611 = {&next611, &term761, nullptr};
+Node node612 = {&next612, &term735, nullptr};
+Node node613 = {&next613, &term709, nullptr};
+Node node614 = {&next614, &term683, nullptr};
+Node node615 = {&next615, &term802, nullptr};
+Node node616 = {&next616, &term32, nullptr};
+Node node617 = {&next617, &term58, nullptr};
+Node node618 = {&next618, &term84, nullptr};
+Node node619 = {&next619, &term110, nullptr};
+Node node620 = {&next620, &term136, nullptr};
+Node node621 = {&next621, &term162, nullptr};
+Node node622 = {&next622, &term188, nullptr};
+Node node623 = {&next623, &term214, nullptr};
+Node node624 = {&next624, &term240, nullptr};
+Node node625 = {&next625, &term266, nullptr};
+Node node626 = {&next626, &term292, nullptr};
+Node node627 = {&next627, &term318, nullptr};
+Node node628 = {&next628, &term344, nullptr};
+Node node629 = {&next629, &term370, nullptr};
+Node node630 = {&next630, &term396, nullptr};
+Node node631 = {&next631, &term422, nullptr};
+Node node632 = {&next632, &term448, nullptr};
+Node node633 = {&next633, &term474, nullptr};
+Node node634 = {&next634, &term500, nullptr};
+Node node635 = {&next635, &term526, nullptr};
+Node node636 = {&next636, &term552, nullptr};
+Node node637 = {&next637, &term578, nullptr};
+Node node638 = {&next638, &term604, nullptr};
+Node node639 = {&next639, &term630, nullptr};
+Node node640 = {&next640, &term656, nullptr};
+Node node641 = {&next641, &term786, nullptr};
+Node node642 = {&next642, &term760, nullptr};
+Node node643 = {&next643, &term734, nullptr};
+Node node644 = {&next644, &term708, nullptr};
+Node node645 = {&next645, &term682, nullptr};
+Node node646 = {&next646, &term802, nullptr};
+Node node647 = {&next647, &term31, nullptr};
+Node node648 = {&next648, &term57, nullptr};
+Node node649 = {&next649, &term83, nullptr};
+Node node650 = {&next650, &term109, nullptr};
+Node node651 = {&next651, &term135, nullptr};
+Node node652 = {&next652, &term161, nullptr};
+Node node653 = {&next653, &term187, nullptr};
+Node node654 = {&next654, &term213, nullptr};
+Node node655 = {&next655, &term239, nullptr};
+Node node656 = {&next656, &term265, nullptr};
+Node node657 = {&next657, &term291, nullptr};
+Node node658 = {&next658, &term317, nullptr};
+Node node659 = {&next659, &term343, nullptr};
+Node node660 = {&next660, &term369, nullptr};
+Node node661 = {&next661, &term395, nullptr};
+Node node662 = {&next662, &term421, nullptr};
+Node node663 = {&next663, &term447, nullptr};
+Node node664 = {&next664, &term473, nullptr};
+Node node665 = {&next665, &term499, nullptr};
+Node node666 = {&next666, &term525, nullptr};
+Node node667 = {&next667, &term551, nullptr};
+Node node668 = {&next668, &term577, nullptr};
+Node node669 = {&next669, &term603, nullptr};
+Node node670 = {&next670, &term629, nullptr};
+Node node671 = {&next671, &term655, nullptr};
+Node node672 = {&next672, &term785, nullptr};
+Node node673 = {&next673, &term759, nullptr};
+Node node674 = {&next674, &term733, nullptr};
+Node node675 = {&next675, &term707, nullptr};
+Node node676 = {&next676, &term681, nullptr};
+Node node677 = {&next677, &term802, nullptr};
+Node node678 = {&next678, &term30, nullptr};
+Node node679 = {&next679, &term56, nullptr};
+Node node680 = {&next680, &term82, nullptr};
+Node node681 = {&next681, &term108, nullptr};
+Node node682 = {&next682, &term134, nullptr};
+Node node683 = {&next683, &term160, nullptr};
+Node node684 = {&next684, &term186, nullptr};
+Node node685 = {&next685, &term212, nullptr};
+Node node686 = {&next686, &term238, nullptr};
+Node node687 = {&next687, &term264, nullptr};
+Node node688 = {&next688, &term290, nullptr};
+Node node689 = {&next689, &term316, nullptr};
+Node node690 = {&next690, &term342, nullptr};
+Node node691 = {&next691, &term368, nullptr};
+Node node692 = {&next692, &term394, nullptr};
+Node node693 = {&next693, &term420, nullptr};
+Node node694 = {&next694, &term446, nullptr};
+Node node695 = {&next695, &term472, nullptr};
+Node node696 = {&next696, &term498, nullptr};
+Node node697 = {&next697, &term524, nullptr};
+Node node698 = {&next698, &term550, nullptr};
+Node node699 = {&next699, &term576, nullptr};
+Node node700 = {&next700, &term602, nullptr};
+Node node701 = {&next701, &term628, nullptr};
+Node node702 = {&next702, &term654, nullptr};
+Node node703 = {&next703, &term784, nullptr};
+Node node704 = {&next704, &term758, nullptr};
+Node node705 = {&next705, &term732, nullptr};
+Node node706 = {&next706, &term706, nullptr};
+Node node707 = {&next707, &term680, nullptr};
+Node node708 = {&next708, &term802, nullptr};
+Node node709 = {&next709, &term29, nullptr};
+Node node710 = {&next710, &term55, nullptr};
+Node node711 = {&next711, &term81, nullptr};
+Node node712 = {&next712, &term107, nullptr};
+Node node713 = {&next713, &term133, nullptr};
+Node node714 = {&next714, &term159, nullptr};
+Node node715 = {&next715, &term185, nullptr};
+Node node716 = {&next716, &term211, nullptr};
+Node node717 = {&next717, &term237, nullptr};
+Node node718 = {&next718, &term263, nullptr};
+Node node719 = {&next719, &term289, nullptr};
+Node node720 = {&next720, &term315, nullptr};
+Node node721 = {&next721, &term341, nullptr};
+Node node722 = {&next722, &term367, nullptr};
+Node node723 = {&next723, &term393, nullptr};
+Node node724 = {&next724, &term419, nullptr};
+Node node725 = {&next725, &term445, nullptr};
+Node node726 = {&next726, &term471, nullptr};
+Node node727 = {&next727, &term497, nullptr};
+Node node728 = {&next728, &term523, nullptr};
+Node node729 = {&next729, &term549, nullptr};
+Node node730 = {&next730, &term575, nullptr};
+Node node731 = {&next731, &term601, nullptr};
+Node node732 = {&next732, &term627, nullptr};
+Node node733 = {&next733, &term653, nullptr};
+Node node734 = {&next734, &term783, nullptr};
+Node node735 = {&next735, &term757, nullptr};
+Node node736 = {&next736, &term731, nullptr};
+Node node737 = {&next737, &term705, nullptr};
+Node node738 = {&next738, &term679, nullptr};
+Node node739 = {&next739, &term802, nullptr};
+Node node740 = {&next740, &term28, nullptr};
+Node node741 = {&next741, &term54, nullptr};
+Node node742 = {&next742, &term80, nullptr};
+Node node743 = {&next743, &term106, nullptr};
+Node node744 = {&next744, &term132, nullptr};
+Node node745 = {&next745, &term158, nullptr};
+Node node746 = {&next746, &term184, nullptr};
+Node node747 = {&next747, &term210, nullptr};
+Node node748 = {&next748, &term236, nullptr};
+Node node749 = {&next749, &term262, nullptr};
+Node node750 = {&next750, &term288, nullptr};
+Node node751 = {&next751, &term314, nullptr};
+Node node752 = {&next752, &term340, nullptr};
+Node node753 = {&next753, &term366, nullptr};
+Node node754 = {&next754, &term392, nullptr};
+Node node755 = {&next755, &term418, nullptr};
+Node node756 = {&next756, &term444, nullptr};
+Node node757 = {&next757, &term470, nullptr};
+Node node758 = {&next758, &term496, nullptr};
+Node node759 = {&next759, &term522, nullptr};
+Node node760 = {&next760, &term548, nullptr};
+Node node761 = {&next761, &term574, nullptr};
+Node node762 = {&next762, &term600, nullptr};
+Node node763 = {&next763, &term626, nullptr};
+Node node764 = {&next764, &term652, nullptr};
+Node node765 = {&next765, &term782, nullptr};
+Node node766 = {&next766, &term756, nullptr};
+Node node767 = {&next767, &term730, nullptr};
+Node node768 = {&next768, &term704, nullptr};
+Node node769 = {&next769, &term678, nullptr};
+Node node770 = {&next770, &term802, nullptr};
+Node node771 = {&next771, &term27, nullptr};
+Node node772 = {&next772, &term53, nullptr};
+Node node773 = {&next773, &term79, nullptr};
+Node node774 = {&next774, &term105, nullptr};
+Node node775 = {&next775, &term131, nullptr};
+Node node776 = {&next776, &term157, nullptr};
+Node node777 = {&next777, &term183, nullptr};
+Node node778 = {&next778, &term209, nullptr};
+Node node779 = {&next779, &term235, nullptr};
+Node node780 = {&next780, &term261, nullptr};
+Node node781 = {&next781, &term287, nullptr};
+Node node782 = {&next782, &term313, nullptr};
+Node node783 = {&next783, &term339, nullptr};
+Node node784 = {&next784, &term365, nullptr};
+Node node785 = {&next785, &term391, nullptr};
+Node node786 = {&next786, &term417, nullptr};
+Node node787 = {&next787, &term443, nullptr};
+Node node788 = {&next788, &term469, nullptr};
+Node node789 = {&next789, &term495, nullptr};
+Node node790 = {&next790, &term521, nullptr};
+Node node791 = {&next791, &term547, nullptr};
+Node node792 = {&next792, &term573, nullptr};
+Node node793 = {&next793, &term599, nullptr};
+Node node794 = {&next794, &term625, nullptr};
+Node node795 = {&next795, &term651, nullptr};
+Node node796 = {&next796, &term781, nullptr};
+Node node797 = {&next797, &term755, nullptr};
+Node node798 = {&next798, &term729, nullptr};
+Node node799 = {&next799, &term703, nullptr};
+Node node800 = {&next800, &term677, nullptr};
+Node node801 = {&next801, &term802, nullptr};
+Node node802 = {&next802, &term26, nullptr};
+Node node803 = {&next803, &term52, nullptr};
+Node node804 = {&next804, &term78, nullptr};
+Node node805 = {&next805, &term104, nullptr};
+Node node806 = {&next806, &term130, nullptr};
+Node node807 = {&next807, &term156, nullptr};
+Node node808 = {&next808, &term182, nullptr};
+Node node809 = {&next809, &term208, nullptr};
+Node node810 = {&next810, &term234, nullptr};
+Node node811 = {&next811, &term260, nullptr};
+Node node812 = {&next812, &term286, nullptr};
+Node node813 = {&next813, &term312, nullptr};
+Node node814 = {&next814, &term338, nullptr};
+Node node815 = {&next815, &term364, nullptr};
+Node node816 = {&next816, &term390, nullptr};
+Node node817 = {&next817, &term416, nullptr};
+Node node818 = {&next818, &term442, nullptr};
+Node node819 = {&next819, &term468, nullptr};
+Node node820 = {&next820, &term494, nullptr};
+Node node821 = {&next821, &term520, nullptr};
+Node node822 = {&next822, &term546, nullptr};
+Node node823 = {&next823, &term572, nullptr};
+Node node824 = {&next824, &term598, nullptr};
+Node node825 = {&next825, &term624, nullptr};
+Node node826 = {&next826, &term650, nullptr};
+Node node827 = {&next827, &term780, nullptr};
+Node node828 = {&next828, &term754, nullptr};
+Node node829 = {&next829, &term728, nullptr};
+Node node830 = {&next830, &term702, nullptr};
+Node node831 = {&next831, &term676, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 804};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_2(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_3(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_4(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_5(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_6(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_7(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_8(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_9(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_10(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_11(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_12(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_13(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_14(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_15(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_16(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_17(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_18(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_19(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_20(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_21(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_22(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_23(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_24(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_25(Table*);
+
+Value*
+reduce_stmt_25(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_25(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_26(Table*);
+
+Value*
+reduce_stmt_26(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_26(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_27(Table*);
+
+Value*
+reduce_stmt_27(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_27(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_28(Table*);
+
+Value*
+reduce_stmt_28(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_28(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_29(Table*);
+
+Value*
+reduce_stmt_29(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_29(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_30(Table*);
+
+Value*
+reduce_stmt_30(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_30(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_31(Table*);
+
+Value*
+reduce_stmt_31(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_31(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_32(Table*);
+
+Value*
+reduce_stmt_32(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_32(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_33(Table*);
+
+Value*
+reduce_stmt_33(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_33(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_34(Table*);
+
+Value*
+reduce_stmt_34(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_34(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_35(Table*);
+
+Value*
+reduce_stmt_35(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_35(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_36(Table*);
+
+Value*
+reduce_stmt_36(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_36(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_37(Table*);
+
+Value*
+reduce_stmt_37(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_37(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_38(Table*);
+
+Value*
+reduce_stmt_38(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_38(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_39(Table*);
+
+Value*
+reduce_stmt_39(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_39(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_40(Table*);
+
+Value*
+reduce_stmt_40(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_40(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_41(Table*);
+
+Value*
+reduce_stmt_41(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_41(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_42(Table*);
+
+Value*
+reduce_stmt_42(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_42(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_43(Table*);
+
+Value*
+reduce_stmt_43(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_43(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_44(Table*);
+
+Value*
+reduce_stmt_44(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_44(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_45(Table*);
+
+Value*
+reduce_stmt_45(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_45(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_46(Table*);
+
+Value*
+reduce_stmt_46(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_46(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_47(Table*);
+
+Value*
+reduce_stmt_47(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_47(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_48(Table*);
+
+Value*
+reduce_stmt_48(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_48(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_49(Table*);
+
+Value*
+reduce_stmt_49(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_49(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_50(Table*);
+
+Value*
+reduce_stmt_50(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_50(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_51(Table*);
+
+Value*
+reduce_stmt_51(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_51(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_52(Table*);
+
+Value*
+reduce_stmt_52(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_52(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_53(Table*);
+
+Value*
+reduce_stmt_53(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_53(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_54(Table*);
+
+Value*
+reduce_stmt_54(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_54(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_55(Table*);
+
+Value*
+reduce_stmt_55(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_55(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_56(Table*);
+
+Value*
+reduce_stmt_56(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_56(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_57(Table*);
+
+Value*
+reduce_stmt_57(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_57(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_58(Table*);
+
+Value*
+reduce_stmt_58(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_58(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_59(Table*);
+
+Value*
+reduce_stmt_59(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_59(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_60(Table*);
+
+Value*
+reduce_stmt_60(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_60(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_61(Table*);
+
+Value*
+reduce_stmt_61(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_61(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_62(Table*);
+
+Value*
+reduce_stmt_62(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_62(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_63(Table*);
+
+Value*
+reduce_stmt_63(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_63(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_64(Table*);
+
+Value*
+reduce_stmt_64(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_64(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_65(Table*);
+
+Value*
+reduce_stmt_65(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_65(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_66(Table*);
+
+Value*
+reduce_stmt_66(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_66(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_67(Table*);
+
+Value*
+reduce_stmt_67(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_67(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_68(Table*);
+
+Value*
+reduce_stmt_68(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_68(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_69(Table*);
+
+Value*
+reduce_stmt_69(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_69(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_70(Table*);
+
+Value*
+reduce_stmt_70(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_70(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_71(Table*);
+
+Value*
+reduce_stmt_71(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_71(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_72(Table*);
+
+Value*
+reduce_stmt_72(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_72(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_73(Table*);
+
+Value*
+reduce_stmt_73(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_73(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_74(Table*);
+
+Value*
+reduce_stmt_74(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_74(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_75(Table*);
+
+Value*
+reduce_stmt_75(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_75(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_76(Table*);
+
+Value*
+reduce_stmt_76(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_76(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_77(Table*);
+
+Value*
+reduce_stmt_77(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_77(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_78(Table*);
+
+Value*
+reduce_stmt_78(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_78(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_79(Table*);
+
+Value*
+reduce_stmt_79(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_79(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_80(Table*);
+
+Value*
+reduce_stmt_80(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_80(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_81(Table*);
+
+Value*
+reduce_stmt_81(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_81(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_82(Table*);
+
+Value*
+reduce_stmt_82(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_82(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_83(Table*);
+
+Value*
+reduce_stmt_83(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_83(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_84(Table*);
+
+Value*
+reduce_stmt_84(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_84(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_85(Table*);
+
+Value*
+reduce_stmt_85(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_85(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_86(Table*);
+
+Value*
+reduce_stmt_86(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_86(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_87(Table*);
+
+Value*
+reduce_stmt_87(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_87(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_88(Table*);
+
+Value*
+reduce_stmt_88(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_88(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_89(Table*);
+
+Value*
+reduce_stmt_89(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_89(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_90(Table*);
+
+Value*
+reduce_stmt_90(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_90(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_91(Table*);
+
+Value*
+reduce_stmt_91(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_91(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_92(Table*);
+
+Value*
+reduce_stmt_92(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_92(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_93(Table*);
+
+Value*
+reduce_stmt_93(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_93(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_94(Table*);
+
+Value*
+reduce_stmt_94(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_94(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_95(Table*);
+
+Value*
+reduce_stmt_95(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_95(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_96(Table*);
+
+Value*
+reduce_stmt_96(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_96(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_97(Table*);
+
+Value*
+reduce_stmt_97(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_97(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_98(Table*);
+
+Value*
+reduce_stmt_98(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_98(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_99(Table*);
+
+Value*
+reduce_stmt_99(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_99(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_100(Table*);
+
+Value*
+reduce_stmt_100(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_100(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_101(Table*);
+
+Value*
+reduce_stmt_101(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_101(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_102(Table*);
+
+Value*
+reduce_stmt_102(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_102(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_103(Table*);
+
+Value*
+reduce_stmt_103(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_103(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_104(Table*);
+
+Value*
+reduce_stmt_104(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_104(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_105(Table*);
+
+Value*
+reduce_stmt_105(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_105(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_106(Table*);
+
+Value*
+reduce_stmt_106(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_106(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_107(Table*);
+
+Value*
+reduce_stmt_107(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_107(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_108(Table*);
+
+Value*
+reduce_stmt_108(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_108(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_109(Table*);
+
+Value*
+reduce_stmt_109(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_109(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_110(Table*);
+
+Value*
+reduce_stmt_110(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_110(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_111(Table*);
+
+Value*
+reduce_stmt_111(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_111(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_112(Table*);
+
+Value*
+reduce_stmt_112(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_112(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_113(Table*);
+
+Value*
+reduce_stmt_113(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_113(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_114(Table*);
+
+Value*
+reduce_stmt_114(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_114(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_115(Table*);
+
+Value*
+reduce_stmt_115(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_115(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_116(Table*);
+
+Value*
+reduce_stmt_116(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_116(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_117(Table*);
+
+Value*
+reduce_stmt_117(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_117(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_118(Table*);
+
+Value*
+reduce_stmt_118(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_118(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_119(Table*);
+
+Value*
+reduce_stmt_119(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_119(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_120(Table*);
+
+Value*
+reduce_stmt_120(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_120(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_121(Table*);
+
+Value*
+reduce_stmt_121(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_121(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_122(Table*);
+
+Value*
+reduce_stmt_122(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_122(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_123(Table*);
+
+Value*
+reduce_stmt_123(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_123(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_124(Table*);
+
+Value*
+reduce_stmt_124(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_124(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_125(Table*);
+
+Value*
+reduce_stmt_125(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_125(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_126(Table*);
+
+Value*
+reduce_stmt_126(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_126(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_127(Table*);
+
+Value*
+reduce_stmt_127(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_127(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_128(Table*);
+
+Value*
+reduce_stmt_128(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_128(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_129(Table*);
+
+Value*
+reduce_stmt_129(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_129(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_130(Table*);
+
+Value*
+reduce_stmt_130(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_130(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_131(Table*);
+
+Value*
+reduce_stmt_131(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_131(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_132(Table*);
+
+Value*
+reduce_stmt_132(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_132(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_133(Table*);
+
+Value*
+reduce_stmt_133(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_133(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_134(Table*);
+
+Value*
+reduce_stmt_134(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_134(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_135(Table*);
+
+Value*
+reduce_stmt_135(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_135(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_136(Table*);
+
+Value*
+reduce_stmt_136(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_136(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_137(Table*);
+
+Value*
+reduce_stmt_137(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_137(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_138(Table*);
+
+Value*
+reduce_stmt_138(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_138(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_139(Table*);
+
+Value*
+reduce_stmt_139(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_139(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_140(Table*);
+
+Value*
+reduce_stmt_140(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_140(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_141(Table*);
+
+Value*
+reduce_stmt_141(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_141(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_142(Table*);
+
+Value*
+reduce_stmt_142(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_142(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_143(Table*);
+
+Value*
+reduce_stmt_143(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_143(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_144(Table*);
+
+Value*
+reduce_stmt_144(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_144(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_145(Table*);
+
+Value*
+reduce_stmt_145(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_145(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_146(Table*);
+
+Value*
+reduce_stmt_146(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_146(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_147(Table*);
+
+Value*
+reduce_stmt_147(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_147(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_148(Table*);
+
+Value*
+reduce_stmt_148(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_148(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_149(Table*);
+
+Value*
+reduce_stmt_149(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_149(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_150(Table*);
+
+Value*
+reduce_stmt_150(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_150(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_151(Table*);
+
+Value*
+reduce_stmt_151(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_151(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_152(Table*);
+
+Value*
+reduce_stmt_152(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_152(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_153(Table*);
+
+Value*
+reduce_stmt_153(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_153(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_154(Table*);
+
+Value*
+reduce_stmt_154(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_154(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_155(Table*);
+
+Value*
+reduce_stmt_155(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_155(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_156(Table*);
+
+Value*
+reduce_stmt_156(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_156(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_157(Table*);
+
+Value*
+reduce_stmt_157(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_157(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_158(Table*);
+
+Value*
+reduce_stmt_158(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_158(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_159(Table*);
+
+Value*
+reduce_stmt_159(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_159(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_160(Table*);
+
+Value*
+reduce_stmt_160(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_160(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_161(Table*);
+
+Value*
+reduce_stmt_161(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_161(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_162(Table*);
+
+Value*
+reduce_stmt_162(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_162(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_163(Table*);
+
+Value*
+reduce_stmt_163(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_163(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_164(Table*);
+
+Value*
+reduce_stmt_164(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_164(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_165(Table*);
+
+Value*
+reduce_stmt_165(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_165(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_166(Table*);
+
+Value*
+reduce_stmt_166(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_166(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_167(Table*);
+
+Value*
+reduce_stmt_167(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_167(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_168(Table*);
+
+Value*
+reduce_stmt_168(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_168(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_169(Table*);
+
+Value*
+reduce_stmt_169(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_169(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_170(Table*);
+
+Value*
+reduce_stmt_170(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_170(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_171(Table*);
+
+Value*
+reduce_stmt_171(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_171(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_172(Table*);
+
+Value*
+reduce_stmt_172(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_172(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_173(Table*);
+
+Value*
+reduce_stmt_173(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_173(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_174(Table*);
+
+Value*
+reduce_stmt_174(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_174(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_175(Table*);
+
+Value*
+reduce_stmt_175(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_175(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_176(Table*);
+
+Value*
+reduce_stmt_176(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_176(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_177(Table*);
+
+Value*
+reduce_stmt_177(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_177(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_178(Table*);
+
+Value*
+reduce_stmt_178(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_178(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_179(Table*);
+
+Value*
+reduce_stmt_179(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_179(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_180(Table*);
+
+Value*
+reduce_stmt_180(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_180(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_181(Table*);
+
+Value*
+reduce_stmt_181(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_181(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_182(Table*);
+
+Value*
+reduce_stmt_182(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_182(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_183(Table*);
+
+Value*
+reduce_stmt_183(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_183(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_184(Table*);
+
+Value*
+reduce_stmt_184(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_184(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_185(Table*);
+
+Value*
+reduce_stmt_185(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_185(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_186(Table*);
+
+Value*
+reduce_stmt_186(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_186(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_187(Table*);
+
+Value*
+reduce_stmt_187(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_187(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_188(Table*);
+
+Value*
+reduce_stmt_188(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_188(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_189(Table*);
+
+Value*
+reduce_stmt_189(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_189(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_190(Table*);
+
+Value*
+reduce_stmt_190(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_190(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_191(Table*);
+
+Value*
+reduce_stmt_191(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_191(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_192(Table*);
+
+Value*
+reduce_stmt_192(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_192(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_193(Table*);
+
+Value*
+reduce_stmt_193(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_193(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_194(Table*);
+
+Value*
+reduce_stmt_194(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_194(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_195(Table*);
+
+Value*
+reduce_stmt_195(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_195(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_196(Table*);
+
+Value*
+reduce_stmt_196(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_196(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_197(Table*);
+
+Value*
+reduce_stmt_197(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_197(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_198(Table*);
+
+Value*
+reduce_stmt_198(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_198(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_199(Table*);
+
+Value*
+reduce_stmt_199(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_199(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_200(Table*);
+
+Value*
+reduce_stmt_200(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_200(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_201(Table*);
+
+Value*
+reduce_stmt_201(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_201(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_202(Table*);
+
+Value*
+reduce_stmt_202(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_202(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_203(Table*);
+
+Value*
+reduce_stmt_203(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_203(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_204(Table*);
+
+Value*
+reduce_stmt_204(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_204(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_205(Table*);
+
+Value*
+reduce_stmt_205(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_205(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_206(Table*);
+
+Value*
+reduce_stmt_206(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_206(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_207(Table*);
+
+Value*
+reduce_stmt_207(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_207(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_208(Table*);
+
+Value*
+reduce_stmt_208(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_208(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_209(Table*);
+
+Value*
+reduce_stmt_209(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_209(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_210(Table*);
+
+Value*
+reduce_stmt_210(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_210(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_211(Table*);
+
+Value*
+reduce_stmt_211(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_211(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_212(Table*);
+
+Value*
+reduce_stmt_212(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_212(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_213(Table*);
+
+Value*
+reduce_stmt_213(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_213(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_214(Table*);
+
+Value*
+reduce_stmt_214(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_214(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_215(Table*);
+
+Value*
+reduce_stmt_215(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_215(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_216(Table*);
+
+Value*
+reduce_stmt_216(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_216(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_217(Table*);
+
+Value*
+reduce_stmt_217(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_217(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_218(Table*);
+
+Value*
+reduce_stmt_218(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_218(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_219(Table*);
+
+Value*
+reduce_stmt_219(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_219(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_220(Table*);
+
+Value*
+reduce_stmt_220(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_220(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_221(Table*);
+
+Value*
+reduce_stmt_221(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_221(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_222(Table*);
+
+Value*
+reduce_stmt_222(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_222(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_223(Table*);
+
+Value*
+reduce_stmt_223(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_223(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_224(Table*);
+
+Value*
+reduce_stmt_224(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_224(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_225(Table*);
+
+Value*
+reduce_stmt_225(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_225(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_226(Table*);
+
+Value*
+reduce_stmt_226(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_226(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_227(Table*);
+
+Value*
+reduce_stmt_227(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_227(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_228(Table*);
+
+Value*
+reduce_stmt_228(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_228(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_229(Table*);
+
+Value*
+reduce_stmt_229(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_229(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_230(Table*);
+
+Value*
+reduce_stmt_230(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_230(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_231(Table*);
+
+Value*
+reduce_stmt_231(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_231(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_232(Table*);
+
+Value*
+reduce_stmt_232(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_232(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_233(Table*);
+
+Value*
+reduce_stmt_233(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_233(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_234(Table*);
+
+Value*
+reduce_stmt_234(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_234(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_235(Table*);
+
+Value*
+reduce_stmt_235(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_235(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_236(Table*);
+
+Value*
+reduce_stmt_236(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_236(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_237(Table*);
+
+Value*
+reduce_stmt_237(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_237(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_238(Table*);
+
+Value*
+reduce_stmt_238(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_238(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_239(Table*);
+
+Value*
+reduce_stmt_239(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_239(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_240(Table*);
+
+Value*
+reduce_stmt_240(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_240(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_241(Table*);
+
+Value*
+reduce_stmt_241(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_241(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_242(Table*);
+
+Value*
+reduce_stmt_242(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_242(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_243(Table*);
+
+Value*
+reduce_stmt_243(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_243(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_244(Table*);
+
+Value*
+reduce_stmt_244(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_244(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_245(Table*);
+
+Value*
+reduce_stmt_245(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_245(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_246(Table*);
+
+Value*
+reduce_stmt_246(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_246(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_247(Table*);
+
+Value*
+reduce_stmt_247(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_247(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_248(Table*);
+
+Value*
+reduce_stmt_248(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_248(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_249(Table*);
+
+Value*
+reduce_stmt_249(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_249(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_250(Table*);
+
+Value*
+reduce_stmt_250(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_250(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_251(Table*);
+
+Value*
+reduce_stmt_251(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_251(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_252(Table*);
+
+Value*
+reduce_stmt_252(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_252(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_253(Table*);
+
+Value*
+reduce_stmt_253(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_253(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_254(Table*);
+
+Value*
+reduce_stmt_254(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_254(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_255(Table*);
+
+Value*
+reduce_stmt_255(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_255(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_256(Table*);
+
+Value*
+reduce_stmt_256(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_256(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_257(Table*);
+
+Value*
+reduce_stmt_257(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_257(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_258(Table*);
+
+Value*
+reduce_stmt_258(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_258(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_259(Table*);
+
+Value*
+reduce_stmt_259(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_259(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_260(Table*);
+
+Value*
+reduce_stmt_260(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_260(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_261(Table*);
+
+Value*
+reduce_stmt_261(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_261(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_262(Table*);
+
+Value*
+reduce_stmt_262(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_262(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_263(Table*);
+
+Value*
+reduce_stmt_263(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_263(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_264(Table*);
+
+Value*
+reduce_stmt_264(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_264(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_265(Table*);
+
+Value*
+reduce_stmt_265(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_265(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_266(Table*);
+
+Value*
+reduce_stmt_266(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_266(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_267(Table*);
+
+Value*
+reduce_stmt_267(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_267(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_268(Table*);
+
+Value*
+reduce_stmt_268(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_268(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_269(Table*);
+
+Value*
+reduce_stmt_269(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_269(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_270(Table*);
+
+Value*
+reduce_stmt_270(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_270(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_271(Table*);
+
+Value*
+reduce_stmt_271(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_271(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_272(Table*);
+
+Value*
+reduce_stmt_272(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_272(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_273(Table*);
+
+Value*
+reduce_stmt_273(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_273(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_274(Table*);
+
+Value*
+reduce_stmt_274(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_274(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_275(Table*);
+
+Value*
+reduce_stmt_275(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_275(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_276(Table*);
+
+Value*
+reduce_stmt_276(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_276(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_277(Table*);
+
+Value*
+reduce_stmt_277(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_277(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_278(Table*);
+
+Value*
+reduce_stmt_278(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_278(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_279(Table*);
+
+Value*
+reduce_stmt_279(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_279(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_280(Table*);
+
+Value*
+reduce_stmt_280(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_280(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_281(Table*);
+
+Value*
+reduce_stmt_281(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_281(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_282(Table*);
+
+Value*
+reduce_stmt_282(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_282(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_283(Table*);
+
+Value*
+reduce_stmt_283(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_283(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_284(Table*);
+
+Value*
+reduce_stmt_284(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_284(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_285(Table*);
+
+Value*
+reduce_stmt_285(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_285(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_286(Table*);
+
+Value*
+reduce_stmt_286(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_286(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_287(Table*);
+
+Value*
+reduce_stmt_287(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_287(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_288(Table*);
+
+Value*
+reduce_stmt_288(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_288(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_289(Table*);
+
+Value*
+reduce_stmt_289(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_289(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_290(Table*);
+
+Value*
+reduce_stmt_290(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_290(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_291(Table*);
+
+Value*
+reduce_stmt_291(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_291(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_292(Table*);
+
+Value*
+reduce_stmt_292(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_292(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_293(Table*);
+
+Value*
+reduce_stmt_293(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_293(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_294(Table*);
+
+Value*
+reduce_stmt_294(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_294(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_295(Table*);
+
+Value*
+reduce_stmt_295(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_295(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_296(Table*);
+
+Value*
+reduce_stmt_296(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_296(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_297(Table*);
+
+Value*
+reduce_stmt_297(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_297(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_298(Table*);
+
+Value*
+reduce_stmt_298(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_298(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_299(Table*);
+
+Value*
+reduce_stmt_299(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_299(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_300(Table*);
+
+Value*
+reduce_stmt_300(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_300(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_301(Table*);
+
+Value*
+reduce_stmt_301(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_301(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_302(Table*);
+
+Value*
+reduce_stmt_302(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_302(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_303(Table*);
+
+Value*
+reduce_stmt_303(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_303(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_304(Table*);
+
+Value*
+reduce_stmt_304(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_304(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_305(Table*);
+
+Value*
+reduce_stmt_305(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_305(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_306(Table*);
+
+Value*
+reduce_stmt_306(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_306(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_307(Table*);
+
+Value*
+reduce_stmt_307(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_307(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_308(Table*);
+
+Value*
+reduce_stmt_308(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_308(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_309(Table*);
+
+Value*
+reduce_stmt_309(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_309(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_310(Table*);
+
+Value*
+reduce_stmt_310(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_310(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_311(Table*);
+
+Value*
+reduce_stmt_311(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_311(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_312(Table*);
+
+Value*
+reduce_stmt_312(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_312(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_313(Table*);
+
+Value*
+reduce_stmt_313(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_313(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_314(Table*);
+
+Value*
+reduce_stmt_314(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_314(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_315(Table*);
+
+Value*
+reduce_stmt_315(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_315(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_316(Table*);
+
+Value*
+reduce_stmt_316(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_316(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_317(Table*);
+
+Value*
+reduce_stmt_317(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_317(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_318(Table*);
+
+Value*
+reduce_stmt_318(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_318(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_319(Table*);
+
+Value*
+reduce_stmt_319(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_319(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_320(Table*);
+
+Value*
+reduce_stmt_320(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_320(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_321(Table*);
+
+Value*
+reduce_stmt_321(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_321(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_322(Table*);
+
+Value*
+reduce_stmt_322(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_322(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_323(Table*);
+
+Value*
+reduce_stmt_323(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_323(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_324(Table*);
+
+Value*
+reduce_stmt_324(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_324(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_325(Table*);
+
+Value*
+reduce_stmt_325(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_325(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_326(Table*);
+
+Value*
+reduce_stmt_326(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_326(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_327(Table*);
+
+Value*
+reduce_stmt_327(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_327(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_328(Table*);
+
+Value*
+reduce_stmt_328(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_328(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_329(Table*);
+
+Value*
+reduce_stmt_329(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_329(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_330(Table*);
+
+Value*
+reduce_stmt_330(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_330(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_331(Table*);
+
+Value*
+reduce_stmt_331(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_331(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_332(Table*);
+
+Value*
+reduce_stmt_332(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_332(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_333(Table*);
+
+Value*
+reduce_stmt_333(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_333(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_334(Table*);
+
+Value*
+reduce_stmt_334(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_334(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_335(Table*);
+
+Value*
+reduce_stmt_335(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_335(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_336(Table*);
+
+Value*
+reduce_stmt_336(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_336(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_337(Table*);
+
+Value*
+reduce_stmt_337(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_337(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_338(Table*);
+
+Value*
+reduce_stmt_338(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_338(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_339(Table*);
+
+Value*
+reduce_stmt_339(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_339(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_340(Table*);
+
+Value*
+reduce_stmt_340(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_340(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_341(Table*);
+
+Value*
+reduce_stmt_341(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_341(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_342(Table*);
+
+Value*
+reduce_stmt_342(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_342(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_343(Table*);
+
+Value*
+reduce_stmt_343(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_343(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_344(Table*);
+
+Value*
+reduce_stmt_344(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_344(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_345(Table*);
+
+Value*
+reduce_stmt_345(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_345(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_346(Table*);
+
+Value*
+reduce_stmt_346(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_346(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_347(Table*);
+
+Value*
+reduce_stmt_347(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_347(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_348(Table*);
+
+Value*
+reduce_stmt_348(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_348(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_349(Table*);
+
+Value*
+reduce_stmt_349(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_349(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_350(Table*);
+
+Value*
+reduce_stmt_350(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_350(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_351(Table*);
+
+Value*
+reduce_stmt_351(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_351(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_352(Table*);
+
+Value*
+reduce_stmt_352(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_352(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_353(Table*);
+
+Value*
+reduce_stmt_353(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_353(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_354(Table*);
+
+Value*
+reduce_stmt_354(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_354(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_355(Table*);
+
+Value*
+reduce_stmt_355(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_355(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_356(Table*);
+
+Value*
+reduce_stmt_356(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_356(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_357(Table*);
+
+Value*
+reduce_stmt_357(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_357(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_358(Table*);
+
+Value*
+reduce_stmt_358(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_358(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_359(Table*);
+
+Value*
+reduce_stmt_359(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_359(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_360(Table*);
+
+Value*
+reduce_stmt_360(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_360(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_361(Table*);
+
+Value*
+reduce_stmt_361(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_361(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_362(Table*);
+
+Value*
+reduce_stmt_362(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_362(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_363(Table*);
+
+Value*
+reduce_stmt_363(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_363(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_364(Table*);
+
+Value*
+reduce_stmt_364(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_364(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_365(Table*);
+
+Value*
+reduce_stmt_365(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_365(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_366(Table*);
+
+Value*
+reduce_stmt_366(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_366(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_367(Table*);
+
+Value*
+reduce_stmt_367(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_367(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_368(Table*);
+
+Value*
+reduce_stmt_368(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_368(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_369(Table*);
+
+Value*
+reduce_stmt_369(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_369(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_370(Table*);
+
+Value*
+reduce_stmt_370(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_370(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_371(Table*);
+
+Value*
+reduce_stmt_371(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_371(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_372(Table*);
+
+Value*
+reduce_stmt_372(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_372(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_373(Table*);
+
+Value*
+reduce_stmt_373(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_373(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_374(Table*);
+
+Value*
+reduce_stmt_374(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_374(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_375(Table*);
+
+Value*
+reduce_stmt_375(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_375(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_376(Table*);
+
+Value*
+reduce_stmt_376(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_376(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_377(Table*);
+
+Value*
+reduce_stmt_377(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_377(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_378(Table*);
+
+Value*
+reduce_stmt_378(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_378(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_379(Table*);
+
+Value*
+reduce_stmt_379(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_379(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_380(Table*);
+
+Value*
+reduce_stmt_380(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_380(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_381(Table*);
+
+Value*
+reduce_stmt_381(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_381(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_382(Table*);
+
+Value*
+reduce_stmt_382(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_382(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_383(Table*);
+
+Value*
+reduce_stmt_383(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_383(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_384(Table*);
+
+Value*
+reduce_stmt_384(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_384(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_385(Table*);
+
+Value*
+reduce_stmt_385(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_385(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_386(Table*);
+
+Value*
+reduce_stmt_386(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_386(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_387(Table*);
+
+Value*
+reduce_stmt_387(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_387(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_388(Table*);
+
+Value*
+reduce_stmt_388(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_388(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_389(Table*);
+
+Value*
+reduce_stmt_389(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_389(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_390(Table*);
+
+Value*
+reduce_stmt_390(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_390(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_391(Table*);
+
+Value*
+reduce_stmt_391(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_391(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_392(Table*);
+
+Value*
+reduce_stmt_392(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_392(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_393(Table*);
+
+Value*
+reduce_stmt_393(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_393(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_394(Table*);
+
+Value*
+reduce_stmt_394(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_394(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_395(Table*);
+
+Value*
+reduce_stmt_395(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_395(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_396(Table*);
+
+Value*
+reduce_stmt_396(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_396(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_397(Table*);
+
+Value*
+reduce_stmt_397(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_397(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_398(Table*);
+
+Value*
+reduce_stmt_398(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_398(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_399(Table*);
+
+Value*
+reduce_stmt_399(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_399(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_400(Table*);
+
+Value*
+reduce_stmt_400(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_400(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_401(Table*);
+
+Value*
+reduce_stmt_401(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_401(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_402(Table*);
+
+Value*
+reduce_stmt_402(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_402(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_403(Table*);
+
+Value*
+reduce_stmt_403(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_403(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_404(Table*);
+
+Value*
+reduce_stmt_404(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_404(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_405(Table*);
+
+Value*
+reduce_stmt_405(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_405(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_406(Table*);
+
+Value*
+reduce_stmt_406(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_406(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_407(Table*);
+
+Value*
+reduce_stmt_407(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_407(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_408(Table*);
+
+Value*
+reduce_stmt_408(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_408(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_409(Table*);
+
+Value*
+reduce_stmt_409(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_409(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_410(Table*);
+
+Value*
+reduce_stmt_410(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_410(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_411(Table*);
+
+Value*
+reduce_stmt_411(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_411(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_412(Table*);
+
+Value*
+reduce_stmt_412(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_412(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_413(Table*);
+
+Value*
+reduce_stmt_413(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_413(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_414(Table*);
+
+Value*
+reduce_stmt_414(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_414(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_415(Table*);
+
+Value*
+reduce_stmt_415(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_415(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_416(Table*);
+
+Value*
+reduce_stmt_416(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_416(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_417(Table*);
+
+Value*
+reduce_stmt_417(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_417(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_418(Table*);
+
+Value*
+reduce_stmt_418(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_418(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_419(Table*);
+
+Value*
+reduce_stmt_419(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_419(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_420(Table*);
+
+Value*
+reduce_stmt_420(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_420(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_421(Table*);
+
+Value*
+reduce_stmt_421(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_421(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_422(Table*);
+
+Value*
+reduce_stmt_422(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_422(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_423(Table*);
+
+Value*
+reduce_stmt_423(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_423(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_424(Table*);
+
+Value*
+reduce_stmt_424(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_424(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_425(Table*);
+
+Value*
+reduce_stmt_425(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_425(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_426(Table*);
+
+Value*
+reduce_stmt_426(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_426(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_427(Table*);
+
+Value*
+reduce_stmt_427(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_427(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_428(Table*);
+
+Value*
+reduce_stmt_428(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_428(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_429(Table*);
+
+Value*
+reduce_stmt_429(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_429(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_430(Table*);
+
+Value*
+reduce_stmt_430(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_430(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_431(Table*);
+
+Value*
+reduce_stmt_431(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_431(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_432(Table*);
+
+Value*
+reduce_stmt_432(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_432(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_433(Table*);
+
+Value*
+reduce_stmt_433(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_433(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_434(Table*);
+
+Value*
+reduce_stmt_434(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_434(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_435(Table*);
+
+Value*
+reduce_stmt_435(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_435(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_436(Table*);
+
+Value*
+reduce_stmt_436(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_436(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_437(Table*);
+
+Value*
+reduce_stmt_437(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_437(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_438(Table*);
+
+Value*
+reduce_stmt_438(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_438(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_439(Table*);
+
+Value*
+reduce_stmt_439(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_439(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_440(Table*);
+
+Value*
+reduce_stmt_440(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_440(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_441(Table*);
+
+Value*
+reduce_stmt_441(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_441(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_442(Table*);
+
+Value*
+reduce_stmt_442(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_442(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_443(Table*);
+
+Value*
+reduce_stmt_443(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_443(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_444(Table*);
+
+Value*
+reduce_stmt_444(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_444(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_445(Table*);
+
+Value*
+reduce_stmt_445(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_445(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_446(Table*);
+
+Value*
+reduce_stmt_446(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_446(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_447(Table*);
+
+Value*
+reduce_stmt_447(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_447(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_448(Table*);
+
+Value*
+reduce_stmt_448(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_448(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_449(Table*);
+
+Value*
+reduce_stmt_449(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_449(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_450(Table*);
+
+Value*
+reduce_stmt_450(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_450(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_451(Table*);
+
+Value*
+reduce_stmt_451(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_451(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_452(Table*);
+
+Value*
+reduce_stmt_452(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_452(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_453(Table*);
+
+Value*
+reduce_stmt_453(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_453(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_454(Table*);
+
+Value*
+reduce_stmt_454(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_454(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_455(Table*);
+
+Value*
+reduce_stmt_455(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_455(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_456(Table*);
+
+Value*
+reduce_stmt_456(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_456(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_457(Table*);
+
+Value*
+reduce_stmt_457(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_457(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_458(Table*);
+
+Value*
+reduce_stmt_458(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_458(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_459(Table*);
+
+Value*
+reduce_stmt_459(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_459(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_460(Table*);
+
+Value*
+reduce_stmt_460(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_460(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_461(Table*);
+
+Value*
+reduce_stmt_461(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_461(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_462(Table*);
+
+Value*
+reduce_stmt_462(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_462(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_463(Table*);
+
+Value*
+reduce_stmt_463(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_463(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_464(Table*);
+
+Value*
+reduce_stmt_464(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_464(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_465(Table*);
+
+Value*
+reduce_stmt_465(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_465(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_466(Table*);
+
+Value*
+reduce_stmt_466(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_466(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_467(Table*);
+
+Value*
+reduce_stmt_467(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_467(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_468(Table*);
+
+Value*
+reduce_stmt_468(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_468(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_469(Table*);
+
+Value*
+reduce_stmt_469(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_469(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_470(Table*);
+
+Value*
+reduce_stmt_470(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_470(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_471(Table*);
+
+Value*
+reduce_stmt_471(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_471(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_472(Table*);
+
+Value*
+reduce_stmt_472(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_472(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_473(Table*);
+
+Value*
+reduce_stmt_473(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_473(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_474(Table*);
+
+Value*
+reduce_stmt_474(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_474(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_475(Table*);
+
+Value*
+reduce_stmt_475(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_475(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_476(Table*);
+
+Value*
+reduce_stmt_476(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_476(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_477(Table*);
+
+Value*
+reduce_stmt_477(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_477(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_478(Table*);
+
+Value*
+reduce_stmt_478(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_478(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_479(Table*);
+
+Value*
+reduce_stmt_479(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_479(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_480(Table*);
+
+Value*
+reduce_stmt_480(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_480(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_481(Table*);
+
+Value*
+reduce_stmt_481(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_481(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_482(Table*);
+
+Value*
+reduce_stmt_482(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_482(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_483(Table*);
+
+Value*
+reduce_stmt_483(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_483(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_484(Table*);
+
+Value*
+reduce_stmt_484(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_484(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_485(Table*);
+
+Value*
+reduce_stmt_485(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_485(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_486(Table*);
+
+Value*
+reduce_stmt_486(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_486(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_487(Table*);
+
+Value*
+reduce_stmt_487(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_487(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_488(Table*);
+
+Value*
+reduce_stmt_488(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_488(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_489(Table*);
+
+Value*
+reduce_stmt_489(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_489(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_490(Table*);
+
+Value*
+reduce_stmt_490(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_490(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_491(Table*);
+
+Value*
+reduce_stmt_491(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_491(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_492(Table*);
+
+Value*
+reduce_stmt_492(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_492(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_493(Table*);
+
+Value*
+reduce_stmt_493(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_493(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_494(Table*);
+
+Value*
+reduce_stmt_494(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_494(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_495(Table*);
+
+Value*
+reduce_stmt_495(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_495(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_496(Table*);
+
+Value*
+reduce_stmt_496(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_496(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_497(Table*);
+
+Value*
+reduce_stmt_497(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_497(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_498(Table*);
+
+Value*
+reduce_stmt_498(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_498(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_499(Table*);
+
+Value*
+reduce_stmt_499(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_499(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_500(Table*);
+
+Value*
+reduce_stmt_500(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_500(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_501(Table*);
+
+Value*
+reduce_stmt_501(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_501(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_502(Table*);
+
+Value*
+reduce_stmt_502(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_502(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_503(Table*);
+
+Value*
+reduce_stmt_503(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_503(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_504(Table*);
+
+Value*
+reduce_stmt_504(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_504(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_505(Table*);
+
+Value*
+reduce_stmt_505(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_505(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_506(Table*);
+
+Value*
+reduce_stmt_506(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_506(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_507(Table*);
+
+Value*
+reduce_stmt_507(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_507(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_508(Table*);
+
+Value*
+reduce_stmt_508(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_508(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_509(Table*);
+
+Value*
+reduce_stmt_509(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_509(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_510(Table*);
+
+Value*
+reduce_stmt_510(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_510(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_511(Table*);
+
+Value*
+reduce_stmt_511(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_511(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_512(Table*);
+
+Value*
+reduce_stmt_512(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_512(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_513(Table*);
+
+Value*
+reduce_stmt_513(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_513(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_514(Table*);
+
+Value*
+reduce_stmt_514(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_514(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_515(Table*);
+
+Value*
+reduce_stmt_515(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_515(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_516(Table*);
+
+Value*
+reduce_stmt_516(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_516(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_517(Table*);
+
+Value*
+reduce_stmt_517(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_517(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_518(Table*);
+
+Value*
+reduce_stmt_518(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_518(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_519(Table*);
+
+Value*
+reduce_stmt_519(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_519(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_520(Table*);
+
+Value*
+reduce_stmt_520(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_520(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_521(Table*);
+
+Value*
+reduce_stmt_521(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_521(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_522(Table*);
+
+Value*
+reduce_stmt_522(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_522(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_523(Table*);
+
+Value*
+reduce_stmt_523(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_523(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_524(Table*);
+
+Value*
+reduce_stmt_524(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_524(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_525(Table*);
+
+Value*
+reduce_stmt_525(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_525(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_526(Table*);
+
+Value*
+reduce_stmt_526(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_526(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_527(Table*);
+
+Value*
+reduce_stmt_527(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_527(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_528(Table*);
+
+Value*
+reduce_stmt_528(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_528(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_529(Table*);
+
+Value*
+reduce_stmt_529(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_529(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_530(Table*);
+
+Value*
+reduce_stmt_530(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_530(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_531(Table*);
+
+Value*
+reduce_stmt_531(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_531(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_532(Table*);
+
+Value*
+reduce_stmt_532(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_532(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_533(Table*);
+
+Value*
+reduce_stmt_533(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_533(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_534(Table*);
+
+Value*
+reduce_stmt_534(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_534(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_535(Table*);
+
+Value*
+reduce_stmt_535(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_535(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_536(Table*);
+
+Value*
+reduce_stmt_536(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_536(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_537(Table*);
+
+Value*
+reduce_stmt_537(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_537(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_538(Table*);
+
+Value*
+reduce_stmt_538(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_538(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_539(Table*);
+
+Value*
+reduce_stmt_539(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_539(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_540(Table*);
+
+Value*
+reduce_stmt_540(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_540(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_541(Table*);
+
+Value*
+reduce_stmt_541(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_541(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_542(Table*);
+
+Value*
+reduce_stmt_542(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_542(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_543(Table*);
+
+Value*
+reduce_stmt_543(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_543(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_544(Table*);
+
+Value*
+reduce_stmt_544(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_544(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_545(Table*);
+
+Value*
+reduce_stmt_545(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_545(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_546(Table*);
+
+Value*
+reduce_stmt_546(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_546(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_547(Table*);
+
+Value*
+reduce_stmt_547(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_547(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_548(Table*);
+
+Value*
+reduce_stmt_548(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_548(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_549(Table*);
+
+Value*
+reduce_stmt_549(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_549(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_550(Table*);
+
+Value*
+reduce_stmt_550(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_550(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_551(Table*);
+
+Value*
+reduce_stmt_551(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_551(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_552(Table*);
+
+Value*
+reduce_stmt_552(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_552(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_553(Table*);
+
+Value*
+reduce_stmt_553(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_553(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_554(Table*);
+
+Value*
+reduce_stmt_554(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_554(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_555(Table*);
+
+Value*
+reduce_stmt_555(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_555(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_556(Table*);
+
+Value*
+reduce_stmt_556(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_556(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_557(Table*);
+
+Value*
+reduce_stmt_557(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_557(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_558(Table*);
+
+Value*
+reduce_stmt_558(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_558(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_559(Table*);
+
+Value*
+reduce_stmt_559(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_559(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_560(Table*);
+
+Value*
+reduce_stmt_560(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_560(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_561(Table*);
+
+Value*
+reduce_stmt_561(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_561(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_562(Table*);
+
+Value*
+reduce_stmt_562(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_562(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_563(Table*);
+
+Value*
+reduce_stmt_563(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_563(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_564(Table*);
+
+Value*
+reduce_stmt_564(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_564(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_565(Table*);
+
+Value*
+reduce_stmt_565(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_565(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_566(Table*);
+
+Value*
+reduce_stmt_566(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_566(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_567(Table*);
+
+Value*
+reduce_stmt_567(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_567(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_568(Table*);
+
+Value*
+reduce_stmt_568(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_568(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_569(Table*);
+
+Value*
+reduce_stmt_569(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_569(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_570(Table*);
+
+Value*
+reduce_stmt_570(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_570(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_571(Table*);
+
+Value*
+reduce_stmt_571(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_571(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_572(Table*);
+
+Value*
+reduce_stmt_572(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_572(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_573(Table*);
+
+Value*
+reduce_stmt_573(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_573(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_574(Table*);
+
+Value*
+reduce_stmt_574(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_574(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_575(Table*);
+
+Value*
+reduce_stmt_575(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_575(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_576(Table*);
+
+Value*
+reduce_stmt_576(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_576(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_577(Table*);
+
+Value*
+reduce_stmt_577(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_577(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_578(Table*);
+
+Value*
+reduce_stmt_578(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_578(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_579(Table*);
+
+Value*
+reduce_stmt_579(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_579(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_580(Table*);
+
+Value*
+reduce_stmt_580(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_580(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_581(Table*);
+
+Value*
+reduce_stmt_581(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_581(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_582(Table*);
+
+Value*
+reduce_stmt_582(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_582(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_583(Table*);
+
+Value*
+reduce_stmt_583(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_583(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_584(Table*);
+
+Value*
+reduce_stmt_584(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_584(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_585(Table*);
+
+Value*
+reduce_stmt_585(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_585(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_586(Table*);
+
+Value*
+reduce_stmt_586(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_586(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_587(Table*);
+
+Value*
+reduce_stmt_587(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_587(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_588(Table*);
+
+Value*
+reduce_stmt_588(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_588(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_589(Table*);
+
+Value*
+reduce_stmt_589(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_589(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_590(Table*);
+
+Value*
+reduce_stmt_590(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_590(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_591(Table*);
+
+Value*
+reduce_stmt_591(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_591(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_592(Table*);
+
+Value*
+reduce_stmt_592(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_592(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_593(Table*);
+
+Value*
+reduce_stmt_593(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_593(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_594(Table*);
+
+Value*
+reduce_stmt_594(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_594(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_595(Table*);
+
+Value*
+reduce_stmt_595(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_595(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_596(Table*);
+
+Value*
+reduce_stmt_596(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_596(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_597(Table*);
+
+Value*
+reduce_stmt_597(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_597(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_598(Table*);
+
+Value*
+reduce_stmt_598(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_598(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_599(Table*);
+
+Value*
+reduce_stmt_599(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_599(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_600(Table*);
+
+Value*
+reduce_stmt_600(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_600(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_601(Table*);
+
+Value*
+reduce_stmt_601(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_601(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_602(Table*);
+
+Value*
+reduce_stmt_602(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_602(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_603(Table*);
+
+Value*
+reduce_stmt_603(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_603(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_604(Table*);
+
+Value*
+reduce_stmt_604(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_604(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_605(Table*);
+
+Value*
+reduce_stmt_605(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_605(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_606(Table*);
+
+Value*
+reduce_stmt_606(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_606(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_607(Table*);
+
+Value*
+reduce_stmt_607(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_607(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_608(Table*);
+
+Value*
+reduce_stmt_608(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_608(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_609(Table*);
+
+Value*
+reduce_stmt_609(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_609(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_610(Table*);
+
+Value*
+reduce_stmt_610(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_610(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_611(Table*);
+
+Value*
+reduce_stmt_611(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_611(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_612(Table*);
+
+Value*
+reduce_stmt_612(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_612(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_613(Table*);
+
+Value*
+reduce_stmt_613(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_613(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_614(Table*);
+
+Value*
+reduce_stmt_614(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_614(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_615(Table*);
+
+Value*
+reduce_stmt_615(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_615(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_616(Table*);
+
+Value*
+reduce_stmt_616(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_616(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_617(Table*);
+
+Value*
+reduce_stmt_617(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_617(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_618(Table*);
+
+Value*
+reduce_stmt_618(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_618(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_619(Table*);
+
+Value*
+reduce_stmt_619(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_619(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_620(Table*);
+
+Value*
+reduce_stmt_620(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_620(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_621(Table*);
+
+Value*
+reduce_stmt_621(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_621(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_622(Table*);
+
+Value*
+reduce_stmt_622(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_622(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_623(Table*);
+
+Value*
+reduce_stmt_623(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_623(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_624(Table*);
+
+Value*
+reduce_stmt_624(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_624(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_625(Table*);
+
+Value*
+reduce_stmt_625(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_625(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_626(Table*);
+
+Value*
+reduce_stmt_626(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_626(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_627(Table*);
+
+Value*
+reduce_stmt_627(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_627(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_628(Table*);
+
+Value*
+reduce_stmt_628(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_628(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_629(Table*);
+
+Value*
+reduce_stmt_629(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_629(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_630(Table*);
+
+Value*
+reduce_stmt_630(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_630(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_631(Table*);
+
+Value*
+reduce_stmt_631(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_631(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_632(Table*);
+
+Value*
+reduce_stmt_632(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_632(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_633(Table*);
+
+Value*
+reduce_stmt_633(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_633(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_634(Table*);
+
+Value*
+reduce_stmt_634(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_634(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_635(Table*);
+
+Value*
+reduce_stmt_635(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_635(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_636(Table*);
+
+Value*
+reduce_stmt_636(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_636(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_637(Table*);
+
+Value*
+reduce_stmt_637(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_637(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_638(Table*);
+
+Value*
+reduce_stmt_638(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_638(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_639(Table*);
+
+Value*
+reduce_stmt_639(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_639(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_640(Table*);
+
+Value*
+reduce_stmt_640(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_640(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_641(Table*);
+
+Value*
+reduce_stmt_641(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_641(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_642(Table*);
+
+Value*
+reduce_stmt_642(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_642(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_643(Table*);
+
+Value*
+reduce_stmt_643(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_643(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_644(Table*);
+
+Value*
+reduce_stmt_644(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_644(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_645(Table*);
+
+Value*
+reduce_stmt_645(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_645(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_646(Table*);
+
+Value*
+reduce_stmt_646(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_646(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_647(Table*);
+
+Value*
+reduce_stmt_647(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_647(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_648(Table*);
+
+Value*
+reduce_stmt_648(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_648(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_649(Table*);
+
+Value*
+reduce_stmt_649(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_649(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_650(Table*);
+
+Value*
+reduce_stmt_650(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_650(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_651(Table*);
+
+Value*
+reduce_stmt_651(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_651(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_652(Table*);
+
+Value*
+reduce_stmt_652(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_652(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_653(Table*);
+
+Value*
+reduce_stmt_653(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_653(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_654(Table*);
+
+Value*
+reduce_stmt_654(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_654(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_655(Table*);
+
+Value*
+reduce_stmt_655(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_655(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_656(Table*);
+
+Value*
+reduce_stmt_656(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_656(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_657(Table*);
+
+Value*
+reduce_stmt_657(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_657(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_658(Table*);
+
+Value*
+reduce_stmt_658(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_658(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_659(Table*);
+
+Value*
+reduce_stmt_659(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_659(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_660(Table*);
+
+Value*
+reduce_stmt_660(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_660(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_661(Table*);
+
+Value*
+reduce_stmt_661(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_661(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_662(Table*);
+
+Value*
+reduce_stmt_662(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_662(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_663(Table*);
+
+Value*
+reduce_stmt_663(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_663(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_664(Table*);
+
+Value*
+reduce_stmt_664(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_664(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_665(Table*);
+
+Value*
+reduce_stmt_665(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_665(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_666(Table*);
+
+Value*
+reduce_stmt_666(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_666(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_667(Table*);
+
+Value*
+reduce_stmt_667(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_667(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_668(Table*);
+
+Value*
+reduce_stmt_668(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_668(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_669(Table*);
+
+Value*
+reduce_stmt_669(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_669(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_670(Table*);
+
+Value*
+reduce_stmt_670(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_670(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_671(Table*);
+
+Value*
+reduce_stmt_671(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_671(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_672(Table*);
+
+Value*
+reduce_stmt_672(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_672(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_673(Table*);
+
+Value*
+reduce_stmt_673(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_673(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_674(Table*);
+
+Value*
+reduce_stmt_674(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_674(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_675(Table*);
+
+Value*
+reduce_stmt_675(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_675(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_676(Table*);
+
+Value*
+reduce_stmt_676(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_676(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_677(Table*);
+
+Value*
+reduce_stmt_677(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_677(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_678(Table*);
+
+Value*
+reduce_stmt_678(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_678(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_679(Table*);
+
+Value*
+reduce_stmt_679(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_679(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_680(Table*);
+
+Value*
+reduce_stmt_680(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_680(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_681(Table*);
+
+Value*
+reduce_stmt_681(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_681(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_682(Table*);
+
+Value*
+reduce_stmt_682(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_682(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_683(Table*);
+
+Value*
+reduce_stmt_683(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_683(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_684(Table*);
+
+Value*
+reduce_stmt_684(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_684(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_685(Table*);
+
+Value*
+reduce_stmt_685(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_685(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_686(Table*);
+
+Value*
+reduce_stmt_686(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_686(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_687(Table*);
+
+Value*
+reduce_stmt_687(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_687(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_688(Table*);
+
+Value*
+reduce_stmt_688(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_688(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_689(Table*);
+
+Value*
+reduce_stmt_689(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_689(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_690(Table*);
+
+Value*
+reduce_stmt_690(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_690(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_691(Table*);
+
+Value*
+reduce_stmt_691(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_691(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_692(Table*);
+
+Value*
+reduce_stmt_692(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_692(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_693(Table*);
+
+Value*
+reduce_stmt_693(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_693(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_694(Table*);
+
+Value*
+reduce_stmt_694(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_694(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_695(Table*);
+
+Value*
+reduce_stmt_695(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_695(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_696(Table*);
+
+Value*
+reduce_stmt_696(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_696(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_697(Table*);
+
+Value*
+reduce_stmt_697(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_697(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_698(Table*);
+
+Value*
+reduce_stmt_698(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_698(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_699(Table*);
+
+Value*
+reduce_stmt_699(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_699(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_700(Table*);
+
+Value*
+reduce_stmt_700(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_700(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_701(Table*);
+
+Value*
+reduce_stmt_701(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_701(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_702(Table*);
+
+Value*
+reduce_stmt_702(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_702(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_703(Table*);
+
+Value*
+reduce_stmt_703(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_703(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_704(Table*);
+
+Value*
+reduce_stmt_704(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_704(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_705(Table*);
+
+Value*
+reduce_stmt_705(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_705(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_706(Table*);
+
+Value*
+reduce_stmt_706(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_706(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_707(Table*);
+
+Value*
+reduce_stmt_707(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_707(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_708(Table*);
+
+Value*
+reduce_stmt_708(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_708(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_709(Table*);
+
+Value*
+reduce_stmt_709(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_709(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_710(Table*);
+
+Value*
+reduce_stmt_710(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_710(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_711(Table*);
+
+Value*
+reduce_stmt_711(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_711(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_712(Table*);
+
+Value*
+reduce_stmt_712(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_712(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_713(Table*);
+
+Value*
+reduce_stmt_713(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_713(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_714(Table*);
+
+Value*
+reduce_stmt_714(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_714(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_715(Table*);
+
+Value*
+reduce_stmt_715(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_715(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_716(Table*);
+
+Value*
+reduce_stmt_716(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_716(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_717(Table*);
+
+Value*
+reduce_stmt_717(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_717(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_718(Table*);
+
+Value*
+reduce_stmt_718(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_718(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_719(Table*);
+
+Value*
+reduce_stmt_719(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_719(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_720(Table*);
+
+Value*
+reduce_stmt_720(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_720(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_721(Table*);
+
+Value*
+reduce_stmt_721(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_721(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_722(Table*);
+
+Value*
+reduce_stmt_722(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_722(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_723(Table*);
+
+Value*
+reduce_stmt_723(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_723(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_724(Table*);
+
+Value*
+reduce_stmt_724(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_724(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_725(Table*);
+
+Value*
+reduce_stmt_725(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_725(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_726(Table*);
+
+Value*
+reduce_stmt_726(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_726(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_727(Table*);
+
+Value*
+reduce_stmt_727(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_727(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_728(Table*);
+
+Value*
+reduce_stmt_728(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_728(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_729(Table*);
+
+Value*
+reduce_stmt_729(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_729(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_730(Table*);
+
+Value*
+reduce_stmt_730(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_730(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_731(Table*);
+
+Value*
+reduce_stmt_731(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_731(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_732(Table*);
+
+Value*
+reduce_stmt_732(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_732(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_733(Table*);
+
+Value*
+reduce_stmt_733(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_733(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_734(Table*);
+
+Value*
+reduce_stmt_734(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_734(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_735(Table*);
+
+Value*
+reduce_stmt_735(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_735(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_736(Table*);
+
+Value*
+reduce_stmt_736(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_736(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_737(Table*);
+
+Value*
+reduce_stmt_737(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_737(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_738(Table*);
+
+Value*
+reduce_stmt_738(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_738(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_739(Table*);
+
+Value*
+reduce_stmt_739(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_739(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_740(Table*);
+
+Value*
+reduce_stmt_740(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_740(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_741(Table*);
+
+Value*
+reduce_stmt_741(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_741(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_742(Table*);
+
+Value*
+reduce_stmt_742(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_742(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_743(Table*);
+
+Value*
+reduce_stmt_743(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_743(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_744(Table*);
+
+Value*
+reduce_stmt_744(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_744(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_745(Table*);
+
+Value*
+reduce_stmt_745(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_745(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_746(Table*);
+
+Value*
+reduce_stmt_746(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_746(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_747(Table*);
+
+Value*
+reduce_stmt_747(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_747(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_748(Table*);
+
+Value*
+reduce_stmt_748(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_748(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_749(Table*);
+
+Value*
+reduce_stmt_749(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_749(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_750(Table*);
+
+Value*
+reduce_stmt_750(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_750(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_751(Table*);
+
+Value*
+reduce_stmt_751(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_751(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_752(Table*);
+
+Value*
+reduce_stmt_752(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_752(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_753(Table*);
+
+Value*
+reduce_stmt_753(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_753(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_754(Table*);
+
+Value*
+reduce_stmt_754(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_754(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_755(Table*);
+
+Value*
+reduce_stmt_755(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_755(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_756(Table*);
+
+Value*
+reduce_stmt_756(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_756(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_757(Table*);
+
+Value*
+reduce_stmt_757(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_757(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_758(Table*);
+
+Value*
+reduce_stmt_758(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_758(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_759(Table*);
+
+Value*
+reduce_stmt_759(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_759(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_760(Table*);
+
+Value*
+reduce_stmt_760(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_760(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_761(Table*);
+
+Value*
+reduce_stmt_761(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_761(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_762(Table*);
+
+Value*
+reduce_stmt_762(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_762(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_763(Table*);
+
+Value*
+reduce_stmt_763(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_763(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_764(Table*);
+
+Value*
+reduce_stmt_764(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_764(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_765(Table*);
+
+Value*
+reduce_stmt_765(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_765(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_766(Table*);
+
+Value*
+reduce_stmt_766(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_766(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_767(Table*);
+
+Value*
+reduce_stmt_767(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_767(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_768(Table*);
+
+Value*
+reduce_stmt_768(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_768(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_769(Table*);
+
+Value*
+reduce_stmt_769(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_769(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_770(Table*);
+
+Value*
+reduce_stmt_770(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_770(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_771(Table*);
+
+Value*
+reduce_stmt_771(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_771(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_772(Table*);
+
+Value*
+reduce_stmt_772(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_772(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_773(Table*);
+
+Value*
+reduce_stmt_773(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_773(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_774(Table*);
+
+Value*
+reduce_stmt_774(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_774(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_775(Table*);
+
+Value*
+reduce_stmt_775(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_775(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_776(Table*);
+
+Value*
+reduce_stmt_776(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_776(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_777(Table*);
+
+Value*
+reduce_stmt_777(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_777(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_778(Table*);
+
+Value*
+reduce_stmt_778(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_778(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_779(Table*);
+
+Value*
+reduce_stmt_779(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_779(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_780(Table*);
+
+Value*
+reduce_stmt_780(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_780(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_781(Table*);
+
+Value*
+reduce_stmt_781(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_781(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_782(Table*);
+
+Value*
+reduce_stmt_782(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_782(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_783(Table*);
+
+Value*
+reduce_stmt_783(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_783(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_784(Table*);
+
+Value*
+reduce_stmt_784(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_784(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_785(Table*);
+
+Value*
+reduce_stmt_785(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_785(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_786(Table*);
+
+Value*
+reduce_stmt_786(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_786(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_787(Table*);
+
+Value*
+reduce_stmt_787(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_787(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_788(Table*);
+
+Value*
+reduce_stmt_788(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_788(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_789(Table*);
+
+Value*
+reduce_stmt_789(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_789(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_790(Table*);
+
+Value*
+reduce_stmt_790(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_790(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_791(Table*);
+
+Value*
+reduce_stmt_791(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_791(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_792(Table*);
+
+Value*
+reduce_stmt_792(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_792(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_793(Table*);
+
+Value*
+reduce_stmt_793(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_793(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_794(Table*);
+
+Value*
+reduce_stmt_794(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_794(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_795(Table*);
+
+Value*
+reduce_stmt_795(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_795(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_796(Table*);
+
+Value*
+reduce_stmt_796(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_796(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_797(Table*);
+
+Value*
+reduce_stmt_797(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_797(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_798(Table*);
+
+Value*
+reduce_stmt_798(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_798(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_799(Table*);
+
+Value*
+reduce_stmt_799(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_stmt_799(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 3, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 3, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 3, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 3, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 3, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 3, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 3, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 3, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 3, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 3, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 3, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 3, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 3, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 3, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 3, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 3, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 3, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 3, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 3, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 3, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 3, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 3, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 3, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm2, 3, &reduce_stmt_25, -1};
+Rule rule29 = {&nonterm2, 3, &reduce_stmt_26, -1};
+Rule rule30 = {&nonterm2, 3, &reduce_stmt_27, -1};
+Rule rule31 = {&nonterm2, 3, &reduce_stmt_28, -1};
+Rule rule32 = {&nonterm2, 3, &reduce_stmt_29, -1};
+Rule rule33 = {&nonterm2, 3, &reduce_stmt_30, -1};
+Rule rule34 = {&nonterm2, 3, &reduce_stmt_31, -1};
+Rule rule35 = {&nonterm2, 3, &reduce_stmt_32, -1};
+Rule rule36 = {&nonterm2, 3, &reduce_stmt_33, -1};
+Rule rule37 = {&nonterm2, 3, &reduce_stmt_34, -1};
+Rule rule38 = {&nonterm2, 3, &reduce_stmt_35, -1};
+Rule rule39 = {&nonterm2, 3, &reduce_stmt_36, -1};
+Rule rule40 = {&nonterm2, 3, &reduce_stmt_37, -1};
+Rule rule41 = {&nonterm2, 3, &reduce_stmt_38, -1};
+Rule rule42 = {&nonterm2, 3, &reduce_stmt_39, -1};
+Rule rule43 = {&nonterm2, 3, &reduce_stmt_40, -1};
+Rule rule44 = {&nonterm2, 3, &reduce_stmt_41, -1};
+Rule rule45 = {&nonterm2, 3, &reduce_stmt_42, -1};
+Rule rule46 = {&nonterm2, 3, &reduce_stmt_43, -1};
+Rule rule47 = {&nonterm2, 3, &reduce_stmt_44, -1};
+Rule rule48 = {&nonterm2, 3, &reduce_stmt_45, -1};
+Rule rule49 = {&nonterm2, 3, &reduce_stmt_46, -1};
+Rule rule50 = {&nonterm2, 3, &reduce_stmt_47, -1};
+Rule rule51 = {&nonterm2, 3, &reduce_stmt_48, -1};
+Rule rule52 = {&nonterm2, 3, &reduce_stmt_49, -1};
+Rule rule53 = {&nonterm2, 3, &reduce_stmt_50, -1};
+Rule rule54 = {&nonterm2, 3, &reduce_stmt_51, -1};
+Rule rule55 = {&nonterm2, 3, &reduce_stmt_52, -1};
+Rule rule56 = {&nonterm2, 3, &reduce_stmt_53, -1};
+Rule rule57 = {&nonterm2, 3, &reduce_stmt_54, -1};
+Rule rule58 = {&nonterm2, 3, &reduce_stmt_55, -1};
+Rule rule59 = {&nonterm2, 3, &reduce_stmt_56, -1};
+Rule rule60 = {&nonterm2, 3, &reduce_stmt_57, -1};
+Rule rule61 = {&nonterm2, 3, &reduce_stmt_58, -1};
+Rule rule62 = {&nonterm2, 3, &reduce_stmt_59, -1};
+Rule rule63 = {&nonterm2, 3, &reduce_stmt_60, -1};
+Rule rule64 = {&nonterm2, 3, &reduce_stmt_61, -1};
+Rule rule65 = {&nonterm2, 3, &reduce_stmt_62, -1};
+Rule rule66 = {&nonterm2, 3, &reduce_stmt_63, -1};
+Rule rule67 = {&nonterm2, 3, &reduce_stmt_64, -1};
+Rule rule68 = {&nonterm2, 3, &reduce_stmt_65, -1};
+Rule rule69 = {&nonterm2, 3, &reduce_stmt_66, -1};
+Rule rule70 = {&nonterm2, 3, &reduce_stmt_67, -1};
+Rule rule71 = {&nonterm2, 3, &reduce_stmt_68, -1};
+Rule rule72 = {&nonterm2, 3, &reduce_stmt_69, -1};
+Rule rule73 = {&nonterm2, 3, &reduce_stmt_70, -1};
+Rule rule74 = {&nonterm2, 3, &reduce_stmt_71, -1};
+Rule rule75 = {&nonterm2, 3, &reduce_stmt_72, -1};
+Rule rule76 = {&nonterm2, 3, &reduce_stmt_73, -1};
+Rule rule77 = {&nonterm2, 3, &reduce_stmt_74, -1};
+Rule rule78 = {&nonterm2, 3, &reduce_stmt_75, -1};
+Rule rule79 = {&nonterm2, 3, &reduce_stmt_76, -1};
+Rule rule80 = {&nonterm2, 3, &reduce_stmt_77, -1};
+Rule rule81 = {&nonterm2, 3, &reduce_stmt_78, -1};
+Rule rule82 = {&nonterm2, 3, &reduce_stmt_79, -1};
+Rule rule83 = {&nonterm2, 3, &reduce_stmt_80, -1};
+Rule rule84 = {&nonterm2, 3, &reduce_stmt_81, -1};
+Rule rule85 = {&nonterm2, 3, &reduce_stmt_82, -1};
+Rule rule86 = {&nonterm2, 3, &reduce_stmt_83, -1};
+Rule rule87 = {&nonterm2, 3, &reduce_stmt_84, -1};
+Rule rule88 = {&nonterm2, 3, &reduce_stmt_85, -1};
+Rule rule89 = {&nonterm2, 3, &reduce_stmt_86, -1};
+Rule rule90 = {&nonterm2, 3, &reduce_stmt_87, -1};
+Rule rule91 = {&nonterm2, 3, &reduce_stmt_88, -1};
+Rule rule92 = {&nonterm2, 3, &reduce_stmt_89, -1};
+Rule rule93 = {&nonterm2, 3, &reduce_stmt_90, -1};
+Rule rule94 = {&nonterm2, 3, &reduce_stmt_91, -1};
+Rule rule95 = {&nonterm2, 3, &reduce_stmt_92, -1};
+Rule rule96 = {&nonterm2, 3, &reduce_stmt_93, -1};
+Rule rule97 = {&nonterm2, 3, &reduce_stmt_94, -1};
+Rule rule98 = {&nonterm2, 3, &reduce_stmt_95, -1};
+Rule rule99 = {&nonterm2, 3, &reduce_stmt_96, -1};
+Rule rule100 = {&nonterm2, 3, &reduce_stmt_97, -1};
+Rule rule101 = {&nonterm2, 3, &reduce_stmt_98, -1};
+Rule rule102 = {&nonterm2, 3, &reduce_stmt_99, -1};
+Rule rule103 = {&nonterm2, 3, &reduce_stmt_100, -1};
+Rule rule104 = {&nonterm2, 3, &reduce_stmt_101, -1};
+Rule rule105 = {&nonterm2, 3, &reduce_stmt_102, -1};
+Rule rule106 = {&nonterm2, 3, &reduce_stmt_103, -1};
+Rule rule107 = {&nonterm2, 3, &reduce_stmt_104, -1};
+Rule rule108 = {&nonterm2, 3, &reduce_stmt_105, -1};
+Rule rule109 = {&nonterm2, 3, &reduce_stmt_106, -1};
+Rule rule110 = {&nonterm2, 3, &reduce_stmt_107, -1};
+Rule rule111 = {&nonterm2, 3, &reduce_stmt_108, -1};
+Rule rule112 = {&nonterm2, 3, &reduce_stmt_109, -1};
+Rule rule113 = {&nonterm2, 3, &reduce_stmt_110, -1};
+Rule rule114 = {&nonterm2, 3, &reduce_stmt_111, -1};
+Rule rule115 = {&nonterm2, 3, &reduce_stmt_112, -1};
+Rule rule116 = {&nonterm2, 3, &reduce_stmt_113, -1};
+Rule rule117 = {&nonterm2, 3, &reduce_stmt_114, -1};
+Rule rule118 = {&nonterm2, 3, &reduce_stmt_115, -1};
+Rule rule119 = {&nonterm2, 3, &reduce_stmt_116, -1};
+Rule rule120 = {&nonterm2, 3, &reduce_stmt_117, -1};
+Rule rule121 = {&nonterm2, 3, &reduce_stmt_118, -1};
+Rule rule122 = {&nonterm2, 3, &reduce_stmt_119, -1};
+Rule rule123 = {&nonterm2, 3, &reduce_stmt_120, -1};
+Rule rule124 = {&nonterm2, 3, &reduce_stmt_121, -1};
+Rule rule125 = {&nonterm2, 3, &reduce_stmt_122, -1};
+Rule rule126 = {&nonterm2, 3, &reduce_stmt_123, -1};
+Rule rule127 = {&nonterm2, 3, &reduce_stmt_124, -1};
+Rule rule128 = {&nonterm2, 3, &reduce_stmt_125, -1};
+Rule rule129 = {&nonterm2, 3, &reduce_stmt_126, -1};
+Rule rule130 = {&nonterm2, 3, &reduce_stmt_127, -1};
+Rule rule131 = {&nonterm2, 3, &reduce_stmt_128, -1};
+Rule rule132 = {&nonterm2, 3, &reduce_stmt_129, -1};
+Rule rule133 = {&nonterm2, 3, &reduce_stmt_130, -1};
+Rule rule134 = {&nonterm2, 3, &reduce_stmt_131, -1};
+Rule rule135 = {&nonterm2, 3, &reduce_stmt_132, -1};
+Rule rule136 = {&nonterm2, 3, &reduce_stmt_133, -1};
+Rule rule137 = {&nonterm2, 3, &reduce_stmt_134, -1};
+Rule rule138 = {&nonterm2, 3, &reduce_stmt_135, -1};
+Rule rule139 = {&nonterm2, 3, &reduce_stmt_136, -1};
+Rule rule140 = {&nonterm2, 3, &reduce_stmt_137, -1};
+Rule rule141 = {&nonterm2, 3, &reduce_stmt_138, -1};
+Rule rule142 = {&nonterm2, 3, &reduce_stmt_139, -1};
+Rule rule143 = {&nonterm2, 3, &reduce_stmt_140, -1};
+Rule rule144 = {&nonterm2, 3, &reduce_stmt_141, -1};
+Rule rule145 = {&nonterm2, 3, &reduce_stmt_142, -1};
+Rule rule146 = {&nonterm2, 3, &reduce_stmt_143, -1};
+Rule rule147 = {&nonterm2, 3, &reduce_stmt_144, -1};
+Rule rule148 = {&nonterm2, 3, &reduce_stmt_145, -1};
+Rule rule149 = {&nonterm2, 3, &reduce_stmt_146, -1};
+Rule rule150 = {&nonterm2, 3, &reduce_stmt_147, -1};
+Rule rule151 = {&nonterm2, 3, &reduce_stmt_148, -1};
+Rule rule152 = {&nonterm2, 3, &reduce_stmt_149, -1};
+Rule rule153 = {&nonterm2, 3, &reduce_stmt_150, -1};
+Rule rule154 = {&nonterm2, 3, &reduce_stmt_151, -1};
+Rule rule155 = {&nonterm2, 3, &reduce_stmt_152, -1};
+Rule rule156 = {&nonterm2, 3, &reduce_stmt_153, -1};
+Rule rule157 = {&nonterm2, 3, &reduce_stmt_154, -1};
+Rule rule158 = {&nonterm2, 3, &reduce_stmt_155, -1};
+Rule rule159 = {&nonterm2, 3, &reduce_stmt_156, -1};
+Rule rule160 = {&nonterm2, 3, &reduce_stmt_157, -1};
+Rule rule161 = {&nonterm2, 3, &reduce_stmt_158, -1};
+Rule rule162 = {&nonterm2, 3, &reduce_stmt_159, -1};
+Rule rule163 = {&nonterm2, 3, &reduce_stmt_160, -1};
+Rule rule164 = {&nonterm2, 3, &reduce_stmt_161, -1};
+Rule rule165 = {&nonterm2, 3, &reduce_stmt_162, -1};
+Rule rule166 = {&nonterm2, 3, &reduce_stmt_163, -1};
+Rule rule167 = {&nonterm2, 3, &reduce_stmt_164, -1};
+Rule rule168 = {&nonterm2, 3, &reduce_stmt_165, -1};
+Rule rule169 = {&nonterm2, 3, &reduce_stmt_166, -1};
+Rule rule170 = {&nonterm2, 3, &reduce_stmt_167, -1};
+Rule rule171 = {&nonterm2, 3, &reduce_stmt_168, -1};
+Rule rule172 = {&nonterm2, 3, &reduce_stmt_169, -1};
+Rule rule173 = {&nonterm2, 3, &reduce_stmt_170, -1};
+Rule rule174 = {&nonterm2, 3, &reduce_stmt_171, -1};
+Rule rule175 = {&nonterm2, 3, &reduce_stmt_172, -1};
+Rule rule176 = {&nonterm2, 3, &reduce_stmt_173, -1};
+Rule rule177 = {&nonterm2, 3, &reduce_stmt_174, -1};
+Rule rule178 = {&nonterm2, 3, &reduce_stmt_175, -1};
+Rule rule179 = {&nonterm2, 3, &reduce_stmt_176, -1};
+Rule rule180 = {&nonterm2, 3, &reduce_stmt_177, -1};
+Rule rule181 = {&nonterm2, 3, &reduce_stmt_178, -1};
+Rule rule182 = {&nonterm2, 3, &reduce_stmt_179, -1};
+Rule rule183 = {&nonterm2, 3, &reduce_stmt_180, -1};
+Rule rule184 = {&nonterm2, 3, &reduce_stmt_181, -1};
+Rule rule185 = {&nonterm2, 3, &reduce_stmt_182, -1};
+Rule rule186 = {&nonterm2, 3, &reduce_stmt_183, -1};
+Rule rule187 = {&nonterm2, 3, &reduce_stmt_184, -1};
+Rule rule188 = {&nonterm2, 3, &reduce_stmt_185, -1};
+Rule rule189 = {&nonterm2, 3, &reduce_stmt_186, -1};
+Rule rule190 = {&nonterm2, 3, &reduce_stmt_187, -1};
+Rule rule191 = {&nonterm2, 3, &reduce_stmt_188, -1};
+Rule rule192 = {&nonterm2, 3, &reduce_stmt_189, -1};
+Rule rule193 = {&nonterm2, 3, &reduce_stmt_190, -1};
+Rule rule194 = {&nonterm2, 3, &reduce_stmt_191, -1};
+Rule rule195 = {&nonterm2, 3, &reduce_stmt_192, -1};
+Rule rule196 = {&nonterm2, 3, &reduce_stmt_193, -1};
+Rule rule197 = {&nonterm2, 3, &reduce_stmt_194, -1};
+Rule rule198 = {&nonterm2, 3, &reduce_stmt_195, -1};
+Rule rule199 = {&nonterm2, 3, &reduce_stmt_196, -1};
+Rule rule200 = {&nonterm2, 3, &reduce_stmt_197, -1};
+Rule rule201 = {&nonterm2, 3, &reduce_stmt_198, -1};
+Rule rule202 = {&nonterm2, 3, &reduce_stmt_199, -1};
+Rule rule203 = {&nonterm2, 3, &reduce_stmt_200, -1};
+Rule rule204 = {&nonterm2, 3, &reduce_stmt_201, -1};
+Rule rule205 = {&nonterm2, 3, &reduce_stmt_202, -1};
+Rule rule206 = {&nonterm2, 3, &reduce_stmt_203, -1};
+Rule rule207 = {&nonterm2, 3, &reduce_stmt_204, -1};
+Rule rule208 = {&nonterm2, 3, &reduce_stmt_205, -1};
+Rule rule209 = {&nonterm2, 3, &reduce_stmt_206, -1};
+Rule rule210 = {&nonterm2, 3, &reduce_stmt_207, -1};
+Rule rule211 = {&nonterm2, 3, &reduce_stmt_208, -1};
+Rule rule212 = {&nonterm2, 3, &reduce_stmt_209, -1};
+Rule rule213 = {&nonterm2, 3, &reduce_stmt_210, -1};
+Rule rule214 = {&nonterm2, 3, &reduce_stmt_211, -1};
+Rule rule215 = {&nonterm2, 3, &reduce_stmt_212, -1};
+Rule rule216 = {&nonterm2, 3, &reduce_stmt_213, -1};
+Rule rule217 = {&nonterm2, 3, &reduce_stmt_214, -1};
+Rule rule218 = {&nonterm2, 3, &reduce_stmt_215, -1};
+Rule rule219 = {&nonterm2, 3, &reduce_stmt_216, -1};
+Rule rule220 = {&nonterm2, 3, &reduce_stmt_217, -1};
+Rule rule221 = {&nonterm2, 3, &reduce_stmt_218, -1};
+Rule rule222 = {&nonterm2, 3, &reduce_stmt_219, -1};
+Rule rule223 = {&nonterm2, 3, &reduce_stmt_220, -1};
+Rule rule224 = {&nonterm2, 3, &reduce_stmt_221, -1};
+Rule rule225 = {&nonterm2, 3, &reduce_stmt_222, -1};
+Rule rule226 = {&nonterm2, 3, &reduce_stmt_223, -1};
+Rule rule227 = {&nonterm2, 3, &reduce_stmt_224, -1};
+Rule rule228 = {&nonterm2, 3, &reduce_stmt_225, -1};
+Rule rule229 = {&nonterm2, 3, &reduce_stmt_226, -1};
+Rule rule230 = {&nonterm2, 3, &reduce_stmt_227, -1};
+Rule rule231 = {&nonterm2, 3, &reduce_stmt_228, -1};
+Rule rule232 = {&nonterm2, 3, &reduce_stmt_229, -1};
+Rule rule233 = {&nonterm2, 3, &reduce_stmt_230, -1};
+Rule rule234 = {&nonterm2, 3, &reduce_stmt_231, -1};
+Rule rule235 = {&nonterm2, 3, &reduce_stmt_232, -1};
+Rule rule236 = {&nonterm2, 3, &reduce_stmt_233, -1};
+Rule rule237 = {&nonterm2, 3, &reduce_stmt_234, -1};
+Rule rule238 = {&nonterm2, 3, &reduce_stmt_235, -1};
+Rule rule239 = {&nonterm2, 3, &reduce_stmt_236, -1};
+Rule rule240 = {&nonterm2, 3, &reduce_stmt_237, -1};
+Rule rule241 = {&nonterm2, 3, &reduce_stmt_238, -1};
+Rule rule242 = {&nonterm2, 3, &reduce_stmt_239, -1};
+Rule rule243 = {&nonterm2, 3, &reduce_stmt_240, -1};
+Rule rule244 = {&nonterm2, 3, &reduce_stmt_241, -1};
+Rule rule245 = {&nonterm2, 3, &reduce_stmt_242, -1};
+Rule rule246 = {&nonterm2, 3, &reduce_stmt_243, -1};
+Rule rule247 = {&nonterm2, 3, &reduce_stmt_244, -1};
+Rule rule248 = {&nonterm2, 3, &reduce_stmt_245, -1};
+Rule rule249 = {&nonterm2, 3, &reduce_stmt_246, -1};
+Rule rule250 = {&nonterm2, 3, &reduce_stmt_247, -1};
+Rule rule251 = {&nonterm2, 3, &reduce_stmt_248, -1};
+Rule rule252 = {&nonterm2, 3, &reduce_stmt_249, -1};
+Rule rule253 = {&nonterm2, 3, &reduce_stmt_250, -1};
+Rule rule254 = {&nonterm2, 3, &reduce_stmt_251, -1};
+Rule rule255 = {&nonterm2, 3, &reduce_stmt_252, -1};
+Rule rule256 = {&nonterm2, 3, &reduce_stmt_253, -1};
+Rule rule257 = {&nonterm2, 3, &reduce_stmt_254, -1};
+Rule rule258 = {&nonterm2, 3, &reduce_stmt_255, -1};
+Rule rule259 = {&nonterm2, 3, &reduce_stmt_256, -1};
+Rule rule260 = {&nonterm2, 3, &reduce_stmt_257, -1};
+Rule rule261 = {&nonterm2, 3, &reduce_stmt_258, -1};
+Rule rule262 = {&nonterm2, 3, &reduce_stmt_259, -1};
+Rule rule263 = {&nonterm2, 3, &reduce_stmt_260, -1};
+Rule rule264 = {&nonterm2, 3, &reduce_stmt_261, -1};
+Rule rule265 = {&nonterm2, 3, &reduce_stmt_262, -1};
+Rule rule266 = {&nonterm2, 3, &reduce_stmt_263, -1};
+Rule rule267 = {&nonterm2, 3, &reduce_stmt_264, -1};
+Rule rule268 = {&nonterm2, 3, &reduce_stmt_265, -1};
+Rule rule269 = {&nonterm2, 3, &reduce_stmt_266, -1};
+Rule rule270 = {&nonterm2, 3, &reduce_stmt_267, -1};
+Rule rule271 = {&nonterm2, 3, &reduce_stmt_268, -1};
+Rule rule272 = {&nonterm2, 3, &reduce_stmt_269, -1};
+Rule rule273 = {&nonterm2, 3, &reduce_stmt_270, -1};
+Rule rule274 = {&nonterm2, 3, &reduce_stmt_271, -1};
+Rule rule275 = {&nonterm2, 3, &reduce_stmt_272, -1};
+Rule rule276 = {&nonterm2, 3, &reduce_stmt_273, -1};
+Rule rule277 = {&nonterm2, 3, &reduce_stmt_274, -1};
+Rule rule278 = {&nonterm2, 3, &reduce_stmt_275, -1};
+Rule rule279 = {&nonterm2, 3, &reduce_stmt_276, -1};
+Rule rule280 = {&nonterm2, 3, &reduce_stmt_277, -1};
+Rule rule281 = {&nonterm2, 3, &reduce_stmt_278, -1};
+Rule rule282 = {&nonterm2, 3, &reduce_stmt_279, -1};
+Rule rule283 = {&nonterm2, 3, &reduce_stmt_280, -1};
+Rule rule284 = {&nonterm2, 3, &reduce_stmt_281, -1};
+Rule rule285 = {&nonterm2, 3, &reduce_stmt_282, -1};
+Rule rule286 = {&nonterm2, 3, &reduce_stmt_283, -1};
+Rule rule287 = {&nonterm2, 3, &reduce_stmt_284, -1};
+Rule rule288 = {&nonterm2, 3, &reduce_stmt_285, -1};
+Rule rule289 = {&nonterm2, 3, &reduce_stmt_286, -1};
+Rule rule290 = {&nonterm2, 3, &reduce_stmt_287, -1};
+Rule rule291 = {&nonterm2, 3, &reduce_stmt_288, -1};
+Rule rule292 = {&nonterm2, 3, &reduce_stmt_289, -1};
+Rule rule293 = {&nonterm2, 3, &reduce_stmt_290, -1};
+Rule rule294 = {&nonterm2, 3, &reduce_stmt_291, -1};
+Rule rule295 = {&nonterm2, 3, &reduce_stmt_292, -1};
+Rule rule296 = {&nonterm2, 3, &reduce_stmt_293, -1};
+Rule rule297 = {&nonterm2, 3, &reduce_stmt_294, -1};
+Rule rule298 = {&nonterm2, 3, &reduce_stmt_295, -1};
+Rule rule299 = {&nonterm2, 3, &reduce_stmt_296, -1};
+Rule rule300 = {&nonterm2, 3, &reduce_stmt_297, -1};
+Rule rule301 = {&nonterm2, 3, &reduce_stmt_298, -1};
+Rule rule302 = {&nonterm2, 3, &reduce_stmt_299, -1};
+Rule rule303 = {&nonterm2, 3, &reduce_stmt_300, -1};
+Rule rule304 = {&nonterm2, 3, &reduce_stmt_301, -1};
+Rule rule305 = {&nonterm2, 3, &reduce_stmt_302, -1};
+Rule rule306 = {&nonterm2, 3, &reduce_stmt_303, -1};
+Rule rule307 = {&nonterm2, 3, &reduce_stmt_304, -1};
+Rule rule308 = {&nonterm2, 3, &reduce_stmt_305, -1};
+Rule rule309 = {&nonterm2, 3, &reduce_stmt_306, -1};
+Rule rule310 = {&nonterm2, 3, &reduce_stmt_307, -1};
+Rule rule311 = {&nonterm2, 3, &reduce_stmt_308, -1};
+Rule rule312 = {&nonterm2, 3, &reduce_stmt_309, -1};
+Rule rule313 = {&nonterm2, 3, &reduce_stmt_310, -1};
+Rule rule314 = {&nonterm2, 3, &reduce_stmt_311, -1};
+Rule rule315 = {&nonterm2, 3, &reduce_stmt_312, -1};
+Rule rule316 = {&nonterm2, 3, &reduce_stmt_313, -1};
+Rule rule317 = {&nonterm2, 3, &reduce_stmt_314, -1};
+Rule rule318 = {&nonterm2, 3, &reduce_stmt_315, -1};
+Rule rule319 = {&nonterm2, 3, &reduce_stmt_316, -1};
+Rule rule320 = {&nonterm2, 3, &reduce_stmt_317, -1};
+Rule rule321 = {&nonterm2, 3, &reduce_stmt_318, -1};
+Rule rule322 = {&nonterm2, 3, &reduce_stmt_319, -1};
+Rule rule323 = {&nonterm2, 3, &reduce_stmt_320, -1};
+Rule rule324 = {&nonterm2, 3, &reduce_stmt_321, -1};
+Rule rule325 = {&nonterm2, 3, &reduce_stmt_322, -1};
+Rule rule326 = {&nonterm2, 3, &reduce_stmt_323, -1};
+Rule rule327 = {&nonterm2, 3, &reduce_stmt_324, -1};
+Rule rule328 = {&nonterm2, 3, &reduce_stmt_325, -1};
+Rule rule329 = {&nonterm2, 3, &reduce_stmt_326, -1};
+Rule rule330 = {&nonterm2, 3, &reduce_stmt_327, -1};
+Rule rule331 = {&nonterm2, 3, &reduce_stmt_328, -1};
+Rule rule332 = {&nonterm2, 3, &reduce_stmt_329, -1};
+Rule rule333 = {&nonterm2, 3, &reduce_stmt_330, -1};
+Rule rule334 = {&nonterm2, 3, &reduce_stmt_331, -1};
+Rule rule335 = {&nonterm2, 3, &reduce_stmt_332, -1};
+Rule rule336 = {&nonterm2, 3, &reduce_stmt_333, -1};
+Rule rule337 = {&nonterm2, 3, &reduce_stmt_334, -1};
+Rule rule338 = {&nonterm2, 3, &reduce_stmt_335, -1};
+Rule rule339 = {&nonterm2, 3, &reduce_stmt_336, -1};
+Rule rule340 = {&nonterm2, 3, &reduce_stmt_337, -1};
+Rule rule341 = {&nonterm2, 3, &reduce_stmt_338, -1};
+Rule rule342 = {&nonterm2, 3, &reduce_stmt_339, -1};
+Rule rule343 = {&nonterm2, 3, &reduce_stmt_340, -1};
+Rule rule344 = {&nonterm2, 3, &reduce_stmt_341, -1};
+Rule rule345 = {&nonterm2, 3, &reduce_stmt_342, -1};
+Rule rule346 = {&nonterm2, 3, &reduce_stmt_343, -1};
+Rule rule347 = {&nonterm2, 3, &reduce_stmt_344, -1};
+Rule rule348 = {&nonterm2, 3, &reduce_stmt_345, -1};
+Rule rule349 = {&nonterm2, 3, &reduce_stmt_346, -1};
+Rule rule350 = {&nonterm2, 3, &reduce_stmt_347, -1};
+Rule rule351 = {&nonterm2, 3, &reduce_stmt_348, -1};
+Rule rule352 = {&nonterm2, 3, &reduce_stmt_349, -1};
+Rule rule353 = {&nonterm2, 3, &reduce_stmt_350, -1};
+Rule rule354 = {&nonterm2, 3, &reduce_stmt_351, -1};
+Rule rule355 = {&nonterm2, 3, &reduce_stmt_352, -1};
+Rule rule356 = {&nonterm2, 3, &reduce_stmt_353, -1};
+Rule rule357 = {&nonterm2, 3, &reduce_stmt_354, -1};
+Rule rule358 = {&nonterm2, 3, &reduce_stmt_355, -1};
+Rule rule359 = {&nonterm2, 3, &reduce_stmt_356, -1};
+Rule rule360 = {&nonterm2, 3, &reduce_stmt_357, -1};
+Rule rule361 = {&nonterm2, 3, &reduce_stmt_358, -1};
+Rule rule362 = {&nonterm2, 3, &reduce_stmt_359, -1};
+Rule rule363 = {&nonterm2, 3, &reduce_stmt_360, -1};
+Rule rule364 = {&nonterm2, 3, &reduce_stmt_361, -1};
+Rule rule365 = {&nonterm2, 3, &reduce_stmt_362, -1};
+Rule rule366 = {&nonterm2, 3, &reduce_stmt_363, -1};
+Rule rule367 = {&nonterm2, 3, &reduce_stmt_364, -1};
+Rule rule368 = {&nonterm2, 3, &reduce_stmt_365, -1};
+Rule rule369 = {&nonterm2, 3, &reduce_stmt_366, -1};
+Rule rule370 = {&nonterm2, 3, &reduce_stmt_367, -1};
+Rule rule371 = {&nonterm2, 3, &reduce_stmt_368, -1};
+Rule rule372 = {&nonterm2, 3, &reduce_stmt_369, -1};
+Rule rule373 = {&nonterm2, 3, &reduce_stmt_370, -1};
+Rule rule374 = {&nonterm2, 3, &reduce_stmt_371, -1};
+Rule rule375 = {&nonterm2, 3, &reduce_stmt_372, -1};
+Rule rule376 = {&nonterm2, 3, &reduce_stmt_373, -1};
+Rule rule377 = {&nonterm2, 3, &reduce_stmt_374, -1};
+Rule rule378 = {&nonterm2, 3, &reduce_stmt_375, -1};
+Rule rule379 = {&nonterm2, 3, &reduce_stmt_376, -1};
+Rule rule380 = {&nonterm2, 3, &reduce_stmt_377, -1};
+Rule rule381 = {&nonterm2, 3, &reduce_stmt_378, -1};
+Rule rule382 = {&nonterm2, 3, &reduce_stmt_379, -1};
+Rule rule383 = {&nonterm2, 3, &reduce_stmt_380, -1};
+Rule rule384 = {&nonterm2, 3, &reduce_stmt_381, -1};
+Rule rule385 = {&nonterm2, 3, &reduce_stmt_382, -1};
+Rule rule386 = {&nonterm2, 3, &reduce_stmt_383, -1};
+Rule rule387 = {&nonterm2, 3, &reduce_stmt_384, -1};
+Rule rule388 = {&nonterm2, 3, &reduce_stmt_385, -1};
+Rule rule389 = {&nonterm2, 3, &reduce_stmt_386, -1};
+Rule rule390 = {&nonterm2, 3, &reduce_stmt_387, -1};
+Rule rule391 = {&nonterm2, 3, &reduce_stmt_388, -1};
+Rule rule392 = {&nonterm2, 3, &reduce_stmt_389, -1};
+Rule rule393 = {&nonterm2, 3, &reduce_stmt_390, -1};
+Rule rule394 = {&nonterm2, 3, &reduce_stmt_391, -1};
+Rule rule395 = {&nonterm2, 3, &reduce_stmt_392, -1};
+Rule rule396 = {&nonterm2, 3, &reduce_stmt_393, -1};
+Rule rule397 = {&nonterm2, 3, &reduce_stmt_394, -1};
+Rule rule398 = {&nonterm2, 3, &reduce_stmt_395, -1};
+Rule rule399 = {&nonterm2, 3, &reduce_stmt_396, -1};
+Rule rule400 = {&nonterm2, 3, &reduce_stmt_397, -1};
+Rule rule401 = {&nonterm2, 3, &reduce_stmt_398, -1};
+Rule rule402 = {&nonterm2, 3, &reduce_stmt_399, -1};
+Rule rule403 = {&nonterm2, 3, &reduce_stmt_400, -1};
+Rule rule404 = {&nonterm2, 3, &reduce_stmt_401, -1};
+Rule rule405 = {&nonterm2, 3, &reduce_stmt_402, -1};
+Rule rule406 = {&nonterm2, 3, &reduce_stmt_403, -1};
+Rule rule407 = {&nonterm2, 3, &reduce_stmt_404, -1};
+Rule rule408 = {&nonterm2, 3, &reduce_stmt_405, -1};
+Rule rule409 = {&nonterm2, 3, &reduce_stmt_406, -1};
+Rule rule410 = {&nonterm2, 3, &reduce_stmt_407, -1};
+Rule rule411 = {&nonterm2, 3, &reduce_stmt_408, -1};
+Rule rule412 = {&nonterm2, 3, &reduce_stmt_409, -1};
+Rule rule413 = {&nonterm2, 3, &reduce_stmt_410, -1};
+Rule rule414 = {&nonterm2, 3, &reduce_stmt_411, -1};
+Rule rule415 = {&nonterm2, 3, &reduce_stmt_412, -1};
+Rule rule416 = {&nonterm2, 3, &reduce_stmt_413, -1};
+Rule rule417 = {&nonterm2, 3, &reduce_stmt_414, -1};
+Rule rule418 = {&nonterm2, 3, &reduce_stmt_415, -1};
+Rule rule419 = {&nonterm2, 3, &reduce_stmt_416, -1};
+Rule rule420 = {&nonterm2, 3, &reduce_stmt_417, -1};
+Rule rule421 = {&nonterm2, 3, &reduce_stmt_418, -1};
+Rule rule422 = {&nonterm2, 3, &reduce_stmt_419, -1};
+Rule rule423 = {&nonterm2, 3, &reduce_stmt_420, -1};
+Rule rule424 = {&nonterm2, 3, &reduce_stmt_421, -1};
+Rule rule425 = {&nonterm2, 3, &reduce_stmt_422, -1};
+Rule rule426 = {&nonterm2, 3, &reduce_stmt_423, -1};
+Rule rule427 = {&nonterm2, 3, &reduce_stmt_424, -1};
+Rule rule428 = {&nonterm2, 3, &reduce_stmt_425, -1};
+Rule rule429 = {&nonterm2, 3, &reduce_stmt_426, -1};
+Rule rule430 = {&nonterm2, 3, &reduce_stmt_427, -1};
+Rule rule431 = {&nonterm2, 3, &reduce_stmt_428, -1};
+Rule rule432 = {&nonterm2, 3, &reduce_stmt_429, -1};
+Rule rule433 = {&nonterm2, 3, &reduce_stmt_430, -1};
+Rule rule434 = {&nonterm2, 3, &reduce_stmt_431, -1};
+Rule rule435 = {&nonterm2, 3, &reduce_stmt_432, -1};
+Rule rule436 = {&nonterm2, 3, &reduce_stmt_433, -1};
+Rule rule437 = {&nonterm2, 3, &reduce_stmt_434, -1};
+Rule rule438 = {&nonterm2, 3, &reduce_stmt_435, -1};
+Rule rule439 = {&nonterm2, 3, &reduce_stmt_436, -1};
+Rule rule440 = {&nonterm2, 3, &reduce_stmt_437, -1};
+Rule rule441 = {&nonterm2, 3, &reduce_stmt_438, -1};
+Rule rule442 = {&nonterm2, 3, &reduce_stmt_439, -1};
+Rule rule443 = {&nonterm2, 3, &reduce_stmt_440, -1};
+Rule rule444 = {&nonterm2, 3, &reduce_stmt_441, -1};
+Rule rule445 = {&nonterm2, 3, &reduce_stmt_442, -1};
+Rule rule446 = {&nonterm2, 3, &reduce_stmt_443, -1};
+Rule rule447 = {&nonterm2, 3, &reduce_stmt_444, -1};
+Rule rule448 = {&nonterm2, 3, &reduce_stmt_445, -1};
+Rule rule449 = {&nonterm2, 3, &reduce_stmt_446, -1};
+Rule rule450 = {&nonterm2, 3, &reduce_stmt_447, -1};
+Rule rule451 = {&nonterm2, 3, &reduce_stmt_448, -1};
+Rule rule452 = {&nonterm2, 3, &reduce_stmt_449, -1};
+Rule rule453 = {&nonterm2, 3, &reduce_stmt_450, -1};
+Rule rule454 = {&nonterm2, 3, &reduce_stmt_451, -1};
+Rule rule455 = {&nonterm2, 3, &reduce_stmt_452, -1};
+Rule rule456 = {&nonterm2, 3, &reduce_stmt_453, -1};
+Rule rule457 = {&nonterm2, 3, &reduce_stmt_454, -1};
+Rule rule458 = {&nonterm2, 3, &reduce_stmt_455, -1};
+Rule rule459 = {&nonterm2, 3, &reduce_stmt_456, -1};
+Rule rule460 = {&nonterm2, 3, &reduce_stmt_457, -1};
+Rule rule461 = {&nonterm2, 3, &reduce_stmt_458, -1};
+Rule rule462 = {&nonterm2, 3, &reduce_stmt_459, -1};
+Rule rule463 = {&nonterm2, 3, &reduce_stmt_460, -1};
+Rule rule464 = {&nonterm2, 3, &reduce_stmt_461, -1};
+Rule rule465 = {&nonterm2, 3, &reduce_stmt_462, -1};
+Rule rule466 = {&nonterm2, 3, &reduce_stmt_463, -1};
+Rule rule467 = {&nonterm2, 3, &reduce_stmt_464, -1};
+Rule rule468 = {&nonterm2, 3, &reduce_stmt_465, -1};
+Rule rule469 = {&nonterm2, 3, &reduce_stmt_466, -1};
+Rule rule470 = {&nonterm2, 3, &reduce_stmt_467, -1};
+Rule rule471 = {&nonterm2, 3, &reduce_stmt_468, -1};
+Rule rule472 = {&nonterm2, 3, &reduce_stmt_469, -1};
+Rule rule473 = {&nonterm2, 3, &reduce_stmt_470, -1};
+Rule rule474 = {&nonterm2, 3, &reduce_stmt_471, -1};
+Rule rule475 = {&nonterm2, 3, &reduce_stmt_472, -1};
+Rule rule476 = {&nonterm2, 3, &reduce_stmt_473, -1};
+Rule rule477 = {&nonterm2, 3, &reduce_stmt_474, -1};
+Rule rule478 = {&nonterm2, 3, &reduce_stmt_475, -1};
+Rule rule479 = {&nonterm2, 3, &reduce_stmt_476, -1};
+Rule rule480 = {&nonterm2, 3, &reduce_stmt_477, -1};
+Rule rule481 = {&nonterm2, 3, &reduce_stmt_478, -1};
+Rule rule482 = {&nonterm2, 3, &reduce_stmt_479, -1};
+Rule rule483 = {&nonterm2, 3, &reduce_stmt_480, -1};
+Rule rule484 = {&nonterm2, 3, &reduce_stmt_481, -1};
+Rule rule485 = {&nonterm2, 3, &reduce_stmt_482, -1};
+Rule rule486 = {&nonterm2, 3, &reduce_stmt_483, -1};
+Rule rule487 = {&nonterm2, 3, &reduce_stmt_484, -1};
+Rule rule488 = {&nonterm2, 3, &reduce_stmt_485, -1};
+Rule rule489 = {&nonterm2, 3, &reduce_stmt_486, -1};
+Rule rule490 = {&nonterm2, 3, &reduce_stmt_487, -1};
+Rule rule491 = {&nonterm2, 3, &reduce_stmt_488, -1};
+Rule rule492 = {&nonterm2, 3, &reduce_stmt_489, -1};
+Rule rule493 = {&nonterm2, 3, &reduce_stmt_490, -1};
+Rule rule494 = {&nonterm2, 3, &reduce_stmt_491, -1};
+Rule rule495 = {&nonterm2, 3, &reduce_stmt_492, -1};
+Rule rule496 = {&nonterm2, 3, &reduce_stmt_493, -1};
+Rule rule497 = {&nonterm2, 3, &reduce_stmt_494, -1};
+Rule rule498 = {&nonterm2, 3, &reduce_stmt_495, -1};
+Rule rule499 = {&nonterm2, 3, &reduce_stmt_496, -1};
+Rule rule500 = {&nonterm2, 3, &reduce_stmt_497, -1};
+Rule rule501 = {&nonterm2, 3, &reduce_stmt_498, -1};
+Rule rule502 = {&nonterm2, 3, &reduce_stmt_499, -1};
+Rule rule503 = {&nonterm2, 3, &reduce_stmt_500, -1};
+Rule rule504 = {&nonterm2, 3, &reduce_stmt_501, -1};
+Rule rule505 = {&nonterm2, 3, &reduce_stmt_502, -1};
+Rule rule506 = {&nonterm2, 3, &reduce_stmt_503, -1};
+Rule rule507 = {&nonterm2, 3, &reduce_stmt_504, -1};
+Rule rule508 = {&nonterm2, 3, &reduce_stmt_505, -1};
+Rule rule509 = {&nonterm2, 3, &reduce_stmt_506, -1};
+Rule rule510 = {&nonterm2, 3, &reduce_stmt_507, -1};
+Rule rule511 = {&nonterm2, 3, &reduce_stmt_508, -1};
+Rule rule512 = {&nonterm2, 3, &reduce_stmt_509, -1};
+Rule rule513 = {&nonterm2, 3, &reduce_stmt_510, -1};
+Rule rule514 = {&nonterm2, 3, &reduce_stmt_511, -1};
+Rule rule515 = {&nonterm2, 3, &reduce_stmt_512, -1};
+Rule rule516 = {&nonterm2, 3, &reduce_stmt_513, -1};
+Rule rule517 = {&nonterm2, 3, &reduce_stmt_514, -1};
+Rule rule518 = {&nonterm2, 3, &reduce_stmt_515, -1};
+Rule rule519 = {&nonterm2, 3, &reduce_stmt_516, -1};
+Rule rule520 = {&nonterm2, 3, &reduce_stmt_517, -1};
+Rule rule521 = {&nonterm2, 3, &reduce_stmt_518, -1};
+Rule rule522 = {&nonterm2, 3, &reduce_stmt_519, -1};
+Rule rule523 = {&nonterm2, 3, &reduce_stmt_520, -1};
+Rule rule524 = {&nonterm2, 3, &reduce_stmt_521, -1};
+Rule rule525 = {&nonterm2, 3, &reduce_stmt_522, -1};
+Rule rule526 = {&nonterm2, 3, &reduce_stmt_523, -1};
+Rule rule527 = {&nonterm2, 3, &reduce_stmt_524, -1};
+Rule rule528 = {&nonterm2, 3, &reduce_stmt_525, -1};
+Rule rule529 = {&nonterm2, 3, &reduce_stmt_526, -1};
+Rule rule530 = {&nonterm2, 3, &reduce_stmt_527, -1};
+Rule rule531 = {&nonterm2, 3, &reduce_stmt_528, -1};
+Rule rule532 = {&nonterm2, 3, &reduce_stmt_529, -1};
+Rule rule533 = {&nonterm2, 3, &reduce_stmt_530, -1};
+Rule rule534 = {&nonterm2, 3, &reduce_stmt_531, -1};
+Rule rule535 = {&nonterm2, 3, &reduce_stmt_532, -1};
+Rule rule536 = {&nonterm2, 3, &reduce_stmt_533, -1};
+Rule rule537 = {&nonterm2, 3, &reduce_stmt_534, -1};
+Rule rule538 = {&nonterm2, 3, &reduce_stmt_535, -1};
+Rule rule539 = {&nonterm2, 3, &reduce_stmt_536, -1};
+Rule rule540 = {&nonterm2, 3, &reduce_stmt_537, -1};
+Rule rule541 = {&nonterm2, 3, &reduce_stmt_538, -1};
+Rule rule542 = {&nonterm2, 3, &reduce_stmt_539, -1};
+Rule rule543 = {&nonterm2, 3, &reduce_stmt_540, -1};
+Rule rule544 = {&nonterm2, 3, &reduce_stmt_541, -1};
+Rule rule545 = {&nonterm2, 3, &reduce_stmt_542, -1};
+Rule rule546 = {&nonterm2, 3, &reduce_stmt_543, -1};
+Rule rule547 = {&nonterm2, 3, &reduce_stmt_544, -1};
+Rule rule548 = {&nonterm2, 3, &reduce_stmt_545, -1};
+Rule rule549 = {&nonterm2, 3, &reduce_stmt_546, -1};
+Rule rule550 = {&nonterm2, 3, &reduce_stmt_547, -1};
+Rule rule551 = {&nonterm2, 3, &reduce_stmt_548, -1};
+Rule rule552 = {&nonterm2, 3, &reduce_stmt_549, -1};
+Rule rule553 = {&nonterm2, 3, &reduce_stmt_550, -1};
+Rule rule554 = {&nonterm2, 3, &reduce_stmt_551, -1};
+Rule rule555 = {&nonterm2, 3, &reduce_stmt_552, -1};
+Rule rule556 = {&nonterm2, 3, &reduce_stmt_553, -1};
+Rule rule557 = {&nonterm2, 3, &reduce_stmt_554, -1};
+Rule rule558 = {&nonterm2, 3, &reduce_stmt_555, -1};
+Rule rule559 = {&nonterm2, 3, &reduce_stmt_556, -1};
+Rule rule560 = {&nonterm2, 3, &reduce_stmt_557, -1};
+Rule rule561 = {&nonterm2, 3, &reduce_stmt_558, -1};
+Rule rule562 = {&nonterm2, 3, &reduce_stmt_559, -1};
+Rule rule563 = {&nonterm2, 3, &reduce_stmt_560, -1};
+Rule rule564 = {&nonterm2, 3, &reduce_stmt_561, -1};
+Rule rule565 = {&nonterm2, 3, &reduce_stmt_562, -1};
+Rule rule566 = {&nonterm2, 3, &reduce_stmt_563, -1};
+Rule rule567 = {&nonterm2, 3, &reduce_stmt_564, -1};
+Rule rule568 = {&nonterm2, 3, &reduce_stmt_565, -1};
+Rule rule569 = {&nonterm2, 3, &reduce_stmt_566, -1};
+Rule rule570 = {&nonterm2, 3, &reduce_stmt_567, -1};
+Rule rule571 = {&nonterm2, 3, &reduce_stmt_568, -1};
+Rule rule572 = {&nonterm2, 3, &reduce_stmt_569, -1};
+Rule rule573 = {&nonterm2, 3, &reduce_stmt_570, -1};
+Rule rule574 = {&nonterm2, 3, &reduce_stmt_571, -1};
+Rule rule575 = {&nonterm2, 3, &reduce_stmt_572, -1};
+Rule rule576 = {&nonterm2, 3, &reduce_stmt_573, -1};
+Rule rule577 = {&nonterm2, 3, &reduce_stmt_574, -1};
+Rule rule578 = {&nonterm2, 3, &reduce_stmt_575, -1};
+Rule rule579 = {&nonterm2, 3, &reduce_stmt_576, -1};
+Rule rule580 = {&nonterm2, 3, &reduce_stmt_577, -1};
+Rule rule581 = {&nonterm2, 3, &reduce_stmt_578, -1};
+Rule rule582 = {&nonterm2, 3, &reduce_stmt_579, -1};
+Rule rule583 = {&nonterm2, 3, &reduce_stmt_580, -1};
+Rule rule584 = {&nonterm2, 3, &reduce_stmt_581, -1};
+Rule rule585 = {&nonterm2, 3, &reduce_stmt_582, -1};
+Rule rule586 = {&nonterm2, 3, &reduce_stmt_583, -1};
+Rule rule587 = {&nonterm2, 3, &reduce_stmt_584, -1};
+Rule rule588 = {&nonterm2, 3, &reduce_stmt_585, -1};
+Rule rule589 = {&nonterm2, 3, &reduce_stmt_586, -1};
+Rule rule590 = {&nonterm2, 3, &reduce_stmt_587, -1};
+Rule rule591 = {&nonterm2, 3, &reduce_stmt_588, -1};
+Rule rule592 = {&nonterm2, 3, &reduce_stmt_589, -1};
+Rule rule593 = {&nonterm2, 3, &reduce_stmt_590, -1};
+Rule rule594 = {&nonterm2, 3, &reduce_stmt_591, -1};
+Rule rule595 = {&nonterm2, 3, &reduce_stmt_592, -1};
+Rule rule596 = {&nonterm2, 3, &reduce_stmt_593, -1};
+Rule rule597 = {&nonterm2, 3, &reduce_stmt_594, -1};
+Rule rule598 = {&nonterm2, 3, &reduce_stmt_595, -1};
+Rule rule599 = {&nonterm2, 3, &reduce_stmt_596, -1};
+Rule rule600 = {&nonterm2, 3, &reduce_stmt_597, -1};
+Rule rule601 = {&nonterm2, 3, &reduce_stmt_598, -1};
+Rule rule602 = {&nonterm2, 3, &reduce_stmt_599, -1};
+Rule rule603 = {&nonterm2, 3, &reduce_stmt_600, -1};
+Rule rule604 = {&nonterm2, 3, &reduce_stmt_601, -1};
+Rule rule605 = {&nonterm2, 3, &reduce_stmt_602, -1};
+Rule rule606 = {&nonterm2, 3, &reduce_stmt_603, -1};
+Rule rule607 = {&nonterm2, 3, &reduce_stmt_604, -1};
+Rule rule608 = {&nonterm2, 3, &reduce_stmt_605, -1};
+Rule rule609 = {&nonterm2, 3, &reduce_stmt_606, -1};
+Rule rule610 = {&nonterm2, 3, &reduce_stmt_607, -1};
+Rule rule611 = {&nonterm2, 3, &reduce_stmt_608, -1};
+Rule rule612 = {&nonterm2, 3, &reduce_stmt_609, -1};
+Rule rule613 = {&nonterm2, 3, &reduce_stmt_610, -1};
+Rule rule614 = {&nonterm2, 3, &reduce_stmt_611, -1};
+Rule rule615 = {&nonterm2, 3, &reduce_stmt_612, -1};
+Rule rule616 = {&nonterm2, 3, &reduce_stmt_613, -1};
+Rule rule617 = {&nonterm2, 3, &reduce_stmt_614, -1};
+Rule rule618 = {&nonterm2, 3, &reduce_stmt_615, -1};
+Rule rule619 = {&nonterm2, 3, &reduce_stmt_616, -1};
+Rule rule620 = {&nonterm2, 3, &reduce_stmt_617, -1};
+Rule rule621 = {&nonterm2, 3, &reduce_stmt_618, -1};
+Rule rule622 = {&nonterm2, 3, &reduce_stmt_619, -1};
+Rule rule623 = {&nonterm2, 3, &reduce_stmt_620, -1};
+Rule rule624 = {&nonterm2, 3, &reduce_stmt_621, -1};
+Rule rule625 = {&nonterm2, 3, &reduce_stmt_622, -1};
+Rule rule626 = {&nonterm2, 3, &reduce_stmt_623, -1};
+Rule rule627 = {&nonterm2, 3, &reduce_stmt_624, -1};
+Rule rule628 = {&nonterm2, 3, &reduce_stmt_625, -1};
+Rule rule629 = {&nonterm2, 3, &reduce_stmt_626, -1};
+Rule rule630 = {&nonterm2, 3, &reduce_stmt_627, -1};
+Rule rule631 = {&nonterm2, 3, &reduce_stmt_628, -1};
+Rule rule632 = {&nonterm2, 3, &reduce_stmt_629, -1};
+Rule rule633 = {&nonterm2, 3, &reduce_stmt_630, -1};
+Rule rule634 = {&nonterm2, 3, &reduce_stmt_631, -1};
+Rule rule635 = {&nonterm2, 3, &reduce_stmt_632, -1};
+Rule rule636 = {&nonterm2, 3, &reduce_stmt_633, -1};
+Rule rule637 = {&nonterm2, 3, &reduce_stmt_634, -1};
+Rule rule638 = {&nonterm2, 3, &reduce_stmt_635, -1};
+Rule rule639 = {&nonterm2, 3, &reduce_stmt_636, -1};
+Rule rule640 = {&nonterm2, 3, &reduce_stmt_637, -1};
+Rule rule641 = {&nonterm2, 3, &reduce_stmt_638, -1};
+Rule rule642 = {&nonterm2, 3, &reduce_stmt_639, -1};
+Rule rule643 = {&nonterm2, 3, &reduce_stmt_640, -1};
+Rule rule644 = {&nonterm2, 3, &reduce_stmt_641, -1};
+Rule rule645 = {&nonterm2, 3, &reduce_stmt_642, -1};
+Rule rule646 = {&nonterm2, 3, &reduce_stmt_643, -1};
+Rule rule647 = {&nonterm2, 3, &reduce_stmt_644, -1};
+Rule rule648 = {&nonterm2, 3, &reduce_stmt_645, -1};
+Rule rule649 = {&nonterm2, 3, &reduce_stmt_646, -1};
+Rule rule650 = {&nonterm2, 3, &reduce_stmt_647, -1};
+Rule rule651 = {&nonterm2, 3, &reduce_stmt_648, -1};
+Rule rule652 = {&nonterm2, 3, &reduce_stmt_649, -1};
+Rule rule653 = {&nonterm2, 3, &reduce_stmt_650, -1};
+Rule rule654 = {&nonterm2, 3, &reduce_stmt_651, -1};
+Rule rule655 = {&nonterm2, 3, &reduce_stmt_652, -1};
+Rule rule656 = {&nonterm2, 3, &reduce_stmt_653, -1};
+Rule rule657 = {&nonterm2, 3, &reduce_stmt_654, -1};
+Rule rule658 = {&nonterm2, 3, &reduce_stmt_655, -1};
+Rule rule659 = {&nonterm2, 3, &reduce_stmt_656, -1};
+Rule rule660 = {&nonterm2, 3, &reduce_stmt_657, -1};
+Rule rule661 = {&nonterm2, 3, &reduce_stmt_658, -1};
+Rule rule662 = {&nonterm2, 3, &reduce_stmt_659, -1};
+Rule rule663 = {&nonterm2, 3, &reduce_stmt_660, -1};
+Rule rule664 = {&nonterm2, 3, &reduce_stmt_661, -1};
+Rule rule665 = {&nonterm2, 3, &reduce_stmt_662, -1};
+Rule rule666 = {&nonterm2, 3, &reduce_stmt_663, -1};
+Rule rule667 = {&nonterm2, 3, &reduce_stmt_664, -1};
+Rule rule668 = {&nonterm2, 3, &reduce_stmt_665, -1};
+Rule rule669 = {&nonterm2, 3, &reduce_stmt_666, -1};
+Rule rule670 = {&nonterm2, 3, &reduce_stmt_667, -1};
+Rule rule671 = {&nonterm2, 3, &reduce_stmt_668, -1};
+Rule rule672 = {&nonterm2, 3, &reduce_stmt_669, -1};
+Rule rule673 = {&nonterm2, 3, &reduce_stmt_670, -1};
+Rule rule674 = {&nonterm2, 3, &reduce_stmt_671, -1};
+Rule rule675 = {&nonterm2, 3, &reduce_stmt_672, -1};
+Rule rule676 = {&nonterm2, 3, &reduce_stmt_673, -1};
+Rule rule677 = {&nonterm2, 3, &reduce_stmt_674, -1};
+Rule rule678 = {&nonterm2, 3, &reduce_stmt_675, -1};
+Rule rule679 = {&nonterm2, 3, &reduce_stmt_676, -1};
+Rule rule680 = {&nonterm2, 3, &reduce_stmt_677, -1};
+Rule rule681 = {&nonterm2, 3, &reduce_stmt_678, -1};
+Rule rule682 = {&nonterm2, 3, &reduce_stmt_679, -1};
+Rule rule683 = {&nonterm2, 3, &reduce_stmt_680, -1};
+Rule rule684 = {&nonterm2, 3, &reduce_stmt_681, -1};
+Rule rule685 = {&nonterm2, 3, &reduce_stmt_682, -1};
+Rule rule686 = {&nonterm2, 3, &reduce_stmt_683, -1};
+Rule rule687 = {&nonterm2, 3, &reduce_stmt_684, -1};
+Rule rule688 = {&nonterm2, 3, &reduce_stmt_685, -1};
+Rule rule689 = {&nonterm2, 3, &reduce_stmt_686, -1};
+Rule rule690 = {&nonterm2, 3, &reduce_stmt_687, -1};
+Rule rule691 = {&nonterm2, 3, &reduce_stmt_688, -1};
+Rule rule692 = {&nonterm2, 3, &reduce_stmt_689, -1};
+Rule rule693 = {&nonterm2, 3, &reduce_stmt_690, -1};
+Rule rule694 = {&nonterm2, 3, &reduce_stmt_691, -1};
+Rule rule695 = {&nonterm2, 3, &reduce_stmt_692, -1};
+Rule rule696 = {&nonterm2, 3, &reduce_stmt_693, -1};
+Rule rule697 = {&nonterm2, 3, &reduce_stmt_694, -1};
+Rule rule698 = {&nonterm2, 3, &reduce_stmt_695, -1};
+Rule rule699 = {&nonterm2, 3, &reduce_stmt_696, -1};
+Rule rule700 = {&nonterm2, 3, &reduce_stmt_697, -1};
+Rule rule701 = {&nonterm2, 3, &reduce_stmt_698, -1};
+Rule rule702 = {&nonterm2, 3, &reduce_stmt_699, -1};
+Rule rule703 = {&nonterm2, 3, &reduce_stmt_700, -1};
+Rule rule704 = {&nonterm2, 3, &reduce_stmt_701, -1};
+Rule rule705 = {&nonterm2, 3, &reduce_stmt_702, -1};
+Rule rule706 = {&nonterm2, 3, &reduce_stmt_703, -1};
+Rule rule707 = {&nonterm2, 3, &reduce_stmt_704, -1};
+Rule rule708 = {&nonterm2, 3, &reduce_stmt_705, -1};
+Rule rule709 = {&nonterm2, 3, &reduce_stmt_706, -1};
+Rule rule710 = {&nonterm2, 3, &reduce_stmt_707, -1};
+Rule rule711 = {&nonterm2, 3, &reduce_stmt_708, -1};
+Rule rule712 = {&nonterm2, 3, &reduce_stmt_709, -1};
+Rule rule713 = {&nonterm2, 3, &reduce_stmt_710, -1};
+Rule rule714 = {&nonterm2, 3, &reduce_stmt_711, -1};
+Rule rule715 = {&nonterm2, 3, &reduce_stmt_712, -1};
+Rule rule716 = {&nonterm2, 3, &reduce_stmt_713, -1};
+Rule rule717 = {&nonterm2, 3, &reduce_stmt_714, -1};
+Rule rule718 = {&nonterm2, 3, &reduce_stmt_715, -1};
+Rule rule719 = {&nonterm2, 3, &reduce_stmt_716, -1};
+Rule rule720 = {&nonterm2, 3, &reduce_stmt_717, -1};
+Rule rule721 = {&nonterm2, 3, &reduce_stmt_718, -1};
+Rule rule722 = {&nonterm2, 3, &reduce_stmt_719, -1};
+Rule rule723 = {&nonterm2, 3, &reduce_stmt_720, -1};
+Rule rule724 = {&nonterm2, 3, &reduce_stmt_721, -1};
+Rule rule725 = {&nonterm2, 3, &reduce_stmt_722, -1};
+Rule rule726 = {&nonterm2, 3, &reduce_stmt_723, -1};
+Rule rule727 = {&nonterm2, 3, &reduce_stmt_724, -1};
+Rule rule728 = {&nonterm2, 3, &reduce_stmt_725, -1};
+Rule rule729 = {&nonterm2, 3, &reduce_stmt_726, -1};
+Rule rule730 = {&nonterm2, 3, &reduce_stmt_727, -1};
+Rule rule731 = {&nonterm2, 3, &reduce_stmt_728, -1};
+Rule rule732 = {&nonterm2, 3, &reduce_stmt_729, -1};
+Rule rule733 = {&nonterm2, 3, &reduce_stmt_730, -1};
+Rule rule734 = {&nonterm2, 3, &reduce_stmt_731, -1};
+Rule rule735 = {&nonterm2, 3, &reduce_stmt_732, -1};
+Rule rule736 = {&nonterm2, 3, &reduce_stmt_733, -1};
+Rule rule737 = {&nonterm2, 3, &reduce_stmt_734, -1};
+Rule rule738 = {&nonterm2, 3, &reduce_stmt_735, -1};
+Rule rule739 = {&nonterm2, 3, &reduce_stmt_736, -1};
+Rule rule740 = {&nonterm2, 3, &reduce_stmt_737, -1};
+Rule rule741 = {&nonterm2, 3, &reduce_stmt_738, -1};
+Rule rule742 = {&nonterm2, 3, &reduce_stmt_739, -1};
+Rule rule743 = {&nonterm2, 3, &reduce_stmt_740, -1};
+Rule rule744 = {&nonterm2, 3, &reduce_stmt_741, -1};
+Rule rule745 = {&nonterm2, 3, &reduce_stmt_742, -1};
+Rule rule746 = {&nonterm2, 3, &reduce_stmt_743, -1};
+Rule rule747 = {&nonterm2, 3, &reduce_stmt_744, -1};
+Rule rule748 = {&nonterm2, 3, &reduce_stmt_745, -1};
+Rule rule749 = {&nonterm2, 3, &reduce_stmt_746, -1};
+Rule rule750 = {&nonterm2, 3, &reduce_stmt_747, -1};
+Rule rule751 = {&nonterm2, 3, &reduce_stmt_748, -1};
+Rule rule752 = {&nonterm2, 3, &reduce_stmt_749, -1};
+Rule rule753 = {&nonterm2, 3, &reduce_stmt_750, -1};
+Rule rule754 = {&nonterm2, 3, &reduce_stmt_751, -1};
+Rule rule755 = {&nonterm2, 3, &reduce_stmt_752, -1};
+Rule rule756 = {&nonterm2, 3, &reduce_stmt_753, -1};
+Rule rule757 = {&nonterm2, 3, &reduce_stmt_754, -1};
+Rule rule758 = {&nonterm2, 3, &reduce_stmt_755, -1};
+Rule rule759 = {&nonterm2, 3, &reduce_stmt_756, -1};
+Rule rule760 = {&nonterm2, 3, &reduce_stmt_757, -1};
+Rule rule761 = {&nonterm2, 3, &reduce_stmt_758, -1};
+Rule rule762 = {&nonterm2, 3, &reduce_stmt_759, -1};
+Rule rule763 = {&nonterm2, 3, &reduce_stmt_760, -1};
+Rule rule764 = {&nonterm2, 3, &reduce_stmt_761, -1};
+Rule rule765 = {&nonterm2, 3, &reduce_stmt_762, -1};
+Rule rule766 = {&nonterm2, 3, &reduce_stmt_763, -1};
+Rule rule767 = {&nonterm2, 3, &reduce_stmt_764, -1};
+Rule rule768 = {&nonterm2, 3, &reduce_stmt_765, -1};
+Rule rule769 = {&nonterm2, 3, &reduce_stmt_766, -1};
+Rule rule770 = {&nonterm2, 3, &reduce_stmt_767, -1};
+Rule rule771 = {&nonterm2, 3, &reduce_stmt_768, -1};
+Rule rule772 = {&nonterm2, 3, &reduce_stmt_769, -1};
+Rule rule773 = {&nonterm2, 3, &reduce_stmt_770, -1};
+Rule rule774 = {&nonterm2, 3, &reduce_stmt_771, -1};
+Rule rule775 = {&nonterm2, 3, &reduce_stmt_772, -1};
+Rule rule776 = {&nonterm2, 3, &reduce_stmt_773, -1};
+Rule rule777 = {&nonterm2, 3, &reduce_stmt_774, -1};
+Rule rule778 = {&nonterm2, 3, &reduce_stmt_775, -1};
+Rule rule779 = {&nonterm2, 3, &reduce_stmt_776, -1};
+Rule rule780 = {&nonterm2, 3, &reduce_stmt_777, -1};
+Rule rule781 = {&nonterm2, 3, &reduce_stmt_778, -1};
+Rule rule782 = {&nonterm2, 3, &reduce_stmt_779, -1};
+Rule rule783 = {&nonterm2, 3, &reduce_stmt_780, -1};
+Rule rule784 = {&nonterm2, 3, &reduce_stmt_781, -1};
+Rule rule785 = {&nonterm2, 3, &reduce_stmt_782, -1};
+Rule rule786 = {&nonterm2, 3, &reduce_stmt_783, -1};
+Rule rule787 = {&nonterm2, 3, &reduce_stmt_784, -1};
+Rule rule788 = {&nonterm2, 3, &reduce_stmt_785, -1};
+Rule rule789 = {&nonterm2, 3, &reduce_stmt_786, -1};
+Rule rule790 = {&nonterm2, 3, &reduce_stmt_787, -1};
+Rule rule791 = {&nonterm2, 3, &reduce_stmt_788, -1};
+Rule rule792 = {&nonterm2, 3, &reduce_stmt_789, -1};
+Rule rule793 = {&nonterm2, 3, &reduce_stmt_790, -1};
+Rule rule794 = {&nonterm2, 3, &reduce_stmt_791, -1};
+Rule rule795 = {&nonterm2, 3, &reduce_stmt_792, -1};
+Rule rule796 = {&nonterm2, 3, &reduce_stmt_793, -1};
+Rule rule797 = {&nonterm2, 3, &reduce_stmt_794, -1};
+Rule rule798 = {&nonterm2, 3, &reduce_stmt_795, -1};
+Rule rule799 = {&nonterm2, 3, &reduce_stmt_796, -1};
+Rule rule800 = {&nonterm2, 3, &reduce_stmt_797, -1};
+Rule rule801 = {&nonterm2, 3, &reduce_stmt_798, -1};
+Rule rule802 = {&nonterm2, 3, &reduce_stmt_799, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+extern State state784;
+extern State state785;
+extern State state786;
+extern State state787;
+extern State state788;
+extern State state789;
+extern State state790;
+extern State state791;
+extern State state792;
+extern State state793;
+extern State state794;
+extern State state795;
+extern State state796;
+extern State state797;
+extern State state798;
+extern State state799;
+extern State state800;
+extern State state801;
+extern State state802;
+extern State state803;
+extern State state804;
+extern State state805;
+extern State state806;
+extern State state807;
+extern State state808;
+extern State state809;
+extern State state810;
+extern State state811;
+extern State state812;
+extern State state813;
+extern State state814;
+extern State state815;
+extern State state816;
+extern State state817;
+extern State state818;
+extern State state819;
+extern State state820;
+extern State state821;
+extern State state822;
+extern State state823;
+extern State state824;
+extern State state825;
+extern State state826;
+extern State state827;
+extern State state828;
+extern State state829;
+extern State state830;
+extern State state831;
+extern State state832;
+extern State state833;
+extern State state834;
+extern State state835;
+extern State state836;
+extern State state837;
+extern State state838;
+extern State state839;
+extern State state840;
+extern State state841;
+extern State state842;
+extern State state843;
+extern State state844;
+extern State state845;
+extern State state846;
+extern State state847;
+extern State state848;
+extern State state849;
+extern State state850;
+extern State state851;
+extern State state852;
+extern State state853;
+extern State state854;
+extern State state855;
+extern State state856;
+extern State state857;
+extern State state858;
+extern State state859;
+extern State state860;
+extern State state861;
+extern State state862;
+extern State state863;
+extern State state864;
+extern State state865;
+extern State state866;
+extern State state867;
+extern State state868;
+extern State state869;
+extern State state870;
+extern State state871;
+extern State state872;
+extern State state873;
+extern State state874;
+extern State state875;
+extern State state876;
+extern State state877;
+extern State state878;
+extern State state879;
+extern State state880;
+extern State state881;
+extern State state882;
+extern State state883;
+extern State state884;
+extern State state885;
+extern State state886;
+extern State state887;
+extern State state888;
+extern State state889;
+extern State state890;
+extern State state891;
+extern State state892;
+extern State state893;
+extern State state894;
+extern State state895;
+extern State state896;
+extern State state897;
+extern State state898;
+extern State state899;
+extern State state900;
+extern State state901;
+extern State state902;
+extern State state903;
+extern State state904;
+extern State state905;
+extern State state906;
+extern State state907;
+extern State state908;
+extern State state909;
+extern State state910;
+extern State state911;
+extern State state912;
+extern State state913;
+extern State state914;
+extern State state915;
+extern State state916;
+extern State state917;
+extern State state918;
+extern State state919;
+extern State state920;
+extern State state921;
+extern State state922;
+extern State state923;
+extern State state924;
+extern State state925;
+extern State state926;
+extern State state927;
+extern State state928;
+extern State state929;
+extern State state930;
+extern State state931;
+extern State state932;
+extern State state933;
+extern State state934;
+extern State state935;
+extern State state936;
+extern State state937;
+extern State state938;
+extern State state939;
+extern State state940;
+extern State state941;
+extern State state942;
+extern State state943;
+extern State state944;
+extern State state945;
+extern State state946;
+extern State state947;
+extern State state948;
+extern State state949;
+extern State state950;
+extern State state951;
+extern State state952;
+extern State state953;
+extern State state954;
+extern State state955;
+extern State state956;
+extern State state957;
+extern State state958;
+extern State state959;
+extern State state960;
+extern State state961;
+extern State state962;
+extern State state963;
+extern State state964;
+extern State state965;
+extern State state966;
+extern State state967;
+extern State state968;
+extern State state969;
+extern State state970;
+extern State state971;
+extern State state972;
+extern State state973;
+extern State state974;
+extern State state975;
+extern State state976;
+extern State state977;
+extern State state978;
+extern State state979;
+extern State state980;
+extern State state981;
+extern State state982;
+extern State state983;
+extern State state984;
+extern State state985;
+extern State state986;
+extern State state987;
+extern State state988;
+extern State state989;
+extern State state990;
+extern State state991;
+extern State state992;
+extern State state993;
+extern State state994;
+extern State state995;
+extern State state996;
+extern State state997;
+extern State state998;
+extern State state999;
+extern State state1000;
+extern State state1001;
+extern State state1002;
+extern State state1003;
+extern State state1004;
+extern State state1005;
+extern State state1006;
+extern State state1007;
+extern State state1008;
+extern State state1009;
+extern State state1010;
+extern State state1011;
+extern State state1012;
+extern State state1013;
+extern State state1014;
+extern State state1015;
+extern State state1016;
+extern State state1017;
+extern State state1018;
+extern State state1019;
+extern State state1020;
+extern State state1021;
+extern State state1022;
+extern State state1023;
+extern State state1024;
+extern State state1025;
+extern State state1026;
+extern State state1027;
+extern State state1028;
+extern State state1029;
+extern State state1030;
+extern State state1031;
+extern State state1032;
+extern State state1033;
+extern State state1034;
+extern State state1035;
+extern State state1036;
+extern State state1037;
+extern State state1038;
+extern State state1039;
+extern State state1040;
+extern State state1041;
+extern State state1042;
+extern State state1043;
+extern State state1044;
+extern State state1045;
+extern State state1046;
+extern State state1047;
+extern State state1048;
+extern State state1049;
+extern State state1050;
+extern State state1051;
+extern State state1052;
+extern State state1053;
+extern State state1054;
+extern State state1055;
+extern State state1056;
+extern State state1057;
+extern State state1058;
+extern State state1059;
+extern State state1060;
+extern State state1061;
+extern State state1062;
+extern State state1063;
+extern State state1064;
+extern State state1065;
+extern State state1066;
+extern State state1067;
+extern State state1068;
+extern State state1069;
+extern State state1070;
+extern State state1071;
+extern State state1072;
+extern State state1073;
+extern State state1074;
+extern State state1075;
+extern State state1076;
+extern State state1077;
+extern State state1078;
+extern State state1079;
+extern State state1080;
+extern State state1081;
+extern State state1082;
+extern State state1083;
+extern State state1084;
+extern State state1085;
+extern State state1086;
+extern State state1087;
+extern State state1088;
+extern State state1089;
+extern State state1090;
+extern State state1091;
+extern State state1092;
+extern State state1093;
+extern State state1094;
+extern State state1095;
+extern State state1096;
+extern State state1097;
+extern State state1098;
+extern State state1099;
+extern State state1100;
+extern State state1101;
+extern State state1102;
+extern State state1103;
+extern State state1104;
+extern State state1105;
+extern State state1106;
+extern State state1107;
+extern State state1108;
+extern State state1109;
+extern State state1110;
+extern State state1111;
+extern State state1112;
+extern State state1113;
+extern State state1114;
+extern State state1115;
+extern State state1116;
+extern State state1117;
+extern State state1118;
+extern State state1119;
+extern State state1120;
+extern State state1121;
+extern State state1122;
+extern State state1123;
+extern State state1124;
+extern State state1125;
+extern State state1126;
+extern State state1127;
+extern State state1128;
+extern State state1129;
+extern State state1130;
+extern State state1131;
+extern State state1132;
+extern State state1133;
+extern State state1134;
+extern State state1135;
+extern State state1136;
+extern State state1137;
+extern State state1138;
+extern State state1139;
+extern State state1140;
+extern State state1141;
+extern State state1142;
+extern State state1143;
+extern State state1144;
+extern State state1145;
+extern State state1146;
+extern State state1147;
+extern State state1148;
+extern State state1149;
+extern State state1150;
+extern State state1151;
+extern State state1152;
+extern State state1153;
+extern State state1154;
+extern State state1155;
+extern State state1156;
+extern State state1157;
+extern State state1158;
+extern State state1159;
+extern State state1160;
+extern State state1161;
+extern State state1162;
+extern State state1163;
+extern State state1164;
+extern State state1165;
+extern State state1166;
+extern State state1167;
+extern State state1168;
+extern State state1169;
+extern State state1170;
+extern State state1171;
+extern State state1172;
+extern State state1173;
+extern State state1174;
+extern State state1175;
+extern State state1176;
+extern State state1177;
+extern State state1178;
+extern State state1179;
+extern State state1180;
+extern State state1181;
+extern State state1182;
+extern State state1183;
+extern State state1184;
+extern State state1185;
+extern State state1186;
+extern State state1187;
+extern State state1188;
+extern State state1189;
+extern State state1190;
+extern State state1191;
+extern State state1192;
+extern State state1193;
+extern State state1194;
+extern State state1195;
+extern State state1196;
+extern State state1197;
+extern State state1198;
+extern State state1199;
+extern State state1200;
+extern State state1201;
+extern State state1202;
+extern State state1203;
+extern State state1204;
+extern State state1205;
+extern State state1206;
+extern State state1207;
+extern State state1208;
+extern State state1209;
+extern State state1210;
+extern State state1211;
+extern State state1212;
+extern State state1213;
+extern State state1214;
+extern State state1215;
+extern State state1216;
+extern State state1217;
+extern State state1218;
+extern State state1219;
+extern State state1220;
+extern State state1221;
+extern State state1222;
+extern State state1223;
+extern State state1224;
+extern State state1225;
+extern State state1226;
+extern State state1227;
+extern State state1228;
+extern State state1229;
+extern State state1230;
+extern State state1231;
+extern State state1232;
+extern State state1233;
+extern State state1234;
+extern State state1235;
+extern State state1236;
+extern State state1237;
+extern State state1238;
+extern State state1239;
+extern State state1240;
+extern State state1241;
+extern State state1242;
+extern State state1243;
+extern State state1244;
+extern State state1245;
+extern State state1246;
+extern State state1247;
+extern State state1248;
+extern State state1249;
+extern State state1250;
+extern State state1251;
+extern State state1252;
+extern State state1253;
+extern State state1254;
+extern State state1255;
+extern State state1256;
+extern State state1257;
+extern State state1258;
+extern State state1259;
+extern State state1260;
+extern State state1261;
+extern State state1262;
+extern State state1263;
+extern State state1264;
+extern State state1265;
+extern State state1266;
+extern State state1267;
+extern State state1268;
+extern State state1269;
+extern State state1270;
+extern State state1271;
+extern State state1272;
+extern State state1273;
+extern State state1274;
+extern State state1275;
+extern State state1276;
+extern State state1277;
+extern State state1278;
+extern State state1279;
+extern State state1280;
+extern State state1281;
+extern State state1282;
+extern State state1283;
+extern State state1284;
+extern State state1285;
+extern State state1286;
+extern State state1287;
+extern State state1288;
+extern State state1289;
+extern State state1290;
+extern State state1291;
+extern State state1292;
+extern State state1293;
+extern State state1294;
+extern State state1295;
+extern State state1296;
+extern State state1297;
+extern State state1298;
+extern State state1299;
+extern State state1300;
+extern State state1301;
+extern State state1302;
+extern State state1303;
+extern State state1304;
+extern State state1305;
+extern State state1306;
+extern State state1307;
+extern State state1308;
+extern State state1309;
+extern State state1310;
+extern State state1311;
+extern State state1312;
+extern State state1313;
+extern State state1314;
+extern State state1315;
+extern State state1316;
+extern State state1317;
+extern State state1318;
+extern State state1319;
+extern State state1320;
+extern State state1321;
+extern State state1322;
+extern State state1323;
+extern State state1324;
+extern State state1325;
+extern State state1326;
+extern State state1327;
+extern State state1328;
+extern State state1329;
+extern State state1330;
+extern State state1331;
+extern State state1332;
+extern State state1333;
+extern State state1334;
+extern State state1335;
+extern State state1336;
+extern State state1337;
+extern State state1338;
+extern State state1339;
+extern State state1340;
+extern State state1341;
+extern State state1342;
+extern State state1343;
+extern State state1344;
+extern State state1345;
+extern State state1346;
+extern State state1347;
+extern State state1348;
+extern State state1349;
+extern State state1350;
+extern State state1351;
+extern State state1352;
+extern State state1353;
+extern State state1354;
+extern State state1355;
+extern State state1356;
+extern State state1357;
+extern State state1358;
+extern State state1359;
+extern State state1360;
+extern State state1361;
+extern State state1362;
+extern State state1363;
+extern State state1364;
+extern State state1365;
+extern State state1366;
+extern State state1367;
+extern State state1368;
+extern State state1369;
+extern State state1370;
+extern State state1371;
+extern State state1372;
+extern State state1373;
+extern State state1374;
+extern State state1375;
+extern State state1376;
+extern State state1377;
+extern State state1378;
+extern State state1379;
+extern State state1380;
+extern State state1381;
+extern State state1382;
+extern State state1383;
+extern State state1384;
+extern State state1385;
+extern State state1386;
+extern State state1387;
+extern State state1388;
+extern State state1389;
+extern State state1390;
+extern State state1391;
+extern State state1392;
+extern State state1393;
+extern State state1394;
+extern State state1395;
+extern State state1396;
+extern State state1397;
+extern State state1398;
+extern State state1399;
+extern State state1400;
+extern State state1401;
+extern State state1402;
+extern State state1403;
+extern State state1404;
+extern State state1405;
+extern State state1406;
+extern State state1407;
+extern State state1408;
+extern State state1409;
+extern State state1410;
+extern State state1411;
+extern State state1412;
+extern State state1413;
+extern State state1414;
+extern State state1415;
+extern State state1416;
+extern State state1417;
+extern State state1418;
+extern State state1419;
+extern State state1420;
+extern State state1421;
+extern State state1422;
+extern State state1423;
+extern State state1424;
+extern State state1425;
+extern State state1426;
+extern State state1427;
+extern State state1428;
+extern State state1429;
+extern State state1430;
+extern State state1431;
+extern State state1432;
+extern State state1433;
+extern State state1434;
+extern State state1435;
+extern State state1436;
+extern State state1437;
+extern State state1438;
+extern State state1439;
+extern State state1440;
+extern State state1441;
+extern State state1442;
+extern State state1443;
+extern State state1444;
+extern State state1445;
+extern State state1446;
+extern State state1447;
+extern State state1448;
+extern State state1449;
+extern State state1450;
+extern State state1451;
+extern State state1452;
+extern State state1453;
+extern State state1454;
+extern State state1455;
+extern State state1456;
+extern State state1457;
+extern State state1458;
+extern State state1459;
+extern State state1460;
+extern State state1461;
+extern State state1462;
+extern State state1463;
+extern State state1464;
+extern State state1465;
+extern State state1466;
+extern State state1467;
+extern State state1468;
+extern State state1469;
+extern State state1470;
+extern State state1471;
+extern State state1472;
+extern State state1473;
+extern State state1474;
+extern State state1475;
+extern State state1476;
+extern State state1477;
+extern State state1478;
+extern State state1479;
+extern State state1480;
+extern State state1481;
+extern State state1482;
+extern State state1483;
+extern State state1484;
+extern State state1485;
+extern State state1486;
+extern State state1487;
+extern State state1488;
+extern State state1489;
+extern State state1490;
+extern State state1491;
+extern State state1492;
+extern State state1493;
+extern State state1494;
+extern State state1495;
+extern State state1496;
+extern State state1497;
+extern State state1498;
+extern State state1499;
+extern State state1500;
+extern State state1501;
+extern State state1502;
+extern State state1503;
+extern State state1504;
+extern State state1505;
+extern State state1506;
+extern State state1507;
+extern State state1508;
+extern State state1509;
+extern State state1510;
+extern State state1511;
+extern State state1512;
+extern State state1513;
+extern State state1514;
+extern State state1515;
+extern State state1516;
+extern State state1517;
+extern State state1518;
+extern State state1519;
+extern State state1520;
+extern State state1521;
+extern State state1522;
+extern State state1523;
+extern State state1524;
+extern State state1525;
+extern State state1526;
+extern State state1527;
+extern State state1528;
+extern State state1529;
+extern State state1530;
+extern State state1531;
+extern State state1532;
+extern State state1533;
+extern State state1534;
+extern State state1535;
+extern State state1536;
+extern State state1537;
+extern State state1538;
+extern State state1539;
+extern State state1540;
+extern State state1541;
+extern State state1542;
+extern State state1543;
+extern State state1544;
+extern State state1545;
+extern State state1546;
+extern State state1547;
+extern State state1548;
+extern State state1549;
+extern State state1550;
+extern State state1551;
+extern State state1552;
+extern State state1553;
+extern State state1554;
+extern State state1555;
+extern State state1556;
+extern State state1557;
+extern State state1558;
+extern State state1559;
+extern State state1560;
+extern State state1561;
+extern State state1562;
+extern State state1563;
+extern State state1564;
+extern State state1565;
+extern State state1566;
+extern State state1567;
+extern State state1568;
+extern State state1569;
+extern State state1570;
+extern State state1571;
+extern State state1572;
+extern State state1573;
+extern State state1574;
+extern State state1575;
+extern State state1576;
+extern State state1577;
+extern State state1578;
+extern State state1579;
+extern State state1580;
+extern State state1581;
+extern State state1582;
+extern State state1583;
+extern State state1584;
+extern State state1585;
+extern State state1586;
+extern State state1587;
+extern State state1588;
+extern State state1589;
+extern State state1590;
+extern State state1591;
+extern State state1592;
+extern State state1593;
+extern State state1594;
+extern State state1595;
+extern State state1596;
+extern State state1597;
+extern State state1598;
+extern State state1599;
+extern State state1600;
+extern State state1601;
+extern State state1602;
+extern State state1603;
+extern State state1604;
+extern State state1605;
+extern State state1606;
+extern State state1607;
+extern State state1608;
+extern State state1609;
+extern State state1610;
+extern State state1611;
+extern State state1612;
+extern State state1613;
+extern State state1614;
+extern State state1615;
+extern State state1616;
+extern State state1617;
+extern State state1618;
+extern State state1619;
+extern State state1620;
+extern State state1621;
+extern State state1622;
+extern State state1623;
+extern State state1624;
+extern State state1625;
+extern State state1626;
+extern State state1627;
+extern State state1628;
+extern State state1629;
+extern State state1630;
+extern State state1631;
+extern State state1632;
+extern State state1633;
+extern State state1634;
+extern State state1635;
+extern State state1636;
+extern State state1637;
+extern State state1638;
+extern State state1639;
+extern State state1640;
+extern State state1641;
+extern State state1642;
+extern State state1643;
+extern State state1644;
+extern State state1645;
+extern State state1646;
+extern State state1647;
+extern State state1648;
+extern State state1649;
+extern State state1650;
+extern State state1651;
+extern State state1652;
+extern State state1653;
+extern State state1654;
+extern State state1655;
+extern State state1656;
+extern State state1657;
+extern State state1658;
+extern State state1659;
+extern State state1660;
+extern State state1661;
+extern State state1662;
+extern State state1663;
+extern State state1664;
+extern State state1665;
+extern State state1666;
+extern State state1667;
+extern State state1668;
+extern State state1669;
+extern State state1670;
+extern State state1671;
+extern State state1672;
+extern State state1673;
+extern State state1674;
+extern State state1675;
+extern State state1676;
+extern State state1677;
+extern State state1678;
+extern State state1679;
+extern State state1680;
+extern State state1681;
+extern State state1682;
+extern State state1683;
+extern State state1684;
+extern State state1685;
+extern State state1686;
+extern State state1687;
+extern State state1688;
+extern State state1689;
+extern State state1690;
+extern State state1691;
+extern State state1692;
+extern State state1693;
+extern State state1694;
+extern State state1695;
+extern State state1696;
+extern State state1697;
+extern State state1698;
+extern State state1699;
+extern State state1700;
+extern State state1701;
+extern State state1702;
+extern State state1703;
+extern State state1704;
+extern State state1705;
+extern State state1706;
+extern State state1707;
+extern State state1708;
+extern State state1709;
+extern State state1710;
+extern State state1711;
+extern State state1712;
+extern State state1713;
+extern State state1714;
+extern State state1715;
+extern State state1716;
+extern State state1717;
+extern State state1718;
+extern State state1719;
+extern State state1720;
+extern State state1721;
+extern State state1722;
+extern State state1723;
+extern State state1724;
+extern State state1725;
+extern State state1726;
+extern State state1727;
+extern State state1728;
+extern State state1729;
+extern State state1730;
+extern State state1731;
+extern State state1732;
+extern State state1733;
+extern State state1734;
+extern State state1735;
+extern State state1736;
+extern State state1737;
+extern State state1738;
+extern State state1739;
+extern State state1740;
+extern State state1741;
+extern State state1742;
+extern State state1743;
+extern State state1744;
+extern State state1745;
+extern State state1746;
+extern State state1747;
+extern State state1748;
+extern State state1749;
+extern State state1750;
+extern State state1751;
+extern State state1752;
+extern State state1753;
+extern State state1754;
+extern State state1755;
+extern State state1756;
+extern State state1757;
+extern State state1758;
+extern State state1759;
+extern State state1760;
+extern State state1761;
+extern State state1762;
+extern State state1763;
+extern State state1764;
+extern State state1765;
+extern State state1766;
+extern State state1767;
+extern State state1768;
+extern State state1769;
+extern State state1770;
+extern State state1771;
+extern State state1772;
+extern State state1773;
+extern State state1774;
+extern State state1775;
+extern State state1776;
+extern State state1777;
+extern State state1778;
+extern State state1779;
+extern State state1780;
+extern State state1781;
+extern State state1782;
+extern State state1783;
+extern State state1784;
+extern State state1785;
+extern State state1786;
+extern State state1787;
+extern State state1788;
+extern State state1789;
+extern State state1790;
+extern State state1791;
+extern State state1792;
+extern State state1793;
+extern State state1794;
+extern State state1795;
+extern State state1796;
+extern State state1797;
+extern State state1798;
+extern State state1799;
+extern State state1800;
+extern State state1801;
+extern State state1802;
+extern State state1803;
+extern State state1804;
+extern State state1805;
+extern State state1806;
+extern State state1807;
+extern State state1808;
+extern State state1809;
+extern State state1810;
+extern State state1811;
+extern State state1812;
+extern State state1813;
+extern State state1814;
+extern State state1815;
+extern State state1816;
+extern State state1817;
+extern State state1818;
+extern State state1819;
+extern State state1820;
+extern State state1821;
+extern State state1822;
+extern State state1823;
+extern State state1824;
+extern State state1825;
+extern State state1826;
+extern State state1827;
+extern State state1828;
+extern State state1829;
+extern State state1830;
+extern State state1831;
+extern State state1832;
+extern State state1833;
+extern State state1834;
+extern State state1835;
+extern State state1836;
+extern State state1837;
+extern State state1838;
+extern State state1839;
+extern State state1840;
+extern State state1841;
+extern State state1842;
+extern State state1843;
+extern State state1844;
+extern State state1845;
+extern State state1846;
+extern State state1847;
+extern State state1848;
+extern State state1849;
+extern State state1850;
+extern State state1851;
+extern State state1852;
+extern State state1853;
+extern State state1854;
+extern State state1855;
+extern State state1856;
+extern State state1857;
+extern State state1858;
+extern State state1859;
+extern State state1860;
+extern State state1861;
+extern State state1862;
+extern State state1863;
+extern State state1864;
+extern State state1865;
+extern State state1866;
+extern State state1867;
+extern State state1868;
+extern State state1869;
+extern State state1870;
+extern State state1871;
+extern State state1872;
+extern State state1873;
+extern State state1874;
+extern State state1875;
+extern State state1876;
+extern State state1877;
+extern State state1878;
+extern State state1879;
+extern State state1880;
+extern State state1881;
+extern State state1882;
+extern State state1883;
+extern State state1884;
+extern State state1885;
+extern State state1886;
+extern State state1887;
+extern State state1888;
+extern State state1889;
+extern State state1890;
+extern State state1891;
+extern State state1892;
+extern State state1893;
+extern State state1894;
+extern State state1895;
+extern State state1896;
+extern State state1897;
+extern State state1898;
+extern State state1899;
+extern State state1900;
+extern State state1901;
+extern State state1902;
+extern State state1903;
+extern State state1904;
+extern State state1905;
+extern State state1906;
+extern State state1907;
+extern State state1908;
+extern State state1909;
+extern State state1910;
+extern State state1911;
+extern State state1912;
+extern State state1913;
+extern State state1914;
+extern State state1915;
+extern State state1916;
+extern State state1917;
+extern State state1918;
+extern State state1919;
+extern State state1920;
+extern State state1921;
+extern State state1922;
+extern State state1923;
+extern State state1924;
+extern State state1925;
+extern State state1926;
+extern State state1927;
+extern State state1928;
+extern State state1929;
+extern State state1930;
+extern State state1931;
+extern State state1932;
+extern State state1933;
+extern State state1934;
+extern State state1935;
+extern State state1936;
+extern State state1937;
+extern State state1938;
+extern State state1939;
+extern State state1940;
+extern State state1941;
+extern State state1942;
+extern State state1943;
+extern State state1944;
+extern State state1945;
+extern State state1946;
+extern State state1947;
+extern State state1948;
+extern State state1949;
+extern State state1950;
+extern State state1951;
+extern State state1952;
+extern State state1953;
+extern State state1954;
+extern State state1955;
+extern State state1956;
+extern State state1957;
+extern State state1958;
+extern State state1959;
+extern State state1960;
+extern State state1961;
+extern State state1962;
+extern State state1963;
+extern State state1964;
+extern State state1965;
+extern State state1966;
+extern State state1967;
+extern State state1968;
+extern State state1969;
+extern State state1970;
+extern State state1971;
+extern State state1972;
+extern State state1973;
+extern State state1974;
+extern State state1975;
+extern State state1976;
+extern State state1977;
+extern State state1978;
+extern State state1979;
+extern State state1980;
+extern State state1981;
+extern State state1982;
+extern State state1983;
+extern State state1984;
+extern State state1985;
+extern State state1986;
+extern State state1987;
+extern State state1988;
+extern State state1989;
+extern State state1990;
+extern State state1991;
+extern State state1992;
+extern State state1993;
+extern State state1994;
+extern State state1995;
+extern State state1996;
+extern State state1997;
+extern State state1998;
+extern State state1999;
+extern State state2000;
+extern State state2001;
+extern State state2002;
+extern State state2003;
+extern State state2004;
+extern State state2005;
+extern State state2006;
+extern State state2007;
+extern State state2008;
+extern State state2009;
+extern State state2010;
+extern State state2011;
+extern State state2012;
+extern State state2013;
+extern State state2014;
+extern State state2015;
+extern State state2016;
+extern State state2017;
+extern State state2018;
+extern State state2019;
+extern State state2020;
+extern State state2021;
+extern State state2022;
+extern State state2023;
+extern State state2024;
+extern State state2025;
+extern State state2026;
+extern State state2027;
+extern State state2028;
+extern State state2029;
+extern State state2030;
+extern State state2031;
+extern State state2032;
+extern State state2033;
+extern State state2034;
+extern State state2035;
+extern State state2036;
+extern State state2037;
+extern State state2038;
+extern State state2039;
+extern State state2040;
+extern State state2041;
+extern State state2042;
+extern State state2043;
+extern State state2044;
+extern State state2045;
+extern State state2046;
+extern State state2047;
+extern State state2048;
+extern State state2049;
+extern State state2050;
+extern State state2051;
+extern State state2052;
+extern State state2053;
+extern State state2054;
+extern State state2055;
+extern State state2056;
+extern State state2057;
+extern State state2058;
+extern State state2059;
+extern State state2060;
+extern State state2061;
+extern State state2062;
+extern State state2063;
+extern State state2064;
+extern State state2065;
+extern State state2066;
+extern State state2067;
+extern State state2068;
+extern State state2069;
+extern State state2070;
+extern State state2071;
+extern State state2072;
+extern State state2073;
+extern State state2074;
+extern State state2075;
+extern State state2076;
+extern State state2077;
+extern State state2078;
+extern State state2079;
+extern State state2080;
+extern State state2081;
+extern State state2082;
+extern State state2083;
+extern State state2084;
+extern State state2085;
+extern State state2086;
+extern State state2087;
+extern State state2088;
+extern State state2089;
+extern State state2090;
+extern State state2091;
+extern State state2092;
+extern State state2093;
+extern State state2094;
+extern State state2095;
+extern State state2096;
+extern State state2097;
+extern State state2098;
+extern State state2099;
+extern State state2100;
+extern State state2101;
+extern State state2102;
+extern State state2103;
+extern State state2104;
+extern State state2105;
+extern State state2106;
+extern State state2107;
+extern State state2108;
+extern State state2109;
+extern State state2110;
+extern State state2111;
+extern State state2112;
+extern State state2113;
+extern State state2114;
+extern State state2115;
+extern State state2116;
+extern State state2117;
+extern State state2118;
+extern State state2119;
+extern State state2120;
+extern State state2121;
+extern State state2122;
+extern State state2123;
+extern State state2124;
+extern State state2125;
+extern State state2126;
+extern State state2127;
+extern State state2128;
+extern State state2129;
+extern State state2130;
+extern State state2131;
+extern State state2132;
+extern State state2133;
+extern State state2134;
+extern State state2135;
+extern State state2136;
+extern State state2137;
+extern State state2138;
+extern State state2139;
+extern State state2140;
+extern State state2141;
+extern State state2142;
+extern State state2143;
+extern State state2144;
+extern State state2145;
+extern State state2146;
+extern State state2147;
+extern State state2148;
+extern State state2149;
+extern State state2150;
+extern State state2151;
+extern State state2152;
+extern State state2153;
+extern State state2154;
+extern State state2155;
+extern State state2156;
+extern State state2157;
+extern State state2158;
+extern State state2159;
+extern State state2160;
+extern State state2161;
+extern State state2162;
+extern State state2163;
+extern State state2164;
+extern State state2165;
+extern State state2166;
+extern State state2167;
+extern State state2168;
+extern State state2169;
+extern State state2170;
+extern State state2171;
+extern State state2172;
+extern State state2173;
+extern State state2174;
+extern State state2175;
+extern State state2176;
+extern State state2177;
+extern State state2178;
+extern State state2179;
+extern State state2180;
+extern State state2181;
+extern State state2182;
+extern State state2183;
+extern State state2184;
+extern State state2185;
+extern State state2186;
+extern State state2187;
+extern State state2188;
+extern State state2189;
+extern State state2190;
+extern State state2191;
+extern State state2192;
+extern State state2193;
+extern State state2194;
+extern State state2195;
+extern State state2196;
+extern State state2197;
+extern State state2198;
+extern State state2199;
+extern State state2200;
+extern State state2201;
+extern State state2202;
+extern State state2203;
+extern State state2204;
+extern State state2205;
+extern State state2206;
+extern State state2207;
+extern State state2208;
+extern State state2209;
+extern State state2210;
+extern State state2211;
+extern State state2212;
+extern State state2213;
+extern State state2214;
+extern State state2215;
+extern State state2216;
+extern State state2217;
+extern State state2218;
+extern State state2219;
+extern State state2220;
+extern State state2221;
+extern State state2222;
+extern State state2223;
+extern State state2224;
+extern State state2225;
+extern State state2226;
+extern State state2227;
+extern State state2228;
+extern State state2229;
+extern State state2230;
+extern State state2231;
+extern State state2232;
+extern State state2233;
+extern State state2234;
+extern State state2235;
+extern State state2236;
+extern State state2237;
+extern State state2238;
+extern State state2239;
+extern State state2240;
+extern State state2241;
+extern State state2242;
+extern State state2243;
+extern State state2244;
+extern State state2245;
+extern State state2246;
+extern State state2247;
+extern State state2248;
+extern State state2249;
+extern State state2250;
+extern State state2251;
+extern State state2252;
+extern State state2253;
+extern State state2254;
+extern State state2255;
+extern State state2256;
+extern State state2257;
+extern State state2258;
+extern State state2259;
+extern State state2260;
+extern State state2261;
+extern State state2262;
+extern State state2263;
+extern State state2264;
+extern State state2265;
+extern State state2266;
+extern State state2267;
+extern State state2268;
+extern State state2269;
+extern State state2270;
+extern State state2271;
+extern State state2272;
+extern State state2273;
+extern State state2274;
+extern State state2275;
+extern State state2276;
+extern State state2277;
+extern State state2278;
+extern State state2279;
+extern State state2280;
+extern State state2281;
+extern State state2282;
+extern State state2283;
+extern State state2284;
+extern State state2285;
+extern State state2286;
+extern State state2287;
+extern State state2288;
+extern State state2289;
+extern State state2290;
+extern State state2291;
+extern State state2292;
+extern State state2293;
+extern State state2294;
+extern State state2295;
+extern State state2296;
+extern State state2297;
+extern State state2298;
+extern State state2299;
+extern State state2300;
+extern State state2301;
+extern State state2302;
+extern State state2303;
+extern State state2304;
+extern State state2305;
+extern State state2306;
+extern State state2307;
+extern State state2308;
+extern State state2309;
+extern State state2310;
+extern State state2311;
+extern State state2312;
+extern State state2313;
+extern State state2314;
+extern State state2315;
+extern State state2316;
+extern State state2317;
+extern State state2318;
+extern State state2319;
+extern State state2320;
+extern State state2321;
+extern State state2322;
+extern State state2323;
+extern State state2324;
+extern State state2325;
+extern State state2326;
+extern State state2327;
+extern State state2328;
+extern State state2329;
+extern State state2330;
+extern State state2331;
+extern State state2332;
+extern State state2333;
+extern State state2334;
+extern State state2335;
+extern State state2336;
+extern State state2337;
+extern State state2338;
+extern State state2339;
+extern State state2340;
+extern State state2341;
+extern State state2342;
+extern State state2343;
+extern State state2344;
+extern State state2345;
+extern State state2346;
+extern State state2347;
+extern State state2348;
+extern State state2349;
+extern State state2350;
+extern State state2351;
+extern State state2352;
+extern State state2353;
+extern State state2354;
+extern State state2355;
+extern State state2356;
+extern State state2357;
+extern State state2358;
+extern State state2359;
+extern State state2360;
+extern State state2361;
+extern State state2362;
+extern State state2363;
+extern State state2364;
+extern State state2365;
+extern State state2366;
+extern State state2367;
+extern State state2368;
+extern State state2369;
+extern State state2370;
+extern State state2371;
+extern State state2372;
+extern State state2373;
+extern State state2374;
+extern State state2375;
+extern State state2376;
+extern State state2377;
+extern State state2378;
+extern State state2379;
+extern State state2380;
+extern State state2381;
+extern State state2382;
+extern State state2383;
+extern State state2384;
+extern State state2385;
+extern State state2386;
+extern State state2387;
+extern State state2388;
+extern State state2389;
+extern State state2390;
+extern State state2391;
+extern State state2392;
+extern State state2393;
+extern State state2394;
+extern State state2395;
+extern State state2396;
+extern State state2397;
+extern State state2398;
+extern State state2399;
+extern State state2400;
+extern State state2401;
+extern State state2402;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term1, &state3}, {&term2, &state4}, {&term3, &state5}, {&term4, &state6}, {&term5, &state7}, {&term6, &state8}, {&term7, &state9}, {&term8, &state10}, {&term9, &state11}, {&term10, &state12}, {&term11, &state13}, {&term12, &state14}, {&term13, &state15}, {&term14, &state16}, {&term15, &state17}, {&term16, &state18}, {&term17, &state19}, {&term18, &state20}, {&term19, &state21}, {&term20, &state22}, {&term21, &state23}, {&term22, &state24}, {&term23, &state25}, {&term24, &state26}, {&term25, &state27}, {&term26, &state28}, {&term27, &state29}, {&term28, &state30}, {&term29, &state31}, {&term30, &state32}, {&term31, &state33}, {&term32, &state34}, {&term33, &state35}, {&term34, &state36}, {&term35, &state37}, {&term36, &state38}, {&term37, &state39}, {&term38, &state40}, {&term39, &state41}, {&term40, &state42}, {&term41, &state43}, {&term42, &state44}, {&term43, &state45}, {&term44, &state46}, {&term45, &state47}, {&term46, &state48}, {&term47, &state49}, {&term48, &state50}, {&term49, &state51}, {&term50, &state52}, {&term51, &state53}, {&term52, &state54}, {&term53, &state55}, {&term54, &state56}, {&term55, &state57}, {&term56, &state58}, {&term57, &state59}, {&term58, &state60}, {&term59, &state61}, {&term60, &state62}, {&term61, &state63}, {&term62, &state64}, {&term63, &state65}, {&term64, &state66}, {&term65, &state67}, {&term66, &state68}, {&term67, &state69}, {&term68, &state70}, {&term69, &state71}, {&term70, &state72}, {&term71, &state73}, {&term72, &state74}, {&term73, &state75}, {&term74, &state76}, {&term75, &state77}, {&term76, &state78}, {&term77, &state79}, {&term78, &state80}, {&term79, &state81}, {&term80, &state82}, {&term81, &state83}, {&term82, &state84}, {&term83, &state85}, {&term84, &state86}, {&term85, &state87}, {&term86, &state88}, {&term87, &state89}, {&term88, &state90}, {&term89, &state91}, {&term90, &state92}, {&term91, &state93}, {&term92, &state94}, {&term93, &state95}, {&term94, &state96}, {&term95, &state97}, {&term96, &state98}, {&term97, &state99}, {&term98, &state100}, {&term99, &state101}, {&term100, &state102}, {&term101, &state103}, {&term102, &state104}, {&term103, &state105}, {&term104, &state106}, {&term105, &state107}, {&term106, &state108}, {&term107, &state109}, {&term108, &state110}, {&term109, &state111}, {&term110, &state112}, {&term111, &state113}, {&term112, &state114}, {&term113, &state115}, {&term114, &state116}, {&term115, &state117}, {&term116, &state118}, {&term117, &state119}, {&term118, &state120}, {&term119, &state121}, {&term120, &state122}, {&term121, &state123}, {&term122, &state124}, {&term123, &state125}, {&term124, &state126}, {&term125, &state127}, {&term126, &state128}, {&term127, &state129}, {&term128, &state130}, {&term257, &state259}, {&term258, &state260}, {&term259, &state261}, {&term260, &state262}, {&term261, &state263}, {&term262, &state264}, {&term263, &state265}, {&term264, &state266}, {&term129, &state131}, {&term130, &state132}, {&term131, &state133}, {&term132, &state134}, {&term133, &state135}, {&term134, &state136}, {&term135, &state137}, {&term136, &state138}, {&term137, &state139}, {&term138, &state140}, {&term139, &state141}, {&term140, &state142}, {&term141, &state143}, {&term142, &state144}, {&term143, &state145}, {&term144, &state146}, {&term145, &state147}, {&term146, &state148}, {&term147, &state149}, {&term148, &state150}, {&term149, &state151}, {&term150, &state152}, {&term151, &state153}, {&term152, &state154}, {&term153, &state155}, {&term154, &state156}, {&term155, &state157}, {&term156, &state158}, {&term157, &state159}, {&term158, &state160}, {&term159, &state161}, {&term160, &state162}, {&term161, &state163}, {&term162, &state164}, {&term163, &state165}, {&term164, &state166}, {&term165, &state167}, {&term166, &state168}, {&term167, &state169}, {&term168, &state170}, {&term169, &state171}, {&term170, &state172}, {&term171, &state173}, {&term172, &state174}, {&term173, &state175}, {&term174, &state176}, {&term175, &state177}, {&term176, &state178}, {&term177, &state179}, {&term178, &state180}, {&term179, &state181}, {&term180, &state182}, {&term181, &state183}, {&term182, &state184}, {&term183, &state185}, {&term184, &state186}, {&term185, &state187}, {&term186, &state188}, {&term187, &state189}, {&term188, &state190}, {&term189, &state191}, {&term190, &state192}, {&term191, &state193}, {&term192, &state194}, {&term193, &state195}, {&term194, &state196}, {&term195, &state197}, {&term196, &state198}, {&term197, &state199}, {&term198, &state200}, {&term199, &state201}, {&term200, &state202}, {&term201, &state203}, {&term202, &state204}, {&term203, &state205}, {&term204, &state206}, {&term205, &state207}, {&term206, &state208}, {&term207, &state209}, {&term208, &state210}, {&term209, &state211}, {&term210, &state212}, {&term211, &state213}, {&term212, &state214}, {&term213, &state215}, {&term214, &state216}, {&term215, &state217}, {&term216, &state218}, {&term217, &state219}, {&term218, &state220}, {&term219, &state221}, {&term220, &state222}, {&term221, &state223}, {&term222, &state224}, {&term223, &state225}, {&term224, &state226}, {&term225, &state227}, {&term226, &state228}, {&term227, &state229}, {&term228, &state230}, {&term229, &state231}, {&term230, &state232}, {&term231, &state233}, {&term232, &state234}, {&term233, &state235}, {&term234, &state236}, {&term235, &state237}, {&term236, &state238}, {&term237, &state239}, {&term238, &state240}, {&term239, &state241}, {&term240, &state242}, {&term241, &state243}, {&term242, &state244}, {&term243, &state245}, {&term244, &state246}, {&term245, &state247}, {&term246, &state248}, {&term247, &state249}, {&term248, &state250}, {&term249, &state251}, {&term250, &state252}, {&term251, &state253}, {&term252, &state254}, {&term253, &state255}, {&term254, &state256}, {&term255, &state257}, {&term256, &state258}, {&term513, &state515}, {&term514, &state516}, {&term515, &state517}, {&term516, &state518}, {&term517, &state519}, {&term518, &state520}, {&term519, &state521}, {&term520, &state522}, {&term521, &state523}, {&term522, &state524}, {&term523, &state525}, {&term524, &state526}, {&term525, &state527}, {&term526, &state528}, {&term527, &state529}, {&term528, &state530}, {&term265, &state267}, {&term266, &state268}, {&term267, &state269}, {&term268, &state270}, {&term269, &state271}, {&term270, &state272}, {&term271, &state273}, {&term272, &state274}, {&term273, &state275}, {&term274, &state276}, {&term275, &state277}, {&term276, &state278}, {&term277, &state279}, {&term278, &state280}, {&term279, &state281}, {&term280, &state282}, {&term281, &state283}, {&term282, &state284}, {&term283, &state285}, {&term284, &state286}, {&term285, &state287}, {&term286, &state288}, {&term287, &state289}, {&term288, &state290}, {&term289, &state291}, {&term290, &state292}, {&term291, &state293}, {&term292, &state294}, {&term293, &state295}, {&term294, &state296}, {&term295, &state297}, {&term296, &state298}, {&term297, &state299}, {&term298, &state300}, {&term299, &state301}, {&term300, &state302}, {&term301, &state303}, {&term302, &state304}, {&term303, &state305}, {&term304, &state306}, {&term305, &state307}, {&term306, &state308}, {&term307, &state309}, {&term308, &state310}, {&term309, &state311}, {&term310, &state312}, {&term311, &state313}, {&term312, &state314}, {&term313, &state315}, {&term314, &state316}, {&term315, &state317}, {&term316, &state318}, {&term317, &state319}, {&term318, &state320}, {&term319, &state321}, {&term320, &state322}, {&term321, &state323}, {&term322, &state324}, {&term323, &state325}, {&term324, &state326}, {&term325, &state327}, {&term326, &state328}, {&term327, &state329}, {&term328, &state330}, {&term329, &state331}, {&term330, &state332}, {&term331, &state333}, {&term332, &state334}, {&term333, &state335}, {&term334, &state336}, {&term335, &state337}, {&term336, &state338}, {&term337, &state339}, {&term338, &state340}, {&term339, &state341}, {&term340, &state342}, {&term341, &state343}, {&term342, &state344}, {&term343, &state345}, {&term344, &state346}, {&term345, &state347}, {&term346, &state348}, {&term347, &state349}, {&term348, &state350}, {&term349, &state351}, {&term350, &state352}, {&term351, &state353}, {&term352, &state354}, {&term353, &state355}, {&term354, &state356}, {&term355, &state357}, {&term356, &state358}, {&term357, &state359}, {&term358, &state360}, {&term359, &state361}, {&term360, &state362}, {&term361, &state363}, {&term362, &state364}, {&term363, &state365}, {&term364, &state366}, {&term365, &state367}, {&term366, &state368}, {&term367, &state369}, {&term368, &state370}, {&term369, &state371}, {&term370, &state372}, {&term371, &state373}, {&term372, &state374}, {&term373, &state375}, {&term374, &state376}, {&term375, &state377}, {&term376, &state378}, {&term377, &state379}, {&term378, &state380}, {&term379, &state381}, {&term380, &state382}, {&term381, &state383}, {&term382, &state384}, {&term383, &state385}, {&term384, &state386}, {&term385, &state387}, {&term386, &state388}, {&term387, &state389}, {&term388, &state390}, {&term389, &state391}, {&term390, &state392}, {&term391, &state393}, {&term392, &state394}, {&term393, &state395}, {&term394, &state396}, {&term395, &state397}, {&term396, &state398}, {&term397, &state399}, {&term398, &state400}, {&term399, &state401}, {&term400, &state402}, {&term401, &state403}, {&term402, &state404}, {&term403, &state405}, {&term404, &state406}, {&term405, &state407}, {&term406, &state408}, {&term407, &state409}, {&term408, &state410}, {&term409, &state411}, {&term410, &state412}, {&term411, &state413}, {&term412, &state414}, {&term413, &state415}, {&term414, &state416}, {&term415, &state417}, {&term416, &state418}, {&term417, &state419}, {&term418, &state420}, {&term419, &state421}, {&term420, &state422}, {&term421, &state423}, {&term422, &state424}, {&term423, &state425}, {&term424, &state426}, {&term425, &state427}, {&term426, &state428}, {&term427, &state429}, {&term428, &state430}, {&term429, &state431}, {&term430, &state432}, {&term431, &state433}, {&term432, &state434}, {&term433, &state435}, {&term434, &state436}, {&term435, &state437}, {&term436, &state438}, {&term437, &state439}, {&term438, &state440}, {&term439, &state441}, {&term440, &state442}, {&term441, &state443}, {&term442, &state444}, {&term443, &state445}, {&term444, &state446}, {&term445, &state447}, {&term446, &state448}, {&term447, &state449}, {&term448, &state450}, {&term449, &state451}, {&term450, &state452}, {&term451, &state453}, {&term452, &state454}, {&term453, &state455}, {&term454, &state456}, {&term455, &state457}, {&term456, &state458}, {&term457, &state459}, {&term458, &state460}, {&term459, &state461}, {&term460, &state462}, {&term461, &state463}, {&term462, &state464}, {&term463, &state465}, {&term464, &state466}, {&term465, &state467}, {&term466, &state468}, {&term467, &state469}, {&term468, &state470}, {&term469, &state471}, {&term470, &state472}, {&term471, &state473}, {&term472, &state474}, {&term473, &state475}, {&term474, &state476}, {&term475, &state477}, {&term476, &state478}, {&term477, &state479}, {&term478, &state480}, {&term479, &state481}, {&term480, &state482}, {&term481, &state483}, {&term482, &state484}, {&term483, &state485}, {&term484, &state486}, {&term485, &state487}, {&term486, &state488}, {&term487, &state489}, {&term488, &state490}, {&term489, &state491}, {&term490, &state492}, {&term491, &state493}, {&term492, &state494}, {&term493, &state495}, {&term494, &state496}, {&term495, &state497}, {&term496, &state498}, {&term497, &state499}, {&term498, &state500}, {&term499, &state501}, {&term500, &state502}, {&term501, &state503}, {&term502, &state504}, {&term503, &state505}, {&term504, &state506}, {&term505, &state507}, {&term506, &state508}, {&term507, &state509}, {&term508, &state510}, {&term509, &state511}, {&term510, &state512}, {&term511, &state513}, {&term512, &state514}, {&term529, &state531}, {&term530, &state532}, {&term531, &state533}, {&term532, &state534}, {&term533, &state535}, {&term534, &state536}, {&term535, &state537}, {&term536, &state538}, {&term537, &state539}, {&term538, &state540}, {&term539, &state541}, {&term540, &state542}, {&term541, &state543}, {&term542, &state544}, {&term543, &state545}, {&term544, &state546}, {&term545, &state547}, {&term546, &state548}, {&term547, &state549}, {&term548, &state550}, {&term549, &state551}, {&term550, &state552}, {&term551, &state553}, {&term552, &state554}, {&term553, &state555}, {&term554, &state556}, {&term555, &state557}, {&term556, &state558}, {&term557, &state559}, {&term558, &state560}, {&term559, &state561}, {&term560, &state562}, {&term561, &state563}, {&term562, &state564}, {&term563, &state565}, {&term564, &state566}, {&term565, &state567}, {&term566, &state568}, {&term567, &state569}, {&term568, &state570}, {&term569, &state571}, {&term570, &state572}, {&term571, &state573}, {&term572, &state574}, {&term573, &state575}, {&term574, &state576}, {&term575, &state577}, {&term576, &state578}, {&term577, &state579}, {&term578, &state580}, {&term579, &state581}, {&term580, &state582}, {&term581, &state583}, {&term582, &state584}, {&term583, &state585}, {&term584, &state586}, {&term585, &state587}, {&term586, &state588}, {&term587, &state589}, {&term588, &state590}, {&term589, &state591}, {&term590, &state592}, {&term591, &state593}, {&term592, &state594}, {&term593, &state595}, {&term594, &state596}, {&term595, &state597}, {&term596, &state598}, {&term597, &state599}, {&term598, &state600}, {&term599, &state601}, {&term600, &state602}, {&term601, &state603}, {&term602, &state604}, {&term603, &state605}, {&term604, &state606}, {&term605, &state607}, {&term606, &state608}, {&term607, &state609}, {&term608, &state610}, {&term609, &state611}, {&term610, &state612}, {&term611, &state613}, {&term612, &state614}, {&term613, &state615}, {&term614, &state616}, {&term615, &state617}, {&term616, &state618}, {&term617, &state619}, {&term618, &state620}, {&term619, &state621}, {&term620, &state622}, {&term621, &state623}, {&term622, &state624}, {&term623, &state625}, {&term624, &state626}, {&term625, &state627}, {&term626, &state628}, {&term627, &state629}, {&term628, &state630}, {&term629, &state631}, {&term630, &state632}, {&term631, &state633}, {&term632, &state634}, {&term633, &state635}, {&term634, &state636}, {&term635, &state637}, {&term636, &state638}, {&term637, &state639}, {&term638, &state640}, {&term639, &state641}, {&term640, &state642}, {&term641, &state643}, {&term642, &state644}, {&term643, &state645}, {&term644, &state646}, {&term645, &state647}, {&term646, &state648}, {&term647, &state649}, {&term648, &state650}, {&term649, &state651}, {&term650, &state652}, {&term651, &state653}, {&term652, &state654}, {&term653, &state655}, {&term654, &state656}, {&term655, &state657}, {&term656, &state658}, {&term657, &state659}, {&term658, &state660}, {&term659, &state661}, {&term660, &state662}, {&term661, &state663}, {&term662, &state664}, {&term663, &state665}, {&term664, &state666}, {&term665, &state667}, {&term666, &state668}, {&term667, &state669}, {&term668, &state670}, {&term669, &state671}, {&term670, &state672}, {&term671, &state673}, {&term672, &state674}, {&term673, &state675}, {&term674, &state676}, {&term675, &state677}, {&term676, &state678}, {&term677, &state679}, {&term678, &state680}, {&term679, &state681}, {&term680, &state682}, {&term681, &state683}, {&term682, &state684}, {&term683, &state685}, {&term684, &state686}, {&term685, &state687}, {&term686, &state688}, {&term687, &state689}, {&term688, &state690}, {&term689, &state691}, {&term690, &state692}, {&term691, &state693}, {&term692, &state694}, {&term693, &state695}, {&term694, &state696}, {&term695, &state697}, {&term696, &state698}, {&term697, &state699}, {&term698, &state700}, {&term699, &state701}, {&term700, &state702}, {&term701, &state703}, {&term702, &state704}, {&term703, &state705}, {&term704, &state706}, {&term705, &state707}, {&term706, &state708}, {&term707, &state709}, {&term708, &state710}, {&term709, &state711}, {&term710, &state712}, {&term711, &state713}, {&term712, &state714}, {&term713, &state715}, {&term714, &state716}, {&term715, &state717}, {&term716, &state718}, {&term717, &state719}, {&term718, &state720}, {&term719, &state721}, {&term720, &state722}, {&term721, &state723}, {&term722, &state724}, {&term723, &state725}, {&term724, &state726}, {&term725, &state727}, {&term726, &state728}, {&term727, &state729}, {&term728, &state730}, {&term729, &state731}, {&term730, &state732}, {&term731, &state733}, {&term732, &state734}, {&term733, &state735}, {&term734, &state736}, {&term735, &state737}, {&term736, &state738}, {&term737, &state739}, {&term738, &state740}, {&term739, &state741}, {&term740, &state742}, {&term741, &state743}, {&term742, &state744}, {&term743, &state745}, {&term744, &state746}, {&term745, &state747}, {&term746, &state748}, {&term747, &state749}, {&term748, &state750}, {&term749, &state751}, {&term750, &state752}, {&term751, &state753}, {&term752, &state754}, {&term753, &state755}, {&term754, &state756}, {&term755, &state757}, {&term756, &state758}, {&term757, &state759}, {&term758, &state760}, {&term759, &state761}, {&term760, &state762}, {&term761, &state763}, {&term762, &state764}, {&term763, &state765}, {&term764, &state766}, {&term765, &state767}, {&term766, &state768}, {&term767, &state769}, {&term768, &state770}, {&term769, &state771}, {&term770, &state772}, {&term771, &state773}, {&term772, &state774}, {&term773, &state775}, {&term774, &state776}, {&term775, &state777}, {&term776, &state778}, {&term777, &state779}, {&term778, &state780}, {&term779, &state781}, {&term780, &state782}, {&term781, &state783}, {&term782, &state784}, {&term783, &state785}, {&term784, &state786}, {&term785, &state787}, {&term786, &state788}, {&term787, &state789}, {&term788, &state790}, {&term789, &state791}, {&term790, &state792}, {&term791, &state793}, {&term792, &state794}, {&term793, &state795}, {&term794, &state796}, {&term795, &state797}, {&term796, &state798}, {&term797, &state799}, {&term798, &state800}, {&term799, &state801}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term802, &state2401}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term802, &state2399}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {{&term802, &state2397}};
+std::vector<Reduce> reduce4 = {};
+std::vector<Shift> shift5 = {{&term802, &state2395}};
+std::vector<Reduce> reduce5 = {};
+std::vector<Shift> shift6 = {{&term802, &state2393}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {{&term802, &state2391}};
+std::vector<Reduce> reduce7 = {};
+std::vector<Shift> shift8 = {{&term802, &state2389}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term802, &state2387}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term802, &state2385}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {{&term802, &state2383}};
+std::vector<Reduce> reduce11 = {};
+std::vector<Shift> shift12 = {{&term802, &state2381}};
+std::vector<Reduce> reduce12 = {};
+std::vector<Shift> shift13 = {{&term802, &state2379}};
+std::vector<Reduce> reduce13 = {};
+std::vector<Shift> shift14 = {{&term802, &state2377}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {{&term802, &state2375}};
+std::vector<Reduce> reduce15 = {};
+std::vector<Shift> shift16 = {{&term802, &state2373}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term802, &state2371}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term802, &state2369}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {{&term802, &state2367}};
+std::vector<Reduce> reduce19 = {};
+std::vector<Shift> shift20 = {{&term802, &state2365}};
+std::vector<Reduce> reduce20 = {};
+std::vector<Shift> shift21 = {{&term802, &state2363}};
+std::vector<Reduce> reduce21 = {};
+std::vector<Shift> shift22 = {{&term802, &state2361}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {{&term802, &state2359}};
+std::vector<Reduce> reduce23 = {};
+std::vector<Shift> shift24 = {{&term802, &state2357}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term802, &state2355}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term802, &state2353}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {{&term802, &state2351}};
+std::vector<Reduce> reduce27 = {};
+std::vector<Shift> shift28 = {{&term802, &state2349}};
+std::vector<Reduce> reduce28 = {};
+std::vector<Shift> shift29 = {{&term802, &state2347}};
+std::vector<Reduce> reduce29 = {};
+std::vector<Shift> shift30 = {{&term802, &state2345}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {{&term802, &state2343}};
+std::vector<Reduce> reduce31 = {};
+std::vector<Shift> shift32 = {{&term802, &state2341}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term802, &state2339}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term802, &state2337}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {{&term802, &state2335}};
+std::vector<Reduce> reduce35 = {};
+std::vector<Shift> shift36 = {{&term802, &state2333}};
+std::vector<Reduce> reduce36 = {};
+std::vector<Shift> shift37 = {{&term802, &state2331}};
+std::vector<Reduce> reduce37 = {};
+std::vector<Shift> shift38 = {{&term802, &state2329}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {{&term802, &state2327}};
+std::vector<Reduce> reduce39 = {};
+std::vector<Shift> shift40 = {{&term802, &state2325}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term802, &state2323}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term802, &state2321}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {{&term802, &state2319}};
+std::vector<Reduce> reduce43 = {};
+std::vector<Shift> shift44 = {{&term802, &state2317}};
+std::vector<Reduce> reduce44 = {};
+std::vector<Shift> shift45 = {{&term802, &state2315}};
+std::vector<Reduce> reduce45 = {};
+std::vector<Shift> shift46 = {{&term802, &state2313}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {{&term802, &state2311}};
+std::vector<Reduce> reduce47 = {};
+std::vector<Shift> shift48 = {{&term802, &state2309}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term802, &state2307}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term802, &state2305}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {{&term802, &state2303}};
+std::vector<Reduce> reduce51 = {};
+std::vector<Shift> shift52 = {{&term802, &state2301}};
+std::vector<Reduce> reduce52 = {};
+std::vector<Shift> shift53 = {{&term802, &state2299}};
+std::vector<Reduce> reduce53 = {};
+std::vector<Shift> shift54 = {{&term802, &state2297}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {{&term802, &state2295}};
+std::vector<Reduce> reduce55 = {};
+std::vector<Shift> shift56 = {{&term802, &state2293}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term802, &state2291}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term802, &state2289}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {{&term802, &state2287}};
+std::vector<Reduce> reduce59 = {};
+std::vector<Shift> shift60 = {{&term802, &state2285}};
+std::vector<Reduce> reduce60 = {};
+std::vector<Shift> shift61 = {{&term802, &state2283}};
+std::vector<Reduce> reduce61 = {};
+std::vector<Shift> shift62 = {{&term802, &state2281}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {{&term802, &state2279}};
+std::vector<Reduce> reduce63 = {};
+std::vector<Shift> shift64 = {{&term802, &state2277}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term802, &state2275}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term802, &state2273}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {{&term802, &state2271}};
+std::vector<Reduce> reduce67 = {};
+std::vector<Shift> shift68 = {{&term802, &state2269}};
+std::vector<Reduce> reduce68 = {};
+std::vector<Shift> shift69 = {{&term802, &state2267}};
+std::vector<Reduce> reduce69 = {};
+std::vector<Shift> shift70 = {{&term802, &state2265}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {{&term802, &state2263}};
+std::vector<Reduce> reduce71 = {};
+std::vector<Shift> shift72 = {{&term802, &state2261}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term802, &state2259}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term802, &state2257}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {{&term802, &state2255}};
+std::vector<Reduce> reduce75 = {};
+std::vector<Shift> shift76 = {{&term802, &state2253}};
+std::vector<Reduce> reduce76 = {};
+std::vector<Shift> shift77 = {{&term802, &state2251}};
+std::vector<Reduce> reduce77 = {};
+std::vector<Shift> shift78 = {{&term802, &state2249}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {{&term802, &state2247}};
+std::vector<Reduce> reduce79 = {};
+std::vector<Shift> shift80 = {{&term802, &state2245}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term802, &state2243}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term802, &state2241}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {{&term802, &state2239}};
+std::vector<Reduce> reduce83 = {};
+std::vector<Shift> shift84 = {{&term802, &state2237}};
+std::vector<Reduce> reduce84 = {};
+std::vector<Shift> shift85 = {{&term802, &state2235}};
+std::vector<Reduce> reduce85 = {};
+std::vector<Shift> shift86 = {{&term802, &state2233}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {{&term802, &state2231}};
+std::vector<Reduce> reduce87 = {};
+std::vector<Shift> shift88 = {{&term802, &state2229}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term802, &state2227}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term802, &state2225}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {{&term802, &state2223}};
+std::vector<Reduce> reduce91 = {};
+std::vector<Shift> shift92 = {{&term802, &state2221}};
+std::vector<Reduce> reduce92 = {};
+std::vector<Shift> shift93 = {{&term802, &state2219}};
+std::vector<Reduce> reduce93 = {};
+std::vector<Shift> shift94 = {{&term802, &state2217}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {{&term802, &state2215}};
+std::vector<Reduce> reduce95 = {};
+std::vector<Shift> shift96 = {{&term802, &state2213}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term802, &state2211}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term802, &state2209}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {{&term802, &state2207}};
+std::vector<Reduce> reduce99 = {};
+std::vector<Shift> shift100 = {{&term802, &state2205}};
+std::vector<Reduce> reduce100 = {};
+std::vector<Shift> shift101 = {{&term802, &state2203}};
+std::vector<Reduce> reduce101 = {};
+std::vector<Shift> shift102 = {{&term802, &state2201}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {{&term802, &state2199}};
+std::vector<Reduce> reduce103 = {};
+std::vector<Shift> shift104 = {{&term802, &state2197}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term802, &state2195}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term802, &state2193}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {{&term802, &state2191}};
+std::vector<Reduce> reduce107 = {};
+std::vector<Shift> shift108 = {{&term802, &state2189}};
+std::vector<Reduce> reduce108 = {};
+std::vector<Shift> shift109 = {{&term802, &state2187}};
+std::vector<Reduce> reduce109 = {};
+std::vector<Shift> shift110 = {{&term802, &state2185}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {{&term802, &state2183}};
+std::vector<Reduce> reduce111 = {};
+std::vector<Shift> shift112 = {{&term802, &state2181}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term802, &state2179}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term802, &state2177}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {{&term802, &state2175}};
+std::vector<Reduce> reduce115 = {};
+std::vector<Shift> shift116 = {{&term802, &state2173}};
+std::vector<Reduce> reduce116 = {};
+std::vector<Shift> shift117 = {{&term802, &state2171}};
+std::vector<Reduce> reduce117 = {};
+std::vector<Shift> shift118 = {{&term802, &state2169}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {{&term802, &state2167}};
+std::vector<Reduce> reduce119 = {};
+std::vector<Shift> shift120 = {{&term802, &state2165}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term802, &state2163}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term802, &state2161}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {{&term802, &state2159}};
+std::vector<Reduce> reduce123 = {};
+std::vector<Shift> shift124 = {{&term802, &state2157}};
+std::vector<Reduce> reduce124 = {};
+std::vector<Shift> shift125 = {{&term802, &state2155}};
+std::vector<Reduce> reduce125 = {};
+std::vector<Shift> shift126 = {{&term802, &state2153}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {{&term802, &state2151}};
+std::vector<Reduce> reduce127 = {};
+std::vector<Shift> shift128 = {{&term802, &state2149}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term802, &state2147}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term802, &state2145}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {{&term802, &state2143}};
+std::vector<Reduce> reduce131 = {};
+std::vector<Shift> shift132 = {{&term802, &state2141}};
+std::vector<Reduce> reduce132 = {};
+std::vector<Shift> shift133 = {{&term802, &state2139}};
+std::vector<Reduce> reduce133 = {};
+std::vector<Shift> shift134 = {{&term802, &state2137}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {{&term802, &state2135}};
+std::vector<Reduce> reduce135 = {};
+std::vector<Shift> shift136 = {{&term802, &state2133}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term802, &state2131}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term802, &state2129}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {{&term802, &state2127}};
+std::vector<Reduce> reduce139 = {};
+std::vector<Shift> shift140 = {{&term802, &state2125}};
+std::vector<Reduce> reduce140 = {};
+std::vector<Shift> shift141 = {{&term802, &state2123}};
+std::vector<Reduce> reduce141 = {};
+std::vector<Shift> shift142 = {{&term802, &state2121}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {{&term802, &state2119}};
+std::vector<Reduce> reduce143 = {};
+std::vector<Shift> shift144 = {{&term802, &state2117}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term802, &state2115}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term802, &state2113}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {{&term802, &state2111}};
+std::vector<Reduce> reduce147 = {};
+std::vector<Shift> shift148 = {{&term802, &state2109}};
+std::vector<Reduce> reduce148 = {};
+std::vector<Shift> shift149 = {{&term802, &state2107}};
+std::vector<Reduce> reduce149 = {};
+std::vector<Shift> shift150 = {{&term802, &state2105}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {{&term802, &state2103}};
+std::vector<Reduce> reduce151 = {};
+std::vector<Shift> shift152 = {{&term802, &state2101}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term802, &state2099}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term802, &state2097}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {{&term802, &state2095}};
+std::vector<Reduce> reduce155 = {};
+std::vector<Shift> shift156 = {{&term802, &state2093}};
+std::vector<Reduce> reduce156 = {};
+std::vector<Shift> shift157 = {{&term802, &state2091}};
+std::vector<Reduce> reduce157 = {};
+std::vector<Shift> shift158 = {{&term802, &state2089}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {{&term802, &state2087}};
+std::vector<Reduce> reduce159 = {};
+std::vector<Shift> shift160 = {{&term802, &state2085}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term802, &state2083}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term802, &state2081}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {{&term802, &state2079}};
+std::vector<Reduce> reduce163 = {};
+std::vector<Shift> shift164 = {{&term802, &state2077}};
+std::vector<Reduce> reduce164 = {};
+std::vector<Shift> shift165 = {{&term802, &state2075}};
+std::vector<Reduce> reduce165 = {};
+std::vector<Shift> shift166 = {{&term802, &state2073}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {{&term802, &state2071}};
+std::vector<Reduce> reduce167 = {};
+std::vector<Shift> shift168 = {{&term802, &state2069}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term802, &state2067}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term802, &state2065}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {{&term802, &state2063}};
+std::vector<Reduce> reduce171 = {};
+std::vector<Shift> shift172 = {{&term802, &state2061}};
+std::vector<Reduce> reduce172 = {};
+std::vector<Shift> shift173 = {{&term802, &state2059}};
+std::vector<Reduce> reduce173 = {};
+std::vector<Shift> shift174 = {{&term802, &state2057}};
+std::vector<Reduce> reduce174 = {};
+std::vector<Shift> shift175 = {{&term802, &state2055}};
+std::vector<Reduce> reduce175 = {};
+std::vector<Shift> shift176 = {{&term802, &state2053}};
+std::vector<Reduce> reduce176 = {};
+std::vector<Shift> shift177 = {{&term802, &state2051}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {{&term802, &state2049}};
+std::vector<Reduce> reduce178 = {};
+std::vector<Shift> shift179 = {{&term802, &state2047}};
+std::vector<Reduce> reduce179 = {};
+std::vector<Shift> shift180 = {{&term802, &state2045}};
+std::vector<Reduce> reduce180 = {};
+std::vector<Shift> shift181 = {{&term802, &state2043}};
+std::vector<Reduce> reduce181 = {};
+std::vector<Shift> shift182 = {{&term802, &state2041}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {{&term802, &state2039}};
+std::vector<Reduce> reduce183 = {};
+std::vector<Shift> shift184 = {{&term802, &state2037}};
+std::vector<Reduce> reduce184 = {};
+std::vector<Shift> shift185 = {{&term802, &state2035}};
+std::vector<Reduce> reduce185 = {};
+std::vector<Shift> shift186 = {{&term802, &state2033}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift187 = {{&term802, &state2031}};
+std::vector<Reduce> reduce187 = {};
+std::vector<Shift> shift188 = {{&term802, &state2029}};
+std::vector<Reduce> reduce188 = {};
+std::vector<Shift> shift189 = {{&term802, &state2027}};
+std::vector<Reduce> reduce189 = {};
+std::vector<Shift> shift190 = {{&term802, &state2025}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {{&term802, &state2023}};
+std::vector<Reduce> reduce191 = {};
+std::vector<Shift> shift192 = {{&term802, &state2021}};
+std::vector<Reduce> reduce192 = {};
+std::vector<Shift> shift193 = {{&term802, &state2019}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term802, &state2017}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {{&term802, &state2015}};
+std::vector<Reduce> reduce195 = {};
+std::vector<Shift> shift196 = {{&term802, &state2013}};
+std::vector<Reduce> reduce196 = {};
+std::vector<Shift> shift197 = {{&term802, &state2011}};
+std::vector<Reduce> reduce197 = {};
+std::vector<Shift> shift198 = {{&term802, &state2009}};
+std::vector<Reduce> reduce198 = {};
+std::vector<Shift> shift199 = {{&term802, &state2007}};
+std::vector<Reduce> reduce199 = {};
+std::vector<Shift> shift200 = {{&term802, &state2005}};
+std::vector<Reduce> reduce200 = {};
+std::vector<Shift> shift201 = {{&term802, &state2003}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift202 = {{&term802, &state2001}};
+std::vector<Reduce> reduce202 = {};
+std::vector<Shift> shift203 = {{&term802, &state1999}};
+std::vector<Reduce> reduce203 = {};
+std::vector<Shift> shift204 = {{&term802, &state1997}};
+std::vector<Reduce> reduce204 = {};
+std::vector<Shift> shift205 = {{&term802, &state1995}};
+std::vector<Reduce> reduce205 = {};
+std::vector<Shift> shift206 = {{&term802, &state1993}};
+std::vector<Reduce> reduce206 = {};
+std::vector<Shift> shift207 = {{&term802, &state1991}};
+std::vector<Reduce> reduce207 = {};
+std::vector<Shift> shift208 = {{&term802, &state1989}};
+std::vector<Reduce> reduce208 = {};
+std::vector<Shift> shift209 = {{&term802, &state1987}};
+std::vector<Reduce> reduce209 = {};
+std::vector<Shift> shift210 = {{&term802, &state1985}};
+std::vector<Reduce> reduce210 = {};
+std::vector<Shift> shift211 = {{&term802, &state1983}};
+std::vector<Reduce> reduce211 = {};
+std::vector<Shift> shift212 = {{&term802, &state1981}};
+std::vector<Reduce> reduce212 = {};
+std::vector<Shift> shift213 = {{&term802, &state1979}};
+std::vector<Reduce> reduce213 = {};
+std::vector<Shift> shift214 = {{&term802, &state1977}};
+std::vector<Reduce> reduce214 = {};
+std::vector<Shift> shift215 = {{&term802, &state1975}};
+std::vector<Reduce> reduce215 = {};
+std::vector<Shift> shift216 = {{&term802, &state1973}};
+std::vector<Reduce> reduce216 = {};
+std::vector<Shift> shift217 = {{&term802, &state1971}};
+std::vector<Reduce> reduce217 = {};
+std::vector<Shift> shift218 = {{&term802, &state1969}};
+std::vector<Reduce> reduce218 = {};
+std::vector<Shift> shift219 = {{&term802, &state1967}};
+std::vector<Reduce> reduce219 = {};
+std::vector<Shift> shift220 = {{&term802, &state1965}};
+std::vector<Reduce> reduce220 = {};
+std::vector<Shift> shift221 = {{&term802, &state1963}};
+std::vector<Reduce> reduce221 = {};
+std::vector<Shift> shift222 = {{&term802, &state1961}};
+std::vector<Reduce> reduce222 = {};
+std::vector<Shift> shift223 = {{&term802, &state1959}};
+std::vector<Reduce> reduce223 = {};
+std::vector<Shift> shift224 = {{&term802, &state1957}};
+std::vector<Reduce> reduce224 = {};
+std::vector<Shift> shift225 = {{&term802, &state1955}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift226 = {{&term802, &state1953}};
+std::vector<Reduce> reduce226 = {};
+std::vector<Shift> shift227 = {{&term802, &state1951}};
+std::vector<Reduce> reduce227 = {};
+std::vector<Shift> shift228 = {{&term802, &state1949}};
+std::vector<Reduce> reduce228 = {};
+std::vector<Shift> shift229 = {{&term802, &state1947}};
+std::vector<Reduce> reduce229 = {};
+std::vector<Shift> shift230 = {{&term802, &state1945}};
+std::vector<Reduce> reduce230 = {};
+std::vector<Shift> shift231 = {{&term802, &state1943}};
+std::vector<Reduce> reduce231 = {};
+std::vector<Shift> shift232 = {{&term802, &state1941}};
+std::vector<Reduce> reduce232 = {};
+std::vector<Shift> shift233 = {{&term802, &state1939}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {{&term802, &state1937}};
+std::vector<Reduce> reduce234 = {};
+std::vector<Shift> shift235 = {{&term802, &state1935}};
+std::vector<Reduce> reduce235 = {};
+std::vector<Shift> shift236 = {{&term802, &state1933}};
+std::vector<Reduce> reduce236 = {};
+std::vector<Shift> shift237 = {{&term802, &state1931}};
+std::vector<Reduce> reduce237 = {};
+std::vector<Shift> shift238 = {{&term802, &state1929}};
+std::vector<Reduce> reduce238 = {};
+std::vector<Shift> shift239 = {{&term802, &state1927}};
+std::vector<Reduce> reduce239 = {};
+std::vector<Shift> shift240 = {{&term802, &state1925}};
+std::vector<Reduce> reduce240 = {};
+std::vector<Shift> shift241 = {{&term802, &state1923}};
+std::vector<Reduce> reduce241 = {};
+std::vector<Shift> shift242 = {{&term802, &state1921}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {{&term802, &state1919}};
+std::vector<Reduce> reduce243 = {};
+std::vector<Shift> shift244 = {{&term802, &state1917}};
+std::vector<Reduce> reduce244 = {};
+std::vector<Shift> shift245 = {{&term802, &state1915}};
+std::vector<Reduce> reduce245 = {};
+std::vector<Shift> shift246 = {{&term802, &state1913}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {{&term802, &state1911}};
+std::vector<Reduce> reduce247 = {};
+std::vector<Shift> shift248 = {{&term802, &state1909}};
+std::vector<Reduce> reduce248 = {};
+std::vector<Shift> shift249 = {{&term802, &state1907}};
+std::vector<Reduce> reduce249 = {};
+std::vector<Shift> shift250 = {{&term802, &state1905}};
+std::vector<Reduce> reduce250 = {};
+std::vector<Shift> shift251 = {{&term802, &state1903}};
+std::vector<Reduce> reduce251 = {};
+std::vector<Shift> shift252 = {{&term802, &state1901}};
+std::vector<Reduce> reduce252 = {};
+std::vector<Shift> shift253 = {{&term802, &state1899}};
+std::vector<Reduce> reduce253 = {};
+std::vector<Shift> shift254 = {{&term802, &state1897}};
+std::vector<Reduce> reduce254 = {};
+std::vector<Shift> shift255 = {{&term802, &state1895}};
+std::vector<Reduce> reduce255 = {};
+std::vector<Shift> shift256 = {{&term802, &state1893}};
+std::vector<Reduce> reduce256 = {};
+std::vector<Shift> shift257 = {{&term802, &state1891}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {{&term802, &state1889}};
+std::vector<Reduce> reduce258 = {};
+std::vector<Shift> shift259 = {{&term802, &state1887}};
+std::vector<Reduce> reduce259 = {};
+std::vector<Shift> shift260 = {{&term802, &state1885}};
+std::vector<Reduce> reduce260 = {};
+std::vector<Shift> shift261 = {{&term802, &state1883}};
+std::vector<Reduce> reduce261 = {};
+std::vector<Shift> shift262 = {{&term802, &state1881}};
+std::vector<Reduce> reduce262 = {};
+std::vector<Shift> shift263 = {{&term802, &state1879}};
+std::vector<Reduce> reduce263 = {};
+std::vector<Shift> shift264 = {{&term802, &state1877}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift265 = {{&term802, &state1875}};
+std::vector<Reduce> reduce265 = {};
+std::vector<Shift> shift266 = {{&term802, &state1873}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift267 = {{&term802, &state1871}};
+std::vector<Reduce> reduce267 = {};
+std::vector<Shift> shift268 = {{&term802, &state1869}};
+std::vector<Reduce> reduce268 = {};
+std::vector<Shift> shift269 = {{&term802, &state1867}};
+std::vector<Reduce> reduce269 = {};
+std::vector<Shift> shift270 = {{&term802, &state1865}};
+std::vector<Reduce> reduce270 = {};
+std::vector<Shift> shift271 = {{&term802, &state1863}};
+std::vector<Reduce> reduce271 = {};
+std::vector<Shift> shift272 = {{&term802, &state1861}};
+std::vector<Reduce> reduce272 = {};
+std::vector<Shift> shift273 = {{&term802, &state1859}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {{&term802, &state1857}};
+std::vector<Reduce> reduce274 = {};
+std::vector<Shift> shift275 = {{&term802, &state1855}};
+std::vector<Reduce> reduce275 = {};
+std::vector<Shift> shift276 = {{&term802, &state1853}};
+std::vector<Reduce> reduce276 = {};
+std::vector<Shift> shift277 = {{&term802, &state1851}};
+std::vector<Reduce> reduce277 = {};
+std::vector<Shift> shift278 = {{&term802, &state1849}};
+std::vector<Reduce> reduce278 = {};
+std::vector<Shift> shift279 = {{&term802, &state1847}};
+std::vector<Reduce> reduce279 = {};
+std::vector<Shift> shift280 = {{&term802, &state1845}};
+std::vector<Reduce> reduce280 = {};
+std::vector<Shift> shift281 = {{&term802, &state1843}};
+std::vector<Reduce> reduce281 = {};
+std::vector<Shift> shift282 = {{&term802, &state1841}};
+std::vector<Reduce> reduce282 = {};
+std::vector<Shift> shift283 = {{&term802, &state1839}};
+std::vector<Reduce> reduce283 = {};
+std::vector<Shift> shift284 = {{&term802, &state1837}};
+std::vector<Reduce> reduce284 = {};
+std::vector<Shift> shift285 = {{&term802, &state1835}};
+std::vector<Reduce> reduce285 = {};
+std::vector<Shift> shift286 = {{&term802, &state1833}};
+std::vector<Reduce> reduce286 = {};
+std::vector<Shift> shift287 = {{&term802, &state1831}};
+std::vector<Reduce> reduce287 = {};
+std::vector<Shift> shift288 = {{&term802, &state1829}};
+std::vector<Reduce> reduce288 = {};
+std::vector<Shift> shift289 = {{&term802, &state1827}};
+std::vector<Reduce> reduce289 = {};
+std::vector<Shift> shift290 = {{&term802, &state1825}};
+std::vector<Reduce> reduce290 = {};
+std::vector<Shift> shift291 = {{&term802, &state1823}};
+std::vector<Reduce> reduce291 = {};
+std::vector<Shift> shift292 = {{&term802, &state1821}};
+std::vector<Reduce> reduce292 = {};
+std::vector<Shift> shift293 = {{&term802, &state1819}};
+std::vector<Reduce> reduce293 = {};
+std::vector<Shift> shift294 = {{&term802, &state1817}};
+std::vector<Reduce> reduce294 = {};
+std::vector<Shift> shift295 = {{&term802, &state1815}};
+std::vector<Reduce> reduce295 = {};
+std::vector<Shift> shift296 = {{&term802, &state1813}};
+std::vector<Reduce> reduce296 = {};
+std::vector<Shift> shift297 = {{&term802, &state1811}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {{&term802, &state1809}};
+std::vector<Reduce> reduce298 = {};
+std::vector<Shift> shift299 = {{&term802, &state1807}};
+std::vector<Reduce> reduce299 = {};
+std::vector<Shift> shift300 = {{&term802, &state1805}};
+std::vector<Reduce> reduce300 = {};
+std::vector<Shift> shift301 = {{&term802, &state1803}};
+std::vector<Reduce> reduce301 = {};
+std::vector<Shift> shift302 = {{&term802, &state1801}};
+std::vector<Reduce> reduce302 = {};
+std::vector<Shift> shift303 = {{&term802, &state1799}};
+std::vector<Reduce> reduce303 = {};
+std::vector<Shift> shift304 = {{&term802, &state1797}};
+std::vector<Reduce> reduce304 = {};
+std::vector<Shift> shift305 = {{&term802, &state1795}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {{&term802, &state1793}};
+std::vector<Reduce> reduce306 = {};
+std::vector<Shift> shift307 = {{&term802, &state1791}};
+std::vector<Reduce> reduce307 = {};
+std::vector<Shift> shift308 = {{&term802, &state1789}};
+std::vector<Reduce> reduce308 = {};
+std::vector<Shift> shift309 = {{&term802, &state1787}};
+std::vector<Reduce> reduce309 = {};
+std::vector<Shift> shift310 = {{&term802, &state1785}};
+std::vector<Reduce> reduce310 = {};
+std::vector<Shift> shift311 = {{&term802, &state1783}};
+std::vector<Reduce> reduce311 = {};
+std::vector<Shift> shift312 = {{&term802, &state1781}};
+std::vector<Reduce> reduce312 = {};
+std::vector<Shift> shift313 = {{&term802, &state1779}};
+std::vector<Reduce> reduce313 = {};
+std::vector<Shift> shift314 = {{&term802, &state1777}};
+std::vector<Reduce> reduce314 = {};
+std::vector<Shift> shift315 = {{&term802, &state1775}};
+std::vector<Reduce> reduce315 = {};
+std::vector<Shift> shift316 = {{&term802, &state1773}};
+std::vector<Reduce> reduce316 = {};
+std::vector<Shift> shift317 = {{&term802, &state1771}};
+std::vector<Reduce> reduce317 = {};
+std::vector<Shift> shift318 = {{&term802, &state1769}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift319 = {{&term802, &state1767}};
+std::vector<Reduce> reduce319 = {};
+std::vector<Shift> shift320 = {{&term802, &state1765}};
+std::vector<Reduce> reduce320 = {};
+std::vector<Shift> shift321 = {{&term802, &state1763}};
+std::vector<Reduce> reduce321 = {};
+std::vector<Shift> shift322 = {{&term802, &state1761}};
+std::vector<Reduce> reduce322 = {};
+std::vector<Shift> shift323 = {{&term802, &state1759}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {{&term802, &state1757}};
+std::vector<Reduce> reduce324 = {};
+std::vector<Shift> shift325 = {{&term802, &state1755}};
+std::vector<Reduce> reduce325 = {};
+std::vector<Shift> shift326 = {{&term802, &state1753}};
+std::vector<Reduce> reduce326 = {};
+std::vector<Shift> shift327 = {{&term802, &state1751}};
+std::vector<Reduce> reduce327 = {};
+std::vector<Shift> shift328 = {{&term802, &state1749}};
+std::vector<Reduce> reduce328 = {};
+std::vector<Shift> shift329 = {{&term802, &state1747}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift330 = {{&term802, &state1745}};
+std::vector<Reduce> reduce330 = {};
+std::vector<Shift> shift331 = {{&term802, &state1743}};
+std::vector<Reduce> reduce331 = {};
+std::vector<Shift> shift332 = {{&term802, &state1741}};
+std::vector<Reduce> reduce332 = {};
+std::vector<Shift> shift333 = {{&term802, &state1739}};
+std::vector<Reduce> reduce333 = {};
+std::vector<Shift> shift334 = {{&term802, &state1737}};
+std::vector<Reduce> reduce334 = {};
+std::vector<Shift> shift335 = {{&term802, &state1735}};
+std::vector<Reduce> reduce335 = {};
+std::vector<Shift> shift336 = {{&term802, &state1733}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {{&term802, &state1731}};
+std::vector<Reduce> reduce337 = {};
+std::vector<Shift> shift338 = {{&term802, &state1729}};
+std::vector<Reduce> reduce338 = {};
+std::vector<Shift> shift339 = {{&term802, &state1727}};
+std::vector<Reduce> reduce339 = {};
+std::vector<Shift> shift340 = {{&term802, &state1725}};
+std::vector<Reduce> reduce340 = {};
+std::vector<Shift> shift341 = {{&term802, &state1723}};
+std::vector<Reduce> reduce341 = {};
+std::vector<Shift> shift342 = {{&term802, &state1721}};
+std::vector<Reduce> reduce342 = {};
+std::vector<Shift> shift343 = {{&term802, &state1719}};
+std::vector<Reduce> reduce343 = {};
+std::vector<Shift> shift344 = {{&term802, &state1717}};
+std::vector<Reduce> reduce344 = {};
+std::vector<Shift> shift345 = {{&term802, &state1715}};
+std::vector<Reduce> reduce345 = {};
+std::vector<Shift> shift346 = {{&term802, &state1713}};
+std::vector<Reduce> reduce346 = {};
+std::vector<Shift> shift347 = {{&term802, &state1711}};
+std::vector<Reduce> reduce347 = {};
+std::vector<Shift> shift348 = {{&term802, &state1709}};
+std::vector<Reduce> reduce348 = {};
+std::vector<Shift> shift349 = {{&term802, &state1707}};
+std::vector<Reduce> reduce349 = {};
+std::vector<Shift> shift350 = {{&term802, &state1705}};
+std::vector<Reduce> reduce350 = {};
+std::vector<Shift> shift351 = {{&term802, &state1703}};
+std::vector<Reduce> reduce351 = {};
+std::vector<Shift> shift352 = {{&term802, &state1701}};
+std::vector<Reduce> reduce352 = {};
+std::vector<Shift> shift353 = {{&term802, &state1699}};
+std::vector<Reduce> reduce353 = {};
+std::vector<Shift> shift354 = {{&term802, &state1697}};
+std::vector<Reduce> reduce354 = {};
+std::vector<Shift> shift355 = {{&term802, &state1695}};
+std::vector<Reduce> reduce355 = {};
+std::vector<Shift> shift356 = {{&term802, &state1693}};
+std::vector<Reduce> reduce356 = {};
+std::vector<Shift> shift357 = {{&term802, &state1691}};
+std::vector<Reduce> reduce357 = {};
+std::vector<Shift> shift358 = {{&term802, &state1689}};
+std::vector<Reduce> reduce358 = {};
+std::vector<Shift> shift359 = {{&term802, &state1687}};
+std::vector<Reduce> reduce359 = {};
+std::vector<Shift> shift360 = {{&term802, &state1685}};
+std::vector<Reduce> reduce360 = {};
+std::vector<Shift> shift361 = {{&term802, &state1683}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift362 = {{&term802, &state1681}};
+std::vector<Reduce> reduce362 = {};
+std::vector<Shift> shift363 = {{&term802, &state1679}};
+std::vector<Reduce> reduce363 = {};
+std::vector<Shift> shift364 = {{&term802, &state1677}};
+std::vector<Reduce> reduce364 = {};
+std::vector<Shift> shift365 = {{&term802, &state1675}};
+std::vector<Reduce> reduce365 = {};
+std::vector<Shift> shift366 = {{&term802, &state1673}};
+std::vector<Reduce> reduce366 = {};
+std::vector<Shift> shift367 = {{&term802, &state1671}};
+std::vector<Reduce> reduce367 = {};
+std::vector<Shift> shift368 = {{&term802, &state1669}};
+std::vector<Reduce> reduce368 = {};
+std::vector<Shift> shift369 = {{&term802, &state1667}};
+std::vector<Reduce> reduce369 = {};
+std::vector<Shift> shift370 = {{&term802, &state1665}};
+std::vector<Reduce> reduce370 = {};
+std::vector<Shift> shift371 = {{&term802, &state1663}};
+std::vector<Reduce> reduce371 = {};
+std::vector<Shift> shift372 = {{&term802, &state1661}};
+std::vector<Reduce> reduce372 = {};
+std::vector<Shift> shift373 = {{&term802, &state1659}};
+std::vector<Reduce> reduce373 = {};
+std::vector<Shift> shift374 = {{&term802, &state1657}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift375 = {{&term802, &state1655}};
+std::vector<Reduce> reduce375 = {};
+std::vector<Shift> shift376 = {{&term802, &state1653}};
+std::vector<Reduce> reduce376 = {};
+std::vector<Shift> shift377 = {{&term802, &state1651}};
+std::vector<Reduce> reduce377 = {};
+std::vector<Shift> shift378 = {{&term802, &state1649}};
+std::vector<Reduce> reduce378 = {};
+std::vector<Shift> shift379 = {{&term802, &state1647}};
+std::vector<Reduce> reduce379 = {};
+std::vector<Shift> shift380 = {{&term802, &state1645}};
+std::vector<Reduce> reduce380 = {};
+std::vector<Shift> shift381 = {{&term802, &state1643}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift382 = {{&term802, &state1641}};
+std::vector<Reduce> reduce382 = {};
+std::vector<Shift> shift383 = {{&term802, &state1639}};
+std::vector<Reduce> reduce383 = {};
+std::vector<Shift> shift384 = {{&term802, &state1637}};
+std::vector<Reduce> reduce384 = {};
+std::vector<Shift> shift385 = {{&term802, &state1635}};
+std::vector<Reduce> reduce385 = {};
+std::vector<Shift> shift386 = {{&term802, &state1633}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift387 = {{&term802, &state1631}};
+std::vector<Reduce> reduce387 = {};
+std::vector<Shift> shift388 = {{&term802, &state1629}};
+std::vector<Reduce> reduce388 = {};
+std::vector<Shift> shift389 = {{&term802, &state1627}};
+std::vector<Reduce> reduce389 = {};
+std::vector<Shift> shift390 = {{&term802, &state1625}};
+std::vector<Reduce> reduce390 = {};
+std::vector<Shift> shift391 = {{&term802, &state1623}};
+std::vector<Reduce> reduce391 = {};
+std::vector<Shift> shift392 = {{&term802, &state1621}};
+std::vector<Reduce> reduce392 = {};
+std::vector<Shift> shift393 = {{&term802, &state1619}};
+std::vector<Reduce> reduce393 = {};
+std::vector<Shift> shift394 = {{&term802, &state1617}};
+std::vector<Reduce> reduce394 = {};
+std::vector<Shift> shift395 = {{&term802, &state1615}};
+std::vector<Reduce> reduce395 = {};
+std::vector<Shift> shift396 = {{&term802, &state1613}};
+std::vector<Reduce> reduce396 = {};
+std::vector<Shift> shift397 = {{&term802, &state1611}};
+std::vector<Reduce> reduce397 = {};
+std::vector<Shift> shift398 = {{&term802, &state1609}};
+std::vector<Reduce> reduce398 = {};
+std::vector<Shift> shift399 = {{&term802, &state1607}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift400 = {{&term802, &state1605}};
+std::vector<Reduce> reduce400 = {};
+std::vector<Shift> shift401 = {{&term802, &state1603}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {{&term802, &state1601}};
+std::vector<Reduce> reduce402 = {};
+std::vector<Shift> shift403 = {{&term802, &state1599}};
+std::vector<Reduce> reduce403 = {};
+std::vector<Shift> shift404 = {{&term802, &state1597}};
+std::vector<Reduce> reduce404 = {};
+std::vector<Shift> shift405 = {{&term802, &state1595}};
+std::vector<Reduce> reduce405 = {};
+std::vector<Shift> shift406 = {{&term802, &state1593}};
+std::vector<Reduce> reduce406 = {};
+std::vector<Shift> shift407 = {{&term802, &state1591}};
+std::vector<Reduce> reduce407 = {};
+std::vector<Shift> shift408 = {{&term802, &state1589}};
+std::vector<Reduce> reduce408 = {};
+std::vector<Shift> shift409 = {{&term802, &state1587}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift410 = {{&term802, &state1585}};
+std::vector<Reduce> reduce410 = {};
+std::vector<Shift> shift411 = {{&term802, &state1583}};
+std::vector<Reduce> reduce411 = {};
+std::vector<Shift> shift412 = {{&term802, &state1581}};
+std::vector<Reduce> reduce412 = {};
+std::vector<Shift> shift413 = {{&term802, &state1579}};
+std::vector<Reduce> reduce413 = {};
+std::vector<Shift> shift414 = {{&term802, &state1577}};
+std::vector<Reduce> reduce414 = {};
+std::vector<Shift> shift415 = {{&term802, &state1575}};
+std::vector<Reduce> reduce415 = {};
+std::vector<Shift> shift416 = {{&term802, &state1573}};
+std::vector<Reduce> reduce416 = {};
+std::vector<Shift> shift417 = {{&term802, &state1571}};
+std::vector<Reduce> reduce417 = {};
+std::vector<Shift> shift418 = {{&term802, &state1569}};
+std::vector<Reduce> reduce418 = {};
+std::vector<Shift> shift419 = {{&term802, &state1567}};
+std::vector<Reduce> reduce419 = {};
+std::vector<Shift> shift420 = {{&term802, &state1565}};
+std::vector<Reduce> reduce420 = {};
+std::vector<Shift> shift421 = {{&term802, &state1563}};
+std::vector<Reduce> reduce421 = {};
+std::vector<Shift> shift422 = {{&term802, &state1561}};
+std::vector<Reduce> reduce422 = {};
+std::vector<Shift> shift423 = {{&term802, &state1559}};
+std::vector<Reduce> reduce423 = {};
+std::vector<Shift> shift424 = {{&term802, &state1557}};
+std::vector<Reduce> reduce424 = {};
+std::vector<Shift> shift425 = {{&term802, &state1555}};
+std::vector<Reduce> reduce425 = {};
+std::vector<Shift> shift426 = {{&term802, &state1553}};
+std::vector<Reduce> reduce426 = {};
+std::vector<Shift> shift427 = {{&term802, &state1551}};
+std::vector<Reduce> reduce427 = {};
+std::vector<Shift> shift428 = {{&term802, &state1549}};
+std::vector<Reduce> reduce428 = {};
+std::vector<Shift> shift429 = {{&term802, &state1547}};
+std::vector<Reduce> reduce429 = {};
+std::vector<Shift> shift430 = {{&term802, &state1545}};
+std::vector<Reduce> reduce430 = {};
+std::vector<Shift> shift431 = {{&term802, &state1543}};
+std::vector<Reduce> reduce431 = {};
+std::vector<Shift> shift432 = {{&term802, &state1541}};
+std::vector<Reduce> reduce432 = {};
+std::vector<Shift> shift433 = {{&term802, &state1539}};
+std::vector<Reduce> reduce433 = {};
+std::vector<Shift> shift434 = {{&term802, &state1537}};
+std::vector<Reduce> reduce434 = {};
+std::vector<Shift> shift435 = {{&term802, &state1535}};
+std::vector<Reduce> reduce435 = {};
+std::vector<Shift> shift436 = {{&term802, &state1533}};
+std::vector<Reduce> reduce436 = {};
+std::vector<Shift> shift437 = {{&term802, &state1531}};
+std::vector<Reduce> reduce437 = {};
+std::vector<Shift> shift438 = {{&term802, &state1529}};
+std::vector<Reduce> reduce438 = {};
+std::vector<Shift> shift439 = {{&term802, &state1527}};
+std::vector<Reduce> reduce439 = {};
+std::vector<Shift> shift440 = {{&term802, &state1525}};
+std::vector<Reduce> reduce440 = {};
+std::vector<Shift> shift441 = {{&term802, &state1523}};
+std::vector<Reduce> reduce441 = {};
+std::vector<Shift> shift442 = {{&term802, &state1521}};
+std::vector<Reduce> reduce442 = {};
+std::vector<Shift> shift443 = {{&term802, &state1519}};
+std::vector<Reduce> reduce443 = {};
+std::vector<Shift> shift444 = {{&term802, &state1517}};
+std::vector<Reduce> reduce444 = {};
+std::vector<Shift> shift445 = {{&term802, &state1515}};
+std::vector<Reduce> reduce445 = {};
+std::vector<Shift> shift446 = {{&term802, &state1513}};
+std::vector<Reduce> reduce446 = {};
+std::vector<Shift> shift447 = {{&term802, &state1511}};
+std::vector<Reduce> reduce447 = {};
+std::vector<Shift> shift448 = {{&term802, &state1509}};
+std::vector<Reduce> reduce448 = {};
+std::vector<Shift> shift449 = {{&term802, &state1507}};
+std::vector<Reduce> reduce449 = {};
+std::vector<Shift> shift450 = {{&term802, &state1505}};
+std::vector<Reduce> reduce450 = {};
+std::vector<Shift> shift451 = {{&term802, &state1503}};
+std::vector<Reduce> reduce451 = {};
+std::vector<Shift> shift452 = {{&term802, &state1501}};
+std::vector<Reduce> reduce452 = {};
+std::vector<Shift> shift453 = {{&term802, &state1499}};
+std::vector<Reduce> reduce453 = {};
+std::vector<Shift> shift454 = {{&term802, &state1497}};
+std::vector<Reduce> reduce454 = {};
+std::vector<Shift> shift455 = {{&term802, &state1495}};
+std::vector<Reduce> reduce455 = {};
+std::vector<Shift> shift456 = {{&term802, &state1493}};
+std::vector<Reduce> reduce456 = {};
+std::vector<Shift> shift457 = {{&term802, &state1491}};
+std::vector<Reduce> reduce457 = {};
+std::vector<Shift> shift458 = {{&term802, &state1489}};
+std::vector<Reduce> reduce458 = {};
+std::vector<Shift> shift459 = {{&term802, &state1487}};
+std::vector<Reduce> reduce459 = {};
+std::vector<Shift> shift460 = {{&term802, &state1485}};
+std::vector<Reduce> reduce460 = {};
+std::vector<Shift> shift461 = {{&term802, &state1483}};
+std::vector<Reduce> reduce461 = {};
+std::vector<Shift> shift462 = {{&term802, &state1481}};
+std::vector<Reduce> reduce462 = {};
+std::vector<Shift> shift463 = {{&term802, &state1479}};
+std::vector<Reduce> reduce463 = {};
+std::vector<Shift> shift464 = {{&term802, &state1477}};
+std::vector<Reduce> reduce464 = {};
+std::vector<Shift> shift465 = {{&term802, &state1475}};
+std::vector<Reduce> reduce465 = {};
+std::vector<Shift> shift466 = {{&term802, &state1473}};
+std::vector<Reduce> reduce466 = {};
+std::vector<Shift> shift467 = {{&term802, &state1471}};
+std::vector<Reduce> reduce467 = {};
+std::vector<Shift> shift468 = {{&term802, &state1469}};
+std::vector<Reduce> reduce468 = {};
+std::vector<Shift> shift469 = {{&term802, &state1467}};
+std::vector<Reduce> reduce469 = {};
+std::vector<Shift> shift470 = {{&term802, &state1465}};
+std::vector<Reduce> reduce470 = {};
+std::vector<Shift> shift471 = {{&term802, &state1463}};
+std::vector<Reduce> reduce471 = {};
+std::vector<Shift> shift472 = {{&term802, &state1461}};
+std::vector<Reduce> reduce472 = {};
+std::vector<Shift> shift473 = {{&term802, &state1459}};
+std::vector<Reduce> reduce473 = {};
+std::vector<Shift> shift474 = {{&term802, &state1457}};
+std::vector<Reduce> reduce474 = {};
+std::vector<Shift> shift475 = {{&term802, &state1455}};
+std::vector<Reduce> reduce475 = {};
+std::vector<Shift> shift476 = {{&term802, &state1453}};
+std::vector<Reduce> reduce476 = {};
+std::vector<Shift> shift477 = {{&term802, &state1451}};
+std::vector<Reduce> reduce477 = {};
+std::vector<Shift> shift478 = {{&term802, &state1449}};
+std::vector<Reduce> reduce478 = {};
+std::vector<Shift> shift479 = {{&term802, &state1447}};
+std::vector<Reduce> reduce479 = {};
+std::vector<Shift> shift480 = {{&term802, &state1445}};
+std::vector<Reduce> reduce480 = {};
+std::vector<Shift> shift481 = {{&term802, &state1443}};
+std::vector<Reduce> reduce481 = {};
+std::vector<Shift> shift482 = {{&term802, &state1441}};
+std::vector<Reduce> reduce482 = {};
+std::vector<Shift> shift483 = {{&term802, &state1439}};
+std::vector<Reduce> reduce483 = {};
+std::vector<Shift> shift484 = {{&term802, &state1437}};
+std::vector<Reduce> reduce484 = {};
+std::vector<Shift> shift485 = {{&term802, &state1435}};
+std::vector<Reduce> reduce485 = {};
+std::vector<Shift> shift486 = {{&term802, &state1433}};
+std::vector<Reduce> reduce486 = {};
+std::vector<Shift> shift487 = {{&term802, &state1431}};
+std::vector<Reduce> reduce487 = {};
+std::vector<Shift> shift488 = {{&term802, &state1429}};
+std::vector<Reduce> reduce488 = {};
+std::vector<Shift> shift489 = {{&term802, &state1427}};
+std::vector<Reduce> reduce489 = {};
+std::vector<Shift> shift490 = {{&term802, &state1425}};
+std::vector<Reduce> reduce490 = {};
+std::vector<Shift> shift491 = {{&term802, &state1423}};
+std::vector<Reduce> reduce491 = {};
+std::vector<Shift> shift492 = {{&term802, &state1421}};
+std::vector<Reduce> reduce492 = {};
+std::vector<Shift> shift493 = {{&term802, &state1419}};
+std::vector<Reduce> reduce493 = {};
+std::vector<Shift> shift494 = {{&term802, &state1417}};
+std::vector<Reduce> reduce494 = {};
+std::vector<Shift> shift495 = {{&term802, &state1415}};
+std::vector<Reduce> reduce495 = {};
+std::vector<Shift> shift496 = {{&term802, &state1413}};
+std::vector<Reduce> reduce496 = {};
+std::vector<Shift> shift497 = {{&term802, &state1411}};
+std::vector<Reduce> reduce497 = {};
+std::vector<Shift> shift498 = {{&term802, &state1409}};
+std::vector<Reduce> reduce498 = {};
+std::vector<Shift> shift499 = {{&term802, &state1407}};
+std::vector<Reduce> reduce499 = {};
+std::vector<Shift> shift500 = {{&term802, &state1405}};
+std::vector<Reduce> reduce500 = {};
+std::vector<Shift> shift501 = {{&term802, &state1403}};
+std::vector<Reduce> reduce501 = {};
+std::vector<Shift> shift502 = {{&term802, &state1401}};
+std::vector<Reduce> reduce502 = {};
+std::vector<Shift> shift503 = {{&term802, &state1399}};
+std::vector<Reduce> reduce503 = {};
+std::vector<Shift> shift504 = {{&term802, &state1397}};
+std::vector<Reduce> reduce504 = {};
+std::vector<Shift> shift505 = {{&term802, &state1395}};
+std::vector<Reduce> reduce505 = {};
+std::vector<Shift> shift506 = {{&term802, &state1393}};
+std::vector<Reduce> reduce506 = {};
+std::vector<Shift> shift507 = {{&term802, &state1391}};
+std::vector<Reduce> reduce507 = {};
+std::vector<Shift> shift508 = {{&term802, &state1389}};
+std::vector<Reduce> reduce508 = {};
+std::vector<Shift> shift509 = {{&term802, &state1387}};
+std::vector<Reduce> reduce509 = {};
+std::vector<Shift> shift510 = {{&term802, &state1385}};
+std::vector<Reduce> reduce510 = {};
+std::vector<Shift> shift511 = {{&term802, &state1383}};
+std::vector<Reduce> reduce511 = {};
+std::vector<Shift> shift512 = {{&term802, &state1381}};
+std::vector<Reduce> reduce512 = {};
+std::vector<Shift> shift513 = {{&term802, &state1379}};
+std::vector<Reduce> reduce513 = {};
+std::vector<Shift> shift514 = {{&term802, &state1377}};
+std::vector<Reduce> reduce514 = {};
+std::vector<Shift> shift515 = {{&term802, &state1375}};
+std::vector<Reduce> reduce515 = {};
+std::vector<Shift> shift516 = {{&term802, &state1373}};
+std::vector<Reduce> reduce516 = {};
+std::vector<Shift> shift517 = {{&term802, &state1371}};
+std::vector<Reduce> reduce517 = {};
+std::vector<Shift> shift518 = {{&term802, &state1369}};
+std::vector<Reduce> reduce518 = {};
+std::vector<Shift> shift519 = {{&term802, &state1367}};
+std::vector<Reduce> reduce519 = {};
+std::vector<Shift> shift520 = {{&term802, &state1365}};
+std::vector<Reduce> reduce520 = {};
+std::vector<Shift> shift521 = {{&term802, &state1363}};
+std::vector<Reduce> reduce521 = {};
+std::vector<Shift> shift522 = {{&term802, &state1361}};
+std::vector<Reduce> reduce522 = {};
+std::vector<Shift> shift523 = {{&term802, &state1359}};
+std::vector<Reduce> reduce523 = {};
+std::vector<Shift> shift524 = {{&term802, &state1357}};
+std::vector<Reduce> reduce524 = {};
+std::vector<Shift> shift525 = {{&term802, &state1355}};
+std::vector<Reduce> reduce525 = {};
+std::vector<Shift> shift526 = {{&term802, &state1353}};
+std::vector<Reduce> reduce526 = {};
+std::vector<Shift> shift527 = {{&term802, &state1351}};
+std::vector<Reduce> reduce527 = {};
+std::vector<Shift> shift528 = {{&term802, &state1349}};
+std::vector<Reduce> reduce528 = {};
+std::vector<Shift> shift529 = {{&term802, &state1347}};
+std::vector<Reduce> reduce529 = {};
+std::vector<Shift> shift530 = {{&term802, &state1345}};
+std::vector<Reduce> reduce530 = {};
+std::vector<Shift> shift531 = {{&term802, &state1343}};
+std::vector<Reduce> reduce531 = {};
+std::vector<Shift> shift532 = {{&term802, &state1341}};
+std::vector<Reduce> reduce532 = {};
+std::vector<Shift> shift533 = {{&term802, &state1339}};
+std::vector<Reduce> reduce533 = {};
+std::vector<Shift> shift534 = {{&term802, &state1337}};
+std::vector<Reduce> reduce534 = {};
+std::vector<Shift> shift535 = {{&term802, &state1335}};
+std::vector<Reduce> reduce535 = {};
+std::vector<Shift> shift536 = {{&term802, &state1333}};
+std::vector<Reduce> reduce536 = {};
+std::vector<Shift> shift537 = {{&term802, &state1331}};
+std::vector<Reduce> reduce537 = {};
+std::vector<Shift> shift538 = {{&term802, &state1329}};
+std::vector<Reduce> reduce538 = {};
+std::vector<Shift> shift539 = {{&term802, &state1327}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {{&term802, &state1325}};
+std::vector<Reduce> reduce540 = {};
+std::vector<Shift> shift541 = {{&term802, &state1323}};
+std::vector<Reduce> reduce541 = {};
+std::vector<Shift> shift542 = {{&term802, &state1321}};
+std::vector<Reduce> reduce542 = {};
+std::vector<Shift> shift543 = {{&term802, &state1319}};
+std::vector<Reduce> reduce543 = {};
+std::vector<Shift> shift544 = {{&term802, &state1317}};
+std::vector<Reduce> reduce544 = {};
+std::vector<Shift> shift545 = {{&term802, &state1315}};
+std::vector<Reduce> reduce545 = {};
+std::vector<Shift> shift546 = {{&term802, &state1313}};
+std::vector<Reduce> reduce546 = {};
+std::vector<Shift> shift547 = {{&term802, &state1311}};
+std::vector<Reduce> reduce547 = {};
+std::vector<Shift> shift548 = {{&term802, &state1309}};
+std::vector<Reduce> reduce548 = {};
+std::vector<Shift> shift549 = {{&term802, &state1307}};
+std::vector<Reduce> reduce549 = {};
+std::vector<Shift> shift550 = {{&term802, &state1305}};
+std::vector<Reduce> reduce550 = {};
+std::vector<Shift> shift551 = {{&term802, &state1303}};
+std::vector<Reduce> reduce551 = {};
+std::vector<Shift> shift552 = {{&term802, &state1301}};
+std::vector<Reduce> reduce552 = {};
+std::vector<Shift> shift553 = {{&term802, &state1299}};
+std::vector<Reduce> reduce553 = {};
+std::vector<Shift> shift554 = {{&term802, &state1297}};
+std::vector<Reduce> reduce554 = {};
+std::vector<Shift> shift555 = {{&term802, &state1295}};
+std::vector<Reduce> reduce555 = {};
+std::vector<Shift> shift556 = {{&term802, &state1293}};
+std::vector<Reduce> reduce556 = {};
+std::vector<Shift> shift557 = {{&term802, &state1291}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift558 = {{&term802, &state1289}};
+std::vector<Reduce> reduce558 = {};
+std::vector<Shift> shift559 = {{&term802, &state1287}};
+std::vector<Reduce> reduce559 = {};
+std::vector<Shift> shift560 = {{&term802, &state1285}};
+std::vector<Reduce> reduce560 = {};
+std::vector<Shift> shift561 = {{&term802, &state1283}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift562 = {{&term802, &state1281}};
+std::vector<Reduce> reduce562 = {};
+std::vector<Shift> shift563 = {{&term802, &state1279}};
+std::vector<Reduce> reduce563 = {};
+std::vector<Shift> shift564 = {{&term802, &state1277}};
+std::vector<Reduce> reduce564 = {};
+std::vector<Shift> shift565 = {{&term802, &state1275}};
+std::vector<Reduce> reduce565 = {};
+std::vector<Shift> shift566 = {{&term802, &state1273}};
+std::vector<Reduce> reduce566 = {};
+std::vector<Shift> shift567 = {{&term802, &state1271}};
+std::vector<Reduce> reduce567 = {};
+std::vector<Shift> shift568 = {{&term802, &state1269}};
+std::vector<Reduce> reduce568 = {};
+std::vector<Shift> shift569 = {{&term802, &state1267}};
+std::vector<Reduce> reduce569 = {};
+std::vector<Shift> shift570 = {{&term802, &state1265}};
+std::vector<Reduce> reduce570 = {};
+std::vector<Shift> shift571 = {{&term802, &state1263}};
+std::vector<Reduce> reduce571 = {};
+std::vector<Shift> shift572 = {{&term802, &state1261}};
+std::vector<Reduce> reduce572 = {};
+std::vector<Shift> shift573 = {{&term802, &state1259}};
+std::vector<Reduce> reduce573 = {};
+std::vector<Shift> shift574 = {{&term802, &state1257}};
+std::vector<Reduce> reduce574 = {};
+std::vector<Shift> shift575 = {{&term802, &state1255}};
+std::vector<Reduce> reduce575 = {};
+std::vector<Shift> shift576 = {{&term802, &state1253}};
+std::vector<Reduce> reduce576 = {};
+std::vector<Shift> shift577 = {{&term802, &state1251}};
+std::vector<Reduce> reduce577 = {};
+std::vector<Shift> shift578 = {{&term802, &state1249}};
+std::vector<Reduce> reduce578 = {};
+std::vector<Shift> shift579 = {{&term802, &state1247}};
+std::vector<Reduce> reduce579 = {};
+std::vector<Shift> shift580 = {{&term802, &state1245}};
+std::vector<Reduce> reduce580 = {};
+std::vector<Shift> shift581 = {{&term802, &state1243}};
+std::vector<Reduce> reduce581 = {};
+std::vector<Shift> shift582 = {{&term802, &state1241}};
+std::vector<Reduce> reduce582 = {};
+std::vector<Shift> shift583 = {{&term802, &state1239}};
+std::vector<Reduce> reduce583 = {};
+std::vector<Shift> shift584 = {{&term802, &state1237}};
+std::vector<Reduce> reduce584 = {};
+std::vector<Shift> shift585 = {{&term802, &state1235}};
+std::vector<Reduce> reduce585 = {};
+std::vector<Shift> shift586 = {{&term802, &state1233}};
+std::vector<Reduce> reduce586 = {};
+std::vector<Shift> shift587 = {{&term802, &state1231}};
+std::vector<Reduce> reduce587 = {};
+std::vector<Shift> shift588 = {{&term802, &state1229}};
+std::vector<Reduce> reduce588 = {};
+std::vector<Shift> shift589 = {{&term802, &state1227}};
+std::vector<Reduce> reduce589 = {};
+std::vector<Shift> shift590 = {{&term802, &state1225}};
+std::vector<Reduce> reduce590 = {};
+std::vector<Shift> shift591 = {{&term802, &state1223}};
+std::vector<Reduce> reduce591 = {};
+std::vector<Shift> shift592 = {{&term802, &state1221}};
+std::vector<Reduce> reduce592 = {};
+std::vector<Shift> shift593 = {{&term802, &state1219}};
+std::vector<Reduce> reduce593 = {};
+std::vector<Shift> shift594 = {{&term802, &state1217}};
+std::vector<Reduce> reduce594 = {};
+std::vector<Shift> shift595 = {{&term802, &state1215}};
+std::vector<Reduce> reduce595 = {};
+std::vector<Shift> shift596 = {{&term802, &state1213}};
+std::vector<Reduce> reduce596 = {};
+std::vector<Shift> shift597 = {{&term802, &state1211}};
+std::vector<Reduce> reduce597 = {};
+std::vector<Shift> shift598 = {{&term802, &state1209}};
+std::vector<Reduce> reduce598 = {};
+std::vector<Shift> shift599 = {{&term802, &state1207}};
+std::vector<Reduce> reduce599 = {};
+std::vector<Shift> shift600 = {{&term802, &state1205}};
+std::vector<Reduce> reduce600 = {};
+std::vector<Shift> shift601 = {{&term802, &state1203}};
+std::vector<Reduce> reduce601 = {};
+std::vector<Shift> shift602 = {{&term802, &state1201}};
+std::vector<Reduce> reduce602 = {};
+std::vector<Shift> shift603 = {{&term802, &state1199}};
+std::vector<Reduce> reduce603 = {};
+std::vector<Shift> shift604 = {{&term802, &state1197}};
+std::vector<Reduce> reduce604 = {};
+std::vector<Shift> shift605 = {{&term802, &state1195}};
+std::vector<Reduce> reduce605 = {};
+std::vector<Shift> shift606 = {{&term802, &state1193}};
+std::vector<Reduce> reduce606 = {};
+std::vector<Shift> shift607 = {{&term802, &state1191}};
+std::vector<Reduce> reduce607 = {};
+std::vector<Shift> shift608 = {{&term802, &state1189}};
+std::vector<Reduce> reduce608 = {};
+std::vector<Shift> shift609 = {{&term802, &state1187}};
+std::vector<Reduce> reduce609 = {};
+std::vector<Shift> shift610 = {{&term802, &state1185}};
+std::vector<Reduce> reduce610 = {};
+std::vector<Shift> shift611 = {{&term802, &state1183}};
+std::vector<Reduce> reduce611 = {};
+std::vector<Shift> shift612 = {{&term802, &state1181}};
+std::vector<Reduce> reduce612 = {};
+std::vector<Shift> shift613 = {{&term802, &state1179}};
+std::vector<Reduce> reduce613 = {};
+std::vector<Shift> shift614 = {{&term802, &state1177}};
+std::vector<Reduce> reduce614 = {};
+std::vector<Shift> shift615 = {{&term802, &state1175}};
+std::vector<Reduce> reduce615 = {};
+std::vector<Shift> shift616 = {{&term802, &state1173}};
+std::vector<Reduce> reduce616 = {};
+std::vector<Shift> shift617 = {{&term802, &state1171}};
+std::vector<Reduce> reduce617 = {};
+std::vector<Shift> shift618 = {{&term802, &state1169}};
+std::vector<Reduce> reduce618 = {};
+std::vector<Shift> shift619 = {{&term802, &state1167}};
+std::vector<Reduce> reduce619 = {};
+std::vector<Shift> shift620 = {{&term802, &state1165}};
+std::vector<Reduce> reduce620 = {};
+std::vector<Shift> shift621 = {{&term802, &state1163}};
+std::vector<Reduce> reduce621 = {};
+std::vector<Shift> shift622 = {{&term802, &state1161}};
+std::vector<Reduce> reduce622 = {};
+std::vector<Shift> shift623 = {{&term802, &state1159}};
+std::vector<Reduce> reduce623 = {};
+std::vector<Shift> shift624 = {{&term802, &state1157}};
+std::vector<Reduce> reduce624 = {};
+std::vector<Shift> shift625 = {{&term802, &state1155}};
+std::vector<Reduce> reduce625 = {};
+std::vector<Shift> shift626 = {{&term802, &state1153}};
+std::vector<Reduce> reduce626 = {};
+std::vector<Shift> shift627 = {{&term802, &state1151}};
+std::vector<Reduce> reduce627 = {};
+std::vector<Shift> shift628 = {{&term802, &state1149}};
+std::vector<Reduce> reduce628 = {};
+std::vector<Shift> shift629 = {{&term802, &state1147}};
+std::vector<Reduce> reduce629 = {};
+std::vector<Shift> shift630 = {{&term802, &state1145}};
+std::vector<Reduce> reduce630 = {};
+std::vector<Shift> shift631 = {{&term802, &state1143}};
+std::vector<Reduce> reduce631 = {};
+std::vector<Shift> shift632 = {{&term802, &state1141}};
+std::vector<Reduce> reduce632 = {};
+std::vector<Shift> shift633 = {{&term802, &state1139}};
+std::vector<Reduce> reduce633 = {};
+std::vector<Shift> shift634 = {{&term802, &state1137}};
+std::vector<Reduce> reduce634 = {};
+std::vector<Shift> shift635 = {{&term802, &state1135}};
+std::vector<Reduce> reduce635 = {};
+std::vector<Shift> shift636 = {{&term802, &state1133}};
+std::vector<Reduce> reduce636 = {};
+std::vector<Shift> shift637 = {{&term802, &state1131}};
+std::vector<Reduce> reduce637 = {};
+std::vector<Shift> shift638 = {{&term802, &state1129}};
+std::vector<Reduce> reduce638 = {};
+std::vector<Shift> shift639 = {{&term802, &state1127}};
+std::vector<Reduce> reduce639 = {};
+std::vector<Shift> shift640 = {{&term802, &state1125}};
+std::vector<Reduce> reduce640 = {};
+std::vector<Shift> shift641 = {{&term802, &state1123}};
+std::vector<Reduce> reduce641 = {};
+std::vector<Shift> shift642 = {{&term802, &state1121}};
+std::vector<Reduce> reduce642 = {};
+std::vector<Shift> shift643 = {{&term802, &state1119}};
+std::vector<Reduce> reduce643 = {};
+std::vector<Shift> shift644 = {{&term802, &state1117}};
+std::vector<Reduce> reduce644 = {};
+std::vector<Shift> shift645 = {{&term802, &state1115}};
+std::vector<Reduce> reduce645 = {};
+std::vector<Shift> shift646 = {{&term802, &state1113}};
+std::vector<Reduce> reduce646 = {};
+std::vector<Shift> shift647 = {{&term802, &state1111}};
+std::vector<Reduce> reduce647 = {};
+std::vector<Shift> shift648 = {{&term802, &state1109}};
+std::vector<Reduce> reduce648 = {};
+std::vector<Shift> shift649 = {{&term802, &state1107}};
+std::vector<Reduce> reduce649 = {};
+std::vector<Shift> shift650 = {{&term802, &state1105}};
+std::vector<Reduce> reduce650 = {};
+std::vector<Shift> shift651 = {{&term802, &state1103}};
+std::vector<Reduce> reduce651 = {};
+std::vector<Shift> shift652 = {{&term802, &state1101}};
+std::vector<Reduce> reduce652 = {};
+std::vector<Shift> shift653 = {{&term802, &state1099}};
+std::vector<Reduce> reduce653 = {};
+std::vector<Shift> shift654 = {{&term802, &state1097}};
+std::vector<Reduce> reduce654 = {};
+std::vector<Shift> shift655 = {{&term802, &state1095}};
+std::vector<Reduce> reduce655 = {};
+std::vector<Shift> shift656 = {{&term802, &state1093}};
+std::vector<Reduce> reduce656 = {};
+std::vector<Shift> shift657 = {{&term802, &state1091}};
+std::vector<Reduce> reduce657 = {};
+std::vector<Shift> shift658 = {{&term802, &state1089}};
+std::vector<Reduce> reduce658 = {};
+std::vector<Shift> shift659 = {{&term802, &state1087}};
+std::vector<Reduce> reduce659 = {};
+std::vector<Shift> shift660 = {{&term802, &state1085}};
+std::vector<Reduce> reduce660 = {};
+std::vector<Shift> shift661 = {{&term802, &state1083}};
+std::vector<Reduce> reduce661 = {};
+std::vector<Shift> shift662 = {{&term802, &state1081}};
+std::vector<Reduce> reduce662 = {};
+std::vector<Shift> shift663 = {{&term802, &state1079}};
+std::vector<Reduce> reduce663 = {};
+std::vector<Shift> shift664 = {{&term802, &state1077}};
+std::vector<Reduce> reduce664 = {};
+std::vector<Shift> shift665 = {{&term802, &state1075}};
+std::vector<Reduce> reduce665 = {};
+std::vector<Shift> shift666 = {{&term802, &state1073}};
+std::vector<Reduce> reduce666 = {};
+std::vector<Shift> shift667 = {{&term802, &state1071}};
+std::vector<Reduce> reduce667 = {};
+std::vector<Shift> shift668 = {{&term802, &state1069}};
+std::vector<Reduce> reduce668 = {};
+std::vector<Shift> shift669 = {{&term802, &state1067}};
+std::vector<Reduce> reduce669 = {};
+std::vector<Shift> shift670 = {{&term802, &state1065}};
+std::vector<Reduce> reduce670 = {};
+std::vector<Shift> shift671 = {{&term802, &state1063}};
+std::vector<Reduce> reduce671 = {};
+std::vector<Shift> shift672 = {{&term802, &state1061}};
+std::vector<Reduce> reduce672 = {};
+std::vector<Shift> shift673 = {{&term802, &state1059}};
+std::vector<Reduce> reduce673 = {};
+std::vector<Shift> shift674 = {{&term802, &state1057}};
+std::vector<Reduce> reduce674 = {};
+std::vector<Shift> shift675 = {{&term802, &state1055}};
+std::vector<Reduce> reduce675 = {};
+std::vector<Shift> shift676 = {{&term802, &state1053}};
+std::vector<Reduce> reduce676 = {};
+std::vector<Shift> shift677 = {{&term802, &state1051}};
+std::vector<Reduce> reduce677 = {};
+std::vector<Shift> shift678 = {{&term802, &state1049}};
+std::vector<Reduce> reduce678 = {};
+std::vector<Shift> shift679 = {{&term802, &state1047}};
+std::vector<Reduce> reduce679 = {};
+std::vector<Shift> shift680 = {{&term802, &state1045}};
+std::vector<Reduce> reduce680 = {};
+std::vector<Shift> shift681 = {{&term802, &state1043}};
+std::vector<Reduce> reduce681 = {};
+std::vector<Shift> shift682 = {{&term802, &state1041}};
+std::vector<Reduce> reduce682 = {};
+std::vector<Shift> shift683 = {{&term802, &state1039}};
+std::vector<Reduce> reduce683 = {};
+std::vector<Shift> shift684 = {{&term802, &state1037}};
+std::vector<Reduce> reduce684 = {};
+std::vector<Shift> shift685 = {{&term802, &state1035}};
+std::vector<Reduce> reduce685 = {};
+std::vector<Shift> shift686 = {{&term802, &state1033}};
+std::vector<Reduce> reduce686 = {};
+std::vector<Shift> shift687 = {{&term802, &state1031}};
+std::vector<Reduce> reduce687 = {};
+std::vector<Shift> shift688 = {{&term802, &state1029}};
+std::vector<Reduce> reduce688 = {};
+std::vector<Shift> shift689 = {{&term802, &state1027}};
+std::vector<Reduce> reduce689 = {};
+std::vector<Shift> shift690 = {{&term802, &state1025}};
+std::vector<Reduce> reduce690 = {};
+std::vector<Shift> shift691 = {{&term802, &state1023}};
+std::vector<Reduce> reduce691 = {};
+std::vector<Shift> shift692 = {{&term802, &state1021}};
+std::vector<Reduce> reduce692 = {};
+std::vector<Shift> shift693 = {{&term802, &state1019}};
+std::vector<Reduce> reduce693 = {};
+std::vector<Shift> shift694 = {{&term802, &state1017}};
+std::vector<Reduce> reduce694 = {};
+std::vector<Shift> shift695 = {{&term802, &state1015}};
+std::vector<Reduce> reduce695 = {};
+std::vector<Shift> shift696 = {{&term802, &state1013}};
+std::vector<Reduce> reduce696 = {};
+std::vector<Shift> shift697 = {{&term802, &state1011}};
+std::vector<Reduce> reduce697 = {};
+std::vector<Shift> shift698 = {{&term802, &state1009}};
+std::vector<Reduce> reduce698 = {};
+std::vector<Shift> shift699 = {{&term802, &state1007}};
+std::vector<Reduce> reduce699 = {};
+std::vector<Shift> shift700 = {{&term802, &state1005}};
+std::vector<Reduce> reduce700 = {};
+std::vector<Shift> shift701 = {{&term802, &state1003}};
+std::vector<Reduce> reduce701 = {};
+std::vector<Shift> shift702 = {{&term802, &state1001}};
+std::vector<Reduce> reduce702 = {};
+std::vector<Shift> shift703 = {{&term802, &state999}};
+std::vector<Reduce> reduce703 = {};
+std::vector<Shift> shift704 = {{&term802, &state997}};
+std::vector<Reduce> reduce704 = {};
+std::vector<Shift> shift705 = {{&term802, &state995}};
+std::vector<Reduce> reduce705 = {};
+std::vector<Shift> shift706 = {{&term802, &state993}};
+std::vector<Reduce> reduce706 = {};
+std::vector<Shift> shift707 = {{&term802, &state991}};
+std::vector<Reduce> reduce707 = {};
+std::vector<Shift> shift708 = {{&term802, &state989}};
+std::vector<Reduce> reduce708 = {};
+std::vector<Shift> shift709 = {{&term802, &state987}};
+std::vector<Reduce> reduce709 = {};
+std::vector<Shift> shift710 = {{&term802, &state985}};
+std::vector<Reduce> reduce710 = {};
+std::vector<Shift> shift711 = {{&term802, &state983}};
+std::vector<Reduce> reduce711 = {};
+std::vector<Shift> shift712 = {{&term802, &state981}};
+std::vector<Reduce> reduce712 = {};
+std::vector<Shift> shift713 = {{&term802, &state979}};
+std::vector<Reduce> reduce713 = {};
+std::vector<Shift> shift714 = {{&term802, &state977}};
+std::vector<Reduce> reduce714 = {};
+std::vector<Shift> shift715 = {{&term802, &state975}};
+std::vector<Reduce> reduce715 = {};
+std::vector<Shift> shift716 = {{&term802, &state973}};
+std::vector<Reduce> reduce716 = {};
+std::vector<Shift> shift717 = {{&term802, &state971}};
+std::vector<Reduce> reduce717 = {};
+std::vector<Shift> shift718 = {{&term802, &state969}};
+std::vector<Reduce> reduce718 = {};
+std::vector<Shift> shift719 = {{&term802, &state967}};
+std::vector<Reduce> reduce719 = {};
+std::vector<Shift> shift720 = {{&term802, &state965}};
+std::vector<Reduce> reduce720 = {};
+std::vector<Shift> shift721 = {{&term802, &state963}};
+std::vector<Reduce> reduce721 = {};
+std::vector<Shift> shift722 = {{&term802, &state961}};
+std::vector<Reduce> reduce722 = {};
+std::vector<Shift> shift723 = {{&term802, &state959}};
+std::vector<Reduce> reduce723 = {};
+std::vector<Shift> shift724 = {{&term802, &state957}};
+std::vector<Reduce> reduce724 = {};
+std::vector<Shift> shift725 = {{&term802, &state955}};
+std::vector<Reduce> reduce725 = {};
+std::vector<Shift> shift726 = {{&term802, &state953}};
+std::vector<Reduce> reduce726 = {};
+std::vector<Shift> shift727 = {{&term802, &state951}};
+std::vector<Reduce> reduce727 = {};
+std::vector<Shift> shift728 = {{&term802, &state949}};
+std::vector<Reduce> reduce728 = {};
+std::vector<Shift> shift729 = {{&term802, &state947}};
+std::vector<Reduce> reduce729 = {};
+std::vector<Shift> shift730 = {{&term802, &state945}};
+std::vector<Reduce> reduce730 = {};
+std::vector<Shift> shift731 = {{&term802, &state943}};
+std::vector<Reduce> reduce731 = {};
+std::vector<Shift> shift732 = {{&term802, &state941}};
+std::vector<Reduce> reduce732 = {};
+std::vector<Shift> shift733 = {{&term802, &state939}};
+std::vector<Reduce> reduce733 = {};
+std::vector<Shift> shift734 = {{&term802, &state937}};
+std::vector<Reduce> reduce734 = {};
+std::vector<Shift> shift735 = {{&term802, &state935}};
+std::vector<Reduce> reduce735 = {};
+std::vector<Shift> shift736 = {{&term802, &state933}};
+std::vector<Reduce> reduce736 = {};
+std::vector<Shift> shift737 = {{&term802, &state931}};
+std::vector<Reduce> reduce737 = {};
+std::vector<Shift> shift738 = {{&term802, &state929}};
+std::vector<Reduce> reduce738 = {};
+std::vector<Shift> shift739 = {{&term802, &state927}};
+std::vector<Reduce> reduce739 = {};
+std::vector<Shift> shift740 = {{&term802, &state925}};
+std::vector<Reduce> reduce740 = {};
+std::vector<Shift> shift741 = {{&term802, &state923}};
+std::vector<Reduce> reduce741 = {};
+std::vector<Shift> shift742 = {{&term802, &state921}};
+std::vector<Reduce> reduce742 = {};
+std::vector<Shift> shift743 = {{&term802, &state919}};
+std::vector<Reduce> reduce743 = {};
+std::vector<Shift> shift744 = {{&term802, &state917}};
+std::vector<Reduce> reduce744 = {};
+std::vector<Shift> shift745 = {{&term802, &state915}};
+std::vector<Reduce> reduce745 = {};
+std::vector<Shift> shift746 = {{&term802, &state913}};
+std::vector<Reduce> reduce746 = {};
+std::vector<Shift> shift747 = {{&term802, &state911}};
+std::vector<Reduce> reduce747 = {};
+std::vector<Shift> shift748 = {{&term802, &state909}};
+std::vector<Reduce> reduce748 = {};
+std::vector<Shift> shift749 = {{&term802, &state907}};
+std::vector<Reduce> reduce749 = {};
+std::vector<Shift> shift750 = {{&term802, &state905}};
+std::vector<Reduce> reduce750 = {};
+std::vector<Shift> shift751 = {{&term802, &state903}};
+std::vector<Reduce> reduce751 = {};
+std::vector<Shift> shift752 = {{&term802, &state901}};
+std::vector<Reduce> reduce752 = {};
+std::vector<Shift> shift753 = {{&term802, &state899}};
+std::vector<Reduce> reduce753 = {};
+std::vector<Shift> shift754 = {{&term802, &state897}};
+std::vector<Reduce> reduce754 = {};
+std::vector<Shift> shift755 = {{&term802, &state895}};
+std::vector<Reduce> reduce755 = {};
+std::vector<Shift> shift756 = {{&term802, &state893}};
+std::vector<Reduce> reduce756 = {};
+std::vector<Shift> shift757 = {{&term802, &state891}};
+std::vector<Reduce> reduce757 = {};
+std::vector<Shift> shift758 = {{&term802, &state889}};
+std::vector<Reduce> reduce758 = {};
+std::vector<Shift> shift759 = {{&term802, &state887}};
+std::vector<Reduce> reduce759 = {};
+std::vector<Shift> shift760 = {{&term802, &state885}};
+std::vector<Reduce> reduce760 = {};
+std::vector<Shift> shift761 = {{&term802, &state883}};
+std::vector<Reduce> reduce761 = {};
+std::vector<Shift> shift762 = {{&term802, &state881}};
+std::vector<Reduce> reduce762 = {};
+std::vector<Shift> shift763 = {{&term802, &state879}};
+std::vector<Reduce> reduce763 = {};
+std::vector<Shift> shift764 = {{&term802, &state877}};
+std::vector<Reduce> reduce764 = {};
+std::vector<Shift> shift765 = {{&term802, &state875}};
+std::vector<Reduce> reduce765 = {};
+std::vector<Shift> shift766 = {{&term802, &state873}};
+std::vector<Reduce> reduce766 = {};
+std::vector<Shift> shift767 = {{&term802, &state871}};
+std::vector<Reduce> reduce767 = {};
+std::vector<Shift> shift768 = {{&term802, &state869}};
+std::vector<Reduce> reduce768 = {};
+std::vector<Shift> shift769 = {{&term802, &state867}};
+std::vector<Reduce> reduce769 = {};
+std::vector<Shift> shift770 = {{&term802, &state865}};
+std::vector<Reduce> reduce770 = {};
+std::vector<Shift> shift771 = {{&term802, &state863}};
+std::vector<Reduce> reduce771 = {};
+std::vector<Shift> shift772 = {{&term802, &state861}};
+std::vector<Reduce> reduce772 = {};
+std::vector<Shift> shift773 = {{&term802, &state859}};
+std::vector<Reduce> reduce773 = {};
+std::vector<Shift> shift774 = {{&term802, &state857}};
+std::vector<Reduce> reduce774 = {};
+std::vector<Shift> shift775 = {{&term802, &state855}};
+std::vector<Reduce> reduce775 = {};
+std::vector<Shift> shift776 = {{&term802, &state853}};
+std::vector<Reduce> reduce776 = {};
+std::vector<Shift> shift777 = {{&term802, &state851}};
+std::vector<Reduce> reduce777 = {};
+std::vector<Shift> shift778 = {{&term802, &state849}};
+std::vector<Reduce> reduce778 = {};
+std::vector<Shift> shift779 = {{&term802, &state847}};
+std::vector<Reduce> reduce779 = {};
+std::vector<Shift> shift780 = {{&term802, &state845}};
+std::vector<Reduce> reduce780 = {};
+std::vector<Shift> shift781 = {{&term802, &state843}};
+std::vector<Reduce> reduce781 = {};
+std::vector<Shift> shift782 = {{&term802, &state841}};
+std::vector<Reduce> reduce782 = {};
+std::vector<Shift> shift783 = {{&term802, &state839}};
+std::vector<Reduce> reduce783 = {};
+std::vector<Shift> shift784 = {{&term802, &state837}};
+std::vector<Reduce> reduce784 = {};
+std::vector<Shift> shift785 = {{&term802, &state835}};
+std::vector<Reduce> reduce785 = {};
+std::vector<Shift> shift786 = {{&term802, &state833}};
+std::vector<Reduce> reduce786 = {};
+std::vector<Shift> shift787 = {{&term802, &state831}};
+std::vector<Reduce> reduce787 = {};
+std::vector<Shift> shift788 = {{&term802, &state829}};
+std::vector<Reduce> reduce788 = {};
+std::vector<Shift> shift789 = {{&term802, &state827}};
+std::vector<Reduce> reduce789 = {};
+std::vector<Shift> shift790 = {{&term802, &state825}};
+std::vector<Reduce> reduce790 = {};
+std::vector<Shift> shift791 = {{&term802, &state823}};
+std::vector<Reduce> reduce791 = {};
+std::vector<Shift> shift792 = {{&term802, &state821}};
+std::vector<Reduce> reduce792 = {};
+std::vector<Shift> shift793 = {{&term802, &state819}};
+std::vector<Reduce> reduce793 = {};
+std::vector<Shift> shift794 = {{&term802, &state817}};
+std::vector<Reduce> reduce794 = {};
+std::vector<Shift> shift795 = {{&term802, &state815}};
+std::vector<Reduce> reduce795 = {};
+std::vector<Shift> shift796 = {{&term802, &state813}};
+std::vector<Reduce> reduce796 = {};
+std::vector<Shift> shift797 = {{&term802, &state811}};
+std::vector<Reduce> reduce797 = {};
+std::vector<Shift> shift798 = {{&term802, &state809}};
+std::vector<Reduce> reduce798 = {};
+std::vector<Shift> shift799 = {{&term802, &state807}};
+std::vector<Reduce> reduce799 = {};
+std::vector<Shift> shift800 = {{&term802, &state805}};
+std::vector<Reduce> reduce800 = {};
+std::vector<Shift> shift801 = {{&term802, &state803}};
+std::vector<Reduce> reduce801 = {};
+std::vector<Shift> shift802 = {};
+std::vector<Reduce> reduce802 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift803 = {{&term803, &state804}};
+std::vector<Reduce> reduce803 = {};
+std::vector<Shift> shift804 = {};
+std::vector<Reduce> reduce804 = {{nullptr, &rule802, false}};
+std::vector<Shift> shift805 = {{&term803, &state806}};
+std::vector<Reduce> reduce805 = {};
+std::vector<Shift> shift806 = {};
+std::vector<Reduce> reduce806 = {{nullptr, &rule801, false}};
+std::vector<Shift> shift807 = {{&term803, &state808}};
+std::vector<Reduce> reduce807 = {};
+std::vector<Shift> shift808 = {};
+std::vector<Reduce> reduce808 = {{nullptr, &rule800, false}};
+std::vector<Shift> shift809 = {{&term803, &state810}};
+std::vector<Reduce> reduce809 = {};
+std::vector<Shift> shift810 = {};
+std::vector<Reduce> reduce810 = {{nullptr, &rule799, false}};
+std::vector<Shift> shift811 = {{&term803, &state812}};
+std::vector<Reduce> reduce811 = {};
+std::vector<Shift> shift812 = {};
+std::vector<Reduce> reduce812 = {{nullptr, &rule798, false}};
+std::vector<Shift> shift813 = {{&term803, &state814}};
+std::vector<Reduce> reduce813 = {};
+std::vector<Shift> shift814 = {};
+std::vector<Reduce> reduce814 = {{nullptr, &rule797, false}};
+std::vector<Shift> shift815 = {{&term803, &state816}};
+std::vector<Reduce> reduce815 = {};
+std::vector<Shift> shift816 = {};
+std::vector<Reduce> reduce816 = {{nullptr, &rule796, false}};
+std::vector<Shift> shift817 = {{&term803, &state818}};
+std::vector<Reduce> reduce817 = {};
+std::vector<Shift> shift818 = {};
+std::vector<Reduce> reduce818 = {{nullptr, &rule795, false}};
+std::vector<Shift> shift819 = {{&term803, &state820}};
+std::vector<Reduce> reduce819 = {};
+std::vector<Shift> shift820 = {};
+std::vector<Reduce> reduce820 = {{nullptr, &rule794, false}};
+std::vector<Shift> shift821 = {{&term803, &state822}};
+std::vector<Reduce> reduce821 = {};
+std::vector<Shift> shift822 = {};
+std::vector<Reduce> reduce822 = {{nullptr, &rule793, false}};
+std::vector<Shift> shift823 = {{&term803, &state824}};
+std::vector<Reduce> reduce823 = {};
+std::vector<Shift> shift824 = {};
+std::vector<Reduce> reduce824 = {{nullptr, &rule792, false}};
+std::vector<Shift> shift825 = {{&term803, &state826}};
+std::vector<Reduce> reduce825 = {};
+std::vector<Shift> shift826 = {};
+std::vector<Reduce> reduce826 = {{nullptr, &rule791, false}};
+std::vector<Shift> shift827 = {{&term803, &state828}};
+std::vector<Reduce> reduce827 = {};
+std::vector<Shift> shift828 = {};
+std::vector<Reduce> reduce828 = {{nullptr, &rule790, false}};
+std::vector<Shift> shift829 = {{&term803, &state830}};
+std::vector<Reduce> reduce829 = {};
+std::vector<Shift> shift830 = {};
+std::vector<Reduce> reduce830 = {{nullptr, &rule789, false}};
+std::vector<Shift> shift831 = {{&term803, &state832}};
+std::vector<Reduce> reduce831 = {};
+std::vector<Shift> shift832 = {};
+std::vector<Reduce> reduce832 = {{nullptr, &rule788, false}};
+std::vector<Shift> shift833 = {{&term803, &state834}};
+std::vector<Reduce> reduce833 = {};
+std::vector<Shift> shift834 = {};
+std::vector<Reduce> reduce834 = {{nullptr, &rule787, false}};
+std::vector<Shift> shift835 = {{&term803, &state836}};
+std::vector<Reduce> reduce835 = {};
+std::vector<Shift> shift836 = {};
+std::vector<Reduce> reduce836 = {{nullptr, &rule786, false}};
+std::vector<Shift> shift837 = {{&term803, &state838}};
+std::vector<Reduce> reduce837 = {};
+std::vector<Shift> shift838 = {};
+std::vector<Reduce> reduce838 = {{nullptr, &rule785, false}};
+std::vector<Shift> shift839 = {{&term803, &state840}};
+std::vector<Reduce> reduce839 = {};
+std::vector<Shift> shift840 = {};
+std::vector<Reduce> reduce840 = {{nullptr, &rule784, false}};
+std::vector<Shift> shift841 = {{&term803, &state842}};
+std::vector<Reduce> reduce841 = {};
+std::vector<Shift> shift842 = {};
+std::vector<Reduce> reduce842 = {{nullptr, &rule783, false}};
+std::vector<Shift> shift843 = {{&term803, &state844}};
+std::vector<Reduce> reduce843 = {};
+std::vector<Shift> shift844 = {};
+std::vector<Reduce> reduce844 = {{nullptr, &rule782, false}};
+std::vector<Shift> shift845 = {{&term803, &state846}};
+std::vector<Reduce> reduce845 = {};
+std::vector<Shift> shift846 = {};
+std::vector<Reduce> reduce846 = {{nullptr, &rule781, false}};
+std::vector<Shift> shift847 = {{&term803, &state848}};
+std::vector<Reduce> reduce847 = {};
+std::vector<Shift> shift848 = {};
+std::vector<Reduce> reduce848 = {{nullptr, &rule780, false}};
+std::vector<Shift> shift849 = {{&term803, &state850}};
+std::vector<Reduce> reduce849 = {};
+std::vector<Shift> shift850 = {};
+std::vector<Reduce> reduce850 = {{nullptr, &rule779, false}};
+std::vector<Shift> shift851 = {{&term803, &state852}};
+std::vector<Reduce> reduce851 = {};
+std::vector<Shift> shift852 = {};
+std::vector<Reduce> reduce852 = {{nullptr, &rule778, false}};
+std::vector<Shift> shift853 = {{&term803, &state854}};
+std::vector<Reduce> reduce853 = {};
+std::vector<Shift> shift854 = {};
+std::vector<Reduce> reduce854 = {{nullptr, &rule777, false}};
+std::vector<Shift> shift855 = {{&term803, &state856}};
+std::vector<Reduce> reduce855 = {};
+std::vector<Shift> shift856 = {};
+std::vector<Reduce> reduce856 = {{nullptr, &rule776, false}};
+std::vector<Shift> shift857 = {{&term803, &state858}};
+std::vector<Reduce> reduce857 = {};
+std::vector<Shift> shift858 = {};
+std::vector<Reduce> reduce858 = {{nullptr, &rule775, false}};
+std::vector<Shift> shift859 = {{&term803, &state860}};
+std::vector<Reduce> reduce859 = {};
+std::vector<Shift> shift860 = {};
+std::vector<Reduce> reduce860 = {{nullptr, &rule774, false}};
+std::vector<Shift> shift861 = {{&term803, &state862}};
+std::vector<Reduce> reduce861 = {};
+std::vector<Shift> shift862 = {};
+std::vector<Reduce> reduce862 = {{nullptr, &rule773, false}};
+std::vector<Shift> shift863 = {{&term803, &state864}};
+std::vector<Reduce> reduce863 = {};
+std::vector<Shift> shift864 = {};
+std::vector<Reduce> reduce864 = {{nullptr, &rule772, false}};
+std::vector<Shift> shift865 = {{&term803, &state866}};
+std::vector<Reduce> reduce865 = {};
+std::vector<Shift> shift866 = {};
+std::vector<Reduce> reduce866 = {{nullptr, &rule771, false}};
+std::vector<Shift> shift867 = {{&term803, &state868}};
+std::vector<Reduce> reduce867 = {};
+std::vector<Shift> shift868 = {};
+std::vector<Reduce> reduce868 = {{nullptr, &rule770, false}};
+std::vector<Shift> shift869 = {{&term803, &state870}};
+std::vector<Reduce> reduce869 = {};
+std::vector<Shift> shift870 = {};
+std::vector<Reduce> reduce870 = {{nullptr, &rule769, false}};
+std::vector<Shift> shift871 = {{&term803, &state872}};
+std::vector<Reduce> reduce871 = {};
+std::vector<Shift> shift872 = {};
+std::vector<Reduce> reduce872 = {{nullptr, &rule768, false}};
+std::vector<Shift> shift873 = {{&term803, &state874}};
+std::vector<Reduce> reduce873 = {};
+std::vector<Shift> shift874 = {};
+std::vector<Reduce> reduce874 = {{nullptr, &rule767, false}};
+std::vector<Shift> shift875 = {{&term803, &state876}};
+std::vector<Reduce> reduce875 = {};
+std::vector<Shift> shift876 = {};
+std::vector<Reduce> reduce876 = {{nullptr, &rule766, false}};
+std::vector<Shift> shift877 = {{&term803, &state878}};
+std::vector<Reduce> reduce877 = {};
+std::vector<Shift> shift878 = {};
+std::vector<Reduce> reduce878 = {{nullptr, &rule765, false}};
+std::vector<Shift> shift879 = {{&term803, &state880}};
+std::vector<Reduce> reduce879 = {};
+std::vector<Shift> shift880 = {};
+std::vector<Reduce> reduce880 = {{nullptr, &rule764, false}};
+std::vector<Shift> shift881 = {{&term803, &state882}};
+std::vector<Reduce> reduce881 = {};
+std::vector<Shift> shift882 = {};
+std::vector<Reduce> reduce882 = {{nullptr, &rule763, false}};
+std::vector<Shift> shift883 = {{&term803, &state884}};
+std::vector<Reduce> reduce883 = {};
+std::vector<Shift> shift884 = {};
+std::vector<Reduce> reduce884 = {{nullptr, &rule762, false}};
+std::vector<Shift> shift885 = {{&term803, &state886}};
+std::vector<Reduce> reduce885 = {};
+std::vector<Shift> shift886 = {};
+std::vector<Reduce> reduce886 = {{nullptr, &rule761, false}};
+std::vector<Shift> shift887 = {{&term803, &state888}};
+std::vector<Reduce> reduce887 = {};
+std::vector<Shift> shift888 = {};
+std::vector<Reduce> reduce888 = {{nullptr, &rule760, false}};
+std::vector<Shift> shift889 = {{&term803, &state890}};
+std::vector<Reduce> reduce889 = {};
+std::vector<Shift> shift890 = {};
+std::vector<Reduce> reduce890 = {{nullptr, &rule759, false}};
+std::vector<Shift> shift891 = {{&term803, &state892}};
+std::vector<Reduce> reduce891 = {};
+std::vector<Shift> shift892 = {};
+std::vector<Reduce> reduce892 = {{nullptr, &rule758, false}};
+std::vector<Shift> shift893 = {{&term803, &state894}};
+std::vector<Reduce> reduce893 = {};
+std::vector<Shift> shift894 = {};
+std::vector<Reduce> reduce894 = {{nullptr, &rule757, false}};
+std::vector<Shift> shift895 = {{&term803, &state896}};
+std::vector<Reduce> reduce895 = {};
+std::vector<Shift> shift896 = {};
+std::vector<Reduce> reduce896 = {{nullptr, &rule756, false}};
+std::vector<Shift> shift897 = {{&term803, &state898}};
+std::vector<Reduce> reduce897 = {};
+std::vector<Shift> shift898 = {};
+std::vector<Reduce> reduce898 = {{nullptr, &rule755, false}};
+std::vector<Shift> shift899 = {{&term803, &state900}};
+std::vector<Reduce> reduce899 = {};
+std::vector<Shift> shift900 = {};
+std::vector<Reduce> reduce900 = {{nullptr, &rule754, false}};
+std::vector<Shift> shift901 = {{&term803, &state902}};
+std::vector<Reduce> reduce901 = {};
+std::vector<Shift> shift902 = {};
+std::vector<Reduce> reduce902 = {{nullptr, &rule753, false}};
+std::vector<Shift> shift903 = {{&term803, &state904}};
+std::vector<Reduce> reduce903 = {};
+std::vector<Shift> shift904 = {};
+std::vector<Reduce> reduce904 = {{nullptr, &rule752, false}};
+std::vector<Shift> shift905 = {{&term803, &state906}};
+std::vector<Reduce> reduce905 = {};
+std::vector<Shift> shift906 = {};
+std::vector<Reduce> reduce906 = {{nullptr, &rule751, false}};
+std::vector<Shift> shift907 = {{&term803, &state908}};
+std::vector<Reduce> reduce907 = {};
+std::vector<Shift> shift908 = {};
+std::vector<Reduce> reduce908 = {{nullptr, &rule750, false}};
+std::vector<Shift> shift909 = {{&term803, &state910}};
+std::vector<Reduce> reduce909 = {};
+std::vector<Shift> shift910 = {};
+std::vector<Reduce> reduce910 = {{nullptr, &rule749, false}};
+std::vector<Shift> shift911 = {{&term803, &state912}};
+std::vector<Reduce> reduce911 = {};
+std::vector<Shift> shift912 = {};
+std::vector<Reduce> reduce912 = {{nullptr, &rule748, false}};
+std::vector<Shift> shift913 = {{&term803, &state914}};
+std::vector<Reduce> reduce913 = {};
+std::vector<Shift> shift914 = {};
+std::vector<Reduce> reduce914 = {{nullptr, &rule747, false}};
+std::vector<Shift> shift915 = {{&term803, &state916}};
+std::vector<Reduce> reduce915 = {};
+std::vector<Shift> shift916 = {};
+std::vector<Reduce> reduce916 = {{nullptr, &rule746, false}};
+std::vector<Shift> shift917 = {{&term803, &state918}};
+std::vector<Reduce> reduce917 = {};
+std::vector<Shift> shift918 = {};
+std::vector<Reduce> reduce918 = {{nullptr, &rule745, false}};
+std::vector<Shift> shift919 = {{&term803, &state920}};
+std::vector<Reduce> reduce919 = {};
+std::vector<Shift> shift920 = {};
+std::vector<Reduce> reduce920 = {{nullptr, &rule744, false}};
+std::vector<Shift> shift921 = {{&term803, &state922}};
+std::vector<Reduce> reduce921 = {};
+std::vector<Shift> shift922 = {};
+std::vector<Reduce> reduce922 = {{nullptr, &rule743, false}};
+std::vector<Shift> shift923 = {{&term803, &state924}};
+std::vector<Reduce> reduce923 = {};
+std::vector<Shift> shift924 = {};
+std::vector<Reduce> reduce924 = {{nullptr, &rule742, false}};
+std::vector<Shift> shift925 = {{&term803, &state926}};
+std::vector<Reduce> reduce925 = {};
+std::vector<Shift> shift926 = {};
+std::vector<Reduce> reduce926 = {{nullptr, &rule741, false}};
+std::vector<Shift> shift927 = {{&term803, &state928}};
+std::vector<Reduce> reduce927 = {};
+std::vector<Shift> shift928 = {};
+std::vector<Reduce> reduce928 = {{nullptr, &rule740, false}};
+std::vector<Shift> shift929 = {{&term803, &state930}};
+std::vector<Reduce> reduce929 = {};
+std::vector<Shift> shift930 = {};
+std::vector<Reduce> reduce930 = {{nullptr, &rule739, false}};
+std::vector<Shift> shift931 = {{&term803, &state932}};
+std::vector<Reduce> reduce931 = {};
+std::vector<Shift> shift932 = {};
+std::vector<Reduce> reduce932 = {{nullptr, &rule738, false}};
+std::vector<Shift> shift933 = {{&term803, &state934}};
+std::vector<Reduce> reduce933 = {};
+std::vector<Shift> shift934 = {};
+std::vector<Reduce> reduce934 = {{nullptr, &rule737, false}};
+std::vector<Shift> shift935 = {{&term803, &state936}};
+std::vector<Reduce> reduce935 = {};
+std::vector<Shift> shift936 = {};
+std::vector<Reduce> reduce936 = {{nullptr, &rule736, false}};
+std::vector<Shift> shift937 = {{&term803, &state938}};
+std::vector<Reduce> reduce937 = {};
+std::vector<Shift> shift938 = {};
+std::vector<Reduce> reduce938 = {{nullptr, &rule735, false}};
+std::vector<Shift> shift939 = {{&term803, &state940}};
+std::vector<Reduce> reduce939 = {};
+std::vector<Shift> shift940 = {};
+std::vector<Reduce> reduce940 = {{nullptr, &rule734, false}};
+std::vector<Shift> shift941 = {{&term803, &state942}};
+std::vector<Reduce> reduce941 = {};
+std::vector<Shift> shift942 = {};
+std::vector<Reduce> reduce942 = {{nullptr, &rule733, false}};
+std::vector<Shift> shift943 = {{&term803, &state944}};
+std::vector<Reduce> reduce943 = {};
+std::vector<Shift> shift944 = {};
+std::vector<Reduce> reduce944 = {{nullptr, &rule732, false}};
+std::vector<Shift> shift945 = {{&term803, &state946}};
+std::vector<Reduce> reduce945 = {};
+std::vector<Shift> shift946 = {};
+std::vector<Reduce> reduce946 = {{nullptr, &rule731, false}};
+std::vector<Shift> shift947 = {{&term803, &state948}};
+std::vector<Reduce> reduce947 = {};
+std::vector<Shift> shift948 = {};
+std::vector<Reduce> reduce948 = {{nullptr, &rule730, false}};
+std::vector<Shift> shift949 = {{&term803, &state950}};
+std::vector<Reduce> reduce949 = {};
+std::vector<Shift> shift950 = {};
+std::vector<Reduce> reduce950 = {{nullptr, &rule729, false}};
+std::vector<Shift> shift951 = {{&term803, &state952}};
+std::vector<Reduce> reduce951 = {};
+std::vector<Shift> shift952 = {};
+std::vector<Reduce> reduce952 = {{nullptr, &rule728, false}};
+std::vector<Shift> shift953 = {{&term803, &state954}};
+std::vector<Reduce> reduce953 = {};
+std::vector<Shift> shift954 = {};
+std::vector<Reduce> reduce954 = {{nullptr, &rule727, false}};
+std::vector<Shift> shift955 = {{&term803, &state956}};
+std::vector<Reduce> reduce955 = {};
+std::vector<Shift> shift956 = {};
+std::vector<Reduce> reduce956 = {{nullptr, &rule726, false}};
+std::vector<Shift> shift957 = {{&term803, &state958}};
+std::vector<Reduce> reduce957 = {};
+std::vector<Shift> shift958 = {};
+std::vector<Reduce> reduce958 = {{nullptr, &rule725, false}};
+std::vector<Shift> shift959 = {{&term803, &state960}};
+std::vector<Reduce> reduce959 = {};
+std::vector<Shift> shift960 = {};
+std::vector<Reduce> reduce960 = {{nullptr, &rule724, false}};
+std::vector<Shift> shift961 = {{&term803, &state962}};
+std::vector<Reduce> reduce961 = {};
+std::vector<Shift> shift962 = {};
+std::vector<Reduce> reduce962 = {{nullptr, &rule723, false}};
+std::vector<Shift> shift963 = {{&term803, &state964}};
+std::vector<Reduce> reduce963 = {};
+std::vector<Shift> shift964 = {};
+std::vector<Reduce> reduce964 = {{nullptr, &rule722, false}};
+std::vector<Shift> shift965 = {{&term803, &state966}};
+std::vector<Reduce> reduce965 = {};
+std::vector<Shift> shift966 = {};
+std::vector<Reduce> reduce966 = {{nullptr, &rule721, false}};
+std::vector<Shift> shift967 = {{&term803, &state968}};
+std::vector<Reduce> reduce967 = {};
+std::vector<Shift> shift968 = {};
+std::vector<Reduce> reduce968 = {{nullptr, &rule720, false}};
+std::vector<Shift> shift969 = {{&term803, &state970}};
+std::vector<Reduce> reduce969 = {};
+std::vector<Shift> shift970 = {};
+std::vector<Reduce> reduce970 = {{nullptr, &rule719, false}};
+std::vector<Shift> shift971 = {{&term803, &state972}};
+std::vector<Reduce> reduce971 = {};
+std::vector<Shift> shift972 = {};
+std::vector<Reduce> reduce972 = {{nullptr, &rule718, false}};
+std::vector<Shift> shift973 = {{&term803, &state974}};
+std::vector<Reduce> reduce973 = {};
+std::vector<Shift> shift974 = {};
+std::vector<Reduce> reduce974 = {{nullptr, &rule717, false}};
+std::vector<Shift> shift975 = {{&term803, &state976}};
+std::vector<Reduce> reduce975 = {};
+std::vector<Shift> shift976 = {};
+std::vector<Reduce> reduce976 = {{nullptr, &rule716, false}};
+std::vector<Shift> shift977 = {{&term803, &state978}};
+std::vector<Reduce> reduce977 = {};
+std::vector<Shift> shift978 = {};
+std::vector<Reduce> reduce978 = {{nullptr, &rule715, false}};
+std::vector<Shift> shift979 = {{&term803, &state980}};
+std::vector<Reduce> reduce979 = {};
+std::vector<Shift> shift980 = {};
+std::vector<Reduce> reduce980 = {{nullptr, &rule714, false}};
+std::vector<Shift> shift981 = {{&term803, &state982}};
+std::vector<Reduce> reduce981 = {};
+std::vector<Shift> shift982 = {};
+std::vector<Reduce> reduce982 = {{nullptr, &rule713, false}};
+std::vector<Shift> shift983 = {{&term803, &state984}};
+std::vector<Reduce> reduce983 = {};
+std::vector<Shift> shift984 = {};
+std::vector<Reduce> reduce984 = {{nullptr, &rule712, false}};
+std::vector<Shift> shift985 = {{&term803, &state986}};
+std::vector<Reduce> reduce985 = {};
+std::vector<Shift> shift986 = {};
+std::vector<Reduce> reduce986 = {{nullptr, &rule711, false}};
+std::vector<Shift> shift987 = {{&term803, &state988}};
+std::vector<Reduce> reduce987 = {};
+std::vector<Shift> shift988 = {};
+std::vector<Reduce> reduce988 = {{nullptr, &rule710, false}};
+std::vector<Shift> shift989 = {{&term803, &state990}};
+std::vector<Reduce> reduce989 = {};
+std::vector<Shift> shift990 = {};
+std::vector<Reduce> reduce990 = {{nullptr, &rule709, false}};
+std::vector<Shift> shift991 = {{&term803, &state992}};
+std::vector<Reduce> reduce991 = {};
+std::vector<Shift> shift992 = {};
+std::vector<Reduce> reduce992 = {{nullptr, &rule708, false}};
+std::vector<Shift> shift993 = {{&term803, &state994}};
+std::vector<Reduce> reduce993 = {};
+std::vector<Shift> shift994 = {};
+std::vector<Reduce> reduce994 = {{nullptr, &rule707, false}};
+std::vector<Shift> shift995 = {{&term803, &state996}};
+std::vector<Reduce> reduce995 = {};
+std::vector<Shift> shift996 = {};
+std::vector<Reduce> reduce996 = {{nullptr, &rule706, false}};
+std::vector<Shift> shift997 = {{&term803, &state998}};
+std::vector<Reduce> reduce997 = {};
+std::vector<Shift> shift998 = {};
+std::vector<Reduce> reduce998 = {{nullptr, &rule705, false}};
+std::vector<Shift> shift999 = {{&term803, &state1000}};
+std::vector<Reduce> reduce999 = {};
+std::vector<Shift> shift1000 = {};
+std::vector<Reduce> reduce1000 = {{nullptr, &rule704, false}};
+std::vector<Shift> shift1001 = {{&term803, &state1002}};
+std::vector<Reduce> reduce1001 = {};
+std::vector<Shift> shift1002 = {};
+std::vector<Reduce> reduce1002 = {{nullptr, &rule703, false}};
+std::vector<Shift> shift1003 = {{&term803, &state1004}};
+std::vector<Reduce> reduce1003 = {};
+std::vector<Shift> shift1004 = {};
+std::vector<Reduce> reduce1004 = {{nullptr, &rule702, false}};
+std::vector<Shift> shift1005 = {{&term803, &state1006}};
+std::vector<Reduce> reduce1005 = {};
+std::vector<Shift> shift1006 = {};
+std::vector<Reduce> reduce1006 = {{nullptr, &rule701, false}};
+std::vector<Shift> shift1007 = {{&term803, &state1008}};
+std::vector<Reduce> reduce1007 = {};
+std::vector<Shift> shift1008 = {};
+std::vector<Reduce> reduce1008 = {{nullptr, &rule700, false}};
+std::vector<Shift> shift1009 = {{&term803, &state1010}};
+std::vector<Reduce> reduce1009 = {};
+std::vector<Shift> shift1010 = {};
+std::vector<Reduce> reduce1010 = {{nullptr, &rule699, false}};
+std::vector<Shift> shift1011 = {{&term803, &state1012}};
+std::vector<Reduce> reduce1011 = {};
+std::vector<Shift> shift1012 = {};
+std::vector<Reduce> reduce1012 = {{nullptr, &rule698, false}};
+std::vector<Shift> shift1013 = {{&term803, &state1014}};
+std::vector<Reduce> reduce1013 = {};
+std::vector<Shift> shift1014 = {};
+std::vector<Reduce> reduce1014 = {{nullptr, &rule697, false}};
+std::vector<Shift> shift1015 = {{&term803, &state1016}};
+std::vector<Reduce> reduce1015 = {};
+std::vector<Shift> shift1016 = {};
+std::vector<Reduce> reduce1016 = {{nullptr, &rule696, false}};
+std::vector<Shift> shift1017 = {{&term803, &state1018}};
+std::vector<Reduce> reduce1017 = {};
+std::vector<Shift> shift1018 = {};
+std::vector<Reduce> reduce1018 = {{nullptr, &rule695, false}};
+std::vector<Shift> shift1019 = {{&term803, &state1020}};
+std::vector<Reduce> reduce1019 = {};
+std::vector<Shift> shift1020 = {};
+std::vector<Reduce> reduce1020 = {{nullptr, &rule694, false}};
+std::vector<Shift> shift1021 = {{&term803, &state1022}};
+std::vector<Reduce> reduce1021 = {};
+std::vector<Shift> shift1022 = {};
+std::vector<Reduce> reduce1022 = {{nullptr, &rule693, false}};
+std::vector<Shift> shift1023 = {{&term803, &state1024}};
+std::vector<Reduce> reduce1023 = {};
+std::vector<Shift> shift1024 = {};
+std::vector<Reduce> reduce1024 = {{nullptr, &rule692, false}};
+std::vector<Shift> shift1025 = {{&term803, &state1026}};
+std::vector<Reduce> reduce1025 = {};
+std::vector<Shift> shift1026 = {};
+std::vector<Reduce> reduce1026 = {{nullptr, &rule691, false}};
+std::vector<Shift> shift1027 = {{&term803, &state1028}};
+std::vector<Reduce> reduce1027 = {};
+std::vector<Shift> shift1028 = {};
+std::vector<Reduce> reduce1028 = {{nullptr, &rule690, false}};
+std::vector<Shift> shift1029 = {{&term803, &state1030}};
+std::vector<Reduce> reduce1029 = {};
+std::vector<Shift> shift1030 = {};
+std::vector<Reduce> reduce1030 = {{nullptr, &rule689, false}};
+std::vector<Shift> shift1031 = {{&term803, &state1032}};
+std::vector<Reduce> reduce1031 = {};
+std::vector<Shift> shift1032 = {};
+std::vector<Reduce> reduce1032 = {{nullptr, &rule688, false}};
+std::vector<Shift> shift1033 = {{&term803, &state1034}};
+std::vector<Reduce> reduce1033 = {};
+std::vector<Shift> shift1034 = {};
+std::vector<Reduce> reduce1034 = {{nullptr, &rule687, false}};
+std::vector<Shift> shift1035 = {{&term803, &state1036}};
+std::vector<Reduce> reduce1035 = {};
+std::vector<Shift> shift1036 = {};
+std::vector<Reduce> reduce1036 = {{nullptr, &rule686, false}};
+std::vector<Shift> shift1037 = {{&term803, &state1038}};
+std::vector<Reduce> reduce1037 = {};
+std::vector<Shift> shift1038 = {};
+std::vector<Reduce> reduce1038 = {{nullptr, &rule685, false}};
+std::vector<Shift> shift1039 = {{&term803, &state1040}};
+std::vector<Reduce> reduce1039 = {};
+std::vector<Shift> shift1040 = {};
+std::vector<Reduce> reduce1040 = {{nullptr, &rule684, false}};
+std::vector<Shift> shift1041 = {{&term803, &state1042}};
+std::vector<Reduce> reduce1041 = {};
+std::vector<Shift> shift1042 = {};
+std::vector<Reduce> reduce1042 = {{nullptr, &rule683, false}};
+std::vector<Shift> shift1043 = {{&term803, &state1044}};
+std::vector<Reduce> reduce1043 = {};
+std::vector<Shift> shift1044 = {};
+std::vector<Reduce> reduce1044 = {{nullptr, &rule682, false}};
+std::vector<Shift> shift1045 = {{&term803, &state1046}};
+std::vector<Reduce> reduce1045 = {};
+std::vector<Shift> shift1046 = {};
+std::vector<Reduce> reduce1046 = {{nullptr, &rule681, false}};
+std::vector<Shift> shift1047 = {{&term803, &state1048}};
+std::vector<Reduce> reduce1047 = {};
+std::vector<Shift> shift1048 = {};
+std::vector<Reduce> reduce1048 = {{nullptr, &rule680, false}};
+std::vector<Shift> shift1049 = {{&term803, &state1050}};
+std::vector<Reduce> reduce1049 = {};
+std::vector<Shift> shift1050 = {};
+std::vector<Reduce> reduce1050 = {{nullptr, &rule679, false}};
+std::vector<Shift> shift1051 = {{&term803, &state1052}};
+std::vector<Reduce> reduce1051 = {};
+std::vector<Shift> shift1052 = {};
+std::vector<Reduce> reduce1052 = {{nullptr, &rule678, false}};
+std::vector<Shift> shift1053 = {{&term803, &state1054}};
+std::vector<Reduce> reduce1053 = {};
+std::vector<Shift> shift1054 = {};
+std::vector<Reduce> reduce1054 = {{nullptr, &rule677, false}};
+std::vector<Shift> shift1055 = {{&term803, &state1056}};
+std::vector<Reduce> reduce1055 = {};
+std::vector<Shift> shift1056 = {};
+std::vector<Reduce> reduce1056 = {{nullptr, &rule676, false}};
+std::vector<Shift> shift1057 = {{&term803, &state1058}};
+std::vector<Reduce> reduce1057 = {};
+std::vector<Shift> shift1058 = {};
+std::vector<Reduce> reduce1058 = {{nullptr, &rule675, false}};
+std::vector<Shift> shift1059 = {{&term803, &state1060}};
+std::vector<Reduce> reduce1059 = {};
+std::vector<Shift> shift1060 = {};
+std::vector<Reduce> reduce1060 = {{nullptr, &rule674, false}};
+std::vector<Shift> shift1061 = {{&term803, &state1062}};
+std::vector<Reduce> reduce1061 = {};
+std::vector<Shift> shift1062 = {};
+std::vector<Reduce> reduce1062 = {{nullptr, &rule673, false}};
+std::vector<Shift> shift1063 = {{&term803, &state1064}};
+std::vector<Reduce> reduce1063 = {};
+std::vector<Shift> shift1064 = {};
+std::vector<Reduce> reduce1064 = {{nullptr, &rule672, false}};
+std::vector<Shift> shift1065 = {{&term803, &state1066}};
+std::vector<Reduce> reduce1065 = {};
+std::vector<Shift> shift1066 = {};
+std::vector<Reduce> reduce1066 = {{nullptr, &rule671, false}};
+std::vector<Shift> shift1067 = {{&term803, &state1068}};
+std::vector<Reduce> reduce1067 = {};
+std::vector<Shift> shift1068 = {};
+std::vector<Reduce> reduce1068 = {{nullptr, &rule670, false}};
+std::vector<Shift> shift1069 = {{&term803, &state1070}};
+std::vector<Reduce> reduce1069 = {};
+std::vector<Shift> shift1070 = {};
+std::vector<Reduce> reduce1070 = {{nullptr, &rule669, false}};
+std::vector<Shift> shift1071 = {{&term803, &state1072}};
+std::vector<Reduce> reduce1071 = {};
+std::vector<Shift> shift1072 = {};
+std::vector<Reduce> reduce1072 = {{nullptr, &rule668, false}};
+std::vector<Shift> shift1073 = {{&term803, &state1074}};
+std::vector<Reduce> reduce1073 = {};
+std::vector<Shift> shift1074 = {};
+std::vector<Reduce> reduce1074 = {{nullptr, &rule667, false}};
+std::vector<Shift> shift1075 = {{&term803, &state1076}};
+std::vector<Reduce> reduce1075 = {};
+std::vector<Shift> shift1076 = {};
+std::vector<Reduce> reduce1076 = {{nullptr, &rule666, false}};
+std::vector<Shift> shift1077 = {{&term803, &state1078}};
+std::vector<Reduce> reduce1077 = {};
+std::vector<Shift> shift1078 = {};
+std::vector<Reduce> reduce1078 = {{nullptr, &rule665, false}};
+std::vector<Shift> shift1079 = {{&term803, &state1080}};
+std::vector<Reduce> reduce1079 = {};
+std::vector<Shift> shift1080 = {};
+std::vector<Reduce> reduce1080 = {{nullptr, &rule664, false}};
+std::vector<Shift> shift1081 = {{&term803, &state1082}};
+std::vector<Reduce> reduce1081 = {};
+std::vector<Shift> shift1082 = {};
+std::vector<Reduce> reduce1082 = {{nullptr, &rule663, false}};
+std::vector<Shift> shift1083 = {{&term803, &state1084}};
+std::vector<Reduce> reduce1083 = {};
+std::vector<Shift> shift1084 = {};
+std::vector<Reduce> reduce1084 = {{nullptr, &rule662, false}};
+std::vector<Shift> shift1085 = {{&term803, &state1086}};
+std::vector<Reduce> reduce1085 = {};
+std::vector<Shift> shift1086 = {};
+std::vector<Reduce> reduce1086 = {{nullptr, &rule661, false}};
+std::vector<Shift> shift1087 = {{&term803, &state1088}};
+std::vector<Reduce> reduce1087 = {};
+std::vector<Shift> shift1088 = {};
+std::vector<Reduce> reduce1088 = {{nullptr, &rule660, false}};
+std::vector<Shift> shift1089 = {{&term803, &state1090}};
+std::vector<Reduce> reduce1089 = {};
+std::vector<Shift> shift1090 = {};
+std::vector<Reduce> reduce1090 = {{nullptr, &rule659, false}};
+std::vector<Shift> shift1091 = {{&term803, &state1092}};
+std::vector<Reduce> reduce1091 = {};
+std::vector<Shift> shift1092 = {};
+std::vector<Reduce> reduce1092 = {{nullptr, &rule658, false}};
+std::vector<Shift> shift1093 = {{&term803, &state1094}};
+std::vector<Reduce> reduce1093 = {};
+std::vector<Shift> shift1094 = {};
+std::vector<Reduce> reduce1094 = {{nullptr, &rule657, false}};
+std::vector<Shift> shift1095 = {{&term803, &state1096}};
+std::vector<Reduce> reduce1095 = {};
+std::vector<Shift> shift1096 = {};
+std::vector<Reduce> reduce1096 = {{nullptr, &rule656, false}};
+std::vector<Shift> shift1097 = {{&term803, &state1098}};
+std::vector<Reduce> reduce1097 = {};
+std::vector<Shift> shift1098 = {};
+std::vector<Reduce> reduce1098 = {{nullptr, &rule655, false}};
+std::vector<Shift> shift1099 = {{&term803, &state1100}};
+std::vector<Reduce> reduce1099 = {};
+std::vector<Shift> shift1100 = {};
+std::vector<Reduce> reduce1100 = {{nullptr, &rule654, false}};
+std::vector<Shift> shift1101 = {{&term803, &state1102}};
+std::vector<Reduce> reduce1101 = {};
+std::vector<Shift> shift1102 = {};
+std::vector<Reduce> reduce1102 = {{nullptr, &rule653, false}};
+std::vector<Shift> shift1103 = {{&term803, &state1104}};
+std::vector<Reduce> reduce1103 = {};
+std::vector<Shift> shift1104 = {};
+std::vector<Reduce> reduce1104 = {{nullptr, &rule652, false}};
+std::vector<Shift> shift1105 = {{&term803, &state1106}};
+std::vector<Reduce> reduce1105 = {};
+std::vector<Shift> shift1106 = {};
+std::vector<Reduce> reduce1106 = {{nullptr, &rule651, false}};
+std::vector<Shift> shift1107 = {{&term803, &state1108}};
+std::vector<Reduce> reduce1107 = {};
+std::vector<Shift> shift1108 = {};
+std::vector<Reduce> reduce1108 = {{nullptr, &rule650, false}};
+std::vector<Shift> shift1109 = {{&term803, &state1110}};
+std::vector<Reduce> reduce1109 = {};
+std::vector<Shift> shift1110 = {};
+std::vector<Reduce> reduce1110 = {{nullptr, &rule649, false}};
+std::vector<Shift> shift1111 = {{&term803, &state1112}};
+std::vector<Reduce> reduce1111 = {};
+std::vector<Shift> shift1112 = {};
+std::vector<Reduce> reduce1112 = {{nullptr, &rule648, false}};
+std::vector<Shift> shift1113 = {{&term803, &state1114}};
+std::vector<Reduce> reduce1113 = {};
+std::vector<Shift> shift1114 = {};
+std::vector<Reduce> reduce1114 = {{nullptr, &rule647, false}};
+std::vector<Shift> shift1115 = {{&term803, &state1116}};
+std::vector<Reduce> reduce1115 = {};
+std::vector<Shift> shift1116 = {};
+std::vector<Reduce> reduce1116 = {{nullptr, &rule646, false}};
+std::vector<Shift> shift1117 = {{&term803, &state1118}};
+std::vector<Reduce> reduce1117 = {};
+std::vector<Shift> shift1118 = {};
+std::vector<Reduce> reduce1118 = {{nullptr, &rule645, false}};
+std::vector<Shift> shift1119 = {{&term803, &state1120}};
+std::vector<Reduce> reduce1119 = {};
+std::vector<Shift> shift1120 = {};
+std::vector<Reduce> reduce1120 = {{nullptr, &rule644, false}};
+std::vector<Shift> shift1121 = {{&term803, &state1122}};
+std::vector<Reduce> reduce1121 = {};
+std::vector<Shift> shift1122 = {};
+std::vector<Reduce> reduce1122 = {{nullptr, &rule643, false}};
+std::vector<Shift> shift1123 = {{&term803, &state1124}};
+std::vector<Reduce> reduce1123 = {};
+std::vector<Shift> shift1124 = {};
+std::vector<Reduce> reduce1124 = {{nullptr, &rule642, false}};
+std::vector<Shift> shift1125 = {{&term803, &state1126}};
+std::vector<Reduce> reduce1125 = {};
+std::vector<Shift> shift1126 = {};
+std::vector<Reduce> reduce1126 = {{nullptr, &rule641, false}};
+std::vector<Shift> shift1127 = {{&term803, &state1128}};
+std::vector<Reduce> reduce1127 = {};
+std::vector<Shift> shift1128 = {};
+std::vector<Reduce> reduce1128 = {{nullptr, &rule640, false}};
+std::vector<Shift> shift1129 = {{&term803, &state1130}};
+std::vector<Reduce> reduce1129 = {};
+std::vector<Shift> shift1130 = {};
+std::vector<Reduce> reduce1130 = {{nullptr, &rule639, false}};
+std::vector<Shift> shift1131 = {{&term803, &state1132}};
+std::vector<Reduce> reduce1131 = {};
+std::vector<Shift> shift1132 = {};
+std::vector<Reduce> reduce1132 = {{nullptr, &rule638, false}};
+std::vector<Shift> shift1133 = {{&term803, &state1134}};
+std::vector<Reduce> reduce1133 = {};
+std::vector<Shift> shift1134 = {};
+std::vector<Reduce> reduce1134 = {{nullptr, &rule637, false}};
+std::vector<Shift> shift1135 = {{&term803, &state1136}};
+std::vector<Reduce> reduce1135 = {};
+std::vector<Shift> shift1136 = {};
+std::vector<Reduce> reduce1136 = {{nullptr, &rule636, false}};
+std::vector<Shift> shift1137 = {{&term803, &state1138}};
+std::vector<Reduce> reduce1137 = {};
+std::vector<Shift> shift1138 = {};
+std::vector<Reduce> reduce1138 = {{nullptr, &rule635, false}};
+std::vector<Shift> shift1139 = {{&term803, &state1140}};
+std::vector<Reduce> reduce1139 = {};
+std::vector<Shift> shift1140 = {};
+std::vector<Reduce> reduce1140 = {{nullptr, &rule634, false}};
+std::vector<Shift> shift1141 = {{&term803, &state1142}};
+std::vector<Reduce> reduce1141 = {};
+std::vector<Shift> shift1142 = {};
+std::vector<Reduce> reduce1142 = {{nullptr, &rule633, false}};
+std::vector<Shift> shift1143 = {{&term803, &state1144}};
+std::vector<Reduce> reduce1143 = {};
+std::vector<Shift> shift1144 = {};
+std::vector<Reduce> reduce1144 = {{nullptr, &rule632, false}};
+std::vector<Shift> shift1145 = {{&term803, &state1146}};
+std::vector<Reduce> reduce1145 = {};
+std::vector<Shift> shift1146 = {};
+std::vector<Reduce> reduce1146 = {{nullptr, &rule631, false}};
+std::vector<Shift> shift1147 = {{&term803, &state1148}};
+std::vector<Reduce> reduce1147 = {};
+std::vector<Shift> shift1148 = {};
+std::vector<Reduce> reduce1148 = {{nullptr, &rule630, false}};
+std::vector<Shift> shift1149 = {{&term803, &state1150}};
+std::vector<Reduce> reduce1149 = {};
+std::vector<Shift> shift1150 = {};
+std::vector<Reduce> reduce1150 = {{nullptr, &rule629, false}};
+std::vector<Shift> shift1151 = {{&term803, &state1152}};
+std::vector<Reduce> reduce1151 = {};
+std::vector<Shift> shift1152 = {};
+std::vector<Reduce> reduce1152 = {{nullptr, &rule628, false}};
+std::vector<Shift> shift1153 = {{&term803, &state1154}};
+std::vector<Reduce> reduce1153 = {};
+std::vector<Shift> shift1154 = {};
+std::vector<Reduce> reduce1154 = {{nullptr, &rule627, false}};
+std::vector<Shift> shift1155 = {{&term803, &state1156}};
+std::vector<Reduce> reduce1155 = {};
+std::vector<Shift> shift1156 = {};
+std::vector<Reduce> reduce1156 = {{nullptr, &rule626, false}};
+std::vector<Shift> shift1157 = {{&term803, &state1158}};
+std::vector<Reduce> reduce1157 = {};
+std::vector<Shift> shift1158 = {};
+std::vector<Reduce> reduce1158 = {{nullptr, &rule625, false}};
+std::vector<Shift> shift1159 = {{&term803, &state1160}};
+std::vector<Reduce> reduce1159 = {};
+std::vector<Shift> shift1160 = {};
+std::vector<Reduce> reduce1160 = {{nullptr, &rule624, false}};
+std::vector<Shift> shift1161 = {{&term803, &state1162}};
+std::vector<Reduce> reduce1161 = {};
+std::vector<Shift> shift1162 = {};
+std::vector<Reduce> reduce1162 = {{nullptr, &rule623, false}};
+std::vector<Shift> shift1163 = {{&term803, &state1164}};
+std::vector<Reduce> reduce1163 = {};
+std::vector<Shift> shift1164 = {};
+std::vector<Reduce> reduce1164 = {{nullptr, &rule622, false}};
+std::vector<Shift> shift1165 = {{&term803, &state1166}};
+std::vector<Reduce> reduce1165 = {};
+std::vector<Shift> shift1166 = {};
+std::vector<Reduce> reduce1166 = {{nullptr, &rule621, false}};
+std::vector<Shift> shift1167 = {{&term803, &state1168}};
+std::vector<Reduce> reduce1167 = {};
+std::vector<Shift> shift1168 = {};
+std::vector<Reduce> reduce1168 = {{nullptr, &rule620, false}};
+std::vector<Shift> shift1169 = {{&term803, &state1170}};
+std::vector<Reduce> reduce1169 = {};
+std::vector<Shift> shift1170 = {};
+std::vector<Reduce> reduce1170 = {{nullptr, &rule619, false}};
+std::vector<Shift> shift1171 = {{&term803, &state1172}};
+std::vector<Reduce> reduce1171 = {};
+std::vector<Shift> shift1172 = {};
+std::vector<Reduce> reduce1172 = {{nullptr, &rule618, false}};
+std::vector<Shift> shift1173 = {{&term803, &state1174}};
+std::vector<Reduce> reduce1173 = {};
+std::vector<Shift> shift1174 = {};
+std::vector<Reduce> reduce1174 = {{nullptr, &rule617, false}};
+std::vector<Shift> shift1175 = {{&term803, &state1176}};
+std::vector<Reduce> reduce1175 = {};
+std::vector<Shift> shift1176 = {};
+std::vector<Reduce> reduce1176 = {{nullptr, &rule616, false}};
+std::vector<Shift> shift1177 = {{&term803, &state1178}};
+std::vector<Reduce> reduce1177 = {};
+std::vector<Shift> shift1178 = {};
+std::vector<Reduce> reduce1178 = {{nullptr, &rule615, false}};
+std::vector<Shift> shift1179 = {{&term803, &state1180}};
+std::vector<Reduce> reduce1179 = {};
+std::vector<Shift> shift1180 = {};
+std::vector<Reduce> reduce1180 = {{nullptr, &rule614, false}};
+std::vector<Shift> shift1181 = {{&term803, &state1182}};
+std::vector<Reduce> reduce1181 = {};
+std::vector<Shift> shift1182 = {};
+std::vector<Reduce> reduce1182 = {{nullptr, &rule613, false}};
+std::vector<Shift> shift1183 = {{&term803, &state1184}};
+std::vector<Reduce> reduce1183 = {};
+std::vector<Shift> shift1184 = {};
+std::vector<Reduce> reduce1184 = {{nullptr, &rule612, false}};
+std::vector<Shift> shift1185 = {{&term803, &state1186}};
+std::vector<Reduce> reduce1185 = {};
+std::vector<Shift> shift1186 = {};
+std::vector<Reduce> reduce1186 = {{nullptr, &rule611, false}};
+std::vector<Shift> shift1187 = {{&term803, &state1188}};
+std::vector<Reduce> reduce1187 = {};
+std::vector<Shift> shift1188 = {};
+std::vector<Reduce> reduce1188 = {{nullptr, &rule610, false}};
+std::vector<Shift> shift1189 = {{&term803, &state1190}};
+std::vector<Reduce> reduce1189 = {};
+std::vector<Shift> shift1190 = {};
+std::vector<Reduce> reduce1190 = {{nullptr, &rule609, false}};
+std::vector<Shift> shift1191 = {{&term803, &state1192}};
+std::vector<Reduce> reduce1191 = {};
+std::vector<Shift> shift1192 = {};
+std::vector<Reduce> reduce1192 = {{nullptr, &rule608, false}};
+std::vector<Shift> shift1193 = {{&term803, &state1194}};
+std::vector<Reduce> reduce1193 = {};
+std::vector<Shift> shift1194 = {};
+std::vector<Reduce> reduce1194 = {{nullptr, &rule607, false}};
+std::vector<Shift> shift1195 = {{&term803, &state1196}};
+std::vector<Reduce> reduce1195 = {};
+std::vector<Shift> shift1196 = {};
+std::vector<Reduce> reduce1196 = {{nullptr, &rule606, false}};
+std::vector<Shift> shift1197 = {{&term803, &state1198}};
+std::vector<Reduce> reduce1197 = {};
+std::vector<Shift> shift1198 = {};
+std::vector<Reduce> reduce1198 = {{nullptr, &rule605, false}};
+std::vector<Shift> shift1199 = {{&term803, &state1200}};
+std::vector<Reduce> reduce1199 = {};
+std::vector<Shift> shift1200 = {};
+std::vector<Reduce> reduce1200 = {{nullptr, &rule604, false}};
+std::vector<Shift> shift1201 = {{&term803, &state1202}};
+std::vector<Reduce> reduce1201 = {};
+std::vector<Shift> shift1202 = {};
+std::vector<Reduce> reduce1202 = {{nullptr, &rule603, false}};
+std::vector<Shift> shift1203 = {{&term803, &state1204}};
+std::vector<Reduce> reduce1203 = {};
+std::vector<Shift> shift1204 = {};
+std::vector<Reduce> reduce1204 = {{nullptr, &rule602, false}};
+std::vector<Shift> shift1205 = {{&term803, &state1206}};
+std::vector<Reduce> reduce1205 = {};
+std::vector<Shift> shift1206 = {};
+std::vector<Reduce> reduce1206 = {{nullptr, &rule601, false}};
+std::vector<Shift> shift1207 = {{&term803, &state1208}};
+std::vector<Reduce> reduce1207 = {};
+std::vector<Shift> shift1208 = {};
+std::vector<Reduce> reduce1208 = {{nullptr, &rule600, false}};
+std::vector<Shift> shift1209 = {{&term803, &state1210}};
+std::vector<Reduce> reduce1209 = {};
+std::vector<Shift> shift1210 = {};
+std::vector<Reduce> reduce1210 = {{nullptr, &rule599, false}};
+std::vector<Shift> shift1211 = {{&term803, &state1212}};
+std::vector<Reduce> reduce1211 = {};
+std::vector<Shift> shift1212 = {};
+std::vector<Reduce> reduce1212 = {{nullptr, &rule598, false}};
+std::vector<Shift> shift1213 = {{&term803, &state1214}};
+std::vector<Reduce> reduce1213 = {};
+std::vector<Shift> shift1214 = {};
+std::vector<Reduce> reduce1214 = {{nullptr, &rule597, false}};
+std::vector<Shift> shift1215 = {{&term803, &state1216}};
+std::vector<Reduce> reduce1215 = {};
+std::vector<Shift> shift1216 = {};
+std::vector<Reduce> reduce1216 = {{nullptr, &rule596, false}};
+std::vector<Shift> shift1217 = {{&term803, &state1218}};
+std::vector<Reduce> reduce1217 = {};
+std::vector<Shift> shift1218 = {};
+std::vector<Reduce> reduce1218 = {{nullptr, &rule595, false}};
+std::vector<Shift> shift1219 = {{&term803, &state1220}};
+std::vector<Reduce> reduce1219 = {};
+std::vector<Shift> shift1220 = {};
+std::vector<Reduce> reduce1220 = {{nullptr, &rule594, false}};
+std::vector<Shift> shift1221 = {{&term803, &state1222}};
+std::vector<Reduce> reduce1221 = {};
+std::vector<Shift> shift1222 = {};
+std::vector<Reduce> reduce1222 = {{nullptr, &rule593, false}};
+std::vector<Shift> shift1223 = {{&term803, &state1224}};
+std::vector<Reduce> reduce1223 = {};
+std::vector<Shift> shift1224 = {};
+std::vector<Reduce> reduce1224 = {{nullptr, &rule592, false}};
+std::vector<Shift> shift1225 = {{&term803, &state1226}};
+std::vector<Reduce> reduce1225 = {};
+std::vector<Shift> shift1226 = {};
+std::vector<Reduce> reduce1226 = {{nullptr, &rule591, false}};
+std::vector<Shift> shift1227 = {{&term803, &state1228}};
+std::vector<Reduce> reduce1227 = {};
+std::vector<Shift> shift1228 = {};
+std::vector<Reduce> reduce1228 = {{nullptr, &rule590, false}};
+std::vector<Shift> shift1229 = {{&term803, &state1230}};
+std::vector<Reduce> reduce1229 = {};
+std::vector<Shift> shift1230 = {};
+std::vector<Reduce> reduce1230 = {{nullptr, &rule589, false}};
+std::vector<Shift> shift1231 = {{&term803, &state1232}};
+std::vector<Reduce> reduce1231 = {};
+std::vector<Shift> shift1232 = {};
+std::vector<Reduce> reduce1232 = {{nullptr, &rule588, false}};
+std::vector<Shift> shift1233 = {{&term803, &state1234}};
+std::vector<Reduce> reduce1233 = {};
+std::vector<Shift> shift1234 = {};
+std::vector<Reduce> reduce1234 = {{nullptr, &rule587, false}};
+std::vector<Shift> shift1235 = {{&term803, &state1236}};
+std::vector<Reduce> reduce1235 = {};
+std::vector<Shift> shift1236 = {};
+std::vector<Reduce> reduce1236 = {{nullptr, &rule586, false}};
+std::vector<Shift> shift1237 = {{&term803, &state1238}};
+std::vector<Reduce> reduce1237 = {};
+std::vector<Shift> shift1238 = {};
+std::vector<Reduce> reduce1238 = {{nullptr, &rule585, false}};
+std::vector<Shift> shift1239 = {{&term803, &state1240}};
+std::vector<Reduce> reduce1239 = {};
+std::vector<Shift> shift1240 = {};
+std::vector<Reduce> reduce1240 = {{nullptr, &rule584, false}};
+std::vector<Shift> shift1241 = {{&term803, &state1242}};
+std::vector<Reduce> reduce1241 = {};
+std::vector<Shift> shift1242 = {};
+std::vector<Reduce> reduce1242 = {{nullptr, &rule583, false}};
+std::vector<Shift> shift1243 = {{&term803, &state1244}};
+std::vector<Reduce> reduce1243 = {};
+std::vector<Shift> shift1244 = {};
+std::vector<Reduce> reduce1244 = {{nullptr, &rule582, false}};
+std::vector<Shift> shift1245 = {{&term803, &state1246}};
+std::vector<Reduce> reduce1245 = {};
+std::vector<Shift> shift1246 = {};
+std::vector<Reduce> reduce1246 = {{nullptr, &rule581, false}};
+std::vector<Shift> shift1247 = {{&term803, &state1248}};
+std::vector<Reduce> reduce1247 = {};
+std::vector<Shift> shift1248 = {};
+std::vector<Reduce> reduce1248 = {{nullptr, &rule580, false}};
+std::vector<Shift> shift1249 = {{&term803, &state1250}};
+std::vector<Reduce> reduce1249 = {};
+std::vector<Shift> shift1250 = {};
+std::vector<Reduce> reduce1250 = {{nullptr, &rule579, false}};
+std::vector<Shift> shift1251 = {{&term803, &state1252}};
+std::vector<Reduce> reduce1251 = {};
+std::vector<Shift> shift1252 = {};
+std::vector<Reduce> reduce1252 = {{nullptr, &rule578, false}};
+std::vector<Shift> shift1253 = {{&term803, &state1254}};
+std::vector<Reduce> reduce1253 = {};
+std::vector<Shift> shift1254 = {};
+std::vector<Reduce> reduce1254 = {{nullptr, &rule577, false}};
+std::vector<Shift> shift1255 = {{&term803, &state1256}};
+std::vector<Reduce> reduce1255 = {};
+std::vector<Shift> shift1256 = {};
+std::vector<Reduce> reduce1256 = {{nullptr, &rule576, false}};
+std::vector<Shift> shift1257 = {{&term803, &state1258}};
+std::vector<Reduce> reduce1257 = {};
+std::vector<Shift> shift1258 = {};
+std::vector<Reduce> reduce1258 = {{nullptr, &rule575, false}};
+std::vector<Shift> shift1259 = {{&term803, &state1260}};
+std::vector<Reduce> reduce1259 = {};
+std::vector<Shift> shift1260 = {};
+std::vector<Reduce> reduce1260 = {{nullptr, &rule574, false}};
+std::vector<Shift> shift1261 = {{&term803, &state1262}};
+std::vector<Reduce> reduce1261 = {};
+std::vector<Shift> shift1262 = {};
+std::vector<Reduce> reduce1262 = {{nullptr, &rule573, false}};
+std::vector<Shift> shift1263 = {{&term803, &state1264}};
+std::vector<Reduce> reduce1263 = {};
+std::vector<Shift> shift1264 = {};
+std::vector<Reduce> reduce1264 = {{nullptr, &rule572, false}};
+std::vector<Shift> shift1265 = {{&term803, &state1266}};
+std::vector<Reduce> reduce1265 = {};
+std::vector<Shift> shift1266 = {};
+std::vector<Reduce> reduce1266 = {{nullptr, &rule571, false}};
+std::vector<Shift> shift1267 = {{&term803, &state1268}};
+std::vector<Reduce> reduce1267 = {};
+std::vector<Shift> shift1268 = {};
+std::vector<Reduce> reduce1268 = {{nullptr, &rule570, false}};
+std::vector<Shift> shift1269 = {{&term803, &state1270}};
+std::vector<Reduce> reduce1269 = {};
+std::vector<Shift> shift1270 = {};
+std::vector<Reduce> reduce1270 = {{nullptr, &rule569, false}};
+std::vector<Shift> shift1271 = {{&term803, &state1272}};
+std::vector<Reduce> reduce1271 = {};
+std::vector<Shift> shift1272 = {};
+std::vector<Reduce> reduce1272 = {{nullptr, &rule568, false}};
+std::vector<Shift> shift1273 = {{&term803, &state1274}};
+std::vector<Reduce> reduce1273 = {};
+std::vector<Shift> shift1274 = {};
+std::vector<Reduce> reduce1274 = {{nullptr, &rule567, false}};
+std::vector<Shift> shift1275 = {{&term803, &state1276}};
+std::vector<Reduce> reduce1275 = {};
+std::vector<Shift> shift1276 = {};
+std::vector<Reduce> reduce1276 = {{nullptr, &rule566, false}};
+std::vector<Shift> shift1277 = {{&term803, &state1278}};
+std::vector<Reduce> reduce1277 = {};
+std::vector<Shift> shift1278 = {};
+std::vector<Reduce> reduce1278 = {{nullptr, &rule565, false}};
+std::vector<Shift> shift1279 = {{&term803, &state1280}};
+std::vector<Reduce> reduce1279 = {};
+std::vector<Shift> shift1280 = {};
+std::vector<Reduce> reduce1280 = {{nullptr, &rule564, false}};
+std::vector<Shift> shift1281 = {{&term803, &state1282}};
+std::vector<Reduce> reduce1281 = {};
+std::vector<Shift> shift1282 = {};
+std::vector<Reduce> reduce1282 = {{nullptr, &rule563, false}};
+std::vector<Shift> shift1283 = {{&term803, &state1284}};
+std::vector<Reduce> reduce1283 = {};
+std::vector<Shift> shift1284 = {};
+std::vector<Reduce> reduce1284 = {{nullptr, &rule562, false}};
+std::vector<Shift> shift1285 = {{&term803, &state1286}};
+std::vector<Reduce> reduce1285 = {};
+std::vector<Shift> shift1286 = {};
+std::vector<Reduce> reduce1286 = {{nullptr, &rule561, false}};
+std::vector<Shift> shift1287 = {{&term803, &state1288}};
+std::vector<Reduce> reduce1287 = {};
+std::vector<Shift> shift1288 = {};
+std::vector<Reduce> reduce1288 = {{nullptr, &rule560, false}};
+std::vector<Shift> shift1289 = {{&term803, &state1290}};
+std::vector<Reduce> reduce1289 = {};
+std::vector<Shift> shift1290 = {};
+std::vector<Reduce> reduce1290 = {{nullptr, &rule559, false}};
+std::vector<Shift> shift1291 = {{&term803, &state1292}};
+std::vector<Reduce> reduce1291 = {};
+std::vector<Shift> shift1292 = {};
+std::vector<Reduce> reduce1292 = {{nullptr, &rule558, false}};
+std::vector<Shift> shift1293 = {{&term803, &state1294}};
+std::vector<Reduce> reduce1293 = {};
+std::vector<Shift> shift1294 = {};
+std::vector<Reduce> reduce1294 = {{nullptr, &rule557, false}};
+std::vector<Shift> shift1295 = {{&term803, &state1296}};
+std::vector<Reduce> reduce1295 = {};
+std::vector<Shift> shift1296 = {};
+std::vector<Reduce> reduce1296 = {{nullptr, &rule556, false}};
+std::vector<Shift> shift1297 = {{&term803, &state1298}};
+std::vector<Reduce> reduce1297 = {};
+std::vector<Shift> shift1298 = {};
+std::vector<Reduce> reduce1298 = {{nullptr, &rule555, false}};
+std::vector<Shift> shift1299 = {{&term803, &state1300}};
+std::vector<Reduce> reduce1299 = {};
+std::vector<Shift> shift1300 = {};
+std::vector<Reduce> reduce1300 = {{nullptr, &rule554, false}};
+std::vector<Shift> shift1301 = {{&term803, &state1302}};
+std::vector<Reduce> reduce1301 = {};
+std::vector<Shift> shift1302 = {};
+std::vector<Reduce> reduce1302 = {{nullptr, &rule553, false}};
+std::vector<Shift> shift1303 = {{&term803, &state1304}};
+std::vector<Reduce> reduce1303 = {};
+std::vector<Shift> shift1304 = {};
+std::vector<Reduce> reduce1304 = {{nullptr, &rule552, false}};
+std::vector<Shift> shift1305 = {{&term803, &state1306}};
+std::vector<Reduce> reduce1305 = {};
+std::vector<Shift> shift1306 = {};
+std::vector<Reduce> reduce1306 = {{nullptr, &rule551, false}};
+std::vector<Shift> shift1307 = {{&term803, &state1308}};
+std::vector<Reduce> reduce1307 = {};
+std::vector<Shift> shift1308 = {};
+std::vector<Reduce> reduce1308 = {{nullptr, &rule550, false}};
+std::vector<Shift> shift1309 = {{&term803, &state1310}};
+std::vector<Reduce> reduce1309 = {};
+std::vector<Shift> shift1310 = {};
+std::vector<Reduce> reduce1310 = {{nullptr, &rule549, false}};
+std::vector<Shift> shift1311 = {{&term803, &state1312}};
+std::vector<Reduce> reduce1311 = {};
+std::vector<Shift> shift1312 = {};
+std::vector<Reduce> reduce1312 = {{nullptr, &rule548, false}};
+std::vector<Shift> shift1313 = {{&term803, &state1314}};
+std::vector<Reduce> reduce1313 = {};
+std::vector<Shift> shift1314 = {};
+std::vector<Reduce> reduce1314 = {{nullptr, &rule547, false}};
+std::vector<Shift> shift1315 = {{&term803, &state1316}};
+std::vector<Reduce> reduce1315 = {};
+std::vector<Shift> shift1316 = {};
+std::vector<Reduce> reduce1316 = {{nullptr, &rule546, false}};
+std::vector<Shift> shift1317 = {{&term803, &state1318}};
+std::vector<Reduce> reduce1317 = {};
+std::vector<Shift> shift1318 = {};
+std::vector<Reduce> reduce1318 = {{nullptr, &rule545, false}};
+std::vector<Shift> shift1319 = {{&term803, &state1320}};
+std::vector<Reduce> reduce1319 = {};
+std::vector<Shift> shift1320 = {};
+std::vector<Reduce> reduce1320 = {{nullptr, &rule544, false}};
+std::vector<Shift> shift1321 = {{&term803, &state1322}};
+std::vector<Reduce> reduce1321 = {};
+std::vector<Shift> shift1322 = {};
+std::vector<Reduce> reduce1322 = {{nullptr, &rule543, false}};
+std::vector<Shift> shift1323 = {{&term803, &state1324}};
+std::vector<Reduce> reduce1323 = {};
+std::vector<Shift> shift1324 = {};
+std::vector<Reduce> reduce1324 = {{nullptr, &rule542, false}};
+std::vector<Shift> shift1325 = {{&term803, &state1326}};
+std::vector<Reduce> reduce1325 = {};
+std::vector<Shift> shift1326 = {};
+std::vector<Reduce> reduce1326 = {{nullptr, &rule541, false}};
+std::vector<Shift> shift1327 = {{&term803, &state1328}};
+std::vector<Reduce> reduce1327 = {};
+std::vector<Shift> shift1328 = {};
+std::vector<Reduce> reduce1328 = {{nullptr, &rule540, false}};
+std::vector<Shift> shift1329 = {{&term803, &state1330}};
+std::vector<Reduce> reduce1329 = {};
+std::vector<Shift> shift1330 = {};
+std::vector<Reduce> reduce1330 = {{nullptr, &rule539, false}};
+std::vector<Shift> shift1331 = {{&term803, &state1332}};
+std::vector<Reduce> reduce1331 = {};
+std::vector<Shift> shift1332 = {};
+std::vector<Reduce> reduce1332 = {{nullptr, &rule538, false}};
+std::vector<Shift> shift1333 = {{&term803, &state1334}};
+std::vector<Reduce> reduce1333 = {};
+std::vector<Shift> shift1334 = {};
+std::vector<Reduce> reduce1334 = {{nullptr, &rule537, false}};
+std::vector<Shift> shift1335 = {{&term803, &state1336}};
+std::vector<Reduce> reduce1335 = {};
+std::vector<Shift> shift1336 = {};
+std::vector<Reduce> reduce1336 = {{nullptr, &rule536, false}};
+std::vector<Shift> shift1337 = {{&term803, &state1338}};
+std::vector<Reduce> reduce1337 = {};
+std::vector<Shift> shift1338 = {};
+std::vector<Reduce> reduce1338 = {{nullptr, &rule535, false}};
+std::vector<Shift> shift1339 = {{&term803, &state1340}};
+std::vector<Reduce> reduce1339 = {};
+std::vector<Shift> shift1340 = {};
+std::vector<Reduce> reduce1340 = {{nullptr, &rule534, false}};
+std::vector<Shift> shift1341 = {{&term803, &state1342}};
+std::vector<Reduce> reduce1341 = {};
+std::vector<Shift> shift1342 = {};
+std::vector<Reduce> reduce1342 = {{nullptr, &rule533, false}};
+std::vector<Shift> shift1343 = {{&term803, &state1344}};
+std::vector<Reduce> reduce1343 = {};
+std::vector<Shift> shift1344 = {};
+std::vector<Reduce> reduce1344 = {{nullptr, &rule532, false}};
+std::vector<Shift> shift1345 = {{&term803, &state1346}};
+std::vector<Reduce> reduce1345 = {};
+std::vector<Shift> shift1346 = {};
+std::vector<Reduce> reduce1346 = {{nullptr, &rule531, false}};
+std::vector<Shift> shift1347 = {{&term803, &state1348}};
+std::vector<Reduce> reduce1347 = {};
+std::vector<Shift> shift1348 = {};
+std::vector<Reduce> reduce1348 = {{nullptr, &rule530, false}};
+std::vector<Shift> shift1349 = {{&term803, &state1350}};
+std::vector<Reduce> reduce1349 = {};
+std::vector<Shift> shift1350 = {};
+std::vector<Reduce> reduce1350 = {{nullptr, &rule529, false}};
+std::vector<Shift> shift1351 = {{&term803, &state1352}};
+std::vector<Reduce> reduce1351 = {};
+std::vector<Shift> shift1352 = {};
+std::vector<Reduce> reduce1352 = {{nullptr, &rule528, false}};
+std::vector<Shift> shift1353 = {{&term803, &state1354}};
+std::vector<Reduce> reduce1353 = {};
+std::vector<Shift> shift1354 = {};
+std::vector<Reduce> reduce1354 = {{nullptr, &rule527, false}};
+std::vector<Shift> shift1355 = {{&term803, &state1356}};
+std::vector<Reduce> reduce1355 = {};
+std::vector<Shift> shift1356 = {};
+std::vector<Reduce> reduce1356 = {{nullptr, &rule526, false}};
+std::vector<Shift> shift1357 = {{&term803, &state1358}};
+std::vector<Reduce> reduce1357 = {};
+std::vector<Shift> shift1358 = {};
+std::vector<Reduce> reduce1358 = {{nullptr, &rule525, false}};
+std::vector<Shift> shift1359 = {{&term803, &state1360}};
+std::vector<Reduce> reduce1359 = {};
+std::vector<Shift> shift1360 = {};
+std::vector<Reduce> reduce1360 = {{nullptr, &rule524, false}};
+std::vector<Shift> shift1361 = {{&term803, &state1362}};
+std::vector<Reduce> reduce1361 = {};
+std::vector<Shift> shift1362 = {};
+std::vector<Reduce> reduce1362 = {{nullptr, &rule523, false}};
+std::vector<Shift> shift1363 = {{&term803, &state1364}};
+std::vector<Reduce> reduce1363 = {};
+std::vector<Shift> shift1364 = {};
+std::vector<Reduce> reduce1364 = {{nullptr, &rule522, false}};
+std::vector<Shift> shift1365 = {{&term803, &state1366}};
+std::vector<Reduce> reduce1365 = {};
+std::vector<Shift> shift1366 = {};
+std::vector<Reduce> reduce1366 = {{nullptr, &rule521, false}};
+std::vector<Shift> shift1367 = {{&term803, &state1368}};
+std::vector<Reduce> reduce1367 = {};
+std::vector<Shift> shift1368 = {};
+std::vector<Reduce> reduce1368 = {{nullptr, &rule520, false}};
+std::vector<Shift> shift1369 = {{&term803, &state1370}};
+std::vector<Reduce> reduce1369 = {};
+std::vector<Shift> shift1370 = {};
+std::vector<Reduce> reduce1370 = {{nullptr, &rule519, false}};
+std::vector<Shift> shift1371 = {{&term803, &state1372}};
+std::vector<Reduce> reduce1371 = {};
+std::vector<Shift> shift1372 = {};
+std::vector<Reduce> reduce1372 = {{nullptr, &rule518, false}};
+std::vector<Shift> shift1373 = {{&term803, &state1374}};
+std::vector<Reduce> reduce1373 = {};
+std::vector<Shift> shift1374 = {};
+std::vector<Reduce> reduce1374 = {{nullptr, &rule517, false}};
+std::vector<Shift> shift1375 = {{&term803, &state1376}};
+std::vector<Reduce> reduce1375 = {};
+std::vector<Shift> shift1376 = {};
+std::vector<Reduce> reduce1376 = {{nullptr, &rule516, false}};
+std::vector<Shift> shift1377 = {{&term803, &state1378}};
+std::vector<Reduce> reduce1377 = {};
+std::vector<Shift> shift1378 = {};
+std::vector<Reduce> reduce1378 = {{nullptr, &rule515, false}};
+std::vector<Shift> shift1379 = {{&term803, &state1380}};
+std::vector<Reduce> reduce1379 = {};
+std::vector<Shift> shift1380 = {};
+std::vector<Reduce> reduce1380 = {{nullptr, &rule514, false}};
+std::vector<Shift> shift1381 = {{&term803, &state1382}};
+std::vector<Reduce> reduce1381 = {};
+std::vector<Shift> shift1382 = {};
+std::vector<Reduce> reduce1382 = {{nullptr, &rule513, false}};
+std::vector<Shift> shift1383 = {{&term803, &state1384}};
+std::vector<Reduce> reduce1383 = {};
+std::vector<Shift> shift1384 = {};
+std::vector<Reduce> reduce1384 = {{nullptr, &rule512, false}};
+std::vector<Shift> shift1385 = {{&term803, &state1386}};
+std::vector<Reduce> reduce1385 = {};
+std::vector<Shift> shift1386 = {};
+std::vector<Reduce> reduce1386 = {{nullptr, &rule511, false}};
+std::vector<Shift> shift1387 = {{&term803, &state1388}};
+std::vector<Reduce> reduce1387 = {};
+std::vector<Shift> shift1388 = {};
+std::vector<Reduce> reduce1388 = {{nullptr, &rule510, false}};
+std::vector<Shift> shift1389 = {{&term803, &state1390}};
+std::vector<Reduce> reduce1389 = {};
+std::vector<Shift> shift1390 = {};
+std::vector<Reduce> reduce1390 = {{nullptr, &rule509, false}};
+std::vector<Shift> shift1391 = {{&term803, &state1392}};
+std::vector<Reduce> reduce1391 = {};
+std::vector<Shift> shift1392 = {};
+std::vector<Reduce> reduce1392 = {{nullptr, &rule508, false}};
+std::vector<Shift> shift1393 = {{&term803, &state1394}};
+std::vector<Reduce> reduce1393 = {};
+std::vector<Shift> shift1394 = {};
+std::vector<Reduce> reduce1394 = {{nullptr, &rule507, false}};
+std::vector<Shift> shift1395 = {{&term803, &state1396}};
+std::vector<Reduce> reduce1395 = {};
+std::vector<Shift> shift1396 = {};
+std::vector<Reduce> reduce1396 = {{nullptr, &rule506, false}};
+std::vector<Shift> shift1397 = {{&term803, &state1398}};
+std::vector<Reduce> reduce1397 = {};
+std::vector<Shift> shift1398 = {};
+std::vector<Reduce> reduce1398 = {{nullptr, &rule505, false}};
+std::vector<Shift> shift1399 = {{&term803, &state1400}};
+std::vector<Reduce> reduce1399 = {};
+std::vector<Shift> shift1400 = {};
+std::vector<Reduce> reduce1400 = {{nullptr, &rule504, false}};
+std::vector<Shift> shift1401 = {{&term803, &state1402}};
+std::vector<Reduce> reduce1401 = {};
+std::vector<Shift> shift1402 = {};
+std::vector<Reduce> reduce1402 = {{nullptr, &rule503, false}};
+std::vector<Shift> shift1403 = {{&term803, &state1404}};
+std::vector<Reduce> reduce1403 = {};
+std::vector<Shift> shift1404 = {};
+std::vector<Reduce> reduce1404 = {{nullptr, &rule502, false}};
+std::vector<Shift> shift1405 = {{&term803, &state1406}};
+std::vector<Reduce> reduce1405 = {};
+std::vector<Shift> shift1406 = {};
+std::vector<Reduce> reduce1406 = {{nullptr, &rule501, false}};
+std::vector<Shift> shift1407 = {{&term803, &state1408}};
+std::vector<Reduce> reduce1407 = {};
+std::vector<Shift> shift1408 = {};
+std::vector<Reduce> reduce1408 = {{nullptr, &rule500, false}};
+std::vector<Shift> shift1409 = {{&term803, &state1410}};
+std::vector<Reduce> reduce1409 = {};
+std::vector<Shift> shift1410 = {};
+std::vector<Reduce> reduce1410 = {{nullptr, &rule499, false}};
+std::vector<Shift> shift1411 = {{&term803, &state1412}};
+std::vector<Reduce> reduce1411 = {};
+std::vector<Shift> shift1412 = {};
+std::vector<Reduce> reduce1412 = {{nullptr, &rule498, false}};
+std::vector<Shift> shift1413 = {{&term803, &state1414}};
+std::vector<Reduce> reduce1413 = {};
+std::vector<Shift> shift1414 = {};
+std::vector<Reduce> reduce1414 = {{nullptr, &rule497, false}};
+std::vector<Shift> shift1415 = {{&term803, &state1416}};
+std::vector<Reduce> reduce1415 = {};
+std::vector<Shift> shift1416 = {};
+std::vector<Reduce> reduce1416 = {{nullptr, &rule496, false}};
+std::vector<Shift> shift1417 = {{&term803, &state1418}};
+std::vector<Reduce> reduce1417 = {};
+std::vector<Shift> shift1418 = {};
+std::vector<Reduce> reduce1418 = {{nullptr, &rule495, false}};
+std::vector<Shift> shift1419 = {{&term803, &state1420}};
+std::vector<Reduce> reduce1419 = {};
+std::vector<Shift> shift1420 = {};
+std::vector<Reduce> reduce1420 = {{nullptr, &rule494, false}};
+std::vector<Shift> shift1421 = {{&term803, &state1422}};
+std::vector<Reduce> reduce1421 = {};
+std::vector<Shift> shift1422 = {};
+std::vector<Reduce> reduce1422 = {{nullptr, &rule493, false}};
+std::vector<Shift> shift1423 = {{&term803, &state1424}};
+std::vector<Reduce> reduce1423 = {};
+std::vector<Shift> shift1424 = {};
+std::vector<Reduce> reduce1424 = {{nullptr, &rule492, false}};
+std::vector<Shift> shift1425 = {{&term803, &state1426}};
+std::vector<Reduce> reduce1425 = {};
+std::vector<Shift> shift1426 = {};
+std::vector<Reduce> reduce1426 = {{nullptr, &rule491, false}};
+std::vector<Shift> shift1427 = {{&term803, &state1428}};
+std::vector<Reduce> reduce1427 = {};
+std::vector<Shift> shift1428 = {};
+std::vector<Reduce> reduce1428 = {{nullptr, &rule490, false}};
+std::vector<Shift> shift1429 = {{&term803, &state1430}};
+std::vector<Reduce> reduce1429 = {};
+std::vector<Shift> shift1430 = {};
+std::vector<Reduce> reduce1430 = {{nullptr, &rule489, false}};
+std::vector<Shift> shift1431 = {{&term803, &state1432}};
+std::vector<Reduce> reduce1431 = {};
+std::vector<Shift> shift1432 = {};
+std::vector<Reduce> reduce1432 = {{nullptr, &rule488, false}};
+std::vector<Shift> shift1433 = {{&term803, &state1434}};
+std::vector<Reduce> reduce1433 = {};
+std::vector<Shift> shift1434 = {};
+std::vector<Reduce> reduce1434 = {{nullptr, &rule487, false}};
+std::vector<Shift> shift1435 = {{&term803, &state1436}};
+std::vector<Reduce> reduce1435 = {};
+std::vector<Shift> shift1436 = {};
+std::vector<Reduce> reduce1436 = {{nullptr, &rule486, false}};
+std::vector<Shift> shift1437 = {{&term803, &state1438}};
+std::vector<Reduce> reduce1437 = {};
+std::vector<Shift> shift1438 = {};
+std::vector<Reduce> reduce1438 = {{nullptr, &rule485, false}};
+std::vector<Shift> shift1439 = {{&term803, &state1440}};
+std::vector<Reduce> reduce1439 = {};
+std::vector<Shift> shift1440 = {};
+std::vector<Reduce> reduce1440 = {{nullptr, &rule484, false}};
+std::vector<Shift> shift1441 = {{&term803, &state1442}};
+std::vector<Reduce> reduce1441 = {};
+std::vector<Shift> shift1442 = {};
+std::vector<Reduce> reduce1442 = {{nullptr, &rule483, false}};
+std::vector<Shift> shift1443 = {{&term803, &state1444}};
+std::vector<Reduce> reduce1443 = {};
+std::vector<Shift> shift1444 = {};
+std::vector<Reduce> reduce1444 = {{nullptr, &rule482, false}};
+std::vector<Shift> shift1445 = {{&term803, &state1446}};
+std::vector<Reduce> reduce1445 = {};
+std::vector<Shift> shift1446 = {};
+std::vector<Reduce> reduce1446 = {{nullptr, &rule481, false}};
+std::vector<Shift> shift1447 = {{&term803, &state1448}};
+std::vector<Reduce> reduce1447 = {};
+std::vector<Shift> shift1448 = {};
+std::vector<Reduce> reduce1448 = {{nullptr, &rule480, false}};
+std::vector<Shift> shift1449 = {{&term803, &state1450}};
+std::vector<Reduce> reduce1449 = {};
+std::vector<Shift> shift1450 = {};
+std::vector<Reduce> reduce1450 = {{nullptr, &rule479, false}};
+std::vector<Shift> shift1451 = {{&term803, &state1452}};
+std::vector<Reduce> reduce1451 = {};
+std::vector<Shift> shift1452 = {};
+std::vector<Reduce> reduce1452 = {{nullptr, &rule478, false}};
+std::vector<Shift> shift1453 = {{&term803, &state1454}};
+std::vector<Reduce> reduce1453 = {};
+std::vector<Shift> shift1454 = {};
+std::vector<Reduce> reduce1454 = {{nullptr, &rule477, false}};
+std::vector<Shift> shift1455 = {{&term803, &state1456}};
+std::vector<Reduce> reduce1455 = {};
+std::vector<Shift> shift1456 = {};
+std::vector<Reduce> reduce1456 = {{nullptr, &rule476, false}};
+std::vector<Shift> shift1457 = {{&term803, &state1458}};
+std::vector<Reduce> reduce1457 = {};
+std::vector<Shift> shift1458 = {};
+std::vector<Reduce> reduce1458 = {{nullptr, &rule475, false}};
+std::vector<Shift> shift1459 = {{&term803, &state1460}};
+std::vector<Reduce> reduce1459 = {};
+std::vector<Shift> shift1460 = {};
+std::vector<Reduce> reduce1460 = {{nullptr, &rule474, false}};
+std::vector<Shift> shift1461 = {{&term803, &state1462}};
+std::vector<Reduce> reduce1461 = {};
+std::vector<Shift> shift1462 = {};
+std::vector<Reduce> reduce1462 = {{nullptr, &rule473, false}};
+std::vector<Shift> shift1463 = {{&term803, &state1464}};
+std::vector<Reduce> reduce1463 = {};
+std::vector<Shift> shift1464 = {};
+std::vector<Reduce> reduce1464 = {{nullptr, &rule472, false}};
+std::vector<Shift> shift1465 = {{&term803, &state1466}};
+std::vector<Reduce> reduce1465 = {};
+std::vector<Shift> shift1466 = {};
+std::vector<Reduce> reduce1466 = {{nullptr, &rule471, false}};
+std::vector<Shift> shift1467 = {{&term803, &state1468}};
+std::vector<Reduce> reduce1467 = {};
+std::vector<Shift> shift1468 = {};
+std::vector<Reduce> reduce1468 = {{nullptr, &rule470, false}};
+std::vector<Shift> shift1469 = {{&term803, &state1470}};
+std::vector<Reduce> reduce1469 = {};
+std::vector<Shift> shift1470 = {};
+std::vector<Reduce> reduce1470 = {{nullptr, &rule469, false}};
+std::vector<Shift> shift1471 = {{&term803, &state1472}};
+std::vector<Reduce> reduce1471 = {};
+std::vector<Shift> shift1472 = {};
+std::vector<Reduce> reduce1472 = {{nullptr, &rule468, false}};
+std::vector<Shift> shift1473 = {{&term803, &state1474}};
+std::vector<Reduce> reduce1473 = {};
+std::vector<Shift> shift1474 = {};
+std::vector<Reduce> reduce1474 = {{nullptr, &rule467, false}};
+std::vector<Shift> shift1475 = {{&term803, &state1476}};
+std::vector<Reduce> reduce1475 = {};
+std::vector<Shift> shift1476 = {};
+std::vector<Reduce> reduce1476 = {{nullptr, &rule466, false}};
+std::vector<Shift> shift1477 = {{&term803, &state1478}};
+std::vector<Reduce> reduce1477 = {};
+std::vector<Shift> shift1478 = {};
+std::vector<Reduce> reduce1478 = {{nullptr, &rule465, false}};
+std::vector<Shift> shift1479 = {{&term803, &state1480}};
+std::vector<Reduce> reduce1479 = {};
+std::vector<Shift> shift1480 = {};
+std::vector<Reduce> reduce1480 = {{nullptr, &rule464, false}};
+std::vector<Shift> shift1481 = {{&term803, &state1482}};
+std::vector<Reduce> reduce1481 = {};
+std::vector<Shift> shift1482 = {};
+std::vector<Reduce> reduce1482 = {{nullptr, &rule463, false}};
+std::vector<Shift> shift1483 = {{&term803, &state1484}};
+std::vector<Reduce> reduce1483 = {};
+std::vector<Shift> shift1484 = {};
+std::vector<Reduce> reduce1484 = {{nullptr, &rule462, false}};
+std::vector<Shift> shift1485 = {{&term803, &state1486}};
+std::vector<Reduce> reduce1485 = {};
+std::vector<Shift> shift1486 = {};
+std::vector<Reduce> reduce1486 = {{nullptr, &rule461, false}};
+std::vector<Shift> shift1487 = {{&term803, &state1488}};
+std::vector<Reduce> reduce1487 = {};
+std::vector<Shift> shift1488 = {};
+std::vector<Reduce> reduce1488 = {{nullptr, &rule460, false}};
+std::vector<Shift> shift1489 = {{&term803, &state1490}};
+std::vector<Reduce> reduce1489 = {};
+std::vector<Shift> shift1490 = {};
+std::vector<Reduce> reduce1490 = {{nullptr, &rule459, false}};
+std::vector<Shift> shift1491 = {{&term803, &state1492}};
+std::vector<Reduce> reduce1491 = {};
+std::vector<Shift> shift1492 = {};
+std::vector<Reduce> reduce1492 = {{nullptr, &rule458, false}};
+std::vector<Shift> shift1493 = {{&term803, &state1494}};
+std::vector<Reduce> reduce1493 = {};
+std::vector<Shift> shift1494 = {};
+std::vector<Reduce> reduce1494 = {{nullptr, &rule457, false}};
+std::vector<Shift> shift1495 = {{&term803, &state1496}};
+std::vector<Reduce> reduce1495 = {};
+std::vector<Shift> shift1496 = {};
+std::vector<Reduce> reduce1496 = {{nullptr, &rule456, false}};
+std::vector<Shift> shift1497 = {{&term803, &state1498}};
+std::vector<Reduce> reduce1497 = {};
+std::vector<Shift> shift1498 = {};
+std::vector<Reduce> reduce1498 = {{nullptr, &rule455, false}};
+std::vector<Shift> shift1499 = {{&term803, &state1500}};
+std::vector<Reduce> reduce1499 = {};
+std::vector<Shift> shift1500 = {};
+std::vector<Reduce> reduce1500 = {{nullptr, &rule454, false}};
+std::vector<Shift> shift1501 = {{&term803, &state1502}};
+std::vector<Reduce> reduce1501 = {};
+std::vector<Shift> shift1502 = {};
+std::vector<Reduce> reduce1502 = {{nullptr, &rule453, false}};
+std::vector<Shift> shift1503 = {{&term803, &state1504}};
+std::vector<Reduce> reduce1503 = {};
+std::vector<Shift> shift1504 = {};
+std::vector<Reduce> reduce1504 = {{nullptr, &rule452, false}};
+std::vector<Shift> shift1505 = {{&term803, &state1506}};
+std::vector<Reduce> reduce1505 = {};
+std::vector<Shift> shift1506 = {};
+std::vector<Reduce> reduce1506 = {{nullptr, &rule451, false}};
+std::vector<Shift> shift1507 = {{&term803, &state1508}};
+std::vector<Reduce> reduce1507 = {};
+std::vector<Shift> shift1508 = {};
+std::vector<Reduce> reduce1508 = {{nullptr, &rule450, false}};
+std::vector<Shift> shift1509 = {{&term803, &state1510}};
+std::vector<Reduce> reduce1509 = {};
+std::vector<Shift> shift1510 = {};
+std::vector<Reduce> reduce1510 = {{nullptr, &rule449, false}};
+std::vector<Shift> shift1511 = {{&term803, &state1512}};
+std::vector<Reduce> reduce1511 = {};
+std::vector<Shift> shift1512 = {};
+std::vector<Reduce> reduce1512 = {{nullptr, &rule448, false}};
+std::vector<Shift> shift1513 = {{&term803, &state1514}};
+std::vector<Reduce> reduce1513 = {};
+std::vector<Shift> shift1514 = {};
+std::vector<Reduce> reduce1514 = {{nullptr, &rule447, false}};
+std::vector<Shift> shift1515 = {{&term803, &state1516}};
+std::vector<Reduce> reduce1515 = {};
+std::vector<Shift> shift1516 = {};
+std::vector<Reduce> reduce1516 = {{nullptr, &rule446, false}};
+std::vector<Shift> shift1517 = {{&term803, &state1518}};
+std::vector<Reduce> reduce1517 = {};
+std::vector<Shift> shift1518 = {};
+std::vector<Reduce> reduce1518 = {{nullptr, &rule445, false}};
+std::vector<Shift> shift1519 = {{&term803, &state1520}};
+std::vector<Reduce> reduce1519 = {};
+std::vector<Shift> shift1520 = {};
+std::vector<Reduce> reduce1520 = {{nullptr, &rule444, false}};
+std::vector<Shift> shift1521 = {{&term803, &state1522}};
+std::vector<Reduce> reduce1521 = {};
+std::vector<Shift> shift1522 = {};
+std::vector<Reduce> reduce1522 = {{nullptr, &rule443, false}};
+std::vector<Shift> shift1523 = {{&term803, &state1524}};
+std::vector<Reduce> reduce1523 = {};
+std::vector<Shift> shift1524 = {};
+std::vector<Reduce> reduce1524 = {{nullptr, &rule442, false}};
+std::vector<Shift> shift1525 = {{&term803, &state1526}};
+std::vector<Reduce> reduce1525 = {};
+std::vector<Shift> shift1526 = {};
+std::vector<Reduce> reduce1526 = {{nullptr, &rule441, false}};
+std::vector<Shift> shift1527 = {{&term803, &state1528}};
+std::vector<Reduce> reduce1527 = {};
+std::vector<Shift> shift1528 = {};
+std::vector<Reduce> reduce1528 = {{nullptr, &rule440, false}};
+std::vector<Shift> shift1529 = {{&term803, &state1530}};
+std::vector<Reduce> reduce1529 = {};
+std::vector<Shift> shift1530 = {};
+std::vector<Reduce> reduce1530 = {{nullptr, &rule439, false}};
+std::vector<Shift> shift1531 = {{&term803, &state1532}};
+std::vector<Reduce> reduce1531 = {};
+std::vector<Shift> shift1532 = {};
+std::vector<Reduce> reduce1532 = {{nullptr, &rule438, false}};
+std::vector<Shift> shift1533 = {{&term803, &state1534}};
+std::vector<Reduce> reduce1533 = {};
+std::vector<Shift> shift1534 = {};
+std::vector<Reduce> reduce1534 = {{nullptr, &rule437, false}};
+std::vector<Shift> shift1535 = {{&term803, &state1536}};
+std::vector<Reduce> reduce1535 = {};
+std::vector<Shift> shift1536 = {};
+std::vector<Reduce> reduce1536 = {{nullptr, &rule436, false}};
+std::vector<Shift> shift1537 = {{&term803, &state1538}};
+std::vector<Reduce> reduce1537 = {};
+std::vector<Shift> shift1538 = {};
+std::vector<Reduce> reduce1538 = {{nullptr, &rule435, false}};
+std::vector<Shift> shift1539 = {{&term803, &state1540}};
+std::vector<Reduce> reduce1539 = {};
+std::vector<Shift> shift1540 = {};
+std::vector<Reduce> reduce1540 = {{nullptr, &rule434, false}};
+std::vector<Shift> shift1541 = {{&term803, &state1542}};
+std::vector<Reduce> reduce1541 = {};
+std::vector<Shift> shift1542 = {};
+std::vector<Reduce> reduce1542 = {{nullptr, &rule433, false}};
+std::vector<Shift> shift1543 = {{&term803, &state1544}};
+std::vector<Reduce> reduce1543 = {};
+std::vector<Shift> shift1544 = {};
+std::vector<Reduce> reduce1544 = {{nullptr, &rule432, false}};
+std::vector<Shift> shift1545 = {{&term803, &state1546}};
+std::vector<Reduce> reduce1545 = {};
+std::vector<Shift> shift1546 = {};
+std::vector<Reduce> reduce1546 = {{nullptr, &rule431, false}};
+std::vector<Shift> shift1547 = {{&term803, &state1548}};
+std::vector<Reduce> reduce1547 = {};
+std::vector<Shift> shift1548 = {};
+std::vector<Reduce> reduce1548 = {{nullptr, &rule430, false}};
+std::vector<Shift> shift1549 = {{&term803, &state1550}};
+std::vector<Reduce> reduce1549 = {};
+std::vector<Shift> shift1550 = {};
+std::vector<Reduce> reduce1550 = {{nullptr, &rule429, false}};
+std::vector<Shift> shift1551 = {{&term803, &state1552}};
+std::vector<Reduce> reduce1551 = {};
+std::vector<Shift> shift1552 = {};
+std::vector<Reduce> reduce1552 = {{nullptr, &rule428, false}};
+std::vector<Shift> shift1553 = {{&term803, &state1554}};
+std::vector<Reduce> reduce1553 = {};
+std::vector<Shift> shift1554 = {};
+std::vector<Reduce> reduce1554 = {{nullptr, &rule427, false}};
+std::vector<Shift> shift1555 = {{&term803, &state1556}};
+std::vector<Reduce> reduce1555 = {};
+std::vector<Shift> shift1556 = {};
+std::vector<Reduce> reduce1556 = {{nullptr, &rule426, false}};
+std::vector<Shift> shift1557 = {{&term803, &state1558}};
+std::vector<Reduce> reduce1557 = {};
+std::vector<Shift> shift1558 = {};
+std::vector<Reduce> reduce1558 = {{nullptr, &rule425, false}};
+std::vector<Shift> shift1559 = {{&term803, &state1560}};
+std::vector<Reduce> reduce1559 = {};
+std::vector<Shift> shift1560 = {};
+std::vector<Reduce> reduce1560 = {{nullptr, &rule424, false}};
+std::vector<Shift> shift1561 = {{&term803, &state1562}};
+std::vector<Reduce> reduce1561 = {};
+std::vector<Shift> shift1562 = {};
+std::vector<Reduce> reduce1562 = {{nullptr, &rule423, false}};
+std::vector<Shift> shift1563 = {{&term803, &state1564}};
+std::vector<Reduce> reduce1563 = {};
+std::vector<Shift> shift1564 = {};
+std::vector<Reduce> reduce1564 = {{nullptr, &rule422, false}};
+std::vector<Shift> shift1565 = {{&term803, &state1566}};
+std::vector<Reduce> reduce1565 = {};
+std::vector<Shift> shift1566 = {};
+std::vector<Reduce> reduce1566 = {{nullptr, &rule421, false}};
+std::vector<Shift> shift1567 = {{&term803, &state1568}};
+std::vector<Reduce> reduce1567 = {};
+std::vector<Shift> shift1568 = {};
+std::vector<Reduce> reduce1568 = {{nullptr, &rule420, false}};
+std::vector<Shift> shift1569 = {{&term803, &state1570}};
+std::vector<Reduce> reduce1569 = {};
+std::vector<Shift> shift1570 = {};
+std::vector<Reduce> reduce1570 = {{nullptr, &rule419, false}};
+std::vector<Shift> shift1571 = {{&term803, &state1572}};
+std::vector<Reduce> reduce1571 = {};
+std::vector<Shift> shift1572 = {};
+std::vector<Reduce> reduce1572 = {{nullptr, &rule418, false}};
+std::vector<Shift> shift1573 = {{&term803, &state1574}};
+std::vector<Reduce> reduce1573 = {};
+std::vector<Shift> shift1574 = {};
+std::vector<Reduce> reduce1574 = {{nullptr, &rule417, false}};
+std::vector<Shift> shift1575 = {{&term803, &state1576}};
+std::vector<Reduce> reduce1575 = {};
+std::vector<Shift> shift1576 = {};
+std::vector<Reduce> reduce1576 = {{nullptr, &rule416, false}};
+std::vector<Shift> shift1577 = {{&term803, &state1578}};
+std::vector<Reduce> reduce1577 = {};
+std::vector<Shift> shift1578 = {};
+std::vector<Reduce> reduce1578 = {{nullptr, &rule415, false}};
+std::vector<Shift> shift1579 = {{&term803, &state1580}};
+std::vector<Reduce> reduce1579 = {};
+std::vector<Shift> shift1580 = {};
+std::vector<Reduce> reduce1580 = {{nullptr, &rule414, false}};
+std::vector<Shift> shift1581 = {{&term803, &state1582}};
+std::vector<Reduce> reduce1581 = {};
+std::vector<Shift> shift1582 = {};
+std::vector<Reduce> reduce1582 = {{nullptr, &rule413, false}};
+std::vector<Shift> shift1583 = {{&term803, &state1584}};
+std::vector<Reduce> reduce1583 = {};
+std::vector<Shift> shift1584 = {};
+std::vector<Reduce> reduce1584 = {{nullptr, &rule412, false}};
+std::vector<Shift> shift1585 = {{&term803, &state1586}};
+std::vector<Reduce> reduce1585 = {};
+std::vector<Shift> shift1586 = {};
+std::vector<Reduce> reduce1586 = {{nullptr, &rule411, false}};
+std::vector<Shift> shift1587 = {{&term803, &state1588}};
+std::vector<Reduce> reduce1587 = {};
+std::vector<Shift> shift1588 = {};
+std::vector<Reduce> reduce1588 = {{nullptr, &rule410, false}};
+std::vector<Shift> shift1589 = {{&term803, &state1590}};
+std::vector<Reduce> reduce1589 = {};
+std::vector<Shift> shift1590 = {};
+std::vector<Reduce> reduce1590 = {{nullptr, &rule409, false}};
+std::vector<Shift> shift1591 = {{&term803, &state1592}};
+std::vector<Reduce> reduce1591 = {};
+std::vector<Shift> shift1592 = {};
+std::vector<Reduce> reduce1592 = {{nullptr, &rule408, false}};
+std::vector<Shift> shift1593 = {{&term803, &state1594}};
+std::vector<Reduce> reduce1593 = {};
+std::vector<Shift> shift1594 = {};
+std::vector<Reduce> reduce1594 = {{nullptr, &rule407, false}};
+std::vector<Shift> shift1595 = {{&term803, &state1596}};
+std::vector<Reduce> reduce1595 = {};
+std::vector<Shift> shift1596 = {};
+std::vector<Reduce> reduce1596 = {{nullptr, &rule406, false}};
+std::vector<Shift> shift1597 = {{&term803, &state1598}};
+std::vector<Reduce> reduce1597 = {};
+std::vector<Shift> shift1598 = {};
+std::vector<Reduce> reduce1598 = {{nullptr, &rule405, false}};
+std::vector<Shift> shift1599 = {{&term803, &state1600}};
+std::vector<Reduce> reduce1599 = {};
+std::vector<Shift> shift1600 = {};
+std::vector<Reduce> reduce1600 = {{nullptr, &rule404, false}};
+std::vector<Shift> shift1601 = {{&term803, &state1602}};
+std::vector<Reduce> reduce1601 = {};
+std::vector<Shift> shift1602 = {};
+std::vector<Reduce> reduce1602 = {{nullptr, &rule403, false}};
+std::vector<Shift> shift1603 = {{&term803, &state1604}};
+std::vector<Reduce> reduce1603 = {};
+std::vector<Shift> shift1604 = {};
+std::vector<Reduce> reduce1604 = {{nullptr, &rule402, false}};
+std::vector<Shift> shift1605 = {{&term803, &state1606}};
+std::vector<Reduce> reduce1605 = {};
+std::vector<Shift> shift1606 = {};
+std::vector<Reduce> reduce1606 = {{nullptr, &rule401, false}};
+std::vector<Shift> shift1607 = {{&term803, &state1608}};
+std::vector<Reduce> reduce1607 = {};
+std::vector<Shift> shift1608 = {};
+std::vector<Reduce> reduce1608 = {{nullptr, &rule400, false}};
+std::vector<Shift> shift1609 = {{&term803, &state1610}};
+std::vector<Reduce> reduce1609 = {};
+std::vector<Shift> shift1610 = {};
+std::vector<Reduce> reduce1610 = {{nullptr, &rule399, false}};
+std::vector<Shift> shift1611 = {{&term803, &state1612}};
+std::vector<Reduce> reduce1611 = {};
+std::vector<Shift> shift1612 = {};
+std::vector<Reduce> reduce1612 = {{nullptr, &rule398, false}};
+std::vector<Shift> shift1613 = {{&term803, &state1614}};
+std::vector<Reduce> reduce1613 = {};
+std::vector<Shift> shift1614 = {};
+std::vector<Reduce> reduce1614 = {{nullptr, &rule397, false}};
+std::vector<Shift> shift1615 = {{&term803, &state1616}};
+std::vector<Reduce> reduce1615 = {};
+std::vector<Shift> shift1616 = {};
+std::vector<Reduce> reduce1616 = {{nullptr, &rule396, false}};
+std::vector<Shift> shift1617 = {{&term803, &state1618}};
+std::vector<Reduce> reduce1617 = {};
+std::vector<Shift> shift1618 = {};
+std::vector<Reduce> reduce1618 = {{nullptr, &rule395, false}};
+std::vector<Shift> shift1619 = {{&term803, &state1620}};
+std::vector<Reduce> reduce1619 = {};
+std::vector<Shift> shift1620 = {};
+std::vector<Reduce> reduce1620 = {{nullptr, &rule394, false}};
+std::vector<Shift> shift1621 = {{&term803, &state1622}};
+std::vector<Reduce> reduce1621 = {};
+std::vector<Shift> shift1622 = {};
+std::vector<Reduce> reduce1622 = {{nullptr, &rule393, false}};
+std::vector<Shift> shift1623 = {{&term803, &state1624}};
+std::vector<Reduce> reduce1623 = {};
+std::vector<Shift> shift1624 = {};
+std::vector<Reduce> reduce1624 = {{nullptr, &rule392, false}};
+std::vector<Shift> shift1625 = {{&term803, &state1626}};
+std::vector<Reduce> reduce1625 = {};
+std::vector<Shift> shift1626 = {};
+std::vector<Reduce> reduce1626 = {{nullptr, &rule391, false}};
+std::vector<Shift> shift1627 = {{&term803, &state1628}};
+std::vector<Reduce> reduce1627 = {};
+std::vector<Shift> shift1628 = {};
+std::vector<Reduce> reduce1628 = {{nullptr, &rule390, false}};
+std::vector<Shift> shift1629 = {{&term803, &state1630}};
+std::vector<Reduce> reduce1629 = {};
+std::vector<Shift> shift1630 = {};
+std::vector<Reduce> reduce1630 = {{nullptr, &rule389, false}};
+std::vector<Shift> shift1631 = {{&term803, &state1632}};
+std::vector<Reduce> reduce1631 = {};
+std::vector<Shift> shift1632 = {};
+std::vector<Reduce> reduce1632 = {{nullptr, &rule388, false}};
+std::vector<Shift> shift1633 = {{&term803, &state1634}};
+std::vector<Reduce> reduce1633 = {};
+std::vector<Shift> shift1634 = {};
+std::vector<Reduce> reduce1634 = {{nullptr, &rule387, false}};
+std::vector<Shift> shift1635 = {{&term803, &state1636}};
+std::vector<Reduce> reduce1635 = {};
+std::vector<Shift> shift1636 = {};
+std::vector<Reduce> reduce1636 = {{nullptr, &rule386, false}};
+std::vector<Shift> shift1637 = {{&term803, &state1638}};
+std::vector<Reduce> reduce1637 = {};
+std::vector<Shift> shift1638 = {};
+std::vector<Reduce> reduce1638 = {{nullptr, &rule385, false}};
+std::vector<Shift> shift1639 = {{&term803, &state1640}};
+std::vector<Reduce> reduce1639 = {};
+std::vector<Shift> shift1640 = {};
+std::vector<Reduce> reduce1640 = {{nullptr, &rule384, false}};
+std::vector<Shift> shift1641 = {{&term803, &state1642}};
+std::vector<Reduce> reduce1641 = {};
+std::vector<Shift> shift1642 = {};
+std::vector<Reduce> reduce1642 = {{nullptr, &rule383, false}};
+std::vector<Shift> shift1643 = {{&term803, &state1644}};
+std::vector<Reduce> reduce1643 = {};
+std::vector<Shift> shift1644 = {};
+std::vector<Reduce> reduce1644 = {{nullptr, &rule382, false}};
+std::vector<Shift> shift1645 = {{&term803, &state1646}};
+std::vector<Reduce> reduce1645 = {};
+std::vector<Shift> shift1646 = {};
+std::vector<Reduce> reduce1646 = {{nullptr, &rule381, false}};
+std::vector<Shift> shift1647 = {{&term803, &state1648}};
+std::vector<Reduce> reduce1647 = {};
+std::vector<Shift> shift1648 = {};
+std::vector<Reduce> reduce1648 = {{nullptr, &rule380, false}};
+std::vector<Shift> shift1649 = {{&term803, &state1650}};
+std::vector<Reduce> reduce1649 = {};
+std::vector<Shift> shift1650 = {};
+std::vector<Reduce> reduce1650 = {{nullptr, &rule379, false}};
+std::vector<Shift> shift1651 = {{&term803, &state1652}};
+std::vector<Reduce> reduce1651 = {};
+std::vector<Shift> shift1652 = {};
+std::vector<Reduce> reduce1652 = {{nullptr, &rule378, false}};
+std::vector<Shift> shift1653 = {{&term803, &state1654}};
+std::vector<Reduce> reduce1653 = {};
+std::vector<Shift> shift1654 = {};
+std::vector<Reduce> reduce1654 = {{nullptr, &rule377, false}};
+std::vector<Shift> shift1655 = {{&term803, &state1656}};
+std::vector<Reduce> reduce1655 = {};
+std::vector<Shift> shift1656 = {};
+std::vector<Reduce> reduce1656 = {{nullptr, &rule376, false}};
+std::vector<Shift> shift1657 = {{&term803, &state1658}};
+std::vector<Reduce> reduce1657 = {};
+std::vector<Shift> shift1658 = {};
+std::vector<Reduce> reduce1658 = {{nullptr, &rule375, false}};
+std::vector<Shift> shift1659 = {{&term803, &state1660}};
+std::vector<Reduce> reduce1659 = {};
+std::vector<Shift> shift1660 = {};
+std::vector<Reduce> reduce1660 = {{nullptr, &rule374, false}};
+std::vector<Shift> shift1661 = {{&term803, &state1662}};
+std::vector<Reduce> reduce1661 = {};
+std::vector<Shift> shift1662 = {};
+std::vector<Reduce> reduce1662 = {{nullptr, &rule373, false}};
+std::vector<Shift> shift1663 = {{&term803, &state1664}};
+std::vector<Reduce> reduce1663 = {};
+std::vector<Shift> shift1664 = {};
+std::vector<Reduce> reduce1664 = {{nullptr, &rule372, false}};
+std::vector<Shift> shift1665 = {{&term803, &state1666}};
+std::vector<Reduce> reduce1665 = {};
+std::vector<Shift> shift1666 = {};
+std::vector<Reduce> reduce1666 = {{nullptr, &rule371, false}};
+std::vector<Shift> shift1667 = {{&term803, &state1668}};
+std::vector<Reduce> reduce1667 = {};
+std::vector<Shift> shift1668 = {};
+std::vector<Reduce> reduce1668 = {{nullptr, &rule370, false}};
+std::vector<Shift> shift1669 = {{&term803, &state1670}};
+std::vector<Reduce> reduce1669 = {};
+std::vector<Shift> shift1670 = {};
+std::vector<Reduce> reduce1670 = {{nullptr, &rule369, false}};
+std::vector<Shift> shift1671 = {{&term803, &state1672}};
+std::vector<Reduce> reduce1671 = {};
+std::vector<Shift> shift1672 = {};
+std::vector<Reduce> reduce1672 = {{nullptr, &rule368, false}};
+std::vector<Shift> shift1673 = {{&term803, &state1674}};
+std::vector<Reduce> reduce1673 = {};
+std::vector<Shift> shift1674 = {};
+std::vector<Reduce> reduce1674 = {{nullptr, &rule367, false}};
+std::vector<Shift> shift1675 = {{&term803, &state1676}};
+std::vector<Reduce> reduce1675 = {};
+std::vector<Shift> shift1676 = {};
+std::vector<Reduce> reduce1676 = {{nullptr, &rule366, false}};
+std::vector<Shift> shift1677 = {{&term803, &state1678}};
+std::vector<Reduce> reduce1677 = {};
+std::vector<Shift> shift1678 = {};
+std::vector<Reduce> reduce1678 = {{nullptr, &rule365, false}};
+std::vector<Shift> shift1679 = {{&term803, &state1680}};
+std::vector<Reduce> reduce1679 = {};
+std::vector<Shift> shift1680 = {};
+std::vector<Reduce> reduce1680 = {{nullptr, &rule364, false}};
+std::vector<Shift> shift1681 = {{&term803, &state1682}};
+std::vector<Reduce> reduce1681 = {};
+std::vector<Shift> shift1682 = {};
+std::vector<Reduce> reduce1682 = {{nullptr, &rule363, false}};
+std::vector<Shift> shift1683 = {{&term803, &state1684}};
+std::vector<Reduce> reduce1683 = {};
+std::vector<Shift> shift1684 = {};
+std::vector<Reduce> reduce1684 = {{nullptr, &rule362, false}};
+std::vector<Shift> shift1685 = {{&term803, &state1686}};
+std::vector<Reduce> reduce1685 = {};
+std::vector<Shift> shift1686 = {};
+std::vector<Reduce> reduce1686 = {{nullptr, &rule361, false}};
+std::vector<Shift> shift1687 = {{&term803, &state1688}};
+std::vector<Reduce> reduce1687 = {};
+std::vector<Shift> shift1688 = {};
+std::vector<Reduce> reduce1688 = {{nullptr, &rule360, false}};
+std::vector<Shift> shift1689 = {{&term803, &state1690}};
+std::vector<Reduce> reduce1689 = {};
+std::vector<Shift> shift1690 = {};
+std::vector<Reduce> reduce1690 = {{nullptr, &rule359, false}};
+std::vector<Shift> shift1691 = {{&term803, &state1692}};
+std::vector<Reduce> reduce1691 = {};
+std::vector<Shift> shift1692 = {};
+std::vector<Reduce> reduce1692 = {{nullptr, &rule358, false}};
+std::vector<Shift> shift1693 = {{&term803, &state1694}};
+std::vector<Reduce> reduce1693 = {};
+std::vector<Shift> shift1694 = {};
+std::vector<Reduce> reduce1694 = {{nullptr, &rule357, false}};
+std::vector<Shift> shift1695 = {{&term803, &state1696}};
+std::vector<Reduce> reduce1695 = {};
+std::vector<Shift> shift1696 = {};
+std::vector<Reduce> reduce1696 = {{nullptr, &rule356, false}};
+std::vector<Shift> shift1697 = {{&term803, &state1698}};
+std::vector<Reduce> reduce1697 = {};
+std::vector<Shift> shift1698 = {};
+std::vector<Reduce> reduce1698 = {{nullptr, &rule355, false}};
+std::vector<Shift> shift1699 = {{&term803, &state1700}};
+std::vector<Reduce> reduce1699 = {};
+std::vector<Shift> shift1700 = {};
+std::vector<Reduce> reduce1700 = {{nullptr, &rule354, false}};
+std::vector<Shift> shift1701 = {{&term803, &state1702}};
+std::vector<Reduce> reduce1701 = {};
+std::vector<Shift> shift1702 = {};
+std::vector<Reduce> reduce1702 = {{nullptr, &rule353, false}};
+std::vector<Shift> shift1703 = {{&term803, &state1704}};
+std::vector<Reduce> reduce1703 = {};
+std::vector<Shift> shift1704 = {};
+std::vector<Reduce> reduce1704 = {{nullptr, &rule352, false}};
+std::vector<Shift> shift1705 = {{&term803, &state1706}};
+std::vector<Reduce> reduce1705 = {};
+std::vector<Shift> shift1706 = {};
+std::vector<Reduce> reduce1706 = {{nullptr, &rule351, false}};
+std::vector<Shift> shift1707 = {{&term803, &state1708}};
+std::vector<Reduce> reduce1707 = {};
+std::vector<Shift> shift1708 = {};
+std::vector<Reduce> reduce1708 = {{nullptr, &rule350, false}};
+std::vector<Shift> shift1709 = {{&term803, &state1710}};
+std::vector<Reduce> reduce1709 = {};
+std::vector<Shift> shift1710 = {};
+std::vector<Reduce> reduce1710 = {{nullptr, &rule349, false}};
+std::vector<Shift> shift1711 = {{&term803, &state1712}};
+std::vector<Reduce> reduce1711 = {};
+std::vector<Shift> shift1712 = {};
+std::vector<Reduce> reduce1712 = {{nullptr, &rule348, false}};
+std::vector<Shift> shift1713 = {{&term803, &state1714}};
+std::vector<Reduce> reduce1713 = {};
+std::vector<Shift> shift1714 = {};
+std::vector<Reduce> reduce1714 = {{nullptr, &rule347, false}};
+std::vector<Shift> shift1715 = {{&term803, &state1716}};
+std::vector<Reduce> reduce1715 = {};
+std::vector<Shift> shift1716 = {};
+std::vector<Reduce> reduce1716 = {{nullptr, &rule346, false}};
+std::vector<Shift> shift1717 = {{&term803, &state1718}};
+std::vector<Reduce> reduce1717 = {};
+std::vector<Shift> shift1718 = {};
+std::vector<Reduce> reduce1718 = {{nullptr, &rule345, false}};
+std::vector<Shift> shift1719 = {{&term803, &state1720}};
+std::vector<Reduce> reduce1719 = {};
+std::vector<Shift> shift1720 = {};
+std::vector<Reduce> reduce1720 = {{nullptr, &rule344, false}};
+std::vector<Shift> shift1721 = {{&term803, &state1722}};
+std::vector<Reduce> reduce1721 = {};
+std::vector<Shift> shift1722 = {};
+std::vector<Reduce> reduce1722 = {{nullptr, &rule343, false}};
+std::vector<Shift> shift1723 = {{&term803, &state1724}};
+std::vector<Reduce> reduce1723 = {};
+std::vector<Shift> shift1724 = {};
+std::vector<Reduce> reduce1724 = {{nullptr, &rule342, false}};
+std::vector<Shift> shift1725 = {{&term803, &state1726}};
+std::vector<Reduce> reduce1725 = {};
+std::vector<Shift> shift1726 = {};
+std::vector<Reduce> reduce1726 = {{nullptr, &rule341, false}};
+std::vector<Shift> shift1727 = {{&term803, &state1728}};
+std::vector<Reduce> reduce1727 = {};
+std::vector<Shift> shift1728 = {};
+std::vector<Reduce> reduce1728 = {{nullptr, &rule340, false}};
+std::vector<Shift> shift1729 = {{&term803, &state1730}};
+std::vector<Reduce> reduce1729 = {};
+std::vector<Shift> shift1730 = {};
+std::vector<Reduce> reduce1730 = {{nullptr, &rule339, false}};
+std::vector<Shift> shift1731 = {{&term803, &state1732}};
+std::vector<Reduce> reduce1731 = {};
+std::vector<Shift> shift1732 = {};
+std::vector<Reduce> reduce1732 = {{nullptr, &rule338, false}};
+std::vector<Shift> shift1733 = {{&term803, &state1734}};
+std::vector<Reduce> reduce1733 = {};
+std::vector<Shift> shift1734 = {};
+std::vector<Reduce> reduce1734 = {{nullptr, &rule337, false}};
+std::vector<Shift> shift1735 = {{&term803, &state1736}};
+std::vector<Reduce> reduce1735 = {};
+std::vector<Shift> shift1736 = {};
+std::vector<Reduce> reduce1736 = {{nullptr, &rule336, false}};
+std::vector<Shift> shift1737 = {{&term803, &state1738}};
+std::vector<Reduce> reduce1737 = {};
+std::vector<Shift> shift1738 = {};
+std::vector<Reduce> reduce1738 = {{nullptr, &rule335, false}};
+std::vector<Shift> shift1739 = {{&term803, &state1740}};
+std::vector<Reduce> reduce1739 = {};
+std::vector<Shift> shift1740 = {};
+std::vector<Reduce> reduce1740 = {{nullptr, &rule334, false}};
+std::vector<Shift> shift1741 = {{&term803, &state1742}};
+std::vector<Reduce> reduce1741 = {};
+std::vector<Shift> shift1742 = {};
+std::vector<Reduce> reduce1742 = {{nullptr, &rule333, false}};
+std::vector<Shift> shift1743 = {{&term803, &state1744}};
+std::vector<Reduce> reduce1743 = {};
+std::vector<Shift> shift1744 = {};
+std::vector<Reduce> reduce1744 = {{nullptr, &rule332, false}};
+std::vector<Shift> shift1745 = {{&term803, &state1746}};
+std::vector<Reduce> reduce1745 = {};
+std::vector<Shift> shift1746 = {};
+std::vector<Reduce> reduce1746 = {{nullptr, &rule331, false}};
+std::vector<Shift> shift1747 = {{&term803, &state1748}};
+std::vector<Reduce> reduce1747 = {};
+std::vector<Shift> shift1748 = {};
+std::vector<Reduce> reduce1748 = {{nullptr, &rule330, false}};
+std::vector<Shift> shift1749 = {{&term803, &state1750}};
+std::vector<Reduce> reduce1749 = {};
+std::vector<Shift> shift1750 = {};
+std::vector<Reduce> reduce1750 = {{nullptr, &rule329, false}};
+std::vector<Shift> shift1751 = {{&term803, &state1752}};
+std::vector<Reduce> reduce1751 = {};
+std::vector<Shift> shift1752 = {};
+std::vector<Reduce> reduce1752 = {{nullptr, &rule328, false}};
+std::vector<Shift> shift1753 = {{&term803, &state1754}};
+std::vector<Reduce> reduce1753 = {};
+std::vector<Shift> shift1754 = {};
+std::vector<Reduce> reduce1754 = {{nullptr, &rule327, false}};
+std::vector<Shift> shift1755 = {{&term803, &state1756}};
+std::vector<Reduce> reduce1755 = {};
+std::vector<Shift> shift1756 = {};
+std::vector<Reduce> reduce1756 = {{nullptr, &rule326, false}};
+std::vector<Shift> shift1757 = {{&term803, &state1758}};
+std::vector<Reduce> reduce1757 = {};
+std::vector<Shift> shift1758 = {};
+std::vector<Reduce> reduce1758 = {{nullptr, &rule325, false}};
+std::vector<Shift> shift1759 = {{&term803, &state1760}};
+std::vector<Reduce> reduce1759 = {};
+std::vector<Shift> shift1760 = {};
+std::vector<Reduce> reduce1760 = {{nullptr, &rule324, false}};
+std::vector<Shift> shift1761 = {{&term803, &state1762}};
+std::vector<Reduce> reduce1761 = {};
+std::vector<Shift> shift1762 = {};
+std::vector<Reduce> reduce1762 = {{nullptr, &rule323, false}};
+std::vector<Shift> shift1763 = {{&term803, &state1764}};
+std::vector<Reduce> reduce1763 = {};
+std::vector<Shift> shift1764 = {};
+std::vector<Reduce> reduce1764 = {{nullptr, &rule322, false}};
+std::vector<Shift> shift1765 = {{&term803, &state1766}};
+std::vector<Reduce> reduce1765 = {};
+std::vector<Shift> shift1766 = {};
+std::vector<Reduce> reduce1766 = {{nullptr, &rule321, false}};
+std::vector<Shift> shift1767 = {{&term803, &state1768}};
+std::vector<Reduce> reduce1767 = {};
+std::vector<Shift> shift1768 = {};
+std::vector<Reduce> reduce1768 = {{nullptr, &rule320, false}};
+std::vector<Shift> shift1769 = {{&term803, &state1770}};
+std::vector<Reduce> reduce1769 = {};
+std::vector<Shift> shift1770 = {};
+std::vector<Reduce> reduce1770 = {{nullptr, &rule319, false}};
+std::vector<Shift> shift1771 = {{&term803, &state1772}};
+std::vector<Reduce> reduce1771 = {};
+std::vector<Shift> shift1772 = {};
+std::vector<Reduce> reduce1772 = {{nullptr, &rule318, false}};
+std::vector<Shift> shift1773 = {{&term803, &state1774}};
+std::vector<Reduce> reduce1773 = {};
+std::vector<Shift> shift1774 = {};
+std::vector<Reduce> reduce1774 = {{nullptr, &rule317, false}};
+std::vector<Shift> shift1775 = {{&term803, &state1776}};
+std::vector<Reduce> reduce1775 = {};
+std::vector<Shift> shift1776 = {};
+std::vector<Reduce> reduce1776 = {{nullptr, &rule316, false}};
+std::vector<Shift> shift1777 = {{&term803, &state1778}};
+std::vector<Reduce> reduce1777 = {};
+std::vector<Shift> shift1778 = {};
+std::vector<Reduce> reduce1778 = {{nullptr, &rule315, false}};
+std::vector<Shift> shift1779 = {{&term803, &state1780}};
+std::vector<Reduce> reduce1779 = {};
+std::vector<Shift> shift1780 = {};
+std::vector<Reduce> reduce1780 = {{nullptr, &rule314, false}};
+std::vector<Shift> shift1781 = {{&term803, &state1782}};
+std::vector<Reduce> reduce1781 = {};
+std::vector<Shift> shift1782 = {};
+std::vector<Reduce> reduce1782 = {{nullptr, &rule313, false}};
+std::vector<Shift> shift1783 = {{&term803, &state1784}};
+std::vector<Reduce> reduce1783 = {};
+std::vector<Shift> shift1784 = {};
+std::vector<Reduce> reduce1784 = {{nullptr, &rule312, false}};
+std::vector<Shift> shift1785 = {{&term803, &state1786}};
+std::vector<Reduce> reduce1785 = {};
+std::vector<Shift> shift1786 = {};
+std::vector<Reduce> reduce1786 = {{nullptr, &rule311, false}};
+std::vector<Shift> shift1787 = {{&term803, &state1788}};
+std::vector<Reduce> reduce1787 = {};
+std::vector<Shift> shift1788 = {};
+std::vector<Reduce> reduce1788 = {{nullptr, &rule310, false}};
+std::vector<Shift> shift1789 = {{&term803, &state1790}};
+std::vector<Reduce> reduce1789 = {};
+std::vector<Shift> shift1790 = {};
+std::vector<Reduce> reduce1790 = {{nullptr, &rule309, false}};
+std::vector<Shift> shift1791 = {{&term803, &state1792}};
+std::vector<Reduce> reduce1791 = {};
+std::vector<Shift> shift1792 = {};
+std::vector<Reduce> reduce1792 = {{nullptr, &rule308, false}};
+std::vector<Shift> shift1793 = {{&term803, &state1794}};
+std::vector<Reduce> reduce1793 = {};
+std::vector<Shift> shift1794 = {};
+std::vector<Reduce> reduce1794 = {{nullptr, &rule307, false}};
+std::vector<Shift> shift1795 = {{&term803, &state1796}};
+std::vector<Reduce> reduce1795 = {};
+std::vector<Shift> shift1796 = {};
+std::vector<Reduce> reduce1796 = {{nullptr, &rule306, false}};
+std::vector<Shift> shift1797 = {{&term803, &state1798}};
+std::vector<Reduce> reduce1797 = {};
+std::vector<Shift> shift1798 = {};
+std::vector<Reduce> reduce1798 = {{nullptr, &rule305, false}};
+std::vector<Shift> shift1799 = {{&term803, &state1800}};
+std::vector<Reduce> reduce1799 = {};
+std::vector<Shift> shift1800 = {};
+std::vector<Reduce> reduce1800 = {{nullptr, &rule304, false}};
+std::vector<Shift> shift1801 = {{&term803, &state1802}};
+std::vector<Reduce> reduce1801 = {};
+std::vector<Shift> shift1802 = {};
+std::vector<Reduce> reduce1802 = {{nullptr, &rule303, false}};
+std::vector<Shift> shift1803 = {{&term803, &state1804}};
+std::vector<Reduce> reduce1803 = {};
+std::vector<Shift> shift1804 = {};
+std::vector<Reduce> reduce1804 = {{nullptr, &rule302, false}};
+std::vector<Shift> shift1805 = {{&term803, &state1806}};
+std::vector<Reduce> reduce1805 = {};
+std::vector<Shift> shift1806 = {};
+std::vector<Reduce> reduce1806 = {{nullptr, &rule301, false}};
+std::vector<Shift> shift1807 = {{&term803, &state1808}};
+std::vector<Reduce> reduce1807 = {};
+std::vector<Shift> shift1808 = {};
+std::vector<Reduce> reduce1808 = {{nullptr, &rule300, false}};
+std::vector<Shift> shift1809 = {{&term803, &state1810}};
+std::vector<Reduce> reduce1809 = {};
+std::vector<Shift> shift1810 = {};
+std::vector<Reduce> reduce1810 = {{nullptr, &rule299, false}};
+std::vector<Shift> shift1811 = {{&term803, &state1812}};
+std::vector<Reduce> reduce1811 = {};
+std::vector<Shift> shift1812 = {};
+std::vector<Reduce> reduce1812 = {{nullptr, &rule298, false}};
+std::vector<Shift> shift1813 = {{&term803, &state1814}};
+std::vector<Reduce> reduce1813 = {};
+std::vector<Shift> shift1814 = {};
+std::vector<Reduce> reduce1814 = {{nullptr, &rule297, false}};
+std::vector<Shift> shift1815 = {{&term803, &state1816}};
+std::vector<Reduce> reduce1815 = {};
+std::vector<Shift> shift1816 = {};
+std::vector<Reduce> reduce1816 = {{nullptr, &rule296, false}};
+std::vector<Shift> shift1817 = {{&term803, &state1818}};
+std::vector<Reduce> reduce1817 = {};
+std::vector<Shift> shift1818 = {};
+std::vector<Reduce> reduce1818 = {{nullptr, &rule295, false}};
+std::vector<Shift> shift1819 = {{&term803, &state1820}};
+std::vector<Reduce> reduce1819 = {};
+std::vector<Shift> shift1820 = {};
+std::vector<Reduce> reduce1820 = {{nullptr, &rule294, false}};
+std::vector<Shift> shift1821 = {{&term803, &state1822}};
+std::vector<Reduce> reduce1821 = {};
+std::vector<Shift> shift1822 = {};
+std::vector<Reduce> reduce1822 = {{nullptr, &rule293, false}};
+std::vector<Shift> shift1823 = {{&term803, &state1824}};
+std::vector<Reduce> reduce1823 = {};
+std::vector<Shift> shift1824 = {};
+std::vector<Reduce> reduce1824 = {{nullptr, &rule292, false}};
+std::vector<Shift> shift1825 = {{&term803, &state1826}};
+std::vector<Reduce> reduce1825 = {};
+std::vector<Shift> shift1826 = {};
+std::vector<Reduce> reduce1826 = {{nullptr, &rule291, false}};
+std::vector<Shift> shift1827 = {{&term803, &state1828}};
+std::vector<Reduce> reduce1827 = {};
+std::vector<Shift> shift1828 = {};
+std::vector<Reduce> reduce1828 = {{nullptr, &rule290, false}};
+std::vector<Shift> shift1829 = {{&term803, &state1830}};
+std::vector<Reduce> reduce1829 = {};
+std::vector<Shift> shift1830 = {};
+std::vector<Reduce> reduce1830 = {{nullptr, &rule289, false}};
+std::vector<Shift> shift1831 = {{&term803, &state1832}};
+std::vector<Reduce> reduce1831 = {};
+std::vector<Shift> shift1832 = {};
+std::vector<Reduce> reduce1832 = {{nullptr, &rule288, false}};
+std::vector<Shift> shift1833 = {{&term803, &state1834}};
+std::vector<Reduce> reduce1833 = {};
+std::vector<Shift> shift1834 = {};
+std::vector<Reduce> reduce1834 = {{nullptr, &rule287, false}};
+std::vector<Shift> shift1835 = {{&term803, &state1836}};
+std::vector<Reduce> reduce1835 = {};
+std::vector<Shift> shift1836 = {};
+std::vector<Reduce> reduce1836 = {{nullptr, &rule286, false}};
+std::vector<Shift> shift1837 = {{&term803, &state1838}};
+std::vector<Reduce> reduce1837 = {};
+std::vector<Shift> shift1838 = {};
+std::vector<Reduce> reduce1838 = {{nullptr, &rule285, false}};
+std::vector<Shift> shift1839 = {{&term803, &state1840}};
+std::vector<Reduce> reduce1839 = {};
+std::vector<Shift> shift1840 = {};
+std::vector<Reduce> reduce1840 = {{nullptr, &rule284, false}};
+std::vector<Shift> shift1841 = {{&term803, &state1842}};
+std::vector<Reduce> reduce1841 = {};
+std::vector<Shift> shift1842 = {};
+std::vector<Reduce> reduce1842 = {{nullptr, &rule283, false}};
+std::vector<Shift> shift1843 = {{&term803, &state1844}};
+std::vector<Reduce> reduce1843 = {};
+std::vector<Shift> shift1844 = {};
+std::vector<Reduce> reduce1844 = {{nullptr, &rule282, false}};
+std::vector<Shift> shift1845 = {{&term803, &state1846}};
+std::vector<Reduce> reduce1845 = {};
+std::vector<Shift> shift1846 = {};
+std::vector<Reduce> reduce1846 = {{nullptr, &rule281, false}};
+std::vector<Shift> shift1847 = {{&term803, &state1848}};
+std::vector<Reduce> reduce1847 = {};
+std::vector<Shift> shift1848 = {};
+std::vector<Reduce> reduce1848 = {{nullptr, &rule280, false}};
+std::vector<Shift> shift1849 = {{&term803, &state1850}};
+std::vector<Reduce> reduce1849 = {};
+std::vector<Shift> shift1850 = {};
+std::vector<Reduce> reduce1850 = {{nullptr, &rule279, false}};
+std::vector<Shift> shift1851 = {{&term803, &state1852}};
+std::vector<Reduce> reduce1851 = {};
+std::vector<Shift> shift1852 = {};
+std::vector<Reduce> reduce1852 = {{nullptr, &rule278, false}};
+std::vector<Shift> shift1853 = {{&term803, &state1854}};
+std::vector<Reduce> reduce1853 = {};
+std::vector<Shift> shift1854 = {};
+std::vector<Reduce> reduce1854 = {{nullptr, &rule277, false}};
+std::vector<Shift> shift1855 = {{&term803, &state1856}};
+std::vector<Reduce> reduce1855 = {};
+std::vector<Shift> shift1856 = {};
+std::vector<Reduce> reduce1856 = {{nullptr, &rule276, false}};
+std::vector<Shift> shift1857 = {{&term803, &state1858}};
+std::vector<Reduce> reduce1857 = {};
+std::vector<Shift> shift1858 = {};
+std::vector<Reduce> reduce1858 = {{nullptr, &rule275, false}};
+std::vector<Shift> shift1859 = {{&term803, &state1860}};
+std::vector<Reduce> reduce1859 = {};
+std::vector<Shift> shift1860 = {};
+std::vector<Reduce> reduce1860 = {{nullptr, &rule274, false}};
+std::vector<Shift> shift1861 = {{&term803, &state1862}};
+std::vector<Reduce> reduce1861 = {};
+std::vector<Shift> shift1862 = {};
+std::vector<Reduce> reduce1862 = {{nullptr, &rule273, false}};
+std::vector<Shift> shift1863 = {{&term803, &state1864}};
+std::vector<Reduce> reduce1863 = {};
+std::vector<Shift> shift1864 = {};
+std::vector<Reduce> reduce1864 = {{nullptr, &rule272, false}};
+std::vector<Shift> shift1865 = {{&term803, &state1866}};
+std::vector<Reduce> reduce1865 = {};
+std::vector<Shift> shift1866 = {};
+std::vector<Reduce> reduce1866 = {{nullptr, &rule271, false}};
+std::vector<Shift> shift1867 = {{&term803, &state1868}};
+std::vector<Reduce> reduce1867 = {};
+std::vector<Shift> shift1868 = {};
+std::vector<Reduce> reduce1868 = {{nullptr, &rule270, false}};
+std::vector<Shift> shift1869 = {{&term803, &state1870}};
+std::vector<Reduce> reduce1869 = {};
+std::vector<Shift> shift1870 = {};
+std::vector<Reduce> reduce1870 = {{nullptr, &rule269, false}};
+std::vector<Shift> shift1871 = {{&term803, &state1872}};
+std::vector<Reduce> reduce1871 = {};
+std::vector<Shift> shift1872 = {};
+std::vector<Reduce> reduce1872 = {{nullptr, &rule268, false}};
+std::vector<Shift> shift1873 = {{&term803, &state1874}};
+std::vector<Reduce> reduce1873 = {};
+std::vector<Shift> shift1874 = {};
+std::vector<Reduce> reduce1874 = {{nullptr, &rule267, false}};
+std::vector<Shift> shift1875 = {{&term803, &state1876}};
+std::vector<Reduce> reduce1875 = {};
+std::vector<Shift> shift1876 = {};
+std::vector<Reduce> reduce1876 = {{nullptr, &rule266, false}};
+std::vector<Shift> shift1877 = {{&term803, &state1878}};
+std::vector<Reduce> reduce1877 = {};
+std::vector<Shift> shift1878 = {};
+std::vector<Reduce> reduce1878 = {{nullptr, &rule265, false}};
+std::vector<Shift> shift1879 = {{&term803, &state1880}};
+std::vector<Reduce> reduce1879 = {};
+std::vector<Shift> shift1880 = {};
+std::vector<Reduce> reduce1880 = {{nullptr, &rule264, false}};
+std::vector<Shift> shift1881 = {{&term803, &state1882}};
+std::vector<Reduce> reduce1881 = {};
+std::vector<Shift> shift1882 = {};
+std::vector<Reduce> reduce1882 = {{nullptr, &rule263, false}};
+std::vector<Shift> shift1883 = {{&term803, &state1884}};
+std::vector<Reduce> reduce1883 = {};
+std::vector<Shift> shift1884 = {};
+std::vector<Reduce> reduce1884 = {{nullptr, &rule262, false}};
+std::vector<Shift> shift1885 = {{&term803, &state1886}};
+std::vector<Reduce> reduce1885 = {};
+std::vector<Shift> shift1886 = {};
+std::vector<Reduce> reduce1886 = {{nullptr, &rule261, false}};
+std::vector<Shift> shift1887 = {{&term803, &state1888}};
+std::vector<Reduce> reduce1887 = {};
+std::vector<Shift> shift1888 = {};
+std::vector<Reduce> reduce1888 = {{nullptr, &rule260, false}};
+std::vector<Shift> shift1889 = {{&term803, &state1890}};
+std::vector<Reduce> reduce1889 = {};
+std::vector<Shift> shift1890 = {};
+std::vector<Reduce> reduce1890 = {{nullptr, &rule259, false}};
+std::vector<Shift> shift1891 = {{&term803, &state1892}};
+std::vector<Reduce> reduce1891 = {};
+std::vector<Shift> shift1892 = {};
+std::vector<Reduce> reduce1892 = {{nullptr, &rule258, false}};
+std::vector<Shift> shift1893 = {{&term803, &state1894}};
+std::vector<Reduce> reduce1893 = {};
+std::vector<Shift> shift1894 = {};
+std::vector<Reduce> reduce1894 = {{nullptr, &rule257, false}};
+std::vector<Shift> shift1895 = {{&term803, &state1896}};
+std::vector<Reduce> reduce1895 = {};
+std::vector<Shift> shift1896 = {};
+std::vector<Reduce> reduce1896 = {{nullptr, &rule256, false}};
+std::vector<Shift> shift1897 = {{&term803, &state1898}};
+std::vector<Reduce> reduce1897 = {};
+std::vector<Shift> shift1898 = {};
+std::vector<Reduce> reduce1898 = {{nullptr, &rule255, false}};
+std::vector<Shift> shift1899 = {{&term803, &state1900}};
+std::vector<Reduce> reduce1899 = {};
+std::vector<Shift> shift1900 = {};
+std::vector<Reduce> reduce1900 = {{nullptr, &rule254, false}};
+std::vector<Shift> shift1901 = {{&term803, &state1902}};
+std::vector<Reduce> reduce1901 = {};
+std::vector<Shift> shift1902 = {};
+std::vector<Reduce> reduce1902 = {{nullptr, &rule253, false}};
+std::vector<Shift> shift1903 = {{&term803, &state1904}};
+std::vector<Reduce> reduce1903 = {};
+std::vector<Shift> shift1904 = {};
+std::vector<Reduce> reduce1904 = {{nullptr, &rule252, false}};
+std::vector<Shift> shift1905 = {{&term803, &state1906}};
+std::vector<Reduce> reduce1905 = {};
+std::vector<Shift> shift1906 = {};
+std::vector<Reduce> reduce1906 = {{nullptr, &rule251, false}};
+std::vector<Shift> shift1907 = {{&term803, &state1908}};
+std::vector<Reduce> reduce1907 = {};
+std::vector<Shift> shift1908 = {};
+std::vector<Reduce> reduce1908 = {{nullptr, &rule250, false}};
+std::vector<Shift> shift1909 = {{&term803, &state1910}};
+std::vector<Reduce> reduce1909 = {};
+std::vector<Shift> shift1910 = {};
+std::vector<Reduce> reduce1910 = {{nullptr, &rule249, false}};
+std::vector<Shift> shift1911 = {{&term803, &state1912}};
+std::vector<Reduce> reduce1911 = {};
+std::vector<Shift> shift1912 = {};
+std::vector<Reduce> reduce1912 = {{nullptr, &rule248, false}};
+std::vector<Shift> shift1913 = {{&term803, &state1914}};
+std::vector<Reduce> reduce1913 = {};
+std::vector<Shift> shift1914 = {};
+std::vector<Reduce> reduce1914 = {{nullptr, &rule247, false}};
+std::vector<Shift> shift1915 = {{&term803, &state1916}};
+std::vector<Reduce> reduce1915 = {};
+std::vector<Shift> shift1916 = {};
+std::vector<Reduce> reduce1916 = {{nullptr, &rule246, false}};
+std::vector<Shift> shift1917 = {{&term803, &state1918}};
+std::vector<Reduce> reduce1917 = {};
+std::vector<Shift> shift1918 = {};
+std::vector<Reduce> reduce1918 = {{nullptr, &rule245, false}};
+std::vector<Shift> shift1919 = {{&term803, &state1920}};
+std::vector<Reduce> reduce1919 = {};
+std::vector<Shift> shift1920 = {};
+std::vector<Reduce> reduce1920 = {{nullptr, &rule244, false}};
+std::vector<Shift> shift1921 = {{&term803, &state1922}};
+std::vector<Reduce> reduce1921 = {};
+std::vector<Shift> shift1922 = {};
+std::vector<Reduce> reduce1922 = {{nullptr, &rule243, false}};
+std::vector<Shift> shift1923 = {{&term803, &state1924}};
+std::vector<Reduce> reduce1923 = {};
+std::vector<Shift> shift1924 = {};
+std::vector<Reduce> reduce1924 = {{nullptr, &rule242, false}};
+std::vector<Shift> shift1925 = {{&term803, &state1926}};
+std::vector<Reduce> reduce1925 = {};
+std::vector<Shift> shift1926 = {};
+std::vector<Reduce> reduce1926 = {{nullptr, &rule241, false}};
+std::vector<Shift> shift1927 = {{&term803, &state1928}};
+std::vector<Reduce> reduce1927 = {};
+std::vector<Shift> shift1928 = {};
+std::vector<Reduce> reduce1928 = {{nullptr, &rule240, false}};
+std::vector<Shift> shift1929 = {{&term803, &state1930}};
+std::vector<Reduce> reduce1929 = {};
+std::vector<Shift> shift1930 = {};
+std::vector<Reduce> reduce1930 = {{nullptr, &rule239, false}};
+std::vector<Shift> shift1931 = {{&term803, &state1932}};
+std::vector<Reduce> reduce1931 = {};
+std::vector<Shift> shift1932 = {};
+std::vector<Reduce> reduce1932 = {{nullptr, &rule238, false}};
+std::vector<Shift> shift1933 = {{&term803, &state1934}};
+std::vector<Reduce> reduce1933 = {};
+std::vector<Shift> shift1934 = {};
+std::vector<Reduce> reduce1934 = {{nullptr, &rule237, false}};
+std::vector<Shift> shift1935 = {{&term803, &state1936}};
+std::vector<Reduce> reduce1935 = {};
+std::vector<Shift> shift1936 = {};
+std::vector<Reduce> reduce1936 = {{nullptr, &rule236, false}};
+std::vector<Shift> shift1937 = {{&term803, &state1938}};
+std::vector<Reduce> reduce1937 = {};
+std::vector<Shift> shift1938 = {};
+std::vector<Reduce> reduce1938 = {{nullptr, &rule235, false}};
+std::vector<Shift> shift1939 = {{&term803, &state1940}};
+std::vector<Reduce> reduce1939 = {};
+std::vector<Shift> shift1940 = {};
+std::vector<Reduce> reduce1940 = {{nullptr, &rule234, false}};
+std::vector<Shift> shift1941 = {{&term803, &state1942}};
+std::vector<Reduce> reduce1941 = {};
+std::vector<Shift> shift1942 = {};
+std::vector<Reduce> reduce1942 = {{nullptr, &rule233, false}};
+std::vector<Shift> shift1943 = {{&term803, &state1944}};
+std::vector<Reduce> reduce1943 = {};
+std::vector<Shift> shift1944 = {};
+std::vector<Reduce> reduce1944 = {{nullptr, &rule232, false}};
+std::vector<Shift> shift1945 = {{&term803, &state1946}};
+std::vector<Reduce> reduce1945 = {};
+std::vector<Shift> shift1946 = {};
+std::vector<Reduce> reduce1946 = {{nullptr, &rule231, false}};
+std::vector<Shift> shift1947 = {{&term803, &state1948}};
+std::vector<Reduce> reduce1947 = {};
+std::vector<Shift> shift1948 = {};
+std::vector<Reduce> reduce1948 = {{nullptr, &rule230, false}};
+std::vector<Shift> shift1949 = {{&term803, &state1950}};
+std::vector<Reduce> reduce1949 = {};
+std::vector<Shift> shift1950 = {};
+std::vector<Reduce> reduce1950 = {{nullptr, &rule229, false}};
+std::vector<Shift> shift1951 = {{&term803, &state1952}};
+std::vector<Reduce> reduce1951 = {};
+std::vector<Shift> shift1952 = {};
+std::vector<Reduce> reduce1952 = {{nullptr, &rule228, false}};
+std::vector<Shift> shift1953 = {{&term803, &state1954}};
+std::vector<Reduce> reduce1953 = {};
+std::vector<Shift> shift1954 = {};
+std::vector<Reduce> reduce1954 = {{nullptr, &rule227, false}};
+std::vector<Shift> shift1955 = {{&term803, &state1956}};
+std::vector<Reduce> reduce1955 = {};
+std::vector<Shift> shift1956 = {};
+std::vector<Reduce> reduce1956 = {{nullptr, &rule226, false}};
+std::vector<Shift> shift1957 = {{&term803, &state1958}};
+std::vector<Reduce> reduce1957 = {};
+std::vector<Shift> shift1958 = {};
+std::vector<Reduce> reduce1958 = {{nullptr, &rule225, false}};
+std::vector<Shift> shift1959 = {{&term803, &state1960}};
+std::vector<Reduce> reduce1959 = {};
+std::vector<Shift> shift1960 = {};
+std::vector<Reduce> reduce1960 = {{nullptr, &rule224, false}};
+std::vector<Shift> shift1961 = {{&term803, &state1962}};
+std::vector<Reduce> reduce1961 = {};
+std::vector<Shift> shift1962 = {};
+std::vector<Reduce> reduce1962 = {{nullptr, &rule223, false}};
+std::vector<Shift> shift1963 = {{&term803, &state1964}};
+std::vector<Reduce> reduce1963 = {};
+std::vector<Shift> shift1964 = {};
+std::vector<Reduce> reduce1964 = {{nullptr, &rule222, false}};
+std::vector<Shift> shift1965 = {{&term803, &state1966}};
+std::vector<Reduce> reduce1965 = {};
+std::vector<Shift> shift1966 = {};
+std::vector<Reduce> reduce1966 = {{nullptr, &rule221, false}};
+std::vector<Shift> shift1967 = {{&term803, &state1968}};
+std::vector<Reduce> reduce1967 = {};
+std::vector<Shift> shift1968 = {};
+std::vector<Reduce> reduce1968 = {{nullptr, &rule220, false}};
+std::vector<Shift> shift1969 = {{&term803, &state1970}};
+std::vector<Reduce> reduce1969 = {};
+std::vector<Shift> shift1970 = {};
+std::vector<Reduce> reduce1970 = {{nullptr, &rule219, false}};
+std::vector<Shift> shift1971 = {{&term803, &state1972}};
+std::vector<Reduce> reduce1971 = {};
+std::vector<Shift> shift1972 = {};
+std::vector<Reduce> reduce1972 = {{nullptr, &rule218, false}};
+std::vector<Shift> shift1973 = {{&term803, &state1974}};
+std::vector<Reduce> reduce1973 = {};
+std::vector<Shift> shift1974 = {};
+std::vector<Reduce> reduce1974 = {{nullptr, &rule217, false}};
+std::vector<Shift> shift1975 = {{&term803, &state1976}};
+std::vector<Reduce> reduce1975 = {};
+std::vector<Shift> shift1976 = {};
+std::vector<Reduce> reduce1976 = {{nullptr, &rule216, false}};
+std::vector<Shift> shift1977 = {{&term803, &state1978}};
+std::vector<Reduce> reduce1977 = {};
+std::vector<Shift> shift1978 = {};
+std::vector<Reduce> reduce1978 = {{nullptr, &rule215, false}};
+std::vector<Shift> shift1979 = {{&term803, &state1980}};
+std::vector<Reduce> reduce1979 = {};
+std::vector<Shift> shift1980 = {};
+std::vector<Reduce> reduce1980 = {{nullptr, &rule214, false}};
+std::vector<Shift> shift1981 = {{&term803, &state1982}};
+std::vector<Reduce> reduce1981 = {};
+std::vector<Shift> shift1982 = {};
+std::vector<Reduce> reduce1982 = {{nullptr, &rule213, false}};
+std::vector<Shift> shift1983 = {{&term803, &state1984}};
+std::vector<Reduce> reduce1983 = {};
+std::vector<Shift> shift1984 = {};
+std::vector<Reduce> reduce1984 = {{nullptr, &rule212, false}};
+std::vector<Shift> shift1985 = {{&term803, &state1986}};
+std::vector<Reduce> reduce1985 = {};
+std::vector<Shift> shift1986 = {};
+std::vector<Reduce> reduce1986 = {{nullptr, &rule211, false}};
+std::vector<Shift> shift1987 = {{&term803, &state1988}};
+std::vector<Reduce> reduce1987 = {};
+std::vector<Shift> shift1988 = {};
+std::vector<Reduce> reduce1988 = {{nullptr, &rule210, false}};
+std::vector<Shift> shift1989 = {{&term803, &state1990}};
+std::vector<Reduce> reduce1989 = {};
+std::vector<Shift> shift1990 = {};
+std::vector<Reduce> reduce1990 = {{nullptr, &rule209, false}};
+std::vector<Shift> shift1991 = {{&term803, &state1992}};
+std::vector<Reduce> reduce1991 = {};
+std::vector<Shift> shift1992 = {};
+std::vector<Reduce> reduce1992 = {{nullptr, &rule208, false}};
+std::vector<Shift> shift1993 = {{&term803, &state1994}};
+std::vector<Reduce> reduce1993 = {};
+std::vector<Shift> shift1994 = {};
+std::vector<Reduce> reduce1994 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift1995 = {{&term803, &state1996}};
+std::vector<Reduce> reduce1995 = {};
+std::vector<Shift> shift1996 = {};
+std::vector<Reduce> reduce1996 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1997 = {{&term803, &state1998}};
+std::vector<Reduce> reduce1997 = {};
+std::vector<Shift> shift1998 = {};
+std::vector<Reduce> reduce1998 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift1999 = {{&term803, &state2000}};
+std::vector<Reduce> reduce1999 = {};
+std::vector<Shift> shift2000 = {};
+std::vector<Reduce> reduce2000 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift2001 = {{&term803, &state2002}};
+std::vector<Reduce> reduce2001 = {};
+std::vector<Shift> shift2002 = {};
+std::vector<Reduce> reduce2002 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift2003 = {{&term803, &state2004}};
+std::vector<Reduce> reduce2003 = {};
+std::vector<Shift> shift2004 = {};
+std::vector<Reduce> reduce2004 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift2005 = {{&term803, &state2006}};
+std::vector<Reduce> reduce2005 = {};
+std::vector<Shift> shift2006 = {};
+std::vector<Reduce> reduce2006 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift2007 = {{&term803, &state2008}};
+std::vector<Reduce> reduce2007 = {};
+std::vector<Shift> shift2008 = {};
+std::vector<Reduce> reduce2008 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift2009 = {{&term803, &state2010}};
+std::vector<Reduce> reduce2009 = {};
+std::vector<Shift> shift2010 = {};
+std::vector<Reduce> reduce2010 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift2011 = {{&term803, &state2012}};
+std::vector<Reduce> reduce2011 = {};
+std::vector<Shift> shift2012 = {};
+std::vector<Reduce> reduce2012 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift2013 = {{&term803, &state2014}};
+std::vector<Reduce> reduce2013 = {};
+std::vector<Shift> shift2014 = {};
+std::vector<Reduce> reduce2014 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift2015 = {{&term803, &state2016}};
+std::vector<Reduce> reduce2015 = {};
+std::vector<Shift> shift2016 = {};
+std::vector<Reduce> reduce2016 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift2017 = {{&term803, &state2018}};
+std::vector<Reduce> reduce2017 = {};
+std::vector<Shift> shift2018 = {};
+std::vector<Reduce> reduce2018 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift2019 = {{&term803, &state2020}};
+std::vector<Reduce> reduce2019 = {};
+std::vector<Shift> shift2020 = {};
+std::vector<Reduce> reduce2020 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift2021 = {{&term803, &state2022}};
+std::vector<Reduce> reduce2021 = {};
+std::vector<Shift> shift2022 = {};
+std::vector<Reduce> reduce2022 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift2023 = {{&term803, &state2024}};
+std::vector<Reduce> reduce2023 = {};
+std::vector<Shift> shift2024 = {};
+std::vector<Reduce> reduce2024 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift2025 = {{&term803, &state2026}};
+std::vector<Reduce> reduce2025 = {};
+std::vector<Shift> shift2026 = {};
+std::vector<Reduce> reduce2026 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift2027 = {{&term803, &state2028}};
+std::vector<Reduce> reduce2027 = {};
+std::vector<Shift> shift2028 = {};
+std::vector<Reduce> reduce2028 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift2029 = {{&term803, &state2030}};
+std::vector<Reduce> reduce2029 = {};
+std::vector<Shift> shift2030 = {};
+std::vector<Reduce> reduce2030 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift2031 = {{&term803, &state2032}};
+std::vector<Reduce> reduce2031 = {};
+std::vector<Shift> shift2032 = {};
+std::vector<Reduce> reduce2032 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift2033 = {{&term803, &state2034}};
+std::vector<Reduce> reduce2033 = {};
+std::vector<Shift> shift2034 = {};
+std::vector<Reduce> reduce2034 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift2035 = {{&term803, &state2036}};
+std::vector<Reduce> reduce2035 = {};
+std::vector<Shift> shift2036 = {};
+std::vector<Reduce> reduce2036 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift2037 = {{&term803, &state2038}};
+std::vector<Reduce> reduce2037 = {};
+std::vector<Shift> shift2038 = {};
+std::vector<Reduce> reduce2038 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift2039 = {{&term803, &state2040}};
+std::vector<Reduce> reduce2039 = {};
+std::vector<Shift> shift2040 = {};
+std::vector<Reduce> reduce2040 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift2041 = {{&term803, &state2042}};
+std::vector<Reduce> reduce2041 = {};
+std::vector<Shift> shift2042 = {};
+std::vector<Reduce> reduce2042 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift2043 = {{&term803, &state2044}};
+std::vector<Reduce> reduce2043 = {};
+std::vector<Shift> shift2044 = {};
+std::vector<Reduce> reduce2044 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift2045 = {{&term803, &state2046}};
+std::vector<Reduce> reduce2045 = {};
+std::vector<Shift> shift2046 = {};
+std::vector<Reduce> reduce2046 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift2047 = {{&term803, &state2048}};
+std::vector<Reduce> reduce2047 = {};
+std::vector<Shift> shift2048 = {};
+std::vector<Reduce> reduce2048 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift2049 = {{&term803, &state2050}};
+std::vector<Reduce> reduce2049 = {};
+std::vector<Shift> shift2050 = {};
+std::vector<Reduce> reduce2050 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift2051 = {{&term803, &state2052}};
+std::vector<Reduce> reduce2051 = {};
+std::vector<Shift> shift2052 = {};
+std::vector<Reduce> reduce2052 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift2053 = {{&term803, &state2054}};
+std::vector<Reduce> reduce2053 = {};
+std::vector<Shift> shift2054 = {};
+std::vector<Reduce> reduce2054 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift2055 = {{&term803, &state2056}};
+std::vector<Reduce> reduce2055 = {};
+std::vector<Shift> shift2056 = {};
+std::vector<Reduce> reduce2056 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift2057 = {{&term803, &state2058}};
+std::vector<Reduce> reduce2057 = {};
+std::vector<Shift> shift2058 = {};
+std::vector<Reduce> reduce2058 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift2059 = {{&term803, &state2060}};
+std::vector<Reduce> reduce2059 = {};
+std::vector<Shift> shift2060 = {};
+std::vector<Reduce> reduce2060 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift2061 = {{&term803, &state2062}};
+std::vector<Reduce> reduce2061 = {};
+std::vector<Shift> shift2062 = {};
+std::vector<Reduce> reduce2062 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift2063 = {{&term803, &state2064}};
+std::vector<Reduce> reduce2063 = {};
+std::vector<Shift> shift2064 = {};
+std::vector<Reduce> reduce2064 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift2065 = {{&term803, &state2066}};
+std::vector<Reduce> reduce2065 = {};
+std::vector<Shift> shift2066 = {};
+std::vector<Reduce> reduce2066 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift2067 = {{&term803, &state2068}};
+std::vector<Reduce> reduce2067 = {};
+std::vector<Shift> shift2068 = {};
+std::vector<Reduce> reduce2068 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift2069 = {{&term803, &state2070}};
+std::vector<Reduce> reduce2069 = {};
+std::vector<Shift> shift2070 = {};
+std::vector<Reduce> reduce2070 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift2071 = {{&term803, &state2072}};
+std::vector<Reduce> reduce2071 = {};
+std::vector<Shift> shift2072 = {};
+std::vector<Reduce> reduce2072 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift2073 = {{&term803, &state2074}};
+std::vector<Reduce> reduce2073 = {};
+std::vector<Shift> shift2074 = {};
+std::vector<Reduce> reduce2074 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift2075 = {{&term803, &state2076}};
+std::vector<Reduce> reduce2075 = {};
+std::vector<Shift> shift2076 = {};
+std::vector<Reduce> reduce2076 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift2077 = {{&term803, &state2078}};
+std::vector<Reduce> reduce2077 = {};
+std::vector<Shift> shift2078 = {};
+std::vector<Reduce> reduce2078 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift2079 = {{&term803, &state2080}};
+std::vector<Reduce> reduce2079 = {};
+std::vector<Shift> shift2080 = {};
+std::vector<Reduce> reduce2080 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift2081 = {{&term803, &state2082}};
+std::vector<Reduce> reduce2081 = {};
+std::vector<Shift> shift2082 = {};
+std::vector<Reduce> reduce2082 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift2083 = {{&term803, &state2084}};
+std::vector<Reduce> reduce2083 = {};
+std::vector<Shift> shift2084 = {};
+std::vector<Reduce> reduce2084 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift2085 = {{&term803, &state2086}};
+std::vector<Reduce> reduce2085 = {};
+std::vector<Shift> shift2086 = {};
+std::vector<Reduce> reduce2086 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift2087 = {{&term803, &state2088}};
+std::vector<Reduce> reduce2087 = {};
+std::vector<Shift> shift2088 = {};
+std::vector<Reduce> reduce2088 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift2089 = {{&term803, &state2090}};
+std::vector<Reduce> reduce2089 = {};
+std::vector<Shift> shift2090 = {};
+std::vector<Reduce> reduce2090 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift2091 = {{&term803, &state2092}};
+std::vector<Reduce> reduce2091 = {};
+std::vector<Shift> shift2092 = {};
+std::vector<Reduce> reduce2092 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift2093 = {{&term803, &state2094}};
+std::vector<Reduce> reduce2093 = {};
+std::vector<Shift> shift2094 = {};
+std::vector<Reduce> reduce2094 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift2095 = {{&term803, &state2096}};
+std::vector<Reduce> reduce2095 = {};
+std::vector<Shift> shift2096 = {};
+std::vector<Reduce> reduce2096 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift2097 = {{&term803, &state2098}};
+std::vector<Reduce> reduce2097 = {};
+std::vector<Shift> shift2098 = {};
+std::vector<Reduce> reduce2098 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift2099 = {{&term803, &state2100}};
+std::vector<Reduce> reduce2099 = {};
+std::vector<Shift> shift2100 = {};
+std::vector<Reduce> reduce2100 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift2101 = {{&term803, &state2102}};
+std::vector<Reduce> reduce2101 = {};
+std::vector<Shift> shift2102 = {};
+std::vector<Reduce> reduce2102 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift2103 = {{&term803, &state2104}};
+std::vector<Reduce> reduce2103 = {};
+std::vector<Shift> shift2104 = {};
+std::vector<Reduce> reduce2104 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift2105 = {{&term803, &state2106}};
+std::vector<Reduce> reduce2105 = {};
+std::vector<Shift> shift2106 = {};
+std::vector<Reduce> reduce2106 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift2107 = {{&term803, &state2108}};
+std::vector<Reduce> reduce2107 = {};
+std::vector<Shift> shift2108 = {};
+std::vector<Reduce> reduce2108 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift2109 = {{&term803, &state2110}};
+std::vector<Reduce> reduce2109 = {};
+std::vector<Shift> shift2110 = {};
+std::vector<Reduce> reduce2110 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift2111 = {{&term803, &state2112}};
+std::vector<Reduce> reduce2111 = {};
+std::vector<Shift> shift2112 = {};
+std::vector<Reduce> reduce2112 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift2113 = {{&term803, &state2114}};
+std::vector<Reduce> reduce2113 = {};
+std::vector<Shift> shift2114 = {};
+std::vector<Reduce> reduce2114 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift2115 = {{&term803, &state2116}};
+std::vector<Reduce> reduce2115 = {};
+std::vector<Shift> shift2116 = {};
+std::vector<Reduce> reduce2116 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift2117 = {{&term803, &state2118}};
+std::vector<Reduce> reduce2117 = {};
+std::vector<Shift> shift2118 = {};
+std::vector<Reduce> reduce2118 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift2119 = {{&term803, &state2120}};
+std::vector<Reduce> reduce2119 = {};
+std::vector<Shift> shift2120 = {};
+std::vector<Reduce> reduce2120 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift2121 = {{&term803, &state2122}};
+std::vector<Reduce> reduce2121 = {};
+std::vector<Shift> shift2122 = {};
+std::vector<Reduce> reduce2122 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift2123 = {{&term803, &state2124}};
+std::vector<Reduce> reduce2123 = {};
+std::vector<Shift> shift2124 = {};
+std::vector<Reduce> reduce2124 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift2125 = {{&term803, &state2126}};
+std::vector<Reduce> reduce2125 = {};
+std::vector<Shift> shift2126 = {};
+std::vector<Reduce> reduce2126 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift2127 = {{&term803, &state2128}};
+std::vector<Reduce> reduce2127 = {};
+std::vector<Shift> shift2128 = {};
+std::vector<Reduce> reduce2128 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift2129 = {{&term803, &state2130}};
+std::vector<Reduce> reduce2129 = {};
+std::vector<Shift> shift2130 = {};
+std::vector<Reduce> reduce2130 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift2131 = {{&term803, &state2132}};
+std::vector<Reduce> reduce2131 = {};
+std::vector<Shift> shift2132 = {};
+std::vector<Reduce> reduce2132 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift2133 = {{&term803, &state2134}};
+std::vector<Reduce> reduce2133 = {};
+std::vector<Shift> shift2134 = {};
+std::vector<Reduce> reduce2134 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift2135 = {{&term803, &state2136}};
+std::vector<Reduce> reduce2135 = {};
+std::vector<Shift> shift2136 = {};
+std::vector<Reduce> reduce2136 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift2137 = {{&term803, &state2138}};
+std::vector<Reduce> reduce2137 = {};
+std::vector<Shift> shift2138 = {};
+std::vector<Reduce> reduce2138 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift2139 = {{&term803, &state2140}};
+std::vector<Reduce> reduce2139 = {};
+std::vector<Shift> shift2140 = {};
+std::vector<Reduce> reduce2140 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift2141 = {{&term803, &state2142}};
+std::vector<Reduce> reduce2141 = {};
+std::vector<Shift> shift2142 = {};
+std::vector<Reduce> reduce2142 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift2143 = {{&term803, &state2144}};
+std::vector<Reduce> reduce2143 = {};
+std::vector<Shift> shift2144 = {};
+std::vector<Reduce> reduce2144 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift2145 = {{&term803, &state2146}};
+std::vector<Reduce> reduce2145 = {};
+std::vector<Shift> shift2146 = {};
+std::vector<Reduce> reduce2146 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift2147 = {{&term803, &state2148}};
+std::vector<Reduce> reduce2147 = {};
+std::vector<Shift> shift2148 = {};
+std::vector<Reduce> reduce2148 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift2149 = {{&term803, &state2150}};
+std::vector<Reduce> reduce2149 = {};
+std::vector<Shift> shift2150 = {};
+std::vector<Reduce> reduce2150 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift2151 = {{&term803, &state2152}};
+std::vector<Reduce> reduce2151 = {};
+std::vector<Shift> shift2152 = {};
+std::vector<Reduce> reduce2152 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift2153 = {{&term803, &state2154}};
+std::vector<Reduce> reduce2153 = {};
+std::vector<Shift> shift2154 = {};
+std::vector<Reduce> reduce2154 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift2155 = {{&term803, &state2156}};
+std::vector<Reduce> reduce2155 = {};
+std::vector<Shift> shift2156 = {};
+std::vector<Reduce> reduce2156 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift2157 = {{&term803, &state2158}};
+std::vector<Reduce> reduce2157 = {};
+std::vector<Shift> shift2158 = {};
+std::vector<Reduce> reduce2158 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift2159 = {{&term803, &state2160}};
+std::vector<Reduce> reduce2159 = {};
+std::vector<Shift> shift2160 = {};
+std::vector<Reduce> reduce2160 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift2161 = {{&term803, &state2162}};
+std::vector<Reduce> reduce2161 = {};
+std::vector<Shift> shift2162 = {};
+std::vector<Reduce> reduce2162 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift2163 = {{&term803, &state2164}};
+std::vector<Reduce> reduce2163 = {};
+std::vector<Shift> shift2164 = {};
+std::vector<Reduce> reduce2164 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift2165 = {{&term803, &state2166}};
+std::vector<Reduce> reduce2165 = {};
+std::vector<Shift> shift2166 = {};
+std::vector<Reduce> reduce2166 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift2167 = {{&term803, &state2168}};
+std::vector<Reduce> reduce2167 = {};
+std::vector<Shift> shift2168 = {};
+std::vector<Reduce> reduce2168 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift2169 = {{&term803, &state2170}};
+std::vector<Reduce> reduce2169 = {};
+std::vector<Shift> shift2170 = {};
+std::vector<Reduce> reduce2170 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift2171 = {{&term803, &state2172}};
+std::vector<Reduce> reduce2171 = {};
+std::vector<Shift> shift2172 = {};
+std::vector<Reduce> reduce2172 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift2173 = {{&term803, &state2174}};
+std::vector<Reduce> reduce2173 = {};
+std::vector<Shift> shift2174 = {};
+std::vector<Reduce> reduce2174 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift2175 = {{&term803, &state2176}};
+std::vector<Reduce> reduce2175 = {};
+std::vector<Shift> shift2176 = {};
+std::vector<Reduce> reduce2176 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift2177 = {{&term803, &state2178}};
+std::vector<Reduce> reduce2177 = {};
+std::vector<Shift> shift2178 = {};
+std::vector<Reduce> reduce2178 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift2179 = {{&term803, &state2180}};
+std::vector<Reduce> reduce2179 = {};
+std::vector<Shift> shift2180 = {};
+std::vector<Reduce> reduce2180 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift2181 = {{&term803, &state2182}};
+std::vector<Reduce> reduce2181 = {};
+std::vector<Shift> shift2182 = {};
+std::vector<Reduce> reduce2182 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift2183 = {{&term803, &state2184}};
+std::vector<Reduce> reduce2183 = {};
+std::vector<Shift> shift2184 = {};
+std::vector<Reduce> reduce2184 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift2185 = {{&term803, &state2186}};
+std::vector<Reduce> reduce2185 = {};
+std::vector<Shift> shift2186 = {};
+std::vector<Reduce> reduce2186 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift2187 = {{&term803, &state2188}};
+std::vector<Reduce> reduce2187 = {};
+std::vector<Shift> shift2188 = {};
+std::vector<Reduce> reduce2188 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift2189 = {{&term803, &state2190}};
+std::vector<Reduce> reduce2189 = {};
+std::vector<Shift> shift2190 = {};
+std::vector<Reduce> reduce2190 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift2191 = {{&term803, &state2192}};
+std::vector<Reduce> reduce2191 = {};
+std::vector<Shift> shift2192 = {};
+std::vector<Reduce> reduce2192 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift2193 = {{&term803, &state2194}};
+std::vector<Reduce> reduce2193 = {};
+std::vector<Shift> shift2194 = {};
+std::vector<Reduce> reduce2194 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift2195 = {{&term803, &state2196}};
+std::vector<Reduce> reduce2195 = {};
+std::vector<Shift> shift2196 = {};
+std::vector<Reduce> reduce2196 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift2197 = {{&term803, &state2198}};
+std::vector<Reduce> reduce2197 = {};
+std::vector<Shift> shift2198 = {};
+std::vector<Reduce> reduce2198 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift2199 = {{&term803, &state2200}};
+std::vector<Reduce> reduce2199 = {};
+std::vector<Shift> shift2200 = {};
+std::vector<Reduce> reduce2200 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift2201 = {{&term803, &state2202}};
+std::vector<Reduce> reduce2201 = {};
+std::vector<Shift> shift2202 = {};
+std::vector<Reduce> reduce2202 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift2203 = {{&term803, &state2204}};
+std::vector<Reduce> reduce2203 = {};
+std::vector<Shift> shift2204 = {};
+std::vector<Reduce> reduce2204 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift2205 = {{&term803, &state2206}};
+std::vector<Reduce> reduce2205 = {};
+std::vector<Shift> shift2206 = {};
+std::vector<Reduce> reduce2206 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift2207 = {{&term803, &state2208}};
+std::vector<Reduce> reduce2207 = {};
+std::vector<Shift> shift2208 = {};
+std::vector<Reduce> reduce2208 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift2209 = {{&term803, &state2210}};
+std::vector<Reduce> reduce2209 = {};
+std::vector<Shift> shift2210 = {};
+std::vector<Reduce> reduce2210 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift2211 = {{&term803, &state2212}};
+std::vector<Reduce> reduce2211 = {};
+std::vector<Shift> shift2212 = {};
+std::vector<Reduce> reduce2212 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift2213 = {{&term803, &state2214}};
+std::vector<Reduce> reduce2213 = {};
+std::vector<Shift> shift2214 = {};
+std::vector<Reduce> reduce2214 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift2215 = {{&term803, &state2216}};
+std::vector<Reduce> reduce2215 = {};
+std::vector<Shift> shift2216 = {};
+std::vector<Reduce> reduce2216 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift2217 = {{&term803, &state2218}};
+std::vector<Reduce> reduce2217 = {};
+std::vector<Shift> shift2218 = {};
+std::vector<Reduce> reduce2218 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift2219 = {{&term803, &state2220}};
+std::vector<Reduce> reduce2219 = {};
+std::vector<Shift> shift2220 = {};
+std::vector<Reduce> reduce2220 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift2221 = {{&term803, &state2222}};
+std::vector<Reduce> reduce2221 = {};
+std::vector<Shift> shift2222 = {};
+std::vector<Reduce> reduce2222 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift2223 = {{&term803, &state2224}};
+std::vector<Reduce> reduce2223 = {};
+std::vector<Shift> shift2224 = {};
+std::vector<Reduce> reduce2224 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift2225 = {{&term803, &state2226}};
+std::vector<Reduce> reduce2225 = {};
+std::vector<Shift> shift2226 = {};
+std::vector<Reduce> reduce2226 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift2227 = {{&term803, &state2228}};
+std::vector<Reduce> reduce2227 = {};
+std::vector<Shift> shift2228 = {};
+std::vector<Reduce> reduce2228 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift2229 = {{&term803, &state2230}};
+std::vector<Reduce> reduce2229 = {};
+std::vector<Shift> shift2230 = {};
+std::vector<Reduce> reduce2230 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift2231 = {{&term803, &state2232}};
+std::vector<Reduce> reduce2231 = {};
+std::vector<Shift> shift2232 = {};
+std::vector<Reduce> reduce2232 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift2233 = {{&term803, &state2234}};
+std::vector<Reduce> reduce2233 = {};
+std::vector<Shift> shift2234 = {};
+std::vector<Reduce> reduce2234 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift2235 = {{&term803, &state2236}};
+std::vector<Reduce> reduce2235 = {};
+std::vector<Shift> shift2236 = {};
+std::vector<Reduce> reduce2236 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift2237 = {{&term803, &state2238}};
+std::vector<Reduce> reduce2237 = {};
+std::vector<Shift> shift2238 = {};
+std::vector<Reduce> reduce2238 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift2239 = {{&term803, &state2240}};
+std::vector<Reduce> reduce2239 = {};
+std::vector<Shift> shift2240 = {};
+std::vector<Reduce> reduce2240 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift2241 = {{&term803, &state2242}};
+std::vector<Reduce> reduce2241 = {};
+std::vector<Shift> shift2242 = {};
+std::vector<Reduce> reduce2242 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift2243 = {{&term803, &state2244}};
+std::vector<Reduce> reduce2243 = {};
+std::vector<Shift> shift2244 = {};
+std::vector<Reduce> reduce2244 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift2245 = {{&term803, &state2246}};
+std::vector<Reduce> reduce2245 = {};
+std::vector<Shift> shift2246 = {};
+std::vector<Reduce> reduce2246 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift2247 = {{&term803, &state2248}};
+std::vector<Reduce> reduce2247 = {};
+std::vector<Shift> shift2248 = {};
+std::vector<Reduce> reduce2248 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift2249 = {{&term803, &state2250}};
+std::vector<Reduce> reduce2249 = {};
+std::vector<Shift> shift2250 = {};
+std::vector<Reduce> reduce2250 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift2251 = {{&term803, &state2252}};
+std::vector<Reduce> reduce2251 = {};
+std::vector<Shift> shift2252 = {};
+std::vector<Reduce> reduce2252 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift2253 = {{&term803, &state2254}};
+std::vector<Reduce> reduce2253 = {};
+std::vector<Shift> shift2254 = {};
+std::vector<Reduce> reduce2254 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift2255 = {{&term803, &state2256}};
+std::vector<Reduce> reduce2255 = {};
+std::vector<Shift> shift2256 = {};
+std::vector<Reduce> reduce2256 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift2257 = {{&term803, &state2258}};
+std::vector<Reduce> reduce2257 = {};
+std::vector<Shift> shift2258 = {};
+std::vector<Reduce> reduce2258 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift2259 = {{&term803, &state2260}};
+std::vector<Reduce> reduce2259 = {};
+std::vector<Shift> shift2260 = {};
+std::vector<Reduce> reduce2260 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift2261 = {{&term803, &state2262}};
+std::vector<Reduce> reduce2261 = {};
+std::vector<Shift> shift2262 = {};
+std::vector<Reduce> reduce2262 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift2263 = {{&term803, &state2264}};
+std::vector<Reduce> reduce2263 = {};
+std::vector<Shift> shift2264 = {};
+std::vector<Reduce> reduce2264 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift2265 = {{&term803, &state2266}};
+std::vector<Reduce> reduce2265 = {};
+std::vector<Shift> shift2266 = {};
+std::vector<Reduce> reduce2266 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift2267 = {{&term803, &state2268}};
+std::vector<Reduce> reduce2267 = {};
+std::vector<Shift> shift2268 = {};
+std::vector<Reduce> reduce2268 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift2269 = {{&term803, &state2270}};
+std::vector<Reduce> reduce2269 = {};
+std::vector<Shift> shift2270 = {};
+std::vector<Reduce> reduce2270 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift2271 = {{&term803, &state2272}};
+std::vector<Reduce> reduce2271 = {};
+std::vector<Shift> shift2272 = {};
+std::vector<Reduce> reduce2272 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift2273 = {{&term803, &state2274}};
+std::vector<Reduce> reduce2273 = {};
+std::vector<Shift> shift2274 = {};
+std::vector<Reduce> reduce2274 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift2275 = {{&term803, &state2276}};
+std::vector<Reduce> reduce2275 = {};
+std::vector<Shift> shift2276 = {};
+std::vector<Reduce> reduce2276 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift2277 = {{&term803, &state2278}};
+std::vector<Reduce> reduce2277 = {};
+std::vector<Shift> shift2278 = {};
+std::vector<Reduce> reduce2278 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift2279 = {{&term803, &state2280}};
+std::vector<Reduce> reduce2279 = {};
+std::vector<Shift> shift2280 = {};
+std::vector<Reduce> reduce2280 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift2281 = {{&term803, &state2282}};
+std::vector<Reduce> reduce2281 = {};
+std::vector<Shift> shift2282 = {};
+std::vector<Reduce> reduce2282 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift2283 = {{&term803, &state2284}};
+std::vector<Reduce> reduce2283 = {};
+std::vector<Shift> shift2284 = {};
+std::vector<Reduce> reduce2284 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift2285 = {{&term803, &state2286}};
+std::vector<Reduce> reduce2285 = {};
+std::vector<Shift> shift2286 = {};
+std::vector<Reduce> reduce2286 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift2287 = {{&term803, &state2288}};
+std::vector<Reduce> reduce2287 = {};
+std::vector<Shift> shift2288 = {};
+std::vector<Reduce> reduce2288 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift2289 = {{&term803, &state2290}};
+std::vector<Reduce> reduce2289 = {};
+std::vector<Shift> shift2290 = {};
+std::vector<Reduce> reduce2290 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift2291 = {{&term803, &state2292}};
+std::vector<Reduce> reduce2291 = {};
+std::vector<Shift> shift2292 = {};
+std::vector<Reduce> reduce2292 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift2293 = {{&term803, &state2294}};
+std::vector<Reduce> reduce2293 = {};
+std::vector<Shift> shift2294 = {};
+std::vector<Reduce> reduce2294 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift2295 = {{&term803, &state2296}};
+std::vector<Reduce> reduce2295 = {};
+std::vector<Shift> shift2296 = {};
+std::vector<Reduce> reduce2296 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift2297 = {{&term803, &state2298}};
+std::vector<Reduce> reduce2297 = {};
+std::vector<Shift> shift2298 = {};
+std::vector<Reduce> reduce2298 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift2299 = {{&term803, &state2300}};
+std::vector<Reduce> reduce2299 = {};
+std::vector<Shift> shift2300 = {};
+std::vector<Reduce> reduce2300 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift2301 = {{&term803, &state2302}};
+std::vector<Reduce> reduce2301 = {};
+std::vector<Shift> shift2302 = {};
+std::vector<Reduce> reduce2302 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift2303 = {{&term803, &state2304}};
+std::vector<Reduce> reduce2303 = {};
+std::vector<Shift> shift2304 = {};
+std::vector<Reduce> reduce2304 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift2305 = {{&term803, &state2306}};
+std::vector<Reduce> reduce2305 = {};
+std::vector<Shift> shift2306 = {};
+std::vector<Reduce> reduce2306 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift2307 = {{&term803, &state2308}};
+std::vector<Reduce> reduce2307 = {};
+std::vector<Shift> shift2308 = {};
+std::vector<Reduce> reduce2308 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift2309 = {{&term803, &state2310}};
+std::vector<Reduce> reduce2309 = {};
+std::vector<Shift> shift2310 = {};
+std::vector<Reduce> reduce2310 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift2311 = {{&term803, &state2312}};
+std::vector<Reduce> reduce2311 = {};
+std::vector<Shift> shift2312 = {};
+std::vector<Reduce> reduce2312 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift2313 = {{&term803, &state2314}};
+std::vector<Reduce> reduce2313 = {};
+std::vector<Shift> shift2314 = {};
+std::vector<Reduce> reduce2314 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift2315 = {{&term803, &state2316}};
+std::vector<Reduce> reduce2315 = {};
+std::vector<Shift> shift2316 = {};
+std::vector<Reduce> reduce2316 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift2317 = {{&term803, &state2318}};
+std::vector<Reduce> reduce2317 = {};
+std::vector<Shift> shift2318 = {};
+std::vector<Reduce> reduce2318 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift2319 = {{&term803, &state2320}};
+std::vector<Reduce> reduce2319 = {};
+std::vector<Shift> shift2320 = {};
+std::vector<Reduce> reduce2320 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift2321 = {{&term803, &state2322}};
+std::vector<Reduce> reduce2321 = {};
+std::vector<Shift> shift2322 = {};
+std::vector<Reduce> reduce2322 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift2323 = {{&term803, &state2324}};
+std::vector<Reduce> reduce2323 = {};
+std::vector<Shift> shift2324 = {};
+std::vector<Reduce> reduce2324 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift2325 = {{&term803, &state2326}};
+std::vector<Reduce> reduce2325 = {};
+std::vector<Shift> shift2326 = {};
+std::vector<Reduce> reduce2326 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift2327 = {{&term803, &state2328}};
+std::vector<Reduce> reduce2327 = {};
+std::vector<Shift> shift2328 = {};
+std::vector<Reduce> reduce2328 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift2329 = {{&term803, &state2330}};
+std::vector<Reduce> reduce2329 = {};
+std::vector<Shift> shift2330 = {};
+std::vector<Reduce> reduce2330 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift2331 = {{&term803, &state2332}};
+std::vector<Reduce> reduce2331 = {};
+std::vector<Shift> shift2332 = {};
+std::vector<Reduce> reduce2332 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift2333 = {{&term803, &state2334}};
+std::vector<Reduce> reduce2333 = {};
+std::vector<Shift> shift2334 = {};
+std::vector<Reduce> reduce2334 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift2335 = {{&term803, &state2336}};
+std::vector<Reduce> reduce2335 = {};
+std::vector<Shift> shift2336 = {};
+std::vector<Reduce> reduce2336 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift2337 = {{&term803, &state2338}};
+std::vector<Reduce> reduce2337 = {};
+std::vector<Shift> shift2338 = {};
+std::vector<Reduce> reduce2338 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift2339 = {{&term803, &state2340}};
+std::vector<Reduce> reduce2339 = {};
+std::vector<Shift> shift2340 = {};
+std::vector<Reduce> reduce2340 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift2341 = {{&term803, &state2342}};
+std::vector<Reduce> reduce2341 = {};
+std::vector<Shift> shift2342 = {};
+std::vector<Reduce> reduce2342 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift2343 = {{&term803, &state2344}};
+std::vector<Reduce> reduce2343 = {};
+std::vector<Shift> shift2344 = {};
+std::vector<Reduce> reduce2344 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift2345 = {{&term803, &state2346}};
+std::vector<Reduce> reduce2345 = {};
+std::vector<Shift> shift2346 = {};
+std::vector<Reduce> reduce2346 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift2347 = {{&term803, &state2348}};
+std::vector<Reduce> reduce2347 = {};
+std::vector<Shift> shift2348 = {};
+std::vector<Reduce> reduce2348 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift2349 = {{&term803, &state2350}};
+std::vector<Reduce> reduce2349 = {};
+std::vector<Shift> shift2350 = {};
+std::vector<Reduce> reduce2350 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift2351 = {{&term803, &state2352}};
+std::vector<Reduce> reduce2351 = {};
+std::vector<Shift> shift2352 = {};
+std::vector<Reduce> reduce2352 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift2353 = {{&term803, &state2354}};
+std::vector<Reduce> reduce2353 = {};
+std::vector<Shift> shift2354 = {};
+std::vector<Reduce> reduce2354 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift2355 = {{&term803, &state2356}};
+std::vector<Reduce> reduce2355 = {};
+std::vector<Shift> shift2356 = {};
+std::vector<Reduce> reduce2356 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift2357 = {{&term803, &state2358}};
+std::vector<Reduce> reduce2357 = {};
+std::vector<Shift> shift2358 = {};
+std::vector<Reduce> reduce2358 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift2359 = {{&term803, &state2360}};
+std::vector<Reduce> reduce2359 = {};
+std::vector<Shift> shift2360 = {};
+std::vector<Reduce> reduce2360 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift2361 = {{&term803, &state2362}};
+std::vector<Reduce> reduce2361 = {};
+std::vector<Shift> shift2362 = {};
+std::vector<Reduce> reduce2362 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift2363 = {{&term803, &state2364}};
+std::vector<Reduce> reduce2363 = {};
+std::vector<Shift> shift2364 = {};
+std::vector<Reduce> reduce2364 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift2365 = {{&term803, &state2366}};
+std::vector<Reduce> reduce2365 = {};
+std::vector<Shift> shift2366 = {};
+std::vector<Reduce> reduce2366 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift2367 = {{&term803, &state2368}};
+std::vector<Reduce> reduce2367 = {};
+std::vector<Shift> shift2368 = {};
+std::vector<Reduce> reduce2368 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift2369 = {{&term803, &state2370}};
+std::vector<Reduce> reduce2369 = {};
+std::vector<Shift> shift2370 = {};
+std::vector<Reduce> reduce2370 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift2371 = {{&term803, &state2372}};
+std::vector<Reduce> reduce2371 = {};
+std::vector<Shift> shift2372 = {};
+std::vector<Reduce> reduce2372 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift2373 = {{&term803, &state2374}};
+std::vector<Reduce> reduce2373 = {};
+std::vector<Shift> shift2374 = {};
+std::vector<Reduce> reduce2374 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift2375 = {{&term803, &state2376}};
+std::vector<Reduce> reduce2375 = {};
+std::vector<Shift> shift2376 = {};
+std::vector<Reduce> reduce2376 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift2377 = {{&term803, &state2378}};
+std::vector<Reduce> reduce2377 = {};
+std::vector<Shift> shift2378 = {};
+std::vector<Reduce> reduce2378 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift2379 = {{&term803, &state2380}};
+std::vector<Reduce> reduce2379 = {};
+std::vector<Shift> shift2380 = {};
+std::vector<Reduce> reduce2380 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift2381 = {{&term803, &state2382}};
+std::vector<Reduce> reduce2381 = {};
+std::vector<Shift> shift2382 = {};
+std::vector<Reduce> reduce2382 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift2383 = {{&term803, &state2384}};
+std::vector<Reduce> reduce2383 = {};
+std::vector<Shift> shift2384 = {};
+std::vector<Reduce> reduce2384 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift2385 = {{&term803, &state2386}};
+std::vector<Reduce> reduce2385 = {};
+std::vector<Shift> shift2386 = {};
+std::vector<Reduce> reduce2386 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift2387 = {{&term803, &state2388}};
+std::vector<Reduce> reduce2387 = {};
+std::vector<Shift> shift2388 = {};
+std::vector<Reduce> reduce2388 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift2389 = {{&term803, &state2390}};
+std::vector<Reduce> reduce2389 = {};
+std::vector<Shift> shift2390 = {};
+std::vector<Reduce> reduce2390 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift2391 = {{&term803, &state2392}};
+std::vector<Reduce> reduce2391 = {};
+std::vector<Shift> shift2392 = {};
+std::vector<Reduce> reduce2392 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift2393 = {{&term803, &state2394}};
+std::vector<Reduce> reduce2393 = {};
+std::vector<Shift> shift2394 = {};
+std::vector<Reduce> reduce2394 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift2395 = {{&term803, &state2396}};
+std::vector<Reduce> reduce2395 = {};
+std::vector<Shift> shift2396 = {};
+std::vector<Reduce> reduce2396 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift2397 = {{&term803, &state2398}};
+std::vector<Reduce> reduce2397 = {};
+std::vector<Shift> shift2398 = {};
+std::vector<Reduce> reduce2398 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift2399 = {{&term803, &state2400}};
+std::vector<Reduce> reduce2399 = {};
+std::vector<Shift> shift2400 = {};
+std::vector<Reduce> reduce2400 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift2401 = {{&term803, &state2402}};
+std::vector<Reduce> reduce2401 = {};
+std::vector<Shift> shift2402 = {};
+std::vector<Reduce> reduce2402 = {{nullptr, &rule3, false}};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state802}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift40, &reduce40, nullptr};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift48, &reduce48, nullptr};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift72, &reduce72, nullptr};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift80, &reduce80, nullptr};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift88, &reduce88, nullptr};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift96, &reduce96, nullptr};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift104, &reduce104, nullptr};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift120, &reduce120, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift128, &reduce128, nullptr};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift136, &reduce136, nullptr};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift140, &reduce140, nullptr};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift144, &reduce144, nullptr};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift146, &reduce146, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift148, &reduce148, nullptr};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift150, &reduce150, nullptr};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift152, &reduce152, nullptr};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift154, &reduce154, nullptr};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift158, &reduce158, nullptr};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift160, &reduce160, nullptr};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift162, &reduce162, nullptr};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift166, &reduce166, nullptr};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift168, &reduce168, nullptr};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift172, &reduce172, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift176, &reduce176, nullptr};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift180, &reduce180, nullptr};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift184, &reduce184, nullptr};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift188, &reduce188, nullptr};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift192, &reduce192, nullptr};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift200, &reduce200, nullptr};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift202, &reduce202, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift208, &reduce208, nullptr};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, nullptr};
+State state216 = {&shift216, &reduce216, nullptr};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, nullptr};
+State state224 = {&shift224, &reduce224, nullptr};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, nullptr};
+State state232 = {&shift232, &reduce232, nullptr};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, nullptr};
+State state240 = {&shift240, &reduce240, nullptr};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, nullptr};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift263, &reduce263, nullptr};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift268, &reduce268, nullptr};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift272, &reduce272, nullptr};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift276, &reduce276, nullptr};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift278, &reduce278, nullptr};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift280, &reduce280, nullptr};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, nullptr};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift286, &reduce286, nullptr};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift288, &reduce288, nullptr};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift290, &reduce290, nullptr};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift296, &reduce296, nullptr};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift302, &reduce302, nullptr};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift304, &reduce304, nullptr};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift308, &reduce308, nullptr};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift312, &reduce312, nullptr};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift320, &reduce320, nullptr};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift322, &reduce322, nullptr};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift326, &reduce326, nullptr};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift328, &reduce328, nullptr};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift330, &reduce330, nullptr};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift336, &reduce336, nullptr};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, nullptr};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift340, &reduce340, nullptr};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift344, &reduce344, nullptr};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift352, &reduce352, nullptr};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift354, &reduce354, nullptr};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift356, &reduce356, nullptr};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift358, &reduce358, nullptr};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift360, &reduce360, nullptr};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift362, &reduce362, nullptr};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift364, &reduce364, nullptr};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift367, &reduce367, nullptr};
+State state368 = {&shift368, &reduce368, nullptr};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift372, &reduce372, nullptr};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift374, &reduce374, nullptr};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift376, &reduce376, nullptr};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift378, &reduce378, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift380, &reduce380, nullptr};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift382, &reduce382, nullptr};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift384, &reduce384, nullptr};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift392, &reduce392, nullptr};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift394, &reduce394, nullptr};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift399, &reduce399, nullptr};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift403, &reduce403, nullptr};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift407, &reduce407, nullptr};
+State state408 = {&shift408, &reduce408, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift412, &reduce412, nullptr};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift416, &reduce416, nullptr};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, nullptr};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift424, &reduce424, nullptr};
+State state425 = {&shift425, &reduce425, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift430, &reduce430, nullptr};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift432, &reduce432, nullptr};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift434, &reduce434, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, nullptr};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift439, &reduce439, nullptr};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift443, &reduce443, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, nullptr};
+State state447 = {&shift447, &reduce447, nullptr};
+State state448 = {&shift448, &reduce448, nullptr};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, nullptr};
+State state456 = {&shift456, &reduce456, nullptr};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, nullptr};
+State state464 = {&shift464, &reduce464, nullptr};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift471, &reduce471, nullptr};
+State state472 = {&shift472, &reduce472, nullptr};
+State state473 = {&shift473, &reduce473, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, nullptr};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift484, &reduce484, nullptr};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift488, &reduce488, nullptr};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift497, &reduce497, nullptr};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift502, &reduce502, nullptr};
+State state503 = {&shift503, &reduce503, nullptr};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift511, &reduce511, nullptr};
+State state512 = {&shift512, &reduce512, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift515, &reduce515, nullptr};
+State state516 = {&shift516, &reduce516, nullptr};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift520, &reduce520, nullptr};
+State state521 = {&shift521, &reduce521, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift523, &reduce523, nullptr};
+State state524 = {&shift524, &reduce524, nullptr};
+State state525 = {&shift525, &reduce525, nullptr};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift528, &reduce528, nullptr};
+State state529 = {&shift529, &reduce529, nullptr};
+State state530 = {&shift530, &reduce530, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift532, &reduce532, nullptr};
+State state533 = {&shift533, &reduce533, nullptr};
+State state534 = {&shift534, &reduce534, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift536, &reduce536, nullptr};
+State state537 = {&shift537, &reduce537, nullptr};
+State state538 = {&shift538, &reduce538, nullptr};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift542, &reduce542, nullptr};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift545, &reduce545, nullptr};
+State state546 = {&shift546, &reduce546, nullptr};
+State state547 = {&shift547, &reduce547, nullptr};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift550, &reduce550, nullptr};
+State state551 = {&shift551, &reduce551, nullptr};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift554, &reduce554, nullptr};
+State state555 = {&shift555, &reduce555, nullptr};
+State state556 = {&shift556, &reduce556, nullptr};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift558, &reduce558, nullptr};
+State state559 = {&shift559, &reduce559, nullptr};
+State state560 = {&shift560, &reduce560, nullptr};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift562, &reduce562, nullptr};
+State state563 = {&shift563, &reduce563, nullptr};
+State state564 = {&shift564, &reduce564, nullptr};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift568, &reduce568, nullptr};
+State state569 = {&shift569, &reduce569, nullptr};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift572, &reduce572, nullptr};
+State state573 = {&shift573, &reduce573, nullptr};
+State state574 = {&shift574, &reduce574, nullptr};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift576, &reduce576, nullptr};
+State state577 = {&shift577, &reduce577, nullptr};
+State state578 = {&shift578, &reduce578, nullptr};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift580, &reduce580, nullptr};
+State state581 = {&shift581, &reduce581, nullptr};
+State state582 = {&shift582, &reduce582, nullptr};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift584, &reduce584, nullptr};
+State state585 = {&shift585, &reduce585, nullptr};
+State state586 = {&shift586, &reduce586, nullptr};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift588, &reduce588, nullptr};
+State state589 = {&shift589, &reduce589, nullptr};
+State state590 = {&shift590, &reduce590, nullptr};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift592, &reduce592, nullptr};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift594, &reduce594, nullptr};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift596, &reduce596, nullptr};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift598, &reduce598, nullptr};
+State state599 = {&shift599, &reduce599, nullptr};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift601, &reduce601, nullptr};
+State state602 = {&shift602, &reduce602, nullptr};
+State state603 = {&shift603, &reduce603, nullptr};
+State state604 = {&shift604, &reduce604, nullptr};
+State state605 = {&shift605, &reduce605, nullptr};
+State state606 = {&shift606, &reduce606, nullptr};
+State state607 = {&shift607, &reduce607, nullptr};
+State state608 = {&shift608, &reduce608, nullptr};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift610, &reduce610, nullptr};
+State state611 = {&shift611, &reduce611, nullptr};
+State state612 = {&shift612, &reduce612, nullptr};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift614, &reduce614, nullptr};
+State state615 = {&shift615, &reduce615, nullptr};
+State state616 = {&shift616, &reduce616, nullptr};
+State state617 = {&shift617, &reduce617, nullptr};
+State state618 = {&shift618, &reduce618, nullptr};
+State state619 = {&shift619, &reduce619, nullptr};
+State state620 = {&shift620, &reduce620, nullptr};
+State state621 = {&shift621, &reduce621, nullptr};
+State state622 = {&shift622, &reduce622, nullptr};
+State state623 = {&shift623, &reduce623, nullptr};
+State state624 = {&shift624, &reduce624, nullptr};
+State state625 = {&shift625, &reduce625, nullptr};
+State state626 = {&shift626, &reduce626, nullptr};
+State state627 = {&shift627, &reduce627, nullptr};
+State state628 = {&shift628, &reduce628, nullptr};
+State state629 = {&shift629, &reduce629, nullptr};
+State state630 = {&shift630, &reduce630, nullptr};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift632, &reduce632, nullptr};
+State state633 = {&shift633, &reduce633, nullptr};
+State state634 = {&shift634, &reduce634, nullptr};
+State state635 = {&shift635, &reduce635, nullptr};
+State state636 = {&shift636, &reduce636, nullptr};
+State state637 = {&shift637, &reduce637, nullptr};
+State state638 = {&shift638, &reduce638, nullptr};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift640, &reduce640, nullptr};
+State state641 = {&shift641, &reduce641, nullptr};
+State state642 = {&shift642, &reduce642, nullptr};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift644, &reduce644, nullptr};
+State state645 = {&shift645, &reduce645, nullptr};
+State state646 = {&shift646, &reduce646, nullptr};
+State state647 = {&shift647, &reduce647, nullptr};
+State state648 = {&shift648, &reduce648, nullptr};
+State state649 = {&shift649, &reduce649, nullptr};
+State state650 = {&shift650, &reduce650, nullptr};
+State state651 = {&shift651, &reduce651, nullptr};
+State state652 = {&shift652, &reduce652, nullptr};
+State state653 = {&shift653, &reduce653, nullptr};
+State state654 = {&shift654, &reduce654, nullptr};
+State state655 = {&shift655, &reduce655, nullptr};
+State state656 = {&shift656, &reduce656, nullptr};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift658, &reduce658, nullptr};
+State state659 = {&shift659, &reduce659, nullptr};
+State state660 = {&shift660, &reduce660, nullptr};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift662, &reduce662, nullptr};
+State state663 = {&shift663, &reduce663, nullptr};
+State state664 = {&shift664, &reduce664, nullptr};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift666, &reduce666, nullptr};
+State state667 = {&shift667, &reduce667, nullptr};
+State state668 = {&shift668, &reduce668, nullptr};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift670, &reduce670, nullptr};
+State state671 = {&shift671, &reduce671, nullptr};
+State state672 = {&shift672, &reduce672, nullptr};
+State state673 = {&shift673, &reduce673, nullptr};
+State state674 = {&shift674, &reduce674, nullptr};
+State state675 = {&shift675, &reduce675, nullptr};
+State state676 = {&shift676, &reduce676, nullptr};
+State state677 = {&shift677, &reduce677, nullptr};
+State state678 = {&shift678, &reduce678, nullptr};
+State state679 = {&shift679, &reduce679, nullptr};
+State state680 = {&shift680, &reduce680, nullptr};
+State state681 = {&shift681, &reduce681, nullptr};
+State state682 = {&shift682, &reduce682, nullptr};
+State state683 = {&shift683, &reduce683, nullptr};
+State state684 = {&shift684, &reduce684, nullptr};
+State state685 = {&shift685, &reduce685, nullptr};
+State state686 = {&shift686, &reduce686, nullptr};
+State state687 = {&shift687, &reduce687, nullptr};
+State state688 = {&shift688, &reduce688, nullptr};
+State state689 = {&shift689, &reduce689, nullptr};
+State state690 = {&shift690, &reduce690, nullptr};
+State state691 = {&shift691, &reduce691, nullptr};
+State state692 = {&shift692, &reduce692, nullptr};
+State state693 = {&shift693, &reduce693, nullptr};
+State state694 = {&shift694, &reduce694, nullptr};
+State state695 = {&shift695, &reduce695, nullptr};
+State state696 = {&shift696, &reduce696, nullptr};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift698, &reduce698, nullptr};
+State state699 = {&shift699, &reduce699, nullptr};
+State state700 = {&shift700, &reduce700, nullptr};
+State state701 = {&shift701, &reduce701, nullptr};
+State state702 = {&shift702, &reduce702, nullptr};
+State state703 = {&shift703, &reduce703, nullptr};
+State state704 = {&shift704, &reduce704, nullptr};
+State state705 = {&shift705, &reduce705, nullptr};
+State state706 = {&shift706, &reduce706, nullptr};
+State state707 = {&shift707, &reduce707, nullptr};
+State state708 = {&shift708, &reduce708, nullptr};
+State state709 = {&shift709, &reduce709, nullptr};
+State state710 = {&shift710, &reduce710, nullptr};
+State state711 = {&shift711, &reduce711, nullptr};
+State state712 = {&shift712, &reduce712, nullptr};
+State state713 = {&shift713, &reduce713, nullptr};
+State state714 = {&shift714, &reduce714, nullptr};
+State state715 = {&shift715, &reduce715, nullptr};
+State state716 = {&shift716, &reduce716, nullptr};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift718, &reduce718, nullptr};
+State state719 = {&shift719, &reduce719, nullptr};
+State state720 = {&shift720, &reduce720, nullptr};
+State state721 = {&shift721, &reduce721, nullptr};
+State state722 = {&shift722, &reduce722, nullptr};
+State state723 = {&shift723, &reduce723, nullptr};
+State state724 = {&shift724, &reduce724, nullptr};
+State state725 = {&shift725, &reduce725, nullptr};
+State state726 = {&shift726, &reduce726, nullptr};
+State state727 = {&shift727, &reduce727, nullptr};
+State state728 = {&shift728, &reduce728, nullptr};
+State state729 = {&shift729, &reduce729, nullptr};
+State state730 = {&shift730, &reduce730, nullptr};
+State state731 = {&shift731, &reduce731, nullptr};
+State state732 = {&shift732, &reduce732, nullptr};
+State state733 = {&shift733, &reduce733, nullptr};
+State state734 = {&shift734, &reduce734, nullptr};
+State state735 = {&shift735, &reduce735, nullptr};
+State state736 = {&shift736, &reduce736, nullptr};
+State state737 = {&shift737, &reduce737, nullptr};
+State state738 = {&shift738, &reduce738, nullptr};
+State state739 = {&shift739, &reduce739, nullptr};
+State state740 = {&shift740, &reduce740, nullptr};
+State state741 = {&shift741, &reduce741, nullptr};
+State state742 = {&shift742, &reduce742, nullptr};
+State state743 = {&shift743, &reduce743, nullptr};
+State state744 = {&shift744, &reduce744, nullptr};
+State state745 = {&shift745, &reduce745, nullptr};
+State state746 = {&shift746, &reduce746, nullptr};
+State state747 = {&shift747, &reduce747, nullptr};
+State state748 = {&shift748, &reduce748, nullptr};
+State state749 = {&shift749, &reduce749, nullptr};
+State state750 = {&shift750, &reduce750, nullptr};
+State state751 = {&shift751, &reduce751, nullptr};
+State state752 = {&shift752, &reduce752, nullptr};
+State state753 = {&shift753, &reduce753, nullptr};
+State state754 = {&shift754, &reduce754, nullptr};
+State state755 = {&shift755, &reduce755, nullptr};
+State state756 = {&shift756, &reduce756, nullptr};
+State state757 = {&shift757, &reduce757, nullptr};
+State state758 = {&shift758, &reduce758, nullptr};
+State state759 = {&shift759, &reduce759, nullptr};
+State state760 = {&shift760, &reduce760, nullptr};
+State state761 = {&shift761, &reduce761, nullptr};
+State state762 = {&shift762, &reduce762, nullptr};
+State state763 = {&shift763, &reduce763, nullptr};
+State state764 = {&shift764, &reduce764, nullptr};
+State state765 = {&shift765, &reduce765, nullptr};
+State state766 = {&shift766, &reduce766, nullptr};
+State state767 = {&shift767, &reduce767, nullptr};
+State state768 = {&shift768, &reduce768, nullptr};
+State state769 = {&shift769, &reduce769, nullptr};
+State state770 = {&shift770, &reduce770, nullptr};
+State state771 = {&shift771, &reduce771, nullptr};
+State state772 = {&shift772, &reduce772, nullptr};
+State state773 = {&shift773, &reduce773, nullptr};
+State state774 = {&shift774, &reduce774, nullptr};
+State state775 = {&shift775, &reduce775, nullptr};
+State state776 = {&shift776, &reduce776, nullptr};
+State state777 = {&shift777, &reduce777, nullptr};
+State state778 = {&shift778, &reduce778, nullptr};
+State state779 = {&shift779, &reduce779, nullptr};
+State state780 = {&shift780, &reduce780, nullptr};
+State state781 = {&shift781, &reduce781, nullptr};
+State state782 = {&shift782, &reduce782, nullptr};
+State state783 = {&shift783, &reduce783, nullptr};
+State state784 = {&shift784, &reduce784, nullptr};
+State state785 = {&shift785, &reduce785, nullptr};
+State state786 = {&shift786, &reduce786, nullptr};
+State state787 = {&shift787, &reduce787, nullptr};
+State state788 = {&shift788, &reduce788, nullptr};
+State state789 = {&shift789, &reduce789, nullptr};
+State state790 = {&shift790, &reduce790, nullptr};
+State state791 = {&shift791, &reduce791, nullptr};
+State state792 = {&shift792, &reduce792, nullptr};
+State state793 = {&shift793, &reduce793, nullptr};
+State state794 = {&shift794, &reduce794, nullptr};
+State state795 = {&shift795, &reduce795, nullptr};
+State state796 = {&shift796, &reduce796, nullptr};
+State state797 = {&shift797, &reduce797, nullptr};
+State state798 = {&shift798, &reduce798, nullptr};
+State state799 = {&shift799, &reduce799, nullptr};
+State state800 = {&shift800, &reduce800, nullptr};
+State state801 = {&shift801, &reduce801, nullptr};
+State state802 = {&shift802, &reduce802, nullptr};
+State state803 = {&shift803, &reduce803, nullptr};
+State state804 = {&shift804, &reduce804, nullptr};
+State state805 = {&shift805, &reduce805, nullptr};
+State state806 = {&shift806, &reduce806, nullptr};
+State state807 = {&shift807, &reduce807, nullptr};
+State state808 = {&shift808, &reduce808, nullptr};
+State state809 = {&shift809, &reduce809, nullptr};
+State state810 = {&shift810, &reduce810, nullptr};
+State state811 = {&shift811, &reduce811, nullptr};
+State state812 = {&shift812, &reduce812, nullptr};
+State state813 = {&shift813, &reduce813, nullptr};
+State state814 = {&shift814, &reduce814, nullptr};
+State state815 = {&shift815, &reduce815, nullptr};
+State state816 = {&shift816, &reduce816, nullptr};
+State state817 = {&shift817, &reduce817, nullptr};
+State state818 = {&shift818, &reduce818, nullptr};
+State state819 = {&shift819, &reduce819, nullptr};
+State state820 = {&shift820, &reduce820, nullptr};
+State state821 = {&shift821, &reduce821, nullptr};
+State state822 = {&shift822, &reduce822, nullptr};
+State state823 = {&shift823, &reduce823, nullptr};
+State state824 = {&shift824, &reduce824, nullptr};
+State state825 = {&shift825, &reduce825, nullptr};
+State state826 = {&shift826, &reduce826, nullptr};
+State state827 = {&shift827, &reduce827, nullptr};
+State state828 = {&shift828, &reduce828, nullptr};
+State state829 = {&shift829, &reduce829, nullptr};
+State state830 = {&shift830, &reduce830, nullptr};
+State state831 = {&shift831, &reduce831, nullptr};
+State state832 = {&shift832, &reduce832, nullptr};
+State state833 = {&shift833, &reduce833, nullptr};
+State state834 = {&shift834, &reduce834, nullptr};
+State state835 = {&shift835, &reduce835, nullptr};
+State state836 = {&shift836, &reduce836, nullptr};
+State state837 = {&shift837, &reduce837, nullptr};
+State state838 = {&shift838, &reduce838, nullptr};
+State state839 = {&shift839, &reduce839, nullptr};
+State state840 = {&shift840, &reduce840, nullptr};
+State state841 = {&shift841, &reduce841, nullptr};
+State state842 = {&shift842, &reduce842, nullptr};
+State state843 = {&shift843, &reduce843, nullptr};
+State state844 = {&shift844, &reduce844, nullptr};
+State state845 = {&shift845, &reduce845, nullptr};
+State state846 = {&shift846, &reduce846, nullptr};
+State state847 = {&shift847, &reduce847, nullptr};
+State state848 = {&shift848, &reduce848, nullptr};
+State state849 = {&shift849, &reduce849, nullptr};
+State state850 = {&shift850, &reduce850, nullptr};
+State state851 = {&shift851, &reduce851, nullptr};
+State state852 = {&shift852, &reduce852, nullptr};
+State state853 = {&shift853, &reduce853, nullptr};
+State state854 = {&shift854, &reduce854, nullptr};
+State state855 = {&shift855, &reduce855, nullptr};
+State state856 = {&shift856, &reduce856, nullptr};
+State state857 = {&shift857, &reduce857, nullptr};
+State state858 = {&shift858, &reduce858, nullptr};
+State state859 = {&shift859, &reduce859, nullptr};
+State state860 = {&shift860, &reduce860, nullptr};
+State state861 = {&shift861, &reduce861, nullptr};
+State state862 = {&shift862, &reduce862, nullptr};
+State state863 = {&shift863, &reduce863, nullptr};
+State state864 = {&shift864, &reduce864, nullptr};
+State state865 = {&shift865, &reduce865, nullptr};
+State state866 = {&shift866, &reduce866, nullptr};
+State state867 = {&shift867, &reduce867, nullptr};
+State state868 = {&shift868, &reduce868, nullptr};
+State state869 = {&shift869, &reduce869, nullptr};
+State state870 = {&shift870, &reduce870, nullptr};
+State state871 = {&shift871, &reduce871, nullptr};
+State state872 = {&shift872, &reduce872, nullptr};
+State state873 = {&shift873, &reduce873, nullptr};
+State state874 = {&shift874, &reduce874, nullptr};
+State state875 = {&shift875, &reduce875, nullptr};
+State state876 = {&shift876, &reduce876, nullptr};
+State state877 = {&shift877, &reduce877, nullptr};
+State state878 = {&shift878, &reduce878, nullptr};
+State state879 = {&shift879, &reduce879, nullptr};
+State state880 = {&shift880, &reduce880, nullptr};
+State state881 = {&shift881, &reduce881, nullptr};
+State state882 = {&shift882, &reduce882, nullptr};
+State state883 = {&shift883, &reduce883, nullptr};
+State state884 = {&shift884, &reduce884, nullptr};
+State state885 = {&shift885, &reduce885, nullptr};
+State state886 = {&shift886, &reduce886, nullptr};
+State state887 = {&shift887, &reduce887, nullptr};
+State state888 = {&shift888, &reduce888, nullptr};
+State state889 = {&shift889, &reduce889, nullptr};
+State state890 = {&shift890, &reduce890, nullptr};
+State state891 = {&shift891, &reduce891, nullptr};
+State state892 = {&shift892, &reduce892, nullptr};
+State state893 = {&shift893, &reduce893, nullptr};
+State state894 = {&shift894, &reduce894, nullptr};
+State state895 = {&shift895, &reduce895, nullptr};
+State state896 = {&shift896, &reduce896, nullptr};
+State state897 = {&shift897, &reduce897, nullptr};
+State state898 = {&shift898, &reduce898, nullptr};
+State state899 = {&shift899, &reduce899, nullptr};
+State state900 = {&shift900, &reduce900, nullptr};
+State state901 = {&shift901, &reduce901, nullptr};
+State state902 = {&shift902, &reduce902, nullptr};
+State state903 = {&shift903, &reduce903, nullptr};
+State state904 = {&shift904, &reduce904, nullptr};
+State state905 = {&shift905, &reduce905, nullptr};
+State state906 = {&shift906, &reduce906, nullptr};
+State state907 = {&shift907, &reduce907, nullptr};
+State state908 = {&shift908, &reduce908, nullptr};
+State state909 = {&shift909, &reduce909, nullptr};
+State state910 = {&shift910, &reduce910, nullptr};
+State state911 = {&shift911, &reduce911, nullptr};
+State state912 = {&shift912, &reduce912, nullptr};
+State state913 = {&shift913, &reduce913, nullptr};
+State state914 = {&shift914, &reduce914, nullptr};
+State state915 = {&shift915, &reduce915, nullptr};
+State state916 = {&shift916, &reduce916, nullptr};
+State state917 = {&shift917, &reduce917, nullptr};
+State state918 = {&shift918, &reduce918, nullptr};
+State state919 = {&shift919, &reduce919, nullptr};
+State state920 = {&shift920, &reduce920, nullptr};
+State state921 = {&shift921, &reduce921, nullptr};
+State state922 = {&shift922, &reduce922, nullptr};
+State state923 = {&shift923, &reduce923, nullptr};
+State state924 = {&shift924, &reduce924, nullptr};
+State state925 = {&shift925, &reduce925, nullptr};
+State state926 = {&shift926, &reduce926, nullptr};
+State state927 = {&shift927, &reduce927, nullptr};
+State state928 = {&shift928, &reduce928, nullptr};
+State state929 = {&shift929, &reduce929, nullptr};
+State state930 = {&shift930, &reduce930, nullptr};
+State state931 = {&shift931, &reduce931, nullptr};
+State state932 = {&shift932, &reduce932, nullptr};
+State state933 = {&shift933, &reduce933, nullptr};
+State state934 = {&shift934, &reduce934, nullptr};
+State state935 = {&shift935, &reduce935, nullptr};
+State state936 = {&shift936, &reduce936, nullptr};
+State state937 = {&shift937, &reduce937, nullptr};
+State state938 = {&shift938, &reduce938, nullptr};
+State state939 = {&shift939, &reduce939, nullptr};
+State state940 = {&shift940, &reduce940, nullptr};
+State state941 = {&shift941, &reduce941, nullptr};
+State state942 = {&shift942, &reduce942, nullptr};
+State state943 = {&shift943, &reduce943, nullptr};
+State state944 = {&shift944, &reduce944, nullptr};
+State state945 = {&shift945, &reduce945, nullptr};
+State state946 = {&shift946, &reduce946, nullptr};
+State state947 = {&shift947, &reduce947, nullptr};
+State state948 = {&shift948, &reduce948, nullptr};
+State state949 = {&shift949, &reduce949, nullptr};
+State state950 = {&shift950, &reduce950, nullptr};
+State state951 = {&shift951, &reduce951, nullptr};
+State state952 = {&shift952, &reduce952, nullptr};
+State state953 = {&shift953, &reduce953, nullptr};
+State state954 = {&shift954, &reduce954, nullptr};
+State state955 = {&shift955, &reduce955, nullptr};
+State state956 = {&shift956, &reduce956, nullptr};
+State state957 = {&shift957, &reduce957, nullptr};
+State state958 = {&shift958, &reduce958, nullptr};
+State state959 = {&shift959, &reduce959, nullptr};
+State state960 = {&shift960, &reduce960, nullptr};
+State state961 = {&shift961, &reduce961, nullptr};
+State state962 = {&shift962, &reduce962, nullptr};
+State state963 = {&shift963, &reduce963, nullptr};
+State state964 = {&shift964, &reduce964, nullptr};
+State state965 = {&shift965, &reduce965, nullptr};
+State state966 = {&shift966, &reduce966, nullptr};
+State state967 = {&shift967, &reduce967, nullptr};
+State state968 = {&shift968, &reduce968, nullptr};
+State state969 = {&shift969, &reduce969, nullptr};
+State state970 = {&shift970, &reduce970, nullptr};
+State state971 = {&shift971, &reduce971, nullptr};
+State state972 = {&shift972, &reduce972, nullptr};
+State state973 = {&shift973, &reduce973, nullptr};
+State state974 = {&shift974, &reduce974, nullptr};
+State state975 = {&shift975, &reduce975, nullptr};
+State state976 = {&shift976, &reduce976, nullptr};
+State state977 = {&shift977, &reduce977, nullptr};
+State state978 = {&shift978, &reduce978, nullptr};
+State state979 = {&shift979, &reduce979, nullptr};
+State state980 = {&shift980, &reduce980, nullptr};
+State state981 = {&shift981, &reduce981, nullptr};
+State state982 = {&shift982, &reduce982, nullptr};
+State state983 = {&shift983, &reduce983, nullptr};
+State state984 = {&shift984, &reduce984, nullptr};
+State state985 = {&shift985, &reduce985, nullptr};
+State state986 = {&shift986, &reduce986, nullptr};
+State state987 = {&shift987, &reduce987, nullptr};
+State state988 = {&shift988, &reduce988, nullptr};
+State state989 = {&shift989, &reduce989, nullptr};
+State state990 = {&shift990, &reduce990, nullptr};
+State state991 = {&shift991, &reduce991, nullptr};
+State state992 = {&shift992, &reduce992, nullptr};
+State state993 = {&shift993, &reduce993, nullptr};
+State state994 = {&shift994, &reduce994, nullptr};
+State state995 = {&shift995, &reduce995, nullptr};
+State state996 = {&shift996, &reduce996, nullptr};
+State state997 = {&shift997, &reduce997, nullptr};
+State state998 = {&shift998, &reduce998, nullptr};
+State state999 = {&shift999, &reduce999, nullptr};
+State state1000 = {&shift1000, &reduce1000, nullptr};
+State state1001 = {&shift1001, &reduce1001, nullptr};
+State state1002 = {&shift1002, &reduce1002, nullptr};
+State state1003 = {&shift1003, &reduce1003, nullptr};
+State state1004 = {&shift1004, &reduce1004, nullptr};
+State state1005 = {&shift1005, &reduce1005, nullptr};
+State state1006 = {&shift1006, &reduce1006, nullptr};
+State state1007 = {&shift1007, &reduce1007, nullptr};
+State state1008 = {&shift1008, &reduce1008, nullptr};
+State state1009 = {&shift1009, &reduce1009, nullptr};
+State state1010 = {&shift1010, &reduce1010, nullptr};
+State state1011 = {&shift1011, &reduce1011, nullptr};
+State state1012 = {&shift1012, &reduce1012, nullptr};
+State state1013 = {&shift1013, &reduce1013, nullptr};
+State state1014 = {&shift1014, &reduce1014, nullptr};
+State state1015 = {&shift1015, &reduce1015, nullptr};
+State state1016 = {&shift1016, &reduce1016, nullptr};
+State state1017 = {&shift1017, &reduce1017, nullptr};
+State state1018 = {&shift1018, &reduce1018, nullptr};
+State state1019 = {&shift1019, &reduce1019, nullptr};
+State state1020 = {&shift1020, &reduce1020, nullptr};
+State state1021 = {&shift1021, &reduce1021, nullptr};
+State state1022 = {&shift1022, &reduce1022, nullptr};
+State state1023 = {&shift1023, &reduce1023, nullptr};
+State state1024 = {&shift1024, &reduce1024, nullptr};
+State state1025 = {&shift1025, &reduce1025, nullptr};
+State state1026 = {&shift1026, &reduce1026, nullptr};
+State state1027 = {&shift1027, &reduce1027, nullptr};
+State state1028 = {&shift1028, &reduce1028, nullptr};
+State state1029 = {&shift1029, &reduce1029, nullptr};
+State state1030 = {&shift1030, &reduce1030, nullptr};
+State state1031 = {&shift1031, &reduce1031, nullptr};
+State state1032 = {&shift1032, &reduce1032, nullptr};
+State state1033 = {&shift1033, &reduce1033, nullptr};
+State state1034 = {&shift1034, &reduce1034, nullptr};
+State state1035 = {&shift1035, &reduce1035, nullptr};
+State state1036 = {&shift1036, &reduce1036, nullptr};
+State state1037 = {&shift1037, &reduce1037, nullptr};
+State state1038 = {&shift1038, &reduce1038, nullptr};
+State state1039 = {&shift1039, &reduce1039, nullptr};
+State state1040 = {&shift1040, &reduce1040, nullptr};
+State state1041 = {&shift1041, &reduce1041, nullptr};
+State state1042 = {&shift1042, &reduce1042, nullptr};
+State state1043 = {&shift1043, &reduce1043, nullptr};
+State state1044 = {&shift1044, &reduce1044, nullptr};
+State state1045 = {&shift1045, &reduce1045, nullptr};
+State state1046 = {&shift1046, &reduce1046, nullptr};
+State state1047 = {&shift1047, &reduce1047, nullptr};
+State state1048 = {&shift1048, &reduce1048, nullptr};
+State state1049 = {&shift1049, &reduce1049, nullptr};
+State state1050 = {&shift1050, &reduce1050, nullptr};
+State state1051 = {&shift1051, &reduce1051, nullptr};
+State state1052 = {&shift1052, &reduce1052, nullptr};
+State state1053 = {&shift1053, &reduce1053, nullptr};
+State state1054 = {&shift1054, &reduce1054, nullptr};
+State state1055 = {&shift1055, &reduce1055, nullptr};
+State state1056 = {&shift1056, &reduce1056, nullptr};
+State state1057 = {&shift1057, &reduce1057, nullptr};
+State state1058 = {&shift1058, &reduce1058, nullptr};
+State state1059 = {&shift1059, &reduce1059, nullptr};
+State state1060 = {&shift1060, &reduce1060, nullptr};
+State state1061 = {&shift1061, &reduce1061, nullptr};
+State state1062 = {&shift1062, &reduce1062, nullptr};
+State state1063 = {&shift1063, &reduce1063, nullptr};
+State state1064 = {&shift1064, &reduce1064, nullptr};
+State state1065 = {&shift1065, &reduce1065, nullptr};
+State state1066 = {&shift1066, &reduce1066, nullptr};
+State state1067 = {&shift1067, &reduce1067, nullptr};
+State state1068 = {&shift1068, &reduce1068, nullptr};
+State state1069 = {&shift1069, &reduce1069, nullptr};
+State state1070 = {&shift1070, &reduce1070, nullptr};
+State state1071 = {&shift1071, &reduce1071, nullptr};
+State state1072 = {&shift1072, &reduce1072, nullptr};
+State state1073 = {&shift1073, &reduce1073, nullptr};
+State state1074 = {&shift1074, &reduce1074, nullptr};
+State state1075 = {&shift1075, &reduce1075, nullptr};
+State state1076 = {&shift1076, &reduce1076, nullptr};
+State state1077 = {&shift1077, &reduce1077, nullptr};
+State state1078 = {&shift1078, &reduce1078, nullptr};
+State state1079 = {&shift1079, &reduce1079, nullptr};
+State state1080 = {&shift1080, &reduce1080, nullptr};
+State state1081 = {&shift1081, &reduce1081, nullptr};
+State state1082 = {&shift1082, &reduce1082, nullptr};
+State state1083 = {&shift1083, &reduce1083, nullptr};
+State state1084 = {&shift1084, &reduce1084, nullptr};
+State state1085 = {&shift1085, &reduce1085, nullptr};
+State state1086 = {&shift1086, &reduce1086, nullptr};
+State state1087 = {&shift1087, &reduce1087, nullptr};
+State state1088 = {&shift1088, &reduce1088, nullptr};
+State state1089 = {&shift1089, &reduce1089, nullptr};
+State state1090 = {&shift1090, &reduce1090, nullptr};
+State state1091 = {&shift1091, &reduce1091, nullptr};
+State state1092 = {&shift1092, &reduce1092, nullptr};
+State state1093 = {&shift1093, &reduce1093, nullptr};
+State state1094 = {&shift1094, &reduce1094, nullptr};
+State state1095 = {&shift1095, &reduce1095, nullptr};
+State state1096 = {&shift1096, &reduce1096, nullptr};
+State state1097 = {&shift1097, &reduce1097, nullptr};
+State state1098 = {&shift1098, &reduce1098, nullptr};
+State state1099 = {&shift1099, &reduce1099, nullptr};
+State state1100 = {&shift1100, &reduce1100, nullptr};
+State state1101 = {&shift1101, &reduce1101, nullptr};
+State state1102 = {&shift1102, &reduce1102, nullptr};
+State state1103 = {&shift1103, &reduce1103, nullptr};
+State state1104 = {&shift1104, &reduce1104, nullptr};
+State state1105 = {&shift1105, &reduce1105, nullptr};
+State state1106 = {&shift1106, &reduce1106, nullptr};
+State state1107 = {&shift1107, &reduce1107, nullptr};
+State state1108 = {&shift1108, &reduce1108, nullptr};
+State state1109 = {&shift1109, &reduce1109, nullptr};
+State state1110 = {&shift1110, &reduce1110, nullptr};
+State state1111 = {&shift1111, &reduce1111, nullptr};
+State state1112 = {&shift1112, &reduce1112, nullptr};
+State state1113 = {&shift1113, &reduce1113, nullptr};
+State state1114 = {&shift1114, &reduce1114, nullptr};
+State state1115 = {&shift1115, &reduce1115, nullptr};
+State state1116 = {&shift1116, &reduce1116, nullptr};
+State state1117 = {&shift1117, &reduce1117, nullptr};
+State state1118 = {&shift1118, &reduce1118, nullptr};
+State state1119 = {&shift1119, &reduce1119, nullptr};
+State state1120 = {&shift1120, &reduce1120, nullptr};
+State state1121 = {&shift1121, &reduce1121, nullptr};
+State state1122 = {&shift1122, &reduce1122, nullptr};
+State state1123 = {&shift1123, &reduce1123, nullptr};
+State state1124 = {&shift1124, &reduce1124, nullptr};
+State state1125 = {&shift1125, &reduce1125, nullptr};
+State state1126 = {&shift1126, &reduce1126, nullptr};
+State state1127 = {&shift1127, &reduce1127, nullptr};
+State state1128 = {&shift1128, &reduce1128, nullptr};
+State state1129 = {&shift1129, &reduce1129, nullptr};
+State state1130 = {&shift1130, &reduce1130, nullptr};
+State state1131 = {&shift1131, &reduce1131, nullptr};
+State state1132 = {&shift1132, &reduce1132, nullptr};
+State state1133 = {&shift1133, &reduce1133, nullptr};
+State state1134 = {&shift1134, &reduce1134, nullptr};
+State state1135 = {&shift1135, &reduce1135, nullptr};
+State state1136 = {&shift1136, &reduce1136, nullptr};
+State state1137 = {&shift1137, &reduce1137, nullptr};
+State state1138 = {&shift1138, &reduce1138, nullptr};
+State state1139 = {&shift1139, &reduce1139, nullptr};
+State state1140 = {&shift1140, &reduce1140, nullptr};
+State state1141 = {&shift1141, &reduce1141, nullptr};
+State state1142 = {&shift1142, &reduce1142, nullptr};
+State state1143 = {&shift1143, &reduce1143, nullptr};
+State state1144 = {&shift1144, &reduce1144, nullptr};
+State state1145 = {&shift1145, &reduce1145, nullptr};
+State state1146 = {&shift1146, &reduce1146, nullptr};
+State state1147 = {&shift1147, &reduce1147, nullptr};
+State state1148 = {&shift1148, &reduce1148, nullptr};
+State state1149 = {&shift1149, &reduce1149, nullptr};
+State state1150 = {&shift1150, &reduce1150, nullptr};
+State state1151 = {&shift1151, &reduce1151, nullptr};
+State state1152 = {&shift1152, &reduce1152, nullptr};
+State state1153 = {&shift1153, &reduce1153, nullptr};
+State state1154 = {&shift1154, &reduce1154, nullptr};
+State state1155 = {&shift1155, &reduce1155, nullptr};
+State state1156 = {&shift1156, &reduce1156, nullptr};
+State state1157 = {&shift1157, &reduce1157, nullptr};
+State state1158 = {&shift1158, &reduce1158, nullptr};
+State state1159 = {&shift1159, &reduce1159, nullptr};
+State state1160 = {&shift1160, &reduce1160, nullptr};
+State state1161 = {&shift1161, &reduce1161, nullptr};
+State state1162 = {&shift1162, &reduce1162, nullptr};
+State state1163 = {&shift1163, &reduce1163, nullptr};
+State state1164 = {&shift1164, &reduce1164, nullptr};
+State state1165 = {&shift1165, &reduce1165, nullptr};
+State state1166 = {&shift1166, &reduce1166, nullptr};
+State state1167 = {&shift1167, &reduce1167, nullptr};
+State state1168 = {&shift1168, &reduce1168, nullptr};
+State state1169 = {&shift1169, &reduce1169, nullptr};
+State state1170 = {&shift1170, &reduce1170, nullptr};
+State state1171 = {&shift1171, &reduce1171, nullptr};
+State state1172 = {&shift1172, &reduce1172, nullptr};
+State state1173 = {&shift1173, &reduce1173, nullptr};
+State state1174 = {&shift1174, &reduce1174, nullptr};
+State state1175 = {&shift1175, &reduce1175, nullptr};
+State state1176 = {&shift1176, &reduce1176, nullptr};
+State state1177 = {&shift1177, &reduce1177, nullptr};
+State state1178 = {&shift1178, &reduce1178, nullptr};
+State state1179 = {&shift1179, &reduce1179, nullptr};
+State state1180 = {&shift1180, &reduce1180, nullptr};
+State state1181 = {&shift1181, &reduce1181, nullptr};
+State state1182 = {&shift1182, &reduce1182, nullptr};
+State state1183 = {&shift1183, &reduce1183, nullptr};
+State state1184 = {&shift1184, &reduce1184, nullptr};
+State state1185 = {&shift1185, &reduce1185, nullptr};
+State state1186 = {&shift1186, &reduce1186, nullptr};
+State state1187 = {&shift1187, &reduce1187, nullptr};
+State state1188 = {&shift1188, &reduce1188, nullptr};
+State state1189 = {&shift1189, &reduce1189, nullptr};
+State state1190 = {&shift1190, &reduce1190, nullptr};
+State state1191 = {&shift1191, &reduce1191, nullptr};
+State state1192 = {&shift1192, &reduce1192, nullptr};
+State state1193 = {&shift1193, &reduce1193, nullptr};
+State state1194 = {&shift1194, &reduce1194, nullptr};
+State state1195 = {&shift1195, &reduce1195, nullptr};
+State state1196 = {&shift1196, &reduce1196, nullptr};
+State state1197 = {&shift1197, &reduce1197, nullptr};
+State state1198 = {&shift1198, &reduce1198, nullptr};
+State state1199 = {&shift1199, &reduce1199, nullptr};
+State state1200 = {&shift1200, &reduce1200, nullptr};
+State state1201 = {&shift1201, &reduce1201, nullptr};
+State state1202 = {&shift1202, &reduce1202, nullptr};
+State state1203 = {&shift1203, &reduce1203, nullptr};
+State state1204 = {&shift1204, &reduce1204, nullptr};
+State state1205 = {&shift1205, &reduce1205, nullptr};
+State state1206 = {&shift1206, &reduce1206, nullptr};
+State state1207 = {&shift1207, &reduce1207, nullptr};
+State state1208 = {&shift1208, &reduce1208, nullptr};
+State state1209 = {&shift1209, &reduce1209, nullptr};
+State state1210 = {&shift1210, &reduce1210, nullptr};
+State state1211 = {&shift1211, &reduce1211, nullptr};
+State state1212 = {&shift1212, &reduce1212, nullptr};
+State state1213 = {&shift1213, &reduce1213, nullptr};
+State state1214 = {&shift1214, &reduce1214, nullptr};
+State state1215 = {&shift1215, &reduce1215, nullptr};
+State state1216 = {&shift1216, &reduce1216, nullptr};
+State state1217 = {&shift1217, &reduce1217, nullptr};
+State state1218 = {&shift1218, &reduce1218, nullptr};
+State state1219 = {&shift1219, &reduce1219, nullptr};
+State state1220 = {&shift1220, &reduce1220, nullptr};
+State state1221 = {&shift1221, &reduce1221, nullptr};
+State state1222 = {&shift1222, &reduce1222, nullptr};
+State state1223 = {&shift1223, &reduce1223, nullptr};
+State state1224 = {&shift1224, &reduce1224, nullptr};
+State state1225 = {&shift1225, &reduce1225, nullptr};
+State state1226 = {&shift1226, &reduce1226, nullptr};
+State state1227 = {&shift1227, &reduce1227, nullptr};
+State state1228 = {&shift1228, &reduce1228, nullptr};
+State state1229 = {&shift1229, &reduce1229, nullptr};
+State state1230 = {&shift1230, &reduce1230, nullptr};
+State state1231 = {&shift1231, &reduce1231, nullptr};
+State state1232 = {&shift1232, &reduce1232, nullptr};
+State state1233 = {&shift1233, &reduce1233, nullptr};
+State state1234 = {&shift1234, &reduce1234, nullptr};
+State state1235 = {&shift1235, &reduce1235, nullptr};
+State state1236 = {&shift1236, &reduce1236, nullptr};
+State state1237 = {&shift1237, &reduce1237, nullptr};
+State state1238 = {&shift1238, &reduce1238, nullptr};
+State state1239 = {&shift1239, &reduce1239, nullptr};
+State state1240 = {&shift1240, &reduce1240, nullptr};
+State state1241 = {&shift1241, &reduce1241, nullptr};
+State state1242 = {&shift1242, &reduce1242, nullptr};
+State state1243 = {&shift1243, &reduce1243, nullptr};
+State state1244 = {&shift1244, &reduce1244, nullptr};
+State state1245 = {&shift1245, &reduce1245, nullptr};
+State state1246 = {&shift1246, &reduce1246, nullptr};
+State state1247 = {&shift1247, &reduce1247, nullptr};
+State state1248 = {&shift1248, &reduce1248, nullptr};
+State state1249 = {&shift1249, &reduce1249, nullptr};
+State state1250 = {&shift1250, &reduce1250, nullptr};
+State state1251 = {&shift1251, &reduce1251, nullptr};
+State state1252 = {&shift1252, &reduce1252, nullptr};
+State state1253 = {&shift1253, &reduce1253, nullptr};
+State state1254 = {&shift1254, &reduce1254, nullptr};
+State state1255 = {&shift1255, &reduce1255, nullptr};
+State state1256 = {&shift1256, &reduce1256, nullptr};
+State state1257 = {&shift1257, &reduce1257, nullptr};
+State state1258 = {&shift1258, &reduce1258, nullptr};
+State state1259 = {&shift1259, &reduce1259, nullptr};
+State state1260 = {&shift1260, &reduce1260, nullptr};
+State state1261 = {&shift1261, &reduce1261, nullptr};
+State state1262 = {&shift1262, &reduce1262, nullptr};
+State state1263 = {&shift1263, &reduce1263, nullptr};
+State state1264 = {&shift1264, &reduce1264, nullptr};
+State state1265 = {&shift1265, &reduce1265, nullptr};
+State state1266 = {&shift1266, &reduce1266, nullptr};
+State state1267 = {&shift1267, &reduce1267, nullptr};
+State state1268 = {&shift1268, &reduce1268, nullptr};
+State state1269 = {&shift1269, &reduce1269, nullptr};
+State state1270 = {&shift1270, &reduce1270, nullptr};
+State state1271 = {&shift1271, &reduce1271, nullptr};
+State state1272 = {&shift1272, &reduce1272, nullptr};
+State state1273 = {&shift1273, &reduce1273, nullptr};
+State state1274 = {&shift1274, &reduce1274, nullptr};
+State state1275 = {&shift1275, &reduce1275, nullptr};
+State state1276 = {&shift1276, &reduce1276, nullptr};
+State state1277 = {&shift1277, &reduce1277, nullptr};
+State state1278 = {&shift1278, &reduce1278, nullptr};
+State state1279 = {&shift1279, &reduce1279, nullptr};
+State state1280 = {&shift1280, &reduce1280, nullptr};
+State state1281 = {&shift1281, &reduce1281, nullptr};
+State state1282 = {&shift1282, &reduce1282, nullptr};
+State state1283 = {&shift1283, &reduce1283, nullptr};
+State state1284 = {&shift1284, &reduce1284, nullptr};
+State state1285 = {&shift1285, &reduce1285, nullptr};
+State state1286 = {&shift1286, &reduce1286, nullptr};
+State state1287 = {&shift1287, &reduce1287, nullptr};
+State state1288 = {&shift1288, &reduce1288, nullptr};
+State state1289 = {&shift1289, &reduce1289, nullptr};
+State state1290 = {&shift1290, &reduce1290, nullptr};
+State state1291 = {&shift1291, &reduce1291, nullptr};
+State state1292 = {&shift1292, &reduce1292, nullptr};
+State state1293 = {&shift1293, &reduce1293, nullptr};
+State state1294 = {&shift1294, &reduce1294, nullptr};
+State state1295 = {&shift1295, &reduce1295, nullptr};
+State state1296 = {&shift1296, &reduce1296, nullptr};
+State state1297 = {&shift1297, &reduce1297, nullptr};
+State state1298 = {&shift1298, &reduce1298, nullptr};
+State state1299 = {&shift1299, &reduce1299, nullptr};
+State state1300 = {&shift1300, &reduce1300, nullptr};
+State state1301 = {&shift1301, &reduce1301, nullptr};
+State state1302 = {&shift1302, &reduce1302, nullptr};
+State state1303 = {&shift1303, &reduce1303, nullptr};
+State state1304 = {&shift1304, &reduce1304, nullptr};
+State state1305 = {&shift1305, &reduce1305, nullptr};
+State state1306 = {&shift1306, &reduce1306, nullptr};
+State state1307 = {&shift1307, &reduce1307, nullptr};
+State state1308 = {&shift1308, &reduce1308, nullptr};
+State state1309 = {&shift1309, &reduce1309, nullptr};
+State state1310 = {&shift1310, &reduce1310, nullptr};
+State state1311 = {&shift1311, &reduce1311, nullptr};
+State state1312 = {&shift1312, &reduce1312, nullptr};
+State state1313 = {&shift1313, &reduce1313, nullptr};
+State state1314 = {&shift1314, &reduce1314, nullptr};
+State state1315 = {&shift1315, &reduce1315, nullptr};
+State state1316 = {&shift1316, &reduce1316, nullptr};
+State state1317 = {&shift1317, &reduce1317, nullptr};
+State state1318 = {&shift1318, &reduce1318, nullptr};
+State state1319 = {&shift1319, &reduce1319, nullptr};
+State state1320 = {&shift1320, &reduce1320, nullptr};
+State state1321 = {&shift1321, &reduce1321, nullptr};
+State state1322 = {&shift1322, &reduce1322, nullptr};
+State state1323 = {&shift1323, &reduce1323, nullptr};
+State state1324 = {&shift1324, &reduce1324, nullptr};
+State state1325 = {&shift1325, &reduce1325, nullptr};
+State state1326 = {&shift1326, &reduce1326, nullptr};
+State state1327 = {&shift1327, &reduce1327, nullptr};
+State state1328 = {&shift1328, &reduce1328, nullptr};
+State state1329 = {&shift1329, &reduce1329, nullptr};
+State state1330 = {&shift1330, &reduce1330, nullptr};
+State state1331 = {&shift1331, &reduce1331, nullptr};
+State state1332 = {&shift1332, &reduce1332, nullptr};
+State state1333 = {&shift1333, &reduce1333, nullptr};
+State state1334 = {&shift1334, &reduce1334, nullptr};
+State state1335 = {&shift1335, &reduce1335, nullptr};
+State state1336 = {&shift1336, &reduce1336, nullptr};
+State state1337 = {&shift1337, &reduce1337, nullptr};
+State state1338 = {&shift1338, &reduce1338, nullptr};
+State state1339 = {&shift1339, &reduce1339, nullptr};
+State state1340 = {&shift1340, &reduce1340, nullptr};
+State state1341 = {&shift1341, &reduce1341, nullptr};
+State state1342 = {&shift1342, &reduce1342, nullptr};
+State state1343 = {&shift1343, &reduce1343, nullptr};
+State state1344 = {&shift1344, &reduce1344, nullptr};
+State state1345 = {&shift1345, &reduce1345, nullptr};
+State state1346 = {&shift1346, &reduce1346, nullptr};
+State state1347 = {&shift1347, &reduce1347, nullptr};
+State state1348 = {&shift1348, &reduce1348, nullptr};
+State state1349 = {&shift1349, &reduce1349, nullptr};
+State state1350 = {&shift1350, &reduce1350, nullptr};
+State state1351 = {&shift1351, &reduce1351, nullptr};
+State state1352 = {&shift1352, &reduce1352, nullptr};
+State state1353 = {&shift1353, &reduce1353, nullptr};
+State state1354 = {&shift1354, &reduce1354, nullptr};
+State state1355 = {&shift1355, &reduce1355, nullptr};
+State state1356 = {&shift1356, &reduce1356, nullptr};
+State state1357 = {&shift1357, &reduce1357, nullptr};
+State state1358 = {&shift1358, &reduce1358, nullptr};
+State state1359 = {&shift1359, &reduce1359, nullptr};
+State state1360 = {&shift1360, &reduce1360, nullptr};
+State state1361 = {&shift1361, &reduce1361, nullptr};
+State state1362 = {&shift1362, &reduce1362, nullptr};
+State state1363 = {&shift1363, &reduce1363, nullptr};
+State state1364 = {&shift1364, &reduce1364, nullptr};
+State state1365 = {&shift1365, &reduce1365, nullptr};
+State state1366 = {&shift1366, &reduce1366, nullptr};
+State state1367 = {&shift1367, &reduce1367, nullptr};
+State state1368 = {&shift1368, &reduce1368, nullptr};
+State state1369 = {&shift1369, &reduce1369, nullptr};
+State state1370 = {&shift1370, &reduce1370, nullptr};
+State state1371 = {&shift1371, &reduce1371, nullptr};
+State state1372 = {&shift1372, &reduce1372, nullptr};
+State state1373 = {&shift1373, &reduce1373, nullptr};
+State state1374 = {&shift1374, &reduce1374, nullptr};
+State state1375 = {&shift1375, &reduce1375, nullptr};
+State state1376 = {&shift1376, &reduce1376, nullptr};
+State state1377 = {&shift1377, &reduce1377, nullptr};
+State state1378 = {&shift1378, &reduce1378, nullptr};
+State state1379 = {&shift1379, &reduce1379, nullptr};
+State state1380 = {&shift1380, &reduce1380, nullptr};
+State state1381 = {&shift1381, &reduce1381, nullptr};
+State state1382 = {&shift1382, &reduce1382, nullptr};
+State state1383 = {&shift1383, &reduce1383, nullptr};
+State state1384 = {&shift1384, &reduce1384, nullptr};
+State state1385 = {&shift1385, &reduce1385, nullptr};
+State state1386 = {&shift1386, &reduce1386, nullptr};
+State state1387 = {&shift1387, &reduce1387, nullptr};
+State state1388 = {&shift1388, &reduce1388, nullptr};
+State state1389 = {&shift1389, &reduce1389, nullptr};
+State state1390 = {&shift1390, &reduce1390, nullptr};
+State state1391 = {&shift1391, &reduce1391, nullptr};
+State state1392 = {&shift1392, &reduce1392, nullptr};
+State state1393 = {&shift1393, &reduce1393, nullptr};
+State state1394 = {&shift1394, &reduce1394, nullptr};
+State state1395 = {&shift1395, &reduce1395, nullptr};
+State state1396 = {&shift1396, &reduce1396, nullptr};
+State state1397 = {&shift1397, &reduce1397, nullptr};
+State state1398 = {&shift1398, &reduce1398, nullptr};
+State state1399 = {&shift1399, &reduce1399, nullptr};
+State state1400 = {&shift1400, &reduce1400, nullptr};
+State state1401 = {&shift1401, &reduce1401, nullptr};
+State state1402 = {&shift1402, &reduce1402, nullptr};
+State state1403 = {&shift1403, &reduce1403, nullptr};
+State state1404 = {&shift1404, &reduce1404, nullptr};
+State state1405 = {&shift1405, &reduce1405, nullptr};
+State state1406 = {&shift1406, &reduce1406, nullptr};
+State state1407 = {&shift1407, &reduce1407, nullptr};
+State state1408 = {&shift1408, &reduce1408, nullptr};
+State state1409 = {&shift1409, &reduce1409, nullptr};
+State state1410 = {&shift1410, &reduce1410, nullptr};
+State state1411 = {&shift1411, &reduce1411, nullptr};
+State state1412 = {&shift1412, &reduce1412, nullptr};
+State state1413 = {&shift1413, &reduce1413, nullptr};
+State state1414 = {&shift1414, &reduce1414, nullptr};
+State state1415 = {&shift1415, &reduce1415, nullptr};
+State state1416 = {&shift1416, &reduce1416, nullptr};
+State state1417 = {&shift1417, &reduce1417, nullptr};
+State state1418 = {&shift1418, &reduce1418, nullptr};
+State state1419 = {&shift1419, &reduce1419, nullptr};
+State state1420 = {&shift1420, &reduce1420, nullptr};
+State state1421 = {&shift1421, &reduce1421, nullptr};
+State state1422 = {&shift1422, &reduce1422, nullptr};
+State state1423 = {&shift1423, &reduce1423, nullptr};
+State state1424 = {&shift1424, &reduce1424, nullptr};
+State state1425 = {&shift1425, &reduce1425, nullptr};
+State state1426 = {&shift1426, &reduce1426, nullptr};
+State state1427 = {&shift1427, &reduce1427, nullptr};
+State state1428 = {&shift1428, &reduce1428, nullptr};
+State state1429 = {&shift1429, &reduce1429, nullptr};
+State state1430 = {&shift1430, &reduce1430, nullptr};
+State state1431 = {&shift1431, &reduce1431, nullptr};
+State state1432 = {&shift1432, &reduce1432, nullptr};
+State state1433 = {&shift1433, &reduce1433, nullptr};
+State state1434 = {&shift1434, &reduce1434, nullptr};
+State state1435 = {&shift1435, &reduce1435, nullptr};
+State state1436 = {&shift1436, &reduce1436, nullptr};
+State state1437 = {&shift1437, &reduce1437, nullptr};
+State state1438 = {&shift1438, &reduce1438, nullptr};
+State state1439 = {&shift1439, &reduce1439, nullptr};
+State state1440 = {&shift1440, &reduce1440, nullptr};
+State state1441 = {&shift1441, &reduce1441, nullptr};
+State state1442 = {&shift1442, &reduce1442, nullptr};
+State state1443 = {&shift1443, &reduce1443, nullptr};
+State state1444 = {&shift1444, &reduce1444, nullptr};
+State state1445 = {&shift1445, &reduce1445, nullptr};
+State state1446 = {&shift1446, &reduce1446, nullptr};
+State state1447 = {&shift1447, &reduce1447, nullptr};
+State state1448 = {&shift1448, &reduce1448, nullptr};
+State state1449 = {&shift1449, &reduce1449, nullptr};
+State state1450 = {&shift1450, &reduce1450, nullptr};
+State state1451 = {&shift1451, &reduce1451, nullptr};
+State state1452 = {&shift1452, &reduce1452, nullptr};
+State state1453 = {&shift1453, &reduce1453, nullptr};
+State state1454 = {&shift1454, &reduce1454, nullptr};
+State state1455 = {&shift1455, &reduce1455, nullptr};
+State state1456 = {&shift1456, &reduce1456, nullptr};
+State state1457 = {&shift1457, &reduce1457, nullptr};
+State state1458 = {&shift1458, &reduce1458, nullptr};
+State state1459 = {&shift1459, &reduce1459, nullptr};
+State state1460 = {&shift1460, &reduce1460, nullptr};
+State state1461 = {&shift1461, &reduce1461, nullptr};
+State state1462 = {&shift1462, &reduce1462, nullptr};
+State state1463 = {&shift1463, &reduce1463, nullptr};
+State state1464 = {&shift1464, &reduce1464, nullptr};
+State state1465 = {&shift1465, &reduce1465, nullptr};
+State state1466 = {&shift1466, &reduce1466, nullptr};
+State state1467 = {&shift1467, &reduce1467, nullptr};
+State state1468 = {&shift1468, &reduce1468, nullptr};
+State state1469 = {&shift1469, &reduce1469, nullptr};
+State state1470 = {&shift1470, &reduce1470, nullptr};
+State state1471 = {&shift1471, &reduce1471, nullptr};
+State state1472 = {&shift1472, &reduce1472, nullptr};
+State state1473 = {&shift1473, &reduce1473, nullptr};
+State state1474 = {&shift1474, &reduce1474, nullptr};
+State state1475 = {&shift1475, &reduce1475, nullptr};
+State state1476 = {&shift1476, &reduce1476, nullptr};
+State state1477 = {&shift1477, &reduce1477, nullptr};
+State state1478 = {&shift1478, &reduce1478, nullptr};
+State state1479 = {&shift1479, &reduce1479, nullptr};
+State state1480 = {&shift1480, &reduce1480, nullptr};
+State state1481 = {&shift1481, &reduce1481, nullptr};
+State state1482 = {&shift1482, &reduce1482, nullptr};
+State state1483 = {&shift1483, &reduce1483, nullptr};
+State state1484 = {&shift1484, &reduce1484, nullptr};
+State state1485 = {&shift1485, &reduce1485, nullptr};
+State state1486 = {&shift1486, &reduce1486, nullptr};
+State state1487 = {&shift1487, &reduce1487, nullptr};
+State state1488 = {&shift1488, &reduce1488, nullptr};
+State state1489 = {&shift1489, &reduce1489, nullptr};
+State state1490 = {&shift1490, &reduce1490, nullptr};
+State state1491 = {&shift1491, &reduce1491, nullptr};
+State state1492 = {&shift1492, &reduce1492, nullptr};
+State state1493 = {&shift1493, &reduce1493, nullptr};
+State state1494 = {&shift1494, &reduce1494, nullptr};
+State state1495 = {&shift1495, &reduce1495, nullptr};
+State state1496 = {&shift1496, &reduce1496, nullptr};
+State state1497 = {&shift1497, &reduce1497, nullptr};
+State state1498 = {&shift1498, &reduce1498, nullptr};
+State state1499 = {&shift1499, &reduce1499, nullptr};
+State state1500 = {&shift1500, &reduce1500, nullptr};
+State state1501 = {&shift1501, &reduce1501, nullptr};
+State state1502 = {&shift1502, &reduce1502, nullptr};
+State state1503 = {&shift1503, &reduce1503, nullptr};
+State state1504 = {&shift1504, &reduce1504, nullptr};
+State state1505 = {&shift1505, &reduce1505, nullptr};
+State state1506 = {&shift1506, &reduce1506, nullptr};
+State state1507 = {&shift1507, &reduce1507, nullptr};
+State state1508 = {&shift1508, &reduce1508, nullptr};
+State state1509 = {&shift1509, &reduce1509, nullptr};
+State state1510 = {&shift1510, &reduce1510, nullptr};
+State state1511 = {&shift1511, &reduce1511, nullptr};
+State state1512 = {&shift1512, &reduce1512, nullptr};
+State state1513 = {&shift1513, &reduce1513, nullptr};
+State state1514 = {&shift1514, &reduce1514, nullptr};
+State state1515 = {&shift1515, &reduce1515, nullptr};
+State state1516 = {&shift1516, &reduce1516, nullptr};
+State state1517 = {&shift1517, &reduce1517, nullptr};
+State state1518 = {&shift1518, &reduce1518, nullptr};
+State state1519 = {&shift1519, &reduce1519, nullptr};
+State state1520 = {&shift1520, &reduce1520, nullptr};
+State state1521 = {&shift1521, &reduce1521, nullptr};
+State state1522 = {&shift1522, &reduce1522, nullptr};
+State state1523 = {&shift1523, &reduce1523, nullptr};
+State state1524 = {&shift1524, &reduce1524, nullptr};
+State state1525 = {&shift1525, &reduce1525, nullptr};
+State state1526 = {&shift1526, &reduce1526, nullptr};
+State state1527 = {&shift1527, &reduce1527, nullptr};
+State state1528 = {&shift1528, &reduce1528, nullptr};
+State state1529 = {&shift1529, &reduce1529, nullptr};
+State state1530 = {&shift1530, &reduce1530, nullptr};
+State state1531 = {&shift1531, &reduce1531, nullptr};
+State state1532 = {&shift1532, &reduce1532, nullptr};
+State state1533 = {&shift1533, &reduce1533, nullptr};
+State state1534 = {&shift1534, &reduce1534, nullptr};
+State state1535 = {&shift1535, &reduce1535, nullptr};
+State state1536 = {&shift1536, &reduce1536, nullptr};
+State state1537 = {&shift1537, &reduce1537, nullptr};
+State state1538 = {&shift1538, &reduce1538, nullptr};
+State state1539 = {&shift1539, &reduce1539, nullptr};
+State state1540 = {&shift1540, &reduce1540, nullptr};
+State state1541 = {&shift1541, &reduce1541, nullptr};
+State state1542 = {&shift1542, &reduce1542, nullptr};
+State state1543 = {&shift1543, &reduce1543, nullptr};
+State state1544 = {&shift1544, &reduce1544, nullptr};
+State state1545 = {&shift1545, &reduce1545, nullptr};
+State state1546 = {&shift1546, &reduce1546, nullptr};
+State state1547 = {&shift1547, &reduce1547, nullptr};
+State state1548 = {&shift1548, &reduce1548, nullptr};
+State state1549 = {&shift1549, &reduce1549, nullptr};
+State state1550 = {&shift1550, &reduce1550, nullptr};
+State state1551 = {&shift1551, &reduce1551, nullptr};
+State state1552 = {&shift1552, &reduce1552, nullptr};
+State state1553 = {&shift1553, &reduce1553, nullptr};
+State state1554 = {&shift1554, &reduce1554, nullptr};
+State state1555 = {&shift1555, &reduce1555, nullptr};
+State state1556 = {&shift1556, &reduce1556, nullptr};
+State state1557 = {&shift1557, &reduce1557, nullptr};
+State state1558 = {&shift1558, &reduce1558, nullptr};
+State state1559 = {&shift1559, &reduce1559, nullptr};
+State state1560 = {&shift1560, &reduce1560, nullptr};
+State state1561 = {&shift1561, &reduce1561, nullptr};
+State state1562 = {&shift1562, &reduce1562, nullptr};
+State state1563 = {&shift1563, &reduce1563, nullptr};
+State state1564 = {&shift1564, &reduce1564, nullptr};
+State state1565 = {&shift1565, &reduce1565, nullptr};
+State state1566 = {&shift1566, &reduce1566, nullptr};
+State state1567 = {&shift1567, &reduce1567, nullptr};
+State state1568 = {&shift1568, &reduce1568, nullptr};
+State state1569 = {&shift1569, &reduce1569, nullptr};
+State state1570 = {&shift1570, &reduce1570, nullptr};
+State state1571 = {&shift1571, &reduce1571, nullptr};
+State state1572 = {&shift1572, &reduce1572, nullptr};
+State state1573 = {&shift1573, &reduce1573, nullptr};
+State state1574 = {&shift1574, &reduce1574, nullptr};
+State state1575 = {&shift1575, &reduce1575, nullptr};
+State state1576 = {&shift1576, &reduce1576, nullptr};
+State state1577 = {&shift1577, &reduce1577, nullptr};
+State state1578 = {&shift1578, &reduce1578, nullptr};
+State state1579 = {&shift1579, &reduce1579, nullptr};
+State state1580 = {&shift1580, &reduce1580, nullptr};
+State state1581 = {&shift1581, &reduce1581, nullptr};
+State state1582 = {&shift1582, &reduce1582, nullptr};
+State state1583 = {&shift1583, &reduce1583, nullptr};
+State state1584 = {&shift1584, &reduce1584, nullptr};
+State state1585 = {&shift1585, &reduce1585, nullptr};
+State state1586 = {&shift1586, &reduce1586, nullptr};
+State state1587 = {&shift1587, &reduce1587, nullptr};
+State state1588 = {&shift1588, &reduce1588, nullptr};
+State state1589 = {&shift1589, &reduce1589, nullptr};
+State state1590 = {&shift1590, &reduce1590, nullptr};
+State state1591 = {&shift1591, &reduce1591, nullptr};
+State state1592 = {&shift1592, &reduce1592, nullptr};
+State state1593 = {&shift1593, &reduce1593, nullptr};
+State state1594 = {&shift1594, &reduce1594, nullptr};
+State state1595 = {&shift1595, &reduce1595, nullptr};
+State state1596 = {&shift1596, &reduce1596, nullptr};
+State state1597 = {&shift1597, &reduce1597, nullptr};
+State state1598 = {&shift1598, &reduce1598, nullptr};
+State state1599 = {&shift1599, &reduce1599, nullptr};
+State state1600 = {&shift1600, &reduce1600, nullptr};
+State state1601 = {&shift1601, &reduce1601, nullptr};
+State state1602 = {&shift1602, &reduce1602, nullptr};
+State state1603 = {&shift1603, &reduce1603, nullptr};
+State state1604 = {&shift1604, &reduce1604, nullptr};
+State state1605 = {&shift1605, &reduce1605, nullptr};
+State state1606 = {&shift1606, &reduce1606, nullptr};
+State state1607 = {&shift1607, &reduce1607, nullptr};
+State state1608 = {&shift1608, &reduce1608, nullptr};
+State state1609 = {&shift1609, &reduce1609, nullptr};
+State state1610 = {&shift1610, &reduce1610, nullptr};
+State state1611 = {&shift1611, &reduce1611, nullptr};
+State state1612 = {&shift1612, &reduce1612, nullptr};
+State state1613 = {&shift1613, &reduce1613, nullptr};
+State state1614 = {&shift1614, &reduce1614, nullptr};
+State state1615 = {&shift1615, &reduce1615, nullptr};
+State state1616 = {&shift1616, &reduce1616, nullptr};
+State state1617 = {&shift1617, &reduce1617, nullptr};
+State state1618 = {&shift1618, &reduce1618, nullptr};
+State state1619 = {&shift1619, &reduce1619, nullptr};
+State state1620 = {&shift1620, &reduce1620, nullptr};
+State state1621 = {&shift1621, &reduce1621, nullptr};
+State state1622 = {&shift1622, &reduce1622, nullptr};
+State state1623 = {&shift1623, &reduce1623, nullptr};
+State state1624 = {&shift1624, &reduce1624, nullptr};
+State state1625 = {&shift1625, &reduce1625, nullptr};
+State state1626 = {&shift1626, &reduce1626, nullptr};
+State state1627 = {&shift1627, &reduce1627, nullptr};
+State state1628 = {&shift1628, &reduce1628, nullptr};
+State state1629 = {&shift1629, &reduce1629, nullptr};
+State state1630 = {&shift1630, &reduce1630, nullptr};
+State state1631 = {&shift1631, &reduce1631, nullptr};
+State state1632 = {&shift1632, &reduce1632, nullptr};
+State state1633 = {&shift1633, &reduce1633, nullptr};
+State state1634 = {&shift1634, &reduce1634, nullptr};
+State state1635 = {&shift1635, &reduce1635, nullptr};
+State state1636 = {&shift1636, &reduce1636, nullptr};
+State state1637 = {&shift1637, &reduce1637, nullptr};
+State state1638 = {&shift1638, &reduce1638, nullptr};
+State state1639 = {&shift1639, &reduce1639, nullptr};
+State state1640 = {&shift1640, &reduce1640, nullptr};
+State state1641 = {&shift1641, &reduce1641, nullptr};
+State state1642 = {&shift1642, &reduce1642, nullptr};
+State state1643 = {&shift1643, &reduce1643, nullptr};
+State state1644 = {&shift1644, &reduce1644, nullptr};
+State state1645 = {&shift1645, &reduce1645, nullptr};
+State state1646 = {&shift1646, &reduce1646, nullptr};
+State state1647 = {&shift1647, &reduce1647, nullptr};
+State state1648 = {&shift1648, &reduce1648, nullptr};
+State state1649 = {&shift1649, &reduce1649, nullptr};
+State state1650 = {&shift1650, &reduce1650, nullptr};
+State state1651 = {&shift1651, &reduce1651, nullptr};
+State state1652 = {&shift1652, &reduce1652, nullptr};
+State state1653 = {&shift1653, &reduce1653, nullptr};
+State state1654 = {&shift1654, &reduce1654, nullptr};
+State state1655 = {&shift1655, &reduce1655, nullptr};
+State state1656 = {&shift1656, &reduce1656, nullptr};
+State state1657 = {&shift1657, &reduce1657, nullptr};
+State state1658 = {&shift1658, &reduce1658, nullptr};
+State state1659 = {&shift1659, &reduce1659, nullptr};
+State state1660 = {&shift1660, &reduce1660, nullptr};
+State state1661 = {&shift1661, &reduce1661, nullptr};
+State state1662 = {&shift1662, &reduce1662, nullptr};
+State state1663 = {&shift1663, &reduce1663, nullptr};
+State state1664 = {&shift1664, &reduce1664, nullptr};
+State state1665 = {&shift1665, &reduce1665, nullptr};
+State state1666 = {&shift1666, &reduce1666, nullptr};
+State state1667 = {&shift1667, &reduce1667, nullptr};
+State state1668 = {&shift1668, &reduce1668, nullptr};
+State state1669 = {&shift1669, &reduce1669, nullptr};
+State state1670 = {&shift1670, &reduce1670, nullptr};
+State state1671 = {&shift1671, &reduce1671, nullptr};
+State state1672 = {&shift1672, &reduce1672, nullptr};
+State state1673 = {&shift1673, &reduce1673, nullptr};
+State state1674 = {&shift1674, &reduce1674, nullptr};
+State state1675 = {&shift1675, &reduce1675, nullptr};
+State state1676 = {&shift1676, &reduce1676, nullptr};
+State state1677 = {&shift1677, &reduce1677, nullptr};
+State state1678 = {&shift1678, &reduce1678, nullptr};
+State state1679 = {&shift1679, &reduce1679, nullptr};
+State state1680 = {&shift1680, &reduce1680, nullptr};
+State state1681 = {&shift1681, &reduce1681, nullptr};
+State state1682 = {&shift1682, &reduce1682, nullptr};
+State state1683 = {&shift1683, &reduce1683, nullptr};
+State state1684 = {&shift1684, &reduce1684, nullptr};
+State state1685 = {&shift1685, &reduce1685, nullptr};
+State state1686 = {&shift1686, &reduce1686, nullptr};
+State state1687 = {&shift1687, &reduce1687, nullptr};
+State state1688 = {&shift1688, &reduce1688, nullptr};
+State state1689 = {&shift1689, &reduce1689, nullptr};
+State state1690 = {&shift1690, &reduce1690, nullptr};
+State state1691 = {&shift1691, &reduce1691, nullptr};
+State state1692 = {&shift1692, &reduce1692, nullptr};
+State state1693 = {&shift1693, &reduce1693, nullptr};
+State state1694 = {&shift1694, &reduce1694, nullptr};
+State state1695 = {&shift1695, &reduce1695, nullptr};
+State state1696 = {&shift1696, &reduce1696, nullptr};
+State state1697 = {&shift1697, &reduce1697, nullptr};
+State state1698 = {&shift1698, &reduce1698, nullptr};
+State state1699 = {&shift1699, &reduce1699, nullptr};
+State state1700 = {&shift1700, &reduce1700, nullptr};
+State state1701 = {&shift1701, &reduce1701, nullptr};
+State state1702 = {&shift1702, &reduce1702, nullptr};
+State state1703 = {&shift1703, &reduce1703, nullptr};
+State state1704 = {&shift1704, &reduce1704, nullptr};
+State state1705 = {&shift1705, &reduce1705, nullptr};
+State state1706 = {&shift1706, &reduce1706, nullptr};
+State state1707 = {&shift1707, &reduce1707, nullptr};
+State state1708 = {&shift1708, &reduce1708, nullptr};
+State state1709 = {&shift1709, &reduce1709, nullptr};
+State state1710 = {&shift1710, &reduce1710, nullptr};
+State state1711 = {&shift1711, &reduce1711, nullptr};
+State state1712 = {&shift1712, &reduce1712, nullptr};
+State state1713 = {&shift1713, &reduce1713, nullptr};
+State state1714 = {&shift1714, &reduce1714, nullptr};
+State state1715 = {&shift1715, &reduce1715, nullptr};
+State state1716 = {&shift1716, &reduce1716, nullptr};
+State state1717 = {&shift1717, &reduce1717, nullptr};
+State state1718 = {&shift1718, &reduce1718, nullptr};
+State state1719 = {&shift1719, &reduce1719, nullptr};
+State state1720 = {&shift1720, &reduce1720, nullptr};
+State state1721 = {&shift1721, &reduce1721, nullptr};
+State state1722 = {&shift1722, &reduce1722, nullptr};
+State state1723 = {&shift1723, &reduce1723, nullptr};
+State state1724 = {&shift1724, &reduce1724, nullptr};
+State state1725 = {&shift1725, &reduce1725, nullptr};
+State state1726 = {&shift1726, &reduce1726, nullptr};
+State state1727 = {&shift1727, &reduce1727, nullptr};
+State state1728 = {&shift1728, &reduce1728, nullptr};
+State state1729 = {&shift1729, &reduce1729, nullptr};
+State state1730 = {&shift1730, &reduce1730, nullptr};
+State state1731 = {&shift1731, &reduce1731, nullptr};
+State state1732 = {&shift1732, &reduce1732, nullptr};
+State state1733 = {&shift1733, &reduce1733, nullptr};
+State state1734 = {&shift1734, &reduce1734, nullptr};
+State state1735 = {&shift1735, &reduce1735, nullptr};
+State state1736 = {&shift1736, &reduce1736, nullptr};
+State state1737 = {&shift1737, &reduce1737, nullptr};
+State state1738 = {&shift1738, &reduce1738, nullptr};
+State state1739 = {&shift1739, &reduce1739, nullptr};
+State state1740 = {&shift1740, &reduce1740, nullptr};
+State state1741 = {&shift1741, &reduce1741, nullptr};
+State state1742 = {&shift1742, &reduce1742, nullptr};
+State state1743 = {&shift1743, &reduce1743, nullptr};
+State state1744 = {&shift1744, &reduce1744, nullptr};
+State state1745 = {&shift1745, &reduce1745, nullptr};
+State state1746 = {&shift1746, &reduce1746, nullptr};
+State state1747 = {&shift1747, &reduce1747, nullptr};
+State state1748 = {&shift1748, &reduce1748, nullptr};
+State state1749 = {&shift1749, &reduce1749, nullptr};
+State state1750 = {&shift1750, &reduce1750, nullptr};
+State state1751 = {&shift1751, &reduce1751, nullptr};
+State state1752 = {&shift1752, &reduce1752, nullptr};
+State state1753 = {&shift1753, &reduce1753, nullptr};
+State state1754 = {&shift1754, &reduce1754, nullptr};
+State state1755 = {&shift1755, &reduce1755, nullptr};
+State state1756 = {&shift1756, &reduce1756, nullptr};
+State state1757 = {&shift1757, &reduce1757, nullptr};
+State state1758 = {&shift1758, &reduce1758, nullptr};
+State state1759 = {&shift1759, &reduce1759, nullptr};
+State state1760 = {&shift1760, &reduce1760, nullptr};
+State state1761 = {&shift1761, &reduce1761, nullptr};
+State state1762 = {&shift1762, &reduce1762, nullptr};
+State state1763 = {&shift1763, &reduce1763, nullptr};
+State state1764 = {&shift1764, &reduce1764, nullptr};
+State state1765 = {&shift1765, &reduce1765, nullptr};
+State state1766 = {&shift1766, &reduce1766, nullptr};
+State state1767 = {&shift1767, &reduce1767, nullptr};
+State state1768 = {&shift1768, &reduce1768, nullptr};
+State state1769 = {&shift1769, &reduce1769, nullptr};
+State state1770 = {&shift1770, &reduce1770, nullptr};
+State state1771 = {&shift1771, &reduce1771, nullptr};
+State state1772 = {&shift1772, &reduce1772, nullptr};
+State state1773 = {&shift1773, &reduce1773, nullptr};
+State state1774 = {&shift1774, &reduce1774, nullptr};
+State state1775 = {&shift1775, &reduce1775, nullptr};
+State state1776 = {&shift1776, &reduce1776, nullptr};
+State state1777 = {&shift1777, &reduce1777, nullptr};
+State state1778 = {&shift1778, &reduce1778, nullptr};
+State state1779 = {&shift1779, &reduce1779, nullptr};
+State state1780 = {&shift1780, &reduce1780, nullptr};
+State state1781 = {&shift1781, &reduce1781, nullptr};
+State state1782 = {&shift1782, &reduce1782, nullptr};
+State state1783 = {&shift1783, &reduce1783, nullptr};
+State state1784 = {&shift1784, &reduce1784, nullptr};
+State state1785 = {&shift1785, &reduce1785, nullptr};
+State state1786 = {&shift1786, &reduce1786, nullptr};
+State state1787 = {&shift1787, &reduce1787, nullptr};
+State state1788 = {&shift1788, &reduce1788, nullptr};
+State state1789 = {&shift1789, &reduce1789, nullptr};
+State state1790 = {&shift1790, &reduce1790, nullptr};
+State state1791 = {&shift1791, &reduce1791, nullptr};
+State state1792 = {&shift1792, &reduce1792, nullptr};
+State state1793 = {&shift1793, &reduce1793, nullptr};
+State state1794 = {&shift1794, &reduce1794, nullptr};
+State state1795 = {&shift1795, &reduce1795, nullptr};
+State state1796 = {&shift1796, &reduce1796, nullptr};
+State state1797 = {&shift1797, &reduce1797, nullptr};
+State state1798 = {&shift1798, &reduce1798, nullptr};
+State state1799 = {&shift1799, &reduce1799, nullptr};
+State state1800 = {&shift1800, &reduce1800, nullptr};
+State state1801 = {&shift1801, &reduce1801, nullptr};
+State state1802 = {&shift1802, &reduce1802, nullptr};
+State state1803 = {&shift1803, &reduce1803, nullptr};
+State state1804 = {&shift1804, &reduce1804, nullptr};
+State state1805 = {&shift1805, &reduce1805, nullptr};
+State state1806 = {&shift1806, &reduce1806, nullptr};
+State state1807 = {&shift1807, &reduce1807, nullptr};
+State state1808 = {&shift1808, &reduce1808, nullptr};
+State state1809 = {&shift1809, &reduce1809, nullptr};
+State state1810 = {&shift1810, &reduce1810, nullptr};
+State state1811 = {&shift1811, &reduce1811, nullptr};
+State state1812 = {&shift1812, &reduce1812, nullptr};
+State state1813 = {&shift1813, &reduce1813, nullptr};
+State state1814 = {&shift1814, &reduce1814, nullptr};
+State state1815 = {&shift1815, &reduce1815, nullptr};
+State state1816 = {&shift1816, &reduce1816, nullptr};
+State state1817 = {&shift1817, &reduce1817, nullptr};
+State state1818 = {&shift1818, &reduce1818, nullptr};
+State state1819 = {&shift1819, &reduce1819, nullptr};
+State state1820 = {&shift1820, &reduce1820, nullptr};
+State state1821 = {&shift1821, &reduce1821, nullptr};
+State state1822 = {&shift1822, &reduce1822, nullptr};
+State state1823 = {&shift1823, &reduce1823, nullptr};
+State state1824 = {&shift1824, &reduce1824, nullptr};
+State state1825 = {&shift1825, &reduce1825, nullptr};
+State state1826 = {&shift1826, &reduce1826, nullptr};
+State state1827 = {&shift1827, &reduce1827, nullptr};
+State state1828 = {&shift1828, &reduce1828, nullptr};
+State state1829 = {&shift1829, &reduce1829, nullptr};
+State state1830 = {&shift1830, &reduce1830, nullptr};
+State state1831 = {&shift1831, &reduce1831, nullptr};
+State state1832 = {&shift1832, &reduce1832, nullptr};
+State state1833 = {&shift1833, &reduce1833, nullptr};
+State state1834 = {&shift1834, &reduce1834, nullptr};
+State state1835 = {&shift1835, &reduce1835, nullptr};
+State state1836 = {&shift1836, &reduce1836, nullptr};
+State state1837 = {&shift1837, &reduce1837, nullptr};
+State state1838 = {&shift1838, &reduce1838, nullptr};
+State state1839 = {&shift1839, &reduce1839, nullptr};
+State state1840 = {&shift1840, &reduce1840, nullptr};
+State state1841 = {&shift1841, &reduce1841, nullptr};
+State state1842 = {&shift1842, &reduce1842, nullptr};
+State state1843 = {&shift1843, &reduce1843, nullptr};
+State state1844 = {&shift1844, &reduce1844, nullptr};
+State state1845 = {&shift1845, &reduce1845, nullptr};
+State state1846 = {&shift1846, &reduce1846, nullptr};
+State state1847 = {&shift1847, &reduce1847, nullptr};
+State state1848 = {&shift1848, &reduce1848, nullptr};
+State state1849 = {&shift1849, &reduce1849, nullptr};
+State state1850 = {&shift1850, &reduce1850, nullptr};
+State state1851 = {&shift1851, &reduce1851, nullptr};
+State state1852 = {&shift1852, &reduce1852, nullptr};
+State state1853 = {&shift1853, &reduce1853, nullptr};
+State state1854 = {&shift1854, &reduce1854, nullptr};
+State state1855 = {&shift1855, &reduce1855, nullptr};
+State state1856 = {&shift1856, &reduce1856, nullptr};
+State state1857 = {&shift1857, &reduce1857, nullptr};
+State state1858 = {&shift1858, &reduce1858, nullptr};
+State state1859 = {&shift1859, &reduce1859, nullptr};
+State state1860 = {&shift1860, &reduce1860, nullptr};
+State state1861 = {&shift1861, &reduce1861, nullptr};
+State state1862 = {&shift1862, &reduce1862, nullptr};
+State state1863 = {&shift1863, &reduce1863, nullptr};
+State state1864 = {&shift1864, &reduce1864, nullptr};
+State state1865 = {&shift1865, &reduce1865, nullptr};
+State state1866 = {&shift1866, &reduce1866, nullptr};
+State state1867 = {&shift1867, &reduce1867, nullptr};
+State state1868 = {&shift1868, &reduce1868, nullptr};
+State state1869 = {&shift1869, &reduce1869, nullptr};
+State state1870 = {&shift1870, &reduce1870, nullptr};
+State state1871 = {&shift1871, &reduce1871, nullptr};
+State state1872 = {&shift1872, &reduce1872, nullptr};
+State state1873 = {&shift1873, &reduce1873, nullptr};
+State state1874 = {&shift1874, &reduce1874, nullptr};
+State state1875 = {&shift1875, &reduce1875, nullptr};
+State state1876 = {&shift1876, &reduce1876, nullptr};
+State state1877 = {&shift1877, &reduce1877, nullptr};
+State state1878 = {&shift1878, &reduce1878, nullptr};
+State state1879 = {&shift1879, &reduce1879, nullptr};
+State state1880 = {&shift1880, &reduce1880, nullptr};
+State state1881 = {&shift1881, &reduce1881, nullptr};
+State state1882 = {&shift1882, &reduce1882, nullptr};
+State state1883 = {&shift1883, &reduce1883, nullptr};
+State state1884 = {&shift1884, &reduce1884, nullptr};
+State state1885 = {&shift1885, &reduce1885, nullptr};
+State state1886 = {&shift1886, &reduce1886, nullptr};
+State state1887 = {&shift1887, &reduce1887, nullptr};
+State state1888 = {&shift1888, &reduce1888, nullptr};
+State state1889 = {&shift1889, &reduce1889, nullptr};
+State state1890 = {&shift1890, &reduce1890, nullptr};
+State state1891 = {&shift1891, &reduce1891, nullptr};
+State state1892 = {&shift1892, &reduce1892, nullptr};
+State state1893 = {&shift1893, &reduce1893, nullptr};
+State state1894 = {&shift1894, &reduce1894, nullptr};
+State state1895 = {&shift1895, &reduce1895, nullptr};
+State state1896 = {&shift1896, &reduce1896, nullptr};
+State state1897 = {&shift1897, &reduce1897, nullptr};
+State state1898 = {&shift1898, &reduce1898, nullptr};
+State state1899 = {&shift1899, &reduce1899, nullptr};
+State state1900 = {&shift1900, &reduce1900, nullptr};
+State state1901 = {&shift1901, &reduce1901, nullptr};
+State state1902 = {&shift1902, &reduce1902, nullptr};
+State state1903 = {&shift1903, &reduce1903, nullptr};
+State state1904 = {&shift1904, &reduce1904, nullptr};
+State state1905 = {&shift1905, &reduce1905, nullptr};
+State state1906 = {&shift1906, &reduce1906, nullptr};
+State state1907 = {&shift1907, &reduce1907, nullptr};
+State state1908 = {&shift1908, &reduce1908, nullptr};
+State state1909 = {&shift1909, &reduce1909, nullptr};
+State state1910 = {&shift1910, &reduce1910, nullptr};
+State state1911 = {&shift1911, &reduce1911, nullptr};
+State state1912 = {&shift1912, &reduce1912, nullptr};
+State state1913 = {&shift1913, &reduce1913, nullptr};
+State state1914 = {&shift1914, &reduce1914, nullptr};
+State state1915 = {&shift1915, &reduce1915, nullptr};
+State state1916 = {&shift1916, &reduce1916, nullptr};
+State state1917 = {&shift1917, &reduce1917, nullptr};
+State state1918 = {&shift1918, &reduce1918, nullptr};
+State state1919 = {&shift1919, &reduce1919, nullptr};
+State state1920 = {&shift1920, &reduce1920, nullptr};
+State state1921 = {&shift1921, &reduce1921, nullptr};
+State state1922 = {&shift1922, &reduce1922, nullptr};
+State state1923 = {&shift1923, &reduce1923, nullptr};
+State state1924 = {&shift1924, &reduce1924, nullptr};
+State state1925 = {&shift1925, &reduce1925, nullptr};
+State state1926 = {&shift1926, &reduce1926, nullptr};
+State state1927 = {&shift1927, &reduce1927, nullptr};
+State state1928 = {&shift1928, &reduce1928, nullptr};
+State state1929 = {&shift1929, &reduce1929, nullptr};
+State state1930 = {&shift1930, &reduce1930, nullptr};
+State state1931 = {&shift1931, &reduce1931, nullptr};
+State state1932 = {&shift1932, &reduce1932, nullptr};
+State state1933 = {&shift1933, &reduce1933, nullptr};
+State state1934 = {&shift1934, &reduce1934, nullptr};
+State state1935 = {&shift1935, &reduce1935, nullptr};
+State state1936 = {&shift1936, &reduce1936, nullptr};
+State state1937 = {&shift1937, &reduce1937, nullptr};
+State state1938 = {&shift1938, &reduce1938, nullptr};
+State state1939 = {&shift1939, &reduce1939, nullptr};
+State state1940 = {&shift1940, &reduce1940, nullptr};
+State state1941 = {&shift1941, &reduce1941, nullptr};
+State state1942 = {&shift1942, &reduce1942, nullptr};
+State state1943 = {&shift1943, &reduce1943, nullptr};
+State state1944 = {&shift1944, &reduce1944, nullptr};
+State state1945 = {&shift1945, &reduce1945, nullptr};
+State state1946 = {&shift1946, &reduce1946, nullptr};
+State state1947 = {&shift1947, &reduce1947, nullptr};
+State state1948 = {&shift1948, &reduce1948, nullptr};
+State state1949 = {&shift1949, &reduce1949, nullptr};
+State state1950 = {&shift1950, &reduce1950, nullptr};
+State state1951 = {&shift1951, &reduce1951, nullptr};
+State state1952 = {&shift1952, &reduce1952, nullptr};
+State state1953 = {&shift1953, &reduce1953, nullptr};
+State state1954 = {&shift1954, &reduce1954, nullptr};
+State state1955 = {&shift1955, &reduce1955, nullptr};
+State state1956 = {&shift1956, &reduce1956, nullptr};
+State state1957 = {&shift1957, &reduce1957, nullptr};
+State state1958 = {&shift1958, &reduce1958, nullptr};
+State state1959 = {&shift1959, &reduce1959, nullptr};
+State state1960 = {&shift1960, &reduce1960, nullptr};
+State state1961 = {&shift1961, &reduce1961, nullptr};
+State state1962 = {&shift1962, &reduce1962, nullptr};
+State state1963 = {&shift1963, &reduce1963, nullptr};
+State state1964 = {&shift1964, &reduce1964, nullptr};
+State state1965 = {&shift1965, &reduce1965, nullptr};
+State state1966 = {&shift1966, &reduce1966, nullptr};
+State state1967 = {&shift1967, &reduce1967, nullptr};
+State state1968 = {&shift1968, &reduce1968, nullptr};
+State state1969 = {&shift1969, &reduce1969, nullptr};
+State state1970 = {&shift1970, &reduce1970, nullptr};
+State state1971 = {&shift1971, &reduce1971, nullptr};
+State state1972 = {&shift1972, &reduce1972, nullptr};
+State state1973 = {&shift1973, &reduce1973, nullptr};
+State state1974 = {&shift1974, &reduce1974, nullptr};
+State state1975 = {&shift1975, &reduce1975, nullptr};
+State state1976 = {&shift1976, &reduce1976, nullptr};
+State state1977 = {&shift1977, &reduce1977, nullptr};
+State state1978 = {&shift1978, &reduce1978, nullptr};
+State state1979 = {&shift1979, &reduce1979, nullptr};
+State state1980 = {&shift1980, &reduce1980, nullptr};
+State state1981 = {&shift1981, &reduce1981, nullptr};
+State state1982 = {&shift1982, &reduce1982, nullptr};
+State state1983 = {&shift1983, &reduce1983, nullptr};
+State state1984 = {&shift1984, &reduce1984, nullptr};
+State state1985 = {&shift1985, &reduce1985, nullptr};
+State state1986 = {&shift1986, &reduce1986, nullptr};
+State state1987 = {&shift1987, &reduce1987, nullptr};
+State state1988 = {&shift1988, &reduce1988, nullptr};
+State state1989 = {&shift1989, &reduce1989, nullptr};
+State state1990 = {&shift1990, &reduce1990, nullptr};
+State state1991 = {&shift1991, &reduce1991, nullptr};
+State state1992 = {&shift1992, &reduce1992, nullptr};
+State state1993 = {&shift1993, &reduce1993, nullptr};
+State state1994 = {&shift1994, &reduce1994, nullptr};
+State state1995 = {&shift1995, &reduce1995, nullptr};
+State state1996 = {&shift1996, &reduce1996, nullptr};
+State state1997 = {&shift1997, &reduce1997, nullptr};
+State state1998 = {&shift1998, &reduce1998, nullptr};
+State state1999 = {&shift1999, &reduce1999, nullptr};
+State state2000 = {&shift2000, &reduce2000, nullptr};
+State state2001 = {&shift2001, &reduce2001, nullptr};
+State state2002 = {&shift2002, &reduce2002, nullptr};
+State state2003 = {&shift2003, &reduce2003, nullptr};
+State state2004 = {&shift2004, &reduce2004, nullptr};
+State state2005 = {&shift2005, &reduce2005, nullptr};
+State state2006 = {&shift2006, &reduce2006, nullptr};
+State state2007 = {&shift2007, &reduce2007, nullptr};
+State state2008 = {&shift2008, &reduce2008, nullptr};
+State state2009 = {&shift2009, &reduce2009, nullptr};
+State state2010 = {&shift2010, &reduce2010, nullptr};
+State state2011 = {&shift2011, &reduce2011, nullptr};
+State state2012 = {&shift2012, &reduce2012, nullptr};
+State state2013 = {&shift2013, &reduce2013, nullptr};
+State state2014 = {&shift2014, &reduce2014, nullptr};
+State state2015 = {&shift2015, &reduce2015, nullptr};
+State state2016 = {&shift2016, &reduce2016, nullptr};
+State state2017 = {&shift2017, &reduce2017, nullptr};
+State state2018 = {&shift2018, &reduce2018, nullptr};
+State state2019 = {&shift2019, &reduce2019, nullptr};
+State state2020 = {&shift2020, &reduce2020, nullptr};
+State state2021 = {&shift2021, &reduce2021, nullptr};
+State state2022 = {&shift2022, &reduce2022, nullptr};
+State state2023 = {&shift2023, &reduce2023, nullptr};
+State state2024 = {&shift2024, &reduce2024, nullptr};
+State state2025 = {&shift2025, &reduce2025, nullptr};
+State state2026 = {&shift2026, &reduce2026, nullptr};
+State state2027 = {&shift2027, &reduce2027, nullptr};
+State state2028 = {&shift2028, &reduce2028, nullptr};
+State state2029 = {&shift2029, &reduce2029, nullptr};
+State state2030 = {&shift2030, &reduce2030, nullptr};
+State state2031 = {&shift2031, &reduce2031, nullptr};
+State state2032 = {&shift2032, &reduce2032, nullptr};
+State state2033 = {&shift2033, &reduce2033, nullptr};
+State state2034 = {&shift2034, &reduce2034, nullptr};
+State state2035 = {&shift2035, &reduce2035, nullptr};
+State state2036 = {&shift2036, &reduce2036, nullptr};
+State state2037 = {&shift2037, &reduce2037, nullptr};
+State state2038 = {&shift2038, &reduce2038, nullptr};
+State state2039 = {&shift2039, &reduce2039, nullptr};
+State state2040 = {&shift2040, &reduce2040, nullptr};
+State state2041 = {&shift2041, &reduce2041, nullptr};
+State state2042 = {&shift2042, &reduce2042, nullptr};
+State state2043 = {&shift2043, &reduce2043, nullptr};
+State state2044 = {&shift2044, &reduce2044, nullptr};
+State state2045 = {&shift2045, &reduce2045, nullptr};
+State state2046 = {&shift2046, &reduce2046, nullptr};
+State state2047 = {&shift2047, &reduce2047, nullptr};
+State state2048 = {&shift2048, &reduce2048, nullptr};
+State state2049 = {&shift2049, &reduce2049, nullptr};
+State state2050 = {&shift2050, &reduce2050, nullptr};
+State state2051 = {&shift2051, &reduce2051, nullptr};
+State state2052 = {&shift2052, &reduce2052, nullptr};
+State state2053 = {&shift2053, &reduce2053, nullptr};
+State state2054 = {&shift2054, &reduce2054, nullptr};
+State state2055 = {&shift2055, &reduce2055, nullptr};
+State state2056 = {&shift2056, &reduce2056, nullptr};
+State state2057 = {&shift2057, &reduce2057, nullptr};
+State state2058 = {&shift2058, &reduce2058, nullptr};
+State state2059 = {&shift2059, &reduce2059, nullptr};
+State state2060 = {&shift2060, &reduce2060, nullptr};
+State state2061 = {&shift2061, &reduce2061, nullptr};
+State state2062 = {&shift2062, &reduce2062, nullptr};
+State state2063 = {&shift2063, &reduce2063, nullptr};
+State state2064 = {&shift2064, &reduce2064, nullptr};
+State state2065 = {&shift2065, &reduce2065, nullptr};
+State state2066 = {&shift2066, &reduce2066, nullptr};
+State state2067 = {&shift2067, &reduce2067, nullptr};
+State state2068 = {&shift2068, &reduce2068, nullptr};
+State state2069 = {&shift2069, &reduce2069, nullptr};
+State state2070 = {&shift2070, &reduce2070, nullptr};
+State state2071 = {&shift2071, &reduce2071, nullptr};
+State state2072 = {&shift2072, &reduce2072, nullptr};
+State state2073 = {&shift2073, &reduce2073, nullptr};
+State state2074 = {&shift2074, &reduce2074, nullptr};
+State state2075 = {&shift2075, &reduce2075, nullptr};
+State state2076 = {&shift2076, &reduce2076, nullptr};
+State state2077 = {&shift2077, &reduce2077, nullptr};
+State state2078 = {&shift2078, &reduce2078, nullptr};
+State state2079 = {&shift2079, &reduce2079, nullptr};
+State state2080 = {&shift2080, &reduce2080, nullptr};
+State state2081 = {&shift2081, &reduce2081, nullptr};
+State state2082 = {&shift2082, &reduce2082, nullptr};
+State state2083 = {&shift2083, &reduce2083, nullptr};
+State state2084 = {&shift2084, &reduce2084, nullptr};
+State state2085 = {&shift2085, &reduce2085, nullptr};
+State state2086 = {&shift2086, &reduce2086, nullptr};
+State state2087 = {&shift2087, &reduce2087, nullptr};
+State state2088 = {&shift2088, &reduce2088, nullptr};
+State state2089 = {&shift2089, &reduce2089, nullptr};
+State state2090 = {&shift2090, &reduce2090, nullptr};
+State state2091 = {&shift2091, &reduce2091, nullptr};
+State state2092 = {&shift2092, &reduce2092, nullptr};
+State state2093 = {&shift2093, &reduce2093, nullptr};
+State state2094 = {&shift2094, &reduce2094, nullptr};
+State state2095 = {&shift2095, &reduce2095, nullptr};
+State state2096 = {&shift2096, &reduce2096, nullptr};
+State state2097 = {&shift2097, &reduce2097, nullptr};
+State state2098 = {&shift2098, &reduce2098, nullptr};
+State state2099 = {&shift2099, &reduce2099, nullptr};
+State state2100 = {&shift2100, &reduce2100, nullptr};
+State state2101 = {&shift2101, &reduce2101, nullptr};
+State state2102 = {&shift2102, &reduce2102, nullptr};
+State state2103 = {&shift2103, &reduce2103, nullptr};
+State state2104 = {&shift2104, &reduce2104, nullptr};
+State state2105 = {&shift2105, &reduce2105, nullptr};
+State state2106 = {&shift2106, &reduce2106, nullptr};
+State state2107 = {&shift2107, &reduce2107, nullptr};
+State state2108 = {&shift2108, &reduce2108, nullptr};
+State state2109 = {&shift2109, &reduce2109, nullptr};
+State state2110 = {&shift2110, &reduce2110, nullptr};
+State state2111 = {&shift2111, &reduce2111, nullptr};
+State state2112 = {&shift2112, &reduce2112, nullptr};
+State state2113 = {&shift2113, &reduce2113, nullptr};
+State state2114 = {&shift2114, &reduce2114, nullptr};
+State state2115 = {&shift2115, &reduce2115, nullptr};
+State state2116 = {&shift2116, &reduce2116, nullptr};
+State state2117 = {&shift2117, &reduce2117, nullptr};
+State state2118 = {&shift2118, &reduce2118, nullptr};
+State state2119 = {&shift2119, &reduce2119, nullptr};
+State state2120 = {&shift2120, &reduce2120, nullptr};
+State state2121 = {&shift2121, &reduce2121, nullptr};
+State state2122 = {&shift2122, &reduce2122, nullptr};
+State state2123 = {&shift2123, &reduce2123, nullptr};
+State state2124 = {&shift2124, &reduce2124, nullptr};
+State state2125 = {&shift2125, &reduce2125, nullptr};
+State state2126 = {&shift2126, &reduce2126, nullptr};
+State state2127 = {&shift2127, &reduce2127, nullptr};
+State state2128 = {&shift2128, &reduce2128, nullptr};
+State state2129 = {&shift2129, &reduce2129, nullptr};
+State state2130 = {&shift2130, &reduce2130, nullptr};
+State state2131 = {&shift2131, &reduce2131, nullptr};
+State state2132 = {&shift2132, &reduce2132, nullptr};
+State state2133 = {&shift2133, &reduce2133, nullptr};
+State state2134 = {&shift2134, &reduce2134, nullptr};
+State state2135 = {&shift2135, &reduce2135, nullptr};
+State state2136 = {&shift2136, &reduce2136, nullptr};
+State state2137 = {&shift2137, &reduce2137, nullptr};
+State state2138 = {&shift2138, &reduce2138, nullptr};
+State state2139 = {&shift2139, &reduce2139, nullptr};
+State state2140 = {&shift2140, &reduce2140, nullptr};
+State state2141 = {&shift2141, &reduce2141, nullptr};
+State state2142 = {&shift2142, &reduce2142, nullptr};
+State state2143 = {&shift2143, &reduce2143, nullptr};
+State state2144 = {&shift2144, &reduce2144, nullptr};
+State state2145 = {&shift2145, &reduce2145, nullptr};
+State state2146 = {&shift2146, &reduce2146, nullptr};
+State state2147 = {&shift2147, &reduce2147, nullptr};
+State state2148 = {&shift2148, &reduce2148, nullptr};
+State state2149 = {&shift2149, &reduce2149, nullptr};
+State state2150 = {&shift2150, &reduce2150, nullptr};
+State state2151 = {&shift2151, &reduce2151, nullptr};
+State state2152 = {&shift2152, &reduce2152, nullptr};
+State state2153 = {&shift2153, &reduce2153, nullptr};
+State state2154 = {&shift2154, &reduce2154, nullptr};
+State state2155 = {&shift2155, &reduce2155, nullptr};
+State state2156 = {&shift2156, &reduce2156, nullptr};
+State state2157 = {&shift2157, &reduce2157, nullptr};
+State state2158 = {&shift2158, &reduce2158, nullptr};
+State state2159 = {&shift2159, &reduce2159, nullptr};
+State state2160 = {&shift2160, &reduce2160, nullptr};
+State state2161 = {&shift2161, &reduce2161, nullptr};
+State state2162 = {&shift2162, &reduce2162, nullptr};
+State state2163 = {&shift2163, &reduce2163, nullptr};
+State state2164 = {&shift2164, &reduce2164, nullptr};
+State state2165 = {&shift2165, &reduce2165, nullptr};
+State state2166 = {&shift2166, &reduce2166, nullptr};
+State state2167 = {&shift2167, &reduce2167, nullptr};
+State state2168 = {&shift2168, &reduce2168, nullptr};
+State state2169 = {&shift2169, &reduce2169, nullptr};
+State state2170 = {&shift2170, &reduce2170, nullptr};
+State state2171 = {&shift2171, &reduce2171, nullptr};
+State state2172 = {&shift2172, &reduce2172, nullptr};
+State state2173 = {&shift2173, &reduce2173, nullptr};
+State state2174 = {&shift2174, &reduce2174, nullptr};
+State state2175 = {&shift2175, &reduce2175, nullptr};
+State state2176 = {&shift2176, &reduce2176, nullptr};
+State state2177 = {&shift2177, &reduce2177, nullptr};
+State state2178 = {&shift2178, &reduce2178, nullptr};
+State state2179 = {&shift2179, &reduce2179, nullptr};
+State state2180 = {&shift2180, &reduce2180, nullptr};
+State state2181 = {&shift2181, &reduce2181, nullptr};
+State state2182 = {&shift2182, &reduce2182, nullptr};
+State state2183 = {&shift2183, &reduce2183, nullptr};
+State state2184 = {&shift2184, &reduce2184, nullptr};
+State state2185 = {&shift2185, &reduce2185, nullptr};
+State state2186 = {&shift2186, &reduce2186, nullptr};
+State state2187 = {&shift2187, &reduce2187, nullptr};
+State state2188 = {&shift2188, &reduce2188, nullptr};
+State state2189 = {&shift2189, &reduce2189, nullptr};
+State state2190 = {&shift2190, &reduce2190, nullptr};
+State state2191 = {&shift2191, &reduce2191, nullptr};
+State state2192 = {&shift2192, &reduce2192, nullptr};
+State state2193 = {&shift2193, &reduce2193, nullptr};
+State state2194 = {&shift2194, &reduce2194, nullptr};
+State state2195 = {&shift2195, &reduce2195, nullptr};
+State state2196 = {&shift2196, &reduce2196, nullptr};
+State state2197 = {&shift2197, &reduce2197, nullptr};
+State state2198 = {&shift2198, &reduce2198, nullptr};
+State state2199 = {&shift2199, &reduce2199, nullptr};
+State state2200 = {&shift2200, &reduce2200, nullptr};
+State state2201 = {&shift2201, &reduce2201, nullptr};
+State state2202 = {&shift2202, &reduce2202, nullptr};
+State state2203 = {&shift2203, &reduce2203, nullptr};
+State state2204 = {&shift2204, &reduce2204, nullptr};
+State state2205 = {&shift2205, &reduce2205, nullptr};
+State state2206 = {&shift2206, &reduce2206, nullptr};
+State state2207 = {&shift2207, &reduce2207, nullptr};
+State state2208 = {&shift2208, &reduce2208, nullptr};
+State state2209 = {&shift2209, &reduce2209, nullptr};
+State state2210 = {&shift2210, &reduce2210, nullptr};
+State state2211 = {&shift2211, &reduce2211, nullptr};
+State state2212 = {&shift2212, &reduce2212, nullptr};
+State state2213 = {&shift2213, &reduce2213, nullptr};
+State state2214 = {&shift2214, &reduce2214, nullptr};
+State state2215 = {&shift2215, &reduce2215, nullptr};
+State state2216 = {&shift2216, &reduce2216, nullptr};
+State state2217 = {&shift2217, &reduce2217, nullptr};
+State state2218 = {&shift2218, &reduce2218, nullptr};
+State state2219 = {&shift2219, &reduce2219, nullptr};
+State state2220 = {&shift2220, &reduce2220, nullptr};
+State state2221 = {&shift2221, &reduce2221, nullptr};
+State state2222 = {&shift2222, &reduce2222, nullptr};
+State state2223 = {&shift2223, &reduce2223, nullptr};
+State state2224 = {&shift2224, &reduce2224, nullptr};
+State state2225 = {&shift2225, &reduce2225, nullptr};
+State state2226 = {&shift2226, &reduce2226, nullptr};
+State state2227 = {&shift2227, &reduce2227, nullptr};
+State state2228 = {&shift2228, &reduce2228, nullptr};
+State state2229 = {&shift2229, &reduce2229, nullptr};
+State state2230 = {&shift2230, &reduce2230, nullptr};
+State state2231 = {&shift2231, &reduce2231, nullptr};
+State state2232 = {&shift2232, &reduce2232, nullptr};
+State state2233 = {&shift2233, &reduce2233, nullptr};
+State state2234 = {&shift2234, &reduce2234, nullptr};
+State state2235 = {&shift2235, &reduce2235, nullptr};
+State state2236 = {&shift2236, &reduce2236, nullptr};
+State state2237 = {&shift2237, &reduce2237, nullptr};
+State state2238 = {&shift2238, &reduce2238, nullptr};
+State state2239 = {&shift2239, &reduce2239, nullptr};
+State state2240 = {&shift2240, &reduce2240, nullptr};
+State state2241 = {&shift2241, &reduce2241, nullptr};
+State state2242 = {&shift2242, &reduce2242, nullptr};
+State state2243 = {&shift2243, &reduce2243, nullptr};
+State state2244 = {&shift2244, &reduce2244, nullptr};
+State state2245 = {&shift2245, &reduce2245, nullptr};
+State state2246 = {&shift2246, &reduce2246, nullptr};
+State state2247 = {&shift2247, &reduce2247, nullptr};
+State state2248 = {&shift2248, &reduce2248, nullptr};
+State state2249 = {&shift2249, &reduce2249, nullptr};
+State state2250 = {&shift2250, &reduce2250, nullptr};
+State state2251 = {&shift2251, &reduce2251, nullptr};
+State state2252 = {&shift2252, &reduce2252, nullptr};
+State state2253 = {&shift2253, &reduce2253, nullptr};
+State state2254 = {&shift2254, &reduce2254, nullptr};
+State state2255 = {&shift2255, &reduce2255, nullptr};
+State state2256 = {&shift2256, &reduce2256, nullptr};
+State state2257 = {&shift2257, &reduce2257, nullptr};
+State state2258 = {&shift2258, &reduce2258, nullptr};
+State state2259 = {&shift2259, &reduce2259, nullptr};
+State state2260 = {&shift2260, &reduce2260, nullptr};
+State state2261 = {&shift2261, &reduce2261, nullptr};
+State state2262 = {&shift2262, &reduce2262, nullptr};
+State state2263 = {&shift2263, &reduce2263, nullptr};
+State state2264 = {&shift2264, &reduce2264, nullptr};
+State state2265 = {&shift2265, &reduce2265, nullptr};
+State state2266 = {&shift2266, &reduce2266, nullptr};
+State state2267 = {&shift2267, &reduce2267, nullptr};
+State state2268 = {&shift2268, &reduce2268, nullptr};
+State state2269 = {&shift2269, &reduce2269, nullptr};
+State state2270 = {&shift2270, &reduce2270, nullptr};
+State state2271 = {&shift2271, &reduce2271, nullptr};
+State state2272 = {&shift2272, &reduce2272, nullptr};
+State state2273 = {&shift2273, &reduce2273, nullptr};
+State state2274 = {&shift2274, &reduce2274, nullptr};
+State state2275 = {&shift2275, &reduce2275, nullptr};
+State state2276 = {&shift2276, &reduce2276, nullptr};
+State state2277 = {&shift2277, &reduce2277, nullptr};
+State state2278 = {&shift2278, &reduce2278, nullptr};
+State state2279 = {&shift2279, &reduce2279, nullptr};
+State state2280 = {&shift2280, &reduce2280, nullptr};
+State state2281 = {&shift2281, &reduce2281, nullptr};
+State state2282 = {&shift2282, &reduce2282, nullptr};
+State state2283 = {&shift2283, &reduce2283, nullptr};
+State state2284 = {&shift2284, &reduce2284, nullptr};
+State state2285 = {&shift2285, &reduce2285, nullptr};
+State state2286 = {&shift2286, &reduce2286, nullptr};
+State state2287 = {&shift2287, &reduce2287, nullptr};
+State state2288 = {&shift2288, &reduce2288, nullptr};
+State state2289 = {&shift2289, &reduce2289, nullptr};
+State state2290 = {&shift2290, &reduce2290, nullptr};
+State state2291 = {&shift2291, &reduce2291, nullptr};
+State state2292 = {&shift2292, &reduce2292, nullptr};
+State state2293 = {&shift2293, &reduce2293, nullptr};
+State state2294 = {&shift2294, &reduce2294, nullptr};
+State state2295 = {&shift2295, &reduce2295, nullptr};
+State state2296 = {&shift2296, &reduce2296, nullptr};
+State state2297 = {&shift2297, &reduce2297, nullptr};
+State state2298 = {&shift2298, &reduce2298, nullptr};
+State state2299 = {&shift2299, &reduce2299, nullptr};
+State state2300 = {&shift2300, &reduce2300, nullptr};
+State state2301 = {&shift2301, &reduce2301, nullptr};
+State state2302 = {&shift2302, &reduce2302, nullptr};
+State state2303 = {&shift2303, &reduce2303, nullptr};
+State state2304 = {&shift2304, &reduce2304, nullptr};
+State state2305 = {&shift2305, &reduce2305, nullptr};
+State state2306 = {&shift2306, &reduce2306, nullptr};
+State state2307 = {&shift2307, &reduce2307, nullptr};
+State state2308 = {&shift2308, &reduce2308, nullptr};
+State state2309 = {&shift2309, &reduce2309, nullptr};
+State state2310 = {&shift2310, &reduce2310, nullptr};
+State state2311 = {&shift2311, &reduce2311, nullptr};
+State state2312 = {&shift2312, &reduce2312, nullptr};
+State state2313 = {&shift2313, &reduce2313, nullptr};
+State state2314 = {&shift2314, &reduce2314, nullptr};
+State state2315 = {&shift2315, &reduce2315, nullptr};
+State state2316 = {&shift2316, &reduce2316, nullptr};
+State state2317 = {&shift2317, &reduce2317, nullptr};
+State state2318 = {&shift2318, &reduce2318, nullptr};
+State state2319 = {&shift2319, &reduce2319, nullptr};
+State state2320 = {&shift2320, &reduce2320, nullptr};
+State state2321 = {&shift2321, &reduce2321, nullptr};
+State state2322 = {&shift2322, &reduce2322, nullptr};
+State state2323 = {&shift2323, &reduce2323, nullptr};
+State state2324 = {&shift2324, &reduce2324, nullptr};
+State state2325 = {&shift2325, &reduce2325, nullptr};
+State state2326 = {&shift2326, &reduce2326, nullptr};
+State state2327 = {&shift2327, &reduce2327, nullptr};
+State state2328 = {&shift2328, &reduce2328, nullptr};
+State state2329 = {&shift2329, &reduce2329, nullptr};
+State state2330 = {&shift2330, &reduce2330, nullptr};
+State state2331 = {&shift2331, &reduce2331, nullptr};
+State state2332 = {&shift2332, &reduce2332, nullptr};
+State state2333 = {&shift2333, &reduce2333, nullptr};
+State state2334 = {&shift2334, &reduce2334, nullptr};
+State state2335 = {&shift2335, &reduce2335, nullptr};
+State state2336 = {&shift2336, &reduce2336, nullptr};
+State state2337 = {&shift2337, &reduce2337, nullptr};
+State state2338 = {&shift2338, &reduce2338, nullptr};
+State state2339 = {&shift2339, &reduce2339, nullptr};
+State state2340 = {&shift2340, &reduce2340, nullptr};
+State state2341 = {&shift2341, &reduce2341, nullptr};
+State state2342 = {&shift2342, &reduce2342, nullptr};
+State state2343 = {&shift2343, &reduce2343, nullptr};
+State state2344 = {&shift2344, &reduce2344, nullptr};
+State state2345 = {&shift2345, &reduce2345, nullptr};
+State state2346 = {&shift2346, &reduce2346, nullptr};
+State state2347 = {&shift2347, &reduce2347, nullptr};
+State state2348 = {&shift2348, &reduce2348, nullptr};
+State state2349 = {&shift2349, &reduce2349, nullptr};
+State state2350 = {&shift2350, &reduce2350, nullptr};
+State state2351 = {&shift2351, &reduce2351, nullptr};
+State state2352 = {&shift2352, &reduce2352, nullptr};
+State state2353 = {&shift2353, &reduce2353, nullptr};
+State state2354 = {&shift2354, &reduce2354, nullptr};
+State state2355 = {&shift2355, &reduce2355, nullptr};
+State state2356 = {&shift2356, &reduce2356, nullptr};
+State state2357 = {&shift2357, &reduce2357, nullptr};
+State state2358 = {&shift2358, &reduce2358, nullptr};
+State state2359 = {&shift2359, &reduce2359, nullptr};
+State state2360 = {&shift2360, &reduce2360, nullptr};
+State state2361 = {&shift2361, &reduce2361, nullptr};
+State state2362 = {&shift2362, &reduce2362, nullptr};
+State state2363 = {&shift2363, &reduce2363, nullptr};
+State state2364 = {&shift2364, &reduce2364, nullptr};
+State state2365 = {&shift2365, &reduce2365, nullptr};
+State state2366 = {&shift2366, &reduce2366, nullptr};
+State state2367 = {&shift2367, &reduce2367, nullptr};
+State state2368 = {&shift2368, &reduce2368, nullptr};
+State state2369 = {&shift2369, &reduce2369, nullptr};
+State state2370 = {&shift2370, &reduce2370, nullptr};
+State state2371 = {&shift2371, &reduce2371, nullptr};
+State state2372 = {&shift2372, &reduce2372, nullptr};
+State state2373 = {&shift2373, &reduce2373, nullptr};
+State state2374 = {&shift2374, &reduce2374, nullptr};
+State state2375 = {&shift2375, &reduce2375, nullptr};
+State state2376 = {&shift2376, &reduce2376, nullptr};
+State state2377 = {&shift2377, &reduce2377, nullptr};
+State state2378 = {&shift2378, &reduce2378, nullptr};
+State state2379 = {&shift2379, &reduce2379, nullptr};
+State state2380 = {&shift2380, &reduce2380, nullptr};
+State state2381 = {&shift2381, &reduce2381, nullptr};
+State state2382 = {&shift2382, &reduce2382, nullptr};
+State state2383 = {&shift2383, &reduce2383, nullptr};
+State state2384 = {&shift2384, &reduce2384, nullptr};
+State state2385 = {&shift2385, &reduce2385, nullptr};
+State state2386 = {&shift2386, &reduce2386, nullptr};
+State state2387 = {&shift2387, &reduce2387, nullptr};
+State state2388 = {&shift2388, &reduce2388, nullptr};
+State state2389 = {&shift2389, &reduce2389, nullptr};
+State state2390 = {&shift2390, &reduce2390, nullptr};
+State state2391 = {&shift2391, &reduce2391, nullptr};
+State state2392 = {&shift2392, &reduce2392, nullptr};
+State state2393 = {&shift2393, &reduce2393, nullptr};
+State state2394 = {&shift2394, &reduce2394, nullptr};
+State state2395 = {&shift2395, &reduce2395, nullptr};
+State state2396 = {&shift2396, &reduce2396, nullptr};
+State state2397 = {&shift2397, &reduce2397, nullptr};
+State state2398 = {&shift2398, &reduce2398, nullptr};
+State state2399 = {&shift2399, &reduce2399, nullptr};
+State state2400 = {&shift2400, &reduce2400, nullptr};
+State state2401 = {&shift2401, &reduce2401, nullptr};
+State state2402 = {&shift2402, &reduce2402, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,3270 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ba", false, 0};
+Symbol term1 = {"bb", false, 1};
+Symbol term2 = {"bc", false, 2};
+Symbol term3 = {"bd", false, 3};
+Symbol term4 = {"be", false, 4};
+Symbol term5 = {"bf", false, 5};
+Symbol term6 = {"bg", false, 6};
+Symbol term7 = {"bh", false, 7};
+Symbol term8 = {"bi", false, 8};
+Symbol term9 = {"bj", false, 9};
+Symbol term10 = {"bk", false, 10};
+Symbol term11 = {"bl", false, 11};
+Symbol term12 = {"bm", false, 12};
+Symbol term13 = {"bn", false, 13};
+Symbol term14 = {"bo", false, 14};
+Symbol term15 = {"bp", false, 15};
+Symbol term16 = {"num", true, 16};
+Symbol term17 = {"ws", true, 17};
+Symbol term18 = {"id", false, 18};
+Symbol term19 = {";", false, 19};
+Symbol term20 = {"=", false, 20};
+Symbol term21 = {"{", false, 21};
+Symbol term22 = {"}", false, 22};
+Symbol term23 = {"(", false, 23};
+Symbol term24 = {")", false, 24};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 8, 8, 8, 8, 8,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 11, 12, 13, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 34, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 36 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node8; }
+    if ((k >= 17) && (k <= 31)) { return &node7; }
+    if (k == 32) { return &node9; }
+    if (k == 34) { return &node10; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 9) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 31)) { return &node7; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term17, nullptr};
+Node node2 = {nullptr, &term23, nullptr};
+Node node3 = {nullptr, &term24, nullptr};
+Node node4 = {&next4, &term16, nullptr};
+Node node5 = {nullptr, &term19, nullptr};
+Node node6 = {nullptr, &term20, nullptr};
+Node node7 = {&next7, &term18, nullptr};
+Node node8 = {&next8, &term18, nullptr};
+Node node9 = {nullptr, &term21, nullptr};
+Node node10 = {nullptr, &term22, nullptr};
+Node node11 = {&next11, &term0, nullptr};
+Node node12 = {&next12, &term1, nullptr};
+Node node13 = {&next13, &term2, nullptr};
+Node node14 = {&next14, &term3, nullptr};
+Node node15 = {&next15, &term4, nullptr};
+Node node16 = {&next16, &term5, nullptr};
+Node node17 = {&next17, &term6, nullptr};
+Node node18 = {&next18, &term7, nullptr};
+Node node19 = {&next19, &term8, nullptr};
+Node node20 = {&next20, &term9, nullptr};
+Node node21 = {&next21, &term10, nullptr};
+Node node22 = {&next22, &term11, nullptr};
+Node node23 = {&next23, &term12, nullptr};
+Node node24 = {&next24, &term13, nullptr};
+Node node25 = {&next25, &term14, nullptr};
+Node node26 = {&next26, &term15, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 25};
+Symbol nonterm0 = {"program", false, 0};
+Symbol nonterm1 = {"items0", false, 1};
+Symbol nonterm2 = {"item0", false, 2};
+Symbol nonterm3 = {"items1", false, 3};
+Symbol nonterm4 = {"item1", false, 4};
+Symbol nonterm5 = {"items2", false, 5};
+Symbol nonterm6 = {"item2", false, 6};
+Symbol nonterm7 = {"items3", false, 7};
+Symbol nonterm8 = {"item3", false, 8};
+Symbol nonterm9 = {"items4", false, 9};
+Symbol nonterm10 = {"item4", false, 10};
+Symbol nonterm11 = {"items5", false, 11};
+Symbol nonterm12 = {"item5", false, 12};
+Symbol nonterm13 = {"items6", false, 13};
+Symbol nonterm14 = {"item6", false, 14};
+Symbol nonterm15 = {"items7", false, 15};
+Symbol nonterm16 = {"item7", false, 16};
+Symbol nonterm17 = {"items8", false, 17};
+Symbol nonterm18 = {"item8", false, 18};
+Symbol nonterm19 = {"items9", false, 19};
+Symbol nonterm20 = {"item9", false, 20};
+Symbol nonterm21 = {"items10", false, 21};
+Symbol nonterm22 = {"item10", false, 22};
+Symbol nonterm23 = {"items11", false, 23};
+Symbol nonterm24 = {"item11", false, 24};
+Symbol nonterm25 = {"items12", false, 25};
+Symbol nonterm26 = {"item12", false, 26};
+Symbol nonterm27 = {"items13", false, 27};
+Symbol nonterm28 = {"item13", false, 28};
+Symbol nonterm29 = {"items14", false, 29};
+Symbol nonterm30 = {"item14", false, 30};
+Symbol nonterm31 = {"items15", false, 31};
+Symbol nonterm32 = {"item15", false, 32};
+
+unique_ptr<Tree>
+reduce_program_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_0(Table*);
+
+Value*
+reduce_items0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items0_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_0(Table*);
+
+Value*
+reduce_item0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_1(Table*);
+
+Value*
+reduce_item0_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_0(Table*);
+
+Value*
+reduce_items1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items1_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_0(Table*);
+
+Value*
+reduce_item1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_1(Table*);
+
+Value*
+reduce_item1_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_0(Table*);
+
+Value*
+reduce_items2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items2_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_0(Table*);
+
+Value*
+reduce_item2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_1(Table*);
+
+Value*
+reduce_item2_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_0(Table*);
+
+Value*
+reduce_items3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items3_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_0(Table*);
+
+Value*
+reduce_item3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_1(Table*);
+
+Value*
+reduce_item3_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_0(Table*);
+
+Value*
+reduce_items4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items4_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_0(Table*);
+
+Value*
+reduce_item4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_1(Table*);
+
+Value*
+reduce_item4_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_0(Table*);
+
+Value*
+reduce_items5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items5_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_0(Table*);
+
+Value*
+reduce_item5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_1(Table*);
+
+Value*
+reduce_item5_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_0(Table*);
+
+Value*
+reduce_items6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items6_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_0(Table*);
+
+Value*
+reduce_item6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_1(Table*);
+
+Value*
+reduce_item6_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_0(Table*);
+
+Value*
+reduce_items7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items7_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_0(Table*);
+
+Value*
+reduce_item7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_1(Table*);
+
+Value*
+reduce_item7_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_0(Table*);
+
+Value*
+reduce_items8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items8_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_0(Table*);
+
+Value*
+reduce_item8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_1(Table*);
+
+Value*
+reduce_item8_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_0(Table*);
+
+Value*
+reduce_items9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items9_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_0(Table*);
+
+Value*
+reduce_item9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_1(Table*);
+
+Value*
+reduce_item9_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_0(Table*);
+
+Value*
+reduce_items10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items10_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_0(Table*);
+
+Value*
+reduce_item10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_1(Table*);
+
+Value*
+reduce_item10_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_0(Table*);
+
+Value*
+reduce_items11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items11_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_0(Table*);
+
+Value*
+reduce_item11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_1(Table*);
+
+Value*
+reduce_item11_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_0(Table*);
+
+Value*
+reduce_items12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items12_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_0(Table*);
+
+Value*
+reduce_item12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_1(Table*);
+
+Value*
+reduce_item12_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_0(Table*);
+
+Value*
+reduce_items13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items13_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_0(Table*);
+
+Value*
+reduce_item13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_1(Table*);
+
+Value*
+reduce_item13_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_0(Table*);
+
+Value*
+reduce_items14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items14_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_0(Table*);
+
+Value*
+reduce_item14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_1(Table*);
+
+Value*
+reduce_item14_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_0(Table*);
+
+Value*
+reduce_items15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items15_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_0(Table*);
+
+Value*
+reduce_item15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_1(Table*);
+
+Value*
+reduce_item15_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_3(table, E2);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_program_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_items0_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_items0_1, -1};
+Rule rule3 = {&nonterm2, 2, &reduce_item0_0, -1};
+Rule rule4 = {&nonterm2, 4, &reduce_item0_1, -1};
+Rule rule5 = {&nonterm2, 4, &reduce_item0_2, -1};
+Rule rule6 = {&nonterm2, 4, &reduce_item0_3, -1};
+Rule rule7 = {&nonterm3, 0, &reduce_items1_0, -1};
+Rule rule8 = {&nonterm3, 2, &reduce_items1_1, -1};
+Rule rule9 = {&nonterm4, 2, &reduce_item1_0, -1};
+Rule rule10 = {&nonterm4, 4, &reduce_item1_1, -1};
+Rule rule11 = {&nonterm4, 4, &reduce_item1_2, -1};
+Rule rule12 = {&nonterm4, 4, &reduce_item1_3, -1};
+Rule rule13 = {&nonterm5, 0, &reduce_items2_0, -1};
+Rule rule14 = {&nonterm5, 2, &reduce_items2_1, -1};
+Rule rule15 = {&nonterm6, 2, &reduce_item2_0, -1};
+Rule rule16 = {&nonterm6, 4, &reduce_item2_1, -1};
+Rule rule17 = {&nonterm6, 4, &reduce_item2_2, -1};
+Rule rule18 = {&nonterm6, 4, &reduce_item2_3, -1};
+Rule rule19 = {&nonterm7, 0, &reduce_items3_0, -1};
+Rule rule20 = {&nonterm7, 2, &reduce_items3_1, -1};
+Rule rule21 = {&nonterm8, 2, &reduce_item3_0, -1};
+Rule rule22 = {&nonterm8, 4, &reduce_item3_1, -1};
+Rule rule23 = {&nonterm8, 4, &reduce_item3_2, -1};
+Rule rule24 = {&nonterm8, 4, &reduce_item3_3, -1};
+Rule rule25 = {&nonterm9, 0, &reduce_items4_0, -1};
+Rule rule26 = {&nonterm9, 2, &reduce_items4_1, -1};
+Rule rule27 = {&nonterm10, 2, &reduce_item4_0, -1};
+Rule rule28 = {&nonterm10, 4, &reduce_item4_1, -1};
+Rule rule29 = {&nonterm10, 4, &reduce_item4_2, -1};
+Rule rule30 = {&nonterm10, 4, &reduce_item4_3, -1};
+Rule rule31 = {&nonterm11, 0, &reduce_items5_0, -1};
+Rule rule32 = {&nonterm11, 2, &reduce_items5_1, -1};
+Rule rule33 = {&nonterm12, 2, &reduce_item5_0, -1};
+Rule rule34 = {&nonterm12, 4, &reduce_item5_1, -1};
+Rule rule35 = {&nonterm12, 4, &reduce_item5_2, -1};
+Rule rule36 = {&nonterm12, 4, &reduce_item5_3, -1};
+Rule rule37 = {&nonterm13, 0, &reduce_items6_0, -1};
+Rule rule38 = {&nonterm13, 2, &reduce_items6_1, -1};
+Rule rule39 = {&nonterm14, 2, &reduce_item6_0, -1};
+Rule rule40 = {&nonterm14, 4, &reduce_item6_1, -1};
+Rule rule41 = {&nonterm14, 4, &reduce_item6_2, -1};
+Rule rule42 = {&nonterm14, 4, &reduce_item6_3, -1};
+Rule rule43 = {&nonterm15, 0, &reduce_items7_0, -1};
+Rule rule44 = {&nonterm15, 2, &reduce_items7_1, -1};
+Rule rule45 = {&nonterm16, 2, &reduce_item7_0, -1};
+Rule rule46 = {&nonterm16, 4, &reduce_item7_1, -1};
+Rule rule47 = {&nonterm16, 4, &reduce_item7_2, -1};
+Rule rule48 = {&nonterm16, 4, &reduce_item7_3, -1};
+Rule rule49 = {&nonterm17, 0, &reduce_items8_0, -1};
+Rule rule50 = {&nonterm17, 2, &reduce_items8_1, -1};
+Rule rule51 = {&nonterm18, 2, &reduce_item8_0, -1};
+Rule rule52 = {&nonterm18, 4, &reduce_item8_1, -1};
+Rule rule53 = {&nonterm18, 4, &reduce_item8_2, -1};
+Rule rule54 = {&nonterm18, 4, &reduce_item8_3, -1};
+Rule rule55 = {&nonterm19, 0, &reduce_items9_0, -1};
+Rule rule56 = {&nonterm19, 2, &reduce_items9_1, -1};
+Rule rule57 = {&nonterm20, 2, &reduce_item9_0, -1};
+Rule rule58 = {&nonterm20, 4, &reduce_item9_1, -1};
+Rule rule59 = {&nonterm20, 4, &reduce_item9_2, -1};
+Rule rule60 = {&nonterm20, 4, &reduce_item9_3, -1};
+Rule rule61 = {&nonterm21, 0, &reduce_items10_0, -1};
+Rule rule62 = {&nonterm21, 2, &reduce_items10_1, -1};
+Rule rule63 = {&nonterm22, 2, &reduce_item10_0, -1};
+Rule rule64 = {&nonterm22, 4, &reduce_item10_1, -1};
+Rule rule65 = {&nonterm22, 4, &reduce_item10_2, -1};
+Rule rule66 = {&nonterm22, 4, &reduce_item10_3, -1};
+Rule rule67 = {&nonterm23, 0, &reduce_items11_0, -1};
+Rule rule68 = {&nonterm23, 2, &reduce_items11_1, -1};
+Rule rule69 = {&nonterm24, 2, &reduce_item11_0, -1};
+Rule rule70 = {&nonterm24, 4, &reduce_item11_1, -1};
+Rule rule71 = {&nonterm24, 4, &reduce_item11_2, -1};
+Rule rule72 = {&nonterm24, 4, &reduce_item11_3, -1};
+Rule rule73 = {&nonterm25, 0, &reduce_items12_0, -1};
+Rule rule74 = {&nonterm25, 2, &reduce_items12_1, -1};
+Rule rule75 = {&nonterm26, 2, &reduce_item12_0, -1};
+Rule rule76 = {&nonterm26, 4, &reduce_item12_1, -1};
+Rule rule77 = {&nonterm26, 4, &reduce_item12_2, -1};
+Rule rule78 = {&nonterm26, 4, &reduce_item12_3, -1};
+Rule rule79 = {&nonterm27, 0, &reduce_items13_0, -1};
+Rule rule80 = {&nonterm27, 2, &reduce_items13_1, -1};
+Rule rule81 = {&nonterm28, 2, &reduce_item13_0, -1};
+Rule rule82 = {&nonterm28, 4, &reduce_item13_1, -1};
+Rule rule83 = {&nonterm28, 4, &reduce_item13_2, -1};
+Rule rule84 = {&nonterm28, 4, &reduce_item13_3, -1};
+Rule rule85 = {&nonterm29, 0, &reduce_items14_0, -1};
+Rule rule86 = {&nonterm29, 2, &reduce_items14_1, -1};
+Rule rule87 = {&nonterm30, 2, &reduce_item14_0, -1};
+Rule rule88 = {&nonterm30, 4, &reduce_item14_1, -1};
+Rule rule89 = {&nonterm30, 4, &reduce_item14_2, -1};
+Rule rule90 = {&nonterm30, 4, &reduce_item14_3, -1};
+Rule rule91 = {&nonterm31, 0, &reduce_items15_0, -1};
+Rule rule92 = {&nonterm31, 2, &reduce_items15_1, -1};
+Rule rule93 = {&nonterm32, 2, &reduce_item15_0, -1};
+Rule rule94 = {&nonterm32, 4, &reduce_item15_1, -1};
+Rule rule95 = {&nonterm32, 4, &reduce_item15_2, -1};
+Rule rule96 = {&nonterm32, 4, &reduce_item15_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term18, &state3}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term21, &state428}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term19, &state5}, {&term20, &state6}, {&term23, &state7}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {};
+std::vector<Reduce> reduce4 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift5 = {};
+std::vector<Reduce> reduce5 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift6 = {{&term18, &state426}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {};
+std::vector<Reduce> reduce7 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift8 = {{&term1, &state9}, {&term18, &state10}, {&term24, &state11}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term21, &state423}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term19, &state13}, {&term20, &state14}, {&term23, &state15}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {};
+std::vector<Reduce> reduce11 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift12 = {};
+std::vector<Reduce> reduce12 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift13 = {};
+std::vector<Reduce> reduce13 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift14 = {{&term18, &state421}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {};
+std::vector<Reduce> reduce15 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift16 = {{&term2, &state17}, {&term18, &state18}, {&term24, &state19}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term21, &state418}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term19, &state21}, {&term20, &state22}, {&term23, &state23}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {};
+std::vector<Reduce> reduce19 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift20 = {};
+std::vector<Reduce> reduce20 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift21 = {};
+std::vector<Reduce> reduce21 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift22 = {{&term18, &state416}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {};
+std::vector<Reduce> reduce23 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift24 = {{&term3, &state25}, {&term18, &state26}, {&term24, &state27}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term21, &state413}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term19, &state29}, {&term20, &state30}, {&term23, &state31}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {};
+std::vector<Reduce> reduce27 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift28 = {};
+std::vector<Reduce> reduce28 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift29 = {};
+std::vector<Reduce> reduce29 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift30 = {{&term18, &state411}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {};
+std::vector<Reduce> reduce31 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift32 = {{&term4, &state33}, {&term18, &state34}, {&term24, &state35}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term21, &state408}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term19, &state37}, {&term20, &state38}, {&term23, &state39}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {};
+std::vector<Reduce> reduce35 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift36 = {};
+std::vector<Reduce> reduce36 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift37 = {};
+std::vector<Reduce> reduce37 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift38 = {{&term18, &state406}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {};
+std::vector<Reduce> reduce39 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift40 = {{&term5, &state41}, {&term18, &state42}, {&term24, &state43}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term21, &state403}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term19, &state45}, {&term20, &state46}, {&term23, &state47}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {};
+std::vector<Reduce> reduce43 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift44 = {};
+std::vector<Reduce> reduce44 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift45 = {};
+std::vector<Reduce> reduce45 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift46 = {{&term18, &state401}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {};
+std::vector<Reduce> reduce47 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift48 = {{&term6, &state49}, {&term18, &state50}, {&term24, &state51}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term21, &state398}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term19, &state53}, {&term20, &state54}, {&term23, &state55}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {};
+std::vector<Reduce> reduce51 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift52 = {};
+std::vector<Reduce> reduce52 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift53 = {};
+std::vector<Reduce> reduce53 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift54 = {{&term18, &state396}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {};
+std::vector<Reduce> reduce55 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift56 = {{&term7, &state57}, {&term18, &state58}, {&term24, &state59}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term21, &state393}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term19, &state61}, {&term20, &state62}, {&term23, &state63}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {};
+std::vector<Reduce> reduce59 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift60 = {};
+std::vector<Reduce> reduce60 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift61 = {};
+std::vector<Reduce> reduce61 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift62 = {{&term18, &state391}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {};
+std::vector<Reduce> reduce63 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift64 = {{&term8, &state65}, {&term18, &state66}, {&term24, &state67}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term21, &state388}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term19, &state69}, {&term20, &state70}, {&term23, &state71}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {};
+std::vector<Reduce> reduce67 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift68 = {};
+std::vector<Reduce> reduce68 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift69 = {};
+std::vector<Reduce> reduce69 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift70 = {{&term18, &state386}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {};
+std::vector<Reduce> reduce71 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift72 = {{&term9, &state73}, {&term18, &state74}, {&term24, &state75}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term21, &state383}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term19, &state77}, {&term20, &state78}, {&term23, &state79}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {};
+std::vector<Reduce> reduce75 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift76 = {};
+std::vector<Reduce> reduce76 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift77 = {};
+std::vector<Reduce> reduce77 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift78 = {{&term18, &state381}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {};
+std::vector<Reduce> reduce79 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift80 = {{&term10, &state81}, {&term18, &state82}, {&term24, &state83}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term21, &state378}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term19, &state85}, {&term20, &state86}, {&term23, &state87}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {};
+std::vector<Reduce> reduce83 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift84 = {};
+std::vector<Reduce> reduce84 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift85 = {};
+std::vector<Reduce> reduce85 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift86 = {{&term18, &state376}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {};
+std::vector<Reduce> reduce87 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift88 = {{&term11, &state89}, {&term18, &state90}, {&term24, &state91}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term21, &state373}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term19, &state93}, {&term20, &state94}, {&term23, &state95}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {};
+std::vector<Reduce> reduce91 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift92 = {};
+std::vector<Reduce> reduce92 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift93 = {};
+std::vector<Reduce> reduce93 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift94 = {{&term18, &state371}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {};
+std::vector<Reduce> reduce95 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift96 = {{&term12, &state97}, {&term18, &state98}, {&term24, &state99}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term21, &state368}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term19, &state101}, {&term20, &state102}, {&term23, &state103}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {};
+std::vector<Reduce> reduce99 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift100 = {};
+std::vector<Reduce> reduce100 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift101 = {};
+std::vector<Reduce> reduce101 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift102 = {{&term18, &state366}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {};
+std::vector<Reduce> reduce103 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift104 = {{&term13, &state105}, {&term18, &state106}, {&term24, &state107}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term21, &state363}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term19, &state109}, {&term20, &state110}, {&term23, &state111}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {};
+std::vector<Reduce> reduce107 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift108 = {};
+std::vector<Reduce> reduce108 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift109 = {};
+std::vector<Reduce> reduce109 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift110 = {{&term18, &state361}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {};
+std::vector<Reduce> reduce111 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift112 = {{&term14, &state113}, {&term18, &state114}, {&term24, &state115}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term21, &state358}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term19, &state117}, {&term20, &state118}, {&term23, &state119}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {};
+std::vector<Reduce> reduce115 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift116 = {};
+std::vector<Reduce> reduce116 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift117 = {};
+std::vector<Reduce> reduce117 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift118 = {{&term18, &state356}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {};
+std::vector<Reduce> reduce119 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift120 = {{&term15, &state121}, {&term18, &state122}, {&term24, &state123}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term21, &state353}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term19, &state125}, {&term20, &state126}, {&term23, &state127}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {};
+std::vector<Reduce> reduce123 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift124 = {};
+std::vector<Reduce> reduce124 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift125 = {};
+std::vector<Reduce> reduce125 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift126 = {{&term18, &state351}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift128 = {{&term0, &state129}, {&term18, &state130}, {&term24, &state131}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term21, &state140}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term19, &state133}, {&term20, &state134}, {&term23, &state135}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {};
+std::vector<Reduce> reduce131 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift134 = {{&term18, &state138}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift136 = {{&term1, &state9}, {&term18, &state10}, {&term24, &state137}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift138 = {{&term19, &state139}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {};
+std::vector<Reduce> reduce139 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift141 = {{&term1, &state142}, {&term18, &state143}, {&term22, &state144}};
+std::vector<Reduce> reduce141 = {};
+std::vector<Shift> shift142 = {{&term21, &state153}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {{&term19, &state146}, {&term20, &state147}, {&term23, &state148}};
+std::vector<Reduce> reduce143 = {};
+std::vector<Shift> shift144 = {};
+std::vector<Reduce> reduce144 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift147 = {{&term18, &state151}};
+std::vector<Reduce> reduce147 = {};
+std::vector<Shift> shift149 = {{&term2, &state17}, {&term18, &state18}, {&term24, &state150}};
+std::vector<Reduce> reduce149 = {};
+std::vector<Shift> shift151 = {{&term19, &state152}};
+std::vector<Reduce> reduce151 = {};
+std::vector<Shift> shift152 = {};
+std::vector<Reduce> reduce152 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift154 = {{&term2, &state155}, {&term18, &state156}, {&term22, &state157}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {{&term21, &state166}};
+std::vector<Reduce> reduce155 = {};
+std::vector<Shift> shift156 = {{&term19, &state159}, {&term20, &state160}, {&term23, &state161}};
+std::vector<Reduce> reduce156 = {};
+std::vector<Shift> shift157 = {};
+std::vector<Reduce> reduce157 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift160 = {{&term18, &state164}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift162 = {{&term3, &state25}, {&term18, &state26}, {&term24, &state163}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift164 = {{&term19, &state165}};
+std::vector<Reduce> reduce164 = {};
+std::vector<Shift> shift165 = {};
+std::vector<Reduce> reduce165 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift167 = {{&term3, &state168}, {&term18, &state169}, {&term22, &state170}};
+std::vector<Reduce> reduce167 = {};
+std::vector<Shift> shift168 = {{&term21, &state179}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term19, &state172}, {&term20, &state173}, {&term23, &state174}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {};
+std::vector<Reduce> reduce170 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift173 = {{&term18, &state177}};
+std::vector<Reduce> reduce173 = {};
+std::vector<Shift> shift175 = {{&term4, &state33}, {&term18, &state34}, {&term24, &state176}};
+std::vector<Reduce> reduce175 = {};
+std::vector<Shift> shift177 = {{&term19, &state178}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {};
+std::vector<Reduce> reduce178 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift180 = {{&term4, &state181}, {&term18, &state182}, {&term22, &state183}};
+std::vector<Reduce> reduce180 = {};
+std::vector<Shift> shift181 = {{&term21, &state192}};
+std::vector<Reduce> reduce181 = {};
+std::vector<Shift> shift182 = {{&term19, &state185}, {&term20, &state186}, {&term23, &state187}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {};
+std::vector<Reduce> reduce183 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift186 = {{&term18, &state190}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift188 = {{&term5, &state41}, {&term18, &state42}, {&term24, &state189}};
+std::vector<Reduce> reduce188 = {};
+std::vector<Shift> shift190 = {{&term19, &state191}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {};
+std::vector<Reduce> reduce191 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift193 = {{&term5, &state194}, {&term18, &state195}, {&term22, &state196}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term21, &state205}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {{&term19, &state198}, {&term20, &state199}, {&term23, &state200}};
+std::vector<Reduce> reduce195 = {};
+std::vector<Shift> shift196 = {};
+std::vector<Reduce> reduce196 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift199 = {{&term18, &state203}};
+std::vector<Reduce> reduce199 = {};
+std::vector<Shift> shift201 = {{&term6, &state49}, {&term18, &state50}, {&term24, &state202}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift203 = {{&term19, &state204}};
+std::vector<Reduce> reduce203 = {};
+std::vector<Shift> shift204 = {};
+std::vector<Reduce> reduce204 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift206 = {{&term6, &state207}, {&term18, &state208}, {&term22, &state209}};
+std::vector<Reduce> reduce206 = {};
+std::vector<Shift> shift207 = {{&term21, &state218}};
+std::vector<Reduce> reduce207 = {};
+std::vector<Shift> shift208 = {{&term19, &state211}, {&term20, &state212}, {&term23, &state213}};
+std::vector<Reduce> reduce208 = {};
+std::vector<Shift> shift209 = {};
+std::vector<Reduce> reduce209 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift212 = {{&term18, &state216}};
+std::vector<Reduce> reduce212 = {};
+std::vector<Shift> shift214 = {{&term7, &state57}, {&term18, &state58}, {&term24, &state215}};
+std::vector<Reduce> reduce214 = {};
+std::vector<Shift> shift216 = {{&term19, &state217}};
+std::vector<Reduce> reduce216 = {};
+std::vector<Shift> shift217 = {};
+std::vector<Reduce> reduce217 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift219 = {{&term7, &state220}, {&term18, &state221}, {&term22, &state222}};
+std::vector<Reduce> reduce219 = {};
+std::vector<Shift> shift220 = {{&term21, &state231}};
+std::vector<Reduce> reduce220 = {};
+std::vector<Shift> shift221 = {{&term19, &state224}, {&term20, &state225}, {&term23, &state226}};
+std::vector<Reduce> reduce221 = {};
+std::vector<Shift> shift222 = {};
+std::vector<Reduce> reduce222 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift225 = {{&term18, &state229}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift227 = {{&term8, &state65}, {&term18, &state66}, {&term24, &state228}};
+std::vector<Reduce> reduce227 = {};
+std::vector<Shift> shift229 = {{&term19, &state230}};
+std::vector<Reduce> reduce229 = {};
+std::vector<Shift> shift230 = {};
+std::vector<Reduce> reduce230 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift232 = {{&term8, &state233}, {&term18, &state234}, {&term22, &state235}};
+std::vector<Reduce> reduce232 = {};
+std::vector<Shift> shift233 = {{&term21, &state244}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {{&term19, &state237}, {&term20, &state238}, {&term23, &state239}};
+std::vector<Reduce> reduce234 = {};
+std::vector<Shift> shift235 = {};
+std::vector<Reduce> reduce235 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift238 = {{&term18, &state242}};
+std::vector<Reduce> reduce238 = {};
+std::vector<Shift> shift240 = {{&term9, &state73}, {&term18, &state74}, {&term24, &state241}};
+std::vector<Reduce> reduce240 = {};
+std::vector<Shift> shift242 = {{&term19, &state243}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {};
+std::vector<Reduce> reduce243 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift245 = {{&term9, &state246}, {&term18, &state247}, {&term22, &state248}};
+std::vector<Reduce> reduce245 = {};
+std::vector<Shift> shift246 = {{&term21, &state257}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {{&term19, &state250}, {&term20, &state251}, {&term23, &state252}};
+std::vector<Reduce> reduce247 = {};
+std::vector<Shift> shift248 = {};
+std::vector<Reduce> reduce248 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift251 = {{&term18, &state255}};
+std::vector<Reduce> reduce251 = {};
+std::vector<Shift> shift253 = {{&term10, &state81}, {&term18, &state82}, {&term24, &state254}};
+std::vector<Reduce> reduce253 = {};
+std::vector<Shift> shift255 = {{&term19, &state256}};
+std::vector<Reduce> reduce255 = {};
+std::vector<Shift> shift256 = {};
+std::vector<Reduce> reduce256 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift258 = {{&term10, &state259}, {&term18, &state260}, {&term22, &state261}};
+std::vector<Reduce> reduce258 = {};
+std::vector<Shift> shift259 = {{&term21, &state270}};
+std::vector<Reduce> reduce259 = {};
+std::vector<Shift> shift260 = {{&term19, &state263}, {&term20, &state264}, {&term23, &state265}};
+std::vector<Reduce> reduce260 = {};
+std::vector<Shift> shift261 = {};
+std::vector<Reduce> reduce261 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift264 = {{&term18, &state268}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift266 = {{&term11, &state89}, {&term18, &state90}, {&term24, &state267}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift268 = {{&term19, &state269}};
+std::vector<Reduce> reduce268 = {};
+std::vector<Shift> shift269 = {};
+std::vector<Reduce> reduce269 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift271 = {{&term11, &state272}, {&term18, &state273}, {&term22, &state274}};
+std::vector<Reduce> reduce271 = {};
+std::vector<Shift> shift272 = {{&term21, &state283}};
+std::vector<Reduce> reduce272 = {};
+std::vector<Shift> shift273 = {{&term19, &state276}, {&term20, &state277}, {&term23, &state278}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {};
+std::vector<Reduce> reduce274 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift277 = {{&term18, &state281}};
+std::vector<Reduce> reduce277 = {};
+std::vector<Shift> shift279 = {{&term12, &state97}, {&term18, &state98}, {&term24, &state280}};
+std::vector<Reduce> reduce279 = {};
+std::vector<Shift> shift281 = {{&term19, &state282}};
+std::vector<Reduce> reduce281 = {};
+std::vector<Shift> shift282 = {};
+std::vector<Reduce> reduce282 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift284 = {{&term12, &state285}, {&term18, &state286}, {&term22, &state287}};
+std::vector<Reduce> reduce284 = {};
+std::vector<Shift> shift285 = {{&term21, &state296}};
+std::vector<Reduce> reduce285 = {};
+std::vector<Shift> shift286 = {{&term19, &state289}, {&term20, &state290}, {&term23, &state291}};
+std::vector<Reduce> reduce286 = {};
+std::vector<Shift> shift287 = {};
+std::vector<Reduce> reduce287 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift290 = {{&term18, &state294}};
+std::vector<Reduce> reduce290 = {};
+std::vector<Shift> shift292 = {{&term13, &state105}, {&term18, &state106}, {&term24, &state293}};
+std::vector<Reduce> reduce292 = {};
+std::vector<Shift> shift294 = {{&term19, &state295}};
+std::vector<Reduce> reduce294 = {};
+std::vector<Shift> shift295 = {};
+std::vector<Reduce> reduce295 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift297 = {{&term13, &state298}, {&term18, &state299}, {&term22, &state300}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {{&term21, &state309}};
+std::vector<Reduce> reduce298 = {};
+std::vector<Shift> shift299 = {{&term19, &state302}, {&term20, &state303}, {&term23, &state304}};
+std::vector<Reduce> reduce299 = {};
+std::vector<Shift> shift300 = {};
+std::vector<Reduce> reduce300 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift303 = {{&term18, &state307}};
+std::vector<Reduce> reduce303 = {};
+std::vector<Shift> shift305 = {{&term14, &state113}, {&term18, &state114}, {&term24, &state306}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift307 = {{&term19, &state308}};
+std::vector<Reduce> reduce307 = {};
+std::vector<Shift> shift308 = {};
+std::vector<Reduce> reduce308 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift310 = {{&term14, &state311}, {&term18, &state312}, {&term22, &state313}};
+std::vector<Reduce> reduce310 = {};
+std::vector<Shift> shift311 = {{&term21, &state322}};
+std::vector<Reduce> reduce311 = {};
+std::vector<Shift> shift312 = {{&term19, &state315}, {&term20, &state316}, {&term23, &state317}};
+std::vector<Reduce> reduce312 = {};
+std::vector<Shift> shift313 = {};
+std::vector<Reduce> reduce313 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift316 = {{&term18, &state320}};
+std::vector<Reduce> reduce316 = {};
+std::vector<Shift> shift318 = {{&term15, &state121}, {&term18, &state122}, {&term24, &state319}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift320 = {{&term19, &state321}};
+std::vector<Reduce> reduce320 = {};
+std::vector<Shift> shift321 = {};
+std::vector<Reduce> reduce321 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift323 = {{&term15, &state324}, {&term18, &state325}, {&term22, &state326}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {{&term21, &state335}};
+std::vector<Reduce> reduce324 = {};
+std::vector<Shift> shift325 = {{&term19, &state328}, {&term20, &state329}, {&term23, &state330}};
+std::vector<Reduce> reduce325 = {};
+std::vector<Shift> shift326 = {};
+std::vector<Reduce> reduce326 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift329 = {{&term18, &state333}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift331 = {{&term0, &state129}, {&term18, &state130}, {&term24, &state332}};
+std::vector<Reduce> reduce331 = {};
+std::vector<Shift> shift333 = {{&term19, &state334}};
+std::vector<Reduce> reduce333 = {};
+std::vector<Shift> shift334 = {};
+std::vector<Reduce> reduce334 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift336 = {{&term0, &state337}, {&term18, &state338}, {&term22, &state339}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {{&term21, &state348}};
+std::vector<Reduce> reduce337 = {};
+std::vector<Shift> shift338 = {{&term19, &state341}, {&term20, &state342}, {&term23, &state343}};
+std::vector<Reduce> reduce338 = {};
+std::vector<Shift> shift339 = {};
+std::vector<Reduce> reduce339 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift342 = {{&term18, &state346}};
+std::vector<Reduce> reduce342 = {};
+std::vector<Shift> shift344 = {{&term1, &state9}, {&term18, &state10}, {&term24, &state345}};
+std::vector<Reduce> reduce344 = {};
+std::vector<Shift> shift346 = {{&term19, &state347}};
+std::vector<Reduce> reduce346 = {};
+std::vector<Shift> shift349 = {{&term1, &state142}, {&term18, &state143}, {&term22, &state350}};
+std::vector<Reduce> reduce349 = {};
+std::vector<Shift> shift351 = {{&term19, &state352}};
+std::vector<Reduce> reduce351 = {};
+std::vector<Shift> shift354 = {{&term0, &state337}, {&term18, &state338}, {&term22, &state355}};
+std::vector<Reduce> reduce354 = {};
+std::vector<Shift> shift356 = {{&term19, &state357}};
+std::vector<Reduce> reduce356 = {};
+std::vector<Shift> shift359 = {{&term15, &state324}, {&term18, &state325}, {&term22, &state360}};
+std::vector<Reduce> reduce359 = {};
+std::vector<Shift> shift361 = {{&term19, &state362}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift364 = {{&term14, &state311}, {&term18, &state312}, {&term22, &state365}};
+std::vector<Reduce> reduce364 = {};
+std::vector<Shift> shift366 = {{&term19, &state367}};
+std::vector<Reduce> reduce366 = {};
+std::vector<Shift> shift369 = {{&term13, &state298}, {&term18, &state299}, {&term22, &state370}};
+std::vector<Reduce> reduce369 = {};
+std::vector<Shift> shift371 = {{&term19, &state372}};
+std::vector<Reduce> reduce371 = {};
+std::vector<Shift> shift374 = {{&term12, &state285}, {&term18, &state286}, {&term22, &state375}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift376 = {{&term19, &state377}};
+std::vector<Reduce> reduce376 = {};
+std::vector<Shift> shift379 = {{&term11, &state272}, {&term18, &state273}, {&term22, &state380}};
+std::vector<Reduce> reduce379 = {};
+std::vector<Shift> shift381 = {{&term19, &state382}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift384 = {{&term10, &state259}, {&term18, &state260}, {&term22, &state385}};
+std::vector<Reduce> reduce384 = {};
+std::vector<Shift> shift386 = {{&term19, &state387}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift389 = {{&term9, &state246}, {&term18, &state247}, {&term22, &state390}};
+std::vector<Reduce> reduce389 = {};
+std::vector<Shift> shift391 = {{&term19, &state392}};
+std::vector<Reduce> reduce391 = {};
+std::vector<Shift> shift394 = {{&term8, &state233}, {&term18, &state234}, {&term22, &state395}};
+std::vector<Reduce> reduce394 = {};
+std::vector<Shift> shift396 = {{&term19, &state397}};
+std::vector<Reduce> reduce396 = {};
+std::vector<Shift> shift399 = {{&term7, &state220}, {&term18, &state221}, {&term22, &state400}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift401 = {{&term19, &state402}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift404 = {{&term6, &state207}, {&term18, &state208}, {&term22, &state405}};
+std::vector<Reduce> reduce404 = {};
+std::vector<Shift> shift406 = {{&term19, &state407}};
+std::vector<Reduce> reduce406 = {};
+std::vector<Shift> shift409 = {{&term5, &state194}, {&term18, &state195}, {&term22, &state410}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift411 = {{&term19, &state412}};
+std::vector<Reduce> reduce411 = {};
+std::vector<Shift> shift414 = {{&term4, &state181}, {&term18, &state182}, {&term22, &state415}};
+std::vector<Reduce> reduce414 = {};
+std::vector<Shift> shift416 = {{&term19, &state417}};
+std::vector<Reduce> reduce416 = {};
+std::vector<Shift> shift419 = {{&term3, &state168}, {&term18, &state169}, {&term22, &state420}};
+std::vector<Reduce> reduce419 = {};
+std::vector<Shift> shift421 = {{&term19, &state422}};
+std::vector<Reduce> reduce421 = {};
+std::vector<Shift> shift424 = {{&term2, &state155}, {&term18, &state156}, {&term22, &state425}};
+std::vector<Reduce> reduce424 = {};
+std::vector<Shift> shift426 = {{&term19, &state427}};
+std::vector<Reduce> reduce426 = {};
+std::vector<Shift> shift429 = {{&term1, &state142}, {&term18, &state143}, {&term22, &state430}};
+std::vector<Reduce> reduce429 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state4}};
+std::vector<Go> go7 = {{&nonterm3, &state8}};
+std::vector<Go> go8 = {{&nonterm4, &state12}};
+std::vector<Go> go15 = {{&nonterm5, &state16}};
+std::vector<Go> go16 = {{&nonterm6, &state20}};
+std::vector<Go> go23 = {{&nonterm7, &state24}};
+std::vector<Go> go24 = {{&nonterm8, &state28}};
+std::vector<Go> go31 = {{&nonterm9, &state32}};
+std::vector<Go> go32 = {{&nonterm10, &state36}};
+std::vector<Go> go39 = {{&nonterm11, &state40}};
+std::vector<Go> go40 = {{&nonterm12, &state44}};
+std::vector<Go> go47 = {{&nonterm13, &state48}};
+std::vector<Go> go48 = {{&nonterm14, &state52}};
+std::vector<Go> go55 = {{&nonterm15, &state56}};
+std::vector<Go> go56 = {{&nonterm16, &state60}};
+std::vector<Go> go63 = {{&nonterm17, &state64}};
+std::vector<Go> go64 = {{&nonterm18, &state68}};
+std::vector<Go> go71 = {{&nonterm19, &state72}};
+std::vector<Go> go72 = {{&nonterm20, &state76}};
+std::vector<Go> go79 = {{&nonterm21, &state80}};
+std::vector<Go> go80 = {{&nonterm22, &state84}};
+std::vector<Go> go87 = {{&nonterm23, &state88}};
+std::vector<Go> go88 = {{&nonterm24, &state92}};
+std::vector<Go> go95 = {{&nonterm25, &state96}};
+std::vector<Go> go96 = {{&nonterm26, &state100}};
+std::vector<Go> go103 = {{&nonterm27, &state104}};
+std::vector<Go> go104 = {{&nonterm28, &state108}};
+std::vector<Go> go111 = {{&nonterm29, &state112}};
+std::vector<Go> go112 = {{&nonterm30, &state116}};
+std::vector<Go> go119 = {{&nonterm31, &state120}};
+std::vector<Go> go120 = {{&nonterm32, &state124}};
+std::vector<Go> go127 = {{&nonterm1, &state128}};
+std::vector<Go> go128 = {{&nonterm2, &state132}};
+std::vector<Go> go135 = {{&nonterm3, &state136}};
+std::vector<Go> go136 = {{&nonterm4, &state12}};
+std::vector<Go> go140 = {{&nonterm3, &state141}};
+std::vector<Go> go141 = {{&nonterm4, &state145}};
+std::vector<Go> go148 = {{&nonterm5, &state149}};
+std::vector<Go> go149 = {{&nonterm6, &state20}};
+std::vector<Go> go153 = {{&nonterm5, &state154}};
+std::vector<Go> go154 = {{&nonterm6, &state158}};
+std::vector<Go> go161 = {{&nonterm7, &state162}};
+std::vector<Go> go162 = {{&nonterm8, &state28}};
+std::vector<Go> go166 = {{&nonterm7, &state167}};
+std::vector<Go> go167 = {{&nonterm8, &state171}};
+std::vector<Go> go174 = {{&nonterm9, &state175}};
+std::vector<Go> go175 = {{&nonterm10, &state36}};
+std::vector<Go> go179 = {{&nonterm9, &state180}};
+std::vector<Go> go180 = {{&nonterm10, &state184}};
+std::vector<Go> go187 = {{&nonterm11, &state188}};
+std::vector<Go> go188 = {{&nonterm12, &state44}};
+std::vector<Go> go192 = {{&nonterm11, &state193}};
+std::vector<Go> go193 = {{&nonterm12, &state197}};
+std::vector<Go> go200 = {{&nonterm13, &state201}};
+std::vector<Go> go201 = {{&nonterm14, &state52}};
+std::vector<Go> go205 = {{&nonterm13, &state206}};
+std::vector<Go> go206 = {{&nonterm14, &state210}};
+std::vector<Go> go213 = {{&nonterm15, &state214}};
+std::vector<Go> go214 = {{&nonterm16, &state60}};
+std::vector<Go> go218 = {{&nonterm15, &state219}};
+std::vector<Go> go219 = {{&nonterm16, &state223}};
+std::vector<Go> go226 = {{&nonterm17, &state227}};
+std::vector<Go> go227 = {{&nonterm18, &state68}};
+std::vector<Go> go231 = {{&nonterm17, &state232}};
+std::vector<Go> go232 = {{&nonterm18, &state236}};
+std::vector<Go> go239 = {{&nonterm19, &state240}};
+std::vector<Go> go240 = {{&nonterm20, &state76}};
+std::vector<Go> go244 = {{&nonterm19, &state245}};
+std::vector<Go> go245 = {{&nonterm20, &state249}};
+std::vector<Go> go252 = {{&nonterm21, &state253}};
+std::vector<Go> go253 = {{&nonterm22, &state84}};
+std::vector<Go> go257 = {{&nonterm21, &state258}};
+std::vector<Go> go258 = {{&nonterm22, &state262}};
+std::vector<Go> go265 = {{&nonterm23, &state266}};
+std::vector<Go> go266 = {{&nonterm24, &state92}};
+std::vector<Go> go270 = {{&nonterm23, &state271}};
+std::vector<Go> go271 = {{&nonterm24, &state275}};
+std::vector<Go> go278 = {{&nonterm25, &state279}};
+std::vector<Go> go279 = {{&nonterm26, &state100}};
+std::vector<Go> go283 = {{&nonterm25, &state284}};
+std::vector<Go> go284 = {{&nonterm26, &state288}};
+std::vector<Go> go291 = {{&nonterm27, &state292}};
+std::vector<Go> go292 = {{&nonterm28, &state108}};
+std::vector<Go> go296 = {{&nonterm27, &state297}};
+std::vector<Go> go297 = {{&nonterm28, &state301}};
+std::vector<Go> go304 = {{&nonterm29, &state305}};
+std::vector<Go> go305 = {{&nonterm30, &state116}};
+std::vector<Go> go309 = {{&nonterm29, &state310}};
+std::vector<Go> go310 = {{&nonterm30, &state314}};
+std::vector<Go> go317 = {{&nonterm31, &state318}};
+std::vector<Go> go318 = {{&nonterm32, &state124}};
+std::vector<Go> go322 = {{&nonterm31, &state323}};
+std::vector<Go> go323 = {{&nonterm32, &state327}};
+std::vector<Go> go330 = {{&nonterm1, &state331}};
+std::vector<Go> go331 = {{&nonterm2, &state132}};
+std::vector<Go> go335 = {{&nonterm1, &state336}};
+std::vector<Go> go336 = {{&nonterm2, &state340}};
+std::vector<Go> go343 = {{&nonterm3, &state344}};
+std::vector<Go> go344 = {{&nonterm4, &state12}};
+std::vector<Go> go348 = {{&nonterm3, &state349}};
+std::vector<Go> go349 = {{&nonterm4, &state145}};
+std::vector<Go> go353 = {{&nonterm1, &state354}};
+std::vector<Go> go354 = {{&nonterm2, &state340}};
+std::vector<Go> go358 = {{&nonterm31, &state359}};
+std::vector<Go> go359 = {{&nonterm32, &state327}};
+std::vector<Go> go363 = {{&nonterm29, &state364}};
+std::vector<Go> go364 = {{&nonterm30, &state314}};
+std::vector<Go> go368 = {{&nonterm27, &state369}};
+std::vector<Go> go369 = {{&nonterm28, &state301}};
+std::vector<Go> go373 = {{&nonterm25, &state374}};
+std::vector<Go> go374 = {{&nonterm26, &state288}};
+std::vector<Go> go378 = {{&nonterm23, &state379}};
+std::vector<Go> go379 = {{&nonterm24, &state275}};
+std::vector<Go> go383 = {{&nonterm21, &state384}};
+std::vector<Go> go384 = {{&nonterm22, &state262}};
+std::vector<Go> go388 = {{&nonterm19, &state389}};
+std::vector<Go> go389 = {{&nonterm20, &state249}};
+std::vector<Go> go393 = {{&nonterm17, &state394}};
+std::vector<Go> go394 = {{&nonterm18, &state236}};
+std::vector<Go> go398 = {{&nonterm15, &state399}};
+std::vector<Go> go399 = {{&nonterm16, &state223}};
+std::vector<Go> go403 = {{&nonterm13, &state404}};
+std::vector<Go> go404 = {{&nonterm14, &state210}};
+std::vector<Go> go408 = {{&nonterm11, &state409}};
+std::vector<Go> go409 = {{&nonterm12, &state197}};
+std::vector<Go> go413 = {{&nonterm9, &state414}};
+std::vector<Go> go414 = {{&nonterm10, &state184}};
+std::vector<Go> go418 = {{&nonterm7, &state419}};
+std::vector<Go> go419 = {{&nonterm8, &state171}};
+std::vector<Go> go423 = {{&nonterm5, &state424}};
+std::vector<Go> go424 = {{&nonterm6, &state158}};
+std::vector<Go> go428 = {{&nonterm3, &state429}};
+std::vector<Go> go429 = {{&nonterm4, &state145}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, &go7};
+State state8 = {&shift8, &reduce8, &go8};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, &go15};
+State state16 = {&shift16, &reduce16, &go16};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, &go23};
+State state24 = {&shift24, &reduce24, &go24};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, &go31};
+State state32 = {&shift32, &reduce32, &go32};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, &go39};
+State state40 = {&shift40, &reduce40, &go40};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, &go47};
+State state48 = {&shift48, &reduce48, &go48};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, &go55};
+State state56 = {&shift56, &reduce56, &go56};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, &go63};
+State state64 = {&shift64, &reduce64, &go64};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, &go71};
+State state72 = {&shift72, &reduce72, &go72};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, &go79};
+State state80 = {&shift80, &reduce80, &go80};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, &go87};
+State state88 = {&shift88, &reduce88, &go88};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, &go95};
+State state96 = {&shift96, &reduce96, &go96};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, &go103};
+State state104 = {&shift104, &reduce104, &go104};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, &go111};
+State state112 = {&shift112, &reduce112, &go112};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, &go119};
+State state120 = {&shift120, &reduce120, &go120};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift0, &reduce0, &go127};
+State state128 = {&shift128, &reduce128, &go128};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift4, &reduce4, nullptr};
+State state133 = {&shift5, &reduce5, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift7, &reduce7, &go135};
+State state136 = {&shift136, &reduce136, &go136};
+State state137 = {&shift11, &reduce11, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift7, &reduce7, &go140};
+State state141 = {&shift141, &reduce141, &go141};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift144, &reduce144, nullptr};
+State state145 = {&shift12, &reduce12, nullptr};
+State state146 = {&shift13, &reduce13, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift15, &reduce15, &go148};
+State state149 = {&shift149, &reduce149, &go149};
+State state150 = {&shift19, &reduce19, nullptr};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift152, &reduce152, nullptr};
+State state153 = {&shift15, &reduce15, &go153};
+State state154 = {&shift154, &reduce154, &go154};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift20, &reduce20, nullptr};
+State state159 = {&shift21, &reduce21, nullptr};
+State state160 = {&shift160, &reduce160, nullptr};
+State state161 = {&shift23, &reduce23, &go161};
+State state162 = {&shift162, &reduce162, &go162};
+State state163 = {&shift27, &reduce27, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift23, &reduce23, &go166};
+State state167 = {&shift167, &reduce167, &go167};
+State state168 = {&shift168, &reduce168, nullptr};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift28, &reduce28, nullptr};
+State state172 = {&shift29, &reduce29, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift31, &reduce31, &go174};
+State state175 = {&shift175, &reduce175, &go175};
+State state176 = {&shift35, &reduce35, nullptr};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift31, &reduce31, &go179};
+State state180 = {&shift180, &reduce180, &go180};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift36, &reduce36, nullptr};
+State state185 = {&shift37, &reduce37, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift39, &reduce39, &go187};
+State state188 = {&shift188, &reduce188, &go188};
+State state189 = {&shift43, &reduce43, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift39, &reduce39, &go192};
+State state193 = {&shift193, &reduce193, &go193};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift44, &reduce44, nullptr};
+State state198 = {&shift45, &reduce45, nullptr};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift47, &reduce47, &go200};
+State state201 = {&shift201, &reduce201, &go201};
+State state202 = {&shift51, &reduce51, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift47, &reduce47, &go205};
+State state206 = {&shift206, &reduce206, &go206};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift208, &reduce208, nullptr};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift52, &reduce52, nullptr};
+State state211 = {&shift53, &reduce53, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift55, &reduce55, &go213};
+State state214 = {&shift214, &reduce214, &go214};
+State state215 = {&shift59, &reduce59, nullptr};
+State state216 = {&shift216, &reduce216, nullptr};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift55, &reduce55, &go218};
+State state219 = {&shift219, &reduce219, &go219};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift60, &reduce60, nullptr};
+State state224 = {&shift61, &reduce61, nullptr};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift63, &reduce63, &go226};
+State state227 = {&shift227, &reduce227, &go227};
+State state228 = {&shift67, &reduce67, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift63, &reduce63, &go231};
+State state232 = {&shift232, &reduce232, &go232};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift68, &reduce68, nullptr};
+State state237 = {&shift69, &reduce69, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift71, &reduce71, &go239};
+State state240 = {&shift240, &reduce240, &go240};
+State state241 = {&shift75, &reduce75, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift71, &reduce71, &go244};
+State state245 = {&shift245, &reduce245, &go245};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, nullptr};
+State state249 = {&shift76, &reduce76, nullptr};
+State state250 = {&shift77, &reduce77, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift79, &reduce79, &go252};
+State state253 = {&shift253, &reduce253, &go253};
+State state254 = {&shift83, &reduce83, nullptr};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift79, &reduce79, &go257};
+State state258 = {&shift258, &reduce258, &go258};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift84, &reduce84, nullptr};
+State state263 = {&shift85, &reduce85, nullptr};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift87, &reduce87, &go265};
+State state266 = {&shift266, &reduce266, &go266};
+State state267 = {&shift91, &reduce91, nullptr};
+State state268 = {&shift268, &reduce268, nullptr};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift87, &reduce87, &go270};
+State state271 = {&shift271, &reduce271, &go271};
+State state272 = {&shift272, &reduce272, nullptr};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift92, &reduce92, nullptr};
+State state276 = {&shift93, &reduce93, nullptr};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift95, &reduce95, &go278};
+State state279 = {&shift279, &reduce279, &go279};
+State state280 = {&shift99, &reduce99, nullptr};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift95, &reduce95, &go283};
+State state284 = {&shift284, &reduce284, &go284};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift286, &reduce286, nullptr};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift100, &reduce100, nullptr};
+State state289 = {&shift101, &reduce101, nullptr};
+State state290 = {&shift290, &reduce290, nullptr};
+State state291 = {&shift103, &reduce103, &go291};
+State state292 = {&shift292, &reduce292, &go292};
+State state293 = {&shift107, &reduce107, nullptr};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift103, &reduce103, &go296};
+State state297 = {&shift297, &reduce297, &go297};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift108, &reduce108, nullptr};
+State state302 = {&shift109, &reduce109, nullptr};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift111, &reduce111, &go304};
+State state305 = {&shift305, &reduce305, &go305};
+State state306 = {&shift115, &reduce115, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift308, &reduce308, nullptr};
+State state309 = {&shift111, &reduce111, &go309};
+State state310 = {&shift310, &reduce310, &go310};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift312, &reduce312, nullptr};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift116, &reduce116, nullptr};
+State state315 = {&shift117, &reduce117, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift119, &reduce119, &go317};
+State state318 = {&shift318, &reduce318, &go318};
+State state319 = {&shift123, &reduce123, nullptr};
+State state320 = {&shift320, &reduce320, nullptr};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift119, &reduce119, &go322};
+State state323 = {&shift323, &reduce323, &go323};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift326, &reduce326, nullptr};
+State state327 = {&shift124, &reduce124, nullptr};
+State state328 = {&shift125, &reduce125, nullptr};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift0, &reduce0, &go330};
+State state331 = {&shift331, &reduce331, &go331};
+State state332 = {&shift131, &reduce131, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift0, &reduce0, &go335};
+State state336 = {&shift336, &reduce336, &go336};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, nullptr};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift4, &reduce4, nullptr};
+State state341 = {&shift5, &reduce5, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift7, &reduce7, &go343};
+State state344 = {&shift344, &reduce344, &go344};
+State state345 = {&shift11, &reduce11, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift139, &reduce139, nullptr};
+State state348 = {&shift7, &reduce7, &go348};
+State state349 = {&shift349, &reduce349, &go349};
+State state350 = {&shift144, &reduce144, nullptr};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift334, &reduce334, nullptr};
+State state353 = {&shift0, &reduce0, &go353};
+State state354 = {&shift354, &reduce354, &go354};
+State state355 = {&shift339, &reduce339, nullptr};
+State state356 = {&shift356, &reduce356, nullptr};
+State state357 = {&shift321, &reduce321, nullptr};
+State state358 = {&shift119, &reduce119, &go358};
+State state359 = {&shift359, &reduce359, &go359};
+State state360 = {&shift326, &reduce326, nullptr};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift308, &reduce308, nullptr};
+State state363 = {&shift111, &reduce111, &go363};
+State state364 = {&shift364, &reduce364, &go364};
+State state365 = {&shift313, &reduce313, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift295, &reduce295, nullptr};
+State state368 = {&shift103, &reduce103, &go368};
+State state369 = {&shift369, &reduce369, &go369};
+State state370 = {&shift300, &reduce300, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift282, &reduce282, nullptr};
+State state373 = {&shift95, &reduce95, &go373};
+State state374 = {&shift374, &reduce374, &go374};
+State state375 = {&shift287, &reduce287, nullptr};
+State state376 = {&shift376, &reduce376, nullptr};
+State state377 = {&shift269, &reduce269, nullptr};
+State state378 = {&shift87, &reduce87, &go378};
+State state379 = {&shift379, &reduce379, &go379};
+State state380 = {&shift274, &reduce274, nullptr};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift256, &reduce256, nullptr};
+State state383 = {&shift79, &reduce79, &go383};
+State state384 = {&shift384, &reduce384, &go384};
+State state385 = {&shift261, &reduce261, nullptr};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift243, &reduce243, nullptr};
+State state388 = {&shift71, &reduce71, &go388};
+State state389 = {&shift389, &reduce389, &go389};
+State state390 = {&shift248, &reduce248, nullptr};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift230, &reduce230, nullptr};
+State state393 = {&shift63, &reduce63, &go393};
+State state394 = {&shift394, &reduce394, &go394};
+State state395 = {&shift235, &reduce235, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift217, &reduce217, nullptr};
+State state398 = {&shift55, &reduce55, &go398};
+State state399 = {&shift399, &reduce399, &go399};
+State state400 = {&shift222, &reduce222, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift204, &reduce204, nullptr};
+State state403 = {&shift47, &reduce47, &go403};
+State state404 = {&shift404, &reduce404, &go404};
+State state405 = {&shift209, &reduce209, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift191, &reduce191, nullptr};
+State state408 = {&shift39, &reduce39, &go408};
+State state409 = {&shift409, &reduce409, &go409};
+State state410 = {&shift196, &reduce196, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift178, &reduce178, nullptr};
+State state413 = {&shift31, &reduce31, &go413};
+State state414 = {&shift414, &reduce414, &go414};
+State state415 = {&shift183, &reduce183, nullptr};
+State state416 = {&shift416, &reduce416, nullptr};
+State state417 = {&shift165, &reduce165, nullptr};
+State state418 = {&shift23, &reduce23, &go418};
+State state419 = {&shift419, &reduce419, &go419};
+State state420 = {&shift170, &reduce170, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift152, &reduce152, nullptr};
+State state423 = {&shift15, &reduce15, &go423};
+State state424 = {&shift424, &reduce424, &go424};
+State state425 = {&shift157, &reduce157, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift139, &reduce139, nullptr};
+State state428 = {&shift7, &reduce7, &go428};
+State state429 = {&shift429, &reduce429, &go429};
+State state430 = {&shift144, &reduce144, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,6043 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ba", false, 0};
+Symbol term1 = {"bb", false, 1};
+Symbol term2 = {"bc", false, 2};
+Symbol term3 = {"bd", false, 3};
+Symbol term4 = {"be", false, 4};
+Symbol term5 = {"bf", false, 5};
+Symbol term6 = {"bg", false, 6};
+Symbol term7 = {"bh", false, 7};
+Symbol term8 = {"bi", false, 8};
+Symbol term9 = {"bj", false, 9};
+Symbol term10 = {"bk", false, 10};
+Symbol term11 = {"bl", false, 11};
+Symbol term12 = {"bm", false, 12};
+Symbol term13 = {"bn", false, 13};
+Symbol term14 = {"bo", false, 14};
+Symbol term15 = {"bp", false, 15};
+Symbol term16 = {"bq", false, 16};
+Symbol term17 = {"br", false, 17};
+Symbol term18 = {"bs", false, 18};
+Symbol term19 = {"bt", false, 19};
+Symbol term20 = {"bu", false, 20};
+Symbol term21 = {"bv", false, 21};
+Symbol term22 = {"bw", false, 22};
+Symbol term23 = {"bx", false, 23};
+Symbol term24 = {"by", false, 24};
+Symbol term25 = {"bz", false, 25};
+Symbol term26 = {"bab", false, 26};
+Symbol term27 = {"bbb", false, 27};
+Symbol term28 = {"bcb", false, 28};
+Symbol term29 = {"bdb", false, 29};
+Symbol term30 = {"beb", false, 30};
+Symbol term31 = {"bfb", false, 31};
+Symbol term32 = {"num", true, 32};
+Symbol term33 = {"ws", true, 33};
+Symbol term34 = {"id", false, 34};
+Symbol term35 = {";", false, 35};
+Symbol term36 = {"=", false, 36};
+Symbol term37 = {"{", false, 37};
+Symbol term38 = {"}", false, 38};
+Symbol term39 = {"(", false, 39};
+Symbol term40 = {")", false, 40};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 8, 8, 8, 8, 8,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 11, 12, 13, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 45 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node8; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    if (k == 41) { return &node9; }
+    if (k == 43) { return &node10; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 9) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    if (k == 36) { return &node32; }
+    if (k == 37) { return &node33; }
+    if (k == 38) { return &node34; }
+    if (k == 39) { return &node35; }
+    if (k == 40) { return &node36; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node42; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node41; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node40; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node39; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node38; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node37; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term33, nullptr};
+Node node2 = {nullptr, &term39, nullptr};
+Node node3 = {nullptr, &term40, nullptr};
+Node node4 = {&next4, &term32, nullptr};
+Node node5 = {nullptr, &term35, nullptr};
+Node node6 = {nullptr, &term36, nullptr};
+Node node7 = {&next7, &term34, nullptr};
+Node node8 = {&next8, &term34, nullptr};
+Node node9 = {nullptr, &term37, nullptr};
+Node node10 = {nullptr, &term38, nullptr};
+Node node11 = {&next11, &term0, nullptr};
+Node node12 = {&next12, &term1, nullptr};
+Node node13 = {&next13, &term2, nullptr};
+Node node14 = {&next14, &term3, nullptr};
+Node node15 = {&next15, &term4, nullptr};
+Node node16 = {&next16, &term5, nullptr};
+Node node17 = {&next17, &term6, nullptr};
+Node node18 = {&next18, &term7, nullptr};
+Node node19 = {&next19, &term8, nullptr};
+Node node20 = {&next20, &term9, nullptr};
+Node node21 = {&next21, &term10, nullptr};
+Node node22 = {&next22, &term11, nullptr};
+Node node23 = {&next23, &term12, nullptr};
+Node node24 = {&next24, &term13, nullptr};
+Node node25 = {&next25, &term14, nullptr};
+Node node26 = {&next26, &term15, nullptr};
+Node node27 = {&next27, &term16, nullptr};
+Node node28 = {&next28, &term17, nullptr};
+Node node29 = {&next29, &term18, nullptr};
+Node node30 = {&next30, &term19, nullptr};
+Node node31 = {&next31, &term20, nullptr};
+Node node32 = {&next32, &term21, nullptr};
+Node node33 = {&next33, &term22, nullptr};
+Node node34 = {&next34, &term23, nullptr};
+Node node35 = {&next35, &term24, nullptr};
+Node node36 = {&next36, &term25, nullptr};
+Node node37 = {&next37, &term31, nullptr};
+Node node38 = {&next38, &term30, nullptr};
+Node node39 = {&next39, &term29, nullptr};
+Node node40 = {&next40, &term28, nullptr};
+Node node41 = {&next41, &term27, nullptr};
+Node node42 = {&next42, &term26, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 41};
+Symbol nonterm0 = {"program", false, 0};
+Symbol nonterm1 = {"items0", false, 1};
+Symbol nonterm2 = {"item0", false, 2};
+Symbol nonterm3 = {"items1", false, 3};
+Symbol nonterm4 = {"item1", false, 4};
+Symbol nonterm5 = {"items2", false, 5};
+Symbol nonterm6 = {"item2", false, 6};
+Symbol nonterm7 = {"items3", false, 7};
+Symbol nonterm8 = {"item3", false, 8};
+Symbol nonterm9 = {"items4", false, 9};
+Symbol nonterm10 = {"item4", false, 10};
+Symbol nonterm11 = {"items5", false, 11};
+Symbol nonterm12 = {"item5", false, 12};
+Symbol nonterm13 = {"items6", false, 13};
+Symbol nonterm14 = {"item6", false, 14};
+Symbol nonterm15 = {"items7", false, 15};
+Symbol nonterm16 = {"item7", false, 16};
+Symbol nonterm17 = {"items8", false, 17};
+Symbol nonterm18 = {"item8", false, 18};
+Symbol nonterm19 = {"items9", false, 19};
+Symbol nonterm20 = {"item9", false, 20};
+Symbol nonterm21 = {"items10", false, 21};
+Symbol nonterm22 = {"item10", false, 22};
+Symbol nonterm23 = {"items11", false, 23};
+Symbol nonterm24 = {"item11", false, 24};
+Symbol nonterm25 = {"items12", false, 25};
+Symbol nonterm26 = {"item12", false, 26};
+Symbol nonterm27 = {"items13", false, 27};
+Symbol nonterm28 = {"item13", false, 28};
+Symbol nonterm29 = {"items14", false, 29};
+Symbol nonterm30 = {"item14", false, 30};
+Symbol nonterm31 = {"items15", false, 31};
+Symbol nonterm32 = {"item15", false, 32};
+Symbol nonterm33 = {"items16", false, 33};
+Symbol nonterm34 = {"item16", false, 34};
+Symbol nonterm35 = {"items17", false, 35};
+Symbol nonterm36 = {"item17", false, 36};
+Symbol nonterm37 = {"items18", false, 37};
+Symbol nonterm38 = {"item18", false, 38};
+Symbol nonterm39 = {"items19", false, 39};
+Symbol nonterm40 = {"item19", false, 40};
+Symbol nonterm41 = {"items20", false, 41};
+Symbol nonterm42 = {"item20", false, 42};
+Symbol nonterm43 = {"items21", false, 43};
+Symbol nonterm44 = {"item21", false, 44};
+Symbol nonterm45 = {"items22", false, 45};
+Symbol nonterm46 = {"item22", false, 46};
+Symbol nonterm47 = {"items23", false, 47};
+Symbol nonterm48 = {"item23", false, 48};
+Symbol nonterm49 = {"items24", false, 49};
+Symbol nonterm50 = {"item24", false, 50};
+Symbol nonterm51 = {"items25", false, 51};
+Symbol nonterm52 = {"item25", false, 52};
+Symbol nonterm53 = {"items26", false, 53};
+Symbol nonterm54 = {"item26", false, 54};
+Symbol nonterm55 = {"items27", false, 55};
+Symbol nonterm56 = {"item27", false, 56};
+Symbol nonterm57 = {"items28", false, 57};
+Symbol nonterm58 = {"item28", false, 58};
+Symbol nonterm59 = {"items29", false, 59};
+Symbol nonterm60 = {"item29", false, 60};
+Symbol nonterm61 = {"items30", false, 61};
+Symbol nonterm62 = {"item30", false, 62};
+Symbol nonterm63 = {"items31", false, 63};
+Symbol nonterm64 = {"item31", false, 64};
+
+unique_ptr<Tree>
+reduce_program_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_0(Table*);
+
+Value*
+reduce_items0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items0_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_0(Table*);
+
+Value*
+reduce_item0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_1(Table*);
+
+Value*
+reduce_item0_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_0(Table*);
+
+Value*
+reduce_items1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items1_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_0(Table*);
+
+Value*
+reduce_item1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_1(Table*);
+
+Value*
+reduce_item1_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_0(Table*);
+
+Value*
+reduce_items2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items2_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_0(Table*);
+
+Value*
+reduce_item2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_1(Table*);
+
+Value*
+reduce_item2_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_0(Table*);
+
+Value*
+reduce_items3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items3_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_0(Table*);
+
+Value*
+reduce_item3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_1(Table*);
+
+Value*
+reduce_item3_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_0(Table*);
+
+Value*
+reduce_items4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items4_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_0(Table*);
+
+Value*
+reduce_item4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_1(Table*);
+
+Value*
+reduce_item4_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_0(Table*);
+
+Value*
+reduce_items5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items5_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_0(Table*);
+
+Value*
+reduce_item5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_1(Table*);
+
+Value*
+reduce_item5_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_0(Table*);
+
+Value*
+reduce_items6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items6_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_0(Table*);
+
+Value*
+reduce_item6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_1(Table*);
+
+Value*
+reduce_item6_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_0(Table*);
+
+Value*
+reduce_items7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items7_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_0(Table*);
+
+Value*
+reduce_item7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_1(Table*);
+
+Value*
+reduce_item7_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_0(Table*);
+
+Value*
+reduce_items8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items8_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_0(Table*);
+
+Value*
+reduce_item8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_1(Table*);
+
+Value*
+reduce_item8_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_0(Table*);
+
+Value*
+reduce_items9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items9_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_0(Table*);
+
+Value*
+reduce_item9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_1(Table*);
+
+Value*
+reduce_item9_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_0(Table*);
+
+Value*
+reduce_items10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items10_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_0(Table*);
+
+Value*
+reduce_item10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_1(Table*);
+
+Value*
+reduce_item10_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_0(Table*);
+
+Value*
+reduce_items11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items11_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_0(Table*);
+
+Value*
+reduce_item11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_1(Table*);
+
+Value*
+reduce_item11_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_0(Table*);
+
+Value*
+reduce_items12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items12_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_0(Table*);
+
+Value*
+reduce_item12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_1(Table*);
+
+Value*
+reduce_item12_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_0(Table*);
+
+Value*
+reduce_items13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items13_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_0(Table*);
+
+Value*
+reduce_item13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_1(Table*);
+
+Value*
+reduce_item13_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_0(Table*);
+
+Value*
+reduce_items14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items14_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_0(Table*);
+
+Value*
+reduce_item14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_1(Table*);
+
+Value*
+reduce_item14_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_0(Table*);
+
+Value*
+reduce_items15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items15_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_0(Table*);
+
+Value*
+reduce_item15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_1(Table*);
+
+Value*
+reduce_item15_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items16_0(Table*);
+
+Value*
+reduce_items16_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items16_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items16_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items16_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_0(Table*);
+
+Value*
+reduce_item16_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item16_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_1(Table*);
+
+Value*
+reduce_item16_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item16_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item16_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item16_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item16_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item16_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items17_0(Table*);
+
+Value*
+reduce_items17_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items17_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items17_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items17_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_0(Table*);
+
+Value*
+reduce_item17_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item17_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_1(Table*);
+
+Value*
+reduce_item17_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item17_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item17_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item17_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item17_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item17_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items18_0(Table*);
+
+Value*
+reduce_items18_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items18_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items18_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items18_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_0(Table*);
+
+Value*
+reduce_item18_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item18_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_1(Table*);
+
+Value*
+reduce_item18_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item18_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item18_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item18_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item18_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item18_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items19_0(Table*);
+
+Value*
+reduce_items19_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items19_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items19_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items19_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_0(Table*);
+
+Value*
+reduce_item19_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item19_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_1(Table*);
+
+Value*
+reduce_item19_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item19_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item19_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item19_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item19_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item19_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items20_0(Table*);
+
+Value*
+reduce_items20_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items20_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items20_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items20_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_0(Table*);
+
+Value*
+reduce_item20_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item20_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_1(Table*);
+
+Value*
+reduce_item20_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item20_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item20_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item20_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item20_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item20_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items21_0(Table*);
+
+Value*
+reduce_items21_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items21_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items21_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items21_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_0(Table*);
+
+Value*
+reduce_item21_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item21_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_1(Table*);
+
+Value*
+reduce_item21_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item21_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item21_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item21_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item21_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item21_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items22_0(Table*);
+
+Value*
+reduce_items22_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items22_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items22_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items22_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_0(Table*);
+
+Value*
+reduce_item22_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item22_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_1(Table*);
+
+Value*
+reduce_item22_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item22_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item22_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item22_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item22_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item22_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items23_0(Table*);
+
+Value*
+reduce_items23_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items23_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items23_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items23_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_0(Table*);
+
+Value*
+reduce_item23_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item23_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_1(Table*);
+
+Value*
+reduce_item23_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item23_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item23_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item23_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item23_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item23_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items24_0(Table*);
+
+Value*
+reduce_items24_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items24_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items24_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items24_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_0(Table*);
+
+Value*
+reduce_item24_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item24_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_1(Table*);
+
+Value*
+reduce_item24_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item24_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item24_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item24_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item24_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item24_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items25_0(Table*);
+
+Value*
+reduce_items25_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items25_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items25_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items25_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_0(Table*);
+
+Value*
+reduce_item25_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item25_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_1(Table*);
+
+Value*
+reduce_item25_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item25_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item25_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item25_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item25_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item25_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items26_0(Table*);
+
+Value*
+reduce_items26_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items26_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items26_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items26_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_0(Table*);
+
+Value*
+reduce_item26_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item26_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_1(Table*);
+
+Value*
+reduce_item26_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item26_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item26_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item26_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item26_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item26_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items27_0(Table*);
+
+Value*
+reduce_items27_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items27_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items27_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items27_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_0(Table*);
+
+Value*
+reduce_item27_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item27_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_1(Table*);
+
+Value*
+reduce_item27_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item27_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item27_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item27_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item27_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item27_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items28_0(Table*);
+
+Value*
+reduce_items28_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items28_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items28_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items28_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_0(Table*);
+
+Value*
+reduce_item28_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item28_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_1(Table*);
+
+Value*
+reduce_item28_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item28_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item28_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item28_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item28_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item28_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items29_0(Table*);
+
+Value*
+reduce_items29_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items29_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items29_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items29_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_0(Table*);
+
+Value*
+reduce_item29_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item29_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_1(Table*);
+
+Value*
+reduce_item29_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item29_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item29_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item29_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item29_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item29_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items30_0(Table*);
+
+Value*
+reduce_items30_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items30_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items30_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items30_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_0(Table*);
+
+Value*
+reduce_item30_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item30_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_1(Table*);
+
+Value*
+reduce_item30_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item30_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item30_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item30_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item30_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item30_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items31_0(Table*);
+
+Value*
+reduce_items31_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items31_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items31_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items31_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_0(Table*);
+
+Value*
+reduce_item31_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item31_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_1(Table*);
+
+Value*
+reduce_item31_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item31_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item31_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item31_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item31_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item31_3(table, E2);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_program_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_items0_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_items0_1, -1};
+Rule rule3 = {&nonterm2, 2, &reduce_item0_0, -1};
+Rule rule4 = {&nonterm2, 4, &reduce_item0_1, -1};
+Rule rule5 = {&nonterm2, 4, &reduce_item0_2, -1};
+Rule rule6 = {&nonterm2, 4, &reduce_item0_3, -1};
+Rule rule7 = {&nonterm3, 0, &reduce_items1_0, -1};
+Rule rule8 = {&nonterm3, 2, &reduce_items1_1, -1};
+Rule rule9 = {&nonterm4, 2, &reduce_item1_0, -1};
+Rule rule10 = {&nonterm4, 4, &reduce_item1_1, -1};
+Rule rule11 = {&nonterm4, 4, &reduce_item1_2, -1};
+Rule rule12 = {&nonterm4, 4, &reduce_item1_3, -1};
+Rule rule13 = {&nonterm5, 0, &reduce_items2_0, -1};
+Rule rule14 = {&nonterm5, 2, &reduce_items2_1, -1};
+Rule rule15 = {&nonterm6, 2, &reduce_item2_0, -1};
+Rule rule16 = {&nonterm6, 4, &reduce_item2_1, -1};
+Rule rule17 = {&nonterm6, 4, &reduce_item2_2, -1};
+Rule rule18 = {&nonterm6, 4, &reduce_item2_3, -1};
+Rule rule19 = {&nonterm7, 0, &reduce_items3_0, -1};
+Rule rule20 = {&nonterm7, 2, &reduce_items3_1, -1};
+Rule rule21 = {&nonterm8, 2, &reduce_item3_0, -1};
+Rule rule22 = {&nonterm8, 4, &reduce_item3_1, -1};
+Rule rule23 = {&nonterm8, 4, &reduce_item3_2, -1};
+Rule rule24 = {&nonterm8, 4, &reduce_item3_3, -1};
+Rule rule25 = {&nonterm9, 0, &reduce_items4_0, -1};
+Rule rule26 = {&nonterm9, 2, &reduce_items4_1, -1};
+Rule rule27 = {&nonterm10, 2, &reduce_item4_0, -1};
+Rule rule28 = {&nonterm10, 4, &reduce_item4_1, -1};
+Rule rule29 = {&nonterm10, 4, &reduce_item4_2, -1};
+Rule rule30 = {&nonterm10, 4, &reduce_item4_3, -1};
+Rule rule31 = {&nonterm11, 0, &reduce_items5_0, -1};
+Rule rule32 = {&nonterm11, 2, &reduce_items5_1, -1};
+Rule rule33 = {&nonterm12, 2, &reduce_item5_0, -1};
+Rule rule34 = {&nonterm12, 4, &reduce_item5_1, -1};
+Rule rule35 = {&nonterm12, 4, &reduce_item5_2, -1};
+Rule rule36 = {&nonterm12, 4, &reduce_item5_3, -1};
+Rule rule37 = {&nonterm13, 0, &reduce_items6_0, -1};
+Rule rule38 = {&nonterm13, 2, &reduce_items6_1, -1};
+Rule rule39 = {&nonterm14, 2, &reduce_item6_0, -1};
+Rule rule40 = {&nonterm14, 4, &reduce_item6_1, -1};
+Rule rule41 = {&nonterm14, 4, &reduce_item6_2, -1};
+Rule rule42 = {&nonterm14, 4, &reduce_item6_3, -1};
+Rule rule43 = {&nonterm15, 0, &reduce_items7_0, -1};
+Rule rule44 = {&nonterm15, 2, &reduce_items7_1, -1};
+Rule rule45 = {&nonterm16, 2, &reduce_item7_0, -1};
+Rule rule46 = {&nonterm16, 4, &reduce_item7_1, -1};
+Rule rule47 = {&nonterm16, 4, &reduce_item7_2, -1};
+Rule rule48 = {&nonterm16, 4, &reduce_item7_3, -1};
+Rule rule49 = {&nonterm17, 0, &reduce_items8_0, -1};
+Rule rule50 = {&nonterm17, 2, &reduce_items8_1, -1};
+Rule rule51 = {&nonterm18, 2, &reduce_item8_0, -1};
+Rule rule52 = {&nonterm18, 4, &reduce_item8_1, -1};
+Rule rule53 = {&nonterm18, 4, &reduce_item8_2, -1};
+Rule rule54 = {&nonterm18, 4, &reduce_item8_3, -1};
+Rule rule55 = {&nonterm19, 0, &reduce_items9_0, -1};
+Rule rule56 = {&nonterm19, 2, &reduce_items9_1, -1};
+Rule rule57 = {&nonterm20, 2, &reduce_item9_0, -1};
+Rule rule58 = {&nonterm20, 4, &reduce_item9_1, -1};
+Rule rule59 = {&nonterm20, 4, &reduce_item9_2, -1};
+Rule rule60 = {&nonterm20, 4, &reduce_item9_3, -1};
+Rule rule61 = {&nonterm21, 0, &reduce_items10_0, -1};
+Rule rule62 = {&nonterm21, 2, &reduce_items10_1, -1};
+Rule rule63 = {&nonterm22, 2, &reduce_item10_0, -1};
+Rule rule64 = {&nonterm22, 4, &reduce_item10_1, -1};
+Rule rule65 = {&nonterm22, 4, &reduce_item10_2, -1};
+Rule rule66 = {&nonterm22, 4, &reduce_item10_3, -1};
+Rule rule67 = {&nonterm23, 0, &reduce_items11_0, -1};
+Rule rule68 = {&nonterm23, 2, &reduce_items11_1, -1};
+Rule rule69 = {&nonterm24, 2, &reduce_item11_0, -1};
+Rule rule70 = {&nonterm24, 4, &reduce_item11_1, -1};
+Rule rule71 = {&nonterm24, 4, &reduce_item11_2, -1};
+Rule rule72 = {&nonterm24, 4, &reduce_item11_3, -1};
+Rule rule73 = {&nonterm25, 0, &reduce_items12_0, -1};
+Rule rule74 = {&nonterm25, 2, &reduce_items12_1, -1};
+Rule rule75 = {&nonterm26, 2, &reduce_item12_0, -1};
+Rule rule76 = {&nonterm26, 4, &reduce_item12_1, -1};
+Rule rule77 = {&nonterm26, 4, &reduce_item12_2, -1};
+Rule rule78 = {&nonterm26, 4, &reduce_item12_3, -1};
+Rule rule79 = {&nonterm27, 0, &reduce_items13_0, -1};
+Rule rule80 = {&nonterm27, 2, &reduce_items13_1, -1};
+Rule rule81 = {&nonterm28, 2, &reduce_item13_0, -1};
+Rule rule82 = {&nonterm28, 4, &reduce_item13_1, -1};
+Rule rule83 = {&nonterm28, 4, &reduce_item13_2, -1};
+Rule rule84 = {&nonterm28, 4, &reduce_item13_3, -1};
+Rule rule85 = {&nonterm29, 0, &reduce_items14_0, -1};
+Rule rule86 = {&nonterm29, 2, &reduce_items14_1, -1};
+Rule rule87 = {&nonterm30, 2, &reduce_item14_0, -1};
+Rule rule88 = {&nonterm30, 4, &reduce_item14_1, -1};
+Rule rule89 = {&nonterm30, 4, &reduce_item14_2, -1};
+Rule rule90 = {&nonterm30, 4, &reduce_item14_3, -1};
+Rule rule91 = {&nonterm31, 0, &reduce_items15_0, -1};
+Rule rule92 = {&nonterm31, 2, &reduce_items15_1, -1};
+Rule rule93 = {&nonterm32, 2, &reduce_item15_0, -1};
+Rule rule94 = {&nonterm32, 4, &reduce_item15_1, -1};
+Rule rule95 = {&nonterm32, 4, &reduce_item15_2, -1};
+Rule rule96 = {&nonterm32, 4, &reduce_item15_3, -1};
+Rule rule97 = {&nonterm33, 0, &reduce_items16_0, -1};
+Rule rule98 = {&nonterm33, 2, &reduce_items16_1, -1};
+Rule rule99 = {&nonterm34, 2, &reduce_item16_0, -1};
+Rule rule100 = {&nonterm34, 4, &reduce_item16_1, -1};
+Rule rule101 = {&nonterm34, 4, &reduce_item16_2, -1};
+Rule rule102 = {&nonterm34, 4, &reduce_item16_3, -1};
+Rule rule103 = {&nonterm35, 0, &reduce_items17_0, -1};
+Rule rule104 = {&nonterm35, 2, &reduce_items17_1, -1};
+Rule rule105 = {&nonterm36, 2, &reduce_item17_0, -1};
+Rule rule106 = {&nonterm36, 4, &reduce_item17_1, -1};
+Rule rule107 = {&nonterm36, 4, &reduce_item17_2, -1};
+Rule rule108 = {&nonterm36, 4, &reduce_item17_3, -1};
+Rule rule109 = {&nonterm37, 0, &reduce_items18_0, -1};
+Rule rule110 = {&nonterm37, 2, &reduce_items18_1, -1};
+Rule rule111 = {&nonterm38, 2, &reduce_item18_0, -1};
+Rule rule112 = {&nonterm38, 4, &reduce_item18_1, -1};
+Rule rule113 = {&nonterm38, 4, &reduce_item18_2, -1};
+Rule rule114 = {&nonterm38, 4, &reduce_item18_3, -1};
+Rule rule115 = {&nonterm39, 0, &reduce_items19_0, -1};
+Rule rule116 = {&nonterm39, 2, &reduce_items19_1, -1};
+Rule rule117 = {&nonterm40, 2, &reduce_item19_0, -1};
+Rule rule118 = {&nonterm40, 4, &reduce_item19_1, -1};
+Rule rule119 = {&nonterm40, 4, &reduce_item19_2, -1};
+Rule rule120 = {&nonterm40, 4, &reduce_item19_3, -1};
+Rule rule121 = {&nonterm41, 0, &reduce_items20_0, -1};
+Rule rule122 = {&nonterm41, 2, &reduce_items20_1, -1};
+Rule rule123 = {&nonterm42, 2, &reduce_item20_0, -1};
+Rule rule124 = {&nonterm42, 4, &reduce_item20_1, -1};
+Rule rule125 = {&nonterm42, 4, &reduce_item20_2, -1};
+Rule rule126 = {&nonterm42, 4, &reduce_item20_3, -1};
+Rule rule127 = {&nonterm43, 0, &reduce_items21_0, -1};
+Rule rule128 = {&nonterm43, 2, &reduce_items21_1, -1};
+Rule rule129 = {&nonterm44, 2, &reduce_item21_0, -1};
+Rule rule130 = {&nonterm44, 4, &reduce_item21_1, -1};
+Rule rule131 = {&nonterm44, 4, &reduce_item21_2, -1};
+Rule rule132 = {&nonterm44, 4, &reduce_item21_3, -1};
+Rule rule133 = {&nonterm45, 0, &reduce_items22_0, -1};
+Rule rule134 = {&nonterm45, 2, &reduce_items22_1, -1};
+Rule rule135 = {&nonterm46, 2, &reduce_item22_0, -1};
+Rule rule136 = {&nonterm46, 4, &reduce_item22_1, -1};
+Rule rule137 = {&nonterm46, 4, &reduce_item22_2, -1};
+Rule rule138 = {&nonterm46, 4, &reduce_item22_3, -1};
+Rule rule139 = {&nonterm47, 0, &reduce_items23_0, -1};
+Rule rule140 = {&nonterm47, 2, &reduce_items23_1, -1};
+Rule rule141 = {&nonterm48, 2, &reduce_item23_0, -1};
+Rule rule142 = {&nonterm48, 4, &reduce_item23_1, -1};
+Rule rule143 = {&nonterm48, 4, &reduce_item23_2, -1};
+Rule rule144 = {&nonterm48, 4, &reduce_item23_3, -1};
+Rule rule145 = {&nonterm49, 0, &reduce_items24_0, -1};
+Rule rule146 = {&nonterm49, 2, &reduce_items24_1, -1};
+Rule rule147 = {&nonterm50, 2, &reduce_item24_0, -1};
+Rule rule148 = {&nonterm50, 4, &reduce_item24_1, -1};
+Rule rule149 = {&nonterm50, 4, &reduce_item24_2, -1};
+Rule rule150 = {&nonterm50, 4, &reduce_item24_3, -1};
+Rule rule151 = {&nonterm51, 0, &reduce_items25_0, -1};
+Rule rule152 = {&nonterm51, 2, &reduce_items25_1, -1};
+Rule rule153 = {&nonterm52, 2, &reduce_item25_0, -1};
+Rule rule154 = {&nonterm52, 4, &reduce_item25_1, -1};
+Rule rule155 = {&nonterm52, 4, &reduce_item25_2, -1};
+Rule rule156 = {&nonterm52, 4, &reduce_item25_3, -1};
+Rule rule157 = {&nonterm53, 0, &reduce_items26_0, -1};
+Rule rule158 = {&nonterm53, 2, &reduce_items26_1, -1};
+Rule rule159 = {&nonterm54, 2, &reduce_item26_0, -1};
+Rule rule160 = {&nonterm54, 4, &reduce_item26_1, -1};
+Rule rule161 = {&nonterm54, 4, &reduce_item26_2, -1};
+Rule rule162 = {&nonterm54, 4, &reduce_item26_3, -1};
+Rule rule163 = {&nonterm55, 0, &reduce_items27_0, -1};
+Rule rule164 = {&nonterm55, 2, &reduce_items27_1, -1};
+Rule rule165 = {&nonterm56, 2, &reduce_item27_0, -1};
+Rule rule166 = {&nonterm56, 4, &reduce_item27_1, -1};
+Rule rule167 = {&nonterm56, 4, &reduce_item27_2, -1};
+Rule rule168 = {&nonterm56, 4, &reduce_item27_3, -1};
+Rule rule169 = {&nonterm57, 0, &reduce_items28_0, -1};
+Rule rule170 = {&nonterm57, 2, &reduce_items28_1, -1};
+Rule rule171 = {&nonterm58, 2, &reduce_item28_0, -1};
+Rule rule172 = {&nonterm58, 4, &reduce_item28_1, -1};
+Rule rule173 = {&nonterm58, 4, &reduce_item28_2, -1};
+Rule rule174 = {&nonterm58, 4, &reduce_item28_3, -1};
+Rule rule175 = {&nonterm59, 0, &reduce_items29_0, -1};
+Rule rule176 = {&nonterm59, 2, &reduce_items29_1, -1};
+Rule rule177 = {&nonterm60, 2, &reduce_item29_0, -1};
+Rule rule178 = {&nonterm60, 4, &reduce_item29_1, -1};
+Rule rule179 = {&nonterm60, 4, &reduce_item29_2, -1};
+Rule rule180 = {&nonterm60, 4, &reduce_item29_3, -1};
+Rule rule181 = {&nonterm61, 0, &reduce_items30_0, -1};
+Rule rule182 = {&nonterm61, 2, &reduce_items30_1, -1};
+Rule rule183 = {&nonterm62, 2, &reduce_item30_0, -1};
+Rule rule184 = {&nonterm62, 4, &reduce_item30_1, -1};
+Rule rule185 = {&nonterm62, 4, &reduce_item30_2, -1};
+Rule rule186 = {&nonterm62, 4, &reduce_item30_3, -1};
+Rule rule187 = {&nonterm63, 0, &reduce_items31_0, -1};
+Rule rule188 = {&nonterm63, 2, &reduce_items31_1, -1};
+Rule rule189 = {&nonterm64, 2, &reduce_item31_0, -1};
+Rule rule190 = {&nonterm64, 4, &reduce_item31_1, -1};
+Rule rule191 = {&nonterm64, 4, &reduce_item31_2, -1};
+Rule rule192 = {&nonterm64, 4, &reduce_item31_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+extern State state784;
+extern State state785;
+extern State state786;
+extern State state787;
+extern State state788;
+extern State state789;
+extern State state790;
+extern State state791;
+extern State state792;
+extern State state793;
+extern State state794;
+extern State state795;
+extern State state796;
+extern State state797;
+extern State state798;
+extern State state799;
+extern State state800;
+extern State state801;
+extern State state802;
+extern State state803;
+extern State state804;
+extern State state805;
+extern State state806;
+extern State state807;
+extern State state808;
+extern State state809;
+extern State state810;
+extern State state811;
+extern State state812;
+extern State state813;
+extern State state814;
+extern State state815;
+extern State state816;
+extern State state817;
+extern State state818;
+extern State state819;
+extern State state820;
+extern State state821;
+extern State state822;
+extern State state823;
+extern State state824;
+extern State state825;
+extern State state826;
+extern State state827;
+extern State state828;
+extern State state829;
+extern State state830;
+extern State state831;
+extern State state832;
+extern State state833;
+extern State state834;
+extern State state835;
+extern State state836;
+extern State state837;
+extern State state838;
+extern State state839;
+extern State state840;
+extern State state841;
+extern State state842;
+extern State state843;
+extern State state844;
+extern State state845;
+extern State state846;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term34, &state3}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term37, &state844}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term35, &state5}, {&term36, &state6}, {&term39, &state7}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {};
+std::vector<Reduce> reduce4 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift5 = {};
+std::vector<Reduce> reduce5 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift6 = {{&term34, &state842}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {};
+std::vector<Reduce> reduce7 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift8 = {{&term1, &state9}, {&term34, &state10}, {&term40, &state11}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term37, &state839}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term35, &state13}, {&term36, &state14}, {&term39, &state15}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {};
+std::vector<Reduce> reduce11 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift12 = {};
+std::vector<Reduce> reduce12 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift13 = {};
+std::vector<Reduce> reduce13 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift14 = {{&term34, &state837}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {};
+std::vector<Reduce> reduce15 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift16 = {{&term2, &state17}, {&term34, &state18}, {&term40, &state19}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term37, &state834}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term35, &state21}, {&term36, &state22}, {&term39, &state23}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {};
+std::vector<Reduce> reduce19 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift20 = {};
+std::vector<Reduce> reduce20 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift21 = {};
+std::vector<Reduce> reduce21 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift22 = {{&term34, &state832}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {};
+std::vector<Reduce> reduce23 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift24 = {{&term3, &state25}, {&term34, &state26}, {&term40, &state27}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term37, &state829}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term35, &state29}, {&term36, &state30}, {&term39, &state31}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {};
+std::vector<Reduce> reduce27 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift28 = {};
+std::vector<Reduce> reduce28 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift29 = {};
+std::vector<Reduce> reduce29 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift30 = {{&term34, &state827}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {};
+std::vector<Reduce> reduce31 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift32 = {{&term4, &state33}, {&term34, &state34}, {&term40, &state35}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term37, &state824}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term35, &state37}, {&term36, &state38}, {&term39, &state39}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {};
+std::vector<Reduce> reduce35 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift36 = {};
+std::vector<Reduce> reduce36 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift37 = {};
+std::vector<Reduce> reduce37 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift38 = {{&term34, &state822}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {};
+std::vector<Reduce> reduce39 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift40 = {{&term5, &state41}, {&term34, &state42}, {&term40, &state43}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term37, &state819}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term35, &state45}, {&term36, &state46}, {&term39, &state47}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {};
+std::vector<Reduce> reduce43 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift44 = {};
+std::vector<Reduce> reduce44 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift45 = {};
+std::vector<Reduce> reduce45 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift46 = {{&term34, &state817}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {};
+std::vector<Reduce> reduce47 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift48 = {{&term6, &state49}, {&term34, &state50}, {&term40, &state51}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term37, &state814}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term35, &state53}, {&term36, &state54}, {&term39, &state55}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {};
+std::vector<Reduce> reduce51 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift52 = {};
+std::vector<Reduce> reduce52 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift53 = {};
+std::vector<Reduce> reduce53 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift54 = {{&term34, &state812}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {};
+std::vector<Reduce> reduce55 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift56 = {{&term7, &state57}, {&term34, &state58}, {&term40, &state59}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term37, &state809}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term35, &state61}, {&term36, &state62}, {&term39, &state63}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {};
+std::vector<Reduce> reduce59 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift60 = {};
+std::vector<Reduce> reduce60 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift61 = {};
+std::vector<Reduce> reduce61 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift62 = {{&term34, &state807}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {};
+std::vector<Reduce> reduce63 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift64 = {{&term8, &state65}, {&term34, &state66}, {&term40, &state67}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term37, &state804}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term35, &state69}, {&term36, &state70}, {&term39, &state71}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {};
+std::vector<Reduce> reduce67 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift68 = {};
+std::vector<Reduce> reduce68 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift69 = {};
+std::vector<Reduce> reduce69 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift70 = {{&term34, &state802}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {};
+std::vector<Reduce> reduce71 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift72 = {{&term9, &state73}, {&term34, &state74}, {&term40, &state75}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term37, &state799}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term35, &state77}, {&term36, &state78}, {&term39, &state79}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {};
+std::vector<Reduce> reduce75 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift76 = {};
+std::vector<Reduce> reduce76 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift77 = {};
+std::vector<Reduce> reduce77 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift78 = {{&term34, &state797}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {};
+std::vector<Reduce> reduce79 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift80 = {{&term10, &state81}, {&term34, &state82}, {&term40, &state83}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term37, &state794}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term35, &state85}, {&term36, &state86}, {&term39, &state87}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {};
+std::vector<Reduce> reduce83 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift84 = {};
+std::vector<Reduce> reduce84 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift85 = {};
+std::vector<Reduce> reduce85 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift86 = {{&term34, &state792}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {};
+std::vector<Reduce> reduce87 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift88 = {{&term11, &state89}, {&term34, &state90}, {&term40, &state91}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term37, &state789}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term35, &state93}, {&term36, &state94}, {&term39, &state95}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {};
+std::vector<Reduce> reduce91 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift92 = {};
+std::vector<Reduce> reduce92 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift93 = {};
+std::vector<Reduce> reduce93 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift94 = {{&term34, &state787}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {};
+std::vector<Reduce> reduce95 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift96 = {{&term12, &state97}, {&term34, &state98}, {&term40, &state99}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term37, &state784}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term35, &state101}, {&term36, &state102}, {&term39, &state103}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {};
+std::vector<Reduce> reduce99 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift100 = {};
+std::vector<Reduce> reduce100 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift101 = {};
+std::vector<Reduce> reduce101 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift102 = {{&term34, &state782}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {};
+std::vector<Reduce> reduce103 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift104 = {{&term13, &state105}, {&term34, &state106}, {&term40, &state107}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term37, &state779}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term35, &state109}, {&term36, &state110}, {&term39, &state111}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {};
+std::vector<Reduce> reduce107 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift108 = {};
+std::vector<Reduce> reduce108 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift109 = {};
+std::vector<Reduce> reduce109 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift110 = {{&term34, &state777}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {};
+std::vector<Reduce> reduce111 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift112 = {{&term14, &state113}, {&term34, &state114}, {&term40, &state115}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term37, &state774}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term35, &state117}, {&term36, &state118}, {&term39, &state119}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {};
+std::vector<Reduce> reduce115 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift116 = {};
+std::vector<Reduce> reduce116 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift117 = {};
+std::vector<Reduce> reduce117 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift118 = {{&term34, &state772}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {};
+std::vector<Reduce> reduce119 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift120 = {{&term15, &state121}, {&term34, &state122}, {&term40, &state123}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term37, &state769}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term35, &state125}, {&term36, &state126}, {&term39, &state127}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {};
+std::vector<Reduce> reduce123 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift124 = {};
+std::vector<Reduce> reduce124 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift125 = {};
+std::vector<Reduce> reduce125 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift126 = {{&term34, &state767}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {};
+std::vector<Reduce> reduce127 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift128 = {{&term16, &state129}, {&term34, &state130}, {&term40, &state131}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term37, &state764}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term35, &state133}, {&term36, &state134}, {&term39, &state135}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {};
+std::vector<Reduce> reduce131 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift132 = {};
+std::vector<Reduce> reduce132 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift133 = {};
+std::vector<Reduce> reduce133 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift134 = {{&term34, &state762}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {};
+std::vector<Reduce> reduce135 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift136 = {{&term17, &state137}, {&term34, &state138}, {&term40, &state139}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term37, &state759}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term35, &state141}, {&term36, &state142}, {&term39, &state143}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {};
+std::vector<Reduce> reduce139 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift140 = {};
+std::vector<Reduce> reduce140 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift141 = {};
+std::vector<Reduce> reduce141 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift142 = {{&term34, &state757}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {};
+std::vector<Reduce> reduce143 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift144 = {{&term18, &state145}, {&term34, &state146}, {&term40, &state147}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term37, &state754}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term35, &state149}, {&term36, &state150}, {&term39, &state151}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {};
+std::vector<Reduce> reduce147 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift148 = {};
+std::vector<Reduce> reduce148 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift149 = {};
+std::vector<Reduce> reduce149 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift150 = {{&term34, &state752}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {};
+std::vector<Reduce> reduce151 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift152 = {{&term19, &state153}, {&term34, &state154}, {&term40, &state155}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term37, &state749}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term35, &state157}, {&term36, &state158}, {&term39, &state159}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {};
+std::vector<Reduce> reduce155 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift156 = {};
+std::vector<Reduce> reduce156 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift157 = {};
+std::vector<Reduce> reduce157 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift158 = {{&term34, &state747}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {};
+std::vector<Reduce> reduce159 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift160 = {{&term20, &state161}, {&term34, &state162}, {&term40, &state163}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term37, &state744}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term35, &state165}, {&term36, &state166}, {&term39, &state167}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {};
+std::vector<Reduce> reduce163 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift164 = {};
+std::vector<Reduce> reduce164 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift165 = {};
+std::vector<Reduce> reduce165 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift166 = {{&term34, &state742}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {};
+std::vector<Reduce> reduce167 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift168 = {{&term21, &state169}, {&term34, &state170}, {&term40, &state171}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term37, &state739}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term35, &state173}, {&term36, &state174}, {&term39, &state175}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {};
+std::vector<Reduce> reduce171 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift172 = {};
+std::vector<Reduce> reduce172 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift173 = {};
+std::vector<Reduce> reduce173 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift174 = {{&term34, &state737}};
+std::vector<Reduce> reduce174 = {};
+std::vector<Shift> shift175 = {};
+std::vector<Reduce> reduce175 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift176 = {{&term22, &state177}, {&term34, &state178}, {&term40, &state179}};
+std::vector<Reduce> reduce176 = {};
+std::vector<Shift> shift177 = {{&term37, &state734}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {{&term35, &state181}, {&term36, &state182}, {&term39, &state183}};
+std::vector<Reduce> reduce178 = {};
+std::vector<Shift> shift179 = {};
+std::vector<Reduce> reduce179 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift180 = {};
+std::vector<Reduce> reduce180 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift181 = {};
+std::vector<Reduce> reduce181 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift182 = {{&term34, &state732}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {};
+std::vector<Reduce> reduce183 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift184 = {{&term23, &state185}, {&term34, &state186}, {&term40, &state187}};
+std::vector<Reduce> reduce184 = {};
+std::vector<Shift> shift185 = {{&term37, &state729}};
+std::vector<Reduce> reduce185 = {};
+std::vector<Shift> shift186 = {{&term35, &state189}, {&term36, &state190}, {&term39, &state191}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift187 = {};
+std::vector<Reduce> reduce187 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift188 = {};
+std::vector<Reduce> reduce188 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift189 = {};
+std::vector<Reduce> reduce189 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift190 = {{&term34, &state727}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {};
+std::vector<Reduce> reduce191 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift192 = {{&term24, &state193}, {&term34, &state194}, {&term40, &state195}};
+std::vector<Reduce> reduce192 = {};
+std::vector<Shift> shift193 = {{&term37, &state724}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term35, &state197}, {&term36, &state198}, {&term39, &state199}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {};
+std::vector<Reduce> reduce195 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift196 = {};
+std::vector<Reduce> reduce196 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift197 = {};
+std::vector<Reduce> reduce197 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift198 = {{&term34, &state722}};
+std::vector<Reduce> reduce198 = {};
+std::vector<Shift> shift199 = {};
+std::vector<Reduce> reduce199 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift200 = {{&term25, &state201}, {&term34, &state202}, {&term40, &state203}};
+std::vector<Reduce> reduce200 = {};
+std::vector<Shift> shift201 = {{&term37, &state719}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift202 = {{&term35, &state205}, {&term36, &state206}, {&term39, &state207}};
+std::vector<Reduce> reduce202 = {};
+std::vector<Shift> shift203 = {};
+std::vector<Reduce> reduce203 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift204 = {};
+std::vector<Reduce> reduce204 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift205 = {};
+std::vector<Reduce> reduce205 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift206 = {{&term34, &state717}};
+std::vector<Reduce> reduce206 = {};
+std::vector<Shift> shift207 = {};
+std::vector<Reduce> reduce207 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift208 = {{&term26, &state209}, {&term34, &state210}, {&term40, &state211}};
+std::vector<Reduce> reduce208 = {};
+std::vector<Shift> shift209 = {{&term37, &state714}};
+std::vector<Reduce> reduce209 = {};
+std::vector<Shift> shift210 = {{&term35, &state213}, {&term36, &state214}, {&term39, &state215}};
+std::vector<Reduce> reduce210 = {};
+std::vector<Shift> shift211 = {};
+std::vector<Reduce> reduce211 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift212 = {};
+std::vector<Reduce> reduce212 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift213 = {};
+std::vector<Reduce> reduce213 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift214 = {{&term34, &state712}};
+std::vector<Reduce> reduce214 = {};
+std::vector<Shift> shift215 = {};
+std::vector<Reduce> reduce215 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift216 = {{&term27, &state217}, {&term34, &state218}, {&term40, &state219}};
+std::vector<Reduce> reduce216 = {};
+std::vector<Shift> shift217 = {{&term37, &state709}};
+std::vector<Reduce> reduce217 = {};
+std::vector<Shift> shift218 = {{&term35, &state221}, {&term36, &state222}, {&term39, &state223}};
+std::vector<Reduce> reduce218 = {};
+std::vector<Shift> shift219 = {};
+std::vector<Reduce> reduce219 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift220 = {};
+std::vector<Reduce> reduce220 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift221 = {};
+std::vector<Reduce> reduce221 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift222 = {{&term34, &state707}};
+std::vector<Reduce> reduce222 = {};
+std::vector<Shift> shift223 = {};
+std::vector<Reduce> reduce223 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift224 = {{&term28, &state225}, {&term34, &state226}, {&term40, &state227}};
+std::vector<Reduce> reduce224 = {};
+std::vector<Shift> shift225 = {{&term37, &state704}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift226 = {{&term35, &state229}, {&term36, &state230}, {&term39, &state231}};
+std::vector<Reduce> reduce226 = {};
+std::vector<Shift> shift227 = {};
+std::vector<Reduce> reduce227 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift228 = {};
+std::vector<Reduce> reduce228 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift229 = {};
+std::vector<Reduce> reduce229 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift230 = {{&term34, &state702}};
+std::vector<Reduce> reduce230 = {};
+std::vector<Shift> shift231 = {};
+std::vector<Reduce> reduce231 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift232 = {{&term29, &state233}, {&term34, &state234}, {&term40, &state235}};
+std::vector<Reduce> reduce232 = {};
+std::vector<Shift> shift233 = {{&term37, &state699}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {{&term35, &state237}, {&term36, &state238}, {&term39, &state239}};
+std::vector<Reduce> reduce234 = {};
+std::vector<Shift> shift235 = {};
+std::vector<Reduce> reduce235 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift236 = {};
+std::vector<Reduce> reduce236 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift237 = {};
+std::vector<Reduce> reduce237 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift238 = {{&term34, &state697}};
+std::vector<Reduce> reduce238 = {};
+std::vector<Shift> shift239 = {};
+std::vector<Reduce> reduce239 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift240 = {{&term30, &state241}, {&term34, &state242}, {&term40, &state243}};
+std::vector<Reduce> reduce240 = {};
+std::vector<Shift> shift241 = {{&term37, &state694}};
+std::vector<Reduce> reduce241 = {};
+std::vector<Shift> shift242 = {{&term35, &state245}, {&term36, &state246}, {&term39, &state247}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {};
+std::vector<Reduce> reduce243 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift244 = {};
+std::vector<Reduce> reduce244 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift245 = {};
+std::vector<Reduce> reduce245 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift246 = {{&term34, &state692}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {};
+std::vector<Reduce> reduce247 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift248 = {{&term31, &state249}, {&term34, &state250}, {&term40, &state251}};
+std::vector<Reduce> reduce248 = {};
+std::vector<Shift> shift249 = {{&term37, &state689}};
+std::vector<Reduce> reduce249 = {};
+std::vector<Shift> shift250 = {{&term35, &state253}, {&term36, &state254}, {&term39, &state255}};
+std::vector<Reduce> reduce250 = {};
+std::vector<Shift> shift251 = {};
+std::vector<Reduce> reduce251 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift252 = {};
+std::vector<Reduce> reduce252 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift253 = {};
+std::vector<Reduce> reduce253 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift254 = {{&term34, &state687}};
+std::vector<Reduce> reduce254 = {};
+std::vector<Shift> shift256 = {{&term0, &state257}, {&term34, &state258}, {&term40, &state259}};
+std::vector<Reduce> reduce256 = {};
+std::vector<Shift> shift257 = {{&term37, &state268}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {{&term35, &state261}, {&term36, &state262}, {&term39, &state263}};
+std::vector<Reduce> reduce258 = {};
+std::vector<Shift> shift259 = {};
+std::vector<Reduce> reduce259 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift262 = {{&term34, &state266}};
+std::vector<Reduce> reduce262 = {};
+std::vector<Shift> shift264 = {{&term1, &state9}, {&term34, &state10}, {&term40, &state265}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift266 = {{&term35, &state267}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift267 = {};
+std::vector<Reduce> reduce267 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift269 = {{&term1, &state270}, {&term34, &state271}, {&term38, &state272}};
+std::vector<Reduce> reduce269 = {};
+std::vector<Shift> shift270 = {{&term37, &state281}};
+std::vector<Reduce> reduce270 = {};
+std::vector<Shift> shift271 = {{&term35, &state274}, {&term36, &state275}, {&term39, &state276}};
+std::vector<Reduce> reduce271 = {};
+std::vector<Shift> shift272 = {};
+std::vector<Reduce> reduce272 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift275 = {{&term34, &state279}};
+std::vector<Reduce> reduce275 = {};
+std::vector<Shift> shift277 = {{&term2, &state17}, {&term34, &state18}, {&term40, &state278}};
+std::vector<Reduce> reduce277 = {};
+std::vector<Shift> shift279 = {{&term35, &state280}};
+std::vector<Reduce> reduce279 = {};
+std::vector<Shift> shift280 = {};
+std::vector<Reduce> reduce280 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift282 = {{&term2, &state283}, {&term34, &state284}, {&term38, &state285}};
+std::vector<Reduce> reduce282 = {};
+std::vector<Shift> shift283 = {{&term37, &state294}};
+std::vector<Reduce> reduce283 = {};
+std::vector<Shift> shift284 = {{&term35, &state287}, {&term36, &state288}, {&term39, &state289}};
+std::vector<Reduce> reduce284 = {};
+std::vector<Shift> shift285 = {};
+std::vector<Reduce> reduce285 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift288 = {{&term34, &state292}};
+std::vector<Reduce> reduce288 = {};
+std::vector<Shift> shift290 = {{&term3, &state25}, {&term34, &state26}, {&term40, &state291}};
+std::vector<Reduce> reduce290 = {};
+std::vector<Shift> shift292 = {{&term35, &state293}};
+std::vector<Reduce> reduce292 = {};
+std::vector<Shift> shift293 = {};
+std::vector<Reduce> reduce293 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift295 = {{&term3, &state296}, {&term34, &state297}, {&term38, &state298}};
+std::vector<Reduce> reduce295 = {};
+std::vector<Shift> shift296 = {{&term37, &state307}};
+std::vector<Reduce> reduce296 = {};
+std::vector<Shift> shift297 = {{&term35, &state300}, {&term36, &state301}, {&term39, &state302}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {};
+std::vector<Reduce> reduce298 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift301 = {{&term34, &state305}};
+std::vector<Reduce> reduce301 = {};
+std::vector<Shift> shift303 = {{&term4, &state33}, {&term34, &state34}, {&term40, &state304}};
+std::vector<Reduce> reduce303 = {};
+std::vector<Shift> shift305 = {{&term35, &state306}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {};
+std::vector<Reduce> reduce306 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift308 = {{&term4, &state309}, {&term34, &state310}, {&term38, &state311}};
+std::vector<Reduce> reduce308 = {};
+std::vector<Shift> shift309 = {{&term37, &state320}};
+std::vector<Reduce> reduce309 = {};
+std::vector<Shift> shift310 = {{&term35, &state313}, {&term36, &state314}, {&term39, &state315}};
+std::vector<Reduce> reduce310 = {};
+std::vector<Shift> shift311 = {};
+std::vector<Reduce> reduce311 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift314 = {{&term34, &state318}};
+std::vector<Reduce> reduce314 = {};
+std::vector<Shift> shift316 = {{&term5, &state41}, {&term34, &state42}, {&term40, &state317}};
+std::vector<Reduce> reduce316 = {};
+std::vector<Shift> shift318 = {{&term35, &state319}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift319 = {};
+std::vector<Reduce> reduce319 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift321 = {{&term5, &state322}, {&term34, &state323}, {&term38, &state324}};
+std::vector<Reduce> reduce321 = {};
+std::vector<Shift> shift322 = {{&term37, &state333}};
+std::vector<Reduce> reduce322 = {};
+std::vector<Shift> shift323 = {{&term35, &state326}, {&term36, &state327}, {&term39, &state328}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {};
+std::vector<Reduce> reduce324 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift327 = {{&term34, &state331}};
+std::vector<Reduce> reduce327 = {};
+std::vector<Shift> shift329 = {{&term6, &state49}, {&term34, &state50}, {&term40, &state330}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift331 = {{&term35, &state332}};
+std::vector<Reduce> reduce331 = {};
+std::vector<Shift> shift332 = {};
+std::vector<Reduce> reduce332 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift334 = {{&term6, &state335}, {&term34, &state336}, {&term38, &state337}};
+std::vector<Reduce> reduce334 = {};
+std::vector<Shift> shift335 = {{&term37, &state346}};
+std::vector<Reduce> reduce335 = {};
+std::vector<Shift> shift336 = {{&term35, &state339}, {&term36, &state340}, {&term39, &state341}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {};
+std::vector<Reduce> reduce337 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift340 = {{&term34, &state344}};
+std::vector<Reduce> reduce340 = {};
+std::vector<Shift> shift342 = {{&term7, &state57}, {&term34, &state58}, {&term40, &state343}};
+std::vector<Reduce> reduce342 = {};
+std::vector<Shift> shift344 = {{&term35, &state345}};
+std::vector<Reduce> reduce344 = {};
+std::vector<Shift> shift345 = {};
+std::vector<Reduce> reduce345 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift347 = {{&term7, &state348}, {&term34, &state349}, {&term38, &state350}};
+std::vector<Reduce> reduce347 = {};
+std::vector<Shift> shift348 = {{&term37, &state359}};
+std::vector<Reduce> reduce348 = {};
+std::vector<Shift> shift349 = {{&term35, &state352}, {&term36, &state353}, {&term39, &state354}};
+std::vector<Reduce> reduce349 = {};
+std::vector<Shift> shift350 = {};
+std::vector<Reduce> reduce350 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift353 = {{&term34, &state357}};
+std::vector<Reduce> reduce353 = {};
+std::vector<Shift> shift355 = {{&term8, &state65}, {&term34, &state66}, {&term40, &state356}};
+std::vector<Reduce> reduce355 = {};
+std::vector<Shift> shift357 = {{&term35, &state358}};
+std::vector<Reduce> reduce357 = {};
+std::vector<Shift> shift358 = {};
+std::vector<Reduce> reduce358 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift360 = {{&term8, &state361}, {&term34, &state362}, {&term38, &state363}};
+std::vector<Reduce> reduce360 = {};
+std::vector<Shift> shift361 = {{&term37, &state372}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift362 = {{&term35, &state365}, {&term36, &state366}, {&term39, &state367}};
+std::vector<Reduce> reduce362 = {};
+std::vector<Shift> shift363 = {};
+std::vector<Reduce> reduce363 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift366 = {{&term34, &state370}};
+std::vector<Reduce> reduce366 = {};
+std::vector<Shift> shift368 = {{&term9, &state73}, {&term34, &state74}, {&term40, &state369}};
+std::vector<Reduce> reduce368 = {};
+std::vector<Shift> shift370 = {{&term35, &state371}};
+std::vector<Reduce> reduce370 = {};
+std::vector<Shift> shift371 = {};
+std::vector<Reduce> reduce371 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift373 = {{&term9, &state374}, {&term34, &state375}, {&term38, &state376}};
+std::vector<Reduce> reduce373 = {};
+std::vector<Shift> shift374 = {{&term37, &state385}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift375 = {{&term35, &state378}, {&term36, &state379}, {&term39, &state380}};
+std::vector<Reduce> reduce375 = {};
+std::vector<Shift> shift376 = {};
+std::vector<Reduce> reduce376 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift379 = {{&term34, &state383}};
+std::vector<Reduce> reduce379 = {};
+std::vector<Shift> shift381 = {{&term10, &state81}, {&term34, &state82}, {&term40, &state382}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift383 = {{&term35, &state384}};
+std::vector<Reduce> reduce383 = {};
+std::vector<Shift> shift384 = {};
+std::vector<Reduce> reduce384 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift386 = {{&term10, &state387}, {&term34, &state388}, {&term38, &state389}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift387 = {{&term37, &state398}};
+std::vector<Reduce> reduce387 = {};
+std::vector<Shift> shift388 = {{&term35, &state391}, {&term36, &state392}, {&term39, &state393}};
+std::vector<Reduce> reduce388 = {};
+std::vector<Shift> shift389 = {};
+std::vector<Reduce> reduce389 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift392 = {{&term34, &state396}};
+std::vector<Reduce> reduce392 = {};
+std::vector<Shift> shift394 = {{&term11, &state89}, {&term34, &state90}, {&term40, &state395}};
+std::vector<Reduce> reduce394 = {};
+std::vector<Shift> shift396 = {{&term35, &state397}};
+std::vector<Reduce> reduce396 = {};
+std::vector<Shift> shift397 = {};
+std::vector<Reduce> reduce397 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift399 = {{&term11, &state400}, {&term34, &state401}, {&term38, &state402}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift400 = {{&term37, &state411}};
+std::vector<Reduce> reduce400 = {};
+std::vector<Shift> shift401 = {{&term35, &state404}, {&term36, &state405}, {&term39, &state406}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {};
+std::vector<Reduce> reduce402 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift405 = {{&term34, &state409}};
+std::vector<Reduce> reduce405 = {};
+std::vector<Shift> shift407 = {{&term12, &state97}, {&term34, &state98}, {&term40, &state408}};
+std::vector<Reduce> reduce407 = {};
+std::vector<Shift> shift409 = {{&term35, &state410}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift410 = {};
+std::vector<Reduce> reduce410 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift412 = {{&term12, &state413}, {&term34, &state414}, {&term38, &state415}};
+std::vector<Reduce> reduce412 = {};
+std::vector<Shift> shift413 = {{&term37, &state424}};
+std::vector<Reduce> reduce413 = {};
+std::vector<Shift> shift414 = {{&term35, &state417}, {&term36, &state418}, {&term39, &state419}};
+std::vector<Reduce> reduce414 = {};
+std::vector<Shift> shift415 = {};
+std::vector<Reduce> reduce415 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift418 = {{&term34, &state422}};
+std::vector<Reduce> reduce418 = {};
+std::vector<Shift> shift420 = {{&term13, &state105}, {&term34, &state106}, {&term40, &state421}};
+std::vector<Reduce> reduce420 = {};
+std::vector<Shift> shift422 = {{&term35, &state423}};
+std::vector<Reduce> reduce422 = {};
+std::vector<Shift> shift423 = {};
+std::vector<Reduce> reduce423 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift425 = {{&term13, &state426}, {&term34, &state427}, {&term38, &state428}};
+std::vector<Reduce> reduce425 = {};
+std::vector<Shift> shift426 = {{&term37, &state437}};
+std::vector<Reduce> reduce426 = {};
+std::vector<Shift> shift427 = {{&term35, &state430}, {&term36, &state431}, {&term39, &state432}};
+std::vector<Reduce> reduce427 = {};
+std::vector<Shift> shift428 = {};
+std::vector<Reduce> reduce428 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift431 = {{&term34, &state435}};
+std::vector<Reduce> reduce431 = {};
+std::vector<Shift> shift433 = {{&term14, &state113}, {&term34, &state114}, {&term40, &state434}};
+std::vector<Reduce> reduce433 = {};
+std::vector<Shift> shift435 = {{&term35, &state436}};
+std::vector<Reduce> reduce435 = {};
+std::vector<Shift> shift436 = {};
+std::vector<Reduce> reduce436 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift438 = {{&term14, &state439}, {&term34, &state440}, {&term38, &state441}};
+std::vector<Reduce> reduce438 = {};
+std::vector<Shift> shift439 = {{&term37, &state450}};
+std::vector<Reduce> reduce439 = {};
+std::vector<Shift> shift440 = {{&term35, &state443}, {&term36, &state444}, {&term39, &state445}};
+std::vector<Reduce> reduce440 = {};
+std::vector<Shift> shift441 = {};
+std::vector<Reduce> reduce441 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift444 = {{&term34, &state448}};
+std::vector<Reduce> reduce444 = {};
+std::vector<Shift> shift446 = {{&term15, &state121}, {&term34, &state122}, {&term40, &state447}};
+std::vector<Reduce> reduce446 = {};
+std::vector<Shift> shift448 = {{&term35, &state449}};
+std::vector<Reduce> reduce448 = {};
+std::vector<Shift> shift449 = {};
+std::vector<Reduce> reduce449 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift451 = {{&term15, &state452}, {&term34, &state453}, {&term38, &state454}};
+std::vector<Reduce> reduce451 = {};
+std::vector<Shift> shift452 = {{&term37, &state463}};
+std::vector<Reduce> reduce452 = {};
+std::vector<Shift> shift453 = {{&term35, &state456}, {&term36, &state457}, {&term39, &state458}};
+std::vector<Reduce> reduce453 = {};
+std::vector<Shift> shift454 = {};
+std::vector<Reduce> reduce454 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift457 = {{&term34, &state461}};
+std::vector<Reduce> reduce457 = {};
+std::vector<Shift> shift459 = {{&term16, &state129}, {&term34, &state130}, {&term40, &state460}};
+std::vector<Reduce> reduce459 = {};
+std::vector<Shift> shift461 = {{&term35, &state462}};
+std::vector<Reduce> reduce461 = {};
+std::vector<Shift> shift462 = {};
+std::vector<Reduce> reduce462 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift464 = {{&term16, &state465}, {&term34, &state466}, {&term38, &state467}};
+std::vector<Reduce> reduce464 = {};
+std::vector<Shift> shift465 = {{&term37, &state476}};
+std::vector<Reduce> reduce465 = {};
+std::vector<Shift> shift466 = {{&term35, &state469}, {&term36, &state470}, {&term39, &state471}};
+std::vector<Reduce> reduce466 = {};
+std::vector<Shift> shift467 = {};
+std::vector<Reduce> reduce467 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift470 = {{&term34, &state474}};
+std::vector<Reduce> reduce470 = {};
+std::vector<Shift> shift472 = {{&term17, &state137}, {&term34, &state138}, {&term40, &state473}};
+std::vector<Reduce> reduce472 = {};
+std::vector<Shift> shift474 = {{&term35, &state475}};
+std::vector<Reduce> reduce474 = {};
+std::vector<Shift> shift475 = {};
+std::vector<Reduce> reduce475 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift477 = {{&term17, &state478}, {&term34, &state479}, {&term38, &state480}};
+std::vector<Reduce> reduce477 = {};
+std::vector<Shift> shift478 = {{&term37, &state489}};
+std::vector<Reduce> reduce478 = {};
+std::vector<Shift> shift479 = {{&term35, &state482}, {&term36, &state483}, {&term39, &state484}};
+std::vector<Reduce> reduce479 = {};
+std::vector<Shift> shift480 = {};
+std::vector<Reduce> reduce480 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift483 = {{&term34, &state487}};
+std::vector<Reduce> reduce483 = {};
+std::vector<Shift> shift485 = {{&term18, &state145}, {&term34, &state146}, {&term40, &state486}};
+std::vector<Reduce> reduce485 = {};
+std::vector<Shift> shift487 = {{&term35, &state488}};
+std::vector<Reduce> reduce487 = {};
+std::vector<Shift> shift488 = {};
+std::vector<Reduce> reduce488 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift490 = {{&term18, &state491}, {&term34, &state492}, {&term38, &state493}};
+std::vector<Reduce> reduce490 = {};
+std::vector<Shift> shift491 = {{&term37, &state502}};
+std::vector<Reduce> reduce491 = {};
+std::vector<Shift> shift492 = {{&term35, &state495}, {&term36, &state496}, {&term39, &state497}};
+std::vector<Reduce> reduce492 = {};
+std::vector<Shift> shift493 = {};
+std::vector<Reduce> reduce493 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift496 = {{&term34, &state500}};
+std::vector<Reduce> reduce496 = {};
+std::vector<Shift> shift498 = {{&term19, &state153}, {&term34, &state154}, {&term40, &state499}};
+std::vector<Reduce> reduce498 = {};
+std::vector<Shift> shift500 = {{&term35, &state501}};
+std::vector<Reduce> reduce500 = {};
+std::vector<Shift> shift501 = {};
+std::vector<Reduce> reduce501 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift503 = {{&term19, &state504}, {&term34, &state505}, {&term38, &state506}};
+std::vector<Reduce> reduce503 = {};
+std::vector<Shift> shift504 = {{&term37, &state515}};
+std::vector<Reduce> reduce504 = {};
+std::vector<Shift> shift505 = {{&term35, &state508}, {&term36, &state509}, {&term39, &state510}};
+std::vector<Reduce> reduce505 = {};
+std::vector<Shift> shift506 = {};
+std::vector<Reduce> reduce506 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift509 = {{&term34, &state513}};
+std::vector<Reduce> reduce509 = {};
+std::vector<Shift> shift511 = {{&term20, &state161}, {&term34, &state162}, {&term40, &state512}};
+std::vector<Reduce> reduce511 = {};
+std::vector<Shift> shift513 = {{&term35, &state514}};
+std::vector<Reduce> reduce513 = {};
+std::vector<Shift> shift514 = {};
+std::vector<Reduce> reduce514 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift516 = {{&term20, &state517}, {&term34, &state518}, {&term38, &state519}};
+std::vector<Reduce> reduce516 = {};
+std::vector<Shift> shift517 = {{&term37, &state528}};
+std::vector<Reduce> reduce517 = {};
+std::vector<Shift> shift518 = {{&term35, &state521}, {&term36, &state522}, {&term39, &state523}};
+std::vector<Reduce> reduce518 = {};
+std::vector<Shift> shift519 = {};
+std::vector<Reduce> reduce519 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift522 = {{&term34, &state526}};
+std::vector<Reduce> reduce522 = {};
+std::vector<Shift> shift524 = {{&term21, &state169}, {&term34, &state170}, {&term40, &state525}};
+std::vector<Reduce> reduce524 = {};
+std::vector<Shift> shift526 = {{&term35, &state527}};
+std::vector<Reduce> reduce526 = {};
+std::vector<Shift> shift527 = {};
+std::vector<Reduce> reduce527 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift529 = {{&term21, &state530}, {&term34, &state531}, {&term38, &state532}};
+std::vector<Reduce> reduce529 = {};
+std::vector<Shift> shift530 = {{&term37, &state541}};
+std::vector<Reduce> reduce530 = {};
+std::vector<Shift> shift531 = {{&term35, &state534}, {&term36, &state535}, {&term39, &state536}};
+std::vector<Reduce> reduce531 = {};
+std::vector<Shift> shift532 = {};
+std::vector<Reduce> reduce532 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift535 = {{&term34, &state539}};
+std::vector<Reduce> reduce535 = {};
+std::vector<Shift> shift537 = {{&term22, &state177}, {&term34, &state178}, {&term40, &state538}};
+std::vector<Reduce> reduce537 = {};
+std::vector<Shift> shift539 = {{&term35, &state540}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {};
+std::vector<Reduce> reduce540 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift542 = {{&term22, &state543}, {&term34, &state544}, {&term38, &state545}};
+std::vector<Reduce> reduce542 = {};
+std::vector<Shift> shift543 = {{&term37, &state554}};
+std::vector<Reduce> reduce543 = {};
+std::vector<Shift> shift544 = {{&term35, &state547}, {&term36, &state548}, {&term39, &state549}};
+std::vector<Reduce> reduce544 = {};
+std::vector<Shift> shift545 = {};
+std::vector<Reduce> reduce545 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift548 = {{&term34, &state552}};
+std::vector<Reduce> reduce548 = {};
+std::vector<Shift> shift550 = {{&term23, &state185}, {&term34, &state186}, {&term40, &state551}};
+std::vector<Reduce> reduce550 = {};
+std::vector<Shift> shift552 = {{&term35, &state553}};
+std::vector<Reduce> reduce552 = {};
+std::vector<Shift> shift553 = {};
+std::vector<Reduce> reduce553 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift555 = {{&term23, &state556}, {&term34, &state557}, {&term38, &state558}};
+std::vector<Reduce> reduce555 = {};
+std::vector<Shift> shift556 = {{&term37, &state567}};
+std::vector<Reduce> reduce556 = {};
+std::vector<Shift> shift557 = {{&term35, &state560}, {&term36, &state561}, {&term39, &state562}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift558 = {};
+std::vector<Reduce> reduce558 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift561 = {{&term34, &state565}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift563 = {{&term24, &state193}, {&term34, &state194}, {&term40, &state564}};
+std::vector<Reduce> reduce563 = {};
+std::vector<Shift> shift565 = {{&term35, &state566}};
+std::vector<Reduce> reduce565 = {};
+std::vector<Shift> shift566 = {};
+std::vector<Reduce> reduce566 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift568 = {{&term24, &state569}, {&term34, &state570}, {&term38, &state571}};
+std::vector<Reduce> reduce568 = {};
+std::vector<Shift> shift569 = {{&term37, &state580}};
+std::vector<Reduce> reduce569 = {};
+std::vector<Shift> shift570 = {{&term35, &state573}, {&term36, &state574}, {&term39, &state575}};
+std::vector<Reduce> reduce570 = {};
+std::vector<Shift> shift571 = {};
+std::vector<Reduce> reduce571 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift574 = {{&term34, &state578}};
+std::vector<Reduce> reduce574 = {};
+std::vector<Shift> shift576 = {{&term25, &state201}, {&term34, &state202}, {&term40, &state577}};
+std::vector<Reduce> reduce576 = {};
+std::vector<Shift> shift578 = {{&term35, &state579}};
+std::vector<Reduce> reduce578 = {};
+std::vector<Shift> shift579 = {};
+std::vector<Reduce> reduce579 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift581 = {{&term25, &state582}, {&term34, &state583}, {&term38, &state584}};
+std::vector<Reduce> reduce581 = {};
+std::vector<Shift> shift582 = {{&term37, &state593}};
+std::vector<Reduce> reduce582 = {};
+std::vector<Shift> shift583 = {{&term35, &state586}, {&term36, &state587}, {&term39, &state588}};
+std::vector<Reduce> reduce583 = {};
+std::vector<Shift> shift584 = {};
+std::vector<Reduce> reduce584 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift587 = {{&term34, &state591}};
+std::vector<Reduce> reduce587 = {};
+std::vector<Shift> shift589 = {{&term26, &state209}, {&term34, &state210}, {&term40, &state590}};
+std::vector<Reduce> reduce589 = {};
+std::vector<Shift> shift591 = {{&term35, &state592}};
+std::vector<Reduce> reduce591 = {};
+std::vector<Shift> shift592 = {};
+std::vector<Reduce> reduce592 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift594 = {{&term26, &state595}, {&term34, &state596}, {&term38, &state597}};
+std::vector<Reduce> reduce594 = {};
+std::vector<Shift> shift595 = {{&term37, &state606}};
+std::vector<Reduce> reduce595 = {};
+std::vector<Shift> shift596 = {{&term35, &state599}, {&term36, &state600}, {&term39, &state601}};
+std::vector<Reduce> reduce596 = {};
+std::vector<Shift> shift597 = {};
+std::vector<Reduce> reduce597 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift600 = {{&term34, &state604}};
+std::vector<Reduce> reduce600 = {};
+std::vector<Shift> shift602 = {{&term27, &state217}, {&term34, &state218}, {&term40, &state603}};
+std::vector<Reduce> reduce602 = {};
+std::vector<Shift> shift604 = {{&term35, &state605}};
+std::vector<Reduce> reduce604 = {};
+std::vector<Shift> shift605 = {};
+std::vector<Reduce> reduce605 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift607 = {{&term27, &state608}, {&term34, &state609}, {&term38, &state610}};
+std::vector<Reduce> reduce607 = {};
+std::vector<Shift> shift608 = {{&term37, &state619}};
+std::vector<Reduce> reduce608 = {};
+std::vector<Shift> shift609 = {{&term35, &state612}, {&term36, &state613}, {&term39, &state614}};
+std::vector<Reduce> reduce609 = {};
+std::vector<Shift> shift610 = {};
+std::vector<Reduce> reduce610 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift613 = {{&term34, &state617}};
+std::vector<Reduce> reduce613 = {};
+std::vector<Shift> shift615 = {{&term28, &state225}, {&term34, &state226}, {&term40, &state616}};
+std::vector<Reduce> reduce615 = {};
+std::vector<Shift> shift617 = {{&term35, &state618}};
+std::vector<Reduce> reduce617 = {};
+std::vector<Shift> shift618 = {};
+std::vector<Reduce> reduce618 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift620 = {{&term28, &state621}, {&term34, &state622}, {&term38, &state623}};
+std::vector<Reduce> reduce620 = {};
+std::vector<Shift> shift621 = {{&term37, &state632}};
+std::vector<Reduce> reduce621 = {};
+std::vector<Shift> shift622 = {{&term35, &state625}, {&term36, &state626}, {&term39, &state627}};
+std::vector<Reduce> reduce622 = {};
+std::vector<Shift> shift623 = {};
+std::vector<Reduce> reduce623 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift626 = {{&term34, &state630}};
+std::vector<Reduce> reduce626 = {};
+std::vector<Shift> shift628 = {{&term29, &state233}, {&term34, &state234}, {&term40, &state629}};
+std::vector<Reduce> reduce628 = {};
+std::vector<Shift> shift630 = {{&term35, &state631}};
+std::vector<Reduce> reduce630 = {};
+std::vector<Shift> shift631 = {};
+std::vector<Reduce> reduce631 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift633 = {{&term29, &state634}, {&term34, &state635}, {&term38, &state636}};
+std::vector<Reduce> reduce633 = {};
+std::vector<Shift> shift634 = {{&term37, &state645}};
+std::vector<Reduce> reduce634 = {};
+std::vector<Shift> shift635 = {{&term35, &state638}, {&term36, &state639}, {&term39, &state640}};
+std::vector<Reduce> reduce635 = {};
+std::vector<Shift> shift636 = {};
+std::vector<Reduce> reduce636 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift639 = {{&term34, &state643}};
+std::vector<Reduce> reduce639 = {};
+std::vector<Shift> shift641 = {{&term30, &state241}, {&term34, &state242}, {&term40, &state642}};
+std::vector<Reduce> reduce641 = {};
+std::vector<Shift> shift643 = {{&term35, &state644}};
+std::vector<Reduce> reduce643 = {};
+std::vector<Shift> shift644 = {};
+std::vector<Reduce> reduce644 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift646 = {{&term30, &state647}, {&term34, &state648}, {&term38, &state649}};
+std::vector<Reduce> reduce646 = {};
+std::vector<Shift> shift647 = {{&term37, &state658}};
+std::vector<Reduce> reduce647 = {};
+std::vector<Shift> shift648 = {{&term35, &state651}, {&term36, &state652}, {&term39, &state653}};
+std::vector<Reduce> reduce648 = {};
+std::vector<Shift> shift649 = {};
+std::vector<Reduce> reduce649 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift652 = {{&term34, &state656}};
+std::vector<Reduce> reduce652 = {};
+std::vector<Shift> shift654 = {{&term31, &state249}, {&term34, &state250}, {&term40, &state655}};
+std::vector<Reduce> reduce654 = {};
+std::vector<Shift> shift656 = {{&term35, &state657}};
+std::vector<Reduce> reduce656 = {};
+std::vector<Shift> shift657 = {};
+std::vector<Reduce> reduce657 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift659 = {{&term31, &state660}, {&term34, &state661}, {&term38, &state662}};
+std::vector<Reduce> reduce659 = {};
+std::vector<Shift> shift660 = {{&term37, &state671}};
+std::vector<Reduce> reduce660 = {};
+std::vector<Shift> shift661 = {{&term35, &state664}, {&term36, &state665}, {&term39, &state666}};
+std::vector<Reduce> reduce661 = {};
+std::vector<Shift> shift662 = {};
+std::vector<Reduce> reduce662 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift665 = {{&term34, &state669}};
+std::vector<Reduce> reduce665 = {};
+std::vector<Shift> shift667 = {{&term0, &state257}, {&term34, &state258}, {&term40, &state668}};
+std::vector<Reduce> reduce667 = {};
+std::vector<Shift> shift669 = {{&term35, &state670}};
+std::vector<Reduce> reduce669 = {};
+std::vector<Shift> shift670 = {};
+std::vector<Reduce> reduce670 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift672 = {{&term0, &state673}, {&term34, &state674}, {&term38, &state675}};
+std::vector<Reduce> reduce672 = {};
+std::vector<Shift> shift673 = {{&term37, &state684}};
+std::vector<Reduce> reduce673 = {};
+std::vector<Shift> shift674 = {{&term35, &state677}, {&term36, &state678}, {&term39, &state679}};
+std::vector<Reduce> reduce674 = {};
+std::vector<Shift> shift675 = {};
+std::vector<Reduce> reduce675 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift678 = {{&term34, &state682}};
+std::vector<Reduce> reduce678 = {};
+std::vector<Shift> shift680 = {{&term1, &state9}, {&term34, &state10}, {&term40, &state681}};
+std::vector<Reduce> reduce680 = {};
+std::vector<Shift> shift682 = {{&term35, &state683}};
+std::vector<Reduce> reduce682 = {};
+std::vector<Shift> shift685 = {{&term1, &state270}, {&term34, &state271}, {&term38, &state686}};
+std::vector<Reduce> reduce685 = {};
+std::vector<Shift> shift687 = {{&term35, &state688}};
+std::vector<Reduce> reduce687 = {};
+std::vector<Shift> shift690 = {{&term0, &state673}, {&term34, &state674}, {&term38, &state691}};
+std::vector<Reduce> reduce690 = {};
+std::vector<Shift> shift692 = {{&term35, &state693}};
+std::vector<Reduce> reduce692 = {};
+std::vector<Shift> shift695 = {{&term31, &state660}, {&term34, &state661}, {&term38, &state696}};
+std::vector<Reduce> reduce695 = {};
+std::vector<Shift> shift697 = {{&term35, &state698}};
+std::vector<Reduce> reduce697 = {};
+std::vector<Shift> shift700 = {{&term30, &state647}, {&term34, &state648}, {&term38, &state701}};
+std::vector<Reduce> reduce700 = {};
+std::vector<Shift> shift702 = {{&term35, &state703}};
+std::vector<Reduce> reduce702 = {};
+std::vector<Shift> shift705 = {{&term29, &state634}, {&term34, &state635}, {&term38, &state706}};
+std::vector<Reduce> reduce705 = {};
+std::vector<Shift> shift707 = {{&term35, &state708}};
+std::vector<Reduce> reduce707 = {};
+std::vector<Shift> shift710 = {{&term28, &state621}, {&term34, &state622}, {&term38, &state711}};
+std::vector<Reduce> reduce710 = {};
+std::vector<Shift> shift712 = {{&term35, &state713}};
+std::vector<Reduce> reduce712 = {};
+std::vector<Shift> shift715 = {{&term27, &state608}, {&term34, &state609}, {&term38, &state716}};
+std::vector<Reduce> reduce715 = {};
+std::vector<Shift> shift717 = {{&term35, &state718}};
+std::vector<Reduce> reduce717 = {};
+std::vector<Shift> shift720 = {{&term26, &state595}, {&term34, &state596}, {&term38, &state721}};
+std::vector<Reduce> reduce720 = {};
+std::vector<Shift> shift722 = {{&term35, &state723}};
+std::vector<Reduce> reduce722 = {};
+std::vector<Shift> shift725 = {{&term25, &state582}, {&term34, &state583}, {&term38, &state726}};
+std::vector<Reduce> reduce725 = {};
+std::vector<Shift> shift727 = {{&term35, &state728}};
+std::vector<Reduce> reduce727 = {};
+std::vector<Shift> shift730 = {{&term24, &state569}, {&term34, &state570}, {&term38, &state731}};
+std::vector<Reduce> reduce730 = {};
+std::vector<Shift> shift732 = {{&term35, &state733}};
+std::vector<Reduce> reduce732 = {};
+std::vector<Shift> shift735 = {{&term23, &state556}, {&term34, &state557}, {&term38, &state736}};
+std::vector<Reduce> reduce735 = {};
+std::vector<Shift> shift737 = {{&term35, &state738}};
+std::vector<Reduce> reduce737 = {};
+std::vector<Shift> shift740 = {{&term22, &state543}, {&term34, &state544}, {&term38, &state741}};
+std::vector<Reduce> reduce740 = {};
+std::vector<Shift> shift742 = {{&term35, &state743}};
+std::vector<Reduce> reduce742 = {};
+std::vector<Shift> shift745 = {{&term21, &state530}, {&term34, &state531}, {&term38, &state746}};
+std::vector<Reduce> reduce745 = {};
+std::vector<Shift> shift747 = {{&term35, &state748}};
+std::vector<Reduce> reduce747 = {};
+std::vector<Shift> shift750 = {{&term20, &state517}, {&term34, &state518}, {&term38, &state751}};
+std::vector<Reduce> reduce750 = {};
+std::vector<Shift> shift752 = {{&term35, &state753}};
+std::vector<Reduce> reduce752 = {};
+std::vector<Shift> shift755 = {{&term19, &state504}, {&term34, &state505}, {&term38, &state756}};
+std::vector<Reduce> reduce755 = {};
+std::vector<Shift> shift757 = {{&term35, &state758}};
+std::vector<Reduce> reduce757 = {};
+std::vector<Shift> shift760 = {{&term18, &state491}, {&term34, &state492}, {&term38, &state761}};
+std::vector<Reduce> reduce760 = {};
+std::vector<Shift> shift762 = {{&term35, &state763}};
+std::vector<Reduce> reduce762 = {};
+std::vector<Shift> shift765 = {{&term17, &state478}, {&term34, &state479}, {&term38, &state766}};
+std::vector<Reduce> reduce765 = {};
+std::vector<Shift> shift767 = {{&term35, &state768}};
+std::vector<Reduce> reduce767 = {};
+std::vector<Shift> shift770 = {{&term16, &state465}, {&term34, &state466}, {&term38, &state771}};
+std::vector<Reduce> reduce770 = {};
+std::vector<Shift> shift772 = {{&term35, &state773}};
+std::vector<Reduce> reduce772 = {};
+std::vector<Shift> shift775 = {{&term15, &state452}, {&term34, &state453}, {&term38, &state776}};
+std::vector<Reduce> reduce775 = {};
+std::vector<Shift> shift777 = {{&term35, &state778}};
+std::vector<Reduce> reduce777 = {};
+std::vector<Shift> shift780 = {{&term14, &state439}, {&term34, &state440}, {&term38, &state781}};
+std::vector<Reduce> reduce780 = {};
+std::vector<Shift> shift782 = {{&term35, &state783}};
+std::vector<Reduce> reduce782 = {};
+std::vector<Shift> shift785 = {{&term13, &state426}, {&term34, &state427}, {&term38, &state786}};
+std::vector<Reduce> reduce785 = {};
+std::vector<Shift> shift787 = {{&term35, &state788}};
+std::vector<Reduce> reduce787 = {};
+std::vector<Shift> shift790 = {{&term12, &state413}, {&term34, &state414}, {&term38, &state791}};
+std::vector<Reduce> reduce790 = {};
+std::vector<Shift> shift792 = {{&term35, &state793}};
+std::vector<Reduce> reduce792 = {};
+std::vector<Shift> shift795 = {{&term11, &state400}, {&term34, &state401}, {&term38, &state796}};
+std::vector<Reduce> reduce795 = {};
+std::vector<Shift> shift797 = {{&term35, &state798}};
+std::vector<Reduce> reduce797 = {};
+std::vector<Shift> shift800 = {{&term10, &state387}, {&term34, &state388}, {&term38, &state801}};
+std::vector<Reduce> reduce800 = {};
+std::vector<Shift> shift802 = {{&term35, &state803}};
+std::vector<Reduce> reduce802 = {};
+std::vector<Shift> shift805 = {{&term9, &state374}, {&term34, &state375}, {&term38, &state806}};
+std::vector<Reduce> reduce805 = {};
+std::vector<Shift> shift807 = {{&term35, &state808}};
+std::vector<Reduce> reduce807 = {};
+std::vector<Shift> shift810 = {{&term8, &state361}, {&term34, &state362}, {&term38, &state811}};
+std::vector<Reduce> reduce810 = {};
+std::vector<Shift> shift812 = {{&term35, &state813}};
+std::vector<Reduce> reduce812 = {};
+std::vector<Shift> shift815 = {{&term7, &state348}, {&term34, &state349}, {&term38, &state816}};
+std::vector<Reduce> reduce815 = {};
+std::vector<Shift> shift817 = {{&term35, &state818}};
+std::vector<Reduce> reduce817 = {};
+std::vector<Shift> shift820 = {{&term6, &state335}, {&term34, &state336}, {&term38, &state821}};
+std::vector<Reduce> reduce820 = {};
+std::vector<Shift> shift822 = {{&term35, &state823}};
+std::vector<Reduce> reduce822 = {};
+std::vector<Shift> shift825 = {{&term5, &state322}, {&term34, &state323}, {&term38, &state826}};
+std::vector<Reduce> reduce825 = {};
+std::vector<Shift> shift827 = {{&term35, &state828}};
+std::vector<Reduce> reduce827 = {};
+std::vector<Shift> shift830 = {{&term4, &state309}, {&term34, &state310}, {&term38, &state831}};
+std::vector<Reduce> reduce830 = {};
+std::vector<Shift> shift832 = {{&term35, &state833}};
+std::vector<Reduce> reduce832 = {};
+std::vector<Shift> shift835 = {{&term3, &state296}, {&term34, &state297}, {&term38, &state836}};
+std::vector<Reduce> reduce835 = {};
+std::vector<Shift> shift837 = {{&term35, &state838}};
+std::vector<Reduce> reduce837 = {};
+std::vector<Shift> shift840 = {{&term2, &state283}, {&term34, &state284}, {&term38, &state841}};
+std::vector<Reduce> reduce840 = {};
+std::vector<Shift> shift842 = {{&term35, &state843}};
+std::vector<Reduce> reduce842 = {};
+std::vector<Shift> shift845 = {{&term1, &state270}, {&term34, &state271}, {&term38, &state846}};
+std::vector<Reduce> reduce845 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state4}};
+std::vector<Go> go7 = {{&nonterm3, &state8}};
+std::vector<Go> go8 = {{&nonterm4, &state12}};
+std::vector<Go> go15 = {{&nonterm5, &state16}};
+std::vector<Go> go16 = {{&nonterm6, &state20}};
+std::vector<Go> go23 = {{&nonterm7, &state24}};
+std::vector<Go> go24 = {{&nonterm8, &state28}};
+std::vector<Go> go31 = {{&nonterm9, &state32}};
+std::vector<Go> go32 = {{&nonterm10, &state36}};
+std::vector<Go> go39 = {{&nonterm11, &state40}};
+std::vector<Go> go40 = {{&nonterm12, &state44}};
+std::vector<Go> go47 = {{&nonterm13, &state48}};
+std::vector<Go> go48 = {{&nonterm14, &state52}};
+std::vector<Go> go55 = {{&nonterm15, &state56}};
+std::vector<Go> go56 = {{&nonterm16, &state60}};
+std::vector<Go> go63 = {{&nonterm17, &state64}};
+std::vector<Go> go64 = {{&nonterm18, &state68}};
+std::vector<Go> go71 = {{&nonterm19, &state72}};
+std::vector<Go> go72 = {{&nonterm20, &state76}};
+std::vector<Go> go79 = {{&nonterm21, &state80}};
+std::vector<Go> go80 = {{&nonterm22, &state84}};
+std::vector<Go> go87 = {{&nonterm23, &state88}};
+std::vector<Go> go88 = {{&nonterm24, &state92}};
+std::vector<Go> go95 = {{&nonterm25, &state96}};
+std::vector<Go> go96 = {{&nonterm26, &state100}};
+std::vector<Go> go103 = {{&nonterm27, &state104}};
+std::vector<Go> go104 = {{&nonterm28, &state108}};
+std::vector<Go> go111 = {{&nonterm29, &state112}};
+std::vector<Go> go112 = {{&nonterm30, &state116}};
+std::vector<Go> go119 = {{&nonterm31, &state120}};
+std::vector<Go> go120 = {{&nonterm32, &state124}};
+std::vector<Go> go127 = {{&nonterm33, &state128}};
+std::vector<Go> go128 = {{&nonterm34, &state132}};
+std::vector<Go> go135 = {{&nonterm35, &state136}};
+std::vector<Go> go136 = {{&nonterm36, &state140}};
+std::vector<Go> go143 = {{&nonterm37, &state144}};
+std::vector<Go> go144 = {{&nonterm38, &state148}};
+std::vector<Go> go151 = {{&nonterm39, &state152}};
+std::vector<Go> go152 = {{&nonterm40, &state156}};
+std::vector<Go> go159 = {{&nonterm41, &state160}};
+std::vector<Go> go160 = {{&nonterm42, &state164}};
+std::vector<Go> go167 = {{&nonterm43, &state168}};
+std::vector<Go> go168 = {{&nonterm44, &state172}};
+std::vector<Go> go175 = {{&nonterm45, &state176}};
+std::vector<Go> go176 = {{&nonterm46, &state180}};
+std::vector<Go> go183 = {{&nonterm47, &state184}};
+std::vector<Go> go184 = {{&nonterm48, &state188}};
+std::vector<Go> go191 = {{&nonterm49, &state192}};
+std::vector<Go> go192 = {{&nonterm50, &state196}};
+std::vector<Go> go199 = {{&nonterm51, &state200}};
+std::vector<Go> go200 = {{&nonterm52, &state204}};
+std::vector<Go> go207 = {{&nonterm53, &state208}};
+std::vector<Go> go208 = {{&nonterm54, &state212}};
+std::vector<Go> go215 = {{&nonterm55, &state216}};
+std::vector<Go> go216 = {{&nonterm56, &state220}};
+std::vector<Go> go223 = {{&nonterm57, &state224}};
+std::vector<Go> go224 = {{&nonterm58, &state228}};
+std::vector<Go> go231 = {{&nonterm59, &state232}};
+std::vector<Go> go232 = {{&nonterm60, &state236}};
+std::vector<Go> go239 = {{&nonterm61, &state240}};
+std::vector<Go> go240 = {{&nonterm62, &state244}};
+std::vector<Go> go247 = {{&nonterm63, &state248}};
+std::vector<Go> go248 = {{&nonterm64, &state252}};
+std::vector<Go> go255 = {{&nonterm1, &state256}};
+std::vector<Go> go256 = {{&nonterm2, &state260}};
+std::vector<Go> go263 = {{&nonterm3, &state264}};
+std::vector<Go> go264 = {{&nonterm4, &state12}};
+std::vector<Go> go268 = {{&nonterm3, &state269}};
+std::vector<Go> go269 = {{&nonterm4, &state273}};
+std::vector<Go> go276 = {{&nonterm5, &state277}};
+std::vector<Go> go277 = {{&nonterm6, &state20}};
+std::vector<Go> go281 = {{&nonterm5, &state282}};
+std::vector<Go> go282 = {{&nonterm6, &state286}};
+std::vector<Go> go289 = {{&nonterm7, &state290}};
+std::vector<Go> go290 = {{&nonterm8, &state28}};
+std::vector<Go> go294 = {{&nonterm7, &state295}};
+std::vector<Go> go295 = {{&nonterm8, &state299}};
+std::vector<Go> go302 = {{&nonterm9, &state303}};
+std::vector<Go> go303 = {{&nonterm10, &state36}};
+std::vector<Go> go307 = {{&nonterm9, &state308}};
+std::vector<Go> go308 = {{&nonterm10, &state312}};
+std::vector<Go> go315 = {{&nonterm11, &state316}};
+std::vector<Go> go316 = {{&nonterm12, &state44}};
+std::vector<Go> go320 = {{&nonterm11, &state321}};
+std::vector<Go> go321 = {{&nonterm12, &state325}};
+std::vector<Go> go328 = {{&nonterm13, &state329}};
+std::vector<Go> go329 = {{&nonterm14, &state52}};
+std::vector<Go> go333 = {{&nonterm13, &state334}};
+std::vector<Go> go334 = {{&nonterm14, &state338}};
+std::vector<Go> go341 = {{&nonterm15, &state342}};
+std::vector<Go> go342 = {{&nonterm16, &state60}};
+std::vector<Go> go346 = {{&nonterm15, &state347}};
+std::vector<Go> go347 = {{&nonterm16, &state351}};
+std::vector<Go> go354 = {{&nonterm17, &state355}};
+std::vector<Go> go355 = {{&nonterm18, &state68}};
+std::vector<Go> go359 = {{&nonterm17, &state360}};
+std::vector<Go> go360 = {{&nonterm18, &state364}};
+std::vector<Go> go367 = {{&nonterm19, &state368}};
+std::vector<Go> go368 = {{&nonterm20, &state76}};
+std::vector<Go> go372 = {{&nonterm19, &state373}};
+std::vector<Go> go373 = {{&nonterm20, &state377}};
+std::vector<Go> go380 = {{&nonterm21, &state381}};
+std::vector<Go> go381 = {{&nonterm22, &state84}};
+std::vector<Go> go385 = {{&nonterm21, &state386}};
+std::vector<Go> go386 = {{&nonterm22, &state390}};
+std::vector<Go> go393 = {{&nonterm23, &state394}};
+std::vector<Go> go394 = {{&nonterm24, &state92}};
+std::vector<Go> go398 = {{&nonterm23, &state399}};
+std::vector<Go> go399 = {{&nonterm24, &state403}};
+std::vector<Go> go406 = {{&nonterm25, &state407}};
+std::vector<Go> go407 = {{&nonterm26, &state100}};
+std::vector<Go> go411 = {{&nonterm25, &state412}};
+std::vector<Go> go412 = {{&nonterm26, &state416}};
+std::vector<Go> go419 = {{&nonterm27, &state420}};
+std::vector<Go> go420 = {{&nonterm28, &state108}};
+std::vector<Go> go424 = {{&nonterm27, &state425}};
+std::vector<Go> go425 = {{&nonterm28, &state429}};
+std::vector<Go> go432 = {{&nonterm29, &state433}};
+std::vector<Go> go433 = {{&nonterm30, &state116}};
+std::vector<Go> go437 = {{&nonterm29, &state438}};
+std::vector<Go> go438 = {{&nonterm30, &state442}};
+std::vector<Go> go445 = {{&nonterm31, &state446}};
+std::vector<Go> go446 = {{&nonterm32, &state124}};
+std::vector<Go> go450 = {{&nonterm31, &state451}};
+std::vector<Go> go451 = {{&nonterm32, &state455}};
+std::vector<Go> go458 = {{&nonterm33, &state459}};
+std::vector<Go> go459 = {{&nonterm34, &state132}};
+std::vector<Go> go463 = {{&nonterm33, &state464}};
+std::vector<Go> go464 = {{&nonterm34, &state468}};
+std::vector<Go> go471 = {{&nonterm35, &state472}};
+std::vector<Go> go472 = {{&nonterm36, &state140}};
+std::vector<Go> go476 = {{&nonterm35, &state477}};
+std::vector<Go> go477 = {{&nonterm36, &state481}};
+std::vector<Go> go484 = {{&nonterm37, &state485}};
+std::vector<Go> go485 = {{&nonterm38, &state148}};
+std::vector<Go> go489 = {{&nonterm37, &state490}};
+std::vector<Go> go490 = {{&nonterm38, &state494}};
+std::vector<Go> go497 = {{&nonterm39, &state498}};
+std::vector<Go> go498 = {{&nonterm40, &state156}};
+std::vector<Go> go502 = {{&nonterm39, &state503}};
+std::vector<Go> go503 = {{&nonterm40, &state507}};
+std::vector<Go> go510 = {{&nonterm41, &state511}};
+std::vector<Go> go511 = {{&nonterm42, &state164}};
+std::vector<Go> go515 = {{&nonterm41, &state516}};
+std::vector<Go> go516 = {{&nonterm42, &state520}};
+std::vector<Go> go523 = {{&nonterm43, &state524}};
+std::vector<Go> go524 = {{&nonterm44, &state172}};
+std::vector<Go> go528 = {{&nonterm43, &state529}};
+std::vector<Go> go529 = {{&nonterm44, &state533}};
+std::vector<Go> go536 = {{&nonterm45, &state537}};
+std::vector<Go> go537 = {{&nonterm46, &state180}};
+std::vector<Go> go541 = {{&nonterm45, &state542}};
+std::vector<Go> go542 = {{&nonterm46, &state546}};
+std::vector<Go> go549 = {{&nonterm47, &state550}};
+std::vector<Go> go550 = {{&nonterm48, &state188}};
+std::vector<Go> go554 = {{&nonterm47, &state555}};
+std::vector<Go> go555 = {{&nonterm48, &state559}};
+std::vector<Go> go562 = {{&nonterm49, &state563}};
+std::vector<Go> go563 = {{&nonterm50, &state196}};
+std::vector<Go> go567 = {{&nonterm49, &state568}};
+std::vector<Go> go568 = {{&nonterm50, &state572}};
+std::vector<Go> go575 = {{&nonterm51, &state576}};
+std::vector<Go> go576 = {{&nonterm52, &state204}};
+std::vector<Go> go580 = {{&nonterm51, &state581}};
+std::vector<Go> go581 = {{&nonterm52, &state585}};
+std::vector<Go> go588 = {{&nonterm53, &state589}};
+std::vector<Go> go589 = {{&nonterm54, &state212}};
+std::vector<Go> go593 = {{&nonterm53, &state594}};
+std::vector<Go> go594 = {{&nonterm54, &state598}};
+std::vector<Go> go601 = {{&nonterm55, &state602}};
+std::vector<Go> go602 = {{&nonterm56, &state220}};
+std::vector<Go> go606 = {{&nonterm55, &state607}};
+std::vector<Go> go607 = {{&nonterm56, &state611}};
+std::vector<Go> go614 = {{&nonterm57, &state615}};
+std::vector<Go> go615 = {{&nonterm58, &state228}};
+std::vector<Go> go619 = {{&nonterm57, &state620}};
+std::vector<Go> go620 = {{&nonterm58, &state624}};
+std::vector<Go> go627 = {{&nonterm59, &state628}};
+std::vector<Go> go628 = {{&nonterm60, &state236}};
+std::vector<Go> go632 = {{&nonterm59, &state633}};
+std::vector<Go> go633 = {{&nonterm60, &state637}};
+std::vector<Go> go640 = {{&nonterm61, &state641}};
+std::vector<Go> go641 = {{&nonterm62, &state244}};
+std::vector<Go> go645 = {{&nonterm61, &state646}};
+std::vector<Go> go646 = {{&nonterm62, &state650}};
+std::vector<Go> go653 = {{&nonterm63, &state654}};
+std::vector<Go> go654 = {{&nonterm64, &state252}};
+std::vector<Go> go658 = {{&nonterm63, &state659}};
+std::vector<Go> go659 = {{&nonterm64, &state663}};
+std::vector<Go> go666 = {{&nonterm1, &state667}};
+std::vector<Go> go667 = {{&nonterm2, &state260}};
+std::vector<Go> go671 = {{&nonterm1, &state672}};
+std::vector<Go> go672 = {{&nonterm2, &state676}};
+std::vector<Go> go679 = {{&nonterm3, &state680}};
+std::vector<Go> go680 = {{&nonterm4, &state12}};
+std::vector<Go> go684 = {{&nonterm3, &state685}};
+std::vector<Go> go685 = {{&nonterm4, &state273}};
+std::vector<Go> go689 = {{&nonterm1, &state690}};
+std::vector<Go> go690 = {{&nonterm2, &state676}};
+std::vector<Go> go694 = {{&nonterm63, &state695}};
+std::vector<Go> go695 = {{&nonterm64, &state663}};
+std::vector<Go> go699 = {{&nonterm61, &state700}};
+std::vector<Go> go700 = {{&nonterm62, &state650}};
+std::vector<Go> go704 = {{&nonterm59, &state705}};
+std::vector<Go> go705 = {{&nonterm60, &state637}};
+std::vector<Go> go709 = {{&nonterm57, &state710}};
+std::vector<Go> go710 = {{&nonterm58, &state624}};
+std::vector<Go> go714 = {{&nonterm55, &state715}};
+std::vector<Go> go715 = {{&nonterm56, &state611}};
+std::vector<Go> go719 = {{&nonterm53, &state720}};
+std::vector<Go> go720 = {{&nonterm54, &state598}};
+std::vector<Go> go724 = {{&nonterm51, &state725}};
+std::vector<Go> go725 = {{&nonterm52, &state585}};
+std::vector<Go> go729 = {{&nonterm49, &state730}};
+std::vector<Go> go730 = {{&nonterm50, &state572}};
+std::vector<Go> go734 = {{&nonterm47, &state735}};
+std::vector<Go> go735 = {{&nonterm48, &state559}};
+std::vector<Go> go739 = {{&nonterm45, &state740}};
+std::vector<Go> go740 = {{&nonterm46, &state546}};
+std::vector<Go> go744 = {{&nonterm43, &state745}};
+std::vector<Go> go745 = {{&nonterm44, &state533}};
+std::vector<Go> go749 = {{&nonterm41, &state750}};
+std::vector<Go> go750 = {{&nonterm42, &state520}};
+std::vector<Go> go754 = {{&nonterm39, &state755}};
+std::vector<Go> go755 = {{&nonterm40, &state507}};
+std::vector<Go> go759 = {{&nonterm37, &state760}};
+std::vector<Go> go760 = {{&nonterm38, &state494}};
+std::vector<Go> go764 = {{&nonterm35, &state765}};
+std::vector<Go> go765 = {{&nonterm36, &state481}};
+std::vector<Go> go769 = {{&nonterm33, &state770}};
+std::vector<Go> go770 = {{&nonterm34, &state468}};
+std::vector<Go> go774 = {{&nonterm31, &state775}};
+std::vector<Go> go775 = {{&nonterm32, &state455}};
+std::vector<Go> go779 = {{&nonterm29, &state780}};
+std::vector<Go> go780 = {{&nonterm30, &state442}};
+std::vector<Go> go784 = {{&nonterm27, &state785}};
+std::vector<Go> go785 = {{&nonterm28, &state429}};
+std::vector<Go> go789 = {{&nonterm25, &state790}};
+std::vector<Go> go790 = {{&nonterm26, &state416}};
+std::vector<Go> go794 = {{&nonterm23, &state795}};
+std::vector<Go> go795 = {{&nonterm24, &state403}};
+std::vector<Go> go799 = {{&nonterm21, &state800}};
+std::vector<Go> go800 = {{&nonterm22, &state390}};
+std::vector<Go> go804 = {{&nonterm19, &state805}};
+std::vector<Go> go805 = {{&nonterm20, &state377}};
+std::vector<Go> go809 = {{&nonterm17, &state810}};
+std::vector<Go> go810 = {{&nonterm18, &state364}};
+std::vector<Go> go814 = {{&nonterm15, &state815}};
+std::vector<Go> go815 = {{&nonterm16, &state351}};
+std::vector<Go> go819 = {{&nonterm13, &state820}};
+std::vector<Go> go820 = {{&nonterm14, &state338}};
+std::vector<Go> go824 = {{&nonterm11, &state825}};
+std::vector<Go> go825 = {{&nonterm12, &state325}};
+std::vector<Go> go829 = {{&nonterm9, &state830}};
+std::vector<Go> go830 = {{&nonterm10, &state312}};
+std::vector<Go> go834 = {{&nonterm7, &state835}};
+std::vector<Go> go835 = {{&nonterm8, &state299}};
+std::vector<Go> go839 = {{&nonterm5, &state840}};
+std::vector<Go> go840 = {{&nonterm6, &state286}};
+std::vector<Go> go844 = {{&nonterm3, &state845}};
+std::vector<Go> go845 = {{&nonterm4, &state273}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, &go7};
+State state8 = {&shift8, &reduce8, &go8};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, &go15};
+State state16 = {&shift16, &reduce16, &go16};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, &go23};
+State state24 = {&shift24, &reduce24, &go24};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, &go31};
+State state32 = {&shift32, &reduce32, &go32};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, &go39};
+State state40 = {&shift40, &reduce40, &go40};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, &go47};
+State state48 = {&shift48, &reduce48, &go48};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, &go55};
+State state56 = {&shift56, &reduce56, &go56};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, &go63};
+State state64 = {&shift64, &reduce64, &go64};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, &go71};
+State state72 = {&shift72, &reduce72, &go72};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, &go79};
+State state80 = {&shift80, &reduce80, &go80};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, &go87};
+State state88 = {&shift88, &reduce88, &go88};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, &go95};
+State state96 = {&shift96, &reduce96, &go96};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, &go103};
+State state104 = {&shift104, &reduce104, &go104};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, &go111};
+State state112 = {&shift112, &reduce112, &go112};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, &go119};
+State state120 = {&shift120, &reduce120, &go120};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, &go127};
+State state128 = {&shift128, &reduce128, &go128};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, &go135};
+State state136 = {&shift136, &reduce136, &go136};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift140, &reduce140, nullptr};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, &go143};
+State state144 = {&shift144, &reduce144, &go144};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift146, &reduce146, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift148, &reduce148, nullptr};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift150, &reduce150, nullptr};
+State state151 = {&shift151, &reduce151, &go151};
+State state152 = {&shift152, &reduce152, &go152};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift154, &reduce154, nullptr};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift158, &reduce158, nullptr};
+State state159 = {&shift159, &reduce159, &go159};
+State state160 = {&shift160, &reduce160, &go160};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift162, &reduce162, nullptr};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift166, &reduce166, nullptr};
+State state167 = {&shift167, &reduce167, &go167};
+State state168 = {&shift168, &reduce168, &go168};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift172, &reduce172, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift175, &reduce175, &go175};
+State state176 = {&shift176, &reduce176, &go176};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift180, &reduce180, nullptr};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, &go183};
+State state184 = {&shift184, &reduce184, &go184};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift188, &reduce188, nullptr};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, &go191};
+State state192 = {&shift192, &reduce192, &go192};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift199, &reduce199, &go199};
+State state200 = {&shift200, &reduce200, &go200};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift202, &reduce202, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, &go207};
+State state208 = {&shift208, &reduce208, &go208};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, &go215};
+State state216 = {&shift216, &reduce216, &go216};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, &go223};
+State state224 = {&shift224, &reduce224, &go224};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, &go231};
+State state232 = {&shift232, &reduce232, &go232};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, &go239};
+State state240 = {&shift240, &reduce240, &go240};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, &go247};
+State state248 = {&shift248, &reduce248, &go248};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift0, &reduce0, &go255};
+State state256 = {&shift256, &reduce256, &go256};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift4, &reduce4, nullptr};
+State state261 = {&shift5, &reduce5, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift7, &reduce7, &go263};
+State state264 = {&shift264, &reduce264, &go264};
+State state265 = {&shift11, &reduce11, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift7, &reduce7, &go268};
+State state269 = {&shift269, &reduce269, &go269};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift272, &reduce272, nullptr};
+State state273 = {&shift12, &reduce12, nullptr};
+State state274 = {&shift13, &reduce13, nullptr};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift15, &reduce15, &go276};
+State state277 = {&shift277, &reduce277, &go277};
+State state278 = {&shift19, &reduce19, nullptr};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift280, &reduce280, nullptr};
+State state281 = {&shift15, &reduce15, &go281};
+State state282 = {&shift282, &reduce282, &go282};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, nullptr};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift20, &reduce20, nullptr};
+State state287 = {&shift21, &reduce21, nullptr};
+State state288 = {&shift288, &reduce288, nullptr};
+State state289 = {&shift23, &reduce23, &go289};
+State state290 = {&shift290, &reduce290, &go290};
+State state291 = {&shift27, &reduce27, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift23, &reduce23, &go294};
+State state295 = {&shift295, &reduce295, &go295};
+State state296 = {&shift296, &reduce296, nullptr};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift28, &reduce28, nullptr};
+State state300 = {&shift29, &reduce29, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift31, &reduce31, &go302};
+State state303 = {&shift303, &reduce303, &go303};
+State state304 = {&shift35, &reduce35, nullptr};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift31, &reduce31, &go307};
+State state308 = {&shift308, &reduce308, &go308};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift36, &reduce36, nullptr};
+State state313 = {&shift37, &reduce37, nullptr};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift39, &reduce39, &go315};
+State state316 = {&shift316, &reduce316, &go316};
+State state317 = {&shift43, &reduce43, nullptr};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift39, &reduce39, &go320};
+State state321 = {&shift321, &reduce321, &go321};
+State state322 = {&shift322, &reduce322, nullptr};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift44, &reduce44, nullptr};
+State state326 = {&shift45, &reduce45, nullptr};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift47, &reduce47, &go328};
+State state329 = {&shift329, &reduce329, &go329};
+State state330 = {&shift51, &reduce51, nullptr};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift47, &reduce47, &go333};
+State state334 = {&shift334, &reduce334, &go334};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift336, &reduce336, nullptr};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift52, &reduce52, nullptr};
+State state339 = {&shift53, &reduce53, nullptr};
+State state340 = {&shift340, &reduce340, nullptr};
+State state341 = {&shift55, &reduce55, &go341};
+State state342 = {&shift342, &reduce342, &go342};
+State state343 = {&shift59, &reduce59, nullptr};
+State state344 = {&shift344, &reduce344, nullptr};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift55, &reduce55, &go346};
+State state347 = {&shift347, &reduce347, &go347};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift60, &reduce60, nullptr};
+State state352 = {&shift61, &reduce61, nullptr};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift63, &reduce63, &go354};
+State state355 = {&shift355, &reduce355, &go355};
+State state356 = {&shift67, &reduce67, nullptr};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift358, &reduce358, nullptr};
+State state359 = {&shift63, &reduce63, &go359};
+State state360 = {&shift360, &reduce360, &go360};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift362, &reduce362, nullptr};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift68, &reduce68, nullptr};
+State state365 = {&shift69, &reduce69, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift71, &reduce71, &go367};
+State state368 = {&shift368, &reduce368, &go368};
+State state369 = {&shift75, &reduce75, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift71, &reduce71, &go372};
+State state373 = {&shift373, &reduce373, &go373};
+State state374 = {&shift374, &reduce374, nullptr};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift376, &reduce376, nullptr};
+State state377 = {&shift76, &reduce76, nullptr};
+State state378 = {&shift77, &reduce77, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift79, &reduce79, &go380};
+State state381 = {&shift381, &reduce381, &go381};
+State state382 = {&shift83, &reduce83, nullptr};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift384, &reduce384, nullptr};
+State state385 = {&shift79, &reduce79, &go385};
+State state386 = {&shift386, &reduce386, &go386};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift84, &reduce84, nullptr};
+State state391 = {&shift85, &reduce85, nullptr};
+State state392 = {&shift392, &reduce392, nullptr};
+State state393 = {&shift87, &reduce87, &go393};
+State state394 = {&shift394, &reduce394, &go394};
+State state395 = {&shift91, &reduce91, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift87, &reduce87, &go398};
+State state399 = {&shift399, &reduce399, &go399};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift92, &reduce92, nullptr};
+State state404 = {&shift93, &reduce93, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift95, &reduce95, &go406};
+State state407 = {&shift407, &reduce407, &go407};
+State state408 = {&shift99, &reduce99, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift95, &reduce95, &go411};
+State state412 = {&shift412, &reduce412, &go412};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift100, &reduce100, nullptr};
+State state417 = {&shift101, &reduce101, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift103, &reduce103, &go419};
+State state420 = {&shift420, &reduce420, &go420};
+State state421 = {&shift107, &reduce107, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift103, &reduce103, &go424};
+State state425 = {&shift425, &reduce425, &go425};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift108, &reduce108, nullptr};
+State state430 = {&shift109, &reduce109, nullptr};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift111, &reduce111, &go432};
+State state433 = {&shift433, &reduce433, &go433};
+State state434 = {&shift115, &reduce115, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift111, &reduce111, &go437};
+State state438 = {&shift438, &reduce438, &go438};
+State state439 = {&shift439, &reduce439, nullptr};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift116, &reduce116, nullptr};
+State state443 = {&shift117, &reduce117, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift119, &reduce119, &go445};
+State state446 = {&shift446, &reduce446, &go446};
+State state447 = {&shift123, &reduce123, nullptr};
+State state448 = {&shift448, &reduce448, nullptr};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift119, &reduce119, &go450};
+State state451 = {&shift451, &reduce451, &go451};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift124, &reduce124, nullptr};
+State state456 = {&shift125, &reduce125, nullptr};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift127, &reduce127, &go458};
+State state459 = {&shift459, &reduce459, &go459};
+State state460 = {&shift131, &reduce131, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift127, &reduce127, &go463};
+State state464 = {&shift464, &reduce464, &go464};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift132, &reduce132, nullptr};
+State state469 = {&shift133, &reduce133, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift135, &reduce135, &go471};
+State state472 = {&shift472, &reduce472, &go472};
+State state473 = {&shift139, &reduce139, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift135, &reduce135, &go476};
+State state477 = {&shift477, &reduce477, &go477};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, nullptr};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift140, &reduce140, nullptr};
+State state482 = {&shift141, &reduce141, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift143, &reduce143, &go484};
+State state485 = {&shift485, &reduce485, &go485};
+State state486 = {&shift147, &reduce147, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift488, &reduce488, nullptr};
+State state489 = {&shift143, &reduce143, &go489};
+State state490 = {&shift490, &reduce490, &go490};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift148, &reduce148, nullptr};
+State state495 = {&shift149, &reduce149, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift151, &reduce151, &go497};
+State state498 = {&shift498, &reduce498, &go498};
+State state499 = {&shift155, &reduce155, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift151, &reduce151, &go502};
+State state503 = {&shift503, &reduce503, &go503};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift156, &reduce156, nullptr};
+State state508 = {&shift157, &reduce157, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift159, &reduce159, &go510};
+State state511 = {&shift511, &reduce511, &go511};
+State state512 = {&shift163, &reduce163, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift159, &reduce159, &go515};
+State state516 = {&shift516, &reduce516, &go516};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift164, &reduce164, nullptr};
+State state521 = {&shift165, &reduce165, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift167, &reduce167, &go523};
+State state524 = {&shift524, &reduce524, &go524};
+State state525 = {&shift171, &reduce171, nullptr};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift167, &reduce167, &go528};
+State state529 = {&shift529, &reduce529, &go529};
+State state530 = {&shift530, &reduce530, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift532, &reduce532, nullptr};
+State state533 = {&shift172, &reduce172, nullptr};
+State state534 = {&shift173, &reduce173, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift175, &reduce175, &go536};
+State state537 = {&shift537, &reduce537, &go537};
+State state538 = {&shift179, &reduce179, nullptr};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift175, &reduce175, &go541};
+State state542 = {&shift542, &reduce542, &go542};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift545, &reduce545, nullptr};
+State state546 = {&shift180, &reduce180, nullptr};
+State state547 = {&shift181, &reduce181, nullptr};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift183, &reduce183, &go549};
+State state550 = {&shift550, &reduce550, &go550};
+State state551 = {&shift187, &reduce187, nullptr};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift183, &reduce183, &go554};
+State state555 = {&shift555, &reduce555, &go555};
+State state556 = {&shift556, &reduce556, nullptr};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift558, &reduce558, nullptr};
+State state559 = {&shift188, &reduce188, nullptr};
+State state560 = {&shift189, &reduce189, nullptr};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift191, &reduce191, &go562};
+State state563 = {&shift563, &reduce563, &go563};
+State state564 = {&shift195, &reduce195, nullptr};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift191, &reduce191, &go567};
+State state568 = {&shift568, &reduce568, &go568};
+State state569 = {&shift569, &reduce569, nullptr};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift196, &reduce196, nullptr};
+State state573 = {&shift197, &reduce197, nullptr};
+State state574 = {&shift574, &reduce574, nullptr};
+State state575 = {&shift199, &reduce199, &go575};
+State state576 = {&shift576, &reduce576, &go576};
+State state577 = {&shift203, &reduce203, nullptr};
+State state578 = {&shift578, &reduce578, nullptr};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift199, &reduce199, &go580};
+State state581 = {&shift581, &reduce581, &go581};
+State state582 = {&shift582, &reduce582, nullptr};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift584, &reduce584, nullptr};
+State state585 = {&shift204, &reduce204, nullptr};
+State state586 = {&shift205, &reduce205, nullptr};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift207, &reduce207, &go588};
+State state589 = {&shift589, &reduce589, &go589};
+State state590 = {&shift211, &reduce211, nullptr};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift592, &reduce592, nullptr};
+State state593 = {&shift207, &reduce207, &go593};
+State state594 = {&shift594, &reduce594, &go594};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift596, &reduce596, nullptr};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift212, &reduce212, nullptr};
+State state599 = {&shift213, &reduce213, nullptr};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift215, &reduce215, &go601};
+State state602 = {&shift602, &reduce602, &go602};
+State state603 = {&shift219, &reduce219, nullptr};
+State state604 = {&shift604, &reduce604, nullptr};
+State state605 = {&shift605, &reduce605, nullptr};
+State state606 = {&shift215, &reduce215, &go606};
+State state607 = {&shift607, &reduce607, &go607};
+State state608 = {&shift608, &reduce608, nullptr};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift610, &reduce610, nullptr};
+State state611 = {&shift220, &reduce220, nullptr};
+State state612 = {&shift221, &reduce221, nullptr};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift223, &reduce223, &go614};
+State state615 = {&shift615, &reduce615, &go615};
+State state616 = {&shift227, &reduce227, nullptr};
+State state617 = {&shift617, &reduce617, nullptr};
+State state618 = {&shift618, &reduce618, nullptr};
+State state619 = {&shift223, &reduce223, &go619};
+State state620 = {&shift620, &reduce620, &go620};
+State state621 = {&shift621, &reduce621, nullptr};
+State state622 = {&shift622, &reduce622, nullptr};
+State state623 = {&shift623, &reduce623, nullptr};
+State state624 = {&shift228, &reduce228, nullptr};
+State state625 = {&shift229, &reduce229, nullptr};
+State state626 = {&shift626, &reduce626, nullptr};
+State state627 = {&shift231, &reduce231, &go627};
+State state628 = {&shift628, &reduce628, &go628};
+State state629 = {&shift235, &reduce235, nullptr};
+State state630 = {&shift630, &reduce630, nullptr};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift231, &reduce231, &go632};
+State state633 = {&shift633, &reduce633, &go633};
+State state634 = {&shift634, &reduce634, nullptr};
+State state635 = {&shift635, &reduce635, nullptr};
+State state636 = {&shift636, &reduce636, nullptr};
+State state637 = {&shift236, &reduce236, nullptr};
+State state638 = {&shift237, &reduce237, nullptr};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift239, &reduce239, &go640};
+State state641 = {&shift641, &reduce641, &go641};
+State state642 = {&shift243, &reduce243, nullptr};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift644, &reduce644, nullptr};
+State state645 = {&shift239, &reduce239, &go645};
+State state646 = {&shift646, &reduce646, &go646};
+State state647 = {&shift647, &reduce647, nullptr};
+State state648 = {&shift648, &reduce648, nullptr};
+State state649 = {&shift649, &reduce649, nullptr};
+State state650 = {&shift244, &reduce244, nullptr};
+State state651 = {&shift245, &reduce245, nullptr};
+State state652 = {&shift652, &reduce652, nullptr};
+State state653 = {&shift247, &reduce247, &go653};
+State state654 = {&shift654, &reduce654, &go654};
+State state655 = {&shift251, &reduce251, nullptr};
+State state656 = {&shift656, &reduce656, nullptr};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift247, &reduce247, &go658};
+State state659 = {&shift659, &reduce659, &go659};
+State state660 = {&shift660, &reduce660, nullptr};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift662, &reduce662, nullptr};
+State state663 = {&shift252, &reduce252, nullptr};
+State state664 = {&shift253, &reduce253, nullptr};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift0, &reduce0, &go666};
+State state667 = {&shift667, &reduce667, &go667};
+State state668 = {&shift259, &reduce259, nullptr};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift670, &reduce670, nullptr};
+State state671 = {&shift0, &reduce0, &go671};
+State state672 = {&shift672, &reduce672, &go672};
+State state673 = {&shift673, &reduce673, nullptr};
+State state674 = {&shift674, &reduce674, nullptr};
+State state675 = {&shift675, &reduce675, nullptr};
+State state676 = {&shift4, &reduce4, nullptr};
+State state677 = {&shift5, &reduce5, nullptr};
+State state678 = {&shift678, &reduce678, nullptr};
+State state679 = {&shift7, &reduce7, &go679};
+State state680 = {&shift680, &reduce680, &go680};
+State state681 = {&shift11, &reduce11, nullptr};
+State state682 = {&shift682, &reduce682, nullptr};
+State state683 = {&shift267, &reduce267, nullptr};
+State state684 = {&shift7, &reduce7, &go684};
+State state685 = {&shift685, &reduce685, &go685};
+State state686 = {&shift272, &reduce272, nullptr};
+State state687 = {&shift687, &reduce687, nullptr};
+State state688 = {&shift670, &reduce670, nullptr};
+State state689 = {&shift0, &reduce0, &go689};
+State state690 = {&shift690, &reduce690, &go690};
+State state691 = {&shift675, &reduce675, nullptr};
+State state692 = {&shift692, &reduce692, nullptr};
+State state693 = {&shift657, &reduce657, nullptr};
+State state694 = {&shift247, &reduce247, &go694};
+State state695 = {&shift695, &reduce695, &go695};
+State state696 = {&shift662, &reduce662, nullptr};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift644, &reduce644, nullptr};
+State state699 = {&shift239, &reduce239, &go699};
+State state700 = {&shift700, &reduce700, &go700};
+State state701 = {&shift649, &reduce649, nullptr};
+State state702 = {&shift702, &reduce702, nullptr};
+State state703 = {&shift631, &reduce631, nullptr};
+State state704 = {&shift231, &reduce231, &go704};
+State state705 = {&shift705, &reduce705, &go705};
+State state706 = {&shift636, &reduce636, nullptr};
+State state707 = {&shift707, &reduce707, nullptr};
+State state708 = {&shift618, &reduce618, nullptr};
+State state709 = {&shift223, &reduce223, &go709};
+State state710 = {&shift710, &reduce710, &go710};
+State state711 = {&shift623, &reduce623, nullptr};
+State state712 = {&shift712, &reduce712, nullptr};
+State state713 = {&shift605, &reduce605, nullptr};
+State state714 = {&shift215, &reduce215, &go714};
+State state715 = {&shift715, &reduce715, &go715};
+State state716 = {&shift610, &reduce610, nullptr};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift592, &reduce592, nullptr};
+State state719 = {&shift207, &reduce207, &go719};
+State state720 = {&shift720, &reduce720, &go720};
+State state721 = {&shift597, &reduce597, nullptr};
+State state722 = {&shift722, &reduce722, nullptr};
+State state723 = {&shift579, &reduce579, nullptr};
+State state724 = {&shift199, &reduce199, &go724};
+State state725 = {&shift725, &reduce725, &go725};
+State state726 = {&shift584, &reduce584, nullptr};
+State state727 = {&shift727, &reduce727, nullptr};
+State state728 = {&shift566, &reduce566, nullptr};
+State state729 = {&shift191, &reduce191, &go729};
+State state730 = {&shift730, &reduce730, &go730};
+State state731 = {&shift571, &reduce571, nullptr};
+State state732 = {&shift732, &reduce732, nullptr};
+State state733 = {&shift553, &reduce553, nullptr};
+State state734 = {&shift183, &reduce183, &go734};
+State state735 = {&shift735, &reduce735, &go735};
+State state736 = {&shift558, &reduce558, nullptr};
+State state737 = {&shift737, &reduce737, nullptr};
+State state738 = {&shift540, &reduce540, nullptr};
+State state739 = {&shift175, &reduce175, &go739};
+State state740 = {&shift740, &reduce740, &go740};
+State state741 = {&shift545, &reduce545, nullptr};
+State state742 = {&shift742, &reduce742, nullptr};
+State state743 = {&shift527, &reduce527, nullptr};
+State state744 = {&shift167, &reduce167, &go744};
+State state745 = {&shift745, &reduce745, &go745};
+State state746 = {&shift532, &reduce532, nullptr};
+State state747 = {&shift747, &reduce747, nullptr};
+State state748 = {&shift514, &reduce514, nullptr};
+State state749 = {&shift159, &reduce159, &go749};
+State state750 = {&shift750, &reduce750, &go750};
+State state751 = {&shift519, &reduce519, nullptr};
+State state752 = {&shift752, &reduce752, nullptr};
+State state753 = {&shift501, &reduce501, nullptr};
+State state754 = {&shift151, &reduce151, &go754};
+State state755 = {&shift755, &reduce755, &go755};
+State state756 = {&shift506, &reduce506, nullptr};
+State state757 = {&shift757, &reduce757, nullptr};
+State state758 = {&shift488, &reduce488, nullptr};
+State state759 = {&shift143, &reduce143, &go759};
+State state760 = {&shift760, &reduce760, &go760};
+State state761 = {&shift493, &reduce493, nullptr};
+State state762 = {&shift762, &reduce762, nullptr};
+State state763 = {&shift475, &reduce475, nullptr};
+State state764 = {&shift135, &reduce135, &go764};
+State state765 = {&shift765, &reduce765, &go765};
+State state766 = {&shift480, &reduce480, nullptr};
+State state767 = {&shift767, &reduce767, nullptr};
+State state768 = {&shift462, &reduce462, nullptr};
+State state769 = {&shift127, &reduce127, &go769};
+State state770 = {&shift770, &reduce770, &go770};
+State state771 = {&shift467, &reduce467, nullptr};
+State state772 = {&shift772, &reduce772, nullptr};
+State state773 = {&shift449, &reduce449, nullptr};
+State state774 = {&shift119, &reduce119, &go774};
+State state775 = {&shift775, &reduce775, &go775};
+State state776 = {&shift454, &reduce454, nullptr};
+State state777 = {&shift777, &reduce777, nullptr};
+State state778 = {&shift436, &reduce436, nullptr};
+State state779 = {&shift111, &reduce111, &go779};
+State state780 = {&shift780, &reduce780, &go780};
+State state781 = {&shift441, &reduce441, nullptr};
+State state782 = {&shift782, &reduce782, nullptr};
+State state783 = {&shift423, &reduce423, nullptr};
+State state784 = {&shift103, &reduce103, &go784};
+State state785 = {&shift785, &reduce785, &go785};
+State state786 = {&shift428, &reduce428, nullptr};
+State state787 = {&shift787, &reduce787, nullptr};
+State state788 = {&shift410, &reduce410, nullptr};
+State state789 = {&shift95, &reduce95, &go789};
+State state790 = {&shift790, &reduce790, &go790};
+State state791 = {&shift415, &reduce415, nullptr};
+State state792 = {&shift792, &reduce792, nullptr};
+State state793 = {&shift397, &reduce397, nullptr};
+State state794 = {&shift87, &reduce87, &go794};
+State state795 = {&shift795, &reduce795, &go795};
+State state796 = {&shift402, &reduce402, nullptr};
+State state797 = {&shift797, &reduce797, nullptr};
+State state798 = {&shift384, &reduce384, nullptr};
+State state799 = {&shift79, &reduce79, &go799};
+State state800 = {&shift800, &reduce800, &go800};
+State state801 = {&shift389, &reduce389, nullptr};
+State state802 = {&shift802, &reduce802, nullptr};
+State state803 = {&shift371, &reduce371, nullptr};
+State state804 = {&shift71, &reduce71, &go804};
+State state805 = {&shift805, &reduce805, &go805};
+State state806 = {&shift376, &reduce376, nullptr};
+State state807 = {&shift807, &reduce807, nullptr};
+State state808 = {&shift358, &reduce358, nullptr};
+State state809 = {&shift63, &reduce63, &go809};
+State state810 = {&shift810, &reduce810, &go810};
+State state811 = {&shift363, &reduce363, nullptr};
+State state812 = {&shift812, &reduce812, nullptr};
+State state813 = {&shift345, &reduce345, nullptr};
+State state814 = {&shift55, &reduce55, &go814};
+State state815 = {&shift815, &reduce815, &go815};
+State state816 = {&shift350, &reduce350, nullptr};
+State state817 = {&shift817, &reduce817, nullptr};
+State state818 = {&shift332, &reduce332, nullptr};
+State state819 = {&shift47, &reduce47, &go819};
+State state820 = {&shift820, &reduce820, &go820};
+State state821 = {&shift337, &reduce337, nullptr};
+State state822 = {&shift822, &reduce822, nullptr};
+State state823 = {&shift319, &reduce319, nullptr};
+State state824 = {&shift39, &reduce39, &go824};
+State state825 = {&shift825, &reduce825, &go825};
+State state826 = {&shift324, &reduce324, nullptr};
+State state827 = {&shift827, &reduce827, nullptr};
+State state828 = {&shift306, &reduce306, nullptr};
+State state829 = {&shift31, &reduce31, &go829};
+State state830 = {&shift830, &reduce830, &go830};
+State state831 = {&shift311, &reduce311, nullptr};
+State state832 = {&shift832, &reduce832, nullptr};
+State state833 = {&shift293, &reduce293, nullptr};
+State state834 = {&shift23, &reduce23, &go834};
+State state835 = {&shift835, &reduce835, &go835};
+State state836 = {&shift298, &reduce298, nullptr};
+State state837 = {&shift837, &reduce837, nullptr};
+State state838 = {&shift280, &reduce280, nullptr};
+State state839 = {&shift15, &reduce15, &go839};
+State state840 = {&shift840, &reduce840, &go840};
+State state841 = {&shift285, &reduce285, nullptr};
+State state842 = {&shift842, &reduce842, nullptr};
+State state843 = {&shift267, &reduce267, nullptr};
+State state844 = {&shift7, &reduce7, &go844};
+State state845 = {&shift845, &reduce845, &go845};
+State state846 = {&shift272, &reduce272, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,11599 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ba", false, 0};
+Symbol term1 = {"bb", false, 1};
+Symbol term2 = {"bc", false, 2};
+Symbol term3 = {"bd", false, 3};
+Symbol term4 = {"be", false, 4};
+Symbol term5 = {"bf", false, 5};
+Symbol term6 = {"bg", false, 6};
+Symbol term7 = {"bh", false, 7};
+Symbol term8 = {"bi", false, 8};
+Symbol term9 = {"bj", false, 9};
+Symbol term10 = {"bk", false, 10};
+Symbol term11 = {"bl", false, 11};
+Symbol term12 = {"bm", false, 12};
+Symbol term13 = {"bn", false, 13};
+Symbol term14 = {"bo", false, 14};
+Symbol term15 = {"bp", false, 15};
+Symbol term16 = {"bq", false, 16};
+Symbol term17 = {"br", false, 17};
+Symbol term18 = {"bs", false, 18};
+Symbol term19 = {"bt", false, 19};
+Symbol term20 = {"bu", false, 20};
+Symbol term21 = {"bv", false, 21};
+Symbol term22 = {"bw", false, 22};
+Symbol term23 = {"bx", false, 23};
+Symbol term24 = {"by", false, 24};
+Symbol term25 = {"bz", false, 25};
+Symbol term26 = {"bab", false, 26};
+Symbol term27 = {"bbb", false, 27};
+Symbol term28 = {"bcb", false, 28};
+Symbol term29 = {"bdb", false, 29};
+Symbol term30 = {"beb", false, 30};
+Symbol term31 = {"bfb", false, 31};
+Symbol term32 = {"bgb", false, 32};
+Symbol term33 = {"bhb", false, 33};
+Symbol term34 = {"bib", false, 34};
+Symbol term35 = {"bjb", false, 35};
+Symbol term36 = {"bkb", false, 36};
+Symbol term37 = {"blb", false, 37};
+Symbol term38 = {"bmb", false, 38};
+Symbol term39 = {"bnb", false, 39};
+Symbol term40 = {"bob", false, 40};
+Symbol term41 = {"bpb", false, 41};
+Symbol term42 = {"bqb", false, 42};
+Symbol term43 = {"brb", false, 43};
+Symbol term44 = {"bsb", false, 44};
+Symbol term45 = {"btb", false, 45};
+Symbol term46 = {"bub", false, 46};
+Symbol term47 = {"bvb", false, 47};
+Symbol term48 = {"bwb", false, 48};
+Symbol term49 = {"bxb", false, 49};
+Symbol term50 = {"byb", false, 50};
+Symbol term51 = {"bzb", false, 51};
+Symbol term52 = {"bac", false, 52};
+Symbol term53 = {"bbc", false, 53};
+Symbol term54 = {"bcc", false, 54};
+Symbol term55 = {"bdc", false, 55};
+Symbol term56 = {"bec", false, 56};
+Symbol term57 = {"bfc", false, 57};
+Symbol term58 = {"bgc", false, 58};
+Symbol term59 = {"bhc", false, 59};
+Symbol term60 = {"bic", false, 60};
+Symbol term61 = {"bjc", false, 61};
+Symbol term62 = {"bkc", false, 62};
+Symbol term63 = {"blc", false, 63};
+Symbol term64 = {"num", true, 64};
+Symbol term65 = {"ws", true, 65};
+Symbol term66 = {"id", false, 66};
+Symbol term67 = {";", false, 67};
+Symbol term68 = {"=", false, 68};
+Symbol term69 = {"{", false, 69};
+Symbol term70 = {"}", false, 70};
+Symbol term71 = {"(", false, 71};
+Symbol term72 = {")", false, 72};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 8, 8, 8, 8, 8,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 11, 12, 13, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 45 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node8; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    if (k == 41) { return &node9; }
+    if (k == 43) { return &node10; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 9) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node19; }
+    if (k == 24) { return &node20; }
+    if (k == 25) { return &node21; }
+    if (k == 26) { return &node22; }
+    if (k == 27) { return &node23; }
+    if (k == 28) { return &node24; }
+    if (k == 29) { return &node25; }
+    if (k == 30) { return &node26; }
+    if (k == 31) { return &node27; }
+    if (k == 32) { return &node28; }
+    if (k == 33) { return &node29; }
+    if (k == 34) { return &node30; }
+    if (k == 35) { return &node31; }
+    if (k == 36) { return &node32; }
+    if (k == 37) { return &node33; }
+    if (k == 38) { return &node34; }
+    if (k == 39) { return &node35; }
+    if (k == 40) { return &node36; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node73; }
+    if (k == 17) { return &node74; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node71; }
+    if (k == 17) { return &node72; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node69; }
+    if (k == 17) { return &node70; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node67; }
+    if (k == 17) { return &node68; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node65; }
+    if (k == 17) { return &node66; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node63; }
+    if (k == 17) { return &node64; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node61; }
+    if (k == 17) { return &node62; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node59; }
+    if (k == 17) { return &node60; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node57; }
+    if (k == 17) { return &node58; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node55; }
+    if (k == 17) { return &node56; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node53; }
+    if (k == 17) { return &node54; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node51; }
+    if (k == 17) { return &node52; }
+    if ((k >= 18) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node50; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node49; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node48; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node47; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node46; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node45; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node44; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node43; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node42; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node41; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node40; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node39; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node38; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node37; }
+    if ((k >= 17) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next62(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next63(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next64(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next65(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next66(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next67(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next68(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next69(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next70(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next71(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next72(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next73(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next74(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 40)) { return &node7; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term65, nullptr};
+Node node2 = {nullptr, &term71, nullptr};
+Node node3 = {nullptr, &term72, nullptr};
+Node node4 = {&next4, &term64, nullptr};
+Node node5 = {nullptr, &term67, nullptr};
+Node node6 = {nullptr, &term68, nullptr};
+Node node7 = {&next7, &term66, nullptr};
+Node node8 = {&next8, &term66, nullptr};
+Node node9 = {nullptr, &term69, nullptr};
+Node node10 = {nullptr, &term70, nullptr};
+Node node11 = {&next11, &term0, nullptr};
+Node node12 = {&next12, &term1, nullptr};
+Node node13 = {&next13, &term2, nullptr};
+Node node14 = {&next14, &term3, nullptr};
+Node node15 = {&next15, &term4, nullptr};
+Node node16 = {&next16, &term5, nullptr};
+Node node17 = {&next17, &term6, nullptr};
+Node node18 = {&next18, &term7, nullptr};
+Node node19 = {&next19, &term8, nullptr};
+Node node20 = {&next20, &term9, nullptr};
+Node node21 = {&next21, &term10, nullptr};
+Node node22 = {&next22, &term11, nullptr};
+Node node23 = {&next23, &term12, nullptr};
+Node node24 = {&next24, &term13, nullptr};
+Node node25 = {&next25, &term14, nullptr};
+Node node26 = {&next26, &term15, nullptr};
+Node node27 = {&next27, &term16, nullptr};
+Node node28 = {&next28, &term17, nullptr};
+Node node29 = {&next29, &term18, nullptr};
+Node node30 = {&next30, &term19, nullptr};
+Node node31 = {&next31, &term20, nullptr};
+Node node32 = {&next32, &term21, nullptr};
+Node node33 = {&next33, &term22, nullptr};
+Node node34 = {&next34, &term23, nullptr};
+Node node35 = {&next35, &term24, nullptr};
+Node node36 = {&next36, &term25, nullptr};
+Node node37 = {&next37, &term51, nullptr};
+Node node38 = {&next38, &term50, nullptr};
+Node node39 = {&next39, &term49, nullptr};
+Node node40 = {&next40, &term48, nullptr};
+Node node41 = {&next41, &term47, nullptr};
+Node node42 = {&next42, &term46, nullptr};
+Node node43 = {&next43, &term45, nullptr};
+Node node44 = {&next44, &term44, nullptr};
+Node node45 = {&next45, &term43, nullptr};
+Node node46 = {&next46, &term42, nullptr};
+Node node47 = {&next47, &term41, nullptr};
+Node node48 = {&next48, &term40, nullptr};
+Node node49 = {&next49, &term39, nullptr};
+Node node50 = {&next50, &term38, nullptr};
+Node node51 = {&next51, &term37, nullptr};
+Node node52 = {&next52, &term63, nullptr};
+Node node53 = {&next53, &term36, nullptr};
+Node node54 = {&next54, &term62, nullptr};
+Node node55 = {&next55, &term35, nullptr};
+Node node56 = {&next56, &term61, nullptr};
+Node node57 = {&next57, &term34, nullptr};
+Node node58 = {&next58, &term60, nullptr};
+Node node59 = {&next59, &term33, nullptr};
+Node node60 = {&next60, &term59, nullptr};
+Node node61 = {&next61, &term32, nullptr};
+Node node62 = {&next62, &term58, nullptr};
+Node node63 = {&next63, &term31, nullptr};
+Node node64 = {&next64, &term57, nullptr};
+Node node65 = {&next65, &term30, nullptr};
+Node node66 = {&next66, &term56, nullptr};
+Node node67 = {&next67, &term29, nullptr};
+Node node68 = {&next68, &term55, nullptr};
+Node node69 = {&next69, &term28, nullptr};
+Node node70 = {&next70, &term54, nullptr};
+Node node71 = {&next71, &term27, nullptr};
+Node node72 = {&next72, &term53, nullptr};
+Node node73 = {&next73, &term26, nullptr};
+Node node74 = {&next74, &term52, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 73};
+Symbol nonterm0 = {"program", false, 0};
+Symbol nonterm1 = {"items0", false, 1};
+Symbol nonterm2 = {"item0", false, 2};
+Symbol nonterm3 = {"items1", false, 3};
+Symbol nonterm4 = {"item1", false, 4};
+Symbol nonterm5 = {"items2", false, 5};
+Symbol nonterm6 = {"item2", false, 6};
+Symbol nonterm7 = {"items3", false, 7};
+Symbol nonterm8 = {"item3", false, 8};
+Symbol nonterm9 = {"items4", false, 9};
+Symbol nonterm10 = {"item4", false, 10};
+Symbol nonterm11 = {"items5", false, 11};
+Symbol nonterm12 = {"item5", false, 12};
+Symbol nonterm13 = {"items6", false, 13};
+Symbol nonterm14 = {"item6", false, 14};
+Symbol nonterm15 = {"items7", false, 15};
+Symbol nonterm16 = {"item7", false, 16};
+Symbol nonterm17 = {"items8", false, 17};
+Symbol nonterm18 = {"item8", false, 18};
+Symbol nonterm19 = {"items9", false, 19};
+Symbol nonterm20 = {"item9", false, 20};
+Symbol nonterm21 = {"items10", false, 21};
+Symbol nonterm22 = {"item10", false, 22};
+Symbol nonterm23 = {"items11", false, 23};
+Symbol nonterm24 = {"item11", false, 24};
+Symbol nonterm25 = {"items12", false, 25};
+Symbol nonterm26 = {"item12", false, 26};
+Symbol nonterm27 = {"items13", false, 27};
+Symbol nonterm28 = {"item13", false, 28};
+Symbol nonterm29 = {"items14", false, 29};
+Symbol nonterm30 = {"item14", false, 30};
+Symbol nonterm31 = {"items15", false, 31};
+Symbol nonterm32 = {"item15", false, 32};
+Symbol nonterm33 = {"items16", false, 33};
+Symbol nonterm34 = {"item16", false, 34};
+Symbol nonterm35 = {"items17", false, 35};
+Symbol nonterm36 = {"item17", false, 36};
+Symbol nonterm37 = {"items18", false, 37};
+Symbol nonterm38 = {"item18", false, 38};
+Symbol nonterm39 = {"items19", false, 39};
+Symbol nonterm40 = {"item19", false, 40};
+Symbol nonterm41 = {"items20", false, 41};
+Symbol nonterm42 = {"item20", false, 42};
+Symbol nonterm43 = {"items21", false, 43};
+Symbol nonterm44 = {"item21", false, 44};
+Symbol nonterm45 = {"items22", false, 45};
+Symbol nonterm46 = {"item22", false, 46};
+Symbol nonterm47 = {"items23", false, 47};
+Symbol nonterm48 = {"item23", false, 48};
+Symbol nonterm49 = {"items24", false, 49};
+Symbol nonterm50 = {"item24", false, 50};
+Symbol nonterm51 = {"items25", false, 51};
+Symbol nonterm52 = {"item25", false, 52};
+Symbol nonterm53 = {"items26", false, 53};
+Symbol nonterm54 = {"item26", false, 54};
+Symbol nonterm55 = {"items27", false, 55};
+Symbol nonterm56 = {"item27", false, 56};
+Symbol nonterm57 = {"items28", false, 57};
+Symbol nonterm58 = {"item28", false, 58};
+Symbol nonterm59 = {"items29", false, 59};
+Symbol nonterm60 = {"item29", false, 60};
+Symbol nonterm61 = {"items30", false, 61};
+Symbol nonterm62 = {"item30", false, 62};
+Symbol nonterm63 = {"items31", false, 63};
+Symbol nonterm64 = {"item31", false, 64};
+Symbol nonterm65 = {"items32", false, 65};
+Symbol nonterm66 = {"item32", false, 66};
+Symbol nonterm67 = {"items33", false, 67};
+Symbol nonterm68 = {"item33", false, 68};
+Symbol nonterm69 = {"items34", false, 69};
+Symbol nonterm70 = {"item34", false, 70};
+Symbol nonterm71 = {"items35", false, 71};
+Symbol nonterm72 = {"item35", false, 72};
+Symbol nonterm73 = {"items36", false, 73};
+Symbol nonterm74 = {"item36", false, 74};
+Symbol nonterm75 = {"items37", false, 75};
+Symbol nonterm76 = {"item37", false, 76};
+Symbol nonterm77 = {"items38", false, 77};
+Symbol nonterm78 = {"item38", false, 78};
+Symbol nonterm79 = {"items39", false, 79};
+Symbol nonterm80 = {"item39", false, 80};
+Symbol nonterm81 = {"items40", false, 81};
+Symbol nonterm82 = {"item40", false, 82};
+Symbol nonterm83 = {"items41", false, 83};
+Symbol nonterm84 = {"item41", false, 84};
+Symbol nonterm85 = {"items42", false, 85};
+Symbol nonterm86 = {"item42", false, 86};
+Symbol nonterm87 = {"items43", false, 87};
+Symbol nonterm88 = {"item43", false, 88};
+Symbol nonterm89 = {"items44", false, 89};
+Symbol nonterm90 = {"item44", false, 90};
+Symbol nonterm91 = {"items45", false, 91};
+Symbol nonterm92 = {"item45", false, 92};
+Symbol nonterm93 = {"items46", false, 93};
+Symbol nonterm94 = {"item46", false, 94};
+Symbol nonterm95 = {"items47", false, 95};
+Symbol nonterm96 = {"item47", false, 96};
+Symbol nonterm97 = {"items48", false, 97};
+Symbol nonterm98 = {"item48", false, 98};
+Symbol nonterm99 = {"items49", false, 99};
+Symbol nonterm100 = {"item49", false, 100};
+Symbol nonterm101 = {"items50", false, 101};
+Symbol nonterm102 = {"item50", false, 102};
+Symbol nonterm103 = {"items51", false, 103};
+Symbol nonterm104 = {"item51", false, 104};
+Symbol nonterm105 = {"items52", false, 105};
+Symbol nonterm106 = {"item52", false, 106};
+Symbol nonterm107 = {"items53", false, 107};
+Symbol nonterm108 = {"item53", false, 108};
+Symbol nonterm109 = {"items54", false, 109};
+Symbol nonterm110 = {"item54", false, 110};
+Symbol nonterm111 = {"items55", false, 111};
+Symbol nonterm112 = {"item55", false, 112};
+Symbol nonterm113 = {"items56", false, 113};
+Symbol nonterm114 = {"item56", false, 114};
+Symbol nonterm115 = {"items57", false, 115};
+Symbol nonterm116 = {"item57", false, 116};
+Symbol nonterm117 = {"items58", false, 117};
+Symbol nonterm118 = {"item58", false, 118};
+Symbol nonterm119 = {"items59", false, 119};
+Symbol nonterm120 = {"item59", false, 120};
+Symbol nonterm121 = {"items60", false, 121};
+Symbol nonterm122 = {"item60", false, 122};
+Symbol nonterm123 = {"items61", false, 123};
+Symbol nonterm124 = {"item61", false, 124};
+Symbol nonterm125 = {"items62", false, 125};
+Symbol nonterm126 = {"item62", false, 126};
+Symbol nonterm127 = {"items63", false, 127};
+Symbol nonterm128 = {"item63", false, 128};
+
+unique_ptr<Tree>
+reduce_program_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_0(Table*);
+
+Value*
+reduce_items0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items0_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_0(Table*);
+
+Value*
+reduce_item0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_1(Table*);
+
+Value*
+reduce_item0_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_0(Table*);
+
+Value*
+reduce_items1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items1_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_0(Table*);
+
+Value*
+reduce_item1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_1(Table*);
+
+Value*
+reduce_item1_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_0(Table*);
+
+Value*
+reduce_items2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items2_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_0(Table*);
+
+Value*
+reduce_item2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_1(Table*);
+
+Value*
+reduce_item2_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_0(Table*);
+
+Value*
+reduce_items3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items3_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_0(Table*);
+
+Value*
+reduce_item3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_1(Table*);
+
+Value*
+reduce_item3_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_0(Table*);
+
+Value*
+reduce_items4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items4_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_0(Table*);
+
+Value*
+reduce_item4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_1(Table*);
+
+Value*
+reduce_item4_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_0(Table*);
+
+Value*
+reduce_items5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items5_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_0(Table*);
+
+Value*
+reduce_item5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_1(Table*);
+
+Value*
+reduce_item5_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_0(Table*);
+
+Value*
+reduce_items6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items6_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_0(Table*);
+
+Value*
+reduce_item6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_1(Table*);
+
+Value*
+reduce_item6_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_0(Table*);
+
+Value*
+reduce_items7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items7_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_0(Table*);
+
+Value*
+reduce_item7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_1(Table*);
+
+Value*
+reduce_item7_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_0(Table*);
+
+Value*
+reduce_items8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items8_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_0(Table*);
+
+Value*
+reduce_item8_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_1(Table*);
+
+Value*
+reduce_item8_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item8_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item8_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item8_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item8_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_0(Table*);
+
+Value*
+reduce_items9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items9_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_0(Table*);
+
+Value*
+reduce_item9_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_1(Table*);
+
+Value*
+reduce_item9_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item9_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item9_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item9_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item9_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_0(Table*);
+
+Value*
+reduce_items10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items10_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_0(Table*);
+
+Value*
+reduce_item10_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_1(Table*);
+
+Value*
+reduce_item10_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item10_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item10_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item10_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item10_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_0(Table*);
+
+Value*
+reduce_items11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items11_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_0(Table*);
+
+Value*
+reduce_item11_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_1(Table*);
+
+Value*
+reduce_item11_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item11_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item11_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item11_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item11_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_0(Table*);
+
+Value*
+reduce_items12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items12_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_0(Table*);
+
+Value*
+reduce_item12_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_1(Table*);
+
+Value*
+reduce_item12_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item12_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item12_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item12_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item12_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_0(Table*);
+
+Value*
+reduce_items13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items13_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_0(Table*);
+
+Value*
+reduce_item13_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_1(Table*);
+
+Value*
+reduce_item13_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item13_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item13_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item13_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item13_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_0(Table*);
+
+Value*
+reduce_items14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items14_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_0(Table*);
+
+Value*
+reduce_item14_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_1(Table*);
+
+Value*
+reduce_item14_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item14_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item14_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item14_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item14_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_0(Table*);
+
+Value*
+reduce_items15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items15_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_0(Table*);
+
+Value*
+reduce_item15_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_1(Table*);
+
+Value*
+reduce_item15_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item15_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item15_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item15_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item15_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items16_0(Table*);
+
+Value*
+reduce_items16_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items16_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items16_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items16_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_0(Table*);
+
+Value*
+reduce_item16_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item16_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_1(Table*);
+
+Value*
+reduce_item16_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item16_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item16_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item16_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item16_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item16_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item16_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items17_0(Table*);
+
+Value*
+reduce_items17_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items17_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items17_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items17_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_0(Table*);
+
+Value*
+reduce_item17_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item17_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_1(Table*);
+
+Value*
+reduce_item17_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item17_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item17_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item17_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item17_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item17_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item17_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items18_0(Table*);
+
+Value*
+reduce_items18_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items18_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items18_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items18_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_0(Table*);
+
+Value*
+reduce_item18_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item18_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_1(Table*);
+
+Value*
+reduce_item18_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item18_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item18_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item18_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item18_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item18_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item18_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items19_0(Table*);
+
+Value*
+reduce_items19_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items19_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items19_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items19_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_0(Table*);
+
+Value*
+reduce_item19_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item19_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_1(Table*);
+
+Value*
+reduce_item19_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item19_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item19_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item19_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item19_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item19_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item19_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items20_0(Table*);
+
+Value*
+reduce_items20_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items20_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items20_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items20_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_0(Table*);
+
+Value*
+reduce_item20_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item20_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_1(Table*);
+
+Value*
+reduce_item20_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item20_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item20_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item20_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item20_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item20_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item20_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items21_0(Table*);
+
+Value*
+reduce_items21_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items21_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items21_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items21_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_0(Table*);
+
+Value*
+reduce_item21_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item21_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_1(Table*);
+
+Value*
+reduce_item21_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item21_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item21_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item21_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item21_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item21_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item21_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items22_0(Table*);
+
+Value*
+reduce_items22_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items22_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items22_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items22_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_0(Table*);
+
+Value*
+reduce_item22_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item22_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_1(Table*);
+
+Value*
+reduce_item22_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item22_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item22_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item22_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item22_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item22_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item22_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items23_0(Table*);
+
+Value*
+reduce_items23_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items23_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items23_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items23_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_0(Table*);
+
+Value*
+reduce_item23_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item23_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_1(Table*);
+
+Value*
+reduce_item23_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item23_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item23_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item23_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item23_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item23_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item23_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items24_0(Table*);
+
+Value*
+reduce_items24_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items24_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items24_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items24_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_0(Table*);
+
+Value*
+reduce_item24_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item24_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_1(Table*);
+
+Value*
+reduce_item24_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item24_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item24_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item24_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item24_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item24_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item24_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items25_0(Table*);
+
+Value*
+reduce_items25_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items25_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items25_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items25_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_0(Table*);
+
+Value*
+reduce_item25_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item25_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_1(Table*);
+
+Value*
+reduce_item25_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item25_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item25_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item25_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item25_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item25_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item25_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items26_0(Table*);
+
+Value*
+reduce_items26_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items26_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items26_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items26_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_0(Table*);
+
+Value*
+reduce_item26_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item26_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_1(Table*);
+
+Value*
+reduce_item26_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item26_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item26_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item26_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item26_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item26_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item26_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items27_0(Table*);
+
+Value*
+reduce_items27_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items27_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items27_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items27_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_0(Table*);
+
+Value*
+reduce_item27_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item27_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_1(Table*);
+
+Value*
+reduce_item27_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item27_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item27_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item27_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item27_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item27_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item27_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items28_0(Table*);
+
+Value*
+reduce_items28_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items28_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items28_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items28_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_0(Table*);
+
+Value*
+reduce_item28_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item28_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_1(Table*);
+
+Value*
+reduce_item28_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item28_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item28_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item28_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item28_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item28_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item28_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items29_0(Table*);
+
+Value*
+reduce_items29_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items29_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items29_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items29_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_0(Table*);
+
+Value*
+reduce_item29_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item29_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_1(Table*);
+
+Value*
+reduce_item29_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item29_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item29_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item29_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item29_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item29_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item29_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items30_0(Table*);
+
+Value*
+reduce_items30_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items30_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items30_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items30_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_0(Table*);
+
+Value*
+reduce_item30_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item30_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_1(Table*);
+
+Value*
+reduce_item30_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item30_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item30_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item30_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item30_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item30_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item30_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items31_0(Table*);
+
+Value*
+reduce_items31_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items31_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items31_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items31_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_0(Table*);
+
+Value*
+reduce_item31_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item31_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_1(Table*);
+
+Value*
+reduce_item31_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item31_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item31_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item31_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item31_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item31_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item31_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items32_0(Table*);
+
+Value*
+reduce_items32_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items32_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items32_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items32_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items32_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item32_0(Table*);
+
+Value*
+reduce_item32_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item32_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item32_1(Table*);
+
+Value*
+reduce_item32_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item32_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item32_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item32_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item32_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item32_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item32_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item32_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items33_0(Table*);
+
+Value*
+reduce_items33_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items33_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items33_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items33_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items33_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item33_0(Table*);
+
+Value*
+reduce_item33_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item33_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item33_1(Table*);
+
+Value*
+reduce_item33_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item33_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item33_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item33_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item33_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item33_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item33_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item33_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items34_0(Table*);
+
+Value*
+reduce_items34_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items34_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items34_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items34_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items34_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item34_0(Table*);
+
+Value*
+reduce_item34_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item34_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item34_1(Table*);
+
+Value*
+reduce_item34_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item34_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item34_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item34_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item34_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item34_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item34_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item34_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items35_0(Table*);
+
+Value*
+reduce_items35_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items35_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items35_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items35_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items35_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item35_0(Table*);
+
+Value*
+reduce_item35_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item35_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item35_1(Table*);
+
+Value*
+reduce_item35_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item35_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item35_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item35_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item35_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item35_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item35_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item35_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items36_0(Table*);
+
+Value*
+reduce_items36_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items36_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items36_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items36_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items36_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item36_0(Table*);
+
+Value*
+reduce_item36_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item36_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item36_1(Table*);
+
+Value*
+reduce_item36_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item36_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item36_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item36_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item36_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item36_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item36_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item36_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items37_0(Table*);
+
+Value*
+reduce_items37_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items37_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items37_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items37_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items37_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item37_0(Table*);
+
+Value*
+reduce_item37_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item37_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item37_1(Table*);
+
+Value*
+reduce_item37_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item37_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item37_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item37_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item37_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item37_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item37_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item37_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items38_0(Table*);
+
+Value*
+reduce_items38_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items38_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items38_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items38_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items38_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item38_0(Table*);
+
+Value*
+reduce_item38_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item38_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item38_1(Table*);
+
+Value*
+reduce_item38_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item38_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item38_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item38_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item38_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item38_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item38_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item38_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items39_0(Table*);
+
+Value*
+reduce_items39_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items39_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items39_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items39_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items39_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item39_0(Table*);
+
+Value*
+reduce_item39_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item39_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item39_1(Table*);
+
+Value*
+reduce_item39_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item39_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item39_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item39_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item39_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item39_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item39_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item39_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items40_0(Table*);
+
+Value*
+reduce_items40_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items40_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items40_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items40_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items40_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item40_0(Table*);
+
+Value*
+reduce_item40_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item40_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item40_1(Table*);
+
+Value*
+reduce_item40_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item40_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item40_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item40_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item40_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item40_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item40_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item40_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items41_0(Table*);
+
+Value*
+reduce_items41_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items41_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items41_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items41_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items41_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item41_0(Table*);
+
+Value*
+reduce_item41_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item41_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item41_1(Table*);
+
+Value*
+reduce_item41_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item41_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item41_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item41_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item41_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item41_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item41_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item41_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items42_0(Table*);
+
+Value*
+reduce_items42_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items42_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items42_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items42_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items42_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item42_0(Table*);
+
+Value*
+reduce_item42_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item42_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item42_1(Table*);
+
+Value*
+reduce_item42_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item42_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item42_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item42_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item42_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item42_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item42_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item42_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items43_0(Table*);
+
+Value*
+reduce_items43_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items43_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items43_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items43_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items43_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item43_0(Table*);
+
+Value*
+reduce_item43_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item43_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item43_1(Table*);
+
+Value*
+reduce_item43_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item43_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item43_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item43_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item43_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item43_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item43_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item43_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items44_0(Table*);
+
+Value*
+reduce_items44_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items44_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items44_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items44_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items44_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item44_0(Table*);
+
+Value*
+reduce_item44_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item44_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item44_1(Table*);
+
+Value*
+reduce_item44_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item44_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item44_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item44_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item44_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item44_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item44_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item44_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items45_0(Table*);
+
+Value*
+reduce_items45_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items45_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items45_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items45_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items45_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item45_0(Table*);
+
+Value*
+reduce_item45_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item45_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item45_1(Table*);
+
+Value*
+reduce_item45_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item45_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item45_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item45_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item45_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item45_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item45_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item45_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items46_0(Table*);
+
+Value*
+reduce_items46_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items46_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items46_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items46_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items46_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item46_0(Table*);
+
+Value*
+reduce_item46_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item46_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item46_1(Table*);
+
+Value*
+reduce_item46_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item46_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item46_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item46_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item46_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item46_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item46_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item46_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items47_0(Table*);
+
+Value*
+reduce_items47_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items47_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items47_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items47_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items47_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item47_0(Table*);
+
+Value*
+reduce_item47_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item47_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item47_1(Table*);
+
+Value*
+reduce_item47_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item47_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item47_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item47_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item47_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item47_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item47_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item47_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items48_0(Table*);
+
+Value*
+reduce_items48_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items48_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items48_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items48_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items48_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item48_0(Table*);
+
+Value*
+reduce_item48_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item48_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item48_1(Table*);
+
+Value*
+reduce_item48_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item48_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item48_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item48_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item48_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item48_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item48_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item48_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items49_0(Table*);
+
+Value*
+reduce_items49_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items49_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items49_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items49_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items49_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item49_0(Table*);
+
+Value*
+reduce_item49_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item49_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item49_1(Table*);
+
+Value*
+reduce_item49_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item49_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item49_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item49_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item49_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item49_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item49_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item49_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items50_0(Table*);
+
+Value*
+reduce_items50_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items50_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items50_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items50_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items50_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item50_0(Table*);
+
+Value*
+reduce_item50_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item50_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item50_1(Table*);
+
+Value*
+reduce_item50_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item50_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item50_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item50_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item50_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item50_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item50_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item50_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items51_0(Table*);
+
+Value*
+reduce_items51_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items51_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items51_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items51_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items51_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item51_0(Table*);
+
+Value*
+reduce_item51_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item51_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item51_1(Table*);
+
+Value*
+reduce_item51_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item51_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item51_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item51_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item51_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item51_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item51_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item51_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items52_0(Table*);
+
+Value*
+reduce_items52_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items52_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items52_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items52_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items52_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item52_0(Table*);
+
+Value*
+reduce_item52_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item52_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item52_1(Table*);
+
+Value*
+reduce_item52_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item52_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item52_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item52_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item52_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item52_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item52_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item52_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items53_0(Table*);
+
+Value*
+reduce_items53_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items53_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items53_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items53_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items53_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item53_0(Table*);
+
+Value*
+reduce_item53_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item53_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item53_1(Table*);
+
+Value*
+reduce_item53_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item53_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item53_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item53_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item53_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item53_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item53_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item53_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items54_0(Table*);
+
+Value*
+reduce_items54_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items54_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items54_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items54_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items54_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item54_0(Table*);
+
+Value*
+reduce_item54_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item54_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item54_1(Table*);
+
+Value*
+reduce_item54_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item54_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item54_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item54_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item54_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item54_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item54_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item54_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items55_0(Table*);
+
+Value*
+reduce_items55_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items55_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items55_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items55_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items55_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item55_0(Table*);
+
+Value*
+reduce_item55_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item55_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item55_1(Table*);
+
+Value*
+reduce_item55_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item55_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item55_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item55_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item55_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item55_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item55_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item55_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items56_0(Table*);
+
+Value*
+reduce_items56_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items56_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items56_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items56_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items56_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item56_0(Table*);
+
+Value*
+reduce_item56_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item56_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item56_1(Table*);
+
+Value*
+reduce_item56_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item56_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item56_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item56_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item56_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item56_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item56_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item56_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items57_0(Table*);
+
+Value*
+reduce_items57_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items57_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items57_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items57_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items57_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item57_0(Table*);
+
+Value*
+reduce_item57_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item57_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item57_1(Table*);
+
+Value*
+reduce_item57_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item57_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item57_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item57_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item57_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item57_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item57_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item57_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items58_0(Table*);
+
+Value*
+reduce_items58_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items58_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items58_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items58_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items58_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item58_0(Table*);
+
+Value*
+reduce_item58_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item58_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item58_1(Table*);
+
+Value*
+reduce_item58_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item58_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item58_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item58_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item58_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item58_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item58_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item58_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items59_0(Table*);
+
+Value*
+reduce_items59_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items59_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items59_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items59_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items59_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item59_0(Table*);
+
+Value*
+reduce_item59_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item59_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item59_1(Table*);
+
+Value*
+reduce_item59_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item59_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item59_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item59_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item59_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item59_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item59_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item59_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items60_0(Table*);
+
+Value*
+reduce_items60_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items60_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items60_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items60_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items60_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item60_0(Table*);
+
+Value*
+reduce_item60_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item60_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item60_1(Table*);
+
+Value*
+reduce_item60_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item60_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item60_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item60_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item60_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item60_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item60_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item60_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items61_0(Table*);
+
+Value*
+reduce_items61_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items61_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items61_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items61_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items61_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item61_0(Table*);
+
+Value*
+reduce_item61_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item61_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item61_1(Table*);
+
+Value*
+reduce_item61_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item61_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item61_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item61_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item61_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item61_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item61_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item61_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items62_0(Table*);
+
+Value*
+reduce_items62_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items62_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items62_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items62_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items62_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item62_0(Table*);
+
+Value*
+reduce_item62_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item62_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item62_1(Table*);
+
+Value*
+reduce_item62_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item62_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item62_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item62_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item62_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item62_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item62_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item62_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items63_0(Table*);
+
+Value*
+reduce_items63_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items63_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items63_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items63_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items63_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item63_0(Table*);
+
+Value*
+reduce_item63_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item63_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item63_1(Table*);
+
+Value*
+reduce_item63_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item63_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item63_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item63_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item63_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item63_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item63_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item63_3(table, E2);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_program_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_items0_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_items0_1, -1};
+Rule rule3 = {&nonterm2, 2, &reduce_item0_0, -1};
+Rule rule4 = {&nonterm2, 4, &reduce_item0_1, -1};
+Rule rule5 = {&nonterm2, 4, &reduce_item0_2, -1};
+Rule rule6 = {&nonterm2, 4, &reduce_item0_3, -1};
+Rule rule7 = {&nonterm3, 0, &reduce_items1_0, -1};
+Rule rule8 = {&nonterm3, 2, &reduce_items1_1, -1};
+Rule rule9 = {&nonterm4, 2, &reduce_item1_0, -1};
+Rule rule10 = {&nonterm4, 4, &reduce_item1_1, -1};
+Rule rule11 = {&nonterm4, 4, &reduce_item1_2, -1};
+Rule rule12 = {&nonterm4, 4, &reduce_item1_3, -1};
+Rule rule13 = {&nonterm5, 0, &reduce_items2_0, -1};
+Rule rule14 = {&nonterm5, 2, &reduce_items2_1, -1};
+Rule rule15 = {&nonterm6, 2, &reduce_item2_0, -1};
+Rule rule16 = {&nonterm6, 4, &reduce_item2_1, -1};
+Rule rule17 = {&nonterm6, 4, &reduce_item2_2, -1};
+Rule rule18 = {&nonterm6, 4, &reduce_item2_3, -1};
+Rule rule19 = {&nonterm7, 0, &reduce_items3_0, -1};
+Rule rule20 = {&nonterm7, 2, &reduce_items3_1, -1};
+Rule rule21 = {&nonterm8, 2, &reduce_item3_0, -1};
+Rule rule22 = {&nonterm8, 4, &reduce_item3_1, -1};
+Rule rule23 = {&nonterm8, 4, &reduce_item3_2, -1};
+Rule rule24 = {&nonterm8, 4, &reduce_item3_3, -1};
+Rule rule25 = {&nonterm9, 0, &reduce_items4_0, -1};
+Rule rule26 = {&nonterm9, 2, &reduce_items4_1, -1};
+Rule rule27 = {&nonterm10, 2, &reduce_item4_0, -1};
+Rule rule28 = {&nonterm10, 4, &reduce_item4_1, -1};
+Rule rule29 = {&nonterm10, 4, &reduce_item4_2, -1};
+Rule rule30 = {&nonterm10, 4, &reduce_item4_3, -1};
+Rule rule31 = {&nonterm11, 0, &reduce_items5_0, -1};
+Rule rule32 = {&nonterm11, 2, &reduce_items5_1, -1};
+Rule rule33 = {&nonterm12, 2, &reduce_item5_0, -1};
+Rule rule34 = {&nonterm12, 4, &reduce_item5_1, -1};
+Rule rule35 = {&nonterm12, 4, &reduce_item5_2, -1};
+Rule rule36 = {&nonterm12, 4, &reduce_item5_3, -1};
+Rule rule37 = {&nonterm13, 0, &reduce_items6_0, -1};
+Rule rule38 = {&nonterm13, 2, &reduce_items6_1, -1};
+Rule rule39 = {&nonterm14, 2, &reduce_item6_0, -1};
+Rule rule40 = {&nonterm14, 4, &reduce_item6_1, -1};
+Rule rule41 = {&nonterm14, 4, &reduce_item6_2, -1};
+Rule rule42 = {&nonterm14, 4, &reduce_item6_3, -1};
+Rule rule43 = {&nonterm15, 0, &reduce_items7_0, -1};
+Rule rule44 = {&nonterm15, 2, &reduce_items7_1, -1};
+Rule rule45 = {&nonterm16, 2, &reduce_item7_0, -1};
+Rule rule46 = {&nonterm16, 4, &reduce_item7_1, -1};
+Rule rule47 = {&nonterm16, 4, &reduce_item7_2, -1};
+Rule rule48 = {&nonterm16, 4, &reduce_item7_3, -1};
+Rule rule49 = {&nonterm17, 0, &reduce_items8_0, -1};
+Rule rule50 = {&nonterm17, 2, &reduce_items8_1, -1};
+Rule rule51 = {&nonterm18, 2, &reduce_item8_0, -1};
+Rule rule52 = {&nonterm18, 4, &reduce_item8_1, -1};
+Rule rule53 = {&nonterm18, 4, &reduce_item8_2, -1};
+Rule rule54 = {&nonterm18, 4, &reduce_item8_3, -1};
+Rule rule55 = {&nonterm19, 0, &reduce_items9_0, -1};
+Rule rule56 = {&nonterm19, 2, &reduce_items9_1, -1};
+Rule rule57 = {&nonterm20, 2, &reduce_item9_0, -1};
+Rule rule58 = {&nonterm20, 4, &reduce_item9_1, -1};
+Rule rule59 = {&nonterm20, 4, &reduce_item9_2, -1};
+Rule rule60 = {&nonterm20, 4, &reduce_item9_3, -1};
+Rule rule61 = {&nonterm21, 0, &reduce_items10_0, -1};
+Rule rule62 = {&nonterm21, 2, &reduce_items10_1, -1};
+Rule rule63 = {&nonterm22, 2, &reduce_item10_0, -1};
+Rule rule64 = {&nonterm22, 4, &reduce_item10_1, -1};
+Rule rule65 = {&nonterm22, 4, &reduce_item10_2, -1};
+Rule rule66 = {&nonterm22, 4, &reduce_item10_3, -1};
+Rule rule67 = {&nonterm23, 0, &reduce_items11_0, -1};
+Rule rule68 = {&nonterm23, 2, &reduce_items11_1, -1};
+Rule rule69 = {&nonterm24, 2, &reduce_item11_0, -1};
+Rule rule70 = {&nonterm24, 4, &reduce_item11_1, -1};
+Rule rule71 = {&nonterm24, 4, &reduce_item11_2, -1};
+Rule rule72 = {&nonterm24, 4, &reduce_item11_3, -1};
+Rule rule73 = {&nonterm25, 0, &reduce_items12_0, -1};
+Rule rule74 = {&nonterm25, 2, &reduce_items12_1, -1};
+Rule rule75 = {&nonterm26, 2, &reduce_item12_0, -1};
+Rule rule76 = {&nonterm26, 4, &reduce_item12_1, -1};
+Rule rule77 = {&nonterm26, 4, &reduce_item12_2, -1};
+Rule rule78 = {&nonterm26, 4, &reduce_item12_3, -1};
+Rule rule79 = {&nonterm27, 0, &reduce_items13_0, -1};
+Rule rule80 = {&nonterm27, 2, &reduce_items13_1, -1};
+Rule rule81 = {&nonterm28, 2, &reduce_item13_0, -1};
+Rule rule82 = {&nonterm28, 4, &reduce_item13_1, -1};
+Rule rule83 = {&nonterm28, 4, &reduce_item13_2, -1};
+Rule rule84 = {&nonterm28, 4, &reduce_item13_3, -1};
+Rule rule85 = {&nonterm29, 0, &reduce_items14_0, -1};
+Rule rule86 = {&nonterm29, 2, &reduce_items14_1, -1};
+Rule rule87 = {&nonterm30, 2, &reduce_item14_0, -1};
+Rule rule88 = {&nonterm30, 4, &reduce_item14_1, -1};
+Rule rule89 = {&nonterm30, 4, &reduce_item14_2, -1};
+Rule rule90 = {&nonterm30, 4, &reduce_item14_3, -1};
+Rule rule91 = {&nonterm31, 0, &reduce_items15_0, -1};
+Rule rule92 = {&nonterm31, 2, &reduce_items15_1, -1};
+Rule rule93 = {&nonterm32, 2, &reduce_item15_0, -1};
+Rule rule94 = {&nonterm32, 4, &reduce_item15_1, -1};
+Rule rule95 = {&nonterm32, 4, &reduce_item15_2, -1};
+Rule rule96 = {&nonterm32, 4, &reduce_item15_3, -1};
+Rule rule97 = {&nonterm33, 0, &reduce_items16_0, -1};
+Rule rule98 = {&nonterm33, 2, &reduce_items16_1, -1};
+Rule rule99 = {&nonterm34, 2, &reduce_item16_0, -1};
+Rule rule100 = {&nonterm34, 4, &reduce_item16_1, -1};
+Rule rule101 = {&nonterm34, 4, &reduce_item16_2, -1};
+Rule rule102 = {&nonterm34, 4, &reduce_item16_3, -1};
+Rule rule103 = {&nonterm35, 0, &reduce_items17_0, -1};
+Rule rule104 = {&nonterm35, 2, &reduce_items17_1, -1};
+Rule rule105 = {&nonterm36, 2, &reduce_item17_0, -1};
+Rule rule106 = {&nonterm36, 4, &reduce_item17_1, -1};
+Rule rule107 = {&nonterm36, 4, &reduce_item17_2, -1};
+Rule rule108 = {&nonterm36, 4, &reduce_item17_3, -1};
+Rule rule109 = {&nonterm37, 0, &reduce_items18_0, -1};
+Rule rule110 = {&nonterm37, 2, &reduce_items18_1, -1};
+Rule rule111 = {&nonterm38, 2, &reduce_item18_0, -1};
+Rule rule112 = {&nonterm38, 4, &reduce_item18_1, -1};
+Rule rule113 = {&nonterm38, 4, &reduce_item18_2, -1};
+Rule rule114 = {&nonterm38, 4, &reduce_item18_3, -1};
+Rule rule115 = {&nonterm39, 0, &reduce_items19_0, -1};
+Rule rule116 = {&nonterm39, 2, &reduce_items19_1, -1};
+Rule rule117 = {&nonterm40, 2, &reduce_item19_0, -1};
+Rule rule118 = {&nonterm40, 4, &reduce_item19_1, -1};
+Rule rule119 = {&nonterm40, 4, &reduce_item19_2, -1};
+Rule rule120 = {&nonterm40, 4, &reduce_item19_3, -1};
+Rule rule121 = {&nonterm41, 0, &reduce_items20_0, -1};
+Rule rule122 = {&nonterm41, 2, &reduce_items20_1, -1};
+Rule rule123 = {&nonterm42, 2, &reduce_item20_0, -1};
+Rule rule124 = {&nonterm42, 4, &reduce_item20_1, -1};
+Rule rule125 = {&nonterm42, 4, &reduce_item20_2, -1};
+Rule rule126 = {&nonterm42, 4, &reduce_item20_3, -1};
+Rule rule127 = {&nonterm43, 0, &reduce_items21_0, -1};
+Rule rule128 = {&nonterm43, 2, &reduce_items21_1, -1};
+Rule rule129 = {&nonterm44, 2, &reduce_item21_0, -1};
+Rule rule130 = {&nonterm44, 4, &reduce_item21_1, -1};
+Rule rule131 = {&nonterm44, 4, &reduce_item21_2, -1};
+Rule rule132 = {&nonterm44, 4, &reduce_item21_3, -1};
+Rule rule133 = {&nonterm45, 0, &reduce_items22_0, -1};
+Rule rule134 = {&nonterm45, 2, &reduce_items22_1, -1};
+Rule rule135 = {&nonterm46, 2, &reduce_item22_0, -1};
+Rule rule136 = {&nonterm46, 4, &reduce_item22_1, -1};
+Rule rule137 = {&nonterm46, 4, &reduce_item22_2, -1};
+Rule rule138 = {&nonterm46, 4, &reduce_item22_3, -1};
+Rule rule139 = {&nonterm47, 0, &reduce_items23_0, -1};
+Rule rule140 = {&nonterm47, 2, &reduce_items23_1, -1};
+Rule rule141 = {&nonterm48, 2, &reduce_item23_0, -1};
+Rule rule142 = {&nonterm48, 4, &reduce_item23_1, -1};
+Rule rule143 = {&nonterm48, 4, &reduce_item23_2, -1};
+Rule rule144 = {&nonterm48, 4, &reduce_item23_3, -1};
+Rule rule145 = {&nonterm49, 0, &reduce_items24_0, -1};
+Rule rule146 = {&nonterm49, 2, &reduce_items24_1, -1};
+Rule rule147 = {&nonterm50, 2, &reduce_item24_0, -1};
+Rule rule148 = {&nonterm50, 4, &reduce_item24_1, -1};
+Rule rule149 = {&nonterm50, 4, &reduce_item24_2, -1};
+Rule rule150 = {&nonterm50, 4, &reduce_item24_3, -1};
+Rule rule151 = {&nonterm51, 0, &reduce_items25_0, -1};
+Rule rule152 = {&nonterm51, 2, &reduce_items25_1, -1};
+Rule rule153 = {&nonterm52, 2, &reduce_item25_0, -1};
+Rule rule154 = {&nonterm52, 4, &reduce_item25_1, -1};
+Rule rule155 = {&nonterm52, 4, &reduce_item25_2, -1};
+Rule rule156 = {&nonterm52, 4, &reduce_item25_3, -1};
+Rule rule157 = {&nonterm53, 0, &reduce_items26_0, -1};
+Rule rule158 = {&nonterm53, 2, &reduce_items26_1, -1};
+Rule rule159 = {&nonterm54, 2, &reduce_item26_0, -1};
+Rule rule160 = {&nonterm54, 4, &reduce_item26_1, -1};
+Rule rule161 = {&nonterm54, 4, &reduce_item26_2, -1};
+Rule rule162 = {&nonterm54, 4, &reduce_item26_3, -1};
+Rule rule163 = {&nonterm55, 0, &reduce_items27_0, -1};
+Rule rule164 = {&nonterm55, 2, &reduce_items27_1, -1};
+Rule rule165 = {&nonterm56, 2, &reduce_item27_0, -1};
+Rule rule166 = {&nonterm56, 4, &reduce_item27_1, -1};
+Rule rule167 = {&nonterm56, 4, &reduce_item27_2, -1};
+Rule rule168 = {&nonterm56, 4, &reduce_item27_3, -1};
+Rule rule169 = {&nonterm57, 0, &reduce_items28_0, -1};
+Rule rule170 = {&nonterm57, 2, &reduce_items28_1, -1};
+Rule rule171 = {&nonterm58, 2, &reduce_item28_0, -1};
+Rule rule172 = {&nonterm58, 4, &reduce_item28_1, -1};
+Rule rule173 = {&nonterm58, 4, &reduce_item28_2, -1};
+Rule rule174 = {&nonterm58, 4, &reduce_item28_3, -1};
+Rule rule175 = {&nonterm59, 0, &reduce_items29_0, -1};
+Rule rule176 = {&nonterm59, 2, &reduce_items29_1, -1};
+Rule rule177 = {&nonterm60, 2, &reduce_item29_0, -1};
+Rule rule178 = {&nonterm60, 4, &reduce_item29_1, -1};
+Rule rule179 = {&nonterm60, 4, &reduce_item29_2, -1};
+Rule rule180 = {&nonterm60, 4, &reduce_item29_3, -1};
+Rule rule181 = {&nonterm61, 0, &reduce_items30_0, -1};
+Rule rule182 = {&nonterm61, 2, &reduce_items30_1, -1};
+Rule rule183 = {&nonterm62, 2, &reduce_item30_0, -1};
+Rule rule184 = {&nonterm62, 4, &reduce_item30_1, -1};
+Rule rule185 = {&nonterm62, 4, &reduce_item30_2, -1};
+Rule rule186 = {&nonterm62, 4, &reduce_item30_3, -1};
+Rule rule187 = {&nonterm63, 0, &reduce_items31_0, -1};
+Rule rule188 = {&nonterm63, 2, &reduce_items31_1, -1};
+Rule rule189 = {&nonterm64, 2, &reduce_item31_0, -1};
+Rule rule190 = {&nonterm64, 4, &reduce_item31_1, -1};
+Rule rule191 = {&nonterm64, 4, &reduce_item31_2, -1};
+Rule rule192 = {&nonterm64, 4, &reduce_item31_3, -1};
+Rule rule193 = {&nonterm65, 0, &reduce_items32_0, -1};
+Rule rule194 = {&nonterm65, 2, &reduce_items32_1, -1};
+Rule rule195 = {&nonterm66, 2, &reduce_item32_0, -1};
+Rule rule196 = {&nonterm66, 4, &reduce_item32_1, -1};
+Rule rule197 = {&nonterm66, 4, &reduce_item32_2, -1};
+Rule rule198 = {&nonterm66, 4, &reduce_item32_3, -1};
+Rule rule199 = {&nonterm67, 0, &reduce_items33_0, -1};
+Rule rule200 = {&nonterm67, 2, &reduce_items33_1, -1};
+Rule rule201 = {&nonterm68, 2, &reduce_item33_0, -1};
+Rule rule202 = {&nonterm68, 4, &reduce_item33_1, -1};
+Rule rule203 = {&nonterm68, 4, &reduce_item33_2, -1};
+Rule rule204 = {&nonterm68, 4, &reduce_item33_3, -1};
+Rule rule205 = {&nonterm69, 0, &reduce_items34_0, -1};
+Rule rule206 = {&nonterm69, 2, &reduce_items34_1, -1};
+Rule rule207 = {&nonterm70, 2, &reduce_item34_0, -1};
+Rule rule208 = {&nonterm70, 4, &reduce_item34_1, -1};
+Rule rule209 = {&nonterm70, 4, &reduce_item34_2, -1};
+Rule rule210 = {&nonterm70, 4, &reduce_item34_3, -1};
+Rule rule211 = {&nonterm71, 0, &reduce_items35_0, -1};
+Rule rule212 = {&nonterm71, 2, &reduce_items35_1, -1};
+Rule rule213 = {&nonterm72, 2, &reduce_item35_0, -1};
+Rule rule214 = {&nonterm72, 4, &reduce_item35_1, -1};
+Rule rule215 = {&nonterm72, 4, &reduce_item35_2, -1};
+Rule rule216 = {&nonterm72, 4, &reduce_item35_3, -1};
+Rule rule217 = {&nonterm73, 0, &reduce_items36_0, -1};
+Rule rule218 = {&nonterm73, 2, &reduce_items36_1, -1};
+Rule rule219 = {&nonterm74, 2, &reduce_item36_0, -1};
+Rule rule220 = {&nonterm74, 4, &reduce_item36_1, -1};
+Rule rule221 = {&nonterm74, 4, &reduce_item36_2, -1};
+Rule rule222 = {&nonterm74, 4, &reduce_item36_3, -1};
+Rule rule223 = {&nonterm75, 0, &reduce_items37_0, -1};
+Rule rule224 = {&nonterm75, 2, &reduce_items37_1, -1};
+Rule rule225 = {&nonterm76, 2, &reduce_item37_0, -1};
+Rule rule226 = {&nonterm76, 4, &reduce_item37_1, -1};
+Rule rule227 = {&nonterm76, 4, &reduce_item37_2, -1};
+Rule rule228 = {&nonterm76, 4, &reduce_item37_3, -1};
+Rule rule229 = {&nonterm77, 0, &reduce_items38_0, -1};
+Rule rule230 = {&nonterm77, 2, &reduce_items38_1, -1};
+Rule rule231 = {&nonterm78, 2, &reduce_item38_0, -1};
+Rule rule232 = {&nonterm78, 4, &reduce_item38_1, -1};
+Rule rule233 = {&nonterm78, 4, &reduce_item38_2, -1};
+Rule rule234 = {&nonterm78, 4, &reduce_item38_3, -1};
+Rule rule235 = {&nonterm79, 0, &reduce_items39_0, -1};
+Rule rule236 = {&nonterm79, 2, &reduce_items39_1, -1};
+Rule rule237 = {&nonterm80, 2, &reduce_item39_0, -1};
+Rule rule238 = {&nonterm80, 4, &reduce_item39_1, -1};
+Rule rule239 = {&nonterm80, 4, &reduce_item39_2, -1};
+Rule rule240 = {&nonterm80, 4, &reduce_item39_3, -1};
+Rule rule241 = {&nonterm81, 0, &reduce_items40_0, -1};
+Rule rule242 = {&nonterm81, 2, &reduce_items40_1, -1};
+Rule rule243 = {&nonterm82, 2, &reduce_item40_0, -1};
+Rule rule244 = {&nonterm82, 4, &reduce_item40_1, -1};
+Rule rule245 = {&nonterm82, 4, &reduce_item40_2, -1};
+Rule rule246 = {&nonterm82, 4, &reduce_item40_3, -1};
+Rule rule247 = {&nonterm83, 0, &reduce_items41_0, -1};
+Rule rule248 = {&nonterm83, 2, &reduce_items41_1, -1};
+Rule rule249 = {&nonterm84, 2, &reduce_item41_0, -1};
+Rule rule250 = {&nonterm84, 4, &reduce_item41_1, -1};
+Rule rule251 = {&nonterm84, 4, &reduce_item41_2, -1};
+Rule rule252 = {&nonterm84, 4, &reduce_item41_3, -1};
+Rule rule253 = {&nonterm85, 0, &reduce_items42_0, -1};
+Rule rule254 = {&nonterm85, 2, &reduce_items42_1, -1};
+Rule rule255 = {&nonterm86, 2, &reduce_item42_0, -1};
+Rule rule256 = {&nonterm86, 4, &reduce_item42_1, -1};
+Rule rule257 = {&nonterm86, 4, &reduce_item42_2, -1};
+Rule rule258 = {&nonterm86, 4, &reduce_item42_3, -1};
+Rule rule259 = {&nonterm87, 0, &reduce_items43_0, -1};
+Rule rule260 = {&nonterm87, 2, &reduce_items43_1, -1};
+Rule rule261 = {&nonterm88, 2, &reduce_item43_0, -1};
+Rule rule262 = {&nonterm88, 4, &reduce_item43_1, -1};
+Rule rule263 = {&nonterm88, 4, &reduce_item43_2, -1};
+Rule rule264 = {&nonterm88, 4, &reduce_item43_3, -1};
+Rule rule265 = {&nonterm89, 0, &reduce_items44_0, -1};
+Rule rule266 = {&nonterm89, 2, &reduce_items44_1, -1};
+Rule rule267 = {&nonterm90, 2, &reduce_item44_0, -1};
+Rule rule268 = {&nonterm90, 4, &reduce_item44_1, -1};
+Rule rule269 = {&nonterm90, 4, &reduce_item44_2, -1};
+Rule rule270 = {&nonterm90, 4, &reduce_item44_3, -1};
+Rule rule271 = {&nonterm91, 0, &reduce_items45_0, -1};
+Rule rule272 = {&nonterm91, 2, &reduce_items45_1, -1};
+Rule rule273 = {&nonterm92, 2, &reduce_item45_0, -1};
+Rule rule274 = {&nonterm92, 4, &reduce_item45_1, -1};
+Rule rule275 = {&nonterm92, 4, &reduce_item45_2, -1};
+Rule rule276 = {&nonterm92, 4, &reduce_item45_3, -1};
+Rule rule277 = {&nonterm93, 0, &reduce_items46_0, -1};
+Rule rule278 = {&nonterm93, 2, &reduce_items46_1, -1};
+Rule rule279 = {&nonterm94, 2, &reduce_item46_0, -1};
+Rule rule280 = {&nonterm94, 4, &reduce_item46_1, -1};
+Rule rule281 = {&nonterm94, 4, &reduce_item46_2, -1};
+Rule rule282 = {&nonterm94, 4, &reduce_item46_3, -1};
+Rule rule283 = {&nonterm95, 0, &reduce_items47_0, -1};
+Rule rule284 = {&nonterm95, 2, &reduce_items47_1, -1};
+Rule rule285 = {&nonterm96, 2, &reduce_item47_0, -1};
+Rule rule286 = {&nonterm96, 4, &reduce_item47_1, -1};
+Rule rule287 = {&nonterm96, 4, &reduce_item47_2, -1};
+Rule rule288 = {&nonterm96, 4, &reduce_item47_3, -1};
+Rule rule289 = {&nonterm97, 0, &reduce_items48_0, -1};
+Rule rule290 = {&nonterm97, 2, &reduce_items48_1, -1};
+Rule rule291 = {&nonterm98, 2, &reduce_item48_0, -1};
+Rule rule292 = {&nonterm98, 4, &reduce_item48_1, -1};
+Rule rule293 = {&nonterm98, 4, &reduce_item48_2, -1};
+Rule rule294 = {&nonterm98, 4, &reduce_item48_3, -1};
+Rule rule295 = {&nonterm99, 0, &reduce_items49_0, -1};
+Rule rule296 = {&nonterm99, 2, &reduce_items49_1, -1};
+Rule rule297 = {&nonterm100, 2, &reduce_item49_0, -1};
+Rule rule298 = {&nonterm100, 4, &reduce_item49_1, -1};
+Rule rule299 = {&nonterm100, 4, &reduce_item49_2, -1};
+Rule rule300 = {&nonterm100, 4, &reduce_item49_3, -1};
+Rule rule301 = {&nonterm101, 0, &reduce_items50_0, -1};
+Rule rule302 = {&nonterm101, 2, &reduce_items50_1, -1};
+Rule rule303 = {&nonterm102, 2, &reduce_item50_0, -1};
+Rule rule304 = {&nonterm102, 4, &reduce_item50_1, -1};
+Rule rule305 = {&nonterm102, 4, &reduce_item50_2, -1};
+Rule rule306 = {&nonterm102, 4, &reduce_item50_3, -1};
+Rule rule307 = {&nonterm103, 0, &reduce_items51_0, -1};
+Rule rule308 = {&nonterm103, 2, &reduce_items51_1, -1};
+Rule rule309 = {&nonterm104, 2, &reduce_item51_0, -1};
+Rule rule310 = {&nonterm104, 4, &reduce_item51_1, -1};
+Rule rule311 = {&nonterm104, 4, &reduce_item51_2, -1};
+Rule rule312 = {&nonterm104, 4, &reduce_item51_3, -1};
+Rule rule313 = {&nonterm105, 0, &reduce_items52_0, -1};
+Rule rule314 = {&nonterm105, 2, &reduce_items52_1, -1};
+Rule rule315 = {&nonterm106, 2, &reduce_item52_0, -1};
+Rule rule316 = {&nonterm106, 4, &reduce_item52_1, -1};
+Rule rule317 = {&nonterm106, 4, &reduce_item52_2, -1};
+Rule rule318 = {&nonterm106, 4, &reduce_item52_3, -1};
+Rule rule319 = {&nonterm107, 0, &reduce_items53_0, -1};
+Rule rule320 = {&nonterm107, 2, &reduce_items53_1, -1};
+Rule rule321 = {&nonterm108, 2, &reduce_item53_0, -1};
+Rule rule322 = {&nonterm108, 4, &reduce_item53_1, -1};
+Rule rule323 = {&nonterm108, 4, &reduce_item53_2, -1};
+Rule rule324 = {&nonterm108, 4, &reduce_item53_3, -1};
+Rule rule325 = {&nonterm109, 0, &reduce_items54_0, -1};
+Rule rule326 = {&nonterm109, 2, &reduce_items54_1, -1};
+Rule rule327 = {&nonterm110, 2, &reduce_item54_0, -1};
+Rule rule328 = {&nonterm110, 4, &reduce_item54_1, -1};
+Rule rule329 = {&nonterm110, 4, &reduce_item54_2, -1};
+Rule rule330 = {&nonterm110, 4, &reduce_item54_3, -1};
+Rule rule331 = {&nonterm111, 0, &reduce_items55_0, -1};
+Rule rule332 = {&nonterm111, 2, &reduce_items55_1, -1};
+Rule rule333 = {&nonterm112, 2, &reduce_item55_0, -1};
+Rule rule334 = {&nonterm112, 4, &reduce_item55_1, -1};
+Rule rule335 = {&nonterm112, 4, &reduce_item55_2, -1};
+Rule rule336 = {&nonterm112, 4, &reduce_item55_3, -1};
+Rule rule337 = {&nonterm113, 0, &reduce_items56_0, -1};
+Rule rule338 = {&nonterm113, 2, &reduce_items56_1, -1};
+Rule rule339 = {&nonterm114, 2, &reduce_item56_0, -1};
+Rule rule340 = {&nonterm114, 4, &reduce_item56_1, -1};
+Rule rule341 = {&nonterm114, 4, &reduce_item56_2, -1};
+Rule rule342 = {&nonterm114, 4, &reduce_item56_3, -1};
+Rule rule343 = {&nonterm115, 0, &reduce_items57_0, -1};
+Rule rule344 = {&nonterm115, 2, &reduce_items57_1, -1};
+Rule rule345 = {&nonterm116, 2, &reduce_item57_0, -1};
+Rule rule346 = {&nonterm116, 4, &reduce_item57_1, -1};
+Rule rule347 = {&nonterm116, 4, &reduce_item57_2, -1};
+Rule rule348 = {&nonterm116, 4, &reduce_item57_3, -1};
+Rule rule349 = {&nonterm117, 0, &reduce_items58_0, -1};
+Rule rule350 = {&nonterm117, 2, &reduce_items58_1, -1};
+Rule rule351 = {&nonterm118, 2, &reduce_item58_0, -1};
+Rule rule352 = {&nonterm118, 4, &reduce_item58_1, -1};
+Rule rule353 = {&nonterm118, 4, &reduce_item58_2, -1};
+Rule rule354 = {&nonterm118, 4, &reduce_item58_3, -1};
+Rule rule355 = {&nonterm119, 0, &reduce_items59_0, -1};
+Rule rule356 = {&nonterm119, 2, &reduce_items59_1, -1};
+Rule rule357 = {&nonterm120, 2, &reduce_item59_0, -1};
+Rule rule358 = {&nonterm120, 4, &reduce_item59_1, -1};
+Rule rule359 = {&nonterm120, 4, &reduce_item59_2, -1};
+Rule rule360 = {&nonterm120, 4, &reduce_item59_3, -1};
+Rule rule361 = {&nonterm121, 0, &reduce_items60_0, -1};
+Rule rule362 = {&nonterm121, 2, &reduce_items60_1, -1};
+Rule rule363 = {&nonterm122, 2, &reduce_item60_0, -1};
+Rule rule364 = {&nonterm122, 4, &reduce_item60_1, -1};
+Rule rule365 = {&nonterm122, 4, &reduce_item60_2, -1};
+Rule rule366 = {&nonterm122, 4, &reduce_item60_3, -1};
+Rule rule367 = {&nonterm123, 0, &reduce_items61_0, -1};
+Rule rule368 = {&nonterm123, 2, &reduce_items61_1, -1};
+Rule rule369 = {&nonterm124, 2, &reduce_item61_0, -1};
+Rule rule370 = {&nonterm124, 4, &reduce_item61_1, -1};
+Rule rule371 = {&nonterm124, 4, &reduce_item61_2, -1};
+Rule rule372 = {&nonterm124, 4, &reduce_item61_3, -1};
+Rule rule373 = {&nonterm125, 0, &reduce_items62_0, -1};
+Rule rule374 = {&nonterm125, 2, &reduce_items62_1, -1};
+Rule rule375 = {&nonterm126, 2, &reduce_item62_0, -1};
+Rule rule376 = {&nonterm126, 4, &reduce_item62_1, -1};
+Rule rule377 = {&nonterm126, 4, &reduce_item62_2, -1};
+Rule rule378 = {&nonterm126, 4, &reduce_item62_3, -1};
+Rule rule379 = {&nonterm127, 0, &reduce_items63_0, -1};
+Rule rule380 = {&nonterm127, 2, &reduce_items63_1, -1};
+Rule rule381 = {&nonterm128, 2, &reduce_item63_0, -1};
+Rule rule382 = {&nonterm128, 4, &reduce_item63_1, -1};
+Rule rule383 = {&nonterm128, 4, &reduce_item63_2, -1};
+Rule rule384 = {&nonterm128, 4, &reduce_item63_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+extern State state784;
+extern State state785;
+extern State state786;
+extern State state787;
+extern State state788;
+extern State state789;
+extern State state790;
+extern State state791;
+extern State state792;
+extern State state793;
+extern State state794;
+extern State state795;
+extern State state796;
+extern State state797;
+extern State state798;
+extern State state799;
+extern State state800;
+extern State state801;
+extern State state802;
+extern State state803;
+extern State state804;
+extern State state805;
+extern State state806;
+extern State state807;
+extern State state808;
+extern State state809;
+extern State state810;
+extern State state811;
+extern State state812;
+extern State state813;
+extern State state814;
+extern State state815;
+extern State state816;
+extern State state817;
+extern State state818;
+extern State state819;
+extern State state820;
+extern State state821;
+extern State state822;
+extern State state823;
+extern State state824;
+extern State state825;
+extern State state826;
+extern State state827;
+extern State state828;
+extern State state829;
+extern State state830;
+extern State state831;
+extern State state832;
+extern State state833;
+extern State state834;
+extern State state835;
+extern State state836;
+extern State state837;
+extern State state838;
+extern State state839;
+extern State state840;
+extern State state841;
+extern State state842;
+extern State state843;
+extern State state844;
+extern State state845;
+extern State state846;
+extern State state847;
+extern State state848;
+extern State state849;
+extern State state850;
+extern State state851;
+extern State state852;
+extern State state853;
+extern State state854;
+extern State state855;
+extern State state856;
+extern State state857;
+extern State state858;
+extern State state859;
+extern State state860;
+extern State state861;
+extern State state862;
+extern State state863;
+extern State state864;
+extern State state865;
+extern State state866;
+extern State state867;
+extern State state868;
+extern State state869;
+extern State state870;
+extern State state871;
+extern State state872;
+extern State state873;
+extern State state874;
+extern State state875;
+extern State state876;
+extern State state877;
+extern State state878;
+extern State state879;
+extern State state880;
+extern State state881;
+extern State state882;
+extern State state883;
+extern State state884;
+extern State state885;
+extern State state886;
+extern State state887;
+extern State state888;
+extern State state889;
+extern State state890;
+extern State state891;
+extern State state892;
+extern State state893;
+extern State state894;
+extern State state895;
+extern State state896;
+extern State state897;
+extern State state898;
+extern State state899;
+extern State state900;
+extern State state901;
+extern State state902;
+extern State state903;
+extern State state904;
+extern State state905;
+extern State state906;
+extern State state907;
+extern State state908;
+extern State state909;
+extern State state910;
+extern State state911;
+extern State state912;
+extern State state913;
+extern State state914;
+extern State state915;
+extern State state916;
+extern State state917;
+extern State state918;
+extern State state919;
+extern State state920;
+extern State state921;
+extern State state922;
+extern State state923;
+extern State state924;
+extern State state925;
+extern State state926;
+extern State state927;
+extern State state928;
+extern State state929;
+extern State state930;
+extern State state931;
+extern State state932;
+extern State state933;
+extern State state934;
+extern State state935;
+extern State state936;
+extern State state937;
+extern State state938;
+extern State state939;
+extern State state940;
+extern State state941;
+extern State state942;
+extern State state943;
+extern State state944;
+extern State state945;
+extern State state946;
+extern State state947;
+extern State state948;
+extern State state949;
+extern State state950;
+extern State state951;
+extern State state952;
+extern State state953;
+extern State state954;
+extern State state955;
+extern State state956;
+extern State state957;
+extern State state958;
+extern State state959;
+extern State state960;
+extern State state961;
+extern State state962;
+extern State state963;
+extern State state964;
+extern State state965;
+extern State state966;
+extern State state967;
+extern State state968;
+extern State state969;
+extern State state970;
+extern State state971;
+extern State state972;
+extern State state973;
+extern State state974;
+extern State state975;
+extern State state976;
+extern State state977;
+extern State state978;
+extern State state979;
+extern State state980;
+extern State state981;
+extern State state982;
+extern State state983;
+extern State state984;
+extern State state985;
+extern State state986;
+extern State state987;
+extern State state988;
+extern State state989;
+extern State state990;
+extern State state991;
+extern State state992;
+extern State state993;
+extern State state994;
+extern State state995;
+extern State state996;
+extern State state997;
+extern State state998;
+extern State state999;
+extern State state1000;
+extern State state1001;
+extern State state1002;
+extern State state1003;
+extern State state1004;
+extern State state1005;
+extern State state1006;
+extern State state1007;
+extern State state1008;
+extern State state1009;
+extern State state1010;
+extern State state1011;
+extern State state1012;
+extern State state1013;
+extern State state1014;
+extern State state1015;
+extern State state1016;
+extern State state1017;
+extern State state1018;
+extern State state1019;
+extern State state1020;
+extern State state1021;
+extern State state1022;
+extern State state1023;
+extern State state1024;
+extern State state1025;
+extern State state1026;
+extern State state1027;
+extern State state1028;
+extern State state1029;
+extern State state1030;
+extern State state1031;
+extern State state1032;
+extern State state1033;
+extern State state1034;
+extern State state1035;
+extern State state1036;
+extern State state1037;
+extern State state1038;
+extern State state1039;
+extern State state1040;
+extern State state1041;
+extern State state1042;
+extern State state1043;
+extern State state1044;
+extern State state1045;
+extern State state1046;
+extern State state1047;
+extern State state1048;
+extern State state1049;
+extern State state1050;
+extern State state1051;
+extern State state1052;
+extern State state1053;
+extern State state1054;
+extern State state1055;
+extern State state1056;
+extern State state1057;
+extern State state1058;
+extern State state1059;
+extern State state1060;
+extern State state1061;
+extern State state1062;
+extern State state1063;
+extern State state1064;
+extern State state1065;
+extern State state1066;
+extern State state1067;
+extern State state1068;
+extern State state1069;
+extern State state1070;
+extern State state1071;
+extern State state1072;
+extern State state1073;
+extern State state1074;
+extern State state1075;
+extern State state1076;
+extern State state1077;
+extern State state1078;
+extern State state1079;
+extern State state1080;
+extern State state1081;
+extern State state1082;
+extern State state1083;
+extern State state1084;
+extern State state1085;
+extern State state1086;
+extern State state1087;
+extern State state1088;
+extern State state1089;
+extern State state1090;
+extern State state1091;
+extern State state1092;
+extern State state1093;
+extern State state1094;
+extern State state1095;
+extern State state1096;
+extern State state1097;
+extern State state1098;
+extern State state1099;
+extern State state1100;
+extern State state1101;
+extern State state1102;
+extern State state1103;
+extern State state1104;
+extern State state1105;
+extern State state1106;
+extern State state1107;
+extern State state1108;
+extern State state1109;
+extern State state1110;
+extern State state1111;
+extern State state1112;
+extern State state1113;
+extern State state1114;
+extern State state1115;
+extern State state1116;
+extern State state1117;
+extern State state1118;
+extern State state1119;
+extern State state1120;
+extern State state1121;
+extern State state1122;
+extern State state1123;
+extern State state1124;
+extern State state1125;
+extern State state1126;
+extern State state1127;
+extern State state1128;
+extern State state1129;
+extern State state1130;
+extern State state1131;
+extern State state1132;
+extern State state1133;
+extern State state1134;
+extern State state1135;
+extern State state1136;
+extern State state1137;
+extern State state1138;
+extern State state1139;
+extern State state1140;
+extern State state1141;
+extern State state1142;
+extern State state1143;
+extern State state1144;
+extern State state1145;
+extern State state1146;
+extern State state1147;
+extern State state1148;
+extern State state1149;
+extern State state1150;
+extern State state1151;
+extern State state1152;
+extern State state1153;
+extern State state1154;
+extern State state1155;
+extern State state1156;
+extern State state1157;
+extern State state1158;
+extern State state1159;
+extern State state1160;
+extern State state1161;
+extern State state1162;
+extern State state1163;
+extern State state1164;
+extern State state1165;
+extern State state1166;
+extern State state1167;
+extern State state1168;
+extern State state1169;
+extern State state1170;
+extern State state1171;
+extern State state1172;
+extern State state1173;
+extern State state1174;
+extern State state1175;
+extern State state1176;
+extern State state1177;
+extern State state1178;
+extern State state1179;
+extern State state1180;
+extern State state1181;
+extern State state1182;
+extern State state1183;
+extern State state1184;
+extern State state1185;
+extern State state1186;
+extern State state1187;
+extern State state1188;
+extern State state1189;
+extern State state1190;
+extern State state1191;
+extern State state1192;
+extern State state1193;
+extern State state1194;
+extern State state1195;
+extern State state1196;
+extern State state1197;
+extern State state1198;
+extern State state1199;
+extern State state1200;
+extern State state1201;
+extern State state1202;
+extern State state1203;
+extern State state1204;
+extern State state1205;
+extern State state1206;
+extern State state1207;
+extern State state1208;
+extern State state1209;
+extern State state1210;
+extern State state1211;
+extern State state1212;
+extern State state1213;
+extern State state1214;
+extern State state1215;
+extern State state1216;
+extern State state1217;
+extern State state1218;
+extern State state1219;
+extern State state1220;
+extern State state1221;
+extern State state1222;
+extern State state1223;
+extern State state1224;
+extern State state1225;
+extern State state1226;
+extern State state1227;
+extern State state1228;
+extern State state1229;
+extern State state1230;
+extern State state1231;
+extern State state1232;
+extern State state1233;
+extern State state1234;
+extern State state1235;
+extern State state1236;
+extern State state1237;
+extern State state1238;
+extern State state1239;
+extern State state1240;
+extern State state1241;
+extern State state1242;
+extern State state1243;
+extern State state1244;
+extern State state1245;
+extern State state1246;
+extern State state1247;
+extern State state1248;
+extern State state1249;
+extern State state1250;
+extern State state1251;
+extern State state1252;
+extern State state1253;
+extern State state1254;
+extern State state1255;
+extern State state1256;
+extern State state1257;
+extern State state1258;
+extern State state1259;
+extern State state1260;
+extern State state1261;
+extern State state1262;
+extern State state1263;
+extern State state1264;
+extern State state1265;
+extern State state1266;
+extern State state1267;
+extern State state1268;
+extern State state1269;
+extern State state1270;
+extern State state1271;
+extern State state1272;
+extern State state1273;
+extern State state1274;
+extern State state1275;
+extern State state1276;
+extern State state1277;
+extern State state1278;
+extern State state1279;
+extern State state1280;
+extern State state1281;
+extern State state1282;
+extern State state1283;
+extern State state1284;
+extern State state1285;
+extern State state1286;
+extern State state1287;
+extern State state1288;
+extern State state1289;
+extern State state1290;
+extern State state1291;
+extern State state1292;
+extern State state1293;
+extern State state1294;
+extern State state1295;
+extern State state1296;
+extern State state1297;
+extern State state1298;
+extern State state1299;
+extern State state1300;
+extern State state1301;
+extern State state1302;
+extern State state1303;
+extern State state1304;
+extern State state1305;
+extern State state1306;
+extern State state1307;
+extern State state1308;
+extern State state1309;
+extern State state1310;
+extern State state1311;
+extern State state1312;
+extern State state1313;
+extern State state1314;
+extern State state1315;
+extern State state1316;
+extern State state1317;
+extern State state1318;
+extern State state1319;
+extern State state1320;
+extern State state1321;
+extern State state1322;
+extern State state1323;
+extern State state1324;
+extern State state1325;
+extern State state1326;
+extern State state1327;
+extern State state1328;
+extern State state1329;
+extern State state1330;
+extern State state1331;
+extern State state1332;
+extern State state1333;
+extern State state1334;
+extern State state1335;
+extern State state1336;
+extern State state1337;
+extern State state1338;
+extern State state1339;
+extern State state1340;
+extern State state1341;
+extern State state1342;
+extern State state1343;
+extern State state1344;
+extern State state1345;
+extern State state1346;
+extern State state1347;
+extern State state1348;
+extern State state1349;
+extern State state1350;
+extern State state1351;
+extern State state1352;
+extern State state1353;
+extern State state1354;
+extern State state1355;
+extern State state1356;
+extern State state1357;
+extern State state1358;
+extern State state1359;
+extern State state1360;
+extern State state1361;
+extern State state1362;
+extern State state1363;
+extern State state1364;
+extern State state1365;
+extern State state1366;
+extern State state1367;
+extern State state1368;
+extern State state1369;
+extern State state1370;
+extern State state1371;
+extern State state1372;
+extern State state1373;
+extern State state1374;
+extern State state1375;
+extern State state1376;
+extern State state1377;
+extern State state1378;
+extern State state1379;
+extern State state1380;
+extern State state1381;
+extern State state1382;
+extern State state1383;
+extern State state1384;
+extern State state1385;
+extern State state1386;
+extern State state1387;
+extern State state1388;
+extern State state1389;
+extern State state1390;
+extern State state1391;
+extern State state1392;
+extern State state1393;
+extern State state1394;
+extern State state1395;
+extern State state1396;
+extern State state1397;
+extern State state1398;
+extern State state1399;
+extern State state1400;
+extern State state1401;
+extern State state1402;
+extern State state1403;
+extern State state1404;
+extern State state1405;
+extern State state1406;
+extern State state1407;
+extern State state1408;
+extern State state1409;
+extern State state1410;
+extern State state1411;
+extern State state1412;
+extern State state1413;
+extern State state1414;
+extern State state1415;
+extern State state1416;
+extern State state1417;
+extern State state1418;
+extern State state1419;
+extern State state1420;
+extern State state1421;
+extern State state1422;
+extern State state1423;
+extern State state1424;
+extern State state1425;
+extern State state1426;
+extern State state1427;
+extern State state1428;
+extern State state1429;
+extern State state1430;
+extern State state1431;
+extern State state1432;
+extern State state1433;
+extern State state1434;
+extern State state1435;
+extern State state1436;
+extern State state1437;
+extern State state1438;
+extern State state1439;
+extern State state1440;
+extern State state1441;
+extern State state1442;
+extern State state1443;
+extern State state1444;
+extern State state1445;
+extern State state1446;
+extern State state1447;
+extern State state1448;
+extern State state1449;
+extern State state1450;
+extern State state1451;
+extern State state1452;
+extern State state1453;
+extern State state1454;
+extern State state1455;
+extern State state1456;
+extern State state1457;
+extern State state1458;
+extern State state1459;
+extern State state1460;
+extern State state1461;
+extern State state1462;
+extern State state1463;
+extern State state1464;
+extern State state1465;
+extern State state1466;
+extern State state1467;
+extern State state1468;
+extern State state1469;
+extern State state1470;
+extern State state1471;
+extern State state1472;
+extern State state1473;
+extern State state1474;
+extern State state1475;
+extern State state1476;
+extern State state1477;
+extern State state1478;
+extern State state1479;
+extern State state1480;
+extern State state1481;
+extern State state1482;
+extern State state1483;
+extern State state1484;
+extern State state1485;
+extern State state1486;
+extern State state1487;
+extern State state1488;
+extern State state1489;
+extern State state1490;
+extern State state1491;
+extern State state1492;
+extern State state1493;
+extern State state1494;
+extern State state1495;
+extern State state1496;
+extern State state1497;
+extern State state1498;
+extern State state1499;
+extern State state1500;
+extern State state1501;
+extern State state1502;
+extern State state1503;
+extern State state1504;
+extern State state1505;
+extern State state1506;
+extern State state1507;
+extern State state1508;
+extern State state1509;
+extern State state1510;
+extern State state1511;
+extern State state1512;
+extern State state1513;
+extern State state1514;
+extern State state1515;
+extern State state1516;
+extern State state1517;
+extern State state1518;
+extern State state1519;
+extern State state1520;
+extern State state1521;
+extern State state1522;
+extern State state1523;
+extern State state1524;
+extern State state1525;
+extern State state1526;
+extern State state1527;
+extern State state1528;
+extern State state1529;
+extern State state1530;
+extern State state1531;
+extern State state1532;
+extern State state1533;
+extern State state1534;
+extern State state1535;
+extern State state1536;
+extern State state1537;
+extern State state1538;
+extern State state1539;
+extern State state1540;
+extern State state1541;
+extern State state1542;
+extern State state1543;
+extern State state1544;
+extern State state1545;
+extern State state1546;
+extern State state1547;
+extern State state1548;
+extern State state1549;
+extern State state1550;
+extern State state1551;
+extern State state1552;
+extern State state1553;
+extern State state1554;
+extern State state1555;
+extern State state1556;
+extern State state1557;
+extern State state1558;
+extern State state1559;
+extern State state1560;
+extern State state1561;
+extern State state1562;
+extern State state1563;
+extern State state1564;
+extern State state1565;
+extern State state1566;
+extern State state1567;
+extern State state1568;
+extern State state1569;
+extern State state1570;
+extern State state1571;
+extern State state1572;
+extern State state1573;
+extern State state1574;
+extern State state1575;
+extern State state1576;
+extern State state1577;
+extern State state1578;
+extern State state1579;
+extern State state1580;
+extern State state1581;
+extern State state1582;
+extern State state1583;
+extern State state1584;
+extern State state1585;
+extern State state1586;
+extern State state1587;
+extern State state1588;
+extern State state1589;
+extern State state1590;
+extern State state1591;
+extern State state1592;
+extern State state1593;
+extern State state1594;
+extern State state1595;
+extern State state1596;
+extern State state1597;
+extern State state1598;
+extern State state1599;
+extern State state1600;
+extern State state1601;
+extern State state1602;
+extern State state1603;
+extern State state1604;
+extern State state1605;
+extern State state1606;
+extern State state1607;
+extern State state1608;
+extern State state1609;
+extern State state1610;
+extern State state1611;
+extern State state1612;
+extern State state1613;
+extern State state1614;
+extern State state1615;
+extern State state1616;
+extern State state1617;
+extern State state1618;
+extern State state1619;
+extern State state1620;
+extern State state1621;
+extern State state1622;
+extern State state1623;
+extern State state1624;
+extern State state1625;
+extern State state1626;
+extern State state1627;
+extern State state1628;
+extern State state1629;
+extern State state1630;
+extern State state1631;
+extern State state1632;
+extern State state1633;
+extern State state1634;
+extern State state1635;
+extern State state1636;
+extern State state1637;
+extern State state1638;
+extern State state1639;
+extern State state1640;
+extern State state1641;
+extern State state1642;
+extern State state1643;
+extern State state1644;
+extern State state1645;
+extern State state1646;
+extern State state1647;
+extern State state1648;
+extern State state1649;
+extern State state1650;
+extern State state1651;
+extern State state1652;
+extern State state1653;
+extern State state1654;
+extern State state1655;
+extern State state1656;
+extern State state1657;
+extern State state1658;
+extern State state1659;
+extern State state1660;
+extern State state1661;
+extern State state1662;
+extern State state1663;
+extern State state1664;
+extern State state1665;
+extern State state1666;
+extern State state1667;
+extern State state1668;
+extern State state1669;
+extern State state1670;
+extern State state1671;
+extern State state1672;
+extern State state1673;
+extern State state1674;
+extern State state1675;
+extern State state1676;
+extern State state1677;
+extern State state1678;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term66, &state3}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term69, &state1676}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term67, &state5}, {&term68, &state6}, {&term71, &state7}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {};
+std::vector<Reduce> reduce4 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift5 = {};
+std::vector<Reduce> reduce5 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift6 = {{&term66, &state1674}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {};
+std::vector<Reduce> reduce7 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift8 = {{&term1, &state9}, {&term66, &state10}, {&term72, &state11}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term69, &state1671}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term67, &state13}, {&term68, &state14}, {&term71, &state15}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {};
+std::vector<Reduce> reduce11 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift12 = {};
+std::vector<Reduce> reduce12 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift13 = {};
+std::vector<Reduce> reduce13 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift14 = {{&term66, &state1669}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {};
+std::vector<Reduce> reduce15 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift16 = {{&term2, &state17}, {&term66, &state18}, {&term72, &state19}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term69, &state1666}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term67, &state21}, {&term68, &state22}, {&term71, &state23}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {};
+std::vector<Reduce> reduce19 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift20 = {};
+std::vector<Reduce> reduce20 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift21 = {};
+std::vector<Reduce> reduce21 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift22 = {{&term66, &state1664}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {};
+std::vector<Reduce> reduce23 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift24 = {{&term3, &state25}, {&term66, &state26}, {&term72, &state27}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term69, &state1661}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term67, &state29}, {&term68, &state30}, {&term71, &state31}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {};
+std::vector<Reduce> reduce27 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift28 = {};
+std::vector<Reduce> reduce28 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift29 = {};
+std::vector<Reduce> reduce29 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift30 = {{&term66, &state1659}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {};
+std::vector<Reduce> reduce31 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift32 = {{&term4, &state33}, {&term66, &state34}, {&term72, &state35}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term69, &state1656}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term67, &state37}, {&term68, &state38}, {&term71, &state39}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {};
+std::vector<Reduce> reduce35 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift36 = {};
+std::vector<Reduce> reduce36 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift37 = {};
+std::vector<Reduce> reduce37 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift38 = {{&term66, &state1654}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {};
+std::vector<Reduce> reduce39 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift40 = {{&term5, &state41}, {&term66, &state42}, {&term72, &state43}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term69, &state1651}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term67, &state45}, {&term68, &state46}, {&term71, &state47}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {};
+std::vector<Reduce> reduce43 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift44 = {};
+std::vector<Reduce> reduce44 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift45 = {};
+std::vector<Reduce> reduce45 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift46 = {{&term66, &state1649}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {};
+std::vector<Reduce> reduce47 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift48 = {{&term6, &state49}, {&term66, &state50}, {&term72, &state51}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term69, &state1646}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term67, &state53}, {&term68, &state54}, {&term71, &state55}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {};
+std::vector<Reduce> reduce51 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift52 = {};
+std::vector<Reduce> reduce52 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift53 = {};
+std::vector<Reduce> reduce53 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift54 = {{&term66, &state1644}};
+std::vector<Reduce> reduce54 = {};
+std::vector<Shift> shift55 = {};
+std::vector<Reduce> reduce55 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift56 = {{&term7, &state57}, {&term66, &state58}, {&term72, &state59}};
+std::vector<Reduce> reduce56 = {};
+std::vector<Shift> shift57 = {{&term69, &state1641}};
+std::vector<Reduce> reduce57 = {};
+std::vector<Shift> shift58 = {{&term67, &state61}, {&term68, &state62}, {&term71, &state63}};
+std::vector<Reduce> reduce58 = {};
+std::vector<Shift> shift59 = {};
+std::vector<Reduce> reduce59 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift60 = {};
+std::vector<Reduce> reduce60 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift61 = {};
+std::vector<Reduce> reduce61 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift62 = {{&term66, &state1639}};
+std::vector<Reduce> reduce62 = {};
+std::vector<Shift> shift63 = {};
+std::vector<Reduce> reduce63 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift64 = {{&term8, &state65}, {&term66, &state66}, {&term72, &state67}};
+std::vector<Reduce> reduce64 = {};
+std::vector<Shift> shift65 = {{&term69, &state1636}};
+std::vector<Reduce> reduce65 = {};
+std::vector<Shift> shift66 = {{&term67, &state69}, {&term68, &state70}, {&term71, &state71}};
+std::vector<Reduce> reduce66 = {};
+std::vector<Shift> shift67 = {};
+std::vector<Reduce> reduce67 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift68 = {};
+std::vector<Reduce> reduce68 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift69 = {};
+std::vector<Reduce> reduce69 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift70 = {{&term66, &state1634}};
+std::vector<Reduce> reduce70 = {};
+std::vector<Shift> shift71 = {};
+std::vector<Reduce> reduce71 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift72 = {{&term9, &state73}, {&term66, &state74}, {&term72, &state75}};
+std::vector<Reduce> reduce72 = {};
+std::vector<Shift> shift73 = {{&term69, &state1631}};
+std::vector<Reduce> reduce73 = {};
+std::vector<Shift> shift74 = {{&term67, &state77}, {&term68, &state78}, {&term71, &state79}};
+std::vector<Reduce> reduce74 = {};
+std::vector<Shift> shift75 = {};
+std::vector<Reduce> reduce75 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift76 = {};
+std::vector<Reduce> reduce76 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift77 = {};
+std::vector<Reduce> reduce77 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift78 = {{&term66, &state1629}};
+std::vector<Reduce> reduce78 = {};
+std::vector<Shift> shift79 = {};
+std::vector<Reduce> reduce79 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift80 = {{&term10, &state81}, {&term66, &state82}, {&term72, &state83}};
+std::vector<Reduce> reduce80 = {};
+std::vector<Shift> shift81 = {{&term69, &state1626}};
+std::vector<Reduce> reduce81 = {};
+std::vector<Shift> shift82 = {{&term67, &state85}, {&term68, &state86}, {&term71, &state87}};
+std::vector<Reduce> reduce82 = {};
+std::vector<Shift> shift83 = {};
+std::vector<Reduce> reduce83 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift84 = {};
+std::vector<Reduce> reduce84 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift85 = {};
+std::vector<Reduce> reduce85 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift86 = {{&term66, &state1624}};
+std::vector<Reduce> reduce86 = {};
+std::vector<Shift> shift87 = {};
+std::vector<Reduce> reduce87 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift88 = {{&term11, &state89}, {&term66, &state90}, {&term72, &state91}};
+std::vector<Reduce> reduce88 = {};
+std::vector<Shift> shift89 = {{&term69, &state1621}};
+std::vector<Reduce> reduce89 = {};
+std::vector<Shift> shift90 = {{&term67, &state93}, {&term68, &state94}, {&term71, &state95}};
+std::vector<Reduce> reduce90 = {};
+std::vector<Shift> shift91 = {};
+std::vector<Reduce> reduce91 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift92 = {};
+std::vector<Reduce> reduce92 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift93 = {};
+std::vector<Reduce> reduce93 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift94 = {{&term66, &state1619}};
+std::vector<Reduce> reduce94 = {};
+std::vector<Shift> shift95 = {};
+std::vector<Reduce> reduce95 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift96 = {{&term12, &state97}, {&term66, &state98}, {&term72, &state99}};
+std::vector<Reduce> reduce96 = {};
+std::vector<Shift> shift97 = {{&term69, &state1616}};
+std::vector<Reduce> reduce97 = {};
+std::vector<Shift> shift98 = {{&term67, &state101}, {&term68, &state102}, {&term71, &state103}};
+std::vector<Reduce> reduce98 = {};
+std::vector<Shift> shift99 = {};
+std::vector<Reduce> reduce99 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift100 = {};
+std::vector<Reduce> reduce100 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift101 = {};
+std::vector<Reduce> reduce101 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift102 = {{&term66, &state1614}};
+std::vector<Reduce> reduce102 = {};
+std::vector<Shift> shift103 = {};
+std::vector<Reduce> reduce103 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift104 = {{&term13, &state105}, {&term66, &state106}, {&term72, &state107}};
+std::vector<Reduce> reduce104 = {};
+std::vector<Shift> shift105 = {{&term69, &state1611}};
+std::vector<Reduce> reduce105 = {};
+std::vector<Shift> shift106 = {{&term67, &state109}, {&term68, &state110}, {&term71, &state111}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {};
+std::vector<Reduce> reduce107 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift108 = {};
+std::vector<Reduce> reduce108 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift109 = {};
+std::vector<Reduce> reduce109 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift110 = {{&term66, &state1609}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {};
+std::vector<Reduce> reduce111 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift112 = {{&term14, &state113}, {&term66, &state114}, {&term72, &state115}};
+std::vector<Reduce> reduce112 = {};
+std::vector<Shift> shift113 = {{&term69, &state1606}};
+std::vector<Reduce> reduce113 = {};
+std::vector<Shift> shift114 = {{&term67, &state117}, {&term68, &state118}, {&term71, &state119}};
+std::vector<Reduce> reduce114 = {};
+std::vector<Shift> shift115 = {};
+std::vector<Reduce> reduce115 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift116 = {};
+std::vector<Reduce> reduce116 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift117 = {};
+std::vector<Reduce> reduce117 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift118 = {{&term66, &state1604}};
+std::vector<Reduce> reduce118 = {};
+std::vector<Shift> shift119 = {};
+std::vector<Reduce> reduce119 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift120 = {{&term15, &state121}, {&term66, &state122}, {&term72, &state123}};
+std::vector<Reduce> reduce120 = {};
+std::vector<Shift> shift121 = {{&term69, &state1601}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift122 = {{&term67, &state125}, {&term68, &state126}, {&term71, &state127}};
+std::vector<Reduce> reduce122 = {};
+std::vector<Shift> shift123 = {};
+std::vector<Reduce> reduce123 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift124 = {};
+std::vector<Reduce> reduce124 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift125 = {};
+std::vector<Reduce> reduce125 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift126 = {{&term66, &state1599}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {};
+std::vector<Reduce> reduce127 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift128 = {{&term16, &state129}, {&term66, &state130}, {&term72, &state131}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term69, &state1596}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term67, &state133}, {&term68, &state134}, {&term71, &state135}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {};
+std::vector<Reduce> reduce131 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift132 = {};
+std::vector<Reduce> reduce132 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift133 = {};
+std::vector<Reduce> reduce133 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift134 = {{&term66, &state1594}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {};
+std::vector<Reduce> reduce135 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift136 = {{&term17, &state137}, {&term66, &state138}, {&term72, &state139}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term69, &state1591}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term67, &state141}, {&term68, &state142}, {&term71, &state143}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {};
+std::vector<Reduce> reduce139 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift140 = {};
+std::vector<Reduce> reduce140 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift141 = {};
+std::vector<Reduce> reduce141 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift142 = {{&term66, &state1589}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {};
+std::vector<Reduce> reduce143 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift144 = {{&term18, &state145}, {&term66, &state146}, {&term72, &state147}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term69, &state1586}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term67, &state149}, {&term68, &state150}, {&term71, &state151}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {};
+std::vector<Reduce> reduce147 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift148 = {};
+std::vector<Reduce> reduce148 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift149 = {};
+std::vector<Reduce> reduce149 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift150 = {{&term66, &state1584}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {};
+std::vector<Reduce> reduce151 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift152 = {{&term19, &state153}, {&term66, &state154}, {&term72, &state155}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term69, &state1581}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term67, &state157}, {&term68, &state158}, {&term71, &state159}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {};
+std::vector<Reduce> reduce155 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift156 = {};
+std::vector<Reduce> reduce156 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift157 = {};
+std::vector<Reduce> reduce157 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift158 = {{&term66, &state1579}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {};
+std::vector<Reduce> reduce159 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift160 = {{&term20, &state161}, {&term66, &state162}, {&term72, &state163}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term69, &state1576}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term67, &state165}, {&term68, &state166}, {&term71, &state167}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {};
+std::vector<Reduce> reduce163 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift164 = {};
+std::vector<Reduce> reduce164 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift165 = {};
+std::vector<Reduce> reduce165 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift166 = {{&term66, &state1574}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {};
+std::vector<Reduce> reduce167 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift168 = {{&term21, &state169}, {&term66, &state170}, {&term72, &state171}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term69, &state1571}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term67, &state173}, {&term68, &state174}, {&term71, &state175}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {};
+std::vector<Reduce> reduce171 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift172 = {};
+std::vector<Reduce> reduce172 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift173 = {};
+std::vector<Reduce> reduce173 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift174 = {{&term66, &state1569}};
+std::vector<Reduce> reduce174 = {};
+std::vector<Shift> shift175 = {};
+std::vector<Reduce> reduce175 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift176 = {{&term22, &state177}, {&term66, &state178}, {&term72, &state179}};
+std::vector<Reduce> reduce176 = {};
+std::vector<Shift> shift177 = {{&term69, &state1566}};
+std::vector<Reduce> reduce177 = {};
+std::vector<Shift> shift178 = {{&term67, &state181}, {&term68, &state182}, {&term71, &state183}};
+std::vector<Reduce> reduce178 = {};
+std::vector<Shift> shift179 = {};
+std::vector<Reduce> reduce179 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift180 = {};
+std::vector<Reduce> reduce180 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift181 = {};
+std::vector<Reduce> reduce181 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift182 = {{&term66, &state1564}};
+std::vector<Reduce> reduce182 = {};
+std::vector<Shift> shift183 = {};
+std::vector<Reduce> reduce183 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift184 = {{&term23, &state185}, {&term66, &state186}, {&term72, &state187}};
+std::vector<Reduce> reduce184 = {};
+std::vector<Shift> shift185 = {{&term69, &state1561}};
+std::vector<Reduce> reduce185 = {};
+std::vector<Shift> shift186 = {{&term67, &state189}, {&term68, &state190}, {&term71, &state191}};
+std::vector<Reduce> reduce186 = {};
+std::vector<Shift> shift187 = {};
+std::vector<Reduce> reduce187 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift188 = {};
+std::vector<Reduce> reduce188 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift189 = {};
+std::vector<Reduce> reduce189 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift190 = {{&term66, &state1559}};
+std::vector<Reduce> reduce190 = {};
+std::vector<Shift> shift191 = {};
+std::vector<Reduce> reduce191 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift192 = {{&term24, &state193}, {&term66, &state194}, {&term72, &state195}};
+std::vector<Reduce> reduce192 = {};
+std::vector<Shift> shift193 = {{&term69, &state1556}};
+std::vector<Reduce> reduce193 = {};
+std::vector<Shift> shift194 = {{&term67, &state197}, {&term68, &state198}, {&term71, &state199}};
+std::vector<Reduce> reduce194 = {};
+std::vector<Shift> shift195 = {};
+std::vector<Reduce> reduce195 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift196 = {};
+std::vector<Reduce> reduce196 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift197 = {};
+std::vector<Reduce> reduce197 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift198 = {{&term66, &state1554}};
+std::vector<Reduce> reduce198 = {};
+std::vector<Shift> shift199 = {};
+std::vector<Reduce> reduce199 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift200 = {{&term25, &state201}, {&term66, &state202}, {&term72, &state203}};
+std::vector<Reduce> reduce200 = {};
+std::vector<Shift> shift201 = {{&term69, &state1551}};
+std::vector<Reduce> reduce201 = {};
+std::vector<Shift> shift202 = {{&term67, &state205}, {&term68, &state206}, {&term71, &state207}};
+std::vector<Reduce> reduce202 = {};
+std::vector<Shift> shift203 = {};
+std::vector<Reduce> reduce203 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift204 = {};
+std::vector<Reduce> reduce204 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift205 = {};
+std::vector<Reduce> reduce205 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift206 = {{&term66, &state1549}};
+std::vector<Reduce> reduce206 = {};
+std::vector<Shift> shift207 = {};
+std::vector<Reduce> reduce207 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift208 = {{&term26, &state209}, {&term66, &state210}, {&term72, &state211}};
+std::vector<Reduce> reduce208 = {};
+std::vector<Shift> shift209 = {{&term69, &state1546}};
+std::vector<Reduce> reduce209 = {};
+std::vector<Shift> shift210 = {{&term67, &state213}, {&term68, &state214}, {&term71, &state215}};
+std::vector<Reduce> reduce210 = {};
+std::vector<Shift> shift211 = {};
+std::vector<Reduce> reduce211 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift212 = {};
+std::vector<Reduce> reduce212 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift213 = {};
+std::vector<Reduce> reduce213 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift214 = {{&term66, &state1544}};
+std::vector<Reduce> reduce214 = {};
+std::vector<Shift> shift215 = {};
+std::vector<Reduce> reduce215 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift216 = {{&term27, &state217}, {&term66, &state218}, {&term72, &state219}};
+std::vector<Reduce> reduce216 = {};
+std::vector<Shift> shift217 = {{&term69, &state1541}};
+std::vector<Reduce> reduce217 = {};
+std::vector<Shift> shift218 = {{&term67, &state221}, {&term68, &state222}, {&term71, &state223}};
+std::vector<Reduce> reduce218 = {};
+std::vector<Shift> shift219 = {};
+std::vector<Reduce> reduce219 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift220 = {};
+std::vector<Reduce> reduce220 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift221 = {};
+std::vector<Reduce> reduce221 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift222 = {{&term66, &state1539}};
+std::vector<Reduce> reduce222 = {};
+std::vector<Shift> shift223 = {};
+std::vector<Reduce> reduce223 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift224 = {{&term28, &state225}, {&term66, &state226}, {&term72, &state227}};
+std::vector<Reduce> reduce224 = {};
+std::vector<Shift> shift225 = {{&term69, &state1536}};
+std::vector<Reduce> reduce225 = {};
+std::vector<Shift> shift226 = {{&term67, &state229}, {&term68, &state230}, {&term71, &state231}};
+std::vector<Reduce> reduce226 = {};
+std::vector<Shift> shift227 = {};
+std::vector<Reduce> reduce227 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift228 = {};
+std::vector<Reduce> reduce228 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift229 = {};
+std::vector<Reduce> reduce229 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift230 = {{&term66, &state1534}};
+std::vector<Reduce> reduce230 = {};
+std::vector<Shift> shift231 = {};
+std::vector<Reduce> reduce231 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift232 = {{&term29, &state233}, {&term66, &state234}, {&term72, &state235}};
+std::vector<Reduce> reduce232 = {};
+std::vector<Shift> shift233 = {{&term69, &state1531}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {{&term67, &state237}, {&term68, &state238}, {&term71, &state239}};
+std::vector<Reduce> reduce234 = {};
+std::vector<Shift> shift235 = {};
+std::vector<Reduce> reduce235 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift236 = {};
+std::vector<Reduce> reduce236 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift237 = {};
+std::vector<Reduce> reduce237 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift238 = {{&term66, &state1529}};
+std::vector<Reduce> reduce238 = {};
+std::vector<Shift> shift239 = {};
+std::vector<Reduce> reduce239 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift240 = {{&term30, &state241}, {&term66, &state242}, {&term72, &state243}};
+std::vector<Reduce> reduce240 = {};
+std::vector<Shift> shift241 = {{&term69, &state1526}};
+std::vector<Reduce> reduce241 = {};
+std::vector<Shift> shift242 = {{&term67, &state245}, {&term68, &state246}, {&term71, &state247}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {};
+std::vector<Reduce> reduce243 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift244 = {};
+std::vector<Reduce> reduce244 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift245 = {};
+std::vector<Reduce> reduce245 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift246 = {{&term66, &state1524}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {};
+std::vector<Reduce> reduce247 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift248 = {{&term31, &state249}, {&term66, &state250}, {&term72, &state251}};
+std::vector<Reduce> reduce248 = {};
+std::vector<Shift> shift249 = {{&term69, &state1521}};
+std::vector<Reduce> reduce249 = {};
+std::vector<Shift> shift250 = {{&term67, &state253}, {&term68, &state254}, {&term71, &state255}};
+std::vector<Reduce> reduce250 = {};
+std::vector<Shift> shift251 = {};
+std::vector<Reduce> reduce251 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift252 = {};
+std::vector<Reduce> reduce252 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift253 = {};
+std::vector<Reduce> reduce253 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift254 = {{&term66, &state1519}};
+std::vector<Reduce> reduce254 = {};
+std::vector<Shift> shift255 = {};
+std::vector<Reduce> reduce255 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift256 = {{&term32, &state257}, {&term66, &state258}, {&term72, &state259}};
+std::vector<Reduce> reduce256 = {};
+std::vector<Shift> shift257 = {{&term69, &state1516}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {{&term67, &state261}, {&term68, &state262}, {&term71, &state263}};
+std::vector<Reduce> reduce258 = {};
+std::vector<Shift> shift259 = {};
+std::vector<Reduce> reduce259 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift260 = {};
+std::vector<Reduce> reduce260 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift261 = {};
+std::vector<Reduce> reduce261 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift262 = {{&term66, &state1514}};
+std::vector<Reduce> reduce262 = {};
+std::vector<Shift> shift263 = {};
+std::vector<Reduce> reduce263 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift264 = {{&term33, &state265}, {&term66, &state266}, {&term72, &state267}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift265 = {{&term69, &state1511}};
+std::vector<Reduce> reduce265 = {};
+std::vector<Shift> shift266 = {{&term67, &state269}, {&term68, &state270}, {&term71, &state271}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift267 = {};
+std::vector<Reduce> reduce267 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift268 = {};
+std::vector<Reduce> reduce268 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift269 = {};
+std::vector<Reduce> reduce269 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift270 = {{&term66, &state1509}};
+std::vector<Reduce> reduce270 = {};
+std::vector<Shift> shift271 = {};
+std::vector<Reduce> reduce271 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift272 = {{&term34, &state273}, {&term66, &state274}, {&term72, &state275}};
+std::vector<Reduce> reduce272 = {};
+std::vector<Shift> shift273 = {{&term69, &state1506}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {{&term67, &state277}, {&term68, &state278}, {&term71, &state279}};
+std::vector<Reduce> reduce274 = {};
+std::vector<Shift> shift275 = {};
+std::vector<Reduce> reduce275 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift276 = {};
+std::vector<Reduce> reduce276 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift277 = {};
+std::vector<Reduce> reduce277 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift278 = {{&term66, &state1504}};
+std::vector<Reduce> reduce278 = {};
+std::vector<Shift> shift279 = {};
+std::vector<Reduce> reduce279 = {{nullptr, &rule211, false}};
+std::vector<Shift> shift280 = {{&term35, &state281}, {&term66, &state282}, {&term72, &state283}};
+std::vector<Reduce> reduce280 = {};
+std::vector<Shift> shift281 = {{&term69, &state1501}};
+std::vector<Reduce> reduce281 = {};
+std::vector<Shift> shift282 = {{&term67, &state285}, {&term68, &state286}, {&term71, &state287}};
+std::vector<Reduce> reduce282 = {};
+std::vector<Shift> shift283 = {};
+std::vector<Reduce> reduce283 = {{nullptr, &rule210, false}};
+std::vector<Shift> shift284 = {};
+std::vector<Reduce> reduce284 = {{nullptr, &rule212, false}};
+std::vector<Shift> shift285 = {};
+std::vector<Reduce> reduce285 = {{nullptr, &rule213, false}};
+std::vector<Shift> shift286 = {{&term66, &state1499}};
+std::vector<Reduce> reduce286 = {};
+std::vector<Shift> shift287 = {};
+std::vector<Reduce> reduce287 = {{nullptr, &rule217, false}};
+std::vector<Shift> shift288 = {{&term36, &state289}, {&term66, &state290}, {&term72, &state291}};
+std::vector<Reduce> reduce288 = {};
+std::vector<Shift> shift289 = {{&term69, &state1496}};
+std::vector<Reduce> reduce289 = {};
+std::vector<Shift> shift290 = {{&term67, &state293}, {&term68, &state294}, {&term71, &state295}};
+std::vector<Reduce> reduce290 = {};
+std::vector<Shift> shift291 = {};
+std::vector<Reduce> reduce291 = {{nullptr, &rule216, false}};
+std::vector<Shift> shift292 = {};
+std::vector<Reduce> reduce292 = {{nullptr, &rule218, false}};
+std::vector<Shift> shift293 = {};
+std::vector<Reduce> reduce293 = {{nullptr, &rule219, false}};
+std::vector<Shift> shift294 = {{&term66, &state1494}};
+std::vector<Reduce> reduce294 = {};
+std::vector<Shift> shift295 = {};
+std::vector<Reduce> reduce295 = {{nullptr, &rule223, false}};
+std::vector<Shift> shift296 = {{&term37, &state297}, {&term66, &state298}, {&term72, &state299}};
+std::vector<Reduce> reduce296 = {};
+std::vector<Shift> shift297 = {{&term69, &state1491}};
+std::vector<Reduce> reduce297 = {};
+std::vector<Shift> shift298 = {{&term67, &state301}, {&term68, &state302}, {&term71, &state303}};
+std::vector<Reduce> reduce298 = {};
+std::vector<Shift> shift299 = {};
+std::vector<Reduce> reduce299 = {{nullptr, &rule222, false}};
+std::vector<Shift> shift300 = {};
+std::vector<Reduce> reduce300 = {{nullptr, &rule224, false}};
+std::vector<Shift> shift301 = {};
+std::vector<Reduce> reduce301 = {{nullptr, &rule225, false}};
+std::vector<Shift> shift302 = {{&term66, &state1489}};
+std::vector<Reduce> reduce302 = {};
+std::vector<Shift> shift303 = {};
+std::vector<Reduce> reduce303 = {{nullptr, &rule229, false}};
+std::vector<Shift> shift304 = {{&term38, &state305}, {&term66, &state306}, {&term72, &state307}};
+std::vector<Reduce> reduce304 = {};
+std::vector<Shift> shift305 = {{&term69, &state1486}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {{&term67, &state309}, {&term68, &state310}, {&term71, &state311}};
+std::vector<Reduce> reduce306 = {};
+std::vector<Shift> shift307 = {};
+std::vector<Reduce> reduce307 = {{nullptr, &rule228, false}};
+std::vector<Shift> shift308 = {};
+std::vector<Reduce> reduce308 = {{nullptr, &rule230, false}};
+std::vector<Shift> shift309 = {};
+std::vector<Reduce> reduce309 = {{nullptr, &rule231, false}};
+std::vector<Shift> shift310 = {{&term66, &state1484}};
+std::vector<Reduce> reduce310 = {};
+std::vector<Shift> shift311 = {};
+std::vector<Reduce> reduce311 = {{nullptr, &rule235, false}};
+std::vector<Shift> shift312 = {{&term39, &state313}, {&term66, &state314}, {&term72, &state315}};
+std::vector<Reduce> reduce312 = {};
+std::vector<Shift> shift313 = {{&term69, &state1481}};
+std::vector<Reduce> reduce313 = {};
+std::vector<Shift> shift314 = {{&term67, &state317}, {&term68, &state318}, {&term71, &state319}};
+std::vector<Reduce> reduce314 = {};
+std::vector<Shift> shift315 = {};
+std::vector<Reduce> reduce315 = {{nullptr, &rule234, false}};
+std::vector<Shift> shift316 = {};
+std::vector<Reduce> reduce316 = {{nullptr, &rule236, false}};
+std::vector<Shift> shift317 = {};
+std::vector<Reduce> reduce317 = {{nullptr, &rule237, false}};
+std::vector<Shift> shift318 = {{&term66, &state1479}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift319 = {};
+std::vector<Reduce> reduce319 = {{nullptr, &rule241, false}};
+std::vector<Shift> shift320 = {{&term40, &state321}, {&term66, &state322}, {&term72, &state323}};
+std::vector<Reduce> reduce320 = {};
+std::vector<Shift> shift321 = {{&term69, &state1476}};
+std::vector<Reduce> reduce321 = {};
+std::vector<Shift> shift322 = {{&term67, &state325}, {&term68, &state326}, {&term71, &state327}};
+std::vector<Reduce> reduce322 = {};
+std::vector<Shift> shift323 = {};
+std::vector<Reduce> reduce323 = {{nullptr, &rule240, false}};
+std::vector<Shift> shift324 = {};
+std::vector<Reduce> reduce324 = {{nullptr, &rule242, false}};
+std::vector<Shift> shift325 = {};
+std::vector<Reduce> reduce325 = {{nullptr, &rule243, false}};
+std::vector<Shift> shift326 = {{&term66, &state1474}};
+std::vector<Reduce> reduce326 = {};
+std::vector<Shift> shift327 = {};
+std::vector<Reduce> reduce327 = {{nullptr, &rule247, false}};
+std::vector<Shift> shift328 = {{&term41, &state329}, {&term66, &state330}, {&term72, &state331}};
+std::vector<Reduce> reduce328 = {};
+std::vector<Shift> shift329 = {{&term69, &state1471}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift330 = {{&term67, &state333}, {&term68, &state334}, {&term71, &state335}};
+std::vector<Reduce> reduce330 = {};
+std::vector<Shift> shift331 = {};
+std::vector<Reduce> reduce331 = {{nullptr, &rule246, false}};
+std::vector<Shift> shift332 = {};
+std::vector<Reduce> reduce332 = {{nullptr, &rule248, false}};
+std::vector<Shift> shift333 = {};
+std::vector<Reduce> reduce333 = {{nullptr, &rule249, false}};
+std::vector<Shift> shift334 = {{&term66, &state1469}};
+std::vector<Reduce> reduce334 = {};
+std::vector<Shift> shift335 = {};
+std::vector<Reduce> reduce335 = {{nullptr, &rule253, false}};
+std::vector<Shift> shift336 = {{&term42, &state337}, {&term66, &state338}, {&term72, &state339}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {{&term69, &state1466}};
+std::vector<Reduce> reduce337 = {};
+std::vector<Shift> shift338 = {{&term67, &state341}, {&term68, &state342}, {&term71, &state343}};
+std::vector<Reduce> reduce338 = {};
+std::vector<Shift> shift339 = {};
+std::vector<Reduce> reduce339 = {{nullptr, &rule252, false}};
+std::vector<Shift> shift340 = {};
+std::vector<Reduce> reduce340 = {{nullptr, &rule254, false}};
+std::vector<Shift> shift341 = {};
+std::vector<Reduce> reduce341 = {{nullptr, &rule255, false}};
+std::vector<Shift> shift342 = {{&term66, &state1464}};
+std::vector<Reduce> reduce342 = {};
+std::vector<Shift> shift343 = {};
+std::vector<Reduce> reduce343 = {{nullptr, &rule259, false}};
+std::vector<Shift> shift344 = {{&term43, &state345}, {&term66, &state346}, {&term72, &state347}};
+std::vector<Reduce> reduce344 = {};
+std::vector<Shift> shift345 = {{&term69, &state1461}};
+std::vector<Reduce> reduce345 = {};
+std::vector<Shift> shift346 = {{&term67, &state349}, {&term68, &state350}, {&term71, &state351}};
+std::vector<Reduce> reduce346 = {};
+std::vector<Shift> shift347 = {};
+std::vector<Reduce> reduce347 = {{nullptr, &rule258, false}};
+std::vector<Shift> shift348 = {};
+std::vector<Reduce> reduce348 = {{nullptr, &rule260, false}};
+std::vector<Shift> shift349 = {};
+std::vector<Reduce> reduce349 = {{nullptr, &rule261, false}};
+std::vector<Shift> shift350 = {{&term66, &state1459}};
+std::vector<Reduce> reduce350 = {};
+std::vector<Shift> shift351 = {};
+std::vector<Reduce> reduce351 = {{nullptr, &rule265, false}};
+std::vector<Shift> shift352 = {{&term44, &state353}, {&term66, &state354}, {&term72, &state355}};
+std::vector<Reduce> reduce352 = {};
+std::vector<Shift> shift353 = {{&term69, &state1456}};
+std::vector<Reduce> reduce353 = {};
+std::vector<Shift> shift354 = {{&term67, &state357}, {&term68, &state358}, {&term71, &state359}};
+std::vector<Reduce> reduce354 = {};
+std::vector<Shift> shift355 = {};
+std::vector<Reduce> reduce355 = {{nullptr, &rule264, false}};
+std::vector<Shift> shift356 = {};
+std::vector<Reduce> reduce356 = {{nullptr, &rule266, false}};
+std::vector<Shift> shift357 = {};
+std::vector<Reduce> reduce357 = {{nullptr, &rule267, false}};
+std::vector<Shift> shift358 = {{&term66, &state1454}};
+std::vector<Reduce> reduce358 = {};
+std::vector<Shift> shift359 = {};
+std::vector<Reduce> reduce359 = {{nullptr, &rule271, false}};
+std::vector<Shift> shift360 = {{&term45, &state361}, {&term66, &state362}, {&term72, &state363}};
+std::vector<Reduce> reduce360 = {};
+std::vector<Shift> shift361 = {{&term69, &state1451}};
+std::vector<Reduce> reduce361 = {};
+std::vector<Shift> shift362 = {{&term67, &state365}, {&term68, &state366}, {&term71, &state367}};
+std::vector<Reduce> reduce362 = {};
+std::vector<Shift> shift363 = {};
+std::vector<Reduce> reduce363 = {{nullptr, &rule270, false}};
+std::vector<Shift> shift364 = {};
+std::vector<Reduce> reduce364 = {{nullptr, &rule272, false}};
+std::vector<Shift> shift365 = {};
+std::vector<Reduce> reduce365 = {{nullptr, &rule273, false}};
+std::vector<Shift> shift366 = {{&term66, &state1449}};
+std::vector<Reduce> reduce366 = {};
+std::vector<Shift> shift367 = {};
+std::vector<Reduce> reduce367 = {{nullptr, &rule277, false}};
+std::vector<Shift> shift368 = {{&term46, &state369}, {&term66, &state370}, {&term72, &state371}};
+std::vector<Reduce> reduce368 = {};
+std::vector<Shift> shift369 = {{&term69, &state1446}};
+std::vector<Reduce> reduce369 = {};
+std::vector<Shift> shift370 = {{&term67, &state373}, {&term68, &state374}, {&term71, &state375}};
+std::vector<Reduce> reduce370 = {};
+std::vector<Shift> shift371 = {};
+std::vector<Reduce> reduce371 = {{nullptr, &rule276, false}};
+std::vector<Shift> shift372 = {};
+std::vector<Reduce> reduce372 = {{nullptr, &rule278, false}};
+std::vector<Shift> shift373 = {};
+std::vector<Reduce> reduce373 = {{nullptr, &rule279, false}};
+std::vector<Shift> shift374 = {{&term66, &state1444}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift375 = {};
+std::vector<Reduce> reduce375 = {{nullptr, &rule283, false}};
+std::vector<Shift> shift376 = {{&term47, &state377}, {&term66, &state378}, {&term72, &state379}};
+std::vector<Reduce> reduce376 = {};
+std::vector<Shift> shift377 = {{&term69, &state1441}};
+std::vector<Reduce> reduce377 = {};
+std::vector<Shift> shift378 = {{&term67, &state381}, {&term68, &state382}, {&term71, &state383}};
+std::vector<Reduce> reduce378 = {};
+std::vector<Shift> shift379 = {};
+std::vector<Reduce> reduce379 = {{nullptr, &rule282, false}};
+std::vector<Shift> shift380 = {};
+std::vector<Reduce> reduce380 = {{nullptr, &rule284, false}};
+std::vector<Shift> shift381 = {};
+std::vector<Reduce> reduce381 = {{nullptr, &rule285, false}};
+std::vector<Shift> shift382 = {{&term66, &state1439}};
+std::vector<Reduce> reduce382 = {};
+std::vector<Shift> shift383 = {};
+std::vector<Reduce> reduce383 = {{nullptr, &rule289, false}};
+std::vector<Shift> shift384 = {{&term48, &state385}, {&term66, &state386}, {&term72, &state387}};
+std::vector<Reduce> reduce384 = {};
+std::vector<Shift> shift385 = {{&term69, &state1436}};
+std::vector<Reduce> reduce385 = {};
+std::vector<Shift> shift386 = {{&term67, &state389}, {&term68, &state390}, {&term71, &state391}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift387 = {};
+std::vector<Reduce> reduce387 = {{nullptr, &rule288, false}};
+std::vector<Shift> shift388 = {};
+std::vector<Reduce> reduce388 = {{nullptr, &rule290, false}};
+std::vector<Shift> shift389 = {};
+std::vector<Reduce> reduce389 = {{nullptr, &rule291, false}};
+std::vector<Shift> shift390 = {{&term66, &state1434}};
+std::vector<Reduce> reduce390 = {};
+std::vector<Shift> shift391 = {};
+std::vector<Reduce> reduce391 = {{nullptr, &rule295, false}};
+std::vector<Shift> shift392 = {{&term49, &state393}, {&term66, &state394}, {&term72, &state395}};
+std::vector<Reduce> reduce392 = {};
+std::vector<Shift> shift393 = {{&term69, &state1431}};
+std::vector<Reduce> reduce393 = {};
+std::vector<Shift> shift394 = {{&term67, &state397}, {&term68, &state398}, {&term71, &state399}};
+std::vector<Reduce> reduce394 = {};
+std::vector<Shift> shift395 = {};
+std::vector<Reduce> reduce395 = {{nullptr, &rule294, false}};
+std::vector<Shift> shift396 = {};
+std::vector<Reduce> reduce396 = {{nullptr, &rule296, false}};
+std::vector<Shift> shift397 = {};
+std::vector<Reduce> reduce397 = {{nullptr, &rule297, false}};
+std::vector<Shift> shift398 = {{&term66, &state1429}};
+std::vector<Reduce> reduce398 = {};
+std::vector<Shift> shift399 = {};
+std::vector<Reduce> reduce399 = {{nullptr, &rule301, false}};
+std::vector<Shift> shift400 = {{&term50, &state401}, {&term66, &state402}, {&term72, &state403}};
+std::vector<Reduce> reduce400 = {};
+std::vector<Shift> shift401 = {{&term69, &state1426}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {{&term67, &state405}, {&term68, &state406}, {&term71, &state407}};
+std::vector<Reduce> reduce402 = {};
+std::vector<Shift> shift403 = {};
+std::vector<Reduce> reduce403 = {{nullptr, &rule300, false}};
+std::vector<Shift> shift404 = {};
+std::vector<Reduce> reduce404 = {{nullptr, &rule302, false}};
+std::vector<Shift> shift405 = {};
+std::vector<Reduce> reduce405 = {{nullptr, &rule303, false}};
+std::vector<Shift> shift406 = {{&term66, &state1424}};
+std::vector<Reduce> reduce406 = {};
+std::vector<Shift> shift407 = {};
+std::vector<Reduce> reduce407 = {{nullptr, &rule307, false}};
+std::vector<Shift> shift408 = {{&term51, &state409}, {&term66, &state410}, {&term72, &state411}};
+std::vector<Reduce> reduce408 = {};
+std::vector<Shift> shift409 = {{&term69, &state1421}};
+std::vector<Reduce> reduce409 = {};
+std::vector<Shift> shift410 = {{&term67, &state413}, {&term68, &state414}, {&term71, &state415}};
+std::vector<Reduce> reduce410 = {};
+std::vector<Shift> shift411 = {};
+std::vector<Reduce> reduce411 = {{nullptr, &rule306, false}};
+std::vector<Shift> shift412 = {};
+std::vector<Reduce> reduce412 = {{nullptr, &rule308, false}};
+std::vector<Shift> shift413 = {};
+std::vector<Reduce> reduce413 = {{nullptr, &rule309, false}};
+std::vector<Shift> shift414 = {{&term66, &state1419}};
+std::vector<Reduce> reduce414 = {};
+std::vector<Shift> shift415 = {};
+std::vector<Reduce> reduce415 = {{nullptr, &rule313, false}};
+std::vector<Shift> shift416 = {{&term52, &state417}, {&term66, &state418}, {&term72, &state419}};
+std::vector<Reduce> reduce416 = {};
+std::vector<Shift> shift417 = {{&term69, &state1416}};
+std::vector<Reduce> reduce417 = {};
+std::vector<Shift> shift418 = {{&term67, &state421}, {&term68, &state422}, {&term71, &state423}};
+std::vector<Reduce> reduce418 = {};
+std::vector<Shift> shift419 = {};
+std::vector<Reduce> reduce419 = {{nullptr, &rule312, false}};
+std::vector<Shift> shift420 = {};
+std::vector<Reduce> reduce420 = {{nullptr, &rule314, false}};
+std::vector<Shift> shift421 = {};
+std::vector<Reduce> reduce421 = {{nullptr, &rule315, false}};
+std::vector<Shift> shift422 = {{&term66, &state1414}};
+std::vector<Reduce> reduce422 = {};
+std::vector<Shift> shift423 = {};
+std::vector<Reduce> reduce423 = {{nullptr, &rule319, false}};
+std::vector<Shift> shift424 = {{&term53, &state425}, {&term66, &state426}, {&term72, &state427}};
+std::vector<Reduce> reduce424 = {};
+std::vector<Shift> shift425 = {{&term69, &state1411}};
+std::vector<Reduce> reduce425 = {};
+std::vector<Shift> shift426 = {{&term67, &state429}, {&term68, &state430}, {&term71, &state431}};
+std::vector<Reduce> reduce426 = {};
+std::vector<Shift> shift427 = {};
+std::vector<Reduce> reduce427 = {{nullptr, &rule318, false}};
+std::vector<Shift> shift428 = {};
+std::vector<Reduce> reduce428 = {{nullptr, &rule320, false}};
+std::vector<Shift> shift429 = {};
+std::vector<Reduce> reduce429 = {{nullptr, &rule321, false}};
+std::vector<Shift> shift430 = {{&term66, &state1409}};
+std::vector<Reduce> reduce430 = {};
+std::vector<Shift> shift431 = {};
+std::vector<Reduce> reduce431 = {{nullptr, &rule325, false}};
+std::vector<Shift> shift432 = {{&term54, &state433}, {&term66, &state434}, {&term72, &state435}};
+std::vector<Reduce> reduce432 = {};
+std::vector<Shift> shift433 = {{&term69, &state1406}};
+std::vector<Reduce> reduce433 = {};
+std::vector<Shift> shift434 = {{&term67, &state437}, {&term68, &state438}, {&term71, &state439}};
+std::vector<Reduce> reduce434 = {};
+std::vector<Shift> shift435 = {};
+std::vector<Reduce> reduce435 = {{nullptr, &rule324, false}};
+std::vector<Shift> shift436 = {};
+std::vector<Reduce> reduce436 = {{nullptr, &rule326, false}};
+std::vector<Shift> shift437 = {};
+std::vector<Reduce> reduce437 = {{nullptr, &rule327, false}};
+std::vector<Shift> shift438 = {{&term66, &state1404}};
+std::vector<Reduce> reduce438 = {};
+std::vector<Shift> shift439 = {};
+std::vector<Reduce> reduce439 = {{nullptr, &rule331, false}};
+std::vector<Shift> shift440 = {{&term55, &state441}, {&term66, &state442}, {&term72, &state443}};
+std::vector<Reduce> reduce440 = {};
+std::vector<Shift> shift441 = {{&term69, &state1401}};
+std::vector<Reduce> reduce441 = {};
+std::vector<Shift> shift442 = {{&term67, &state445}, {&term68, &state446}, {&term71, &state447}};
+std::vector<Reduce> reduce442 = {};
+std::vector<Shift> shift443 = {};
+std::vector<Reduce> reduce443 = {{nullptr, &rule330, false}};
+std::vector<Shift> shift444 = {};
+std::vector<Reduce> reduce444 = {{nullptr, &rule332, false}};
+std::vector<Shift> shift445 = {};
+std::vector<Reduce> reduce445 = {{nullptr, &rule333, false}};
+std::vector<Shift> shift446 = {{&term66, &state1399}};
+std::vector<Reduce> reduce446 = {};
+std::vector<Shift> shift447 = {};
+std::vector<Reduce> reduce447 = {{nullptr, &rule337, false}};
+std::vector<Shift> shift448 = {{&term56, &state449}, {&term66, &state450}, {&term72, &state451}};
+std::vector<Reduce> reduce448 = {};
+std::vector<Shift> shift449 = {{&term69, &state1396}};
+std::vector<Reduce> reduce449 = {};
+std::vector<Shift> shift450 = {{&term67, &state453}, {&term68, &state454}, {&term71, &state455}};
+std::vector<Reduce> reduce450 = {};
+std::vector<Shift> shift451 = {};
+std::vector<Reduce> reduce451 = {{nullptr, &rule336, false}};
+std::vector<Shift> shift452 = {};
+std::vector<Reduce> reduce452 = {{nullptr, &rule338, false}};
+std::vector<Shift> shift453 = {};
+std::vector<Reduce> reduce453 = {{nullptr, &rule339, false}};
+std::vector<Shift> shift454 = {{&term66, &state1394}};
+std::vector<Reduce> reduce454 = {};
+std::vector<Shift> shift455 = {};
+std::vector<Reduce> reduce455 = {{nullptr, &rule343, false}};
+std::vector<Shift> shift456 = {{&term57, &state457}, {&term66, &state458}, {&term72, &state459}};
+std::vector<Reduce> reduce456 = {};
+std::vector<Shift> shift457 = {{&term69, &state1391}};
+std::vector<Reduce> reduce457 = {};
+std::vector<Shift> shift458 = {{&term67, &state461}, {&term68, &state462}, {&term71, &state463}};
+std::vector<Reduce> reduce458 = {};
+std::vector<Shift> shift459 = {};
+std::vector<Reduce> reduce459 = {{nullptr, &rule342, false}};
+std::vector<Shift> shift460 = {};
+std::vector<Reduce> reduce460 = {{nullptr, &rule344, false}};
+std::vector<Shift> shift461 = {};
+std::vector<Reduce> reduce461 = {{nullptr, &rule345, false}};
+std::vector<Shift> shift462 = {{&term66, &state1389}};
+std::vector<Reduce> reduce462 = {};
+std::vector<Shift> shift463 = {};
+std::vector<Reduce> reduce463 = {{nullptr, &rule349, false}};
+std::vector<Shift> shift464 = {{&term58, &state465}, {&term66, &state466}, {&term72, &state467}};
+std::vector<Reduce> reduce464 = {};
+std::vector<Shift> shift465 = {{&term69, &state1386}};
+std::vector<Reduce> reduce465 = {};
+std::vector<Shift> shift466 = {{&term67, &state469}, {&term68, &state470}, {&term71, &state471}};
+std::vector<Reduce> reduce466 = {};
+std::vector<Shift> shift467 = {};
+std::vector<Reduce> reduce467 = {{nullptr, &rule348, false}};
+std::vector<Shift> shift468 = {};
+std::vector<Reduce> reduce468 = {{nullptr, &rule350, false}};
+std::vector<Shift> shift469 = {};
+std::vector<Reduce> reduce469 = {{nullptr, &rule351, false}};
+std::vector<Shift> shift470 = {{&term66, &state1384}};
+std::vector<Reduce> reduce470 = {};
+std::vector<Shift> shift471 = {};
+std::vector<Reduce> reduce471 = {{nullptr, &rule355, false}};
+std::vector<Shift> shift472 = {{&term59, &state473}, {&term66, &state474}, {&term72, &state475}};
+std::vector<Reduce> reduce472 = {};
+std::vector<Shift> shift473 = {{&term69, &state1381}};
+std::vector<Reduce> reduce473 = {};
+std::vector<Shift> shift474 = {{&term67, &state477}, {&term68, &state478}, {&term71, &state479}};
+std::vector<Reduce> reduce474 = {};
+std::vector<Shift> shift475 = {};
+std::vector<Reduce> reduce475 = {{nullptr, &rule354, false}};
+std::vector<Shift> shift476 = {};
+std::vector<Reduce> reduce476 = {{nullptr, &rule356, false}};
+std::vector<Shift> shift477 = {};
+std::vector<Reduce> reduce477 = {{nullptr, &rule357, false}};
+std::vector<Shift> shift478 = {{&term66, &state1379}};
+std::vector<Reduce> reduce478 = {};
+std::vector<Shift> shift479 = {};
+std::vector<Reduce> reduce479 = {{nullptr, &rule361, false}};
+std::vector<Shift> shift480 = {{&term60, &state481}, {&term66, &state482}, {&term72, &state483}};
+std::vector<Reduce> reduce480 = {};
+std::vector<Shift> shift481 = {{&term69, &state1376}};
+std::vector<Reduce> reduce481 = {};
+std::vector<Shift> shift482 = {{&term67, &state485}, {&term68, &state486}, {&term71, &state487}};
+std::vector<Reduce> reduce482 = {};
+std::vector<Shift> shift483 = {};
+std::vector<Reduce> reduce483 = {{nullptr, &rule360, false}};
+std::vector<Shift> shift484 = {};
+std::vector<Reduce> reduce484 = {{nullptr, &rule362, false}};
+std::vector<Shift> shift485 = {};
+std::vector<Reduce> reduce485 = {{nullptr, &rule363, false}};
+std::vector<Shift> shift486 = {{&term66, &state1374}};
+std::vector<Reduce> reduce486 = {};
+std::vector<Shift> shift487 = {};
+std::vector<Reduce> reduce487 = {{nullptr, &rule367, false}};
+std::vector<Shift> shift488 = {{&term61, &state489}, {&term66, &state490}, {&term72, &state491}};
+std::vector<Reduce> reduce488 = {};
+std::vector<Shift> shift489 = {{&term69, &state1371}};
+std::vector<Reduce> reduce489 = {};
+std::vector<Shift> shift490 = {{&term67, &state493}, {&term68, &state494}, {&term71, &state495}};
+std::vector<Reduce> reduce490 = {};
+std::vector<Shift> shift491 = {};
+std::vector<Reduce> reduce491 = {{nullptr, &rule366, false}};
+std::vector<Shift> shift492 = {};
+std::vector<Reduce> reduce492 = {{nullptr, &rule368, false}};
+std::vector<Shift> shift493 = {};
+std::vector<Reduce> reduce493 = {{nullptr, &rule369, false}};
+std::vector<Shift> shift494 = {{&term66, &state1369}};
+std::vector<Reduce> reduce494 = {};
+std::vector<Shift> shift495 = {};
+std::vector<Reduce> reduce495 = {{nullptr, &rule373, false}};
+std::vector<Shift> shift496 = {{&term62, &state497}, {&term66, &state498}, {&term72, &state499}};
+std::vector<Reduce> reduce496 = {};
+std::vector<Shift> shift497 = {{&term69, &state1366}};
+std::vector<Reduce> reduce497 = {};
+std::vector<Shift> shift498 = {{&term67, &state501}, {&term68, &state502}, {&term71, &state503}};
+std::vector<Reduce> reduce498 = {};
+std::vector<Shift> shift499 = {};
+std::vector<Reduce> reduce499 = {{nullptr, &rule372, false}};
+std::vector<Shift> shift500 = {};
+std::vector<Reduce> reduce500 = {{nullptr, &rule374, false}};
+std::vector<Shift> shift501 = {};
+std::vector<Reduce> reduce501 = {{nullptr, &rule375, false}};
+std::vector<Shift> shift502 = {{&term66, &state1364}};
+std::vector<Reduce> reduce502 = {};
+std::vector<Shift> shift503 = {};
+std::vector<Reduce> reduce503 = {{nullptr, &rule379, false}};
+std::vector<Shift> shift504 = {{&term63, &state505}, {&term66, &state506}, {&term72, &state507}};
+std::vector<Reduce> reduce504 = {};
+std::vector<Shift> shift505 = {{&term69, &state1361}};
+std::vector<Reduce> reduce505 = {};
+std::vector<Shift> shift506 = {{&term67, &state509}, {&term68, &state510}, {&term71, &state511}};
+std::vector<Reduce> reduce506 = {};
+std::vector<Shift> shift507 = {};
+std::vector<Reduce> reduce507 = {{nullptr, &rule378, false}};
+std::vector<Shift> shift508 = {};
+std::vector<Reduce> reduce508 = {{nullptr, &rule380, false}};
+std::vector<Shift> shift509 = {};
+std::vector<Reduce> reduce509 = {{nullptr, &rule381, false}};
+std::vector<Shift> shift510 = {{&term66, &state1359}};
+std::vector<Reduce> reduce510 = {};
+std::vector<Shift> shift512 = {{&term0, &state513}, {&term66, &state514}, {&term72, &state515}};
+std::vector<Reduce> reduce512 = {};
+std::vector<Shift> shift513 = {{&term69, &state524}};
+std::vector<Reduce> reduce513 = {};
+std::vector<Shift> shift514 = {{&term67, &state517}, {&term68, &state518}, {&term71, &state519}};
+std::vector<Reduce> reduce514 = {};
+std::vector<Shift> shift515 = {};
+std::vector<Reduce> reduce515 = {{nullptr, &rule384, false}};
+std::vector<Shift> shift518 = {{&term66, &state522}};
+std::vector<Reduce> reduce518 = {};
+std::vector<Shift> shift520 = {{&term1, &state9}, {&term66, &state10}, {&term72, &state521}};
+std::vector<Reduce> reduce520 = {};
+std::vector<Shift> shift522 = {{&term67, &state523}};
+std::vector<Reduce> reduce522 = {};
+std::vector<Shift> shift523 = {};
+std::vector<Reduce> reduce523 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift525 = {{&term1, &state526}, {&term66, &state527}, {&term70, &state528}};
+std::vector<Reduce> reduce525 = {};
+std::vector<Shift> shift526 = {{&term69, &state537}};
+std::vector<Reduce> reduce526 = {};
+std::vector<Shift> shift527 = {{&term67, &state530}, {&term68, &state531}, {&term71, &state532}};
+std::vector<Reduce> reduce527 = {};
+std::vector<Shift> shift528 = {};
+std::vector<Reduce> reduce528 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift531 = {{&term66, &state535}};
+std::vector<Reduce> reduce531 = {};
+std::vector<Shift> shift533 = {{&term2, &state17}, {&term66, &state18}, {&term72, &state534}};
+std::vector<Reduce> reduce533 = {};
+std::vector<Shift> shift535 = {{&term67, &state536}};
+std::vector<Reduce> reduce535 = {};
+std::vector<Shift> shift536 = {};
+std::vector<Reduce> reduce536 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift538 = {{&term2, &state539}, {&term66, &state540}, {&term70, &state541}};
+std::vector<Reduce> reduce538 = {};
+std::vector<Shift> shift539 = {{&term69, &state550}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {{&term67, &state543}, {&term68, &state544}, {&term71, &state545}};
+std::vector<Reduce> reduce540 = {};
+std::vector<Shift> shift541 = {};
+std::vector<Reduce> reduce541 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift544 = {{&term66, &state548}};
+std::vector<Reduce> reduce544 = {};
+std::vector<Shift> shift546 = {{&term3, &state25}, {&term66, &state26}, {&term72, &state547}};
+std::vector<Reduce> reduce546 = {};
+std::vector<Shift> shift548 = {{&term67, &state549}};
+std::vector<Reduce> reduce548 = {};
+std::vector<Shift> shift549 = {};
+std::vector<Reduce> reduce549 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift551 = {{&term3, &state552}, {&term66, &state553}, {&term70, &state554}};
+std::vector<Reduce> reduce551 = {};
+std::vector<Shift> shift552 = {{&term69, &state563}};
+std::vector<Reduce> reduce552 = {};
+std::vector<Shift> shift553 = {{&term67, &state556}, {&term68, &state557}, {&term71, &state558}};
+std::vector<Reduce> reduce553 = {};
+std::vector<Shift> shift554 = {};
+std::vector<Reduce> reduce554 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift557 = {{&term66, &state561}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift559 = {{&term4, &state33}, {&term66, &state34}, {&term72, &state560}};
+std::vector<Reduce> reduce559 = {};
+std::vector<Shift> shift561 = {{&term67, &state562}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift562 = {};
+std::vector<Reduce> reduce562 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift564 = {{&term4, &state565}, {&term66, &state566}, {&term70, &state567}};
+std::vector<Reduce> reduce564 = {};
+std::vector<Shift> shift565 = {{&term69, &state576}};
+std::vector<Reduce> reduce565 = {};
+std::vector<Shift> shift566 = {{&term67, &state569}, {&term68, &state570}, {&term71, &state571}};
+std::vector<Reduce> reduce566 = {};
+std::vector<Shift> shift567 = {};
+std::vector<Reduce> reduce567 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift570 = {{&term66, &state574}};
+std::vector<Reduce> reduce570 = {};
+std::vector<Shift> shift572 = {{&term5, &state41}, {&term66, &state42}, {&term72, &state573}};
+std::vector<Reduce> reduce572 = {};
+std::vector<Shift> shift574 = {{&term67, &state575}};
+std::vector<Reduce> reduce574 = {};
+std::vector<Shift> shift575 = {};
+std::vector<Reduce> reduce575 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift577 = {{&term5, &state578}, {&term66, &state579}, {&term70, &state580}};
+std::vector<Reduce> reduce577 = {};
+std::vector<Shift> shift578 = {{&term69, &state589}};
+std::vector<Reduce> reduce578 = {};
+std::vector<Shift> shift579 = {{&term67, &state582}, {&term68, &state583}, {&term71, &state584}};
+std::vector<Reduce> reduce579 = {};
+std::vector<Shift> shift580 = {};
+std::vector<Reduce> reduce580 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift583 = {{&term66, &state587}};
+std::vector<Reduce> reduce583 = {};
+std::vector<Shift> shift585 = {{&term6, &state49}, {&term66, &state50}, {&term72, &state586}};
+std::vector<Reduce> reduce585 = {};
+std::vector<Shift> shift587 = {{&term67, &state588}};
+std::vector<Reduce> reduce587 = {};
+std::vector<Shift> shift588 = {};
+std::vector<Reduce> reduce588 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift590 = {{&term6, &state591}, {&term66, &state592}, {&term70, &state593}};
+std::vector<Reduce> reduce590 = {};
+std::vector<Shift> shift591 = {{&term69, &state602}};
+std::vector<Reduce> reduce591 = {};
+std::vector<Shift> shift592 = {{&term67, &state595}, {&term68, &state596}, {&term71, &state597}};
+std::vector<Reduce> reduce592 = {};
+std::vector<Shift> shift593 = {};
+std::vector<Reduce> reduce593 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift596 = {{&term66, &state600}};
+std::vector<Reduce> reduce596 = {};
+std::vector<Shift> shift598 = {{&term7, &state57}, {&term66, &state58}, {&term72, &state599}};
+std::vector<Reduce> reduce598 = {};
+std::vector<Shift> shift600 = {{&term67, &state601}};
+std::vector<Reduce> reduce600 = {};
+std::vector<Shift> shift601 = {};
+std::vector<Reduce> reduce601 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift603 = {{&term7, &state604}, {&term66, &state605}, {&term70, &state606}};
+std::vector<Reduce> reduce603 = {};
+std::vector<Shift> shift604 = {{&term69, &state615}};
+std::vector<Reduce> reduce604 = {};
+std::vector<Shift> shift605 = {{&term67, &state608}, {&term68, &state609}, {&term71, &state610}};
+std::vector<Reduce> reduce605 = {};
+std::vector<Shift> shift606 = {};
+std::vector<Reduce> reduce606 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift609 = {{&term66, &state613}};
+std::vector<Reduce> reduce609 = {};
+std::vector<Shift> shift611 = {{&term8, &state65}, {&term66, &state66}, {&term72, &state612}};
+std::vector<Reduce> reduce611 = {};
+std::vector<Shift> shift613 = {{&term67, &state614}};
+std::vector<Reduce> reduce613 = {};
+std::vector<Shift> shift614 = {};
+std::vector<Reduce> reduce614 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift616 = {{&term8, &state617}, {&term66, &state618}, {&term70, &state619}};
+std::vector<Reduce> reduce616 = {};
+std::vector<Shift> shift617 = {{&term69, &state628}};
+std::vector<Reduce> reduce617 = {};
+std::vector<Shift> shift618 = {{&term67, &state621}, {&term68, &state622}, {&term71, &state623}};
+std::vector<Reduce> reduce618 = {};
+std::vector<Shift> shift619 = {};
+std::vector<Reduce> reduce619 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift622 = {{&term66, &state626}};
+std::vector<Reduce> reduce622 = {};
+std::vector<Shift> shift624 = {{&term9, &state73}, {&term66, &state74}, {&term72, &state625}};
+std::vector<Reduce> reduce624 = {};
+std::vector<Shift> shift626 = {{&term67, &state627}};
+std::vector<Reduce> reduce626 = {};
+std::vector<Shift> shift627 = {};
+std::vector<Reduce> reduce627 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift629 = {{&term9, &state630}, {&term66, &state631}, {&term70, &state632}};
+std::vector<Reduce> reduce629 = {};
+std::vector<Shift> shift630 = {{&term69, &state641}};
+std::vector<Reduce> reduce630 = {};
+std::vector<Shift> shift631 = {{&term67, &state634}, {&term68, &state635}, {&term71, &state636}};
+std::vector<Reduce> reduce631 = {};
+std::vector<Shift> shift632 = {};
+std::vector<Reduce> reduce632 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift635 = {{&term66, &state639}};
+std::vector<Reduce> reduce635 = {};
+std::vector<Shift> shift637 = {{&term10, &state81}, {&term66, &state82}, {&term72, &state638}};
+std::vector<Reduce> reduce637 = {};
+std::vector<Shift> shift639 = {{&term67, &state640}};
+std::vector<Reduce> reduce639 = {};
+std::vector<Shift> shift640 = {};
+std::vector<Reduce> reduce640 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift642 = {{&term10, &state643}, {&term66, &state644}, {&term70, &state645}};
+std::vector<Reduce> reduce642 = {};
+std::vector<Shift> shift643 = {{&term69, &state654}};
+std::vector<Reduce> reduce643 = {};
+std::vector<Shift> shift644 = {{&term67, &state647}, {&term68, &state648}, {&term71, &state649}};
+std::vector<Reduce> reduce644 = {};
+std::vector<Shift> shift645 = {};
+std::vector<Reduce> reduce645 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift648 = {{&term66, &state652}};
+std::vector<Reduce> reduce648 = {};
+std::vector<Shift> shift650 = {{&term11, &state89}, {&term66, &state90}, {&term72, &state651}};
+std::vector<Reduce> reduce650 = {};
+std::vector<Shift> shift652 = {{&term67, &state653}};
+std::vector<Reduce> reduce652 = {};
+std::vector<Shift> shift653 = {};
+std::vector<Reduce> reduce653 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift655 = {{&term11, &state656}, {&term66, &state657}, {&term70, &state658}};
+std::vector<Reduce> reduce655 = {};
+std::vector<Shift> shift656 = {{&term69, &state667}};
+std::vector<Reduce> reduce656 = {};
+std::vector<Shift> shift657 = {{&term67, &state660}, {&term68, &state661}, {&term71, &state662}};
+std::vector<Reduce> reduce657 = {};
+std::vector<Shift> shift658 = {};
+std::vector<Reduce> reduce658 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift661 = {{&term66, &state665}};
+std::vector<Reduce> reduce661 = {};
+std::vector<Shift> shift663 = {{&term12, &state97}, {&term66, &state98}, {&term72, &state664}};
+std::vector<Reduce> reduce663 = {};
+std::vector<Shift> shift665 = {{&term67, &state666}};
+std::vector<Reduce> reduce665 = {};
+std::vector<Shift> shift666 = {};
+std::vector<Reduce> reduce666 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift668 = {{&term12, &state669}, {&term66, &state670}, {&term70, &state671}};
+std::vector<Reduce> reduce668 = {};
+std::vector<Shift> shift669 = {{&term69, &state680}};
+std::vector<Reduce> reduce669 = {};
+std::vector<Shift> shift670 = {{&term67, &state673}, {&term68, &state674}, {&term71, &state675}};
+std::vector<Reduce> reduce670 = {};
+std::vector<Shift> shift671 = {};
+std::vector<Reduce> reduce671 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift674 = {{&term66, &state678}};
+std::vector<Reduce> reduce674 = {};
+std::vector<Shift> shift676 = {{&term13, &state105}, {&term66, &state106}, {&term72, &state677}};
+std::vector<Reduce> reduce676 = {};
+std::vector<Shift> shift678 = {{&term67, &state679}};
+std::vector<Reduce> reduce678 = {};
+std::vector<Shift> shift679 = {};
+std::vector<Reduce> reduce679 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift681 = {{&term13, &state682}, {&term66, &state683}, {&term70, &state684}};
+std::vector<Reduce> reduce681 = {};
+std::vector<Shift> shift682 = {{&term69, &state693}};
+std::vector<Reduce> reduce682 = {};
+std::vector<Shift> shift683 = {{&term67, &state686}, {&term68, &state687}, {&term71, &state688}};
+std::vector<Reduce> reduce683 = {};
+std::vector<Shift> shift684 = {};
+std::vector<Reduce> reduce684 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift687 = {{&term66, &state691}};
+std::vector<Reduce> reduce687 = {};
+std::vector<Shift> shift689 = {{&term14, &state113}, {&term66, &state114}, {&term72, &state690}};
+std::vector<Reduce> reduce689 = {};
+std::vector<Shift> shift691 = {{&term67, &state692}};
+std::vector<Reduce> reduce691 = {};
+std::vector<Shift> shift692 = {};
+std::vector<Reduce> reduce692 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift694 = {{&term14, &state695}, {&term66, &state696}, {&term70, &state697}};
+std::vector<Reduce> reduce694 = {};
+std::vector<Shift> shift695 = {{&term69, &state706}};
+std::vector<Reduce> reduce695 = {};
+std::vector<Shift> shift696 = {{&term67, &state699}, {&term68, &state700}, {&term71, &state701}};
+std::vector<Reduce> reduce696 = {};
+std::vector<Shift> shift697 = {};
+std::vector<Reduce> reduce697 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift700 = {{&term66, &state704}};
+std::vector<Reduce> reduce700 = {};
+std::vector<Shift> shift702 = {{&term15, &state121}, {&term66, &state122}, {&term72, &state703}};
+std::vector<Reduce> reduce702 = {};
+std::vector<Shift> shift704 = {{&term67, &state705}};
+std::vector<Reduce> reduce704 = {};
+std::vector<Shift> shift705 = {};
+std::vector<Reduce> reduce705 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift707 = {{&term15, &state708}, {&term66, &state709}, {&term70, &state710}};
+std::vector<Reduce> reduce707 = {};
+std::vector<Shift> shift708 = {{&term69, &state719}};
+std::vector<Reduce> reduce708 = {};
+std::vector<Shift> shift709 = {{&term67, &state712}, {&term68, &state713}, {&term71, &state714}};
+std::vector<Reduce> reduce709 = {};
+std::vector<Shift> shift710 = {};
+std::vector<Reduce> reduce710 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift713 = {{&term66, &state717}};
+std::vector<Reduce> reduce713 = {};
+std::vector<Shift> shift715 = {{&term16, &state129}, {&term66, &state130}, {&term72, &state716}};
+std::vector<Reduce> reduce715 = {};
+std::vector<Shift> shift717 = {{&term67, &state718}};
+std::vector<Reduce> reduce717 = {};
+std::vector<Shift> shift718 = {};
+std::vector<Reduce> reduce718 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift720 = {{&term16, &state721}, {&term66, &state722}, {&term70, &state723}};
+std::vector<Reduce> reduce720 = {};
+std::vector<Shift> shift721 = {{&term69, &state732}};
+std::vector<Reduce> reduce721 = {};
+std::vector<Shift> shift722 = {{&term67, &state725}, {&term68, &state726}, {&term71, &state727}};
+std::vector<Reduce> reduce722 = {};
+std::vector<Shift> shift723 = {};
+std::vector<Reduce> reduce723 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift726 = {{&term66, &state730}};
+std::vector<Reduce> reduce726 = {};
+std::vector<Shift> shift728 = {{&term17, &state137}, {&term66, &state138}, {&term72, &state729}};
+std::vector<Reduce> reduce728 = {};
+std::vector<Shift> shift730 = {{&term67, &state731}};
+std::vector<Reduce> reduce730 = {};
+std::vector<Shift> shift731 = {};
+std::vector<Reduce> reduce731 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift733 = {{&term17, &state734}, {&term66, &state735}, {&term70, &state736}};
+std::vector<Reduce> reduce733 = {};
+std::vector<Shift> shift734 = {{&term69, &state745}};
+std::vector<Reduce> reduce734 = {};
+std::vector<Shift> shift735 = {{&term67, &state738}, {&term68, &state739}, {&term71, &state740}};
+std::vector<Reduce> reduce735 = {};
+std::vector<Shift> shift736 = {};
+std::vector<Reduce> reduce736 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift739 = {{&term66, &state743}};
+std::vector<Reduce> reduce739 = {};
+std::vector<Shift> shift741 = {{&term18, &state145}, {&term66, &state146}, {&term72, &state742}};
+std::vector<Reduce> reduce741 = {};
+std::vector<Shift> shift743 = {{&term67, &state744}};
+std::vector<Reduce> reduce743 = {};
+std::vector<Shift> shift744 = {};
+std::vector<Reduce> reduce744 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift746 = {{&term18, &state747}, {&term66, &state748}, {&term70, &state749}};
+std::vector<Reduce> reduce746 = {};
+std::vector<Shift> shift747 = {{&term69, &state758}};
+std::vector<Reduce> reduce747 = {};
+std::vector<Shift> shift748 = {{&term67, &state751}, {&term68, &state752}, {&term71, &state753}};
+std::vector<Reduce> reduce748 = {};
+std::vector<Shift> shift749 = {};
+std::vector<Reduce> reduce749 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift752 = {{&term66, &state756}};
+std::vector<Reduce> reduce752 = {};
+std::vector<Shift> shift754 = {{&term19, &state153}, {&term66, &state154}, {&term72, &state755}};
+std::vector<Reduce> reduce754 = {};
+std::vector<Shift> shift756 = {{&term67, &state757}};
+std::vector<Reduce> reduce756 = {};
+std::vector<Shift> shift757 = {};
+std::vector<Reduce> reduce757 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift759 = {{&term19, &state760}, {&term66, &state761}, {&term70, &state762}};
+std::vector<Reduce> reduce759 = {};
+std::vector<Shift> shift760 = {{&term69, &state771}};
+std::vector<Reduce> reduce760 = {};
+std::vector<Shift> shift761 = {{&term67, &state764}, {&term68, &state765}, {&term71, &state766}};
+std::vector<Reduce> reduce761 = {};
+std::vector<Shift> shift762 = {};
+std::vector<Reduce> reduce762 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift765 = {{&term66, &state769}};
+std::vector<Reduce> reduce765 = {};
+std::vector<Shift> shift767 = {{&term20, &state161}, {&term66, &state162}, {&term72, &state768}};
+std::vector<Reduce> reduce767 = {};
+std::vector<Shift> shift769 = {{&term67, &state770}};
+std::vector<Reduce> reduce769 = {};
+std::vector<Shift> shift770 = {};
+std::vector<Reduce> reduce770 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift772 = {{&term20, &state773}, {&term66, &state774}, {&term70, &state775}};
+std::vector<Reduce> reduce772 = {};
+std::vector<Shift> shift773 = {{&term69, &state784}};
+std::vector<Reduce> reduce773 = {};
+std::vector<Shift> shift774 = {{&term67, &state777}, {&term68, &state778}, {&term71, &state779}};
+std::vector<Reduce> reduce774 = {};
+std::vector<Shift> shift775 = {};
+std::vector<Reduce> reduce775 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift778 = {{&term66, &state782}};
+std::vector<Reduce> reduce778 = {};
+std::vector<Shift> shift780 = {{&term21, &state169}, {&term66, &state170}, {&term72, &state781}};
+std::vector<Reduce> reduce780 = {};
+std::vector<Shift> shift782 = {{&term67, &state783}};
+std::vector<Reduce> reduce782 = {};
+std::vector<Shift> shift783 = {};
+std::vector<Reduce> reduce783 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift785 = {{&term21, &state786}, {&term66, &state787}, {&term70, &state788}};
+std::vector<Reduce> reduce785 = {};
+std::vector<Shift> shift786 = {{&term69, &state797}};
+std::vector<Reduce> reduce786 = {};
+std::vector<Shift> shift787 = {{&term67, &state790}, {&term68, &state791}, {&term71, &state792}};
+std::vector<Reduce> reduce787 = {};
+std::vector<Shift> shift788 = {};
+std::vector<Reduce> reduce788 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift791 = {{&term66, &state795}};
+std::vector<Reduce> reduce791 = {};
+std::vector<Shift> shift793 = {{&term22, &state177}, {&term66, &state178}, {&term72, &state794}};
+std::vector<Reduce> reduce793 = {};
+std::vector<Shift> shift795 = {{&term67, &state796}};
+std::vector<Reduce> reduce795 = {};
+std::vector<Shift> shift796 = {};
+std::vector<Reduce> reduce796 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift798 = {{&term22, &state799}, {&term66, &state800}, {&term70, &state801}};
+std::vector<Reduce> reduce798 = {};
+std::vector<Shift> shift799 = {{&term69, &state810}};
+std::vector<Reduce> reduce799 = {};
+std::vector<Shift> shift800 = {{&term67, &state803}, {&term68, &state804}, {&term71, &state805}};
+std::vector<Reduce> reduce800 = {};
+std::vector<Shift> shift801 = {};
+std::vector<Reduce> reduce801 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift804 = {{&term66, &state808}};
+std::vector<Reduce> reduce804 = {};
+std::vector<Shift> shift806 = {{&term23, &state185}, {&term66, &state186}, {&term72, &state807}};
+std::vector<Reduce> reduce806 = {};
+std::vector<Shift> shift808 = {{&term67, &state809}};
+std::vector<Reduce> reduce808 = {};
+std::vector<Shift> shift809 = {};
+std::vector<Reduce> reduce809 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift811 = {{&term23, &state812}, {&term66, &state813}, {&term70, &state814}};
+std::vector<Reduce> reduce811 = {};
+std::vector<Shift> shift812 = {{&term69, &state823}};
+std::vector<Reduce> reduce812 = {};
+std::vector<Shift> shift813 = {{&term67, &state816}, {&term68, &state817}, {&term71, &state818}};
+std::vector<Reduce> reduce813 = {};
+std::vector<Shift> shift814 = {};
+std::vector<Reduce> reduce814 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift817 = {{&term66, &state821}};
+std::vector<Reduce> reduce817 = {};
+std::vector<Shift> shift819 = {{&term24, &state193}, {&term66, &state194}, {&term72, &state820}};
+std::vector<Reduce> reduce819 = {};
+std::vector<Shift> shift821 = {{&term67, &state822}};
+std::vector<Reduce> reduce821 = {};
+std::vector<Shift> shift822 = {};
+std::vector<Reduce> reduce822 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift824 = {{&term24, &state825}, {&term66, &state826}, {&term70, &state827}};
+std::vector<Reduce> reduce824 = {};
+std::vector<Shift> shift825 = {{&term69, &state836}};
+std::vector<Reduce> reduce825 = {};
+std::vector<Shift> shift826 = {{&term67, &state829}, {&term68, &state830}, {&term71, &state831}};
+std::vector<Reduce> reduce826 = {};
+std::vector<Shift> shift827 = {};
+std::vector<Reduce> reduce827 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift830 = {{&term66, &state834}};
+std::vector<Reduce> reduce830 = {};
+std::vector<Shift> shift832 = {{&term25, &state201}, {&term66, &state202}, {&term72, &state833}};
+std::vector<Reduce> reduce832 = {};
+std::vector<Shift> shift834 = {{&term67, &state835}};
+std::vector<Reduce> reduce834 = {};
+std::vector<Shift> shift835 = {};
+std::vector<Reduce> reduce835 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift837 = {{&term25, &state838}, {&term66, &state839}, {&term70, &state840}};
+std::vector<Reduce> reduce837 = {};
+std::vector<Shift> shift838 = {{&term69, &state849}};
+std::vector<Reduce> reduce838 = {};
+std::vector<Shift> shift839 = {{&term67, &state842}, {&term68, &state843}, {&term71, &state844}};
+std::vector<Reduce> reduce839 = {};
+std::vector<Shift> shift840 = {};
+std::vector<Reduce> reduce840 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift843 = {{&term66, &state847}};
+std::vector<Reduce> reduce843 = {};
+std::vector<Shift> shift845 = {{&term26, &state209}, {&term66, &state210}, {&term72, &state846}};
+std::vector<Reduce> reduce845 = {};
+std::vector<Shift> shift847 = {{&term67, &state848}};
+std::vector<Reduce> reduce847 = {};
+std::vector<Shift> shift848 = {};
+std::vector<Reduce> reduce848 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift850 = {{&term26, &state851}, {&term66, &state852}, {&term70, &state853}};
+std::vector<Reduce> reduce850 = {};
+std::vector<Shift> shift851 = {{&term69, &state862}};
+std::vector<Reduce> reduce851 = {};
+std::vector<Shift> shift852 = {{&term67, &state855}, {&term68, &state856}, {&term71, &state857}};
+std::vector<Reduce> reduce852 = {};
+std::vector<Shift> shift853 = {};
+std::vector<Reduce> reduce853 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift856 = {{&term66, &state860}};
+std::vector<Reduce> reduce856 = {};
+std::vector<Shift> shift858 = {{&term27, &state217}, {&term66, &state218}, {&term72, &state859}};
+std::vector<Reduce> reduce858 = {};
+std::vector<Shift> shift860 = {{&term67, &state861}};
+std::vector<Reduce> reduce860 = {};
+std::vector<Shift> shift861 = {};
+std::vector<Reduce> reduce861 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift863 = {{&term27, &state864}, {&term66, &state865}, {&term70, &state866}};
+std::vector<Reduce> reduce863 = {};
+std::vector<Shift> shift864 = {{&term69, &state875}};
+std::vector<Reduce> reduce864 = {};
+std::vector<Shift> shift865 = {{&term67, &state868}, {&term68, &state869}, {&term71, &state870}};
+std::vector<Reduce> reduce865 = {};
+std::vector<Shift> shift866 = {};
+std::vector<Reduce> reduce866 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift869 = {{&term66, &state873}};
+std::vector<Reduce> reduce869 = {};
+std::vector<Shift> shift871 = {{&term28, &state225}, {&term66, &state226}, {&term72, &state872}};
+std::vector<Reduce> reduce871 = {};
+std::vector<Shift> shift873 = {{&term67, &state874}};
+std::vector<Reduce> reduce873 = {};
+std::vector<Shift> shift874 = {};
+std::vector<Reduce> reduce874 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift876 = {{&term28, &state877}, {&term66, &state878}, {&term70, &state879}};
+std::vector<Reduce> reduce876 = {};
+std::vector<Shift> shift877 = {{&term69, &state888}};
+std::vector<Reduce> reduce877 = {};
+std::vector<Shift> shift878 = {{&term67, &state881}, {&term68, &state882}, {&term71, &state883}};
+std::vector<Reduce> reduce878 = {};
+std::vector<Shift> shift879 = {};
+std::vector<Reduce> reduce879 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift882 = {{&term66, &state886}};
+std::vector<Reduce> reduce882 = {};
+std::vector<Shift> shift884 = {{&term29, &state233}, {&term66, &state234}, {&term72, &state885}};
+std::vector<Reduce> reduce884 = {};
+std::vector<Shift> shift886 = {{&term67, &state887}};
+std::vector<Reduce> reduce886 = {};
+std::vector<Shift> shift887 = {};
+std::vector<Reduce> reduce887 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift889 = {{&term29, &state890}, {&term66, &state891}, {&term70, &state892}};
+std::vector<Reduce> reduce889 = {};
+std::vector<Shift> shift890 = {{&term69, &state901}};
+std::vector<Reduce> reduce890 = {};
+std::vector<Shift> shift891 = {{&term67, &state894}, {&term68, &state895}, {&term71, &state896}};
+std::vector<Reduce> reduce891 = {};
+std::vector<Shift> shift892 = {};
+std::vector<Reduce> reduce892 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift895 = {{&term66, &state899}};
+std::vector<Reduce> reduce895 = {};
+std::vector<Shift> shift897 = {{&term30, &state241}, {&term66, &state242}, {&term72, &state898}};
+std::vector<Reduce> reduce897 = {};
+std::vector<Shift> shift899 = {{&term67, &state900}};
+std::vector<Reduce> reduce899 = {};
+std::vector<Shift> shift900 = {};
+std::vector<Reduce> reduce900 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift902 = {{&term30, &state903}, {&term66, &state904}, {&term70, &state905}};
+std::vector<Reduce> reduce902 = {};
+std::vector<Shift> shift903 = {{&term69, &state914}};
+std::vector<Reduce> reduce903 = {};
+std::vector<Shift> shift904 = {{&term67, &state907}, {&term68, &state908}, {&term71, &state909}};
+std::vector<Reduce> reduce904 = {};
+std::vector<Shift> shift905 = {};
+std::vector<Reduce> reduce905 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift908 = {{&term66, &state912}};
+std::vector<Reduce> reduce908 = {};
+std::vector<Shift> shift910 = {{&term31, &state249}, {&term66, &state250}, {&term72, &state911}};
+std::vector<Reduce> reduce910 = {};
+std::vector<Shift> shift912 = {{&term67, &state913}};
+std::vector<Reduce> reduce912 = {};
+std::vector<Shift> shift913 = {};
+std::vector<Reduce> reduce913 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift915 = {{&term31, &state916}, {&term66, &state917}, {&term70, &state918}};
+std::vector<Reduce> reduce915 = {};
+std::vector<Shift> shift916 = {{&term69, &state927}};
+std::vector<Reduce> reduce916 = {};
+std::vector<Shift> shift917 = {{&term67, &state920}, {&term68, &state921}, {&term71, &state922}};
+std::vector<Reduce> reduce917 = {};
+std::vector<Shift> shift918 = {};
+std::vector<Reduce> reduce918 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift921 = {{&term66, &state925}};
+std::vector<Reduce> reduce921 = {};
+std::vector<Shift> shift923 = {{&term32, &state257}, {&term66, &state258}, {&term72, &state924}};
+std::vector<Reduce> reduce923 = {};
+std::vector<Shift> shift925 = {{&term67, &state926}};
+std::vector<Reduce> reduce925 = {};
+std::vector<Shift> shift926 = {};
+std::vector<Reduce> reduce926 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift928 = {{&term32, &state929}, {&term66, &state930}, {&term70, &state931}};
+std::vector<Reduce> reduce928 = {};
+std::vector<Shift> shift929 = {{&term69, &state940}};
+std::vector<Reduce> reduce929 = {};
+std::vector<Shift> shift930 = {{&term67, &state933}, {&term68, &state934}, {&term71, &state935}};
+std::vector<Reduce> reduce930 = {};
+std::vector<Shift> shift931 = {};
+std::vector<Reduce> reduce931 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift934 = {{&term66, &state938}};
+std::vector<Reduce> reduce934 = {};
+std::vector<Shift> shift936 = {{&term33, &state265}, {&term66, &state266}, {&term72, &state937}};
+std::vector<Reduce> reduce936 = {};
+std::vector<Shift> shift938 = {{&term67, &state939}};
+std::vector<Reduce> reduce938 = {};
+std::vector<Shift> shift939 = {};
+std::vector<Reduce> reduce939 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift941 = {{&term33, &state942}, {&term66, &state943}, {&term70, &state944}};
+std::vector<Reduce> reduce941 = {};
+std::vector<Shift> shift942 = {{&term69, &state953}};
+std::vector<Reduce> reduce942 = {};
+std::vector<Shift> shift943 = {{&term67, &state946}, {&term68, &state947}, {&term71, &state948}};
+std::vector<Reduce> reduce943 = {};
+std::vector<Shift> shift944 = {};
+std::vector<Reduce> reduce944 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift947 = {{&term66, &state951}};
+std::vector<Reduce> reduce947 = {};
+std::vector<Shift> shift949 = {{&term34, &state273}, {&term66, &state274}, {&term72, &state950}};
+std::vector<Reduce> reduce949 = {};
+std::vector<Shift> shift951 = {{&term67, &state952}};
+std::vector<Reduce> reduce951 = {};
+std::vector<Shift> shift952 = {};
+std::vector<Reduce> reduce952 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift954 = {{&term34, &state955}, {&term66, &state956}, {&term70, &state957}};
+std::vector<Reduce> reduce954 = {};
+std::vector<Shift> shift955 = {{&term69, &state966}};
+std::vector<Reduce> reduce955 = {};
+std::vector<Shift> shift956 = {{&term67, &state959}, {&term68, &state960}, {&term71, &state961}};
+std::vector<Reduce> reduce956 = {};
+std::vector<Shift> shift957 = {};
+std::vector<Reduce> reduce957 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift960 = {{&term66, &state964}};
+std::vector<Reduce> reduce960 = {};
+std::vector<Shift> shift962 = {{&term35, &state281}, {&term66, &state282}, {&term72, &state963}};
+std::vector<Reduce> reduce962 = {};
+std::vector<Shift> shift964 = {{&term67, &state965}};
+std::vector<Reduce> reduce964 = {};
+std::vector<Shift> shift965 = {};
+std::vector<Reduce> reduce965 = {{nullptr, &rule208, false}};
+std::vector<Shift> shift967 = {{&term35, &state968}, {&term66, &state969}, {&term70, &state970}};
+std::vector<Reduce> reduce967 = {};
+std::vector<Shift> shift968 = {{&term69, &state979}};
+std::vector<Reduce> reduce968 = {};
+std::vector<Shift> shift969 = {{&term67, &state972}, {&term68, &state973}, {&term71, &state974}};
+std::vector<Reduce> reduce969 = {};
+std::vector<Shift> shift970 = {};
+std::vector<Reduce> reduce970 = {{nullptr, &rule209, false}};
+std::vector<Shift> shift973 = {{&term66, &state977}};
+std::vector<Reduce> reduce973 = {};
+std::vector<Shift> shift975 = {{&term36, &state289}, {&term66, &state290}, {&term72, &state976}};
+std::vector<Reduce> reduce975 = {};
+std::vector<Shift> shift977 = {{&term67, &state978}};
+std::vector<Reduce> reduce977 = {};
+std::vector<Shift> shift978 = {};
+std::vector<Reduce> reduce978 = {{nullptr, &rule214, false}};
+std::vector<Shift> shift980 = {{&term36, &state981}, {&term66, &state982}, {&term70, &state983}};
+std::vector<Reduce> reduce980 = {};
+std::vector<Shift> shift981 = {{&term69, &state992}};
+std::vector<Reduce> reduce981 = {};
+std::vector<Shift> shift982 = {{&term67, &state985}, {&term68, &state986}, {&term71, &state987}};
+std::vector<Reduce> reduce982 = {};
+std::vector<Shift> shift983 = {};
+std::vector<Reduce> reduce983 = {{nullptr, &rule215, false}};
+std::vector<Shift> shift986 = {{&term66, &state990}};
+std::vector<Reduce> reduce986 = {};
+std::vector<Shift> shift988 = {{&term37, &state297}, {&term66, &state298}, {&term72, &state989}};
+std::vector<Reduce> reduce988 = {};
+std::vector<Shift> shift990 = {{&term67, &state991}};
+std::vector<Reduce> reduce990 = {};
+std::vector<Shift> shift991 = {};
+std::vector<Reduce> reduce991 = {{nullptr, &rule220, false}};
+std::vector<Shift> shift993 = {{&term37, &state994}, {&term66, &state995}, {&term70, &state996}};
+std::vector<Reduce> reduce993 = {};
+std::vector<Shift> shift994 = {{&term69, &state1005}};
+std::vector<Reduce> reduce994 = {};
+std::vector<Shift> shift995 = {{&term67, &state998}, {&term68, &state999}, {&term71, &state1000}};
+std::vector<Reduce> reduce995 = {};
+std::vector<Shift> shift996 = {};
+std::vector<Reduce> reduce996 = {{nullptr, &rule221, false}};
+std::vector<Shift> shift999 = {{&term66, &state1003}};
+std::vector<Reduce> reduce999 = {};
+std::vector<Shift> shift1001 = {{&term38, &state305}, {&term66, &state306}, {&term72, &state1002}};
+std::vector<Reduce> reduce1001 = {};
+std::vector<Shift> shift1003 = {{&term67, &state1004}};
+std::vector<Reduce> reduce1003 = {};
+std::vector<Shift> shift1004 = {};
+std::vector<Reduce> reduce1004 = {{nullptr, &rule226, false}};
+std::vector<Shift> shift1006 = {{&term38, &state1007}, {&term66, &state1008}, {&term70, &state1009}};
+std::vector<Reduce> reduce1006 = {};
+std::vector<Shift> shift1007 = {{&term69, &state1018}};
+std::vector<Reduce> reduce1007 = {};
+std::vector<Shift> shift1008 = {{&term67, &state1011}, {&term68, &state1012}, {&term71, &state1013}};
+std::vector<Reduce> reduce1008 = {};
+std::vector<Shift> shift1009 = {};
+std::vector<Reduce> reduce1009 = {{nullptr, &rule227, false}};
+std::vector<Shift> shift1012 = {{&term66, &state1016}};
+std::vector<Reduce> reduce1012 = {};
+std::vector<Shift> shift1014 = {{&term39, &state313}, {&term66, &state314}, {&term72, &state1015}};
+std::vector<Reduce> reduce1014 = {};
+std::vector<Shift> shift1016 = {{&term67, &state1017}};
+std::vector<Reduce> reduce1016 = {};
+std::vector<Shift> shift1017 = {};
+std::vector<Reduce> reduce1017 = {{nullptr, &rule232, false}};
+std::vector<Shift> shift1019 = {{&term39, &state1020}, {&term66, &state1021}, {&term70, &state1022}};
+std::vector<Reduce> reduce1019 = {};
+std::vector<Shift> shift1020 = {{&term69, &state1031}};
+std::vector<Reduce> reduce1020 = {};
+std::vector<Shift> shift1021 = {{&term67, &state1024}, {&term68, &state1025}, {&term71, &state1026}};
+std::vector<Reduce> reduce1021 = {};
+std::vector<Shift> shift1022 = {};
+std::vector<Reduce> reduce1022 = {{nullptr, &rule233, false}};
+std::vector<Shift> shift1025 = {{&term66, &state1029}};
+std::vector<Reduce> reduce1025 = {};
+std::vector<Shift> shift1027 = {{&term40, &state321}, {&term66, &state322}, {&term72, &state1028}};
+std::vector<Reduce> reduce1027 = {};
+std::vector<Shift> shift1029 = {{&term67, &state1030}};
+std::vector<Reduce> reduce1029 = {};
+std::vector<Shift> shift1030 = {};
+std::vector<Reduce> reduce1030 = {{nullptr, &rule238, false}};
+std::vector<Shift> shift1032 = {{&term40, &state1033}, {&term66, &state1034}, {&term70, &state1035}};
+std::vector<Reduce> reduce1032 = {};
+std::vector<Shift> shift1033 = {{&term69, &state1044}};
+std::vector<Reduce> reduce1033 = {};
+std::vector<Shift> shift1034 = {{&term67, &state1037}, {&term68, &state1038}, {&term71, &state1039}};
+std::vector<Reduce> reduce1034 = {};
+std::vector<Shift> shift1035 = {};
+std::vector<Reduce> reduce1035 = {{nullptr, &rule239, false}};
+std::vector<Shift> shift1038 = {{&term66, &state1042}};
+std::vector<Reduce> reduce1038 = {};
+std::vector<Shift> shift1040 = {{&term41, &state329}, {&term66, &state330}, {&term72, &state1041}};
+std::vector<Reduce> reduce1040 = {};
+std::vector<Shift> shift1042 = {{&term67, &state1043}};
+std::vector<Reduce> reduce1042 = {};
+std::vector<Shift> shift1043 = {};
+std::vector<Reduce> reduce1043 = {{nullptr, &rule244, false}};
+std::vector<Shift> shift1045 = {{&term41, &state1046}, {&term66, &state1047}, {&term70, &state1048}};
+std::vector<Reduce> reduce1045 = {};
+std::vector<Shift> shift1046 = {{&term69, &state1057}};
+std::vector<Reduce> reduce1046 = {};
+std::vector<Shift> shift1047 = {{&term67, &state1050}, {&term68, &state1051}, {&term71, &state1052}};
+std::vector<Reduce> reduce1047 = {};
+std::vector<Shift> shift1048 = {};
+std::vector<Reduce> reduce1048 = {{nullptr, &rule245, false}};
+std::vector<Shift> shift1051 = {{&term66, &state1055}};
+std::vector<Reduce> reduce1051 = {};
+std::vector<Shift> shift1053 = {{&term42, &state337}, {&term66, &state338}, {&term72, &state1054}};
+std::vector<Reduce> reduce1053 = {};
+std::vector<Shift> shift1055 = {{&term67, &state1056}};
+std::vector<Reduce> reduce1055 = {};
+std::vector<Shift> shift1056 = {};
+std::vector<Reduce> reduce1056 = {{nullptr, &rule250, false}};
+std::vector<Shift> shift1058 = {{&term42, &state1059}, {&term66, &state1060}, {&term70, &state1061}};
+std::vector<Reduce> reduce1058 = {};
+std::vector<Shift> shift1059 = {{&term69, &state1070}};
+std::vector<Reduce> reduce1059 = {};
+std::vector<Shift> shift1060 = {{&term67, &state1063}, {&term68, &state1064}, {&term71, &state1065}};
+std::vector<Reduce> reduce1060 = {};
+std::vector<Shift> shift1061 = {};
+std::vector<Reduce> reduce1061 = {{nullptr, &rule251, false}};
+std::vector<Shift> shift1064 = {{&term66, &state1068}};
+std::vector<Reduce> reduce1064 = {};
+std::vector<Shift> shift1066 = {{&term43, &state345}, {&term66, &state346}, {&term72, &state1067}};
+std::vector<Reduce> reduce1066 = {};
+std::vector<Shift> shift1068 = {{&term67, &state1069}};
+std::vector<Reduce> reduce1068 = {};
+std::vector<Shift> shift1069 = {};
+std::vector<Reduce> reduce1069 = {{nullptr, &rule256, false}};
+std::vector<Shift> shift1071 = {{&term43, &state1072}, {&term66, &state1073}, {&term70, &state1074}};
+std::vector<Reduce> reduce1071 = {};
+std::vector<Shift> shift1072 = {{&term69, &state1083}};
+std::vector<Reduce> reduce1072 = {};
+std::vector<Shift> shift1073 = {{&term67, &state1076}, {&term68, &state1077}, {&term71, &state1078}};
+std::vector<Reduce> reduce1073 = {};
+std::vector<Shift> shift1074 = {};
+std::vector<Reduce> reduce1074 = {{nullptr, &rule257, false}};
+std::vector<Shift> shift1077 = {{&term66, &state1081}};
+std::vector<Reduce> reduce1077 = {};
+std::vector<Shift> shift1079 = {{&term44, &state353}, {&term66, &state354}, {&term72, &state1080}};
+std::vector<Reduce> reduce1079 = {};
+std::vector<Shift> shift1081 = {{&term67, &state1082}};
+std::vector<Reduce> reduce1081 = {};
+std::vector<Shift> shift1082 = {};
+std::vector<Reduce> reduce1082 = {{nullptr, &rule262, false}};
+std::vector<Shift> shift1084 = {{&term44, &state1085}, {&term66, &state1086}, {&term70, &state1087}};
+std::vector<Reduce> reduce1084 = {};
+std::vector<Shift> shift1085 = {{&term69, &state1096}};
+std::vector<Reduce> reduce1085 = {};
+std::vector<Shift> shift1086 = {{&term67, &state1089}, {&term68, &state1090}, {&term71, &state1091}};
+std::vector<Reduce> reduce1086 = {};
+std::vector<Shift> shift1087 = {};
+std::vector<Reduce> reduce1087 = {{nullptr, &rule263, false}};
+std::vector<Shift> shift1090 = {{&term66, &state1094}};
+std::vector<Reduce> reduce1090 = {};
+std::vector<Shift> shift1092 = {{&term45, &state361}, {&term66, &state362}, {&term72, &state1093}};
+std::vector<Reduce> reduce1092 = {};
+std::vector<Shift> shift1094 = {{&term67, &state1095}};
+std::vector<Reduce> reduce1094 = {};
+std::vector<Shift> shift1095 = {};
+std::vector<Reduce> reduce1095 = {{nullptr, &rule268, false}};
+std::vector<Shift> shift1097 = {{&term45, &state1098}, {&term66, &state1099}, {&term70, &state1100}};
+std::vector<Reduce> reduce1097 = {};
+std::vector<Shift> shift1098 = {{&term69, &state1109}};
+std::vector<Reduce> reduce1098 = {};
+std::vector<Shift> shift1099 = {{&term67, &state1102}, {&term68, &state1103}, {&term71, &state1104}};
+std::vector<Reduce> reduce1099 = {};
+std::vector<Shift> shift1100 = {};
+std::vector<Reduce> reduce1100 = {{nullptr, &rule269, false}};
+std::vector<Shift> shift1103 = {{&term66, &state1107}};
+std::vector<Reduce> reduce1103 = {};
+std::vector<Shift> shift1105 = {{&term46, &state369}, {&term66, &state370}, {&term72, &state1106}};
+std::vector<Reduce> reduce1105 = {};
+std::vector<Shift> shift1107 = {{&term67, &state1108}};
+std::vector<Reduce> reduce1107 = {};
+std::vector<Shift> shift1108 = {};
+std::vector<Reduce> reduce1108 = {{nullptr, &rule274, false}};
+std::vector<Shift> shift1110 = {{&term46, &state1111}, {&term66, &state1112}, {&term70, &state1113}};
+std::vector<Reduce> reduce1110 = {};
+std::vector<Shift> shift1111 = {{&term69, &state1122}};
+std::vector<Reduce> reduce1111 = {};
+std::vector<Shift> shift1112 = {{&term67, &state1115}, {&term68, &state1116}, {&term71, &state1117}};
+std::vector<Reduce> reduce1112 = {};
+std::vector<Shift> shift1113 = {};
+std::vector<Reduce> reduce1113 = {{nullptr, &rule275, false}};
+std::vector<Shift> shift1116 = {{&term66, &state1120}};
+std::vector<Reduce> reduce1116 = {};
+std::vector<Shift> shift1118 = {{&term47, &state377}, {&term66, &state378}, {&term72, &state1119}};
+std::vector<Reduce> reduce1118 = {};
+std::vector<Shift> shift1120 = {{&term67, &state1121}};
+std::vector<Reduce> reduce1120 = {};
+std::vector<Shift> shift1121 = {};
+std::vector<Reduce> reduce1121 = {{nullptr, &rule280, false}};
+std::vector<Shift> shift1123 = {{&term47, &state1124}, {&term66, &state1125}, {&term70, &state1126}};
+std::vector<Reduce> reduce1123 = {};
+std::vector<Shift> shift1124 = {{&term69, &state1135}};
+std::vector<Reduce> reduce1124 = {};
+std::vector<Shift> shift1125 = {{&term67, &state1128}, {&term68, &state1129}, {&term71, &state1130}};
+std::vector<Reduce> reduce1125 = {};
+std::vector<Shift> shift1126 = {};
+std::vector<Reduce> reduce1126 = {{nullptr, &rule281, false}};
+std::vector<Shift> shift1129 = {{&term66, &state1133}};
+std::vector<Reduce> reduce1129 = {};
+std::vector<Shift> shift1131 = {{&term48, &state385}, {&term66, &state386}, {&term72, &state1132}};
+std::vector<Reduce> reduce1131 = {};
+std::vector<Shift> shift1133 = {{&term67, &state1134}};
+std::vector<Reduce> reduce1133 = {};
+std::vector<Shift> shift1134 = {};
+std::vector<Reduce> reduce1134 = {{nullptr, &rule286, false}};
+std::vector<Shift> shift1136 = {{&term48, &state1137}, {&term66, &state1138}, {&term70, &state1139}};
+std::vector<Reduce> reduce1136 = {};
+std::vector<Shift> shift1137 = {{&term69, &state1148}};
+std::vector<Reduce> reduce1137 = {};
+std::vector<Shift> shift1138 = {{&term67, &state1141}, {&term68, &state1142}, {&term71, &state1143}};
+std::vector<Reduce> reduce1138 = {};
+std::vector<Shift> shift1139 = {};
+std::vector<Reduce> reduce1139 = {{nullptr, &rule287, false}};
+std::vector<Shift> shift1142 = {{&term66, &state1146}};
+std::vector<Reduce> reduce1142 = {};
+std::vector<Shift> shift1144 = {{&term49, &state393}, {&term66, &state394}, {&term72, &state1145}};
+std::vector<Reduce> reduce1144 = {};
+std::vector<Shift> shift1146 = {{&term67, &state1147}};
+std::vector<Reduce> reduce1146 = {};
+std::vector<Shift> shift1147 = {};
+std::vector<Reduce> reduce1147 = {{nullptr, &rule292, false}};
+std::vector<Shift> shift1149 = {{&term49, &state1150}, {&term66, &state1151}, {&term70, &state1152}};
+std::vector<Reduce> reduce1149 = {};
+std::vector<Shift> shift1150 = {{&term69, &state1161}};
+std::vector<Reduce> reduce1150 = {};
+std::vector<Shift> shift1151 = {{&term67, &state1154}, {&term68, &state1155}, {&term71, &state1156}};
+std::vector<Reduce> reduce1151 = {};
+std::vector<Shift> shift1152 = {};
+std::vector<Reduce> reduce1152 = {{nullptr, &rule293, false}};
+std::vector<Shift> shift1155 = {{&term66, &state1159}};
+std::vector<Reduce> reduce1155 = {};
+std::vector<Shift> shift1157 = {{&term50, &state401}, {&term66, &state402}, {&term72, &state1158}};
+std::vector<Reduce> reduce1157 = {};
+std::vector<Shift> shift1159 = {{&term67, &state1160}};
+std::vector<Reduce> reduce1159 = {};
+std::vector<Shift> shift1160 = {};
+std::vector<Reduce> reduce1160 = {{nullptr, &rule298, false}};
+std::vector<Shift> shift1162 = {{&term50, &state1163}, {&term66, &state1164}, {&term70, &state1165}};
+std::vector<Reduce> reduce1162 = {};
+std::vector<Shift> shift1163 = {{&term69, &state1174}};
+std::vector<Reduce> reduce1163 = {};
+std::vector<Shift> shift1164 = {{&term67, &state1167}, {&term68, &state1168}, {&term71, &state1169}};
+std::vector<Reduce> reduce1164 = {};
+std::vector<Shift> shift1165 = {};
+std::vector<Reduce> reduce1165 = {{nullptr, &rule299, false}};
+std::vector<Shift> shift1168 = {{&term66, &state1172}};
+std::vector<Reduce> reduce1168 = {};
+std::vector<Shift> shift1170 = {{&term51, &state409}, {&term66, &state410}, {&term72, &state1171}};
+std::vector<Reduce> reduce1170 = {};
+std::vector<Shift> shift1172 = {{&term67, &state1173}};
+std::vector<Reduce> reduce1172 = {};
+std::vector<Shift> shift1173 = {};
+std::vector<Reduce> reduce1173 = {{nullptr, &rule304, false}};
+std::vector<Shift> shift1175 = {{&term51, &state1176}, {&term66, &state1177}, {&term70, &state1178}};
+std::vector<Reduce> reduce1175 = {};
+std::vector<Shift> shift1176 = {{&term69, &state1187}};
+std::vector<Reduce> reduce1176 = {};
+std::vector<Shift> shift1177 = {{&term67, &state1180}, {&term68, &state1181}, {&term71, &state1182}};
+std::vector<Reduce> reduce1177 = {};
+std::vector<Shift> shift1178 = {};
+std::vector<Reduce> reduce1178 = {{nullptr, &rule305, false}};
+std::vector<Shift> shift1181 = {{&term66, &state1185}};
+std::vector<Reduce> reduce1181 = {};
+std::vector<Shift> shift1183 = {{&term52, &state417}, {&term66, &state418}, {&term72, &state1184}};
+std::vector<Reduce> reduce1183 = {};
+std::vector<Shift> shift1185 = {{&term67, &state1186}};
+std::vector<Reduce> reduce1185 = {};
+std::vector<Shift> shift1186 = {};
+std::vector<Reduce> reduce1186 = {{nullptr, &rule310, false}};
+std::vector<Shift> shift1188 = {{&term52, &state1189}, {&term66, &state1190}, {&term70, &state1191}};
+std::vector<Reduce> reduce1188 = {};
+std::vector<Shift> shift1189 = {{&term69, &state1200}};
+std::vector<Reduce> reduce1189 = {};
+std::vector<Shift> shift1190 = {{&term67, &state1193}, {&term68, &state1194}, {&term71, &state1195}};
+std::vector<Reduce> reduce1190 = {};
+std::vector<Shift> shift1191 = {};
+std::vector<Reduce> reduce1191 = {{nullptr, &rule311, false}};
+std::vector<Shift> shift1194 = {{&term66, &state1198}};
+std::vector<Reduce> reduce1194 = {};
+std::vector<Shift> shift1196 = {{&term53, &state425}, {&term66, &state426}, {&term72, &state1197}};
+std::vector<Reduce> reduce1196 = {};
+std::vector<Shift> shift1198 = {{&term67, &state1199}};
+std::vector<Reduce> reduce1198 = {};
+std::vector<Shift> shift1199 = {};
+std::vector<Reduce> reduce1199 = {{nullptr, &rule316, false}};
+std::vector<Shift> shift1201 = {{&term53, &state1202}, {&term66, &state1203}, {&term70, &state1204}};
+std::vector<Reduce> reduce1201 = {};
+std::vector<Shift> shift1202 = {{&term69, &state1213}};
+std::vector<Reduce> reduce1202 = {};
+std::vector<Shift> shift1203 = {{&term67, &state1206}, {&term68, &state1207}, {&term71, &state1208}};
+std::vector<Reduce> reduce1203 = {};
+std::vector<Shift> shift1204 = {};
+std::vector<Reduce> reduce1204 = {{nullptr, &rule317, false}};
+std::vector<Shift> shift1207 = {{&term66, &state1211}};
+std::vector<Reduce> reduce1207 = {};
+std::vector<Shift> shift1209 = {{&term54, &state433}, {&term66, &state434}, {&term72, &state1210}};
+std::vector<Reduce> reduce1209 = {};
+std::vector<Shift> shift1211 = {{&term67, &state1212}};
+std::vector<Reduce> reduce1211 = {};
+std::vector<Shift> shift1212 = {};
+std::vector<Reduce> reduce1212 = {{nullptr, &rule322, false}};
+std::vector<Shift> shift1214 = {{&term54, &state1215}, {&term66, &state1216}, {&term70, &state1217}};
+std::vector<Reduce> reduce1214 = {};
+std::vector<Shift> shift1215 = {{&term69, &state1226}};
+std::vector<Reduce> reduce1215 = {};
+std::vector<Shift> shift1216 = {{&term67, &state1219}, {&term68, &state1220}, {&term71, &state1221}};
+std::vector<Reduce> reduce1216 = {};
+std::vector<Shift> shift1217 = {};
+std::vector<Reduce> reduce1217 = {{nullptr, &rule323, false}};
+std::vector<Shift> shift1220 = {{&term66, &state1224}};
+std::vector<Reduce> reduce1220 = {};
+std::vector<Shift> shift1222 = {{&term55, &state441}, {&term66, &state442}, {&term72, &state1223}};
+std::vector<Reduce> reduce1222 = {};
+std::vector<Shift> shift1224 = {{&term67, &state1225}};
+std::vector<Reduce> reduce1224 = {};
+std::vector<Shift> shift1225 = {};
+std::vector<Reduce> reduce1225 = {{nullptr, &rule328, false}};
+std::vector<Shift> shift1227 = {{&term55, &state1228}, {&term66, &state1229}, {&term70, &state1230}};
+std::vector<Reduce> reduce1227 = {};
+std::vector<Shift> shift1228 = {{&term69, &state1239}};
+std::vector<Reduce> reduce1228 = {};
+std::vector<Shift> shift1229 = {{&term67, &state1232}, {&term68, &state1233}, {&term71, &state1234}};
+std::vector<Reduce> reduce1229 = {};
+std::vector<Shift> shift1230 = {};
+std::vector<Reduce> reduce1230 = {{nullptr, &rule329, false}};
+std::vector<Shift> shift1233 = {{&term66, &state1237}};
+std::vector<Reduce> reduce1233 = {};
+std::vector<Shift> shift1235 = {{&term56, &state449}, {&term66, &state450}, {&term72, &state1236}};
+std::vector<Reduce> reduce1235 = {};
+std::vector<Shift> shift1237 = {{&term67, &state1238}};
+std::vector<Reduce> reduce1237 = {};
+std::vector<Shift> shift1238 = {};
+std::vector<Reduce> reduce1238 = {{nullptr, &rule334, false}};
+std::vector<Shift> shift1240 = {{&term56, &state1241}, {&term66, &state1242}, {&term70, &state1243}};
+std::vector<Reduce> reduce1240 = {};
+std::vector<Shift> shift1241 = {{&term69, &state1252}};
+std::vector<Reduce> reduce1241 = {};
+std::vector<Shift> shift1242 = {{&term67, &state1245}, {&term68, &state1246}, {&term71, &state1247}};
+std::vector<Reduce> reduce1242 = {};
+std::vector<Shift> shift1243 = {};
+std::vector<Reduce> reduce1243 = {{nullptr, &rule335, false}};
+std::vector<Shift> shift1246 = {{&term66, &state1250}};
+std::vector<Reduce> reduce1246 = {};
+std::vector<Shift> shift1248 = {{&term57, &state457}, {&term66, &state458}, {&term72, &state1249}};
+std::vector<Reduce> reduce1248 = {};
+std::vector<Shift> shift1250 = {{&term67, &state1251}};
+std::vector<Reduce> reduce1250 = {};
+std::vector<Shift> shift1251 = {};
+std::vector<Reduce> reduce1251 = {{nullptr, &rule340, false}};
+std::vector<Shift> shift1253 = {{&term57, &state1254}, {&term66, &state1255}, {&term70, &state1256}};
+std::vector<Reduce> reduce1253 = {};
+std::vector<Shift> shift1254 = {{&term69, &state1265}};
+std::vector<Reduce> reduce1254 = {};
+std::vector<Shift> shift1255 = {{&term67, &state1258}, {&term68, &state1259}, {&term71, &state1260}};
+std::vector<Reduce> reduce1255 = {};
+std::vector<Shift> shift1256 = {};
+std::vector<Reduce> reduce1256 = {{nullptr, &rule341, false}};
+std::vector<Shift> shift1259 = {{&term66, &state1263}};
+std::vector<Reduce> reduce1259 = {};
+std::vector<Shift> shift1261 = {{&term58, &state465}, {&term66, &state466}, {&term72, &state1262}};
+std::vector<Reduce> reduce1261 = {};
+std::vector<Shift> shift1263 = {{&term67, &state1264}};
+std::vector<Reduce> reduce1263 = {};
+std::vector<Shift> shift1264 = {};
+std::vector<Reduce> reduce1264 = {{nullptr, &rule346, false}};
+std::vector<Shift> shift1266 = {{&term58, &state1267}, {&term66, &state1268}, {&term70, &state1269}};
+std::vector<Reduce> reduce1266 = {};
+std::vector<Shift> shift1267 = {{&term69, &state1278}};
+std::vector<Reduce> reduce1267 = {};
+std::vector<Shift> shift1268 = {{&term67, &state1271}, {&term68, &state1272}, {&term71, &state1273}};
+std::vector<Reduce> reduce1268 = {};
+std::vector<Shift> shift1269 = {};
+std::vector<Reduce> reduce1269 = {{nullptr, &rule347, false}};
+std::vector<Shift> shift1272 = {{&term66, &state1276}};
+std::vector<Reduce> reduce1272 = {};
+std::vector<Shift> shift1274 = {{&term59, &state473}, {&term66, &state474}, {&term72, &state1275}};
+std::vector<Reduce> reduce1274 = {};
+std::vector<Shift> shift1276 = {{&term67, &state1277}};
+std::vector<Reduce> reduce1276 = {};
+std::vector<Shift> shift1277 = {};
+std::vector<Reduce> reduce1277 = {{nullptr, &rule352, false}};
+std::vector<Shift> shift1279 = {{&term59, &state1280}, {&term66, &state1281}, {&term70, &state1282}};
+std::vector<Reduce> reduce1279 = {};
+std::vector<Shift> shift1280 = {{&term69, &state1291}};
+std::vector<Reduce> reduce1280 = {};
+std::vector<Shift> shift1281 = {{&term67, &state1284}, {&term68, &state1285}, {&term71, &state1286}};
+std::vector<Reduce> reduce1281 = {};
+std::vector<Shift> shift1282 = {};
+std::vector<Reduce> reduce1282 = {{nullptr, &rule353, false}};
+std::vector<Shift> shift1285 = {{&term66, &state1289}};
+std::vector<Reduce> reduce1285 = {};
+std::vector<Shift> shift1287 = {{&term60, &state481}, {&term66, &state482}, {&term72, &state1288}};
+std::vector<Reduce> reduce1287 = {};
+std::vector<Shift> shift1289 = {{&term67, &state1290}};
+std::vector<Reduce> reduce1289 = {};
+std::vector<Shift> shift1290 = {};
+std::vector<Reduce> reduce1290 = {{nullptr, &rule358, false}};
+std::vector<Shift> shift1292 = {{&term60, &state1293}, {&term66, &state1294}, {&term70, &state1295}};
+std::vector<Reduce> reduce1292 = {};
+std::vector<Shift> shift1293 = {{&term69, &state1304}};
+std::vector<Reduce> reduce1293 = {};
+std::vector<Shift> shift1294 = {{&term67, &state1297}, {&term68, &state1298}, {&term71, &state1299}};
+std::vector<Reduce> reduce1294 = {};
+std::vector<Shift> shift1295 = {};
+std::vector<Reduce> reduce1295 = {{nullptr, &rule359, false}};
+std::vector<Shift> shift1298 = {{&term66, &state1302}};
+std::vector<Reduce> reduce1298 = {};
+std::vector<Shift> shift1300 = {{&term61, &state489}, {&term66, &state490}, {&term72, &state1301}};
+std::vector<Reduce> reduce1300 = {};
+std::vector<Shift> shift1302 = {{&term67, &state1303}};
+std::vector<Reduce> reduce1302 = {};
+std::vector<Shift> shift1303 = {};
+std::vector<Reduce> reduce1303 = {{nullptr, &rule364, false}};
+std::vector<Shift> shift1305 = {{&term61, &state1306}, {&term66, &state1307}, {&term70, &state1308}};
+std::vector<Reduce> reduce1305 = {};
+std::vector<Shift> shift1306 = {{&term69, &state1317}};
+std::vector<Reduce> reduce1306 = {};
+std::vector<Shift> shift1307 = {{&term67, &state1310}, {&term68, &state1311}, {&term71, &state1312}};
+std::vector<Reduce> reduce1307 = {};
+std::vector<Shift> shift1308 = {};
+std::vector<Reduce> reduce1308 = {{nullptr, &rule365, false}};
+std::vector<Shift> shift1311 = {{&term66, &state1315}};
+std::vector<Reduce> reduce1311 = {};
+std::vector<Shift> shift1313 = {{&term62, &state497}, {&term66, &state498}, {&term72, &state1314}};
+std::vector<Reduce> reduce1313 = {};
+std::vector<Shift> shift1315 = {{&term67, &state1316}};
+std::vector<Reduce> reduce1315 = {};
+std::vector<Shift> shift1316 = {};
+std::vector<Reduce> reduce1316 = {{nullptr, &rule370, false}};
+std::vector<Shift> shift1318 = {{&term62, &state1319}, {&term66, &state1320}, {&term70, &state1321}};
+std::vector<Reduce> reduce1318 = {};
+std::vector<Shift> shift1319 = {{&term69, &state1330}};
+std::vector<Reduce> reduce1319 = {};
+std::vector<Shift> shift1320 = {{&term67, &state1323}, {&term68, &state1324}, {&term71, &state1325}};
+std::vector<Reduce> reduce1320 = {};
+std::vector<Shift> shift1321 = {};
+std::vector<Reduce> reduce1321 = {{nullptr, &rule371, false}};
+std::vector<Shift> shift1324 = {{&term66, &state1328}};
+std::vector<Reduce> reduce1324 = {};
+std::vector<Shift> shift1326 = {{&term63, &state505}, {&term66, &state506}, {&term72, &state1327}};
+std::vector<Reduce> reduce1326 = {};
+std::vector<Shift> shift1328 = {{&term67, &state1329}};
+std::vector<Reduce> reduce1328 = {};
+std::vector<Shift> shift1329 = {};
+std::vector<Reduce> reduce1329 = {{nullptr, &rule376, false}};
+std::vector<Shift> shift1331 = {{&term63, &state1332}, {&term66, &state1333}, {&term70, &state1334}};
+std::vector<Reduce> reduce1331 = {};
+std::vector<Shift> shift1332 = {{&term69, &state1343}};
+std::vector<Reduce> reduce1332 = {};
+std::vector<Shift> shift1333 = {{&term67, &state1336}, {&term68, &state1337}, {&term71, &state1338}};
+std::vector<Reduce> reduce1333 = {};
+std::vector<Shift> shift1334 = {};
+std::vector<Reduce> reduce1334 = {{nullptr, &rule377, false}};
+std::vector<Shift> shift1337 = {{&term66, &state1341}};
+std::vector<Reduce> reduce1337 = {};
+std::vector<Shift> shift1339 = {{&term0, &state513}, {&term66, &state514}, {&term72, &state1340}};
+std::vector<Reduce> reduce1339 = {};
+std::vector<Shift> shift1341 = {{&term67, &state1342}};
+std::vector<Reduce> reduce1341 = {};
+std::vector<Shift> shift1342 = {};
+std::vector<Reduce> reduce1342 = {{nullptr, &rule382, false}};
+std::vector<Shift> shift1344 = {{&term0, &state1345}, {&term66, &state1346}, {&term70, &state1347}};
+std::vector<Reduce> reduce1344 = {};
+std::vector<Shift> shift1345 = {{&term69, &state1356}};
+std::vector<Reduce> reduce1345 = {};
+std::vector<Shift> shift1346 = {{&term67, &state1349}, {&term68, &state1350}, {&term71, &state1351}};
+std::vector<Reduce> reduce1346 = {};
+std::vector<Shift> shift1347 = {};
+std::vector<Reduce> reduce1347 = {{nullptr, &rule383, false}};
+std::vector<Shift> shift1350 = {{&term66, &state1354}};
+std::vector<Reduce> reduce1350 = {};
+std::vector<Shift> shift1352 = {{&term1, &state9}, {&term66, &state10}, {&term72, &state1353}};
+std::vector<Reduce> reduce1352 = {};
+std::vector<Shift> shift1354 = {{&term67, &state1355}};
+std::vector<Reduce> reduce1354 = {};
+std::vector<Shift> shift1357 = {{&term1, &state526}, {&term66, &state527}, {&term70, &state1358}};
+std::vector<Reduce> reduce1357 = {};
+std::vector<Shift> shift1359 = {{&term67, &state1360}};
+std::vector<Reduce> reduce1359 = {};
+std::vector<Shift> shift1362 = {{&term0, &state1345}, {&term66, &state1346}, {&term70, &state1363}};
+std::vector<Reduce> reduce1362 = {};
+std::vector<Shift> shift1364 = {{&term67, &state1365}};
+std::vector<Reduce> reduce1364 = {};
+std::vector<Shift> shift1367 = {{&term63, &state1332}, {&term66, &state1333}, {&term70, &state1368}};
+std::vector<Reduce> reduce1367 = {};
+std::vector<Shift> shift1369 = {{&term67, &state1370}};
+std::vector<Reduce> reduce1369 = {};
+std::vector<Shift> shift1372 = {{&term62, &state1319}, {&term66, &state1320}, {&term70, &state1373}};
+std::vector<Reduce> reduce1372 = {};
+std::vector<Shift> shift1374 = {{&term67, &state1375}};
+std::vector<Reduce> reduce1374 = {};
+std::vector<Shift> shift1377 = {{&term61, &state1306}, {&term66, &state1307}, {&term70, &state1378}};
+std::vector<Reduce> reduce1377 = {};
+std::vector<Shift> shift1379 = {{&term67, &state1380}};
+std::vector<Reduce> reduce1379 = {};
+std::vector<Shift> shift1382 = {{&term60, &state1293}, {&term66, &state1294}, {&term70, &state1383}};
+std::vector<Reduce> reduce1382 = {};
+std::vector<Shift> shift1384 = {{&term67, &state1385}};
+std::vector<Reduce> reduce1384 = {};
+std::vector<Shift> shift1387 = {{&term59, &state1280}, {&term66, &state1281}, {&term70, &state1388}};
+std::vector<Reduce> reduce1387 = {};
+std::vector<Shift> shift1389 = {{&term67, &state1390}};
+std::vector<Reduce> reduce1389 = {};
+std::vector<Shift> shift1392 = {{&term58, &state1267}, {&term66, &state1268}, {&term70, &state1393}};
+std::vector<Reduce> reduce1392 = {};
+std::vector<Shift> shift1394 = {{&term67, &state1395}};
+std::vector<Reduce> reduce1394 = {};
+std::vector<Shift> shift1397 = {{&term57, &state1254}, {&term66, &state1255}, {&term70, &state1398}};
+std::vector<Reduce> reduce1397 = {};
+std::vector<Shift> shift1399 = {{&term67, &state1400}};
+std::vector<Reduce> reduce1399 = {};
+std::vector<Shift> shift1402 = {{&term56, &state1241}, {&term66, &state1242}, {&term70, &state1403}};
+std::vector<Reduce> reduce1402 = {};
+std::vector<Shift> shift1404 = {{&term67, &state1405}};
+std::vector<Reduce> reduce1404 = {};
+std::vector<Shift> shift1407 = {{&term55, &state1228}, {&term66, &state1229}, {&term70, &state1408}};
+std::vector<Reduce> reduce1407 = {};
+std::vector<Shift> shift1409 = {{&term67, &state1410}};
+std::vector<Reduce> reduce1409 = {};
+std::vector<Shift> shift1412 = {{&term54, &state1215}, {&term66, &state1216}, {&term70, &state1413}};
+std::vector<Reduce> reduce1412 = {};
+std::vector<Shift> shift1414 = {{&term67, &state1415}};
+std::vector<Reduce> reduce1414 = {};
+std::vector<Shift> shift1417 = {{&term53, &state1202}, {&term66, &state1203}, {&term70, &state1418}};
+std::vector<Reduce> reduce1417 = {};
+std::vector<Shift> shift1419 = {{&term67, &state1420}};
+std::vector<Reduce> reduce1419 = {};
+std::vector<Shift> shift1422 = {{&term52, &state1189}, {&term66, &state1190}, {&term70, &state1423}};
+std::vector<Reduce> reduce1422 = {};
+std::vector<Shift> shift1424 = {{&term67, &state1425}};
+std::vector<Reduce> reduce1424 = {};
+std::vector<Shift> shift1427 = {{&term51, &state1176}, {&term66, &state1177}, {&term70, &state1428}};
+std::vector<Reduce> reduce1427 = {};
+std::vector<Shift> shift1429 = {{&term67, &state1430}};
+std::vector<Reduce> reduce1429 = {};
+std::vector<Shift> shift1432 = {{&term50, &state1163}, {&term66, &state1164}, {&term70, &state1433}};
+std::vector<Reduce> reduce1432 = {};
+std::vector<Shift> shift1434 = {{&term67, &state1435}};
+std::vector<Reduce> reduce1434 = {};
+std::vector<Shift> shift1437 = {{&term49, &state1150}, {&term66, &state1151}, {&term70, &state1438}};
+std::vector<Reduce> reduce1437 = {};
+std::vector<Shift> shift1439 = {{&term67, &state1440}};
+std::vector<Reduce> reduce1439 = {};
+std::vector<Shift> shift1442 = {{&term48, &state1137}, {&term66, &state1138}, {&term70, &state1443}};
+std::vector<Reduce> reduce1442 = {};
+std::vector<Shift> shift1444 = {{&term67, &state1445}};
+std::vector<Reduce> reduce1444 = {};
+std::vector<Shift> shift1447 = {{&term47, &state1124}, {&term66, &state1125}, {&term70, &state1448}};
+std::vector<Reduce> reduce1447 = {};
+std::vector<Shift> shift1449 = {{&term67, &state1450}};
+std::vector<Reduce> reduce1449 = {};
+std::vector<Shift> shift1452 = {{&term46, &state1111}, {&term66, &state1112}, {&term70, &state1453}};
+std::vector<Reduce> reduce1452 = {};
+std::vector<Shift> shift1454 = {{&term67, &state1455}};
+std::vector<Reduce> reduce1454 = {};
+std::vector<Shift> shift1457 = {{&term45, &state1098}, {&term66, &state1099}, {&term70, &state1458}};
+std::vector<Reduce> reduce1457 = {};
+std::vector<Shift> shift1459 = {{&term67, &state1460}};
+std::vector<Reduce> reduce1459 = {};
+std::vector<Shift> shift1462 = {{&term44, &state1085}, {&term66, &state1086}, {&term70, &state1463}};
+std::vector<Reduce> reduce1462 = {};
+std::vector<Shift> shift1464 = {{&term67, &state1465}};
+std::vector<Reduce> reduce1464 = {};
+std::vector<Shift> shift1467 = {{&term43, &state1072}, {&term66, &state1073}, {&term70, &state1468}};
+std::vector<Reduce> reduce1467 = {};
+std::vector<Shift> shift1469 = {{&term67, &state1470}};
+std::vector<Reduce> reduce1469 = {};
+std::vector<Shift> shift1472 = {{&term42, &state1059}, {&term66, &state1060}, {&term70, &state1473}};
+std::vector<Reduce> reduce1472 = {};
+std::vector<Shift> shift1474 = {{&term67, &state1475}};
+std::vector<Reduce> reduce1474 = {};
+std::vector<Shift> shift1477 = {{&term41, &state1046}, {&term66, &state1047}, {&term70, &state1478}};
+std::vector<Reduce> reduce1477 = {};
+std::vector<Shift> shift1479 = {{&term67, &state1480}};
+std::vector<Reduce> reduce1479 = {};
+std::vector<Shift> shift1482 = {{&term40, &state1033}, {&term66, &state1034}, {&term70, &state1483}};
+std::vector<Reduce> reduce1482 = {};
+std::vector<Shift> shift1484 = {{&term67, &state1485}};
+std::vector<Reduce> reduce1484 = {};
+std::vector<Shift> shift1487 = {{&term39, &state1020}, {&term66, &state1021}, {&term70, &state1488}};
+std::vector<Reduce> reduce1487 = {};
+std::vector<Shift> shift1489 = {{&term67, &state1490}};
+std::vector<Reduce> reduce1489 = {};
+std::vector<Shift> shift1492 = {{&term38, &state1007}, {&term66, &state1008}, {&term70, &state1493}};
+std::vector<Reduce> reduce1492 = {};
+std::vector<Shift> shift1494 = {{&term67, &state1495}};
+std::vector<Reduce> reduce1494 = {};
+std::vector<Shift> shift1497 = {{&term37, &state994}, {&term66, &state995}, {&term70, &state1498}};
+std::vector<Reduce> reduce1497 = {};
+std::vector<Shift> shift1499 = {{&term67, &state1500}};
+std::vector<Reduce> reduce1499 = {};
+std::vector<Shift> shift1502 = {{&term36, &state981}, {&term66, &state982}, {&term70, &state1503}};
+std::vector<Reduce> reduce1502 = {};
+std::vector<Shift> shift1504 = {{&term67, &state1505}};
+std::vector<Reduce> reduce1504 = {};
+std::vector<Shift> shift1507 = {{&term35, &state968}, {&term66, &state969}, {&term70, &state1508}};
+std::vector<Reduce> reduce1507 = {};
+std::vector<Shift> shift1509 = {{&term67, &state1510}};
+std::vector<Reduce> reduce1509 = {};
+std::vector<Shift> shift1512 = {{&term34, &state955}, {&term66, &state956}, {&term70, &state1513}};
+std::vector<Reduce> reduce1512 = {};
+std::vector<Shift> shift1514 = {{&term67, &state1515}};
+std::vector<Reduce> reduce1514 = {};
+std::vector<Shift> shift1517 = {{&term33, &state942}, {&term66, &state943}, {&term70, &state1518}};
+std::vector<Reduce> reduce1517 = {};
+std::vector<Shift> shift1519 = {{&term67, &state1520}};
+std::vector<Reduce> reduce1519 = {};
+std::vector<Shift> shift1522 = {{&term32, &state929}, {&term66, &state930}, {&term70, &state1523}};
+std::vector<Reduce> reduce1522 = {};
+std::vector<Shift> shift1524 = {{&term67, &state1525}};
+std::vector<Reduce> reduce1524 = {};
+std::vector<Shift> shift1527 = {{&term31, &state916}, {&term66, &state917}, {&term70, &state1528}};
+std::vector<Reduce> reduce1527 = {};
+std::vector<Shift> shift1529 = {{&term67, &state1530}};
+std::vector<Reduce> reduce1529 = {};
+std::vector<Shift> shift1532 = {{&term30, &state903}, {&term66, &state904}, {&term70, &state1533}};
+std::vector<Reduce> reduce1532 = {};
+std::vector<Shift> shift1534 = {{&term67, &state1535}};
+std::vector<Reduce> reduce1534 = {};
+std::vector<Shift> shift1537 = {{&term29, &state890}, {&term66, &state891}, {&term70, &state1538}};
+std::vector<Reduce> reduce1537 = {};
+std::vector<Shift> shift1539 = {{&term67, &state1540}};
+std::vector<Reduce> reduce1539 = {};
+std::vector<Shift> shift1542 = {{&term28, &state877}, {&term66, &state878}, {&term70, &state1543}};
+std::vector<Reduce> reduce1542 = {};
+std::vector<Shift> shift1544 = {{&term67, &state1545}};
+std::vector<Reduce> reduce1544 = {};
+std::vector<Shift> shift1547 = {{&term27, &state864}, {&term66, &state865}, {&term70, &state1548}};
+std::vector<Reduce> reduce1547 = {};
+std::vector<Shift> shift1549 = {{&term67, &state1550}};
+std::vector<Reduce> reduce1549 = {};
+std::vector<Shift> shift1552 = {{&term26, &state851}, {&term66, &state852}, {&term70, &state1553}};
+std::vector<Reduce> reduce1552 = {};
+std::vector<Shift> shift1554 = {{&term67, &state1555}};
+std::vector<Reduce> reduce1554 = {};
+std::vector<Shift> shift1557 = {{&term25, &state838}, {&term66, &state839}, {&term70, &state1558}};
+std::vector<Reduce> reduce1557 = {};
+std::vector<Shift> shift1559 = {{&term67, &state1560}};
+std::vector<Reduce> reduce1559 = {};
+std::vector<Shift> shift1562 = {{&term24, &state825}, {&term66, &state826}, {&term70, &state1563}};
+std::vector<Reduce> reduce1562 = {};
+std::vector<Shift> shift1564 = {{&term67, &state1565}};
+std::vector<Reduce> reduce1564 = {};
+std::vector<Shift> shift1567 = {{&term23, &state812}, {&term66, &state813}, {&term70, &state1568}};
+std::vector<Reduce> reduce1567 = {};
+std::vector<Shift> shift1569 = {{&term67, &state1570}};
+std::vector<Reduce> reduce1569 = {};
+std::vector<Shift> shift1572 = {{&term22, &state799}, {&term66, &state800}, {&term70, &state1573}};
+std::vector<Reduce> reduce1572 = {};
+std::vector<Shift> shift1574 = {{&term67, &state1575}};
+std::vector<Reduce> reduce1574 = {};
+std::vector<Shift> shift1577 = {{&term21, &state786}, {&term66, &state787}, {&term70, &state1578}};
+std::vector<Reduce> reduce1577 = {};
+std::vector<Shift> shift1579 = {{&term67, &state1580}};
+std::vector<Reduce> reduce1579 = {};
+std::vector<Shift> shift1582 = {{&term20, &state773}, {&term66, &state774}, {&term70, &state1583}};
+std::vector<Reduce> reduce1582 = {};
+std::vector<Shift> shift1584 = {{&term67, &state1585}};
+std::vector<Reduce> reduce1584 = {};
+std::vector<Shift> shift1587 = {{&term19, &state760}, {&term66, &state761}, {&term70, &state1588}};
+std::vector<Reduce> reduce1587 = {};
+std::vector<Shift> shift1589 = {{&term67, &state1590}};
+std::vector<Reduce> reduce1589 = {};
+std::vector<Shift> shift1592 = {{&term18, &state747}, {&term66, &state748}, {&term70, &state1593}};
+std::vector<Reduce> reduce1592 = {};
+std::vector<Shift> shift1594 = {{&term67, &state1595}};
+std::vector<Reduce> reduce1594 = {};
+std::vector<Shift> shift1597 = {{&term17, &state734}, {&term66, &state735}, {&term70, &state1598}};
+std::vector<Reduce> reduce1597 = {};
+std::vector<Shift> shift1599 = {{&term67, &state1600}};
+std::vector<Reduce> reduce1599 = {};
+std::vector<Shift> shift1602 = {{&term16, &state721}, {&term66, &state722}, {&term70, &state1603}};
+std::vector<Reduce> reduce1602 = {};
+std::vector<Shift> shift1604 = {{&term67, &state1605}};
+std::vector<Reduce> reduce1604 = {};
+std::vector<Shift> shift1607 = {{&term15, &state708}, {&term66, &state709}, {&term70, &state1608}};
+std::vector<Reduce> reduce1607 = {};
+std::vector<Shift> shift1609 = {{&term67, &state1610}};
+std::vector<Reduce> reduce1609 = {};
+std::vector<Shift> shift1612 = {{&term14, &state695}, {&term66, &state696}, {&term70, &state1613}};
+std::vector<Reduce> reduce1612 = {};
+std::vector<Shift> shift1614 = {{&term67, &state1615}};
+std::vector<Reduce> reduce1614 = {};
+std::vector<Shift> shift1617 = {{&term13, &state682}, {&term66, &state683}, {&term70, &state1618}};
+std::vector<Reduce> reduce1617 = {};
+std::vector<Shift> shift1619 = {{&term67, &state1620}};
+std::vector<Reduce> reduce1619 = {};
+std::vector<Shift> shift1622 = {{&term12, &state669}, {&term66, &state670}, {&term70, &state1623}};
+std::vector<Reduce> reduce1622 = {};
+std::vector<Shift> shift1624 = {{&term67, &state1625}};
+std::vector<Reduce> reduce1624 = {};
+std::vector<Shift> shift1627 = {{&term11, &state656}, {&term66, &state657}, {&term70, &state1628}};
+std::vector<Reduce> reduce1627 = {};
+std::vector<Shift> shift1629 = {{&term67, &state1630}};
+std::vector<Reduce> reduce1629 = {};
+std::vector<Shift> shift1632 = {{&term10, &state643}, {&term66, &state644}, {&term70, &state1633}};
+std::vector<Reduce> reduce1632 = {};
+std::vector<Shift> shift1634 = {{&term67, &state1635}};
+std::vector<Reduce> reduce1634 = {};
+std::vector<Shift> shift1637 = {{&term9, &state630}, {&term66, &state631}, {&term70, &state1638}};
+std::vector<Reduce> reduce1637 = {};
+std::vector<Shift> shift1639 = {{&term67, &state1640}};
+std::vector<Reduce> reduce1639 = {};
+std::vector<Shift> shift1642 = {{&term8, &state617}, {&term66, &state618}, {&term70, &state1643}};
+std::vector<Reduce> reduce1642 = {};
+std::vector<Shift> shift1644 = {{&term67, &state1645}};
+std::vector<Reduce> reduce1644 = {};
+std::vector<Shift> shift1647 = {{&term7, &state604}, {&term66, &state605}, {&term70, &state1648}};
+std::vector<Reduce> reduce1647 = {};
+std::vector<Shift> shift1649 = {{&term67, &state1650}};
+std::vector<Reduce> reduce1649 = {};
+std::vector<Shift> shift1652 = {{&term6, &state591}, {&term66, &state592}, {&term70, &state1653}};
+std::vector<Reduce> reduce1652 = {};
+std::vector<Shift> shift1654 = {{&term67, &state1655}};
+std::vector<Reduce> reduce1654 = {};
+std::vector<Shift> shift1657 = {{&term5, &state578}, {&term66, &state579}, {&term70, &state1658}};
+std::vector<Reduce> reduce1657 = {};
+std::vector<Shift> shift1659 = {{&term67, &state1660}};
+std::vector<Reduce> reduce1659 = {};
+std::vector<Shift> shift1662 = {{&term4, &state565}, {&term66, &state566}, {&term70, &state1663}};
+std::vector<Reduce> reduce1662 = {};
+std::vector<Shift> shift1664 = {{&term67, &state1665}};
+std::vector<Reduce> reduce1664 = {};
+std::vector<Shift> shift1667 = {{&term3, &state552}, {&term66, &state553}, {&term70, &state1668}};
+std::vector<Reduce> reduce1667 = {};
+std::vector<Shift> shift1669 = {{&term67, &state1670}};
+std::vector<Reduce> reduce1669 = {};
+std::vector<Shift> shift1672 = {{&term2, &state539}, {&term66, &state540}, {&term70, &state1673}};
+std::vector<Reduce> reduce1672 = {};
+std::vector<Shift> shift1674 = {{&term67, &state1675}};
+std::vector<Reduce> reduce1674 = {};
+std::vector<Shift> shift1677 = {{&term1, &state526}, {&term66, &state527}, {&term70, &state1678}};
+std::vector<Reduce> reduce1677 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state4}};
+std::vector<Go> go7 = {{&nonterm3, &state8}};
+std::vector<Go> go8 = {{&nonterm4, &state12}};
+std::vector<Go> go15 = {{&nonterm5, &state16}};
+std::vector<Go> go16 = {{&nonterm6, &state20}};
+std::vector<Go> go23 = {{&nonterm7, &state24}};
+std::vector<Go> go24 = {{&nonterm8, &state28}};
+std::vector<Go> go31 = {{&nonterm9, &state32}};
+std::vector<Go> go32 = {{&nonterm10, &state36}};
+std::vector<Go> go39 = {{&nonterm11, &state40}};
+std::vector<Go> go40 = {{&nonterm12, &state44}};
+std::vector<Go> go47 = {{&nonterm13, &state48}};
+std::vector<Go> go48 = {{&nonterm14, &state52}};
+std::vector<Go> go55 = {{&nonterm15, &state56}};
+std::vector<Go> go56 = {{&nonterm16, &state60}};
+std::vector<Go> go63 = {{&nonterm17, &state64}};
+std::vector<Go> go64 = {{&nonterm18, &state68}};
+std::vector<Go> go71 = {{&nonterm19, &state72}};
+std::vector<Go> go72 = {{&nonterm20, &state76}};
+std::vector<Go> go79 = {{&nonterm21, &state80}};
+std::vector<Go> go80 = {{&nonterm22, &state84}};
+std::vector<Go> go87 = {{&nonterm23, &state88}};
+std::vector<Go> go88 = {{&nonterm24, &state92}};
+std::vector<Go> go95 = {{&nonterm25, &state96}};
+std::vector<Go> go96 = {{&nonterm26, &state100}};
+std::vector<Go> go103 = {{&nonterm27, &state104}};
+std::vector<Go> go104 = {{&nonterm28, &state108}};
+std::vector<Go> go111 = {{&nonterm29, &state112}};
+std::vector<Go> go112 = {{&nonterm30, &state116}};
+std::vector<Go> go119 = {{&nonterm31, &state120}};
+std::vector<Go> go120 = {{&nonterm32, &state124}};
+std::vector<Go> go127 = {{&nonterm33, &state128}};
+std::vector<Go> go128 = {{&nonterm34, &state132}};
+std::vector<Go> go135 = {{&nonterm35, &state136}};
+std::vector<Go> go136 = {{&nonterm36, &state140}};
+std::vector<Go> go143 = {{&nonterm37, &state144}};
+std::vector<Go> go144 = {{&nonterm38, &state148}};
+std::vector<Go> go151 = {{&nonterm39, &state152}};
+std::vector<Go> go152 = {{&nonterm40, &state156}};
+std::vector<Go> go159 = {{&nonterm41, &state160}};
+std::vector<Go> go160 = {{&nonterm42, &state164}};
+std::vector<Go> go167 = {{&nonterm43, &state168}};
+std::vector<Go> go168 = {{&nonterm44, &state172}};
+std::vector<Go> go175 = {{&nonterm45, &state176}};
+std::vector<Go> go176 = {{&nonterm46, &state180}};
+std::vector<Go> go183 = {{&nonterm47, &state184}};
+std::vector<Go> go184 = {{&nonterm48, &state188}};
+std::vector<Go> go191 = {{&nonterm49, &state192}};
+std::vector<Go> go192 = {{&nonterm50, &state196}};
+std::vector<Go> go199 = {{&nonterm51, &state200}};
+std::vector<Go> go200 = {{&nonterm52, &state204}};
+std::vector<Go> go207 = {{&nonterm53, &state208}};
+std::vector<Go> go208 = {{&nonterm54, &state212}};
+std::vector<Go> go215 = {{&nonterm55, &state216}};
+std::vector<Go> go216 = {{&nonterm56, &state220}};
+std::vector<Go> go223 = {{&nonterm57, &state224}};
+std::vector<Go> go224 = {{&nonterm58, &state228}};
+std::vector<Go> go231 = {{&nonterm59, &state232}};
+std::vector<Go> go232 = {{&nonterm60, &state236}};
+std::vector<Go> go239 = {{&nonterm61, &state240}};
+std::vector<Go> go240 = {{&nonterm62, &state244}};
+std::vector<Go> go247 = {{&nonterm63, &state248}};
+std::vector<Go> go248 = {{&nonterm64, &state252}};
+std::vector<Go> go255 = {{&nonterm65, &state256}};
+std::vector<Go> go256 = {{&nonterm66, &state260}};
+std::vector<Go> go263 = {{&nonterm67, &state264}};
+std::vector<Go> go264 = {{&nonterm68, &state268}};
+std::vector<Go> go271 = {{&nonterm69, &state272}};
+std::vector<Go> go272 = {{&nonterm70, &state276}};
+std::vector<Go> go279 = {{&nonterm71, &state280}};
+std::vector<Go> go280 = {{&nonterm72, &state284}};
+std::vector<Go> go287 = {{&nonterm73, &state288}};
+std::vector<Go> go288 = {{&nonterm74, &state292}};
+std::vector<Go> go295 = {{&nonterm75, &state296}};
+std::vector<Go> go296 = {{&nonterm76, &state300}};
+std::vector<Go> go303 = {{&nonterm77, &state304}};
+std::vector<Go> go304 = {{&nonterm78, &state308}};
+std::vector<Go> go311 = {{&nonterm79, &state312}};
+std::vector<Go> go312 = {{&nonterm80, &state316}};
+std::vector<Go> go319 = {{&nonterm81, &state320}};
+std::vector<Go> go320 = {{&nonterm82, &state324}};
+std::vector<Go> go327 = {{&nonterm83, &state328}};
+std::vector<Go> go328 = {{&nonterm84, &state332}};
+std::vector<Go> go335 = {{&nonterm85, &state336}};
+std::vector<Go> go336 = {{&nonterm86, &state340}};
+std::vector<Go> go343 = {{&nonterm87, &state344}};
+std::vector<Go> go344 = {{&nonterm88, &state348}};
+std::vector<Go> go351 = {{&nonterm89, &state352}};
+std::vector<Go> go352 = {{&nonterm90, &state356}};
+std::vector<Go> go359 = {{&nonterm91, &state360}};
+std::vector<Go> go360 = {{&nonterm92, &state364}};
+std::vector<Go> go367 = {{&nonterm93, &state368}};
+std::vector<Go> go368 = {{&nonterm94, &state372}};
+std::vector<Go> go375 = {{&nonterm95, &state376}};
+std::vector<Go> go376 = {{&nonterm96, &state380}};
+std::vector<Go> go383 = {{&nonterm97, &state384}};
+std::vector<Go> go384 = {{&nonterm98, &state388}};
+std::vector<Go> go391 = {{&nonterm99, &state392}};
+std::vector<Go> go392 = {{&nonterm100, &state396}};
+std::vector<Go> go399 = {{&nonterm101, &state400}};
+std::vector<Go> go400 = {{&nonterm102, &state404}};
+std::vector<Go> go407 = {{&nonterm103, &state408}};
+std::vector<Go> go408 = {{&nonterm104, &state412}};
+std::vector<Go> go415 = {{&nonterm105, &state416}};
+std::vector<Go> go416 = {{&nonterm106, &state420}};
+std::vector<Go> go423 = {{&nonterm107, &state424}};
+std::vector<Go> go424 = {{&nonterm108, &state428}};
+std::vector<Go> go431 = {{&nonterm109, &state432}};
+std::vector<Go> go432 = {{&nonterm110, &state436}};
+std::vector<Go> go439 = {{&nonterm111, &state440}};
+std::vector<Go> go440 = {{&nonterm112, &state444}};
+std::vector<Go> go447 = {{&nonterm113, &state448}};
+std::vector<Go> go448 = {{&nonterm114, &state452}};
+std::vector<Go> go455 = {{&nonterm115, &state456}};
+std::vector<Go> go456 = {{&nonterm116, &state460}};
+std::vector<Go> go463 = {{&nonterm117, &state464}};
+std::vector<Go> go464 = {{&nonterm118, &state468}};
+std::vector<Go> go471 = {{&nonterm119, &state472}};
+std::vector<Go> go472 = {{&nonterm120, &state476}};
+std::vector<Go> go479 = {{&nonterm121, &state480}};
+std::vector<Go> go480 = {{&nonterm122, &state484}};
+std::vector<Go> go487 = {{&nonterm123, &state488}};
+std::vector<Go> go488 = {{&nonterm124, &state492}};
+std::vector<Go> go495 = {{&nonterm125, &state496}};
+std::vector<Go> go496 = {{&nonterm126, &state500}};
+std::vector<Go> go503 = {{&nonterm127, &state504}};
+std::vector<Go> go504 = {{&nonterm128, &state508}};
+std::vector<Go> go511 = {{&nonterm1, &state512}};
+std::vector<Go> go512 = {{&nonterm2, &state516}};
+std::vector<Go> go519 = {{&nonterm3, &state520}};
+std::vector<Go> go520 = {{&nonterm4, &state12}};
+std::vector<Go> go524 = {{&nonterm3, &state525}};
+std::vector<Go> go525 = {{&nonterm4, &state529}};
+std::vector<Go> go532 = {{&nonterm5, &state533}};
+std::vector<Go> go533 = {{&nonterm6, &state20}};
+std::vector<Go> go537 = {{&nonterm5, &state538}};
+std::vector<Go> go538 = {{&nonterm6, &state542}};
+std::vector<Go> go545 = {{&nonterm7, &state546}};
+std::vector<Go> go546 = {{&nonterm8, &state28}};
+std::vector<Go> go550 = {{&nonterm7, &state551}};
+std::vector<Go> go551 = {{&nonterm8, &state555}};
+std::vector<Go> go558 = {{&nonterm9, &state559}};
+std::vector<Go> go559 = {{&nonterm10, &state36}};
+std::vector<Go> go563 = {{&nonterm9, &state564}};
+std::vector<Go> go564 = {{&nonterm10, &state568}};
+std::vector<Go> go571 = {{&nonterm11, &state572}};
+std::vector<Go> go572 = {{&nonterm12, &state44}};
+std::vector<Go> go576 = {{&nonterm11, &state577}};
+std::vector<Go> go577 = {{&nonterm12, &state581}};
+std::vector<Go> go584 = {{&nonterm13, &state585}};
+std::vector<Go> go585 = {{&nonterm14, &state52}};
+std::vector<Go> go589 = {{&nonterm13, &state590}};
+std::vector<Go> go590 = {{&nonterm14, &state594}};
+std::vector<Go> go597 = {{&nonterm15, &state598}};
+std::vector<Go> go598 = {{&nonterm16, &state60}};
+std::vector<Go> go602 = {{&nonterm15, &state603}};
+std::vector<Go> go603 = {{&nonterm16, &state607}};
+std::vector<Go> go610 = {{&nonterm17, &state611}};
+std::vector<Go> go611 = {{&nonterm18, &state68}};
+std::vector<Go> go615 = {{&nonterm17, &state616}};
+std::vector<Go> go616 = {{&nonterm18, &state620}};
+std::vector<Go> go623 = {{&nonterm19, &state624}};
+std::vector<Go> go624 = {{&nonterm20, &state76}};
+std::vector<Go> go628 = {{&nonterm19, &state629}};
+std::vector<Go> go629 = {{&nonterm20, &state633}};
+std::vector<Go> go636 = {{&nonterm21, &state637}};
+std::vector<Go> go637 = {{&nonterm22, &state84}};
+std::vector<Go> go641 = {{&nonterm21, &state642}};
+std::vector<Go> go642 = {{&nonterm22, &state646}};
+std::vector<Go> go649 = {{&nonterm23, &state650}};
+std::vector<Go> go650 = {{&nonterm24, &state92}};
+std::vector<Go> go654 = {{&nonterm23, &state655}};
+std::vector<Go> go655 = {{&nonterm24, &state659}};
+std::vector<Go> go662 = {{&nonterm25, &state663}};
+std::vector<Go> go663 = {{&nonterm26, &state100}};
+std::vector<Go> go667 = {{&nonterm25, &state668}};
+std::vector<Go> go668 = {{&nonterm26, &state672}};
+std::vector<Go> go675 = {{&nonterm27, &state676}};
+std::vector<Go> go676 = {{&nonterm28, &state108}};
+std::vector<Go> go680 = {{&nonterm27, &state681}};
+std::vector<Go> go681 = {{&nonterm28, &state685}};
+std::vector<Go> go688 = {{&nonterm29, &state689}};
+std::vector<Go> go689 = {{&nonterm30, &state116}};
+std::vector<Go> go693 = {{&nonterm29, &state694}};
+std::vector<Go> go694 = {{&nonterm30, &state698}};
+std::vector<Go> go701 = {{&nonterm31, &state702}};
+std::vector<Go> go702 = {{&nonterm32, &state124}};
+std::vector<Go> go706 = {{&nonterm31, &state707}};
+std::vector<Go> go707 = {{&nonterm32, &state711}};
+std::vector<Go> go714 = {{&nonterm33, &state715}};
+std::vector<Go> go715 = {{&nonterm34, &state132}};
+std::vector<Go> go719 = {{&nonterm33, &state720}};
+std::vector<Go> go720 = {{&nonterm34, &state724}};
+std::vector<Go> go727 = {{&nonterm35, &state728}};
+std::vector<Go> go728 = {{&nonterm36, &state140}};
+std::vector<Go> go732 = {{&nonterm35, &state733}};
+std::vector<Go> go733 = {{&nonterm36, &state737}};
+std::vector<Go> go740 = {{&nonterm37, &state741}};
+std::vector<Go> go741 = {{&nonterm38, &state148}};
+std::vector<Go> go745 = {{&nonterm37, &state746}};
+std::vector<Go> go746 = {{&nonterm38, &state750}};
+std::vector<Go> go753 = {{&nonterm39, &state754}};
+std::vector<Go> go754 = {{&nonterm40, &state156}};
+std::vector<Go> go758 = {{&nonterm39, &state759}};
+std::vector<Go> go759 = {{&nonterm40, &state763}};
+std::vector<Go> go766 = {{&nonterm41, &state767}};
+std::vector<Go> go767 = {{&nonterm42, &state164}};
+std::vector<Go> go771 = {{&nonterm41, &state772}};
+std::vector<Go> go772 = {{&nonterm42, &state776}};
+std::vector<Go> go779 = {{&nonterm43, &state780}};
+std::vector<Go> go780 = {{&nonterm44, &state172}};
+std::vector<Go> go784 = {{&nonterm43, &state785}};
+std::vector<Go> go785 = {{&nonterm44, &state789}};
+std::vector<Go> go792 = {{&nonterm45, &state793}};
+std::vector<Go> go793 = {{&nonterm46, &state180}};
+std::vector<Go> go797 = {{&nonterm45, &state798}};
+std::vector<Go> go798 = {{&nonterm46, &state802}};
+std::vector<Go> go805 = {{&nonterm47, &state806}};
+std::vector<Go> go806 = {{&nonterm48, &state188}};
+std::vector<Go> go810 = {{&nonterm47, &state811}};
+std::vector<Go> go811 = {{&nonterm48, &state815}};
+std::vector<Go> go818 = {{&nonterm49, &state819}};
+std::vector<Go> go819 = {{&nonterm50, &state196}};
+std::vector<Go> go823 = {{&nonterm49, &state824}};
+std::vector<Go> go824 = {{&nonterm50, &state828}};
+std::vector<Go> go831 = {{&nonterm51, &state832}};
+std::vector<Go> go832 = {{&nonterm52, &state204}};
+std::vector<Go> go836 = {{&nonterm51, &state837}};
+std::vector<Go> go837 = {{&nonterm52, &state841}};
+std::vector<Go> go844 = {{&nonterm53, &state845}};
+std::vector<Go> go845 = {{&nonterm54, &state212}};
+std::vector<Go> go849 = {{&nonterm53, &state850}};
+std::vector<Go> go850 = {{&nonterm54, &state854}};
+std::vector<Go> go857 = {{&nonterm55, &state858}};
+std::vector<Go> go858 = {{&nonterm56, &state220}};
+std::vector<Go> go862 = {{&nonterm55, &state863}};
+std::vector<Go> go863 = {{&nonterm56, &state867}};
+std::vector<Go> go870 = {{&nonterm57, &state871}};
+std::vector<Go> go871 = {{&nonterm58, &state228}};
+std::vector<Go> go875 = {{&nonterm57, &state876}};
+std::vector<Go> go876 = {{&nonterm58, &state880}};
+std::vector<Go> go883 = {{&nonterm59, &state884}};
+std::vector<Go> go884 = {{&nonterm60, &state236}};
+std::vector<Go> go888 = {{&nonterm59, &state889}};
+std::vector<Go> go889 = {{&nonterm60, &state893}};
+std::vector<Go> go896 = {{&nonterm61, &state897}};
+std::vector<Go> go897 = {{&nonterm62, &state244}};
+std::vector<Go> go901 = {{&nonterm61, &state902}};
+std::vector<Go> go902 = {{&nonterm62, &state906}};
+std::vector<Go> go909 = {{&nonterm63, &state910}};
+std::vector<Go> go910 = {{&nonterm64, &state252}};
+std::vector<Go> go914 = {{&nonterm63, &state915}};
+std::vector<Go> go915 = {{&nonterm64, &state919}};
+std::vector<Go> go922 = {{&nonterm65, &state923}};
+std::vector<Go> go923 = {{&nonterm66, &state260}};
+std::vector<Go> go927 = {{&nonterm65, &state928}};
+std::vector<Go> go928 = {{&nonterm66, &state932}};
+std::vector<Go> go935 = {{&nonterm67, &state936}};
+std::vector<Go> go936 = {{&nonterm68, &state268}};
+std::vector<Go> go940 = {{&nonterm67, &state941}};
+std::vector<Go> go941 = {{&nonterm68, &state945}};
+std::vector<Go> go948 = {{&nonterm69, &state949}};
+std::vector<Go> go949 = {{&nonterm70, &state276}};
+std::vector<Go> go953 = {{&nonterm69, &state954}};
+std::vector<Go> go954 = {{&nonterm70, &state958}};
+std::vector<Go> go961 = {{&nonterm71, &state962}};
+std::vector<Go> go962 = {{&nonterm72, &state284}};
+std::vector<Go> go966 = {{&nonterm71, &state967}};
+std::vector<Go> go967 = {{&nonterm72, &state971}};
+std::vector<Go> go974 = {{&nonterm73, &state975}};
+std::vector<Go> go975 = {{&nonterm74, &state292}};
+std::vector<Go> go979 = {{&nonterm73, &state980}};
+std::vector<Go> go980 = {{&nonterm74, &state984}};
+std::vector<Go> go987 = {{&nonterm75, &state988}};
+std::vector<Go> go988 = {{&nonterm76, &state300}};
+std::vector<Go> go992 = {{&nonterm75, &state993}};
+std::vector<Go> go993 = {{&nonterm76, &state997}};
+std::vector<Go> go1000 = {{&nonterm77, &state1001}};
+std::vector<Go> go1001 = {{&nonterm78, &state308}};
+std::vector<Go> go1005 = {{&nonterm77, &state1006}};
+std::vector<Go> go1006 = {{&nonterm78, &state1010}};
+std::vector<Go> go1013 = {{&nonterm79, &state1014}};
+std::vector<Go> go1014 = {{&nonterm80, &state316}};
+std::vector<Go> go1018 = {{&nonterm79, &state1019}};
+std::vector<Go> go1019 = {{&nonterm80, &state1023}};
+std::vector<Go> go1026 = {{&nonterm81, &state1027}};
+std::vector<Go> go1027 = {{&nonterm82, &state324}};
+std::vector<Go> go1031 = {{&nonterm81, &state1032}};
+std::vector<Go> go1032 = {{&nonterm82, &state1036}};
+std::vector<Go> go1039 = {{&nonterm83, &state1040}};
+std::vector<Go> go1040 = {{&nonterm84, &state332}};
+std::vector<Go> go1044 = {{&nonterm83, &state1045}};
+std::vector<Go> go1045 = {{&nonterm84, &state1049}};
+std::vector<Go> go1052 = {{&nonterm85, &state1053}};
+std::vector<Go> go1053 = {{&nonterm86, &state340}};
+std::vector<Go> go1057 = {{&nonterm85, &state1058}};
+std::vector<Go> go1058 = {{&nonterm86, &state1062}};
+std::vector<Go> go1065 = {{&nonterm87, &state1066}};
+std::vector<Go> go1066 = {{&nonterm88, &state348}};
+std::vector<Go> go1070 = {{&nonterm87, &state1071}};
+std::vector<Go> go1071 = {{&nonterm88, &state1075}};
+std::vector<Go> go1078 = {{&nonterm89, &state1079}};
+std::vector<Go> go1079 = {{&nonterm90, &state356}};
+std::vector<Go> go1083 = {{&nonterm89, &state1084}};
+std::vector<Go> go1084 = {{&nonterm90, &state1088}};
+std::vector<Go> go1091 = {{&nonterm91, &state1092}};
+std::vector<Go> go1092 = {{&nonterm92, &state364}};
+std::vector<Go> go1096 = {{&nonterm91, &state1097}};
+std::vector<Go> go1097 = {{&nonterm92, &state1101}};
+std::vector<Go> go1104 = {{&nonterm93, &state1105}};
+std::vector<Go> go1105 = {{&nonterm94, &state372}};
+std::vector<Go> go1109 = {{&nonterm93, &state1110}};
+std::vector<Go> go1110 = {{&nonterm94, &state1114}};
+std::vector<Go> go1117 = {{&nonterm95, &state1118}};
+std::vector<Go> go1118 = {{&nonterm96, &state380}};
+std::vector<Go> go1122 = {{&nonterm95, &state1123}};
+std::vector<Go> go1123 = {{&nonterm96, &state1127}};
+std::vector<Go> go1130 = {{&nonterm97, &state1131}};
+std::vector<Go> go1131 = {{&nonterm98, &state388}};
+std::vector<Go> go1135 = {{&nonterm97, &state1136}};
+std::vector<Go> go1136 = {{&nonterm98, &state1140}};
+std::vector<Go> go1143 = {{&nonterm99, &state1144}};
+std::vector<Go> go1144 = {{&nonterm100, &state396}};
+std::vector<Go> go1148 = {{&nonterm99, &state1149}};
+std::vector<Go> go1149 = {{&nonterm100, &state1153}};
+std::vector<Go> go1156 = {{&nonterm101, &state1157}};
+std::vector<Go> go1157 = {{&nonterm102, &state404}};
+std::vector<Go> go1161 = {{&nonterm101, &state1162}};
+std::vector<Go> go1162 = {{&nonterm102, &state1166}};
+std::vector<Go> go1169 = {{&nonterm103, &state1170}};
+std::vector<Go> go1170 = {{&nonterm104, &state412}};
+std::vector<Go> go1174 = {{&nonterm103, &state1175}};
+std::vector<Go> go1175 = {{&nonterm104, &state1179}};
+std::vector<Go> go1182 = {{&nonterm105, &state1183}};
+std::vector<Go> go1183 = {{&nonterm106, &state420}};
+std::vector<Go> go1187 = {{&nonterm105, &state1188}};
+std::vector<Go> go1188 = {{&nonterm106, &state1192}};
+std::vector<Go> go1195 = {{&nonterm107, &state1196}};
+std::vector<Go> go1196 = {{&nonterm108, &state428}};
+std::vector<Go> go1200 = {{&nonterm107, &state1201}};
+std::vector<Go> go1201 = {{&nonterm108, &state1205}};
+std::vector<Go> go1208 = {{&nonterm109, &state1209}};
+std::vector<Go> go1209 = {{&nonterm110, &state436}};
+std::vector<Go> go1213 = {{&nonterm109, &state1214}};
+std::vector<Go> go1214 = {{&nonterm110, &state1218}};
+std::vector<Go> go1221 = {{&nonterm111, &state1222}};
+std::vector<Go> go1222 = {{&nonterm112, &state444}};
+std::vector<Go> go1226 = {{&nonterm111, &state1227}};
+std::vector<Go> go1227 = {{&nonterm112, &state1231}};
+std::vector<Go> go1234 = {{&nonterm113, &state1235}};
+std::vector<Go> go1235 = {{&nonterm114, &state452}};
+std::vector<Go> go1239 = {{&nonterm113, &state1240}};
+std::vector<Go> go1240 = {{&nonterm114, &state1244}};
+std::vector<Go> go1247 = {{&nonterm115, &state1248}};
+std::vector<Go> go1248 = {{&nonterm116, &state460}};
+std::vector<Go> go1252 = {{&nonterm115, &state1253}};
+std::vector<Go> go1253 = {{&nonterm116, &state1257}};
+std::vector<Go> go1260 = {{&nonterm117, &state1261}};
+std::vector<Go> go1261 = {{&nonterm118, &state468}};
+std::vector<Go> go1265 = {{&nonterm117, &state1266}};
+std::vector<Go> go1266 = {{&nonterm118, &state1270}};
+std::vector<Go> go1273 = {{&nonterm119, &state1274}};
+std::vector<Go> go1274 = {{&nonterm120, &state476}};
+std::vector<Go> go1278 = {{&nonterm119, &state1279}};
+std::vector<Go> go1279 = {{&nonterm120, &state1283}};
+std::vector<Go> go1286 = {{&nonterm121, &state1287}};
+std::vector<Go> go1287 = {{&nonterm122, &state484}};
+std::vector<Go> go1291 = {{&nonterm121, &state1292}};
+std::vector<Go> go1292 = {{&nonterm122, &state1296}};
+std::vector<Go> go1299 = {{&nonterm123, &state1300}};
+std::vector<Go> go1300 = {{&nonterm124, &state492}};
+std::vector<Go> go1304 = {{&nonterm123, &state1305}};
+std::vector<Go> go1305 = {{&nonterm124, &state1309}};
+std::vector<Go> go1312 = {{&nonterm125, &state1313}};
+std::vector<Go> go1313 = {{&nonterm126, &state500}};
+std::vector<Go> go1317 = {{&nonterm125, &state1318}};
+std::vector<Go> go1318 = {{&nonterm126, &state1322}};
+std::vector<Go> go1325 = {{&nonterm127, &state1326}};
+std::vector<Go> go1326 = {{&nonterm128, &state508}};
+std::vector<Go> go1330 = {{&nonterm127, &state1331}};
+std::vector<Go> go1331 = {{&nonterm128, &state1335}};
+std::vector<Go> go1338 = {{&nonterm1, &state1339}};
+std::vector<Go> go1339 = {{&nonterm2, &state516}};
+std::vector<Go> go1343 = {{&nonterm1, &state1344}};
+std::vector<Go> go1344 = {{&nonterm2, &state1348}};
+std::vector<Go> go1351 = {{&nonterm3, &state1352}};
+std::vector<Go> go1352 = {{&nonterm4, &state12}};
+std::vector<Go> go1356 = {{&nonterm3, &state1357}};
+std::vector<Go> go1357 = {{&nonterm4, &state529}};
+std::vector<Go> go1361 = {{&nonterm1, &state1362}};
+std::vector<Go> go1362 = {{&nonterm2, &state1348}};
+std::vector<Go> go1366 = {{&nonterm127, &state1367}};
+std::vector<Go> go1367 = {{&nonterm128, &state1335}};
+std::vector<Go> go1371 = {{&nonterm125, &state1372}};
+std::vector<Go> go1372 = {{&nonterm126, &state1322}};
+std::vector<Go> go1376 = {{&nonterm123, &state1377}};
+std::vector<Go> go1377 = {{&nonterm124, &state1309}};
+std::vector<Go> go1381 = {{&nonterm121, &state1382}};
+std::vector<Go> go1382 = {{&nonterm122, &state1296}};
+std::vector<Go> go1386 = {{&nonterm119, &state1387}};
+std::vector<Go> go1387 = {{&nonterm120, &state1283}};
+std::vector<Go> go1391 = {{&nonterm117, &state1392}};
+std::vector<Go> go1392 = {{&nonterm118, &state1270}};
+std::vector<Go> go1396 = {{&nonterm115, &state1397}};
+std::vector<Go> go1397 = {{&nonterm116, &state1257}};
+std::vector<Go> go1401 = {{&nonterm113, &state1402}};
+std::vector<Go> go1402 = {{&nonterm114, &state1244}};
+std::vector<Go> go1406 = {{&nonterm111, &state1407}};
+std::vector<Go> go1407 = {{&nonterm112, &state1231}};
+std::vector<Go> go1411 = {{&nonterm109, &state1412}};
+std::vector<Go> go1412 = {{&nonterm110, &state1218}};
+std::vector<Go> go1416 = {{&nonterm107, &state1417}};
+std::vector<Go> go1417 = {{&nonterm108, &state1205}};
+std::vector<Go> go1421 = {{&nonterm105, &state1422}};
+std::vector<Go> go1422 = {{&nonterm106, &state1192}};
+std::vector<Go> go1426 = {{&nonterm103, &state1427}};
+std::vector<Go> go1427 = {{&nonterm104, &state1179}};
+std::vector<Go> go1431 = {{&nonterm101, &state1432}};
+std::vector<Go> go1432 = {{&nonterm102, &state1166}};
+std::vector<Go> go1436 = {{&nonterm99, &state1437}};
+std::vector<Go> go1437 = {{&nonterm100, &state1153}};
+std::vector<Go> go1441 = {{&nonterm97, &state1442}};
+std::vector<Go> go1442 = {{&nonterm98, &state1140}};
+std::vector<Go> go1446 = {{&nonterm95, &state1447}};
+std::vector<Go> go1447 = {{&nonterm96, &state1127}};
+std::vector<Go> go1451 = {{&nonterm93, &state1452}};
+std::vector<Go> go1452 = {{&nonterm94, &state1114}};
+std::vector<Go> go1456 = {{&nonterm91, &state1457}};
+std::vector<Go> go1457 = {{&nonterm92, &state1101}};
+std::vector<Go> go1461 = {{&nonterm89, &state1462}};
+std::vector<Go> go1462 = {{&nonterm90, &state1088}};
+std::vector<Go> go1466 = {{&nonterm87, &state1467}};
+std::vector<Go> go1467 = {{&nonterm88, &state1075}};
+std::vector<Go> go1471 = {{&nonterm85, &state1472}};
+std::vector<Go> go1472 = {{&nonterm86, &state1062}};
+std::vector<Go> go1476 = {{&nonterm83, &state1477}};
+std::vector<Go> go1477 = {{&nonterm84, &state1049}};
+std::vector<Go> go1481 = {{&nonterm81, &state1482}};
+std::vector<Go> go1482 = {{&nonterm82, &state1036}};
+std::vector<Go> go1486 = {{&nonterm79, &state1487}};
+std::vector<Go> go1487 = {{&nonterm80, &state1023}};
+std::vector<Go> go1491 = {{&nonterm77, &state1492}};
+std::vector<Go> go1492 = {{&nonterm78, &state1010}};
+std::vector<Go> go1496 = {{&nonterm75, &state1497}};
+std::vector<Go> go1497 = {{&nonterm76, &state997}};
+std::vector<Go> go1501 = {{&nonterm73, &state1502}};
+std::vector<Go> go1502 = {{&nonterm74, &state984}};
+std::vector<Go> go1506 = {{&nonterm71, &state1507}};
+std::vector<Go> go1507 = {{&nonterm72, &state971}};
+std::vector<Go> go1511 = {{&nonterm69, &state1512}};
+std::vector<Go> go1512 = {{&nonterm70, &state958}};
+std::vector<Go> go1516 = {{&nonterm67, &state1517}};
+std::vector<Go> go1517 = {{&nonterm68, &state945}};
+std::vector<Go> go1521 = {{&nonterm65, &state1522}};
+std::vector<Go> go1522 = {{&nonterm66, &state932}};
+std::vector<Go> go1526 = {{&nonterm63, &state1527}};
+std::vector<Go> go1527 = {{&nonterm64, &state919}};
+std::vector<Go> go1531 = {{&nonterm61, &state1532}};
+std::vector<Go> go1532 = {{&nonterm62, &state906}};
+std::vector<Go> go1536 = {{&nonterm59, &state1537}};
+std::vector<Go> go1537 = {{&nonterm60, &state893}};
+std::vector<Go> go1541 = {{&nonterm57, &state1542}};
+std::vector<Go> go1542 = {{&nonterm58, &state880}};
+std::vector<Go> go1546 = {{&nonterm55, &state1547}};
+std::vector<Go> go1547 = {{&nonterm56, &state867}};
+std::vector<Go> go1551 = {{&nonterm53, &state1552}};
+std::vector<Go> go1552 = {{&nonterm54, &state854}};
+std::vector<Go> go1556 = {{&nonterm51, &state1557}};
+std::vector<Go> go1557 = {{&nonterm52, &state841}};
+std::vector<Go> go1561 = {{&nonterm49, &state1562}};
+std::vector<Go> go1562 = {{&nonterm50, &state828}};
+std::vector<Go> go1566 = {{&nonterm47, &state1567}};
+std::vector<Go> go1567 = {{&nonterm48, &state815}};
+std::vector<Go> go1571 = {{&nonterm45, &state1572}};
+std::vector<Go> go1572 = {{&nonterm46, &state802}};
+std::vector<Go> go1576 = {{&nonterm43, &state1577}};
+std::vector<Go> go1577 = {{&nonterm44, &state789}};
+std::vector<Go> go1581 = {{&nonterm41, &state1582}};
+std::vector<Go> go1582 = {{&nonterm42, &state776}};
+std::vector<Go> go1586 = {{&nonterm39, &state1587}};
+std::vector<Go> go1587 = {{&nonterm40, &state763}};
+std::vector<Go> go1591 = {{&nonterm37, &state1592}};
+std::vector<Go> go1592 = {{&nonterm38, &state750}};
+std::vector<Go> go1596 = {{&nonterm35, &state1597}};
+std::vector<Go> go1597 = {{&nonterm36, &state737}};
+std::vector<Go> go1601 = {{&nonterm33, &state1602}};
+std::vector<Go> go1602 = {{&nonterm34, &state724}};
+std::vector<Go> go1606 = {{&nonterm31, &state1607}};
+std::vector<Go> go1607 = {{&nonterm32, &state711}};
+std::vector<Go> go1611 = {{&nonterm29, &state1612}};
+std::vector<Go> go1612 = {{&nonterm30, &state698}};
+std::vector<Go> go1616 = {{&nonterm27, &state1617}};
+std::vector<Go> go1617 = {{&nonterm28, &state685}};
+std::vector<Go> go1621 = {{&nonterm25, &state1622}};
+std::vector<Go> go1622 = {{&nonterm26, &state672}};
+std::vector<Go> go1626 = {{&nonterm23, &state1627}};
+std::vector<Go> go1627 = {{&nonterm24, &state659}};
+std::vector<Go> go1631 = {{&nonterm21, &state1632}};
+std::vector<Go> go1632 = {{&nonterm22, &state646}};
+std::vector<Go> go1636 = {{&nonterm19, &state1637}};
+std::vector<Go> go1637 = {{&nonterm20, &state633}};
+std::vector<Go> go1641 = {{&nonterm17, &state1642}};
+std::vector<Go> go1642 = {{&nonterm18, &state620}};
+std::vector<Go> go1646 = {{&nonterm15, &state1647}};
+std::vector<Go> go1647 = {{&nonterm16, &state607}};
+std::vector<Go> go1651 = {{&nonterm13, &state1652}};
+std::vector<Go> go1652 = {{&nonterm14, &state594}};
+std::vector<Go> go1656 = {{&nonterm11, &state1657}};
+std::vector<Go> go1657 = {{&nonterm12, &state581}};
+std::vector<Go> go1661 = {{&nonterm9, &state1662}};
+std::vector<Go> go1662 = {{&nonterm10, &state568}};
+std::vector<Go> go1666 = {{&nonterm7, &state1667}};
+std::vector<Go> go1667 = {{&nonterm8, &state555}};
+std::vector<Go> go1671 = {{&nonterm5, &state1672}};
+std::vector<Go> go1672 = {{&nonterm6, &state542}};
+std::vector<Go> go1676 = {{&nonterm3, &state1677}};
+std::vector<Go> go1677 = {{&nonterm4, &state529}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, nullptr};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, &go7};
+State state8 = {&shift8, &reduce8, &go8};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, &go15};
+State state16 = {&shift16, &reduce16, &go16};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, &go23};
+State state24 = {&shift24, &reduce24, &go24};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, &go31};
+State state32 = {&shift32, &reduce32, &go32};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, &go39};
+State state40 = {&shift40, &reduce40, &go40};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, &go47};
+State state48 = {&shift48, &reduce48, &go48};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, &go55};
+State state56 = {&shift56, &reduce56, &go56};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, &go63};
+State state64 = {&shift64, &reduce64, &go64};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, &go71};
+State state72 = {&shift72, &reduce72, &go72};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, &go79};
+State state80 = {&shift80, &reduce80, &go80};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, &go87};
+State state88 = {&shift88, &reduce88, &go88};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, &go95};
+State state96 = {&shift96, &reduce96, &go96};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, &go103};
+State state104 = {&shift104, &reduce104, &go104};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, &go111};
+State state112 = {&shift112, &reduce112, &go112};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, &go119};
+State state120 = {&shift120, &reduce120, &go120};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, &go127};
+State state128 = {&shift128, &reduce128, &go128};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, &go135};
+State state136 = {&shift136, &reduce136, &go136};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift140, &reduce140, nullptr};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift142, &reduce142, nullptr};
+State state143 = {&shift143, &reduce143, &go143};
+State state144 = {&shift144, &reduce144, &go144};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift146, &reduce146, nullptr};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift148, &reduce148, nullptr};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift150, &reduce150, nullptr};
+State state151 = {&shift151, &reduce151, &go151};
+State state152 = {&shift152, &reduce152, &go152};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift154, &reduce154, nullptr};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift156, &reduce156, nullptr};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift158, &reduce158, nullptr};
+State state159 = {&shift159, &reduce159, &go159};
+State state160 = {&shift160, &reduce160, &go160};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift162, &reduce162, nullptr};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift164, &reduce164, nullptr};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift166, &reduce166, nullptr};
+State state167 = {&shift167, &reduce167, &go167};
+State state168 = {&shift168, &reduce168, &go168};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift170, &reduce170, nullptr};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift172, &reduce172, nullptr};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift175, &reduce175, &go175};
+State state176 = {&shift176, &reduce176, &go176};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift178, &reduce178, nullptr};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift180, &reduce180, nullptr};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift182, &reduce182, nullptr};
+State state183 = {&shift183, &reduce183, &go183};
+State state184 = {&shift184, &reduce184, &go184};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift186, &reduce186, nullptr};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift188, &reduce188, nullptr};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift190, &reduce190, nullptr};
+State state191 = {&shift191, &reduce191, &go191};
+State state192 = {&shift192, &reduce192, &go192};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift194, &reduce194, nullptr};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift196, &reduce196, nullptr};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift199, &reduce199, &go199};
+State state200 = {&shift200, &reduce200, &go200};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift202, &reduce202, nullptr};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, &go207};
+State state208 = {&shift208, &reduce208, &go208};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, &go215};
+State state216 = {&shift216, &reduce216, &go216};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, &go223};
+State state224 = {&shift224, &reduce224, &go224};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, &go231};
+State state232 = {&shift232, &reduce232, &go232};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, &go239};
+State state240 = {&shift240, &reduce240, &go240};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, &go247};
+State state248 = {&shift248, &reduce248, &go248};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift255, &reduce255, &go255};
+State state256 = {&shift256, &reduce256, &go256};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift263, &reduce263, &go263};
+State state264 = {&shift264, &reduce264, &go264};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift268, &reduce268, nullptr};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, &go271};
+State state272 = {&shift272, &reduce272, &go272};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift276, &reduce276, nullptr};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift278, &reduce278, nullptr};
+State state279 = {&shift279, &reduce279, &go279};
+State state280 = {&shift280, &reduce280, &go280};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, nullptr};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift286, &reduce286, nullptr};
+State state287 = {&shift287, &reduce287, &go287};
+State state288 = {&shift288, &reduce288, &go288};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift290, &reduce290, nullptr};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift295, &reduce295, &go295};
+State state296 = {&shift296, &reduce296, &go296};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift302, &reduce302, nullptr};
+State state303 = {&shift303, &reduce303, &go303};
+State state304 = {&shift304, &reduce304, &go304};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift308, &reduce308, nullptr};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, &go311};
+State state312 = {&shift312, &reduce312, &go312};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, &go319};
+State state320 = {&shift320, &reduce320, &go320};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift322, &reduce322, nullptr};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift326, &reduce326, nullptr};
+State state327 = {&shift327, &reduce327, &go327};
+State state328 = {&shift328, &reduce328, &go328};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift330, &reduce330, nullptr};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift335, &reduce335, &go335};
+State state336 = {&shift336, &reduce336, &go336};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, nullptr};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift340, &reduce340, nullptr};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift343, &reduce343, &go343};
+State state344 = {&shift344, &reduce344, &go344};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift351, &reduce351, &go351};
+State state352 = {&shift352, &reduce352, &go352};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift354, &reduce354, nullptr};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift356, &reduce356, nullptr};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift358, &reduce358, nullptr};
+State state359 = {&shift359, &reduce359, &go359};
+State state360 = {&shift360, &reduce360, &go360};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift362, &reduce362, nullptr};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift364, &reduce364, nullptr};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift367, &reduce367, &go367};
+State state368 = {&shift368, &reduce368, &go368};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift372, &reduce372, nullptr};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift374, &reduce374, nullptr};
+State state375 = {&shift375, &reduce375, &go375};
+State state376 = {&shift376, &reduce376, &go376};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift378, &reduce378, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift380, &reduce380, nullptr};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift382, &reduce382, nullptr};
+State state383 = {&shift383, &reduce383, &go383};
+State state384 = {&shift384, &reduce384, &go384};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift391, &reduce391, &go391};
+State state392 = {&shift392, &reduce392, &go392};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift394, &reduce394, nullptr};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift399, &reduce399, &go399};
+State state400 = {&shift400, &reduce400, &go400};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift403, &reduce403, nullptr};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift407, &reduce407, &go407};
+State state408 = {&shift408, &reduce408, &go408};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift412, &reduce412, nullptr};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, &go415};
+State state416 = {&shift416, &reduce416, &go416};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, nullptr};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, &go423};
+State state424 = {&shift424, &reduce424, &go424};
+State state425 = {&shift425, &reduce425, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift430, &reduce430, nullptr};
+State state431 = {&shift431, &reduce431, &go431};
+State state432 = {&shift432, &reduce432, &go432};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift434, &reduce434, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, nullptr};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift439, &reduce439, &go439};
+State state440 = {&shift440, &reduce440, &go440};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift443, &reduce443, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, nullptr};
+State state447 = {&shift447, &reduce447, &go447};
+State state448 = {&shift448, &reduce448, &go448};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, &go455};
+State state456 = {&shift456, &reduce456, &go456};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, &go463};
+State state464 = {&shift464, &reduce464, &go464};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift471, &reduce471, &go471};
+State state472 = {&shift472, &reduce472, &go472};
+State state473 = {&shift473, &reduce473, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, &go479};
+State state480 = {&shift480, &reduce480, &go480};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift484, &reduce484, nullptr};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, &go487};
+State state488 = {&shift488, &reduce488, &go488};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, &go495};
+State state496 = {&shift496, &reduce496, &go496};
+State state497 = {&shift497, &reduce497, nullptr};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift502, &reduce502, nullptr};
+State state503 = {&shift503, &reduce503, &go503};
+State state504 = {&shift504, &reduce504, &go504};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift0, &reduce0, &go511};
+State state512 = {&shift512, &reduce512, &go512};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift515, &reduce515, nullptr};
+State state516 = {&shift4, &reduce4, nullptr};
+State state517 = {&shift5, &reduce5, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift7, &reduce7, &go519};
+State state520 = {&shift520, &reduce520, &go520};
+State state521 = {&shift11, &reduce11, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift523, &reduce523, nullptr};
+State state524 = {&shift7, &reduce7, &go524};
+State state525 = {&shift525, &reduce525, &go525};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift528, &reduce528, nullptr};
+State state529 = {&shift12, &reduce12, nullptr};
+State state530 = {&shift13, &reduce13, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift15, &reduce15, &go532};
+State state533 = {&shift533, &reduce533, &go533};
+State state534 = {&shift19, &reduce19, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift536, &reduce536, nullptr};
+State state537 = {&shift15, &reduce15, &go537};
+State state538 = {&shift538, &reduce538, &go538};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift20, &reduce20, nullptr};
+State state543 = {&shift21, &reduce21, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift23, &reduce23, &go545};
+State state546 = {&shift546, &reduce546, &go546};
+State state547 = {&shift27, &reduce27, nullptr};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift23, &reduce23, &go550};
+State state551 = {&shift551, &reduce551, &go551};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift554, &reduce554, nullptr};
+State state555 = {&shift28, &reduce28, nullptr};
+State state556 = {&shift29, &reduce29, nullptr};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift31, &reduce31, &go558};
+State state559 = {&shift559, &reduce559, &go559};
+State state560 = {&shift35, &reduce35, nullptr};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift562, &reduce562, nullptr};
+State state563 = {&shift31, &reduce31, &go563};
+State state564 = {&shift564, &reduce564, &go564};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift36, &reduce36, nullptr};
+State state569 = {&shift37, &reduce37, nullptr};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift39, &reduce39, &go571};
+State state572 = {&shift572, &reduce572, &go572};
+State state573 = {&shift43, &reduce43, nullptr};
+State state574 = {&shift574, &reduce574, nullptr};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift39, &reduce39, &go576};
+State state577 = {&shift577, &reduce577, &go577};
+State state578 = {&shift578, &reduce578, nullptr};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift580, &reduce580, nullptr};
+State state581 = {&shift44, &reduce44, nullptr};
+State state582 = {&shift45, &reduce45, nullptr};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift47, &reduce47, &go584};
+State state585 = {&shift585, &reduce585, &go585};
+State state586 = {&shift51, &reduce51, nullptr};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift588, &reduce588, nullptr};
+State state589 = {&shift47, &reduce47, &go589};
+State state590 = {&shift590, &reduce590, &go590};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift592, &reduce592, nullptr};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift52, &reduce52, nullptr};
+State state595 = {&shift53, &reduce53, nullptr};
+State state596 = {&shift596, &reduce596, nullptr};
+State state597 = {&shift55, &reduce55, &go597};
+State state598 = {&shift598, &reduce598, &go598};
+State state599 = {&shift59, &reduce59, nullptr};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift601, &reduce601, nullptr};
+State state602 = {&shift55, &reduce55, &go602};
+State state603 = {&shift603, &reduce603, &go603};
+State state604 = {&shift604, &reduce604, nullptr};
+State state605 = {&shift605, &reduce605, nullptr};
+State state606 = {&shift606, &reduce606, nullptr};
+State state607 = {&shift60, &reduce60, nullptr};
+State state608 = {&shift61, &reduce61, nullptr};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift63, &reduce63, &go610};
+State state611 = {&shift611, &reduce611, &go611};
+State state612 = {&shift67, &reduce67, nullptr};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift614, &reduce614, nullptr};
+State state615 = {&shift63, &reduce63, &go615};
+State state616 = {&shift616, &reduce616, &go616};
+State state617 = {&shift617, &reduce617, nullptr};
+State state618 = {&shift618, &reduce618, nullptr};
+State state619 = {&shift619, &reduce619, nullptr};
+State state620 = {&shift68, &reduce68, nullptr};
+State state621 = {&shift69, &reduce69, nullptr};
+State state622 = {&shift622, &reduce622, nullptr};
+State state623 = {&shift71, &reduce71, &go623};
+State state624 = {&shift624, &reduce624, &go624};
+State state625 = {&shift75, &reduce75, nullptr};
+State state626 = {&shift626, &reduce626, nullptr};
+State state627 = {&shift627, &reduce627, nullptr};
+State state628 = {&shift71, &reduce71, &go628};
+State state629 = {&shift629, &reduce629, &go629};
+State state630 = {&shift630, &reduce630, nullptr};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift632, &reduce632, nullptr};
+State state633 = {&shift76, &reduce76, nullptr};
+State state634 = {&shift77, &reduce77, nullptr};
+State state635 = {&shift635, &reduce635, nullptr};
+State state636 = {&shift79, &reduce79, &go636};
+State state637 = {&shift637, &reduce637, &go637};
+State state638 = {&shift83, &reduce83, nullptr};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift640, &reduce640, nullptr};
+State state641 = {&shift79, &reduce79, &go641};
+State state642 = {&shift642, &reduce642, &go642};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift644, &reduce644, nullptr};
+State state645 = {&shift645, &reduce645, nullptr};
+State state646 = {&shift84, &reduce84, nullptr};
+State state647 = {&shift85, &reduce85, nullptr};
+State state648 = {&shift648, &reduce648, nullptr};
+State state649 = {&shift87, &reduce87, &go649};
+State state650 = {&shift650, &reduce650, &go650};
+State state651 = {&shift91, &reduce91, nullptr};
+State state652 = {&shift652, &reduce652, nullptr};
+State state653 = {&shift653, &reduce653, nullptr};
+State state654 = {&shift87, &reduce87, &go654};
+State state655 = {&shift655, &reduce655, &go655};
+State state656 = {&shift656, &reduce656, nullptr};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift658, &reduce658, nullptr};
+State state659 = {&shift92, &reduce92, nullptr};
+State state660 = {&shift93, &reduce93, nullptr};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift95, &reduce95, &go662};
+State state663 = {&shift663, &reduce663, &go663};
+State state664 = {&shift99, &reduce99, nullptr};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift666, &reduce666, nullptr};
+State state667 = {&shift95, &reduce95, &go667};
+State state668 = {&shift668, &reduce668, &go668};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift670, &reduce670, nullptr};
+State state671 = {&shift671, &reduce671, nullptr};
+State state672 = {&shift100, &reduce100, nullptr};
+State state673 = {&shift101, &reduce101, nullptr};
+State state674 = {&shift674, &reduce674, nullptr};
+State state675 = {&shift103, &reduce103, &go675};
+State state676 = {&shift676, &reduce676, &go676};
+State state677 = {&shift107, &reduce107, nullptr};
+State state678 = {&shift678, &reduce678, nullptr};
+State state679 = {&shift679, &reduce679, nullptr};
+State state680 = {&shift103, &reduce103, &go680};
+State state681 = {&shift681, &reduce681, &go681};
+State state682 = {&shift682, &reduce682, nullptr};
+State state683 = {&shift683, &reduce683, nullptr};
+State state684 = {&shift684, &reduce684, nullptr};
+State state685 = {&shift108, &reduce108, nullptr};
+State state686 = {&shift109, &reduce109, nullptr};
+State state687 = {&shift687, &reduce687, nullptr};
+State state688 = {&shift111, &reduce111, &go688};
+State state689 = {&shift689, &reduce689, &go689};
+State state690 = {&shift115, &reduce115, nullptr};
+State state691 = {&shift691, &reduce691, nullptr};
+State state692 = {&shift692, &reduce692, nullptr};
+State state693 = {&shift111, &reduce111, &go693};
+State state694 = {&shift694, &reduce694, &go694};
+State state695 = {&shift695, &reduce695, nullptr};
+State state696 = {&shift696, &reduce696, nullptr};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift116, &reduce116, nullptr};
+State state699 = {&shift117, &reduce117, nullptr};
+State state700 = {&shift700, &reduce700, nullptr};
+State state701 = {&shift119, &reduce119, &go701};
+State state702 = {&shift702, &reduce702, &go702};
+State state703 = {&shift123, &reduce123, nullptr};
+State state704 = {&shift704, &reduce704, nullptr};
+State state705 = {&shift705, &reduce705, nullptr};
+State state706 = {&shift119, &reduce119, &go706};
+State state707 = {&shift707, &reduce707, &go707};
+State state708 = {&shift708, &reduce708, nullptr};
+State state709 = {&shift709, &reduce709, nullptr};
+State state710 = {&shift710, &reduce710, nullptr};
+State state711 = {&shift124, &reduce124, nullptr};
+State state712 = {&shift125, &reduce125, nullptr};
+State state713 = {&shift713, &reduce713, nullptr};
+State state714 = {&shift127, &reduce127, &go714};
+State state715 = {&shift715, &reduce715, &go715};
+State state716 = {&shift131, &reduce131, nullptr};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift718, &reduce718, nullptr};
+State state719 = {&shift127, &reduce127, &go719};
+State state720 = {&shift720, &reduce720, &go720};
+State state721 = {&shift721, &reduce721, nullptr};
+State state722 = {&shift722, &reduce722, nullptr};
+State state723 = {&shift723, &reduce723, nullptr};
+State state724 = {&shift132, &reduce132, nullptr};
+State state725 = {&shift133, &reduce133, nullptr};
+State state726 = {&shift726, &reduce726, nullptr};
+State state727 = {&shift135, &reduce135, &go727};
+State state728 = {&shift728, &reduce728, &go728};
+State state729 = {&shift139, &reduce139, nullptr};
+State state730 = {&shift730, &reduce730, nullptr};
+State state731 = {&shift731, &reduce731, nullptr};
+State state732 = {&shift135, &reduce135, &go732};
+State state733 = {&shift733, &reduce733, &go733};
+State state734 = {&shift734, &reduce734, nullptr};
+State state735 = {&shift735, &reduce735, nullptr};
+State state736 = {&shift736, &reduce736, nullptr};
+State state737 = {&shift140, &reduce140, nullptr};
+State state738 = {&shift141, &reduce141, nullptr};
+State state739 = {&shift739, &reduce739, nullptr};
+State state740 = {&shift143, &reduce143, &go740};
+State state741 = {&shift741, &reduce741, &go741};
+State state742 = {&shift147, &reduce147, nullptr};
+State state743 = {&shift743, &reduce743, nullptr};
+State state744 = {&shift744, &reduce744, nullptr};
+State state745 = {&shift143, &reduce143, &go745};
+State state746 = {&shift746, &reduce746, &go746};
+State state747 = {&shift747, &reduce747, nullptr};
+State state748 = {&shift748, &reduce748, nullptr};
+State state749 = {&shift749, &reduce749, nullptr};
+State state750 = {&shift148, &reduce148, nullptr};
+State state751 = {&shift149, &reduce149, nullptr};
+State state752 = {&shift752, &reduce752, nullptr};
+State state753 = {&shift151, &reduce151, &go753};
+State state754 = {&shift754, &reduce754, &go754};
+State state755 = {&shift155, &reduce155, nullptr};
+State state756 = {&shift756, &reduce756, nullptr};
+State state757 = {&shift757, &reduce757, nullptr};
+State state758 = {&shift151, &reduce151, &go758};
+State state759 = {&shift759, &reduce759, &go759};
+State state760 = {&shift760, &reduce760, nullptr};
+State state761 = {&shift761, &reduce761, nullptr};
+State state762 = {&shift762, &reduce762, nullptr};
+State state763 = {&shift156, &reduce156, nullptr};
+State state764 = {&shift157, &reduce157, nullptr};
+State state765 = {&shift765, &reduce765, nullptr};
+State state766 = {&shift159, &reduce159, &go766};
+State state767 = {&shift767, &reduce767, &go767};
+State state768 = {&shift163, &reduce163, nullptr};
+State state769 = {&shift769, &reduce769, nullptr};
+State state770 = {&shift770, &reduce770, nullptr};
+State state771 = {&shift159, &reduce159, &go771};
+State state772 = {&shift772, &reduce772, &go772};
+State state773 = {&shift773, &reduce773, nullptr};
+State state774 = {&shift774, &reduce774, nullptr};
+State state775 = {&shift775, &reduce775, nullptr};
+State state776 = {&shift164, &reduce164, nullptr};
+State state777 = {&shift165, &reduce165, nullptr};
+State state778 = {&shift778, &reduce778, nullptr};
+State state779 = {&shift167, &reduce167, &go779};
+State state780 = {&shift780, &reduce780, &go780};
+State state781 = {&shift171, &reduce171, nullptr};
+State state782 = {&shift782, &reduce782, nullptr};
+State state783 = {&shift783, &reduce783, nullptr};
+State state784 = {&shift167, &reduce167, &go784};
+State state785 = {&shift785, &reduce785, &go785};
+State state786 = {&shift786, &reduce786, nullptr};
+State state787 = {&shift787, &reduce787, nullptr};
+State state788 = {&shift788, &reduce788, nullptr};
+State state789 = {&shift172, &reduce172, nullptr};
+State state790 = {&shift173, &reduce173, nullptr};
+State state791 = {&shift791, &reduce791, nullptr};
+State state792 = {&shift175, &reduce175, &go792};
+State state793 = {&shift793, &reduce793, &go793};
+State state794 = {&shift179, &reduce179, nullptr};
+State state795 = {&shift795, &reduce795, nullptr};
+State state796 = {&shift796, &reduce796, nullptr};
+State state797 = {&shift175, &reduce175, &go797};
+State state798 = {&shift798, &reduce798, &go798};
+State state799 = {&shift799, &reduce799, nullptr};
+State state800 = {&shift800, &reduce800, nullptr};
+State state801 = {&shift801, &reduce801, nullptr};
+State state802 = {&shift180, &reduce180, nullptr};
+State state803 = {&shift181, &reduce181, nullptr};
+State state804 = {&shift804, &reduce804, nullptr};
+State state805 = {&shift183, &reduce183, &go805};
+State state806 = {&shift806, &reduce806, &go806};
+State state807 = {&shift187, &reduce187, nullptr};
+State state808 = {&shift808, &reduce808, nullptr};
+State state809 = {&shift809, &reduce809, nullptr};
+State state810 = {&shift183, &reduce183, &go810};
+State state811 = {&shift811, &reduce811, &go811};
+State state812 = {&shift812, &reduce812, nullptr};
+State state813 = {&shift813, &reduce813, nullptr};
+State state814 = {&shift814, &reduce814, nullptr};
+State state815 = {&shift188, &reduce188, nullptr};
+State state816 = {&shift189, &reduce189, nullptr};
+State state817 = {&shift817, &reduce817, nullptr};
+State state818 = {&shift191, &reduce191, &go818};
+State state819 = {&shift819, &reduce819, &go819};
+State state820 = {&shift195, &reduce195, nullptr};
+State state821 = {&shift821, &reduce821, nullptr};
+State state822 = {&shift822, &reduce822, nullptr};
+State state823 = {&shift191, &reduce191, &go823};
+State state824 = {&shift824, &reduce824, &go824};
+State state825 = {&shift825, &reduce825, nullptr};
+State state826 = {&shift826, &reduce826, nullptr};
+State state827 = {&shift827, &reduce827, nullptr};
+State state828 = {&shift196, &reduce196, nullptr};
+State state829 = {&shift197, &reduce197, nullptr};
+State state830 = {&shift830, &reduce830, nullptr};
+State state831 = {&shift199, &reduce199, &go831};
+State state832 = {&shift832, &reduce832, &go832};
+State state833 = {&shift203, &reduce203, nullptr};
+State state834 = {&shift834, &reduce834, nullptr};
+State state835 = {&shift835, &reduce835, nullptr};
+State state836 = {&shift199, &reduce199, &go836};
+State state837 = {&shift837, &reduce837, &go837};
+State state838 = {&shift838, &reduce838, nullptr};
+State state839 = {&shift839, &reduce839, nullptr};
+State state840 = {&shift840, &reduce840, nullptr};
+State state841 = {&shift204, &reduce204, nullptr};
+State state842 = {&shift205, &reduce205, nullptr};
+State state843 = {&shift843, &reduce843, nullptr};
+State state844 = {&shift207, &reduce207, &go844};
+State state845 = {&shift845, &reduce845, &go845};
+State state846 = {&shift211, &reduce211, nullptr};
+State state847 = {&shift847, &reduce847, nullptr};
+State state848 = {&shift848, &reduce848, nullptr};
+State state849 = {&shift207, &reduce207, &go849};
+State state850 = {&shift850, &reduce850, &go850};
+State state851 = {&shift851, &reduce851, nullptr};
+State state852 = {&shift852, &reduce852, nullptr};
+State state853 = {&shift853, &reduce853, nullptr};
+State state854 = {&shift212, &reduce212, nullptr};
+State state855 = {&shift213, &reduce213, nullptr};
+State state856 = {&shift856, &reduce856, nullptr};
+State state857 = {&shift215, &reduce215, &go857};
+State state858 = {&shift858, &reduce858, &go858};
+State state859 = {&shift219, &reduce219, nullptr};
+State state860 = {&shift860, &reduce860, nullptr};
+State state861 = {&shift861, &reduce861, nullptr};
+State state862 = {&shift215, &reduce215, &go862};
+State state863 = {&shift863, &reduce863, &go863};
+State state864 = {&shift864, &reduce864, nullptr};
+State state865 = {&shift865, &reduce865, nullptr};
+State state866 = {&shift866, &reduce866, nullptr};
+State state867 = {&shift220, &reduce220, nullptr};
+State state868 = {&shift221, &reduce221, nullptr};
+State state869 = {&shift869, &reduce869, nullptr};
+State state870 = {&shift223, &reduce223, &go870};
+State state871 = {&shift871, &reduce871, &go871};
+State state872 = {&shift227, &reduce227, nullptr};
+State state873 = {&shift873, &reduce873, nullptr};
+State state874 = {&shift874, &reduce874, nullptr};
+State state875 = {&shift223, &reduce223, &go875};
+State state876 = {&shift876, &reduce876, &go876};
+State state877 = {&shift877, &reduce877, nullptr};
+State state878 = {&shift878, &reduce878, nullptr};
+State state879 = {&shift879, &reduce879, nullptr};
+State state880 = {&shift228, &reduce228, nullptr};
+State state881 = {&shift229, &reduce229, nullptr};
+State state882 = {&shift882, &reduce882, nullptr};
+State state883 = {&shift231, &reduce231, &go883};
+State state884 = {&shift884, &reduce884, &go884};
+State state885 = {&shift235, &reduce235, nullptr};
+State state886 = {&shift886, &reduce886, nullptr};
+State state887 = {&shift887, &reduce887, nullptr};
+State state888 = {&shift231, &reduce231, &go888};
+State state889 = {&shift889, &reduce889, &go889};
+State state890 = {&shift890, &reduce890, nullptr};
+State state891 = {&shift891, &reduce891, nullptr};
+State state892 = {&shift892, &reduce892, nullptr};
+State state893 = {&shift236, &reduce236, nullptr};
+State state894 = {&shift237, &reduce237, nullptr};
+State state895 = {&shift895, &reduce895, nullptr};
+State state896 = {&shift239, &reduce239, &go896};
+State state897 = {&shift897, &reduce897, &go897};
+State state898 = {&shift243, &reduce243, nullptr};
+State state899 = {&shift899, &reduce899, nullptr};
+State state900 = {&shift900, &reduce900, nullptr};
+State state901 = {&shift239, &reduce239, &go901};
+State state902 = {&shift902, &reduce902, &go902};
+State state903 = {&shift903, &reduce903, nullptr};
+State state904 = {&shift904, &reduce904, nullptr};
+State state905 = {&shift905, &reduce905, nullptr};
+State state906 = {&shift244, &reduce244, nullptr};
+State state907 = {&shift245, &reduce245, nullptr};
+State state908 = {&shift908, &reduce908, nullptr};
+State state909 = {&shift247, &reduce247, &go909};
+State state910 = {&shift910, &reduce910, &go910};
+State state911 = {&shift251, &reduce251, nullptr};
+State state912 = {&shift912, &reduce912, nullptr};
+State state913 = {&shift913, &reduce913, nullptr};
+State state914 = {&shift247, &reduce247, &go914};
+State state915 = {&shift915, &reduce915, &go915};
+State state916 = {&shift916, &reduce916, nullptr};
+State state917 = {&shift917, &reduce917, nullptr};
+State state918 = {&shift918, &reduce918, nullptr};
+State state919 = {&shift252, &reduce252, nullptr};
+State state920 = {&shift253, &reduce253, nullptr};
+State state921 = {&shift921, &reduce921, nullptr};
+State state922 = {&shift255, &reduce255, &go922};
+State state923 = {&shift923, &reduce923, &go923};
+State state924 = {&shift259, &reduce259, nullptr};
+State state925 = {&shift925, &reduce925, nullptr};
+State state926 = {&shift926, &reduce926, nullptr};
+State state927 = {&shift255, &reduce255, &go927};
+State state928 = {&shift928, &reduce928, &go928};
+State state929 = {&shift929, &reduce929, nullptr};
+State state930 = {&shift930, &reduce930, nullptr};
+State state931 = {&shift931, &reduce931, nullptr};
+State state932 = {&shift260, &reduce260, nullptr};
+State state933 = {&shift261, &reduce261, nullptr};
+State state934 = {&shift934, &reduce934, nullptr};
+State state935 = {&shift263, &reduce263, &go935};
+State state936 = {&shift936, &reduce936, &go936};
+State state937 = {&shift267, &reduce267, nullptr};
+State state938 = {&shift938, &reduce938, nullptr};
+State state939 = {&shift939, &reduce939, nullptr};
+State state940 = {&shift263, &reduce263, &go940};
+State state941 = {&shift941, &reduce941, &go941};
+State state942 = {&shift942, &reduce942, nullptr};
+State state943 = {&shift943, &reduce943, nullptr};
+State state944 = {&shift944, &reduce944, nullptr};
+State state945 = {&shift268, &reduce268, nullptr};
+State state946 = {&shift269, &reduce269, nullptr};
+State state947 = {&shift947, &reduce947, nullptr};
+State state948 = {&shift271, &reduce271, &go948};
+State state949 = {&shift949, &reduce949, &go949};
+State state950 = {&shift275, &reduce275, nullptr};
+State state951 = {&shift951, &reduce951, nullptr};
+State state952 = {&shift952, &reduce952, nullptr};
+State state953 = {&shift271, &reduce271, &go953};
+State state954 = {&shift954, &reduce954, &go954};
+State state955 = {&shift955, &reduce955, nullptr};
+State state956 = {&shift956, &reduce956, nullptr};
+State state957 = {&shift957, &reduce957, nullptr};
+State state958 = {&shift276, &reduce276, nullptr};
+State state959 = {&shift277, &reduce277, nullptr};
+State state960 = {&shift960, &reduce960, nullptr};
+State state961 = {&shift279, &reduce279, &go961};
+State state962 = {&shift962, &reduce962, &go962};
+State state963 = {&shift283, &reduce283, nullptr};
+State state964 = {&shift964, &reduce964, nullptr};
+State state965 = {&shift965, &reduce965, nullptr};
+State state966 = {&shift279, &reduce279, &go966};
+State state967 = {&shift967, &reduce967, &go967};
+State state968 = {&shift968, &reduce968, nullptr};
+State state969 = {&shift969, &reduce969, nullptr};
+State state970 = {&shift970, &reduce970, nullptr};
+State state971 = {&shift284, &reduce284, nullptr};
+State state972 = {&shift285, &reduce285, nullptr};
+State state973 = {&shift973, &reduce973, nullptr};
+State state974 = {&shift287, &reduce287, &go974};
+State state975 = {&shift975, &reduce975, &go975};
+State state976 = {&shift291, &reduce291, nullptr};
+State state977 = {&shift977, &reduce977, nullptr};
+State state978 = {&shift978, &reduce978, nullptr};
+State state979 = {&shift287, &reduce287, &go979};
+State state980 = {&shift980, &reduce980, &go980};
+State state981 = {&shift981, &reduce981, nullptr};
+State state982 = {&shift982, &reduce982, nullptr};
+State state983 = {&shift983, &reduce983, nullptr};
+State state984 = {&shift292, &reduce292, nullptr};
+State state985 = {&shift293, &reduce293, nullptr};
+State state986 = {&shift986, &reduce986, nullptr};
+State state987 = {&shift295, &reduce295, &go987};
+State state988 = {&shift988, &reduce988, &go988};
+State state989 = {&shift299, &reduce299, nullptr};
+State state990 = {&shift990, &reduce990, nullptr};
+State state991 = {&shift991, &reduce991, nullptr};
+State state992 = {&shift295, &reduce295, &go992};
+State state993 = {&shift993, &reduce993, &go993};
+State state994 = {&shift994, &reduce994, nullptr};
+State state995 = {&shift995, &reduce995, nullptr};
+State state996 = {&shift996, &reduce996, nullptr};
+State state997 = {&shift300, &reduce300, nullptr};
+State state998 = {&shift301, &reduce301, nullptr};
+State state999 = {&shift999, &reduce999, nullptr};
+State state1000 = {&shift303, &reduce303, &go1000};
+State state1001 = {&shift1001, &reduce1001, &go1001};
+State state1002 = {&shift307, &reduce307, nullptr};
+State state1003 = {&shift1003, &reduce1003, nullptr};
+State state1004 = {&shift1004, &reduce1004, nullptr};
+State state1005 = {&shift303, &reduce303, &go1005};
+State state1006 = {&shift1006, &reduce1006, &go1006};
+State state1007 = {&shift1007, &reduce1007, nullptr};
+State state1008 = {&shift1008, &reduce1008, nullptr};
+State state1009 = {&shift1009, &reduce1009, nullptr};
+State state1010 = {&shift308, &reduce308, nullptr};
+State state1011 = {&shift309, &reduce309, nullptr};
+State state1012 = {&shift1012, &reduce1012, nullptr};
+State state1013 = {&shift311, &reduce311, &go1013};
+State state1014 = {&shift1014, &reduce1014, &go1014};
+State state1015 = {&shift315, &reduce315, nullptr};
+State state1016 = {&shift1016, &reduce1016, nullptr};
+State state1017 = {&shift1017, &reduce1017, nullptr};
+State state1018 = {&shift311, &reduce311, &go1018};
+State state1019 = {&shift1019, &reduce1019, &go1019};
+State state1020 = {&shift1020, &reduce1020, nullptr};
+State state1021 = {&shift1021, &reduce1021, nullptr};
+State state1022 = {&shift1022, &reduce1022, nullptr};
+State state1023 = {&shift316, &reduce316, nullptr};
+State state1024 = {&shift317, &reduce317, nullptr};
+State state1025 = {&shift1025, &reduce1025, nullptr};
+State state1026 = {&shift319, &reduce319, &go1026};
+State state1027 = {&shift1027, &reduce1027, &go1027};
+State state1028 = {&shift323, &reduce323, nullptr};
+State state1029 = {&shift1029, &reduce1029, nullptr};
+State state1030 = {&shift1030, &reduce1030, nullptr};
+State state1031 = {&shift319, &reduce319, &go1031};
+State state1032 = {&shift1032, &reduce1032, &go1032};
+State state1033 = {&shift1033, &reduce1033, nullptr};
+State state1034 = {&shift1034, &reduce1034, nullptr};
+State state1035 = {&shift1035, &reduce1035, nullptr};
+State state1036 = {&shift324, &reduce324, nullptr};
+State state1037 = {&shift325, &reduce325, nullptr};
+State state1038 = {&shift1038, &reduce1038, nullptr};
+State state1039 = {&shift327, &reduce327, &go1039};
+State state1040 = {&shift1040, &reduce1040, &go1040};
+State state1041 = {&shift331, &reduce331, nullptr};
+State state1042 = {&shift1042, &reduce1042, nullptr};
+State state1043 = {&shift1043, &reduce1043, nullptr};
+State state1044 = {&shift327, &reduce327, &go1044};
+State state1045 = {&shift1045, &reduce1045, &go1045};
+State state1046 = {&shift1046, &reduce1046, nullptr};
+State state1047 = {&shift1047, &reduce1047, nullptr};
+State state1048 = {&shift1048, &reduce1048, nullptr};
+State state1049 = {&shift332, &reduce332, nullptr};
+State state1050 = {&shift333, &reduce333, nullptr};
+State state1051 = {&shift1051, &reduce1051, nullptr};
+State state1052 = {&shift335, &reduce335, &go1052};
+State state1053 = {&shift1053, &reduce1053, &go1053};
+State state1054 = {&shift339, &reduce339, nullptr};
+State state1055 = {&shift1055, &reduce1055, nullptr};
+State state1056 = {&shift1056, &reduce1056, nullptr};
+State state1057 = {&shift335, &reduce335, &go1057};
+State state1058 = {&shift1058, &reduce1058, &go1058};
+State state1059 = {&shift1059, &reduce1059, nullptr};
+State state1060 = {&shift1060, &reduce1060, nullptr};
+State state1061 = {&shift1061, &reduce1061, nullptr};
+State state1062 = {&shift340, &reduce340, nullptr};
+State state1063 = {&shift341, &reduce341, nullptr};
+State state1064 = {&shift1064, &reduce1064, nullptr};
+State state1065 = {&shift343, &reduce343, &go1065};
+State state1066 = {&shift1066, &reduce1066, &go1066};
+State state1067 = {&shift347, &reduce347, nullptr};
+State state1068 = {&shift1068, &reduce1068, nullptr};
+State state1069 = {&shift1069, &reduce1069, nullptr};
+State state1070 = {&shift343, &reduce343, &go1070};
+State state1071 = {&shift1071, &reduce1071, &go1071};
+State state1072 = {&shift1072, &reduce1072, nullptr};
+State state1073 = {&shift1073, &reduce1073, nullptr};
+State state1074 = {&shift1074, &reduce1074, nullptr};
+State state1075 = {&shift348, &reduce348, nullptr};
+State state1076 = {&shift349, &reduce349, nullptr};
+State state1077 = {&shift1077, &reduce1077, nullptr};
+State state1078 = {&shift351, &reduce351, &go1078};
+State state1079 = {&shift1079, &reduce1079, &go1079};
+State state1080 = {&shift355, &reduce355, nullptr};
+State state1081 = {&shift1081, &reduce1081, nullptr};
+State state1082 = {&shift1082, &reduce1082, nullptr};
+State state1083 = {&shift351, &reduce351, &go1083};
+State state1084 = {&shift1084, &reduce1084, &go1084};
+State state1085 = {&shift1085, &reduce1085, nullptr};
+State state1086 = {&shift1086, &reduce1086, nullptr};
+State state1087 = {&shift1087, &reduce1087, nullptr};
+State state1088 = {&shift356, &reduce356, nullptr};
+State state1089 = {&shift357, &reduce357, nullptr};
+State state1090 = {&shift1090, &reduce1090, nullptr};
+State state1091 = {&shift359, &reduce359, &go1091};
+State state1092 = {&shift1092, &reduce1092, &go1092};
+State state1093 = {&shift363, &reduce363, nullptr};
+State state1094 = {&shift1094, &reduce1094, nullptr};
+State state1095 = {&shift1095, &reduce1095, nullptr};
+State state1096 = {&shift359, &reduce359, &go1096};
+State state1097 = {&shift1097, &reduce1097, &go1097};
+State state1098 = {&shift1098, &reduce1098, nullptr};
+State state1099 = {&shift1099, &reduce1099, nullptr};
+State state1100 = {&shift1100, &reduce1100, nullptr};
+State state1101 = {&shift364, &reduce364, nullptr};
+State state1102 = {&shift365, &reduce365, nullptr};
+State state1103 = {&shift1103, &reduce1103, nullptr};
+State state1104 = {&shift367, &reduce367, &go1104};
+State state1105 = {&shift1105, &reduce1105, &go1105};
+State state1106 = {&shift371, &reduce371, nullptr};
+State state1107 = {&shift1107, &reduce1107, nullptr};
+State state1108 = {&shift1108, &reduce1108, nullptr};
+State state1109 = {&shift367, &reduce367, &go1109};
+State state1110 = {&shift1110, &reduce1110, &go1110};
+State state1111 = {&shift1111, &reduce1111, nullptr};
+State state1112 = {&shift1112, &reduce1112, nullptr};
+State state1113 = {&shift1113, &reduce1113, nullptr};
+State state1114 = {&shift372, &reduce372, nullptr};
+State state1115 = {&shift373, &reduce373, nullptr};
+State state1116 = {&shift1116, &reduce1116, nullptr};
+State state1117 = {&shift375, &reduce375, &go1117};
+State state1118 = {&shift1118, &reduce1118, &go1118};
+State state1119 = {&shift379, &reduce379, nullptr};
+State state1120 = {&shift1120, &reduce1120, nullptr};
+State state1121 = {&shift1121, &reduce1121, nullptr};
+State state1122 = {&shift375, &reduce375, &go1122};
+State state1123 = {&shift1123, &reduce1123, &go1123};
+State state1124 = {&shift1124, &reduce1124, nullptr};
+State state1125 = {&shift1125, &reduce1125, nullptr};
+State state1126 = {&shift1126, &reduce1126, nullptr};
+State state1127 = {&shift380, &reduce380, nullptr};
+State state1128 = {&shift381, &reduce381, nullptr};
+State state1129 = {&shift1129, &reduce1129, nullptr};
+State state1130 = {&shift383, &reduce383, &go1130};
+State state1131 = {&shift1131, &reduce1131, &go1131};
+State state1132 = {&shift387, &reduce387, nullptr};
+State state1133 = {&shift1133, &reduce1133, nullptr};
+State state1134 = {&shift1134, &reduce1134, nullptr};
+State state1135 = {&shift383, &reduce383, &go1135};
+State state1136 = {&shift1136, &reduce1136, &go1136};
+State state1137 = {&shift1137, &reduce1137, nullptr};
+State state1138 = {&shift1138, &reduce1138, nullptr};
+State state1139 = {&shift1139, &reduce1139, nullptr};
+State state1140 = {&shift388, &reduce388, nullptr};
+State state1141 = {&shift389, &reduce389, nullptr};
+State state1142 = {&shift1142, &reduce1142, nullptr};
+State state1143 = {&shift391, &reduce391, &go1143};
+State state1144 = {&shift1144, &reduce1144, &go1144};
+State state1145 = {&shift395, &reduce395, nullptr};
+State state1146 = {&shift1146, &reduce1146, nullptr};
+State state1147 = {&shift1147, &reduce1147, nullptr};
+State state1148 = {&shift391, &reduce391, &go1148};
+State state1149 = {&shift1149, &reduce1149, &go1149};
+State state1150 = {&shift1150, &reduce1150, nullptr};
+State state1151 = {&shift1151, &reduce1151, nullptr};
+State state1152 = {&shift1152, &reduce1152, nullptr};
+State state1153 = {&shift396, &reduce396, nullptr};
+State state1154 = {&shift397, &reduce397, nullptr};
+State state1155 = {&shift1155, &reduce1155, nullptr};
+State state1156 = {&shift399, &reduce399, &go1156};
+State state1157 = {&shift1157, &reduce1157, &go1157};
+State state1158 = {&shift403, &reduce403, nullptr};
+State state1159 = {&shift1159, &reduce1159, nullptr};
+State state1160 = {&shift1160, &reduce1160, nullptr};
+State state1161 = {&shift399, &reduce399, &go1161};
+State state1162 = {&shift1162, &reduce1162, &go1162};
+State state1163 = {&shift1163, &reduce1163, nullptr};
+State state1164 = {&shift1164, &reduce1164, nullptr};
+State state1165 = {&shift1165, &reduce1165, nullptr};
+State state1166 = {&shift404, &reduce404, nullptr};
+State state1167 = {&shift405, &reduce405, nullptr};
+State state1168 = {&shift1168, &reduce1168, nullptr};
+State state1169 = {&shift407, &reduce407, &go1169};
+State state1170 = {&shift1170, &reduce1170, &go1170};
+State state1171 = {&shift411, &reduce411, nullptr};
+State state1172 = {&shift1172, &reduce1172, nullptr};
+State state1173 = {&shift1173, &reduce1173, nullptr};
+State state1174 = {&shift407, &reduce407, &go1174};
+State state1175 = {&shift1175, &reduce1175, &go1175};
+State state1176 = {&shift1176, &reduce1176, nullptr};
+State state1177 = {&shift1177, &reduce1177, nullptr};
+State state1178 = {&shift1178, &reduce1178, nullptr};
+State state1179 = {&shift412, &reduce412, nullptr};
+State state1180 = {&shift413, &reduce413, nullptr};
+State state1181 = {&shift1181, &reduce1181, nullptr};
+State state1182 = {&shift415, &reduce415, &go1182};
+State state1183 = {&shift1183, &reduce1183, &go1183};
+State state1184 = {&shift419, &reduce419, nullptr};
+State state1185 = {&shift1185, &reduce1185, nullptr};
+State state1186 = {&shift1186, &reduce1186, nullptr};
+State state1187 = {&shift415, &reduce415, &go1187};
+State state1188 = {&shift1188, &reduce1188, &go1188};
+State state1189 = {&shift1189, &reduce1189, nullptr};
+State state1190 = {&shift1190, &reduce1190, nullptr};
+State state1191 = {&shift1191, &reduce1191, nullptr};
+State state1192 = {&shift420, &reduce420, nullptr};
+State state1193 = {&shift421, &reduce421, nullptr};
+State state1194 = {&shift1194, &reduce1194, nullptr};
+State state1195 = {&shift423, &reduce423, &go1195};
+State state1196 = {&shift1196, &reduce1196, &go1196};
+State state1197 = {&shift427, &reduce427, nullptr};
+State state1198 = {&shift1198, &reduce1198, nullptr};
+State state1199 = {&shift1199, &reduce1199, nullptr};
+State state1200 = {&shift423, &reduce423, &go1200};
+State state1201 = {&shift1201, &reduce1201, &go1201};
+State state1202 = {&shift1202, &reduce1202, nullptr};
+State state1203 = {&shift1203, &reduce1203, nullptr};
+State state1204 = {&shift1204, &reduce1204, nullptr};
+State state1205 = {&shift428, &reduce428, nullptr};
+State state1206 = {&shift429, &reduce429, nullptr};
+State state1207 = {&shift1207, &reduce1207, nullptr};
+State state1208 = {&shift431, &reduce431, &go1208};
+State state1209 = {&shift1209, &reduce1209, &go1209};
+State state1210 = {&shift435, &reduce435, nullptr};
+State state1211 = {&shift1211, &reduce1211, nullptr};
+State state1212 = {&shift1212, &reduce1212, nullptr};
+State state1213 = {&shift431, &reduce431, &go1213};
+State state1214 = {&shift1214, &reduce1214, &go1214};
+State state1215 = {&shift1215, &reduce1215, nullptr};
+State state1216 = {&shift1216, &reduce1216, nullptr};
+State state1217 = {&shift1217, &reduce1217, nullptr};
+State state1218 = {&shift436, &reduce436, nullptr};
+State state1219 = {&shift437, &reduce437, nullptr};
+State state1220 = {&shift1220, &reduce1220, nullptr};
+State state1221 = {&shift439, &reduce439, &go1221};
+State state1222 = {&shift1222, &reduce1222, &go1222};
+State state1223 = {&shift443, &reduce443, nullptr};
+State state1224 = {&shift1224, &reduce1224, nullptr};
+State state1225 = {&shift1225, &reduce1225, nullptr};
+State state1226 = {&shift439, &reduce439, &go1226};
+State state1227 = {&shift1227, &reduce1227, &go1227};
+State state1228 = {&shift1228, &reduce1228, nullptr};
+State state1229 = {&shift1229, &reduce1229, nullptr};
+State state1230 = {&shift1230, &reduce1230, nullptr};
+State state1231 = {&shift444, &reduce444, nullptr};
+State state1232 = {&shift445, &reduce445, nullptr};
+State state1233 = {&shift1233, &reduce1233, nullptr};
+State state1234 = {&shift447, &reduce447, &go1234};
+State state1235 = {&shift1235, &reduce1235, &go1235};
+State state1236 = {&shift451, &reduce451, nullptr};
+State state1237 = {&shift1237, &reduce1237, nullptr};
+State state1238 = {&shift1238, &reduce1238, nullptr};
+State state1239 = {&shift447, &reduce447, &go1239};
+State state1240 = {&shift1240, &reduce1240, &go1240};
+State state1241 = {&shift1241, &reduce1241, nullptr};
+State state1242 = {&shift1242, &reduce1242, nullptr};
+State state1243 = {&shift1243, &reduce1243, nullptr};
+State state1244 = {&shift452, &reduce452, nullptr};
+State state1245 = {&shift453, &reduce453, nullptr};
+State state1246 = {&shift1246, &reduce1246, nullptr};
+State state1247 = {&shift455, &reduce455, &go1247};
+State state1248 = {&shift1248, &reduce1248, &go1248};
+State state1249 = {&shift459, &reduce459, nullptr};
+State state1250 = {&shift1250, &reduce1250, nullptr};
+State state1251 = {&shift1251, &reduce1251, nullptr};
+State state1252 = {&shift455, &reduce455, &go1252};
+State state1253 = {&shift1253, &reduce1253, &go1253};
+State state1254 = {&shift1254, &reduce1254, nullptr};
+State state1255 = {&shift1255, &reduce1255, nullptr};
+State state1256 = {&shift1256, &reduce1256, nullptr};
+State state1257 = {&shift460, &reduce460, nullptr};
+State state1258 = {&shift461, &reduce461, nullptr};
+State state1259 = {&shift1259, &reduce1259, nullptr};
+State state1260 = {&shift463, &reduce463, &go1260};
+State state1261 = {&shift1261, &reduce1261, &go1261};
+State state1262 = {&shift467, &reduce467, nullptr};
+State state1263 = {&shift1263, &reduce1263, nullptr};
+State state1264 = {&shift1264, &reduce1264, nullptr};
+State state1265 = {&shift463, &reduce463, &go1265};
+State state1266 = {&shift1266, &reduce1266, &go1266};
+State state1267 = {&shift1267, &reduce1267, nullptr};
+State state1268 = {&shift1268, &reduce1268, nullptr};
+State state1269 = {&shift1269, &reduce1269, nullptr};
+State state1270 = {&shift468, &reduce468, nullptr};
+State state1271 = {&shift469, &reduce469, nullptr};
+State state1272 = {&shift1272, &reduce1272, nullptr};
+State state1273 = {&shift471, &reduce471, &go1273};
+State state1274 = {&shift1274, &reduce1274, &go1274};
+State state1275 = {&shift475, &reduce475, nullptr};
+State state1276 = {&shift1276, &reduce1276, nullptr};
+State state1277 = {&shift1277, &reduce1277, nullptr};
+State state1278 = {&shift471, &reduce471, &go1278};
+State state1279 = {&shift1279, &reduce1279, &go1279};
+State state1280 = {&shift1280, &reduce1280, nullptr};
+State state1281 = {&shift1281, &reduce1281, nullptr};
+State state1282 = {&shift1282, &reduce1282, nullptr};
+State state1283 = {&shift476, &reduce476, nullptr};
+State state1284 = {&shift477, &reduce477, nullptr};
+State state1285 = {&shift1285, &reduce1285, nullptr};
+State state1286 = {&shift479, &reduce479, &go1286};
+State state1287 = {&shift1287, &reduce1287, &go1287};
+State state1288 = {&shift483, &reduce483, nullptr};
+State state1289 = {&shift1289, &reduce1289, nullptr};
+State state1290 = {&shift1290, &reduce1290, nullptr};
+State state1291 = {&shift479, &reduce479, &go1291};
+State state1292 = {&shift1292, &reduce1292, &go1292};
+State state1293 = {&shift1293, &reduce1293, nullptr};
+State state1294 = {&shift1294, &reduce1294, nullptr};
+State state1295 = {&shift1295, &reduce1295, nullptr};
+State state1296 = {&shift484, &reduce484, nullptr};
+State state1297 = {&shift485, &reduce485, nullptr};
+State state1298 = {&shift1298, &reduce1298, nullptr};
+State state1299 = {&shift487, &reduce487, &go1299};
+State state1300 = {&shift1300, &reduce1300, &go1300};
+State state1301 = {&shift491, &reduce491, nullptr};
+State state1302 = {&shift1302, &reduce1302, nullptr};
+State state1303 = {&shift1303, &reduce1303, nullptr};
+State state1304 = {&shift487, &reduce487, &go1304};
+State state1305 = {&shift1305, &reduce1305, &go1305};
+State state1306 = {&shift1306, &reduce1306, nullptr};
+State state1307 = {&shift1307, &reduce1307, nullptr};
+State state1308 = {&shift1308, &reduce1308, nullptr};
+State state1309 = {&shift492, &reduce492, nullptr};
+State state1310 = {&shift493, &reduce493, nullptr};
+State state1311 = {&shift1311, &reduce1311, nullptr};
+State state1312 = {&shift495, &reduce495, &go1312};
+State state1313 = {&shift1313, &reduce1313, &go1313};
+State state1314 = {&shift499, &reduce499, nullptr};
+State state1315 = {&shift1315, &reduce1315, nullptr};
+State state1316 = {&shift1316, &reduce1316, nullptr};
+State state1317 = {&shift495, &reduce495, &go1317};
+State state1318 = {&shift1318, &reduce1318, &go1318};
+State state1319 = {&shift1319, &reduce1319, nullptr};
+State state1320 = {&shift1320, &reduce1320, nullptr};
+State state1321 = {&shift1321, &reduce1321, nullptr};
+State state1322 = {&shift500, &reduce500, nullptr};
+State state1323 = {&shift501, &reduce501, nullptr};
+State state1324 = {&shift1324, &reduce1324, nullptr};
+State state1325 = {&shift503, &reduce503, &go1325};
+State state1326 = {&shift1326, &reduce1326, &go1326};
+State state1327 = {&shift507, &reduce507, nullptr};
+State state1328 = {&shift1328, &reduce1328, nullptr};
+State state1329 = {&shift1329, &reduce1329, nullptr};
+State state1330 = {&shift503, &reduce503, &go1330};
+State state1331 = {&shift1331, &reduce1331, &go1331};
+State state1332 = {&shift1332, &reduce1332, nullptr};
+State state1333 = {&shift1333, &reduce1333, nullptr};
+State state1334 = {&shift1334, &reduce1334, nullptr};
+State state1335 = {&shift508, &reduce508, nullptr};
+State state1336 = {&shift509, &reduce509, nullptr};
+State state1337 = {&shift1337, &reduce1337, nullptr};
+State state1338 = {&shift0, &reduce0, &go1338};
+State state1339 = {&shift1339, &reduce1339, &go1339};
+State state1340 = {&shift515, &reduce515, nullptr};
+State state1341 = {&shift1341, &reduce1341, nullptr};
+State state1342 = {&shift1342, &reduce1342, nullptr};
+State state1343 = {&shift0, &reduce0, &go1343};
+State state1344 = {&shift1344, &reduce1344, &go1344};
+State state1345 = {&shift1345, &reduce1345, nullptr};
+State state1346 = {&shift1346, &reduce1346, nullptr};
+State state1347 = {&shift1347, &reduce1347, nullptr};
+State state1348 = {&shift4, &reduce4, nullptr};
+State state1349 = {&shift5, &reduce5, nullptr};
+State state1350 = {&shift1350, &reduce1350, nullptr};
+State state1351 = {&shift7, &reduce7, &go1351};
+State state1352 = {&shift1352, &reduce1352, &go1352};
+State state1353 = {&shift11, &reduce11, nullptr};
+State state1354 = {&shift1354, &reduce1354, nullptr};
+State state1355 = {&shift523, &reduce523, nullptr};
+State state1356 = {&shift7, &reduce7, &go1356};
+State state1357 = {&shift1357, &reduce1357, &go1357};
+State state1358 = {&shift528, &reduce528, nullptr};
+State state1359 = {&shift1359, &reduce1359, nullptr};
+State state1360 = {&shift1342, &reduce1342, nullptr};
+State state1361 = {&shift0, &reduce0, &go1361};
+State state1362 = {&shift1362, &reduce1362, &go1362};
+State state1363 = {&shift1347, &reduce1347, nullptr};
+State state1364 = {&shift1364, &reduce1364, nullptr};
+State state1365 = {&shift1329, &reduce1329, nullptr};
+State state1366 = {&shift503, &reduce503, &go1366};
+State state1367 = {&shift1367, &reduce1367, &go1367};
+State state1368 = {&shift1334, &reduce1334, nullptr};
+State state1369 = {&shift1369, &reduce1369, nullptr};
+State state1370 = {&shift1316, &reduce1316, nullptr};
+State state1371 = {&shift495, &reduce495, &go1371};
+State state1372 = {&shift1372, &reduce1372, &go1372};
+State state1373 = {&shift1321, &reduce1321, nullptr};
+State state1374 = {&shift1374, &reduce1374, nullptr};
+State state1375 = {&shift1303, &reduce1303, nullptr};
+State state1376 = {&shift487, &reduce487, &go1376};
+State state1377 = {&shift1377, &reduce1377, &go1377};
+State state1378 = {&shift1308, &reduce1308, nullptr};
+State state1379 = {&shift1379, &reduce1379, nullptr};
+State state1380 = {&shift1290, &reduce1290, nullptr};
+State state1381 = {&shift479, &reduce479, &go1381};
+State state1382 = {&shift1382, &reduce1382, &go1382};
+State state1383 = {&shift1295, &reduce1295, nullptr};
+State state1384 = {&shift1384, &reduce1384, nullptr};
+State state1385 = {&shift1277, &reduce1277, nullptr};
+State state1386 = {&shift471, &reduce471, &go1386};
+State state1387 = {&shift1387, &reduce1387, &go1387};
+State state1388 = {&shift1282, &reduce1282, nullptr};
+State state1389 = {&shift1389, &reduce1389, nullptr};
+State state1390 = {&shift1264, &reduce1264, nullptr};
+State state1391 = {&shift463, &reduce463, &go1391};
+State state1392 = {&shift1392, &reduce1392, &go1392};
+State state1393 = {&shift1269, &reduce1269, nullptr};
+State state1394 = {&shift1394, &reduce1394, nullptr};
+State state1395 = {&shift1251, &reduce1251, nullptr};
+State state1396 = {&shift455, &reduce455, &go1396};
+State state1397 = {&shift1397, &reduce1397, &go1397};
+State state1398 = {&shift1256, &reduce1256, nullptr};
+State state1399 = {&shift1399, &reduce1399, nullptr};
+State state1400 = {&shift1238, &reduce1238, nullptr};
+State state1401 = {&shift447, &reduce447, &go1401};
+State state1402 = {&shift1402, &reduce1402, &go1402};
+State state1403 = {&shift1243, &reduce1243, nullptr};
+State state1404 = {&shift1404, &reduce1404, nullptr};
+State state1405 = {&shift1225, &reduce1225, nullptr};
+State state1406 = {&shift439, &reduce439, &go1406};
+State state1407 = {&shift1407, &reduce1407, &go1407};
+State state1408 = {&shift1230, &reduce1230, nullptr};
+State state1409 = {&shift1409, &reduce1409, nullptr};
+State state1410 = {&shift1212, &reduce1212, nullptr};
+State state1411 = {&shift431, &reduce431, &go1411};
+State state1412 = {&shift1412, &reduce1412, &go1412};
+State state1413 = {&shift1217, &reduce1217, nullptr};
+State state1414 = {&shift1414, &reduce1414, nullptr};
+State state1415 = {&shift1199, &reduce1199, nullptr};
+State state1416 = {&shift423, &reduce423, &go1416};
+State state1417 = {&shift1417, &reduce1417, &go1417};
+State state1418 = {&shift1204, &reduce1204, nullptr};
+State state1419 = {&shift1419, &reduce1419, nullptr};
+State state1420 = {&shift1186, &reduce1186, nullptr};
+State state1421 = {&shift415, &reduce415, &go1421};
+State state1422 = {&shift1422, &reduce1422, &go1422};
+State state1423 = {&shift1191, &reduce1191, nullptr};
+State state1424 = {&shift1424, &reduce1424, nullptr};
+State state1425 = {&shift1173, &reduce1173, nullptr};
+State state1426 = {&shift407, &reduce407, &go1426};
+State state1427 = {&shift1427, &reduce1427, &go1427};
+State state1428 = {&shift1178, &reduce1178, nullptr};
+State state1429 = {&shift1429, &reduce1429, nullptr};
+State state1430 = {&shift1160, &reduce1160, nullptr};
+State state1431 = {&shift399, &reduce399, &go1431};
+State state1432 = {&shift1432, &reduce1432, &go1432};
+State state1433 = {&shift1165, &reduce1165, nullptr};
+State state1434 = {&shift1434, &reduce1434, nullptr};
+State state1435 = {&shift1147, &reduce1147, nullptr};
+State state1436 = {&shift391, &reduce391, &go1436};
+State state1437 = {&shift1437, &reduce1437, &go1437};
+State state1438 = {&shift1152, &reduce1152, nullptr};
+State state1439 = {&shift1439, &reduce1439, nullptr};
+State state1440 = {&shift1134, &reduce1134, nullptr};
+State state1441 = {&shift383, &reduce383, &go1441};
+State state1442 = {&shift1442, &reduce1442, &go1442};
+State state1443 = {&shift1139, &reduce1139, nullptr};
+State state1444 = {&shift1444, &reduce1444, nullptr};
+State state1445 = {&shift1121, &reduce1121, nullptr};
+State state1446 = {&shift375, &reduce375, &go1446};
+State state1447 = {&shift1447, &reduce1447, &go1447};
+State state1448 = {&shift1126, &reduce1126, nullptr};
+State state1449 = {&shift1449, &reduce1449, nullptr};
+State state1450 = {&shift1108, &reduce1108, nullptr};
+State state1451 = {&shift367, &reduce367, &go1451};
+State state1452 = {&shift1452, &reduce1452, &go1452};
+State state1453 = {&shift1113, &reduce1113, nullptr};
+State state1454 = {&shift1454, &reduce1454, nullptr};
+State state1455 = {&shift1095, &reduce1095, nullptr};
+State state1456 = {&shift359, &reduce359, &go1456};
+State state1457 = {&shift1457, &reduce1457, &go1457};
+State state1458 = {&shift1100, &reduce1100, nullptr};
+State state1459 = {&shift1459, &reduce1459, nullptr};
+State state1460 = {&shift1082, &reduce1082, nullptr};
+State state1461 = {&shift351, &reduce351, &go1461};
+State state1462 = {&shift1462, &reduce1462, &go1462};
+State state1463 = {&shift1087, &reduce1087, nullptr};
+State state1464 = {&shift1464, &reduce1464, nullptr};
+State state1465 = {&shift1069, &reduce1069, nullptr};
+State state1466 = {&shift343, &reduce343, &go1466};
+State state1467 = {&shift1467, &reduce1467, &go1467};
+State state1468 = {&shift1074, &reduce1074, nullptr};
+State state1469 = {&shift1469, &reduce1469, nullptr};
+State state1470 = {&shift1056, &reduce1056, nullptr};
+State state1471 = {&shift335, &reduce335, &go1471};
+State state1472 = {&shift1472, &reduce1472, &go1472};
+State state1473 = {&shift1061, &reduce1061, nullptr};
+State state1474 = {&shift1474, &reduce1474, nullptr};
+State state1475 = {&shift1043, &reduce1043, nullptr};
+State state1476 = {&shift327, &reduce327, &go1476};
+State state1477 = {&shift1477, &reduce1477, &go1477};
+State state1478 = {&shift1048, &reduce1048, nullptr};
+State state1479 = {&shift1479, &reduce1479, nullptr};
+State state1480 = {&shift1030, &reduce1030, nullptr};
+State state1481 = {&shift319, &reduce319, &go1481};
+State state1482 = {&shift1482, &reduce1482, &go1482};
+State state1483 = {&shift1035, &reduce1035, nullptr};
+State state1484 = {&shift1484, &reduce1484, nullptr};
+State state1485 = {&shift1017, &reduce1017, nullptr};
+State state1486 = {&shift311, &reduce311, &go1486};
+State state1487 = {&shift1487, &reduce1487, &go1487};
+State state1488 = {&shift1022, &reduce1022, nullptr};
+State state1489 = {&shift1489, &reduce1489, nullptr};
+State state1490 = {&shift1004, &reduce1004, nullptr};
+State state1491 = {&shift303, &reduce303, &go1491};
+State state1492 = {&shift1492, &reduce1492, &go1492};
+State state1493 = {&shift1009, &reduce1009, nullptr};
+State state1494 = {&shift1494, &reduce1494, nullptr};
+State state1495 = {&shift991, &reduce991, nullptr};
+State state1496 = {&shift295, &reduce295, &go1496};
+State state1497 = {&shift1497, &reduce1497, &go1497};
+State state1498 = {&shift996, &reduce996, nullptr};
+State state1499 = {&shift1499, &reduce1499, nullptr};
+State state1500 = {&shift978, &reduce978, nullptr};
+State state1501 = {&shift287, &reduce287, &go1501};
+State state1502 = {&shift1502, &reduce1502, &go1502};
+State state1503 = {&shift983, &reduce983, nullptr};
+State state1504 = {&shift1504, &reduce1504, nullptr};
+State state1505 = {&shift965, &reduce965, nullptr};
+State state1506 = {&shift279, &reduce279, &go1506};
+State state1507 = {&shift1507, &reduce1507, &go1507};
+State state1508 = {&shift970, &reduce970, nullptr};
+State state1509 = {&shift1509, &reduce1509, nullptr};
+State state1510 = {&shift952, &reduce952, nullptr};
+State state1511 = {&shift271, &reduce271, &go1511};
+State state1512 = {&shift1512, &reduce1512, &go1512};
+State state1513 = {&shift957, &reduce957, nullptr};
+State state1514 = {&shift1514, &reduce1514, nullptr};
+State state1515 = {&shift939, &reduce939, nullptr};
+State state1516 = {&shift263, &reduce263, &go1516};
+State state1517 = {&shift1517, &reduce1517, &go1517};
+State state1518 = {&shift944, &reduce944, nullptr};
+State state1519 = {&shift1519, &reduce1519, nullptr};
+State state1520 = {&shift926, &reduce926, nullptr};
+State state1521 = {&shift255, &reduce255, &go1521};
+State state1522 = {&shift1522, &reduce1522, &go1522};
+State state1523 = {&shift931, &reduce931, nullptr};
+State state1524 = {&shift1524, &reduce1524, nullptr};
+State state1525 = {&shift913, &reduce913, nullptr};
+State state1526 = {&shift247, &reduce247, &go1526};
+State state1527 = {&shift1527, &reduce1527, &go1527};
+State state1528 = {&shift918, &reduce918, nullptr};
+State state1529 = {&shift1529, &reduce1529, nullptr};
+State state1530 = {&shift900, &reduce900, nullptr};
+State state1531 = {&shift239, &reduce239, &go1531};
+State state1532 = {&shift1532, &reduce1532, &go1532};
+State state1533 = {&shift905, &reduce905, nullptr};
+State state1534 = {&shift1534, &reduce1534, nullptr};
+State state1535 = {&shift887, &reduce887, nullptr};
+State state1536 = {&shift231, &reduce231, &go1536};
+State state1537 = {&shift1537, &reduce1537, &go1537};
+State state1538 = {&shift892, &reduce892, nullptr};
+State state1539 = {&shift1539, &reduce1539, nullptr};
+State state1540 = {&shift874, &reduce874, nullptr};
+State state1541 = {&shift223, &reduce223, &go1541};
+State state1542 = {&shift1542, &reduce1542, &go1542};
+State state1543 = {&shift879, &reduce879, nullptr};
+State state1544 = {&shift1544, &reduce1544, nullptr};
+State state1545 = {&shift861, &reduce861, nullptr};
+State state1546 = {&shift215, &reduce215, &go1546};
+State state1547 = {&shift1547, &reduce1547, &go1547};
+State state1548 = {&shift866, &reduce866, nullptr};
+State state1549 = {&shift1549, &reduce1549, nullptr};
+State state1550 = {&shift848, &reduce848, nullptr};
+State state1551 = {&shift207, &reduce207, &go1551};
+State state1552 = {&shift1552, &reduce1552, &go1552};
+State state1553 = {&shift853, &reduce853, nullptr};
+State state1554 = {&shift1554, &reduce1554, nullptr};
+State state1555 = {&shift835, &reduce835, nullptr};
+State state1556 = {&shift199, &reduce199, &go1556};
+State state1557 = {&shift1557, &reduce1557, &go1557};
+State state1558 = {&shift840, &reduce840, nullptr};
+State state1559 = {&shift1559, &reduce1559, nullptr};
+State state1560 = {&shift822, &reduce822, nullptr};
+State state1561 = {&shift191, &reduce191, &go1561};
+State state1562 = {&shift1562, &reduce1562, &go1562};
+State state1563 = {&shift827, &reduce827, nullptr};
+State state1564 = {&shift1564, &reduce1564, nullptr};
+State state1565 = {&shift809, &reduce809, nullptr};
+State state1566 = {&shift183, &reduce183, &go1566};
+State state1567 = {&shift1567, &reduce1567, &go1567};
+State state1568 = {&shift814, &reduce814, nullptr};
+State state1569 = {&shift1569, &reduce1569, nullptr};
+State state1570 = {&shift796, &reduce796, nullptr};
+State state1571 = {&shift175, &reduce175, &go1571};
+State state1572 = {&shift1572, &reduce1572, &go1572};
+State state1573 = {&shift801, &reduce801, nullptr};
+State state1574 = {&shift1574, &reduce1574, nullptr};
+State state1575 = {&shift783, &reduce783, nullptr};
+State state1576 = {&shift167, &reduce167, &go1576};
+State state1577 = {&shift1577, &reduce1577, &go1577};
+State state1578 = {&shift788, &reduce788, nullptr};
+State state1579 = {&shift1579, &reduce1579, nullptr};
+State state1580 = {&shift770, &reduce770, nullptr};
+State state1581 = {&shift159, &reduce159, &go1581};
+State state1582 = {&shift1582, &reduce1582, &go1582};
+State state1583 = {&shift775, &reduce775, nullptr};
+State state1584 = {&shift1584, &reduce1584, nullptr};
+State state1585 = {&shift757, &reduce757, nullptr};
+State state1586 = {&shift151, &reduce151, &go1586};
+State state1587 = {&shift1587, &reduce1587, &go1587};
+State state1588 = {&shift762, &reduce762, nullptr};
+State state1589 = {&shift1589, &reduce1589, nullptr};
+State state1590 = {&shift744, &reduce744, nullptr};
+State state1591 = {&shift143, &reduce143, &go1591};
+State state1592 = {&shift1592, &reduce1592, &go1592};
+State state1593 = {&shift749, &reduce749, nullptr};
+State state1594 = {&shift1594, &reduce1594, nullptr};
+State state1595 = {&shift731, &reduce731, nullptr};
+State state1596 = {&shift135, &reduce135, &go1596};
+State state1597 = {&shift1597, &reduce1597, &go1597};
+State state1598 = {&shift736, &reduce736, nullptr};
+State state1599 = {&shift1599, &reduce1599, nullptr};
+State state1600 = {&shift718, &reduce718, nullptr};
+State state1601 = {&shift127, &reduce127, &go1601};
+State state1602 = {&shift1602, &reduce1602, &go1602};
+State state1603 = {&shift723, &reduce723, nullptr};
+State state1604 = {&shift1604, &reduce1604, nullptr};
+State state1605 = {&shift705, &reduce705, nullptr};
+State state1606 = {&shift119, &reduce119, &go1606};
+State state1607 = {&shift1607, &reduce1607, &go1607};
+State state1608 = {&shift710, &reduce710, nullptr};
+State state1609 = {&shift1609, &reduce1609, nullptr};
+State state1610 = {&shift692, &reduce692, nullptr};
+State state1611 = {&shift111, &reduce111, &go1611};
+State state1612 = {&shift1612, &reduce1612, &go1612};
+State state1613 = {&shift697, &reduce697, nullptr};
+State state1614 = {&shift1614, &reduce1614, nullptr};
+State state1615 = {&shift679, &reduce679, nullptr};
+State state1616 = {&shift103, &reduce103, &go1616};
+State state1617 = {&shift1617, &reduce1617, &go1617};
+State state1618 = {&shift684, &reduce684, nullptr};
+State state1619 = {&shift1619, &reduce1619, nullptr};
+State state1620 = {&shift666, &reduce666, nullptr};
+State state1621 = {&shift95, &reduce95, &go1621};
+State state1622 = {&shift1622, &reduce1622, &go1622};
+State state1623 = {&shift671, &reduce671, nullptr};
+State state1624 = {&shift1624, &reduce1624, nullptr};
+State state1625 = {&shift653, &reduce653, nullptr};
+State state1626 = {&shift87, &reduce87, &go1626};
+State state1627 = {&shift1627, &reduce1627, &go1627};
+State state1628 = {&shift658, &reduce658, nullptr};
+State state1629 = {&shift1629, &reduce1629, nullptr};
+State state1630 = {&shift640, &reduce640, nullptr};
+State state1631 = {&shift79, &reduce79, &go1631};
+State state1632 = {&shift1632, &reduce1632, &go1632};
+State state1633 = {&shift645, &reduce645, nullptr};
+State state1634 = {&shift1634, &reduce1634, nullptr};
+State state1635 = {&shift627, &reduce627, nullptr};
+State state1636 = {&shift71, &reduce71, &go1636};
+State state1637 = {&shift1637, &reduce1637, &go1637};
+State state1638 = {&shift632, &reduce632, nullptr};
+State state1639 = {&shift1639, &reduce1639, nullptr};
+State state1640 = {&shift614, &reduce614, nullptr};
+State state1641 = {&shift63, &reduce63, &go1641};
+State state1642 = {&shift1642, &reduce1642, &go1642};
+State state1643 = {&shift619, &reduce619, nullptr};
+State state1644 = {&shift1644, &reduce1644, nullptr};
+State state1645 = {&shift601, &reduce601, nullptr};
+State state1646 = {&shift55, &reduce55, &go1646};
+State state1647 = {&shift1647, &reduce1647, &go1647};
+State state1648 = {&shift606, &reduce606, nullptr};
+State state1649 = {&shift1649, &reduce1649, nullptr};
+State state1650 = {&shift588, &reduce588, nullptr};
+State state1651 = {&shift47, &reduce47, &go1651};
+State state1652 = {&shift1652, &reduce1652, &go1652};
+State state1653 = {&shift593, &reduce593, nullptr};
+State state1654 = {&shift1654, &reduce1654, nullptr};
+State state1655 = {&shift575, &reduce575, nullptr};
+State state1656 = {&shift39, &reduce39, &go1656};
+State state1657 = {&shift1657, &reduce1657, &go1657};
+State state1658 = {&shift580, &reduce580, nullptr};
+State state1659 = {&shift1659, &reduce1659, nullptr};
+State state1660 = {&shift562, &reduce562, nullptr};
+State state1661 = {&shift31, &reduce31, &go1661};
+State state1662 = {&shift1662, &reduce1662, &go1662};
+State state1663 = {&shift567, &reduce567, nullptr};
+State state1664 = {&shift1664, &reduce1664, nullptr};
+State state1665 = {&shift549, &reduce549, nullptr};
+State state1666 = {&shift23, &reduce23, &go1666};
+State state1667 = {&shift1667, &reduce1667, &go1667};
+State state1668 = {&shift554, &reduce554, nullptr};
+State state1669 = {&shift1669, &reduce1669, nullptr};
+State state1670 = {&shift536, &reduce536, nullptr};
+State state1671 = {&shift15, &reduce15, &go1671};
+State state1672 = {&shift1672, &reduce1672, &go1672};
+State state1673 = {&shift541, &reduce541, nullptr};
+State state1674 = {&shift1674, &reduce1674, nullptr};
+State state1675 = {&shift523, &reduce523, nullptr};
+State state1676 = {&shift7, &reduce7, &go1676};
+State state1677 = {&shift1677, &reduce1677, &go1677};
+State state1678 = {&shift528, &reduce528, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,329 @@
+#include "synth.hpp"
+
+std::unique_ptr<Tree>
+reduce_program_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items0_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items0_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item0_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item0_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item0_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item0_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items1_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items1_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item1_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item1_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item1_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item1_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items2_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items2_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item2_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item2_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item2_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item2_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items3_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items3_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item3_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item3_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item3_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item3_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items4_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items4_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item4_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item4_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item4_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item4_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items5_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items5_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item5_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item5_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item5_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item5_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items6_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items6_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item6_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item6_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item6_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item6_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items7_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_items7_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item7_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item7_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item7_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_item7_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
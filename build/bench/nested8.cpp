@@ -0,0 +1,1214 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"ba", false, 0};
+Symbol term1 = {"bb", false, 1};
+Symbol term2 = {"bc", false, 2};
+Symbol term3 = {"bd", false, 3};
+Symbol term4 = {"be", false, 4};
+Symbol term5 = {"bf", false, 5};
+Symbol term6 = {"bg", false, 6};
+Symbol term7 = {"bh", false, 7};
+Symbol term8 = {"num", true, 8};
+Symbol term9 = {"ws", true, 9};
+Symbol term10 = {"id", false, 10};
+Symbol term11 = {";", false, 11};
+Symbol term12 = {"=", false, 12};
+Symbol term13 = {"{", false, 13};
+Symbol term14 = {"}", false, 14};
+Symbol term15 = {"(", false, 15};
+Symbol term16 = {")", false, 16};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 8, 8, 8, 8, 8,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 11, 12, 13, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 25, 26, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 28 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if (k == 16) { return &node8; }
+    if ((k >= 17) && (k <= 23)) { return &node7; }
+    if (k == 24) { return &node9; }
+    if (k == 26) { return &node10; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next4(int c) {
+    int k = lexer_class(c);
+    if (k == 9) { return &node4; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 15) { return &node11; }
+    if (k == 16) { return &node12; }
+    if (k == 17) { return &node13; }
+    if (k == 18) { return &node14; }
+    if (k == 19) { return &node15; }
+    if (k == 20) { return &node16; }
+    if (k == 21) { return &node17; }
+    if (k == 22) { return &node18; }
+    if (k == 23) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if ((k >= 15) && (k <= 23)) { return &node7; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term9, nullptr};
+Node node2 = {nullptr, &term15, nullptr};
+Node node3 = {nullptr, &term16, nullptr};
+Node node4 = {&next4, &term8, nullptr};
+Node node5 = {nullptr, &term11, nullptr};
+Node node6 = {nullptr, &term12, nullptr};
+Node node7 = {&next7, &term10, nullptr};
+Node node8 = {&next8, &term10, nullptr};
+Node node9 = {nullptr, &term13, nullptr};
+Node node10 = {nullptr, &term14, nullptr};
+Node node11 = {&next11, &term0, nullptr};
+Node node12 = {&next12, &term1, nullptr};
+Node node13 = {&next13, &term2, nullptr};
+Node node14 = {&next14, &term3, nullptr};
+Node node15 = {&next15, &term4, nullptr};
+Node node16 = {&next16, &term5, nullptr};
+Node node17 = {&next17, &term6, nullptr};
+Node node18 = {&next18, &term7, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 17};
+Symbol nonterm0 = {"program", false, 0};
+Symbol nonterm1 = {"items0", false, 1};
+Symbol nonterm2 = {"item0", false, 2};
+Symbol nonterm3 = {"items1", false, 3};
+Symbol nonterm4 = {"item1", false, 4};
+Symbol nonterm5 = {"items2", false, 5};
+Symbol nonterm6 = {"item2", false, 6};
+Symbol nonterm7 = {"items3", false, 7};
+Symbol nonterm8 = {"item3", false, 8};
+Symbol nonterm9 = {"items4", false, 9};
+Symbol nonterm10 = {"item4", false, 10};
+Symbol nonterm11 = {"items5", false, 11};
+Symbol nonterm12 = {"item5", false, 12};
+Symbol nonterm13 = {"items6", false, 13};
+Symbol nonterm14 = {"item6", false, 14};
+Symbol nonterm15 = {"items7", false, 15};
+Symbol nonterm16 = {"item7", false, 16};
+
+unique_ptr<Tree>
+reduce_program_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_0(Table*);
+
+Value*
+reduce_items0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items0_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_0(Table*);
+
+Value*
+reduce_item0_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_1(Table*);
+
+Value*
+reduce_item0_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item0_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item0_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item0_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item0_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_0(Table*);
+
+Value*
+reduce_items1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items1_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_0(Table*);
+
+Value*
+reduce_item1_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_1(Table*);
+
+Value*
+reduce_item1_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item1_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item1_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item1_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item1_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_0(Table*);
+
+Value*
+reduce_items2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items2_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_0(Table*);
+
+Value*
+reduce_item2_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_1(Table*);
+
+Value*
+reduce_item2_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item2_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item2_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item2_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item2_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_0(Table*);
+
+Value*
+reduce_items3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items3_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_0(Table*);
+
+Value*
+reduce_item3_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_1(Table*);
+
+Value*
+reduce_item3_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item3_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item3_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item3_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item3_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_0(Table*);
+
+Value*
+reduce_items4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items4_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_0(Table*);
+
+Value*
+reduce_item4_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_1(Table*);
+
+Value*
+reduce_item4_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item4_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item4_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item4_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item4_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_0(Table*);
+
+Value*
+reduce_items5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items5_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_0(Table*);
+
+Value*
+reduce_item5_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_1(Table*);
+
+Value*
+reduce_item5_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item5_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item5_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item5_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item5_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_0(Table*);
+
+Value*
+reduce_items6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items6_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_0(Table*);
+
+Value*
+reduce_item6_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_1(Table*);
+
+Value*
+reduce_item6_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item6_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item6_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item6_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item6_3(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_0(Table*);
+
+Value*
+reduce_items7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_items7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_items7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_items7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_items7_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_0(Table*);
+
+Value*
+reduce_item7_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_1(Table*);
+
+Value*
+reduce_item7_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_item7_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_item7_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_item7_3(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_item7_3(table, E2);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_program_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_items0_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_items0_1, -1};
+Rule rule3 = {&nonterm2, 2, &reduce_item0_0, -1};
+Rule rule4 = {&nonterm2, 4, &reduce_item0_1, -1};
+Rule rule5 = {&nonterm2, 4, &reduce_item0_2, -1};
+Rule rule6 = {&nonterm2, 4, &reduce_item0_3, -1};
+Rule rule7 = {&nonterm3, 0, &reduce_items1_0, -1};
+Rule rule8 = {&nonterm3, 2, &reduce_items1_1, -1};
+Rule rule9 = {&nonterm4, 2, &reduce_item1_0, -1};
+Rule rule10 = {&nonterm4, 4, &reduce_item1_1, -1};
+Rule rule11 = {&nonterm4, 4, &reduce_item1_2, -1};
+Rule rule12 = {&nonterm4, 4, &reduce_item1_3, -1};
+Rule rule13 = {&nonterm5, 0, &reduce_items2_0, -1};
+Rule rule14 = {&nonterm5, 2, &reduce_items2_1, -1};
+Rule rule15 = {&nonterm6, 2, &reduce_item2_0, -1};
+Rule rule16 = {&nonterm6, 4, &reduce_item2_1, -1};
+Rule rule17 = {&nonterm6, 4, &reduce_item2_2, -1};
+Rule rule18 = {&nonterm6, 4, &reduce_item2_3, -1};
+Rule rule19 = {&nonterm7, 0, &reduce_items3_0, -1};
+Rule rule20 = {&nonterm7, 2, &reduce_items3_1, -1};
+Rule rule21 = {&nonterm8, 2, &reduce_item3_0, -1};
+Rule rule22 = {&nonterm8, 4, &reduce_item3_1, -1};
+Rule rule23 = {&nonterm8, 4, &reduce_item3_2, -1};
+Rule rule24 = {&nonterm8, 4, &reduce_item3_3, -1};
+Rule rule25 = {&nonterm9, 0, &reduce_items4_0, -1};
+Rule rule26 = {&nonterm9, 2, &reduce_items4_1, -1};
+Rule rule27 = {&nonterm10, 2, &reduce_item4_0, -1};
+Rule rule28 = {&nonterm10, 4, &reduce_item4_1, -1};
+Rule rule29 = {&nonterm10, 4, &reduce_item4_2, -1};
+Rule rule30 = {&nonterm10, 4, &reduce_item4_3, -1};
+Rule rule31 = {&nonterm11, 0, &reduce_items5_0, -1};
+Rule rule32 = {&nonterm11, 2, &reduce_items5_1, -1};
+Rule rule33 = {&nonterm12, 2, &reduce_item5_0, -1};
+Rule rule34 = {&nonterm12, 4, &reduce_item5_1, -1};
+Rule rule35 = {&nonterm12, 4, &reduce_item5_2, -1};
+Rule rule36 = {&nonterm12, 4, &reduce_item5_3, -1};
+Rule rule37 = {&nonterm13, 0, &reduce_items6_0, -1};
+Rule rule38 = {&nonterm13, 2, &reduce_items6_1, -1};
+Rule rule39 = {&nonterm14, 2, &reduce_item6_0, -1};
+Rule rule40 = {&nonterm14, 4, &reduce_item6_1, -1};
+Rule rule41 = {&nonterm14, 4, &reduce_item6_2, -1};
+Rule rule42 = {&nonterm14, 4, &reduce_item6_3, -1};
+Rule rule43 = {&nonterm15, 0, &reduce_items7_0, -1};
+Rule rule44 = {&nonterm15, 2, &reduce_items7_1, -1};
+Rule rule45 = {&nonterm16, 2, &reduce_item7_0, -1};
+Rule rule46 = {&nonterm16, 4, &reduce_item7_1, -1};
+Rule rule47 = {&nonterm16, 4, &reduce_item7_2, -1};
+Rule rule48 = {&nonterm16, 4, &reduce_item7_3, -1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6, &rule7,
+    &rule8, &rule9, &rule10, &rule11, &rule12, &rule13, &rule14, &rule15,
+    &rule16, &rule17, &rule18, &rule19, &rule20, &rule21, &rule22, &rule23,
+    &rule24, &rule25, &rule26, &rule27, &rule28, &rule29, &rule30, &rule31,
+    &rule32, &rule33, &rule34, &rule35, &rule36, &rule37, &rule38, &rule39,
+    &rule40, &rule41, &rule42, &rule43, &rule44, &rule45, &rule46, &rule47,
+    &rule48
+};
+
+State parse_states[223] = {
+    {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7},
+    {8, 8}, {9, 9}, {10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}, {15, 15},
+    {16, 16}, {17, 17}, {18, 18}, {19, 19}, {20, 20}, {21, 21}, {22, 22}, {23, 23},
+    {24, 24}, {25, 25}, {26, 26}, {27, 27}, {28, 28}, {29, 29}, {30, 30}, {31, 31},
+    {32, 32}, {33, 33}, {34, 34}, {35, 35}, {36, 36}, {37, 37}, {38, 38}, {39, 39},
+    {40, 40}, {41, 41}, {42, 42}, {43, 43}, {44, 44}, {45, 45}, {46, 46}, {47, 47},
+    {48, 48}, {49, 49}, {50, 50}, {51, 51}, {52, 52}, {53, 53}, {54, 54}, {55, 55},
+    {56, 56}, {57, 57}, {58, 58}, {59, 59}, {60, 60}, {61, 61}, {62, 62}, {63, 0},
+    {64, 63}, {65, 64}, {66, 65}, {67, 66}, {68, 4}, {69, 5}, {70, 67}, {71, 7},
+    {72, 68}, {73, 11}, {74, 69}, {75, 70}, {76, 7}, {77, 71}, {78, 72}, {79, 73},
+    {80, 74}, {81, 12}, {82, 13}, {83, 75}, {84, 15}, {85, 76}, {86, 19}, {87, 77},
+    {88, 78}, {89, 15}, {90, 79}, {91, 80}, {92, 81}, {93, 82}, {94, 20}, {95, 21},
+    {96, 83}, {97, 23}, {98, 84}, {99, 27}, {100, 85}, {101, 86}, {102, 23}, {103, 87},
+    {104, 88}, {105, 89}, {106, 90}, {107, 28}, {108, 29}, {109, 91}, {110, 31}, {111, 92},
+    {112, 35}, {113, 93}, {114, 94}, {115, 31}, {116, 95}, {117, 96}, {118, 97}, {119, 98},
+    {120, 36}, {121, 37}, {122, 99}, {123, 39}, {124, 100}, {125, 43}, {126, 101}, {127, 102},
+    {128, 39}, {129, 103}, {130, 104}, {131, 105}, {132, 106}, {133, 44}, {134, 45}, {135, 107},
+    {136, 47}, {137, 108}, {138, 51}, {139, 109}, {140, 110}, {141, 47}, {142, 111}, {143, 112},
+    {144, 113}, {145, 114}, {146, 52}, {147, 53}, {148, 115}, {149, 55}, {150, 116}, {151, 59},
+    {152, 117}, {153, 118}, {154, 55}, {155, 119}, {156, 120}, {157, 121}, {158, 122}, {159, 60},
+    {160, 61}, {161, 123}, {162, 0}, {163, 124}, {164, 66}, {165, 125}, {166, 126}, {167, 0},
+    {168, 127}, {169, 128}, {170, 129}, {171, 130}, {172, 4}, {173, 5}, {174, 131}, {175, 7},
+    {176, 132}, {177, 11}, {178, 133}, {179, 70}, {180, 7}, {181, 134}, {182, 74}, {183, 135},
+    {184, 126}, {185, 0}, {186, 136}, {187, 130}, {188, 137}, {189, 118}, {190, 55}, {191, 138},
+    {192, 122}, {193, 139}, {194, 110}, {195, 47}, {196, 140}, {197, 114}, {198, 141}, {199, 102},
+    {200, 39}, {201, 142}, {202, 106}, {203, 143}, {204, 94}, {205, 31}, {206, 144}, {207, 98},
+    {208, 145}, {209, 86}, {210, 23}, {211, 146}, {212, 90}, {213, 147}, {214, 78}, {215, 15},
+    {216, 148}, {217, 82}, {218, 149}, {219, 70}, {220, 7}, {221, 150}, {222, 74}
+};
+
+unsigned char action_base[] = {
+    0, 0, 56, 0, 0, 0, 78, 0, 3, 87, 9, 0, 0, 0, 102, 0,
+    6, 127, 14, 0, 0, 0, 131, 0, 20, 146, 16, 0, 0, 0, 153, 0,
+    28, 156, 22, 0, 0, 0, 160, 0, 30, 159, 30, 0, 0, 0, 163, 0,
+    33, 161, 36, 0, 0, 0, 165, 0, 43, 163, 43, 0, 0, 0, 167, 52,
+    165, 45, 0, 169, 60, 169, 0, 4, 168, 52, 0, 172, 63, 172, 0, 64,
+    171, 60, 0, 175, 74, 175, 0, 77, 174, 70, 0, 178, 79, 178, 0, 82,
+    177, 82, 0, 181, 93, 181, 0, 94, 180, 90, 0, 184, 100, 184, 0, 101,
+    183, 102, 0, 187, 111, 187, 0, 112, 186, 113, 0, 190, 120, 190, 0, 123,
+    189, 120, 0, 193, 128, 193, 133, 194, 139, 195, 138, 196, 136, 197, 146, 198,
+    151, 199, 154, 200, 152, 201, 157
+};
+
+unsigned short action_default[] = {
+    6, 0, 0, 0, 10, 14, 0, 30, 0, 0, 0, 26, 34, 38, 0, 54,
+    0, 0, 0, 50, 58, 62, 0, 78, 0, 0, 0, 74, 82, 86, 0, 102,
+    0, 0, 0, 98, 106, 110, 0, 126, 0, 0, 0, 122, 130, 134, 0, 150,
+    0, 0, 0, 146, 154, 158, 0, 174, 0, 0, 0, 170, 178, 182, 0, 0,
+    0, 0, 194, 0, 0, 0, 18, 0, 0, 0, 22, 0, 0, 0, 42, 0,
+    0, 0, 46, 0, 0, 0, 66, 0, 0, 0, 70, 0, 0, 0, 90, 0,
+    0, 0, 94, 0, 0, 0, 114, 0, 0, 0, 118, 0, 0, 0, 138, 0,
+    0, 0, 142, 0, 0, 0, 162, 0, 0, 0, 166, 0, 0, 0, 186, 0,
+    0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+};
+
+unsigned char action_check[] = {
+    1, 151, 151, 151, 8, 71, 151, 151, 16, 151, 1, 3, 3, 8, 71, 3,
+    16, 1, 71, 8, 10, 10, 16, 24, 10, 18, 18, 26, 26, 18, 24, 26,
+    32, 34, 34, 40, 24, 34, 32, 48, 40, 42, 42, 48, 32, 42, 40, 50,
+    50, 48, 56, 50, 63, 56, 58, 58, 65, 65, 58, 56, 65, 68, 63, 73,
+    73, 76, 79, 73, 63, 2, 68, 81, 81, 76, 79, 81, 68, 84, 79, 76,
+    87, 89, 89, 92, 84, 89, 95, 87, 6, 92, 84, 87, 95, 97, 97, 92,
+    95, 97, 100, 103, 9, 105, 105, 100, 103, 105, 108, 111, 103, 100, 108, 111,
+    14, 113, 113, 111, 108, 113, 116, 119, 124, 116, 119, 127, 121, 121, 119, 116,
+    121, 132, 124, 129, 129, 127, 134, 129, 124, 127, 132, 136, 17, 22, 140, 134,
+    132, 138, 140, 134, 138, 136, 140, 142, 138, 136, 148, 144, 142, 146, 150, 25,
+    142, 144, 148, 30, 146, 144, 148, 150, 146, 33, 38, 150, 41, 46, 49, 54,
+    57, 62, 64, 67, 69, 72, 75, 77, 80, 83, 85, 88, 91, 93, 96, 99,
+    101, 104, 107, 109, 112, 115, 117, 120, 123, 125, 128, 131, 133, 135, 137, 139,
+    141, 143, 145, 147, 149, 151, 151, 151, 151, 151, 151
+};
+
+unsigned short action_next[] = {
+    9, 0, 0, 0, 37, 313, 0, 0, 69, 0, 13, 21, 25, 41, 317, 29,
+    73, 3, 321, 45, 53, 57, 77, 101, 61, 85, 89, 117, 121, 93, 105, 125,
+    133, 149, 153, 165, 109, 157, 137, 197, 169, 181, 185, 201, 141, 189, 173, 213,
+    217, 205, 229, 221, 261, 233, 245, 249, 277, 281, 253, 237, 285, 37, 265, 329,
+    333, 69, 365, 337, 269, 881, 41, 381, 385, 73, 369, 389, 293, 101, 373, 345,
+    417, 433, 437, 133, 105, 441, 469, 421, 873, 137, 397, 425, 473, 485, 489, 449,
+    477, 493, 165, 521, 861, 537, 541, 169, 525, 545, 197, 573, 529, 501, 201, 577,
+    853, 589, 593, 581, 553, 597, 229, 625, 261, 233, 629, 677, 641, 645, 633, 605,
+    649, 37, 265, 693, 697, 681, 313, 701, 657, 685, 41, 677, 841, 833, 573, 317,
+    709, 625, 577, 729, 629, 681, 789, 521, 769, 749, 365, 469, 525, 417, 313, 821,
+    809, 473, 369, 813, 421, 829, 869, 317, 849, 801, 793, 889, 781, 773, 761, 753,
+    741, 733, 305, 297, 301, 357, 349, 353, 409, 401, 405, 461, 453, 457, 513, 505,
+    509, 565, 557, 561, 617, 609, 613, 669, 661, 665, 721, 713, 717, 737, 757, 777,
+    797, 817, 837, 857, 877, 0, 0, 0, 0, 0, 0
+};
+
+unsigned char goto_base[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+unsigned char goto_default[] = {
+    0, 1, 68, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56,
+    60
+};
+
+unsigned char goto_check[] = {
+    17, 2, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1,
+    17, 17, 17, 17, 17, 17, 17, 3, 17, 17, 17, 17, 3, 4, 17, 17,
+    17, 17, 17, 17, 5, 17, 17, 17, 17, 5, 6, 17, 17, 17, 17, 17,
+    17, 7, 17, 17, 17, 17, 7, 8, 17, 17, 17, 17, 17, 17, 9, 17,
+    17, 17, 17, 9, 10, 17, 17, 17, 17, 17, 17, 11, 17, 17, 17, 17,
+    11, 12, 17, 17, 17, 17, 17, 17, 13, 17, 17, 17, 17, 13, 14, 17,
+    17, 17, 17, 17, 17, 15, 17, 17, 17, 17, 15, 16, 17, 17, 17, 17,
+    17, 17, 1, 17, 17, 17, 17, 1, 2, 17, 17, 17, 17, 17, 17, 3,
+    17, 17, 17, 17, 3, 4, 17, 17, 17, 1, 2, 17, 17, 17, 15, 16,
+    17, 17, 17, 13, 14, 17, 17, 17, 11, 12, 17, 17, 17, 9, 10, 17,
+    17, 17, 7, 8, 17, 17, 17, 5, 6, 17, 17, 17, 3, 4, 17
+};
+
+unsigned char goto_next[] = {
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+    0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 77, 81, 0, 0,
+    0, 0, 0, 0, 85, 0, 0, 0, 0, 90, 94, 0, 0, 0, 0, 0,
+    0, 98, 0, 0, 0, 0, 103, 107, 0, 0, 0, 0, 0, 0, 111, 0,
+    0, 0, 0, 116, 120, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0,
+    129, 133, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 142, 146, 0,
+    0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 155, 159, 0, 0, 0, 0,
+    0, 0, 163, 0, 0, 0, 0, 168, 172, 0, 0, 0, 0, 0, 0, 176,
+    0, 0, 0, 0, 181, 81, 0, 0, 0, 186, 172, 0, 0, 0, 191, 159,
+    0, 0, 0, 196, 146, 0, 0, 0, 201, 133, 0, 0, 0, 206, 120, 0,
+    0, 0, 211, 107, 0, 0, 0, 216, 94, 0, 0, 0, 221, 81, 0
+};
+
+/* Comb tables of 3374 bytes, 26.5439% of the 12711 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,7004 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"#0", false, 3};
+Symbol term4 = {"#1", false, 4};
+Symbol term5 = {"#2", false, 5};
+Symbol term6 = {"#3", false, 6};
+Symbol term7 = {"#4", false, 7};
+Symbol term8 = {"#5", false, 8};
+Symbol term9 = {"#6", false, 9};
+Symbol term10 = {"#7", false, 10};
+Symbol term11 = {"#8", false, 11};
+Symbol term12 = {"#9", false, 12};
+Symbol term13 = {"#10", false, 13};
+Symbol term14 = {"#11", false, 14};
+Symbol term15 = {"#12", false, 15};
+Symbol term16 = {"#13", false, 16};
+Symbol term17 = {"#14", false, 17};
+Symbol term18 = {"#15", false, 18};
+Symbol term19 = {"#16", false, 19};
+Symbol term20 = {"#17", false, 20};
+Symbol term21 = {"#18", false, 21};
+Symbol term22 = {"#19", false, 22};
+Symbol term23 = {"#20", false, 23};
+Symbol term24 = {"#21", false, 24};
+Symbol term25 = {"#22", false, 25};
+Symbol term26 = {"#23", false, 26};
+Symbol term27 = {"#24", false, 27};
+Symbol term28 = {"#25", false, 28};
+Symbol term29 = {"#26", false, 29};
+Symbol term30 = {"#27", false, 30};
+Symbol term31 = {"#28", false, 31};
+Symbol term32 = {"#29", false, 32};
+Symbol term33 = {"#30", false, 33};
+Symbol term34 = {"#31", false, 34};
+Symbol term35 = {"#32", false, 35};
+Symbol term36 = {"#33", false, 36};
+Symbol term37 = {"#34", false, 37};
+Symbol term38 = {"#35", false, 38};
+Symbol term39 = {"#36", false, 39};
+Symbol term40 = {"#37", false, 40};
+Symbol term41 = {"#38", false, 41};
+Symbol term42 = {"#39", false, 42};
+Symbol term43 = {"#40", false, 43};
+Symbol term44 = {"#41", false, 44};
+Symbol term45 = {"#42", false, 45};
+Symbol term46 = {"#43", false, 46};
+Symbol term47 = {"#44", false, 47};
+Symbol term48 = {"#45", false, 48};
+Symbol term49 = {"#46", false, 49};
+Symbol term50 = {"#47", false, 50};
+Symbol term51 = {"#48", false, 51};
+Symbol term52 = {"#49", false, 52};
+Symbol term53 = {"#50", false, 53};
+Symbol term54 = {"#51", false, 54};
+Symbol term55 = {"#52", false, 55};
+Symbol term56 = {"#53", false, 56};
+Symbol term57 = {"#54", false, 57};
+Symbol term58 = {"#55", false, 58};
+Symbol term59 = {"#56", false, 59};
+Symbol term60 = {"#57", false, 60};
+Symbol term61 = {"#58", false, 61};
+Symbol term62 = {"#59", false, 62};
+Symbol term63 = {"#60", false, 63};
+Symbol term64 = {"#61", false, 64};
+Symbol term65 = {"#62", false, 65};
+Symbol term66 = {"#63", false, 66};
+Symbol term67 = {"#64", false, 67};
+Symbol term68 = {"#65", false, 68};
+Symbol term69 = {"#66", false, 69};
+Symbol term70 = {"#67", false, 70};
+Symbol term71 = {"#68", false, 71};
+Symbol term72 = {"#69", false, 72};
+Symbol term73 = {"#70", false, 73};
+Symbol term74 = {"#71", false, 74};
+Symbol term75 = {"#72", false, 75};
+Symbol term76 = {"#73", false, 76};
+Symbol term77 = {"#74", false, 77};
+Symbol term78 = {"#75", false, 78};
+Symbol term79 = {"#76", false, 79};
+Symbol term80 = {"#77", false, 80};
+Symbol term81 = {"#78", false, 81};
+Symbol term82 = {"#79", false, 82};
+Symbol term83 = {"#80", false, 83};
+Symbol term84 = {"#81", false, 84};
+Symbol term85 = {"#82", false, 85};
+Symbol term86 = {"#83", false, 86};
+Symbol term87 = {"#84", false, 87};
+Symbol term88 = {"#85", false, 88};
+Symbol term89 = {"#86", false, 89};
+Symbol term90 = {"#87", false, 90};
+Symbol term91 = {"#88", false, 91};
+Symbol term92 = {"#89", false, 92};
+Symbol term93 = {"#90", false, 93};
+Symbol term94 = {"#91", false, 94};
+Symbol term95 = {"#92", false, 95};
+Symbol term96 = {"#93", false, 96};
+Symbol term97 = {"#94", false, 97};
+Symbol term98 = {"#95", false, 98};
+Symbol term99 = {"#96", false, 99};
+Symbol term100 = {"#97", false, 100};
+Symbol term101 = {"#98", false, 101};
+Symbol term102 = {"#99", false, 102};
+Symbol term103 = {"#100", false, 103};
+Symbol term104 = {"#101", false, 104};
+Symbol term105 = {"#102", false, 105};
+Symbol term106 = {"#103", false, 106};
+Symbol term107 = {"#104", false, 107};
+Symbol term108 = {"#105", false, 108};
+Symbol term109 = {"#106", false, 109};
+Symbol term110 = {"#107", false, 110};
+Symbol term111 = {"#108", false, 111};
+Symbol term112 = {"#109", false, 112};
+Symbol term113 = {"#110", false, 113};
+Symbol term114 = {"#111", false, 114};
+Symbol term115 = {"#112", false, 115};
+Symbol term116 = {"#113", false, 116};
+Symbol term117 = {"#114", false, 117};
+Symbol term118 = {"#115", false, 118};
+Symbol term119 = {"#116", false, 119};
+Symbol term120 = {"#117", false, 120};
+Symbol term121 = {"#118", false, 121};
+Symbol term122 = {"#119", false, 122};
+Symbol term123 = {"#120", false, 123};
+Symbol term124 = {"#121", false, 124};
+Symbol term125 = {"#122", false, 125};
+Symbol term126 = {"#123", false, 126};
+Symbol term127 = {"#124", false, 127};
+Symbol term128 = {"#125", false, 128};
+Symbol term129 = {"#126", false, 129};
+Symbol term130 = {"#127", false, 130};
+Symbol term131 = {"(", false, 131};
+Symbol term132 = {")", false, 132};
+Symbol term133 = {"-", false, 133};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+extern Node node72;
+extern Node node73;
+extern Node node74;
+extern Node node75;
+extern Node node76;
+extern Node node77;
+extern Node node78;
+extern Node node79;
+extern Node node80;
+extern Node node81;
+extern Node node82;
+extern Node node83;
+extern Node node84;
+extern Node node85;
+extern Node node86;
+extern Node node87;
+extern Node node88;
+extern Node node89;
+extern Node node90;
+extern Node node91;
+extern Node node92;
+extern Node node93;
+extern Node node94;
+extern Node node95;
+extern Node node96;
+extern Node node97;
+extern Node node98;
+extern Node node99;
+extern Node node100;
+extern Node node101;
+extern Node node102;
+extern Node node103;
+extern Node node104;
+extern Node node105;
+extern Node node106;
+extern Node node107;
+extern Node node108;
+extern Node node109;
+extern Node node110;
+extern Node node111;
+extern Node node112;
+extern Node node113;
+extern Node node114;
+extern Node node115;
+extern Node node116;
+extern Node node117;
+extern Node node118;
+extern Node node119;
+extern Node node120;
+extern Node node121;
+extern Node node122;
+extern Node node123;
+extern Node node124;
+extern Node node125;
+extern Node node126;
+extern Node node127;
+extern Node node128;
+extern Node node129;
+extern Node node130;
+extern Node node131;
+extern Node node132;
+extern Node node133;
+extern Node node134;
+extern Node node135;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 6, 7, 7, 7, 7, 8, 9, 10, 10, 10, 11, 12, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 26 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node8; }
+    if (k == 14) { return &node9; }
+    if (k == 15) { return &node10; }
+    if (k == 16) { return &node11; }
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node98; }
+    if (k == 14) { return &node99; }
+    if (k == 15) { return &node100; }
+    if (k == 16) { return &node101; }
+    if (k == 17) { return &node102; }
+    if (k == 18) { return &node103; }
+    if (k == 19) { return &node104; }
+    if (k == 20) { return &node105; }
+    if (k == 21) { return &node106; }
+    if (k == 22) { return &node107; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node88; }
+    if (k == 14) { return &node89; }
+    if (k == 15) { return &node90; }
+    if (k == 16) { return &node91; }
+    if (k == 17) { return &node92; }
+    if (k == 18) { return &node93; }
+    if (k == 19) { return &node94; }
+    if (k == 20) { return &node95; }
+    if (k == 21) { return &node96; }
+    if (k == 22) { return &node97; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node78; }
+    if (k == 14) { return &node79; }
+    if (k == 15) { return &node80; }
+    if (k == 16) { return &node81; }
+    if (k == 17) { return &node82; }
+    if (k == 18) { return &node83; }
+    if (k == 19) { return &node84; }
+    if (k == 20) { return &node85; }
+    if (k == 21) { return &node86; }
+    if (k == 22) { return &node87; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node68; }
+    if (k == 14) { return &node69; }
+    if (k == 15) { return &node70; }
+    if (k == 16) { return &node71; }
+    if (k == 17) { return &node72; }
+    if (k == 18) { return &node73; }
+    if (k == 19) { return &node74; }
+    if (k == 20) { return &node75; }
+    if (k == 21) { return &node76; }
+    if (k == 22) { return &node77; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node58; }
+    if (k == 14) { return &node59; }
+    if (k == 15) { return &node60; }
+    if (k == 16) { return &node61; }
+    if (k == 17) { return &node62; }
+    if (k == 18) { return &node63; }
+    if (k == 19) { return &node64; }
+    if (k == 20) { return &node65; }
+    if (k == 21) { return &node66; }
+    if (k == 22) { return &node67; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node48; }
+    if (k == 14) { return &node49; }
+    if (k == 15) { return &node50; }
+    if (k == 16) { return &node51; }
+    if (k == 17) { return &node52; }
+    if (k == 18) { return &node53; }
+    if (k == 19) { return &node54; }
+    if (k == 20) { return &node55; }
+    if (k == 21) { return &node56; }
+    if (k == 22) { return &node57; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node38; }
+    if (k == 14) { return &node39; }
+    if (k == 15) { return &node40; }
+    if (k == 16) { return &node41; }
+    if (k == 17) { return &node42; }
+    if (k == 18) { return &node43; }
+    if (k == 19) { return &node44; }
+    if (k == 20) { return &node45; }
+    if (k == 21) { return &node46; }
+    if (k == 22) { return &node47; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node28; }
+    if (k == 14) { return &node29; }
+    if (k == 15) { return &node30; }
+    if (k == 16) { return &node31; }
+    if (k == 17) { return &node32; }
+    if (k == 18) { return &node33; }
+    if (k == 19) { return &node34; }
+    if (k == 20) { return &node35; }
+    if (k == 21) { return &node36; }
+    if (k == 22) { return &node37; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node18; }
+    if (k == 14) { return &node19; }
+    if (k == 15) { return &node20; }
+    if (k == 16) { return &node21; }
+    if (k == 17) { return &node22; }
+    if (k == 18) { return &node23; }
+    if (k == 19) { return &node24; }
+    if (k == 20) { return &node25; }
+    if (k == 21) { return &node26; }
+    if (k == 22) { return &node27; }
+    return nullptr;
+}
+
+Node*
+next98(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node126; }
+    if (k == 14) { return &node127; }
+    if (k == 15) { return &node128; }
+    if (k == 16) { return &node129; }
+    if (k == 17) { return &node130; }
+    if (k == 18) { return &node131; }
+    if (k == 19) { return &node132; }
+    if (k == 20) { return &node133; }
+    if (k == 21) { return &node134; }
+    if (k == 22) { return &node135; }
+    return nullptr;
+}
+
+Node*
+next99(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node116; }
+    if (k == 14) { return &node117; }
+    if (k == 15) { return &node118; }
+    if (k == 16) { return &node119; }
+    if (k == 17) { return &node120; }
+    if (k == 18) { return &node121; }
+    if (k == 19) { return &node122; }
+    if (k == 20) { return &node123; }
+    if (k == 21) { return &node124; }
+    if (k == 22) { return &node125; }
+    return nullptr;
+}
+
+Node*
+next100(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node108; }
+    if (k == 14) { return &node109; }
+    if (k == 15) { return &node110; }
+    if (k == 16) { return &node111; }
+    if (k == 17) { return &node112; }
+    if (k == 18) { return &node113; }
+    if (k == 19) { return &node114; }
+    if (k == 20) { return &node115; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, nullptr, nullptr};
+Node node3 = {nullptr, &term131, nullptr};
+Node node4 = {nullptr, &term132, nullptr};
+Node node5 = {nullptr, &term133, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term2, nullptr};
+Node node8 = {nullptr, &term3, nullptr};
+Node node9 = {&next9, &term4, nullptr};
+Node node10 = {&next10, &term5, nullptr};
+Node node11 = {&next11, &term6, nullptr};
+Node node12 = {&next12, &term7, nullptr};
+Node node13 = {&next13, &term8, nullptr};
+Node node14 = {&next14, &term9, nullptr};
+Node node15 = {&next15, &term10, nullptr};
+Node node16 = {&next16, &term11, nullptr};
+Node node17 = {&next17, &term12, nullptr};
+Node node18 = {nullptr, &term93, nullptr};
+Node node19 = {nullptr, &term94, nullptr};
+Node node20 = {nullptr, &term95, nullptr};
+Node node21 = {nullptr, &term96, nullptr};
+Node node22 = {nullptr, &term97, nullptr};
+Node node23 = {nullptr, &term98, nullptr};
+Node node24 = {nullptr, &term99, nullptr};
+Node node25 = {nullptr, &term100, nullptr};
+Node node26 = {nullptr, &term101, nullptr};
+Node node27 = {nullptr, &term102, nullptr};
+Node node28 = {nullptr, &term83, nullptr};
+Node node29 = {nullptr, &term84, nullptr};
+Node node30 = {nullptr, &term85, nullptr};
+Node node31 = {nullptr, &term86, nullptr};
+Node node32 = {nullptr, &term87, nullptr};
+Node node33 = {nullptr, &term88, nullptr};
+Node node34 = {nullptr, &term89, nullptr};
+Node node35 = {nullptr, &term90, nullptr};
+Node node36 = {nullptr, &term91, nullptr};
+Node node37 = {nullptr, &term92, nullptr};
+Node node38 = {nullptr, &term73, nullptr};
+Node node39 = {nullptr, &term74, nullptr};
+Node node40 = {nullptr, &term75, nullptr};
+Node node41 = {nullptr, &term76, nullptr};
+Node node42 = {nullptr, &term77, nullptr};
+Node node43 = {nullptr, &term78, nullptr};
+Node node44 = {nullptr, &term79, nullptr};
+Node node45 = {nullptr, &term80, nullptr};
+Node node46 = {nullptr, &term81, nullptr};
+Node node47 = {nullptr, &term82, nullptr};
+Node node48 = {nullptr, &term63, nullptr};
+Node node49 = {nullptr, &term64, nullptr};
+Node node50 = {nullptr, &term65, nullptr};
+Node node51 = {nullptr, &term66, nullptr};
+Node node52 = {nullptr, &term67, nullptr};
+Node node53 = {nullptr, &term68, nullptr};
+Node node54 = {nullptr, &term69, nullptr};
+Node node55 = {nullptr, &term70, nullptr};
+Node node56 = {nullptr, &term71, nullptr};
+Node node57 = {nullptr, &term72, nullptr};
+Node node58 = {nullptr, &term53, nullptr};
+Node node59 = {nullptr, &term54, nullptr};
+Node node60 = {nullptr, &term55, nullptr};
+Node node61 = {nullptr, &term56, nullptr};
+Node node62 = {nullptr, &term57, nullptr};
+Node node63 = {nullptr, &term58, nullptr};
+Node node64 = {nullptr, &term59, nullptr};
+Node node65 = {nullptr, &term60, nullptr};
+Node node66 = {nullptr, &term61, nullptr};
+Node node67 = {nullptr, &term62, nullptr};
+Node node68 = {nullptr, &term43, nullptr};
+Node node69 = {nullptr, &term44, nullptr};
+Node node70 = {nullptr, &term45, nullptr};
+Node node71 = {nullptr, &term46, nullptr};
+Node node72 = {nullptr, &term47, nullptr};
+Node node73 = {nullptr, &term48, nullptr};
+Node node74 = {nullptr, &term49, nullptr};
+Node node75 = {nullptr, &term50, nullptr};
+Node node76 = {nullptr, &term51, nullptr};
+Node node77 = {nullptr, &term52, nullptr};
+Node node78 = {nullptr, &term33, nullptr};
+Node node79 = {nullptr, &term34, nullptr};
+Node node80 = {nullptr, &term35, nullptr};
+Node node81 = {nullptr, &term36, nullptr};
+Node node82 = {nullptr, &term37, nullptr};
+Node node83 = {nullptr, &term38, nullptr};
+Node node84 = {nullptr, &term39, nullptr};
+Node node85 = {nullptr, &term40, nullptr};
+Node node86 = {nullptr, &term41, nullptr};
+Node node87 = {nullptr, &term42, nullptr};
+Node node88 = {nullptr, &term23, nullptr};
+Node node89 = {nullptr, &term24, nullptr};
+Node node90 = {nullptr, &term25, nullptr};
+Node node91 = {nullptr, &term26, nullptr};
+Node node92 = {nullptr, &term27, nullptr};
+Node node93 = {nullptr, &term28, nullptr};
+Node node94 = {nullptr, &term29, nullptr};
+Node node95 = {nullptr, &term30, nullptr};
+Node node96 = {nullptr, &term31, nullptr};
+Node node97 = {nullptr, &term32, nullptr};
+Node node98 = {&next98, &term13, nullptr};
+Node node99 = {&next99, &term14, nullptr};
+Node node100 = {&next100, &term15, nullptr};
+Node node101 = {nullptr, &term16, nullptr};
+Node node102 = {nullptr, &term17, nullptr};
+Node node103 = {nullptr, &term18, nullptr};
+Node node104 = {nullptr, &term19, nullptr};
+Node node105 = {nullptr, &term20, nullptr};
+Node node106 = {nullptr, &term21, nullptr};
+Node node107 = {nullptr, &term22, nullptr};
+Node node108 = {nullptr, &term123, nullptr};
+Node node109 = {nullptr, &term124, nullptr};
+Node node110 = {nullptr, &term125, nullptr};
+Node node111 = {nullptr, &term126, nullptr};
+Node node112 = {nullptr, &term127, nullptr};
+Node node113 = {nullptr, &term128, nullptr};
+Node node114 = {nullptr, &term129, nullptr};
+Node node115 = {nullptr, &term130, nullptr};
+Node node116 = {nullptr, &term113, nullptr};
+Node node117 = {nullptr, &term114, nullptr};
+Node node118 = {nullptr, &term115, nullptr};
+Node node119 = {nullptr, &term116, nullptr};
+Node node120 = {nullptr, &term117, nullptr};
+Node node121 = {nullptr, &term118, nullptr};
+Node node122 = {nullptr, &term119, nullptr};
+Node node123 = {nullptr, &term120, nullptr};
+Node node124 = {nullptr, &term121, nullptr};
+Node node125 = {nullptr, &term122, nullptr};
+Node node126 = {nullptr, &term103, nullptr};
+Node node127 = {nullptr, &term104, nullptr};
+Node node128 = {nullptr, &term105, nullptr};
+Node node129 = {nullptr, &term106, nullptr};
+Node node130 = {nullptr, &term107, nullptr};
+Node node131 = {nullptr, &term108, nullptr};
+Node node132 = {nullptr, &term109, nullptr};
+Node node133 = {nullptr, &term110, nullptr};
+Node node134 = {nullptr, &term111, nullptr};
+Node node135 = {nullptr, &term112, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 134};
+Symbol nonterm0 = {"expr", false, 0};
+Symbol nonterm1 = {"e0", false, 1};
+Symbol nonterm2 = {"e1", false, 2};
+Symbol nonterm3 = {"e2", false, 3};
+Symbol nonterm4 = {"e3", false, 4};
+Symbol nonterm5 = {"e4", false, 5};
+Symbol nonterm6 = {"e5", false, 6};
+Symbol nonterm7 = {"e6", false, 7};
+Symbol nonterm8 = {"e7", false, 8};
+Symbol nonterm9 = {"e8", false, 9};
+Symbol nonterm10 = {"e9", false, 10};
+Symbol nonterm11 = {"e10", false, 11};
+Symbol nonterm12 = {"e11", false, 12};
+Symbol nonterm13 = {"e12", false, 13};
+Symbol nonterm14 = {"e13", false, 14};
+Symbol nonterm15 = {"e14", false, 15};
+Symbol nonterm16 = {"e15", false, 16};
+Symbol nonterm17 = {"e16", false, 17};
+Symbol nonterm18 = {"e17", false, 18};
+Symbol nonterm19 = {"e18", false, 19};
+Symbol nonterm20 = {"e19", false, 20};
+Symbol nonterm21 = {"e20", false, 21};
+Symbol nonterm22 = {"e21", false, 22};
+Symbol nonterm23 = {"e22", false, 23};
+Symbol nonterm24 = {"e23", false, 24};
+Symbol nonterm25 = {"e24", false, 25};
+Symbol nonterm26 = {"e25", false, 26};
+Symbol nonterm27 = {"e26", false, 27};
+Symbol nonterm28 = {"e27", false, 28};
+Symbol nonterm29 = {"e28", false, 29};
+Symbol nonterm30 = {"e29", false, 30};
+Symbol nonterm31 = {"e30", false, 31};
+Symbol nonterm32 = {"e31", false, 32};
+Symbol nonterm33 = {"e32", false, 33};
+Symbol nonterm34 = {"e33", false, 34};
+Symbol nonterm35 = {"e34", false, 35};
+Symbol nonterm36 = {"e35", false, 36};
+Symbol nonterm37 = {"e36", false, 37};
+Symbol nonterm38 = {"e37", false, 38};
+Symbol nonterm39 = {"e38", false, 39};
+Symbol nonterm40 = {"e39", false, 40};
+Symbol nonterm41 = {"e40", false, 41};
+Symbol nonterm42 = {"e41", false, 42};
+Symbol nonterm43 = {"e42", false, 43};
+Symbol nonterm44 = {"e43", false, 44};
+Symbol nonterm45 = {"e44", false, 45};
+Symbol nonterm46 = {"e45", false, 46};
+Symbol nonterm47 = {"e46", false, 47};
+Symbol nonterm48 = {"e47", false, 48};
+Symbol nonterm49 = {"e48", false, 49};
+Symbol nonterm50 = {"e49", false, 50};
+Symbol nonterm51 = {"e50", false, 51};
+Symbol nonterm52 = {"e51", false, 52};
+Symbol nonterm53 = {"e52", false, 53};
+Symbol nonterm54 = {"e53", false, 54};
+Symbol nonterm55 = {"e54", false, 55};
+Symbol nonterm56 = {"e55", false, 56};
+Symbol nonterm57 = {"e56", false, 57};
+Symbol nonterm58 = {"e57", false, 58};
+Symbol nonterm59 = {"e58", false, 59};
+Symbol nonterm60 = {"e59", false, 60};
+Symbol nonterm61 = {"e60", false, 61};
+Symbol nonterm62 = {"e61", false, 62};
+Symbol nonterm63 = {"e62", false, 63};
+Symbol nonterm64 = {"e63", false, 64};
+Symbol nonterm65 = {"e64", false, 65};
+Symbol nonterm66 = {"e65", false, 66};
+Symbol nonterm67 = {"e66", false, 67};
+Symbol nonterm68 = {"e67", false, 68};
+Symbol nonterm69 = {"e68", false, 69};
+Symbol nonterm70 = {"e69", false, 70};
+Symbol nonterm71 = {"e70", false, 71};
+Symbol nonterm72 = {"e71", false, 72};
+Symbol nonterm73 = {"e72", false, 73};
+Symbol nonterm74 = {"e73", false, 74};
+Symbol nonterm75 = {"e74", false, 75};
+Symbol nonterm76 = {"e75", false, 76};
+Symbol nonterm77 = {"e76", false, 77};
+Symbol nonterm78 = {"e77", false, 78};
+Symbol nonterm79 = {"e78", false, 79};
+Symbol nonterm80 = {"e79", false, 80};
+Symbol nonterm81 = {"e80", false, 81};
+Symbol nonterm82 = {"e81", false, 82};
+Symbol nonterm83 = {"e82", false, 83};
+Symbol nonterm84 = {"e83", false, 84};
+Symbol nonterm85 = {"e84", false, 85};
+Symbol nonterm86 = {"e85", false, 86};
+Symbol nonterm87 = {"e86", false, 87};
+Symbol nonterm88 = {"e87", false, 88};
+Symbol nonterm89 = {"e88", false, 89};
+Symbol nonterm90 = {"e89", false, 90};
+Symbol nonterm91 = {"e90", false, 91};
+Symbol nonterm92 = {"e91", false, 92};
+Symbol nonterm93 = {"e92", false, 93};
+Symbol nonterm94 = {"e93", false, 94};
+Symbol nonterm95 = {"e94", false, 95};
+Symbol nonterm96 = {"e95", false, 96};
+Symbol nonterm97 = {"e96", false, 97};
+Symbol nonterm98 = {"e97", false, 98};
+Symbol nonterm99 = {"e98", false, 99};
+Symbol nonterm100 = {"e99", false, 100};
+Symbol nonterm101 = {"e100", false, 101};
+Symbol nonterm102 = {"e101", false, 102};
+Symbol nonterm103 = {"e102", false, 103};
+Symbol nonterm104 = {"e103", false, 104};
+Symbol nonterm105 = {"e104", false, 105};
+Symbol nonterm106 = {"e105", false, 106};
+Symbol nonterm107 = {"e106", false, 107};
+Symbol nonterm108 = {"e107", false, 108};
+Symbol nonterm109 = {"e108", false, 109};
+Symbol nonterm110 = {"e109", false, 110};
+Symbol nonterm111 = {"e110", false, 111};
+Symbol nonterm112 = {"e111", false, 112};
+Symbol nonterm113 = {"e112", false, 113};
+Symbol nonterm114 = {"e113", false, 114};
+Symbol nonterm115 = {"e114", false, 115};
+Symbol nonterm116 = {"e115", false, 116};
+Symbol nonterm117 = {"e116", false, 117};
+Symbol nonterm118 = {"e117", false, 118};
+Symbol nonterm119 = {"e118", false, 119};
+Symbol nonterm120 = {"e119", false, 120};
+Symbol nonterm121 = {"e120", false, 121};
+Symbol nonterm122 = {"e121", false, 122};
+Symbol nonterm123 = {"e122", false, 123};
+Symbol nonterm124 = {"e123", false, 124};
+Symbol nonterm125 = {"e124", false, 125};
+Symbol nonterm126 = {"e125", false, 126};
+Symbol nonterm127 = {"e126", false, 127};
+Symbol nonterm128 = {"e127", false, 128};
+Symbol nonterm129 = {"e128", false, 129};
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e32_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e32_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e33_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e33_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e33_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e33_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e33_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e33_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e34_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e34_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e34_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e34_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e34_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e34_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e35_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e35_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e35_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e35_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e35_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e35_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e36_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e36_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e36_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e36_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e36_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e36_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e37_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e37_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e37_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e37_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e37_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e37_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e38_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e38_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e38_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e38_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e38_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e38_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e39_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e39_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e39_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e39_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e39_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e39_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e40_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e40_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e40_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e40_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e40_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e40_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e41_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e41_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e41_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e41_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e41_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e41_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e42_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e42_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e42_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e42_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e42_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e42_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e43_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e43_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e43_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e43_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e43_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e43_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e44_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e44_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e44_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e44_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e44_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e44_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e45_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e45_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e45_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e45_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e45_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e45_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e46_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e46_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e46_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e46_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e46_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e46_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e47_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e47_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e47_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e47_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e47_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e47_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e48_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e48_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e48_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e48_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e48_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e48_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e49_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e49_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e49_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e49_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e49_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e49_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e50_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e50_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e50_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e50_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e50_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e50_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e51_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e51_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e51_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e51_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e51_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e51_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e52_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e52_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e52_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e52_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e52_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e52_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e53_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e53_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e53_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e53_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e53_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e53_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e54_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e54_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e54_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e54_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e54_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e54_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e55_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e55_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e55_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e55_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e55_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e55_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e56_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e56_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e56_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e56_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e56_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e56_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e57_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e57_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e57_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e57_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e57_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e57_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e58_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e58_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e58_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e58_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e58_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e58_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e59_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e59_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e59_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e59_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e59_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e59_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e60_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e60_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e60_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e60_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e60_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e60_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e61_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e61_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e61_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e61_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e61_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e61_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e62_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e62_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e62_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e62_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e62_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e62_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e63_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e63_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e63_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e63_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e63_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e63_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e64_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e64_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e64_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e64_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e65_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e65_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e65_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e65_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e65_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e65_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e66_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e66_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e66_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e66_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e66_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e66_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e67_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e67_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e67_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e67_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e67_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e67_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e68_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e68_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e68_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e68_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e68_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e68_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e69_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e69_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e69_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e69_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e69_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e69_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e70_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e70_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e70_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e70_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e70_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e70_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e71_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e71_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e71_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e71_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e71_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e71_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e72_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e72_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e72_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e72_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e72_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e72_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e73_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e73_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e73_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e73_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e73_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e73_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e74_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e74_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e74_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e74_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e74_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e74_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e75_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e75_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e75_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e75_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e75_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e75_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e76_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e76_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e76_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e76_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e76_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e76_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e77_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e77_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e77_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e77_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e77_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e77_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e78_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e78_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e78_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e78_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e78_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e78_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e79_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e79_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e79_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e79_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e79_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e79_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e80_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e80_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e80_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e80_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e80_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e80_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e81_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e81_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e81_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e81_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e81_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e81_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e82_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e82_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e82_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e82_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e82_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e82_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e83_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e83_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e83_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e83_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e83_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e83_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e84_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e84_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e84_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e84_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e84_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e84_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e85_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e85_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e85_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e85_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e85_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e85_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e86_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e86_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e86_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e86_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e86_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e86_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e87_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e87_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e87_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e87_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e87_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e87_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e88_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e88_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e88_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e88_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e88_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e88_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e89_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e89_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e89_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e89_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e89_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e89_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e90_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e90_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e90_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e90_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e90_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e90_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e91_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e91_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e91_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e91_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e91_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e91_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e92_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e92_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e92_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e92_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e92_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e92_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e93_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e93_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e93_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e93_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e93_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e93_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e94_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e94_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e94_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e94_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e94_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e94_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e95_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e95_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e95_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e95_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e95_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e95_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e96_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e96_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e96_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e96_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e96_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e96_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e97_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e97_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e97_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e97_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e97_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e97_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e98_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e98_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e98_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e98_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e98_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e98_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e99_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e99_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e99_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e99_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e99_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e99_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e100_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e100_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e100_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e100_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e100_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e100_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e101_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e101_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e101_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e101_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e101_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e101_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e102_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e102_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e102_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e102_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e102_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e102_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e103_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e103_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e103_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e103_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e103_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e103_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e104_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e104_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e104_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e104_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e104_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e104_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e105_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e105_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e105_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e105_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e105_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e105_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e106_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e106_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e106_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e106_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e106_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e106_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e107_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e107_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e107_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e107_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e107_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e107_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e108_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e108_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e108_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e108_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e108_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e108_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e109_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e109_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e109_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e109_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e109_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e109_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e110_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e110_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e110_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e110_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e110_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e110_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e111_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e111_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e111_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e111_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e111_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e111_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e112_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e112_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e112_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e112_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e112_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e112_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e113_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e113_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e113_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e113_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e113_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e113_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e114_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e114_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e114_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e114_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e114_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e114_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e115_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e115_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e115_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e115_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e115_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e115_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e116_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e116_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e116_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e116_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e116_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e116_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e117_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e117_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e117_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e117_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e117_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e117_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e118_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e118_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e118_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e118_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e118_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e118_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e119_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e119_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e119_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e119_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e119_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e119_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e120_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e120_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e120_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e120_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e120_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e120_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e121_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e121_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e121_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e121_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e121_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e121_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e122_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e122_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e122_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e122_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e122_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e122_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e123_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e123_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e123_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e123_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e123_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e123_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e124_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e124_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e124_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e124_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e124_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e124_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e125_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e125_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e125_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e125_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e125_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e125_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e126_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e126_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e126_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e126_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e126_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e126_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e127_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e127_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e127_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e127_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e127_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e127_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e128_0(Table*);
+
+Value*
+reduce_e128_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e128_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e128_1(Table*);
+
+Value*
+reduce_e128_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e128_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e128_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e128_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_e128_2(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e128_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e128_3(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e128_3(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_expr_0, -1};
+Rule rule1 = {&nonterm1, 1, &reduce_e0_0, -1};
+Rule rule2 = {&nonterm1, 3, &reduce_e0_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_e1_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_e1_1, -1};
+Rule rule5 = {&nonterm3, 1, &reduce_e2_0, -1};
+Rule rule6 = {&nonterm3, 3, &reduce_e2_1, -1};
+Rule rule7 = {&nonterm4, 1, &reduce_e3_0, -1};
+Rule rule8 = {&nonterm4, 3, &reduce_e3_1, -1};
+Rule rule9 = {&nonterm5, 1, &reduce_e4_0, -1};
+Rule rule10 = {&nonterm5, 3, &reduce_e4_1, -1};
+Rule rule11 = {&nonterm6, 1, &reduce_e5_0, -1};
+Rule rule12 = {&nonterm6, 3, &reduce_e5_1, -1};
+Rule rule13 = {&nonterm7, 1, &reduce_e6_0, -1};
+Rule rule14 = {&nonterm7, 3, &reduce_e6_1, -1};
+Rule rule15 = {&nonterm8, 1, &reduce_e7_0, -1};
+Rule rule16 = {&nonterm8, 3, &reduce_e7_1, -1};
+Rule rule17 = {&nonterm9, 1, &reduce_e8_0, -1};
+Rule rule18 = {&nonterm9, 3, &reduce_e8_1, -1};
+Rule rule19 = {&nonterm10, 1, &reduce_e9_0, -1};
+Rule rule20 = {&nonterm10, 3, &reduce_e9_1, -1};
+Rule rule21 = {&nonterm11, 1, &reduce_e10_0, -1};
+Rule rule22 = {&nonterm11, 3, &reduce_e10_1, -1};
+Rule rule23 = {&nonterm12, 1, &reduce_e11_0, -1};
+Rule rule24 = {&nonterm12, 3, &reduce_e11_1, -1};
+Rule rule25 = {&nonterm13, 1, &reduce_e12_0, -1};
+Rule rule26 = {&nonterm13, 3, &reduce_e12_1, -1};
+Rule rule27 = {&nonterm14, 1, &reduce_e13_0, -1};
+Rule rule28 = {&nonterm14, 3, &reduce_e13_1, -1};
+Rule rule29 = {&nonterm15, 1, &reduce_e14_0, -1};
+Rule rule30 = {&nonterm15, 3, &reduce_e14_1, -1};
+Rule rule31 = {&nonterm16, 1, &reduce_e15_0, -1};
+Rule rule32 = {&nonterm16, 3, &reduce_e15_1, -1};
+Rule rule33 = {&nonterm17, 1, &reduce_e16_0, -1};
+Rule rule34 = {&nonterm17, 3, &reduce_e16_1, -1};
+Rule rule35 = {&nonterm18, 1, &reduce_e17_0, -1};
+Rule rule36 = {&nonterm18, 3, &reduce_e17_1, -1};
+Rule rule37 = {&nonterm19, 1, &reduce_e18_0, -1};
+Rule rule38 = {&nonterm19, 3, &reduce_e18_1, -1};
+Rule rule39 = {&nonterm20, 1, &reduce_e19_0, -1};
+Rule rule40 = {&nonterm20, 3, &reduce_e19_1, -1};
+Rule rule41 = {&nonterm21, 1, &reduce_e20_0, -1};
+Rule rule42 = {&nonterm21, 3, &reduce_e20_1, -1};
+Rule rule43 = {&nonterm22, 1, &reduce_e21_0, -1};
+Rule rule44 = {&nonterm22, 3, &reduce_e21_1, -1};
+Rule rule45 = {&nonterm23, 1, &reduce_e22_0, -1};
+Rule rule46 = {&nonterm23, 3, &reduce_e22_1, -1};
+Rule rule47 = {&nonterm24, 1, &reduce_e23_0, -1};
+Rule rule48 = {&nonterm24, 3, &reduce_e23_1, -1};
+Rule rule49 = {&nonterm25, 1, &reduce_e24_0, -1};
+Rule rule50 = {&nonterm25, 3, &reduce_e24_1, -1};
+Rule rule51 = {&nonterm26, 1, &reduce_e25_0, -1};
+Rule rule52 = {&nonterm26, 3, &reduce_e25_1, -1};
+Rule rule53 = {&nonterm27, 1, &reduce_e26_0, -1};
+Rule rule54 = {&nonterm27, 3, &reduce_e26_1, -1};
+Rule rule55 = {&nonterm28, 1, &reduce_e27_0, -1};
+Rule rule56 = {&nonterm28, 3, &reduce_e27_1, -1};
+Rule rule57 = {&nonterm29, 1, &reduce_e28_0, -1};
+Rule rule58 = {&nonterm29, 3, &reduce_e28_1, -1};
+Rule rule59 = {&nonterm30, 1, &reduce_e29_0, -1};
+Rule rule60 = {&nonterm30, 3, &reduce_e29_1, -1};
+Rule rule61 = {&nonterm31, 1, &reduce_e30_0, -1};
+Rule rule62 = {&nonterm31, 3, &reduce_e30_1, -1};
+Rule rule63 = {&nonterm32, 1, &reduce_e31_0, -1};
+Rule rule64 = {&nonterm32, 3, &reduce_e31_1, -1};
+Rule rule65 = {&nonterm33, 1, &reduce_e32_0, -1};
+Rule rule66 = {&nonterm33, 3, &reduce_e32_1, -1};
+Rule rule67 = {&nonterm34, 1, &reduce_e33_0, -1};
+Rule rule68 = {&nonterm34, 3, &reduce_e33_1, -1};
+Rule rule69 = {&nonterm35, 1, &reduce_e34_0, -1};
+Rule rule70 = {&nonterm35, 3, &reduce_e34_1, -1};
+Rule rule71 = {&nonterm36, 1, &reduce_e35_0, -1};
+Rule rule72 = {&nonterm36, 3, &reduce_e35_1, -1};
+Rule rule73 = {&nonterm37, 1, &reduce_e36_0, -1};
+Rule rule74 = {&nonterm37, 3, &reduce_e36_1, -1};
+Rule rule75 = {&nonterm38, 1, &reduce_e37_0, -1};
+Rule rule76 = {&nonterm38, 3, &reduce_e37_1, -1};
+Rule rule77 = {&nonterm39, 1, &reduce_e38_0, -1};
+Rule rule78 = {&nonterm39, 3, &reduce_e38_1, -1};
+Rule rule79 = {&nonterm40, 1, &reduce_e39_0, -1};
+Rule rule80 = {&nonterm40, 3, &reduce_e39_1, -1};
+Rule rule81 = {&nonterm41, 1, &reduce_e40_0, -1};
+Rule rule82 = {&nonterm41, 3, &reduce_e40_1, -1};
+Rule rule83 = {&nonterm42, 1, &reduce_e41_0, -1};
+Rule rule84 = {&nonterm42, 3, &reduce_e41_1, -1};
+Rule rule85 = {&nonterm43, 1, &reduce_e42_0, -1};
+Rule rule86 = {&nonterm43, 3, &reduce_e42_1, -1};
+Rule rule87 = {&nonterm44, 1, &reduce_e43_0, -1};
+Rule rule88 = {&nonterm44, 3, &reduce_e43_1, -1};
+Rule rule89 = {&nonterm45, 1, &reduce_e44_0, -1};
+Rule rule90 = {&nonterm45, 3, &reduce_e44_1, -1};
+Rule rule91 = {&nonterm46, 1, &reduce_e45_0, -1};
+Rule rule92 = {&nonterm46, 3, &reduce_e45_1, -1};
+Rule rule93 = {&nonterm47, 1, &reduce_e46_0, -1};
+Rule rule94 = {&nonterm47, 3, &reduce_e46_1, -1};
+Rule rule95 = {&nonterm48, 1, &reduce_e47_0, -1};
+Rule rule96 = {&nonterm48, 3, &reduce_e47_1, -1};
+Rule rule97 = {&nonterm49, 1, &reduce_e48_0, -1};
+Rule rule98 = {&nonterm49, 3, &reduce_e48_1, -1};
+Rule rule99 = {&nonterm50, 1, &reduce_e49_0, -1};
+Rule rule100 = {&nonterm50, 3, &reduce_e49_1, -1};
+Rule rule101 = {&nonterm51, 1, &reduce_e50_0, -1};
+Rule rule102 = {&nonterm51, 3, &reduce_e50_1, -1};
+Rule rule103 = {&nonterm52, 1, &reduce_e51_0, -1};
+Rule rule104 = {&nonterm52, 3, &reduce_e51_1, -1};
+Rule rule105 = {&nonterm53, 1, &reduce_e52_0, -1};
+Rule rule106 = {&nonterm53, 3, &reduce_e52_1, -1};
+Rule rule107 = {&nonterm54, 1, &reduce_e53_0, -1};
+Rule rule108 = {&nonterm54, 3, &reduce_e53_1, -1};
+Rule rule109 = {&nonterm55, 1, &reduce_e54_0, -1};
+Rule rule110 = {&nonterm55, 3, &reduce_e54_1, -1};
+Rule rule111 = {&nonterm56, 1, &reduce_e55_0, -1};
+Rule rule112 = {&nonterm56, 3, &reduce_e55_1, -1};
+Rule rule113 = {&nonterm57, 1, &reduce_e56_0, -1};
+Rule rule114 = {&nonterm57, 3, &reduce_e56_1, -1};
+Rule rule115 = {&nonterm58, 1, &reduce_e57_0, -1};
+Rule rule116 = {&nonterm58, 3, &reduce_e57_1, -1};
+Rule rule117 = {&nonterm59, 1, &reduce_e58_0, -1};
+Rule rule118 = {&nonterm59, 3, &reduce_e58_1, -1};
+Rule rule119 = {&nonterm60, 1, &reduce_e59_0, -1};
+Rule rule120 = {&nonterm60, 3, &reduce_e59_1, -1};
+Rule rule121 = {&nonterm61, 1, &reduce_e60_0, -1};
+Rule rule122 = {&nonterm61, 3, &reduce_e60_1, -1};
+Rule rule123 = {&nonterm62, 1, &reduce_e61_0, -1};
+Rule rule124 = {&nonterm62, 3, &reduce_e61_1, -1};
+Rule rule125 = {&nonterm63, 1, &reduce_e62_0, -1};
+Rule rule126 = {&nonterm63, 3, &reduce_e62_1, -1};
+Rule rule127 = {&nonterm64, 1, &reduce_e63_0, -1};
+Rule rule128 = {&nonterm64, 3, &reduce_e63_1, -1};
+Rule rule129 = {&nonterm65, 1, &reduce_e64_0, -1};
+Rule rule130 = {&nonterm65, 3, &reduce_e64_1, -1};
+Rule rule131 = {&nonterm66, 1, &reduce_e65_0, -1};
+Rule rule132 = {&nonterm66, 3, &reduce_e65_1, -1};
+Rule rule133 = {&nonterm67, 1, &reduce_e66_0, -1};
+Rule rule134 = {&nonterm67, 3, &reduce_e66_1, -1};
+Rule rule135 = {&nonterm68, 1, &reduce_e67_0, -1};
+Rule rule136 = {&nonterm68, 3, &reduce_e67_1, -1};
+Rule rule137 = {&nonterm69, 1, &reduce_e68_0, -1};
+Rule rule138 = {&nonterm69, 3, &reduce_e68_1, -1};
+Rule rule139 = {&nonterm70, 1, &reduce_e69_0, -1};
+Rule rule140 = {&nonterm70, 3, &reduce_e69_1, -1};
+Rule rule141 = {&nonterm71, 1, &reduce_e70_0, -1};
+Rule rule142 = {&nonterm71, 3, &reduce_e70_1, -1};
+Rule rule143 = {&nonterm72, 1, &reduce_e71_0, -1};
+Rule rule144 = {&nonterm72, 3, &reduce_e71_1, -1};
+Rule rule145 = {&nonterm73, 1, &reduce_e72_0, -1};
+Rule rule146 = {&nonterm73, 3, &reduce_e72_1, -1};
+Rule rule147 = {&nonterm74, 1, &reduce_e73_0, -1};
+Rule rule148 = {&nonterm74, 3, &reduce_e73_1, -1};
+Rule rule149 = {&nonterm75, 1, &reduce_e74_0, -1};
+Rule rule150 = {&nonterm75, 3, &reduce_e74_1, -1};
+Rule rule151 = {&nonterm76, 1, &reduce_e75_0, -1};
+Rule rule152 = {&nonterm76, 3, &reduce_e75_1, -1};
+Rule rule153 = {&nonterm77, 1, &reduce_e76_0, -1};
+Rule rule154 = {&nonterm77, 3, &reduce_e76_1, -1};
+Rule rule155 = {&nonterm78, 1, &reduce_e77_0, -1};
+Rule rule156 = {&nonterm78, 3, &reduce_e77_1, -1};
+Rule rule157 = {&nonterm79, 1, &reduce_e78_0, -1};
+Rule rule158 = {&nonterm79, 3, &reduce_e78_1, -1};
+Rule rule159 = {&nonterm80, 1, &reduce_e79_0, -1};
+Rule rule160 = {&nonterm80, 3, &reduce_e79_1, -1};
+Rule rule161 = {&nonterm81, 1, &reduce_e80_0, -1};
+Rule rule162 = {&nonterm81, 3, &reduce_e80_1, -1};
+Rule rule163 = {&nonterm82, 1, &reduce_e81_0, -1};
+Rule rule164 = {&nonterm82, 3, &reduce_e81_1, -1};
+Rule rule165 = {&nonterm83, 1, &reduce_e82_0, -1};
+Rule rule166 = {&nonterm83, 3, &reduce_e82_1, -1};
+Rule rule167 = {&nonterm84, 1, &reduce_e83_0, -1};
+Rule rule168 = {&nonterm84, 3, &reduce_e83_1, -1};
+Rule rule169 = {&nonterm85, 1, &reduce_e84_0, -1};
+Rule rule170 = {&nonterm85, 3, &reduce_e84_1, -1};
+Rule rule171 = {&nonterm86, 1, &reduce_e85_0, -1};
+Rule rule172 = {&nonterm86, 3, &reduce_e85_1, -1};
+Rule rule173 = {&nonterm87, 1, &reduce_e86_0, -1};
+Rule rule174 = {&nonterm87, 3, &reduce_e86_1, -1};
+Rule rule175 = {&nonterm88, 1, &reduce_e87_0, -1};
+Rule rule176 = {&nonterm88, 3, &reduce_e87_1, -1};
+Rule rule177 = {&nonterm89, 1, &reduce_e88_0, -1};
+Rule rule178 = {&nonterm89, 3, &reduce_e88_1, -1};
+Rule rule179 = {&nonterm90, 1, &reduce_e89_0, -1};
+Rule rule180 = {&nonterm90, 3, &reduce_e89_1, -1};
+Rule rule181 = {&nonterm91, 1, &reduce_e90_0, -1};
+Rule rule182 = {&nonterm91, 3, &reduce_e90_1, -1};
+Rule rule183 = {&nonterm92, 1, &reduce_e91_0, -1};
+Rule rule184 = {&nonterm92, 3, &reduce_e91_1, -1};
+Rule rule185 = {&nonterm93, 1, &reduce_e92_0, -1};
+Rule rule186 = {&nonterm93, 3, &reduce_e92_1, -1};
+Rule rule187 = {&nonterm94, 1, &reduce_e93_0, -1};
+Rule rule188 = {&nonterm94, 3, &reduce_e93_1, -1};
+Rule rule189 = {&nonterm95, 1, &reduce_e94_0, -1};
+Rule rule190 = {&nonterm95, 3, &reduce_e94_1, -1};
+Rule rule191 = {&nonterm96, 1, &reduce_e95_0, -1};
+Rule rule192 = {&nonterm96, 3, &reduce_e95_1, -1};
+Rule rule193 = {&nonterm97, 1, &reduce_e96_0, -1};
+Rule rule194 = {&nonterm97, 3, &reduce_e96_1, -1};
+Rule rule195 = {&nonterm98, 1, &reduce_e97_0, -1};
+Rule rule196 = {&nonterm98, 3, &reduce_e97_1, -1};
+Rule rule197 = {&nonterm99, 1, &reduce_e98_0, -1};
+Rule rule198 = {&nonterm99, 3, &reduce_e98_1, -1};
+Rule rule199 = {&nonterm100, 1, &reduce_e99_0, -1};
+Rule rule200 = {&nonterm100, 3, &reduce_e99_1, -1};
+Rule rule201 = {&nonterm101, 1, &reduce_e100_0, -1};
+Rule rule202 = {&nonterm101, 3, &reduce_e100_1, -1};
+Rule rule203 = {&nonterm102, 1, &reduce_e101_0, -1};
+Rule rule204 = {&nonterm102, 3, &reduce_e101_1, -1};
+Rule rule205 = {&nonterm103, 1, &reduce_e102_0, -1};
+Rule rule206 = {&nonterm103, 3, &reduce_e102_1, -1};
+Rule rule207 = {&nonterm104, 1, &reduce_e103_0, -1};
+Rule rule208 = {&nonterm104, 3, &reduce_e103_1, -1};
+Rule rule209 = {&nonterm105, 1, &reduce_e104_0, -1};
+Rule rule210 = {&nonterm105, 3, &reduce_e104_1, -1};
+Rule rule211 = {&nonterm106, 1, &reduce_e105_0, -1};
+Rule rule212 = {&nonterm106, 3, &reduce_e105_1, -1};
+Rule rule213 = {&nonterm107, 1, &reduce_e106_0, -1};
+Rule rule214 = {&nonterm107, 3, &reduce_e106_1, -1};
+Rule rule215 = {&nonterm108, 1, &reduce_e107_0, -1};
+Rule rule216 = {&nonterm108, 3, &reduce_e107_1, -1};
+Rule rule217 = {&nonterm109, 1, &reduce_e108_0, -1};
+Rule rule218 = {&nonterm109, 3, &reduce_e108_1, -1};
+Rule rule219 = {&nonterm110, 1, &reduce_e109_0, -1};
+Rule rule220 = {&nonterm110, 3, &reduce_e109_1, -1};
+Rule rule221 = {&nonterm111, 1, &reduce_e110_0, -1};
+Rule rule222 = {&nonterm111, 3, &reduce_e110_1, -1};
+Rule rule223 = {&nonterm112, 1, &reduce_e111_0, -1};
+Rule rule224 = {&nonterm112, 3, &reduce_e111_1, -1};
+Rule rule225 = {&nonterm113, 1, &reduce_e112_0, -1};
+Rule rule226 = {&nonterm113, 3, &reduce_e112_1, -1};
+Rule rule227 = {&nonterm114, 1, &reduce_e113_0, -1};
+Rule rule228 = {&nonterm114, 3, &reduce_e113_1, -1};
+Rule rule229 = {&nonterm115, 1, &reduce_e114_0, -1};
+Rule rule230 = {&nonterm115, 3, &reduce_e114_1, -1};
+Rule rule231 = {&nonterm116, 1, &reduce_e115_0, -1};
+Rule rule232 = {&nonterm116, 3, &reduce_e115_1, -1};
+Rule rule233 = {&nonterm117, 1, &reduce_e116_0, -1};
+Rule rule234 = {&nonterm117, 3, &reduce_e116_1, -1};
+Rule rule235 = {&nonterm118, 1, &reduce_e117_0, -1};
+Rule rule236 = {&nonterm118, 3, &reduce_e117_1, -1};
+Rule rule237 = {&nonterm119, 1, &reduce_e118_0, -1};
+Rule rule238 = {&nonterm119, 3, &reduce_e118_1, -1};
+Rule rule239 = {&nonterm120, 1, &reduce_e119_0, -1};
+Rule rule240 = {&nonterm120, 3, &reduce_e119_1, -1};
+Rule rule241 = {&nonterm121, 1, &reduce_e120_0, -1};
+Rule rule242 = {&nonterm121, 3, &reduce_e120_1, -1};
+Rule rule243 = {&nonterm122, 1, &reduce_e121_0, -1};
+Rule rule244 = {&nonterm122, 3, &reduce_e121_1, -1};
+Rule rule245 = {&nonterm123, 1, &reduce_e122_0, -1};
+Rule rule246 = {&nonterm123, 3, &reduce_e122_1, -1};
+Rule rule247 = {&nonterm124, 1, &reduce_e123_0, -1};
+Rule rule248 = {&nonterm124, 3, &reduce_e123_1, -1};
+Rule rule249 = {&nonterm125, 1, &reduce_e124_0, -1};
+Rule rule250 = {&nonterm125, 3, &reduce_e124_1, -1};
+Rule rule251 = {&nonterm126, 1, &reduce_e125_0, -1};
+Rule rule252 = {&nonterm126, 3, &reduce_e125_1, -1};
+Rule rule253 = {&nonterm127, 1, &reduce_e126_0, -1};
+Rule rule254 = {&nonterm127, 3, &reduce_e126_1, -1};
+Rule rule255 = {&nonterm128, 1, &reduce_e127_0, -1};
+Rule rule256 = {&nonterm128, 3, &reduce_e127_1, -1};
+Rule rule257 = {&nonterm129, 1, &reduce_e128_0, -1};
+Rule rule258 = {&nonterm129, 1, &reduce_e128_1, -1};
+Rule rule259 = {&nonterm129, 3, &reduce_e128_2, -1};
+Rule rule260 = {&nonterm129, 2, &reduce_e128_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+
+std::vector<Shift> shift0 = {{&term0, &state1}, {&term2, &state2}, {&term131, &state3}, {&term133, &state4}};
+std::vector<Reduce> reduce0 = {};
+std::vector<Shift> shift1 = {};
+std::vector<Reduce> reduce1 = {{nullptr, &rule257, false}};
+std::vector<Shift> shift2 = {};
+std::vector<Reduce> reduce2 = {{nullptr, &rule258, false}};
+std::vector<Shift> shift3 = {{&term0, &state391}, {&term2, &state392}, {&term131, &state393}, {&term133, &state394}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift5 = {{&term3, &state388}};
+std::vector<Reduce> reduce5 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift6 = {{&term4, &state386}};
+std::vector<Reduce> reduce6 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift7 = {{&term5, &state384}};
+std::vector<Reduce> reduce7 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift8 = {{&term6, &state382}};
+std::vector<Reduce> reduce8 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift9 = {{&term7, &state380}};
+std::vector<Reduce> reduce9 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift10 = {{&term8, &state378}};
+std::vector<Reduce> reduce10 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift11 = {{&term9, &state376}};
+std::vector<Reduce> reduce11 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift12 = {{&term10, &state374}};
+std::vector<Reduce> reduce12 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift13 = {{&term11, &state372}};
+std::vector<Reduce> reduce13 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift14 = {{&term12, &state370}};
+std::vector<Reduce> reduce14 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift15 = {{&term13, &state368}};
+std::vector<Reduce> reduce15 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift16 = {{&term14, &state366}};
+std::vector<Reduce> reduce16 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift17 = {{&term15, &state364}};
+std::vector<Reduce> reduce17 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift18 = {{&term16, &state362}};
+std::vector<Reduce> reduce18 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift19 = {{&term17, &state360}};
+std::vector<Reduce> reduce19 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift20 = {{&term18, &state358}};
+std::vector<Reduce> reduce20 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift21 = {{&term19, &state356}};
+std::vector<Reduce> reduce21 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift22 = {{&term20, &state354}};
+std::vector<Reduce> reduce22 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift23 = {{&term21, &state352}};
+std::vector<Reduce> reduce23 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift24 = {{&term22, &state350}};
+std::vector<Reduce> reduce24 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift25 = {{&term23, &state348}};
+std::vector<Reduce> reduce25 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift26 = {{&term24, &state346}};
+std::vector<Reduce> reduce26 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift27 = {{&term25, &state344}};
+std::vector<Reduce> reduce27 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift28 = {{&term26, &state342}};
+std::vector<Reduce> reduce28 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift29 = {{&term27, &state340}};
+std::vector<Reduce> reduce29 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift30 = {{&term28, &state338}};
+std::vector<Reduce> reduce30 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift31 = {{&term29, &state336}};
+std::vector<Reduce> reduce31 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift32 = {{&term30, &state334}};
+std::vector<Reduce> reduce32 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift33 = {{&term31, &state332}};
+std::vector<Reduce> reduce33 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift34 = {{&term32, &state330}};
+std::vector<Reduce> reduce34 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift35 = {{&term33, &state328}};
+std::vector<Reduce> reduce35 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift36 = {{&term34, &state326}};
+std::vector<Reduce> reduce36 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift37 = {{&term35, &state324}};
+std::vector<Reduce> reduce37 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift38 = {{&term36, &state322}};
+std::vector<Reduce> reduce38 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift39 = {{&term37, &state320}};
+std::vector<Reduce> reduce39 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift40 = {{&term38, &state318}};
+std::vector<Reduce> reduce40 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift41 = {{&term39, &state316}};
+std::vector<Reduce> reduce41 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift42 = {{&term40, &state314}};
+std::vector<Reduce> reduce42 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift43 = {{&term41, &state312}};
+std::vector<Reduce> reduce43 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift44 = {{&term42, &state310}};
+std::vector<Reduce> reduce44 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift45 = {{&term43, &state308}};
+std::vector<Reduce> reduce45 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift46 = {{&term44, &state306}};
+std::vector<Reduce> reduce46 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift47 = {{&term45, &state304}};
+std::vector<Reduce> reduce47 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift48 = {{&term46, &state302}};
+std::vector<Reduce> reduce48 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift49 = {{&term47, &state300}};
+std::vector<Reduce> reduce49 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift50 = {{&term48, &state298}};
+std::vector<Reduce> reduce50 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift51 = {{&term49, &state296}};
+std::vector<Reduce> reduce51 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift52 = {{&term50, &state294}};
+std::vector<Reduce> reduce52 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift53 = {{&term51, &state292}};
+std::vector<Reduce> reduce53 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift54 = {{&term52, &state290}};
+std::vector<Reduce> reduce54 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift55 = {{&term53, &state288}};
+std::vector<Reduce> reduce55 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift56 = {{&term54, &state286}};
+std::vector<Reduce> reduce56 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift57 = {{&term55, &state284}};
+std::vector<Reduce> reduce57 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift58 = {{&term56, &state282}};
+std::vector<Reduce> reduce58 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift59 = {{&term57, &state280}};
+std::vector<Reduce> reduce59 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift60 = {{&term58, &state278}};
+std::vector<Reduce> reduce60 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift61 = {{&term59, &state276}};
+std::vector<Reduce> reduce61 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift62 = {{&term60, &state274}};
+std::vector<Reduce> reduce62 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift63 = {{&term61, &state272}};
+std::vector<Reduce> reduce63 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift64 = {{&term62, &state270}};
+std::vector<Reduce> reduce64 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift65 = {{&term63, &state268}};
+std::vector<Reduce> reduce65 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift66 = {{&term64, &state266}};
+std::vector<Reduce> reduce66 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift67 = {{&term65, &state264}};
+std::vector<Reduce> reduce67 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift68 = {{&term66, &state262}};
+std::vector<Reduce> reduce68 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift69 = {{&term67, &state260}};
+std::vector<Reduce> reduce69 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift70 = {{&term68, &state258}};
+std::vector<Reduce> reduce70 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift71 = {{&term69, &state256}};
+std::vector<Reduce> reduce71 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift72 = {{&term70, &state254}};
+std::vector<Reduce> reduce72 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift73 = {{&term71, &state252}};
+std::vector<Reduce> reduce73 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift74 = {{&term72, &state250}};
+std::vector<Reduce> reduce74 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift75 = {{&term73, &state248}};
+std::vector<Reduce> reduce75 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift76 = {{&term74, &state246}};
+std::vector<Reduce> reduce76 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift77 = {{&term75, &state244}};
+std::vector<Reduce> reduce77 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift78 = {{&term76, &state242}};
+std::vector<Reduce> reduce78 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift79 = {{&term77, &state240}};
+std::vector<Reduce> reduce79 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift80 = {{&term78, &state238}};
+std::vector<Reduce> reduce80 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift81 = {{&term79, &state236}};
+std::vector<Reduce> reduce81 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift82 = {{&term80, &state234}};
+std::vector<Reduce> reduce82 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift83 = {{&term81, &state232}};
+std::vector<Reduce> reduce83 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift84 = {{&term82, &state230}};
+std::vector<Reduce> reduce84 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift85 = {{&term83, &state228}};
+std::vector<Reduce> reduce85 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift86 = {{&term84, &state226}};
+std::vector<Reduce> reduce86 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift87 = {{&term85, &state224}};
+std::vector<Reduce> reduce87 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift88 = {{&term86, &state222}};
+std::vector<Reduce> reduce88 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift89 = {{&term87, &state220}};
+std::vector<Reduce> reduce89 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift90 = {{&term88, &state218}};
+std::vector<Reduce> reduce90 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift91 = {{&term89, &state216}};
+std::vector<Reduce> reduce91 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift92 = {{&term90, &state214}};
+std::vector<Reduce> reduce92 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift93 = {{&term91, &state212}};
+std::vector<Reduce> reduce93 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift94 = {{&term92, &state210}};
+std::vector<Reduce> reduce94 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift95 = {{&term93, &state208}};
+std::vector<Reduce> reduce95 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift96 = {{&term94, &state206}};
+std::vector<Reduce> reduce96 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift97 = {{&term95, &state204}};
+std::vector<Reduce> reduce97 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift98 = {{&term96, &state202}};
+std::vector<Reduce> reduce98 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift99 = {{&term97, &state200}};
+std::vector<Reduce> reduce99 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift100 = {{&term98, &state198}};
+std::vector<Reduce> reduce100 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift101 = {{&term99, &state196}};
+std::vector<Reduce> reduce101 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift102 = {{&term100, &state194}};
+std::vector<Reduce> reduce102 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift103 = {{&term101, &state192}};
+std::vector<Reduce> reduce103 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift104 = {{&term102, &state190}};
+std::vector<Reduce> reduce104 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift105 = {{&term103, &state188}};
+std::vector<Reduce> reduce105 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift106 = {{&term104, &state186}};
+std::vector<Reduce> reduce106 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift107 = {{&term105, &state184}};
+std::vector<Reduce> reduce107 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift108 = {{&term106, &state182}};
+std::vector<Reduce> reduce108 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift109 = {{&term107, &state180}};
+std::vector<Reduce> reduce109 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift110 = {{&term108, &state178}};
+std::vector<Reduce> reduce110 = {{nullptr, &rule209, false}};
+std::vector<Shift> shift111 = {{&term109, &state176}};
+std::vector<Reduce> reduce111 = {{nullptr, &rule211, false}};
+std::vector<Shift> shift112 = {{&term110, &state174}};
+std::vector<Reduce> reduce112 = {{nullptr, &rule213, false}};
+std::vector<Shift> shift113 = {{&term111, &state172}};
+std::vector<Reduce> reduce113 = {{nullptr, &rule215, false}};
+std::vector<Shift> shift114 = {{&term112, &state170}};
+std::vector<Reduce> reduce114 = {{nullptr, &rule217, false}};
+std::vector<Shift> shift115 = {{&term113, &state168}};
+std::vector<Reduce> reduce115 = {{nullptr, &rule219, false}};
+std::vector<Shift> shift116 = {{&term114, &state166}};
+std::vector<Reduce> reduce116 = {{nullptr, &rule221, false}};
+std::vector<Shift> shift117 = {{&term115, &state164}};
+std::vector<Reduce> reduce117 = {{nullptr, &rule223, false}};
+std::vector<Shift> shift118 = {{&term116, &state162}};
+std::vector<Reduce> reduce118 = {{nullptr, &rule225, false}};
+std::vector<Shift> shift119 = {{&term117, &state160}};
+std::vector<Reduce> reduce119 = {{nullptr, &rule227, false}};
+std::vector<Shift> shift120 = {{&term118, &state158}};
+std::vector<Reduce> reduce120 = {{nullptr, &rule229, false}};
+std::vector<Shift> shift121 = {{&term119, &state156}};
+std::vector<Reduce> reduce121 = {{nullptr, &rule231, false}};
+std::vector<Shift> shift122 = {{&term120, &state154}};
+std::vector<Reduce> reduce122 = {{nullptr, &rule233, false}};
+std::vector<Shift> shift123 = {{&term121, &state152}};
+std::vector<Reduce> reduce123 = {{nullptr, &rule235, false}};
+std::vector<Shift> shift124 = {{&term122, &state150}};
+std::vector<Reduce> reduce124 = {{nullptr, &rule237, false}};
+std::vector<Shift> shift125 = {{&term123, &state148}};
+std::vector<Reduce> reduce125 = {{nullptr, &rule239, false}};
+std::vector<Shift> shift126 = {{&term124, &state146}};
+std::vector<Reduce> reduce126 = {{nullptr, &rule241, false}};
+std::vector<Shift> shift127 = {{&term125, &state144}};
+std::vector<Reduce> reduce127 = {{nullptr, &rule243, false}};
+std::vector<Shift> shift128 = {{&term126, &state142}};
+std::vector<Reduce> reduce128 = {{nullptr, &rule245, false}};
+std::vector<Shift> shift129 = {{&term127, &state140}};
+std::vector<Reduce> reduce129 = {{nullptr, &rule247, false}};
+std::vector<Shift> shift130 = {{&term128, &state138}};
+std::vector<Reduce> reduce130 = {{nullptr, &rule249, false}};
+std::vector<Shift> shift131 = {{&term129, &state136}};
+std::vector<Reduce> reduce131 = {{nullptr, &rule251, false}};
+std::vector<Shift> shift132 = {{&term130, &state134}};
+std::vector<Reduce> reduce132 = {{nullptr, &rule253, false}};
+std::vector<Shift> shift133 = {};
+std::vector<Reduce> reduce133 = {{nullptr, &rule255, false}};
+std::vector<Shift> shift135 = {};
+std::vector<Reduce> reduce135 = {{nullptr, &rule256, false}};
+std::vector<Shift> shift137 = {{&term130, &state134}};
+std::vector<Reduce> reduce137 = {{nullptr, &rule254, false}};
+std::vector<Shift> shift139 = {{&term129, &state136}};
+std::vector<Reduce> reduce139 = {{nullptr, &rule252, false}};
+std::vector<Shift> shift141 = {{&term128, &state138}};
+std::vector<Reduce> reduce141 = {{nullptr, &rule250, false}};
+std::vector<Shift> shift143 = {{&term127, &state140}};
+std::vector<Reduce> reduce143 = {{nullptr, &rule248, false}};
+std::vector<Shift> shift145 = {{&term126, &state142}};
+std::vector<Reduce> reduce145 = {{nullptr, &rule246, false}};
+std::vector<Shift> shift147 = {{&term125, &state144}};
+std::vector<Reduce> reduce147 = {{nullptr, &rule244, false}};
+std::vector<Shift> shift149 = {{&term124, &state146}};
+std::vector<Reduce> reduce149 = {{nullptr, &rule242, false}};
+std::vector<Shift> shift151 = {{&term123, &state148}};
+std::vector<Reduce> reduce151 = {{nullptr, &rule240, false}};
+std::vector<Shift> shift153 = {{&term122, &state150}};
+std::vector<Reduce> reduce153 = {{nullptr, &rule238, false}};
+std::vector<Shift> shift155 = {{&term121, &state152}};
+std::vector<Reduce> reduce155 = {{nullptr, &rule236, false}};
+std::vector<Shift> shift157 = {{&term120, &state154}};
+std::vector<Reduce> reduce157 = {{nullptr, &rule234, false}};
+std::vector<Shift> shift159 = {{&term119, &state156}};
+std::vector<Reduce> reduce159 = {{nullptr, &rule232, false}};
+std::vector<Shift> shift161 = {{&term118, &state158}};
+std::vector<Reduce> reduce161 = {{nullptr, &rule230, false}};
+std::vector<Shift> shift163 = {{&term117, &state160}};
+std::vector<Reduce> reduce163 = {{nullptr, &rule228, false}};
+std::vector<Shift> shift165 = {{&term116, &state162}};
+std::vector<Reduce> reduce165 = {{nullptr, &rule226, false}};
+std::vector<Shift> shift167 = {{&term115, &state164}};
+std::vector<Reduce> reduce167 = {{nullptr, &rule224, false}};
+std::vector<Shift> shift169 = {{&term114, &state166}};
+std::vector<Reduce> reduce169 = {{nullptr, &rule222, false}};
+std::vector<Shift> shift171 = {{&term113, &state168}};
+std::vector<Reduce> reduce171 = {{nullptr, &rule220, false}};
+std::vector<Shift> shift173 = {{&term112, &state170}};
+std::vector<Reduce> reduce173 = {{nullptr, &rule218, false}};
+std::vector<Shift> shift175 = {{&term111, &state172}};
+std::vector<Reduce> reduce175 = {{nullptr, &rule216, false}};
+std::vector<Shift> shift177 = {{&term110, &state174}};
+std::vector<Reduce> reduce177 = {{nullptr, &rule214, false}};
+std::vector<Shift> shift179 = {{&term109, &state176}};
+std::vector<Reduce> reduce179 = {{nullptr, &rule212, false}};
+std::vector<Shift> shift181 = {{&term108, &state178}};
+std::vector<Reduce> reduce181 = {{nullptr, &rule210, false}};
+std::vector<Shift> shift183 = {{&term107, &state180}};
+std::vector<Reduce> reduce183 = {{nullptr, &rule208, false}};
+std::vector<Shift> shift185 = {{&term106, &state182}};
+std::vector<Reduce> reduce185 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift187 = {{&term105, &state184}};
+std::vector<Reduce> reduce187 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift189 = {{&term104, &state186}};
+std::vector<Reduce> reduce189 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift191 = {{&term103, &state188}};
+std::vector<Reduce> reduce191 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift193 = {{&term102, &state190}};
+std::vector<Reduce> reduce193 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift195 = {{&term101, &state192}};
+std::vector<Reduce> reduce195 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift197 = {{&term100, &state194}};
+std::vector<Reduce> reduce197 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift199 = {{&term99, &state196}};
+std::vector<Reduce> reduce199 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift201 = {{&term98, &state198}};
+std::vector<Reduce> reduce201 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift203 = {{&term97, &state200}};
+std::vector<Reduce> reduce203 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift205 = {{&term96, &state202}};
+std::vector<Reduce> reduce205 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift207 = {{&term95, &state204}};
+std::vector<Reduce> reduce207 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift209 = {{&term94, &state206}};
+std::vector<Reduce> reduce209 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift211 = {{&term93, &state208}};
+std::vector<Reduce> reduce211 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift213 = {{&term92, &state210}};
+std::vector<Reduce> reduce213 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift215 = {{&term91, &state212}};
+std::vector<Reduce> reduce215 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift217 = {{&term90, &state214}};
+std::vector<Reduce> reduce217 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift219 = {{&term89, &state216}};
+std::vector<Reduce> reduce219 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift221 = {{&term88, &state218}};
+std::vector<Reduce> reduce221 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift223 = {{&term87, &state220}};
+std::vector<Reduce> reduce223 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift225 = {{&term86, &state222}};
+std::vector<Reduce> reduce225 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift227 = {{&term85, &state224}};
+std::vector<Reduce> reduce227 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift229 = {{&term84, &state226}};
+std::vector<Reduce> reduce229 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift231 = {{&term83, &state228}};
+std::vector<Reduce> reduce231 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift233 = {{&term82, &state230}};
+std::vector<Reduce> reduce233 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift235 = {{&term81, &state232}};
+std::vector<Reduce> reduce235 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift237 = {{&term80, &state234}};
+std::vector<Reduce> reduce237 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift239 = {{&term79, &state236}};
+std::vector<Reduce> reduce239 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift241 = {{&term78, &state238}};
+std::vector<Reduce> reduce241 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift243 = {{&term77, &state240}};
+std::vector<Reduce> reduce243 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift245 = {{&term76, &state242}};
+std::vector<Reduce> reduce245 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift247 = {{&term75, &state244}};
+std::vector<Reduce> reduce247 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift249 = {{&term74, &state246}};
+std::vector<Reduce> reduce249 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift251 = {{&term73, &state248}};
+std::vector<Reduce> reduce251 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift253 = {{&term72, &state250}};
+std::vector<Reduce> reduce253 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift255 = {{&term71, &state252}};
+std::vector<Reduce> reduce255 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift257 = {{&term70, &state254}};
+std::vector<Reduce> reduce257 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift259 = {{&term69, &state256}};
+std::vector<Reduce> reduce259 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift261 = {{&term68, &state258}};
+std::vector<Reduce> reduce261 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift263 = {{&term67, &state260}};
+std::vector<Reduce> reduce263 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift265 = {{&term66, &state262}};
+std::vector<Reduce> reduce265 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift267 = {{&term65, &state264}};
+std::vector<Reduce> reduce267 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift269 = {{&term64, &state266}};
+std::vector<Reduce> reduce269 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift271 = {{&term63, &state268}};
+std::vector<Reduce> reduce271 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift273 = {{&term62, &state270}};
+std::vector<Reduce> reduce273 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift275 = {{&term61, &state272}};
+std::vector<Reduce> reduce275 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift277 = {{&term60, &state274}};
+std::vector<Reduce> reduce277 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift279 = {{&term59, &state276}};
+std::vector<Reduce> reduce279 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift281 = {{&term58, &state278}};
+std::vector<Reduce> reduce281 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift283 = {{&term57, &state280}};
+std::vector<Reduce> reduce283 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift285 = {{&term56, &state282}};
+std::vector<Reduce> reduce285 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift287 = {{&term55, &state284}};
+std::vector<Reduce> reduce287 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift289 = {{&term54, &state286}};
+std::vector<Reduce> reduce289 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift291 = {{&term53, &state288}};
+std::vector<Reduce> reduce291 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift293 = {{&term52, &state290}};
+std::vector<Reduce> reduce293 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift295 = {{&term51, &state292}};
+std::vector<Reduce> reduce295 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift297 = {{&term50, &state294}};
+std::vector<Reduce> reduce297 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift299 = {{&term49, &state296}};
+std::vector<Reduce> reduce299 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift301 = {{&term48, &state298}};
+std::vector<Reduce> reduce301 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift303 = {{&term47, &state300}};
+std::vector<Reduce> reduce303 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift305 = {{&term46, &state302}};
+std::vector<Reduce> reduce305 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift307 = {{&term45, &state304}};
+std::vector<Reduce> reduce307 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift309 = {{&term44, &state306}};
+std::vector<Reduce> reduce309 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift311 = {{&term43, &state308}};
+std::vector<Reduce> reduce311 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift313 = {{&term42, &state310}};
+std::vector<Reduce> reduce313 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift315 = {{&term41, &state312}};
+std::vector<Reduce> reduce315 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift317 = {{&term40, &state314}};
+std::vector<Reduce> reduce317 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift319 = {{&term39, &state316}};
+std::vector<Reduce> reduce319 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift321 = {{&term38, &state318}};
+std::vector<Reduce> reduce321 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift323 = {{&term37, &state320}};
+std::vector<Reduce> reduce323 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift325 = {{&term36, &state322}};
+std::vector<Reduce> reduce325 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift327 = {{&term35, &state324}};
+std::vector<Reduce> reduce327 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift329 = {{&term34, &state326}};
+std::vector<Reduce> reduce329 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift331 = {{&term33, &state328}};
+std::vector<Reduce> reduce331 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift333 = {{&term32, &state330}};
+std::vector<Reduce> reduce333 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift335 = {{&term31, &state332}};
+std::vector<Reduce> reduce335 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift337 = {{&term30, &state334}};
+std::vector<Reduce> reduce337 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift339 = {{&term29, &state336}};
+std::vector<Reduce> reduce339 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift341 = {{&term28, &state338}};
+std::vector<Reduce> reduce341 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift343 = {{&term27, &state340}};
+std::vector<Reduce> reduce343 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift345 = {{&term26, &state342}};
+std::vector<Reduce> reduce345 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift347 = {{&term25, &state344}};
+std::vector<Reduce> reduce347 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift349 = {{&term24, &state346}};
+std::vector<Reduce> reduce349 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift351 = {{&term23, &state348}};
+std::vector<Reduce> reduce351 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift353 = {{&term22, &state350}};
+std::vector<Reduce> reduce353 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift355 = {{&term21, &state352}};
+std::vector<Reduce> reduce355 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift357 = {{&term20, &state354}};
+std::vector<Reduce> reduce357 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift359 = {{&term19, &state356}};
+std::vector<Reduce> reduce359 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift361 = {{&term18, &state358}};
+std::vector<Reduce> reduce361 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift363 = {{&term17, &state360}};
+std::vector<Reduce> reduce363 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift365 = {{&term16, &state362}};
+std::vector<Reduce> reduce365 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift367 = {{&term15, &state364}};
+std::vector<Reduce> reduce367 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift369 = {{&term14, &state366}};
+std::vector<Reduce> reduce369 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift371 = {{&term13, &state368}};
+std::vector<Reduce> reduce371 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift373 = {{&term12, &state370}};
+std::vector<Reduce> reduce373 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift375 = {{&term11, &state372}};
+std::vector<Reduce> reduce375 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift377 = {{&term10, &state374}};
+std::vector<Reduce> reduce377 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift379 = {{&term9, &state376}};
+std::vector<Reduce> reduce379 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift381 = {{&term8, &state378}};
+std::vector<Reduce> reduce381 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift383 = {{&term7, &state380}};
+std::vector<Reduce> reduce383 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift385 = {{&term6, &state382}};
+std::vector<Reduce> reduce385 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift387 = {{&term5, &state384}};
+std::vector<Reduce> reduce387 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift389 = {{&term4, &state386}};
+std::vector<Reduce> reduce389 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift390 = {};
+std::vector<Reduce> reduce390 = {{nullptr, &rule260, false}};
+std::vector<Shift> shift395 = {{&term3, &state778}, {&term132, &state779}};
+std::vector<Reduce> reduce395 = {};
+std::vector<Shift> shift396 = {{&term4, &state776}};
+std::vector<Reduce> reduce396 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift397 = {{&term5, &state774}};
+std::vector<Reduce> reduce397 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift398 = {{&term6, &state772}};
+std::vector<Reduce> reduce398 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift399 = {{&term7, &state770}};
+std::vector<Reduce> reduce399 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift400 = {{&term8, &state768}};
+std::vector<Reduce> reduce400 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift401 = {{&term9, &state766}};
+std::vector<Reduce> reduce401 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift402 = {{&term10, &state764}};
+std::vector<Reduce> reduce402 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift403 = {{&term11, &state762}};
+std::vector<Reduce> reduce403 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift404 = {{&term12, &state760}};
+std::vector<Reduce> reduce404 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift405 = {{&term13, &state758}};
+std::vector<Reduce> reduce405 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift406 = {{&term14, &state756}};
+std::vector<Reduce> reduce406 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift407 = {{&term15, &state754}};
+std::vector<Reduce> reduce407 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift408 = {{&term16, &state752}};
+std::vector<Reduce> reduce408 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift409 = {{&term17, &state750}};
+std::vector<Reduce> reduce409 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift410 = {{&term18, &state748}};
+std::vector<Reduce> reduce410 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift411 = {{&term19, &state746}};
+std::vector<Reduce> reduce411 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift412 = {{&term20, &state744}};
+std::vector<Reduce> reduce412 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift413 = {{&term21, &state742}};
+std::vector<Reduce> reduce413 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift414 = {{&term22, &state740}};
+std::vector<Reduce> reduce414 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift415 = {{&term23, &state738}};
+std::vector<Reduce> reduce415 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift416 = {{&term24, &state736}};
+std::vector<Reduce> reduce416 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift417 = {{&term25, &state734}};
+std::vector<Reduce> reduce417 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift418 = {{&term26, &state732}};
+std::vector<Reduce> reduce418 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift419 = {{&term27, &state730}};
+std::vector<Reduce> reduce419 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift420 = {{&term28, &state728}};
+std::vector<Reduce> reduce420 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift421 = {{&term29, &state726}};
+std::vector<Reduce> reduce421 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift422 = {{&term30, &state724}};
+std::vector<Reduce> reduce422 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift423 = {{&term31, &state722}};
+std::vector<Reduce> reduce423 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift424 = {{&term32, &state720}};
+std::vector<Reduce> reduce424 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift425 = {{&term33, &state718}};
+std::vector<Reduce> reduce425 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift426 = {{&term34, &state716}};
+std::vector<Reduce> reduce426 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift427 = {{&term35, &state714}};
+std::vector<Reduce> reduce427 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift428 = {{&term36, &state712}};
+std::vector<Reduce> reduce428 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift429 = {{&term37, &state710}};
+std::vector<Reduce> reduce429 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift430 = {{&term38, &state708}};
+std::vector<Reduce> reduce430 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift431 = {{&term39, &state706}};
+std::vector<Reduce> reduce431 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift432 = {{&term40, &state704}};
+std::vector<Reduce> reduce432 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift433 = {{&term41, &state702}};
+std::vector<Reduce> reduce433 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift434 = {{&term42, &state700}};
+std::vector<Reduce> reduce434 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift435 = {{&term43, &state698}};
+std::vector<Reduce> reduce435 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift436 = {{&term44, &state696}};
+std::vector<Reduce> reduce436 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift437 = {{&term45, &state694}};
+std::vector<Reduce> reduce437 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift438 = {{&term46, &state692}};
+std::vector<Reduce> reduce438 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift439 = {{&term47, &state690}};
+std::vector<Reduce> reduce439 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift440 = {{&term48, &state688}};
+std::vector<Reduce> reduce440 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift441 = {{&term49, &state686}};
+std::vector<Reduce> reduce441 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift442 = {{&term50, &state684}};
+std::vector<Reduce> reduce442 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift443 = {{&term51, &state682}};
+std::vector<Reduce> reduce443 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift444 = {{&term52, &state680}};
+std::vector<Reduce> reduce444 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift445 = {{&term53, &state678}};
+std::vector<Reduce> reduce445 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift446 = {{&term54, &state676}};
+std::vector<Reduce> reduce446 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift447 = {{&term55, &state674}};
+std::vector<Reduce> reduce447 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift448 = {{&term56, &state672}};
+std::vector<Reduce> reduce448 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift449 = {{&term57, &state670}};
+std::vector<Reduce> reduce449 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift450 = {{&term58, &state668}};
+std::vector<Reduce> reduce450 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift451 = {{&term59, &state666}};
+std::vector<Reduce> reduce451 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift452 = {{&term60, &state664}};
+std::vector<Reduce> reduce452 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift453 = {{&term61, &state662}};
+std::vector<Reduce> reduce453 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift454 = {{&term62, &state660}};
+std::vector<Reduce> reduce454 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift455 = {{&term63, &state658}};
+std::vector<Reduce> reduce455 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift456 = {{&term64, &state656}};
+std::vector<Reduce> reduce456 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift457 = {{&term65, &state654}};
+std::vector<Reduce> reduce457 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift458 = {{&term66, &state652}};
+std::vector<Reduce> reduce458 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift459 = {{&term67, &state650}};
+std::vector<Reduce> reduce459 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift460 = {{&term68, &state648}};
+std::vector<Reduce> reduce460 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift461 = {{&term69, &state646}};
+std::vector<Reduce> reduce461 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift462 = {{&term70, &state644}};
+std::vector<Reduce> reduce462 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift463 = {{&term71, &state642}};
+std::vector<Reduce> reduce463 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift464 = {{&term72, &state640}};
+std::vector<Reduce> reduce464 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift465 = {{&term73, &state638}};
+std::vector<Reduce> reduce465 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift466 = {{&term74, &state636}};
+std::vector<Reduce> reduce466 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift467 = {{&term75, &state634}};
+std::vector<Reduce> reduce467 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift468 = {{&term76, &state632}};
+std::vector<Reduce> reduce468 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift469 = {{&term77, &state630}};
+std::vector<Reduce> reduce469 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift470 = {{&term78, &state628}};
+std::vector<Reduce> reduce470 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift471 = {{&term79, &state626}};
+std::vector<Reduce> reduce471 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift472 = {{&term80, &state624}};
+std::vector<Reduce> reduce472 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift473 = {{&term81, &state622}};
+std::vector<Reduce> reduce473 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift474 = {{&term82, &state620}};
+std::vector<Reduce> reduce474 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift475 = {{&term83, &state618}};
+std::vector<Reduce> reduce475 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift476 = {{&term84, &state616}};
+std::vector<Reduce> reduce476 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift477 = {{&term85, &state614}};
+std::vector<Reduce> reduce477 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift478 = {{&term86, &state612}};
+std::vector<Reduce> reduce478 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift479 = {{&term87, &state610}};
+std::vector<Reduce> reduce479 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift480 = {{&term88, &state608}};
+std::vector<Reduce> reduce480 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift481 = {{&term89, &state606}};
+std::vector<Reduce> reduce481 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift482 = {{&term90, &state604}};
+std::vector<Reduce> reduce482 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift483 = {{&term91, &state602}};
+std::vector<Reduce> reduce483 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift484 = {{&term92, &state600}};
+std::vector<Reduce> reduce484 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift485 = {{&term93, &state598}};
+std::vector<Reduce> reduce485 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift486 = {{&term94, &state596}};
+std::vector<Reduce> reduce486 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift487 = {{&term95, &state594}};
+std::vector<Reduce> reduce487 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift488 = {{&term96, &state592}};
+std::vector<Reduce> reduce488 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift489 = {{&term97, &state590}};
+std::vector<Reduce> reduce489 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift490 = {{&term98, &state588}};
+std::vector<Reduce> reduce490 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift491 = {{&term99, &state586}};
+std::vector<Reduce> reduce491 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift492 = {{&term100, &state584}};
+std::vector<Reduce> reduce492 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift493 = {{&term101, &state582}};
+std::vector<Reduce> reduce493 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift494 = {{&term102, &state580}};
+std::vector<Reduce> reduce494 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift495 = {{&term103, &state578}};
+std::vector<Reduce> reduce495 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift496 = {{&term104, &state576}};
+std::vector<Reduce> reduce496 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift497 = {{&term105, &state574}};
+std::vector<Reduce> reduce497 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift498 = {{&term106, &state572}};
+std::vector<Reduce> reduce498 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift499 = {{&term107, &state570}};
+std::vector<Reduce> reduce499 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift500 = {{&term108, &state568}};
+std::vector<Reduce> reduce500 = {{nullptr, &rule209, false}};
+std::vector<Shift> shift501 = {{&term109, &state566}};
+std::vector<Reduce> reduce501 = {{nullptr, &rule211, false}};
+std::vector<Shift> shift502 = {{&term110, &state564}};
+std::vector<Reduce> reduce502 = {{nullptr, &rule213, false}};
+std::vector<Shift> shift503 = {{&term111, &state562}};
+std::vector<Reduce> reduce503 = {{nullptr, &rule215, false}};
+std::vector<Shift> shift504 = {{&term112, &state560}};
+std::vector<Reduce> reduce504 = {{nullptr, &rule217, false}};
+std::vector<Shift> shift505 = {{&term113, &state558}};
+std::vector<Reduce> reduce505 = {{nullptr, &rule219, false}};
+std::vector<Shift> shift506 = {{&term114, &state556}};
+std::vector<Reduce> reduce506 = {{nullptr, &rule221, false}};
+std::vector<Shift> shift507 = {{&term115, &state554}};
+std::vector<Reduce> reduce507 = {{nullptr, &rule223, false}};
+std::vector<Shift> shift508 = {{&term116, &state552}};
+std::vector<Reduce> reduce508 = {{nullptr, &rule225, false}};
+std::vector<Shift> shift509 = {{&term117, &state550}};
+std::vector<Reduce> reduce509 = {{nullptr, &rule227, false}};
+std::vector<Shift> shift510 = {{&term118, &state548}};
+std::vector<Reduce> reduce510 = {{nullptr, &rule229, false}};
+std::vector<Shift> shift511 = {{&term119, &state546}};
+std::vector<Reduce> reduce511 = {{nullptr, &rule231, false}};
+std::vector<Shift> shift512 = {{&term120, &state544}};
+std::vector<Reduce> reduce512 = {{nullptr, &rule233, false}};
+std::vector<Shift> shift513 = {{&term121, &state542}};
+std::vector<Reduce> reduce513 = {{nullptr, &rule235, false}};
+std::vector<Shift> shift514 = {{&term122, &state540}};
+std::vector<Reduce> reduce514 = {{nullptr, &rule237, false}};
+std::vector<Shift> shift515 = {{&term123, &state538}};
+std::vector<Reduce> reduce515 = {{nullptr, &rule239, false}};
+std::vector<Shift> shift516 = {{&term124, &state536}};
+std::vector<Reduce> reduce516 = {{nullptr, &rule241, false}};
+std::vector<Shift> shift517 = {{&term125, &state534}};
+std::vector<Reduce> reduce517 = {{nullptr, &rule243, false}};
+std::vector<Shift> shift518 = {{&term126, &state532}};
+std::vector<Reduce> reduce518 = {{nullptr, &rule245, false}};
+std::vector<Shift> shift519 = {{&term127, &state530}};
+std::vector<Reduce> reduce519 = {{nullptr, &rule247, false}};
+std::vector<Shift> shift520 = {{&term128, &state528}};
+std::vector<Reduce> reduce520 = {{nullptr, &rule249, false}};
+std::vector<Shift> shift521 = {{&term129, &state526}};
+std::vector<Reduce> reduce521 = {{nullptr, &rule251, false}};
+std::vector<Shift> shift522 = {{&term130, &state524}};
+std::vector<Reduce> reduce522 = {{nullptr, &rule253, false}};
+std::vector<Shift> shift527 = {{&term130, &state524}};
+std::vector<Reduce> reduce527 = {{nullptr, &rule254, false}};
+std::vector<Shift> shift529 = {{&term129, &state526}};
+std::vector<Reduce> reduce529 = {{nullptr, &rule252, false}};
+std::vector<Shift> shift531 = {{&term128, &state528}};
+std::vector<Reduce> reduce531 = {{nullptr, &rule250, false}};
+std::vector<Shift> shift533 = {{&term127, &state530}};
+std::vector<Reduce> reduce533 = {{nullptr, &rule248, false}};
+std::vector<Shift> shift535 = {{&term126, &state532}};
+std::vector<Reduce> reduce535 = {{nullptr, &rule246, false}};
+std::vector<Shift> shift537 = {{&term125, &state534}};
+std::vector<Reduce> reduce537 = {{nullptr, &rule244, false}};
+std::vector<Shift> shift539 = {{&term124, &state536}};
+std::vector<Reduce> reduce539 = {{nullptr, &rule242, false}};
+std::vector<Shift> shift541 = {{&term123, &state538}};
+std::vector<Reduce> reduce541 = {{nullptr, &rule240, false}};
+std::vector<Shift> shift543 = {{&term122, &state540}};
+std::vector<Reduce> reduce543 = {{nullptr, &rule238, false}};
+std::vector<Shift> shift545 = {{&term121, &state542}};
+std::vector<Reduce> reduce545 = {{nullptr, &rule236, false}};
+std::vector<Shift> shift547 = {{&term120, &state544}};
+std::vector<Reduce> reduce547 = {{nullptr, &rule234, false}};
+std::vector<Shift> shift549 = {{&term119, &state546}};
+std::vector<Reduce> reduce549 = {{nullptr, &rule232, false}};
+std::vector<Shift> shift551 = {{&term118, &state548}};
+std::vector<Reduce> reduce551 = {{nullptr, &rule230, false}};
+std::vector<Shift> shift553 = {{&term117, &state550}};
+std::vector<Reduce> reduce553 = {{nullptr, &rule228, false}};
+std::vector<Shift> shift555 = {{&term116, &state552}};
+std::vector<Reduce> reduce555 = {{nullptr, &rule226, false}};
+std::vector<Shift> shift557 = {{&term115, &state554}};
+std::vector<Reduce> reduce557 = {{nullptr, &rule224, false}};
+std::vector<Shift> shift559 = {{&term114, &state556}};
+std::vector<Reduce> reduce559 = {{nullptr, &rule222, false}};
+std::vector<Shift> shift561 = {{&term113, &state558}};
+std::vector<Reduce> reduce561 = {{nullptr, &rule220, false}};
+std::vector<Shift> shift563 = {{&term112, &state560}};
+std::vector<Reduce> reduce563 = {{nullptr, &rule218, false}};
+std::vector<Shift> shift565 = {{&term111, &state562}};
+std::vector<Reduce> reduce565 = {{nullptr, &rule216, false}};
+std::vector<Shift> shift567 = {{&term110, &state564}};
+std::vector<Reduce> reduce567 = {{nullptr, &rule214, false}};
+std::vector<Shift> shift569 = {{&term109, &state566}};
+std::vector<Reduce> reduce569 = {{nullptr, &rule212, false}};
+std::vector<Shift> shift571 = {{&term108, &state568}};
+std::vector<Reduce> reduce571 = {{nullptr, &rule210, false}};
+std::vector<Shift> shift573 = {{&term107, &state570}};
+std::vector<Reduce> reduce573 = {{nullptr, &rule208, false}};
+std::vector<Shift> shift575 = {{&term106, &state572}};
+std::vector<Reduce> reduce575 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift577 = {{&term105, &state574}};
+std::vector<Reduce> reduce577 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift579 = {{&term104, &state576}};
+std::vector<Reduce> reduce579 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift581 = {{&term103, &state578}};
+std::vector<Reduce> reduce581 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift583 = {{&term102, &state580}};
+std::vector<Reduce> reduce583 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift585 = {{&term101, &state582}};
+std::vector<Reduce> reduce585 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift587 = {{&term100, &state584}};
+std::vector<Reduce> reduce587 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift589 = {{&term99, &state586}};
+std::vector<Reduce> reduce589 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift591 = {{&term98, &state588}};
+std::vector<Reduce> reduce591 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift593 = {{&term97, &state590}};
+std::vector<Reduce> reduce593 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift595 = {{&term96, &state592}};
+std::vector<Reduce> reduce595 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift597 = {{&term95, &state594}};
+std::vector<Reduce> reduce597 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift599 = {{&term94, &state596}};
+std::vector<Reduce> reduce599 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift601 = {{&term93, &state598}};
+std::vector<Reduce> reduce601 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift603 = {{&term92, &state600}};
+std::vector<Reduce> reduce603 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift605 = {{&term91, &state602}};
+std::vector<Reduce> reduce605 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift607 = {{&term90, &state604}};
+std::vector<Reduce> reduce607 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift609 = {{&term89, &state606}};
+std::vector<Reduce> reduce609 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift611 = {{&term88, &state608}};
+std::vector<Reduce> reduce611 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift613 = {{&term87, &state610}};
+std::vector<Reduce> reduce613 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift615 = {{&term86, &state612}};
+std::vector<Reduce> reduce615 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift617 = {{&term85, &state614}};
+std::vector<Reduce> reduce617 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift619 = {{&term84, &state616}};
+std::vector<Reduce> reduce619 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift621 = {{&term83, &state618}};
+std::vector<Reduce> reduce621 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift623 = {{&term82, &state620}};
+std::vector<Reduce> reduce623 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift625 = {{&term81, &state622}};
+std::vector<Reduce> reduce625 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift627 = {{&term80, &state624}};
+std::vector<Reduce> reduce627 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift629 = {{&term79, &state626}};
+std::vector<Reduce> reduce629 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift631 = {{&term78, &state628}};
+std::vector<Reduce> reduce631 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift633 = {{&term77, &state630}};
+std::vector<Reduce> reduce633 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift635 = {{&term76, &state632}};
+std::vector<Reduce> reduce635 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift637 = {{&term75, &state634}};
+std::vector<Reduce> reduce637 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift639 = {{&term74, &state636}};
+std::vector<Reduce> reduce639 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift641 = {{&term73, &state638}};
+std::vector<Reduce> reduce641 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift643 = {{&term72, &state640}};
+std::vector<Reduce> reduce643 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift645 = {{&term71, &state642}};
+std::vector<Reduce> reduce645 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift647 = {{&term70, &state644}};
+std::vector<Reduce> reduce647 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift649 = {{&term69, &state646}};
+std::vector<Reduce> reduce649 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift651 = {{&term68, &state648}};
+std::vector<Reduce> reduce651 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift653 = {{&term67, &state650}};
+std::vector<Reduce> reduce653 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift655 = {{&term66, &state652}};
+std::vector<Reduce> reduce655 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift657 = {{&term65, &state654}};
+std::vector<Reduce> reduce657 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift659 = {{&term64, &state656}};
+std::vector<Reduce> reduce659 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift661 = {{&term63, &state658}};
+std::vector<Reduce> reduce661 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift663 = {{&term62, &state660}};
+std::vector<Reduce> reduce663 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift665 = {{&term61, &state662}};
+std::vector<Reduce> reduce665 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift667 = {{&term60, &state664}};
+std::vector<Reduce> reduce667 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift669 = {{&term59, &state666}};
+std::vector<Reduce> reduce669 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift671 = {{&term58, &state668}};
+std::vector<Reduce> reduce671 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift673 = {{&term57, &state670}};
+std::vector<Reduce> reduce673 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift675 = {{&term56, &state672}};
+std::vector<Reduce> reduce675 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift677 = {{&term55, &state674}};
+std::vector<Reduce> reduce677 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift679 = {{&term54, &state676}};
+std::vector<Reduce> reduce679 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift681 = {{&term53, &state678}};
+std::vector<Reduce> reduce681 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift683 = {{&term52, &state680}};
+std::vector<Reduce> reduce683 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift685 = {{&term51, &state682}};
+std::vector<Reduce> reduce685 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift687 = {{&term50, &state684}};
+std::vector<Reduce> reduce687 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift689 = {{&term49, &state686}};
+std::vector<Reduce> reduce689 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift691 = {{&term48, &state688}};
+std::vector<Reduce> reduce691 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift693 = {{&term47, &state690}};
+std::vector<Reduce> reduce693 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift695 = {{&term46, &state692}};
+std::vector<Reduce> reduce695 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift697 = {{&term45, &state694}};
+std::vector<Reduce> reduce697 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift699 = {{&term44, &state696}};
+std::vector<Reduce> reduce699 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift701 = {{&term43, &state698}};
+std::vector<Reduce> reduce701 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift703 = {{&term42, &state700}};
+std::vector<Reduce> reduce703 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift705 = {{&term41, &state702}};
+std::vector<Reduce> reduce705 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift707 = {{&term40, &state704}};
+std::vector<Reduce> reduce707 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift709 = {{&term39, &state706}};
+std::vector<Reduce> reduce709 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift711 = {{&term38, &state708}};
+std::vector<Reduce> reduce711 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift713 = {{&term37, &state710}};
+std::vector<Reduce> reduce713 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift715 = {{&term36, &state712}};
+std::vector<Reduce> reduce715 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift717 = {{&term35, &state714}};
+std::vector<Reduce> reduce717 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift719 = {{&term34, &state716}};
+std::vector<Reduce> reduce719 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift721 = {{&term33, &state718}};
+std::vector<Reduce> reduce721 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift723 = {{&term32, &state720}};
+std::vector<Reduce> reduce723 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift725 = {{&term31, &state722}};
+std::vector<Reduce> reduce725 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift727 = {{&term30, &state724}};
+std::vector<Reduce> reduce727 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift729 = {{&term29, &state726}};
+std::vector<Reduce> reduce729 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift731 = {{&term28, &state728}};
+std::vector<Reduce> reduce731 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift733 = {{&term27, &state730}};
+std::vector<Reduce> reduce733 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift735 = {{&term26, &state732}};
+std::vector<Reduce> reduce735 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift737 = {{&term25, &state734}};
+std::vector<Reduce> reduce737 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift739 = {{&term24, &state736}};
+std::vector<Reduce> reduce739 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift741 = {{&term23, &state738}};
+std::vector<Reduce> reduce741 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift743 = {{&term22, &state740}};
+std::vector<Reduce> reduce743 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift745 = {{&term21, &state742}};
+std::vector<Reduce> reduce745 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift747 = {{&term20, &state744}};
+std::vector<Reduce> reduce747 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift749 = {{&term19, &state746}};
+std::vector<Reduce> reduce749 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift751 = {{&term18, &state748}};
+std::vector<Reduce> reduce751 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift753 = {{&term17, &state750}};
+std::vector<Reduce> reduce753 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift755 = {{&term16, &state752}};
+std::vector<Reduce> reduce755 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift757 = {{&term15, &state754}};
+std::vector<Reduce> reduce757 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift759 = {{&term14, &state756}};
+std::vector<Reduce> reduce759 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift761 = {{&term13, &state758}};
+std::vector<Reduce> reduce761 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift763 = {{&term12, &state760}};
+std::vector<Reduce> reduce763 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift765 = {{&term11, &state762}};
+std::vector<Reduce> reduce765 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift767 = {{&term10, &state764}};
+std::vector<Reduce> reduce767 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift769 = {{&term9, &state766}};
+std::vector<Reduce> reduce769 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift771 = {{&term8, &state768}};
+std::vector<Reduce> reduce771 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift773 = {{&term7, &state770}};
+std::vector<Reduce> reduce773 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift775 = {{&term6, &state772}};
+std::vector<Reduce> reduce775 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift777 = {{&term5, &state774}};
+std::vector<Reduce> reduce777 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift779 = {};
+std::vector<Reduce> reduce779 = {{nullptr, &rule259, false}};
+std::vector<Shift> shift780 = {{&term4, &state776}};
+std::vector<Reduce> reduce780 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift782 = {{&term3, &state778}, {&term132, &state783}};
+std::vector<Reduce> reduce782 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state5}, {&nonterm2, &state6}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go3 = {{&nonterm1, &state395}, {&nonterm2, &state396}, {&nonterm3, &state397}, {&nonterm4, &state398}, {&nonterm5, &state399}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go4 = {{&nonterm129, &state390}};
+std::vector<Go> go134 = {{&nonterm129, &state135}};
+std::vector<Go> go136 = {{&nonterm128, &state137}, {&nonterm129, &state133}};
+std::vector<Go> go138 = {{&nonterm127, &state139}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go140 = {{&nonterm126, &state141}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go142 = {{&nonterm125, &state143}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go144 = {{&nonterm124, &state145}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go146 = {{&nonterm123, &state147}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go148 = {{&nonterm122, &state149}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go150 = {{&nonterm121, &state151}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go152 = {{&nonterm120, &state153}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go154 = {{&nonterm119, &state155}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go156 = {{&nonterm118, &state157}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go158 = {{&nonterm117, &state159}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go160 = {{&nonterm116, &state161}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go162 = {{&nonterm115, &state163}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go164 = {{&nonterm114, &state165}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go166 = {{&nonterm113, &state167}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go168 = {{&nonterm112, &state169}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go170 = {{&nonterm111, &state171}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go172 = {{&nonterm110, &state173}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go174 = {{&nonterm109, &state175}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go176 = {{&nonterm108, &state177}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go178 = {{&nonterm107, &state179}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go180 = {{&nonterm106, &state181}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go182 = {{&nonterm105, &state183}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go184 = {{&nonterm104, &state185}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go186 = {{&nonterm103, &state187}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go188 = {{&nonterm102, &state189}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go190 = {{&nonterm101, &state191}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go192 = {{&nonterm100, &state193}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go194 = {{&nonterm99, &state195}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go196 = {{&nonterm98, &state197}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go198 = {{&nonterm97, &state199}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go200 = {{&nonterm96, &state201}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go202 = {{&nonterm95, &state203}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go204 = {{&nonterm94, &state205}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go206 = {{&nonterm93, &state207}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go208 = {{&nonterm92, &state209}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go210 = {{&nonterm91, &state211}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go212 = {{&nonterm90, &state213}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go214 = {{&nonterm89, &state215}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go216 = {{&nonterm88, &state217}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go218 = {{&nonterm87, &state219}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go220 = {{&nonterm86, &state221}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go222 = {{&nonterm85, &state223}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go224 = {{&nonterm84, &state225}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go226 = {{&nonterm83, &state227}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go228 = {{&nonterm82, &state229}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go230 = {{&nonterm81, &state231}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go232 = {{&nonterm80, &state233}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go234 = {{&nonterm79, &state235}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go236 = {{&nonterm78, &state237}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go238 = {{&nonterm77, &state239}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go240 = {{&nonterm76, &state241}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go242 = {{&nonterm75, &state243}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go244 = {{&nonterm74, &state245}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go246 = {{&nonterm73, &state247}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go248 = {{&nonterm72, &state249}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go250 = {{&nonterm71, &state251}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go252 = {{&nonterm70, &state253}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go254 = {{&nonterm69, &state255}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go256 = {{&nonterm68, &state257}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go258 = {{&nonterm67, &state259}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go260 = {{&nonterm66, &state261}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go262 = {{&nonterm65, &state263}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go264 = {{&nonterm64, &state265}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go266 = {{&nonterm63, &state267}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go268 = {{&nonterm62, &state269}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go270 = {{&nonterm61, &state271}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go272 = {{&nonterm60, &state273}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go274 = {{&nonterm59, &state275}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go276 = {{&nonterm58, &state277}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go278 = {{&nonterm57, &state279}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go280 = {{&nonterm56, &state281}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go282 = {{&nonterm55, &state283}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go284 = {{&nonterm54, &state285}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go286 = {{&nonterm53, &state287}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go288 = {{&nonterm52, &state289}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go290 = {{&nonterm51, &state291}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go292 = {{&nonterm50, &state293}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go294 = {{&nonterm49, &state295}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go296 = {{&nonterm48, &state297}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go298 = {{&nonterm47, &state299}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go300 = {{&nonterm46, &state301}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go302 = {{&nonterm45, &state303}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go304 = {{&nonterm44, &state305}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go306 = {{&nonterm43, &state307}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go308 = {{&nonterm42, &state309}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go310 = {{&nonterm41, &state311}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go312 = {{&nonterm40, &state313}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go314 = {{&nonterm39, &state315}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go316 = {{&nonterm38, &state317}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go318 = {{&nonterm37, &state319}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go320 = {{&nonterm36, &state321}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go322 = {{&nonterm35, &state323}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go324 = {{&nonterm34, &state325}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go326 = {{&nonterm33, &state327}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go328 = {{&nonterm32, &state329}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go330 = {{&nonterm31, &state331}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go332 = {{&nonterm30, &state333}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go334 = {{&nonterm29, &state335}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go336 = {{&nonterm28, &state337}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go338 = {{&nonterm27, &state339}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go340 = {{&nonterm26, &state341}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go342 = {{&nonterm25, &state343}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go344 = {{&nonterm24, &state345}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go346 = {{&nonterm23, &state347}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go348 = {{&nonterm22, &state349}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go350 = {{&nonterm21, &state351}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go352 = {{&nonterm20, &state353}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go354 = {{&nonterm19, &state355}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go356 = {{&nonterm18, &state357}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go358 = {{&nonterm17, &state359}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go360 = {{&nonterm16, &state361}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go362 = {{&nonterm15, &state363}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go364 = {{&nonterm14, &state365}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go366 = {{&nonterm13, &state367}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go368 = {{&nonterm12, &state369}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go370 = {{&nonterm11, &state371}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go372 = {{&nonterm10, &state373}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go374 = {{&nonterm9, &state375}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go376 = {{&nonterm8, &state377}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go378 = {{&nonterm7, &state379}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go380 = {{&nonterm6, &state381}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go382 = {{&nonterm5, &state383}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go384 = {{&nonterm4, &state385}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go386 = {{&nonterm3, &state387}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go388 = {{&nonterm2, &state389}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}, {&nonterm66, &state70}, {&nonterm67, &state71}, {&nonterm68, &state72}, {&nonterm69, &state73}, {&nonterm70, &state74}, {&nonterm71, &state75}, {&nonterm72, &state76}, {&nonterm73, &state77}, {&nonterm74, &state78}, {&nonterm75, &state79}, {&nonterm76, &state80}, {&nonterm77, &state81}, {&nonterm78, &state82}, {&nonterm79, &state83}, {&nonterm80, &state84}, {&nonterm81, &state85}, {&nonterm82, &state86}, {&nonterm83, &state87}, {&nonterm84, &state88}, {&nonterm85, &state89}, {&nonterm86, &state90}, {&nonterm87, &state91}, {&nonterm88, &state92}, {&nonterm89, &state93}, {&nonterm90, &state94}, {&nonterm91, &state95}, {&nonterm92, &state96}, {&nonterm93, &state97}, {&nonterm94, &state98}, {&nonterm95, &state99}, {&nonterm96, &state100}, {&nonterm97, &state101}, {&nonterm98, &state102}, {&nonterm99, &state103}, {&nonterm100, &state104}, {&nonterm101, &state105}, {&nonterm102, &state106}, {&nonterm103, &state107}, {&nonterm104, &state108}, {&nonterm105, &state109}, {&nonterm106, &state110}, {&nonterm107, &state111}, {&nonterm108, &state112}, {&nonterm109, &state113}, {&nonterm110, &state114}, {&nonterm111, &state115}, {&nonterm112, &state116}, {&nonterm113, &state117}, {&nonterm114, &state118}, {&nonterm115, &state119}, {&nonterm116, &state120}, {&nonterm117, &state121}, {&nonterm118, &state122}, {&nonterm119, &state123}, {&nonterm120, &state124}, {&nonterm121, &state125}, {&nonterm122, &state126}, {&nonterm123, &state127}, {&nonterm124, &state128}, {&nonterm125, &state129}, {&nonterm126, &state130}, {&nonterm127, &state131}, {&nonterm128, &state132}, {&nonterm129, &state133}};
+std::vector<Go> go393 = {{&nonterm1, &state782}, {&nonterm2, &state396}, {&nonterm3, &state397}, {&nonterm4, &state398}, {&nonterm5, &state399}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go394 = {{&nonterm129, &state781}};
+std::vector<Go> go524 = {{&nonterm129, &state525}};
+std::vector<Go> go526 = {{&nonterm128, &state527}, {&nonterm129, &state523}};
+std::vector<Go> go528 = {{&nonterm127, &state529}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go530 = {{&nonterm126, &state531}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go532 = {{&nonterm125, &state533}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go534 = {{&nonterm124, &state535}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go536 = {{&nonterm123, &state537}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go538 = {{&nonterm122, &state539}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go540 = {{&nonterm121, &state541}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go542 = {{&nonterm120, &state543}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go544 = {{&nonterm119, &state545}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go546 = {{&nonterm118, &state547}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go548 = {{&nonterm117, &state549}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go550 = {{&nonterm116, &state551}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go552 = {{&nonterm115, &state553}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go554 = {{&nonterm114, &state555}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go556 = {{&nonterm113, &state557}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go558 = {{&nonterm112, &state559}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go560 = {{&nonterm111, &state561}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go562 = {{&nonterm110, &state563}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go564 = {{&nonterm109, &state565}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go566 = {{&nonterm108, &state567}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go568 = {{&nonterm107, &state569}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go570 = {{&nonterm106, &state571}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go572 = {{&nonterm105, &state573}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go574 = {{&nonterm104, &state575}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go576 = {{&nonterm103, &state577}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go578 = {{&nonterm102, &state579}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go580 = {{&nonterm101, &state581}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go582 = {{&nonterm100, &state583}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go584 = {{&nonterm99, &state585}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go586 = {{&nonterm98, &state587}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go588 = {{&nonterm97, &state589}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go590 = {{&nonterm96, &state591}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go592 = {{&nonterm95, &state593}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go594 = {{&nonterm94, &state595}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go596 = {{&nonterm93, &state597}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go598 = {{&nonterm92, &state599}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go600 = {{&nonterm91, &state601}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go602 = {{&nonterm90, &state603}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go604 = {{&nonterm89, &state605}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go606 = {{&nonterm88, &state607}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go608 = {{&nonterm87, &state609}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go610 = {{&nonterm86, &state611}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go612 = {{&nonterm85, &state613}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go614 = {{&nonterm84, &state615}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go616 = {{&nonterm83, &state617}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go618 = {{&nonterm82, &state619}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go620 = {{&nonterm81, &state621}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go622 = {{&nonterm80, &state623}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go624 = {{&nonterm79, &state625}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go626 = {{&nonterm78, &state627}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go628 = {{&nonterm77, &state629}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go630 = {{&nonterm76, &state631}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go632 = {{&nonterm75, &state633}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go634 = {{&nonterm74, &state635}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go636 = {{&nonterm73, &state637}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go638 = {{&nonterm72, &state639}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go640 = {{&nonterm71, &state641}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go642 = {{&nonterm70, &state643}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go644 = {{&nonterm69, &state645}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go646 = {{&nonterm68, &state647}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go648 = {{&nonterm67, &state649}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go650 = {{&nonterm66, &state651}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go652 = {{&nonterm65, &state653}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go654 = {{&nonterm64, &state655}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go656 = {{&nonterm63, &state657}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go658 = {{&nonterm62, &state659}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go660 = {{&nonterm61, &state661}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go662 = {{&nonterm60, &state663}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go664 = {{&nonterm59, &state665}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go666 = {{&nonterm58, &state667}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go668 = {{&nonterm57, &state669}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go670 = {{&nonterm56, &state671}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go672 = {{&nonterm55, &state673}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go674 = {{&nonterm54, &state675}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go676 = {{&nonterm53, &state677}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go678 = {{&nonterm52, &state679}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go680 = {{&nonterm51, &state681}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go682 = {{&nonterm50, &state683}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go684 = {{&nonterm49, &state685}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go686 = {{&nonterm48, &state687}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go688 = {{&nonterm47, &state689}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go690 = {{&nonterm46, &state691}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go692 = {{&nonterm45, &state693}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go694 = {{&nonterm44, &state695}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go696 = {{&nonterm43, &state697}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go698 = {{&nonterm42, &state699}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go700 = {{&nonterm41, &state701}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go702 = {{&nonterm40, &state703}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go704 = {{&nonterm39, &state705}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go706 = {{&nonterm38, &state707}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go708 = {{&nonterm37, &state709}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go710 = {{&nonterm36, &state711}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go712 = {{&nonterm35, &state713}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go714 = {{&nonterm34, &state715}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go716 = {{&nonterm33, &state717}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go718 = {{&nonterm32, &state719}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go720 = {{&nonterm31, &state721}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go722 = {{&nonterm30, &state723}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go724 = {{&nonterm29, &state725}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go726 = {{&nonterm28, &state727}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go728 = {{&nonterm27, &state729}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go730 = {{&nonterm26, &state731}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go732 = {{&nonterm25, &state733}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go734 = {{&nonterm24, &state735}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go736 = {{&nonterm23, &state737}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go738 = {{&nonterm22, &state739}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go740 = {{&nonterm21, &state741}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go742 = {{&nonterm20, &state743}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go744 = {{&nonterm19, &state745}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go746 = {{&nonterm18, &state747}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go748 = {{&nonterm17, &state749}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go750 = {{&nonterm16, &state751}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go752 = {{&nonterm15, &state753}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go754 = {{&nonterm14, &state755}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go756 = {{&nonterm13, &state757}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go758 = {{&nonterm12, &state759}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go760 = {{&nonterm11, &state761}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go762 = {{&nonterm10, &state763}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go764 = {{&nonterm9, &state765}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go766 = {{&nonterm8, &state767}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go768 = {{&nonterm7, &state769}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go770 = {{&nonterm6, &state771}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go772 = {{&nonterm5, &state773}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go774 = {{&nonterm4, &state775}, {&nonterm5, &state399}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go776 = {{&nonterm3, &state777}, {&nonterm4, &state398}, {&nonterm5, &state399}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+std::vector<Go> go778 = {{&nonterm2, &state780}, {&nonterm3, &state397}, {&nonterm4, &state398}, {&nonterm5, &state399}, {&nonterm6, &state400}, {&nonterm7, &state401}, {&nonterm8, &state402}, {&nonterm9, &state403}, {&nonterm10, &state404}, {&nonterm11, &state405}, {&nonterm12, &state406}, {&nonterm13, &state407}, {&nonterm14, &state408}, {&nonterm15, &state409}, {&nonterm16, &state410}, {&nonterm17, &state411}, {&nonterm18, &state412}, {&nonterm19, &state413}, {&nonterm20, &state414}, {&nonterm21, &state415}, {&nonterm22, &state416}, {&nonterm23, &state417}, {&nonterm24, &state418}, {&nonterm25, &state419}, {&nonterm26, &state420}, {&nonterm27, &state421}, {&nonterm28, &state422}, {&nonterm29, &state423}, {&nonterm30, &state424}, {&nonterm31, &state425}, {&nonterm32, &state426}, {&nonterm33, &state427}, {&nonterm34, &state428}, {&nonterm35, &state429}, {&nonterm36, &state430}, {&nonterm37, &state431}, {&nonterm38, &state432}, {&nonterm39, &state433}, {&nonterm40, &state434}, {&nonterm41, &state435}, {&nonterm42, &state436}, {&nonterm43, &state437}, {&nonterm44, &state438}, {&nonterm45, &state439}, {&nonterm46, &state440}, {&nonterm47, &state441}, {&nonterm48, &state442}, {&nonterm49, &state443}, {&nonterm50, &state444}, {&nonterm51, &state445}, {&nonterm52, &state446}, {&nonterm53, &state447}, {&nonterm54, &state448}, {&nonterm55, &state449}, {&nonterm56, &state450}, {&nonterm57, &state451}, {&nonterm58, &state452}, {&nonterm59, &state453}, {&nonterm60, &state454}, {&nonterm61, &state455}, {&nonterm62, &state456}, {&nonterm63, &state457}, {&nonterm64, &state458}, {&nonterm65, &state459}, {&nonterm66, &state460}, {&nonterm67, &state461}, {&nonterm68, &state462}, {&nonterm69, &state463}, {&nonterm70, &state464}, {&nonterm71, &state465}, {&nonterm72, &state466}, {&nonterm73, &state467}, {&nonterm74, &state468}, {&nonterm75, &state469}, {&nonterm76, &state470}, {&nonterm77, &state471}, {&nonterm78, &state472}, {&nonterm79, &state473}, {&nonterm80, &state474}, {&nonterm81, &state475}, {&nonterm82, &state476}, {&nonterm83, &state477}, {&nonterm84, &state478}, {&nonterm85, &state479}, {&nonterm86, &state480}, {&nonterm87, &state481}, {&nonterm88, &state482}, {&nonterm89, &state483}, {&nonterm90, &state484}, {&nonterm91, &state485}, {&nonterm92, &state486}, {&nonterm93, &state487}, {&nonterm94, &state488}, {&nonterm95, &state489}, {&nonterm96, &state490}, {&nonterm97, &state491}, {&nonterm98, &state492}, {&nonterm99, &state493}, {&nonterm100, &state494}, {&nonterm101, &state495}, {&nonterm102, &state496}, {&nonterm103, &state497}, {&nonterm104, &state498}, {&nonterm105, &state499}, {&nonterm106, &state500}, {&nonterm107, &state501}, {&nonterm108, &state502}, {&nonterm109, &state503}, {&nonterm110, &state504}, {&nonterm111, &state505}, {&nonterm112, &state506}, {&nonterm113, &state507}, {&nonterm114, &state508}, {&nonterm115, &state509}, {&nonterm116, &state510}, {&nonterm117, &state511}, {&nonterm118, &state512}, {&nonterm119, &state513}, {&nonterm120, &state514}, {&nonterm121, &state515}, {&nonterm122, &state516}, {&nonterm123, &state517}, {&nonterm124, &state518}, {&nonterm125, &state519}, {&nonterm126, &state520}, {&nonterm127, &state521}, {&nonterm128, &state522}, {&nonterm129, &state523}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, nullptr};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift0, &reduce0, &go4};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift40, &reduce40, nullptr};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift48, &reduce48, nullptr};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift72, &reduce72, nullptr};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift80, &reduce80, nullptr};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift88, &reduce88, nullptr};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift96, &reduce96, nullptr};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift104, &reduce104, nullptr};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift106, &reduce106, nullptr};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift120, &reduce120, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift128, &reduce128, nullptr};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift0, &reduce0, &go134};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift0, &reduce0, &go136};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift0, &reduce0, &go138};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift0, &reduce0, &go140};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift0, &reduce0, &go142};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift0, &reduce0, &go144};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift0, &reduce0, &go146};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift0, &reduce0, &go148};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift0, &reduce0, &go150};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift0, &reduce0, &go152};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift0, &reduce0, &go154};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift0, &reduce0, &go156};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift0, &reduce0, &go158};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift0, &reduce0, &go160};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift0, &reduce0, &go162};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift0, &reduce0, &go164};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift0, &reduce0, &go166};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift0, &reduce0, &go168};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift0, &reduce0, &go170};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift0, &reduce0, &go172};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift0, &reduce0, &go174};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift0, &reduce0, &go176};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift0, &reduce0, &go178};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift0, &reduce0, &go180};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift0, &reduce0, &go182};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift0, &reduce0, &go184};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift0, &reduce0, &go186};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift0, &reduce0, &go188};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift0, &reduce0, &go190};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift0, &reduce0, &go192};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift0, &reduce0, &go194};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift0, &reduce0, &go196};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift0, &reduce0, &go198};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift0, &reduce0, &go200};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift0, &reduce0, &go202};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift0, &reduce0, &go204};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift0, &reduce0, &go206};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift0, &reduce0, &go208};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift0, &reduce0, &go210};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift0, &reduce0, &go212};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift0, &reduce0, &go214};
+State state215 = {&shift215, &reduce215, nullptr};
+State state216 = {&shift0, &reduce0, &go216};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift0, &reduce0, &go218};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift0, &reduce0, &go220};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift0, &reduce0, &go222};
+State state223 = {&shift223, &reduce223, nullptr};
+State state224 = {&shift0, &reduce0, &go224};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift0, &reduce0, &go226};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift0, &reduce0, &go228};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift0, &reduce0, &go230};
+State state231 = {&shift231, &reduce231, nullptr};
+State state232 = {&shift0, &reduce0, &go232};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift0, &reduce0, &go234};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift0, &reduce0, &go236};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift0, &reduce0, &go238};
+State state239 = {&shift239, &reduce239, nullptr};
+State state240 = {&shift0, &reduce0, &go240};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift0, &reduce0, &go242};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift0, &reduce0, &go244};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift0, &reduce0, &go246};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift0, &reduce0, &go248};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift0, &reduce0, &go250};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift0, &reduce0, &go252};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift0, &reduce0, &go254};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift0, &reduce0, &go256};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift0, &reduce0, &go258};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift0, &reduce0, &go260};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift0, &reduce0, &go262};
+State state263 = {&shift263, &reduce263, nullptr};
+State state264 = {&shift0, &reduce0, &go264};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift0, &reduce0, &go266};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift0, &reduce0, &go268};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift0, &reduce0, &go270};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift0, &reduce0, &go272};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift0, &reduce0, &go274};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift0, &reduce0, &go276};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift0, &reduce0, &go278};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift0, &reduce0, &go280};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift0, &reduce0, &go282};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift0, &reduce0, &go284};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift0, &reduce0, &go286};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift0, &reduce0, &go288};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift0, &reduce0, &go290};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift0, &reduce0, &go292};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift0, &reduce0, &go294};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift0, &reduce0, &go296};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift0, &reduce0, &go298};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift0, &reduce0, &go300};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift0, &reduce0, &go302};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift0, &reduce0, &go304};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift0, &reduce0, &go306};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift0, &reduce0, &go308};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift0, &reduce0, &go310};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift0, &reduce0, &go312};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift0, &reduce0, &go314};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift0, &reduce0, &go316};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift0, &reduce0, &go318};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift0, &reduce0, &go320};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift0, &reduce0, &go322};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift0, &reduce0, &go324};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift0, &reduce0, &go326};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift0, &reduce0, &go328};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift0, &reduce0, &go330};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift0, &reduce0, &go332};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift0, &reduce0, &go334};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift0, &reduce0, &go336};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift0, &reduce0, &go338};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift0, &reduce0, &go340};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift0, &reduce0, &go342};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift0, &reduce0, &go344};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift0, &reduce0, &go346};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift0, &reduce0, &go348};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift0, &reduce0, &go350};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift0, &reduce0, &go352};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift0, &reduce0, &go354};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift0, &reduce0, &go356};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift0, &reduce0, &go358};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift0, &reduce0, &go360};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift0, &reduce0, &go362};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift0, &reduce0, &go364};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift0, &reduce0, &go366};
+State state367 = {&shift367, &reduce367, nullptr};
+State state368 = {&shift0, &reduce0, &go368};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift0, &reduce0, &go370};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift0, &reduce0, &go372};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift0, &reduce0, &go374};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift0, &reduce0, &go376};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift0, &reduce0, &go378};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift0, &reduce0, &go380};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift0, &reduce0, &go382};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift0, &reduce0, &go384};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift0, &reduce0, &go386};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift0, &reduce0, &go388};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift1, &reduce1, nullptr};
+State state392 = {&shift2, &reduce2, nullptr};
+State state393 = {&shift3, &reduce3, &go393};
+State state394 = {&shift3, &reduce3, &go394};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift399, &reduce399, nullptr};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, nullptr};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift403, &reduce403, nullptr};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift407, &reduce407, nullptr};
+State state408 = {&shift408, &reduce408, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, nullptr};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift412, &reduce412, nullptr};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift416, &reduce416, nullptr};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, nullptr};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift421, &reduce421, nullptr};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift424, &reduce424, nullptr};
+State state425 = {&shift425, &reduce425, nullptr};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, nullptr};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift430, &reduce430, nullptr};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift432, &reduce432, nullptr};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift434, &reduce434, nullptr};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, nullptr};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift439, &reduce439, nullptr};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift443, &reduce443, nullptr};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, nullptr};
+State state447 = {&shift447, &reduce447, nullptr};
+State state448 = {&shift448, &reduce448, nullptr};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift452, &reduce452, nullptr};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, nullptr};
+State state456 = {&shift456, &reduce456, nullptr};
+State state457 = {&shift457, &reduce457, nullptr};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift461, &reduce461, nullptr};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, nullptr};
+State state464 = {&shift464, &reduce464, nullptr};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift466, &reduce466, nullptr};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift470, &reduce470, nullptr};
+State state471 = {&shift471, &reduce471, nullptr};
+State state472 = {&shift472, &reduce472, nullptr};
+State state473 = {&shift473, &reduce473, nullptr};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift475, &reduce475, nullptr};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift479, &reduce479, nullptr};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, nullptr};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift484, &reduce484, nullptr};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift488, &reduce488, nullptr};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, nullptr};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift493, &reduce493, nullptr};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift497, &reduce497, nullptr};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, nullptr};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift502, &reduce502, nullptr};
+State state503 = {&shift503, &reduce503, nullptr};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift506, &reduce506, nullptr};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, nullptr};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift511, &reduce511, nullptr};
+State state512 = {&shift512, &reduce512, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift515, &reduce515, nullptr};
+State state516 = {&shift516, &reduce516, nullptr};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, nullptr};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift520, &reduce520, nullptr};
+State state521 = {&shift521, &reduce521, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift133, &reduce133, nullptr};
+State state524 = {&shift3, &reduce3, &go524};
+State state525 = {&shift135, &reduce135, nullptr};
+State state526 = {&shift3, &reduce3, &go526};
+State state527 = {&shift527, &reduce527, nullptr};
+State state528 = {&shift3, &reduce3, &go528};
+State state529 = {&shift529, &reduce529, nullptr};
+State state530 = {&shift3, &reduce3, &go530};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift3, &reduce3, &go532};
+State state533 = {&shift533, &reduce533, nullptr};
+State state534 = {&shift3, &reduce3, &go534};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift3, &reduce3, &go536};
+State state537 = {&shift537, &reduce537, nullptr};
+State state538 = {&shift3, &reduce3, &go538};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift3, &reduce3, &go540};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift3, &reduce3, &go542};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift3, &reduce3, &go544};
+State state545 = {&shift545, &reduce545, nullptr};
+State state546 = {&shift3, &reduce3, &go546};
+State state547 = {&shift547, &reduce547, nullptr};
+State state548 = {&shift3, &reduce3, &go548};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift3, &reduce3, &go550};
+State state551 = {&shift551, &reduce551, nullptr};
+State state552 = {&shift3, &reduce3, &go552};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift3, &reduce3, &go554};
+State state555 = {&shift555, &reduce555, nullptr};
+State state556 = {&shift3, &reduce3, &go556};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift3, &reduce3, &go558};
+State state559 = {&shift559, &reduce559, nullptr};
+State state560 = {&shift3, &reduce3, &go560};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift3, &reduce3, &go562};
+State state563 = {&shift563, &reduce563, nullptr};
+State state564 = {&shift3, &reduce3, &go564};
+State state565 = {&shift565, &reduce565, nullptr};
+State state566 = {&shift3, &reduce3, &go566};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift3, &reduce3, &go568};
+State state569 = {&shift569, &reduce569, nullptr};
+State state570 = {&shift3, &reduce3, &go570};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift3, &reduce3, &go572};
+State state573 = {&shift573, &reduce573, nullptr};
+State state574 = {&shift3, &reduce3, &go574};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift3, &reduce3, &go576};
+State state577 = {&shift577, &reduce577, nullptr};
+State state578 = {&shift3, &reduce3, &go578};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift3, &reduce3, &go580};
+State state581 = {&shift581, &reduce581, nullptr};
+State state582 = {&shift3, &reduce3, &go582};
+State state583 = {&shift583, &reduce583, nullptr};
+State state584 = {&shift3, &reduce3, &go584};
+State state585 = {&shift585, &reduce585, nullptr};
+State state586 = {&shift3, &reduce3, &go586};
+State state587 = {&shift587, &reduce587, nullptr};
+State state588 = {&shift3, &reduce3, &go588};
+State state589 = {&shift589, &reduce589, nullptr};
+State state590 = {&shift3, &reduce3, &go590};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift3, &reduce3, &go592};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift3, &reduce3, &go594};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift3, &reduce3, &go596};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift3, &reduce3, &go598};
+State state599 = {&shift599, &reduce599, nullptr};
+State state600 = {&shift3, &reduce3, &go600};
+State state601 = {&shift601, &reduce601, nullptr};
+State state602 = {&shift3, &reduce3, &go602};
+State state603 = {&shift603, &reduce603, nullptr};
+State state604 = {&shift3, &reduce3, &go604};
+State state605 = {&shift605, &reduce605, nullptr};
+State state606 = {&shift3, &reduce3, &go606};
+State state607 = {&shift607, &reduce607, nullptr};
+State state608 = {&shift3, &reduce3, &go608};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift3, &reduce3, &go610};
+State state611 = {&shift611, &reduce611, nullptr};
+State state612 = {&shift3, &reduce3, &go612};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift3, &reduce3, &go614};
+State state615 = {&shift615, &reduce615, nullptr};
+State state616 = {&shift3, &reduce3, &go616};
+State state617 = {&shift617, &reduce617, nullptr};
+State state618 = {&shift3, &reduce3, &go618};
+State state619 = {&shift619, &reduce619, nullptr};
+State state620 = {&shift3, &reduce3, &go620};
+State state621 = {&shift621, &reduce621, nullptr};
+State state622 = {&shift3, &reduce3, &go622};
+State state623 = {&shift623, &reduce623, nullptr};
+State state624 = {&shift3, &reduce3, &go624};
+State state625 = {&shift625, &reduce625, nullptr};
+State state626 = {&shift3, &reduce3, &go626};
+State state627 = {&shift627, &reduce627, nullptr};
+State state628 = {&shift3, &reduce3, &go628};
+State state629 = {&shift629, &reduce629, nullptr};
+State state630 = {&shift3, &reduce3, &go630};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift3, &reduce3, &go632};
+State state633 = {&shift633, &reduce633, nullptr};
+State state634 = {&shift3, &reduce3, &go634};
+State state635 = {&shift635, &reduce635, nullptr};
+State state636 = {&shift3, &reduce3, &go636};
+State state637 = {&shift637, &reduce637, nullptr};
+State state638 = {&shift3, &reduce3, &go638};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift3, &reduce3, &go640};
+State state641 = {&shift641, &reduce641, nullptr};
+State state642 = {&shift3, &reduce3, &go642};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift3, &reduce3, &go644};
+State state645 = {&shift645, &reduce645, nullptr};
+State state646 = {&shift3, &reduce3, &go646};
+State state647 = {&shift647, &reduce647, nullptr};
+State state648 = {&shift3, &reduce3, &go648};
+State state649 = {&shift649, &reduce649, nullptr};
+State state650 = {&shift3, &reduce3, &go650};
+State state651 = {&shift651, &reduce651, nullptr};
+State state652 = {&shift3, &reduce3, &go652};
+State state653 = {&shift653, &reduce653, nullptr};
+State state654 = {&shift3, &reduce3, &go654};
+State state655 = {&shift655, &reduce655, nullptr};
+State state656 = {&shift3, &reduce3, &go656};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift3, &reduce3, &go658};
+State state659 = {&shift659, &reduce659, nullptr};
+State state660 = {&shift3, &reduce3, &go660};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift3, &reduce3, &go662};
+State state663 = {&shift663, &reduce663, nullptr};
+State state664 = {&shift3, &reduce3, &go664};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift3, &reduce3, &go666};
+State state667 = {&shift667, &reduce667, nullptr};
+State state668 = {&shift3, &reduce3, &go668};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift3, &reduce3, &go670};
+State state671 = {&shift671, &reduce671, nullptr};
+State state672 = {&shift3, &reduce3, &go672};
+State state673 = {&shift673, &reduce673, nullptr};
+State state674 = {&shift3, &reduce3, &go674};
+State state675 = {&shift675, &reduce675, nullptr};
+State state676 = {&shift3, &reduce3, &go676};
+State state677 = {&shift677, &reduce677, nullptr};
+State state678 = {&shift3, &reduce3, &go678};
+State state679 = {&shift679, &reduce679, nullptr};
+State state680 = {&shift3, &reduce3, &go680};
+State state681 = {&shift681, &reduce681, nullptr};
+State state682 = {&shift3, &reduce3, &go682};
+State state683 = {&shift683, &reduce683, nullptr};
+State state684 = {&shift3, &reduce3, &go684};
+State state685 = {&shift685, &reduce685, nullptr};
+State state686 = {&shift3, &reduce3, &go686};
+State state687 = {&shift687, &reduce687, nullptr};
+State state688 = {&shift3, &reduce3, &go688};
+State state689 = {&shift689, &reduce689, nullptr};
+State state690 = {&shift3, &reduce3, &go690};
+State state691 = {&shift691, &reduce691, nullptr};
+State state692 = {&shift3, &reduce3, &go692};
+State state693 = {&shift693, &reduce693, nullptr};
+State state694 = {&shift3, &reduce3, &go694};
+State state695 = {&shift695, &reduce695, nullptr};
+State state696 = {&shift3, &reduce3, &go696};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift3, &reduce3, &go698};
+State state699 = {&shift699, &reduce699, nullptr};
+State state700 = {&shift3, &reduce3, &go700};
+State state701 = {&shift701, &reduce701, nullptr};
+State state702 = {&shift3, &reduce3, &go702};
+State state703 = {&shift703, &reduce703, nullptr};
+State state704 = {&shift3, &reduce3, &go704};
+State state705 = {&shift705, &reduce705, nullptr};
+State state706 = {&shift3, &reduce3, &go706};
+State state707 = {&shift707, &reduce707, nullptr};
+State state708 = {&shift3, &reduce3, &go708};
+State state709 = {&shift709, &reduce709, nullptr};
+State state710 = {&shift3, &reduce3, &go710};
+State state711 = {&shift711, &reduce711, nullptr};
+State state712 = {&shift3, &reduce3, &go712};
+State state713 = {&shift713, &reduce713, nullptr};
+State state714 = {&shift3, &reduce3, &go714};
+State state715 = {&shift715, &reduce715, nullptr};
+State state716 = {&shift3, &reduce3, &go716};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift3, &reduce3, &go718};
+State state719 = {&shift719, &reduce719, nullptr};
+State state720 = {&shift3, &reduce3, &go720};
+State state721 = {&shift721, &reduce721, nullptr};
+State state722 = {&shift3, &reduce3, &go722};
+State state723 = {&shift723, &reduce723, nullptr};
+State state724 = {&shift3, &reduce3, &go724};
+State state725 = {&shift725, &reduce725, nullptr};
+State state726 = {&shift3, &reduce3, &go726};
+State state727 = {&shift727, &reduce727, nullptr};
+State state728 = {&shift3, &reduce3, &go728};
+State state729 = {&shift729, &reduce729, nullptr};
+State state730 = {&shift3, &reduce3, &go730};
+State state731 = {&shift731, &reduce731, nullptr};
+State state732 = {&shift3, &reduce3, &go732};
+State state733 = {&shift733, &reduce733, nullptr};
+State state734 = {&shift3, &reduce3, &go734};
+State state735 = {&shift735, &reduce735, nullptr};
+State state736 = {&shift3, &reduce3, &go736};
+State state737 = {&shift737, &reduce737, nullptr};
+State state738 = {&shift3, &reduce3, &go738};
+State state739 = {&shift739, &reduce739, nullptr};
+State state740 = {&shift3, &reduce3, &go740};
+State state741 = {&shift741, &reduce741, nullptr};
+State state742 = {&shift3, &reduce3, &go742};
+State state743 = {&shift743, &reduce743, nullptr};
+State state744 = {&shift3, &reduce3, &go744};
+State state745 = {&shift745, &reduce745, nullptr};
+State state746 = {&shift3, &reduce3, &go746};
+State state747 = {&shift747, &reduce747, nullptr};
+State state748 = {&shift3, &reduce3, &go748};
+State state749 = {&shift749, &reduce749, nullptr};
+State state750 = {&shift3, &reduce3, &go750};
+State state751 = {&shift751, &reduce751, nullptr};
+State state752 = {&shift3, &reduce3, &go752};
+State state753 = {&shift753, &reduce753, nullptr};
+State state754 = {&shift3, &reduce3, &go754};
+State state755 = {&shift755, &reduce755, nullptr};
+State state756 = {&shift3, &reduce3, &go756};
+State state757 = {&shift757, &reduce757, nullptr};
+State state758 = {&shift3, &reduce3, &go758};
+State state759 = {&shift759, &reduce759, nullptr};
+State state760 = {&shift3, &reduce3, &go760};
+State state761 = {&shift761, &reduce761, nullptr};
+State state762 = {&shift3, &reduce3, &go762};
+State state763 = {&shift763, &reduce763, nullptr};
+State state764 = {&shift3, &reduce3, &go764};
+State state765 = {&shift765, &reduce765, nullptr};
+State state766 = {&shift3, &reduce3, &go766};
+State state767 = {&shift767, &reduce767, nullptr};
+State state768 = {&shift3, &reduce3, &go768};
+State state769 = {&shift769, &reduce769, nullptr};
+State state770 = {&shift3, &reduce3, &go770};
+State state771 = {&shift771, &reduce771, nullptr};
+State state772 = {&shift3, &reduce3, &go772};
+State state773 = {&shift773, &reduce773, nullptr};
+State state774 = {&shift3, &reduce3, &go774};
+State state775 = {&shift775, &reduce775, nullptr};
+State state776 = {&shift3, &reduce3, &go776};
+State state777 = {&shift777, &reduce777, nullptr};
+State state778 = {&shift3, &reduce3, &go778};
+State state779 = {&shift779, &reduce779, nullptr};
+State state780 = {&shift780, &reduce780, nullptr};
+State state781 = {&shift390, &reduce390, nullptr};
+State state782 = {&shift782, &reduce782, nullptr};
+State state783 = {&shift779, &reduce779, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,275 @@
+#include "synth.hpp"
+
+std::unique_ptr<Tree>
+reduce_expr_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e0_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e0_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e1_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e1_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e2_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e2_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e3_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e3_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e4_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e4_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e5_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e5_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e6_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e6_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e7_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e7_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e8_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e8_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e9_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e9_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e10_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e10_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e11_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e11_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e12_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e12_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e13_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e13_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e14_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e14_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e15_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e15_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e16_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e16_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e16_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_e16_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
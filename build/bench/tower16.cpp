@@ -0,0 +1,1053 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"#0", false, 3};
+Symbol term4 = {"#1", false, 4};
+Symbol term5 = {"#2", false, 5};
+Symbol term6 = {"#3", false, 6};
+Symbol term7 = {"#4", false, 7};
+Symbol term8 = {"#5", false, 8};
+Symbol term9 = {"#6", false, 9};
+Symbol term10 = {"#7", false, 10};
+Symbol term11 = {"#8", false, 11};
+Symbol term12 = {"#9", false, 12};
+Symbol term13 = {"#10", false, 13};
+Symbol term14 = {"#11", false, 14};
+Symbol term15 = {"#12", false, 15};
+Symbol term16 = {"#13", false, 16};
+Symbol term17 = {"#14", false, 17};
+Symbol term18 = {"#15", false, 18};
+Symbol term19 = {"(", false, 19};
+Symbol term20 = {")", false, 20};
+Symbol term21 = {"-", false, 21};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 6, 7, 7, 7, 7, 8, 9, 10, 10, 10, 11, 12, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 26 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node8; }
+    if (k == 14) { return &node9; }
+    if (k == 15) { return &node10; }
+    if (k == 16) { return &node11; }
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node18; }
+    if (k == 14) { return &node19; }
+    if (k == 15) { return &node20; }
+    if (k == 16) { return &node21; }
+    if (k == 17) { return &node22; }
+    if (k == 18) { return &node23; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, nullptr, nullptr};
+Node node3 = {nullptr, &term19, nullptr};
+Node node4 = {nullptr, &term20, nullptr};
+Node node5 = {nullptr, &term21, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term2, nullptr};
+Node node8 = {nullptr, &term3, nullptr};
+Node node9 = {&next9, &term4, nullptr};
+Node node10 = {nullptr, &term5, nullptr};
+Node node11 = {nullptr, &term6, nullptr};
+Node node12 = {nullptr, &term7, nullptr};
+Node node13 = {nullptr, &term8, nullptr};
+Node node14 = {nullptr, &term9, nullptr};
+Node node15 = {nullptr, &term10, nullptr};
+Node node16 = {nullptr, &term11, nullptr};
+Node node17 = {nullptr, &term12, nullptr};
+Node node18 = {nullptr, &term13, nullptr};
+Node node19 = {nullptr, &term14, nullptr};
+Node node20 = {nullptr, &term15, nullptr};
+Node node21 = {nullptr, &term16, nullptr};
+Node node22 = {nullptr, &term17, nullptr};
+Node node23 = {nullptr, &term18, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 22};
+Symbol nonterm0 = {"expr", false, 0};
+Symbol nonterm1 = {"e0", false, 1};
+Symbol nonterm2 = {"e1", false, 2};
+Symbol nonterm3 = {"e2", false, 3};
+Symbol nonterm4 = {"e3", false, 4};
+Symbol nonterm5 = {"e4", false, 5};
+Symbol nonterm6 = {"e5", false, 6};
+Symbol nonterm7 = {"e6", false, 7};
+Symbol nonterm8 = {"e7", false, 8};
+Symbol nonterm9 = {"e8", false, 9};
+Symbol nonterm10 = {"e9", false, 10};
+Symbol nonterm11 = {"e10", false, 11};
+Symbol nonterm12 = {"e11", false, 12};
+Symbol nonterm13 = {"e12", false, 13};
+Symbol nonterm14 = {"e13", false, 14};
+Symbol nonterm15 = {"e14", false, 15};
+Symbol nonterm16 = {"e15", false, 16};
+Symbol nonterm17 = {"e16", false, 17};
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_0(Table*);
+
+Value*
+reduce_e16_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e16_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_1(Table*);
+
+Value*
+reduce_e16_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e16_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_e16_2(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_3(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_3(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_expr_0, -1};
+Rule rule1 = {&nonterm1, 1, &reduce_e0_0, -1};
+Rule rule2 = {&nonterm1, 3, &reduce_e0_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_e1_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_e1_1, -1};
+Rule rule5 = {&nonterm3, 1, &reduce_e2_0, -1};
+Rule rule6 = {&nonterm3, 3, &reduce_e2_1, -1};
+Rule rule7 = {&nonterm4, 1, &reduce_e3_0, -1};
+Rule rule8 = {&nonterm4, 3, &reduce_e3_1, -1};
+Rule rule9 = {&nonterm5, 1, &reduce_e4_0, -1};
+Rule rule10 = {&nonterm5, 3, &reduce_e4_1, -1};
+Rule rule11 = {&nonterm6, 1, &reduce_e5_0, -1};
+Rule rule12 = {&nonterm6, 3, &reduce_e5_1, -1};
+Rule rule13 = {&nonterm7, 1, &reduce_e6_0, -1};
+Rule rule14 = {&nonterm7, 3, &reduce_e6_1, -1};
+Rule rule15 = {&nonterm8, 1, &reduce_e7_0, -1};
+Rule rule16 = {&nonterm8, 3, &reduce_e7_1, -1};
+Rule rule17 = {&nonterm9, 1, &reduce_e8_0, -1};
+Rule rule18 = {&nonterm9, 3, &reduce_e8_1, -1};
+Rule rule19 = {&nonterm10, 1, &reduce_e9_0, -1};
+Rule rule20 = {&nonterm10, 3, &reduce_e9_1, -1};
+Rule rule21 = {&nonterm11, 1, &reduce_e10_0, -1};
+Rule rule22 = {&nonterm11, 3, &reduce_e10_1, -1};
+Rule rule23 = {&nonterm12, 1, &reduce_e11_0, -1};
+Rule rule24 = {&nonterm12, 3, &reduce_e11_1, -1};
+Rule rule25 = {&nonterm13, 1, &reduce_e12_0, -1};
+Rule rule26 = {&nonterm13, 3, &reduce_e12_1, -1};
+Rule rule27 = {&nonterm14, 1, &reduce_e13_0, -1};
+Rule rule28 = {&nonterm14, 3, &reduce_e13_1, -1};
+Rule rule29 = {&nonterm15, 1, &reduce_e14_0, -1};
+Rule rule30 = {&nonterm15, 3, &reduce_e14_1, -1};
+Rule rule31 = {&nonterm16, 1, &reduce_e15_0, -1};
+Rule rule32 = {&nonterm16, 3, &reduce_e15_1, -1};
+Rule rule33 = {&nonterm17, 1, &reduce_e16_0, -1};
+Rule rule34 = {&nonterm17, 1, &reduce_e16_1, -1};
+Rule rule35 = {&nonterm17, 3, &reduce_e16_2, -1};
+Rule rule36 = {&nonterm17, 2, &reduce_e16_3, -1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6, &rule7,
+    &rule8, &rule9, &rule10, &rule11, &rule12, &rule13, &rule14, &rule15,
+    &rule16, &rule17, &rule18, &rule19, &rule20, &rule21, &rule22, &rule23,
+    &rule24, &rule25, &rule26, &rule27, &rule28, &rule29, &rule30, &rule31,
+    &rule32, &rule33, &rule34, &rule35, &rule36
+};
+
+State parse_states[112] = {
+    {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 0}, {5, 4}, {6, 5}, {7, 6},
+    {8, 7}, {9, 8}, {10, 9}, {11, 10}, {12, 11}, {13, 12}, {14, 13}, {15, 14},
+    {16, 15}, {17, 16}, {18, 17}, {19, 18}, {20, 19}, {21, 20}, {22, 0}, {23, 21},
+    {24, 0}, {25, 22}, {26, 0}, {27, 23}, {28, 0}, {29, 24}, {30, 0}, {31, 25},
+    {32, 0}, {33, 26}, {34, 0}, {35, 27}, {36, 0}, {37, 28}, {38, 0}, {39, 29},
+    {40, 0}, {41, 30}, {42, 0}, {43, 31}, {44, 0}, {45, 32}, {46, 0}, {47, 33},
+    {48, 0}, {49, 34}, {50, 0}, {51, 35}, {52, 0}, {53, 36}, {54, 37}, {55, 1},
+    {56, 2}, {57, 3}, {58, 3}, {59, 38}, {60, 39}, {61, 40}, {62, 41}, {63, 42},
+    {64, 43}, {65, 44}, {66, 45}, {67, 46}, {68, 47}, {69, 48}, {70, 49}, {71, 50},
+    {72, 51}, {73, 52}, {74, 53}, {75, 20}, {76, 3}, {77, 21}, {78, 3}, {79, 54},
+    {80, 3}, {81, 55}, {82, 3}, {83, 56}, {84, 3}, {85, 57}, {86, 3}, {87, 58},
+    {88, 3}, {89, 59}, {90, 3}, {91, 60}, {92, 3}, {93, 61}, {94, 3}, {95, 62},
+    {96, 3}, {97, 63}, {98, 3}, {99, 64}, {100, 3}, {101, 65}, {102, 3}, {103, 66},
+    {104, 3}, {105, 67}, {106, 3}, {107, 68}, {108, 69}, {109, 37}, {110, 70}, {111, 68}
+};
+
+unsigned char action_base[] = {
+    0, 0, 0, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 10, 10, 10, 0, 0, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29,
+    31, 33, 35, 37, 39, 0, 4, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59,
+    61, 63, 65, 67, 0, 69, 5
+};
+
+unsigned short action_default[] = {
+    0, 134, 138, 0, 0, 6, 14, 22, 30, 38, 46, 54, 62, 70, 78, 86,
+    94, 102, 110, 118, 126, 130, 122, 114, 106, 98, 90, 82, 74, 66, 58, 50,
+    42, 34, 26, 18, 10, 146, 0, 6, 14, 22, 30, 38, 46, 54, 62, 70,
+    78, 86, 94, 102, 110, 118, 122, 114, 106, 98, 90, 82, 74, 66, 58, 50,
+    42, 34, 26, 18, 142, 10, 0
+};
+
+unsigned char action_check[] = {
+    0, 3, 0, 3, 4, 5, 6, 38, 70, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 0, 3, 0, 3, 4, 38, 70, 17, 18, 19, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 39, 40, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 69, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71
+};
+
+unsigned short action_next[] = {
+    5, 221, 9, 225, 209, 201, 193, 425, 425, 185, 177, 169, 161, 153, 145, 137,
+    129, 121, 113, 13, 229, 17, 233, 3, 429, 445, 105, 97, 89, 89, 97, 105,
+    113, 121, 129, 137, 145, 153, 161, 169, 177, 185, 193, 201, 417, 409, 401, 393,
+    385, 377, 369, 361, 353, 345, 337, 329, 321, 313, 305, 305, 313, 321, 329, 337,
+    345, 353, 361, 369, 377, 385, 393, 401, 409, 417, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+unsigned short goto_base[] = {
+    0, 0, 217, 215, 211, 166, 157, 158, 146, 147, 132, 131, 77, 78, 55, 54,
+    1, 0
+};
+
+unsigned char goto_default[] = {
+    0, 5, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75
+};
+
+unsigned char goto_check[] = {
+    17, 16, 18, 1, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 17, 18, 17, 16, 17, 16, 17, 16, 17, 16,
+    17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16,
+    17, 16, 17, 16, 17, 16, 15, 14, 18, 1, 17, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 17, 12, 13, 16,
+    15, 18, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 11, 10, 18, 15, 18, 18, 14, 18, 18, 18, 18, 18, 18,
+    18, 18, 8, 9, 18, 18, 18, 18, 18, 18, 18, 18, 18, 6, 7, 18,
+    18, 18, 13, 12, 18, 11, 5, 11, 10, 11, 10, 11, 10, 11, 10, 11,
+    10, 11, 10, 11, 10, 11, 10, 11, 10, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 4, 5, 18, 5, 3, 5, 2, 5, 11, 18, 18, 10, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 9,
+    8, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 7, 6,
+    18, 18, 18, 4, 18, 4, 18, 4, 18, 3, 5, 3, 18, 2, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 18, 18, 18, 18, 18, 3,
+    18, 18, 18, 2, 18, 18, 18, 18, 18
+};
+
+unsigned char goto_next[] = {
+    21, 20, 0, 59, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 0, 21, 25, 21, 20, 21, 20, 21, 20,
+    21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+    21, 20, 21, 20, 21, 20, 19, 18, 0, 110, 109, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 16, 17, 79,
+    27, 0, 19, 29, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18,
+    19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 19, 18, 31, 33, 17, 16,
+    17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16, 17, 16,
+    17, 16, 17, 15, 14, 0, 81, 0, 0, 83, 0, 0, 0, 0, 0, 0,
+    0, 0, 12, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 11, 0,
+    0, 0, 85, 87, 0, 35, 9, 15, 37, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 39, 41, 13, 12, 13, 12, 13,
+    12, 13, 12, 13, 12, 13, 12, 13, 43, 45, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 8, 47, 0, 9, 7, 9, 6, 9, 89, 0, 0, 91, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 99,
+    0, 0, 0, 49, 0, 8, 0, 8, 0, 51, 101, 7, 0, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 105,
+    0, 0, 0, 108, 0, 0, 0, 0, 0
+};
+
+/* Comb tables of 2097 bytes, 27.5341% of the 7616 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,2150 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"#0", false, 3};
+Symbol term4 = {"#1", false, 4};
+Symbol term5 = {"#2", false, 5};
+Symbol term6 = {"#3", false, 6};
+Symbol term7 = {"#4", false, 7};
+Symbol term8 = {"#5", false, 8};
+Symbol term9 = {"#6", false, 9};
+Symbol term10 = {"#7", false, 10};
+Symbol term11 = {"#8", false, 11};
+Symbol term12 = {"#9", false, 12};
+Symbol term13 = {"#10", false, 13};
+Symbol term14 = {"#11", false, 14};
+Symbol term15 = {"#12", false, 15};
+Symbol term16 = {"#13", false, 16};
+Symbol term17 = {"#14", false, 17};
+Symbol term18 = {"#15", false, 18};
+Symbol term19 = {"#16", false, 19};
+Symbol term20 = {"#17", false, 20};
+Symbol term21 = {"#18", false, 21};
+Symbol term22 = {"#19", false, 22};
+Symbol term23 = {"#20", false, 23};
+Symbol term24 = {"#21", false, 24};
+Symbol term25 = {"#22", false, 25};
+Symbol term26 = {"#23", false, 26};
+Symbol term27 = {"#24", false, 27};
+Symbol term28 = {"#25", false, 28};
+Symbol term29 = {"#26", false, 29};
+Symbol term30 = {"#27", false, 30};
+Symbol term31 = {"#28", false, 31};
+Symbol term32 = {"#29", false, 32};
+Symbol term33 = {"#30", false, 33};
+Symbol term34 = {"#31", false, 34};
+Symbol term35 = {"(", false, 35};
+Symbol term36 = {")", false, 36};
+Symbol term37 = {"-", false, 37};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 6, 7, 7, 7, 7, 8, 9, 10, 10, 10, 11, 12, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 26 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node8; }
+    if (k == 14) { return &node9; }
+    if (k == 15) { return &node10; }
+    if (k == 16) { return &node11; }
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node30; }
+    if (k == 14) { return &node31; }
+    if (k == 15) { return &node32; }
+    if (k == 16) { return &node33; }
+    if (k == 17) { return &node34; }
+    if (k == 18) { return &node35; }
+    if (k == 19) { return &node36; }
+    if (k == 20) { return &node37; }
+    if (k == 21) { return &node38; }
+    if (k == 22) { return &node39; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node20; }
+    if (k == 14) { return &node21; }
+    if (k == 15) { return &node22; }
+    if (k == 16) { return &node23; }
+    if (k == 17) { return &node24; }
+    if (k == 18) { return &node25; }
+    if (k == 19) { return &node26; }
+    if (k == 20) { return &node27; }
+    if (k == 21) { return &node28; }
+    if (k == 22) { return &node29; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node18; }
+    if (k == 14) { return &node19; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, nullptr, nullptr};
+Node node3 = {nullptr, &term35, nullptr};
+Node node4 = {nullptr, &term36, nullptr};
+Node node5 = {nullptr, &term37, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term2, nullptr};
+Node node8 = {nullptr, &term3, nullptr};
+Node node9 = {&next9, &term4, nullptr};
+Node node10 = {&next10, &term5, nullptr};
+Node node11 = {&next11, &term6, nullptr};
+Node node12 = {nullptr, &term7, nullptr};
+Node node13 = {nullptr, &term8, nullptr};
+Node node14 = {nullptr, &term9, nullptr};
+Node node15 = {nullptr, &term10, nullptr};
+Node node16 = {nullptr, &term11, nullptr};
+Node node17 = {nullptr, &term12, nullptr};
+Node node18 = {nullptr, &term33, nullptr};
+Node node19 = {nullptr, &term34, nullptr};
+Node node20 = {nullptr, &term23, nullptr};
+Node node21 = {nullptr, &term24, nullptr};
+Node node22 = {nullptr, &term25, nullptr};
+Node node23 = {nullptr, &term26, nullptr};
+Node node24 = {nullptr, &term27, nullptr};
+Node node25 = {nullptr, &term28, nullptr};
+Node node26 = {nullptr, &term29, nullptr};
+Node node27 = {nullptr, &term30, nullptr};
+Node node28 = {nullptr, &term31, nullptr};
+Node node29 = {nullptr, &term32, nullptr};
+Node node30 = {nullptr, &term13, nullptr};
+Node node31 = {nullptr, &term14, nullptr};
+Node node32 = {nullptr, &term15, nullptr};
+Node node33 = {nullptr, &term16, nullptr};
+Node node34 = {nullptr, &term17, nullptr};
+Node node35 = {nullptr, &term18, nullptr};
+Node node36 = {nullptr, &term19, nullptr};
+Node node37 = {nullptr, &term20, nullptr};
+Node node38 = {nullptr, &term21, nullptr};
+Node node39 = {nullptr, &term22, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 38};
+Symbol nonterm0 = {"expr", false, 0};
+Symbol nonterm1 = {"e0", false, 1};
+Symbol nonterm2 = {"e1", false, 2};
+Symbol nonterm3 = {"e2", false, 3};
+Symbol nonterm4 = {"e3", false, 4};
+Symbol nonterm5 = {"e4", false, 5};
+Symbol nonterm6 = {"e5", false, 6};
+Symbol nonterm7 = {"e6", false, 7};
+Symbol nonterm8 = {"e7", false, 8};
+Symbol nonterm9 = {"e8", false, 9};
+Symbol nonterm10 = {"e9", false, 10};
+Symbol nonterm11 = {"e10", false, 11};
+Symbol nonterm12 = {"e11", false, 12};
+Symbol nonterm13 = {"e12", false, 13};
+Symbol nonterm14 = {"e13", false, 14};
+Symbol nonterm15 = {"e14", false, 15};
+Symbol nonterm16 = {"e15", false, 16};
+Symbol nonterm17 = {"e16", false, 17};
+Symbol nonterm18 = {"e17", false, 18};
+Symbol nonterm19 = {"e18", false, 19};
+Symbol nonterm20 = {"e19", false, 20};
+Symbol nonterm21 = {"e20", false, 21};
+Symbol nonterm22 = {"e21", false, 22};
+Symbol nonterm23 = {"e22", false, 23};
+Symbol nonterm24 = {"e23", false, 24};
+Symbol nonterm25 = {"e24", false, 25};
+Symbol nonterm26 = {"e25", false, 26};
+Symbol nonterm27 = {"e26", false, 27};
+Symbol nonterm28 = {"e27", false, 28};
+Symbol nonterm29 = {"e28", false, 29};
+Symbol nonterm30 = {"e29", false, 30};
+Symbol nonterm31 = {"e30", false, 31};
+Symbol nonterm32 = {"e31", false, 32};
+Symbol nonterm33 = {"e32", false, 33};
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_0(Table*);
+
+Value*
+reduce_e32_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e32_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_1(Table*);
+
+Value*
+reduce_e32_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e32_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_e32_2(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_3(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e32_3(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_expr_0, -1};
+Rule rule1 = {&nonterm1, 1, &reduce_e0_0, -1};
+Rule rule2 = {&nonterm1, 3, &reduce_e0_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_e1_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_e1_1, -1};
+Rule rule5 = {&nonterm3, 1, &reduce_e2_0, -1};
+Rule rule6 = {&nonterm3, 3, &reduce_e2_1, -1};
+Rule rule7 = {&nonterm4, 1, &reduce_e3_0, -1};
+Rule rule8 = {&nonterm4, 3, &reduce_e3_1, -1};
+Rule rule9 = {&nonterm5, 1, &reduce_e4_0, -1};
+Rule rule10 = {&nonterm5, 3, &reduce_e4_1, -1};
+Rule rule11 = {&nonterm6, 1, &reduce_e5_0, -1};
+Rule rule12 = {&nonterm6, 3, &reduce_e5_1, -1};
+Rule rule13 = {&nonterm7, 1, &reduce_e6_0, -1};
+Rule rule14 = {&nonterm7, 3, &reduce_e6_1, -1};
+Rule rule15 = {&nonterm8, 1, &reduce_e7_0, -1};
+Rule rule16 = {&nonterm8, 3, &reduce_e7_1, -1};
+Rule rule17 = {&nonterm9, 1, &reduce_e8_0, -1};
+Rule rule18 = {&nonterm9, 3, &reduce_e8_1, -1};
+Rule rule19 = {&nonterm10, 1, &reduce_e9_0, -1};
+Rule rule20 = {&nonterm10, 3, &reduce_e9_1, -1};
+Rule rule21 = {&nonterm11, 1, &reduce_e10_0, -1};
+Rule rule22 = {&nonterm11, 3, &reduce_e10_1, -1};
+Rule rule23 = {&nonterm12, 1, &reduce_e11_0, -1};
+Rule rule24 = {&nonterm12, 3, &reduce_e11_1, -1};
+Rule rule25 = {&nonterm13, 1, &reduce_e12_0, -1};
+Rule rule26 = {&nonterm13, 3, &reduce_e12_1, -1};
+Rule rule27 = {&nonterm14, 1, &reduce_e13_0, -1};
+Rule rule28 = {&nonterm14, 3, &reduce_e13_1, -1};
+Rule rule29 = {&nonterm15, 1, &reduce_e14_0, -1};
+Rule rule30 = {&nonterm15, 3, &reduce_e14_1, -1};
+Rule rule31 = {&nonterm16, 1, &reduce_e15_0, -1};
+Rule rule32 = {&nonterm16, 3, &reduce_e15_1, -1};
+Rule rule33 = {&nonterm17, 1, &reduce_e16_0, -1};
+Rule rule34 = {&nonterm17, 3, &reduce_e16_1, -1};
+Rule rule35 = {&nonterm18, 1, &reduce_e17_0, -1};
+Rule rule36 = {&nonterm18, 3, &reduce_e17_1, -1};
+Rule rule37 = {&nonterm19, 1, &reduce_e18_0, -1};
+Rule rule38 = {&nonterm19, 3, &reduce_e18_1, -1};
+Rule rule39 = {&nonterm20, 1, &reduce_e19_0, -1};
+Rule rule40 = {&nonterm20, 3, &reduce_e19_1, -1};
+Rule rule41 = {&nonterm21, 1, &reduce_e20_0, -1};
+Rule rule42 = {&nonterm21, 3, &reduce_e20_1, -1};
+Rule rule43 = {&nonterm22, 1, &reduce_e21_0, -1};
+Rule rule44 = {&nonterm22, 3, &reduce_e21_1, -1};
+Rule rule45 = {&nonterm23, 1, &reduce_e22_0, -1};
+Rule rule46 = {&nonterm23, 3, &reduce_e22_1, -1};
+Rule rule47 = {&nonterm24, 1, &reduce_e23_0, -1};
+Rule rule48 = {&nonterm24, 3, &reduce_e23_1, -1};
+Rule rule49 = {&nonterm25, 1, &reduce_e24_0, -1};
+Rule rule50 = {&nonterm25, 3, &reduce_e24_1, -1};
+Rule rule51 = {&nonterm26, 1, &reduce_e25_0, -1};
+Rule rule52 = {&nonterm26, 3, &reduce_e25_1, -1};
+Rule rule53 = {&nonterm27, 1, &reduce_e26_0, -1};
+Rule rule54 = {&nonterm27, 3, &reduce_e26_1, -1};
+Rule rule55 = {&nonterm28, 1, &reduce_e27_0, -1};
+Rule rule56 = {&nonterm28, 3, &reduce_e27_1, -1};
+Rule rule57 = {&nonterm29, 1, &reduce_e28_0, -1};
+Rule rule58 = {&nonterm29, 3, &reduce_e28_1, -1};
+Rule rule59 = {&nonterm30, 1, &reduce_e29_0, -1};
+Rule rule60 = {&nonterm30, 3, &reduce_e29_1, -1};
+Rule rule61 = {&nonterm31, 1, &reduce_e30_0, -1};
+Rule rule62 = {&nonterm31, 3, &reduce_e30_1, -1};
+Rule rule63 = {&nonterm32, 1, &reduce_e31_0, -1};
+Rule rule64 = {&nonterm32, 3, &reduce_e31_1, -1};
+Rule rule65 = {&nonterm33, 1, &reduce_e32_0, -1};
+Rule rule66 = {&nonterm33, 1, &reduce_e32_1, -1};
+Rule rule67 = {&nonterm33, 3, &reduce_e32_2, -1};
+Rule rule68 = {&nonterm33, 2, &reduce_e32_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+
+std::vector<Shift> shift0 = {{&term0, &state1}, {&term2, &state2}, {&term35, &state3}, {&term37, &state4}};
+std::vector<Reduce> reduce0 = {};
+std::vector<Shift> shift1 = {};
+std::vector<Reduce> reduce1 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift2 = {};
+std::vector<Reduce> reduce2 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift3 = {{&term0, &state103}, {&term2, &state104}, {&term35, &state105}, {&term37, &state106}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift5 = {{&term3, &state100}};
+std::vector<Reduce> reduce5 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift6 = {{&term4, &state98}};
+std::vector<Reduce> reduce6 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift7 = {{&term5, &state96}};
+std::vector<Reduce> reduce7 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift8 = {{&term6, &state94}};
+std::vector<Reduce> reduce8 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift9 = {{&term7, &state92}};
+std::vector<Reduce> reduce9 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift10 = {{&term8, &state90}};
+std::vector<Reduce> reduce10 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift11 = {{&term9, &state88}};
+std::vector<Reduce> reduce11 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift12 = {{&term10, &state86}};
+std::vector<Reduce> reduce12 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift13 = {{&term11, &state84}};
+std::vector<Reduce> reduce13 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift14 = {{&term12, &state82}};
+std::vector<Reduce> reduce14 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift15 = {{&term13, &state80}};
+std::vector<Reduce> reduce15 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift16 = {{&term14, &state78}};
+std::vector<Reduce> reduce16 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift17 = {{&term15, &state76}};
+std::vector<Reduce> reduce17 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift18 = {{&term16, &state74}};
+std::vector<Reduce> reduce18 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift19 = {{&term17, &state72}};
+std::vector<Reduce> reduce19 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift20 = {{&term18, &state70}};
+std::vector<Reduce> reduce20 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift21 = {{&term19, &state68}};
+std::vector<Reduce> reduce21 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift22 = {{&term20, &state66}};
+std::vector<Reduce> reduce22 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift23 = {{&term21, &state64}};
+std::vector<Reduce> reduce23 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift24 = {{&term22, &state62}};
+std::vector<Reduce> reduce24 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift25 = {{&term23, &state60}};
+std::vector<Reduce> reduce25 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift26 = {{&term24, &state58}};
+std::vector<Reduce> reduce26 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift27 = {{&term25, &state56}};
+std::vector<Reduce> reduce27 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift28 = {{&term26, &state54}};
+std::vector<Reduce> reduce28 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift29 = {{&term27, &state52}};
+std::vector<Reduce> reduce29 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift30 = {{&term28, &state50}};
+std::vector<Reduce> reduce30 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift31 = {{&term29, &state48}};
+std::vector<Reduce> reduce31 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift32 = {{&term30, &state46}};
+std::vector<Reduce> reduce32 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift33 = {{&term31, &state44}};
+std::vector<Reduce> reduce33 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift34 = {{&term32, &state42}};
+std::vector<Reduce> reduce34 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift35 = {{&term33, &state40}};
+std::vector<Reduce> reduce35 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift36 = {{&term34, &state38}};
+std::vector<Reduce> reduce36 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift37 = {};
+std::vector<Reduce> reduce37 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift39 = {};
+std::vector<Reduce> reduce39 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift41 = {{&term34, &state38}};
+std::vector<Reduce> reduce41 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift43 = {{&term33, &state40}};
+std::vector<Reduce> reduce43 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift45 = {{&term32, &state42}};
+std::vector<Reduce> reduce45 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift47 = {{&term31, &state44}};
+std::vector<Reduce> reduce47 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift49 = {{&term30, &state46}};
+std::vector<Reduce> reduce49 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift51 = {{&term29, &state48}};
+std::vector<Reduce> reduce51 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift53 = {{&term28, &state50}};
+std::vector<Reduce> reduce53 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift55 = {{&term27, &state52}};
+std::vector<Reduce> reduce55 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift57 = {{&term26, &state54}};
+std::vector<Reduce> reduce57 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift59 = {{&term25, &state56}};
+std::vector<Reduce> reduce59 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift61 = {{&term24, &state58}};
+std::vector<Reduce> reduce61 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift63 = {{&term23, &state60}};
+std::vector<Reduce> reduce63 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift65 = {{&term22, &state62}};
+std::vector<Reduce> reduce65 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift67 = {{&term21, &state64}};
+std::vector<Reduce> reduce67 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift69 = {{&term20, &state66}};
+std::vector<Reduce> reduce69 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift71 = {{&term19, &state68}};
+std::vector<Reduce> reduce71 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift73 = {{&term18, &state70}};
+std::vector<Reduce> reduce73 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift75 = {{&term17, &state72}};
+std::vector<Reduce> reduce75 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift77 = {{&term16, &state74}};
+std::vector<Reduce> reduce77 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift79 = {{&term15, &state76}};
+std::vector<Reduce> reduce79 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift81 = {{&term14, &state78}};
+std::vector<Reduce> reduce81 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift83 = {{&term13, &state80}};
+std::vector<Reduce> reduce83 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift85 = {{&term12, &state82}};
+std::vector<Reduce> reduce85 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift87 = {{&term11, &state84}};
+std::vector<Reduce> reduce87 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift89 = {{&term10, &state86}};
+std::vector<Reduce> reduce89 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift91 = {{&term9, &state88}};
+std::vector<Reduce> reduce91 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift93 = {{&term8, &state90}};
+std::vector<Reduce> reduce93 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift95 = {{&term7, &state92}};
+std::vector<Reduce> reduce95 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift97 = {{&term6, &state94}};
+std::vector<Reduce> reduce97 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift99 = {{&term5, &state96}};
+std::vector<Reduce> reduce99 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift101 = {{&term4, &state98}};
+std::vector<Reduce> reduce101 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift102 = {};
+std::vector<Reduce> reduce102 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift107 = {{&term3, &state202}, {&term36, &state203}};
+std::vector<Reduce> reduce107 = {};
+std::vector<Shift> shift108 = {{&term4, &state200}};
+std::vector<Reduce> reduce108 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift109 = {{&term5, &state198}};
+std::vector<Reduce> reduce109 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift110 = {{&term6, &state196}};
+std::vector<Reduce> reduce110 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift111 = {{&term7, &state194}};
+std::vector<Reduce> reduce111 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift112 = {{&term8, &state192}};
+std::vector<Reduce> reduce112 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift113 = {{&term9, &state190}};
+std::vector<Reduce> reduce113 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift114 = {{&term10, &state188}};
+std::vector<Reduce> reduce114 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift115 = {{&term11, &state186}};
+std::vector<Reduce> reduce115 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift116 = {{&term12, &state184}};
+std::vector<Reduce> reduce116 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift117 = {{&term13, &state182}};
+std::vector<Reduce> reduce117 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift118 = {{&term14, &state180}};
+std::vector<Reduce> reduce118 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift119 = {{&term15, &state178}};
+std::vector<Reduce> reduce119 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift120 = {{&term16, &state176}};
+std::vector<Reduce> reduce120 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift121 = {{&term17, &state174}};
+std::vector<Reduce> reduce121 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift122 = {{&term18, &state172}};
+std::vector<Reduce> reduce122 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift123 = {{&term19, &state170}};
+std::vector<Reduce> reduce123 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift124 = {{&term20, &state168}};
+std::vector<Reduce> reduce124 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift125 = {{&term21, &state166}};
+std::vector<Reduce> reduce125 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift126 = {{&term22, &state164}};
+std::vector<Reduce> reduce126 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift127 = {{&term23, &state162}};
+std::vector<Reduce> reduce127 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift128 = {{&term24, &state160}};
+std::vector<Reduce> reduce128 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift129 = {{&term25, &state158}};
+std::vector<Reduce> reduce129 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift130 = {{&term26, &state156}};
+std::vector<Reduce> reduce130 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift131 = {{&term27, &state154}};
+std::vector<Reduce> reduce131 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift132 = {{&term28, &state152}};
+std::vector<Reduce> reduce132 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift133 = {{&term29, &state150}};
+std::vector<Reduce> reduce133 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift134 = {{&term30, &state148}};
+std::vector<Reduce> reduce134 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift135 = {{&term31, &state146}};
+std::vector<Reduce> reduce135 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift136 = {{&term32, &state144}};
+std::vector<Reduce> reduce136 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift137 = {{&term33, &state142}};
+std::vector<Reduce> reduce137 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift138 = {{&term34, &state140}};
+std::vector<Reduce> reduce138 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift143 = {{&term34, &state140}};
+std::vector<Reduce> reduce143 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift145 = {{&term33, &state142}};
+std::vector<Reduce> reduce145 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift147 = {{&term32, &state144}};
+std::vector<Reduce> reduce147 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift149 = {{&term31, &state146}};
+std::vector<Reduce> reduce149 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift151 = {{&term30, &state148}};
+std::vector<Reduce> reduce151 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift153 = {{&term29, &state150}};
+std::vector<Reduce> reduce153 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift155 = {{&term28, &state152}};
+std::vector<Reduce> reduce155 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift157 = {{&term27, &state154}};
+std::vector<Reduce> reduce157 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift159 = {{&term26, &state156}};
+std::vector<Reduce> reduce159 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift161 = {{&term25, &state158}};
+std::vector<Reduce> reduce161 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift163 = {{&term24, &state160}};
+std::vector<Reduce> reduce163 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift165 = {{&term23, &state162}};
+std::vector<Reduce> reduce165 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift167 = {{&term22, &state164}};
+std::vector<Reduce> reduce167 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift169 = {{&term21, &state166}};
+std::vector<Reduce> reduce169 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift171 = {{&term20, &state168}};
+std::vector<Reduce> reduce171 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift173 = {{&term19, &state170}};
+std::vector<Reduce> reduce173 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift175 = {{&term18, &state172}};
+std::vector<Reduce> reduce175 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift177 = {{&term17, &state174}};
+std::vector<Reduce> reduce177 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift179 = {{&term16, &state176}};
+std::vector<Reduce> reduce179 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift181 = {{&term15, &state178}};
+std::vector<Reduce> reduce181 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift183 = {{&term14, &state180}};
+std::vector<Reduce> reduce183 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift185 = {{&term13, &state182}};
+std::vector<Reduce> reduce185 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift187 = {{&term12, &state184}};
+std::vector<Reduce> reduce187 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift189 = {{&term11, &state186}};
+std::vector<Reduce> reduce189 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift191 = {{&term10, &state188}};
+std::vector<Reduce> reduce191 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift193 = {{&term9, &state190}};
+std::vector<Reduce> reduce193 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift195 = {{&term8, &state192}};
+std::vector<Reduce> reduce195 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift197 = {{&term7, &state194}};
+std::vector<Reduce> reduce197 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift199 = {{&term6, &state196}};
+std::vector<Reduce> reduce199 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift201 = {{&term5, &state198}};
+std::vector<Reduce> reduce201 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift203 = {};
+std::vector<Reduce> reduce203 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift204 = {{&term4, &state200}};
+std::vector<Reduce> reduce204 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift206 = {{&term3, &state202}, {&term36, &state207}};
+std::vector<Reduce> reduce206 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state5}, {&nonterm2, &state6}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go3 = {{&nonterm1, &state107}, {&nonterm2, &state108}, {&nonterm3, &state109}, {&nonterm4, &state110}, {&nonterm5, &state111}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go4 = {{&nonterm33, &state102}};
+std::vector<Go> go38 = {{&nonterm33, &state39}};
+std::vector<Go> go40 = {{&nonterm32, &state41}, {&nonterm33, &state37}};
+std::vector<Go> go42 = {{&nonterm31, &state43}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go44 = {{&nonterm30, &state45}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go46 = {{&nonterm29, &state47}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go48 = {{&nonterm28, &state49}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go50 = {{&nonterm27, &state51}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go52 = {{&nonterm26, &state53}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go54 = {{&nonterm25, &state55}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go56 = {{&nonterm24, &state57}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go58 = {{&nonterm23, &state59}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go60 = {{&nonterm22, &state61}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go62 = {{&nonterm21, &state63}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go64 = {{&nonterm20, &state65}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go66 = {{&nonterm19, &state67}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go68 = {{&nonterm18, &state69}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go70 = {{&nonterm17, &state71}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go72 = {{&nonterm16, &state73}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go74 = {{&nonterm15, &state75}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go76 = {{&nonterm14, &state77}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go78 = {{&nonterm13, &state79}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go80 = {{&nonterm12, &state81}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go82 = {{&nonterm11, &state83}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go84 = {{&nonterm10, &state85}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go86 = {{&nonterm9, &state87}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go88 = {{&nonterm8, &state89}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go90 = {{&nonterm7, &state91}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go92 = {{&nonterm6, &state93}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go94 = {{&nonterm5, &state95}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go96 = {{&nonterm4, &state97}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go98 = {{&nonterm3, &state99}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go100 = {{&nonterm2, &state101}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}};
+std::vector<Go> go105 = {{&nonterm1, &state206}, {&nonterm2, &state108}, {&nonterm3, &state109}, {&nonterm4, &state110}, {&nonterm5, &state111}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go106 = {{&nonterm33, &state205}};
+std::vector<Go> go140 = {{&nonterm33, &state141}};
+std::vector<Go> go142 = {{&nonterm32, &state143}, {&nonterm33, &state139}};
+std::vector<Go> go144 = {{&nonterm31, &state145}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go146 = {{&nonterm30, &state147}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go148 = {{&nonterm29, &state149}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go150 = {{&nonterm28, &state151}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go152 = {{&nonterm27, &state153}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go154 = {{&nonterm26, &state155}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go156 = {{&nonterm25, &state157}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go158 = {{&nonterm24, &state159}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go160 = {{&nonterm23, &state161}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go162 = {{&nonterm22, &state163}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go164 = {{&nonterm21, &state165}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go166 = {{&nonterm20, &state167}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go168 = {{&nonterm19, &state169}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go170 = {{&nonterm18, &state171}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go172 = {{&nonterm17, &state173}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go174 = {{&nonterm16, &state175}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go176 = {{&nonterm15, &state177}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go178 = {{&nonterm14, &state179}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go180 = {{&nonterm13, &state181}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go182 = {{&nonterm12, &state183}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go184 = {{&nonterm11, &state185}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go186 = {{&nonterm10, &state187}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go188 = {{&nonterm9, &state189}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go190 = {{&nonterm8, &state191}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go192 = {{&nonterm7, &state193}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go194 = {{&nonterm6, &state195}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go196 = {{&nonterm5, &state197}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go198 = {{&nonterm4, &state199}, {&nonterm5, &state111}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go200 = {{&nonterm3, &state201}, {&nonterm4, &state110}, {&nonterm5, &state111}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+std::vector<Go> go202 = {{&nonterm2, &state204}, {&nonterm3, &state109}, {&nonterm4, &state110}, {&nonterm5, &state111}, {&nonterm6, &state112}, {&nonterm7, &state113}, {&nonterm8, &state114}, {&nonterm9, &state115}, {&nonterm10, &state116}, {&nonterm11, &state117}, {&nonterm12, &state118}, {&nonterm13, &state119}, {&nonterm14, &state120}, {&nonterm15, &state121}, {&nonterm16, &state122}, {&nonterm17, &state123}, {&nonterm18, &state124}, {&nonterm19, &state125}, {&nonterm20, &state126}, {&nonterm21, &state127}, {&nonterm22, &state128}, {&nonterm23, &state129}, {&nonterm24, &state130}, {&nonterm25, &state131}, {&nonterm26, &state132}, {&nonterm27, &state133}, {&nonterm28, &state134}, {&nonterm29, &state135}, {&nonterm30, &state136}, {&nonterm31, &state137}, {&nonterm32, &state138}, {&nonterm33, &state139}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, nullptr};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift0, &reduce0, &go4};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift0, &reduce0, &go38};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift0, &reduce0, &go40};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift0, &reduce0, &go42};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift0, &reduce0, &go44};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift0, &reduce0, &go46};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift0, &reduce0, &go48};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift0, &reduce0, &go50};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift0, &reduce0, &go52};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift0, &reduce0, &go54};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift0, &reduce0, &go56};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift0, &reduce0, &go58};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift0, &reduce0, &go60};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift0, &reduce0, &go62};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift0, &reduce0, &go64};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift0, &reduce0, &go66};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift0, &reduce0, &go68};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift0, &reduce0, &go70};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift0, &reduce0, &go72};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift0, &reduce0, &go74};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift0, &reduce0, &go76};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift0, &reduce0, &go78};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift0, &reduce0, &go80};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift0, &reduce0, &go82};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift0, &reduce0, &go84};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift0, &reduce0, &go86};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift0, &reduce0, &go88};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift0, &reduce0, &go90};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift0, &reduce0, &go92};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift0, &reduce0, &go94};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift0, &reduce0, &go96};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift0, &reduce0, &go98};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift0, &reduce0, &go100};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift1, &reduce1, nullptr};
+State state104 = {&shift2, &reduce2, nullptr};
+State state105 = {&shift3, &reduce3, &go105};
+State state106 = {&shift3, &reduce3, &go106};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, nullptr};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift114, &reduce114, nullptr};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift118, &reduce118, nullptr};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift120, &reduce120, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift122, &reduce122, nullptr};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift124, &reduce124, nullptr};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift126, &reduce126, nullptr};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift128, &reduce128, nullptr};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift130, &reduce130, nullptr};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift132, &reduce132, nullptr};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift134, &reduce134, nullptr};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift136, &reduce136, nullptr};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift138, &reduce138, nullptr};
+State state139 = {&shift37, &reduce37, nullptr};
+State state140 = {&shift3, &reduce3, &go140};
+State state141 = {&shift39, &reduce39, nullptr};
+State state142 = {&shift3, &reduce3, &go142};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift3, &reduce3, &go144};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift3, &reduce3, &go146};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift3, &reduce3, &go148};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift3, &reduce3, &go150};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift3, &reduce3, &go152};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift3, &reduce3, &go154};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift3, &reduce3, &go156};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift3, &reduce3, &go158};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift3, &reduce3, &go160};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift3, &reduce3, &go162};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift3, &reduce3, &go164};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift3, &reduce3, &go166};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift3, &reduce3, &go168};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift3, &reduce3, &go170};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift3, &reduce3, &go172};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift3, &reduce3, &go174};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift3, &reduce3, &go176};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift3, &reduce3, &go178};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift3, &reduce3, &go180};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift3, &reduce3, &go182};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift3, &reduce3, &go184};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift3, &reduce3, &go186};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift3, &reduce3, &go188};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift3, &reduce3, &go190};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift3, &reduce3, &go192};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift3, &reduce3, &go194};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift3, &reduce3, &go196};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift3, &reduce3, &go198};
+State state199 = {&shift199, &reduce199, nullptr};
+State state200 = {&shift3, &reduce3, &go200};
+State state201 = {&shift201, &reduce201, nullptr};
+State state202 = {&shift3, &reduce3, &go202};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift102, &reduce102, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift203, &reduce203, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
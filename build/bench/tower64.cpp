@@ -0,0 +1,3768 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"#0", false, 3};
+Symbol term4 = {"#1", false, 4};
+Symbol term5 = {"#2", false, 5};
+Symbol term6 = {"#3", false, 6};
+Symbol term7 = {"#4", false, 7};
+Symbol term8 = {"#5", false, 8};
+Symbol term9 = {"#6", false, 9};
+Symbol term10 = {"#7", false, 10};
+Symbol term11 = {"#8", false, 11};
+Symbol term12 = {"#9", false, 12};
+Symbol term13 = {"#10", false, 13};
+Symbol term14 = {"#11", false, 14};
+Symbol term15 = {"#12", false, 15};
+Symbol term16 = {"#13", false, 16};
+Symbol term17 = {"#14", false, 17};
+Symbol term18 = {"#15", false, 18};
+Symbol term19 = {"#16", false, 19};
+Symbol term20 = {"#17", false, 20};
+Symbol term21 = {"#18", false, 21};
+Symbol term22 = {"#19", false, 22};
+Symbol term23 = {"#20", false, 23};
+Symbol term24 = {"#21", false, 24};
+Symbol term25 = {"#22", false, 25};
+Symbol term26 = {"#23", false, 26};
+Symbol term27 = {"#24", false, 27};
+Symbol term28 = {"#25", false, 28};
+Symbol term29 = {"#26", false, 29};
+Symbol term30 = {"#27", false, 30};
+Symbol term31 = {"#28", false, 31};
+Symbol term32 = {"#29", false, 32};
+Symbol term33 = {"#30", false, 33};
+Symbol term34 = {"#31", false, 34};
+Symbol term35 = {"#32", false, 35};
+Symbol term36 = {"#33", false, 36};
+Symbol term37 = {"#34", false, 37};
+Symbol term38 = {"#35", false, 38};
+Symbol term39 = {"#36", false, 39};
+Symbol term40 = {"#37", false, 40};
+Symbol term41 = {"#38", false, 41};
+Symbol term42 = {"#39", false, 42};
+Symbol term43 = {"#40", false, 43};
+Symbol term44 = {"#41", false, 44};
+Symbol term45 = {"#42", false, 45};
+Symbol term46 = {"#43", false, 46};
+Symbol term47 = {"#44", false, 47};
+Symbol term48 = {"#45", false, 48};
+Symbol term49 = {"#46", false, 49};
+Symbol term50 = {"#47", false, 50};
+Symbol term51 = {"#48", false, 51};
+Symbol term52 = {"#49", false, 52};
+Symbol term53 = {"#50", false, 53};
+Symbol term54 = {"#51", false, 54};
+Symbol term55 = {"#52", false, 55};
+Symbol term56 = {"#53", false, 56};
+Symbol term57 = {"#54", false, 57};
+Symbol term58 = {"#55", false, 58};
+Symbol term59 = {"#56", false, 59};
+Symbol term60 = {"#57", false, 60};
+Symbol term61 = {"#58", false, 61};
+Symbol term62 = {"#59", false, 62};
+Symbol term63 = {"#60", false, 63};
+Symbol term64 = {"#61", false, 64};
+Symbol term65 = {"#62", false, 65};
+Symbol term66 = {"#63", false, 66};
+Symbol term67 = {"(", false, 67};
+Symbol term68 = {")", false, 68};
+Symbol term69 = {"-", false, 69};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+extern Node node62;
+extern Node node63;
+extern Node node64;
+extern Node node65;
+extern Node node66;
+extern Node node67;
+extern Node node68;
+extern Node node69;
+extern Node node70;
+extern Node node71;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 6, 7, 7, 7, 7, 8, 9, 10, 10, 10, 11, 12, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 26 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node8; }
+    if (k == 14) { return &node9; }
+    if (k == 15) { return &node10; }
+    if (k == 16) { return &node11; }
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if ((k >= 13) && (k <= 22)) { return &node6; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 24) { return &node7; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node62; }
+    if (k == 14) { return &node63; }
+    if (k == 15) { return &node64; }
+    if (k == 16) { return &node65; }
+    if (k == 17) { return &node66; }
+    if (k == 18) { return &node67; }
+    if (k == 19) { return &node68; }
+    if (k == 20) { return &node69; }
+    if (k == 21) { return &node70; }
+    if (k == 22) { return &node71; }
+    return nullptr;
+}
+
+Node*
+next10(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node52; }
+    if (k == 14) { return &node53; }
+    if (k == 15) { return &node54; }
+    if (k == 16) { return &node55; }
+    if (k == 17) { return &node56; }
+    if (k == 18) { return &node57; }
+    if (k == 19) { return &node58; }
+    if (k == 20) { return &node59; }
+    if (k == 21) { return &node60; }
+    if (k == 22) { return &node61; }
+    return nullptr;
+}
+
+Node*
+next11(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node42; }
+    if (k == 14) { return &node43; }
+    if (k == 15) { return &node44; }
+    if (k == 16) { return &node45; }
+    if (k == 17) { return &node46; }
+    if (k == 18) { return &node47; }
+    if (k == 19) { return &node48; }
+    if (k == 20) { return &node49; }
+    if (k == 21) { return &node50; }
+    if (k == 22) { return &node51; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node32; }
+    if (k == 14) { return &node33; }
+    if (k == 15) { return &node34; }
+    if (k == 16) { return &node35; }
+    if (k == 17) { return &node36; }
+    if (k == 18) { return &node37; }
+    if (k == 19) { return &node38; }
+    if (k == 20) { return &node39; }
+    if (k == 21) { return &node40; }
+    if (k == 22) { return &node41; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node22; }
+    if (k == 14) { return &node23; }
+    if (k == 15) { return &node24; }
+    if (k == 16) { return &node25; }
+    if (k == 17) { return &node26; }
+    if (k == 18) { return &node27; }
+    if (k == 19) { return &node28; }
+    if (k == 20) { return &node29; }
+    if (k == 21) { return &node30; }
+    if (k == 22) { return &node31; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 13) { return &node18; }
+    if (k == 14) { return &node19; }
+    if (k == 15) { return &node20; }
+    if (k == 16) { return &node21; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, nullptr, nullptr};
+Node node3 = {nullptr, &term67, nullptr};
+Node node4 = {nullptr, &term68, nullptr};
+Node node5 = {nullptr, &term69, nullptr};
+Node node6 = {&next6, &term0, nullptr};
+Node node7 = {&next7, &term2, nullptr};
+Node node8 = {nullptr, &term3, nullptr};
+Node node9 = {&next9, &term4, nullptr};
+Node node10 = {&next10, &term5, nullptr};
+Node node11 = {&next11, &term6, nullptr};
+Node node12 = {&next12, &term7, nullptr};
+Node node13 = {&next13, &term8, nullptr};
+Node node14 = {&next14, &term9, nullptr};
+Node node15 = {nullptr, &term10, nullptr};
+Node node16 = {nullptr, &term11, nullptr};
+Node node17 = {nullptr, &term12, nullptr};
+Node node18 = {nullptr, &term63, nullptr};
+Node node19 = {nullptr, &term64, nullptr};
+Node node20 = {nullptr, &term65, nullptr};
+Node node21 = {nullptr, &term66, nullptr};
+Node node22 = {nullptr, &term53, nullptr};
+Node node23 = {nullptr, &term54, nullptr};
+Node node24 = {nullptr, &term55, nullptr};
+Node node25 = {nullptr, &term56, nullptr};
+Node node26 = {nullptr, &term57, nullptr};
+Node node27 = {nullptr, &term58, nullptr};
+Node node28 = {nullptr, &term59, nullptr};
+Node node29 = {nullptr, &term60, nullptr};
+Node node30 = {nullptr, &term61, nullptr};
+Node node31 = {nullptr, &term62, nullptr};
+Node node32 = {nullptr, &term43, nullptr};
+Node node33 = {nullptr, &term44, nullptr};
+Node node34 = {nullptr, &term45, nullptr};
+Node node35 = {nullptr, &term46, nullptr};
+Node node36 = {nullptr, &term47, nullptr};
+Node node37 = {nullptr, &term48, nullptr};
+Node node38 = {nullptr, &term49, nullptr};
+Node node39 = {nullptr, &term50, nullptr};
+Node node40 = {nullptr, &term51, nullptr};
+Node node41 = {nullptr, &term52, nullptr};
+Node node42 = {nullptr, &term33, nullptr};
+Node node43 = {nullptr, &term34, nullptr};
+Node node44 = {nullptr, &term35, nullptr};
+Node node45 = {nullptr, &term36, nullptr};
+Node node46 = {nullptr, &term37, nullptr};
+Node node47 = {nullptr, &term38, nullptr};
+Node node48 = {nullptr, &term39, nullptr};
+Node node49 = {nullptr, &term40, nullptr};
+Node node50 = {nullptr, &term41, nullptr};
+Node node51 = {nullptr, &term42, nullptr};
+Node node52 = {nullptr, &term23, nullptr};
+Node node53 = {nullptr, &term24, nullptr};
+Node node54 = {nullptr, &term25, nullptr};
+Node node55 = {nullptr, &term26, nullptr};
+Node node56 = {nullptr, &term27, nullptr};
+Node node57 = {nullptr, &term28, nullptr};
+Node node58 = {nullptr, &term29, nullptr};
+Node node59 = {nullptr, &term30, nullptr};
+Node node60 = {nullptr, &term31, nullptr};
+Node node61 = {nullptr, &term32, nullptr};
+Node node62 = {nullptr, &term13, nullptr};
+Node node63 = {nullptr, &term14, nullptr};
+Node node64 = {nullptr, &term15, nullptr};
+Node node65 = {nullptr, &term16, nullptr};
+Node node66 = {nullptr, &term17, nullptr};
+Node node67 = {nullptr, &term18, nullptr};
+Node node68 = {nullptr, &term19, nullptr};
+Node node69 = {nullptr, &term20, nullptr};
+Node node70 = {nullptr, &term21, nullptr};
+Node node71 = {nullptr, &term22, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 70};
+Symbol nonterm0 = {"expr", false, 0};
+Symbol nonterm1 = {"e0", false, 1};
+Symbol nonterm2 = {"e1", false, 2};
+Symbol nonterm3 = {"e2", false, 3};
+Symbol nonterm4 = {"e3", false, 4};
+Symbol nonterm5 = {"e4", false, 5};
+Symbol nonterm6 = {"e5", false, 6};
+Symbol nonterm7 = {"e6", false, 7};
+Symbol nonterm8 = {"e7", false, 8};
+Symbol nonterm9 = {"e8", false, 9};
+Symbol nonterm10 = {"e9", false, 10};
+Symbol nonterm11 = {"e10", false, 11};
+Symbol nonterm12 = {"e11", false, 12};
+Symbol nonterm13 = {"e12", false, 13};
+Symbol nonterm14 = {"e13", false, 14};
+Symbol nonterm15 = {"e14", false, 15};
+Symbol nonterm16 = {"e15", false, 16};
+Symbol nonterm17 = {"e16", false, 17};
+Symbol nonterm18 = {"e17", false, 18};
+Symbol nonterm19 = {"e18", false, 19};
+Symbol nonterm20 = {"e19", false, 20};
+Symbol nonterm21 = {"e20", false, 21};
+Symbol nonterm22 = {"e21", false, 22};
+Symbol nonterm23 = {"e22", false, 23};
+Symbol nonterm24 = {"e23", false, 24};
+Symbol nonterm25 = {"e24", false, 25};
+Symbol nonterm26 = {"e25", false, 26};
+Symbol nonterm27 = {"e26", false, 27};
+Symbol nonterm28 = {"e27", false, 28};
+Symbol nonterm29 = {"e28", false, 29};
+Symbol nonterm30 = {"e29", false, 30};
+Symbol nonterm31 = {"e30", false, 31};
+Symbol nonterm32 = {"e31", false, 32};
+Symbol nonterm33 = {"e32", false, 33};
+Symbol nonterm34 = {"e33", false, 34};
+Symbol nonterm35 = {"e34", false, 35};
+Symbol nonterm36 = {"e35", false, 36};
+Symbol nonterm37 = {"e36", false, 37};
+Symbol nonterm38 = {"e37", false, 38};
+Symbol nonterm39 = {"e38", false, 39};
+Symbol nonterm40 = {"e39", false, 40};
+Symbol nonterm41 = {"e40", false, 41};
+Symbol nonterm42 = {"e41", false, 42};
+Symbol nonterm43 = {"e42", false, 43};
+Symbol nonterm44 = {"e43", false, 44};
+Symbol nonterm45 = {"e44", false, 45};
+Symbol nonterm46 = {"e45", false, 46};
+Symbol nonterm47 = {"e46", false, 47};
+Symbol nonterm48 = {"e47", false, 48};
+Symbol nonterm49 = {"e48", false, 49};
+Symbol nonterm50 = {"e49", false, 50};
+Symbol nonterm51 = {"e50", false, 51};
+Symbol nonterm52 = {"e51", false, 52};
+Symbol nonterm53 = {"e52", false, 53};
+Symbol nonterm54 = {"e53", false, 54};
+Symbol nonterm55 = {"e54", false, 55};
+Symbol nonterm56 = {"e55", false, 56};
+Symbol nonterm57 = {"e56", false, 57};
+Symbol nonterm58 = {"e57", false, 58};
+Symbol nonterm59 = {"e58", false, 59};
+Symbol nonterm60 = {"e59", false, 60};
+Symbol nonterm61 = {"e60", false, 61};
+Symbol nonterm62 = {"e61", false, 62};
+Symbol nonterm63 = {"e62", false, 63};
+Symbol nonterm64 = {"e63", false, 64};
+Symbol nonterm65 = {"e64", false, 65};
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e0_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e0_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e1_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e1_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e2_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e2_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e3_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e3_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e4_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e4_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e5_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e5_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e6_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e6_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e7_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e7_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e8_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e8_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e9_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e9_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e10_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e10_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e11_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e11_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e12_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e12_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e13_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e13_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e14_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e14_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e15_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e15_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e16_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e16_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e17_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e17_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e18_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e18_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e19_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e19_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e20_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e20_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e21_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e21_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e22_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e22_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e23_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e23_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e24_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e24_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e25_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e25_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e26_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e26_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e27_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e27_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e28_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e28_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e29_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e29_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e30_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e30_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e31_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e31_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e32_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e32_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e32_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e32_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e33_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e33_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e33_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e33_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e33_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e33_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e34_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e34_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e34_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e34_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e34_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e34_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e35_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e35_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e35_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e35_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e35_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e35_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e36_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e36_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e36_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e36_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e36_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e36_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e37_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e37_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e37_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e37_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e37_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e37_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e38_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e38_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e38_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e38_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e38_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e38_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e39_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e39_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e39_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e39_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e39_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e39_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e40_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e40_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e40_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e40_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e40_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e40_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e41_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e41_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e41_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e41_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e41_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e41_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e42_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e42_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e42_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e42_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e42_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e42_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e43_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e43_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e43_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e43_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e43_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e43_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e44_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e44_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e44_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e44_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e44_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e44_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e45_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e45_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e45_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e45_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e45_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e45_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e46_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e46_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e46_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e46_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e46_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e46_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e47_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e47_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e47_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e47_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e47_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e47_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e48_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e48_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e48_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e48_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e48_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e48_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e49_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e49_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e49_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e49_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e49_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e49_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e50_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e50_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e50_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e50_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e50_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e50_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e51_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e51_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e51_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e51_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e51_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e51_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e52_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e52_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e52_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e52_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e52_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e52_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e53_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e53_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e53_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e53_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e53_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e53_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e54_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e54_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e54_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e54_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e54_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e54_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e55_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e55_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e55_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e55_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e55_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e55_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e56_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e56_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e56_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e56_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e56_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e56_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e57_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e57_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e57_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e57_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e57_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e57_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e58_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e58_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e58_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e58_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e58_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e58_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e59_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e59_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e59_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e59_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e59_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e59_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e60_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e60_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e60_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e60_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e60_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e60_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e61_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e61_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e61_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e61_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e61_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e61_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e62_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e62_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e62_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e62_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e62_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e62_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e63_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e63_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e63_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e63_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_e63_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e63_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_0(Table*);
+
+Value*
+reduce_e64_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e64_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_1(Table*);
+
+Value*
+reduce_e64_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_e64_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e64_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_e64_2(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_e64_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_e64_3(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_e64_3(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_expr_0, -1};
+Rule rule1 = {&nonterm1, 1, &reduce_e0_0, -1};
+Rule rule2 = {&nonterm1, 3, &reduce_e0_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_e1_0, -1};
+Rule rule4 = {&nonterm2, 3, &reduce_e1_1, -1};
+Rule rule5 = {&nonterm3, 1, &reduce_e2_0, -1};
+Rule rule6 = {&nonterm3, 3, &reduce_e2_1, -1};
+Rule rule7 = {&nonterm4, 1, &reduce_e3_0, -1};
+Rule rule8 = {&nonterm4, 3, &reduce_e3_1, -1};
+Rule rule9 = {&nonterm5, 1, &reduce_e4_0, -1};
+Rule rule10 = {&nonterm5, 3, &reduce_e4_1, -1};
+Rule rule11 = {&nonterm6, 1, &reduce_e5_0, -1};
+Rule rule12 = {&nonterm6, 3, &reduce_e5_1, -1};
+Rule rule13 = {&nonterm7, 1, &reduce_e6_0, -1};
+Rule rule14 = {&nonterm7, 3, &reduce_e6_1, -1};
+Rule rule15 = {&nonterm8, 1, &reduce_e7_0, -1};
+Rule rule16 = {&nonterm8, 3, &reduce_e7_1, -1};
+Rule rule17 = {&nonterm9, 1, &reduce_e8_0, -1};
+Rule rule18 = {&nonterm9, 3, &reduce_e8_1, -1};
+Rule rule19 = {&nonterm10, 1, &reduce_e9_0, -1};
+Rule rule20 = {&nonterm10, 3, &reduce_e9_1, -1};
+Rule rule21 = {&nonterm11, 1, &reduce_e10_0, -1};
+Rule rule22 = {&nonterm11, 3, &reduce_e10_1, -1};
+Rule rule23 = {&nonterm12, 1, &reduce_e11_0, -1};
+Rule rule24 = {&nonterm12, 3, &reduce_e11_1, -1};
+Rule rule25 = {&nonterm13, 1, &reduce_e12_0, -1};
+Rule rule26 = {&nonterm13, 3, &reduce_e12_1, -1};
+Rule rule27 = {&nonterm14, 1, &reduce_e13_0, -1};
+Rule rule28 = {&nonterm14, 3, &reduce_e13_1, -1};
+Rule rule29 = {&nonterm15, 1, &reduce_e14_0, -1};
+Rule rule30 = {&nonterm15, 3, &reduce_e14_1, -1};
+Rule rule31 = {&nonterm16, 1, &reduce_e15_0, -1};
+Rule rule32 = {&nonterm16, 3, &reduce_e15_1, -1};
+Rule rule33 = {&nonterm17, 1, &reduce_e16_0, -1};
+Rule rule34 = {&nonterm17, 3, &reduce_e16_1, -1};
+Rule rule35 = {&nonterm18, 1, &reduce_e17_0, -1};
+Rule rule36 = {&nonterm18, 3, &reduce_e17_1, -1};
+Rule rule37 = {&nonterm19, 1, &reduce_e18_0, -1};
+Rule rule38 = {&nonterm19, 3, &reduce_e18_1, -1};
+Rule rule39 = {&nonterm20, 1, &reduce_e19_0, -1};
+Rule rule40 = {&nonterm20, 3, &reduce_e19_1, -1};
+Rule rule41 = {&nonterm21, 1, &reduce_e20_0, -1};
+Rule rule42 = {&nonterm21, 3, &reduce_e20_1, -1};
+Rule rule43 = {&nonterm22, 1, &reduce_e21_0, -1};
+Rule rule44 = {&nonterm22, 3, &reduce_e21_1, -1};
+Rule rule45 = {&nonterm23, 1, &reduce_e22_0, -1};
+Rule rule46 = {&nonterm23, 3, &reduce_e22_1, -1};
+Rule rule47 = {&nonterm24, 1, &reduce_e23_0, -1};
+Rule rule48 = {&nonterm24, 3, &reduce_e23_1, -1};
+Rule rule49 = {&nonterm25, 1, &reduce_e24_0, -1};
+Rule rule50 = {&nonterm25, 3, &reduce_e24_1, -1};
+Rule rule51 = {&nonterm26, 1, &reduce_e25_0, -1};
+Rule rule52 = {&nonterm26, 3, &reduce_e25_1, -1};
+Rule rule53 = {&nonterm27, 1, &reduce_e26_0, -1};
+Rule rule54 = {&nonterm27, 3, &reduce_e26_1, -1};
+Rule rule55 = {&nonterm28, 1, &reduce_e27_0, -1};
+Rule rule56 = {&nonterm28, 3, &reduce_e27_1, -1};
+Rule rule57 = {&nonterm29, 1, &reduce_e28_0, -1};
+Rule rule58 = {&nonterm29, 3, &reduce_e28_1, -1};
+Rule rule59 = {&nonterm30, 1, &reduce_e29_0, -1};
+Rule rule60 = {&nonterm30, 3, &reduce_e29_1, -1};
+Rule rule61 = {&nonterm31, 1, &reduce_e30_0, -1};
+Rule rule62 = {&nonterm31, 3, &reduce_e30_1, -1};
+Rule rule63 = {&nonterm32, 1, &reduce_e31_0, -1};
+Rule rule64 = {&nonterm32, 3, &reduce_e31_1, -1};
+Rule rule65 = {&nonterm33, 1, &reduce_e32_0, -1};
+Rule rule66 = {&nonterm33, 3, &reduce_e32_1, -1};
+Rule rule67 = {&nonterm34, 1, &reduce_e33_0, -1};
+Rule rule68 = {&nonterm34, 3, &reduce_e33_1, -1};
+Rule rule69 = {&nonterm35, 1, &reduce_e34_0, -1};
+Rule rule70 = {&nonterm35, 3, &reduce_e34_1, -1};
+Rule rule71 = {&nonterm36, 1, &reduce_e35_0, -1};
+Rule rule72 = {&nonterm36, 3, &reduce_e35_1, -1};
+Rule rule73 = {&nonterm37, 1, &reduce_e36_0, -1};
+Rule rule74 = {&nonterm37, 3, &reduce_e36_1, -1};
+Rule rule75 = {&nonterm38, 1, &reduce_e37_0, -1};
+Rule rule76 = {&nonterm38, 3, &reduce_e37_1, -1};
+Rule rule77 = {&nonterm39, 1, &reduce_e38_0, -1};
+Rule rule78 = {&nonterm39, 3, &reduce_e38_1, -1};
+Rule rule79 = {&nonterm40, 1, &reduce_e39_0, -1};
+Rule rule80 = {&nonterm40, 3, &reduce_e39_1, -1};
+Rule rule81 = {&nonterm41, 1, &reduce_e40_0, -1};
+Rule rule82 = {&nonterm41, 3, &reduce_e40_1, -1};
+Rule rule83 = {&nonterm42, 1, &reduce_e41_0, -1};
+Rule rule84 = {&nonterm42, 3, &reduce_e41_1, -1};
+Rule rule85 = {&nonterm43, 1, &reduce_e42_0, -1};
+Rule rule86 = {&nonterm43, 3, &reduce_e42_1, -1};
+Rule rule87 = {&nonterm44, 1, &reduce_e43_0, -1};
+Rule rule88 = {&nonterm44, 3, &reduce_e43_1, -1};
+Rule rule89 = {&nonterm45, 1, &reduce_e44_0, -1};
+Rule rule90 = {&nonterm45, 3, &reduce_e44_1, -1};
+Rule rule91 = {&nonterm46, 1, &reduce_e45_0, -1};
+Rule rule92 = {&nonterm46, 3, &reduce_e45_1, -1};
+Rule rule93 = {&nonterm47, 1, &reduce_e46_0, -1};
+Rule rule94 = {&nonterm47, 3, &reduce_e46_1, -1};
+Rule rule95 = {&nonterm48, 1, &reduce_e47_0, -1};
+Rule rule96 = {&nonterm48, 3, &reduce_e47_1, -1};
+Rule rule97 = {&nonterm49, 1, &reduce_e48_0, -1};
+Rule rule98 = {&nonterm49, 3, &reduce_e48_1, -1};
+Rule rule99 = {&nonterm50, 1, &reduce_e49_0, -1};
+Rule rule100 = {&nonterm50, 3, &reduce_e49_1, -1};
+Rule rule101 = {&nonterm51, 1, &reduce_e50_0, -1};
+Rule rule102 = {&nonterm51, 3, &reduce_e50_1, -1};
+Rule rule103 = {&nonterm52, 1, &reduce_e51_0, -1};
+Rule rule104 = {&nonterm52, 3, &reduce_e51_1, -1};
+Rule rule105 = {&nonterm53, 1, &reduce_e52_0, -1};
+Rule rule106 = {&nonterm53, 3, &reduce_e52_1, -1};
+Rule rule107 = {&nonterm54, 1, &reduce_e53_0, -1};
+Rule rule108 = {&nonterm54, 3, &reduce_e53_1, -1};
+Rule rule109 = {&nonterm55, 1, &reduce_e54_0, -1};
+Rule rule110 = {&nonterm55, 3, &reduce_e54_1, -1};
+Rule rule111 = {&nonterm56, 1, &reduce_e55_0, -1};
+Rule rule112 = {&nonterm56, 3, &reduce_e55_1, -1};
+Rule rule113 = {&nonterm57, 1, &reduce_e56_0, -1};
+Rule rule114 = {&nonterm57, 3, &reduce_e56_1, -1};
+Rule rule115 = {&nonterm58, 1, &reduce_e57_0, -1};
+Rule rule116 = {&nonterm58, 3, &reduce_e57_1, -1};
+Rule rule117 = {&nonterm59, 1, &reduce_e58_0, -1};
+Rule rule118 = {&nonterm59, 3, &reduce_e58_1, -1};
+Rule rule119 = {&nonterm60, 1, &reduce_e59_0, -1};
+Rule rule120 = {&nonterm60, 3, &reduce_e59_1, -1};
+Rule rule121 = {&nonterm61, 1, &reduce_e60_0, -1};
+Rule rule122 = {&nonterm61, 3, &reduce_e60_1, -1};
+Rule rule123 = {&nonterm62, 1, &reduce_e61_0, -1};
+Rule rule124 = {&nonterm62, 3, &reduce_e61_1, -1};
+Rule rule125 = {&nonterm63, 1, &reduce_e62_0, -1};
+Rule rule126 = {&nonterm63, 3, &reduce_e62_1, -1};
+Rule rule127 = {&nonterm64, 1, &reduce_e63_0, -1};
+Rule rule128 = {&nonterm64, 3, &reduce_e63_1, -1};
+Rule rule129 = {&nonterm65, 1, &reduce_e64_0, -1};
+Rule rule130 = {&nonterm65, 1, &reduce_e64_1, -1};
+Rule rule131 = {&nonterm65, 3, &reduce_e64_2, -1};
+Rule rule132 = {&nonterm65, 2, &reduce_e64_3, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+
+std::vector<Shift> shift0 = {{&term0, &state1}, {&term2, &state2}, {&term67, &state3}, {&term69, &state4}};
+std::vector<Reduce> reduce0 = {};
+std::vector<Shift> shift1 = {};
+std::vector<Reduce> reduce1 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift2 = {};
+std::vector<Reduce> reduce2 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift3 = {{&term0, &state199}, {&term2, &state200}, {&term67, &state201}, {&term69, &state202}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift5 = {{&term3, &state196}};
+std::vector<Reduce> reduce5 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift6 = {{&term4, &state194}};
+std::vector<Reduce> reduce6 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift7 = {{&term5, &state192}};
+std::vector<Reduce> reduce7 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift8 = {{&term6, &state190}};
+std::vector<Reduce> reduce8 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift9 = {{&term7, &state188}};
+std::vector<Reduce> reduce9 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift10 = {{&term8, &state186}};
+std::vector<Reduce> reduce10 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift11 = {{&term9, &state184}};
+std::vector<Reduce> reduce11 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift12 = {{&term10, &state182}};
+std::vector<Reduce> reduce12 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift13 = {{&term11, &state180}};
+std::vector<Reduce> reduce13 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift14 = {{&term12, &state178}};
+std::vector<Reduce> reduce14 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift15 = {{&term13, &state176}};
+std::vector<Reduce> reduce15 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift16 = {{&term14, &state174}};
+std::vector<Reduce> reduce16 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift17 = {{&term15, &state172}};
+std::vector<Reduce> reduce17 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift18 = {{&term16, &state170}};
+std::vector<Reduce> reduce18 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift19 = {{&term17, &state168}};
+std::vector<Reduce> reduce19 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift20 = {{&term18, &state166}};
+std::vector<Reduce> reduce20 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift21 = {{&term19, &state164}};
+std::vector<Reduce> reduce21 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift22 = {{&term20, &state162}};
+std::vector<Reduce> reduce22 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift23 = {{&term21, &state160}};
+std::vector<Reduce> reduce23 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift24 = {{&term22, &state158}};
+std::vector<Reduce> reduce24 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift25 = {{&term23, &state156}};
+std::vector<Reduce> reduce25 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift26 = {{&term24, &state154}};
+std::vector<Reduce> reduce26 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift27 = {{&term25, &state152}};
+std::vector<Reduce> reduce27 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift28 = {{&term26, &state150}};
+std::vector<Reduce> reduce28 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift29 = {{&term27, &state148}};
+std::vector<Reduce> reduce29 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift30 = {{&term28, &state146}};
+std::vector<Reduce> reduce30 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift31 = {{&term29, &state144}};
+std::vector<Reduce> reduce31 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift32 = {{&term30, &state142}};
+std::vector<Reduce> reduce32 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift33 = {{&term31, &state140}};
+std::vector<Reduce> reduce33 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift34 = {{&term32, &state138}};
+std::vector<Reduce> reduce34 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift35 = {{&term33, &state136}};
+std::vector<Reduce> reduce35 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift36 = {{&term34, &state134}};
+std::vector<Reduce> reduce36 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift37 = {{&term35, &state132}};
+std::vector<Reduce> reduce37 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift38 = {{&term36, &state130}};
+std::vector<Reduce> reduce38 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift39 = {{&term37, &state128}};
+std::vector<Reduce> reduce39 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift40 = {{&term38, &state126}};
+std::vector<Reduce> reduce40 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift41 = {{&term39, &state124}};
+std::vector<Reduce> reduce41 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift42 = {{&term40, &state122}};
+std::vector<Reduce> reduce42 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift43 = {{&term41, &state120}};
+std::vector<Reduce> reduce43 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift44 = {{&term42, &state118}};
+std::vector<Reduce> reduce44 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift45 = {{&term43, &state116}};
+std::vector<Reduce> reduce45 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift46 = {{&term44, &state114}};
+std::vector<Reduce> reduce46 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift47 = {{&term45, &state112}};
+std::vector<Reduce> reduce47 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift48 = {{&term46, &state110}};
+std::vector<Reduce> reduce48 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift49 = {{&term47, &state108}};
+std::vector<Reduce> reduce49 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift50 = {{&term48, &state106}};
+std::vector<Reduce> reduce50 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift51 = {{&term49, &state104}};
+std::vector<Reduce> reduce51 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift52 = {{&term50, &state102}};
+std::vector<Reduce> reduce52 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift53 = {{&term51, &state100}};
+std::vector<Reduce> reduce53 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift54 = {{&term52, &state98}};
+std::vector<Reduce> reduce54 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift55 = {{&term53, &state96}};
+std::vector<Reduce> reduce55 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift56 = {{&term54, &state94}};
+std::vector<Reduce> reduce56 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift57 = {{&term55, &state92}};
+std::vector<Reduce> reduce57 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift58 = {{&term56, &state90}};
+std::vector<Reduce> reduce58 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift59 = {{&term57, &state88}};
+std::vector<Reduce> reduce59 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift60 = {{&term58, &state86}};
+std::vector<Reduce> reduce60 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift61 = {{&term59, &state84}};
+std::vector<Reduce> reduce61 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift62 = {{&term60, &state82}};
+std::vector<Reduce> reduce62 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift63 = {{&term61, &state80}};
+std::vector<Reduce> reduce63 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift64 = {{&term62, &state78}};
+std::vector<Reduce> reduce64 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift65 = {{&term63, &state76}};
+std::vector<Reduce> reduce65 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift66 = {{&term64, &state74}};
+std::vector<Reduce> reduce66 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift67 = {{&term65, &state72}};
+std::vector<Reduce> reduce67 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift68 = {{&term66, &state70}};
+std::vector<Reduce> reduce68 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift69 = {};
+std::vector<Reduce> reduce69 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift71 = {};
+std::vector<Reduce> reduce71 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift73 = {{&term66, &state70}};
+std::vector<Reduce> reduce73 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift75 = {{&term65, &state72}};
+std::vector<Reduce> reduce75 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift77 = {{&term64, &state74}};
+std::vector<Reduce> reduce77 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift79 = {{&term63, &state76}};
+std::vector<Reduce> reduce79 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift81 = {{&term62, &state78}};
+std::vector<Reduce> reduce81 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift83 = {{&term61, &state80}};
+std::vector<Reduce> reduce83 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift85 = {{&term60, &state82}};
+std::vector<Reduce> reduce85 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift87 = {{&term59, &state84}};
+std::vector<Reduce> reduce87 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift89 = {{&term58, &state86}};
+std::vector<Reduce> reduce89 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift91 = {{&term57, &state88}};
+std::vector<Reduce> reduce91 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift93 = {{&term56, &state90}};
+std::vector<Reduce> reduce93 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift95 = {{&term55, &state92}};
+std::vector<Reduce> reduce95 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift97 = {{&term54, &state94}};
+std::vector<Reduce> reduce97 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift99 = {{&term53, &state96}};
+std::vector<Reduce> reduce99 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift101 = {{&term52, &state98}};
+std::vector<Reduce> reduce101 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift103 = {{&term51, &state100}};
+std::vector<Reduce> reduce103 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift105 = {{&term50, &state102}};
+std::vector<Reduce> reduce105 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift107 = {{&term49, &state104}};
+std::vector<Reduce> reduce107 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift109 = {{&term48, &state106}};
+std::vector<Reduce> reduce109 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift111 = {{&term47, &state108}};
+std::vector<Reduce> reduce111 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift113 = {{&term46, &state110}};
+std::vector<Reduce> reduce113 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift115 = {{&term45, &state112}};
+std::vector<Reduce> reduce115 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift117 = {{&term44, &state114}};
+std::vector<Reduce> reduce117 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift119 = {{&term43, &state116}};
+std::vector<Reduce> reduce119 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift121 = {{&term42, &state118}};
+std::vector<Reduce> reduce121 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift123 = {{&term41, &state120}};
+std::vector<Reduce> reduce123 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift125 = {{&term40, &state122}};
+std::vector<Reduce> reduce125 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift127 = {{&term39, &state124}};
+std::vector<Reduce> reduce127 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift129 = {{&term38, &state126}};
+std::vector<Reduce> reduce129 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift131 = {{&term37, &state128}};
+std::vector<Reduce> reduce131 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift133 = {{&term36, &state130}};
+std::vector<Reduce> reduce133 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift135 = {{&term35, &state132}};
+std::vector<Reduce> reduce135 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift137 = {{&term34, &state134}};
+std::vector<Reduce> reduce137 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift139 = {{&term33, &state136}};
+std::vector<Reduce> reduce139 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift141 = {{&term32, &state138}};
+std::vector<Reduce> reduce141 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift143 = {{&term31, &state140}};
+std::vector<Reduce> reduce143 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift145 = {{&term30, &state142}};
+std::vector<Reduce> reduce145 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift147 = {{&term29, &state144}};
+std::vector<Reduce> reduce147 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift149 = {{&term28, &state146}};
+std::vector<Reduce> reduce149 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift151 = {{&term27, &state148}};
+std::vector<Reduce> reduce151 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift153 = {{&term26, &state150}};
+std::vector<Reduce> reduce153 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift155 = {{&term25, &state152}};
+std::vector<Reduce> reduce155 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift157 = {{&term24, &state154}};
+std::vector<Reduce> reduce157 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift159 = {{&term23, &state156}};
+std::vector<Reduce> reduce159 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift161 = {{&term22, &state158}};
+std::vector<Reduce> reduce161 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift163 = {{&term21, &state160}};
+std::vector<Reduce> reduce163 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift165 = {{&term20, &state162}};
+std::vector<Reduce> reduce165 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift167 = {{&term19, &state164}};
+std::vector<Reduce> reduce167 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift169 = {{&term18, &state166}};
+std::vector<Reduce> reduce169 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift171 = {{&term17, &state168}};
+std::vector<Reduce> reduce171 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift173 = {{&term16, &state170}};
+std::vector<Reduce> reduce173 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift175 = {{&term15, &state172}};
+std::vector<Reduce> reduce175 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift177 = {{&term14, &state174}};
+std::vector<Reduce> reduce177 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift179 = {{&term13, &state176}};
+std::vector<Reduce> reduce179 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift181 = {{&term12, &state178}};
+std::vector<Reduce> reduce181 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift183 = {{&term11, &state180}};
+std::vector<Reduce> reduce183 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift185 = {{&term10, &state182}};
+std::vector<Reduce> reduce185 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift187 = {{&term9, &state184}};
+std::vector<Reduce> reduce187 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift189 = {{&term8, &state186}};
+std::vector<Reduce> reduce189 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift191 = {{&term7, &state188}};
+std::vector<Reduce> reduce191 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift193 = {{&term6, &state190}};
+std::vector<Reduce> reduce193 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift195 = {{&term5, &state192}};
+std::vector<Reduce> reduce195 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift197 = {{&term4, &state194}};
+std::vector<Reduce> reduce197 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift198 = {};
+std::vector<Reduce> reduce198 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift203 = {{&term3, &state394}, {&term68, &state395}};
+std::vector<Reduce> reduce203 = {};
+std::vector<Shift> shift204 = {{&term4, &state392}};
+std::vector<Reduce> reduce204 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift205 = {{&term5, &state390}};
+std::vector<Reduce> reduce205 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift206 = {{&term6, &state388}};
+std::vector<Reduce> reduce206 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift207 = {{&term7, &state386}};
+std::vector<Reduce> reduce207 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift208 = {{&term8, &state384}};
+std::vector<Reduce> reduce208 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift209 = {{&term9, &state382}};
+std::vector<Reduce> reduce209 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift210 = {{&term10, &state380}};
+std::vector<Reduce> reduce210 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift211 = {{&term11, &state378}};
+std::vector<Reduce> reduce211 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift212 = {{&term12, &state376}};
+std::vector<Reduce> reduce212 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift213 = {{&term13, &state374}};
+std::vector<Reduce> reduce213 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift214 = {{&term14, &state372}};
+std::vector<Reduce> reduce214 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift215 = {{&term15, &state370}};
+std::vector<Reduce> reduce215 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift216 = {{&term16, &state368}};
+std::vector<Reduce> reduce216 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift217 = {{&term17, &state366}};
+std::vector<Reduce> reduce217 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift218 = {{&term18, &state364}};
+std::vector<Reduce> reduce218 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift219 = {{&term19, &state362}};
+std::vector<Reduce> reduce219 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift220 = {{&term20, &state360}};
+std::vector<Reduce> reduce220 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift221 = {{&term21, &state358}};
+std::vector<Reduce> reduce221 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift222 = {{&term22, &state356}};
+std::vector<Reduce> reduce222 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift223 = {{&term23, &state354}};
+std::vector<Reduce> reduce223 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift224 = {{&term24, &state352}};
+std::vector<Reduce> reduce224 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift225 = {{&term25, &state350}};
+std::vector<Reduce> reduce225 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift226 = {{&term26, &state348}};
+std::vector<Reduce> reduce226 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift227 = {{&term27, &state346}};
+std::vector<Reduce> reduce227 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift228 = {{&term28, &state344}};
+std::vector<Reduce> reduce228 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift229 = {{&term29, &state342}};
+std::vector<Reduce> reduce229 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift230 = {{&term30, &state340}};
+std::vector<Reduce> reduce230 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift231 = {{&term31, &state338}};
+std::vector<Reduce> reduce231 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift232 = {{&term32, &state336}};
+std::vector<Reduce> reduce232 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift233 = {{&term33, &state334}};
+std::vector<Reduce> reduce233 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift234 = {{&term34, &state332}};
+std::vector<Reduce> reduce234 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift235 = {{&term35, &state330}};
+std::vector<Reduce> reduce235 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift236 = {{&term36, &state328}};
+std::vector<Reduce> reduce236 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift237 = {{&term37, &state326}};
+std::vector<Reduce> reduce237 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift238 = {{&term38, &state324}};
+std::vector<Reduce> reduce238 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift239 = {{&term39, &state322}};
+std::vector<Reduce> reduce239 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift240 = {{&term40, &state320}};
+std::vector<Reduce> reduce240 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift241 = {{&term41, &state318}};
+std::vector<Reduce> reduce241 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift242 = {{&term42, &state316}};
+std::vector<Reduce> reduce242 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift243 = {{&term43, &state314}};
+std::vector<Reduce> reduce243 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift244 = {{&term44, &state312}};
+std::vector<Reduce> reduce244 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift245 = {{&term45, &state310}};
+std::vector<Reduce> reduce245 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift246 = {{&term46, &state308}};
+std::vector<Reduce> reduce246 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift247 = {{&term47, &state306}};
+std::vector<Reduce> reduce247 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift248 = {{&term48, &state304}};
+std::vector<Reduce> reduce248 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift249 = {{&term49, &state302}};
+std::vector<Reduce> reduce249 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift250 = {{&term50, &state300}};
+std::vector<Reduce> reduce250 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift251 = {{&term51, &state298}};
+std::vector<Reduce> reduce251 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift252 = {{&term52, &state296}};
+std::vector<Reduce> reduce252 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift253 = {{&term53, &state294}};
+std::vector<Reduce> reduce253 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift254 = {{&term54, &state292}};
+std::vector<Reduce> reduce254 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift255 = {{&term55, &state290}};
+std::vector<Reduce> reduce255 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift256 = {{&term56, &state288}};
+std::vector<Reduce> reduce256 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift257 = {{&term57, &state286}};
+std::vector<Reduce> reduce257 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift258 = {{&term58, &state284}};
+std::vector<Reduce> reduce258 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift259 = {{&term59, &state282}};
+std::vector<Reduce> reduce259 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift260 = {{&term60, &state280}};
+std::vector<Reduce> reduce260 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift261 = {{&term61, &state278}};
+std::vector<Reduce> reduce261 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift262 = {{&term62, &state276}};
+std::vector<Reduce> reduce262 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift263 = {{&term63, &state274}};
+std::vector<Reduce> reduce263 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift264 = {{&term64, &state272}};
+std::vector<Reduce> reduce264 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift265 = {{&term65, &state270}};
+std::vector<Reduce> reduce265 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift266 = {{&term66, &state268}};
+std::vector<Reduce> reduce266 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift271 = {{&term66, &state268}};
+std::vector<Reduce> reduce271 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift273 = {{&term65, &state270}};
+std::vector<Reduce> reduce273 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift275 = {{&term64, &state272}};
+std::vector<Reduce> reduce275 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift277 = {{&term63, &state274}};
+std::vector<Reduce> reduce277 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift279 = {{&term62, &state276}};
+std::vector<Reduce> reduce279 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift281 = {{&term61, &state278}};
+std::vector<Reduce> reduce281 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift283 = {{&term60, &state280}};
+std::vector<Reduce> reduce283 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift285 = {{&term59, &state282}};
+std::vector<Reduce> reduce285 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift287 = {{&term58, &state284}};
+std::vector<Reduce> reduce287 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift289 = {{&term57, &state286}};
+std::vector<Reduce> reduce289 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift291 = {{&term56, &state288}};
+std::vector<Reduce> reduce291 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift293 = {{&term55, &state290}};
+std::vector<Reduce> reduce293 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift295 = {{&term54, &state292}};
+std::vector<Reduce> reduce295 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift297 = {{&term53, &state294}};
+std::vector<Reduce> reduce297 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift299 = {{&term52, &state296}};
+std::vector<Reduce> reduce299 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift301 = {{&term51, &state298}};
+std::vector<Reduce> reduce301 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift303 = {{&term50, &state300}};
+std::vector<Reduce> reduce303 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift305 = {{&term49, &state302}};
+std::vector<Reduce> reduce305 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift307 = {{&term48, &state304}};
+std::vector<Reduce> reduce307 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift309 = {{&term47, &state306}};
+std::vector<Reduce> reduce309 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift311 = {{&term46, &state308}};
+std::vector<Reduce> reduce311 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift313 = {{&term45, &state310}};
+std::vector<Reduce> reduce313 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift315 = {{&term44, &state312}};
+std::vector<Reduce> reduce315 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift317 = {{&term43, &state314}};
+std::vector<Reduce> reduce317 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift319 = {{&term42, &state316}};
+std::vector<Reduce> reduce319 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift321 = {{&term41, &state318}};
+std::vector<Reduce> reduce321 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift323 = {{&term40, &state320}};
+std::vector<Reduce> reduce323 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift325 = {{&term39, &state322}};
+std::vector<Reduce> reduce325 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift327 = {{&term38, &state324}};
+std::vector<Reduce> reduce327 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift329 = {{&term37, &state326}};
+std::vector<Reduce> reduce329 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift331 = {{&term36, &state328}};
+std::vector<Reduce> reduce331 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift333 = {{&term35, &state330}};
+std::vector<Reduce> reduce333 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift335 = {{&term34, &state332}};
+std::vector<Reduce> reduce335 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift337 = {{&term33, &state334}};
+std::vector<Reduce> reduce337 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift339 = {{&term32, &state336}};
+std::vector<Reduce> reduce339 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift341 = {{&term31, &state338}};
+std::vector<Reduce> reduce341 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift343 = {{&term30, &state340}};
+std::vector<Reduce> reduce343 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift345 = {{&term29, &state342}};
+std::vector<Reduce> reduce345 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift347 = {{&term28, &state344}};
+std::vector<Reduce> reduce347 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift349 = {{&term27, &state346}};
+std::vector<Reduce> reduce349 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift351 = {{&term26, &state348}};
+std::vector<Reduce> reduce351 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift353 = {{&term25, &state350}};
+std::vector<Reduce> reduce353 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift355 = {{&term24, &state352}};
+std::vector<Reduce> reduce355 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift357 = {{&term23, &state354}};
+std::vector<Reduce> reduce357 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift359 = {{&term22, &state356}};
+std::vector<Reduce> reduce359 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift361 = {{&term21, &state358}};
+std::vector<Reduce> reduce361 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift363 = {{&term20, &state360}};
+std::vector<Reduce> reduce363 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift365 = {{&term19, &state362}};
+std::vector<Reduce> reduce365 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift367 = {{&term18, &state364}};
+std::vector<Reduce> reduce367 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift369 = {{&term17, &state366}};
+std::vector<Reduce> reduce369 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift371 = {{&term16, &state368}};
+std::vector<Reduce> reduce371 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift373 = {{&term15, &state370}};
+std::vector<Reduce> reduce373 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift375 = {{&term14, &state372}};
+std::vector<Reduce> reduce375 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift377 = {{&term13, &state374}};
+std::vector<Reduce> reduce377 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift379 = {{&term12, &state376}};
+std::vector<Reduce> reduce379 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift381 = {{&term11, &state378}};
+std::vector<Reduce> reduce381 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift383 = {{&term10, &state380}};
+std::vector<Reduce> reduce383 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift385 = {{&term9, &state382}};
+std::vector<Reduce> reduce385 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift387 = {{&term8, &state384}};
+std::vector<Reduce> reduce387 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift389 = {{&term7, &state386}};
+std::vector<Reduce> reduce389 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift391 = {{&term6, &state388}};
+std::vector<Reduce> reduce391 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift393 = {{&term5, &state390}};
+std::vector<Reduce> reduce393 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift395 = {};
+std::vector<Reduce> reduce395 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift396 = {{&term4, &state392}};
+std::vector<Reduce> reduce396 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift398 = {{&term3, &state394}, {&term68, &state399}};
+std::vector<Reduce> reduce398 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state5}, {&nonterm2, &state6}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go3 = {{&nonterm1, &state203}, {&nonterm2, &state204}, {&nonterm3, &state205}, {&nonterm4, &state206}, {&nonterm5, &state207}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go4 = {{&nonterm65, &state198}};
+std::vector<Go> go70 = {{&nonterm65, &state71}};
+std::vector<Go> go72 = {{&nonterm64, &state73}, {&nonterm65, &state69}};
+std::vector<Go> go74 = {{&nonterm63, &state75}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go76 = {{&nonterm62, &state77}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go78 = {{&nonterm61, &state79}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go80 = {{&nonterm60, &state81}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go82 = {{&nonterm59, &state83}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go84 = {{&nonterm58, &state85}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go86 = {{&nonterm57, &state87}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go88 = {{&nonterm56, &state89}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go90 = {{&nonterm55, &state91}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go92 = {{&nonterm54, &state93}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go94 = {{&nonterm53, &state95}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go96 = {{&nonterm52, &state97}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go98 = {{&nonterm51, &state99}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go100 = {{&nonterm50, &state101}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go102 = {{&nonterm49, &state103}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go104 = {{&nonterm48, &state105}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go106 = {{&nonterm47, &state107}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go108 = {{&nonterm46, &state109}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go110 = {{&nonterm45, &state111}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go112 = {{&nonterm44, &state113}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go114 = {{&nonterm43, &state115}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go116 = {{&nonterm42, &state117}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go118 = {{&nonterm41, &state119}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go120 = {{&nonterm40, &state121}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go122 = {{&nonterm39, &state123}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go124 = {{&nonterm38, &state125}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go126 = {{&nonterm37, &state127}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go128 = {{&nonterm36, &state129}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go130 = {{&nonterm35, &state131}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go132 = {{&nonterm34, &state133}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go134 = {{&nonterm33, &state135}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go136 = {{&nonterm32, &state137}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go138 = {{&nonterm31, &state139}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go140 = {{&nonterm30, &state141}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go142 = {{&nonterm29, &state143}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go144 = {{&nonterm28, &state145}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go146 = {{&nonterm27, &state147}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go148 = {{&nonterm26, &state149}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go150 = {{&nonterm25, &state151}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go152 = {{&nonterm24, &state153}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go154 = {{&nonterm23, &state155}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go156 = {{&nonterm22, &state157}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go158 = {{&nonterm21, &state159}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go160 = {{&nonterm20, &state161}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go162 = {{&nonterm19, &state163}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go164 = {{&nonterm18, &state165}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go166 = {{&nonterm17, &state167}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go168 = {{&nonterm16, &state169}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go170 = {{&nonterm15, &state171}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go172 = {{&nonterm14, &state173}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go174 = {{&nonterm13, &state175}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go176 = {{&nonterm12, &state177}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go178 = {{&nonterm11, &state179}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go180 = {{&nonterm10, &state181}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go182 = {{&nonterm9, &state183}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go184 = {{&nonterm8, &state185}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go186 = {{&nonterm7, &state187}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go188 = {{&nonterm6, &state189}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go190 = {{&nonterm5, &state191}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go192 = {{&nonterm4, &state193}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go194 = {{&nonterm3, &state195}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go196 = {{&nonterm2, &state197}, {&nonterm3, &state7}, {&nonterm4, &state8}, {&nonterm5, &state9}, {&nonterm6, &state10}, {&nonterm7, &state11}, {&nonterm8, &state12}, {&nonterm9, &state13}, {&nonterm10, &state14}, {&nonterm11, &state15}, {&nonterm12, &state16}, {&nonterm13, &state17}, {&nonterm14, &state18}, {&nonterm15, &state19}, {&nonterm16, &state20}, {&nonterm17, &state21}, {&nonterm18, &state22}, {&nonterm19, &state23}, {&nonterm20, &state24}, {&nonterm21, &state25}, {&nonterm22, &state26}, {&nonterm23, &state27}, {&nonterm24, &state28}, {&nonterm25, &state29}, {&nonterm26, &state30}, {&nonterm27, &state31}, {&nonterm28, &state32}, {&nonterm29, &state33}, {&nonterm30, &state34}, {&nonterm31, &state35}, {&nonterm32, &state36}, {&nonterm33, &state37}, {&nonterm34, &state38}, {&nonterm35, &state39}, {&nonterm36, &state40}, {&nonterm37, &state41}, {&nonterm38, &state42}, {&nonterm39, &state43}, {&nonterm40, &state44}, {&nonterm41, &state45}, {&nonterm42, &state46}, {&nonterm43, &state47}, {&nonterm44, &state48}, {&nonterm45, &state49}, {&nonterm46, &state50}, {&nonterm47, &state51}, {&nonterm48, &state52}, {&nonterm49, &state53}, {&nonterm50, &state54}, {&nonterm51, &state55}, {&nonterm52, &state56}, {&nonterm53, &state57}, {&nonterm54, &state58}, {&nonterm55, &state59}, {&nonterm56, &state60}, {&nonterm57, &state61}, {&nonterm58, &state62}, {&nonterm59, &state63}, {&nonterm60, &state64}, {&nonterm61, &state65}, {&nonterm62, &state66}, {&nonterm63, &state67}, {&nonterm64, &state68}, {&nonterm65, &state69}};
+std::vector<Go> go201 = {{&nonterm1, &state398}, {&nonterm2, &state204}, {&nonterm3, &state205}, {&nonterm4, &state206}, {&nonterm5, &state207}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go202 = {{&nonterm65, &state397}};
+std::vector<Go> go268 = {{&nonterm65, &state269}};
+std::vector<Go> go270 = {{&nonterm64, &state271}, {&nonterm65, &state267}};
+std::vector<Go> go272 = {{&nonterm63, &state273}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go274 = {{&nonterm62, &state275}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go276 = {{&nonterm61, &state277}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go278 = {{&nonterm60, &state279}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go280 = {{&nonterm59, &state281}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go282 = {{&nonterm58, &state283}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go284 = {{&nonterm57, &state285}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go286 = {{&nonterm56, &state287}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go288 = {{&nonterm55, &state289}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go290 = {{&nonterm54, &state291}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go292 = {{&nonterm53, &state293}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go294 = {{&nonterm52, &state295}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go296 = {{&nonterm51, &state297}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go298 = {{&nonterm50, &state299}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go300 = {{&nonterm49, &state301}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go302 = {{&nonterm48, &state303}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go304 = {{&nonterm47, &state305}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go306 = {{&nonterm46, &state307}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go308 = {{&nonterm45, &state309}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go310 = {{&nonterm44, &state311}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go312 = {{&nonterm43, &state313}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go314 = {{&nonterm42, &state315}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go316 = {{&nonterm41, &state317}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go318 = {{&nonterm40, &state319}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go320 = {{&nonterm39, &state321}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go322 = {{&nonterm38, &state323}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go324 = {{&nonterm37, &state325}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go326 = {{&nonterm36, &state327}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go328 = {{&nonterm35, &state329}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go330 = {{&nonterm34, &state331}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go332 = {{&nonterm33, &state333}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go334 = {{&nonterm32, &state335}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go336 = {{&nonterm31, &state337}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go338 = {{&nonterm30, &state339}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go340 = {{&nonterm29, &state341}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go342 = {{&nonterm28, &state343}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go344 = {{&nonterm27, &state345}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go346 = {{&nonterm26, &state347}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go348 = {{&nonterm25, &state349}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go350 = {{&nonterm24, &state351}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go352 = {{&nonterm23, &state353}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go354 = {{&nonterm22, &state355}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go356 = {{&nonterm21, &state357}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go358 = {{&nonterm20, &state359}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go360 = {{&nonterm19, &state361}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go362 = {{&nonterm18, &state363}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go364 = {{&nonterm17, &state365}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go366 = {{&nonterm16, &state367}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go368 = {{&nonterm15, &state369}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go370 = {{&nonterm14, &state371}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go372 = {{&nonterm13, &state373}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go374 = {{&nonterm12, &state375}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go376 = {{&nonterm11, &state377}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go378 = {{&nonterm10, &state379}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go380 = {{&nonterm9, &state381}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go382 = {{&nonterm8, &state383}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go384 = {{&nonterm7, &state385}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go386 = {{&nonterm6, &state387}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go388 = {{&nonterm5, &state389}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go390 = {{&nonterm4, &state391}, {&nonterm5, &state207}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go392 = {{&nonterm3, &state393}, {&nonterm4, &state206}, {&nonterm5, &state207}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+std::vector<Go> go394 = {{&nonterm2, &state396}, {&nonterm3, &state205}, {&nonterm4, &state206}, {&nonterm5, &state207}, {&nonterm6, &state208}, {&nonterm7, &state209}, {&nonterm8, &state210}, {&nonterm9, &state211}, {&nonterm10, &state212}, {&nonterm11, &state213}, {&nonterm12, &state214}, {&nonterm13, &state215}, {&nonterm14, &state216}, {&nonterm15, &state217}, {&nonterm16, &state218}, {&nonterm17, &state219}, {&nonterm18, &state220}, {&nonterm19, &state221}, {&nonterm20, &state222}, {&nonterm21, &state223}, {&nonterm22, &state224}, {&nonterm23, &state225}, {&nonterm24, &state226}, {&nonterm25, &state227}, {&nonterm26, &state228}, {&nonterm27, &state229}, {&nonterm28, &state230}, {&nonterm29, &state231}, {&nonterm30, &state232}, {&nonterm31, &state233}, {&nonterm32, &state234}, {&nonterm33, &state235}, {&nonterm34, &state236}, {&nonterm35, &state237}, {&nonterm36, &state238}, {&nonterm37, &state239}, {&nonterm38, &state240}, {&nonterm39, &state241}, {&nonterm40, &state242}, {&nonterm41, &state243}, {&nonterm42, &state244}, {&nonterm43, &state245}, {&nonterm44, &state246}, {&nonterm45, &state247}, {&nonterm46, &state248}, {&nonterm47, &state249}, {&nonterm48, &state250}, {&nonterm49, &state251}, {&nonterm50, &state252}, {&nonterm51, &state253}, {&nonterm52, &state254}, {&nonterm53, &state255}, {&nonterm54, &state256}, {&nonterm55, &state257}, {&nonterm56, &state258}, {&nonterm57, &state259}, {&nonterm58, &state260}, {&nonterm59, &state261}, {&nonterm60, &state262}, {&nonterm61, &state263}, {&nonterm62, &state264}, {&nonterm63, &state265}, {&nonterm64, &state266}, {&nonterm65, &state267}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, nullptr};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift0, &reduce0, &go4};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift8, &reduce8, nullptr};
+State state9 = {&shift9, &reduce9, nullptr};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift12, &reduce12, nullptr};
+State state13 = {&shift13, &reduce13, nullptr};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift16, &reduce16, nullptr};
+State state17 = {&shift17, &reduce17, nullptr};
+State state18 = {&shift18, &reduce18, nullptr};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift21, &reduce21, nullptr};
+State state22 = {&shift22, &reduce22, nullptr};
+State state23 = {&shift23, &reduce23, nullptr};
+State state24 = {&shift24, &reduce24, nullptr};
+State state25 = {&shift25, &reduce25, nullptr};
+State state26 = {&shift26, &reduce26, nullptr};
+State state27 = {&shift27, &reduce27, nullptr};
+State state28 = {&shift28, &reduce28, nullptr};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift33, &reduce33, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift35, &reduce35, nullptr};
+State state36 = {&shift36, &reduce36, nullptr};
+State state37 = {&shift37, &reduce37, nullptr};
+State state38 = {&shift38, &reduce38, nullptr};
+State state39 = {&shift39, &reduce39, nullptr};
+State state40 = {&shift40, &reduce40, nullptr};
+State state41 = {&shift41, &reduce41, nullptr};
+State state42 = {&shift42, &reduce42, nullptr};
+State state43 = {&shift43, &reduce43, nullptr};
+State state44 = {&shift44, &reduce44, nullptr};
+State state45 = {&shift45, &reduce45, nullptr};
+State state46 = {&shift46, &reduce46, nullptr};
+State state47 = {&shift47, &reduce47, nullptr};
+State state48 = {&shift48, &reduce48, nullptr};
+State state49 = {&shift49, &reduce49, nullptr};
+State state50 = {&shift50, &reduce50, nullptr};
+State state51 = {&shift51, &reduce51, nullptr};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift0, &reduce0, &go70};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift0, &reduce0, &go72};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift0, &reduce0, &go74};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift0, &reduce0, &go76};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift0, &reduce0, &go78};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift0, &reduce0, &go80};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift0, &reduce0, &go82};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift0, &reduce0, &go84};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift0, &reduce0, &go86};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift0, &reduce0, &go88};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift0, &reduce0, &go90};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift0, &reduce0, &go92};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift0, &reduce0, &go94};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift0, &reduce0, &go96};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift0, &reduce0, &go98};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift0, &reduce0, &go100};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift0, &reduce0, &go102};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift0, &reduce0, &go104};
+State state105 = {&shift105, &reduce105, nullptr};
+State state106 = {&shift0, &reduce0, &go106};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift0, &reduce0, &go108};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift0, &reduce0, &go110};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift0, &reduce0, &go112};
+State state113 = {&shift113, &reduce113, nullptr};
+State state114 = {&shift0, &reduce0, &go114};
+State state115 = {&shift115, &reduce115, nullptr};
+State state116 = {&shift0, &reduce0, &go116};
+State state117 = {&shift117, &reduce117, nullptr};
+State state118 = {&shift0, &reduce0, &go118};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift0, &reduce0, &go120};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift0, &reduce0, &go122};
+State state123 = {&shift123, &reduce123, nullptr};
+State state124 = {&shift0, &reduce0, &go124};
+State state125 = {&shift125, &reduce125, nullptr};
+State state126 = {&shift0, &reduce0, &go126};
+State state127 = {&shift127, &reduce127, nullptr};
+State state128 = {&shift0, &reduce0, &go128};
+State state129 = {&shift129, &reduce129, nullptr};
+State state130 = {&shift0, &reduce0, &go130};
+State state131 = {&shift131, &reduce131, nullptr};
+State state132 = {&shift0, &reduce0, &go132};
+State state133 = {&shift133, &reduce133, nullptr};
+State state134 = {&shift0, &reduce0, &go134};
+State state135 = {&shift135, &reduce135, nullptr};
+State state136 = {&shift0, &reduce0, &go136};
+State state137 = {&shift137, &reduce137, nullptr};
+State state138 = {&shift0, &reduce0, &go138};
+State state139 = {&shift139, &reduce139, nullptr};
+State state140 = {&shift0, &reduce0, &go140};
+State state141 = {&shift141, &reduce141, nullptr};
+State state142 = {&shift0, &reduce0, &go142};
+State state143 = {&shift143, &reduce143, nullptr};
+State state144 = {&shift0, &reduce0, &go144};
+State state145 = {&shift145, &reduce145, nullptr};
+State state146 = {&shift0, &reduce0, &go146};
+State state147 = {&shift147, &reduce147, nullptr};
+State state148 = {&shift0, &reduce0, &go148};
+State state149 = {&shift149, &reduce149, nullptr};
+State state150 = {&shift0, &reduce0, &go150};
+State state151 = {&shift151, &reduce151, nullptr};
+State state152 = {&shift0, &reduce0, &go152};
+State state153 = {&shift153, &reduce153, nullptr};
+State state154 = {&shift0, &reduce0, &go154};
+State state155 = {&shift155, &reduce155, nullptr};
+State state156 = {&shift0, &reduce0, &go156};
+State state157 = {&shift157, &reduce157, nullptr};
+State state158 = {&shift0, &reduce0, &go158};
+State state159 = {&shift159, &reduce159, nullptr};
+State state160 = {&shift0, &reduce0, &go160};
+State state161 = {&shift161, &reduce161, nullptr};
+State state162 = {&shift0, &reduce0, &go162};
+State state163 = {&shift163, &reduce163, nullptr};
+State state164 = {&shift0, &reduce0, &go164};
+State state165 = {&shift165, &reduce165, nullptr};
+State state166 = {&shift0, &reduce0, &go166};
+State state167 = {&shift167, &reduce167, nullptr};
+State state168 = {&shift0, &reduce0, &go168};
+State state169 = {&shift169, &reduce169, nullptr};
+State state170 = {&shift0, &reduce0, &go170};
+State state171 = {&shift171, &reduce171, nullptr};
+State state172 = {&shift0, &reduce0, &go172};
+State state173 = {&shift173, &reduce173, nullptr};
+State state174 = {&shift0, &reduce0, &go174};
+State state175 = {&shift175, &reduce175, nullptr};
+State state176 = {&shift0, &reduce0, &go176};
+State state177 = {&shift177, &reduce177, nullptr};
+State state178 = {&shift0, &reduce0, &go178};
+State state179 = {&shift179, &reduce179, nullptr};
+State state180 = {&shift0, &reduce0, &go180};
+State state181 = {&shift181, &reduce181, nullptr};
+State state182 = {&shift0, &reduce0, &go182};
+State state183 = {&shift183, &reduce183, nullptr};
+State state184 = {&shift0, &reduce0, &go184};
+State state185 = {&shift185, &reduce185, nullptr};
+State state186 = {&shift0, &reduce0, &go186};
+State state187 = {&shift187, &reduce187, nullptr};
+State state188 = {&shift0, &reduce0, &go188};
+State state189 = {&shift189, &reduce189, nullptr};
+State state190 = {&shift0, &reduce0, &go190};
+State state191 = {&shift191, &reduce191, nullptr};
+State state192 = {&shift0, &reduce0, &go192};
+State state193 = {&shift193, &reduce193, nullptr};
+State state194 = {&shift0, &reduce0, &go194};
+State state195 = {&shift195, &reduce195, nullptr};
+State state196 = {&shift0, &reduce0, &go196};
+State state197 = {&shift197, &reduce197, nullptr};
+State state198 = {&shift198, &reduce198, nullptr};
+State state199 = {&shift1, &reduce1, nullptr};
+State state200 = {&shift2, &reduce2, nullptr};
+State state201 = {&shift3, &reduce3, &go201};
+State state202 = {&shift3, &reduce3, &go202};
+State state203 = {&shift203, &reduce203, nullptr};
+State state204 = {&shift204, &reduce204, nullptr};
+State state205 = {&shift205, &reduce205, nullptr};
+State state206 = {&shift206, &reduce206, nullptr};
+State state207 = {&shift207, &reduce207, nullptr};
+State state208 = {&shift208, &reduce208, nullptr};
+State state209 = {&shift209, &reduce209, nullptr};
+State state210 = {&shift210, &reduce210, nullptr};
+State state211 = {&shift211, &reduce211, nullptr};
+State state212 = {&shift212, &reduce212, nullptr};
+State state213 = {&shift213, &reduce213, nullptr};
+State state214 = {&shift214, &reduce214, nullptr};
+State state215 = {&shift215, &reduce215, nullptr};
+State state216 = {&shift216, &reduce216, nullptr};
+State state217 = {&shift217, &reduce217, nullptr};
+State state218 = {&shift218, &reduce218, nullptr};
+State state219 = {&shift219, &reduce219, nullptr};
+State state220 = {&shift220, &reduce220, nullptr};
+State state221 = {&shift221, &reduce221, nullptr};
+State state222 = {&shift222, &reduce222, nullptr};
+State state223 = {&shift223, &reduce223, nullptr};
+State state224 = {&shift224, &reduce224, nullptr};
+State state225 = {&shift225, &reduce225, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift227, &reduce227, nullptr};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift229, &reduce229, nullptr};
+State state230 = {&shift230, &reduce230, nullptr};
+State state231 = {&shift231, &reduce231, nullptr};
+State state232 = {&shift232, &reduce232, nullptr};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift236, &reduce236, nullptr};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, nullptr};
+State state240 = {&shift240, &reduce240, nullptr};
+State state241 = {&shift241, &reduce241, nullptr};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift245, &reduce245, nullptr};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, nullptr};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift250, &reduce250, nullptr};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift254, &reduce254, nullptr};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift257, &reduce257, nullptr};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift259, &reduce259, nullptr};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift263, &reduce263, nullptr};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, nullptr};
+State state267 = {&shift69, &reduce69, nullptr};
+State state268 = {&shift3, &reduce3, &go268};
+State state269 = {&shift71, &reduce71, nullptr};
+State state270 = {&shift3, &reduce3, &go270};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift3, &reduce3, &go272};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift3, &reduce3, &go274};
+State state275 = {&shift275, &reduce275, nullptr};
+State state276 = {&shift3, &reduce3, &go276};
+State state277 = {&shift277, &reduce277, nullptr};
+State state278 = {&shift3, &reduce3, &go278};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift3, &reduce3, &go280};
+State state281 = {&shift281, &reduce281, nullptr};
+State state282 = {&shift3, &reduce3, &go282};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift3, &reduce3, &go284};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift3, &reduce3, &go286};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift3, &reduce3, &go288};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift3, &reduce3, &go290};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift3, &reduce3, &go292};
+State state293 = {&shift293, &reduce293, nullptr};
+State state294 = {&shift3, &reduce3, &go294};
+State state295 = {&shift295, &reduce295, nullptr};
+State state296 = {&shift3, &reduce3, &go296};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift3, &reduce3, &go298};
+State state299 = {&shift299, &reduce299, nullptr};
+State state300 = {&shift3, &reduce3, &go300};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift3, &reduce3, &go302};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift3, &reduce3, &go304};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift3, &reduce3, &go306};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift3, &reduce3, &go308};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift3, &reduce3, &go310};
+State state311 = {&shift311, &reduce311, nullptr};
+State state312 = {&shift3, &reduce3, &go312};
+State state313 = {&shift313, &reduce313, nullptr};
+State state314 = {&shift3, &reduce3, &go314};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift3, &reduce3, &go316};
+State state317 = {&shift317, &reduce317, nullptr};
+State state318 = {&shift3, &reduce3, &go318};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift3, &reduce3, &go320};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift3, &reduce3, &go322};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift3, &reduce3, &go324};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift3, &reduce3, &go326};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift3, &reduce3, &go328};
+State state329 = {&shift329, &reduce329, nullptr};
+State state330 = {&shift3, &reduce3, &go330};
+State state331 = {&shift331, &reduce331, nullptr};
+State state332 = {&shift3, &reduce3, &go332};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift3, &reduce3, &go334};
+State state335 = {&shift335, &reduce335, nullptr};
+State state336 = {&shift3, &reduce3, &go336};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift3, &reduce3, &go338};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift3, &reduce3, &go340};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift3, &reduce3, &go342};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift3, &reduce3, &go344};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift3, &reduce3, &go346};
+State state347 = {&shift347, &reduce347, nullptr};
+State state348 = {&shift3, &reduce3, &go348};
+State state349 = {&shift349, &reduce349, nullptr};
+State state350 = {&shift3, &reduce3, &go350};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift3, &reduce3, &go352};
+State state353 = {&shift353, &reduce353, nullptr};
+State state354 = {&shift3, &reduce3, &go354};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift3, &reduce3, &go356};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift3, &reduce3, &go358};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift3, &reduce3, &go360};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift3, &reduce3, &go362};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift3, &reduce3, &go364};
+State state365 = {&shift365, &reduce365, nullptr};
+State state366 = {&shift3, &reduce3, &go366};
+State state367 = {&shift367, &reduce367, nullptr};
+State state368 = {&shift3, &reduce3, &go368};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift3, &reduce3, &go370};
+State state371 = {&shift371, &reduce371, nullptr};
+State state372 = {&shift3, &reduce3, &go372};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift3, &reduce3, &go374};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift3, &reduce3, &go376};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift3, &reduce3, &go378};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift3, &reduce3, &go380};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift3, &reduce3, &go382};
+State state383 = {&shift383, &reduce383, nullptr};
+State state384 = {&shift3, &reduce3, &go384};
+State state385 = {&shift385, &reduce385, nullptr};
+State state386 = {&shift3, &reduce3, &go386};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift3, &reduce3, &go388};
+State state389 = {&shift389, &reduce389, nullptr};
+State state390 = {&shift3, &reduce3, &go390};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift3, &reduce3, &go392};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift3, &reduce3, &go394};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift198, &reduce198, nullptr};
+State state398 = {&shift398, &reduce398, nullptr};
+State state399 = {&shift395, &reduce395, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
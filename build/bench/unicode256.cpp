@@ -0,0 +1,1079 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"=", false, 3};
+Symbol term4 = {";", false, 4};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+
+unsigned short lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 10, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+
+int lexer_starts[] = {
+    256, 289, 320, 353, 384, 417, 448, 481,
+    512, 545, 576, 609, 640, 673, 704, 737,
+    768, 801, 832, 865, 896, 929, 960, 993,
+    1024, 1057, 1088, 1121, 1152, 1185, 1216, 1249,
+    1280, 1313, 1344, 1377, 1408, 1441, 1472, 1505,
+    1536, 1569, 1600, 1633, 1664, 1697, 1728, 1761,
+    1792, 1825, 1856, 1889, 1920, 1953, 1984, 2017,
+    2048, 2081, 2112, 2145, 2176, 2209, 2240, 2273,
+    2304, 2337, 2368, 2401, 2432, 2465, 2496, 2529,
+    2560, 2593, 2624, 2657, 2688, 2721, 2752, 2785,
+    2816, 2849, 2880, 2913, 2944, 2977, 3008, 3041,
+    3072, 3105, 3136, 3169, 3200, 3233, 3264, 3297,
+    3328, 3361, 3392, 3425, 3456, 3489, 3520, 3553,
+    3584, 3617, 3648, 3681, 3712, 3745, 3776, 3809,
+    3840, 3873, 3904, 3937, 3968, 4001, 4032, 4065,
+    4096, 4129, 4160, 4193, 4224, 4257, 4288, 4321,
+    4352, 4385, 4416, 4449, 4480, 4513, 4544, 4577,
+    4608, 4641, 4672, 4705, 4736, 4769, 4800, 4833,
+    4864, 4897, 4928, 4961, 4992, 5025, 5056, 5089,
+    5120, 5153, 5184, 5217, 5248, 5281, 5312, 5345,
+    5376, 5409, 5440, 5473, 5504, 5537, 5568, 5601,
+    5632, 5665, 5696, 5729, 5760, 5793, 5824, 5857,
+    5888, 5921, 5952, 5985, 6016, 6049, 6080, 6113,
+    6144, 6177, 6208, 6241, 6272, 6305, 6336, 6369,
+    6400, 6433, 6464, 6497, 6528, 6561, 6592, 6625,
+    6656, 6689, 6720, 6753, 6784, 6817, 6848, 6881,
+    6912, 6945, 6976, 7009, 7040, 7073, 7104, 7137,
+    7168, 7201, 7232, 7265, 7296, 7329, 7360, 7393,
+    7424, 7457, 7488, 7521, 7552, 7585, 7616, 7649,
+    7680, 7713, 7744, 7777, 7808, 7841, 7872, 7905,
+    7936, 7969, 8000, 8033, 8064, 8097, 8128, 8161,
+    8192, 8225, 8256, 8289, 8320, 8353, 8384, 8417,
+    8448, 8481, 8512, 8545, 8576, 8609, 8640, 8673,
+    8704, 8737, 8768, 8801, 8832, 8865, 8896, 8929,
+    8960, 8993, 9024, 9057, 9088, 9121, 9152, 9185,
+    9216, 9249, 9280, 9313, 9344, 9377, 9408, 9441,
+    9472, 9505, 9536, 9569, 9600, 9633, 9664, 9697,
+    9728, 9761, 9792, 9825, 9856, 9889, 9920, 9953,
+    9984, 10017, 10048, 10081, 10112, 10145, 10176, 10209,
+    10240, 10273, 10304, 10337, 10368, 10401, 10432, 10465,
+    10496, 10529, 10560, 10593, 10624, 10657, 10688, 10721,
+    10752, 10785, 10816, 10849, 10880, 10913, 10944, 10977,
+    11008, 11041, 11072, 11105, 11136, 11169, 11200, 11233,
+    11264, 11297, 11328, 11361, 11392, 11425, 11456, 11489,
+    11520, 11553, 11584, 11617, 11648, 11681, 11712, 11745,
+    11776, 11809, 11840, 11873, 11904, 11937, 11968, 12001,
+    12032, 12065, 12096, 12129, 12160, 12193, 12224, 12257,
+    12288, 12321, 12352, 12385, 12416, 12449, 12480, 12513,
+    12544, 12577, 12608, 12641, 12672, 12705, 12736, 12769,
+    12800, 12833, 12864, 12897, 12928, 12961, 12992, 13025,
+    13056, 13089, 13120, 13153, 13184, 13217, 13248, 13281,
+    13312, 13345, 13376, 13409, 13440, 13473, 13504, 13537,
+    13568, 13601, 13632, 13665, 13696, 13729, 13760, 13793,
+    13824, 13857, 13888, 13921, 13952, 13985, 14016, 14049,
+    14080, 14113, 14144, 14177, 14208, 14241, 14272, 14305,
+    14336, 14369, 14400, 14433, 14464, 14497, 14528, 14561,
+    14592, 14625, 14656, 14689, 14720, 14753, 14784, 14817,
+    14848, 14881, 14912, 14945, 14976, 15009, 15040, 15073,
+    15104, 15137, 15168, 15201, 15232, 15265, 15296, 15329,
+    15360, 15393, 15424, 15457, 15488, 15521, 15552, 15585,
+    15616, 15649, 15680, 15713, 15744, 15777, 15808, 15841,
+    15872, 15905, 15936, 15969, 16000, 16033, 16064, 16097,
+    16128, 16161, 16192, 16225, 16256, 16289, 16320, 16353,
+    16384, 16417, 16448, 16481, 16512, 16545, 16576, 16609
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 512;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 14 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 10) { return &node4; }
+    if (k == 12) { return &node5; }
+    if (k == 14) { return &node5; }
+    if (k == 16) { return &node5; }
+    if (k == 18) { return &node5; }
+    if (k == 20) { return &node5; }
+    if (k == 22) { return &node5; }
+    if (k == 24) { return &node5; }
+    if (k == 26) { return &node5; }
+    if (k == 28) { return &node5; }
+    if (k == 30) { return &node5; }
+    if (k == 32) { return &node5; }
+    if (k == 34) { return &node5; }
+    if (k == 36) { return &node5; }
+    if (k == 38) { return &node5; }
+    if (k == 40) { return &node5; }
+    if (k == 42) { return &node5; }
+    if (k == 44) { return &node5; }
+    if (k == 46) { return &node5; }
+    if (k == 48) { return &node5; }
+    if (k == 50) { return &node5; }
+    if (k == 52) { return &node5; }
+    if (k == 54) { return &node5; }
+    if (k == 56) { return &node5; }
+    if (k == 58) { return &node5; }
+    if (k == 60) { return &node5; }
+    if (k == 62) { return &node5; }
+    if (k == 64) { return &node5; }
+    if (k == 66) { return &node5; }
+    if (k == 68) { return &node5; }
+    if (k == 70) { return &node5; }
+    if (k == 72) { return &node5; }
+    if (k == 74) { return &node5; }
+    if (k == 76) { return &node5; }
+    if (k == 78) { return &node5; }
+    if (k == 80) { return &node5; }
+    if (k == 82) { return &node5; }
+    if (k == 84) { return &node5; }
+    if (k == 86) { return &node5; }
+    if (k == 88) { return &node5; }
+    if (k == 90) { return &node5; }
+    if (k == 92) { return &node5; }
+    if (k == 94) { return &node5; }
+    if (k == 96) { return &node5; }
+    if (k == 98) { return &node5; }
+    if (k == 100) { return &node5; }
+    if (k == 102) { return &node5; }
+    if (k == 104) { return &node5; }
+    if (k == 106) { return &node5; }
+    if (k == 108) { return &node5; }
+    if (k == 110) { return &node5; }
+    if (k == 112) { return &node5; }
+    if (k == 114) { return &node5; }
+    if (k == 116) { return &node5; }
+    if (k == 118) { return &node5; }
+    if (k == 120) { return &node5; }
+    if (k == 122) { return &node5; }
+    if (k == 124) { return &node5; }
+    if (k == 126) { return &node5; }
+    if (k == 128) { return &node5; }
+    if (k == 130) { return &node5; }
+    if (k == 132) { return &node5; }
+    if (k == 134) { return &node5; }
+    if (k == 136) { return &node5; }
+    if (k == 138) { return &node5; }
+    if (k == 140) { return &node5; }
+    if (k == 142) { return &node5; }
+    if (k == 144) { return &node5; }
+    if (k == 146) { return &node5; }
+    if (k == 148) { return &node5; }
+    if (k == 150) { return &node5; }
+    if (k == 152) { return &node5; }
+    if (k == 154) { return &node5; }
+    if (k == 156) { return &node5; }
+    if (k == 158) { return &node5; }
+    if (k == 160) { return &node5; }
+    if (k == 162) { return &node5; }
+    if (k == 164) { return &node5; }
+    if (k == 166) { return &node5; }
+    if (k == 168) { return &node5; }
+    if (k == 170) { return &node5; }
+    if (k == 172) { return &node5; }
+    if (k == 174) { return &node5; }
+    if (k == 176) { return &node5; }
+    if (k == 178) { return &node5; }
+    if (k == 180) { return &node5; }
+    if (k == 182) { return &node5; }
+    if (k == 184) { return &node5; }
+    if (k == 186) { return &node5; }
+    if (k == 188) { return &node5; }
+    if (k == 190) { return &node5; }
+    if (k == 192) { return &node5; }
+    if (k == 194) { return &node5; }
+    if (k == 196) { return &node5; }
+    if (k == 198) { return &node5; }
+    if (k == 200) { return &node5; }
+    if (k == 202) { return &node5; }
+    if (k == 204) { return &node5; }
+    if (k == 206) { return &node5; }
+    if (k == 208) { return &node5; }
+    if (k == 210) { return &node5; }
+    if (k == 212) { return &node5; }
+    if (k == 214) { return &node5; }
+    if (k == 216) { return &node5; }
+    if (k == 218) { return &node5; }
+    if (k == 220) { return &node5; }
+    if (k == 222) { return &node5; }
+    if (k == 224) { return &node5; }
+    if (k == 226) { return &node5; }
+    if (k == 228) { return &node5; }
+    if (k == 230) { return &node5; }
+    if (k == 232) { return &node5; }
+    if (k == 234) { return &node5; }
+    if (k == 236) { return &node5; }
+    if (k == 238) { return &node5; }
+    if (k == 240) { return &node5; }
+    if (k == 242) { return &node5; }
+    if (k == 244) { return &node5; }
+    if (k == 246) { return &node5; }
+    if (k == 248) { return &node5; }
+    if (k == 250) { return &node5; }
+    if (k == 252) { return &node5; }
+    if (k == 254) { return &node5; }
+    if (k == 256) { return &node5; }
+    if (k == 258) { return &node5; }
+    if (k == 260) { return &node5; }
+    if (k == 262) { return &node5; }
+    if (k == 264) { return &node5; }
+    if (k == 266) { return &node5; }
+    if (k == 268) { return &node5; }
+    if (k == 270) { return &node5; }
+    if (k == 272) { return &node5; }
+    if (k == 274) { return &node5; }
+    if (k == 276) { return &node5; }
+    if (k == 278) { return &node5; }
+    if (k == 280) { return &node5; }
+    if (k == 282) { return &node5; }
+    if (k == 284) { return &node5; }
+    if (k == 286) { return &node5; }
+    if (k == 288) { return &node5; }
+    if (k == 290) { return &node5; }
+    if (k == 292) { return &node5; }
+    if (k == 294) { return &node5; }
+    if (k == 296) { return &node5; }
+    if (k == 298) { return &node5; }
+    if (k == 300) { return &node5; }
+    if (k == 302) { return &node5; }
+    if (k == 304) { return &node5; }
+    if (k == 306) { return &node5; }
+    if (k == 308) { return &node5; }
+    if (k == 310) { return &node5; }
+    if (k == 312) { return &node5; }
+    if (k == 314) { return &node5; }
+    if (k == 316) { return &node5; }
+    if (k == 318) { return &node5; }
+    if (k == 320) { return &node5; }
+    if (k == 322) { return &node5; }
+    if (k == 324) { return &node5; }
+    if (k == 326) { return &node5; }
+    if (k == 328) { return &node5; }
+    if (k == 330) { return &node5; }
+    if (k == 332) { return &node5; }
+    if (k == 334) { return &node5; }
+    if (k == 336) { return &node5; }
+    if (k == 338) { return &node5; }
+    if (k == 340) { return &node5; }
+    if (k == 342) { return &node5; }
+    if (k == 344) { return &node5; }
+    if (k == 346) { return &node5; }
+    if (k == 348) { return &node5; }
+    if (k == 350) { return &node5; }
+    if (k == 352) { return &node5; }
+    if (k == 354) { return &node5; }
+    if (k == 356) { return &node5; }
+    if (k == 358) { return &node5; }
+    if (k == 360) { return &node5; }
+    if (k == 362) { return &node5; }
+    if (k == 364) { return &node5; }
+    if (k == 366) { return &node5; }
+    if (k == 368) { return &node5; }
+    if (k == 370) { return &node5; }
+    if (k == 372) { return &node5; }
+    if (k == 374) { return &node5; }
+    if (k == 376) { return &node5; }
+    if (k == 378) { return &node5; }
+    if (k == 380) { return &node5; }
+    if (k == 382) { return &node5; }
+    if (k == 384) { return &node5; }
+    if (k == 386) { return &node5; }
+    if (k == 388) { return &node5; }
+    if (k == 390) { return &node5; }
+    if (k == 392) { return &node5; }
+    if (k == 394) { return &node5; }
+    if (k == 396) { return &node5; }
+    if (k == 398) { return &node5; }
+    if (k == 400) { return &node5; }
+    if (k == 402) { return &node5; }
+    if (k == 404) { return &node5; }
+    if (k == 406) { return &node5; }
+    if (k == 408) { return &node5; }
+    if (k == 410) { return &node5; }
+    if (k == 412) { return &node5; }
+    if (k == 414) { return &node5; }
+    if (k == 416) { return &node5; }
+    if (k == 418) { return &node5; }
+    if (k == 420) { return &node5; }
+    if (k == 422) { return &node5; }
+    if (k == 424) { return &node5; }
+    if (k == 426) { return &node5; }
+    if (k == 428) { return &node5; }
+    if (k == 430) { return &node5; }
+    if (k == 432) { return &node5; }
+    if (k == 434) { return &node5; }
+    if (k == 436) { return &node5; }
+    if (k == 438) { return &node5; }
+    if (k == 440) { return &node5; }
+    if (k == 442) { return &node5; }
+    if (k == 444) { return &node5; }
+    if (k == 446) { return &node5; }
+    if (k == 448) { return &node5; }
+    if (k == 450) { return &node5; }
+    if (k == 452) { return &node5; }
+    if (k == 454) { return &node5; }
+    if (k == 456) { return &node5; }
+    if (k == 458) { return &node5; }
+    if (k == 460) { return &node5; }
+    if (k == 462) { return &node5; }
+    if (k == 464) { return &node5; }
+    if (k == 466) { return &node5; }
+    if (k == 468) { return &node5; }
+    if (k == 470) { return &node5; }
+    if (k == 472) { return &node5; }
+    if (k == 474) { return &node5; }
+    if (k == 476) { return &node5; }
+    if (k == 478) { return &node5; }
+    if (k == 480) { return &node5; }
+    if (k == 482) { return &node5; }
+    if (k == 484) { return &node5; }
+    if (k == 486) { return &node5; }
+    if (k == 488) { return &node5; }
+    if (k == 490) { return &node5; }
+    if (k == 492) { return &node5; }
+    if (k == 494) { return &node5; }
+    if (k == 496) { return &node5; }
+    if (k == 498) { return &node5; }
+    if (k == 500) { return &node5; }
+    if (k == 502) { return &node5; }
+    if (k == 504) { return &node5; }
+    if (k == 506) { return &node5; }
+    if (k == 508) { return &node5; }
+    if (k == 510) { return &node5; }
+    if (k == 512) { return &node5; }
+    if (k == 514) { return &node5; }
+    if (k == 516) { return &node5; }
+    if (k == 518) { return &node5; }
+    if (k == 520) { return &node5; }
+    if (k == 522) { return &node5; }
+    if (k == 524) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if (k == 12) { return &node5; }
+    if (k == 14) { return &node5; }
+    if (k == 16) { return &node5; }
+    if (k == 18) { return &node5; }
+    if (k == 20) { return &node5; }
+    if (k == 22) { return &node5; }
+    if (k == 24) { return &node5; }
+    if (k == 26) { return &node5; }
+    if (k == 28) { return &node5; }
+    if (k == 30) { return &node5; }
+    if (k == 32) { return &node5; }
+    if (k == 34) { return &node5; }
+    if (k == 36) { return &node5; }
+    if (k == 38) { return &node5; }
+    if (k == 40) { return &node5; }
+    if (k == 42) { return &node5; }
+    if (k == 44) { return &node5; }
+    if (k == 46) { return &node5; }
+    if (k == 48) { return &node5; }
+    if (k == 50) { return &node5; }
+    if (k == 52) { return &node5; }
+    if (k == 54) { return &node5; }
+    if (k == 56) { return &node5; }
+    if (k == 58) { return &node5; }
+    if (k == 60) { return &node5; }
+    if (k == 62) { return &node5; }
+    if (k == 64) { return &node5; }
+    if (k == 66) { return &node5; }
+    if (k == 68) { return &node5; }
+    if (k == 70) { return &node5; }
+    if (k == 72) { return &node5; }
+    if (k == 74) { return &node5; }
+    if (k == 76) { return &node5; }
+    if (k == 78) { return &node5; }
+    if (k == 80) { return &node5; }
+    if (k == 82) { return &node5; }
+    if (k == 84) { return &node5; }
+    if (k == 86) { return &node5; }
+    if (k == 88) { return &node5; }
+    if (k == 90) { return &node5; }
+    if (k == 92) { return &node5; }
+    if (k == 94) { return &node5; }
+    if (k == 96) { return &node5; }
+    if (k == 98) { return &node5; }
+    if (k == 100) { return &node5; }
+    if (k == 102) { return &node5; }
+    if (k == 104) { return &node5; }
+    if (k == 106) { return &node5; }
+    if (k == 108) { return &node5; }
+    if (k == 110) { return &node5; }
+    if (k == 112) { return &node5; }
+    if (k == 114) { return &node5; }
+    if (k == 116) { return &node5; }
+    if (k == 118) { return &node5; }
+    if (k == 120) { return &node5; }
+    if (k == 122) { return &node5; }
+    if (k == 124) { return &node5; }
+    if (k == 126) { return &node5; }
+    if (k == 128) { return &node5; }
+    if (k == 130) { return &node5; }
+    if (k == 132) { return &node5; }
+    if (k == 134) { return &node5; }
+    if (k == 136) { return &node5; }
+    if (k == 138) { return &node5; }
+    if (k == 140) { return &node5; }
+    if (k == 142) { return &node5; }
+    if (k == 144) { return &node5; }
+    if (k == 146) { return &node5; }
+    if (k == 148) { return &node5; }
+    if (k == 150) { return &node5; }
+    if (k == 152) { return &node5; }
+    if (k == 154) { return &node5; }
+    if (k == 156) { return &node5; }
+    if (k == 158) { return &node5; }
+    if (k == 160) { return &node5; }
+    if (k == 162) { return &node5; }
+    if (k == 164) { return &node5; }
+    if (k == 166) { return &node5; }
+    if (k == 168) { return &node5; }
+    if (k == 170) { return &node5; }
+    if (k == 172) { return &node5; }
+    if (k == 174) { return &node5; }
+    if (k == 176) { return &node5; }
+    if (k == 178) { return &node5; }
+    if (k == 180) { return &node5; }
+    if (k == 182) { return &node5; }
+    if (k == 184) { return &node5; }
+    if (k == 186) { return &node5; }
+    if (k == 188) { return &node5; }
+    if (k == 190) { return &node5; }
+    if (k == 192) { return &node5; }
+    if (k == 194) { return &node5; }
+    if (k == 196) { return &node5; }
+    if (k == 198) { return &node5; }
+    if (k == 200) { return &node5; }
+    if (k == 202) { return &node5; }
+    if (k == 204) { return &node5; }
+    if (k == 206) { return &node5; }
+    if (k == 208) { return &node5; }
+    if (k == 210) { return &node5; }
+    if (k == 212) { return &node5; }
+    if (k == 214) { return &node5; }
+    if (k == 216) { return &node5; }
+    if (k == 218) { return &node5; }
+    if (k == 220) { return &node5; }
+    if (k == 222) { return &node5; }
+    if (k == 224) { return &node5; }
+    if (k == 226) { return &node5; }
+    if (k == 228) { return &node5; }
+    if (k == 230) { return &node5; }
+    if (k == 232) { return &node5; }
+    if (k == 234) { return &node5; }
+    if (k == 236) { return &node5; }
+    if (k == 238) { return &node5; }
+    if (k == 240) { return &node5; }
+    if (k == 242) { return &node5; }
+    if (k == 244) { return &node5; }
+    if (k == 246) { return &node5; }
+    if (k == 248) { return &node5; }
+    if (k == 250) { return &node5; }
+    if (k == 252) { return &node5; }
+    if (k == 254) { return &node5; }
+    if (k == 256) { return &node5; }
+    if (k == 258) { return &node5; }
+    if (k == 260) { return &node5; }
+    if (k == 262) { return &node5; }
+    if (k == 264) { return &node5; }
+    if (k == 266) { return &node5; }
+    if (k == 268) { return &node5; }
+    if (k == 270) { return &node5; }
+    if (k == 272) { return &node5; }
+    if (k == 274) { return &node5; }
+    if (k == 276) { return &node5; }
+    if (k == 278) { return &node5; }
+    if (k == 280) { return &node5; }
+    if (k == 282) { return &node5; }
+    if (k == 284) { return &node5; }
+    if (k == 286) { return &node5; }
+    if (k == 288) { return &node5; }
+    if (k == 290) { return &node5; }
+    if (k == 292) { return &node5; }
+    if (k == 294) { return &node5; }
+    if (k == 296) { return &node5; }
+    if (k == 298) { return &node5; }
+    if (k == 300) { return &node5; }
+    if (k == 302) { return &node5; }
+    if (k == 304) { return &node5; }
+    if (k == 306) { return &node5; }
+    if (k == 308) { return &node5; }
+    if (k == 310) { return &node5; }
+    if (k == 312) { return &node5; }
+    if (k == 314) { return &node5; }
+    if (k == 316) { return &node5; }
+    if (k == 318) { return &node5; }
+    if (k == 320) { return &node5; }
+    if (k == 322) { return &node5; }
+    if (k == 324) { return &node5; }
+    if (k == 326) { return &node5; }
+    if (k == 328) { return &node5; }
+    if (k == 330) { return &node5; }
+    if (k == 332) { return &node5; }
+    if (k == 334) { return &node5; }
+    if (k == 336) { return &node5; }
+    if (k == 338) { return &node5; }
+    if (k == 340) { return &node5; }
+    if (k == 342) { return &node5; }
+    if (k == 344) { return &node5; }
+    if (k == 346) { return &node5; }
+    if (k == 348) { return &node5; }
+    if (k == 350) { return &node5; }
+    if (k == 352) { return &node5; }
+    if (k == 354) { return &node5; }
+    if (k == 356) { return &node5; }
+    if (k == 358) { return &node5; }
+    if (k == 360) { return &node5; }
+    if (k == 362) { return &node5; }
+    if (k == 364) { return &node5; }
+    if (k == 366) { return &node5; }
+    if (k == 368) { return &node5; }
+    if (k == 370) { return &node5; }
+    if (k == 372) { return &node5; }
+    if (k == 374) { return &node5; }
+    if (k == 376) { return &node5; }
+    if (k == 378) { return &node5; }
+    if (k == 380) { return &node5; }
+    if (k == 382) { return &node5; }
+    if (k == 384) { return &node5; }
+    if (k == 386) { return &node5; }
+    if (k == 388) { return &node5; }
+    if (k == 390) { return &node5; }
+    if (k == 392) { return &node5; }
+    if (k == 394) { return &node5; }
+    if (k == 396) { return &node5; }
+    if (k == 398) { return &node5; }
+    if (k == 400) { return &node5; }
+    if (k == 402) { return &node5; }
+    if (k == 404) { return &node5; }
+    if (k == 406) { return &node5; }
+    if (k == 408) { return &node5; }
+    if (k == 410) { return &node5; }
+    if (k == 412) { return &node5; }
+    if (k == 414) { return &node5; }
+    if (k == 416) { return &node5; }
+    if (k == 418) { return &node5; }
+    if (k == 420) { return &node5; }
+    if (k == 422) { return &node5; }
+    if (k == 424) { return &node5; }
+    if (k == 426) { return &node5; }
+    if (k == 428) { return &node5; }
+    if (k == 430) { return &node5; }
+    if (k == 432) { return &node5; }
+    if (k == 434) { return &node5; }
+    if (k == 436) { return &node5; }
+    if (k == 438) { return &node5; }
+    if (k == 440) { return &node5; }
+    if (k == 442) { return &node5; }
+    if (k == 444) { return &node5; }
+    if (k == 446) { return &node5; }
+    if (k == 448) { return &node5; }
+    if (k == 450) { return &node5; }
+    if (k == 452) { return &node5; }
+    if (k == 454) { return &node5; }
+    if (k == 456) { return &node5; }
+    if (k == 458) { return &node5; }
+    if (k == 460) { return &node5; }
+    if (k == 462) { return &node5; }
+    if (k == 464) { return &node5; }
+    if (k == 466) { return &node5; }
+    if (k == 468) { return &node5; }
+    if (k == 470) { return &node5; }
+    if (k == 472) { return &node5; }
+    if (k == 474) { return &node5; }
+    if (k == 476) { return &node5; }
+    if (k == 478) { return &node5; }
+    if (k == 480) { return &node5; }
+    if (k == 482) { return &node5; }
+    if (k == 484) { return &node5; }
+    if (k == 486) { return &node5; }
+    if (k == 488) { return &node5; }
+    if (k == 490) { return &node5; }
+    if (k == 492) { return &node5; }
+    if (k == 494) { return &node5; }
+    if (k == 496) { return &node5; }
+    if (k == 498) { return &node5; }
+    if (k == 500) { return &node5; }
+    if (k == 502) { return &node5; }
+    if (k == 504) { return &node5; }
+    if (k == 506) { return &node5; }
+    if (k == 508) { return &node5; }
+    if (k == 510) { return &node5; }
+    if (k == 512) { return &node5; }
+    if (k == 514) { return &node5; }
+    if (k == 516) { return &node5; }
+    if (k == 518) { return &node5; }
+    if (k == 520) { return &node5; }
+    if (k == 522) { return &node5; }
+    if (k == 524) { return &node5; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, &term0, nullptr};
+Node node3 = {nullptr, &term4, nullptr};
+Node node4 = {nullptr, &term3, nullptr};
+Node node5 = {&next5, &term2, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 5};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"value", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-5]));
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_value_0(Table*);
+
+Value*
+reduce_value_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_value_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_value_1(Table*);
+
+Value*
+reduce_value_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_value_1(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 5, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_value_0, -1};
+Rule rule4 = {&nonterm2, 1, &reduce_value_1, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term2, &state2}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term3, &state3}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term0, &state4}, {&term2, &state5}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {};
+std::vector<Reduce> reduce4 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift5 = {};
+std::vector<Reduce> reduce5 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift6 = {{&term4, &state7}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {};
+std::vector<Reduce> reduce7 = {{nullptr, &rule2, false}};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go3 = {{&nonterm2, &state6}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, nullptr};
+State state2 = {&shift2, &reduce2, nullptr};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
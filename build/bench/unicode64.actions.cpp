@@ -0,0 +1,35 @@
+#include "synth.hpp"
+
+std::unique_ptr<Tree>
+reduce_start_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_value_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_value_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
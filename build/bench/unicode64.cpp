@@ -0,0 +1,654 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"id", false, 2};
+Symbol term3 = {"=", false, 3};
+Symbol term4 = {";", false, 4};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 10, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+
+int lexer_starts[] = {
+    256, 289, 320, 353, 384, 417, 448, 481,
+    512, 545, 576, 609, 640, 673, 704, 737,
+    768, 801, 832, 865, 896, 929, 960, 993,
+    1024, 1057, 1088, 1121, 1152, 1185, 1216, 1249,
+    1280, 1313, 1344, 1377, 1408, 1441, 1472, 1505,
+    1536, 1569, 1600, 1633, 1664, 1697, 1728, 1761,
+    1792, 1825, 1856, 1889, 1920, 1953, 1984, 2017,
+    2048, 2081, 2112, 2145, 2176, 2209, 2240, 2273,
+    2304, 2337, 2368, 2401, 2432, 2465, 2496, 2529,
+    2560, 2593, 2624, 2657, 2688, 2721, 2752, 2785,
+    2816, 2849, 2880, 2913, 2944, 2977, 3008, 3041,
+    3072, 3105, 3136, 3169, 3200, 3233, 3264, 3297,
+    3328, 3361, 3392, 3425, 3456, 3489, 3520, 3553,
+    3584, 3617, 3648, 3681, 3712, 3745, 3776, 3809,
+    3840, 3873, 3904, 3937, 3968, 4001, 4032, 4065,
+    4096, 4129, 4160, 4193, 4224, 4257, 4288, 4321
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 128;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 14 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 10) { return &node4; }
+    if (k == 12) { return &node5; }
+    if (k == 14) { return &node5; }
+    if (k == 16) { return &node5; }
+    if (k == 18) { return &node5; }
+    if (k == 20) { return &node5; }
+    if (k == 22) { return &node5; }
+    if (k == 24) { return &node5; }
+    if (k == 26) { return &node5; }
+    if (k == 28) { return &node5; }
+    if (k == 30) { return &node5; }
+    if (k == 32) { return &node5; }
+    if (k == 34) { return &node5; }
+    if (k == 36) { return &node5; }
+    if (k == 38) { return &node5; }
+    if (k == 40) { return &node5; }
+    if (k == 42) { return &node5; }
+    if (k == 44) { return &node5; }
+    if (k == 46) { return &node5; }
+    if (k == 48) { return &node5; }
+    if (k == 50) { return &node5; }
+    if (k == 52) { return &node5; }
+    if (k == 54) { return &node5; }
+    if (k == 56) { return &node5; }
+    if (k == 58) { return &node5; }
+    if (k == 60) { return &node5; }
+    if (k == 62) { return &node5; }
+    if (k == 64) { return &node5; }
+    if (k == 66) { return &node5; }
+    if (k == 68) { return &node5; }
+    if (k == 70) { return &node5; }
+    if (k == 72) { return &node5; }
+    if (k == 74) { return &node5; }
+    if (k == 76) { return &node5; }
+    if (k == 78) { return &node5; }
+    if (k == 80) { return &node5; }
+    if (k == 82) { return &node5; }
+    if (k == 84) { return &node5; }
+    if (k == 86) { return &node5; }
+    if (k == 88) { return &node5; }
+    if (k == 90) { return &node5; }
+    if (k == 92) { return &node5; }
+    if (k == 94) { return &node5; }
+    if (k == 96) { return &node5; }
+    if (k == 98) { return &node5; }
+    if (k == 100) { return &node5; }
+    if (k == 102) { return &node5; }
+    if (k == 104) { return &node5; }
+    if (k == 106) { return &node5; }
+    if (k == 108) { return &node5; }
+    if (k == 110) { return &node5; }
+    if (k == 112) { return &node5; }
+    if (k == 114) { return &node5; }
+    if (k == 116) { return &node5; }
+    if (k == 118) { return &node5; }
+    if (k == 120) { return &node5; }
+    if (k == 122) { return &node5; }
+    if (k == 124) { return &node5; }
+    if (k == 126) { return &node5; }
+    if (k == 128) { return &node5; }
+    if (k == 130) { return &node5; }
+    if (k == 132) { return &node5; }
+    if (k == 134) { return &node5; }
+    if (k == 136) { return &node5; }
+    if (k == 138) { return &node5; }
+    if (k == 140) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if (k == 12) { return &node5; }
+    if (k == 14) { return &node5; }
+    if (k == 16) { return &node5; }
+    if (k == 18) { return &node5; }
+    if (k == 20) { return &node5; }
+    if (k == 22) { return &node5; }
+    if (k == 24) { return &node5; }
+    if (k == 26) { return &node5; }
+    if (k == 28) { return &node5; }
+    if (k == 30) { return &node5; }
+    if (k == 32) { return &node5; }
+    if (k == 34) { return &node5; }
+    if (k == 36) { return &node5; }
+    if (k == 38) { return &node5; }
+    if (k == 40) { return &node5; }
+    if (k == 42) { return &node5; }
+    if (k == 44) { return &node5; }
+    if (k == 46) { return &node5; }
+    if (k == 48) { return &node5; }
+    if (k == 50) { return &node5; }
+    if (k == 52) { return &node5; }
+    if (k == 54) { return &node5; }
+    if (k == 56) { return &node5; }
+    if (k == 58) { return &node5; }
+    if (k == 60) { return &node5; }
+    if (k == 62) { return &node5; }
+    if (k == 64) { return &node5; }
+    if (k == 66) { return &node5; }
+    if (k == 68) { return &node5; }
+    if (k == 70) { return &node5; }
+    if (k == 72) { return &node5; }
+    if (k == 74) { return &node5; }
+    if (k == 76) { return &node5; }
+    if (k == 78) { return &node5; }
+    if (k == 80) { return &node5; }
+    if (k == 82) { return &node5; }
+    if (k == 84) { return &node5; }
+    if (k == 86) { return &node5; }
+    if (k == 88) { return &node5; }
+    if (k == 90) { return &node5; }
+    if (k == 92) { return &node5; }
+    if (k == 94) { return &node5; }
+    if (k == 96) { return &node5; }
+    if (k == 98) { return &node5; }
+    if (k == 100) { return &node5; }
+    if (k == 102) { return &node5; }
+    if (k == 104) { return &node5; }
+    if (k == 106) { return &node5; }
+    if (k == 108) { return &node5; }
+    if (k == 110) { return &node5; }
+    if (k == 112) { return &node5; }
+    if (k == 114) { return &node5; }
+    if (k == 116) { return &node5; }
+    if (k == 118) { return &node5; }
+    if (k == 120) { return &node5; }
+    if (k == 122) { return &node5; }
+    if (k == 124) { return &node5; }
+    if (k == 126) { return &node5; }
+    if (k == 128) { return &node5; }
+    if (k == 130) { return &node5; }
+    if (k == 132) { return &node5; }
+    if (k == 134) { return &node5; }
+    if (k == 136) { return &node5; }
+    if (k == 138) { return &node5; }
+    if (k == 140) { return &node5; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {&next2, &term0, nullptr};
+Node node3 = {nullptr, &term4, nullptr};
+Node node4 = {nullptr, &term3, nullptr};
+Node node5 = {&next5, &term2, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 5};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"value", false, 2};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-5]));
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_value_0(Table*);
+
+Value*
+reduce_value_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_value_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_value_1(Table*);
+
+Value*
+reduce_value_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_value_1(table);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 5, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_value_0, -1};
+Rule rule4 = {&nonterm2, 1, &reduce_value_1, -1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4
+};
+
+State parse_states[8] = {
+    {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7}
+};
+
+unsigned char action_base[] = {
+    0, 0, 1, 1, 0, 0, 2, 0
+};
+
+unsigned char action_default[] = {
+    6, 0, 0, 0, 14, 18, 0, 10
+};
+
+unsigned char action_check[] = {
+    8, 3, 1, 3, 2, 1, 6, 8
+};
+
+unsigned char action_next[] = {
+    0, 17, 9, 21, 13, 3, 29, 0
+};
+
+unsigned char goto_base[] = {
+    0, 0, 0
+};
+
+unsigned char goto_default[] = {
+    0, 1, 6
+};
+
+unsigned char goto_check[] = {
+    3, 3, 3, 3, 3, 3, 3, 3
+};
+
+unsigned char goto_next[] = {
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/* Comb tables of 118 bytes, 113.462% of the 104 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,757 @@
+#include "synth.hpp"
+
+std::unique_ptr<Tree>
+reduce_start_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_program_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_3(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_4(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_5(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_6(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_7(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_8(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_9(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_10(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_11(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_12(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_13(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_14(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_15(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_16(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_17(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_18(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_19(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_20(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_21(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_22(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_23(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_stmt_24(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s0_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s0_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s0_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s1_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s1_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s1_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s2_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s2_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s2_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s3_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s3_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s3_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s4_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s4_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s4_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s5_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s5_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s5_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s6_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s6_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s6_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s7_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s7_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s7_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s8_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s8_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s8_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s9_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s9_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s9_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s10_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s10_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s10_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s11_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s11_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s11_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s12_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s12_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s12_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s13_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s13_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s13_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s14_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s14_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s14_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s15_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s15_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s15_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s16_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s16_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s16_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s17_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s17_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s17_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s18_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s18_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s18_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s19_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s19_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s19_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s20_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s20_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s20_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s21_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s21_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s21_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s22_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s22_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s22_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s23_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s23_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s23_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s24_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s24_1(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_s24_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_expr_0(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_expr_1(Table*, std::unique_ptr<Tree>& a0, std::unique_ptr<Tree>& a1) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    tree->size += a1->size;
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_term_0(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_term_1(Table*) {
+    std::unique_ptr<Tree> tree(new Tree());
+    return tree;
+}
+
+std::unique_ptr<Tree>
+reduce_term_2(Table*, std::unique_ptr<Tree>& a0) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->size += a0->size;
+    return tree;
+}
+
@@ -0,0 +1,2421 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"sa", false, 0};
+Symbol term1 = {"sb", false, 1};
+Symbol term2 = {"sc", false, 2};
+Symbol term3 = {"sd", false, 3};
+Symbol term4 = {"se", false, 4};
+Symbol term5 = {"sf", false, 5};
+Symbol term6 = {"sg", false, 6};
+Symbol term7 = {"sh", false, 7};
+Symbol term8 = {"si", false, 8};
+Symbol term9 = {"sj", false, 9};
+Symbol term10 = {"sk", false, 10};
+Symbol term11 = {"sl", false, 11};
+Symbol term12 = {"sm", false, 12};
+Symbol term13 = {"sn", false, 13};
+Symbol term14 = {"so", false, 14};
+Symbol term15 = {"sp", false, 15};
+Symbol term16 = {"sq", false, 16};
+Symbol term17 = {"sr", false, 17};
+Symbol term18 = {"ss", false, 18};
+Symbol term19 = {"st", false, 19};
+Symbol term20 = {"su", false, 20};
+Symbol term21 = {"sv", false, 21};
+Symbol term22 = {"sw", false, 22};
+Symbol term23 = {"sx", false, 23};
+Symbol term24 = {"sy", false, 24};
+Symbol term25 = {"num", false, 25};
+Symbol term26 = {"ws", true, 26};
+Symbol term27 = {"id", false, 27};
+Symbol term28 = {";", false, 28};
+Symbol term29 = {"=", false, 29};
+Symbol term30 = {"{", false, 30};
+Symbol term31 = {"}", false, 31};
+Symbol term32 = {"+", false, 32};
+Symbol term33 = {"(", false, 33};
+Symbol term34 = {")", false, 34};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 9, 10, 10, 10, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 13, 14, 15, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 47 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if ((k >= 17) && (k <= 34)) { return &node8; }
+    if (k == 35) { return &node9; }
+    if ((k >= 36) && (k <= 42)) { return &node8; }
+    if (k == 43) { return &node10; }
+    if (k == 45) { return &node11; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 11) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    if (k == 23) { return &node18; }
+    if (k == 24) { return &node19; }
+    if (k == 25) { return &node20; }
+    if (k == 26) { return &node21; }
+    if (k == 27) { return &node22; }
+    if (k == 28) { return &node23; }
+    if (k == 29) { return &node24; }
+    if (k == 30) { return &node25; }
+    if (k == 31) { return &node26; }
+    if (k == 32) { return &node27; }
+    if (k == 33) { return &node28; }
+    if (k == 34) { return &node29; }
+    if (k == 35) { return &node30; }
+    if (k == 36) { return &node31; }
+    if (k == 37) { return &node32; }
+    if (k == 38) { return &node33; }
+    if (k == 39) { return &node34; }
+    if (k == 40) { return &node35; }
+    if (k == 41) { return &node36; }
+    if (k == 42) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term26, nullptr};
+Node node2 = {nullptr, &term33, nullptr};
+Node node3 = {nullptr, &term34, nullptr};
+Node node4 = {nullptr, &term32, nullptr};
+Node node5 = {&next5, &term25, nullptr};
+Node node6 = {nullptr, &term28, nullptr};
+Node node7 = {nullptr, &term29, nullptr};
+Node node8 = {&next8, &term27, nullptr};
+Node node9 = {&next9, &term27, nullptr};
+Node node10 = {nullptr, &term30, nullptr};
+Node node11 = {nullptr, &term31, nullptr};
+Node node12 = {&next12, &term0, nullptr};
+Node node13 = {&next13, &term1, nullptr};
+Node node14 = {&next14, &term2, nullptr};
+Node node15 = {&next15, &term3, nullptr};
+Node node16 = {&next16, &term4, nullptr};
+Node node17 = {&next17, &term5, nullptr};
+Node node18 = {&next18, &term6, nullptr};
+Node node19 = {&next19, &term7, nullptr};
+Node node20 = {&next20, &term8, nullptr};
+Node node21 = {&next21, &term9, nullptr};
+Node node22 = {&next22, &term10, nullptr};
+Node node23 = {&next23, &term11, nullptr};
+Node node24 = {&next24, &term12, nullptr};
+Node node25 = {&next25, &term13, nullptr};
+Node node26 = {&next26, &term14, nullptr};
+Node node27 = {&next27, &term15, nullptr};
+Node node28 = {&next28, &term16, nullptr};
+Node node29 = {&next29, &term17, nullptr};
+Node node30 = {&next30, &term18, nullptr};
+Node node31 = {&next31, &term19, nullptr};
+Node node32 = {&next32, &term20, nullptr};
+Node node33 = {&next33, &term21, nullptr};
+Node node34 = {&next34, &term22, nullptr};
+Node node35 = {&next35, &term23, nullptr};
+Node node36 = {&next36, &term24, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 35};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+Symbol nonterm3 = {"s0", false, 3};
+Symbol nonterm4 = {"s1", false, 4};
+Symbol nonterm5 = {"s2", false, 5};
+Symbol nonterm6 = {"s3", false, 6};
+Symbol nonterm7 = {"s4", false, 7};
+Symbol nonterm8 = {"s5", false, 8};
+Symbol nonterm9 = {"s6", false, 9};
+Symbol nonterm10 = {"s7", false, 10};
+Symbol nonterm11 = {"s8", false, 11};
+Symbol nonterm12 = {"s9", false, 12};
+Symbol nonterm13 = {"s10", false, 13};
+Symbol nonterm14 = {"s11", false, 14};
+Symbol nonterm15 = {"s12", false, 15};
+Symbol nonterm16 = {"s13", false, 16};
+Symbol nonterm17 = {"s14", false, 17};
+Symbol nonterm18 = {"s15", false, 18};
+Symbol nonterm19 = {"s16", false, 19};
+Symbol nonterm20 = {"s17", false, 20};
+Symbol nonterm21 = {"s18", false, 21};
+Symbol nonterm22 = {"s19", false, 22};
+Symbol nonterm23 = {"s20", false, 23};
+Symbol nonterm24 = {"s21", false, 24};
+Symbol nonterm25 = {"s22", false, 25};
+Symbol nonterm26 = {"s23", false, 26};
+Symbol nonterm27 = {"s24", false, 27};
+Symbol nonterm28 = {"expr", false, 28};
+Symbol nonterm29 = {"term", false, 29};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_1(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_2(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_3(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_4(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_5(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_6(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_7(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_8(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_9(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_10(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_11(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_12(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_13(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_14(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_15(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_16(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_17(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_18(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_19(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_20(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_21(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_22(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_23(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_24(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_expr_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_0(Table*);
+
+Value*
+reduce_term_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_term_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_1(Table*);
+
+Value*
+reduce_term_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_term_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_term_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_term_2(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 1, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 1, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 1, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 1, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 1, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 1, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 1, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 1, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 1, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 1, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 1, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 1, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 1, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 1, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 1, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 1, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 1, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 1, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 1, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 1, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 1, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 1, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 1, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 1, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm3, 3, &reduce_s0_0, -1};
+Rule rule29 = {&nonterm3, 5, &reduce_s0_1, -1};
+Rule rule30 = {&nonterm3, 4, &reduce_s0_2, -1};
+Rule rule31 = {&nonterm4, 3, &reduce_s1_0, -1};
+Rule rule32 = {&nonterm4, 5, &reduce_s1_1, -1};
+Rule rule33 = {&nonterm4, 4, &reduce_s1_2, -1};
+Rule rule34 = {&nonterm5, 3, &reduce_s2_0, -1};
+Rule rule35 = {&nonterm5, 5, &reduce_s2_1, -1};
+Rule rule36 = {&nonterm5, 4, &reduce_s2_2, -1};
+Rule rule37 = {&nonterm6, 3, &reduce_s3_0, -1};
+Rule rule38 = {&nonterm6, 5, &reduce_s3_1, -1};
+Rule rule39 = {&nonterm6, 4, &reduce_s3_2, -1};
+Rule rule40 = {&nonterm7, 3, &reduce_s4_0, -1};
+Rule rule41 = {&nonterm7, 5, &reduce_s4_1, -1};
+Rule rule42 = {&nonterm7, 4, &reduce_s4_2, -1};
+Rule rule43 = {&nonterm8, 3, &reduce_s5_0, -1};
+Rule rule44 = {&nonterm8, 5, &reduce_s5_1, -1};
+Rule rule45 = {&nonterm8, 4, &reduce_s5_2, -1};
+Rule rule46 = {&nonterm9, 3, &reduce_s6_0, -1};
+Rule rule47 = {&nonterm9, 5, &reduce_s6_1, -1};
+Rule rule48 = {&nonterm9, 4, &reduce_s6_2, -1};
+Rule rule49 = {&nonterm10, 3, &reduce_s7_0, -1};
+Rule rule50 = {&nonterm10, 5, &reduce_s7_1, -1};
+Rule rule51 = {&nonterm10, 4, &reduce_s7_2, -1};
+Rule rule52 = {&nonterm11, 3, &reduce_s8_0, -1};
+Rule rule53 = {&nonterm11, 5, &reduce_s8_1, -1};
+Rule rule54 = {&nonterm11, 4, &reduce_s8_2, -1};
+Rule rule55 = {&nonterm12, 3, &reduce_s9_0, -1};
+Rule rule56 = {&nonterm12, 5, &reduce_s9_1, -1};
+Rule rule57 = {&nonterm12, 4, &reduce_s9_2, -1};
+Rule rule58 = {&nonterm13, 3, &reduce_s10_0, -1};
+Rule rule59 = {&nonterm13, 5, &reduce_s10_1, -1};
+Rule rule60 = {&nonterm13, 4, &reduce_s10_2, -1};
+Rule rule61 = {&nonterm14, 3, &reduce_s11_0, -1};
+Rule rule62 = {&nonterm14, 5, &reduce_s11_1, -1};
+Rule rule63 = {&nonterm14, 4, &reduce_s11_2, -1};
+Rule rule64 = {&nonterm15, 3, &reduce_s12_0, -1};
+Rule rule65 = {&nonterm15, 5, &reduce_s12_1, -1};
+Rule rule66 = {&nonterm15, 4, &reduce_s12_2, -1};
+Rule rule67 = {&nonterm16, 3, &reduce_s13_0, -1};
+Rule rule68 = {&nonterm16, 5, &reduce_s13_1, -1};
+Rule rule69 = {&nonterm16, 4, &reduce_s13_2, -1};
+Rule rule70 = {&nonterm17, 3, &reduce_s14_0, -1};
+Rule rule71 = {&nonterm17, 5, &reduce_s14_1, -1};
+Rule rule72 = {&nonterm17, 4, &reduce_s14_2, -1};
+Rule rule73 = {&nonterm18, 3, &reduce_s15_0, -1};
+Rule rule74 = {&nonterm18, 5, &reduce_s15_1, -1};
+Rule rule75 = {&nonterm18, 4, &reduce_s15_2, -1};
+Rule rule76 = {&nonterm19, 3, &reduce_s16_0, -1};
+Rule rule77 = {&nonterm19, 5, &reduce_s16_1, -1};
+Rule rule78 = {&nonterm19, 4, &reduce_s16_2, -1};
+Rule rule79 = {&nonterm20, 3, &reduce_s17_0, -1};
+Rule rule80 = {&nonterm20, 5, &reduce_s17_1, -1};
+Rule rule81 = {&nonterm20, 4, &reduce_s17_2, -1};
+Rule rule82 = {&nonterm21, 3, &reduce_s18_0, -1};
+Rule rule83 = {&nonterm21, 5, &reduce_s18_1, -1};
+Rule rule84 = {&nonterm21, 4, &reduce_s18_2, -1};
+Rule rule85 = {&nonterm22, 3, &reduce_s19_0, -1};
+Rule rule86 = {&nonterm22, 5, &reduce_s19_1, -1};
+Rule rule87 = {&nonterm22, 4, &reduce_s19_2, -1};
+Rule rule88 = {&nonterm23, 3, &reduce_s20_0, -1};
+Rule rule89 = {&nonterm23, 5, &reduce_s20_1, -1};
+Rule rule90 = {&nonterm23, 4, &reduce_s20_2, -1};
+Rule rule91 = {&nonterm24, 3, &reduce_s21_0, -1};
+Rule rule92 = {&nonterm24, 5, &reduce_s21_1, -1};
+Rule rule93 = {&nonterm24, 4, &reduce_s21_2, -1};
+Rule rule94 = {&nonterm25, 3, &reduce_s22_0, -1};
+Rule rule95 = {&nonterm25, 5, &reduce_s22_1, -1};
+Rule rule96 = {&nonterm25, 4, &reduce_s22_2, -1};
+Rule rule97 = {&nonterm26, 3, &reduce_s23_0, -1};
+Rule rule98 = {&nonterm26, 5, &reduce_s23_1, -1};
+Rule rule99 = {&nonterm26, 4, &reduce_s23_2, -1};
+Rule rule100 = {&nonterm27, 3, &reduce_s24_0, -1};
+Rule rule101 = {&nonterm27, 5, &reduce_s24_1, -1};
+Rule rule102 = {&nonterm27, 4, &reduce_s24_2, -1};
+Rule rule103 = {&nonterm28, 1, &reduce_expr_0, -1};
+Rule rule104 = {&nonterm28, 3, &reduce_expr_1, -1};
+Rule rule105 = {&nonterm29, 1, &reduce_term_0, -1};
+Rule rule106 = {&nonterm29, 1, &reduce_term_1, -1};
+Rule rule107 = {&nonterm29, 3, &reduce_term_2, -1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6, &rule7,
+    &rule8, &rule9, &rule10, &rule11, &rule12, &rule13, &rule14, &rule15,
+    &rule16, &rule17, &rule18, &rule19, &rule20, &rule21, &rule22, &rule23,
+    &rule24, &rule25, &rule26, &rule27, &rule28, &rule29, &rule30, &rule31,
+    &rule32, &rule33, &rule34, &rule35, &rule36, &rule37, &rule38, &rule39,
+    &rule40, &rule41, &rule42, &rule43, &rule44, &rule45, &rule46, &rule47,
+    &rule48, &rule49, &rule50, &rule51, &rule52, &rule53, &rule54, &rule55,
+    &rule56, &rule57, &rule58, &rule59, &rule60, &rule61, &rule62, &rule63,
+    &rule64, &rule65, &rule66, &rule67, &rule68, &rule69, &rule70, &rule71,
+    &rule72, &rule73, &rule74, &rule75, &rule76, &rule77, &rule78, &rule79,
+    &rule80, &rule81, &rule82, &rule83, &rule84, &rule85, &rule86, &rule87,
+    &rule88, &rule89, &rule90, &rule91, &rule92, &rule93, &rule94, &rule95,
+    &rule96, &rule97, &rule98, &rule99, &rule100, &rule101, &rule102, &rule103,
+    &rule104, &rule105, &rule106, &rule107
+};
+
+State parse_states[570] = {
+    {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7},
+    {8, 8}, {9, 9}, {10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}, {15, 15},
+    {16, 16}, {17, 17}, {18, 18}, {19, 19}, {20, 20}, {21, 21}, {22, 22}, {23, 23},
+    {24, 24}, {25, 25}, {26, 26}, {27, 27}, {28, 28}, {29, 29}, {30, 30}, {31, 31},
+    {32, 32}, {33, 33}, {34, 34}, {35, 35}, {36, 36}, {37, 37}, {38, 38}, {39, 39},
+    {40, 40}, {41, 41}, {42, 42}, {43, 43}, {44, 44}, {45, 45}, {46, 46}, {47, 47},
+    {48, 48}, {49, 49}, {50, 50}, {51, 51}, {52, 52}, {53, 53}, {54, 54}, {55, 0},
+    {56, 55}, {57, 56}, {58, 57}, {59, 58}, {60, 59}, {61, 60}, {62, 61}, {63, 53},
+    {64, 60}, {65, 55}, {66, 62}, {67, 57}, {68, 55}, {69, 63}, {70, 61}, {71, 64},
+    {72, 63}, {73, 65}, {74, 66}, {75, 67}, {76, 68}, {77, 69}, {78, 70}, {79, 71},
+    {80, 72}, {81, 73}, {82, 74}, {83, 75}, {84, 76}, {85, 77}, {86, 78}, {87, 79},
+    {88, 80}, {89, 81}, {90, 82}, {91, 83}, {92, 84}, {93, 85}, {94, 86}, {95, 87},
+    {96, 88}, {97, 89}, {98, 90}, {99, 91}, {100, 27}, {101, 28}, {102, 29}, {103, 30},
+    {104, 31}, {105, 32}, {106, 33}, {107, 34}, {108, 35}, {109, 36}, {110, 37}, {111, 38},
+    {112, 39}, {113, 40}, {114, 41}, {115, 42}, {116, 43}, {117, 44}, {118, 45}, {119, 46},
+    {120, 47}, {121, 48}, {122, 49}, {123, 50}, {124, 51}, {125, 52}, {126, 92}, {127, 0},
+    {128, 93}, {129, 58}, {130, 94}, {131, 91}, {132, 59}, {133, 95}, {134, 96}, {135, 97},
+    {136, 0}, {137, 98}, {138, 99}, {139, 100}, {140, 101}, {141, 59}, {142, 102}, {143, 103},
+    {144, 104}, {145, 0}, {146, 105}, {147, 106}, {148, 107}, {149, 108}, {150, 59}, {151, 109},
+    {152, 110}, {153, 111}, {154, 0}, {155, 112}, {156, 113}, {157, 114}, {158, 115}, {159, 59},
+    {160, 116}, {161, 117}, {162, 118}, {163, 0}, {164, 119}, {165, 120}, {166, 121}, {167, 122},
+    {168, 59}, {169, 123}, {170, 124}, {171, 125}, {172, 0}, {173, 126}, {174, 127}, {175, 128},
+    {176, 129}, {177, 59}, {178, 130}, {179, 131}, {180, 132}, {181, 0}, {182, 133}, {183, 134},
+    {184, 135}, {185, 136}, {186, 59}, {187, 137}, {188, 138}, {189, 139}, {190, 0}, {191, 140},
+    {192, 141}, {193, 142}, {194, 143}, {195, 59}, {196, 144}, {197, 145}, {198, 146}, {199, 0},
+    {200, 147}, {201, 148}, {202, 149}, {203, 150}, {204, 59}, {205, 151}, {206, 152}, {207, 153},
+    {208, 0}, {209, 154}, {210, 155}, {211, 156}, {212, 157}, {213, 59}, {214, 158}, {215, 159},
+    {216, 160}, {217, 0}, {218, 161}, {219, 162}, {220, 163}, {221, 164}, {222, 59}, {223, 165},
+    {224, 166}, {225, 167}, {226, 0}, {227, 168}, {228, 169}, {229, 170}, {230, 171}, {231, 59},
+    {232, 172}, {233, 173}, {234, 174}, {235, 0}, {236, 175}, {237, 176}, {238, 177}, {239, 178},
+    {240, 59}, {241, 179}, {242, 180}, {243, 181}, {244, 0}, {245, 182}, {246, 183}, {247, 184},
+    {248, 185}, {249, 59}, {250, 186}, {251, 187}, {252, 188}, {253, 0}, {254, 189}, {255, 190},
+    {256, 191}, {257, 192}, {258, 59}, {259, 193}, {260, 194}, {261, 195}, {262, 0}, {263, 196},
+    {264, 197}, {265, 198}, {266, 199}, {267, 59}, {268, 200}, {269, 201}, {270, 202}, {271, 0},
+    {272, 203}, {273, 204}, {274, 205}, {275, 206}, {276, 59}, {277, 207}, {278, 208}, {279, 209},
+    {280, 0}, {281, 210}, {282, 211}, {283, 212}, {284, 213}, {285, 59}, {286, 214}, {287, 215},
+    {288, 216}, {289, 0}, {290, 217}, {291, 218}, {292, 219}, {293, 220}, {294, 59}, {295, 221},
+    {296, 222}, {297, 223}, {298, 0}, {299, 224}, {300, 225}, {301, 226}, {302, 227}, {303, 59},
+    {304, 228}, {305, 229}, {306, 230}, {307, 0}, {308, 231}, {309, 232}, {310, 233}, {311, 234},
+    {312, 59}, {313, 235}, {314, 236}, {315, 237}, {316, 0}, {317, 238}, {318, 239}, {319, 240},
+    {320, 241}, {321, 59}, {322, 242}, {323, 243}, {324, 244}, {325, 0}, {326, 245}, {327, 246},
+    {328, 247}, {329, 248}, {330, 59}, {331, 249}, {332, 250}, {333, 251}, {334, 0}, {335, 252},
+    {336, 253}, {337, 254}, {338, 255}, {339, 59}, {340, 256}, {341, 257}, {342, 258}, {343, 0},
+    {344, 259}, {345, 260}, {346, 261}, {347, 262}, {348, 59}, {349, 263}, {350, 264}, {351, 59},
+    {352, 265}, {353, 96}, {354, 266}, {355, 0}, {356, 267}, {357, 99}, {358, 268}, {359, 101},
+    {360, 59}, {361, 269}, {362, 103}, {363, 270}, {364, 0}, {365, 271}, {366, 106}, {367, 272},
+    {368, 108}, {369, 59}, {370, 273}, {371, 110}, {372, 274}, {373, 0}, {374, 275}, {375, 113},
+    {376, 276}, {377, 115}, {378, 59}, {379, 277}, {380, 117}, {381, 278}, {382, 0}, {383, 279},
+    {384, 120}, {385, 280}, {386, 122}, {387, 59}, {388, 281}, {389, 124}, {390, 282}, {391, 0},
+    {392, 283}, {393, 127}, {394, 284}, {395, 129}, {396, 59}, {397, 285}, {398, 131}, {399, 286},
+    {400, 0}, {401, 287}, {402, 134}, {403, 288}, {404, 136}, {405, 59}, {406, 289}, {407, 138},
+    {408, 290}, {409, 0}, {410, 291}, {411, 141}, {412, 292}, {413, 143}, {414, 59}, {415, 293},
+    {416, 145}, {417, 294}, {418, 0}, {419, 295}, {420, 148}, {421, 296}, {422, 150}, {423, 59},
+    {424, 297}, {425, 152}, {426, 298}, {427, 0}, {428, 299}, {429, 155}, {430, 300}, {431, 157},
+    {432, 59}, {433, 301}, {434, 159}, {435, 302}, {436, 0}, {437, 303}, {438, 162}, {439, 304},
+    {440, 164}, {441, 59}, {442, 305}, {443, 166}, {444, 306}, {445, 0}, {446, 307}, {447, 169},
+    {448, 308}, {449, 171}, {450, 59}, {451, 309}, {452, 173}, {453, 310}, {454, 0}, {455, 311},
+    {456, 176}, {457, 312}, {458, 178}, {459, 59}, {460, 313}, {461, 180}, {462, 314}, {463, 0},
+    {464, 315}, {465, 183}, {466, 316}, {467, 185}, {468, 59}, {469, 317}, {470, 187}, {471, 318},
+    {472, 0}, {473, 319}, {474, 190}, {475, 320}, {476, 192}, {477, 59}, {478, 321}, {479, 194},
+    {480, 322}, {481, 0}, {482, 323}, {483, 197}, {484, 324}, {485, 199}, {486, 59}, {487, 325},
+    {488, 201}, {489, 326}, {490, 0}, {491, 327}, {492, 204}, {493, 328}, {494, 206}, {495, 59},
+    {496, 329}, {497, 208}, {498, 330}, {499, 0}, {500, 331}, {501, 211}, {502, 332}, {503, 213},
+    {504, 59}, {505, 333}, {506, 215}, {507, 334}, {508, 0}, {509, 335}, {510, 218}, {511, 336},
+    {512, 220}, {513, 59}, {514, 337}, {515, 222}, {516, 338}, {517, 0}, {518, 339}, {519, 225},
+    {520, 340}, {521, 227}, {522, 59}, {523, 341}, {524, 229}, {525, 342}, {526, 0}, {527, 343},
+    {528, 232}, {529, 344}, {530, 234}, {531, 59}, {532, 345}, {533, 236}, {534, 346}, {535, 0},
+    {536, 347}, {537, 239}, {538, 348}, {539, 241}, {540, 59}, {541, 349}, {542, 243}, {543, 350},
+    {544, 0}, {545, 351}, {546, 246}, {547, 352}, {548, 248}, {549, 59}, {550, 353}, {551, 250},
+    {552, 354}, {553, 0}, {554, 355}, {555, 253}, {556, 356}, {557, 255}, {558, 59}, {559, 357},
+    {560, 257}, {561, 358}, {562, 0}, {563, 359}, {564, 260}, {565, 360}, {566, 262}, {567, 59},
+    {568, 361}, {569, 264}
+};
+
+unsigned short action_base[] = {
+    0, 0, 0, 1, 1604, 1611, 1615, 1622, 1626, 1633, 1637, 1644, 1648, 1655, 1659, 1666,
+    1670, 1677, 1681, 1688, 1692, 1699, 1703, 1710, 1714, 1721, 1725, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1868, 33, 0, 0, 1871, 0, 0, 30, 0,
+    61, 36, 1732, 1736, 1743, 1747, 1754, 1758, 1765, 1769, 1776, 1780, 1787, 1791, 1798, 1802,
+    1809, 1813, 1820, 1824, 1831, 1835, 1842, 1846, 1853, 1857, 1864, 0, 3, 66, 68, 97,
+    0, 34, 98, 0, 100, 0, 129, 0, 37, 130, 0, 132, 0, 161, 0, 67,
+    162, 0, 164, 0, 193, 0, 68, 194, 0, 196, 0, 225, 0, 98, 226, 0,
+    228, 0, 257, 0, 99, 258, 0, 260, 0, 289, 0, 130, 290, 0, 292, 0,
+    321, 0, 131, 322, 0, 324, 0, 353, 0, 162, 354, 0, 356, 0, 385, 0,
+    163, 386, 0, 388, 0, 417, 0, 194, 418, 0, 420, 0, 449, 0, 195, 450,
+    0, 452, 0, 481, 0, 226, 482, 0, 484, 0, 513, 0, 227, 514, 0, 516,
+    0, 545, 0, 258, 546, 0, 548, 0, 577, 0, 259, 578, 0, 580, 0, 609,
+    0, 290, 610, 0, 612, 0, 641, 0, 291, 642, 0, 644, 0, 673, 0, 322,
+    674, 0, 676, 0, 705, 0, 323, 706, 0, 708, 0, 737, 0, 354, 738, 0,
+    740, 0, 769, 0, 355, 770, 0, 772, 0, 801, 0, 386, 802, 0, 804, 0,
+    833, 0, 387, 834, 0, 836, 0, 865, 0, 866, 418, 897, 868, 898, 419, 929,
+    900, 930, 450, 961, 932, 962, 451, 993, 964, 994, 482, 1025, 996, 1026, 483, 1057,
+    1028, 1058, 514, 1089, 1060, 1090, 515, 1121, 1092, 1122, 546, 1153, 1124, 1154, 547, 1185,
+    1156, 1186, 578, 1217, 1188, 1218, 579, 1249, 1220, 1250, 610, 1281, 1252, 1282, 611, 1313,
+    1284, 1314, 642, 1345, 1316, 1346, 643, 1377, 1348, 1378, 674, 1409, 1380, 1410, 675, 1441,
+    1412, 1442, 706, 1473, 1444, 1474, 707, 1505, 1476, 1506, 738, 1537, 1508, 1538, 739, 1569,
+    1540, 1570, 770, 1611, 1572, 1618, 771, 1629, 1604, 1640
+};
+
+unsigned short action_default[] = {
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 14, 18, 22, 26,
+    30, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90,
+    94, 98, 102, 106, 110, 422, 426, 0, 0, 414, 402, 0, 426, 418, 0, 430,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 410, 426, 0, 0, 0,
+    406, 426, 0, 390, 0, 398, 0, 394, 426, 0, 378, 0, 386, 0, 382, 426,
+    0, 366, 0, 374, 0, 370, 426, 0, 354, 0, 362, 0, 358, 426, 0, 342,
+    0, 350, 0, 346, 426, 0, 330, 0, 338, 0, 334, 426, 0, 318, 0, 326,
+    0, 322, 426, 0, 306, 0, 314, 0, 310, 426, 0, 294, 0, 302, 0, 298,
+    426, 0, 282, 0, 290, 0, 286, 426, 0, 270, 0, 278, 0, 274, 426, 0,
+    258, 0, 266, 0, 262, 426, 0, 246, 0, 254, 0, 250, 426, 0, 234, 0,
+    242, 0, 238, 426, 0, 222, 0, 230, 0, 226, 426, 0, 210, 0, 218, 0,
+    214, 426, 0, 198, 0, 206, 0, 202, 426, 0, 186, 0, 194, 0, 190, 426,
+    0, 174, 0, 182, 0, 178, 426, 0, 162, 0, 170, 0, 166, 426, 0, 150,
+    0, 158, 0, 154, 426, 0, 138, 0, 146, 0, 142, 426, 0, 126, 0, 134,
+    0, 130, 426, 0, 114, 0, 122, 0, 118, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0, 0, 0, 426, 0,
+    0, 0, 426, 0, 0, 0, 426, 0, 0, 0
+};
+
+unsigned short action_check[] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 3, 54, 2, 3,
+    92, 2, 3, 1, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 56, 62, 97,
+    62, 56, 104, 65, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 64, 93, 64,
+    111, 118, 93, 94, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 95, 98, 125,
+    132, 95, 98, 100, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 102, 105, 139,
+    146, 102, 105, 107, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 109, 112, 153,
+    160, 109, 112, 114, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 116, 119, 167,
+    174, 116, 119, 121, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 123, 126, 181,
+    188, 123, 126, 128, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+    135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 130, 133, 195,
+    202, 130, 133, 135, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 137, 140, 209,
+    216, 137, 140, 142, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+    149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 144, 147, 223,
+    230, 144, 147, 149, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 151, 154, 237,
+    244, 151, 154, 156, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+    163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 158, 161, 251,
+    258, 158, 161, 163, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 165, 168, 266,
+    270, 165, 168, 170, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 172, 175, 274,
+    278, 172, 175, 177, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 179, 182, 282,
+    286, 179, 182, 184, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 186, 189, 290,
+    294, 186, 189, 191, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 193, 196, 298,
+    302, 193, 196, 198, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205,
+    205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 200, 203, 306,
+    310, 200, 203, 205, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 207, 210, 314,
+    318, 207, 210, 212, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+    219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 214, 217, 322,
+    326, 214, 217, 219, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 221, 224, 330,
+    334, 221, 224, 226, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 228, 231, 338,
+    342, 228, 231, 233, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 235, 238, 346,
+    350, 235, 238, 240, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 242, 245, 354,
+    358, 242, 245, 247, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 249, 252, 362,
+    362, 249, 252, 254, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 256, 259, 362,
+    362, 256, 259, 261, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+    268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 263, 265, 362,
+    362, 263, 265, 268, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+    272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 267, 269, 362,
+    362, 267, 269, 272, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 271, 273, 362,
+    362, 271, 273, 276, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 275, 277, 362,
+    362, 275, 277, 280, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+    284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 279, 281, 362,
+    362, 279, 281, 284, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+    288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 283, 285, 362,
+    362, 283, 285, 288, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+    292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 287, 289, 362,
+    362, 287, 289, 292, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296,
+    296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 291, 293, 362,
+    362, 291, 293, 296, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+    300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 295, 297, 362,
+    362, 295, 297, 300, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+    304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 299, 301, 362,
+    362, 299, 301, 304, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 303, 305, 362,
+    362, 303, 305, 308, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312,
+    312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 307, 309, 362,
+    362, 307, 309, 312, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316,
+    316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 311, 313, 362,
+    362, 311, 313, 316, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+    320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 315, 317, 362,
+    362, 315, 317, 320, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+    324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 319, 321, 362,
+    362, 319, 321, 324, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+    328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 323, 325, 362,
+    362, 323, 325, 328, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+    332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 327, 329, 362,
+    362, 327, 329, 332, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+    336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 331, 333, 362,
+    362, 331, 333, 336, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340,
+    340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 335, 337, 362,
+    362, 335, 337, 340, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344,
+    344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 339, 341, 362,
+    362, 339, 341, 344, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 343, 345, 362,
+    362, 343, 345, 348, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+    352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 347, 349, 362,
+    362, 347, 349, 352, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 351, 353, 362,
+    362, 351, 353, 356, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360,
+    360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 4, 362, 4,
+    362, 362, 4, 360, 5, 4, 5, 355, 6, 5, 6, 355, 5, 6, 357, 7,
+    6, 7, 357, 8, 7, 8, 362, 7, 8, 359, 9, 8, 9, 359, 10, 9,
+    10, 362, 9, 10, 361, 11, 10, 11, 361, 12, 11, 12, 362, 11, 12, 362,
+    13, 12, 13, 362, 14, 13, 14, 362, 13, 14, 362, 15, 14, 15, 362, 16,
+    15, 16, 362, 15, 16, 362, 17, 16, 17, 362, 18, 17, 18, 362, 17, 18,
+    362, 19, 18, 19, 362, 20, 19, 20, 362, 19, 20, 362, 21, 20, 21, 362,
+    22, 21, 22, 362, 21, 22, 362, 23, 22, 23, 362, 24, 23, 24, 362, 23,
+    24, 362, 25, 24, 25, 362, 26, 25, 26, 362, 25, 26, 362, 66, 26, 66,
+    362, 67, 66, 67, 362, 66, 67, 362, 68, 67, 68, 362, 69, 68, 69, 362,
+    68, 69, 362, 70, 69, 70, 362, 71, 70, 71, 362, 70, 71, 362, 72, 71,
+    72, 362, 73, 72, 73, 362, 72, 73, 362, 74, 73, 74, 362, 75, 74, 75,
+    362, 74, 75, 362, 76, 75, 76, 362, 77, 76, 77, 362, 76, 77, 362, 78,
+    77, 78, 362, 79, 78, 79, 362, 78, 79, 362, 80, 79, 80, 362, 81, 80,
+    81, 362, 80, 81, 362, 82, 81, 82, 362, 83, 82, 83, 362, 82, 83, 362,
+    84, 83, 84, 362, 85, 84, 85, 362, 84, 85, 362, 86, 85, 86, 362, 87,
+    86, 87, 362, 86, 87, 362, 88, 87, 88, 362, 89, 88, 89, 362, 88, 89,
+    362, 90, 89, 90, 362, 55, 90, 55, 59, 90, 59, 362, 362, 55, 362, 362,
+    59, 362, 362
+};
+
+unsigned short action_next[] = {
+    9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61, 65, 69,
+    73, 77, 81, 85, 89, 93, 97, 101, 105, 213, 213, 2245, 2209, 1405, 2249, 2213,
+    529, 225, 225, 3, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 237, 273, 565,
+    277, 241, 601, 397, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 273, 517, 289,
+    637, 673, 241, 525, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 537, 553, 709,
+    745, 241, 241, 561, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 573, 589, 781,
+    817, 241, 241, 597, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 609, 625, 853,
+    889, 241, 241, 633, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 645, 661, 925,
+    961, 241, 241, 669, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 681, 697, 997,
+    1033, 241, 241, 705, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 717, 733, 1069,
+    1105, 241, 241, 741, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 753, 769, 1141,
+    1177, 241, 241, 777, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 789, 805, 1213,
+    1249, 241, 241, 813, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 825, 841, 1285,
+    1321, 241, 241, 849, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 861, 877, 1357,
+    1393, 241, 241, 885, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 897, 913, 1441,
+    1477, 241, 241, 921, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 933, 949, 1513,
+    1549, 241, 241, 957, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 969, 985, 1585,
+    1621, 241, 241, 993, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1005, 1021, 1657,
+    1693, 241, 241, 1029, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1041, 1057, 1729,
+    1765, 241, 241, 1065, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1077, 1093, 1801,
+    1837, 241, 241, 1101, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1113, 1129, 1873,
+    1909, 241, 241, 1137, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1149, 1165, 1945,
+    1981, 241, 241, 1173, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1185, 1201, 2017,
+    2053, 241, 241, 1209, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1221, 1237, 2089,
+    2125, 241, 241, 1245, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1257, 1273, 2161,
+    2197, 241, 241, 1281, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1293, 1309, 2233,
+    2269, 241, 241, 1317, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1329, 1345, 0,
+    0, 241, 241, 1353, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1365, 1381, 0,
+    0, 241, 241, 1389, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1401, 1413, 0,
+    0, 241, 241, 1437, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1429, 1449, 0,
+    0, 241, 241, 1473, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1465, 1485, 0,
+    0, 241, 241, 1509, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1501, 1521, 0,
+    0, 241, 241, 1545, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1537, 1557, 0,
+    0, 241, 241, 1581, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1573, 1593, 0,
+    0, 241, 241, 1617, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1609, 1629, 0,
+    0, 241, 241, 1653, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1645, 1665, 0,
+    0, 241, 241, 1689, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1681, 1701, 0,
+    0, 241, 241, 1725, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1717, 1737, 0,
+    0, 241, 241, 1761, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1753, 1773, 0,
+    0, 241, 241, 1797, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1789, 1809, 0,
+    0, 241, 241, 1833, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1825, 1845, 0,
+    0, 241, 241, 1869, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1861, 1881, 0,
+    0, 241, 241, 1905, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1897, 1917, 0,
+    0, 241, 241, 1941, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1933, 1953, 0,
+    0, 241, 241, 1977, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 1969, 1989, 0,
+    0, 241, 241, 2013, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2005, 2025, 0,
+    0, 241, 241, 2049, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2041, 2061, 0,
+    0, 241, 241, 2085, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2077, 2097, 0,
+    0, 241, 241, 2121, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2113, 2133, 0,
+    0, 241, 241, 2157, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2149, 2169, 0,
+    0, 241, 241, 2193, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 2185, 2205, 0,
+    0, 241, 241, 2229, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 337, 341,
+    345, 349, 353, 357, 361, 365, 369, 373, 377, 381, 385, 389, 393, 213, 0, 2173,
+    0, 0, 2177, 2265, 213, 225, 2137, 2221, 213, 2141, 2101, 241, 225, 2105, 2241, 213,
+    225, 2065, 241, 213, 2069, 2029, 0, 225, 2033, 2257, 213, 225, 1993, 241, 213, 1997,
+    1957, 0, 225, 1961, 2277, 213, 225, 1921, 241, 213, 1925, 1885, 0, 225, 1889, 0,
+    213, 225, 1849, 0, 213, 1853, 1813, 0, 225, 1817, 0, 213, 225, 1777, 0, 213,
+    1781, 1741, 0, 225, 1745, 0, 213, 225, 1705, 0, 213, 1709, 1669, 0, 225, 1673,
+    0, 213, 225, 1633, 0, 213, 1637, 1597, 0, 225, 1601, 0, 213, 225, 1561, 0,
+    213, 1565, 1525, 0, 225, 1529, 0, 213, 225, 1489, 0, 213, 1493, 1453, 0, 225,
+    1457, 0, 213, 225, 1417, 0, 213, 1421, 217, 0, 225, 221, 0, 213, 225, 1369,
+    0, 213, 1373, 1333, 0, 225, 1337, 0, 213, 225, 1297, 0, 213, 1301, 1261, 0,
+    225, 1265, 0, 213, 225, 1225, 0, 213, 1229, 1189, 0, 225, 1193, 0, 213, 225,
+    1153, 0, 213, 1157, 1117, 0, 225, 1121, 0, 213, 225, 1081, 0, 213, 1085, 1045,
+    0, 225, 1049, 0, 213, 225, 1009, 0, 213, 1013, 973, 0, 225, 977, 0, 213,
+    225, 937, 0, 213, 941, 901, 0, 225, 905, 0, 213, 225, 865, 0, 213, 869,
+    829, 0, 225, 833, 0, 213, 225, 793, 0, 213, 797, 757, 0, 225, 761, 0,
+    213, 225, 721, 0, 213, 725, 685, 0, 225, 689, 0, 213, 225, 649, 0, 213,
+    653, 613, 0, 225, 617, 0, 213, 225, 577, 0, 213, 581, 541, 0, 225, 545,
+    0, 213, 225, 505, 0, 253, 509, 257, 213, 225, 245, 0, 0, 261, 0, 0,
+    225, 0, 0
+};
+
+unsigned short goto_base[] = {
+    0, 0, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 0, 1
+};
+
+unsigned short goto_default[] = {
+    0, 1, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 57, 58
+};
+
+unsigned char goto_check[] = {
+    30, 2, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 30, 30, 30, 30, 1, 28, 29, 30, 30, 30, 29, 30, 30,
+    30, 28, 29, 30, 30, 29, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 1,
+    30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30,
+    30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28,
+    30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30,
+    30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30,
+    30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30,
+    1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30,
+    30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30,
+    28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30,
+    30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1,
+    30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30,
+    30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28,
+    30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30,
+    30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30,
+    30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 28,
+    30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30,
+    30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30,
+    30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30,
+    1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30,
+    30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30,
+    28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30,
+    30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1,
+    30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30,
+    30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28,
+    30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30,
+    30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30,
+    30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30,
+    1, 30, 30, 30, 30, 28, 30, 30, 30, 1, 30, 30, 30, 30, 28, 30,
+    30, 30, 1, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30
+};
+
+unsigned short goto_next[] = {
+    0, 27, 563, 554, 545, 536, 527, 518, 509, 500, 491, 482, 473, 464, 455, 446,
+    437, 428, 419, 410, 401, 392, 383, 374, 365, 356, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 0, 0, 0, 0, 73, 66, 67, 0, 0, 0, 62, 0, 0,
+    0, 71, 67, 0, 0, 70, 0, 0, 0, 0, 344, 335, 326, 317, 308, 299,
+    290, 281, 272, 263, 254, 245, 236, 227, 218, 209, 200, 191, 182, 173, 164, 155,
+    146, 137, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+    0, 0, 0, 0, 133, 0, 0, 0, 139, 0, 0, 0, 0, 142, 0, 0,
+    0, 148, 0, 0, 0, 0, 151, 0, 0, 0, 157, 0, 0, 0, 0, 160,
+    0, 0, 0, 166, 0, 0, 0, 0, 169, 0, 0, 0, 175, 0, 0, 0,
+    0, 178, 0, 0, 0, 184, 0, 0, 0, 0, 187, 0, 0, 0, 193, 0,
+    0, 0, 0, 196, 0, 0, 0, 202, 0, 0, 0, 0, 205, 0, 0, 0,
+    211, 0, 0, 0, 0, 214, 0, 0, 0, 220, 0, 0, 0, 0, 223, 0,
+    0, 0, 229, 0, 0, 0, 0, 232, 0, 0, 0, 238, 0, 0, 0, 0,
+    241, 0, 0, 0, 247, 0, 0, 0, 0, 250, 0, 0, 0, 256, 0, 0,
+    0, 0, 259, 0, 0, 0, 265, 0, 0, 0, 0, 268, 0, 0, 0, 274,
+    0, 0, 0, 0, 277, 0, 0, 0, 283, 0, 0, 0, 0, 286, 0, 0,
+    0, 292, 0, 0, 0, 0, 295, 0, 0, 0, 301, 0, 0, 0, 0, 304,
+    0, 0, 0, 310, 0, 0, 0, 0, 313, 0, 0, 0, 319, 0, 0, 0,
+    0, 322, 0, 0, 0, 328, 0, 0, 0, 0, 331, 0, 0, 0, 337, 0,
+    0, 0, 0, 340, 0, 0, 0, 346, 0, 0, 0, 0, 349, 0, 0, 352,
+    0, 0, 0, 358, 0, 0, 0, 0, 361, 0, 0, 0, 367, 0, 0, 0,
+    0, 370, 0, 0, 0, 376, 0, 0, 0, 0, 379, 0, 0, 0, 385, 0,
+    0, 0, 0, 388, 0, 0, 0, 394, 0, 0, 0, 0, 397, 0, 0, 0,
+    403, 0, 0, 0, 0, 406, 0, 0, 0, 412, 0, 0, 0, 0, 415, 0,
+    0, 0, 421, 0, 0, 0, 0, 424, 0, 0, 0, 430, 0, 0, 0, 0,
+    433, 0, 0, 0, 439, 0, 0, 0, 0, 442, 0, 0, 0, 448, 0, 0,
+    0, 0, 451, 0, 0, 0, 457, 0, 0, 0, 0, 460, 0, 0, 0, 466,
+    0, 0, 0, 0, 469, 0, 0, 0, 475, 0, 0, 0, 0, 478, 0, 0,
+    0, 484, 0, 0, 0, 0, 487, 0, 0, 0, 493, 0, 0, 0, 0, 496,
+    0, 0, 0, 502, 0, 0, 0, 0, 505, 0, 0, 0, 511, 0, 0, 0,
+    0, 514, 0, 0, 0, 520, 0, 0, 0, 0, 523, 0, 0, 0, 529, 0,
+    0, 0, 0, 532, 0, 0, 0, 538, 0, 0, 0, 0, 541, 0, 0, 0,
+    547, 0, 0, 0, 0, 550, 0, 0, 0, 556, 0, 0, 0, 0, 559, 0,
+    0, 0, 565, 0, 0, 0, 0, 568, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/* Comb tables of 15613 bytes, 20.1406% of the 77520 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,7429 @@
+#include "synth.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"sa", false, 0};
+Symbol term1 = {"sb", false, 1};
+Symbol term2 = {"sc", false, 2};
+Symbol term3 = {"sd", false, 3};
+Symbol term4 = {"se", false, 4};
+Symbol term5 = {"sf", false, 5};
+Symbol term6 = {"sg", false, 6};
+Symbol term7 = {"sh", false, 7};
+Symbol term8 = {"si", false, 8};
+Symbol term9 = {"sj", false, 9};
+Symbol term10 = {"sk", false, 10};
+Symbol term11 = {"sl", false, 11};
+Symbol term12 = {"sm", false, 12};
+Symbol term13 = {"sn", false, 13};
+Symbol term14 = {"so", false, 14};
+Symbol term15 = {"sp", false, 15};
+Symbol term16 = {"sq", false, 16};
+Symbol term17 = {"sr", false, 17};
+Symbol term18 = {"ss", false, 18};
+Symbol term19 = {"st", false, 19};
+Symbol term20 = {"su", false, 20};
+Symbol term21 = {"sv", false, 21};
+Symbol term22 = {"sw", false, 22};
+Symbol term23 = {"sx", false, 23};
+Symbol term24 = {"sy", false, 24};
+Symbol term25 = {"sz", false, 25};
+Symbol term26 = {"sab", false, 26};
+Symbol term27 = {"sbb", false, 27};
+Symbol term28 = {"scb", false, 28};
+Symbol term29 = {"sdb", false, 29};
+Symbol term30 = {"seb", false, 30};
+Symbol term31 = {"sfb", false, 31};
+Symbol term32 = {"sgb", false, 32};
+Symbol term33 = {"shb", false, 33};
+Symbol term34 = {"sib", false, 34};
+Symbol term35 = {"sjb", false, 35};
+Symbol term36 = {"skb", false, 36};
+Symbol term37 = {"slb", false, 37};
+Symbol term38 = {"smb", false, 38};
+Symbol term39 = {"snb", false, 39};
+Symbol term40 = {"sob", false, 40};
+Symbol term41 = {"spb", false, 41};
+Symbol term42 = {"sqb", false, 42};
+Symbol term43 = {"srb", false, 43};
+Symbol term44 = {"ssb", false, 44};
+Symbol term45 = {"stb", false, 45};
+Symbol term46 = {"sub", false, 46};
+Symbol term47 = {"svb", false, 47};
+Symbol term48 = {"swb", false, 48};
+Symbol term49 = {"sxb", false, 49};
+Symbol term50 = {"num", false, 50};
+Symbol term51 = {"ws", true, 51};
+Symbol term52 = {"id", false, 52};
+Symbol term53 = {";", false, 53};
+Symbol term54 = {"=", false, 54};
+Symbol term55 = {"{", false, 55};
+Symbol term56 = {"}", false, 56};
+Symbol term57 = {"+", false, 57};
+Symbol term58 = {"(", false, 58};
+Symbol term59 = {")", false, 59};
+
+class Tree;
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+extern Node node9;
+extern Node node10;
+extern Node node11;
+extern Node node12;
+extern Node node13;
+extern Node node14;
+extern Node node15;
+extern Node node16;
+extern Node node17;
+extern Node node18;
+extern Node node19;
+extern Node node20;
+extern Node node21;
+extern Node node22;
+extern Node node23;
+extern Node node24;
+extern Node node25;
+extern Node node26;
+extern Node node27;
+extern Node node28;
+extern Node node29;
+extern Node node30;
+extern Node node31;
+extern Node node32;
+extern Node node33;
+extern Node node34;
+extern Node node35;
+extern Node node36;
+extern Node node37;
+extern Node node38;
+extern Node node39;
+extern Node node40;
+extern Node node41;
+extern Node node42;
+extern Node node43;
+extern Node node44;
+extern Node node45;
+extern Node node46;
+extern Node node47;
+extern Node node48;
+extern Node node49;
+extern Node node50;
+extern Node node51;
+extern Node node52;
+extern Node node53;
+extern Node node54;
+extern Node node55;
+extern Node node56;
+extern Node node57;
+extern Node node58;
+extern Node node59;
+extern Node node60;
+extern Node node61;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 9, 10, 10, 10, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 13, 14, 15, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 47 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 9) { return &node4; }
+    if (k == 11) { return &node5; }
+    if (k == 13) { return &node6; }
+    if (k == 15) { return &node7; }
+    if ((k >= 17) && (k <= 34)) { return &node8; }
+    if (k == 35) { return &node9; }
+    if ((k >= 36) && (k <= 42)) { return &node8; }
+    if (k == 43) { return &node10; }
+    if (k == 45) { return &node11; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 11) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next9(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node12; }
+    if (k == 18) { return &node13; }
+    if (k == 19) { return &node14; }
+    if (k == 20) { return &node15; }
+    if (k == 21) { return &node16; }
+    if (k == 22) { return &node17; }
+    if (k == 23) { return &node18; }
+    if (k == 24) { return &node19; }
+    if (k == 25) { return &node20; }
+    if (k == 26) { return &node21; }
+    if (k == 27) { return &node22; }
+    if (k == 28) { return &node23; }
+    if (k == 29) { return &node24; }
+    if (k == 30) { return &node25; }
+    if (k == 31) { return &node26; }
+    if (k == 32) { return &node27; }
+    if (k == 33) { return &node28; }
+    if (k == 34) { return &node29; }
+    if (k == 35) { return &node30; }
+    if (k == 36) { return &node31; }
+    if (k == 37) { return &node32; }
+    if (k == 38) { return &node33; }
+    if (k == 39) { return &node34; }
+    if (k == 40) { return &node35; }
+    if (k == 41) { return &node36; }
+    if (k == 42) { return &node37; }
+    return nullptr;
+}
+
+Node*
+next12(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node61; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next13(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node60; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next14(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node59; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next15(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node58; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next16(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node57; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next17(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node56; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next18(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node55; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next19(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node54; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next20(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node53; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next21(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node52; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next22(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node51; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next23(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node50; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next24(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node49; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next25(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node48; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next26(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node47; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next27(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node46; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next28(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node45; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next29(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node44; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next30(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node43; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next31(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node42; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next32(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node41; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next33(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node40; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next34(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node39; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next35(int c) {
+    int k = lexer_class(c);
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node38; }
+    if ((k >= 19) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next36(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next37(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next38(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next39(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next40(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next41(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next42(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next43(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next44(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next45(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next46(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next47(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next48(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next49(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next50(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next51(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next52(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next53(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next54(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next55(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next56(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next57(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next58(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next59(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next60(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next61(int c) {
+    int k = lexer_class(c);
+    if ((k >= 17) && (k <= 42)) { return &node8; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term51, nullptr};
+Node node2 = {nullptr, &term58, nullptr};
+Node node3 = {nullptr, &term59, nullptr};
+Node node4 = {nullptr, &term57, nullptr};
+Node node5 = {&next5, &term50, nullptr};
+Node node6 = {nullptr, &term53, nullptr};
+Node node7 = {nullptr, &term54, nullptr};
+Node node8 = {&next8, &term52, nullptr};
+Node node9 = {&next9, &term52, nullptr};
+Node node10 = {nullptr, &term55, nullptr};
+Node node11 = {nullptr, &term56, nullptr};
+Node node12 = {&next12, &term0, nullptr};
+Node node13 = {&next13, &term1, nullptr};
+Node node14 = {&next14, &term2, nullptr};
+Node node15 = {&next15, &term3, nullptr};
+Node node16 = {&next16, &term4, nullptr};
+Node node17 = {&next17, &term5, nullptr};
+Node node18 = {&next18, &term6, nullptr};
+Node node19 = {&next19, &term7, nullptr};
+Node node20 = {&next20, &term8, nullptr};
+Node node21 = {&next21, &term9, nullptr};
+Node node22 = {&next22, &term10, nullptr};
+Node node23 = {&next23, &term11, nullptr};
+Node node24 = {&next24, &term12, nullptr};
+Node node25 = {&next25, &term13, nullptr};
+Node node26 = {&next26, &term14, nullptr};
+Node node27 = {&next27, &term15, nullptr};
+Node node28 = {&next28, &term16, nullptr};
+Node node29 = {&next29, &term17, nullptr};
+Node node30 = {&next30, &term18, nullptr};
+Node node31 = {&next31, &term19, nullptr};
+Node node32 = {&next32, &term20, nullptr};
+Node node33 = {&next33, &term21, nullptr};
+Node node34 = {&next34, &term22, nullptr};
+Node node35 = {&next35, &term23, nullptr};
+Node node36 = {&next36, &term24, nullptr};
+Node node37 = {&next37, &term25, nullptr};
+Node node38 = {&next38, &term49, nullptr};
+Node node39 = {&next39, &term48, nullptr};
+Node node40 = {&next40, &term47, nullptr};
+Node node41 = {&next41, &term46, nullptr};
+Node node42 = {&next42, &term45, nullptr};
+Node node43 = {&next43, &term44, nullptr};
+Node node44 = {&next44, &term43, nullptr};
+Node node45 = {&next45, &term42, nullptr};
+Node node46 = {&next46, &term41, nullptr};
+Node node47 = {&next47, &term40, nullptr};
+Node node48 = {&next48, &term39, nullptr};
+Node node49 = {&next49, &term38, nullptr};
+Node node50 = {&next50, &term37, nullptr};
+Node node51 = {&next51, &term36, nullptr};
+Node node52 = {&next52, &term35, nullptr};
+Node node53 = {&next53, &term34, nullptr};
+Node node54 = {&next54, &term33, nullptr};
+Node node55 = {&next55, &term32, nullptr};
+Node node56 = {&next56, &term31, nullptr};
+Node node57 = {&next57, &term30, nullptr};
+Node node58 = {&next58, &term29, nullptr};
+Node node59 = {&next59, &term28, nullptr};
+Node node60 = {&next60, &term27, nullptr};
+Node node61 = {&next61, &term26, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 60};
+Symbol nonterm0 = {"start", false, 0};
+Symbol nonterm1 = {"program", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+Symbol nonterm3 = {"s0", false, 3};
+Symbol nonterm4 = {"s1", false, 4};
+Symbol nonterm5 = {"s2", false, 5};
+Symbol nonterm6 = {"s3", false, 6};
+Symbol nonterm7 = {"s4", false, 7};
+Symbol nonterm8 = {"s5", false, 8};
+Symbol nonterm9 = {"s6", false, 9};
+Symbol nonterm10 = {"s7", false, 10};
+Symbol nonterm11 = {"s8", false, 11};
+Symbol nonterm12 = {"s9", false, 12};
+Symbol nonterm13 = {"s10", false, 13};
+Symbol nonterm14 = {"s11", false, 14};
+Symbol nonterm15 = {"s12", false, 15};
+Symbol nonterm16 = {"s13", false, 16};
+Symbol nonterm17 = {"s14", false, 17};
+Symbol nonterm18 = {"s15", false, 18};
+Symbol nonterm19 = {"s16", false, 19};
+Symbol nonterm20 = {"s17", false, 20};
+Symbol nonterm21 = {"s18", false, 21};
+Symbol nonterm22 = {"s19", false, 22};
+Symbol nonterm23 = {"s20", false, 23};
+Symbol nonterm24 = {"s21", false, 24};
+Symbol nonterm25 = {"s22", false, 25};
+Symbol nonterm26 = {"s23", false, 26};
+Symbol nonterm27 = {"s24", false, 27};
+Symbol nonterm28 = {"s25", false, 28};
+Symbol nonterm29 = {"s26", false, 29};
+Symbol nonterm30 = {"s27", false, 30};
+Symbol nonterm31 = {"s28", false, 31};
+Symbol nonterm32 = {"s29", false, 32};
+Symbol nonterm33 = {"s30", false, 33};
+Symbol nonterm34 = {"s31", false, 34};
+Symbol nonterm35 = {"s32", false, 35};
+Symbol nonterm36 = {"s33", false, 36};
+Symbol nonterm37 = {"s34", false, 37};
+Symbol nonterm38 = {"s35", false, 38};
+Symbol nonterm39 = {"s36", false, 39};
+Symbol nonterm40 = {"s37", false, 40};
+Symbol nonterm41 = {"s38", false, 41};
+Symbol nonterm42 = {"s39", false, 42};
+Symbol nonterm43 = {"s40", false, 43};
+Symbol nonterm44 = {"s41", false, 44};
+Symbol nonterm45 = {"s42", false, 45};
+Symbol nonterm46 = {"s43", false, 46};
+Symbol nonterm47 = {"s44", false, 47};
+Symbol nonterm48 = {"s45", false, 48};
+Symbol nonterm49 = {"s46", false, 49};
+Symbol nonterm50 = {"s47", false, 50};
+Symbol nonterm51 = {"s48", false, 51};
+Symbol nonterm52 = {"s49", false, 52};
+Symbol nonterm53 = {"expr", false, 53};
+Symbol nonterm54 = {"term", false, 54};
+
+unique_ptr<Tree>
+reduce_start_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_start_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_start_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_0(Table*);
+
+Value*
+reduce_program_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_program_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_program_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_program_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_program_1(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_1(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_2(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_2(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_3(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_3(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_3(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_4(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_4(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_4(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_5(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_5(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_5(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_6(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_6(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_6(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_7(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_7(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_7(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_8(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_8(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_8(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_9(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_9(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_9(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_10(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_10(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_10(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_11(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_11(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_11(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_12(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_12(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_12(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_13(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_13(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_13(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_14(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_14(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_14(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_15(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_15(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_15(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_16(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_16(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_16(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_17(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_17(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_17(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_18(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_18(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_18(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_19(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_19(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_19(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_20(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_20(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_20(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_21(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_21(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_21(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_22(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_22(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_22(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_23(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_23(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_23(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_24(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_24(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_24(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_25(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_25(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_25(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_26(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_26(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_26(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_27(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_27(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_27(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_28(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_28(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_28(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_29(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_29(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_29(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_30(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_30(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_30(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_31(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_31(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_31(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_32(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_32(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_32(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_33(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_33(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_33(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_34(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_34(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_34(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_35(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_35(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_35(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_36(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_36(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_36(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_37(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_37(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_37(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_38(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_38(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_38(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_39(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_39(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_39(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_40(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_40(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_40(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_41(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_41(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_41(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_42(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_42(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_42(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_43(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_43(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_43(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_44(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_44(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_44(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_45(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_45(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_45(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_46(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_46(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_46(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_47(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_47(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_47(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_48(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_48(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_48(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_stmt_49(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_stmt_49(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_stmt_49(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s0_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s0_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s0_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s1_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s1_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s1_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s2_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s2_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s2_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s3_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s3_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s3_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s4_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s4_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s4_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s5_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s5_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s5_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s6_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s6_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s6_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s7_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s7_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s7_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s8_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s8_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s8_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s9_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s9_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s9_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s10_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s10_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s10_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s11_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s11_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s11_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s12_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s12_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s12_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s13_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s13_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s13_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s14_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s14_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s14_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s15_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s15_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s15_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s16_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s16_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s16_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s17_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s17_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s17_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s18_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s18_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s18_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s19_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s19_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s19_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s20_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s20_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s20_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s21_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s21_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s21_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s22_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s22_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s22_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s23_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s23_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s23_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s24_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s24_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s24_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s25_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s25_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s25_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s25_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s25_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s25_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s25_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s25_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s25_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s26_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s26_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s26_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s26_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s26_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s26_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s26_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s26_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s26_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s27_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s27_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s27_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s27_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s27_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s27_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s27_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s27_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s27_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s28_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s28_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s28_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s28_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s28_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s28_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s28_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s28_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s28_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s29_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s29_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s29_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s29_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s29_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s29_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s29_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s29_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s29_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s30_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s30_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s30_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s30_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s30_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s30_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s30_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s30_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s30_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s31_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s31_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s31_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s31_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s31_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s31_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s31_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s31_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s31_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s32_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s32_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s32_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s32_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s32_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s32_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s32_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s32_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s32_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s33_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s33_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s33_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s33_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s33_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s33_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s33_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s33_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s33_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s34_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s34_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s34_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s34_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s34_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s34_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s34_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s34_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s34_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s35_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s35_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s35_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s35_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s35_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s35_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s35_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s35_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s35_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s36_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s36_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s36_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s36_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s36_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s36_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s36_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s36_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s36_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s37_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s37_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s37_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s37_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s37_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s37_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s37_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s37_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s37_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s38_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s38_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s38_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s38_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s38_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s38_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s38_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s38_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s38_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s39_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s39_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s39_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s39_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s39_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s39_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s39_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s39_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s39_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s40_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s40_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s40_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s40_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s40_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s40_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s40_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s40_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s40_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s41_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s41_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s41_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s41_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s41_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s41_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s41_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s41_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s41_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s42_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s42_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s42_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s42_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s42_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s42_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s42_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s42_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s42_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s43_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s43_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s43_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s43_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s43_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s43_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s43_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s43_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s43_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s44_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s44_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s44_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s44_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s44_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s44_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s44_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s44_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s44_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s45_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s45_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s45_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s45_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s45_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s45_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s45_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s45_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s45_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s46_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s46_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s46_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s46_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s46_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s46_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s46_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s46_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s46_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s47_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s47_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s47_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s47_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s47_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s47_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s47_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s47_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s47_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s48_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s48_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s48_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s48_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s48_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s48_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s48_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s48_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s48_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s49_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s49_0(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s49_0(table, E1);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s49_1(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s49_1(Table* table, Value** values) {
+    unique_ptr<Tree> E3(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s49_1(table, E3);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_s49_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_s49_2(Table* table, Value** values) {
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_s49_2(table, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_expr_0(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_0(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_0(table, E0);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_expr_1(Table*, unique_ptr<Tree>&, unique_ptr<Tree>&);
+
+Value*
+reduce_expr_1(Table* table, Value** values) {
+    unique_ptr<Tree> E0(dynamic_cast<Tree*>(values[-3]));
+    unique_ptr<Tree> E2(dynamic_cast<Tree*>(values[-1]));
+    unique_ptr<Tree> R = reduce_expr_1(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_0(Table*);
+
+Value*
+reduce_term_0(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_term_0(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_1(Table*);
+
+Value*
+reduce_term_1(Table* table, Value** values) {
+    unique_ptr<Tree> R = reduce_term_1(table);
+    return R.release();
+}
+
+unique_ptr<Tree>
+reduce_term_2(Table*, unique_ptr<Tree>&);
+
+Value*
+reduce_term_2(Table* table, Value** values) {
+    unique_ptr<Tree> E1(dynamic_cast<Tree*>(values[-2]));
+    unique_ptr<Tree> R = reduce_term_2(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_start_0, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_program_0, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_program_1, -1};
+Rule rule3 = {&nonterm2, 1, &reduce_stmt_0, -1};
+Rule rule4 = {&nonterm2, 1, &reduce_stmt_1, -1};
+Rule rule5 = {&nonterm2, 1, &reduce_stmt_2, -1};
+Rule rule6 = {&nonterm2, 1, &reduce_stmt_3, -1};
+Rule rule7 = {&nonterm2, 1, &reduce_stmt_4, -1};
+Rule rule8 = {&nonterm2, 1, &reduce_stmt_5, -1};
+Rule rule9 = {&nonterm2, 1, &reduce_stmt_6, -1};
+Rule rule10 = {&nonterm2, 1, &reduce_stmt_7, -1};
+Rule rule11 = {&nonterm2, 1, &reduce_stmt_8, -1};
+Rule rule12 = {&nonterm2, 1, &reduce_stmt_9, -1};
+Rule rule13 = {&nonterm2, 1, &reduce_stmt_10, -1};
+Rule rule14 = {&nonterm2, 1, &reduce_stmt_11, -1};
+Rule rule15 = {&nonterm2, 1, &reduce_stmt_12, -1};
+Rule rule16 = {&nonterm2, 1, &reduce_stmt_13, -1};
+Rule rule17 = {&nonterm2, 1, &reduce_stmt_14, -1};
+Rule rule18 = {&nonterm2, 1, &reduce_stmt_15, -1};
+Rule rule19 = {&nonterm2, 1, &reduce_stmt_16, -1};
+Rule rule20 = {&nonterm2, 1, &reduce_stmt_17, -1};
+Rule rule21 = {&nonterm2, 1, &reduce_stmt_18, -1};
+Rule rule22 = {&nonterm2, 1, &reduce_stmt_19, -1};
+Rule rule23 = {&nonterm2, 1, &reduce_stmt_20, -1};
+Rule rule24 = {&nonterm2, 1, &reduce_stmt_21, -1};
+Rule rule25 = {&nonterm2, 1, &reduce_stmt_22, -1};
+Rule rule26 = {&nonterm2, 1, &reduce_stmt_23, -1};
+Rule rule27 = {&nonterm2, 1, &reduce_stmt_24, -1};
+Rule rule28 = {&nonterm2, 1, &reduce_stmt_25, -1};
+Rule rule29 = {&nonterm2, 1, &reduce_stmt_26, -1};
+Rule rule30 = {&nonterm2, 1, &reduce_stmt_27, -1};
+Rule rule31 = {&nonterm2, 1, &reduce_stmt_28, -1};
+Rule rule32 = {&nonterm2, 1, &reduce_stmt_29, -1};
+Rule rule33 = {&nonterm2, 1, &reduce_stmt_30, -1};
+Rule rule34 = {&nonterm2, 1, &reduce_stmt_31, -1};
+Rule rule35 = {&nonterm2, 1, &reduce_stmt_32, -1};
+Rule rule36 = {&nonterm2, 1, &reduce_stmt_33, -1};
+Rule rule37 = {&nonterm2, 1, &reduce_stmt_34, -1};
+Rule rule38 = {&nonterm2, 1, &reduce_stmt_35, -1};
+Rule rule39 = {&nonterm2, 1, &reduce_stmt_36, -1};
+Rule rule40 = {&nonterm2, 1, &reduce_stmt_37, -1};
+Rule rule41 = {&nonterm2, 1, &reduce_stmt_38, -1};
+Rule rule42 = {&nonterm2, 1, &reduce_stmt_39, -1};
+Rule rule43 = {&nonterm2, 1, &reduce_stmt_40, -1};
+Rule rule44 = {&nonterm2, 1, &reduce_stmt_41, -1};
+Rule rule45 = {&nonterm2, 1, &reduce_stmt_42, -1};
+Rule rule46 = {&nonterm2, 1, &reduce_stmt_43, -1};
+Rule rule47 = {&nonterm2, 1, &reduce_stmt_44, -1};
+Rule rule48 = {&nonterm2, 1, &reduce_stmt_45, -1};
+Rule rule49 = {&nonterm2, 1, &reduce_stmt_46, -1};
+Rule rule50 = {&nonterm2, 1, &reduce_stmt_47, -1};
+Rule rule51 = {&nonterm2, 1, &reduce_stmt_48, -1};
+Rule rule52 = {&nonterm2, 1, &reduce_stmt_49, -1};
+Rule rule53 = {&nonterm3, 3, &reduce_s0_0, -1};
+Rule rule54 = {&nonterm3, 5, &reduce_s0_1, -1};
+Rule rule55 = {&nonterm3, 4, &reduce_s0_2, -1};
+Rule rule56 = {&nonterm4, 3, &reduce_s1_0, -1};
+Rule rule57 = {&nonterm4, 5, &reduce_s1_1, -1};
+Rule rule58 = {&nonterm4, 4, &reduce_s1_2, -1};
+Rule rule59 = {&nonterm5, 3, &reduce_s2_0, -1};
+Rule rule60 = {&nonterm5, 5, &reduce_s2_1, -1};
+Rule rule61 = {&nonterm5, 4, &reduce_s2_2, -1};
+Rule rule62 = {&nonterm6, 3, &reduce_s3_0, -1};
+Rule rule63 = {&nonterm6, 5, &reduce_s3_1, -1};
+Rule rule64 = {&nonterm6, 4, &reduce_s3_2, -1};
+Rule rule65 = {&nonterm7, 3, &reduce_s4_0, -1};
+Rule rule66 = {&nonterm7, 5, &reduce_s4_1, -1};
+Rule rule67 = {&nonterm7, 4, &reduce_s4_2, -1};
+Rule rule68 = {&nonterm8, 3, &reduce_s5_0, -1};
+Rule rule69 = {&nonterm8, 5, &reduce_s5_1, -1};
+Rule rule70 = {&nonterm8, 4, &reduce_s5_2, -1};
+Rule rule71 = {&nonterm9, 3, &reduce_s6_0, -1};
+Rule rule72 = {&nonterm9, 5, &reduce_s6_1, -1};
+Rule rule73 = {&nonterm9, 4, &reduce_s6_2, -1};
+Rule rule74 = {&nonterm10, 3, &reduce_s7_0, -1};
+Rule rule75 = {&nonterm10, 5, &reduce_s7_1, -1};
+Rule rule76 = {&nonterm10, 4, &reduce_s7_2, -1};
+Rule rule77 = {&nonterm11, 3, &reduce_s8_0, -1};
+Rule rule78 = {&nonterm11, 5, &reduce_s8_1, -1};
+Rule rule79 = {&nonterm11, 4, &reduce_s8_2, -1};
+Rule rule80 = {&nonterm12, 3, &reduce_s9_0, -1};
+Rule rule81 = {&nonterm12, 5, &reduce_s9_1, -1};
+Rule rule82 = {&nonterm12, 4, &reduce_s9_2, -1};
+Rule rule83 = {&nonterm13, 3, &reduce_s10_0, -1};
+Rule rule84 = {&nonterm13, 5, &reduce_s10_1, -1};
+Rule rule85 = {&nonterm13, 4, &reduce_s10_2, -1};
+Rule rule86 = {&nonterm14, 3, &reduce_s11_0, -1};
+Rule rule87 = {&nonterm14, 5, &reduce_s11_1, -1};
+Rule rule88 = {&nonterm14, 4, &reduce_s11_2, -1};
+Rule rule89 = {&nonterm15, 3, &reduce_s12_0, -1};
+Rule rule90 = {&nonterm15, 5, &reduce_s12_1, -1};
+Rule rule91 = {&nonterm15, 4, &reduce_s12_2, -1};
+Rule rule92 = {&nonterm16, 3, &reduce_s13_0, -1};
+Rule rule93 = {&nonterm16, 5, &reduce_s13_1, -1};
+Rule rule94 = {&nonterm16, 4, &reduce_s13_2, -1};
+Rule rule95 = {&nonterm17, 3, &reduce_s14_0, -1};
+Rule rule96 = {&nonterm17, 5, &reduce_s14_1, -1};
+Rule rule97 = {&nonterm17, 4, &reduce_s14_2, -1};
+Rule rule98 = {&nonterm18, 3, &reduce_s15_0, -1};
+Rule rule99 = {&nonterm18, 5, &reduce_s15_1, -1};
+Rule rule100 = {&nonterm18, 4, &reduce_s15_2, -1};
+Rule rule101 = {&nonterm19, 3, &reduce_s16_0, -1};
+Rule rule102 = {&nonterm19, 5, &reduce_s16_1, -1};
+Rule rule103 = {&nonterm19, 4, &reduce_s16_2, -1};
+Rule rule104 = {&nonterm20, 3, &reduce_s17_0, -1};
+Rule rule105 = {&nonterm20, 5, &reduce_s17_1, -1};
+Rule rule106 = {&nonterm20, 4, &reduce_s17_2, -1};
+Rule rule107 = {&nonterm21, 3, &reduce_s18_0, -1};
+Rule rule108 = {&nonterm21, 5, &reduce_s18_1, -1};
+Rule rule109 = {&nonterm21, 4, &reduce_s18_2, -1};
+Rule rule110 = {&nonterm22, 3, &reduce_s19_0, -1};
+Rule rule111 = {&nonterm22, 5, &reduce_s19_1, -1};
+Rule rule112 = {&nonterm22, 4, &reduce_s19_2, -1};
+Rule rule113 = {&nonterm23, 3, &reduce_s20_0, -1};
+Rule rule114 = {&nonterm23, 5, &reduce_s20_1, -1};
+Rule rule115 = {&nonterm23, 4, &reduce_s20_2, -1};
+Rule rule116 = {&nonterm24, 3, &reduce_s21_0, -1};
+Rule rule117 = {&nonterm24, 5, &reduce_s21_1, -1};
+Rule rule118 = {&nonterm24, 4, &reduce_s21_2, -1};
+Rule rule119 = {&nonterm25, 3, &reduce_s22_0, -1};
+Rule rule120 = {&nonterm25, 5, &reduce_s22_1, -1};
+Rule rule121 = {&nonterm25, 4, &reduce_s22_2, -1};
+Rule rule122 = {&nonterm26, 3, &reduce_s23_0, -1};
+Rule rule123 = {&nonterm26, 5, &reduce_s23_1, -1};
+Rule rule124 = {&nonterm26, 4, &reduce_s23_2, -1};
+Rule rule125 = {&nonterm27, 3, &reduce_s24_0, -1};
+Rule rule126 = {&nonterm27, 5, &reduce_s24_1, -1};
+Rule rule127 = {&nonterm27, 4, &reduce_s24_2, -1};
+Rule rule128 = {&nonterm28, 3, &reduce_s25_0, -1};
+Rule rule129 = {&nonterm28, 5, &reduce_s25_1, -1};
+Rule rule130 = {&nonterm28, 4, &reduce_s25_2, -1};
+Rule rule131 = {&nonterm29, 3, &reduce_s26_0, -1};
+Rule rule132 = {&nonterm29, 5, &reduce_s26_1, -1};
+Rule rule133 = {&nonterm29, 4, &reduce_s26_2, -1};
+Rule rule134 = {&nonterm30, 3, &reduce_s27_0, -1};
+Rule rule135 = {&nonterm30, 5, &reduce_s27_1, -1};
+Rule rule136 = {&nonterm30, 4, &reduce_s27_2, -1};
+Rule rule137 = {&nonterm31, 3, &reduce_s28_0, -1};
+Rule rule138 = {&nonterm31, 5, &reduce_s28_1, -1};
+Rule rule139 = {&nonterm31, 4, &reduce_s28_2, -1};
+Rule rule140 = {&nonterm32, 3, &reduce_s29_0, -1};
+Rule rule141 = {&nonterm32, 5, &reduce_s29_1, -1};
+Rule rule142 = {&nonterm32, 4, &reduce_s29_2, -1};
+Rule rule143 = {&nonterm33, 3, &reduce_s30_0, -1};
+Rule rule144 = {&nonterm33, 5, &reduce_s30_1, -1};
+Rule rule145 = {&nonterm33, 4, &reduce_s30_2, -1};
+Rule rule146 = {&nonterm34, 3, &reduce_s31_0, -1};
+Rule rule147 = {&nonterm34, 5, &reduce_s31_1, -1};
+Rule rule148 = {&nonterm34, 4, &reduce_s31_2, -1};
+Rule rule149 = {&nonterm35, 3, &reduce_s32_0, -1};
+Rule rule150 = {&nonterm35, 5, &reduce_s32_1, -1};
+Rule rule151 = {&nonterm35, 4, &reduce_s32_2, -1};
+Rule rule152 = {&nonterm36, 3, &reduce_s33_0, -1};
+Rule rule153 = {&nonterm36, 5, &reduce_s33_1, -1};
+Rule rule154 = {&nonterm36, 4, &reduce_s33_2, -1};
+Rule rule155 = {&nonterm37, 3, &reduce_s34_0, -1};
+Rule rule156 = {&nonterm37, 5, &reduce_s34_1, -1};
+Rule rule157 = {&nonterm37, 4, &reduce_s34_2, -1};
+Rule rule158 = {&nonterm38, 3, &reduce_s35_0, -1};
+Rule rule159 = {&nonterm38, 5, &reduce_s35_1, -1};
+Rule rule160 = {&nonterm38, 4, &reduce_s35_2, -1};
+Rule rule161 = {&nonterm39, 3, &reduce_s36_0, -1};
+Rule rule162 = {&nonterm39, 5, &reduce_s36_1, -1};
+Rule rule163 = {&nonterm39, 4, &reduce_s36_2, -1};
+Rule rule164 = {&nonterm40, 3, &reduce_s37_0, -1};
+Rule rule165 = {&nonterm40, 5, &reduce_s37_1, -1};
+Rule rule166 = {&nonterm40, 4, &reduce_s37_2, -1};
+Rule rule167 = {&nonterm41, 3, &reduce_s38_0, -1};
+Rule rule168 = {&nonterm41, 5, &reduce_s38_1, -1};
+Rule rule169 = {&nonterm41, 4, &reduce_s38_2, -1};
+Rule rule170 = {&nonterm42, 3, &reduce_s39_0, -1};
+Rule rule171 = {&nonterm42, 5, &reduce_s39_1, -1};
+Rule rule172 = {&nonterm42, 4, &reduce_s39_2, -1};
+Rule rule173 = {&nonterm43, 3, &reduce_s40_0, -1};
+Rule rule174 = {&nonterm43, 5, &reduce_s40_1, -1};
+Rule rule175 = {&nonterm43, 4, &reduce_s40_2, -1};
+Rule rule176 = {&nonterm44, 3, &reduce_s41_0, -1};
+Rule rule177 = {&nonterm44, 5, &reduce_s41_1, -1};
+Rule rule178 = {&nonterm44, 4, &reduce_s41_2, -1};
+Rule rule179 = {&nonterm45, 3, &reduce_s42_0, -1};
+Rule rule180 = {&nonterm45, 5, &reduce_s42_1, -1};
+Rule rule181 = {&nonterm45, 4, &reduce_s42_2, -1};
+Rule rule182 = {&nonterm46, 3, &reduce_s43_0, -1};
+Rule rule183 = {&nonterm46, 5, &reduce_s43_1, -1};
+Rule rule184 = {&nonterm46, 4, &reduce_s43_2, -1};
+Rule rule185 = {&nonterm47, 3, &reduce_s44_0, -1};
+Rule rule186 = {&nonterm47, 5, &reduce_s44_1, -1};
+Rule rule187 = {&nonterm47, 4, &reduce_s44_2, -1};
+Rule rule188 = {&nonterm48, 3, &reduce_s45_0, -1};
+Rule rule189 = {&nonterm48, 5, &reduce_s45_1, -1};
+Rule rule190 = {&nonterm48, 4, &reduce_s45_2, -1};
+Rule rule191 = {&nonterm49, 3, &reduce_s46_0, -1};
+Rule rule192 = {&nonterm49, 5, &reduce_s46_1, -1};
+Rule rule193 = {&nonterm49, 4, &reduce_s46_2, -1};
+Rule rule194 = {&nonterm50, 3, &reduce_s47_0, -1};
+Rule rule195 = {&nonterm50, 5, &reduce_s47_1, -1};
+Rule rule196 = {&nonterm50, 4, &reduce_s47_2, -1};
+Rule rule197 = {&nonterm51, 3, &reduce_s48_0, -1};
+Rule rule198 = {&nonterm51, 5, &reduce_s48_1, -1};
+Rule rule199 = {&nonterm51, 4, &reduce_s48_2, -1};
+Rule rule200 = {&nonterm52, 3, &reduce_s49_0, -1};
+Rule rule201 = {&nonterm52, 5, &reduce_s49_1, -1};
+Rule rule202 = {&nonterm52, 4, &reduce_s49_2, -1};
+Rule rule203 = {&nonterm53, 1, &reduce_expr_0, -1};
+Rule rule204 = {&nonterm53, 3, &reduce_expr_1, -1};
+Rule rule205 = {&nonterm54, 1, &reduce_term_0, -1};
+Rule rule206 = {&nonterm54, 1, &reduce_term_1, -1};
+Rule rule207 = {&nonterm54, 3, &reduce_term_2, -1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+extern State state36;
+extern State state37;
+extern State state38;
+extern State state39;
+extern State state40;
+extern State state41;
+extern State state42;
+extern State state43;
+extern State state44;
+extern State state45;
+extern State state46;
+extern State state47;
+extern State state48;
+extern State state49;
+extern State state50;
+extern State state51;
+extern State state52;
+extern State state53;
+extern State state54;
+extern State state55;
+extern State state56;
+extern State state57;
+extern State state58;
+extern State state59;
+extern State state60;
+extern State state61;
+extern State state62;
+extern State state63;
+extern State state64;
+extern State state65;
+extern State state66;
+extern State state67;
+extern State state68;
+extern State state69;
+extern State state70;
+extern State state71;
+extern State state72;
+extern State state73;
+extern State state74;
+extern State state75;
+extern State state76;
+extern State state77;
+extern State state78;
+extern State state79;
+extern State state80;
+extern State state81;
+extern State state82;
+extern State state83;
+extern State state84;
+extern State state85;
+extern State state86;
+extern State state87;
+extern State state88;
+extern State state89;
+extern State state90;
+extern State state91;
+extern State state92;
+extern State state93;
+extern State state94;
+extern State state95;
+extern State state96;
+extern State state97;
+extern State state98;
+extern State state99;
+extern State state100;
+extern State state101;
+extern State state102;
+extern State state103;
+extern State state104;
+extern State state105;
+extern State state106;
+extern State state107;
+extern State state108;
+extern State state109;
+extern State state110;
+extern State state111;
+extern State state112;
+extern State state113;
+extern State state114;
+extern State state115;
+extern State state116;
+extern State state117;
+extern State state118;
+extern State state119;
+extern State state120;
+extern State state121;
+extern State state122;
+extern State state123;
+extern State state124;
+extern State state125;
+extern State state126;
+extern State state127;
+extern State state128;
+extern State state129;
+extern State state130;
+extern State state131;
+extern State state132;
+extern State state133;
+extern State state134;
+extern State state135;
+extern State state136;
+extern State state137;
+extern State state138;
+extern State state139;
+extern State state140;
+extern State state141;
+extern State state142;
+extern State state143;
+extern State state144;
+extern State state145;
+extern State state146;
+extern State state147;
+extern State state148;
+extern State state149;
+extern State state150;
+extern State state151;
+extern State state152;
+extern State state153;
+extern State state154;
+extern State state155;
+extern State state156;
+extern State state157;
+extern State state158;
+extern State state159;
+extern State state160;
+extern State state161;
+extern State state162;
+extern State state163;
+extern State state164;
+extern State state165;
+extern State state166;
+extern State state167;
+extern State state168;
+extern State state169;
+extern State state170;
+extern State state171;
+extern State state172;
+extern State state173;
+extern State state174;
+extern State state175;
+extern State state176;
+extern State state177;
+extern State state178;
+extern State state179;
+extern State state180;
+extern State state181;
+extern State state182;
+extern State state183;
+extern State state184;
+extern State state185;
+extern State state186;
+extern State state187;
+extern State state188;
+extern State state189;
+extern State state190;
+extern State state191;
+extern State state192;
+extern State state193;
+extern State state194;
+extern State state195;
+extern State state196;
+extern State state197;
+extern State state198;
+extern State state199;
+extern State state200;
+extern State state201;
+extern State state202;
+extern State state203;
+extern State state204;
+extern State state205;
+extern State state206;
+extern State state207;
+extern State state208;
+extern State state209;
+extern State state210;
+extern State state211;
+extern State state212;
+extern State state213;
+extern State state214;
+extern State state215;
+extern State state216;
+extern State state217;
+extern State state218;
+extern State state219;
+extern State state220;
+extern State state221;
+extern State state222;
+extern State state223;
+extern State state224;
+extern State state225;
+extern State state226;
+extern State state227;
+extern State state228;
+extern State state229;
+extern State state230;
+extern State state231;
+extern State state232;
+extern State state233;
+extern State state234;
+extern State state235;
+extern State state236;
+extern State state237;
+extern State state238;
+extern State state239;
+extern State state240;
+extern State state241;
+extern State state242;
+extern State state243;
+extern State state244;
+extern State state245;
+extern State state246;
+extern State state247;
+extern State state248;
+extern State state249;
+extern State state250;
+extern State state251;
+extern State state252;
+extern State state253;
+extern State state254;
+extern State state255;
+extern State state256;
+extern State state257;
+extern State state258;
+extern State state259;
+extern State state260;
+extern State state261;
+extern State state262;
+extern State state263;
+extern State state264;
+extern State state265;
+extern State state266;
+extern State state267;
+extern State state268;
+extern State state269;
+extern State state270;
+extern State state271;
+extern State state272;
+extern State state273;
+extern State state274;
+extern State state275;
+extern State state276;
+extern State state277;
+extern State state278;
+extern State state279;
+extern State state280;
+extern State state281;
+extern State state282;
+extern State state283;
+extern State state284;
+extern State state285;
+extern State state286;
+extern State state287;
+extern State state288;
+extern State state289;
+extern State state290;
+extern State state291;
+extern State state292;
+extern State state293;
+extern State state294;
+extern State state295;
+extern State state296;
+extern State state297;
+extern State state298;
+extern State state299;
+extern State state300;
+extern State state301;
+extern State state302;
+extern State state303;
+extern State state304;
+extern State state305;
+extern State state306;
+extern State state307;
+extern State state308;
+extern State state309;
+extern State state310;
+extern State state311;
+extern State state312;
+extern State state313;
+extern State state314;
+extern State state315;
+extern State state316;
+extern State state317;
+extern State state318;
+extern State state319;
+extern State state320;
+extern State state321;
+extern State state322;
+extern State state323;
+extern State state324;
+extern State state325;
+extern State state326;
+extern State state327;
+extern State state328;
+extern State state329;
+extern State state330;
+extern State state331;
+extern State state332;
+extern State state333;
+extern State state334;
+extern State state335;
+extern State state336;
+extern State state337;
+extern State state338;
+extern State state339;
+extern State state340;
+extern State state341;
+extern State state342;
+extern State state343;
+extern State state344;
+extern State state345;
+extern State state346;
+extern State state347;
+extern State state348;
+extern State state349;
+extern State state350;
+extern State state351;
+extern State state352;
+extern State state353;
+extern State state354;
+extern State state355;
+extern State state356;
+extern State state357;
+extern State state358;
+extern State state359;
+extern State state360;
+extern State state361;
+extern State state362;
+extern State state363;
+extern State state364;
+extern State state365;
+extern State state366;
+extern State state367;
+extern State state368;
+extern State state369;
+extern State state370;
+extern State state371;
+extern State state372;
+extern State state373;
+extern State state374;
+extern State state375;
+extern State state376;
+extern State state377;
+extern State state378;
+extern State state379;
+extern State state380;
+extern State state381;
+extern State state382;
+extern State state383;
+extern State state384;
+extern State state385;
+extern State state386;
+extern State state387;
+extern State state388;
+extern State state389;
+extern State state390;
+extern State state391;
+extern State state392;
+extern State state393;
+extern State state394;
+extern State state395;
+extern State state396;
+extern State state397;
+extern State state398;
+extern State state399;
+extern State state400;
+extern State state401;
+extern State state402;
+extern State state403;
+extern State state404;
+extern State state405;
+extern State state406;
+extern State state407;
+extern State state408;
+extern State state409;
+extern State state410;
+extern State state411;
+extern State state412;
+extern State state413;
+extern State state414;
+extern State state415;
+extern State state416;
+extern State state417;
+extern State state418;
+extern State state419;
+extern State state420;
+extern State state421;
+extern State state422;
+extern State state423;
+extern State state424;
+extern State state425;
+extern State state426;
+extern State state427;
+extern State state428;
+extern State state429;
+extern State state430;
+extern State state431;
+extern State state432;
+extern State state433;
+extern State state434;
+extern State state435;
+extern State state436;
+extern State state437;
+extern State state438;
+extern State state439;
+extern State state440;
+extern State state441;
+extern State state442;
+extern State state443;
+extern State state444;
+extern State state445;
+extern State state446;
+extern State state447;
+extern State state448;
+extern State state449;
+extern State state450;
+extern State state451;
+extern State state452;
+extern State state453;
+extern State state454;
+extern State state455;
+extern State state456;
+extern State state457;
+extern State state458;
+extern State state459;
+extern State state460;
+extern State state461;
+extern State state462;
+extern State state463;
+extern State state464;
+extern State state465;
+extern State state466;
+extern State state467;
+extern State state468;
+extern State state469;
+extern State state470;
+extern State state471;
+extern State state472;
+extern State state473;
+extern State state474;
+extern State state475;
+extern State state476;
+extern State state477;
+extern State state478;
+extern State state479;
+extern State state480;
+extern State state481;
+extern State state482;
+extern State state483;
+extern State state484;
+extern State state485;
+extern State state486;
+extern State state487;
+extern State state488;
+extern State state489;
+extern State state490;
+extern State state491;
+extern State state492;
+extern State state493;
+extern State state494;
+extern State state495;
+extern State state496;
+extern State state497;
+extern State state498;
+extern State state499;
+extern State state500;
+extern State state501;
+extern State state502;
+extern State state503;
+extern State state504;
+extern State state505;
+extern State state506;
+extern State state507;
+extern State state508;
+extern State state509;
+extern State state510;
+extern State state511;
+extern State state512;
+extern State state513;
+extern State state514;
+extern State state515;
+extern State state516;
+extern State state517;
+extern State state518;
+extern State state519;
+extern State state520;
+extern State state521;
+extern State state522;
+extern State state523;
+extern State state524;
+extern State state525;
+extern State state526;
+extern State state527;
+extern State state528;
+extern State state529;
+extern State state530;
+extern State state531;
+extern State state532;
+extern State state533;
+extern State state534;
+extern State state535;
+extern State state536;
+extern State state537;
+extern State state538;
+extern State state539;
+extern State state540;
+extern State state541;
+extern State state542;
+extern State state543;
+extern State state544;
+extern State state545;
+extern State state546;
+extern State state547;
+extern State state548;
+extern State state549;
+extern State state550;
+extern State state551;
+extern State state552;
+extern State state553;
+extern State state554;
+extern State state555;
+extern State state556;
+extern State state557;
+extern State state558;
+extern State state559;
+extern State state560;
+extern State state561;
+extern State state562;
+extern State state563;
+extern State state564;
+extern State state565;
+extern State state566;
+extern State state567;
+extern State state568;
+extern State state569;
+extern State state570;
+extern State state571;
+extern State state572;
+extern State state573;
+extern State state574;
+extern State state575;
+extern State state576;
+extern State state577;
+extern State state578;
+extern State state579;
+extern State state580;
+extern State state581;
+extern State state582;
+extern State state583;
+extern State state584;
+extern State state585;
+extern State state586;
+extern State state587;
+extern State state588;
+extern State state589;
+extern State state590;
+extern State state591;
+extern State state592;
+extern State state593;
+extern State state594;
+extern State state595;
+extern State state596;
+extern State state597;
+extern State state598;
+extern State state599;
+extern State state600;
+extern State state601;
+extern State state602;
+extern State state603;
+extern State state604;
+extern State state605;
+extern State state606;
+extern State state607;
+extern State state608;
+extern State state609;
+extern State state610;
+extern State state611;
+extern State state612;
+extern State state613;
+extern State state614;
+extern State state615;
+extern State state616;
+extern State state617;
+extern State state618;
+extern State state619;
+extern State state620;
+extern State state621;
+extern State state622;
+extern State state623;
+extern State state624;
+extern State state625;
+extern State state626;
+extern State state627;
+extern State state628;
+extern State state629;
+extern State state630;
+extern State state631;
+extern State state632;
+extern State state633;
+extern State state634;
+extern State state635;
+extern State state636;
+extern State state637;
+extern State state638;
+extern State state639;
+extern State state640;
+extern State state641;
+extern State state642;
+extern State state643;
+extern State state644;
+extern State state645;
+extern State state646;
+extern State state647;
+extern State state648;
+extern State state649;
+extern State state650;
+extern State state651;
+extern State state652;
+extern State state653;
+extern State state654;
+extern State state655;
+extern State state656;
+extern State state657;
+extern State state658;
+extern State state659;
+extern State state660;
+extern State state661;
+extern State state662;
+extern State state663;
+extern State state664;
+extern State state665;
+extern State state666;
+extern State state667;
+extern State state668;
+extern State state669;
+extern State state670;
+extern State state671;
+extern State state672;
+extern State state673;
+extern State state674;
+extern State state675;
+extern State state676;
+extern State state677;
+extern State state678;
+extern State state679;
+extern State state680;
+extern State state681;
+extern State state682;
+extern State state683;
+extern State state684;
+extern State state685;
+extern State state686;
+extern State state687;
+extern State state688;
+extern State state689;
+extern State state690;
+extern State state691;
+extern State state692;
+extern State state693;
+extern State state694;
+extern State state695;
+extern State state696;
+extern State state697;
+extern State state698;
+extern State state699;
+extern State state700;
+extern State state701;
+extern State state702;
+extern State state703;
+extern State state704;
+extern State state705;
+extern State state706;
+extern State state707;
+extern State state708;
+extern State state709;
+extern State state710;
+extern State state711;
+extern State state712;
+extern State state713;
+extern State state714;
+extern State state715;
+extern State state716;
+extern State state717;
+extern State state718;
+extern State state719;
+extern State state720;
+extern State state721;
+extern State state722;
+extern State state723;
+extern State state724;
+extern State state725;
+extern State state726;
+extern State state727;
+extern State state728;
+extern State state729;
+extern State state730;
+extern State state731;
+extern State state732;
+extern State state733;
+extern State state734;
+extern State state735;
+extern State state736;
+extern State state737;
+extern State state738;
+extern State state739;
+extern State state740;
+extern State state741;
+extern State state742;
+extern State state743;
+extern State state744;
+extern State state745;
+extern State state746;
+extern State state747;
+extern State state748;
+extern State state749;
+extern State state750;
+extern State state751;
+extern State state752;
+extern State state753;
+extern State state754;
+extern State state755;
+extern State state756;
+extern State state757;
+extern State state758;
+extern State state759;
+extern State state760;
+extern State state761;
+extern State state762;
+extern State state763;
+extern State state764;
+extern State state765;
+extern State state766;
+extern State state767;
+extern State state768;
+extern State state769;
+extern State state770;
+extern State state771;
+extern State state772;
+extern State state773;
+extern State state774;
+extern State state775;
+extern State state776;
+extern State state777;
+extern State state778;
+extern State state779;
+extern State state780;
+extern State state781;
+extern State state782;
+extern State state783;
+extern State state784;
+extern State state785;
+extern State state786;
+extern State state787;
+extern State state788;
+extern State state789;
+extern State state790;
+extern State state791;
+extern State state792;
+extern State state793;
+extern State state794;
+extern State state795;
+extern State state796;
+extern State state797;
+extern State state798;
+extern State state799;
+extern State state800;
+extern State state801;
+extern State state802;
+extern State state803;
+extern State state804;
+extern State state805;
+extern State state806;
+extern State state807;
+extern State state808;
+extern State state809;
+extern State state810;
+extern State state811;
+extern State state812;
+extern State state813;
+extern State state814;
+extern State state815;
+extern State state816;
+extern State state817;
+extern State state818;
+extern State state819;
+extern State state820;
+extern State state821;
+extern State state822;
+extern State state823;
+extern State state824;
+extern State state825;
+extern State state826;
+extern State state827;
+extern State state828;
+extern State state829;
+extern State state830;
+extern State state831;
+extern State state832;
+extern State state833;
+extern State state834;
+extern State state835;
+extern State state836;
+extern State state837;
+extern State state838;
+extern State state839;
+extern State state840;
+extern State state841;
+extern State state842;
+extern State state843;
+extern State state844;
+extern State state845;
+extern State state846;
+extern State state847;
+extern State state848;
+extern State state849;
+extern State state850;
+extern State state851;
+extern State state852;
+extern State state853;
+extern State state854;
+extern State state855;
+extern State state856;
+extern State state857;
+extern State state858;
+extern State state859;
+extern State state860;
+extern State state861;
+extern State state862;
+extern State state863;
+extern State state864;
+extern State state865;
+extern State state866;
+extern State state867;
+extern State state868;
+extern State state869;
+extern State state870;
+extern State state871;
+extern State state872;
+extern State state873;
+extern State state874;
+extern State state875;
+extern State state876;
+extern State state877;
+extern State state878;
+extern State state879;
+extern State state880;
+extern State state881;
+extern State state882;
+extern State state883;
+extern State state884;
+extern State state885;
+extern State state886;
+extern State state887;
+extern State state888;
+extern State state889;
+extern State state890;
+extern State state891;
+extern State state892;
+extern State state893;
+extern State state894;
+extern State state895;
+extern State state896;
+extern State state897;
+extern State state898;
+extern State state899;
+extern State state900;
+extern State state901;
+extern State state902;
+extern State state903;
+extern State state904;
+extern State state905;
+extern State state906;
+extern State state907;
+extern State state908;
+extern State state909;
+extern State state910;
+extern State state911;
+extern State state912;
+extern State state913;
+extern State state914;
+extern State state915;
+extern State state916;
+extern State state917;
+extern State state918;
+extern State state919;
+extern State state920;
+extern State state921;
+extern State state922;
+extern State state923;
+extern State state924;
+extern State state925;
+extern State state926;
+extern State state927;
+extern State state928;
+extern State state929;
+extern State state930;
+extern State state931;
+extern State state932;
+extern State state933;
+extern State state934;
+extern State state935;
+extern State state936;
+extern State state937;
+extern State state938;
+extern State state939;
+extern State state940;
+extern State state941;
+extern State state942;
+extern State state943;
+extern State state944;
+extern State state945;
+extern State state946;
+extern State state947;
+extern State state948;
+extern State state949;
+extern State state950;
+extern State state951;
+extern State state952;
+extern State state953;
+extern State state954;
+extern State state955;
+extern State state956;
+extern State state957;
+extern State state958;
+extern State state959;
+extern State state960;
+extern State state961;
+extern State state962;
+extern State state963;
+extern State state964;
+extern State state965;
+extern State state966;
+extern State state967;
+extern State state968;
+extern State state969;
+extern State state970;
+extern State state971;
+extern State state972;
+extern State state973;
+extern State state974;
+extern State state975;
+extern State state976;
+extern State state977;
+extern State state978;
+extern State state979;
+extern State state980;
+extern State state981;
+extern State state982;
+extern State state983;
+extern State state984;
+extern State state985;
+extern State state986;
+extern State state987;
+extern State state988;
+extern State state989;
+extern State state990;
+extern State state991;
+extern State state992;
+extern State state993;
+extern State state994;
+extern State state995;
+extern State state996;
+extern State state997;
+extern State state998;
+extern State state999;
+extern State state1000;
+extern State state1001;
+extern State state1002;
+extern State state1003;
+extern State state1004;
+extern State state1005;
+extern State state1006;
+extern State state1007;
+extern State state1008;
+extern State state1009;
+extern State state1010;
+extern State state1011;
+extern State state1012;
+extern State state1013;
+extern State state1014;
+extern State state1015;
+extern State state1016;
+extern State state1017;
+extern State state1018;
+extern State state1019;
+extern State state1020;
+extern State state1021;
+extern State state1022;
+extern State state1023;
+extern State state1024;
+extern State state1025;
+extern State state1026;
+extern State state1027;
+extern State state1028;
+extern State state1029;
+extern State state1030;
+extern State state1031;
+extern State state1032;
+extern State state1033;
+extern State state1034;
+extern State state1035;
+extern State state1036;
+extern State state1037;
+extern State state1038;
+extern State state1039;
+extern State state1040;
+extern State state1041;
+extern State state1042;
+extern State state1043;
+extern State state1044;
+extern State state1045;
+extern State state1046;
+extern State state1047;
+extern State state1048;
+extern State state1049;
+extern State state1050;
+extern State state1051;
+extern State state1052;
+extern State state1053;
+extern State state1054;
+extern State state1055;
+extern State state1056;
+extern State state1057;
+extern State state1058;
+extern State state1059;
+extern State state1060;
+extern State state1061;
+extern State state1062;
+extern State state1063;
+extern State state1064;
+extern State state1065;
+extern State state1066;
+extern State state1067;
+extern State state1068;
+extern State state1069;
+extern State state1070;
+extern State state1071;
+extern State state1072;
+extern State state1073;
+extern State state1074;
+extern State state1075;
+extern State state1076;
+extern State state1077;
+extern State state1078;
+extern State state1079;
+extern State state1080;
+extern State state1081;
+extern State state1082;
+extern State state1083;
+extern State state1084;
+extern State state1085;
+extern State state1086;
+extern State state1087;
+extern State state1088;
+extern State state1089;
+extern State state1090;
+extern State state1091;
+extern State state1092;
+extern State state1093;
+extern State state1094;
+extern State state1095;
+extern State state1096;
+extern State state1097;
+extern State state1098;
+extern State state1099;
+extern State state1100;
+extern State state1101;
+extern State state1102;
+extern State state1103;
+extern State state1104;
+extern State state1105;
+extern State state1106;
+extern State state1107;
+extern State state1108;
+extern State state1109;
+extern State state1110;
+extern State state1111;
+extern State state1112;
+extern State state1113;
+extern State state1114;
+extern State state1115;
+extern State state1116;
+extern State state1117;
+extern State state1118;
+extern State state1119;
+
+std::vector<Shift> shift0 = {};
+std::vector<Reduce> reduce0 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift1 = {{&term0, &state2}, {&term1, &state3}, {&term2, &state4}, {&term3, &state5}, {&term4, &state6}, {&term5, &state7}, {&term6, &state8}, {&term7, &state9}, {&term8, &state10}, {&term9, &state11}, {&term10, &state12}, {&term11, &state13}, {&term12, &state14}, {&term13, &state15}, {&term14, &state16}, {&term15, &state17}, {&term16, &state18}, {&term17, &state19}, {&term18, &state20}, {&term19, &state21}, {&term20, &state22}, {&term21, &state23}, {&term22, &state24}, {&term23, &state25}, {&term24, &state26}, {&term25, &state27}, {&term26, &state28}, {&term27, &state29}, {&term28, &state30}, {&term29, &state31}, {&term30, &state32}, {&term31, &state33}, {&term32, &state34}, {&term33, &state35}, {&term34, &state36}, {&term35, &state37}, {&term36, &state38}, {&term37, &state39}, {&term38, &state40}, {&term39, &state41}, {&term40, &state42}, {&term41, &state43}, {&term42, &state44}, {&term43, &state45}, {&term44, &state46}, {&term45, &state47}, {&term46, &state48}, {&term47, &state49}, {&term48, &state50}, {&term49, &state51}};
+std::vector<Reduce> reduce1 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift2 = {{&term50, &state103}, {&term52, &state1111}, {&term55, &state1112}, {&term58, &state106}};
+std::vector<Reduce> reduce2 = {};
+std::vector<Shift> shift3 = {{&term50, &state103}, {&term52, &state1102}, {&term55, &state1103}, {&term58, &state106}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {{&term50, &state103}, {&term52, &state1093}, {&term55, &state1094}, {&term58, &state106}};
+std::vector<Reduce> reduce4 = {};
+std::vector<Shift> shift5 = {{&term50, &state103}, {&term52, &state1084}, {&term55, &state1085}, {&term58, &state106}};
+std::vector<Reduce> reduce5 = {};
+std::vector<Shift> shift6 = {{&term50, &state103}, {&term52, &state1075}, {&term55, &state1076}, {&term58, &state106}};
+std::vector<Reduce> reduce6 = {};
+std::vector<Shift> shift7 = {{&term50, &state103}, {&term52, &state1066}, {&term55, &state1067}, {&term58, &state106}};
+std::vector<Reduce> reduce7 = {};
+std::vector<Shift> shift8 = {{&term50, &state103}, {&term52, &state1057}, {&term55, &state1058}, {&term58, &state106}};
+std::vector<Reduce> reduce8 = {};
+std::vector<Shift> shift9 = {{&term50, &state103}, {&term52, &state1048}, {&term55, &state1049}, {&term58, &state106}};
+std::vector<Reduce> reduce9 = {};
+std::vector<Shift> shift10 = {{&term50, &state103}, {&term52, &state1039}, {&term55, &state1040}, {&term58, &state106}};
+std::vector<Reduce> reduce10 = {};
+std::vector<Shift> shift11 = {{&term50, &state103}, {&term52, &state1030}, {&term55, &state1031}, {&term58, &state106}};
+std::vector<Reduce> reduce11 = {};
+std::vector<Shift> shift12 = {{&term50, &state103}, {&term52, &state1021}, {&term55, &state1022}, {&term58, &state106}};
+std::vector<Reduce> reduce12 = {};
+std::vector<Shift> shift13 = {{&term50, &state103}, {&term52, &state1012}, {&term55, &state1013}, {&term58, &state106}};
+std::vector<Reduce> reduce13 = {};
+std::vector<Shift> shift14 = {{&term50, &state103}, {&term52, &state1003}, {&term55, &state1004}, {&term58, &state106}};
+std::vector<Reduce> reduce14 = {};
+std::vector<Shift> shift15 = {{&term50, &state103}, {&term52, &state994}, {&term55, &state995}, {&term58, &state106}};
+std::vector<Reduce> reduce15 = {};
+std::vector<Shift> shift16 = {{&term50, &state103}, {&term52, &state985}, {&term55, &state986}, {&term58, &state106}};
+std::vector<Reduce> reduce16 = {};
+std::vector<Shift> shift17 = {{&term50, &state103}, {&term52, &state976}, {&term55, &state977}, {&term58, &state106}};
+std::vector<Reduce> reduce17 = {};
+std::vector<Shift> shift18 = {{&term50, &state103}, {&term52, &state967}, {&term55, &state968}, {&term58, &state106}};
+std::vector<Reduce> reduce18 = {};
+std::vector<Shift> shift19 = {{&term50, &state103}, {&term52, &state958}, {&term55, &state959}, {&term58, &state106}};
+std::vector<Reduce> reduce19 = {};
+std::vector<Shift> shift20 = {{&term50, &state103}, {&term52, &state949}, {&term55, &state950}, {&term58, &state106}};
+std::vector<Reduce> reduce20 = {};
+std::vector<Shift> shift21 = {{&term50, &state103}, {&term52, &state940}, {&term55, &state941}, {&term58, &state106}};
+std::vector<Reduce> reduce21 = {};
+std::vector<Shift> shift22 = {{&term50, &state103}, {&term52, &state931}, {&term55, &state932}, {&term58, &state106}};
+std::vector<Reduce> reduce22 = {};
+std::vector<Shift> shift23 = {{&term50, &state103}, {&term52, &state922}, {&term55, &state923}, {&term58, &state106}};
+std::vector<Reduce> reduce23 = {};
+std::vector<Shift> shift24 = {{&term50, &state103}, {&term52, &state913}, {&term55, &state914}, {&term58, &state106}};
+std::vector<Reduce> reduce24 = {};
+std::vector<Shift> shift25 = {{&term50, &state103}, {&term52, &state904}, {&term55, &state905}, {&term58, &state106}};
+std::vector<Reduce> reduce25 = {};
+std::vector<Shift> shift26 = {{&term50, &state103}, {&term52, &state895}, {&term55, &state896}, {&term58, &state106}};
+std::vector<Reduce> reduce26 = {};
+std::vector<Shift> shift27 = {{&term50, &state103}, {&term52, &state886}, {&term55, &state887}, {&term58, &state106}};
+std::vector<Reduce> reduce27 = {};
+std::vector<Shift> shift28 = {{&term50, &state103}, {&term52, &state877}, {&term55, &state878}, {&term58, &state106}};
+std::vector<Reduce> reduce28 = {};
+std::vector<Shift> shift29 = {{&term50, &state103}, {&term52, &state868}, {&term55, &state869}, {&term58, &state106}};
+std::vector<Reduce> reduce29 = {};
+std::vector<Shift> shift30 = {{&term50, &state103}, {&term52, &state859}, {&term55, &state860}, {&term58, &state106}};
+std::vector<Reduce> reduce30 = {};
+std::vector<Shift> shift31 = {{&term50, &state103}, {&term52, &state850}, {&term55, &state851}, {&term58, &state106}};
+std::vector<Reduce> reduce31 = {};
+std::vector<Shift> shift32 = {{&term50, &state103}, {&term52, &state841}, {&term55, &state842}, {&term58, &state106}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift33 = {{&term50, &state103}, {&term52, &state832}, {&term55, &state833}, {&term58, &state106}};
+std::vector<Reduce> reduce33 = {};
+std::vector<Shift> shift34 = {{&term50, &state103}, {&term52, &state823}, {&term55, &state824}, {&term58, &state106}};
+std::vector<Reduce> reduce34 = {};
+std::vector<Shift> shift35 = {{&term50, &state103}, {&term52, &state814}, {&term55, &state815}, {&term58, &state106}};
+std::vector<Reduce> reduce35 = {};
+std::vector<Shift> shift36 = {{&term50, &state103}, {&term52, &state805}, {&term55, &state806}, {&term58, &state106}};
+std::vector<Reduce> reduce36 = {};
+std::vector<Shift> shift37 = {{&term50, &state103}, {&term52, &state796}, {&term55, &state797}, {&term58, &state106}};
+std::vector<Reduce> reduce37 = {};
+std::vector<Shift> shift38 = {{&term50, &state103}, {&term52, &state787}, {&term55, &state788}, {&term58, &state106}};
+std::vector<Reduce> reduce38 = {};
+std::vector<Shift> shift39 = {{&term50, &state103}, {&term52, &state778}, {&term55, &state779}, {&term58, &state106}};
+std::vector<Reduce> reduce39 = {};
+std::vector<Shift> shift40 = {{&term50, &state103}, {&term52, &state769}, {&term55, &state770}, {&term58, &state106}};
+std::vector<Reduce> reduce40 = {};
+std::vector<Shift> shift41 = {{&term50, &state103}, {&term52, &state760}, {&term55, &state761}, {&term58, &state106}};
+std::vector<Reduce> reduce41 = {};
+std::vector<Shift> shift42 = {{&term50, &state103}, {&term52, &state751}, {&term55, &state752}, {&term58, &state106}};
+std::vector<Reduce> reduce42 = {};
+std::vector<Shift> shift43 = {{&term50, &state103}, {&term52, &state742}, {&term55, &state743}, {&term58, &state106}};
+std::vector<Reduce> reduce43 = {};
+std::vector<Shift> shift44 = {{&term50, &state103}, {&term52, &state733}, {&term55, &state734}, {&term58, &state106}};
+std::vector<Reduce> reduce44 = {};
+std::vector<Shift> shift45 = {{&term50, &state103}, {&term52, &state724}, {&term55, &state725}, {&term58, &state106}};
+std::vector<Reduce> reduce45 = {};
+std::vector<Shift> shift46 = {{&term50, &state103}, {&term52, &state715}, {&term55, &state716}, {&term58, &state106}};
+std::vector<Reduce> reduce46 = {};
+std::vector<Shift> shift47 = {{&term50, &state103}, {&term52, &state706}, {&term55, &state707}, {&term58, &state106}};
+std::vector<Reduce> reduce47 = {};
+std::vector<Shift> shift48 = {{&term50, &state103}, {&term52, &state697}, {&term55, &state698}, {&term58, &state106}};
+std::vector<Reduce> reduce48 = {};
+std::vector<Shift> shift49 = {{&term50, &state103}, {&term52, &state688}, {&term55, &state689}, {&term58, &state106}};
+std::vector<Reduce> reduce49 = {};
+std::vector<Shift> shift50 = {{&term50, &state103}, {&term52, &state679}, {&term55, &state680}, {&term58, &state106}};
+std::vector<Reduce> reduce50 = {};
+std::vector<Shift> shift51 = {{&term50, &state103}, {&term52, &state104}, {&term55, &state105}, {&term58, &state106}};
+std::vector<Reduce> reduce51 = {};
+std::vector<Shift> shift52 = {};
+std::vector<Reduce> reduce52 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift53 = {};
+std::vector<Reduce> reduce53 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift54 = {};
+std::vector<Reduce> reduce54 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift55 = {};
+std::vector<Reduce> reduce55 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift56 = {};
+std::vector<Reduce> reduce56 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift57 = {};
+std::vector<Reduce> reduce57 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift58 = {};
+std::vector<Reduce> reduce58 = {{nullptr, &rule8, false}};
+std::vector<Shift> shift59 = {};
+std::vector<Reduce> reduce59 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift60 = {};
+std::vector<Reduce> reduce60 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift61 = {};
+std::vector<Reduce> reduce61 = {{nullptr, &rule11, false}};
+std::vector<Shift> shift62 = {};
+std::vector<Reduce> reduce62 = {{nullptr, &rule12, false}};
+std::vector<Shift> shift63 = {};
+std::vector<Reduce> reduce63 = {{nullptr, &rule13, false}};
+std::vector<Shift> shift64 = {};
+std::vector<Reduce> reduce64 = {{nullptr, &rule14, false}};
+std::vector<Shift> shift65 = {};
+std::vector<Reduce> reduce65 = {{nullptr, &rule15, false}};
+std::vector<Shift> shift66 = {};
+std::vector<Reduce> reduce66 = {{nullptr, &rule16, false}};
+std::vector<Shift> shift67 = {};
+std::vector<Reduce> reduce67 = {{nullptr, &rule17, false}};
+std::vector<Shift> shift68 = {};
+std::vector<Reduce> reduce68 = {{nullptr, &rule18, false}};
+std::vector<Shift> shift69 = {};
+std::vector<Reduce> reduce69 = {{nullptr, &rule19, false}};
+std::vector<Shift> shift70 = {};
+std::vector<Reduce> reduce70 = {{nullptr, &rule20, false}};
+std::vector<Shift> shift71 = {};
+std::vector<Reduce> reduce71 = {{nullptr, &rule21, false}};
+std::vector<Shift> shift72 = {};
+std::vector<Reduce> reduce72 = {{nullptr, &rule22, false}};
+std::vector<Shift> shift73 = {};
+std::vector<Reduce> reduce73 = {{nullptr, &rule23, false}};
+std::vector<Shift> shift74 = {};
+std::vector<Reduce> reduce74 = {{nullptr, &rule24, false}};
+std::vector<Shift> shift75 = {};
+std::vector<Reduce> reduce75 = {{nullptr, &rule25, false}};
+std::vector<Shift> shift76 = {};
+std::vector<Reduce> reduce76 = {{nullptr, &rule26, false}};
+std::vector<Shift> shift77 = {};
+std::vector<Reduce> reduce77 = {{nullptr, &rule27, false}};
+std::vector<Shift> shift78 = {};
+std::vector<Reduce> reduce78 = {{nullptr, &rule28, false}};
+std::vector<Shift> shift79 = {};
+std::vector<Reduce> reduce79 = {{nullptr, &rule29, false}};
+std::vector<Shift> shift80 = {};
+std::vector<Reduce> reduce80 = {{nullptr, &rule30, false}};
+std::vector<Shift> shift81 = {};
+std::vector<Reduce> reduce81 = {{nullptr, &rule31, false}};
+std::vector<Shift> shift82 = {};
+std::vector<Reduce> reduce82 = {{nullptr, &rule32, false}};
+std::vector<Shift> shift83 = {};
+std::vector<Reduce> reduce83 = {{nullptr, &rule33, false}};
+std::vector<Shift> shift84 = {};
+std::vector<Reduce> reduce84 = {{nullptr, &rule34, false}};
+std::vector<Shift> shift85 = {};
+std::vector<Reduce> reduce85 = {{nullptr, &rule35, false}};
+std::vector<Shift> shift86 = {};
+std::vector<Reduce> reduce86 = {{nullptr, &rule36, false}};
+std::vector<Shift> shift87 = {};
+std::vector<Reduce> reduce87 = {{nullptr, &rule37, false}};
+std::vector<Shift> shift88 = {};
+std::vector<Reduce> reduce88 = {{nullptr, &rule38, false}};
+std::vector<Shift> shift89 = {};
+std::vector<Reduce> reduce89 = {{nullptr, &rule39, false}};
+std::vector<Shift> shift90 = {};
+std::vector<Reduce> reduce90 = {{nullptr, &rule40, false}};
+std::vector<Shift> shift91 = {};
+std::vector<Reduce> reduce91 = {{nullptr, &rule41, false}};
+std::vector<Shift> shift92 = {};
+std::vector<Reduce> reduce92 = {{nullptr, &rule42, false}};
+std::vector<Shift> shift93 = {};
+std::vector<Reduce> reduce93 = {{nullptr, &rule43, false}};
+std::vector<Shift> shift94 = {};
+std::vector<Reduce> reduce94 = {{nullptr, &rule44, false}};
+std::vector<Shift> shift95 = {};
+std::vector<Reduce> reduce95 = {{nullptr, &rule45, false}};
+std::vector<Shift> shift96 = {};
+std::vector<Reduce> reduce96 = {{nullptr, &rule46, false}};
+std::vector<Shift> shift97 = {};
+std::vector<Reduce> reduce97 = {{nullptr, &rule47, false}};
+std::vector<Shift> shift98 = {};
+std::vector<Reduce> reduce98 = {{nullptr, &rule48, false}};
+std::vector<Shift> shift99 = {};
+std::vector<Reduce> reduce99 = {{nullptr, &rule49, false}};
+std::vector<Shift> shift100 = {};
+std::vector<Reduce> reduce100 = {{nullptr, &rule50, false}};
+std::vector<Shift> shift101 = {};
+std::vector<Reduce> reduce101 = {{nullptr, &rule51, false}};
+std::vector<Shift> shift102 = {};
+std::vector<Reduce> reduce102 = {{nullptr, &rule52, false}};
+std::vector<Shift> shift103 = {};
+std::vector<Reduce> reduce103 = {{nullptr, &rule205, false}};
+std::vector<Shift> shift104 = {{&term54, &state676}};
+std::vector<Reduce> reduce104 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift106 = {{&term50, &state113}, {&term52, &state114}, {&term58, &state115}};
+std::vector<Reduce> reduce106 = {};
+std::vector<Shift> shift107 = {{&term53, &state109}, {&term57, &state110}};
+std::vector<Reduce> reduce107 = {};
+std::vector<Shift> shift108 = {};
+std::vector<Reduce> reduce108 = {{nullptr, &rule203, false}};
+std::vector<Shift> shift109 = {};
+std::vector<Reduce> reduce109 = {{nullptr, &rule200, false}};
+std::vector<Shift> shift110 = {{&term50, &state103}, {&term52, &state111}, {&term58, &state106}};
+std::vector<Reduce> reduce110 = {};
+std::vector<Shift> shift111 = {};
+std::vector<Reduce> reduce111 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift112 = {};
+std::vector<Reduce> reduce112 = {{nullptr, &rule204, false}};
+std::vector<Shift> shift116 = {{&term57, &state118}, {&term59, &state119}};
+std::vector<Reduce> reduce116 = {};
+std::vector<Shift> shift119 = {};
+std::vector<Reduce> reduce119 = {{nullptr, &rule207, false}};
+std::vector<Shift> shift121 = {{&term57, &state118}, {&term59, &state122}};
+std::vector<Reduce> reduce121 = {};
+std::vector<Shift> shift123 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state174}};
+std::vector<Reduce> reduce123 = {};
+std::vector<Shift> shift124 = {{&term50, &state103}, {&term52, &state667}, {&term55, &state668}, {&term58, &state106}};
+std::vector<Reduce> reduce124 = {};
+std::vector<Shift> shift125 = {{&term50, &state103}, {&term52, &state658}, {&term55, &state659}, {&term58, &state106}};
+std::vector<Reduce> reduce125 = {};
+std::vector<Shift> shift126 = {{&term50, &state103}, {&term52, &state649}, {&term55, &state650}, {&term58, &state106}};
+std::vector<Reduce> reduce126 = {};
+std::vector<Shift> shift127 = {{&term50, &state103}, {&term52, &state640}, {&term55, &state641}, {&term58, &state106}};
+std::vector<Reduce> reduce127 = {};
+std::vector<Shift> shift128 = {{&term50, &state103}, {&term52, &state631}, {&term55, &state632}, {&term58, &state106}};
+std::vector<Reduce> reduce128 = {};
+std::vector<Shift> shift129 = {{&term50, &state103}, {&term52, &state622}, {&term55, &state623}, {&term58, &state106}};
+std::vector<Reduce> reduce129 = {};
+std::vector<Shift> shift130 = {{&term50, &state103}, {&term52, &state613}, {&term55, &state614}, {&term58, &state106}};
+std::vector<Reduce> reduce130 = {};
+std::vector<Shift> shift131 = {{&term50, &state103}, {&term52, &state604}, {&term55, &state605}, {&term58, &state106}};
+std::vector<Reduce> reduce131 = {};
+std::vector<Shift> shift132 = {{&term50, &state103}, {&term52, &state595}, {&term55, &state596}, {&term58, &state106}};
+std::vector<Reduce> reduce132 = {};
+std::vector<Shift> shift133 = {{&term50, &state103}, {&term52, &state586}, {&term55, &state587}, {&term58, &state106}};
+std::vector<Reduce> reduce133 = {};
+std::vector<Shift> shift134 = {{&term50, &state103}, {&term52, &state577}, {&term55, &state578}, {&term58, &state106}};
+std::vector<Reduce> reduce134 = {};
+std::vector<Shift> shift135 = {{&term50, &state103}, {&term52, &state568}, {&term55, &state569}, {&term58, &state106}};
+std::vector<Reduce> reduce135 = {};
+std::vector<Shift> shift136 = {{&term50, &state103}, {&term52, &state559}, {&term55, &state560}, {&term58, &state106}};
+std::vector<Reduce> reduce136 = {};
+std::vector<Shift> shift137 = {{&term50, &state103}, {&term52, &state550}, {&term55, &state551}, {&term58, &state106}};
+std::vector<Reduce> reduce137 = {};
+std::vector<Shift> shift138 = {{&term50, &state103}, {&term52, &state541}, {&term55, &state542}, {&term58, &state106}};
+std::vector<Reduce> reduce138 = {};
+std::vector<Shift> shift139 = {{&term50, &state103}, {&term52, &state532}, {&term55, &state533}, {&term58, &state106}};
+std::vector<Reduce> reduce139 = {};
+std::vector<Shift> shift140 = {{&term50, &state103}, {&term52, &state523}, {&term55, &state524}, {&term58, &state106}};
+std::vector<Reduce> reduce140 = {};
+std::vector<Shift> shift141 = {{&term50, &state103}, {&term52, &state514}, {&term55, &state515}, {&term58, &state106}};
+std::vector<Reduce> reduce141 = {};
+std::vector<Shift> shift142 = {{&term50, &state103}, {&term52, &state505}, {&term55, &state506}, {&term58, &state106}};
+std::vector<Reduce> reduce142 = {};
+std::vector<Shift> shift143 = {{&term50, &state103}, {&term52, &state496}, {&term55, &state497}, {&term58, &state106}};
+std::vector<Reduce> reduce143 = {};
+std::vector<Shift> shift144 = {{&term50, &state103}, {&term52, &state487}, {&term55, &state488}, {&term58, &state106}};
+std::vector<Reduce> reduce144 = {};
+std::vector<Shift> shift145 = {{&term50, &state103}, {&term52, &state478}, {&term55, &state479}, {&term58, &state106}};
+std::vector<Reduce> reduce145 = {};
+std::vector<Shift> shift146 = {{&term50, &state103}, {&term52, &state469}, {&term55, &state470}, {&term58, &state106}};
+std::vector<Reduce> reduce146 = {};
+std::vector<Shift> shift147 = {{&term50, &state103}, {&term52, &state460}, {&term55, &state461}, {&term58, &state106}};
+std::vector<Reduce> reduce147 = {};
+std::vector<Shift> shift148 = {{&term50, &state103}, {&term52, &state451}, {&term55, &state452}, {&term58, &state106}};
+std::vector<Reduce> reduce148 = {};
+std::vector<Shift> shift149 = {{&term50, &state103}, {&term52, &state442}, {&term55, &state443}, {&term58, &state106}};
+std::vector<Reduce> reduce149 = {};
+std::vector<Shift> shift150 = {{&term50, &state103}, {&term52, &state433}, {&term55, &state434}, {&term58, &state106}};
+std::vector<Reduce> reduce150 = {};
+std::vector<Shift> shift151 = {{&term50, &state103}, {&term52, &state424}, {&term55, &state425}, {&term58, &state106}};
+std::vector<Reduce> reduce151 = {};
+std::vector<Shift> shift152 = {{&term50, &state103}, {&term52, &state415}, {&term55, &state416}, {&term58, &state106}};
+std::vector<Reduce> reduce152 = {};
+std::vector<Shift> shift153 = {{&term50, &state103}, {&term52, &state406}, {&term55, &state407}, {&term58, &state106}};
+std::vector<Reduce> reduce153 = {};
+std::vector<Shift> shift154 = {{&term50, &state103}, {&term52, &state397}, {&term55, &state398}, {&term58, &state106}};
+std::vector<Reduce> reduce154 = {};
+std::vector<Shift> shift155 = {{&term50, &state103}, {&term52, &state388}, {&term55, &state389}, {&term58, &state106}};
+std::vector<Reduce> reduce155 = {};
+std::vector<Shift> shift156 = {{&term50, &state103}, {&term52, &state379}, {&term55, &state380}, {&term58, &state106}};
+std::vector<Reduce> reduce156 = {};
+std::vector<Shift> shift157 = {{&term50, &state103}, {&term52, &state370}, {&term55, &state371}, {&term58, &state106}};
+std::vector<Reduce> reduce157 = {};
+std::vector<Shift> shift158 = {{&term50, &state103}, {&term52, &state361}, {&term55, &state362}, {&term58, &state106}};
+std::vector<Reduce> reduce158 = {};
+std::vector<Shift> shift159 = {{&term50, &state103}, {&term52, &state352}, {&term55, &state353}, {&term58, &state106}};
+std::vector<Reduce> reduce159 = {};
+std::vector<Shift> shift160 = {{&term50, &state103}, {&term52, &state343}, {&term55, &state344}, {&term58, &state106}};
+std::vector<Reduce> reduce160 = {};
+std::vector<Shift> shift161 = {{&term50, &state103}, {&term52, &state334}, {&term55, &state335}, {&term58, &state106}};
+std::vector<Reduce> reduce161 = {};
+std::vector<Shift> shift162 = {{&term50, &state103}, {&term52, &state325}, {&term55, &state326}, {&term58, &state106}};
+std::vector<Reduce> reduce162 = {};
+std::vector<Shift> shift163 = {{&term50, &state103}, {&term52, &state316}, {&term55, &state317}, {&term58, &state106}};
+std::vector<Reduce> reduce163 = {};
+std::vector<Shift> shift164 = {{&term50, &state103}, {&term52, &state307}, {&term55, &state308}, {&term58, &state106}};
+std::vector<Reduce> reduce164 = {};
+std::vector<Shift> shift165 = {{&term50, &state103}, {&term52, &state298}, {&term55, &state299}, {&term58, &state106}};
+std::vector<Reduce> reduce165 = {};
+std::vector<Shift> shift166 = {{&term50, &state103}, {&term52, &state289}, {&term55, &state290}, {&term58, &state106}};
+std::vector<Reduce> reduce166 = {};
+std::vector<Shift> shift167 = {{&term50, &state103}, {&term52, &state280}, {&term55, &state281}, {&term58, &state106}};
+std::vector<Reduce> reduce167 = {};
+std::vector<Shift> shift168 = {{&term50, &state103}, {&term52, &state271}, {&term55, &state272}, {&term58, &state106}};
+std::vector<Reduce> reduce168 = {};
+std::vector<Shift> shift169 = {{&term50, &state103}, {&term52, &state262}, {&term55, &state263}, {&term58, &state106}};
+std::vector<Reduce> reduce169 = {};
+std::vector<Shift> shift170 = {{&term50, &state103}, {&term52, &state253}, {&term55, &state254}, {&term58, &state106}};
+std::vector<Reduce> reduce170 = {};
+std::vector<Shift> shift171 = {{&term50, &state103}, {&term52, &state244}, {&term55, &state245}, {&term58, &state106}};
+std::vector<Reduce> reduce171 = {};
+std::vector<Shift> shift172 = {{&term50, &state103}, {&term52, &state235}, {&term55, &state236}, {&term58, &state106}};
+std::vector<Reduce> reduce172 = {};
+std::vector<Shift> shift173 = {{&term50, &state103}, {&term52, &state226}, {&term55, &state227}, {&term58, &state106}};
+std::vector<Reduce> reduce173 = {};
+std::vector<Shift> shift174 = {};
+std::vector<Reduce> reduce174 = {{nullptr, &rule202, false}};
+std::vector<Shift> shift226 = {{&term54, &state232}};
+std::vector<Reduce> reduce226 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift228 = {{&term53, &state229}, {&term57, &state110}};
+std::vector<Reduce> reduce228 = {};
+std::vector<Shift> shift230 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state231}};
+std::vector<Reduce> reduce230 = {};
+std::vector<Shift> shift233 = {{&term53, &state234}, {&term57, &state110}};
+std::vector<Reduce> reduce233 = {};
+std::vector<Shift> shift234 = {};
+std::vector<Reduce> reduce234 = {{nullptr, &rule201, false}};
+std::vector<Shift> shift235 = {{&term54, &state241}};
+std::vector<Reduce> reduce235 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift237 = {{&term53, &state238}, {&term57, &state110}};
+std::vector<Reduce> reduce237 = {};
+std::vector<Shift> shift238 = {};
+std::vector<Reduce> reduce238 = {{nullptr, &rule197, false}};
+std::vector<Shift> shift239 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state240}};
+std::vector<Reduce> reduce239 = {};
+std::vector<Shift> shift240 = {};
+std::vector<Reduce> reduce240 = {{nullptr, &rule199, false}};
+std::vector<Shift> shift242 = {{&term53, &state243}, {&term57, &state110}};
+std::vector<Reduce> reduce242 = {};
+std::vector<Shift> shift243 = {};
+std::vector<Reduce> reduce243 = {{nullptr, &rule198, false}};
+std::vector<Shift> shift244 = {{&term54, &state250}};
+std::vector<Reduce> reduce244 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift246 = {{&term53, &state247}, {&term57, &state110}};
+std::vector<Reduce> reduce246 = {};
+std::vector<Shift> shift247 = {};
+std::vector<Reduce> reduce247 = {{nullptr, &rule194, false}};
+std::vector<Shift> shift248 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state249}};
+std::vector<Reduce> reduce248 = {};
+std::vector<Shift> shift249 = {};
+std::vector<Reduce> reduce249 = {{nullptr, &rule196, false}};
+std::vector<Shift> shift251 = {{&term53, &state252}, {&term57, &state110}};
+std::vector<Reduce> reduce251 = {};
+std::vector<Shift> shift252 = {};
+std::vector<Reduce> reduce252 = {{nullptr, &rule195, false}};
+std::vector<Shift> shift253 = {{&term54, &state259}};
+std::vector<Reduce> reduce253 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift255 = {{&term53, &state256}, {&term57, &state110}};
+std::vector<Reduce> reduce255 = {};
+std::vector<Shift> shift256 = {};
+std::vector<Reduce> reduce256 = {{nullptr, &rule191, false}};
+std::vector<Shift> shift257 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state258}};
+std::vector<Reduce> reduce257 = {};
+std::vector<Shift> shift258 = {};
+std::vector<Reduce> reduce258 = {{nullptr, &rule193, false}};
+std::vector<Shift> shift260 = {{&term53, &state261}, {&term57, &state110}};
+std::vector<Reduce> reduce260 = {};
+std::vector<Shift> shift261 = {};
+std::vector<Reduce> reduce261 = {{nullptr, &rule192, false}};
+std::vector<Shift> shift262 = {{&term54, &state268}};
+std::vector<Reduce> reduce262 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift264 = {{&term53, &state265}, {&term57, &state110}};
+std::vector<Reduce> reduce264 = {};
+std::vector<Shift> shift265 = {};
+std::vector<Reduce> reduce265 = {{nullptr, &rule188, false}};
+std::vector<Shift> shift266 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state267}};
+std::vector<Reduce> reduce266 = {};
+std::vector<Shift> shift267 = {};
+std::vector<Reduce> reduce267 = {{nullptr, &rule190, false}};
+std::vector<Shift> shift269 = {{&term53, &state270}, {&term57, &state110}};
+std::vector<Reduce> reduce269 = {};
+std::vector<Shift> shift270 = {};
+std::vector<Reduce> reduce270 = {{nullptr, &rule189, false}};
+std::vector<Shift> shift271 = {{&term54, &state277}};
+std::vector<Reduce> reduce271 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift273 = {{&term53, &state274}, {&term57, &state110}};
+std::vector<Reduce> reduce273 = {};
+std::vector<Shift> shift274 = {};
+std::vector<Reduce> reduce274 = {{nullptr, &rule185, false}};
+std::vector<Shift> shift275 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state276}};
+std::vector<Reduce> reduce275 = {};
+std::vector<Shift> shift276 = {};
+std::vector<Reduce> reduce276 = {{nullptr, &rule187, false}};
+std::vector<Shift> shift278 = {{&term53, &state279}, {&term57, &state110}};
+std::vector<Reduce> reduce278 = {};
+std::vector<Shift> shift279 = {};
+std::vector<Reduce> reduce279 = {{nullptr, &rule186, false}};
+std::vector<Shift> shift280 = {{&term54, &state286}};
+std::vector<Reduce> reduce280 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift282 = {{&term53, &state283}, {&term57, &state110}};
+std::vector<Reduce> reduce282 = {};
+std::vector<Shift> shift283 = {};
+std::vector<Reduce> reduce283 = {{nullptr, &rule182, false}};
+std::vector<Shift> shift284 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state285}};
+std::vector<Reduce> reduce284 = {};
+std::vector<Shift> shift285 = {};
+std::vector<Reduce> reduce285 = {{nullptr, &rule184, false}};
+std::vector<Shift> shift287 = {{&term53, &state288}, {&term57, &state110}};
+std::vector<Reduce> reduce287 = {};
+std::vector<Shift> shift288 = {};
+std::vector<Reduce> reduce288 = {{nullptr, &rule183, false}};
+std::vector<Shift> shift289 = {{&term54, &state295}};
+std::vector<Reduce> reduce289 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift291 = {{&term53, &state292}, {&term57, &state110}};
+std::vector<Reduce> reduce291 = {};
+std::vector<Shift> shift292 = {};
+std::vector<Reduce> reduce292 = {{nullptr, &rule179, false}};
+std::vector<Shift> shift293 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state294}};
+std::vector<Reduce> reduce293 = {};
+std::vector<Shift> shift294 = {};
+std::vector<Reduce> reduce294 = {{nullptr, &rule181, false}};
+std::vector<Shift> shift296 = {{&term53, &state297}, {&term57, &state110}};
+std::vector<Reduce> reduce296 = {};
+std::vector<Shift> shift297 = {};
+std::vector<Reduce> reduce297 = {{nullptr, &rule180, false}};
+std::vector<Shift> shift298 = {{&term54, &state304}};
+std::vector<Reduce> reduce298 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift300 = {{&term53, &state301}, {&term57, &state110}};
+std::vector<Reduce> reduce300 = {};
+std::vector<Shift> shift301 = {};
+std::vector<Reduce> reduce301 = {{nullptr, &rule176, false}};
+std::vector<Shift> shift302 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state303}};
+std::vector<Reduce> reduce302 = {};
+std::vector<Shift> shift303 = {};
+std::vector<Reduce> reduce303 = {{nullptr, &rule178, false}};
+std::vector<Shift> shift305 = {{&term53, &state306}, {&term57, &state110}};
+std::vector<Reduce> reduce305 = {};
+std::vector<Shift> shift306 = {};
+std::vector<Reduce> reduce306 = {{nullptr, &rule177, false}};
+std::vector<Shift> shift307 = {{&term54, &state313}};
+std::vector<Reduce> reduce307 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift309 = {{&term53, &state310}, {&term57, &state110}};
+std::vector<Reduce> reduce309 = {};
+std::vector<Shift> shift310 = {};
+std::vector<Reduce> reduce310 = {{nullptr, &rule173, false}};
+std::vector<Shift> shift311 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state312}};
+std::vector<Reduce> reduce311 = {};
+std::vector<Shift> shift312 = {};
+std::vector<Reduce> reduce312 = {{nullptr, &rule175, false}};
+std::vector<Shift> shift314 = {{&term53, &state315}, {&term57, &state110}};
+std::vector<Reduce> reduce314 = {};
+std::vector<Shift> shift315 = {};
+std::vector<Reduce> reduce315 = {{nullptr, &rule174, false}};
+std::vector<Shift> shift316 = {{&term54, &state322}};
+std::vector<Reduce> reduce316 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift318 = {{&term53, &state319}, {&term57, &state110}};
+std::vector<Reduce> reduce318 = {};
+std::vector<Shift> shift319 = {};
+std::vector<Reduce> reduce319 = {{nullptr, &rule170, false}};
+std::vector<Shift> shift320 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state321}};
+std::vector<Reduce> reduce320 = {};
+std::vector<Shift> shift321 = {};
+std::vector<Reduce> reduce321 = {{nullptr, &rule172, false}};
+std::vector<Shift> shift323 = {{&term53, &state324}, {&term57, &state110}};
+std::vector<Reduce> reduce323 = {};
+std::vector<Shift> shift324 = {};
+std::vector<Reduce> reduce324 = {{nullptr, &rule171, false}};
+std::vector<Shift> shift325 = {{&term54, &state331}};
+std::vector<Reduce> reduce325 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift327 = {{&term53, &state328}, {&term57, &state110}};
+std::vector<Reduce> reduce327 = {};
+std::vector<Shift> shift328 = {};
+std::vector<Reduce> reduce328 = {{nullptr, &rule167, false}};
+std::vector<Shift> shift329 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state330}};
+std::vector<Reduce> reduce329 = {};
+std::vector<Shift> shift330 = {};
+std::vector<Reduce> reduce330 = {{nullptr, &rule169, false}};
+std::vector<Shift> shift332 = {{&term53, &state333}, {&term57, &state110}};
+std::vector<Reduce> reduce332 = {};
+std::vector<Shift> shift333 = {};
+std::vector<Reduce> reduce333 = {{nullptr, &rule168, false}};
+std::vector<Shift> shift334 = {{&term54, &state340}};
+std::vector<Reduce> reduce334 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift336 = {{&term53, &state337}, {&term57, &state110}};
+std::vector<Reduce> reduce336 = {};
+std::vector<Shift> shift337 = {};
+std::vector<Reduce> reduce337 = {{nullptr, &rule164, false}};
+std::vector<Shift> shift338 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state339}};
+std::vector<Reduce> reduce338 = {};
+std::vector<Shift> shift339 = {};
+std::vector<Reduce> reduce339 = {{nullptr, &rule166, false}};
+std::vector<Shift> shift341 = {{&term53, &state342}, {&term57, &state110}};
+std::vector<Reduce> reduce341 = {};
+std::vector<Shift> shift342 = {};
+std::vector<Reduce> reduce342 = {{nullptr, &rule165, false}};
+std::vector<Shift> shift343 = {{&term54, &state349}};
+std::vector<Reduce> reduce343 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift345 = {{&term53, &state346}, {&term57, &state110}};
+std::vector<Reduce> reduce345 = {};
+std::vector<Shift> shift346 = {};
+std::vector<Reduce> reduce346 = {{nullptr, &rule161, false}};
+std::vector<Shift> shift347 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state348}};
+std::vector<Reduce> reduce347 = {};
+std::vector<Shift> shift348 = {};
+std::vector<Reduce> reduce348 = {{nullptr, &rule163, false}};
+std::vector<Shift> shift350 = {{&term53, &state351}, {&term57, &state110}};
+std::vector<Reduce> reduce350 = {};
+std::vector<Shift> shift351 = {};
+std::vector<Reduce> reduce351 = {{nullptr, &rule162, false}};
+std::vector<Shift> shift352 = {{&term54, &state358}};
+std::vector<Reduce> reduce352 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift354 = {{&term53, &state355}, {&term57, &state110}};
+std::vector<Reduce> reduce354 = {};
+std::vector<Shift> shift355 = {};
+std::vector<Reduce> reduce355 = {{nullptr, &rule158, false}};
+std::vector<Shift> shift356 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state357}};
+std::vector<Reduce> reduce356 = {};
+std::vector<Shift> shift357 = {};
+std::vector<Reduce> reduce357 = {{nullptr, &rule160, false}};
+std::vector<Shift> shift359 = {{&term53, &state360}, {&term57, &state110}};
+std::vector<Reduce> reduce359 = {};
+std::vector<Shift> shift360 = {};
+std::vector<Reduce> reduce360 = {{nullptr, &rule159, false}};
+std::vector<Shift> shift361 = {{&term54, &state367}};
+std::vector<Reduce> reduce361 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift363 = {{&term53, &state364}, {&term57, &state110}};
+std::vector<Reduce> reduce363 = {};
+std::vector<Shift> shift364 = {};
+std::vector<Reduce> reduce364 = {{nullptr, &rule155, false}};
+std::vector<Shift> shift365 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state366}};
+std::vector<Reduce> reduce365 = {};
+std::vector<Shift> shift366 = {};
+std::vector<Reduce> reduce366 = {{nullptr, &rule157, false}};
+std::vector<Shift> shift368 = {{&term53, &state369}, {&term57, &state110}};
+std::vector<Reduce> reduce368 = {};
+std::vector<Shift> shift369 = {};
+std::vector<Reduce> reduce369 = {{nullptr, &rule156, false}};
+std::vector<Shift> shift370 = {{&term54, &state376}};
+std::vector<Reduce> reduce370 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift372 = {{&term53, &state373}, {&term57, &state110}};
+std::vector<Reduce> reduce372 = {};
+std::vector<Shift> shift373 = {};
+std::vector<Reduce> reduce373 = {{nullptr, &rule152, false}};
+std::vector<Shift> shift374 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state375}};
+std::vector<Reduce> reduce374 = {};
+std::vector<Shift> shift375 = {};
+std::vector<Reduce> reduce375 = {{nullptr, &rule154, false}};
+std::vector<Shift> shift377 = {{&term53, &state378}, {&term57, &state110}};
+std::vector<Reduce> reduce377 = {};
+std::vector<Shift> shift378 = {};
+std::vector<Reduce> reduce378 = {{nullptr, &rule153, false}};
+std::vector<Shift> shift379 = {{&term54, &state385}};
+std::vector<Reduce> reduce379 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift381 = {{&term53, &state382}, {&term57, &state110}};
+std::vector<Reduce> reduce381 = {};
+std::vector<Shift> shift382 = {};
+std::vector<Reduce> reduce382 = {{nullptr, &rule149, false}};
+std::vector<Shift> shift383 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state384}};
+std::vector<Reduce> reduce383 = {};
+std::vector<Shift> shift384 = {};
+std::vector<Reduce> reduce384 = {{nullptr, &rule151, false}};
+std::vector<Shift> shift386 = {{&term53, &state387}, {&term57, &state110}};
+std::vector<Reduce> reduce386 = {};
+std::vector<Shift> shift387 = {};
+std::vector<Reduce> reduce387 = {{nullptr, &rule150, false}};
+std::vector<Shift> shift388 = {{&term54, &state394}};
+std::vector<Reduce> reduce388 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift390 = {{&term53, &state391}, {&term57, &state110}};
+std::vector<Reduce> reduce390 = {};
+std::vector<Shift> shift391 = {};
+std::vector<Reduce> reduce391 = {{nullptr, &rule146, false}};
+std::vector<Shift> shift392 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state393}};
+std::vector<Reduce> reduce392 = {};
+std::vector<Shift> shift393 = {};
+std::vector<Reduce> reduce393 = {{nullptr, &rule148, false}};
+std::vector<Shift> shift395 = {{&term53, &state396}, {&term57, &state110}};
+std::vector<Reduce> reduce395 = {};
+std::vector<Shift> shift396 = {};
+std::vector<Reduce> reduce396 = {{nullptr, &rule147, false}};
+std::vector<Shift> shift397 = {{&term54, &state403}};
+std::vector<Reduce> reduce397 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift399 = {{&term53, &state400}, {&term57, &state110}};
+std::vector<Reduce> reduce399 = {};
+std::vector<Shift> shift400 = {};
+std::vector<Reduce> reduce400 = {{nullptr, &rule143, false}};
+std::vector<Shift> shift401 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state402}};
+std::vector<Reduce> reduce401 = {};
+std::vector<Shift> shift402 = {};
+std::vector<Reduce> reduce402 = {{nullptr, &rule145, false}};
+std::vector<Shift> shift404 = {{&term53, &state405}, {&term57, &state110}};
+std::vector<Reduce> reduce404 = {};
+std::vector<Shift> shift405 = {};
+std::vector<Reduce> reduce405 = {{nullptr, &rule144, false}};
+std::vector<Shift> shift406 = {{&term54, &state412}};
+std::vector<Reduce> reduce406 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift408 = {{&term53, &state409}, {&term57, &state110}};
+std::vector<Reduce> reduce408 = {};
+std::vector<Shift> shift409 = {};
+std::vector<Reduce> reduce409 = {{nullptr, &rule140, false}};
+std::vector<Shift> shift410 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state411}};
+std::vector<Reduce> reduce410 = {};
+std::vector<Shift> shift411 = {};
+std::vector<Reduce> reduce411 = {{nullptr, &rule142, false}};
+std::vector<Shift> shift413 = {{&term53, &state414}, {&term57, &state110}};
+std::vector<Reduce> reduce413 = {};
+std::vector<Shift> shift414 = {};
+std::vector<Reduce> reduce414 = {{nullptr, &rule141, false}};
+std::vector<Shift> shift415 = {{&term54, &state421}};
+std::vector<Reduce> reduce415 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift417 = {{&term53, &state418}, {&term57, &state110}};
+std::vector<Reduce> reduce417 = {};
+std::vector<Shift> shift418 = {};
+std::vector<Reduce> reduce418 = {{nullptr, &rule137, false}};
+std::vector<Shift> shift419 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state420}};
+std::vector<Reduce> reduce419 = {};
+std::vector<Shift> shift420 = {};
+std::vector<Reduce> reduce420 = {{nullptr, &rule139, false}};
+std::vector<Shift> shift422 = {{&term53, &state423}, {&term57, &state110}};
+std::vector<Reduce> reduce422 = {};
+std::vector<Shift> shift423 = {};
+std::vector<Reduce> reduce423 = {{nullptr, &rule138, false}};
+std::vector<Shift> shift424 = {{&term54, &state430}};
+std::vector<Reduce> reduce424 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift426 = {{&term53, &state427}, {&term57, &state110}};
+std::vector<Reduce> reduce426 = {};
+std::vector<Shift> shift427 = {};
+std::vector<Reduce> reduce427 = {{nullptr, &rule134, false}};
+std::vector<Shift> shift428 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state429}};
+std::vector<Reduce> reduce428 = {};
+std::vector<Shift> shift429 = {};
+std::vector<Reduce> reduce429 = {{nullptr, &rule136, false}};
+std::vector<Shift> shift431 = {{&term53, &state432}, {&term57, &state110}};
+std::vector<Reduce> reduce431 = {};
+std::vector<Shift> shift432 = {};
+std::vector<Reduce> reduce432 = {{nullptr, &rule135, false}};
+std::vector<Shift> shift433 = {{&term54, &state439}};
+std::vector<Reduce> reduce433 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift435 = {{&term53, &state436}, {&term57, &state110}};
+std::vector<Reduce> reduce435 = {};
+std::vector<Shift> shift436 = {};
+std::vector<Reduce> reduce436 = {{nullptr, &rule131, false}};
+std::vector<Shift> shift437 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state438}};
+std::vector<Reduce> reduce437 = {};
+std::vector<Shift> shift438 = {};
+std::vector<Reduce> reduce438 = {{nullptr, &rule133, false}};
+std::vector<Shift> shift440 = {{&term53, &state441}, {&term57, &state110}};
+std::vector<Reduce> reduce440 = {};
+std::vector<Shift> shift441 = {};
+std::vector<Reduce> reduce441 = {{nullptr, &rule132, false}};
+std::vector<Shift> shift442 = {{&term54, &state448}};
+std::vector<Reduce> reduce442 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift444 = {{&term53, &state445}, {&term57, &state110}};
+std::vector<Reduce> reduce444 = {};
+std::vector<Shift> shift445 = {};
+std::vector<Reduce> reduce445 = {{nullptr, &rule128, false}};
+std::vector<Shift> shift446 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state447}};
+std::vector<Reduce> reduce446 = {};
+std::vector<Shift> shift447 = {};
+std::vector<Reduce> reduce447 = {{nullptr, &rule130, false}};
+std::vector<Shift> shift449 = {{&term53, &state450}, {&term57, &state110}};
+std::vector<Reduce> reduce449 = {};
+std::vector<Shift> shift450 = {};
+std::vector<Reduce> reduce450 = {{nullptr, &rule129, false}};
+std::vector<Shift> shift451 = {{&term54, &state457}};
+std::vector<Reduce> reduce451 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift453 = {{&term53, &state454}, {&term57, &state110}};
+std::vector<Reduce> reduce453 = {};
+std::vector<Shift> shift454 = {};
+std::vector<Reduce> reduce454 = {{nullptr, &rule125, false}};
+std::vector<Shift> shift455 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state456}};
+std::vector<Reduce> reduce455 = {};
+std::vector<Shift> shift456 = {};
+std::vector<Reduce> reduce456 = {{nullptr, &rule127, false}};
+std::vector<Shift> shift458 = {{&term53, &state459}, {&term57, &state110}};
+std::vector<Reduce> reduce458 = {};
+std::vector<Shift> shift459 = {};
+std::vector<Reduce> reduce459 = {{nullptr, &rule126, false}};
+std::vector<Shift> shift460 = {{&term54, &state466}};
+std::vector<Reduce> reduce460 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift462 = {{&term53, &state463}, {&term57, &state110}};
+std::vector<Reduce> reduce462 = {};
+std::vector<Shift> shift463 = {};
+std::vector<Reduce> reduce463 = {{nullptr, &rule122, false}};
+std::vector<Shift> shift464 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state465}};
+std::vector<Reduce> reduce464 = {};
+std::vector<Shift> shift465 = {};
+std::vector<Reduce> reduce465 = {{nullptr, &rule124, false}};
+std::vector<Shift> shift467 = {{&term53, &state468}, {&term57, &state110}};
+std::vector<Reduce> reduce467 = {};
+std::vector<Shift> shift468 = {};
+std::vector<Reduce> reduce468 = {{nullptr, &rule123, false}};
+std::vector<Shift> shift469 = {{&term54, &state475}};
+std::vector<Reduce> reduce469 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift471 = {{&term53, &state472}, {&term57, &state110}};
+std::vector<Reduce> reduce471 = {};
+std::vector<Shift> shift472 = {};
+std::vector<Reduce> reduce472 = {{nullptr, &rule119, false}};
+std::vector<Shift> shift473 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state474}};
+std::vector<Reduce> reduce473 = {};
+std::vector<Shift> shift474 = {};
+std::vector<Reduce> reduce474 = {{nullptr, &rule121, false}};
+std::vector<Shift> shift476 = {{&term53, &state477}, {&term57, &state110}};
+std::vector<Reduce> reduce476 = {};
+std::vector<Shift> shift477 = {};
+std::vector<Reduce> reduce477 = {{nullptr, &rule120, false}};
+std::vector<Shift> shift478 = {{&term54, &state484}};
+std::vector<Reduce> reduce478 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift480 = {{&term53, &state481}, {&term57, &state110}};
+std::vector<Reduce> reduce480 = {};
+std::vector<Shift> shift481 = {};
+std::vector<Reduce> reduce481 = {{nullptr, &rule116, false}};
+std::vector<Shift> shift482 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state483}};
+std::vector<Reduce> reduce482 = {};
+std::vector<Shift> shift483 = {};
+std::vector<Reduce> reduce483 = {{nullptr, &rule118, false}};
+std::vector<Shift> shift485 = {{&term53, &state486}, {&term57, &state110}};
+std::vector<Reduce> reduce485 = {};
+std::vector<Shift> shift486 = {};
+std::vector<Reduce> reduce486 = {{nullptr, &rule117, false}};
+std::vector<Shift> shift487 = {{&term54, &state493}};
+std::vector<Reduce> reduce487 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift489 = {{&term53, &state490}, {&term57, &state110}};
+std::vector<Reduce> reduce489 = {};
+std::vector<Shift> shift490 = {};
+std::vector<Reduce> reduce490 = {{nullptr, &rule113, false}};
+std::vector<Shift> shift491 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state492}};
+std::vector<Reduce> reduce491 = {};
+std::vector<Shift> shift492 = {};
+std::vector<Reduce> reduce492 = {{nullptr, &rule115, false}};
+std::vector<Shift> shift494 = {{&term53, &state495}, {&term57, &state110}};
+std::vector<Reduce> reduce494 = {};
+std::vector<Shift> shift495 = {};
+std::vector<Reduce> reduce495 = {{nullptr, &rule114, false}};
+std::vector<Shift> shift496 = {{&term54, &state502}};
+std::vector<Reduce> reduce496 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift498 = {{&term53, &state499}, {&term57, &state110}};
+std::vector<Reduce> reduce498 = {};
+std::vector<Shift> shift499 = {};
+std::vector<Reduce> reduce499 = {{nullptr, &rule110, false}};
+std::vector<Shift> shift500 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state501}};
+std::vector<Reduce> reduce500 = {};
+std::vector<Shift> shift501 = {};
+std::vector<Reduce> reduce501 = {{nullptr, &rule112, false}};
+std::vector<Shift> shift503 = {{&term53, &state504}, {&term57, &state110}};
+std::vector<Reduce> reduce503 = {};
+std::vector<Shift> shift504 = {};
+std::vector<Reduce> reduce504 = {{nullptr, &rule111, false}};
+std::vector<Shift> shift505 = {{&term54, &state511}};
+std::vector<Reduce> reduce505 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift507 = {{&term53, &state508}, {&term57, &state110}};
+std::vector<Reduce> reduce507 = {};
+std::vector<Shift> shift508 = {};
+std::vector<Reduce> reduce508 = {{nullptr, &rule107, false}};
+std::vector<Shift> shift509 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state510}};
+std::vector<Reduce> reduce509 = {};
+std::vector<Shift> shift510 = {};
+std::vector<Reduce> reduce510 = {{nullptr, &rule109, false}};
+std::vector<Shift> shift512 = {{&term53, &state513}, {&term57, &state110}};
+std::vector<Reduce> reduce512 = {};
+std::vector<Shift> shift513 = {};
+std::vector<Reduce> reduce513 = {{nullptr, &rule108, false}};
+std::vector<Shift> shift514 = {{&term54, &state520}};
+std::vector<Reduce> reduce514 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift516 = {{&term53, &state517}, {&term57, &state110}};
+std::vector<Reduce> reduce516 = {};
+std::vector<Shift> shift517 = {};
+std::vector<Reduce> reduce517 = {{nullptr, &rule104, false}};
+std::vector<Shift> shift518 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state519}};
+std::vector<Reduce> reduce518 = {};
+std::vector<Shift> shift519 = {};
+std::vector<Reduce> reduce519 = {{nullptr, &rule106, false}};
+std::vector<Shift> shift521 = {{&term53, &state522}, {&term57, &state110}};
+std::vector<Reduce> reduce521 = {};
+std::vector<Shift> shift522 = {};
+std::vector<Reduce> reduce522 = {{nullptr, &rule105, false}};
+std::vector<Shift> shift523 = {{&term54, &state529}};
+std::vector<Reduce> reduce523 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift525 = {{&term53, &state526}, {&term57, &state110}};
+std::vector<Reduce> reduce525 = {};
+std::vector<Shift> shift526 = {};
+std::vector<Reduce> reduce526 = {{nullptr, &rule101, false}};
+std::vector<Shift> shift527 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state528}};
+std::vector<Reduce> reduce527 = {};
+std::vector<Shift> shift528 = {};
+std::vector<Reduce> reduce528 = {{nullptr, &rule103, false}};
+std::vector<Shift> shift530 = {{&term53, &state531}, {&term57, &state110}};
+std::vector<Reduce> reduce530 = {};
+std::vector<Shift> shift531 = {};
+std::vector<Reduce> reduce531 = {{nullptr, &rule102, false}};
+std::vector<Shift> shift532 = {{&term54, &state538}};
+std::vector<Reduce> reduce532 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift534 = {{&term53, &state535}, {&term57, &state110}};
+std::vector<Reduce> reduce534 = {};
+std::vector<Shift> shift535 = {};
+std::vector<Reduce> reduce535 = {{nullptr, &rule98, false}};
+std::vector<Shift> shift536 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state537}};
+std::vector<Reduce> reduce536 = {};
+std::vector<Shift> shift537 = {};
+std::vector<Reduce> reduce537 = {{nullptr, &rule100, false}};
+std::vector<Shift> shift539 = {{&term53, &state540}, {&term57, &state110}};
+std::vector<Reduce> reduce539 = {};
+std::vector<Shift> shift540 = {};
+std::vector<Reduce> reduce540 = {{nullptr, &rule99, false}};
+std::vector<Shift> shift541 = {{&term54, &state547}};
+std::vector<Reduce> reduce541 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift543 = {{&term53, &state544}, {&term57, &state110}};
+std::vector<Reduce> reduce543 = {};
+std::vector<Shift> shift544 = {};
+std::vector<Reduce> reduce544 = {{nullptr, &rule95, false}};
+std::vector<Shift> shift545 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state546}};
+std::vector<Reduce> reduce545 = {};
+std::vector<Shift> shift546 = {};
+std::vector<Reduce> reduce546 = {{nullptr, &rule97, false}};
+std::vector<Shift> shift548 = {{&term53, &state549}, {&term57, &state110}};
+std::vector<Reduce> reduce548 = {};
+std::vector<Shift> shift549 = {};
+std::vector<Reduce> reduce549 = {{nullptr, &rule96, false}};
+std::vector<Shift> shift550 = {{&term54, &state556}};
+std::vector<Reduce> reduce550 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift552 = {{&term53, &state553}, {&term57, &state110}};
+std::vector<Reduce> reduce552 = {};
+std::vector<Shift> shift553 = {};
+std::vector<Reduce> reduce553 = {{nullptr, &rule92, false}};
+std::vector<Shift> shift554 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state555}};
+std::vector<Reduce> reduce554 = {};
+std::vector<Shift> shift555 = {};
+std::vector<Reduce> reduce555 = {{nullptr, &rule94, false}};
+std::vector<Shift> shift557 = {{&term53, &state558}, {&term57, &state110}};
+std::vector<Reduce> reduce557 = {};
+std::vector<Shift> shift558 = {};
+std::vector<Reduce> reduce558 = {{nullptr, &rule93, false}};
+std::vector<Shift> shift559 = {{&term54, &state565}};
+std::vector<Reduce> reduce559 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift561 = {{&term53, &state562}, {&term57, &state110}};
+std::vector<Reduce> reduce561 = {};
+std::vector<Shift> shift562 = {};
+std::vector<Reduce> reduce562 = {{nullptr, &rule89, false}};
+std::vector<Shift> shift563 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state564}};
+std::vector<Reduce> reduce563 = {};
+std::vector<Shift> shift564 = {};
+std::vector<Reduce> reduce564 = {{nullptr, &rule91, false}};
+std::vector<Shift> shift566 = {{&term53, &state567}, {&term57, &state110}};
+std::vector<Reduce> reduce566 = {};
+std::vector<Shift> shift567 = {};
+std::vector<Reduce> reduce567 = {{nullptr, &rule90, false}};
+std::vector<Shift> shift568 = {{&term54, &state574}};
+std::vector<Reduce> reduce568 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift570 = {{&term53, &state571}, {&term57, &state110}};
+std::vector<Reduce> reduce570 = {};
+std::vector<Shift> shift571 = {};
+std::vector<Reduce> reduce571 = {{nullptr, &rule86, false}};
+std::vector<Shift> shift572 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state573}};
+std::vector<Reduce> reduce572 = {};
+std::vector<Shift> shift573 = {};
+std::vector<Reduce> reduce573 = {{nullptr, &rule88, false}};
+std::vector<Shift> shift575 = {{&term53, &state576}, {&term57, &state110}};
+std::vector<Reduce> reduce575 = {};
+std::vector<Shift> shift576 = {};
+std::vector<Reduce> reduce576 = {{nullptr, &rule87, false}};
+std::vector<Shift> shift577 = {{&term54, &state583}};
+std::vector<Reduce> reduce577 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift579 = {{&term53, &state580}, {&term57, &state110}};
+std::vector<Reduce> reduce579 = {};
+std::vector<Shift> shift580 = {};
+std::vector<Reduce> reduce580 = {{nullptr, &rule83, false}};
+std::vector<Shift> shift581 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state582}};
+std::vector<Reduce> reduce581 = {};
+std::vector<Shift> shift582 = {};
+std::vector<Reduce> reduce582 = {{nullptr, &rule85, false}};
+std::vector<Shift> shift584 = {{&term53, &state585}, {&term57, &state110}};
+std::vector<Reduce> reduce584 = {};
+std::vector<Shift> shift585 = {};
+std::vector<Reduce> reduce585 = {{nullptr, &rule84, false}};
+std::vector<Shift> shift586 = {{&term54, &state592}};
+std::vector<Reduce> reduce586 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift588 = {{&term53, &state589}, {&term57, &state110}};
+std::vector<Reduce> reduce588 = {};
+std::vector<Shift> shift589 = {};
+std::vector<Reduce> reduce589 = {{nullptr, &rule80, false}};
+std::vector<Shift> shift590 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state591}};
+std::vector<Reduce> reduce590 = {};
+std::vector<Shift> shift591 = {};
+std::vector<Reduce> reduce591 = {{nullptr, &rule82, false}};
+std::vector<Shift> shift593 = {{&term53, &state594}, {&term57, &state110}};
+std::vector<Reduce> reduce593 = {};
+std::vector<Shift> shift594 = {};
+std::vector<Reduce> reduce594 = {{nullptr, &rule81, false}};
+std::vector<Shift> shift595 = {{&term54, &state601}};
+std::vector<Reduce> reduce595 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift597 = {{&term53, &state598}, {&term57, &state110}};
+std::vector<Reduce> reduce597 = {};
+std::vector<Shift> shift598 = {};
+std::vector<Reduce> reduce598 = {{nullptr, &rule77, false}};
+std::vector<Shift> shift599 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state600}};
+std::vector<Reduce> reduce599 = {};
+std::vector<Shift> shift600 = {};
+std::vector<Reduce> reduce600 = {{nullptr, &rule79, false}};
+std::vector<Shift> shift602 = {{&term53, &state603}, {&term57, &state110}};
+std::vector<Reduce> reduce602 = {};
+std::vector<Shift> shift603 = {};
+std::vector<Reduce> reduce603 = {{nullptr, &rule78, false}};
+std::vector<Shift> shift604 = {{&term54, &state610}};
+std::vector<Reduce> reduce604 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift606 = {{&term53, &state607}, {&term57, &state110}};
+std::vector<Reduce> reduce606 = {};
+std::vector<Shift> shift607 = {};
+std::vector<Reduce> reduce607 = {{nullptr, &rule74, false}};
+std::vector<Shift> shift608 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state609}};
+std::vector<Reduce> reduce608 = {};
+std::vector<Shift> shift609 = {};
+std::vector<Reduce> reduce609 = {{nullptr, &rule76, false}};
+std::vector<Shift> shift611 = {{&term53, &state612}, {&term57, &state110}};
+std::vector<Reduce> reduce611 = {};
+std::vector<Shift> shift612 = {};
+std::vector<Reduce> reduce612 = {{nullptr, &rule75, false}};
+std::vector<Shift> shift613 = {{&term54, &state619}};
+std::vector<Reduce> reduce613 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift615 = {{&term53, &state616}, {&term57, &state110}};
+std::vector<Reduce> reduce615 = {};
+std::vector<Shift> shift616 = {};
+std::vector<Reduce> reduce616 = {{nullptr, &rule71, false}};
+std::vector<Shift> shift617 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state618}};
+std::vector<Reduce> reduce617 = {};
+std::vector<Shift> shift618 = {};
+std::vector<Reduce> reduce618 = {{nullptr, &rule73, false}};
+std::vector<Shift> shift620 = {{&term53, &state621}, {&term57, &state110}};
+std::vector<Reduce> reduce620 = {};
+std::vector<Shift> shift621 = {};
+std::vector<Reduce> reduce621 = {{nullptr, &rule72, false}};
+std::vector<Shift> shift622 = {{&term54, &state628}};
+std::vector<Reduce> reduce622 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift624 = {{&term53, &state625}, {&term57, &state110}};
+std::vector<Reduce> reduce624 = {};
+std::vector<Shift> shift625 = {};
+std::vector<Reduce> reduce625 = {{nullptr, &rule68, false}};
+std::vector<Shift> shift626 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state627}};
+std::vector<Reduce> reduce626 = {};
+std::vector<Shift> shift627 = {};
+std::vector<Reduce> reduce627 = {{nullptr, &rule70, false}};
+std::vector<Shift> shift629 = {{&term53, &state630}, {&term57, &state110}};
+std::vector<Reduce> reduce629 = {};
+std::vector<Shift> shift630 = {};
+std::vector<Reduce> reduce630 = {{nullptr, &rule69, false}};
+std::vector<Shift> shift631 = {{&term54, &state637}};
+std::vector<Reduce> reduce631 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift633 = {{&term53, &state634}, {&term57, &state110}};
+std::vector<Reduce> reduce633 = {};
+std::vector<Shift> shift634 = {};
+std::vector<Reduce> reduce634 = {{nullptr, &rule65, false}};
+std::vector<Shift> shift635 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state636}};
+std::vector<Reduce> reduce635 = {};
+std::vector<Shift> shift636 = {};
+std::vector<Reduce> reduce636 = {{nullptr, &rule67, false}};
+std::vector<Shift> shift638 = {{&term53, &state639}, {&term57, &state110}};
+std::vector<Reduce> reduce638 = {};
+std::vector<Shift> shift639 = {};
+std::vector<Reduce> reduce639 = {{nullptr, &rule66, false}};
+std::vector<Shift> shift640 = {{&term54, &state646}};
+std::vector<Reduce> reduce640 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift642 = {{&term53, &state643}, {&term57, &state110}};
+std::vector<Reduce> reduce642 = {};
+std::vector<Shift> shift643 = {};
+std::vector<Reduce> reduce643 = {{nullptr, &rule62, false}};
+std::vector<Shift> shift644 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state645}};
+std::vector<Reduce> reduce644 = {};
+std::vector<Shift> shift645 = {};
+std::vector<Reduce> reduce645 = {{nullptr, &rule64, false}};
+std::vector<Shift> shift647 = {{&term53, &state648}, {&term57, &state110}};
+std::vector<Reduce> reduce647 = {};
+std::vector<Shift> shift648 = {};
+std::vector<Reduce> reduce648 = {{nullptr, &rule63, false}};
+std::vector<Shift> shift649 = {{&term54, &state655}};
+std::vector<Reduce> reduce649 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift651 = {{&term53, &state652}, {&term57, &state110}};
+std::vector<Reduce> reduce651 = {};
+std::vector<Shift> shift652 = {};
+std::vector<Reduce> reduce652 = {{nullptr, &rule59, false}};
+std::vector<Shift> shift653 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state654}};
+std::vector<Reduce> reduce653 = {};
+std::vector<Shift> shift654 = {};
+std::vector<Reduce> reduce654 = {{nullptr, &rule61, false}};
+std::vector<Shift> shift656 = {{&term53, &state657}, {&term57, &state110}};
+std::vector<Reduce> reduce656 = {};
+std::vector<Shift> shift657 = {};
+std::vector<Reduce> reduce657 = {{nullptr, &rule60, false}};
+std::vector<Shift> shift658 = {{&term54, &state664}};
+std::vector<Reduce> reduce658 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift660 = {{&term53, &state661}, {&term57, &state110}};
+std::vector<Reduce> reduce660 = {};
+std::vector<Shift> shift661 = {};
+std::vector<Reduce> reduce661 = {{nullptr, &rule56, false}};
+std::vector<Shift> shift662 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state663}};
+std::vector<Reduce> reduce662 = {};
+std::vector<Shift> shift663 = {};
+std::vector<Reduce> reduce663 = {{nullptr, &rule58, false}};
+std::vector<Shift> shift665 = {{&term53, &state666}, {&term57, &state110}};
+std::vector<Reduce> reduce665 = {};
+std::vector<Shift> shift666 = {};
+std::vector<Reduce> reduce666 = {{nullptr, &rule57, false}};
+std::vector<Shift> shift667 = {{&term54, &state673}};
+std::vector<Reduce> reduce667 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift669 = {{&term53, &state670}, {&term57, &state110}};
+std::vector<Reduce> reduce669 = {};
+std::vector<Shift> shift670 = {};
+std::vector<Reduce> reduce670 = {{nullptr, &rule53, false}};
+std::vector<Shift> shift671 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state672}};
+std::vector<Reduce> reduce671 = {};
+std::vector<Shift> shift672 = {};
+std::vector<Reduce> reduce672 = {{nullptr, &rule55, false}};
+std::vector<Shift> shift674 = {{&term53, &state675}, {&term57, &state110}};
+std::vector<Reduce> reduce674 = {};
+std::vector<Shift> shift675 = {};
+std::vector<Reduce> reduce675 = {{nullptr, &rule54, false}};
+std::vector<Shift> shift677 = {{&term53, &state678}, {&term57, &state110}};
+std::vector<Reduce> reduce677 = {};
+std::vector<Shift> shift679 = {{&term54, &state685}};
+std::vector<Reduce> reduce679 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift681 = {{&term53, &state682}, {&term57, &state110}};
+std::vector<Reduce> reduce681 = {};
+std::vector<Shift> shift683 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state684}};
+std::vector<Reduce> reduce683 = {};
+std::vector<Shift> shift686 = {{&term53, &state687}, {&term57, &state110}};
+std::vector<Reduce> reduce686 = {};
+std::vector<Shift> shift688 = {{&term54, &state694}};
+std::vector<Reduce> reduce688 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift690 = {{&term53, &state691}, {&term57, &state110}};
+std::vector<Reduce> reduce690 = {};
+std::vector<Shift> shift692 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state693}};
+std::vector<Reduce> reduce692 = {};
+std::vector<Shift> shift695 = {{&term53, &state696}, {&term57, &state110}};
+std::vector<Reduce> reduce695 = {};
+std::vector<Shift> shift697 = {{&term54, &state703}};
+std::vector<Reduce> reduce697 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift699 = {{&term53, &state700}, {&term57, &state110}};
+std::vector<Reduce> reduce699 = {};
+std::vector<Shift> shift701 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state702}};
+std::vector<Reduce> reduce701 = {};
+std::vector<Shift> shift704 = {{&term53, &state705}, {&term57, &state110}};
+std::vector<Reduce> reduce704 = {};
+std::vector<Shift> shift706 = {{&term54, &state712}};
+std::vector<Reduce> reduce706 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift708 = {{&term53, &state709}, {&term57, &state110}};
+std::vector<Reduce> reduce708 = {};
+std::vector<Shift> shift710 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state711}};
+std::vector<Reduce> reduce710 = {};
+std::vector<Shift> shift713 = {{&term53, &state714}, {&term57, &state110}};
+std::vector<Reduce> reduce713 = {};
+std::vector<Shift> shift715 = {{&term54, &state721}};
+std::vector<Reduce> reduce715 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift717 = {{&term53, &state718}, {&term57, &state110}};
+std::vector<Reduce> reduce717 = {};
+std::vector<Shift> shift719 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state720}};
+std::vector<Reduce> reduce719 = {};
+std::vector<Shift> shift722 = {{&term53, &state723}, {&term57, &state110}};
+std::vector<Reduce> reduce722 = {};
+std::vector<Shift> shift724 = {{&term54, &state730}};
+std::vector<Reduce> reduce724 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift726 = {{&term53, &state727}, {&term57, &state110}};
+std::vector<Reduce> reduce726 = {};
+std::vector<Shift> shift728 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state729}};
+std::vector<Reduce> reduce728 = {};
+std::vector<Shift> shift731 = {{&term53, &state732}, {&term57, &state110}};
+std::vector<Reduce> reduce731 = {};
+std::vector<Shift> shift733 = {{&term54, &state739}};
+std::vector<Reduce> reduce733 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift735 = {{&term53, &state736}, {&term57, &state110}};
+std::vector<Reduce> reduce735 = {};
+std::vector<Shift> shift737 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state738}};
+std::vector<Reduce> reduce737 = {};
+std::vector<Shift> shift740 = {{&term53, &state741}, {&term57, &state110}};
+std::vector<Reduce> reduce740 = {};
+std::vector<Shift> shift742 = {{&term54, &state748}};
+std::vector<Reduce> reduce742 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift744 = {{&term53, &state745}, {&term57, &state110}};
+std::vector<Reduce> reduce744 = {};
+std::vector<Shift> shift746 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state747}};
+std::vector<Reduce> reduce746 = {};
+std::vector<Shift> shift749 = {{&term53, &state750}, {&term57, &state110}};
+std::vector<Reduce> reduce749 = {};
+std::vector<Shift> shift751 = {{&term54, &state757}};
+std::vector<Reduce> reduce751 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift753 = {{&term53, &state754}, {&term57, &state110}};
+std::vector<Reduce> reduce753 = {};
+std::vector<Shift> shift755 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state756}};
+std::vector<Reduce> reduce755 = {};
+std::vector<Shift> shift758 = {{&term53, &state759}, {&term57, &state110}};
+std::vector<Reduce> reduce758 = {};
+std::vector<Shift> shift760 = {{&term54, &state766}};
+std::vector<Reduce> reduce760 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift762 = {{&term53, &state763}, {&term57, &state110}};
+std::vector<Reduce> reduce762 = {};
+std::vector<Shift> shift764 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state765}};
+std::vector<Reduce> reduce764 = {};
+std::vector<Shift> shift767 = {{&term53, &state768}, {&term57, &state110}};
+std::vector<Reduce> reduce767 = {};
+std::vector<Shift> shift769 = {{&term54, &state775}};
+std::vector<Reduce> reduce769 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift771 = {{&term53, &state772}, {&term57, &state110}};
+std::vector<Reduce> reduce771 = {};
+std::vector<Shift> shift773 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state774}};
+std::vector<Reduce> reduce773 = {};
+std::vector<Shift> shift776 = {{&term53, &state777}, {&term57, &state110}};
+std::vector<Reduce> reduce776 = {};
+std::vector<Shift> shift778 = {{&term54, &state784}};
+std::vector<Reduce> reduce778 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift780 = {{&term53, &state781}, {&term57, &state110}};
+std::vector<Reduce> reduce780 = {};
+std::vector<Shift> shift782 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state783}};
+std::vector<Reduce> reduce782 = {};
+std::vector<Shift> shift785 = {{&term53, &state786}, {&term57, &state110}};
+std::vector<Reduce> reduce785 = {};
+std::vector<Shift> shift787 = {{&term54, &state793}};
+std::vector<Reduce> reduce787 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift789 = {{&term53, &state790}, {&term57, &state110}};
+std::vector<Reduce> reduce789 = {};
+std::vector<Shift> shift791 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state792}};
+std::vector<Reduce> reduce791 = {};
+std::vector<Shift> shift794 = {{&term53, &state795}, {&term57, &state110}};
+std::vector<Reduce> reduce794 = {};
+std::vector<Shift> shift796 = {{&term54, &state802}};
+std::vector<Reduce> reduce796 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift798 = {{&term53, &state799}, {&term57, &state110}};
+std::vector<Reduce> reduce798 = {};
+std::vector<Shift> shift800 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state801}};
+std::vector<Reduce> reduce800 = {};
+std::vector<Shift> shift803 = {{&term53, &state804}, {&term57, &state110}};
+std::vector<Reduce> reduce803 = {};
+std::vector<Shift> shift805 = {{&term54, &state811}};
+std::vector<Reduce> reduce805 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift807 = {{&term53, &state808}, {&term57, &state110}};
+std::vector<Reduce> reduce807 = {};
+std::vector<Shift> shift809 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state810}};
+std::vector<Reduce> reduce809 = {};
+std::vector<Shift> shift812 = {{&term53, &state813}, {&term57, &state110}};
+std::vector<Reduce> reduce812 = {};
+std::vector<Shift> shift814 = {{&term54, &state820}};
+std::vector<Reduce> reduce814 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift816 = {{&term53, &state817}, {&term57, &state110}};
+std::vector<Reduce> reduce816 = {};
+std::vector<Shift> shift818 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state819}};
+std::vector<Reduce> reduce818 = {};
+std::vector<Shift> shift821 = {{&term53, &state822}, {&term57, &state110}};
+std::vector<Reduce> reduce821 = {};
+std::vector<Shift> shift823 = {{&term54, &state829}};
+std::vector<Reduce> reduce823 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift825 = {{&term53, &state826}, {&term57, &state110}};
+std::vector<Reduce> reduce825 = {};
+std::vector<Shift> shift827 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state828}};
+std::vector<Reduce> reduce827 = {};
+std::vector<Shift> shift830 = {{&term53, &state831}, {&term57, &state110}};
+std::vector<Reduce> reduce830 = {};
+std::vector<Shift> shift832 = {{&term54, &state838}};
+std::vector<Reduce> reduce832 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift834 = {{&term53, &state835}, {&term57, &state110}};
+std::vector<Reduce> reduce834 = {};
+std::vector<Shift> shift836 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state837}};
+std::vector<Reduce> reduce836 = {};
+std::vector<Shift> shift839 = {{&term53, &state840}, {&term57, &state110}};
+std::vector<Reduce> reduce839 = {};
+std::vector<Shift> shift841 = {{&term54, &state847}};
+std::vector<Reduce> reduce841 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift843 = {{&term53, &state844}, {&term57, &state110}};
+std::vector<Reduce> reduce843 = {};
+std::vector<Shift> shift845 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state846}};
+std::vector<Reduce> reduce845 = {};
+std::vector<Shift> shift848 = {{&term53, &state849}, {&term57, &state110}};
+std::vector<Reduce> reduce848 = {};
+std::vector<Shift> shift850 = {{&term54, &state856}};
+std::vector<Reduce> reduce850 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift852 = {{&term53, &state853}, {&term57, &state110}};
+std::vector<Reduce> reduce852 = {};
+std::vector<Shift> shift854 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state855}};
+std::vector<Reduce> reduce854 = {};
+std::vector<Shift> shift857 = {{&term53, &state858}, {&term57, &state110}};
+std::vector<Reduce> reduce857 = {};
+std::vector<Shift> shift859 = {{&term54, &state865}};
+std::vector<Reduce> reduce859 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift861 = {{&term53, &state862}, {&term57, &state110}};
+std::vector<Reduce> reduce861 = {};
+std::vector<Shift> shift863 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state864}};
+std::vector<Reduce> reduce863 = {};
+std::vector<Shift> shift866 = {{&term53, &state867}, {&term57, &state110}};
+std::vector<Reduce> reduce866 = {};
+std::vector<Shift> shift868 = {{&term54, &state874}};
+std::vector<Reduce> reduce868 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift870 = {{&term53, &state871}, {&term57, &state110}};
+std::vector<Reduce> reduce870 = {};
+std::vector<Shift> shift872 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state873}};
+std::vector<Reduce> reduce872 = {};
+std::vector<Shift> shift875 = {{&term53, &state876}, {&term57, &state110}};
+std::vector<Reduce> reduce875 = {};
+std::vector<Shift> shift877 = {{&term54, &state883}};
+std::vector<Reduce> reduce877 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift879 = {{&term53, &state880}, {&term57, &state110}};
+std::vector<Reduce> reduce879 = {};
+std::vector<Shift> shift881 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state882}};
+std::vector<Reduce> reduce881 = {};
+std::vector<Shift> shift884 = {{&term53, &state885}, {&term57, &state110}};
+std::vector<Reduce> reduce884 = {};
+std::vector<Shift> shift886 = {{&term54, &state892}};
+std::vector<Reduce> reduce886 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift888 = {{&term53, &state889}, {&term57, &state110}};
+std::vector<Reduce> reduce888 = {};
+std::vector<Shift> shift890 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state891}};
+std::vector<Reduce> reduce890 = {};
+std::vector<Shift> shift893 = {{&term53, &state894}, {&term57, &state110}};
+std::vector<Reduce> reduce893 = {};
+std::vector<Shift> shift895 = {{&term54, &state901}};
+std::vector<Reduce> reduce895 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift897 = {{&term53, &state898}, {&term57, &state110}};
+std::vector<Reduce> reduce897 = {};
+std::vector<Shift> shift899 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state900}};
+std::vector<Reduce> reduce899 = {};
+std::vector<Shift> shift902 = {{&term53, &state903}, {&term57, &state110}};
+std::vector<Reduce> reduce902 = {};
+std::vector<Shift> shift904 = {{&term54, &state910}};
+std::vector<Reduce> reduce904 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift906 = {{&term53, &state907}, {&term57, &state110}};
+std::vector<Reduce> reduce906 = {};
+std::vector<Shift> shift908 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state909}};
+std::vector<Reduce> reduce908 = {};
+std::vector<Shift> shift911 = {{&term53, &state912}, {&term57, &state110}};
+std::vector<Reduce> reduce911 = {};
+std::vector<Shift> shift913 = {{&term54, &state919}};
+std::vector<Reduce> reduce913 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift915 = {{&term53, &state916}, {&term57, &state110}};
+std::vector<Reduce> reduce915 = {};
+std::vector<Shift> shift917 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state918}};
+std::vector<Reduce> reduce917 = {};
+std::vector<Shift> shift920 = {{&term53, &state921}, {&term57, &state110}};
+std::vector<Reduce> reduce920 = {};
+std::vector<Shift> shift922 = {{&term54, &state928}};
+std::vector<Reduce> reduce922 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift924 = {{&term53, &state925}, {&term57, &state110}};
+std::vector<Reduce> reduce924 = {};
+std::vector<Shift> shift926 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state927}};
+std::vector<Reduce> reduce926 = {};
+std::vector<Shift> shift929 = {{&term53, &state930}, {&term57, &state110}};
+std::vector<Reduce> reduce929 = {};
+std::vector<Shift> shift931 = {{&term54, &state937}};
+std::vector<Reduce> reduce931 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift933 = {{&term53, &state934}, {&term57, &state110}};
+std::vector<Reduce> reduce933 = {};
+std::vector<Shift> shift935 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state936}};
+std::vector<Reduce> reduce935 = {};
+std::vector<Shift> shift938 = {{&term53, &state939}, {&term57, &state110}};
+std::vector<Reduce> reduce938 = {};
+std::vector<Shift> shift940 = {{&term54, &state946}};
+std::vector<Reduce> reduce940 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift942 = {{&term53, &state943}, {&term57, &state110}};
+std::vector<Reduce> reduce942 = {};
+std::vector<Shift> shift944 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state945}};
+std::vector<Reduce> reduce944 = {};
+std::vector<Shift> shift947 = {{&term53, &state948}, {&term57, &state110}};
+std::vector<Reduce> reduce947 = {};
+std::vector<Shift> shift949 = {{&term54, &state955}};
+std::vector<Reduce> reduce949 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift951 = {{&term53, &state952}, {&term57, &state110}};
+std::vector<Reduce> reduce951 = {};
+std::vector<Shift> shift953 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state954}};
+std::vector<Reduce> reduce953 = {};
+std::vector<Shift> shift956 = {{&term53, &state957}, {&term57, &state110}};
+std::vector<Reduce> reduce956 = {};
+std::vector<Shift> shift958 = {{&term54, &state964}};
+std::vector<Reduce> reduce958 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift960 = {{&term53, &state961}, {&term57, &state110}};
+std::vector<Reduce> reduce960 = {};
+std::vector<Shift> shift962 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state963}};
+std::vector<Reduce> reduce962 = {};
+std::vector<Shift> shift965 = {{&term53, &state966}, {&term57, &state110}};
+std::vector<Reduce> reduce965 = {};
+std::vector<Shift> shift967 = {{&term54, &state973}};
+std::vector<Reduce> reduce967 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift969 = {{&term53, &state970}, {&term57, &state110}};
+std::vector<Reduce> reduce969 = {};
+std::vector<Shift> shift971 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state972}};
+std::vector<Reduce> reduce971 = {};
+std::vector<Shift> shift974 = {{&term53, &state975}, {&term57, &state110}};
+std::vector<Reduce> reduce974 = {};
+std::vector<Shift> shift976 = {{&term54, &state982}};
+std::vector<Reduce> reduce976 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift978 = {{&term53, &state979}, {&term57, &state110}};
+std::vector<Reduce> reduce978 = {};
+std::vector<Shift> shift980 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state981}};
+std::vector<Reduce> reduce980 = {};
+std::vector<Shift> shift983 = {{&term53, &state984}, {&term57, &state110}};
+std::vector<Reduce> reduce983 = {};
+std::vector<Shift> shift985 = {{&term54, &state991}};
+std::vector<Reduce> reduce985 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift987 = {{&term53, &state988}, {&term57, &state110}};
+std::vector<Reduce> reduce987 = {};
+std::vector<Shift> shift989 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state990}};
+std::vector<Reduce> reduce989 = {};
+std::vector<Shift> shift992 = {{&term53, &state993}, {&term57, &state110}};
+std::vector<Reduce> reduce992 = {};
+std::vector<Shift> shift994 = {{&term54, &state1000}};
+std::vector<Reduce> reduce994 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift996 = {{&term53, &state997}, {&term57, &state110}};
+std::vector<Reduce> reduce996 = {};
+std::vector<Shift> shift998 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state999}};
+std::vector<Reduce> reduce998 = {};
+std::vector<Shift> shift1001 = {{&term53, &state1002}, {&term57, &state110}};
+std::vector<Reduce> reduce1001 = {};
+std::vector<Shift> shift1003 = {{&term54, &state1009}};
+std::vector<Reduce> reduce1003 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1005 = {{&term53, &state1006}, {&term57, &state110}};
+std::vector<Reduce> reduce1005 = {};
+std::vector<Shift> shift1007 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1008}};
+std::vector<Reduce> reduce1007 = {};
+std::vector<Shift> shift1010 = {{&term53, &state1011}, {&term57, &state110}};
+std::vector<Reduce> reduce1010 = {};
+std::vector<Shift> shift1012 = {{&term54, &state1018}};
+std::vector<Reduce> reduce1012 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1014 = {{&term53, &state1015}, {&term57, &state110}};
+std::vector<Reduce> reduce1014 = {};
+std::vector<Shift> shift1016 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1017}};
+std::vector<Reduce> reduce1016 = {};
+std::vector<Shift> shift1019 = {{&term53, &state1020}, {&term57, &state110}};
+std::vector<Reduce> reduce1019 = {};
+std::vector<Shift> shift1021 = {{&term54, &state1027}};
+std::vector<Reduce> reduce1021 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1023 = {{&term53, &state1024}, {&term57, &state110}};
+std::vector<Reduce> reduce1023 = {};
+std::vector<Shift> shift1025 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1026}};
+std::vector<Reduce> reduce1025 = {};
+std::vector<Shift> shift1028 = {{&term53, &state1029}, {&term57, &state110}};
+std::vector<Reduce> reduce1028 = {};
+std::vector<Shift> shift1030 = {{&term54, &state1036}};
+std::vector<Reduce> reduce1030 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1032 = {{&term53, &state1033}, {&term57, &state110}};
+std::vector<Reduce> reduce1032 = {};
+std::vector<Shift> shift1034 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1035}};
+std::vector<Reduce> reduce1034 = {};
+std::vector<Shift> shift1037 = {{&term53, &state1038}, {&term57, &state110}};
+std::vector<Reduce> reduce1037 = {};
+std::vector<Shift> shift1039 = {{&term54, &state1045}};
+std::vector<Reduce> reduce1039 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1041 = {{&term53, &state1042}, {&term57, &state110}};
+std::vector<Reduce> reduce1041 = {};
+std::vector<Shift> shift1043 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1044}};
+std::vector<Reduce> reduce1043 = {};
+std::vector<Shift> shift1046 = {{&term53, &state1047}, {&term57, &state110}};
+std::vector<Reduce> reduce1046 = {};
+std::vector<Shift> shift1048 = {{&term54, &state1054}};
+std::vector<Reduce> reduce1048 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1050 = {{&term53, &state1051}, {&term57, &state110}};
+std::vector<Reduce> reduce1050 = {};
+std::vector<Shift> shift1052 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1053}};
+std::vector<Reduce> reduce1052 = {};
+std::vector<Shift> shift1055 = {{&term53, &state1056}, {&term57, &state110}};
+std::vector<Reduce> reduce1055 = {};
+std::vector<Shift> shift1057 = {{&term54, &state1063}};
+std::vector<Reduce> reduce1057 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1059 = {{&term53, &state1060}, {&term57, &state110}};
+std::vector<Reduce> reduce1059 = {};
+std::vector<Shift> shift1061 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1062}};
+std::vector<Reduce> reduce1061 = {};
+std::vector<Shift> shift1064 = {{&term53, &state1065}, {&term57, &state110}};
+std::vector<Reduce> reduce1064 = {};
+std::vector<Shift> shift1066 = {{&term54, &state1072}};
+std::vector<Reduce> reduce1066 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1068 = {{&term53, &state1069}, {&term57, &state110}};
+std::vector<Reduce> reduce1068 = {};
+std::vector<Shift> shift1070 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1071}};
+std::vector<Reduce> reduce1070 = {};
+std::vector<Shift> shift1073 = {{&term53, &state1074}, {&term57, &state110}};
+std::vector<Reduce> reduce1073 = {};
+std::vector<Shift> shift1075 = {{&term54, &state1081}};
+std::vector<Reduce> reduce1075 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1077 = {{&term53, &state1078}, {&term57, &state110}};
+std::vector<Reduce> reduce1077 = {};
+std::vector<Shift> shift1079 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1080}};
+std::vector<Reduce> reduce1079 = {};
+std::vector<Shift> shift1082 = {{&term53, &state1083}, {&term57, &state110}};
+std::vector<Reduce> reduce1082 = {};
+std::vector<Shift> shift1084 = {{&term54, &state1090}};
+std::vector<Reduce> reduce1084 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1086 = {{&term53, &state1087}, {&term57, &state110}};
+std::vector<Reduce> reduce1086 = {};
+std::vector<Shift> shift1088 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1089}};
+std::vector<Reduce> reduce1088 = {};
+std::vector<Shift> shift1091 = {{&term53, &state1092}, {&term57, &state110}};
+std::vector<Reduce> reduce1091 = {};
+std::vector<Shift> shift1093 = {{&term54, &state1099}};
+std::vector<Reduce> reduce1093 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1095 = {{&term53, &state1096}, {&term57, &state110}};
+std::vector<Reduce> reduce1095 = {};
+std::vector<Shift> shift1097 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1098}};
+std::vector<Reduce> reduce1097 = {};
+std::vector<Shift> shift1100 = {{&term53, &state1101}, {&term57, &state110}};
+std::vector<Reduce> reduce1100 = {};
+std::vector<Shift> shift1102 = {{&term54, &state1108}};
+std::vector<Reduce> reduce1102 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1104 = {{&term53, &state1105}, {&term57, &state110}};
+std::vector<Reduce> reduce1104 = {};
+std::vector<Shift> shift1106 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1107}};
+std::vector<Reduce> reduce1106 = {};
+std::vector<Shift> shift1109 = {{&term53, &state1110}, {&term57, &state110}};
+std::vector<Reduce> reduce1109 = {};
+std::vector<Shift> shift1111 = {{&term54, &state1117}};
+std::vector<Reduce> reduce1111 = {{nullptr, &rule206, false}};
+std::vector<Shift> shift1113 = {{&term53, &state1114}, {&term57, &state110}};
+std::vector<Reduce> reduce1113 = {};
+std::vector<Shift> shift1115 = {{&term0, &state124}, {&term1, &state125}, {&term2, &state126}, {&term3, &state127}, {&term4, &state128}, {&term5, &state129}, {&term6, &state130}, {&term7, &state131}, {&term8, &state132}, {&term9, &state133}, {&term10, &state134}, {&term11, &state135}, {&term12, &state136}, {&term13, &state137}, {&term14, &state138}, {&term15, &state139}, {&term16, &state140}, {&term17, &state141}, {&term18, &state142}, {&term19, &state143}, {&term20, &state144}, {&term21, &state145}, {&term22, &state146}, {&term23, &state147}, {&term24, &state148}, {&term25, &state149}, {&term26, &state150}, {&term27, &state151}, {&term28, &state152}, {&term29, &state153}, {&term30, &state154}, {&term31, &state155}, {&term32, &state156}, {&term33, &state157}, {&term34, &state158}, {&term35, &state159}, {&term36, &state160}, {&term37, &state161}, {&term38, &state162}, {&term39, &state163}, {&term40, &state164}, {&term41, &state165}, {&term42, &state166}, {&term43, &state167}, {&term44, &state168}, {&term45, &state169}, {&term46, &state170}, {&term47, &state171}, {&term48, &state172}, {&term49, &state173}, {&term56, &state1116}};
+std::vector<Reduce> reduce1115 = {};
+std::vector<Shift> shift1118 = {{&term53, &state1119}, {&term57, &state110}};
+std::vector<Reduce> reduce1118 = {};
+
+std::vector<Go> go0 = {{&nonterm1, &state1}};
+std::vector<Go> go1 = {{&nonterm2, &state52}, {&nonterm3, &state53}, {&nonterm4, &state54}, {&nonterm5, &state55}, {&nonterm6, &state56}, {&nonterm7, &state57}, {&nonterm8, &state58}, {&nonterm9, &state59}, {&nonterm10, &state60}, {&nonterm11, &state61}, {&nonterm12, &state62}, {&nonterm13, &state63}, {&nonterm14, &state64}, {&nonterm15, &state65}, {&nonterm16, &state66}, {&nonterm17, &state67}, {&nonterm18, &state68}, {&nonterm19, &state69}, {&nonterm20, &state70}, {&nonterm21, &state71}, {&nonterm22, &state72}, {&nonterm23, &state73}, {&nonterm24, &state74}, {&nonterm25, &state75}, {&nonterm26, &state76}, {&nonterm27, &state77}, {&nonterm28, &state78}, {&nonterm29, &state79}, {&nonterm30, &state80}, {&nonterm31, &state81}, {&nonterm32, &state82}, {&nonterm33, &state83}, {&nonterm34, &state84}, {&nonterm35, &state85}, {&nonterm36, &state86}, {&nonterm37, &state87}, {&nonterm38, &state88}, {&nonterm39, &state89}, {&nonterm40, &state90}, {&nonterm41, &state91}, {&nonterm42, &state92}, {&nonterm43, &state93}, {&nonterm44, &state94}, {&nonterm45, &state95}, {&nonterm46, &state96}, {&nonterm47, &state97}, {&nonterm48, &state98}, {&nonterm49, &state99}, {&nonterm50, &state100}, {&nonterm51, &state101}, {&nonterm52, &state102}};
+std::vector<Go> go2 = {{&nonterm53, &state1113}, {&nonterm54, &state108}};
+std::vector<Go> go3 = {{&nonterm53, &state1104}, {&nonterm54, &state108}};
+std::vector<Go> go4 = {{&nonterm53, &state1095}, {&nonterm54, &state108}};
+std::vector<Go> go5 = {{&nonterm53, &state1086}, {&nonterm54, &state108}};
+std::vector<Go> go6 = {{&nonterm53, &state1077}, {&nonterm54, &state108}};
+std::vector<Go> go7 = {{&nonterm53, &state1068}, {&nonterm54, &state108}};
+std::vector<Go> go8 = {{&nonterm53, &state1059}, {&nonterm54, &state108}};
+std::vector<Go> go9 = {{&nonterm53, &state1050}, {&nonterm54, &state108}};
+std::vector<Go> go10 = {{&nonterm53, &state1041}, {&nonterm54, &state108}};
+std::vector<Go> go11 = {{&nonterm53, &state1032}, {&nonterm54, &state108}};
+std::vector<Go> go12 = {{&nonterm53, &state1023}, {&nonterm54, &state108}};
+std::vector<Go> go13 = {{&nonterm53, &state1014}, {&nonterm54, &state108}};
+std::vector<Go> go14 = {{&nonterm53, &state1005}, {&nonterm54, &state108}};
+std::vector<Go> go15 = {{&nonterm53, &state996}, {&nonterm54, &state108}};
+std::vector<Go> go16 = {{&nonterm53, &state987}, {&nonterm54, &state108}};
+std::vector<Go> go17 = {{&nonterm53, &state978}, {&nonterm54, &state108}};
+std::vector<Go> go18 = {{&nonterm53, &state969}, {&nonterm54, &state108}};
+std::vector<Go> go19 = {{&nonterm53, &state960}, {&nonterm54, &state108}};
+std::vector<Go> go20 = {{&nonterm53, &state951}, {&nonterm54, &state108}};
+std::vector<Go> go21 = {{&nonterm53, &state942}, {&nonterm54, &state108}};
+std::vector<Go> go22 = {{&nonterm53, &state933}, {&nonterm54, &state108}};
+std::vector<Go> go23 = {{&nonterm53, &state924}, {&nonterm54, &state108}};
+std::vector<Go> go24 = {{&nonterm53, &state915}, {&nonterm54, &state108}};
+std::vector<Go> go25 = {{&nonterm53, &state906}, {&nonterm54, &state108}};
+std::vector<Go> go26 = {{&nonterm53, &state897}, {&nonterm54, &state108}};
+std::vector<Go> go27 = {{&nonterm53, &state888}, {&nonterm54, &state108}};
+std::vector<Go> go28 = {{&nonterm53, &state879}, {&nonterm54, &state108}};
+std::vector<Go> go29 = {{&nonterm53, &state870}, {&nonterm54, &state108}};
+std::vector<Go> go30 = {{&nonterm53, &state861}, {&nonterm54, &state108}};
+std::vector<Go> go31 = {{&nonterm53, &state852}, {&nonterm54, &state108}};
+std::vector<Go> go32 = {{&nonterm53, &state843}, {&nonterm54, &state108}};
+std::vector<Go> go33 = {{&nonterm53, &state834}, {&nonterm54, &state108}};
+std::vector<Go> go34 = {{&nonterm53, &state825}, {&nonterm54, &state108}};
+std::vector<Go> go35 = {{&nonterm53, &state816}, {&nonterm54, &state108}};
+std::vector<Go> go36 = {{&nonterm53, &state807}, {&nonterm54, &state108}};
+std::vector<Go> go37 = {{&nonterm53, &state798}, {&nonterm54, &state108}};
+std::vector<Go> go38 = {{&nonterm53, &state789}, {&nonterm54, &state108}};
+std::vector<Go> go39 = {{&nonterm53, &state780}, {&nonterm54, &state108}};
+std::vector<Go> go40 = {{&nonterm53, &state771}, {&nonterm54, &state108}};
+std::vector<Go> go41 = {{&nonterm53, &state762}, {&nonterm54, &state108}};
+std::vector<Go> go42 = {{&nonterm53, &state753}, {&nonterm54, &state108}};
+std::vector<Go> go43 = {{&nonterm53, &state744}, {&nonterm54, &state108}};
+std::vector<Go> go44 = {{&nonterm53, &state735}, {&nonterm54, &state108}};
+std::vector<Go> go45 = {{&nonterm53, &state726}, {&nonterm54, &state108}};
+std::vector<Go> go46 = {{&nonterm53, &state717}, {&nonterm54, &state108}};
+std::vector<Go> go47 = {{&nonterm53, &state708}, {&nonterm54, &state108}};
+std::vector<Go> go48 = {{&nonterm53, &state699}, {&nonterm54, &state108}};
+std::vector<Go> go49 = {{&nonterm53, &state690}, {&nonterm54, &state108}};
+std::vector<Go> go50 = {{&nonterm53, &state681}, {&nonterm54, &state108}};
+std::vector<Go> go51 = {{&nonterm53, &state107}, {&nonterm54, &state108}};
+std::vector<Go> go105 = {{&nonterm1, &state123}};
+std::vector<Go> go106 = {{&nonterm53, &state116}, {&nonterm54, &state117}};
+std::vector<Go> go110 = {{&nonterm54, &state112}};
+std::vector<Go> go115 = {{&nonterm53, &state121}, {&nonterm54, &state117}};
+std::vector<Go> go118 = {{&nonterm54, &state120}};
+std::vector<Go> go123 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go124 = {{&nonterm53, &state669}, {&nonterm54, &state108}};
+std::vector<Go> go125 = {{&nonterm53, &state660}, {&nonterm54, &state108}};
+std::vector<Go> go126 = {{&nonterm53, &state651}, {&nonterm54, &state108}};
+std::vector<Go> go127 = {{&nonterm53, &state642}, {&nonterm54, &state108}};
+std::vector<Go> go128 = {{&nonterm53, &state633}, {&nonterm54, &state108}};
+std::vector<Go> go129 = {{&nonterm53, &state624}, {&nonterm54, &state108}};
+std::vector<Go> go130 = {{&nonterm53, &state615}, {&nonterm54, &state108}};
+std::vector<Go> go131 = {{&nonterm53, &state606}, {&nonterm54, &state108}};
+std::vector<Go> go132 = {{&nonterm53, &state597}, {&nonterm54, &state108}};
+std::vector<Go> go133 = {{&nonterm53, &state588}, {&nonterm54, &state108}};
+std::vector<Go> go134 = {{&nonterm53, &state579}, {&nonterm54, &state108}};
+std::vector<Go> go135 = {{&nonterm53, &state570}, {&nonterm54, &state108}};
+std::vector<Go> go136 = {{&nonterm53, &state561}, {&nonterm54, &state108}};
+std::vector<Go> go137 = {{&nonterm53, &state552}, {&nonterm54, &state108}};
+std::vector<Go> go138 = {{&nonterm53, &state543}, {&nonterm54, &state108}};
+std::vector<Go> go139 = {{&nonterm53, &state534}, {&nonterm54, &state108}};
+std::vector<Go> go140 = {{&nonterm53, &state525}, {&nonterm54, &state108}};
+std::vector<Go> go141 = {{&nonterm53, &state516}, {&nonterm54, &state108}};
+std::vector<Go> go142 = {{&nonterm53, &state507}, {&nonterm54, &state108}};
+std::vector<Go> go143 = {{&nonterm53, &state498}, {&nonterm54, &state108}};
+std::vector<Go> go144 = {{&nonterm53, &state489}, {&nonterm54, &state108}};
+std::vector<Go> go145 = {{&nonterm53, &state480}, {&nonterm54, &state108}};
+std::vector<Go> go146 = {{&nonterm53, &state471}, {&nonterm54, &state108}};
+std::vector<Go> go147 = {{&nonterm53, &state462}, {&nonterm54, &state108}};
+std::vector<Go> go148 = {{&nonterm53, &state453}, {&nonterm54, &state108}};
+std::vector<Go> go149 = {{&nonterm53, &state444}, {&nonterm54, &state108}};
+std::vector<Go> go150 = {{&nonterm53, &state435}, {&nonterm54, &state108}};
+std::vector<Go> go151 = {{&nonterm53, &state426}, {&nonterm54, &state108}};
+std::vector<Go> go152 = {{&nonterm53, &state417}, {&nonterm54, &state108}};
+std::vector<Go> go153 = {{&nonterm53, &state408}, {&nonterm54, &state108}};
+std::vector<Go> go154 = {{&nonterm53, &state399}, {&nonterm54, &state108}};
+std::vector<Go> go155 = {{&nonterm53, &state390}, {&nonterm54, &state108}};
+std::vector<Go> go156 = {{&nonterm53, &state381}, {&nonterm54, &state108}};
+std::vector<Go> go157 = {{&nonterm53, &state372}, {&nonterm54, &state108}};
+std::vector<Go> go158 = {{&nonterm53, &state363}, {&nonterm54, &state108}};
+std::vector<Go> go159 = {{&nonterm53, &state354}, {&nonterm54, &state108}};
+std::vector<Go> go160 = {{&nonterm53, &state345}, {&nonterm54, &state108}};
+std::vector<Go> go161 = {{&nonterm53, &state336}, {&nonterm54, &state108}};
+std::vector<Go> go162 = {{&nonterm53, &state327}, {&nonterm54, &state108}};
+std::vector<Go> go163 = {{&nonterm53, &state318}, {&nonterm54, &state108}};
+std::vector<Go> go164 = {{&nonterm53, &state309}, {&nonterm54, &state108}};
+std::vector<Go> go165 = {{&nonterm53, &state300}, {&nonterm54, &state108}};
+std::vector<Go> go166 = {{&nonterm53, &state291}, {&nonterm54, &state108}};
+std::vector<Go> go167 = {{&nonterm53, &state282}, {&nonterm54, &state108}};
+std::vector<Go> go168 = {{&nonterm53, &state273}, {&nonterm54, &state108}};
+std::vector<Go> go169 = {{&nonterm53, &state264}, {&nonterm54, &state108}};
+std::vector<Go> go170 = {{&nonterm53, &state255}, {&nonterm54, &state108}};
+std::vector<Go> go171 = {{&nonterm53, &state246}, {&nonterm54, &state108}};
+std::vector<Go> go172 = {{&nonterm53, &state237}, {&nonterm54, &state108}};
+std::vector<Go> go173 = {{&nonterm53, &state228}, {&nonterm54, &state108}};
+std::vector<Go> go227 = {{&nonterm1, &state230}};
+std::vector<Go> go230 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go232 = {{&nonterm53, &state233}, {&nonterm54, &state108}};
+std::vector<Go> go236 = {{&nonterm1, &state239}};
+std::vector<Go> go239 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go241 = {{&nonterm53, &state242}, {&nonterm54, &state108}};
+std::vector<Go> go245 = {{&nonterm1, &state248}};
+std::vector<Go> go248 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go250 = {{&nonterm53, &state251}, {&nonterm54, &state108}};
+std::vector<Go> go254 = {{&nonterm1, &state257}};
+std::vector<Go> go257 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go259 = {{&nonterm53, &state260}, {&nonterm54, &state108}};
+std::vector<Go> go263 = {{&nonterm1, &state266}};
+std::vector<Go> go266 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go268 = {{&nonterm53, &state269}, {&nonterm54, &state108}};
+std::vector<Go> go272 = {{&nonterm1, &state275}};
+std::vector<Go> go275 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go277 = {{&nonterm53, &state278}, {&nonterm54, &state108}};
+std::vector<Go> go281 = {{&nonterm1, &state284}};
+std::vector<Go> go284 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go286 = {{&nonterm53, &state287}, {&nonterm54, &state108}};
+std::vector<Go> go290 = {{&nonterm1, &state293}};
+std::vector<Go> go293 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go295 = {{&nonterm53, &state296}, {&nonterm54, &state108}};
+std::vector<Go> go299 = {{&nonterm1, &state302}};
+std::vector<Go> go302 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go304 = {{&nonterm53, &state305}, {&nonterm54, &state108}};
+std::vector<Go> go308 = {{&nonterm1, &state311}};
+std::vector<Go> go311 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go313 = {{&nonterm53, &state314}, {&nonterm54, &state108}};
+std::vector<Go> go317 = {{&nonterm1, &state320}};
+std::vector<Go> go320 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go322 = {{&nonterm53, &state323}, {&nonterm54, &state108}};
+std::vector<Go> go326 = {{&nonterm1, &state329}};
+std::vector<Go> go329 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go331 = {{&nonterm53, &state332}, {&nonterm54, &state108}};
+std::vector<Go> go335 = {{&nonterm1, &state338}};
+std::vector<Go> go338 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go340 = {{&nonterm53, &state341}, {&nonterm54, &state108}};
+std::vector<Go> go344 = {{&nonterm1, &state347}};
+std::vector<Go> go347 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go349 = {{&nonterm53, &state350}, {&nonterm54, &state108}};
+std::vector<Go> go353 = {{&nonterm1, &state356}};
+std::vector<Go> go356 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go358 = {{&nonterm53, &state359}, {&nonterm54, &state108}};
+std::vector<Go> go362 = {{&nonterm1, &state365}};
+std::vector<Go> go365 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go367 = {{&nonterm53, &state368}, {&nonterm54, &state108}};
+std::vector<Go> go371 = {{&nonterm1, &state374}};
+std::vector<Go> go374 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go376 = {{&nonterm53, &state377}, {&nonterm54, &state108}};
+std::vector<Go> go380 = {{&nonterm1, &state383}};
+std::vector<Go> go383 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go385 = {{&nonterm53, &state386}, {&nonterm54, &state108}};
+std::vector<Go> go389 = {{&nonterm1, &state392}};
+std::vector<Go> go392 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go394 = {{&nonterm53, &state395}, {&nonterm54, &state108}};
+std::vector<Go> go398 = {{&nonterm1, &state401}};
+std::vector<Go> go401 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go403 = {{&nonterm53, &state404}, {&nonterm54, &state108}};
+std::vector<Go> go407 = {{&nonterm1, &state410}};
+std::vector<Go> go410 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go412 = {{&nonterm53, &state413}, {&nonterm54, &state108}};
+std::vector<Go> go416 = {{&nonterm1, &state419}};
+std::vector<Go> go419 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go421 = {{&nonterm53, &state422}, {&nonterm54, &state108}};
+std::vector<Go> go425 = {{&nonterm1, &state428}};
+std::vector<Go> go428 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go430 = {{&nonterm53, &state431}, {&nonterm54, &state108}};
+std::vector<Go> go434 = {{&nonterm1, &state437}};
+std::vector<Go> go437 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go439 = {{&nonterm53, &state440}, {&nonterm54, &state108}};
+std::vector<Go> go443 = {{&nonterm1, &state446}};
+std::vector<Go> go446 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go448 = {{&nonterm53, &state449}, {&nonterm54, &state108}};
+std::vector<Go> go452 = {{&nonterm1, &state455}};
+std::vector<Go> go455 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go457 = {{&nonterm53, &state458}, {&nonterm54, &state108}};
+std::vector<Go> go461 = {{&nonterm1, &state464}};
+std::vector<Go> go464 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go466 = {{&nonterm53, &state467}, {&nonterm54, &state108}};
+std::vector<Go> go470 = {{&nonterm1, &state473}};
+std::vector<Go> go473 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go475 = {{&nonterm53, &state476}, {&nonterm54, &state108}};
+std::vector<Go> go479 = {{&nonterm1, &state482}};
+std::vector<Go> go482 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go484 = {{&nonterm53, &state485}, {&nonterm54, &state108}};
+std::vector<Go> go488 = {{&nonterm1, &state491}};
+std::vector<Go> go491 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go493 = {{&nonterm53, &state494}, {&nonterm54, &state108}};
+std::vector<Go> go497 = {{&nonterm1, &state500}};
+std::vector<Go> go500 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go502 = {{&nonterm53, &state503}, {&nonterm54, &state108}};
+std::vector<Go> go506 = {{&nonterm1, &state509}};
+std::vector<Go> go509 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go511 = {{&nonterm53, &state512}, {&nonterm54, &state108}};
+std::vector<Go> go515 = {{&nonterm1, &state518}};
+std::vector<Go> go518 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go520 = {{&nonterm53, &state521}, {&nonterm54, &state108}};
+std::vector<Go> go524 = {{&nonterm1, &state527}};
+std::vector<Go> go527 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go529 = {{&nonterm53, &state530}, {&nonterm54, &state108}};
+std::vector<Go> go533 = {{&nonterm1, &state536}};
+std::vector<Go> go536 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go538 = {{&nonterm53, &state539}, {&nonterm54, &state108}};
+std::vector<Go> go542 = {{&nonterm1, &state545}};
+std::vector<Go> go545 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go547 = {{&nonterm53, &state548}, {&nonterm54, &state108}};
+std::vector<Go> go551 = {{&nonterm1, &state554}};
+std::vector<Go> go554 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go556 = {{&nonterm53, &state557}, {&nonterm54, &state108}};
+std::vector<Go> go560 = {{&nonterm1, &state563}};
+std::vector<Go> go563 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go565 = {{&nonterm53, &state566}, {&nonterm54, &state108}};
+std::vector<Go> go569 = {{&nonterm1, &state572}};
+std::vector<Go> go572 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go574 = {{&nonterm53, &state575}, {&nonterm54, &state108}};
+std::vector<Go> go578 = {{&nonterm1, &state581}};
+std::vector<Go> go581 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go583 = {{&nonterm53, &state584}, {&nonterm54, &state108}};
+std::vector<Go> go587 = {{&nonterm1, &state590}};
+std::vector<Go> go590 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go592 = {{&nonterm53, &state593}, {&nonterm54, &state108}};
+std::vector<Go> go596 = {{&nonterm1, &state599}};
+std::vector<Go> go599 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go601 = {{&nonterm53, &state602}, {&nonterm54, &state108}};
+std::vector<Go> go605 = {{&nonterm1, &state608}};
+std::vector<Go> go608 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go610 = {{&nonterm53, &state611}, {&nonterm54, &state108}};
+std::vector<Go> go614 = {{&nonterm1, &state617}};
+std::vector<Go> go617 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go619 = {{&nonterm53, &state620}, {&nonterm54, &state108}};
+std::vector<Go> go623 = {{&nonterm1, &state626}};
+std::vector<Go> go626 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go628 = {{&nonterm53, &state629}, {&nonterm54, &state108}};
+std::vector<Go> go632 = {{&nonterm1, &state635}};
+std::vector<Go> go635 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go637 = {{&nonterm53, &state638}, {&nonterm54, &state108}};
+std::vector<Go> go641 = {{&nonterm1, &state644}};
+std::vector<Go> go644 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go646 = {{&nonterm53, &state647}, {&nonterm54, &state108}};
+std::vector<Go> go650 = {{&nonterm1, &state653}};
+std::vector<Go> go653 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go655 = {{&nonterm53, &state656}, {&nonterm54, &state108}};
+std::vector<Go> go659 = {{&nonterm1, &state662}};
+std::vector<Go> go662 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go664 = {{&nonterm53, &state665}, {&nonterm54, &state108}};
+std::vector<Go> go668 = {{&nonterm1, &state671}};
+std::vector<Go> go671 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go673 = {{&nonterm53, &state674}, {&nonterm54, &state108}};
+std::vector<Go> go676 = {{&nonterm53, &state677}, {&nonterm54, &state108}};
+std::vector<Go> go680 = {{&nonterm1, &state683}};
+std::vector<Go> go683 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go685 = {{&nonterm53, &state686}, {&nonterm54, &state108}};
+std::vector<Go> go689 = {{&nonterm1, &state692}};
+std::vector<Go> go692 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go694 = {{&nonterm53, &state695}, {&nonterm54, &state108}};
+std::vector<Go> go698 = {{&nonterm1, &state701}};
+std::vector<Go> go701 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go703 = {{&nonterm53, &state704}, {&nonterm54, &state108}};
+std::vector<Go> go707 = {{&nonterm1, &state710}};
+std::vector<Go> go710 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go712 = {{&nonterm53, &state713}, {&nonterm54, &state108}};
+std::vector<Go> go716 = {{&nonterm1, &state719}};
+std::vector<Go> go719 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go721 = {{&nonterm53, &state722}, {&nonterm54, &state108}};
+std::vector<Go> go725 = {{&nonterm1, &state728}};
+std::vector<Go> go728 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go730 = {{&nonterm53, &state731}, {&nonterm54, &state108}};
+std::vector<Go> go734 = {{&nonterm1, &state737}};
+std::vector<Go> go737 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go739 = {{&nonterm53, &state740}, {&nonterm54, &state108}};
+std::vector<Go> go743 = {{&nonterm1, &state746}};
+std::vector<Go> go746 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go748 = {{&nonterm53, &state749}, {&nonterm54, &state108}};
+std::vector<Go> go752 = {{&nonterm1, &state755}};
+std::vector<Go> go755 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go757 = {{&nonterm53, &state758}, {&nonterm54, &state108}};
+std::vector<Go> go761 = {{&nonterm1, &state764}};
+std::vector<Go> go764 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go766 = {{&nonterm53, &state767}, {&nonterm54, &state108}};
+std::vector<Go> go770 = {{&nonterm1, &state773}};
+std::vector<Go> go773 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go775 = {{&nonterm53, &state776}, {&nonterm54, &state108}};
+std::vector<Go> go779 = {{&nonterm1, &state782}};
+std::vector<Go> go782 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go784 = {{&nonterm53, &state785}, {&nonterm54, &state108}};
+std::vector<Go> go788 = {{&nonterm1, &state791}};
+std::vector<Go> go791 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go793 = {{&nonterm53, &state794}, {&nonterm54, &state108}};
+std::vector<Go> go797 = {{&nonterm1, &state800}};
+std::vector<Go> go800 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go802 = {{&nonterm53, &state803}, {&nonterm54, &state108}};
+std::vector<Go> go806 = {{&nonterm1, &state809}};
+std::vector<Go> go809 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go811 = {{&nonterm53, &state812}, {&nonterm54, &state108}};
+std::vector<Go> go815 = {{&nonterm1, &state818}};
+std::vector<Go> go818 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go820 = {{&nonterm53, &state821}, {&nonterm54, &state108}};
+std::vector<Go> go824 = {{&nonterm1, &state827}};
+std::vector<Go> go827 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go829 = {{&nonterm53, &state830}, {&nonterm54, &state108}};
+std::vector<Go> go833 = {{&nonterm1, &state836}};
+std::vector<Go> go836 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go838 = {{&nonterm53, &state839}, {&nonterm54, &state108}};
+std::vector<Go> go842 = {{&nonterm1, &state845}};
+std::vector<Go> go845 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go847 = {{&nonterm53, &state848}, {&nonterm54, &state108}};
+std::vector<Go> go851 = {{&nonterm1, &state854}};
+std::vector<Go> go854 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go856 = {{&nonterm53, &state857}, {&nonterm54, &state108}};
+std::vector<Go> go860 = {{&nonterm1, &state863}};
+std::vector<Go> go863 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go865 = {{&nonterm53, &state866}, {&nonterm54, &state108}};
+std::vector<Go> go869 = {{&nonterm1, &state872}};
+std::vector<Go> go872 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go874 = {{&nonterm53, &state875}, {&nonterm54, &state108}};
+std::vector<Go> go878 = {{&nonterm1, &state881}};
+std::vector<Go> go881 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go883 = {{&nonterm53, &state884}, {&nonterm54, &state108}};
+std::vector<Go> go887 = {{&nonterm1, &state890}};
+std::vector<Go> go890 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go892 = {{&nonterm53, &state893}, {&nonterm54, &state108}};
+std::vector<Go> go896 = {{&nonterm1, &state899}};
+std::vector<Go> go899 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go901 = {{&nonterm53, &state902}, {&nonterm54, &state108}};
+std::vector<Go> go905 = {{&nonterm1, &state908}};
+std::vector<Go> go908 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go910 = {{&nonterm53, &state911}, {&nonterm54, &state108}};
+std::vector<Go> go914 = {{&nonterm1, &state917}};
+std::vector<Go> go917 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go919 = {{&nonterm53, &state920}, {&nonterm54, &state108}};
+std::vector<Go> go923 = {{&nonterm1, &state926}};
+std::vector<Go> go926 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go928 = {{&nonterm53, &state929}, {&nonterm54, &state108}};
+std::vector<Go> go932 = {{&nonterm1, &state935}};
+std::vector<Go> go935 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go937 = {{&nonterm53, &state938}, {&nonterm54, &state108}};
+std::vector<Go> go941 = {{&nonterm1, &state944}};
+std::vector<Go> go944 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go946 = {{&nonterm53, &state947}, {&nonterm54, &state108}};
+std::vector<Go> go950 = {{&nonterm1, &state953}};
+std::vector<Go> go953 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go955 = {{&nonterm53, &state956}, {&nonterm54, &state108}};
+std::vector<Go> go959 = {{&nonterm1, &state962}};
+std::vector<Go> go962 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go964 = {{&nonterm53, &state965}, {&nonterm54, &state108}};
+std::vector<Go> go968 = {{&nonterm1, &state971}};
+std::vector<Go> go971 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go973 = {{&nonterm53, &state974}, {&nonterm54, &state108}};
+std::vector<Go> go977 = {{&nonterm1, &state980}};
+std::vector<Go> go980 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go982 = {{&nonterm53, &state983}, {&nonterm54, &state108}};
+std::vector<Go> go986 = {{&nonterm1, &state989}};
+std::vector<Go> go989 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go991 = {{&nonterm53, &state992}, {&nonterm54, &state108}};
+std::vector<Go> go995 = {{&nonterm1, &state998}};
+std::vector<Go> go998 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1000 = {{&nonterm53, &state1001}, {&nonterm54, &state108}};
+std::vector<Go> go1004 = {{&nonterm1, &state1007}};
+std::vector<Go> go1007 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1009 = {{&nonterm53, &state1010}, {&nonterm54, &state108}};
+std::vector<Go> go1013 = {{&nonterm1, &state1016}};
+std::vector<Go> go1016 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1018 = {{&nonterm53, &state1019}, {&nonterm54, &state108}};
+std::vector<Go> go1022 = {{&nonterm1, &state1025}};
+std::vector<Go> go1025 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1027 = {{&nonterm53, &state1028}, {&nonterm54, &state108}};
+std::vector<Go> go1031 = {{&nonterm1, &state1034}};
+std::vector<Go> go1034 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1036 = {{&nonterm53, &state1037}, {&nonterm54, &state108}};
+std::vector<Go> go1040 = {{&nonterm1, &state1043}};
+std::vector<Go> go1043 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1045 = {{&nonterm53, &state1046}, {&nonterm54, &state108}};
+std::vector<Go> go1049 = {{&nonterm1, &state1052}};
+std::vector<Go> go1052 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1054 = {{&nonterm53, &state1055}, {&nonterm54, &state108}};
+std::vector<Go> go1058 = {{&nonterm1, &state1061}};
+std::vector<Go> go1061 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1063 = {{&nonterm53, &state1064}, {&nonterm54, &state108}};
+std::vector<Go> go1067 = {{&nonterm1, &state1070}};
+std::vector<Go> go1070 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1072 = {{&nonterm53, &state1073}, {&nonterm54, &state108}};
+std::vector<Go> go1076 = {{&nonterm1, &state1079}};
+std::vector<Go> go1079 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1081 = {{&nonterm53, &state1082}, {&nonterm54, &state108}};
+std::vector<Go> go1085 = {{&nonterm1, &state1088}};
+std::vector<Go> go1088 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1090 = {{&nonterm53, &state1091}, {&nonterm54, &state108}};
+std::vector<Go> go1094 = {{&nonterm1, &state1097}};
+std::vector<Go> go1097 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1099 = {{&nonterm53, &state1100}, {&nonterm54, &state108}};
+std::vector<Go> go1103 = {{&nonterm1, &state1106}};
+std::vector<Go> go1106 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1108 = {{&nonterm53, &state1109}, {&nonterm54, &state108}};
+std::vector<Go> go1112 = {{&nonterm1, &state1115}};
+std::vector<Go> go1115 = {{&nonterm2, &state175}, {&nonterm3, &state176}, {&nonterm4, &state177}, {&nonterm5, &state178}, {&nonterm6, &state179}, {&nonterm7, &state180}, {&nonterm8, &state181}, {&nonterm9, &state182}, {&nonterm10, &state183}, {&nonterm11, &state184}, {&nonterm12, &state185}, {&nonterm13, &state186}, {&nonterm14, &state187}, {&nonterm15, &state188}, {&nonterm16, &state189}, {&nonterm17, &state190}, {&nonterm18, &state191}, {&nonterm19, &state192}, {&nonterm20, &state193}, {&nonterm21, &state194}, {&nonterm22, &state195}, {&nonterm23, &state196}, {&nonterm24, &state197}, {&nonterm25, &state198}, {&nonterm26, &state199}, {&nonterm27, &state200}, {&nonterm28, &state201}, {&nonterm29, &state202}, {&nonterm30, &state203}, {&nonterm31, &state204}, {&nonterm32, &state205}, {&nonterm33, &state206}, {&nonterm34, &state207}, {&nonterm35, &state208}, {&nonterm36, &state209}, {&nonterm37, &state210}, {&nonterm38, &state211}, {&nonterm39, &state212}, {&nonterm40, &state213}, {&nonterm41, &state214}, {&nonterm42, &state215}, {&nonterm43, &state216}, {&nonterm44, &state217}, {&nonterm45, &state218}, {&nonterm46, &state219}, {&nonterm47, &state220}, {&nonterm48, &state221}, {&nonterm49, &state222}, {&nonterm50, &state223}, {&nonterm51, &state224}, {&nonterm52, &state225}};
+std::vector<Go> go1117 = {{&nonterm53, &state1118}, {&nonterm54, &state108}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, &go1};
+State state2 = {&shift2, &reduce2, &go2};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift4, &reduce4, &go4};
+State state5 = {&shift5, &reduce5, &go5};
+State state6 = {&shift6, &reduce6, &go6};
+State state7 = {&shift7, &reduce7, &go7};
+State state8 = {&shift8, &reduce8, &go8};
+State state9 = {&shift9, &reduce9, &go9};
+State state10 = {&shift10, &reduce10, &go10};
+State state11 = {&shift11, &reduce11, &go11};
+State state12 = {&shift12, &reduce12, &go12};
+State state13 = {&shift13, &reduce13, &go13};
+State state14 = {&shift14, &reduce14, &go14};
+State state15 = {&shift15, &reduce15, &go15};
+State state16 = {&shift16, &reduce16, &go16};
+State state17 = {&shift17, &reduce17, &go17};
+State state18 = {&shift18, &reduce18, &go18};
+State state19 = {&shift19, &reduce19, &go19};
+State state20 = {&shift20, &reduce20, &go20};
+State state21 = {&shift21, &reduce21, &go21};
+State state22 = {&shift22, &reduce22, &go22};
+State state23 = {&shift23, &reduce23, &go23};
+State state24 = {&shift24, &reduce24, &go24};
+State state25 = {&shift25, &reduce25, &go25};
+State state26 = {&shift26, &reduce26, &go26};
+State state27 = {&shift27, &reduce27, &go27};
+State state28 = {&shift28, &reduce28, &go28};
+State state29 = {&shift29, &reduce29, &go29};
+State state30 = {&shift30, &reduce30, &go30};
+State state31 = {&shift31, &reduce31, &go31};
+State state32 = {&shift32, &reduce32, &go32};
+State state33 = {&shift33, &reduce33, &go33};
+State state34 = {&shift34, &reduce34, &go34};
+State state35 = {&shift35, &reduce35, &go35};
+State state36 = {&shift36, &reduce36, &go36};
+State state37 = {&shift37, &reduce37, &go37};
+State state38 = {&shift38, &reduce38, &go38};
+State state39 = {&shift39, &reduce39, &go39};
+State state40 = {&shift40, &reduce40, &go40};
+State state41 = {&shift41, &reduce41, &go41};
+State state42 = {&shift42, &reduce42, &go42};
+State state43 = {&shift43, &reduce43, &go43};
+State state44 = {&shift44, &reduce44, &go44};
+State state45 = {&shift45, &reduce45, &go45};
+State state46 = {&shift46, &reduce46, &go46};
+State state47 = {&shift47, &reduce47, &go47};
+State state48 = {&shift48, &reduce48, &go48};
+State state49 = {&shift49, &reduce49, &go49};
+State state50 = {&shift50, &reduce50, &go50};
+State state51 = {&shift51, &reduce51, &go51};
+State state52 = {&shift52, &reduce52, nullptr};
+State state53 = {&shift53, &reduce53, nullptr};
+State state54 = {&shift54, &reduce54, nullptr};
+State state55 = {&shift55, &reduce55, nullptr};
+State state56 = {&shift56, &reduce56, nullptr};
+State state57 = {&shift57, &reduce57, nullptr};
+State state58 = {&shift58, &reduce58, nullptr};
+State state59 = {&shift59, &reduce59, nullptr};
+State state60 = {&shift60, &reduce60, nullptr};
+State state61 = {&shift61, &reduce61, nullptr};
+State state62 = {&shift62, &reduce62, nullptr};
+State state63 = {&shift63, &reduce63, nullptr};
+State state64 = {&shift64, &reduce64, nullptr};
+State state65 = {&shift65, &reduce65, nullptr};
+State state66 = {&shift66, &reduce66, nullptr};
+State state67 = {&shift67, &reduce67, nullptr};
+State state68 = {&shift68, &reduce68, nullptr};
+State state69 = {&shift69, &reduce69, nullptr};
+State state70 = {&shift70, &reduce70, nullptr};
+State state71 = {&shift71, &reduce71, nullptr};
+State state72 = {&shift72, &reduce72, nullptr};
+State state73 = {&shift73, &reduce73, nullptr};
+State state74 = {&shift74, &reduce74, nullptr};
+State state75 = {&shift75, &reduce75, nullptr};
+State state76 = {&shift76, &reduce76, nullptr};
+State state77 = {&shift77, &reduce77, nullptr};
+State state78 = {&shift78, &reduce78, nullptr};
+State state79 = {&shift79, &reduce79, nullptr};
+State state80 = {&shift80, &reduce80, nullptr};
+State state81 = {&shift81, &reduce81, nullptr};
+State state82 = {&shift82, &reduce82, nullptr};
+State state83 = {&shift83, &reduce83, nullptr};
+State state84 = {&shift84, &reduce84, nullptr};
+State state85 = {&shift85, &reduce85, nullptr};
+State state86 = {&shift86, &reduce86, nullptr};
+State state87 = {&shift87, &reduce87, nullptr};
+State state88 = {&shift88, &reduce88, nullptr};
+State state89 = {&shift89, &reduce89, nullptr};
+State state90 = {&shift90, &reduce90, nullptr};
+State state91 = {&shift91, &reduce91, nullptr};
+State state92 = {&shift92, &reduce92, nullptr};
+State state93 = {&shift93, &reduce93, nullptr};
+State state94 = {&shift94, &reduce94, nullptr};
+State state95 = {&shift95, &reduce95, nullptr};
+State state96 = {&shift96, &reduce96, nullptr};
+State state97 = {&shift97, &reduce97, nullptr};
+State state98 = {&shift98, &reduce98, nullptr};
+State state99 = {&shift99, &reduce99, nullptr};
+State state100 = {&shift100, &reduce100, nullptr};
+State state101 = {&shift101, &reduce101, nullptr};
+State state102 = {&shift102, &reduce102, nullptr};
+State state103 = {&shift103, &reduce103, nullptr};
+State state104 = {&shift104, &reduce104, nullptr};
+State state105 = {&shift0, &reduce0, &go105};
+State state106 = {&shift106, &reduce106, &go106};
+State state107 = {&shift107, &reduce107, nullptr};
+State state108 = {&shift108, &reduce108, nullptr};
+State state109 = {&shift109, &reduce109, nullptr};
+State state110 = {&shift110, &reduce110, &go110};
+State state111 = {&shift111, &reduce111, nullptr};
+State state112 = {&shift112, &reduce112, nullptr};
+State state113 = {&shift103, &reduce103, nullptr};
+State state114 = {&shift111, &reduce111, nullptr};
+State state115 = {&shift106, &reduce106, &go115};
+State state116 = {&shift116, &reduce116, nullptr};
+State state117 = {&shift108, &reduce108, nullptr};
+State state118 = {&shift106, &reduce106, &go118};
+State state119 = {&shift119, &reduce119, nullptr};
+State state120 = {&shift112, &reduce112, nullptr};
+State state121 = {&shift121, &reduce121, nullptr};
+State state122 = {&shift119, &reduce119, nullptr};
+State state123 = {&shift123, &reduce123, &go123};
+State state124 = {&shift124, &reduce124, &go124};
+State state125 = {&shift125, &reduce125, &go125};
+State state126 = {&shift126, &reduce126, &go126};
+State state127 = {&shift127, &reduce127, &go127};
+State state128 = {&shift128, &reduce128, &go128};
+State state129 = {&shift129, &reduce129, &go129};
+State state130 = {&shift130, &reduce130, &go130};
+State state131 = {&shift131, &reduce131, &go131};
+State state132 = {&shift132, &reduce132, &go132};
+State state133 = {&shift133, &reduce133, &go133};
+State state134 = {&shift134, &reduce134, &go134};
+State state135 = {&shift135, &reduce135, &go135};
+State state136 = {&shift136, &reduce136, &go136};
+State state137 = {&shift137, &reduce137, &go137};
+State state138 = {&shift138, &reduce138, &go138};
+State state139 = {&shift139, &reduce139, &go139};
+State state140 = {&shift140, &reduce140, &go140};
+State state141 = {&shift141, &reduce141, &go141};
+State state142 = {&shift142, &reduce142, &go142};
+State state143 = {&shift143, &reduce143, &go143};
+State state144 = {&shift144, &reduce144, &go144};
+State state145 = {&shift145, &reduce145, &go145};
+State state146 = {&shift146, &reduce146, &go146};
+State state147 = {&shift147, &reduce147, &go147};
+State state148 = {&shift148, &reduce148, &go148};
+State state149 = {&shift149, &reduce149, &go149};
+State state150 = {&shift150, &reduce150, &go150};
+State state151 = {&shift151, &reduce151, &go151};
+State state152 = {&shift152, &reduce152, &go152};
+State state153 = {&shift153, &reduce153, &go153};
+State state154 = {&shift154, &reduce154, &go154};
+State state155 = {&shift155, &reduce155, &go155};
+State state156 = {&shift156, &reduce156, &go156};
+State state157 = {&shift157, &reduce157, &go157};
+State state158 = {&shift158, &reduce158, &go158};
+State state159 = {&shift159, &reduce159, &go159};
+State state160 = {&shift160, &reduce160, &go160};
+State state161 = {&shift161, &reduce161, &go161};
+State state162 = {&shift162, &reduce162, &go162};
+State state163 = {&shift163, &reduce163, &go163};
+State state164 = {&shift164, &reduce164, &go164};
+State state165 = {&shift165, &reduce165, &go165};
+State state166 = {&shift166, &reduce166, &go166};
+State state167 = {&shift167, &reduce167, &go167};
+State state168 = {&shift168, &reduce168, &go168};
+State state169 = {&shift169, &reduce169, &go169};
+State state170 = {&shift170, &reduce170, &go170};
+State state171 = {&shift171, &reduce171, &go171};
+State state172 = {&shift172, &reduce172, &go172};
+State state173 = {&shift173, &reduce173, &go173};
+State state174 = {&shift174, &reduce174, nullptr};
+State state175 = {&shift52, &reduce52, nullptr};
+State state176 = {&shift53, &reduce53, nullptr};
+State state177 = {&shift54, &reduce54, nullptr};
+State state178 = {&shift55, &reduce55, nullptr};
+State state179 = {&shift56, &reduce56, nullptr};
+State state180 = {&shift57, &reduce57, nullptr};
+State state181 = {&shift58, &reduce58, nullptr};
+State state182 = {&shift59, &reduce59, nullptr};
+State state183 = {&shift60, &reduce60, nullptr};
+State state184 = {&shift61, &reduce61, nullptr};
+State state185 = {&shift62, &reduce62, nullptr};
+State state186 = {&shift63, &reduce63, nullptr};
+State state187 = {&shift64, &reduce64, nullptr};
+State state188 = {&shift65, &reduce65, nullptr};
+State state189 = {&shift66, &reduce66, nullptr};
+State state190 = {&shift67, &reduce67, nullptr};
+State state191 = {&shift68, &reduce68, nullptr};
+State state192 = {&shift69, &reduce69, nullptr};
+State state193 = {&shift70, &reduce70, nullptr};
+State state194 = {&shift71, &reduce71, nullptr};
+State state195 = {&shift72, &reduce72, nullptr};
+State state196 = {&shift73, &reduce73, nullptr};
+State state197 = {&shift74, &reduce74, nullptr};
+State state198 = {&shift75, &reduce75, nullptr};
+State state199 = {&shift76, &reduce76, nullptr};
+State state200 = {&shift77, &reduce77, nullptr};
+State state201 = {&shift78, &reduce78, nullptr};
+State state202 = {&shift79, &reduce79, nullptr};
+State state203 = {&shift80, &reduce80, nullptr};
+State state204 = {&shift81, &reduce81, nullptr};
+State state205 = {&shift82, &reduce82, nullptr};
+State state206 = {&shift83, &reduce83, nullptr};
+State state207 = {&shift84, &reduce84, nullptr};
+State state208 = {&shift85, &reduce85, nullptr};
+State state209 = {&shift86, &reduce86, nullptr};
+State state210 = {&shift87, &reduce87, nullptr};
+State state211 = {&shift88, &reduce88, nullptr};
+State state212 = {&shift89, &reduce89, nullptr};
+State state213 = {&shift90, &reduce90, nullptr};
+State state214 = {&shift91, &reduce91, nullptr};
+State state215 = {&shift92, &reduce92, nullptr};
+State state216 = {&shift93, &reduce93, nullptr};
+State state217 = {&shift94, &reduce94, nullptr};
+State state218 = {&shift95, &reduce95, nullptr};
+State state219 = {&shift96, &reduce96, nullptr};
+State state220 = {&shift97, &reduce97, nullptr};
+State state221 = {&shift98, &reduce98, nullptr};
+State state222 = {&shift99, &reduce99, nullptr};
+State state223 = {&shift100, &reduce100, nullptr};
+State state224 = {&shift101, &reduce101, nullptr};
+State state225 = {&shift102, &reduce102, nullptr};
+State state226 = {&shift226, &reduce226, nullptr};
+State state227 = {&shift0, &reduce0, &go227};
+State state228 = {&shift228, &reduce228, nullptr};
+State state229 = {&shift109, &reduce109, nullptr};
+State state230 = {&shift230, &reduce230, &go230};
+State state231 = {&shift174, &reduce174, nullptr};
+State state232 = {&shift110, &reduce110, &go232};
+State state233 = {&shift233, &reduce233, nullptr};
+State state234 = {&shift234, &reduce234, nullptr};
+State state235 = {&shift235, &reduce235, nullptr};
+State state236 = {&shift0, &reduce0, &go236};
+State state237 = {&shift237, &reduce237, nullptr};
+State state238 = {&shift238, &reduce238, nullptr};
+State state239 = {&shift239, &reduce239, &go239};
+State state240 = {&shift240, &reduce240, nullptr};
+State state241 = {&shift110, &reduce110, &go241};
+State state242 = {&shift242, &reduce242, nullptr};
+State state243 = {&shift243, &reduce243, nullptr};
+State state244 = {&shift244, &reduce244, nullptr};
+State state245 = {&shift0, &reduce0, &go245};
+State state246 = {&shift246, &reduce246, nullptr};
+State state247 = {&shift247, &reduce247, nullptr};
+State state248 = {&shift248, &reduce248, &go248};
+State state249 = {&shift249, &reduce249, nullptr};
+State state250 = {&shift110, &reduce110, &go250};
+State state251 = {&shift251, &reduce251, nullptr};
+State state252 = {&shift252, &reduce252, nullptr};
+State state253 = {&shift253, &reduce253, nullptr};
+State state254 = {&shift0, &reduce0, &go254};
+State state255 = {&shift255, &reduce255, nullptr};
+State state256 = {&shift256, &reduce256, nullptr};
+State state257 = {&shift257, &reduce257, &go257};
+State state258 = {&shift258, &reduce258, nullptr};
+State state259 = {&shift110, &reduce110, &go259};
+State state260 = {&shift260, &reduce260, nullptr};
+State state261 = {&shift261, &reduce261, nullptr};
+State state262 = {&shift262, &reduce262, nullptr};
+State state263 = {&shift0, &reduce0, &go263};
+State state264 = {&shift264, &reduce264, nullptr};
+State state265 = {&shift265, &reduce265, nullptr};
+State state266 = {&shift266, &reduce266, &go266};
+State state267 = {&shift267, &reduce267, nullptr};
+State state268 = {&shift110, &reduce110, &go268};
+State state269 = {&shift269, &reduce269, nullptr};
+State state270 = {&shift270, &reduce270, nullptr};
+State state271 = {&shift271, &reduce271, nullptr};
+State state272 = {&shift0, &reduce0, &go272};
+State state273 = {&shift273, &reduce273, nullptr};
+State state274 = {&shift274, &reduce274, nullptr};
+State state275 = {&shift275, &reduce275, &go275};
+State state276 = {&shift276, &reduce276, nullptr};
+State state277 = {&shift110, &reduce110, &go277};
+State state278 = {&shift278, &reduce278, nullptr};
+State state279 = {&shift279, &reduce279, nullptr};
+State state280 = {&shift280, &reduce280, nullptr};
+State state281 = {&shift0, &reduce0, &go281};
+State state282 = {&shift282, &reduce282, nullptr};
+State state283 = {&shift283, &reduce283, nullptr};
+State state284 = {&shift284, &reduce284, &go284};
+State state285 = {&shift285, &reduce285, nullptr};
+State state286 = {&shift110, &reduce110, &go286};
+State state287 = {&shift287, &reduce287, nullptr};
+State state288 = {&shift288, &reduce288, nullptr};
+State state289 = {&shift289, &reduce289, nullptr};
+State state290 = {&shift0, &reduce0, &go290};
+State state291 = {&shift291, &reduce291, nullptr};
+State state292 = {&shift292, &reduce292, nullptr};
+State state293 = {&shift293, &reduce293, &go293};
+State state294 = {&shift294, &reduce294, nullptr};
+State state295 = {&shift110, &reduce110, &go295};
+State state296 = {&shift296, &reduce296, nullptr};
+State state297 = {&shift297, &reduce297, nullptr};
+State state298 = {&shift298, &reduce298, nullptr};
+State state299 = {&shift0, &reduce0, &go299};
+State state300 = {&shift300, &reduce300, nullptr};
+State state301 = {&shift301, &reduce301, nullptr};
+State state302 = {&shift302, &reduce302, &go302};
+State state303 = {&shift303, &reduce303, nullptr};
+State state304 = {&shift110, &reduce110, &go304};
+State state305 = {&shift305, &reduce305, nullptr};
+State state306 = {&shift306, &reduce306, nullptr};
+State state307 = {&shift307, &reduce307, nullptr};
+State state308 = {&shift0, &reduce0, &go308};
+State state309 = {&shift309, &reduce309, nullptr};
+State state310 = {&shift310, &reduce310, nullptr};
+State state311 = {&shift311, &reduce311, &go311};
+State state312 = {&shift312, &reduce312, nullptr};
+State state313 = {&shift110, &reduce110, &go313};
+State state314 = {&shift314, &reduce314, nullptr};
+State state315 = {&shift315, &reduce315, nullptr};
+State state316 = {&shift316, &reduce316, nullptr};
+State state317 = {&shift0, &reduce0, &go317};
+State state318 = {&shift318, &reduce318, nullptr};
+State state319 = {&shift319, &reduce319, nullptr};
+State state320 = {&shift320, &reduce320, &go320};
+State state321 = {&shift321, &reduce321, nullptr};
+State state322 = {&shift110, &reduce110, &go322};
+State state323 = {&shift323, &reduce323, nullptr};
+State state324 = {&shift324, &reduce324, nullptr};
+State state325 = {&shift325, &reduce325, nullptr};
+State state326 = {&shift0, &reduce0, &go326};
+State state327 = {&shift327, &reduce327, nullptr};
+State state328 = {&shift328, &reduce328, nullptr};
+State state329 = {&shift329, &reduce329, &go329};
+State state330 = {&shift330, &reduce330, nullptr};
+State state331 = {&shift110, &reduce110, &go331};
+State state332 = {&shift332, &reduce332, nullptr};
+State state333 = {&shift333, &reduce333, nullptr};
+State state334 = {&shift334, &reduce334, nullptr};
+State state335 = {&shift0, &reduce0, &go335};
+State state336 = {&shift336, &reduce336, nullptr};
+State state337 = {&shift337, &reduce337, nullptr};
+State state338 = {&shift338, &reduce338, &go338};
+State state339 = {&shift339, &reduce339, nullptr};
+State state340 = {&shift110, &reduce110, &go340};
+State state341 = {&shift341, &reduce341, nullptr};
+State state342 = {&shift342, &reduce342, nullptr};
+State state343 = {&shift343, &reduce343, nullptr};
+State state344 = {&shift0, &reduce0, &go344};
+State state345 = {&shift345, &reduce345, nullptr};
+State state346 = {&shift346, &reduce346, nullptr};
+State state347 = {&shift347, &reduce347, &go347};
+State state348 = {&shift348, &reduce348, nullptr};
+State state349 = {&shift110, &reduce110, &go349};
+State state350 = {&shift350, &reduce350, nullptr};
+State state351 = {&shift351, &reduce351, nullptr};
+State state352 = {&shift352, &reduce352, nullptr};
+State state353 = {&shift0, &reduce0, &go353};
+State state354 = {&shift354, &reduce354, nullptr};
+State state355 = {&shift355, &reduce355, nullptr};
+State state356 = {&shift356, &reduce356, &go356};
+State state357 = {&shift357, &reduce357, nullptr};
+State state358 = {&shift110, &reduce110, &go358};
+State state359 = {&shift359, &reduce359, nullptr};
+State state360 = {&shift360, &reduce360, nullptr};
+State state361 = {&shift361, &reduce361, nullptr};
+State state362 = {&shift0, &reduce0, &go362};
+State state363 = {&shift363, &reduce363, nullptr};
+State state364 = {&shift364, &reduce364, nullptr};
+State state365 = {&shift365, &reduce365, &go365};
+State state366 = {&shift366, &reduce366, nullptr};
+State state367 = {&shift110, &reduce110, &go367};
+State state368 = {&shift368, &reduce368, nullptr};
+State state369 = {&shift369, &reduce369, nullptr};
+State state370 = {&shift370, &reduce370, nullptr};
+State state371 = {&shift0, &reduce0, &go371};
+State state372 = {&shift372, &reduce372, nullptr};
+State state373 = {&shift373, &reduce373, nullptr};
+State state374 = {&shift374, &reduce374, &go374};
+State state375 = {&shift375, &reduce375, nullptr};
+State state376 = {&shift110, &reduce110, &go376};
+State state377 = {&shift377, &reduce377, nullptr};
+State state378 = {&shift378, &reduce378, nullptr};
+State state379 = {&shift379, &reduce379, nullptr};
+State state380 = {&shift0, &reduce0, &go380};
+State state381 = {&shift381, &reduce381, nullptr};
+State state382 = {&shift382, &reduce382, nullptr};
+State state383 = {&shift383, &reduce383, &go383};
+State state384 = {&shift384, &reduce384, nullptr};
+State state385 = {&shift110, &reduce110, &go385};
+State state386 = {&shift386, &reduce386, nullptr};
+State state387 = {&shift387, &reduce387, nullptr};
+State state388 = {&shift388, &reduce388, nullptr};
+State state389 = {&shift0, &reduce0, &go389};
+State state390 = {&shift390, &reduce390, nullptr};
+State state391 = {&shift391, &reduce391, nullptr};
+State state392 = {&shift392, &reduce392, &go392};
+State state393 = {&shift393, &reduce393, nullptr};
+State state394 = {&shift110, &reduce110, &go394};
+State state395 = {&shift395, &reduce395, nullptr};
+State state396 = {&shift396, &reduce396, nullptr};
+State state397 = {&shift397, &reduce397, nullptr};
+State state398 = {&shift0, &reduce0, &go398};
+State state399 = {&shift399, &reduce399, nullptr};
+State state400 = {&shift400, &reduce400, nullptr};
+State state401 = {&shift401, &reduce401, &go401};
+State state402 = {&shift402, &reduce402, nullptr};
+State state403 = {&shift110, &reduce110, &go403};
+State state404 = {&shift404, &reduce404, nullptr};
+State state405 = {&shift405, &reduce405, nullptr};
+State state406 = {&shift406, &reduce406, nullptr};
+State state407 = {&shift0, &reduce0, &go407};
+State state408 = {&shift408, &reduce408, nullptr};
+State state409 = {&shift409, &reduce409, nullptr};
+State state410 = {&shift410, &reduce410, &go410};
+State state411 = {&shift411, &reduce411, nullptr};
+State state412 = {&shift110, &reduce110, &go412};
+State state413 = {&shift413, &reduce413, nullptr};
+State state414 = {&shift414, &reduce414, nullptr};
+State state415 = {&shift415, &reduce415, nullptr};
+State state416 = {&shift0, &reduce0, &go416};
+State state417 = {&shift417, &reduce417, nullptr};
+State state418 = {&shift418, &reduce418, nullptr};
+State state419 = {&shift419, &reduce419, &go419};
+State state420 = {&shift420, &reduce420, nullptr};
+State state421 = {&shift110, &reduce110, &go421};
+State state422 = {&shift422, &reduce422, nullptr};
+State state423 = {&shift423, &reduce423, nullptr};
+State state424 = {&shift424, &reduce424, nullptr};
+State state425 = {&shift0, &reduce0, &go425};
+State state426 = {&shift426, &reduce426, nullptr};
+State state427 = {&shift427, &reduce427, nullptr};
+State state428 = {&shift428, &reduce428, &go428};
+State state429 = {&shift429, &reduce429, nullptr};
+State state430 = {&shift110, &reduce110, &go430};
+State state431 = {&shift431, &reduce431, nullptr};
+State state432 = {&shift432, &reduce432, nullptr};
+State state433 = {&shift433, &reduce433, nullptr};
+State state434 = {&shift0, &reduce0, &go434};
+State state435 = {&shift435, &reduce435, nullptr};
+State state436 = {&shift436, &reduce436, nullptr};
+State state437 = {&shift437, &reduce437, &go437};
+State state438 = {&shift438, &reduce438, nullptr};
+State state439 = {&shift110, &reduce110, &go439};
+State state440 = {&shift440, &reduce440, nullptr};
+State state441 = {&shift441, &reduce441, nullptr};
+State state442 = {&shift442, &reduce442, nullptr};
+State state443 = {&shift0, &reduce0, &go443};
+State state444 = {&shift444, &reduce444, nullptr};
+State state445 = {&shift445, &reduce445, nullptr};
+State state446 = {&shift446, &reduce446, &go446};
+State state447 = {&shift447, &reduce447, nullptr};
+State state448 = {&shift110, &reduce110, &go448};
+State state449 = {&shift449, &reduce449, nullptr};
+State state450 = {&shift450, &reduce450, nullptr};
+State state451 = {&shift451, &reduce451, nullptr};
+State state452 = {&shift0, &reduce0, &go452};
+State state453 = {&shift453, &reduce453, nullptr};
+State state454 = {&shift454, &reduce454, nullptr};
+State state455 = {&shift455, &reduce455, &go455};
+State state456 = {&shift456, &reduce456, nullptr};
+State state457 = {&shift110, &reduce110, &go457};
+State state458 = {&shift458, &reduce458, nullptr};
+State state459 = {&shift459, &reduce459, nullptr};
+State state460 = {&shift460, &reduce460, nullptr};
+State state461 = {&shift0, &reduce0, &go461};
+State state462 = {&shift462, &reduce462, nullptr};
+State state463 = {&shift463, &reduce463, nullptr};
+State state464 = {&shift464, &reduce464, &go464};
+State state465 = {&shift465, &reduce465, nullptr};
+State state466 = {&shift110, &reduce110, &go466};
+State state467 = {&shift467, &reduce467, nullptr};
+State state468 = {&shift468, &reduce468, nullptr};
+State state469 = {&shift469, &reduce469, nullptr};
+State state470 = {&shift0, &reduce0, &go470};
+State state471 = {&shift471, &reduce471, nullptr};
+State state472 = {&shift472, &reduce472, nullptr};
+State state473 = {&shift473, &reduce473, &go473};
+State state474 = {&shift474, &reduce474, nullptr};
+State state475 = {&shift110, &reduce110, &go475};
+State state476 = {&shift476, &reduce476, nullptr};
+State state477 = {&shift477, &reduce477, nullptr};
+State state478 = {&shift478, &reduce478, nullptr};
+State state479 = {&shift0, &reduce0, &go479};
+State state480 = {&shift480, &reduce480, nullptr};
+State state481 = {&shift481, &reduce481, nullptr};
+State state482 = {&shift482, &reduce482, &go482};
+State state483 = {&shift483, &reduce483, nullptr};
+State state484 = {&shift110, &reduce110, &go484};
+State state485 = {&shift485, &reduce485, nullptr};
+State state486 = {&shift486, &reduce486, nullptr};
+State state487 = {&shift487, &reduce487, nullptr};
+State state488 = {&shift0, &reduce0, &go488};
+State state489 = {&shift489, &reduce489, nullptr};
+State state490 = {&shift490, &reduce490, nullptr};
+State state491 = {&shift491, &reduce491, &go491};
+State state492 = {&shift492, &reduce492, nullptr};
+State state493 = {&shift110, &reduce110, &go493};
+State state494 = {&shift494, &reduce494, nullptr};
+State state495 = {&shift495, &reduce495, nullptr};
+State state496 = {&shift496, &reduce496, nullptr};
+State state497 = {&shift0, &reduce0, &go497};
+State state498 = {&shift498, &reduce498, nullptr};
+State state499 = {&shift499, &reduce499, nullptr};
+State state500 = {&shift500, &reduce500, &go500};
+State state501 = {&shift501, &reduce501, nullptr};
+State state502 = {&shift110, &reduce110, &go502};
+State state503 = {&shift503, &reduce503, nullptr};
+State state504 = {&shift504, &reduce504, nullptr};
+State state505 = {&shift505, &reduce505, nullptr};
+State state506 = {&shift0, &reduce0, &go506};
+State state507 = {&shift507, &reduce507, nullptr};
+State state508 = {&shift508, &reduce508, nullptr};
+State state509 = {&shift509, &reduce509, &go509};
+State state510 = {&shift510, &reduce510, nullptr};
+State state511 = {&shift110, &reduce110, &go511};
+State state512 = {&shift512, &reduce512, nullptr};
+State state513 = {&shift513, &reduce513, nullptr};
+State state514 = {&shift514, &reduce514, nullptr};
+State state515 = {&shift0, &reduce0, &go515};
+State state516 = {&shift516, &reduce516, nullptr};
+State state517 = {&shift517, &reduce517, nullptr};
+State state518 = {&shift518, &reduce518, &go518};
+State state519 = {&shift519, &reduce519, nullptr};
+State state520 = {&shift110, &reduce110, &go520};
+State state521 = {&shift521, &reduce521, nullptr};
+State state522 = {&shift522, &reduce522, nullptr};
+State state523 = {&shift523, &reduce523, nullptr};
+State state524 = {&shift0, &reduce0, &go524};
+State state525 = {&shift525, &reduce525, nullptr};
+State state526 = {&shift526, &reduce526, nullptr};
+State state527 = {&shift527, &reduce527, &go527};
+State state528 = {&shift528, &reduce528, nullptr};
+State state529 = {&shift110, &reduce110, &go529};
+State state530 = {&shift530, &reduce530, nullptr};
+State state531 = {&shift531, &reduce531, nullptr};
+State state532 = {&shift532, &reduce532, nullptr};
+State state533 = {&shift0, &reduce0, &go533};
+State state534 = {&shift534, &reduce534, nullptr};
+State state535 = {&shift535, &reduce535, nullptr};
+State state536 = {&shift536, &reduce536, &go536};
+State state537 = {&shift537, &reduce537, nullptr};
+State state538 = {&shift110, &reduce110, &go538};
+State state539 = {&shift539, &reduce539, nullptr};
+State state540 = {&shift540, &reduce540, nullptr};
+State state541 = {&shift541, &reduce541, nullptr};
+State state542 = {&shift0, &reduce0, &go542};
+State state543 = {&shift543, &reduce543, nullptr};
+State state544 = {&shift544, &reduce544, nullptr};
+State state545 = {&shift545, &reduce545, &go545};
+State state546 = {&shift546, &reduce546, nullptr};
+State state547 = {&shift110, &reduce110, &go547};
+State state548 = {&shift548, &reduce548, nullptr};
+State state549 = {&shift549, &reduce549, nullptr};
+State state550 = {&shift550, &reduce550, nullptr};
+State state551 = {&shift0, &reduce0, &go551};
+State state552 = {&shift552, &reduce552, nullptr};
+State state553 = {&shift553, &reduce553, nullptr};
+State state554 = {&shift554, &reduce554, &go554};
+State state555 = {&shift555, &reduce555, nullptr};
+State state556 = {&shift110, &reduce110, &go556};
+State state557 = {&shift557, &reduce557, nullptr};
+State state558 = {&shift558, &reduce558, nullptr};
+State state559 = {&shift559, &reduce559, nullptr};
+State state560 = {&shift0, &reduce0, &go560};
+State state561 = {&shift561, &reduce561, nullptr};
+State state562 = {&shift562, &reduce562, nullptr};
+State state563 = {&shift563, &reduce563, &go563};
+State state564 = {&shift564, &reduce564, nullptr};
+State state565 = {&shift110, &reduce110, &go565};
+State state566 = {&shift566, &reduce566, nullptr};
+State state567 = {&shift567, &reduce567, nullptr};
+State state568 = {&shift568, &reduce568, nullptr};
+State state569 = {&shift0, &reduce0, &go569};
+State state570 = {&shift570, &reduce570, nullptr};
+State state571 = {&shift571, &reduce571, nullptr};
+State state572 = {&shift572, &reduce572, &go572};
+State state573 = {&shift573, &reduce573, nullptr};
+State state574 = {&shift110, &reduce110, &go574};
+State state575 = {&shift575, &reduce575, nullptr};
+State state576 = {&shift576, &reduce576, nullptr};
+State state577 = {&shift577, &reduce577, nullptr};
+State state578 = {&shift0, &reduce0, &go578};
+State state579 = {&shift579, &reduce579, nullptr};
+State state580 = {&shift580, &reduce580, nullptr};
+State state581 = {&shift581, &reduce581, &go581};
+State state582 = {&shift582, &reduce582, nullptr};
+State state583 = {&shift110, &reduce110, &go583};
+State state584 = {&shift584, &reduce584, nullptr};
+State state585 = {&shift585, &reduce585, nullptr};
+State state586 = {&shift586, &reduce586, nullptr};
+State state587 = {&shift0, &reduce0, &go587};
+State state588 = {&shift588, &reduce588, nullptr};
+State state589 = {&shift589, &reduce589, nullptr};
+State state590 = {&shift590, &reduce590, &go590};
+State state591 = {&shift591, &reduce591, nullptr};
+State state592 = {&shift110, &reduce110, &go592};
+State state593 = {&shift593, &reduce593, nullptr};
+State state594 = {&shift594, &reduce594, nullptr};
+State state595 = {&shift595, &reduce595, nullptr};
+State state596 = {&shift0, &reduce0, &go596};
+State state597 = {&shift597, &reduce597, nullptr};
+State state598 = {&shift598, &reduce598, nullptr};
+State state599 = {&shift599, &reduce599, &go599};
+State state600 = {&shift600, &reduce600, nullptr};
+State state601 = {&shift110, &reduce110, &go601};
+State state602 = {&shift602, &reduce602, nullptr};
+State state603 = {&shift603, &reduce603, nullptr};
+State state604 = {&shift604, &reduce604, nullptr};
+State state605 = {&shift0, &reduce0, &go605};
+State state606 = {&shift606, &reduce606, nullptr};
+State state607 = {&shift607, &reduce607, nullptr};
+State state608 = {&shift608, &reduce608, &go608};
+State state609 = {&shift609, &reduce609, nullptr};
+State state610 = {&shift110, &reduce110, &go610};
+State state611 = {&shift611, &reduce611, nullptr};
+State state612 = {&shift612, &reduce612, nullptr};
+State state613 = {&shift613, &reduce613, nullptr};
+State state614 = {&shift0, &reduce0, &go614};
+State state615 = {&shift615, &reduce615, nullptr};
+State state616 = {&shift616, &reduce616, nullptr};
+State state617 = {&shift617, &reduce617, &go617};
+State state618 = {&shift618, &reduce618, nullptr};
+State state619 = {&shift110, &reduce110, &go619};
+State state620 = {&shift620, &reduce620, nullptr};
+State state621 = {&shift621, &reduce621, nullptr};
+State state622 = {&shift622, &reduce622, nullptr};
+State state623 = {&shift0, &reduce0, &go623};
+State state624 = {&shift624, &reduce624, nullptr};
+State state625 = {&shift625, &reduce625, nullptr};
+State state626 = {&shift626, &reduce626, &go626};
+State state627 = {&shift627, &reduce627, nullptr};
+State state628 = {&shift110, &reduce110, &go628};
+State state629 = {&shift629, &reduce629, nullptr};
+State state630 = {&shift630, &reduce630, nullptr};
+State state631 = {&shift631, &reduce631, nullptr};
+State state632 = {&shift0, &reduce0, &go632};
+State state633 = {&shift633, &reduce633, nullptr};
+State state634 = {&shift634, &reduce634, nullptr};
+State state635 = {&shift635, &reduce635, &go635};
+State state636 = {&shift636, &reduce636, nullptr};
+State state637 = {&shift110, &reduce110, &go637};
+State state638 = {&shift638, &reduce638, nullptr};
+State state639 = {&shift639, &reduce639, nullptr};
+State state640 = {&shift640, &reduce640, nullptr};
+State state641 = {&shift0, &reduce0, &go641};
+State state642 = {&shift642, &reduce642, nullptr};
+State state643 = {&shift643, &reduce643, nullptr};
+State state644 = {&shift644, &reduce644, &go644};
+State state645 = {&shift645, &reduce645, nullptr};
+State state646 = {&shift110, &reduce110, &go646};
+State state647 = {&shift647, &reduce647, nullptr};
+State state648 = {&shift648, &reduce648, nullptr};
+State state649 = {&shift649, &reduce649, nullptr};
+State state650 = {&shift0, &reduce0, &go650};
+State state651 = {&shift651, &reduce651, nullptr};
+State state652 = {&shift652, &reduce652, nullptr};
+State state653 = {&shift653, &reduce653, &go653};
+State state654 = {&shift654, &reduce654, nullptr};
+State state655 = {&shift110, &reduce110, &go655};
+State state656 = {&shift656, &reduce656, nullptr};
+State state657 = {&shift657, &reduce657, nullptr};
+State state658 = {&shift658, &reduce658, nullptr};
+State state659 = {&shift0, &reduce0, &go659};
+State state660 = {&shift660, &reduce660, nullptr};
+State state661 = {&shift661, &reduce661, nullptr};
+State state662 = {&shift662, &reduce662, &go662};
+State state663 = {&shift663, &reduce663, nullptr};
+State state664 = {&shift110, &reduce110, &go664};
+State state665 = {&shift665, &reduce665, nullptr};
+State state666 = {&shift666, &reduce666, nullptr};
+State state667 = {&shift667, &reduce667, nullptr};
+State state668 = {&shift0, &reduce0, &go668};
+State state669 = {&shift669, &reduce669, nullptr};
+State state670 = {&shift670, &reduce670, nullptr};
+State state671 = {&shift671, &reduce671, &go671};
+State state672 = {&shift672, &reduce672, nullptr};
+State state673 = {&shift110, &reduce110, &go673};
+State state674 = {&shift674, &reduce674, nullptr};
+State state675 = {&shift675, &reduce675, nullptr};
+State state676 = {&shift110, &reduce110, &go676};
+State state677 = {&shift677, &reduce677, nullptr};
+State state678 = {&shift234, &reduce234, nullptr};
+State state679 = {&shift679, &reduce679, nullptr};
+State state680 = {&shift0, &reduce0, &go680};
+State state681 = {&shift681, &reduce681, nullptr};
+State state682 = {&shift238, &reduce238, nullptr};
+State state683 = {&shift683, &reduce683, &go683};
+State state684 = {&shift240, &reduce240, nullptr};
+State state685 = {&shift110, &reduce110, &go685};
+State state686 = {&shift686, &reduce686, nullptr};
+State state687 = {&shift243, &reduce243, nullptr};
+State state688 = {&shift688, &reduce688, nullptr};
+State state689 = {&shift0, &reduce0, &go689};
+State state690 = {&shift690, &reduce690, nullptr};
+State state691 = {&shift247, &reduce247, nullptr};
+State state692 = {&shift692, &reduce692, &go692};
+State state693 = {&shift249, &reduce249, nullptr};
+State state694 = {&shift110, &reduce110, &go694};
+State state695 = {&shift695, &reduce695, nullptr};
+State state696 = {&shift252, &reduce252, nullptr};
+State state697 = {&shift697, &reduce697, nullptr};
+State state698 = {&shift0, &reduce0, &go698};
+State state699 = {&shift699, &reduce699, nullptr};
+State state700 = {&shift256, &reduce256, nullptr};
+State state701 = {&shift701, &reduce701, &go701};
+State state702 = {&shift258, &reduce258, nullptr};
+State state703 = {&shift110, &reduce110, &go703};
+State state704 = {&shift704, &reduce704, nullptr};
+State state705 = {&shift261, &reduce261, nullptr};
+State state706 = {&shift706, &reduce706, nullptr};
+State state707 = {&shift0, &reduce0, &go707};
+State state708 = {&shift708, &reduce708, nullptr};
+State state709 = {&shift265, &reduce265, nullptr};
+State state710 = {&shift710, &reduce710, &go710};
+State state711 = {&shift267, &reduce267, nullptr};
+State state712 = {&shift110, &reduce110, &go712};
+State state713 = {&shift713, &reduce713, nullptr};
+State state714 = {&shift270, &reduce270, nullptr};
+State state715 = {&shift715, &reduce715, nullptr};
+State state716 = {&shift0, &reduce0, &go716};
+State state717 = {&shift717, &reduce717, nullptr};
+State state718 = {&shift274, &reduce274, nullptr};
+State state719 = {&shift719, &reduce719, &go719};
+State state720 = {&shift276, &reduce276, nullptr};
+State state721 = {&shift110, &reduce110, &go721};
+State state722 = {&shift722, &reduce722, nullptr};
+State state723 = {&shift279, &reduce279, nullptr};
+State state724 = {&shift724, &reduce724, nullptr};
+State state725 = {&shift0, &reduce0, &go725};
+State state726 = {&shift726, &reduce726, nullptr};
+State state727 = {&shift283, &reduce283, nullptr};
+State state728 = {&shift728, &reduce728, &go728};
+State state729 = {&shift285, &reduce285, nullptr};
+State state730 = {&shift110, &reduce110, &go730};
+State state731 = {&shift731, &reduce731, nullptr};
+State state732 = {&shift288, &reduce288, nullptr};
+State state733 = {&shift733, &reduce733, nullptr};
+State state734 = {&shift0, &reduce0, &go734};
+State state735 = {&shift735, &reduce735, nullptr};
+State state736 = {&shift292, &reduce292, nullptr};
+State state737 = {&shift737, &reduce737, &go737};
+State state738 = {&shift294, &reduce294, nullptr};
+State state739 = {&shift110, &reduce110, &go739};
+State state740 = {&shift740, &reduce740, nullptr};
+State state741 = {&shift297, &reduce297, nullptr};
+State state742 = {&shift742, &reduce742, nullptr};
+State state743 = {&shift0, &reduce0, &go743};
+State state744 = {&shift744, &reduce744, nullptr};
+State state745 = {&shift301, &reduce301, nullptr};
+State state746 = {&shift746, &reduce746, &go746};
+State state747 = {&shift303, &reduce303, nullptr};
+State state748 = {&shift110, &reduce110, &go748};
+State state749 = {&shift749, &reduce749, nullptr};
+State state750 = {&shift306, &reduce306, nullptr};
+State state751 = {&shift751, &reduce751, nullptr};
+State state752 = {&shift0, &reduce0, &go752};
+State state753 = {&shift753, &reduce753, nullptr};
+State state754 = {&shift310, &reduce310, nullptr};
+State state755 = {&shift755, &reduce755, &go755};
+State state756 = {&shift312, &reduce312, nullptr};
+State state757 = {&shift110, &reduce110, &go757};
+State state758 = {&shift758, &reduce758, nullptr};
+State state759 = {&shift315, &reduce315, nullptr};
+State state760 = {&shift760, &reduce760, nullptr};
+State state761 = {&shift0, &reduce0, &go761};
+State state762 = {&shift762, &reduce762, nullptr};
+State state763 = {&shift319, &reduce319, nullptr};
+State state764 = {&shift764, &reduce764, &go764};
+State state765 = {&shift321, &reduce321, nullptr};
+State state766 = {&shift110, &reduce110, &go766};
+State state767 = {&shift767, &reduce767, nullptr};
+State state768 = {&shift324, &reduce324, nullptr};
+State state769 = {&shift769, &reduce769, nullptr};
+State state770 = {&shift0, &reduce0, &go770};
+State state771 = {&shift771, &reduce771, nullptr};
+State state772 = {&shift328, &reduce328, nullptr};
+State state773 = {&shift773, &reduce773, &go773};
+State state774 = {&shift330, &reduce330, nullptr};
+State state775 = {&shift110, &reduce110, &go775};
+State state776 = {&shift776, &reduce776, nullptr};
+State state777 = {&shift333, &reduce333, nullptr};
+State state778 = {&shift778, &reduce778, nullptr};
+State state779 = {&shift0, &reduce0, &go779};
+State state780 = {&shift780, &reduce780, nullptr};
+State state781 = {&shift337, &reduce337, nullptr};
+State state782 = {&shift782, &reduce782, &go782};
+State state783 = {&shift339, &reduce339, nullptr};
+State state784 = {&shift110, &reduce110, &go784};
+State state785 = {&shift785, &reduce785, nullptr};
+State state786 = {&shift342, &reduce342, nullptr};
+State state787 = {&shift787, &reduce787, nullptr};
+State state788 = {&shift0, &reduce0, &go788};
+State state789 = {&shift789, &reduce789, nullptr};
+State state790 = {&shift346, &reduce346, nullptr};
+State state791 = {&shift791, &reduce791, &go791};
+State state792 = {&shift348, &reduce348, nullptr};
+State state793 = {&shift110, &reduce110, &go793};
+State state794 = {&shift794, &reduce794, nullptr};
+State state795 = {&shift351, &reduce351, nullptr};
+State state796 = {&shift796, &reduce796, nullptr};
+State state797 = {&shift0, &reduce0, &go797};
+State state798 = {&shift798, &reduce798, nullptr};
+State state799 = {&shift355, &reduce355, nullptr};
+State state800 = {&shift800, &reduce800, &go800};
+State state801 = {&shift357, &reduce357, nullptr};
+State state802 = {&shift110, &reduce110, &go802};
+State state803 = {&shift803, &reduce803, nullptr};
+State state804 = {&shift360, &reduce360, nullptr};
+State state805 = {&shift805, &reduce805, nullptr};
+State state806 = {&shift0, &reduce0, &go806};
+State state807 = {&shift807, &reduce807, nullptr};
+State state808 = {&shift364, &reduce364, nullptr};
+State state809 = {&shift809, &reduce809, &go809};
+State state810 = {&shift366, &reduce366, nullptr};
+State state811 = {&shift110, &reduce110, &go811};
+State state812 = {&shift812, &reduce812, nullptr};
+State state813 = {&shift369, &reduce369, nullptr};
+State state814 = {&shift814, &reduce814, nullptr};
+State state815 = {&shift0, &reduce0, &go815};
+State state816 = {&shift816, &reduce816, nullptr};
+State state817 = {&shift373, &reduce373, nullptr};
+State state818 = {&shift818, &reduce818, &go818};
+State state819 = {&shift375, &reduce375, nullptr};
+State state820 = {&shift110, &reduce110, &go820};
+State state821 = {&shift821, &reduce821, nullptr};
+State state822 = {&shift378, &reduce378, nullptr};
+State state823 = {&shift823, &reduce823, nullptr};
+State state824 = {&shift0, &reduce0, &go824};
+State state825 = {&shift825, &reduce825, nullptr};
+State state826 = {&shift382, &reduce382, nullptr};
+State state827 = {&shift827, &reduce827, &go827};
+State state828 = {&shift384, &reduce384, nullptr};
+State state829 = {&shift110, &reduce110, &go829};
+State state830 = {&shift830, &reduce830, nullptr};
+State state831 = {&shift387, &reduce387, nullptr};
+State state832 = {&shift832, &reduce832, nullptr};
+State state833 = {&shift0, &reduce0, &go833};
+State state834 = {&shift834, &reduce834, nullptr};
+State state835 = {&shift391, &reduce391, nullptr};
+State state836 = {&shift836, &reduce836, &go836};
+State state837 = {&shift393, &reduce393, nullptr};
+State state838 = {&shift110, &reduce110, &go838};
+State state839 = {&shift839, &reduce839, nullptr};
+State state840 = {&shift396, &reduce396, nullptr};
+State state841 = {&shift841, &reduce841, nullptr};
+State state842 = {&shift0, &reduce0, &go842};
+State state843 = {&shift843, &reduce843, nullptr};
+State state844 = {&shift400, &reduce400, nullptr};
+State state845 = {&shift845, &reduce845, &go845};
+State state846 = {&shift402, &reduce402, nullptr};
+State state847 = {&shift110, &reduce110, &go847};
+State state848 = {&shift848, &reduce848, nullptr};
+State state849 = {&shift405, &reduce405, nullptr};
+State state850 = {&shift850, &reduce850, nullptr};
+State state851 = {&shift0, &reduce0, &go851};
+State state852 = {&shift852, &reduce852, nullptr};
+State state853 = {&shift409, &reduce409, nullptr};
+State state854 = {&shift854, &reduce854, &go854};
+State state855 = {&shift411, &reduce411, nullptr};
+State state856 = {&shift110, &reduce110, &go856};
+State state857 = {&shift857, &reduce857, nullptr};
+State state858 = {&shift414, &reduce414, nullptr};
+State state859 = {&shift859, &reduce859, nullptr};
+State state860 = {&shift0, &reduce0, &go860};
+State state861 = {&shift861, &reduce861, nullptr};
+State state862 = {&shift418, &reduce418, nullptr};
+State state863 = {&shift863, &reduce863, &go863};
+State state864 = {&shift420, &reduce420, nullptr};
+State state865 = {&shift110, &reduce110, &go865};
+State state866 = {&shift866, &reduce866, nullptr};
+State state867 = {&shift423, &reduce423, nullptr};
+State state868 = {&shift868, &reduce868, nullptr};
+State state869 = {&shift0, &reduce0, &go869};
+State state870 = {&shift870, &reduce870, nullptr};
+State state871 = {&shift427, &reduce427, nullptr};
+State state872 = {&shift872, &reduce872, &go872};
+State state873 = {&shift429, &reduce429, nullptr};
+State state874 = {&shift110, &reduce110, &go874};
+State state875 = {&shift875, &reduce875, nullptr};
+State state876 = {&shift432, &reduce432, nullptr};
+State state877 = {&shift877, &reduce877, nullptr};
+State state878 = {&shift0, &reduce0, &go878};
+State state879 = {&shift879, &reduce879, nullptr};
+State state880 = {&shift436, &reduce436, nullptr};
+State state881 = {&shift881, &reduce881, &go881};
+State state882 = {&shift438, &reduce438, nullptr};
+State state883 = {&shift110, &reduce110, &go883};
+State state884 = {&shift884, &reduce884, nullptr};
+State state885 = {&shift441, &reduce441, nullptr};
+State state886 = {&shift886, &reduce886, nullptr};
+State state887 = {&shift0, &reduce0, &go887};
+State state888 = {&shift888, &reduce888, nullptr};
+State state889 = {&shift445, &reduce445, nullptr};
+State state890 = {&shift890, &reduce890, &go890};
+State state891 = {&shift447, &reduce447, nullptr};
+State state892 = {&shift110, &reduce110, &go892};
+State state893 = {&shift893, &reduce893, nullptr};
+State state894 = {&shift450, &reduce450, nullptr};
+State state895 = {&shift895, &reduce895, nullptr};
+State state896 = {&shift0, &reduce0, &go896};
+State state897 = {&shift897, &reduce897, nullptr};
+State state898 = {&shift454, &reduce454, nullptr};
+State state899 = {&shift899, &reduce899, &go899};
+State state900 = {&shift456, &reduce456, nullptr};
+State state901 = {&shift110, &reduce110, &go901};
+State state902 = {&shift902, &reduce902, nullptr};
+State state903 = {&shift459, &reduce459, nullptr};
+State state904 = {&shift904, &reduce904, nullptr};
+State state905 = {&shift0, &reduce0, &go905};
+State state906 = {&shift906, &reduce906, nullptr};
+State state907 = {&shift463, &reduce463, nullptr};
+State state908 = {&shift908, &reduce908, &go908};
+State state909 = {&shift465, &reduce465, nullptr};
+State state910 = {&shift110, &reduce110, &go910};
+State state911 = {&shift911, &reduce911, nullptr};
+State state912 = {&shift468, &reduce468, nullptr};
+State state913 = {&shift913, &reduce913, nullptr};
+State state914 = {&shift0, &reduce0, &go914};
+State state915 = {&shift915, &reduce915, nullptr};
+State state916 = {&shift472, &reduce472, nullptr};
+State state917 = {&shift917, &reduce917, &go917};
+State state918 = {&shift474, &reduce474, nullptr};
+State state919 = {&shift110, &reduce110, &go919};
+State state920 = {&shift920, &reduce920, nullptr};
+State state921 = {&shift477, &reduce477, nullptr};
+State state922 = {&shift922, &reduce922, nullptr};
+State state923 = {&shift0, &reduce0, &go923};
+State state924 = {&shift924, &reduce924, nullptr};
+State state925 = {&shift481, &reduce481, nullptr};
+State state926 = {&shift926, &reduce926, &go926};
+State state927 = {&shift483, &reduce483, nullptr};
+State state928 = {&shift110, &reduce110, &go928};
+State state929 = {&shift929, &reduce929, nullptr};
+State state930 = {&shift486, &reduce486, nullptr};
+State state931 = {&shift931, &reduce931, nullptr};
+State state932 = {&shift0, &reduce0, &go932};
+State state933 = {&shift933, &reduce933, nullptr};
+State state934 = {&shift490, &reduce490, nullptr};
+State state935 = {&shift935, &reduce935, &go935};
+State state936 = {&shift492, &reduce492, nullptr};
+State state937 = {&shift110, &reduce110, &go937};
+State state938 = {&shift938, &reduce938, nullptr};
+State state939 = {&shift495, &reduce495, nullptr};
+State state940 = {&shift940, &reduce940, nullptr};
+State state941 = {&shift0, &reduce0, &go941};
+State state942 = {&shift942, &reduce942, nullptr};
+State state943 = {&shift499, &reduce499, nullptr};
+State state944 = {&shift944, &reduce944, &go944};
+State state945 = {&shift501, &reduce501, nullptr};
+State state946 = {&shift110, &reduce110, &go946};
+State state947 = {&shift947, &reduce947, nullptr};
+State state948 = {&shift504, &reduce504, nullptr};
+State state949 = {&shift949, &reduce949, nullptr};
+State state950 = {&shift0, &reduce0, &go950};
+State state951 = {&shift951, &reduce951, nullptr};
+State state952 = {&shift508, &reduce508, nullptr};
+State state953 = {&shift953, &reduce953, &go953};
+State state954 = {&shift510, &reduce510, nullptr};
+State state955 = {&shift110, &reduce110, &go955};
+State state956 = {&shift956, &reduce956, nullptr};
+State state957 = {&shift513, &reduce513, nullptr};
+State state958 = {&shift958, &reduce958, nullptr};
+State state959 = {&shift0, &reduce0, &go959};
+State state960 = {&shift960, &reduce960, nullptr};
+State state961 = {&shift517, &reduce517, nullptr};
+State state962 = {&shift962, &reduce962, &go962};
+State state963 = {&shift519, &reduce519, nullptr};
+State state964 = {&shift110, &reduce110, &go964};
+State state965 = {&shift965, &reduce965, nullptr};
+State state966 = {&shift522, &reduce522, nullptr};
+State state967 = {&shift967, &reduce967, nullptr};
+State state968 = {&shift0, &reduce0, &go968};
+State state969 = {&shift969, &reduce969, nullptr};
+State state970 = {&shift526, &reduce526, nullptr};
+State state971 = {&shift971, &reduce971, &go971};
+State state972 = {&shift528, &reduce528, nullptr};
+State state973 = {&shift110, &reduce110, &go973};
+State state974 = {&shift974, &reduce974, nullptr};
+State state975 = {&shift531, &reduce531, nullptr};
+State state976 = {&shift976, &reduce976, nullptr};
+State state977 = {&shift0, &reduce0, &go977};
+State state978 = {&shift978, &reduce978, nullptr};
+State state979 = {&shift535, &reduce535, nullptr};
+State state980 = {&shift980, &reduce980, &go980};
+State state981 = {&shift537, &reduce537, nullptr};
+State state982 = {&shift110, &reduce110, &go982};
+State state983 = {&shift983, &reduce983, nullptr};
+State state984 = {&shift540, &reduce540, nullptr};
+State state985 = {&shift985, &reduce985, nullptr};
+State state986 = {&shift0, &reduce0, &go986};
+State state987 = {&shift987, &reduce987, nullptr};
+State state988 = {&shift544, &reduce544, nullptr};
+State state989 = {&shift989, &reduce989, &go989};
+State state990 = {&shift546, &reduce546, nullptr};
+State state991 = {&shift110, &reduce110, &go991};
+State state992 = {&shift992, &reduce992, nullptr};
+State state993 = {&shift549, &reduce549, nullptr};
+State state994 = {&shift994, &reduce994, nullptr};
+State state995 = {&shift0, &reduce0, &go995};
+State state996 = {&shift996, &reduce996, nullptr};
+State state997 = {&shift553, &reduce553, nullptr};
+State state998 = {&shift998, &reduce998, &go998};
+State state999 = {&shift555, &reduce555, nullptr};
+State state1000 = {&shift110, &reduce110, &go1000};
+State state1001 = {&shift1001, &reduce1001, nullptr};
+State state1002 = {&shift558, &reduce558, nullptr};
+State state1003 = {&shift1003, &reduce1003, nullptr};
+State state1004 = {&shift0, &reduce0, &go1004};
+State state1005 = {&shift1005, &reduce1005, nullptr};
+State state1006 = {&shift562, &reduce562, nullptr};
+State state1007 = {&shift1007, &reduce1007, &go1007};
+State state1008 = {&shift564, &reduce564, nullptr};
+State state1009 = {&shift110, &reduce110, &go1009};
+State state1010 = {&shift1010, &reduce1010, nullptr};
+State state1011 = {&shift567, &reduce567, nullptr};
+State state1012 = {&shift1012, &reduce1012, nullptr};
+State state1013 = {&shift0, &reduce0, &go1013};
+State state1014 = {&shift1014, &reduce1014, nullptr};
+State state1015 = {&shift571, &reduce571, nullptr};
+State state1016 = {&shift1016, &reduce1016, &go1016};
+State state1017 = {&shift573, &reduce573, nullptr};
+State state1018 = {&shift110, &reduce110, &go1018};
+State state1019 = {&shift1019, &reduce1019, nullptr};
+State state1020 = {&shift576, &reduce576, nullptr};
+State state1021 = {&shift1021, &reduce1021, nullptr};
+State state1022 = {&shift0, &reduce0, &go1022};
+State state1023 = {&shift1023, &reduce1023, nullptr};
+State state1024 = {&shift580, &reduce580, nullptr};
+State state1025 = {&shift1025, &reduce1025, &go1025};
+State state1026 = {&shift582, &reduce582, nullptr};
+State state1027 = {&shift110, &reduce110, &go1027};
+State state1028 = {&shift1028, &reduce1028, nullptr};
+State state1029 = {&shift585, &reduce585, nullptr};
+State state1030 = {&shift1030, &reduce1030, nullptr};
+State state1031 = {&shift0, &reduce0, &go1031};
+State state1032 = {&shift1032, &reduce1032, nullptr};
+State state1033 = {&shift589, &reduce589, nullptr};
+State state1034 = {&shift1034, &reduce1034, &go1034};
+State state1035 = {&shift591, &reduce591, nullptr};
+State state1036 = {&shift110, &reduce110, &go1036};
+State state1037 = {&shift1037, &reduce1037, nullptr};
+State state1038 = {&shift594, &reduce594, nullptr};
+State state1039 = {&shift1039, &reduce1039, nullptr};
+State state1040 = {&shift0, &reduce0, &go1040};
+State state1041 = {&shift1041, &reduce1041, nullptr};
+State state1042 = {&shift598, &reduce598, nullptr};
+State state1043 = {&shift1043, &reduce1043, &go1043};
+State state1044 = {&shift600, &reduce600, nullptr};
+State state1045 = {&shift110, &reduce110, &go1045};
+State state1046 = {&shift1046, &reduce1046, nullptr};
+State state1047 = {&shift603, &reduce603, nullptr};
+State state1048 = {&shift1048, &reduce1048, nullptr};
+State state1049 = {&shift0, &reduce0, &go1049};
+State state1050 = {&shift1050, &reduce1050, nullptr};
+State state1051 = {&shift607, &reduce607, nullptr};
+State state1052 = {&shift1052, &reduce1052, &go1052};
+State state1053 = {&shift609, &reduce609, nullptr};
+State state1054 = {&shift110, &reduce110, &go1054};
+State state1055 = {&shift1055, &reduce1055, nullptr};
+State state1056 = {&shift612, &reduce612, nullptr};
+State state1057 = {&shift1057, &reduce1057, nullptr};
+State state1058 = {&shift0, &reduce0, &go1058};
+State state1059 = {&shift1059, &reduce1059, nullptr};
+State state1060 = {&shift616, &reduce616, nullptr};
+State state1061 = {&shift1061, &reduce1061, &go1061};
+State state1062 = {&shift618, &reduce618, nullptr};
+State state1063 = {&shift110, &reduce110, &go1063};
+State state1064 = {&shift1064, &reduce1064, nullptr};
+State state1065 = {&shift621, &reduce621, nullptr};
+State state1066 = {&shift1066, &reduce1066, nullptr};
+State state1067 = {&shift0, &reduce0, &go1067};
+State state1068 = {&shift1068, &reduce1068, nullptr};
+State state1069 = {&shift625, &reduce625, nullptr};
+State state1070 = {&shift1070, &reduce1070, &go1070};
+State state1071 = {&shift627, &reduce627, nullptr};
+State state1072 = {&shift110, &reduce110, &go1072};
+State state1073 = {&shift1073, &reduce1073, nullptr};
+State state1074 = {&shift630, &reduce630, nullptr};
+State state1075 = {&shift1075, &reduce1075, nullptr};
+State state1076 = {&shift0, &reduce0, &go1076};
+State state1077 = {&shift1077, &reduce1077, nullptr};
+State state1078 = {&shift634, &reduce634, nullptr};
+State state1079 = {&shift1079, &reduce1079, &go1079};
+State state1080 = {&shift636, &reduce636, nullptr};
+State state1081 = {&shift110, &reduce110, &go1081};
+State state1082 = {&shift1082, &reduce1082, nullptr};
+State state1083 = {&shift639, &reduce639, nullptr};
+State state1084 = {&shift1084, &reduce1084, nullptr};
+State state1085 = {&shift0, &reduce0, &go1085};
+State state1086 = {&shift1086, &reduce1086, nullptr};
+State state1087 = {&shift643, &reduce643, nullptr};
+State state1088 = {&shift1088, &reduce1088, &go1088};
+State state1089 = {&shift645, &reduce645, nullptr};
+State state1090 = {&shift110, &reduce110, &go1090};
+State state1091 = {&shift1091, &reduce1091, nullptr};
+State state1092 = {&shift648, &reduce648, nullptr};
+State state1093 = {&shift1093, &reduce1093, nullptr};
+State state1094 = {&shift0, &reduce0, &go1094};
+State state1095 = {&shift1095, &reduce1095, nullptr};
+State state1096 = {&shift652, &reduce652, nullptr};
+State state1097 = {&shift1097, &reduce1097, &go1097};
+State state1098 = {&shift654, &reduce654, nullptr};
+State state1099 = {&shift110, &reduce110, &go1099};
+State state1100 = {&shift1100, &reduce1100, nullptr};
+State state1101 = {&shift657, &reduce657, nullptr};
+State state1102 = {&shift1102, &reduce1102, nullptr};
+State state1103 = {&shift0, &reduce0, &go1103};
+State state1104 = {&shift1104, &reduce1104, nullptr};
+State state1105 = {&shift661, &reduce661, nullptr};
+State state1106 = {&shift1106, &reduce1106, &go1106};
+State state1107 = {&shift663, &reduce663, nullptr};
+State state1108 = {&shift110, &reduce110, &go1108};
+State state1109 = {&shift1109, &reduce1109, nullptr};
+State state1110 = {&shift666, &reduce666, nullptr};
+State state1111 = {&shift1111, &reduce1111, nullptr};
+State state1112 = {&shift0, &reduce0, &go1112};
+State state1113 = {&shift1113, &reduce1113, nullptr};
+State state1114 = {&shift670, &reduce670, nullptr};
+State state1115 = {&shift1115, &reduce1115, &go1115};
+State state1116 = {&shift672, &reduce672, nullptr};
+State state1117 = {&shift110, &reduce110, &go1117};
+State state1118 = {&shift1118, &reduce1118, nullptr};
+State state1119 = {&shift675, &reduce675, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,628 @@
+#include "tests.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"+", false, 2};
+Symbol term3 = {"-", false, 3};
+Symbol term4 = {"*", false, 4};
+Symbol term5 = {"/", false, 5};
+Symbol term6 = {"(", false, 6};
+Symbol term7 = {")", false, 7};
+
+class Num;
+
+unique_ptr<Num>
+scan_num(Table*, const std::string&);
+
+Value*
+scan0(Table* t, const std::string& s) {
+    unique_ptr<Num> value = scan_num(t, s);
+    return value.release();
+}
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 16 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 8) { return &node4; }
+    if (k == 9) { return &node5; }
+    if (k == 11) { return &node6; }
+    if (k == 13) { return &node7; }
+    if (k == 14) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 14) { return &node8; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {nullptr, &term6, nullptr};
+Node node3 = {nullptr, &term7, nullptr};
+Node node4 = {nullptr, &term4, nullptr};
+Node node5 = {nullptr, &term2, nullptr};
+Node node6 = {nullptr, &term3, nullptr};
+Node node7 = {nullptr, &term5, nullptr};
+Node node8 = {&next8, &term0, &scan0};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+Symbol endmark = {"$", false, 8};
+Symbol nonterm0 = {"total", false, 0};
+Symbol nonterm1 = {"add", false, 1};
+Symbol nonterm2 = {"mul", false, 2};
+Symbol nonterm3 = {"unary", false, 3};
+Symbol nonterm4 = {"atom", false, 4};
+
+unique_ptr<Num>
+reduce_total(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_total(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_total(table, E0);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_add(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_add(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_add(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_sub(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_sub(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_sub(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_mul(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_mul(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_mul(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_div(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_div(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_div(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_neg(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_neg(Table* table, Value** values) {
+    unique_ptr<Num> E1(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_neg(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_total, -1};
+Rule rule1 = {&nonterm1, 1, nullptr, 0};
+Rule rule2 = {&nonterm1, 3, &reduce_add, -1};
+Rule rule3 = {&nonterm1, 3, &reduce_sub, -1};
+Rule rule4 = {&nonterm2, 1, nullptr, 0};
+Rule rule5 = {&nonterm2, 3, &reduce_mul, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_div, -1};
+Rule rule7 = {&nonterm3, 1, nullptr, 0};
+Rule rule8 = {&nonterm3, 2, &reduce_neg, -1};
+Rule rule9 = {&nonterm4, 1, nullptr, 0};
+Rule rule10 = {&nonterm4, 3, nullptr, 1};
+
+extern State state0;
+extern State state1;
+extern State state2;
+extern State state3;
+extern State state4;
+extern State state5;
+extern State state6;
+extern State state7;
+extern State state8;
+extern State state9;
+extern State state10;
+extern State state11;
+extern State state12;
+extern State state13;
+extern State state14;
+extern State state15;
+extern State state16;
+extern State state17;
+extern State state18;
+extern State state19;
+extern State state20;
+extern State state21;
+extern State state22;
+extern State state23;
+extern State state24;
+extern State state25;
+extern State state26;
+extern State state27;
+extern State state28;
+extern State state29;
+extern State state30;
+extern State state31;
+extern State state32;
+extern State state33;
+extern State state34;
+extern State state35;
+
+std::vector<Shift> shift0 = {{&term0, &state1}, {&term3, &state2}, {&term6, &state3}};
+std::vector<Reduce> reduce0 = {};
+std::vector<Shift> shift1 = {};
+std::vector<Reduce> reduce1 = {{nullptr, &rule9, false}};
+std::vector<Shift> shift3 = {{&term0, &state16}, {&term3, &state17}, {&term6, &state18}};
+std::vector<Reduce> reduce3 = {};
+std::vector<Shift> shift4 = {{&term2, &state12}, {&term3, &state13}};
+std::vector<Reduce> reduce4 = {{&endmark, &rule0, true}};
+std::vector<Shift> shift5 = {{&term4, &state8}, {&term5, &state9}};
+std::vector<Reduce> reduce5 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift6 = {};
+std::vector<Reduce> reduce6 = {{nullptr, &rule4, false}};
+std::vector<Shift> shift7 = {};
+std::vector<Reduce> reduce7 = {{nullptr, &rule7, false}};
+std::vector<Shift> shift10 = {};
+std::vector<Reduce> reduce10 = {{nullptr, &rule6, false}};
+std::vector<Shift> shift11 = {};
+std::vector<Reduce> reduce11 = {{nullptr, &rule5, false}};
+std::vector<Shift> shift14 = {{&term4, &state8}, {&term5, &state9}};
+std::vector<Reduce> reduce14 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift15 = {{&term4, &state8}, {&term5, &state9}};
+std::vector<Reduce> reduce15 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift19 = {{&term2, &state27}, {&term3, &state28}, {&term7, &state29}};
+std::vector<Reduce> reduce19 = {};
+std::vector<Shift> shift20 = {{&term4, &state23}, {&term5, &state24}};
+std::vector<Reduce> reduce20 = {{nullptr, &rule1, false}};
+std::vector<Shift> shift29 = {};
+std::vector<Reduce> reduce29 = {{nullptr, &rule10, false}};
+std::vector<Shift> shift30 = {{&term4, &state23}, {&term5, &state24}};
+std::vector<Reduce> reduce30 = {{nullptr, &rule3, false}};
+std::vector<Shift> shift31 = {{&term4, &state23}, {&term5, &state24}};
+std::vector<Reduce> reduce31 = {{nullptr, &rule2, false}};
+std::vector<Shift> shift32 = {{&term2, &state27}, {&term3, &state28}, {&term7, &state33}};
+std::vector<Reduce> reduce32 = {};
+std::vector<Shift> shift34 = {};
+std::vector<Reduce> reduce34 = {{nullptr, &rule8, false}};
+
+std::vector<Go> go0 = {{&nonterm1, &state4}, {&nonterm2, &state5}, {&nonterm3, &state6}, {&nonterm4, &state7}};
+std::vector<Go> go2 = {{&nonterm3, &state35}, {&nonterm4, &state7}};
+std::vector<Go> go3 = {{&nonterm1, &state19}, {&nonterm2, &state20}, {&nonterm3, &state21}, {&nonterm4, &state22}};
+std::vector<Go> go8 = {{&nonterm3, &state11}, {&nonterm4, &state7}};
+std::vector<Go> go9 = {{&nonterm3, &state10}, {&nonterm4, &state7}};
+std::vector<Go> go12 = {{&nonterm2, &state15}, {&nonterm3, &state6}, {&nonterm4, &state7}};
+std::vector<Go> go13 = {{&nonterm2, &state14}, {&nonterm3, &state6}, {&nonterm4, &state7}};
+std::vector<Go> go17 = {{&nonterm3, &state34}, {&nonterm4, &state22}};
+std::vector<Go> go18 = {{&nonterm1, &state32}, {&nonterm2, &state20}, {&nonterm3, &state21}, {&nonterm4, &state22}};
+std::vector<Go> go23 = {{&nonterm3, &state26}, {&nonterm4, &state22}};
+std::vector<Go> go24 = {{&nonterm3, &state25}, {&nonterm4, &state22}};
+std::vector<Go> go27 = {{&nonterm2, &state31}, {&nonterm3, &state21}, {&nonterm4, &state22}};
+std::vector<Go> go28 = {{&nonterm2, &state30}, {&nonterm3, &state21}, {&nonterm4, &state22}};
+
+State state0 = {&shift0, &reduce0, &go0};
+State state1 = {&shift1, &reduce1, nullptr};
+State state2 = {&shift0, &reduce0, &go2};
+State state3 = {&shift3, &reduce3, &go3};
+State state4 = {&shift4, &reduce4, nullptr};
+State state5 = {&shift5, &reduce5, nullptr};
+State state6 = {&shift6, &reduce6, nullptr};
+State state7 = {&shift7, &reduce7, nullptr};
+State state8 = {&shift0, &reduce0, &go8};
+State state9 = {&shift0, &reduce0, &go9};
+State state10 = {&shift10, &reduce10, nullptr};
+State state11 = {&shift11, &reduce11, nullptr};
+State state12 = {&shift0, &reduce0, &go12};
+State state13 = {&shift0, &reduce0, &go13};
+State state14 = {&shift14, &reduce14, nullptr};
+State state15 = {&shift15, &reduce15, nullptr};
+State state16 = {&shift1, &reduce1, nullptr};
+State state17 = {&shift3, &reduce3, &go17};
+State state18 = {&shift3, &reduce3, &go18};
+State state19 = {&shift19, &reduce19, nullptr};
+State state20 = {&shift20, &reduce20, nullptr};
+State state21 = {&shift6, &reduce6, nullptr};
+State state22 = {&shift7, &reduce7, nullptr};
+State state23 = {&shift3, &reduce3, &go23};
+State state24 = {&shift3, &reduce3, &go24};
+State state25 = {&shift10, &reduce10, nullptr};
+State state26 = {&shift11, &reduce11, nullptr};
+State state27 = {&shift3, &reduce3, &go27};
+State state28 = {&shift3, &reduce3, &go28};
+State state29 = {&shift29, &reduce29, nullptr};
+State state30 = {&shift30, &reduce30, nullptr};
+State state31 = {&shift31, &reduce31, nullptr};
+State state32 = {&shift32, &reduce32, nullptr};
+State state33 = {&shift29, &reduce29, nullptr};
+State state34 = {&shift34, &reduce34, nullptr};
+State state35 = {&shift34, &reduce34, nullptr};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &state0;
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    for (auto& s : *state->shift) {
+        if (s.symbol == sym) {
+            return s.next;
+        }
+    }
+    return nullptr;
+}
+State*
+find_goto(State* state, Symbol* sym) {
+   if (!state->go)
+        return nullptr;
+   for (auto& g : *state->go) {
+       if (g.symbol == sym) {
+           return g.state;
+       }
+   }
+   return nullptr;
+};
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,631 @@
+#include "tests.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"num", false, 0};
+Symbol term1 = {"ws", true, 1};
+Symbol term2 = {"+", false, 2};
+Symbol term3 = {"-", false, 3};
+Symbol term4 = {"*", false, 4};
+Symbol term5 = {"/", false, 5};
+Symbol term6 = {"(", false, 6};
+Symbol term7 = {")", false, 7};
+
+class Num;
+
+unique_ptr<Num>
+scan_num(Table*, const std::string&);
+
+Value*
+scan0(Table* t, const std::string& s) {
+    unique_ptr<Num> value = scan_num(t, s);
+    return value.release();
+}
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15
+};
+
+int lexer_starts[] = {
+    0
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 0;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 16 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 7) { return &node3; }
+    if (k == 8) { return &node4; }
+    if (k == 9) { return &node5; }
+    if (k == 11) { return &node6; }
+    if (k == 13) { return &node7; }
+    if (k == 14) { return &node8; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 14) { return &node8; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term1, nullptr};
+Node node2 = {nullptr, &term6, nullptr};
+Node node3 = {nullptr, &term7, nullptr};
+Node node4 = {nullptr, &term4, nullptr};
+Node node5 = {nullptr, &term2, nullptr};
+Node node6 = {nullptr, &term3, nullptr};
+Node node7 = {nullptr, &term5, nullptr};
+Node node8 = {&next8, &term0, &scan0};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* match = nullptr;
+    int k = 0;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 1: case 2: goto node1;
+    case 4: goto node1;
+    case 6: goto node2;
+    case 7: goto node3;
+    case 8: goto node4;
+    case 9: goto node5;
+    case 11: goto node6;
+    case 13: goto node7;
+    case 14: goto node8;
+    default: break;
+    }
+    return match;
+node1:
+    match = &node1;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 1: case 2: goto node1;
+    case 4: goto node1;
+    default: break;
+    }
+    return match;
+node2:
+    match = &node2;
+    *end = pos;
+    return match;
+node3:
+    match = &node3;
+    *end = pos;
+    return match;
+node4:
+    match = &node4;
+    *end = pos;
+    return match;
+node5:
+    match = &node5;
+    *end = pos;
+    return match;
+node6:
+    match = &node6;
+    *end = pos;
+    return match;
+node7:
+    match = &node7;
+    *end = pos;
+    return match;
+node8:
+    match = &node8;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 14: goto node8;
+    default: break;
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+    int row;
+};
+
+Symbol endmark = {"$", false, 8};
+Symbol nonterm0 = {"total", false, 0};
+Symbol nonterm1 = {"add", false, 1};
+Symbol nonterm2 = {"mul", false, 2};
+Symbol nonterm3 = {"unary", false, 3};
+Symbol nonterm4 = {"atom", false, 4};
+
+unique_ptr<Num>
+reduce_total(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_total(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_total(table, E0);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_add(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_add(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_add(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_sub(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_sub(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_sub(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_mul(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_mul(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_mul(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_div(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_div(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-3]));
+    unique_ptr<Num> E2(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_div(table, E0, E2);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_neg(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_neg(Table* table, Value** values) {
+    unique_ptr<Num> E1(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_neg(table, E1);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_total, -1};
+Rule rule1 = {&nonterm1, 1, nullptr, 0};
+Rule rule2 = {&nonterm1, 3, &reduce_add, -1};
+Rule rule3 = {&nonterm1, 3, &reduce_sub, -1};
+Rule rule4 = {&nonterm2, 1, nullptr, 0};
+Rule rule5 = {&nonterm2, 3, &reduce_mul, -1};
+Rule rule6 = {&nonterm2, 3, &reduce_div, -1};
+Rule rule7 = {&nonterm3, 1, nullptr, 0};
+Rule rule8 = {&nonterm3, 2, &reduce_neg, -1};
+Rule rule9 = {&nonterm4, 1, nullptr, 0};
+Rule rule10 = {&nonterm4, 3, nullptr, 1};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6, &rule7,
+    &rule8, &rule9, &rule10
+};
+
+State parse_states[36] = {
+    {0, 0}, {1, 1}, {2, 0}, {3, 2}, {4, 3}, {5, 4}, {6, 5}, {7, 6},
+    {8, 0}, {9, 0}, {10, 7}, {11, 8}, {12, 0}, {13, 0}, {14, 9}, {15, 10},
+    {16, 1}, {17, 2}, {18, 2}, {19, 11}, {20, 12}, {21, 5}, {22, 6}, {23, 2},
+    {24, 2}, {25, 7}, {26, 8}, {27, 2}, {28, 2}, {29, 13}, {30, 14}, {31, 15},
+    {32, 16}, {33, 13}, {34, 17}, {35, 17}
+};
+
+unsigned char action_base[] = {
+    0, 0, 1, 6, 14, 0, 0, 0, 0, 16, 18, 8, 20, 0, 22, 24,
+    10, 0
+};
+
+unsigned char action_default[] = {
+    0, 38, 0, 0, 6, 18, 30, 26, 22, 14, 10, 0, 6, 42, 14, 10,
+    0, 34
+};
+
+unsigned char action_check[] = {
+    0, 2, 18, 0, 2, 18, 0, 2, 3, 3, 11, 11, 16, 16, 3, 11,
+    18, 16, 4, 4, 9, 9, 10, 10, 12, 12, 14, 14, 15, 15, 18, 18,
+    18
+};
+
+unsigned char action_next[] = {
+    5, 65, 0, 9, 69, 0, 13, 73, 49, 53, 109, 113, 109, 113, 3, 117,
+    0, 133, 33, 37, 33, 37, 33, 37, 93, 97, 93, 97, 93, 97, 0, 0,
+    0
+};
+
+unsigned char goto_base[] = {
+    0, 1, 16, 0, 18
+};
+
+unsigned char goto_default[] = {
+    0, 4, 20, 21, 22
+};
+
+unsigned char goto_check[] = {
+    3, 5, 3, 5, 1, 5, 5, 5, 3, 3, 5, 5, 3, 3, 5, 5,
+    2, 3, 4, 1, 4, 5, 5, 3, 3, 5, 4, 4, 2, 2, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 5, 5, 5,
+    5, 5, 5, 5, 5, 5
+};
+
+unsigned char goto_next[] = {
+    6, 0, 35, 0, 19, 0, 0, 0, 11, 10, 0, 0, 6, 6, 0, 0,
+    5, 34, 7, 32, 7, 0, 0, 26, 25, 0, 7, 7, 15, 14, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0
+};
+
+/* Comb tables of 508 bytes, 78.3951% of the 648 bytes of dense tables. */
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
@@ -0,0 +1,686 @@
+#include "tests.hpp"
+#include <cstring>
+#include <memory>
+using std::unique_ptr;
+using std::vector;
+
+
+
+struct Symbol {
+    const char* name;
+    bool skip;
+    int id;
+};
+
+struct Node {
+    Node* (*next)(int c);
+    Symbol* accept;
+    Value* (*scan)(Table*, const std::string&);
+};
+
+
+struct Shift {
+    Symbol* symbol;
+    State*  next;
+};
+
+struct Rule {
+    Symbol* nonterm;
+    int length;
+    Value* (*reduce)(Table*, Value**);
+    int value;
+};
+
+struct Reduce {
+    Symbol* symbol;
+    Rule*   rule;
+    bool    accept;
+};
+
+struct Go {
+    Symbol* symbol;
+    State*  state;
+};
+
+Symbol term0 = {"let", false, 0};
+Symbol term1 = {"id", false, 1};
+Symbol term2 = {"num", false, 2};
+Symbol term3 = {"ws", true, 3};
+Symbol term4 = {"=", false, 4};
+Symbol term5 = {";", false, 5};
+
+class Num;
+
+unique_ptr<Num>
+scan_length(Table*, const std::string&);
+
+Value*
+scan1(Table* t, const std::string& s) {
+    unique_ptr<Num> value = scan_length(t, s);
+    return value.release();
+}
+
+unique_ptr<Num>
+scan_num(Table*, const std::string&);
+
+Value*
+scan2(Table* t, const std::string& s) {
+    unique_ptr<Num> value = scan_num(t, s);
+    return value.release();
+}
+
+extern Node node0;
+extern Node node1;
+extern Node node2;
+extern Node node3;
+extern Node node4;
+extern Node node5;
+extern Node node6;
+extern Node node7;
+extern Node node8;
+
+unsigned char lexer_classes[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 9, 10, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 12, 12, 12, 12, 13, 14, 14, 14, 14, 14, 14, 15, 16, 16, 16,
+    16, 16, 16, 16, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19
+};
+
+int lexer_starts[] = {
+    945, 970
+};
+
+int
+lexer_class(int c) {
+    if (c < 0) {
+        return -1;
+    } else if (c < 256) {
+        return lexer_classes[c];
+    }
+    int low = 0;
+    int high = 2;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (lexer_starts[mid] <= c) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return 20 + low - 1;
+}
+
+Node*
+next0(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    if (k == 6) { return &node2; }
+    if (k == 8) { return &node3; }
+    if (k == 10) { return &node4; }
+    if ((k >= 12) && (k <= 14)) { return &node5; }
+    if (k == 15) { return &node6; }
+    if ((k >= 16) && (k <= 18)) { return &node5; }
+    if (k == 20) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next1(int c) {
+    int k = lexer_class(c);
+    if ((k >= 1) && (k <= 2)) { return &node1; }
+    if (k == 4) { return &node1; }
+    return nullptr;
+}
+
+Node*
+next2(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node2; }
+    return nullptr;
+}
+
+Node*
+next5(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if ((k >= 12) && (k <= 18)) { return &node5; }
+    if (k == 20) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next6(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if (k == 12) { return &node5; }
+    if (k == 13) { return &node7; }
+    if ((k >= 14) && (k <= 18)) { return &node5; }
+    if (k == 20) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next7(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if ((k >= 12) && (k <= 16)) { return &node5; }
+    if (k == 17) { return &node8; }
+    if (k == 18) { return &node5; }
+    if (k == 20) { return &node5; }
+    return nullptr;
+}
+
+Node*
+next8(int c) {
+    int k = lexer_class(c);
+    if (k == 6) { return &node5; }
+    if ((k >= 12) && (k <= 18)) { return &node5; }
+    if (k == 20) { return &node5; }
+    return nullptr;
+}
+
+Node node0 = {&next0, nullptr, nullptr};
+Node node1 = {&next1, &term3, nullptr};
+Node node2 = {&next2, &term2, &scan2};
+Node node3 = {nullptr, &term5, nullptr};
+Node node4 = {nullptr, &term4, nullptr};
+Node node5 = {&next5, &term1, &scan1};
+Node node6 = {&next6, &term1, &scan1};
+Node node7 = {&next7, &term1, &scan1};
+Node node8 = {&next8, &term0, nullptr};
+
+
+
+Node*
+node_next(Node* node, int c) {
+    if (node->next) {
+        return node->next(c);
+    }
+    return nullptr;
+}
+
+Symbol*
+node_accept(Node* node) {
+    return node->accept;
+}
+
+Value*
+node_scan(Node* node, Table* table, const std::string& text) {
+    Value* value = nullptr;
+    if (node->scan) {
+        value = node->scan(table, text);
+    }
+    return value;
+}
+
+Symbol*
+rule_nonterm(Rule* rule, size_t* length) {
+    *length = rule->length;
+    return rule->nonterm;
+}
+
+Value*
+rule_reduce(Rule* rule, Table* table, Value** values) {
+    if (rule->reduce) {
+        return rule->reduce(table, values);
+    } else {
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
+        } else {
+            return nullptr;
+        }
+    }
+}
+
+
+
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* match = nullptr;
+    int k = 0;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 1: case 2: goto node1;
+    case 4: goto node1;
+    case 6: goto node2;
+    case 8: goto node3;
+    case 10: goto node4;
+    case 12: case 13: case 14: goto node5;
+    case 15: goto node6;
+    case 16: case 17: case 18: goto node5;
+    case 20: goto node5;
+    default: break;
+    }
+    return match;
+node1:
+    match = &node1;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 1: case 2: goto node1;
+    case 4: goto node1;
+    default: break;
+    }
+    return match;
+node2:
+    match = &node2;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 6: goto node2;
+    default: break;
+    }
+    return match;
+node3:
+    match = &node3;
+    *end = pos;
+    return match;
+node4:
+    match = &node4;
+    *end = pos;
+    return match;
+node5:
+    match = &node5;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 6: goto node5;
+    case 12: case 13: case 14: case 15: case 16: case 17: case 18: goto node5;
+    case 20: goto node5;
+    default: break;
+    }
+    return match;
+node6:
+    match = &node6;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 6: goto node5;
+    case 12: goto node5;
+    case 13: goto node7;
+    case 14: case 15: case 16: case 17: case 18: goto node5;
+    case 20: goto node5;
+    default: break;
+    }
+    return match;
+node7:
+    match = &node7;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 6: goto node5;
+    case 12: case 13: case 14: case 15: case 16: goto node5;
+    case 17: goto node8;
+    case 18: goto node5;
+    case 20: goto node5;
+    default: break;
+    }
+    return match;
+node8:
+    match = &node8;
+    *end = pos;
+    if (pos >= length) {
+        return match;
+    }
+    if (input[pos] < 0x80) {
+        k = lexer_classes[input[pos++]];
+    } else {
+        k = lexer_class(parse_char(input, length, &pos));
+    }
+    switch (k) {
+    case 6: goto node5;
+    case 12: case 13: case 14: case 15: case 16: case 17: case 18: goto node5;
+    case 20: goto node5;
+    default: break;
+    }
+    return match;
+}
+
+
+struct State {
+    int id;
+};
+
+Symbol endmark = {"$", false, 6};
+Symbol nonterm0 = {"program", false, 0};
+Symbol nonterm1 = {"stmts", false, 1};
+Symbol nonterm2 = {"stmt", false, 2};
+Symbol nonterm3 = {"value", false, 3};
+
+unique_ptr<Num>
+reduce_program(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_program(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_program(table, E0);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_none(Table*);
+
+Value*
+reduce_none(Table* table, Value** values) {
+    unique_ptr<Num> R = reduce_none(table);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_add(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_add(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-2]));
+    unique_ptr<Num> E1(dynamic_cast<Num*>(values[-1]));
+    unique_ptr<Num> R = reduce_add(table, E0, E1);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_let(Table*, unique_ptr<Num>&, unique_ptr<Num>&);
+
+Value*
+reduce_let(Table* table, Value** values) {
+    unique_ptr<Num> E1(dynamic_cast<Num*>(values[-4]));
+    unique_ptr<Num> E3(dynamic_cast<Num*>(values[-2]));
+    unique_ptr<Num> R = reduce_let(table, E1, E3);
+    return R.release();
+}
+
+unique_ptr<Num>
+reduce_value(Table*, unique_ptr<Num>&);
+
+Value*
+reduce_value(Table* table, Value** values) {
+    unique_ptr<Num> E0(dynamic_cast<Num*>(values[-2]));
+    unique_ptr<Num> R = reduce_value(table, E0);
+    return R.release();
+}
+
+Rule rule0 = {&nonterm0, 1, &reduce_program, -1};
+Rule rule1 = {&nonterm1, 0, &reduce_none, -1};
+Rule rule2 = {&nonterm1, 2, &reduce_add, -1};
+Rule rule3 = {&nonterm2, 5, &reduce_let, -1};
+Rule rule4 = {&nonterm2, 2, &reduce_value, -1};
+Rule rule5 = {&nonterm3, 1, nullptr, 0};
+Rule rule6 = {&nonterm3, 1, nullptr, 0};
+
+Rule* parse_rules[] = {
+    &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6
+};
+
+State parse_states[12] = {
+    {0}, {1}, {2}, {3}, {4}, {5}, {6}, {7},
+    {8}, {9}, {10}, {11}
+};
+
+unsigned char parse_actions[12][7] = {
+    {6, 6, 6, 6, 6, 6, 6},
+    {9, 13, 17, 0, 0, 0, 3},
+    {0, 33, 0, 0, 0, 0, 0},
+    {22, 22, 22, 22, 22, 22, 22},
+    {26, 26, 26, 26, 26, 26, 26},
+    {10, 10, 10, 10, 10, 10, 10},
+    {0, 0, 0, 0, 0, 29, 0},
+    {18, 18, 18, 18, 18, 18, 18},
+    {0, 0, 0, 0, 37, 0, 0},
+    {0, 13, 17, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 45, 0},
+    {14, 14, 14, 14, 14, 14, 14},
+};
+
+unsigned char parse_gotos[12][4] = {
+    {0, 1, 0, 0},
+    {0, 0, 5, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 10},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+};
+
+Node* lexer_start = &node0;
+
+State* parser_start = &parse_states[0];
+
+Symbol* symbol_endmark = &endmark;
+
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = parse_actions[state->id][sym->id];
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = parse_actions[state->id][sym->id];
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    return &parse_states[parse_gotos[state->id][sym->id]];
+}
+
+
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
+
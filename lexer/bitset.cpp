@@ -0,0 +1,166 @@
+#include "bitset.hpp"
+
+#include <algorithm>
+
+static const size_t bits = 64;
+
+bool
+Bitset::insert(size_t index)
+{
+    size_t word = index / bits;
+    if (word >= words.size()) {
+        words.resize(word + 1, 0);
+    }
+    uint64_t mask = (uint64_t)1 << (index % bits);
+    if (words[word] & mask) {
+        return false;
+    }
+    words[word] |= mask;
+    return true;
+}
+
+bool
+Bitset::insert(const Bitset& other)
+{
+    if (other.words.size() > words.size()) {
+        words.resize(other.words.size(), 0);
+    }
+    bool added = false;
+    for (size_t i = 0; i < other.words.size(); i++) {
+        uint64_t update = words[i] | other.words[i];
+        if (update != words[i]) {
+            words[i] = update;
+            added = true;
+        }
+    }
+    return added;
+}
+
+void
+Bitset::erase(size_t index)
+{
+    size_t word = index / bits;
+    if (word < words.size()) {
+        words[word] &= ~((uint64_t)1 << (index % bits));
+    }
+}
+
+bool
+Bitset::contains(size_t index) const
+{
+    size_t word = index / bits;
+    if (word >= words.size()) {
+        return false;
+    }
+    return (words[word] >> (index % bits)) & 1;
+}
+
+bool
+Bitset::intersects(const Bitset& other) const
+{
+    size_t size = std::min(words.size(), other.words.size());
+    for (size_t i = 0; i < size; i++) {
+        if (words[i] & other.words[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+Bitset::empty() const
+{
+    for (uint64_t word : words) {
+        if (word) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t
+Bitset::count() const
+{
+    size_t result = 0;
+    for (uint64_t word : words) {
+        result += __builtin_popcountll(word);
+    }
+    return result;
+}
+
+void
+Bitset::clear()
+{
+    words.clear();
+}
+
+size_t
+Bitset::next(size_t index) const
+{
+    size_t word = index / bits;
+    if (word >= words.size()) {
+        return npos;
+    }
+    
+    uint64_t rest = words[word] & (~(uint64_t)0 << (index % bits));
+    while (true) {
+        if (rest) {
+            return word * bits + __builtin_ctzll(rest);
+        }
+        word++;
+        if (word >= words.size()) {
+            return npos;
+        }
+        rest = words[word];
+    }
+}
+
+/******************************************************************************/
+size_t
+Bitset::hash() const
+{
+    size_t size = words.size();
+    while (size > 0 && words[size - 1] == 0) {
+        size--;
+    }
+    
+    size_t result = size;
+    for (size_t i = 0; i < size; i++) {
+        hash_combine(result, words[i]);
+    }
+    return result;
+}
+
+bool
+Bitset::operator==(const Bitset& other) const
+{
+    size_t size = std::max(words.size(), other.words.size());
+    for (size_t i = 0; i < size; i++) {
+        uint64_t left  = (i < words.size()) ? words[i] : 0;
+        uint64_t right = (i < other.words.size()) ? other.words[i] : 0;
+        if (left != right) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+Bitset::operator!=(const Bitset& other) const
+{
+    return !(*this == other);
+}
+
+bool
+Bitset::operator<(const Bitset& other) const
+{
+    size_t size = std::max(words.size(), other.words.size());
+    for (size_t i = 0; i < size; i++) {
+        uint64_t left  = (i < words.size()) ? words[i] : 0;
+        uint64_t right = (i < other.words.size()) ? other.words[i] : 0;
+        if (left != right) {
+            return left < right;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,56 @@
+/**
+ * Set of small unsigned integers, such as the indices of symbols or states,
+ * stored as the bits of machine words.
+ */
+
+#ifndef bitset_hpp
+#define bitset_hpp
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Unlike a std::set, the union and intersection of two bitsets are computed a
+ * word at a time without allocating a node per element.  The set grows as
+ * larger indices are inserted, and missing words are treated as zero when
+ * comparing sets.
+ */
+class Bitset
+{
+public:
+    /** Returns true if the index, or any index of the other set, is new. */
+    bool insert(size_t index);
+    bool insert(const Bitset& other);
+    void erase(size_t index);
+    
+    bool contains(size_t index) const;
+    bool intersects(const Bitset& other) const;
+    bool empty() const;
+    size_t count() const;
+    void clear();
+    
+    /**
+     * Returns the first index in the set at or after the given index, or npos
+     * if there are none, for iterating over the set.
+     */
+    size_t next(size_t index) const;
+    static const size_t npos = (size_t)-1;
+    
+    size_t hash() const;
+    bool operator==(const Bitset& other) const;
+    bool operator!=(const Bitset& other) const;
+    bool operator<(const Bitset& other) const;
+    
+private:
+    std::vector<uint64_t> words;
+};
+
+/** Mixes the value into the hash, so that the order of the values matters. */
+inline void
+hash_combine(size_t& result, size_t value)
+{
+    result ^= value + 0x9e3779b9 + (result << 6) + (result >> 2);
+}
+
+#endif
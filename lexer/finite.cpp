@@ -1,6 +1,7 @@
 #include "finite.hpp"
 
 #include <algorithm>
+#include <climits>
 
 /**
  * Terminals of the grammar.  The rank is required when a strings matches
@@ -22,29 +23,140 @@ Term::write(std::ostream& out) const {
 
 /**
  * The state machine is constructed by connecting states to each other with
- * outputs.  Each state contains a vector of outputs that defines the next
- * active states for a given input character.  While operating the machine, one
- * or more states is in a set of active states.
+ * outputs.  Each state holds the span of its outputs in the automaton, where
+ * an output defines the next active state for a given input character.
  */
-Finite::Finite():
-term(nullptr){}
-
 Finite::Finite(Term* accept):
 term(accept){}
 
+/**
+ * Each terminal is given a unique rank to determine which pattern will be
+ * the accepted match in cases with multiple final states.
+ */
+bool
+Finite::lower_rank(const Finite& left, const Finite& right)
+{
+    if (left.term && right.term) {
+        return left.term->rank < right.term->rank;
+    } else if (left.term) {
+        return true;
+    } else {
+        return false;
+    }
+}
+
+Finite::Out::Out(size_t state, int first, int last, size_t next):
+state   (state),
+next    (next),
+epsilon (false),
+first   (first),
+last    (last){}
+
+Finite::Out::Out(size_t state, size_t next):
+state   (state),
+next    (next),
+epsilon (true),
+first   ('\0'),
+last    ('\0'){}
+
+bool
+Finite::Out::is_epsilon() const {
+    return epsilon;
+}
+
+bool
+Finite::Out::in_range(int c) const {
+    if (epsilon) {
+        return false;
+    } else {
+        return (c >= first && c <= last);
+    }
+}
+
+/******************************************************************************/
+size_t
+Automaton::add_state() {
+    states.emplace_back(nullptr);
+    return states.size() - 1;
+}
+
+size_t
+Automaton::add_state(Term* accept) {
+    states.emplace_back(accept);
+    return states.size() - 1;
+}
+
+size_t
+Automaton::add_out(size_t state, int c, size_t next) {
+    outs.emplace_back(state, c, c, next);
+    return outs.size() - 1;
+}
+
+size_t
+Automaton::add_out(size_t state, int first, int last, size_t next) {
+    outs.emplace_back(state, first, last, next);
+    return outs.size() - 1;
+}
+
+size_t
+Automaton::add_epsilon(size_t state, size_t next) {
+    outs.emplace_back(state, next);
+    return outs.size() - 1;
+}
+
+void
+Automaton::connect(size_t out, size_t next) {
+    outs[out].next = next;
+}
+
+void
+Automaton::set_term(size_t state, Term* accept) {
+    states[state].term = accept;
+}
+
+size_t
+Automaton::size() const {
+    return states.size();
+}
+
+/**
+ * The outputs are added in the order the expressions are parsed, so a stable
+ * sort by state keeps the order of the outputs within each state.
+ */
+void
+Automaton::finish()
+{
+    std::stable_sort(outs.begin(), outs.end(),
+                     [](const Finite::Out& left, const Finite::Out& right) {
+        return left.state < right.state;
+    });
+    
+    for (auto& state : states) {
+        state.first_out = 0;
+        state.count_out = 0;
+    }
+    for (size_t i = outs.size(); i > 0; i--) {
+        Finite& state = states[outs[i - 1].state];
+        state.first_out = i - 1;
+        state.count_out++;
+    }
+    
+    solve_closures();
+}
+
 /**
  * Reads from an input stream, following the outputs base on each character,
  * until no new states are found.  Returns the lowest ranked term term of the
  * final set of states.
  */
 Term*
-Finite::scan(std::istream& in, std::string* match)
+Automaton::scan(size_t start, std::istream& in, std::string* match)
 {
     /** Current states and the new ones found based on the input character. */
-    std::set<Finite*> current;
-    std::set<Finite*> found;
+    std::vector<size_t> current;
+    std::vector<size_t> found;
     
-    current.insert(this);
+    current.push_back(start);
     closure(&current);
     
     bool done = false;
@@ -53,8 +165,8 @@ Finite::scan(std::istream& in, std::string* match)
     while (!done) {
         int c = in.peek();
         
-        for (Finite* state : current) {
-            state->find_next(c, &found);
+        for (size_t state : current) {
+            find_next(state, c, &found);
         }
         closure(&found);
         
@@ -68,145 +180,137 @@ Finite::scan(std::istream& in, std::string* match)
     }
     
     /** Return the terminal with the lowest rank. */
-    auto lowest = std::min_element(current.begin(), current.end(), lower_rank);
-    if (lowest != current.end()) {
-        return (*lowest)->term;
-    } else {
-        return nullptr;
-    }
+    return find_accept(current);
 }
 
 /**
- * Find all of the new active states based on the current set and the next
+ * Find all of the new active states based on the current state and the next
  * character of the input string.
  */
 void
-Finite::find_next(int c, std::set<Finite*>* next) const
+Automaton::find_next(size_t state, int c, std::vector<size_t>* next) const
 {
-    for (auto& out : outs) {
-        if (out->in_range(c)) {
-            if (out->next) {
-                next->insert(out->next);
-            }
+    const Finite& finite = states[state];
+    for (size_t i = 0; i < finite.count_out; i++) {
+        const Finite::Out& out = outs[finite.first_out + i];
+        if (out.in_range(c) && out.next != none) {
+            next->push_back(out.next);
         }
     }
 }
 
+/**
+ * Since the bounds of every output range start a class, each range covers the
+ * classes from the one starting at its first character up to its last.
+ */
 void
-Finite::find_next(int c, std::set<Finite*>* next, int* last) const
+Automaton::find_next(size_t state, const std::vector<int>& classes,
+                     std::vector<std::vector<size_t>>* next) const
 {
-    for (auto& out : outs)
+    const Finite& finite = states[state];
+    for (size_t i = 0; i < finite.count_out; i++)
     {
-        if (out->in_range(c)) {
-            if (out->next)
-                next->insert(out->next);
-            if (*last > out->last)
-                *last = out->last;
+        const Finite::Out& out = outs[finite.first_out + i];
+        if (out.is_epsilon() || out.next == none) {
+            continue;
         }
-        else if (!out->is_epsilon()) {
-            if (out->first > c && out->first <= *last) {
-                *last = out->first - 1;
-            }
+        auto c = std::lower_bound(classes.begin(), classes.end(), out.first);
+        for (; c != classes.end() && *c <= out.last; ++c) {
+            (*next)[c - classes.begin()].push_back(out.next);
         }
     }
 }
 
-/**
- * Closure methods follow the empty transitions of a state to complete the new
- * active set after reading a character.
- */
 void
-Finite::closure(std::set<Finite*>* states)
+Automaton::find_bounds(std::set<int>* bounds) const
 {
-    std::vector<Finite*> stack;
-    stack.insert(stack.end(), states->begin(), states->end());
-    
-    while (stack.size() > 0) {
-        Finite* check = stack.back();
-        stack.pop_back();
-        check->closure(states, &stack);
+    for (auto& out : outs) {
+        if (!out.is_epsilon()) {
+            bounds->insert(out.first);
+            if (out.last < INT_MAX) {
+                bounds->insert(out.last + 1);
+            }
+        }
     }
 }
 
 /**
- * Closure methods follow the empty transitions of a state to complete the new
- * active set after reading a character.  Newly found states are added to a
- * stack to check later.
+ * The closure of each state is solved once by following its empty transitions
+ * with a stack, marking the states found so each is added only once.
  */
 void
-Finite::closure(std::set<Finite*>* states, std::vector<Finite*>* stack) const
+Automaton::solve_closures()
 {
-    for (auto& out: outs) {
-        if (out->is_epsilon()) {
-            Finite* next = out->next;
-            if (next) {
-                auto found = states->insert(next);
-                if (found.second) {
-                    stack->push_back(next);
+    closures.clear();
+    
+    std::vector<size_t> stack;
+    for (size_t start = 0; start < states.size(); start++)
+    {
+        size_t first = closures.size();
+        marks.insert(start);
+        closures.push_back(start);
+        stack.push_back(start);
+        
+        while (stack.size() > 0) {
+            const Finite& check = states[stack.back()];
+            stack.pop_back();
+            
+            for (size_t i = 0; i < check.count_out; i++) {
+                const Finite::Out& out = outs[check.first_out + i];
+                if (out.is_epsilon() && out.next != none &&
+                    marks.insert(out.next)) {
+                    closures.push_back(out.next);
+                    stack.push_back(out.next);
                 }
             }
         }
+        
+        for (size_t i = first; i < closures.size(); i++) {
+            marks.erase(closures[i]);
+        }
+        states[start].first_closure = first;
+        states[start].count_closure = closures.size() - first;
     }
 }
 
 /**
- * Each terminal is given a unique rank to determine which pattern will be
- * the accepted match in cases with multiple final states.
+ * Closure completes the new active set after reading a character, joining the
+ * closures of its states.  The states already found are marked, so each is
+ * added only once.
  */
-bool
-Finite::lower_rank(const Finite* left, const Finite* right)
+void
+Automaton::closure(std::vector<size_t>* active)
 {
-    if (left->term && right->term) {
-        return left->term->rank < right->term->rank;
-    } else if (left->term) {
-        return true;
-    } else {
-        return false;
+    std::vector<size_t> result;
+    for (size_t state : *active) {
+        const Finite& check = states[state];
+        for (size_t i = 0; i < check.count_closure; i++) {
+            size_t next = closures[check.first_closure + i];
+            if (marks.insert(next)) {
+                result.push_back(next);
+            }
+        }
     }
-}
-
-Finite::Out::Out(int first, int last, Finite* next):
-next    (next),
-epsilon (false),
-first   (first),
-last    (last){}
-
-Finite::Out::Out(Finite* next):
-next    (next),
-epsilon (true),
-first   ('\0'),
-last    ('\0'){}
-
-bool
-Finite::Out::is_epsilon() {
-    return epsilon;
-}
-
-bool
-Finite::Out::in_range(int c) {
-    if (epsilon) {
-        return false;
-    } else {
-        return (c >= first && c <= last);
+    
+    for (size_t state : result) {
+        marks.erase(state);
     }
+    std::sort(result.begin(), result.end());
+    *active = std::move(result);
 }
 
-/** Builds and returns new outputs, but retains ownership. */
-Finite::Out*
-Finite::add_out(int c, Finite* next) {
-    outs.emplace_back(std::make_unique<Out>(c, c, next));
-    return outs.back().get();
-}
-
-Finite::Out*
-Finite::add_out(int first, int last, Finite* next) {
-    outs.emplace_back(std::make_unique<Out>(first, last, next));
-    return outs.back().get();
-}
-
-Finite::Out*
-Finite::add_epsilon(Finite* next) {
-    outs.emplace_back(std::make_unique<Out>(next));
-    return outs.back().get();
+/**
+ * Since the DFA states contain multiple finite states, determine the NFA state
+ * with the lowest ranked accept to represent the pattern matched.
+ */
+Term*
+Automaton::find_accept(const std::vector<size_t>& active) const
+{
+    const Finite* lowest = nullptr;
+    for (size_t state : active) {
+        if (!lowest || Finite::lower_rank(states[state], *lowest)) {
+            lowest = &states[state];
+        }
+    }
+    return lowest ? lowest->term : nullptr;
 }
-
@@ -6,6 +6,8 @@
 #ifndef finite_hpp
 #define finite_hpp
 
+#include "bitset.hpp"
+
 #include <set>
 #include <string>
 #include <vector>
@@ -23,6 +25,15 @@ public:
     virtual ~Symbol() = default;
     std::string type;
     
+    /**
+     * Dense index assigned after reading the grammar.  Terminals, with the
+     * endmark after the last terminal, and nonterminals are numbered
+     * separately, so the index can be used with arrays of either kind.  The
+     * flag tells the two kinds apart without casting the symbol.
+     */
+    size_t id = 0;
+    bool terminal = true;
+    
     virtual void print(std::ostream& out) const = 0;
     virtual void write(std::ostream& out) const = 0;
 };
@@ -46,21 +57,25 @@ public:
 
 /**
  * The state machine is constructed by connecting states to each other with
- * outputs.  Each state contains a vector of outputs that defines the next
- * active states for a given input character.  While operating the machine, one
- * or more states is in a set of active states.
+ * outputs.  Each state holds the span of its outputs in the automaton, where
+ * an output defines the next active state for a given input character.  While
+ * operating the machine, one or more states is in a set of active states.
  */
 class Finite
 {
 public:
-    Finite();
     Finite(Term* term);
     
     /** Pointer indicates a match when this state active. */
     Term* term = nullptr;
     
-    /** Checks an input stream for a match starting from this state. */
-    Term* scan(std::istream& in, std::string* match);
+    /** Span of the outputs of the state, after the automaton is finished. */
+    size_t first_out = 0;
+    size_t count_out = 0;
+    
+    /** Span of the states reached by empty transitions, including itself. */
+    size_t first_closure = 0;
+    size_t count_closure = 0;
     
     /**
      * If the next character is within the output range of an active state, then
@@ -69,39 +84,94 @@ public:
      */
     class Out {
     public:
-        Out(int first, int last, Finite* next);
-        Out(Finite* next);
+        Out(size_t state, int first, int last, size_t next);
+        Out(size_t state, size_t next);
         
-        Finite* next = nullptr;
-        bool is_epsilon();
-        bool in_range(int c);
+        size_t state;
+        size_t next;
+        bool is_epsilon() const;
+        bool in_range(int c) const;
         
         bool epsilon;
         int first;
         int last;
     };
     
-    /** Builds and returns new outputs, but retains ownership. */
-    Out* add_out(int c, Finite* next);
-    Out* add_out(int first, int last, Finite* next);
-    Out* add_epsilon(Finite* next);
+    /** Determines the accepted match in cases with multiple final states. */
+    static bool lower_rank(const Finite& left, const Finite& right);
+};
+
+/**
+ * The states of every expression of a lexer are kept together, numbered in the
+ * order they are added, so a set of active states is a sorted vector of
+ * indices.  All outputs are in a single vector, and finishing the automaton
+ * groups them by their state, so the outputs of a state are next to each other.
+ */
+class Automaton
+{
+public:
+    
+    /** Index of the target of an output that is not yet connected. */
+    static const size_t none = (size_t)-1;
+    
+    /** Builds states and outputs, returning their indices. */
+    size_t add_state();
+    size_t add_state(Term* accept);
+    size_t add_out(size_t state, int c, size_t next);
+    size_t add_out(size_t state, int first, int last, size_t next);
+    size_t add_epsilon(size_t state, size_t next);
+    
+    /**
+     * Sets the target of an output.  The indices of outputs are only valid
+     * until the automaton is finished.
+     */
+    void connect(size_t out, size_t next);
+    void set_term(size_t state, Term* accept);
+    
+    /**
+     * After adding all of the expressions, groups the outputs by state and
+     * solves the closure of every state.
+     */
+    void finish();
+    
+    size_t size() const;
+    
+    /** Checks an input stream for a match starting from the given state. */
+    Term* scan(size_t start, std::istream& in, std::string* match);
     
     /** Finds output targets with the given character in its range. */
-    void find_next(int c, std::set<Finite*>* next) const;
-    void find_next(int c, std::set<Finite*>* next, int* last) const;
+    void find_next(size_t state, int c, std::vector<size_t>* next) const;
     
-    /** Follows empty transitions until no new states are found. */
-    static void closure(std::set<Finite*>* states);
-    void closure(std::set<Finite*>* states, std::vector<Finite*>* stack) const;
+    /**
+     * Finds the output targets for every character class in the output ranges,
+     * given the first character of each class.
+     */
+    void find_next(size_t state, const std::vector<int>& classes,
+                   std::vector<std::vector<size_t>>* next) const;
     
-    /** Determines the accepted match in cases with multiple final states. */
-    static bool lower_rank(const Finite* left, const Finite* right);
+    /** Adds the first character of each range and the one after its end. */
+    void find_bounds(std::set<int>* bounds) const;
+    
+    /**
+     * Adds the states reached by empty transitions, using the closure of each
+     * state solved when finishing.  The states are sorted, without any
+     * repeated, after the closure.
+     */
+    void closure(std::vector<size_t>* states);
+    
+    /** Returns the lowest ranked term of a set of states. */
+    Term* find_accept(const std::vector<size_t>& states) const;
     
 private:
+    std::vector<Finite> states;
+    std::vector<Finite::Out> outs;
+    
+    /** The closures of all states, in the spans given by each state. */
+    std::vector<size_t> closures;
+    void solve_closures();
     
-    /** Next active states for a given input character. */
-    std::vector<std::unique_ptr<Out>> outs;
+    /** States found during a closure, which are cleared after. */
+    Bitset marks;
 };
 
 #endif
-
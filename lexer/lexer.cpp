@@ -2,13 +2,21 @@
 
 #include <algorithm>
 #include <climits>
+#include <unordered_map>
+
+size_t Lexer::comparisons = 0;
 
 bool
 Lexer::add_regex(Term* accept, const std::string& regex)
 {
-    std::unique_ptr<Regex> expr = std::make_unique<Regex>();
+    std::unique_ptr<Regex> expr = std::make_unique<Regex>(&automaton);
     
-    bool ok = expr->parse(regex, accept);
+    bool ok = false;
+    if (construction == position) {
+        ok = expr->parse_positions(regex, accept);
+    } else {
+        ok = expr->parse(regex, accept);
+    }
     if (!ok) {
         std::cerr << "Unable to parse expression.\n";
         return false;
@@ -21,7 +29,7 @@ Lexer::add_regex(Term* accept, const std::string& regex)
 bool
 Lexer::add_literal(Term* accept, const std::string& series)
 {
-    std::unique_ptr<Literal> expr = std::make_unique<Literal>();
+    std::unique_ptr<Literal> expr = std::make_unique<Literal>(&automaton);
     
     bool ok = expr->parse(series, accept);
     if (!ok) {
@@ -33,37 +41,63 @@ Lexer::add_literal(Term* accept, const std::string& series)
     return true;
 }
 
+/**
+ * The classes start at zero, at the first character of every output range and
+ * at the character after the end of each range.
+ */
+void
+Lexer::solve_classes()
+{
+    std::set<int> bounds;
+    bounds.insert(0);
+    automaton.find_bounds(&bounds);
+    classes.assign(bounds.begin(), bounds.end());
+}
+
+int
+Lexer::find_class(int c) const
+{
+    if (c < 0) {
+        return -1;
+    }
+    auto found = std::upper_bound(classes.begin(), classes.end(), c);
+    return (int)(found - classes.begin()) - 1;
+}
+
 /**
  * Converts the multiple non-deterministic finite automaton (NFA) defined by
  * regular expressions into a single deterministic finite automaton (DFA).
  * The lexer DFA is built by finding new nodes that are the possible sets of
  * finite nodes of a NFA while reading input characters.  Starting with the
  * initial set of finite nodes as the first DFA node, solve will follow
- * character ranges to new sets of nodes.  Each new found set of nodes will
+ * character classes to new sets of nodes.  Each new found set of nodes will
  * define a new DFA node.  This searching will continue until no new sets of
  * nodes are found.
  */
 void
 Lexer::solve()
 {
+    automaton.finish();
+    solve_classes();
+    
     /** Build the first node from the start node of all expressions. */
     auto first = std::make_unique<Node>();
     for (auto& expr : exprs) {
-        if (expr->start) {
-            first->items.insert(expr->start);
-        }
+        first->items.push_back(expr->start);
     }
     for (auto& expr : literals) {
-        if (expr->start) {
-            first->items.insert(expr->start);
-        }
+        first->items.push_back(expr->start);
     }
     
-    first->solve_closure();
-    first->solve_accept();
+    first->solve_closure(automaton);
+    first->solve_accept(automaton);
     Node* initial = first.get();
     nodes.push_back(std::move(first));
     
+    std::unordered_map<const std::vector<size_t>*, Node*,
+                       ItemsHash, ItemsEqual> solved;
+    solved[&initial->items] = initial;
+    
     std::vector<Node*> pending;
     pending.push_back(initial);
     
@@ -72,132 +106,181 @@ Lexer::solve()
         Node* current = pending.back();
         pending.pop_back();
         
-        /** Check every character for a possible new set. */
-        int c = 0;
-        int max = INT_MAX;
-        while (true)
+        /** Find the set for every class, joining neighbors with the same. */
+        std::vector<std::vector<size_t>> found(classes.size());
+        current->find_next(automaton, classes, &found);
+        for (auto& next : found) {
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+        }
+        
+        size_t c = 0;
+        while (c < classes.size())
         {
-            int last = max;
-            std::set<Finite*> found;
-            current->find_next(c, &found, &last);
+            size_t end = c + 1;
+            while (end < classes.size() && found[end] == found[c]) {
+                end++;
+            }
+            int first = classes[c];
+            int last = end < classes.size() ? classes[end] - 1 : INT_MAX;
             
-            /** After searching check to see if the node was already found. */
-            if (found.size() > 0) {
-                auto node = std::make_unique<Node>();
-                node->items.insert(found.begin(), found.end());
-                node->solve_closure();
-                node->solve_accept();
-                
-                bool exists = false;
-                
-                for (auto& check : nodes) {
-                    if (check->items == node->items) {
-                        current->nexts[Node::Range(c, last)] = check.get();
-                        exists = true;
-                    }
-                }
+            /**
+             * The closure of the found set identifies the node, so it is
+             * looked up before a new node is made for it.
+             */
+            if (found[c].size() > 0) {
+                automaton.closure(&found[c]);
                 
-                if (!exists) {
-                    current->nexts[Node::Range(c, last)] = node.get();
+                auto exists = solved.find(&found[c]);
+                if (exists != solved.end()) {
+                    current->nexts[Node::Range(first, last)] = exists->second;
+                } else {
+                    auto node = std::make_unique<Node>();
+                    node->items = std::move(found[c]);
+                    node->solve_accept(automaton);
+                    solved[&node->items] = node.get();
+                    
+                    current->nexts[Node::Range(first, last)] = node.get();
                     pending.push_back(node.get());
                     nodes.push_back(std::move(node));
                 }
             }
-            
-            if (last == max) {
-                break;
-            } else {
-                c = last + 1;
-            }
+            c = end;
         }
     }
 }
 
-/**
- * Initial partion of the nodes for finding the unique sets of nodes.
- */
-std::vector<std::unique_ptr<Group>>
-initial_partition(const std::vector<std::unique_ptr<Node>>& nodes)
-{
-    std::map<Term*, std::unique_ptr<Group>> split;
-    
-    for (auto& node : nodes) {
-        auto found = split.find(node->accept);
-        if (found != split.end()) {
-            found->second->nodes.push_back(node.get());
-        } else {
-            auto group = std::make_unique<Group>();
-            group->nodes.push_back(node.get());
-            split.emplace(node->accept, std::move(group));
-        }
+size_t
+Lexer::ItemsHash::operator()(const std::vector<size_t>* items) const {
+    size_t result = items->size();
+    for (size_t item : *items) {
+        hash_combine(result, item);
     }
-    
-    std::vector<std::unique_ptr<Group>> result;
-    
-    for (auto& group : split) {
-        result.push_back(std::move(group.second));
-    }
-    
     return result;
 }
 
+bool
+Lexer::ItemsEqual::operator()(const std::vector<size_t>* left,
+                              const std::vector<size_t>* right) const {
+    comparisons++;
+    return *left == *right;
+}
+
+size_t
+Lexer::count_states() const {
+    return automaton.size();
+}
+
+/**
+ * Minimizes the nodes with Hopcroft's partition refinement.  The nodes start in
+ * blocks by their accepted term.  For a block and a character class, the nodes
+ * with a next node in the block are split from those without.  After splitting
+ * a block that is not waiting to be checked, only the smaller part needs to be
+ * checked, which solves the partition in O(n log n) time for each class.
+ */
 void
 Lexer::reduce()
 {
-    std::vector<std::unique_ptr<Group>> groups = initial_partition(nodes);
+    size_t size = nodes.size();
+    size_t width = classes.size();
     
-    std::map<Node*, Group*> lookup;
+    std::map<Node*, size_t> index;
+    for (size_t i = 0; i < size; i++) {
+        index[nodes[i].get()] = i;
+    }
     
-    for (auto& g : groups) {
-        for (auto n : g->nodes) {
-            lookup[n] = g.get();
+    /** Previous nodes for each class and next node, at offsets by both. */
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 0; i < size; i++) {
+        for (auto& next : nodes[i]->nexts) {
+            auto c = std::upper_bound(classes.begin(), classes.end(),
+                                      next.first.first) - classes.begin() - 1;
+            size_t target = index[next.second];
+            for (; (size_t)c < width && classes[c] <= next.first.last; c++) {
+                edges.emplace_back(c * size + target, i);
+            }
         }
     }
+    std::vector<size_t> offsets(width * size + 1, 0);
+    for (auto& edge : edges) {
+        offsets[edge.first + 1]++;
+    }
+    for (size_t i = 1; i < offsets.size(); i++) {
+        offsets[i] += offsets[i - 1];
+    }
+    std::vector<size_t> previous(edges.size());
+    std::vector<size_t> filled(offsets.begin(), offsets.end() - 1);
+    for (auto& edge : edges) {
+        previous[filled[edge.first]++] = edge.second;
+    }
+    
+    std::map<Term*, size_t> terms;
+    std::vector<size_t> keys;
+    for (auto& node : nodes) {
+        keys.push_back(terms.emplace(node->accept, terms.size()).first->second);
+    }
+    Partition partition(keys);
     
-    bool adding = true;
+    std::vector<std::pair<size_t, size_t>> pending;
+    std::vector<bool> waiting(partition.size() * width, true);
+    for (size_t block = 0; block < partition.size(); block++) {
+        for (size_t c = 0; c < width; c++) {
+            pending.emplace_back(block, c);
+        }
+    }
     
-    while (adding) {
-        adding = false;
+    while (pending.size() > 0)
+    {
+        size_t block = pending.back().first;
+        size_t c = pending.back().second;
+        pending.pop_back();
+        waiting[block * width + c] = false;
         
-        for (auto itr = groups.begin(); itr != groups.end(); ++itr) {
-            std::vector<std::unique_ptr<Group>> added = (*itr)->divide(lookup);
-            if (added.size() > 1) {
-                groups.erase(itr);
-                
-                for (auto& g : added) {
-                    for (auto n : g->nodes) {
-                        lookup[n] = g.get();
-                    }
-                    groups.push_back(std::move(g));
+        for (size_t target : partition.nodes(block)) {
+            size_t key = c * size + target;
+            for (size_t i = offsets[key]; i < offsets[key + 1]; i++) {
+                partition.mark(previous[i]);
+            }
+        }
+        
+        for (auto& split : partition.split()) {
+            waiting.resize(partition.size() * width, false);
+            
+            size_t smaller = split.second;
+            if (partition.count(split.first) < partition.count(split.second)) {
+                smaller = split.first;
+            }
+            for (size_t d = 0; d < width; d++) {
+                size_t add = smaller;
+                if (waiting[split.first * width + d]) {
+                    add = split.second;
+                }
+                if (!waiting[add * width + d]) {
+                    waiting[add * width + d] = true;
+                    pending.emplace_back(add, d);
                 }
-                adding = true;
-                break;
             }
         }
-    };
-    
-    std::map<Node*, Node*> replacement;
-    
-    std::vector<Node*> keep;
+    }
     
-    for (auto& group : groups) {
-        Node* initial = nodes.front().get();
-        auto found = std::find(group->nodes.begin(), group->nodes.end(), initial);
-        if (found == group->nodes.end()) {
-            found = group->nodes.begin();
-        }
-        Node* prime = *found;
-        keep.push_back(prime);
-        for (auto node : group->nodes) {
-            replacement[node] = prime;
+    /** The first node of each block replaces the others. */
+    std::vector<Node*> primes(partition.size(), nullptr);
+    for (size_t i = 0; i < size; i++) {
+        size_t block = partition.block(i);
+        if (!primes[block]) {
+            primes[block] = nodes[i].get();
         }
     }
     
+    std::map<Node*, Node*> replacement;
+    for (size_t i = 0; i < size; i++) {
+        replacement[nodes[i].get()] = primes[partition.block(i)];
+    }
+    
     std::vector<std::unique_ptr<Node>> reduced;
-    for (auto& node : nodes) {
-        auto found = std::find(keep.begin(), keep.end(), node.get());
-        if (found != keep.end()) {
-            reduced.push_back(std::move(node));
+    for (size_t i = 0; i < size; i++) {
+        if (primes[partition.block(i)] == nodes[i].get()) {
+            reduced.push_back(std::move(nodes[i]));
         }
     }
     
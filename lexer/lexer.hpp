@@ -24,6 +24,15 @@ class Lexer
 {
 public:
     
+    /**
+     * Regular expressions are built with Thompson's construction, which uses
+     * empty transitions to join the parts of an expression, or as a position
+     * automaton, which has a state for each character or range and no empty
+     * transitions.  Set before adding the expressions.
+     */
+    enum Construction { thompson, position };
+    Construction construction = thompson;
+    
     /** Adding expressions, return true if the provided expression is valid. */
     bool add_regex(Term* accept, const std::string& regex);
     bool add_literal(Term* accept, const std::string& series);
@@ -37,7 +46,38 @@ public:
 public:
     std::vector<std::unique_ptr<Node>> nodes;
     
+    /**
+     * Characters are split into classes, where all characters of a class are
+     * in the same output ranges of every state.  The nodes are solved for each
+     * class instead of each character, and the vector holds the first
+     * character of each class.
+     */
+    std::vector<int> classes;
+    
+    /** Returns the class of a character, or -1 for a negative character. */
+    int find_class(int c) const;
+    
+    /** Number of states of the automaton of all expressions. */
+    size_t count_states() const;
+    
+    /** Number of sets of finite states compared while looking up nodes. */
+    static size_t comparisons;
+    
 private:
+    void solve_classes();
+    
+    /** Looks up the solved nodes by their set of finite states. */
+    struct ItemsHash {
+        size_t operator()(const std::vector<size_t>* items) const;
+    };
+    struct ItemsEqual {
+        bool operator()(const std::vector<size_t>* left,
+                        const std::vector<size_t>* right) const;
+    };
+    
+    /** States of all expressions, which are numbered in one automaton. */
+    Automaton automaton;
+    
     std::vector<std::unique_ptr<Regex>> exprs;
     std::vector<std::unique_ptr<Literal>> literals;
 };
@@ -6,17 +6,18 @@
  * Builds the state machine by connecting a series of states, one for each
  * character in the pattern.
  */
+Literal::Literal(Automaton* automaton):
+automaton(automaton){}
+
 bool
 Literal::parse(const std::string& pattern, Term* accept)
 {
     std::istringstream in(pattern);
     
     /** Build a single state to start */
-    states.clear();
-    states.emplace_back(std::make_unique<Finite>());
-    start = states.back().get();
+    start = automaton->add_state();
     
-    Finite* state = start;
+    size_t state = start;
     
     /** Add a state for each character in the string */
     while (in.peek() != EOF)
@@ -51,13 +52,12 @@ Literal::parse(const std::string& pattern, Term* accept)
         }
         
         /** Each state has only a single output with its character. */
-        states.emplace_back(std::make_unique<Finite>());
-        Finite* next = states.back().get();
-        state->add_out(c, next);
+        size_t next = automaton->add_state();
+        automaton->add_out(state, c, next);
         state = next;
     }
     
     /** Set the term of the last state to indicate a match. */
-    state->term = accept;
+    automaton->set_term(state, accept);
     return true;
 }
@@ -16,14 +16,18 @@
 class Literal
 {
 public:
+    Literal(Automaton* automaton);
+    
     /** Builds the NFA to match the sequence. */
     bool parse(const std::string& in, Term* accept);
     
-    /** After parsing, call scan of the start state to look for a match. */
-    Finite* start = nullptr;
+    /** After parsing, call scan of the automaton to look for a match. */
+    size_t start = Automaton::none;
     
 private:
-    std::vector<std::unique_ptr<Finite>> states;
+    
+    /** The states are added to the automaton shared by the lexer. */
+    Automaton* automaton;
 };
 
 #endif
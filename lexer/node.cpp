@@ -1,7 +1,6 @@
 #include "node.hpp"
 
 #include <algorithm>
-#include <climits>
 
 Node*
 Node::get_next(int c, int* last)
@@ -21,9 +20,10 @@ Node::get_next(int c, int* last)
 }
 
 void
-Node::find_next(int c, std::set<Finite*>* found, int* last) {
-    for (Finite* item : items) {
-        item->find_next(c, found, last);
+Node::find_next(const Automaton& automaton, const std::vector<int>& classes,
+                std::vector<std::vector<size_t>>* found) {
+    for (size_t item : items) {
+        automaton.find_next(item, classes, found);
     }
 }
 
@@ -32,16 +32,8 @@ Node::find_next(int c, std::set<Finite*>* found, int* last) {
  * empty transitions to the newly found set of states.
  */
 void
-Node::solve_closure()
-{
-    std::vector<Finite*> stack;
-    stack.insert(stack.end(), items.begin(), items.end());
-    
-    while (stack.size() > 0) {
-        Finite* check = stack.back();
-        stack.pop_back();
-        check->closure(&items, &stack);
-    }
+Node::solve_closure(Automaton& automaton) {
+    automaton.closure(&items);
 }
 
 /**
@@ -50,12 +42,8 @@ Node::solve_closure()
  * current DFA state.
  */
 void
-Node::solve_accept()
-{
-    auto lowest = std::min_element(items.begin(), items.end(), Finite::lower_rank);
-    if (lowest != items.end()) {
-        accept = (*lowest)->term;
-    }
+Node::solve_accept(const Automaton& automaton) {
+    accept = automaton.find_accept(items);
 }
 
 void
@@ -115,64 +103,96 @@ Node::Range::operator<(const Range& other) const {
 }
 
 /******************************************************************************/
-std::vector<std::unique_ptr<Group>>
-Group::divide(const std::map<Node*, Group*>& lookup)
+Partition::Partition(const std::vector<size_t>& keys):
+location(keys.size()),
+owner   (keys.size())
 {
-    std::vector<std::unique_ptr<Group>> result;
+    for (size_t i = 0; i < keys.size(); i++) {
+        elements.push_back(i);
+    }
+    std::stable_sort(elements.begin(), elements.end(),
+                     [&keys](size_t left, size_t right) {
+        return keys[left] < keys[right];
+    });
     
-    for (auto node : nodes) {
-        bool inserted = false;
-        
-        for (auto& add : result) {
-            if (add->belongs(node, lookup)) {
-                add->nodes.push_back(node);
-                inserted = true;
-            }
-        }
-        
-        if (!inserted) {
-            auto add = std::make_unique<Group>();
-            add->nodes.push_back(node);
-            result.push_back(std::move(add));
+    for (size_t i = 0; i < elements.size(); i++) {
+        size_t node = elements[i];
+        if (i == 0 || keys[elements[i - 1]] != keys[node]) {
+            first.push_back(i);
+            marked.push_back(i);
+            last.push_back(i);
         }
+        location[node] = i;
+        owner[node] = first.size() - 1;
+        last.back() = i + 1;
     }
-    
-    return result;
 }
 
-/**
- * A node belong in a group if every target of the node is the same as every
- * node already in the group.  Since all nodes in a group have the same targets,
- * only compare the node to the first node of the group.
- */
-bool
-Group::belongs(Node* node, const std::map<Node*, Group*>& lookup)
+size_t
+Partition::size() const {
+    return first.size();
+}
+
+size_t
+Partition::block(size_t node) const {
+    return owner[node];
+}
+
+size_t
+Partition::count(size_t block) const {
+    return last[block] - first[block];
+}
+
+std::vector<size_t>
+Partition::nodes(size_t block) const {
+    return std::vector<size_t>(elements.begin() + first[block],
+                               elements.begin() + last[block]);
+}
+
+/** Swaps the node with the first unmarked node of its block. */
+void
+Partition::mark(size_t node)
 {
-    Node* other = nodes.front();
+    size_t block = owner[node];
+    size_t index = location[node];
+    if (index < marked[block]) {
+        return;
+    }
+    if (marked[block] == first[block]) {
+        touched.push_back(block);
+    }
     
-    int c = 0;
-    int max = INT_MAX;
+    size_t other = elements[marked[block]];
+    elements[index] = other;
+    location[other] = index;
+    elements[marked[block]] = node;
+    location[node] = marked[block];
+    marked[block]++;
+}
+
+std::vector<std::pair<size_t, size_t>>
+Partition::split()
+{
+    std::vector<std::pair<size_t, size_t>> added;
     
-    while (true)
-    {
-        int last = max;
-        Node* next = node->get_next(c, &last);
-        Node* comp = other->get_next(c, &last);
-        
-        if (comp || next) {
-            if (!comp || !next) {
-                return false;
-            } else if (lookup.at(comp) != lookup.at(next)) {
-                return false;
-            }
+    for (size_t block : touched) {
+        if (marked[block] == last[block]) {
+            marked[block] = first[block];
+            continue;
         }
         
-        if (last == max) {
-            break;
-        } else {
-            c = last + 1;
+        size_t created = first.size();
+        first.push_back(first[block]);
+        marked.push_back(first[block]);
+        last.push_back(marked[block]);
+        
+        for (size_t i = first[created]; i < last[created]; i++) {
+            owner[elements[i]] = created;
         }
+        first[block] = marked[block];
+        added.emplace_back(block, created);
     }
+    touched.clear();
     
-    return true;
+    return added;
 }
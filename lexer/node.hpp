@@ -23,7 +23,7 @@
 class Node
 {
   public:
-    std::set<Finite*> items;
+    std::vector<size_t> items;
     
     /** Accepted term when no new node is next. */
     Term* accept = nullptr;
@@ -32,9 +32,10 @@ class Node
     Node* get_next(int c, int* last);
     
     /** Solving for the next states in the DFA from this state. */
-    void find_next(int c, std::set<Finite*>* next, int* last);
-    void solve_closure();
-    void solve_accept();
+    void find_next(const Automaton& automaton, const std::vector<int>& classes,
+                   std::vector<std::vector<size_t>>* next);
+    void solve_closure(Automaton& automaton);
+    void solve_accept(const Automaton& automaton);
     
     /** Character range for connecting states. */
     struct Range {
@@ -59,17 +60,42 @@ class Node
 };
 
 /**
- * Group of nodes used in minimizing the number of states of a DFA.
+ * Partition of the nodes used in minimizing the number of states of a DFA.
+ * The nodes are numbered and the nodes of each block are kept together in one
+ * array.  Marked nodes are moved to the front of their block, so splitting the
+ * marked nodes from a block only takes time for the marked nodes.
  */
-class Group
+class Partition
 {
   public:
-    std::vector<Node*> nodes;
+    /** Starts with a block for each distinct key of the nodes. */
+    Partition(const std::vector<size_t>& keys);
     
-    std::vector<std::unique_ptr<Group>> divide(const std::map<Node*, Group*>& lookup);
+    size_t size() const;
+    size_t block(size_t node) const;
+    size_t count(size_t block) const;
+    
+    /** Nodes of a block, which are moved when the block is split. */
+    std::vector<size_t> nodes(size_t block) const;
+    
+    /**
+     * Marks a node, then splits every block with some but not all nodes
+     * marked.  The marked nodes form a new block, and the pairs of the old and
+     * new blocks are returned.
+     */
+    void mark(size_t node);
+    std::vector<std::pair<size_t, size_t>> split();
     
   private:
-    bool belongs(Node* node, const std::map<Node*, Group*>& lookup);
+    std::vector<size_t> elements;
+    std::vector<size_t> location;
+    std::vector<size_t> owner;
+    
+    std::vector<size_t> first;
+    std::vector<size_t> marked;
+    std::vector<size_t> last;
+    
+    std::vector<size_t> touched;
 };
 
 #endif
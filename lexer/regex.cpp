@@ -7,19 +7,21 @@
  * unconnected outputs are connected to a new state that contains a pointer to
  * the user defined terminal representing this expression.
  */
+Regex::Regex(Automaton* automaton):
+automaton(automaton){}
+
 bool
 Regex::parse(const std::string& in, Term* accept)
 {
-    states.clear();
     std::istringstream input(in);
-    std::vector<Finite::Out*> outs;
+    std::vector<size_t> outs;
     
     start = parse_expr(input, &outs);
     
-    if (start) {
-        Finite* target = add_state(accept);
-        for (Finite::Out* out : outs) {
-            out->next = target;
+    if (start != Automaton::none) {
+        size_t target = automaton->add_state(accept);
+        for (size_t out : outs) {
+            automaton->connect(out, target);
         }
         return true;
     }
@@ -34,19 +36,19 @@ Regex::parse(const std::string& in, Term* accept)
  * either one of patterns on the two sides of the bar.  As an example, the
  * expression ab|cd will look for the string ab or cd.
  */
-Finite*
-Regex::parse_expr(std::istream& in, std::vector<Finite::Out*>* outs)
+size_t
+Regex::parse_expr(std::istream& in, std::vector<size_t>* outs)
 {
-    Finite* expr = add_state();
+    size_t expr = automaton->add_state();
     
     while (in.peek() != EOF)
     {
-        Finite* term = parse_term(in, outs);
-        if (!term) {
-            return nullptr;
+        size_t term = parse_term(in, outs);
+        if (term == Automaton::none) {
+            return Automaton::none;
         }
         
-        expr->add_epsilon(term);
+        automaton->add_epsilon(expr, term);
         if (in.peek() == '|') {
             in.get();
         } else {
@@ -62,14 +64,14 @@ Regex::parse_expr(std::istream& in, std::vector<Finite::Out*>* outs)
  * tracks the outputs from the previous state.  Previously unconnected outputs
  * are then connected to the state built for the next letter in the expression.
  */
-Finite*
-Regex::parse_term(std::istream& in, std::vector<Finite::Out*>* outs)
+size_t
+Regex::parse_term(std::istream& in, std::vector<size_t>* outs)
 {
-    std::vector<Finite::Out*> fact_in;
-    std::vector<Finite::Out*> fact_out;
-    Finite* term = parse_fact(in, &fact_out);
-    if (!term) {
-        return nullptr;
+    std::vector<size_t> fact_in;
+    std::vector<size_t> fact_out;
+    size_t term = parse_fact(in, &fact_out);
+    if (term == Automaton::none) {
+        return Automaton::none;
     }
     
     while (true)
@@ -82,13 +84,13 @@ Regex::parse_term(std::istream& in, std::vector<Finite::Out*>* outs)
         fact_in = fact_out;
         fact_out.clear();
         
-        Finite* fact = parse_fact(in, &fact_out);
-        if (!fact) {
-            return nullptr;
+        size_t fact = parse_fact(in, &fact_out);
+        if (fact == Automaton::none) {
+            return Automaton::none;
         }
         
-        for (Finite::Out* input : fact_in) {
-            input->next = fact;
+        for (size_t input : fact_in) {
+            automaton->connect(input, fact);
         }
     }
     
@@ -105,13 +107,13 @@ Regex::parse_term(std::istream& in, std::vector<Finite::Out*>* outs)
  * marks that the previous character is optional.  As an example, ab?c will
  * match the strings abc or ac.
  */
-Finite*
-Regex::parse_fact(std::istream& in, std::vector<Finite::Out*>* outs)
+size_t
+Regex::parse_fact(std::istream& in, std::vector<size_t>* outs)
 {
-    std::vector<Finite::Out*> atom_outs;
-    Finite* atom = parse_atom(in, &atom_outs);
-    if (!atom) {
-        return nullptr;
+    std::vector<size_t> atom_outs;
+    size_t atom = parse_atom(in, &atom_outs);
+    if (atom == Automaton::none) {
+        return Automaton::none;
     }
     
     int c = in.peek();
@@ -120,22 +122,22 @@ Regex::parse_fact(std::istream& in, std::vector<Finite::Out*>* outs)
         return atom;
     }
     
-    Finite* state = add_state();
-    state->add_epsilon(atom);
-    Finite::Out* out2 = state->add_epsilon(nullptr);
+    size_t state = automaton->add_state();
+    automaton->add_epsilon(state, atom);
+    size_t out2 = automaton->add_epsilon(state, Automaton::none);
     
     outs->push_back(out2);
     
     switch (in.get()) {
     case '+': {
-        for (Finite::Out* out : atom_outs) {
-            out->next = state;
+        for (size_t out : atom_outs) {
+            automaton->connect(out, state);
         }
         return atom;
     }
     case '*': {
-        for (Finite::Out* out : atom_outs) {
-            out->next = state;
+        for (size_t out : atom_outs) {
+            automaton->connect(out, state);
         }
         return state;
     }
@@ -144,7 +146,7 @@ Regex::parse_fact(std::istream& in, std::vector<Finite::Out*>* outs)
         return state;
     }
     default: {
-        return nullptr;
+        return Automaton::none;
     }
     }
 }
@@ -158,19 +160,19 @@ Regex::parse_fact(std::istream& in, std::vector<Finite::Out*>* outs)
  * matches ab or ac. In another example, ab+ matches ab and abbb, while (ab)+
  * defines ab or ababab.
  */
-Finite*
-Regex::parse_atom(std::istream& in, std::vector<Finite::Out*>* outs)
+size_t
+Regex::parse_atom(std::istream& in, std::vector<size_t>* outs)
 {
     int c = in.peek();
     if (c == '(') {
         in.get();
-        Finite* expr = parse_expr(in, outs);
-        if (!expr) {
-            return nullptr;
+        size_t expr = parse_expr(in, outs);
+        if (expr == Automaton::none) {
+            return Automaton::none;
         }
         if (in.get() != ')') {
             std::cerr << "Expected ')' to end expression.\n";
-            return nullptr;
+            return Automaton::none;
         }
         return expr;
     }
@@ -180,68 +182,257 @@ Regex::parse_atom(std::istream& in, std::vector<Finite::Out*>* outs)
     }
     else if (c == ']' || c == ')' || c == '|') {
         std::cerr << "Unexpected '" << (char)c << "' in expression.\n";
-        return nullptr;
+        return Automaton::none;
     }
     else {
         int c = parse_char(in);
         if (c >= 0) {
-            Finite* state = add_state();
-            Finite::Out* out = state->add_out(c, nullptr);
+            size_t state = automaton->add_state();
+            size_t out = automaton->add_out(state, c, Automaton::none);
             outs->push_back(out);
             return state;
         } else {
-            return nullptr;
+            return Automaton::none;
         }
     }
 }
 
+/** Parses a range of characters, [a-z]. */
+size_t
+Regex::parse_atom_range(std::istream& in, std::vector<size_t>* outs)
+{
+    int first = parse_char(in);
+    if (first < 0) {
+        return Automaton::none;
+    }
+    
+    if (in.get() != '-') {
+        std::cerr << "Expected a '-' to separate range.\n";
+        return Automaton::none;
+    }
+    
+    int last = parse_char(in);
+    if (last < 0) {
+        return Automaton::none;
+    }
+    
+    if (in.get() != ']') {
+        std::cerr << "Expected a ']' to end range.\n";
+        return Automaton::none;
+    }
+    
+    size_t state = automaton->add_state();
+    size_t out = automaton->add_out(state, first, last, Automaton::none);
+    outs->push_back(out);
+    return state;
+}
+
+/******************************************************************************/
 /**
- * Builds a new state and retains ownership.  No memory leaks occur if any
- * exceptions or errors occur during subset construction, as the states vector
- * contains all fragments of the automaton.
+ * Builds the position automaton of the regular expression.  The start state
+ * has outputs to the first positions of the expression, and the last positions
+ * accept the user defined terminal, along with the start state if the
+ * expression could match an empty string.
  */
-Finite*
-Regex::add_state() {
-    states.emplace_back(std::make_unique<Finite>());
-    return states.back().get();
+bool
+Regex::parse_positions(const std::string& in, Term* accept)
+{
+    std::istringstream input(in);
+    ranges.clear();
+    
+    Positions expr;
+    start = automaton->add_state();
+    
+    if (position_expr(input, &expr)) {
+        connect({start}, expr.first);
+        for (size_t last : expr.last) {
+            automaton->set_term(last, accept);
+        }
+        if (expr.empty) {
+            automaton->set_term(start, accept);
+        }
+        return true;
+    }
+    else {
+        std::cerr << "Unable to parse expression '" << in << "'.\n";
+        return false;
+    }
 }
 
-Finite*
-Regex::add_state(Term* accept) {
-    states.emplace_back(std::make_unique<Finite>(accept));
-    return states.back().get();
+/** Either side of the vertical bar, |, is first, last or empty. */
+bool
+Regex::position_expr(std::istream& in, Positions* expr)
+{
+    while (in.peek() != EOF)
+    {
+        Positions term;
+        if (!position_term(in, &term)) {
+            return false;
+        }
+        
+        expr->empty = expr->empty || term.empty;
+        expr->first.insert(expr->first.end(),
+                           term.first.begin(), term.first.end());
+        expr->last.insert(expr->last.end(),
+                          term.last.begin(), term.last.end());
+        if (in.peek() == '|') {
+            in.get();
+        } else {
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * In a series, the last positions of each part are followed by the first
+ * positions of the next.  The first positions of the series continue through
+ * the parts that could be empty, as do the last positions backwards.
+ */
+bool
+Regex::position_term(std::istream& in, Positions* term)
+{
+    if (!position_fact(in, term)) {
+        return false;
+    }
+    
+    while (true)
+    {
+        int c = in.peek();
+        if (c == EOF || c == ')' || c == '|') {
+            break;
+        }
+        
+        Positions fact;
+        if (!position_fact(in, &fact)) {
+            return false;
+        }
+        
+        connect(term->last, fact.first);
+        if (term->empty) {
+            term->first.insert(term->first.end(),
+                               fact.first.begin(), fact.first.end());
+        }
+        if (fact.empty) {
+            term->last.insert(term->last.end(),
+                              fact.last.begin(), fact.last.end());
+        } else {
+            term->last = fact.last;
+        }
+        term->empty = term->empty && fact.empty;
+    }
+    return true;
+}
+
+/**
+ * The + and * operators connect the last positions back to the first, while
+ * the * and ? operators allow the part to be empty.
+ */
+bool
+Regex::position_fact(std::istream& in, Positions* fact)
+{
+    if (!position_atom(in, fact)) {
+        return false;
+    }
+    
+    int c = in.peek();
+    if (c == '+' || c == '*') {
+        connect(fact->last, fact->first);
+    }
+    if (c == '*' || c == '?') {
+        fact->empty = true;
+    }
+    if (c == '+' || c == '*' || c == '?') {
+        in.get();
+    }
+    return true;
+}
+
+bool
+Regex::position_atom(std::istream& in, Positions* atom)
+{
+    int c = in.peek();
+    if (c == '(') {
+        in.get();
+        if (!position_expr(in, atom)) {
+            return false;
+        }
+        if (in.get() != ')') {
+            std::cerr << "Expected ')' to end expression.\n";
+            return false;
+        }
+        return true;
+    }
+    else if (c == '[') {
+        in.get();
+        return position_atom_range(in, atom);
+    }
+    else if (c == ']' || c == ')' || c == '|') {
+        std::cerr << "Unexpected '" << (char)c << "' in expression.\n";
+        return false;
+    }
+    else {
+        int c = parse_char(in);
+        if (c < 0) {
+            return false;
+        }
+        size_t state = add_position(c, c);
+        atom->first.push_back(state);
+        atom->last.push_back(state);
+        return true;
+    }
 }
 
 /** Parses a range of characters, [a-z]. */
-Finite*
-Regex::parse_atom_range(std::istream& in, std::vector<Finite::Out*>* outs)
+bool
+Regex::position_atom_range(std::istream& in, Positions* atom)
 {
     int first = parse_char(in);
     if (first < 0) {
-        return nullptr;
+        return false;
     }
     
     if (in.get() != '-') {
         std::cerr << "Expected a '-' to separate range.\n";
-        return nullptr;
+        return false;
     }
     
     int last = parse_char(in);
     if (last < 0) {
-        return nullptr;
+        return false;
     }
     
     if (in.get() != ']') {
         std::cerr << "Expected a ']' to end range.\n";
-        return nullptr;
+        return false;
     }
     
-    Finite* state = add_state();
-    Finite::Out* out = state->add_out(first, last, nullptr);
-    outs->push_back(out);
+    size_t state = add_position(first, last);
+    atom->first.push_back(state);
+    atom->last.push_back(state);
+    return true;
+}
+
+size_t
+Regex::add_position(int first, int last)
+{
+    size_t state = automaton->add_state();
+    ranges[state] = std::make_pair(first, last);
     return state;
 }
 
+void
+Regex::connect(const std::vector<size_t>& from, const std::vector<size_t>& to)
+{
+    for (size_t state : from) {
+        for (size_t next : to) {
+            const std::pair<int, int>& range = ranges[next];
+            automaton->add_out(state, range.first, range.second, next);
+        }
+    }
+}
+
+/******************************************************************************/
 /** Returns the next printable character or escape sequence. */
 int
 Regex::parse_char(std::istream& in)
@@ -7,44 +7,76 @@
 
 #include "finite.hpp"
 
+#include <map>
+
 /**
  * Matches complex patterns defined with the regular expression syntax.  The
  * class implements the Thompson's construction algorithm to construct the
- * finite state machines.
+ * finite state machines, or alternatively the position automaton of Glushkov,
+ * which has no empty transitions.
  */
 class Regex
 {
 public:
+    Regex(Automaton* automaton);
     
     /** Builds the NFA to match the pattern. */
     bool parse(const std::string& in, Term* accept);
     
-    /** After parsing, call scan of the start state to look for a match. */
-    Finite* start = nullptr;
+    /** Builds the NFA to match the pattern without empty transitions. */
+    bool parse_positions(const std::string& in, Term* accept);
+    
+    /** After parsing, call scan of the automaton to look for a match. */
+    size_t start = Automaton::none;
     
 private:
-    std::vector<std::unique_ptr<Finite>> states;
-    Finite* add_state();
-    Finite* add_state(Term* accept);
+    
+    /** The states are added to the automaton shared by the lexer. */
+    Automaton* automaton;
     
     /**
      * Recursively reads the user defined expression and return subsets of
      * connected states for each part of the expression.  Each method takes the
-     * input expression stream and returns the first state of the set that
-     * matches the next part of the expression.
+     * input expression stream and returns the index of the first state of
+     * the set that matches the next part of the expression, or none after an
+     * error.
      *
      * These methods also return a vector all of the unconnected outputs from
      * the newly created states.  These outputs are connected later as the
      * recursive decent parser returns and assembles the complete finite
      * state machine.
      */
-    Finite* parse_expr(std::istream& in, std::vector<Finite::Out*>* outs);
-    Finite* parse_term(std::istream& in, std::vector<Finite::Out*>* outs);
-    Finite* parse_fact(std::istream& in, std::vector<Finite::Out*>* outs);
-    Finite* parse_atom(std::istream& in, std::vector<Finite::Out*>* outs);
+    size_t parse_expr(std::istream& in, std::vector<size_t>* outs);
+    size_t parse_term(std::istream& in, std::vector<size_t>* outs);
+    size_t parse_fact(std::istream& in, std::vector<size_t>* outs);
+    size_t parse_atom(std::istream& in, std::vector<size_t>* outs);
     
     /** Additional method to find characters in a range. */
-    Finite* parse_atom_range(std::istream& in, std::vector<Finite::Out*>* outs);
+    size_t parse_atom_range(std::istream& in, std::vector<size_t>* outs);
+    
+    /**
+     * In the position automaton, a state is added for each character or range
+     * in the expression, and the outputs into a state all match its range.
+     * Each method returns the positions that could match the first and the
+     * last character of its part of the expression, and whether the part
+     * could match an empty string.  The last positions of each part are
+     * connected to the first positions of the part that follows it.
+     */
+    struct Positions {
+        bool empty = false;
+        std::vector<size_t> first;
+        std::vector<size_t> last;
+    };
+    bool position_expr(std::istream& in, Positions* positions);
+    bool position_term(std::istream& in, Positions* positions);
+    bool position_fact(std::istream& in, Positions* positions);
+    bool position_atom(std::istream& in, Positions* positions);
+    bool position_atom_range(std::istream& in, Positions* positions);
+    
+    /** Adds a position and remembers the range that leads to it. */
+    size_t add_position(int first, int last);
+    void connect(const std::vector<size_t>& from, const std::vector<size_t>& to);
+    std::map<size_t, std::pair<int, int>> ranges;
     
     /** Returns the next printable character or escape sequence. */
     int parse_char(std::istream& in);
@@ -7,6 +7,8 @@
 #include "grammar.hpp"
 #include "display.hpp"
 #include "code.hpp"
+#include "cache.hpp"
+#include "profile.hpp"
 #include "options.hpp"
 
 #include <iostream>
@@ -27,6 +29,15 @@ main(int argc, char* argv[])
         return 0;
     }
 
+    if (!opt.profile.empty() && opt.profile != "text" && opt.profile != "json") {
+        std::cerr << "Unknown report format '" << opt.profile << "'.\n";
+        return 1;
+    }
+    Profile profile;
+    if (!opt.profile.empty()) {
+        Profile::count_allocations();
+    }
+    
     std::istream* in  = &std::cin;
     std::ostream* out = &std::cout;
     
@@ -54,7 +65,9 @@ main(int argc, char* argv[])
     
     Grammar grammar;
     
+    profile.begin("read grammar");
     bool ok = grammar.read_grammar(*in);
+    profile.end();
     if (!ok) {
         std::cerr << "Unable to read grammar.\n";
         return 1;
@@ -62,6 +75,14 @@ main(int argc, char* argv[])
     
     Lexer lexer;
     
+    if (opt.construction == "position") {
+        lexer.construction = Lexer::position;
+    } else if (opt.construction != "thompson") {
+        std::cerr << "Unknown construction '" << opt.construction << "'.\n";
+        return 1;
+    }
+    
+    profile.begin("add expressions");
     for (auto& term : grammar.terms) {
         if (!term->regex.empty()) {
             lexer.add_regex(term.get(), term->regex);
@@ -69,18 +90,105 @@ main(int argc, char* argv[])
             lexer.add_literal(term.get(), term->name);
         }
     }
-    
-    lexer.solve();
-    lexer.reduce();
+    profile.end();
     
     Solver parser;
     
-    ok = parser.solve(grammar);
-    if (!ok) {
-        std::cerr << "Unable to solve states of the grammar.\n";
+    if (opt.method == "lalr") {
+        parser.method = Solver::lalr;
+    } else if (opt.method == "pager") {
+        parser.method = Solver::pager;
+    } else if (opt.method != "lr1") {
+        std::cerr << "Unknown method '" << opt.method << "'.\n";
+        return 1;
+    }
+    
+    Code::Layout layout = Code::lists;
+    if (opt.layout == "dense") {
+        layout = Code::dense;
+    } else if (opt.layout == "comb") {
+        layout = Code::comb;
+    } else if (opt.layout != "lists") {
+        std::cerr << "Unknown table layout '" << opt.layout << "'.\n";
+        return 1;
+    }
+    
+    Code::Scanner scanner = Code::functions;
+    if (opt.scanner == "direct") {
+        scanner = Code::direct;
+    } else if (opt.scanner == "table") {
+        scanner = Code::table;
+    } else if (opt.scanner != "functions") {
+        std::cerr << "Unknown scanner '" << opt.scanner << "'.\n";
         return 1;
     }
     
+    if (opt.threads < 1) {
+        std::cerr << "Invalid number of threads.\n";
+        return 1;
+    }
+    parser.threads = opt.threads;
+    
+    /** A missing file of previous states is made after solving. */
+    Previous previous;
+    if (!opt.previouspath.empty()) {
+        std::ifstream previous_in(opt.previouspath);
+        if (previous_in) {
+            if (previous.read(previous_in, grammar)) {
+                parser.previous = &previous;
+            } else {
+                std::cerr << "Ignoring invalid previous states file.\n";
+            }
+        }
+    }
+    
+    /** The states of the items and the report are not saved in the cache. */
+    Cache cache(opt.cachepath, grammar, lexer, parser);
+    bool cached = false;
+    if (!opt.cachepath.empty() && !opt.show_states && !opt.show_report) {
+        profile.begin("load cache");
+        cached = cache.load(grammar, &lexer, &parser);
+        profile.end();
+    }
+    
+    size_t solved_nodes = lexer.nodes.size();
+    if (!cached) {
+        profile.begin("solve lexer");
+        lexer.solve();
+        profile.end();
+        solved_nodes = lexer.nodes.size();
+        
+        profile.begin("reduce lexer");
+        lexer.reduce();
+        profile.end();
+        
+        profile.begin("solve parser");
+        ok = parser.solve(grammar);
+        profile.end();
+        if (!ok) {
+            std::cerr << "Unable to solve states of the grammar.\n";
+            return 1;
+        }
+        
+        if (!opt.cachepath.empty()) {
+            cache.save(grammar, lexer, parser);
+        }
+        if (!opt.previouspath.empty()) {
+            std::ofstream previous_out(opt.previouspath);
+            if (previous_out) {
+                Previous::write(grammar, parser, previous_out);
+            } else {
+                std::cerr << "Unable to write previous states file.\n";
+            }
+        }
+    }
+    
+    if (opt.show_report) {
+        parser.solve_canonical(grammar);
+        Display::print_report(parser, std::cerr);
+    }
+    
+    profile.begin("write");
     if (opt.show_lexer) {
         Display::print_lexer(lexer, *out);
     } else if (opt.show_parser) {
@@ -88,13 +196,43 @@ main(int argc, char* argv[])
     } else if (opt.show_states) {
         Display::print_states(grammar, parser, std::cout);
     } else {
-        Code::write(grammar, lexer, *out);
-        ok = Code::write(grammar, parser, *out);
+        Code::write(grammar, lexer, scanner, *out);
+        ok = Code::write(grammar, parser, layout, *out);
         if (!ok) {
             std::cerr << "Error while writing the parse tables.\n";
             return 1;
         }
     }
+    out->flush();
+    profile.end();
+    
+    if (opt.show_report && Code::table_bytes > 0) {
+        Display::print_tables(Code::table_bytes, Code::dense_bytes, std::cerr);
+    }
+    
+    if (!opt.profile.empty()) {
+        profile.count("finite states", lexer.count_states());
+        profile.count("solved nodes", solved_nodes);
+        profile.count("reduced nodes", lexer.nodes.size());
+        profile.count("node comparisons", Lexer::comparisons);
+        profile.count("parser states", parser.states.size());
+        profile.count("unique actions", parser.actions.size());
+        profile.count("closures", State::closures);
+        profile.count("state comparisons", Solver::comparisons);
+        if (Code::table_bytes > 0) {
+            profile.count("table bytes", Code::table_bytes);
+            profile.count("dense table bytes", Code::dense_bytes);
+            profile.count("table percent of dense",
+                          (Code::table_bytes * 100 + Code::dense_bytes / 2) /
+                          std::max(Code::dense_bytes, (size_t)1));
+        }
+        
+        if (opt.profile == "json") {
+            profile.print_json(std::cerr);
+        } else {
+            profile.print_text(std::cerr);
+        }
+    }
     
     return 0;
 }
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <fstream>
 #include <cstring>
+#include <cstdlib>
 
 void
 Options::display_help()
@@ -10,10 +11,25 @@ Options::display_help()
     std::cout <<
     "Usage: parser [options] [file]\n"
     "  -o   specify output filename\n"
+    "  -c   directory for saving the solved states, which are reused while the\n"
+    "       terminals and rules of the grammar stay the same\n"
+    "  -i   file of the states from the previous run, whose unchanged states\n"
+    "       are reused and keep their ids\n"
+    "  -a   solve the parser states with the lr1 (default), lalr or pager method\n"
+    "  -j   number of threads for solving the lr1 or lalr parser states\n"
+    "  -g   write the parse tables as lists (default), dense tables or comb\n"
+    "       packed tables\n"
+    "  -x   write the lexer as functions (default) for each node, as one\n"
+    "       direct function, or as a table of the next node by class\n"
+    "  -e   build the regex automata with the thompson (default) or position\n"
+    "       construction\n"
     "\n"
     "  -l   display only the lexer states\n"
     "  -p   display only the parser table\n"
     "  -s   display only the parser states\n"
+    "  -r   report solver and table statistics to standard error\n"
+    "  -t   report the time, memory and counts of each phase to standard error\n"
+    "       as text or json\n"
     "\n"
     "  -v   display version and license\n"
     "\n"
@@ -71,6 +87,62 @@ Options::parse_option(char c, int argc, char *argv[], int* idx)
         }
         break;
     }
+    case 'c': {
+        if (*idx < argc) {
+            cachepath = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'i': {
+        if (*idx < argc) {
+            previouspath = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'a': {
+        if (*idx < argc) {
+            method = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'g': {
+        if (*idx < argc) {
+            layout = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'x': {
+        if (*idx < argc) {
+            scanner = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'e': {
+        if (*idx < argc) {
+            construction = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
+    case 'j': {
+        if (*idx < argc) {
+            threads = atoi(argv[(*idx)++]);
+            return true;
+        }
+        break;
+    }
+    case 't': {
+        if (*idx < argc) {
+            profile = argv[(*idx)++];
+            return true;
+        }
+        break;
+    }
     case 'h': {
         show_help = true;
         return true;
@@ -91,6 +163,10 @@ Options::parse_option(char c, int argc, char *argv[], int* idx)
         show_states = true;
         return true;
     }
+    case 'r': {
+        show_report = true;
+        return true;
+    }
     }
     return false;
 }
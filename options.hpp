@@ -16,12 +16,21 @@ class Options {
 
     std::string inpath;
     std::string outpath;
+    std::string cachepath;
+    std::string previouspath;
+    std::string profile;
+    std::string method = "lr1";
+    std::string construction = "thompson";
+    std::string layout = "lists";
+    std::string scanner = "functions";
+    int threads = 1;
     
     bool show_help      = false;
     bool show_version   = false;
     bool show_lexer     = false;
     bool show_parser    = false;
     bool show_states    = false;
+    bool show_report    = false;
     
   private:
     bool parse_option(char c, int argc, char *argv[], int* idx);
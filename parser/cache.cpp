@@ -0,0 +1,410 @@
+#include "cache.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+/******************************************************************************/
+/** Numbers are written as eight bytes, lowest first, on any platform. */
+static void
+write_number(std::ostream& out, int64_t value)
+{
+    uint64_t bits = (uint64_t)value;
+    for (int i = 0; i < 8; i++) {
+        out.put((char)(bits & 0xff));
+        bits >>= 8;
+    }
+}
+
+static bool
+read_number(std::istream& in, int64_t* value)
+{
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; i++) {
+        int c = in.get();
+        if (c == EOF) {
+            return false;
+        }
+        bits |= (uint64_t)(c & 0xff) << (8 * i);
+    }
+    *value = (int64_t)bits;
+    return true;
+}
+
+/** Reads a number that must be an index less than the given size. */
+static bool
+read_index(std::istream& in, size_t size, size_t* index)
+{
+    int64_t value = 0;
+    if (!read_number(in, &value) || value < 0 || (uint64_t)value >= size) {
+        return false;
+    }
+    *index = (size_t)value;
+    return true;
+}
+
+/**
+ * Reads the number of elements that follow.  Each element has at least one
+ * number, so a count larger than what is left of the file is rejected before
+ * anything is allocated for it.
+ */
+static bool
+read_count(std::istream& in, std::streamoff end, size_t* count)
+{
+    std::streamoff left = end - (std::streamoff)in.tellg();
+    return left >= 8 && read_index(in, (size_t)(left / 8), count);
+}
+
+static void
+write_string(std::ostream& out, const std::string& value) {
+    out << value.size() << ":" << value;
+}
+
+/** Hashes the description with the 64 bit FNV-1a hash. */
+static uint64_t
+hash_string(const std::string& value)
+{
+    uint64_t result = 14695981039346656037ull;
+    for (char c : value) {
+        result ^= (unsigned char)c;
+        result *= 1099511628211ull;
+    }
+    return result;
+}
+
+/******************************************************************************/
+Cache::Cache(const std::string& directory,
+             const Grammar& grammar,
+             const Lexer& lexer,
+             const Solver& solver)
+{
+    std::stringstream out;
+    describe(grammar, lexer, solver, out);
+    description = out.str();
+    
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0');
+    name << hash_string(description) << ".cache";
+    
+    path = directory;
+    if (!path.empty() && path.back() != '/') {
+        path += "/";
+    }
+    path += name.str();
+}
+
+/**
+ * Describes each terminal by its rank and pattern, and each rule by its
+ * symbols, given by their ids.  Names are only included for literals, where
+ * the name is the pattern.
+ */
+void
+Cache::describe(const Grammar& grammar,
+                const Lexer& lexer,
+                const Solver& solver,
+                std::ostream& out)
+{
+    out << "version " << version << "\n";
+    out << "construction " << lexer.construction << "\n";
+    out << "method " << solver.method << "\n";
+    
+    for (auto& term : grammar.terms) {
+        out << "term " << term->rank << " ";
+        if (term->regex.empty()) {
+            out << "literal ";
+            write_string(out, term->name);
+        } else {
+            out << "regex ";
+            write_string(out, term->regex);
+        }
+        out << "\n";
+    }
+    
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            out << "rule " << nonterm->id << ":";
+            for (auto sym : rule->product) {
+                out << (sym->terminal ? " t" : " n") << sym->id;
+            }
+            out << "\n";
+        }
+    }
+}
+
+/******************************************************************************/
+/**
+ * Nodes and states are written by their index in the vectors, and symbols and
+ * rules by their ids.  The file ends with the description again, so a file
+ * that was not completely written is not loaded.
+ */
+bool
+Cache::save(const Grammar& grammar,
+            const Lexer& lexer,
+            const Solver& solver) const
+{
+    std::map<const Term*, size_t> terms;
+    for (size_t i = 0; i < grammar.terms.size(); i++) {
+        terms[grammar.terms[i].get()] = i;
+    }
+    std::map<const Node*, size_t> nodes;
+    for (size_t i = 0; i < lexer.nodes.size(); i++) {
+        nodes[lexer.nodes[i].get()] = i;
+    }
+    std::map<const State*, size_t> states;
+    for (size_t i = 0; i < solver.states.size(); i++) {
+        states[solver.states[i].get()] = i;
+    }
+    std::map<const State::Actions*, size_t> actions;
+    for (size_t i = 0; i < solver.actions.size(); i++) {
+        actions[solver.actions[i].get()] = i;
+    }
+    
+    /** Write to a new file, then replace the old file only once complete. */
+    std::string temp = path + ".tmp";
+    std::ofstream out(temp, std::ios::binary);
+    if (!out) {
+        std::cerr << "Unable to write cache file '" << temp << "'.\n";
+        return false;
+    }
+    
+    write_string(out, description);
+    
+    write_number(out, lexer.classes.size());
+    for (int c : lexer.classes) {
+        write_number(out, c);
+    }
+    write_number(out, lexer.nodes.size());
+    for (auto& node : lexer.nodes) {
+        write_number(out, node->accept ? (int64_t)terms[node->accept] : -1);
+        write_number(out, node->nexts.size());
+        for (auto& next : node->nexts) {
+            write_number(out, next.first.first);
+            write_number(out, next.first.last);
+            write_number(out, nodes[next.second]);
+        }
+    }
+    
+    write_number(out, solver.states.size());
+    write_number(out, solver.actions.size());
+    for (auto& acts : solver.actions) {
+        write_number(out, acts->id);
+        write_number(out, acts->shift.size());
+        for (auto& shift : acts->shift) {
+            write_number(out, shift.first->id);
+            write_number(out, states[shift.second]);
+        }
+        write_number(out, acts->accept.size());
+        for (auto& accept : acts->accept) {
+            write_number(out, accept.first->id);
+            write_number(out, accept.second->id);
+        }
+        write_number(out, acts->reduce.size());
+        for (auto& reduce : acts->reduce) {
+            write_number(out, reduce.first->id);
+            write_number(out, reduce.second->id);
+        }
+        write_number(out, acts->any ? (int64_t)acts->any->id : -1);
+    }
+    
+    for (auto& state : solver.states) {
+        write_number(out, state->id);
+        write_number(out, actions[state->actions]);
+        write_number(out, state->gotos.size());
+        for (auto& go : state->gotos) {
+            write_number(out, go.first->id);
+            write_number(out, states[go.second]);
+        }
+    }
+    
+    write_string(out, description);
+    out.close();
+    
+    if (!out || std::rename(temp.c_str(), path.c_str()) != 0) {
+        std::remove(temp.c_str());
+        std::cerr << "Unable to write cache file '" << path << "'.\n";
+        return false;
+    }
+    return true;
+}
+
+/******************************************************************************/
+bool
+Cache::load(const Grammar& grammar, Lexer* lexer, Solver* solver) const
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    
+    if (!read(in, grammar, lexer, solver)) {
+        lexer->nodes.clear();
+        lexer->classes.clear();
+        solver->states.clear();
+        solver->actions.clear();
+        return false;
+    }
+    return true;
+}
+
+/** Checks every index read from the file, so a bad file is never used. */
+bool
+Cache::read(std::istream& in, const Grammar& grammar,
+            Lexer* lexer, Solver* solver) const
+{
+    std::streampos start = in.tellg();
+    if (start < 0 || !in.seekg(0, std::ios::end)) {
+        return false;
+    }
+    std::streamoff end = (std::streamoff)in.tellg();
+    if (end < 0 || !in.seekg(start)) {
+        return false;
+    }
+    
+    std::stringstream head;
+    write_string(head, description);
+    std::string check(head.str().size(), '\0');
+    
+    if (!in.read(&check[0], check.size()) || check != head.str()) {
+        return false;
+    }
+    
+    std::vector<Nonterm::Rule*> rules;
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            if (rule->id >= rules.size()) {
+                rules.resize(rule->id + 1, nullptr);
+            }
+            rules[rule->id] = rule.get();
+        }
+    }
+    std::vector<Nonterm*> nonterms(grammar.nonterms.size(), nullptr);
+    for (auto& nonterm : grammar.nonterms) {
+        nonterms[nonterm->id] = nonterm.get();
+    }
+    
+    const size_t limit = (size_t)INT64_MAX;
+    size_t count = 0;
+    size_t index = 0;
+    int64_t value = 0;
+    
+    /** The classes and nodes of the lexer. */
+    if (!read_count(in, end, &count)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!read_number(in, &value)) {
+            return false;
+        }
+        lexer->classes.push_back((int)value);
+    }
+    
+    if (!read_count(in, end, &count)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        lexer->nodes.push_back(std::make_unique<Node>());
+    }
+    for (auto& node : lexer->nodes) {
+        if (!read_number(in, &value) || value >= (int64_t)grammar.terms.size()) {
+            return false;
+        }
+        if (value >= 0) {
+            node->accept = grammar.terms[value].get();
+        }
+        
+        size_t nexts = 0;
+        if (!read_count(in, end, &nexts)) {
+            return false;
+        }
+        for (size_t i = 0; i < nexts; i++) {
+            int64_t first = 0;
+            int64_t last = 0;
+            if (!read_number(in, &first) || !read_number(in, &last) ||
+                !read_index(in, lexer->nodes.size(), &index)) {
+                return false;
+            }
+            Node::Range range((int)first, (int)last);
+            node->nexts[range] = lexer->nodes[index].get();
+        }
+    }
+    
+    /** The states are made first, since the actions refer to them. */
+    if (!read_count(in, end, &count)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        solver->states.push_back(std::make_unique<State>(i));
+    }
+    if (!read_count(in, end, &count)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        solver->actions.push_back(std::make_unique<State::Actions>());
+    }
+    
+    const std::vector<Symbol*>& terminals = grammar.terminals;
+    for (auto& acts : solver->actions) {
+        if (!read_index(in, limit, &acts->id)) {
+            return false;
+        }
+        
+        size_t sym = 0;
+        if (!read_count(in, end, &count)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (!read_index(in, terminals.size(), &sym) ||
+                !read_index(in, solver->states.size(), &index)) {
+                return false;
+            }
+            acts->shift[terminals[sym]] = solver->states[index].get();
+        }
+        
+        for (auto reduce : {&acts->accept, &acts->reduce}) {
+            if (!read_count(in, end, &count)) {
+                return false;
+            }
+            for (size_t i = 0; i < count; i++) {
+                if (!read_index(in, terminals.size(), &sym) ||
+                    !read_index(in, rules.size(), &index) || !rules[index]) {
+                    return false;
+                }
+                (*reduce)[terminals[sym]] = rules[index];
+            }
+        }
+        
+        if (!read_number(in, &value) || value >= (int64_t)rules.size()) {
+            return false;
+        }
+        if (value >= 0) {
+            acts->any = rules[value];
+        }
+    }
+    
+    for (auto& state : solver->states) {
+        if (!read_index(in, limit, &state->id) ||
+            !read_index(in, solver->actions.size(), &index)) {
+            return false;
+        }
+        state->actions = solver->actions[index].get();
+        
+        size_t sym = 0;
+        if (!read_count(in, end, &count)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (!read_index(in, nonterms.size(), &sym) ||
+                !read_index(in, solver->states.size(), &index)) {
+                return false;
+            }
+            state->gotos[nonterms[sym]] = solver->states[index].get();
+        }
+    }
+    
+    if (!in.read(&check[0], check.size()) || check != head.str()) {
+        return false;
+    }
+    return true;
+}
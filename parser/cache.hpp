@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Saves the solved lexer and parser states to a file, so that later runs on a
+ * grammar with the same terminals and rules can skip solving them.
+ */
+
+#ifndef cache_hpp
+#define cache_hpp
+
+#include "lexer.hpp"
+#include "solver.hpp"
+
+#include <string>
+
+/*******************************************************************************
+ * The cache file is named by a hash of the parts of the grammar that the
+ * states depend on: the patterns and ranks of the terminals, the symbols of
+ * each rule and the methods used to solve them.  Types, actions and includes
+ * are written from the grammar itself, so changing them still finds the saved
+ * states.  The file begins with the full description that was hashed, which
+ * is compared when loading to rule out a collision of the hashes.
+ */
+class Cache
+{
+public:
+    Cache(const std::string& directory,
+          const Grammar& grammar,
+          const Lexer& lexer,
+          const Solver& solver);
+    
+    /** Returns false if there is no saved file or if it is not valid. */
+    bool load(const Grammar& grammar, Lexer* lexer, Solver* solver) const;
+    
+    /** After solving, saves the states to the file. */
+    bool save(const Grammar& grammar,
+              const Lexer& lexer,
+              const Solver& solver) const;
+    
+    /** Version of the file format, changed if the layout ever changes. */
+    static const int version = 1;
+    
+    std::string path;
+    
+private:
+    std::string description;
+    
+    bool read(std::istream& in, const Grammar& grammar,
+              Lexer* lexer, Solver* solver) const;
+    
+    static void describe(const Grammar& grammar,
+                         const Lexer& lexer,
+                         const Solver& solver,
+                         std::ostream& out);
+};
+
+#endif
@@ -2,12 +2,15 @@
 
 #include <algorithm>
 #include <fstream>
+#include <set>
 
 /******************************************************************************/
 const char* header = R"""(
 
 struct Symbol {
     const char* name;
+    bool skip;
+    int id;
 };
 
 struct Node {
@@ -26,6 +29,7 @@ struct Rule {
     Symbol* nonterm;
     int length;
     Value* (*reduce)(Table*, Value**);
+    int value;
 };
 
 struct Reduce {
@@ -39,12 +43,6 @@ struct Go {
     State*  state;
 };
 
-struct State {
-    std::vector<Shift>*  shift;
-    std::vector<Reduce>* reduce;
-    std::vector<Go>*     go;
-};
-
 )""";
 
 /******************************************************************************/
@@ -52,11 +50,10 @@ const char* source = R"""(
 
 Node*
 node_next(Node* node, int c) {
-    Node* next = nullptr;
-    if (node->next && node->next(c)) {
-        next = node->next(c);
+    if (node->next) {
+        return node->next(c);
     }
-    return next;
+    return nullptr;
 }
 
 Symbol*
@@ -73,18 +70,6 @@ node_scan(Node* node, Table* table, const std::string& text) {
     return value;
 }
 
-Rule*
-find_reduce(State* state, Symbol* sym, bool* accept) {
-    for (auto& s : *state->reduce) {
-        if (s.symbol == nullptr || s.symbol == sym) {
-            *accept = s.accept;
-            return s.rule;
-        }
-    }
-    *accept = false;
-    return nullptr;
-}
-
 Symbol*
 rule_nonterm(Rule* rule, size_t* length) {
     *length = rule->length;
@@ -96,14 +81,43 @@ rule_reduce(Rule* rule, Table* table, Value** values) {
     if (rule->reduce) {
         return rule->reduce(table, values);
     } else {
-        if (rule->length == 1) {
-            return *(values - 1);
+        if (rule->value >= 0) {
+            return *(values - rule->length + rule->value);
         } else {
             return nullptr;
         }
     }
 }
 
+
+)""";
+
+/*******************************************************************************
+ * With the lists layout, each state points to vectors of its shifts, reduces
+ * and gotos, which are searched for the symbol.
+ */
+const char* lists_header = R"""(
+struct State {
+    std::vector<Shift>*  shift;
+    std::vector<Reduce>* reduce;
+    std::vector<Go>*     go;
+};
+
+)""";
+
+const char* lists_source = R"""(
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    for (auto& s : *state->reduce) {
+        if (s.symbol == nullptr || s.symbol == sym) {
+            *accept = s.accept;
+            return s.rule;
+        }
+    }
+    *accept = false;
+    return nullptr;
+}
+
 State*
 find_shift(State* state, Symbol* sym) {
     for (auto& s : *state->shift) {
@@ -125,6 +139,284 @@ find_goto(State* state, Symbol* sym) {
    return nullptr;
 };
 
+)""";
+
+/*******************************************************************************
+ * With the dense layout, states are numbered and index a row of the action
+ * and goto tables, where each column is the id of a terminal or nonterminal.
+ * An action is the kind in the low two bits, either an error, shift, reduce
+ * or accept, and the index of the next state or rule in the other bits.
+ */
+const char* dense_header = R"""(
+struct State {
+    int id;
+};
+
+)""";
+
+const char* dense_source = R"""(
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = parse_actions[state->id][sym->id];
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = parse_actions[state->id][sym->id];
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    return &parse_states[parse_gotos[state->id][sym->id]];
+}
+
+)""";
+
+/*******************************************************************************
+ * With the comb layout, the rows of the dense tables are packed into shared
+ * arrays by displacing each row by its base, where the check of an entry
+ * tells if it belongs to the row.  Entries not found in the row are the
+ * row's default.  The actions are packed by their unique rows, and the gotos
+ * are packed by the column of each nonterminal.
+ */
+const char* comb_header = R"""(
+struct State {
+    int id;
+    int row;
+};
+
+)""";
+
+const char* comb_source = R"""(
+static inline unsigned
+find_action(State* state, Symbol* sym) {
+    int index = action_base[state->row] + sym->id;
+    if (action_check[index] == state->row) {
+        return action_next[index];
+    }
+    return action_default[state->row];
+}
+
+Rule*
+find_reduce(State* state, Symbol* sym, bool* accept) {
+    unsigned action = find_action(state, sym);
+    *accept = (action & 3) == 3;
+    if ((action & 3) < 2) {
+        return nullptr;
+    }
+    return parse_rules[action >> 2];
+}
+
+State*
+find_shift(State* state, Symbol* sym) {
+    unsigned action = find_action(state, sym);
+    if ((action & 3) != 1) {
+        return nullptr;
+    }
+    return &parse_states[action >> 2];
+}
+
+State*
+find_goto(State* state, Symbol* sym) {
+    int index = goto_base[sym->id] + state->id;
+    if (goto_check[index] == sym->id) {
+        return &parse_states[goto_next[index]];
+    }
+    return &parse_states[goto_default[sym->id]];
+}
+
+)""";
+
+/*******************************************************************************
+ * Every lexer defines a match function, which finds the longest match from a
+ * position of the input, and returns its node and end.
+ */
+const char* match_source = R"""(
+/**
+ * Decodes the next character of the UTF-8 input, since the lexer matches
+ * unicode characters.  Bytes that are not valid UTF-8 are read as a single
+ * character.
+ */
+static inline int
+parse_char(const unsigned char* input, size_t length, size_t* pos) {
+    int c = input[(*pos)++];
+    if (c < 0x80) {
+        return c;
+    }
+    
+    int count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+    if (count == 0 || *pos + count > length) {
+        return c;
+    }
+    int result = c & (0x3f >> count);
+    for (int i = 0; i < count; i++) {
+        int next = input[*pos + i];
+        if ((next & 0xc0) != 0x80) {
+            return c;
+        }
+        result = (result << 6) | (next & 0x3f);
+    }
+    *pos += count;
+    return result;
+}
+
+)""";
+
+/** The functions lexer follows the next function of each node. */
+const char* functions_source = R"""(
+Node*
+lexer_match(const unsigned char* input, size_t length, size_t pos, size_t* end) {
+    Node* node = &node0;
+    Node* match = nullptr;
+    while (pos < length && node->next) {
+        node = node->next(parse_char(input, length, &pos));
+        if (!node) {
+            break;
+        }
+        if (node->accept) {
+            match = node;
+            *end = pos;
+        }
+    }
+    return match;
+}
+
+)""";
+
+/******************************************************************************/
+const char* parser_source = R"""(
+/**
+ * Stack of states and their values.  The stack starts in fixed arrays, and
+ * only moves to the heap, doubling in size, for deeply nested input.  Any
+ * values left on the stack after an error are deleted.
+ */
+struct ParseStack {
+    static const size_t fixed = 256;
+    State* fixed_states[fixed];
+    Value* fixed_values[fixed];
+    
+    State** states = fixed_states;
+    Value** values = fixed_values;
+    size_t size = 0;
+    size_t capacity = fixed;
+    
+    ParseStack() {}
+    ParseStack(const ParseStack&) = delete;
+    ParseStack& operator=(const ParseStack&) = delete;
+    
+    ~ParseStack() {
+        for (size_t i = 0; i < size; i++) {
+            delete values[i];
+        }
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+    }
+    
+    void push(State* state, Value* value) {
+        if (size == capacity) {
+            grow();
+        }
+        states[size] = state;
+        values[size] = value;
+        size++;
+    }
+    
+    void grow() {
+        State** more_states = new State*[capacity * 2];
+        Value** more_values = new Value*[capacity * 2];
+        std::memcpy(more_states, states, size * sizeof(State*));
+        std::memcpy(more_values, values, size * sizeof(Value*));
+        if (states != fixed_states) {
+            delete[] states;
+            delete[] values;
+        }
+        states = more_states;
+        values = more_values;
+        capacity *= 2;
+    }
+};
+
+/**
+ * Parses the input with the tables, returning the value of the accepted rule,
+ * or null if the input does not match the grammar.  Each token is the longest
+ * match of the lexer, and terminals not used by any rule, such as spaces, are
+ * skipped.  The text of a token is only copied for a terminal with a scan
+ * action, into a string that is reused for every token.
+ */
+Value*
+parse(const char* input, size_t length, Table* table) {
+    const unsigned char* bytes = (const unsigned char*)input;
+    
+    ParseStack stack;
+    stack.push(parser_start, nullptr);
+    
+    std::string text;
+    size_t pos = 0;
+    Symbol* sym = nullptr;
+    Value* value = nullptr;
+    
+    while (true) {
+        while (!sym) {
+            if (pos >= length) {
+                sym = &endmark;
+                break;
+            }
+            
+            size_t end = pos;
+            Node* match = lexer_match(bytes, length, pos, &end);
+            if (!match) {
+                return nullptr;
+            }
+            
+            if (match->scan) {
+                text.assign(input + pos, end - pos);
+                value = match->scan(table, text);
+            }
+            pos = end;
+            
+            if (match->accept->skip) {
+                delete value;
+                value = nullptr;
+            } else {
+                sym = match->accept;
+            }
+        }
+        
+        State* state = stack.states[stack.size - 1];
+        State* next = find_shift(state, sym);
+        if (next) {
+            stack.push(next, value);
+            sym = nullptr;
+            value = nullptr;
+            continue;
+        }
+        
+        bool accept = false;
+        Rule* rule = find_reduce(state, sym, &accept);
+        if (!rule) {
+            delete value;
+            return nullptr;
+        }
+        
+        Value* result = rule_reduce(rule, table, stack.values + stack.size);
+        stack.size -= rule->length;
+        if (accept) {
+            return result;
+        }
+        stack.push(find_goto(stack.states[stack.size - 1], rule->nonterm), result);
+    }
+}
 
 )""";
 
@@ -136,7 +428,8 @@ find_goto(State* state, Symbol* sym) {
  * any, for the current state is the type of token identified.
  */
 void
-Code::write(const Grammar& grammar, const Lexer& lexer, std::ostream& out)
+Code::write(const Grammar& grammar, const Lexer& lexer, Scanner scanner,
+            std::ostream& out)
 {
     int id = 0;
     std::map<Node*, int> ids;
@@ -147,6 +440,7 @@ Code::write(const Grammar& grammar, const Lexer& lexer, std::ostream& out)
     for (auto include : grammar.includes) {
         out << include << std::endl;
     }
+    out << "#include <cstring>\n";
     out << "#include <memory>\n";
     out << "using std::unique_ptr;\n";
     out << "using std::vector;\n\n";
@@ -166,8 +460,16 @@ Code::write(const Grammar& grammar, const Lexer& lexer, std::ostream& out)
         }
     }
     
+    /** Terminals that are not in any rule are skipped by the parser. */
+    std::set<const Symbol*> used;
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            used.insert(rule->product.begin(), rule->product.end());
+        }
+    }
+    
     for (auto& term : grammar.terms) {
-        write_terms(term.get(), out);
+        write_terms(term.get(), used.count(term.get()) == 0, out);
     }
     out << "\n";
     
@@ -185,8 +487,10 @@ Code::write(const Grammar& grammar, const Lexer& lexer, std::ostream& out)
     }
     out << "\n";
     
+    write_classes(lexer, out);
+    
     for (auto& node : lexer.nodes) {
-        write_scan(node.get(), ids, out);
+        write_scan(node.get(), ids, lexer, out);
     }
     
     for (auto& node : lexer.nodes) {
@@ -196,15 +500,30 @@ Code::write(const Grammar& grammar, const Lexer& lexer, std::ostream& out)
     out << "\n";
     
     out << source;
+    out << match_source;
+    if (scanner == direct) {
+        write_direct(lexer, ids, out);
+    } else if (scanner == table) {
+        write_table(lexer, ids, out);
+    } else {
+        out << functions_source;
+    }
 }
 
 /******************************************************************************/
 bool
-Code::write(const Grammar& grammar, const Solver& solver, std::ostream& out)
+Code::write(const Grammar& grammar, const Solver& solver, Layout layout,
+            std::ostream& out)
 {
-    std::vector<State*> states_sorted;
+    if (layout == lists) {
+        out << lists_header;
+    } else if (layout == dense) {
+        out << dense_header;
+    } else {
+        out << comb_header;
+    }
     
-    out << "Symbol endmark;\n";
+    out << "Symbol endmark = {\"$\", false, " << grammar.endmark.id << "};\n";
     
     for (auto& nonterm : grammar.nonterms) {
         write_nonterm(nonterm.get(), out);
@@ -217,6 +536,20 @@ Code::write(const Grammar& grammar, const Solver& solver, std::ostream& out)
     }
     write_rules(grammar, out);
     
+    if (layout != lists) {
+        if (layout == dense) {
+            write_dense(grammar, solver, out);
+        } else {
+            write_comb(grammar, solver, out);
+        }
+        out << "Node* lexer_start = &node0;\n\n";
+        out << "State* parser_start = &parse_states[0];\n\n";
+        out << "Symbol* symbol_endmark = &endmark;\n\n";
+        out << (layout == dense ? dense_source : comb_source);
+        out << parser_source;
+        return true;
+    }
+    
     for (auto& s : solver.states) {
         out << "extern State state" << s->id << ";\n";
     }
@@ -234,17 +567,19 @@ Code::write(const Grammar& grammar, const Solver& solver, std::ostream& out)
     out << "State* parser_start = &state0;\n\n";
     out << "Symbol* symbol_endmark = &endmark;\n\n";
     
-    //out << parser_source;
+    out << lists_source;
+    out << parser_source;
     
     return true;
 }
 
 /******************************************************************************/
 void
-Code::write_terms(Term* term, std::ostream& out)
+Code::write_terms(Term* term, bool skip, std::ostream& out)
 {
     out << "Symbol term" << term->rank;
-    out << " = {\"" << term->name << "\"};\n";
+    out << " = {\"" << term->name << "\", ";
+    out << (skip ? "true" : "false") << ", " << term->id << "};\n";
 }
 
 void
@@ -269,7 +604,8 @@ Code::write_eval(Term* term, std::ostream& out)
  * input character and returns the next node in the DFA or a null pointer.
  */
 void
-Code::write_scan(Node* node, std::map<Node*, int>& ids, std::ostream& out)
+Code::write_scan(Node* node, std::map<Node*, int>& ids, const Lexer& lexer,
+                 std::ostream& out)
 {
     if (node->nexts.size() == 0) {
         return;
@@ -277,9 +613,10 @@ Code::write_scan(Node* node, std::map<Node*, int>& ids, std::ostream& out)
     
     out << "Node*\n";
     out << "next" << ids[node] << "(int c) {\n";
+    out << "    int k = lexer_class(c);\n";
     for (auto next : node->nexts) {
         out << "    if (";
-        write_range(&next.first, out);
+        write_range(&next.first, lexer, out);
         out << ") { return &node" << ids[next.second] << "; }\n";
     }
     out << "    return nullptr;\n";
@@ -309,32 +646,180 @@ Code::write_node(Node* node, std::map<Node*, int>& ids, std::ostream& out)
     out << "};\n";
 }
 
+/** Since the ranges start and end with whole classes, test the classes. */
 void
-Code::write_range(const Node::Range* range, std::ostream& out)
+Code::write_range(const Node::Range* range, const Lexer& lexer,
+                  std::ostream& out)
 {
-    int first = range->first;
-    int last  = range->last;
+    int first = lexer.find_class(range->first);
+    int last  = lexer.find_class(range->last);
     
     if (first == last) {
-        if ((first <= 127) && isprint(first) && first != '\'' && first != '\\') {
-            out << "c == '" << (char)first << "'";
-        } else {
-            out << "c == " << first << "";
-        }
+        out << "k == " << first;
     } else {
-        if ((first <= 127) && (last <= 127)
-            && isprint(first) && isprint(last)
-            && first != '\'' && last != '\''
-            && first != '\\' && last != '\\') {
-            out << "(c >= '" << (char)first << "')";
-            out << " && ";
-            out << "(c <= '" << (char)last << "')";
-        } else {
-            out << "(c >= " << first << ")";
-            out << " && ";
-            out << "(c <= " << last << ")";
+        out << "(k >= " << first << ")";
+        out << " && ";
+        out << "(k <= " << last << ")";
+    }
+}
+
+/**
+ * Bytes find their class in the table, while larger characters search the
+ * first characters of the classes after the table.
+ */
+void
+Code::write_classes(const Lexer& lexer, std::ostream& out)
+{
+    const std::vector<int>& classes = lexer.classes;
+    
+    std::string type = "unsigned char";
+    if (classes.size() > 0x10000) {
+        type = "int";
+    } else if (classes.size() > 0x100) {
+        type = "unsigned short";
+    }
+    
+    out << type << " lexer_classes[256] = {";
+    for (int c = 0; c < 256; c++) {
+        out << (c % 16 == 0 ? "\n    " : " ") << lexer.find_class(c);
+        if (c < 255) {
+            out << ",";
+        }
+    }
+    out << "\n};\n\n";
+    
+    size_t wide = lexer.find_class(255) + 1;
+    out << "int lexer_starts[] = {";
+    for (size_t i = wide; i < classes.size(); i++) {
+        out << ((i - wide) % 8 == 0 ? "\n    " : " ") << classes[i];
+        if (i + 1 < classes.size()) {
+            out << ",";
         }
     }
+    if (wide == classes.size()) {
+        out << "\n    0";
+    }
+    out << "\n};\n\n";
+    
+    out << "int\n";
+    out << "lexer_class(int c) {\n";
+    out << "    if (c < 0) {\n";
+    out << "        return -1;\n";
+    out << "    } else if (c < 256) {\n";
+    out << "        return lexer_classes[c];\n";
+    out << "    }\n";
+    out << "    int low = 0;\n";
+    out << "    int high = " << classes.size() - wide << ";\n";
+    out << "    while (low < high) {\n";
+    out << "        int mid = (low + high) / 2;\n";
+    out << "        if (lexer_starts[mid] <= c) {\n";
+    out << "            low = mid + 1;\n";
+    out << "        } else {\n";
+    out << "            high = mid;\n";
+    out << "        }\n";
+    out << "    }\n";
+    out << "    return " << wide << " + low - 1;\n";
+    out << "}\n\n";
+}
+
+/******************************************************************************/
+/**
+ * Writes the match function of the direct lexer, where each node is a label
+ * followed by a switch on the class of the next character, which jumps to
+ * the label of the next node.  A node that accepts records the match before
+ * reading on.  ASCII bytes are looked up in the class table directly, as in
+ * the table lexer.  Ranges of eight or more classes are tested before the
+ * switch, those with the most ASCII characters first, since the input is
+ * mostly ASCII.
+ */
+void
+Code::write_direct(const Lexer& lexer, std::map<Node*, int>& ids,
+                   std::ostream& out)
+{
+    const int cases = 8;
+    
+    out << "Node*\n";
+    out << "lexer_match(const unsigned char* input, size_t length, size_t pos, ";
+    out << "size_t* end) {\n";
+    out << "    Node* match = nullptr;\n";
+    out << "    int k = 0;\n";
+    
+    /** Only the nodes that are jumped to have labels, which must be used. */
+    std::set<Node*> targets;
+    for (auto& node : lexer.nodes) {
+        for (auto& next : node->nexts) {
+            targets.insert(next.second);
+        }
+    }
+    
+    for (auto& node : lexer.nodes) {
+        int id = ids[node.get()];
+        if (targets.count(node.get())) {
+            out << "node" << id << ":\n";
+        }
+        if (node->accept && node.get() != lexer.nodes.front().get()) {
+            out << "    match = &node" << id << ";\n";
+            out << "    *end = pos;\n";
+        }
+        if (node->nexts.size() == 0) {
+            out << "    return match;\n";
+            continue;
+        }
+        out << "    if (pos >= length) {\n";
+        out << "        return match;\n";
+        out << "    }\n";
+        out << "    if (input[pos] < 0x80) {\n";
+        out << "        k = lexer_classes[input[pos++]];\n";
+        out << "    } else {\n";
+        out << "        k = lexer_class(parse_char(input, length, &pos));\n";
+        out << "    }\n";
+        
+        /** The ranges with the most ASCII characters are tested first. */
+        std::vector<std::pair<Node::Range, Node*>> ranges;
+        bool cased = false;
+        for (auto& next : node->nexts) {
+            int first = lexer.find_class(next.first.first);
+            int last = lexer.find_class(next.first.last);
+            if (last - first + 1 >= cases) {
+                ranges.emplace_back(next.first, next.second);
+            } else {
+                cased = true;
+            }
+        }
+        auto ascii = [](const Node::Range& range) {
+            return std::max(0, std::min(range.last, 0x7f) - range.first + 1);
+        };
+        std::stable_sort(ranges.begin(), ranges.end(),
+                         [&ascii](const auto& left, const auto& right) {
+            return ascii(left.first) > ascii(right.first);
+        });
+        for (auto& range : ranges) {
+            int first = lexer.find_class(range.first.first);
+            int last = lexer.find_class(range.first.last);
+            out << "    if (k >= " << first << " && k <= " << last << ") {\n";
+            out << "        goto node" << ids[range.second] << ";\n";
+            out << "    }\n";
+        }
+        if (cased) {
+            out << "    switch (k) {\n";
+            for (auto& next : node->nexts) {
+                int first = lexer.find_class(next.first.first);
+                int last = lexer.find_class(next.first.last);
+                if (last - first + 1 >= cases) {
+                    continue;
+                }
+                out << "   ";
+                for (int k = first; k <= last; k++) {
+                    out << " case " << k << ":";
+                }
+                out << " goto node" << ids[next.second] << ";\n";
+            }
+            out << "    default: break;\n";
+            out << "    }\n";
+        }
+        out << "    return match;\n";
+    }
+    out << "}\n\n";
 }
 
 /******************************************************************************/
@@ -444,7 +929,7 @@ void
 Code::write_nonterm(Nonterm* nonterm, std::ostream& out)
 {
     out << "Symbol nonterm" << nonterm->id;
-    out << " = {\"" << nonterm->name << "\"};\n";
+    out << " = {\"" << nonterm->name << "\", false, " << nonterm->id << "};\n";
 }
 
 void
@@ -460,7 +945,13 @@ Code::write_rules(const Grammar& grammar, std::ostream& out)
             } else {
                 out << "nullptr";
             }
-            out << "};\n";
+            int value = -1;
+            for (size_t i = 0; i < rule->product.size(); i++) {
+                if (rule->action.empty() && !rule->product[i]->type.empty()) {
+                    value = (int)i;
+                }
+            }
+            out << ", " << value << "};\n";
         }
     }
     out << "\n";
@@ -535,3 +1026,419 @@ Code::write_states(const std::vector<std::unique_ptr<State>>& states, std::ostre
     }
     out << "\n";
 }
+
+/******************************************************************************/
+/** Sizes of the tables written by the last dense or comb layout. */
+size_t Code::table_bytes = 0;
+size_t Code::dense_bytes = 0;
+
+/** Returns the smallest unsigned type that holds values up to the maximum. */
+static const char*
+table_type(size_t maximum)
+{
+    if (maximum <= 0xff) {
+        return "unsigned char";
+    } else if (maximum <= 0xffff) {
+        return "unsigned short";
+    } else {
+        return "unsigned int";
+    }
+}
+
+static size_t
+table_size(size_t maximum)
+{
+    if (maximum <= 0xff) {
+        return 1;
+    } else if (maximum <= 0xffff) {
+        return 2;
+    } else {
+        return 4;
+    }
+}
+
+/** Writes an array of numbers, using the smallest type that holds them. */
+static void
+write_array(const std::string& name, const std::vector<size_t>& values,
+            size_t maximum, ostream& out)
+{
+    out << table_type(maximum) << " " << name << "[] = {";
+    for (size_t i = 0; i < values.size(); i++) {
+        out << (i % 16 == 0 ? "\n    " : " ") << values[i];
+        out << (i + 1 < values.size() ? "," : "");
+    }
+    if (values.empty()) {
+        out << "\n    0";
+    }
+    out << "\n};\n\n";
+}
+
+/**
+ * Writes the rules by id, so the tables can refer to a rule by its index, and
+ * returns the number of rules.
+ */
+static size_t
+write_rule_list(const Grammar& grammar, ostream& out)
+{
+    std::vector<const Nonterm::Rule*> sorted;
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            if (rule->id >= sorted.size()) {
+                sorted.resize(rule->id + 1, nullptr);
+            }
+            sorted[rule->id] = rule.get();
+        }
+    }
+    
+    out << "Rule* parse_rules[] = {";
+    for (size_t i = 0; i < sorted.size(); i++) {
+        out << (i % 8 == 0 ? "\n    " : " ") << "&rule" << sorted[i]->id;
+        out << (i + 1 < sorted.size() ? "," : "");
+    }
+    out << "\n};\n\n";
+    return sorted.size();
+}
+
+/**
+ * Bytes of the dense tables, where each state is written as its id, so the
+ * state array counts the same as in the comb layout, where it also has the
+ * row of its actions.
+ */
+static size_t
+dense_size(size_t states, size_t terms, size_t nonterms, size_t largest)
+{
+    return states * (sizeof(int) + terms * table_size(largest) +
+                     nonterms * table_size(states));
+}
+
+/**
+ * Returns the action on each terminal as its kind in the low two bits and
+ * the index of the next state or rule above them.  The reduce of any
+ * terminal fills the row first, and the actions on each terminal then take
+ * its place in the order the lists are searched: a shift over a reduce, and
+ * a reduce over an accept.
+ */
+static std::vector<size_t>
+action_row(const State::Actions* actions, size_t terms)
+{
+    std::vector<size_t> row(terms, 0);
+    if (actions->any) {
+        std::fill(row.begin(), row.end(), actions->any->id * 4 + 2);
+    }
+    for (auto& accept : actions->accept) {
+        row[accept.first->id] = accept.second->id * 4 + 3;
+    }
+    for (auto& reduce : actions->reduce) {
+        row[reduce.first->id] = reduce.second->id * 4 + 2;
+    }
+    for (auto& shift : actions->shift) {
+        row[shift.first->id] = shift.second->id * 4 + 1;
+    }
+    return row;
+}
+
+/******************************************************************************/
+void
+Code::write_dense(const Grammar& grammar, const Solver& solver, ostream& out)
+{
+    size_t terms = grammar.terminals.size();
+    size_t nonterms = std::max(grammar.nonterms.size(), (size_t)1);
+    size_t rules = write_rule_list(grammar, out);
+    
+    out << "State parse_states[" << solver.states.size() << "] = {";
+    for (size_t i = 0; i < solver.states.size(); i++) {
+        out << (i % 8 == 0 ? "\n    " : " ") << "{" << i << "}";
+        out << (i + 1 < solver.states.size() ? "," : "");
+    }
+    out << "\n};\n\n";
+    
+    size_t largest = std::max(solver.states.size(), rules) * 4 + 3;
+    out << table_type(largest) << " parse_actions[";
+    out << solver.states.size() << "][" << terms << "] = {\n";
+    for (auto& state : solver.states) {
+        std::vector<size_t> row = action_row(state->actions, terms);
+        out << "    {";
+        for (size_t i = 0; i < row.size(); i++) {
+            out << (i > 0 ? ", " : "") << row[i];
+        }
+        out << "},\n";
+    }
+    out << "};\n\n";
+    
+    out << table_type(solver.states.size()) << " parse_gotos[";
+    out << solver.states.size() << "][" << nonterms << "] = {\n";
+    for (auto& state : solver.states) {
+        std::vector<size_t> row(nonterms, 0);
+        for (auto& go : state->gotos) {
+            row[go.first->id] = go.second->id;
+        }
+        
+        out << "    {";
+        for (size_t i = 0; i < row.size(); i++) {
+            out << (i > 0 ? ", " : "") << row[i];
+        }
+        out << "},\n";
+    }
+    out << "};\n\n";
+    
+    dense_bytes = dense_size(solver.states.size(), terms, nonterms, largest);
+    table_bytes = dense_bytes;
+}
+
+/******************************************************************************/
+/**
+ * Places the entries of each row in one shared table, at the lowest offset
+ * where none of them land on an entry of a row placed before.  The rows with
+ * the most entries are placed first, when the table is still empty.  The
+ * check of each entry is its row, and the empty entries are checked against
+ * a row that does not exist, so the tables are sized for every column of
+ * every row to be looked up.
+ */
+static std::vector<size_t>
+pack_rows(const std::vector<std::vector<std::pair<size_t, size_t>>>& rows,
+          size_t width,
+          std::vector<size_t>* next,
+          std::vector<size_t>* check)
+{
+    const size_t empty = rows.size();
+    std::vector<size_t> order(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&rows](size_t left, size_t right) {
+        return rows[left].size() > rows[right].size();
+    });
+    
+    std::vector<size_t> base(rows.size(), 0);
+    size_t last = 0;
+    size_t first_free = 0;
+    
+    for (size_t index : order) {
+        const auto& row = rows[index];
+        if (row.empty()) {
+            continue;
+        }
+        
+        size_t offset = first_free > row[0].first ? first_free - row[0].first : 0;
+        while (true) {
+            bool fits = true;
+            for (auto& entry : row) {
+                size_t i = offset + entry.first;
+                if (i < check->size() && (*check)[i] != empty) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits) {
+                break;
+            }
+            offset++;
+        }
+        
+        base[index] = offset;
+        last = std::max(last, offset);
+        for (auto& entry : row) {
+            size_t i = offset + entry.first;
+            if (i >= check->size()) {
+                check->resize(i + 1, empty);
+                next->resize(i + 1, 0);
+            }
+            (*check)[i] = index;
+            (*next)[i] = entry.second;
+        }
+        while (first_free < check->size() && (*check)[first_free] != empty) {
+            first_free++;
+        }
+    }
+    
+    check->resize(last + width, empty);
+    next->resize(last + width, 0);
+    return base;
+}
+
+/** Returns the value found most often, preferring the lowest. */
+static size_t
+most_common(const std::vector<size_t>& values)
+{
+    std::map<size_t, size_t> counts;
+    for (size_t value : values) {
+        counts[value]++;
+    }
+    size_t result = 0;
+    size_t most = 0;
+    for (auto& count : counts) {
+        if (count.second > most) {
+            result = count.first;
+            most = count.second;
+        }
+    }
+    return result;
+}
+
+/**
+ * The actions are packed by the unique action rows, whose default is the
+ * action found most often in the row, and the gotos are packed by the
+ * columns of each nonterminal, whose default is the state found most often.
+ * Only the entries that differ from the default are stored, so a lookup
+ * finds exactly the same action as in the dense table.
+ */
+void
+Code::write_comb(const Grammar& grammar, const Solver& solver, ostream& out)
+{
+    size_t terms = grammar.terminals.size();
+    size_t nonterms = std::max(grammar.nonterms.size(), (size_t)1);
+    size_t states = solver.states.size();
+    size_t rules = write_rule_list(grammar, out);
+    
+    std::map<const State::Actions*, size_t> ids;
+    for (size_t i = 0; i < solver.actions.size(); i++) {
+        ids[solver.actions[i].get()] = i;
+    }
+    
+    out << "State parse_states[" << states << "] = {";
+    for (size_t i = 0; i < states; i++) {
+        out << (i % 8 == 0 ? "\n    " : " ");
+        out << "{" << i << ", " << ids[solver.states[i]->actions] << "}";
+        out << (i + 1 < states ? "," : "");
+    }
+    out << "\n};\n\n";
+    
+    /** Rows of the actions. */
+    size_t count = solver.actions.size();
+    std::vector<std::vector<std::pair<size_t, size_t>>> rows(count);
+    std::vector<size_t> defaults(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        std::vector<size_t> row = action_row(solver.actions[i].get(), terms);
+        defaults[i] = most_common(row);
+        for (size_t j = 0; j < terms; j++) {
+            if (row[j] != defaults[i]) {
+                rows[i].emplace_back(j, row[j]);
+            }
+        }
+    }
+    std::vector<size_t> next;
+    std::vector<size_t> check;
+    std::vector<size_t> base = pack_rows(rows, terms, &next, &check);
+    
+    size_t largest = std::max(states, rules) * 4 + 3;
+    size_t offsets = check.size();
+    write_array("action_base", base, offsets, out);
+    write_array("action_default", defaults, largest, out);
+    write_array("action_check", check, count, out);
+    write_array("action_next", next, largest, out);
+    
+    table_bytes = states * 2 * sizeof(int) +
+                  count * (table_size(offsets) + table_size(largest)) +
+                  check.size() * (table_size(count) + table_size(largest));
+    
+    /** Columns of the gotos. */
+    std::vector<std::vector<size_t>> columns(nonterms);
+    for (auto& state : solver.states) {
+        for (auto& go : state->gotos) {
+            columns[go.first->id].push_back(go.second->id);
+        }
+    }
+    std::vector<std::vector<std::pair<size_t, size_t>>> gotos(nonterms);
+    std::vector<size_t> goto_defaults(nonterms, 0);
+    for (size_t i = 0; i < nonterms; i++) {
+        goto_defaults[i] = most_common(columns[i]);
+    }
+    for (auto& state : solver.states) {
+        for (auto& go : state->gotos) {
+            if (go.second->id != goto_defaults[go.first->id]) {
+                gotos[go.first->id].emplace_back(state->id, go.second->id);
+            }
+        }
+    }
+    std::vector<size_t> goto_next;
+    std::vector<size_t> goto_check;
+    std::vector<size_t> goto_base = pack_rows(gotos, states, &goto_next, &goto_check);
+    
+    offsets = goto_check.size();
+    write_array("goto_base", goto_base, offsets, out);
+    write_array("goto_default", goto_defaults, states, out);
+    write_array("goto_check", goto_check, nonterms, out);
+    write_array("goto_next", goto_next, states, out);
+    
+    table_bytes += nonterms * (table_size(offsets) + table_size(states)) +
+                   goto_check.size() * (table_size(nonterms) + table_size(states));
+    dense_bytes = dense_size(states, terms, nonterms, largest);
+    
+    out << "/* Comb tables of " << table_bytes << " bytes, ";
+    out << (table_bytes * 100.0 / std::max(dense_bytes, (size_t)1));
+    out << "% of the " << dense_bytes << " bytes of dense tables. */\n\n";
+}
+
+/******************************************************************************/
+/**
+ * Writes the lexer as a flat array of the next node by node and class, where
+ * each node has a row of the next node for every class.  Nodes are numbered
+ * from one, leaving zero for no next node, and row zero is never read.  The
+ * numbers use the smallest type that holds them, so the rows of the nodes
+ * that are visited together share cache lines.  An ASCII byte finds its
+ * class in the byte table directly, so each byte of such input takes two
+ * dependent loads, the class and then the next node.
+ */
+void
+Code::write_table(const Lexer& lexer, std::map<Node*, int>& ids,
+                  std::ostream& out)
+{
+    size_t classes = std::max(lexer.classes.size(), (size_t)1);
+    size_t nodes = lexer.nodes.size() + 1;
+    
+    out << table_type(nodes) << " lexer_next[" << nodes << " * ";
+    out << classes << "] = {\n";
+    for (size_t i = 0; i < nodes; i++) {
+        std::vector<size_t> row(classes, 0);
+        if (i > 0) {
+            for (auto& next : lexer.nodes[i - 1]->nexts) {
+                int first = lexer.find_class(next.first.first);
+                int last = lexer.find_class(next.first.last);
+                for (int k = first; k <= last; k++) {
+                    row[k] = ids[next.second] + 1;
+                }
+            }
+        }
+        out << "   ";
+        for (size_t k = 0; k < classes; k++) {
+            out << " " << row[k] << ",";
+        }
+        out << "\n";
+    }
+    out << "};\n\n";
+    
+    out << "Node* lexer_accepts[" << nodes << "] = {\n";
+    out << "    nullptr,\n";
+    for (auto& node : lexer.nodes) {
+        if (node->accept) {
+            out << "    &node" << ids[node.get()] << ",\n";
+        } else {
+            out << "    nullptr,\n";
+        }
+    }
+    out << "};\n\n";
+    
+    out << "Node*\n";
+    out << "lexer_match(const unsigned char* input, size_t length, size_t pos, ";
+    out << "size_t* end) {\n";
+    out << "    Node* match = nullptr;\n";
+    out << "    size_t node = 1;\n";
+    out << "    while (pos < length) {\n";
+    out << "        int k = 0;\n";
+    out << "        if (input[pos] < 0x80) {\n";
+    out << "            k = lexer_classes[input[pos++]];\n";
+    out << "        } else {\n";
+    out << "            k = lexer_class(parse_char(input, length, &pos));\n";
+    out << "        }\n";
+    out << "        node = lexer_next[node * " << classes << " + k];\n";
+    out << "        if (node == 0) {\n";
+    out << "            break;\n";
+    out << "        }\n";
+    out << "        if (lexer_accepts[node]) {\n";
+    out << "            match = lexer_accepts[node];\n";
+    out << "            *end = pos;\n";
+    out << "        }\n";
+    out << "    }\n";
+    out << "    return match;\n";
+    out << "}\n\n";
+}
@@ -18,14 +18,39 @@ class Code
 {
 public:
     
+    /**
+     * The lists layout writes vectors of the shifts, reduces and gotos of each
+     * state, which are searched for the next symbol.  The dense layout writes
+     * the actions and gotos as tables of integers indexed by the state and
+     * the id of the symbol, so each lookup is a single read.  The comb layout
+     * packs the rows of the dense tables into shared arrays, where a lookup
+     * reads the base of the row, the check of the entry and then the entry
+     * or the default of the row.
+     */
+    enum Layout { lists, dense, comb };
+    
+    /**
+     * The functions scanner writes a next function for each node of the
+     * lexer, which the match function calls for each character.  The direct
+     * scanner writes the whole match as one function, with a label and a
+     * switch for each node, so there are no indirect calls.  The table
+     * scanner looks up the next node in an array by node and class.
+     */
+    enum Scanner { functions, direct, table };
+    
     /** After solving, write the source code for the scanner. */
     static void write(const Grammar& grammar,
                       const Lexer& lexer,
+                      Scanner scanner,
                       ostream& out);
     
-    /** After solving, write the source code for the parse table. */
+    /**
+     * After solving, write the source code for the parse table, followed by a
+     * parse function that reads the input with the lexer and the table.
+     */
     static bool write(const Grammar& grammar,
                       const Solver& solver,
+                      Layout layout,
                       ostream& out);
     
     /**
@@ -34,11 +59,28 @@ public:
      * an input character.  When there is no next node for a given input
      * character, check for a matching terminal at the current node.
      */
-    static void write_terms(Term* term, ostream& out);
+    static void write_terms(Term* term, bool skip, ostream& out);
     static void write_eval( Term* term, ostream& out);
-    static void write_scan( Node* node, std::map<Node*, int>& ids, ostream& out);
+    static void write_scan( Node* node, std::map<Node*, int>& ids,
+                            const Lexer& lexer, ostream& out);
     static void write_node( Node* node, std::map<Node*, int>& ids, ostream& out);
-    static void write_range(const Node::Range* range, ostream& out);
+    static void write_range(const Node::Range* range, const Lexer& lexer,
+                            ostream& out);
+    
+    /**
+     * Writes the class of each byte as a table, and a function that finds the
+     * class of any character.  The nodes test the class of the character
+     * instead of the character itself.
+     */
+    static void write_classes(const Lexer& lexer, ostream& out);
+    
+    /** Writes the match function of the direct scanner. */
+    static void write_direct(const Lexer& lexer, std::map<Node*, int>& ids,
+                             ostream& out);
+    
+    /** Writes the transitions, accepts and match function of the table scanner. */
+    static void write_table(const Lexer& lexer, std::map<Node*, int>& ids,
+                            ostream& out);
     
     /**
      * Writes the functions that calls the user defined action for a given rule.
@@ -68,6 +110,23 @@ public:
     static void write_actions(State::Actions* actions, ostream& out);
     static void write_gotos(const std::vector<std::unique_ptr<State>>& states, ostream& out);
     static void write_states(const std::vector<std::unique_ptr<State>>& states, ostream& out);
+    
+    /** Writes the rules, states, actions and gotos of the dense layout. */
+    static void write_dense(const Grammar& grammar,
+                            const Solver& solver,
+                            ostream& out);
+    
+    /** Writes the same tables packed as rows of the comb layout. */
+    static void write_comb(const Grammar& grammar,
+                           const Solver& solver,
+                           ostream& out);
+    
+    /**
+     * Bytes of the tables written by the dense or comb layout, and of the
+     * dense tables for the same grammar, for reporting the compression.
+     */
+    static size_t table_bytes;
+    static size_t dense_bytes;
 };
 
 #endif
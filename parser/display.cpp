@@ -2,6 +2,7 @@
 
 #include <iomanip>
 #include <climits>
+#include <algorithm>
 
 /******************************************************************************/
 void
@@ -234,12 +235,13 @@ Display::print_states(const Grammar& grammar,
                       std::ostream& out) 
 {
     for (auto& state : solver.states) {
-        print_state(*state, out);
+        print_state(*state, grammar, out);
     }
 }
 
 void 
-Display::print_state(const State& state, std::ostream& out)
+Display::print_state(const State& state, const Grammar& grammar,
+                     std::ostream& out)
 {
     out << "State\n";
     for (auto& item : state.items) {
@@ -252,9 +254,45 @@ Display::print_state(const State& state, std::ostream& out)
             out << " ";
             i++;
         }
-        out << " :  ";
-        item.ahead->print(out);
+        out << " : ";
+        for (size_t i = item.ahead.next(0); i != Bitset::npos;
+             i = item.ahead.next(i + 1)) {
+            out << " ";
+            grammar.terminals[i]->print(out);
+        }
         out << "\n";
     }
     out << "\n";
 }
+
+/******************************************************************************/
+void
+Display::print_report(const Solver& solver, std::ostream& out)
+{
+    out << "States:  " << solver.states.size();
+    if (solver.method != Solver::canonical) {
+        out << " merged from " << solver.canonical_states << " canonical";
+    }
+    out << "\n";
+    out << "Actions: " << solver.actions.size() << "\n";
+    out << "Lookups: " << solver.lookup_hits << " hits, ";
+    out << solver.lookup_misses << " misses\n";
+    if (solver.method != Solver::canonical) {
+        out << "Merges:  " << solver.merges << " kernels with new lookaheads\n";
+    }
+    if (solver.method == Solver::pager) {
+        out << "Removed: " << solver.unreachable << " unreachable states\n";
+    }
+    if (solver.previous) {
+        out << "Reused:  " << solver.reused << " states, ";
+        out << solver.kept << " kept their ids\n";
+    }
+}
+
+void
+Display::print_tables(size_t bytes, size_t dense, std::ostream& out)
+{
+    out << "Tables:  " << bytes << " bytes, ";
+    out << (bytes * 100.0 / std::max(dense, (size_t)1));
+    out << "% of the " << dense << " bytes of dense tables\n";
+}
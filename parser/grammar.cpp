@@ -58,7 +58,19 @@ Grammar::read_grammar(std::istream& in)
         }
     }
     
+    /** Number the terminals, then the endmark, and separately the nonterms. */
     size_t id = 0;
+    for (auto& term : terms) {
+        term->id = id++;
+    }
+    endmark.id = id;
+    
+    for (auto& term : terms) {
+        terminals.push_back(term.get());
+    }
+    terminals.push_back(&endmark);
+    
+    id = 0;
     size_t rule_id = 0;
     for (auto& nonterm : nonterms) {
         nonterm->id = id++;
@@ -84,14 +96,14 @@ Grammar::print(std::ostream& out) const
     
     out << "Firsts:\n";
     for (auto& nonterm : nonterms) {
-        nonterm->print_firsts(out);
+        nonterm->print_firsts(out, terminals);
         out << std::endl;
     }
     out << std::endl;
     
     out << "Follows:\n";
     for (auto& nonterm : nonterms) {
-        nonterm->print_follows(out);
+        nonterm->print_follows(out, terminals);
         out << std::endl;
     }
     out << std::endl;
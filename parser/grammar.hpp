@@ -29,6 +29,9 @@ public:
     std::vector<std::unique_ptr<Term>> terms;
     Endmark endmark;
     
+    /** Terminals followed by the endmark, indexed by their lookahead id. */
+    std::vector<Symbol*> terminals;
+    
     /** Reads in the user defined grammar. */
     bool read_grammar(std::istream& in);
     
@@ -0,0 +1,392 @@
+#include "previous.hpp"
+#include "solver.hpp"
+
+#include <algorithm>
+
+/******************************************************************************/
+/**
+ * Symbols are written by their kind and name, with the length of the name
+ * before it, so any characters can be in the name.
+ */
+static void
+write_symbol(std::ostream& out, const Grammar& grammar, const Symbol* sym)
+{
+    if (sym == &grammar.endmark) {
+        out << "e";
+    } else if (sym->terminal) {
+        const std::string& name = static_cast<const Term*>(sym)->name;
+        out << "t" << name.size() << ":" << name;
+    } else {
+        const std::string& name = static_cast<const Nonterm*>(sym)->name;
+        out << "n" << name.size() << ":" << name;
+    }
+}
+
+/**
+ * Reads a symbol and finds it in the grammar by name.  The symbol is null if
+ * it is no longer in the grammar, and false is returned if the file is bad.
+ */
+static bool
+read_symbol(std::istream& in,
+            const std::map<std::string, Symbol*>& terms,
+            const std::map<std::string, Symbol*>& nonterms,
+            Symbol* endmark,
+            Symbol** sym)
+{
+    *sym = nullptr;
+    
+    in >> std::ws;
+    int kind = in.get();
+    if (kind == 'e') {
+        *sym = endmark;
+        return true;
+    } else if (kind != 't' && kind != 'n') {
+        return false;
+    }
+    
+    size_t size = 0;
+    if (!(in >> size) || in.get() != ':') {
+        return false;
+    }
+    std::string name(size, '\0');
+    if (size > 0 && !in.read(&name[0], size)) {
+        return false;
+    }
+    
+    const std::map<std::string, Symbol*>& names = kind == 't' ? terms : nonterms;
+    auto found = names.find(name);
+    if (found != names.end()) {
+        *sym = found->second;
+    }
+    return true;
+}
+
+/******************************************************************************/
+/**
+ * The symbols are written once by name, and the rules and items after them
+ * refer to the symbols and rules by their index.
+ */
+void
+Previous::write(const Grammar& grammar, const Solver& solver, std::ostream& out)
+{
+    std::vector<Nonterm::Rule*> rules;
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            rules.push_back(rule.get());
+        }
+    }
+    
+    /** Terminals are numbered by id, followed by the nonterminals. */
+    size_t terms = grammar.terminals.size();
+    auto index = [terms](const Symbol* sym) {
+        return sym->terminal ? sym->id : terms + sym->id;
+    };
+    
+    out << "previous " << version << "\n";
+    out << "symbols " << terms << " " << grammar.nonterms.size() << "\n";
+    for (auto sym : grammar.terminals) {
+        write_symbol(out, grammar, sym);
+        out << "\n";
+    }
+    for (auto& nonterm : grammar.nonterms) {
+        write_symbol(out, grammar, nonterm.get());
+        out << "\n";
+    }
+    
+    out << "rules " << rules.size() << "\n";
+    for (auto rule : rules) {
+        out << index(rule->nonterm) << " " << rule->product.size();
+        for (auto sym : rule->product) {
+            out << " " << index(sym);
+        }
+        out << "\n";
+    }
+    
+    std::vector<size_t> numbers(rules.size());
+    for (size_t i = 0; i < rules.size(); i++) {
+        if (rules[i]->id >= numbers.size()) {
+            numbers.resize(rules[i]->id + 1);
+        }
+        numbers[rules[i]->id] = i;
+    }
+    
+    out << "states " << solver.states.size() << "\n";
+    for (auto& state : solver.states) {
+        
+        /** The next states are written in the order they are solved. */
+        std::vector<std::pair<Symbol*, State*>> nexts(state->nexts.begin(),
+                                                      state->nexts.end());
+        std::sort(nexts.begin(), nexts.end(),
+                  [](const std::pair<Symbol*, State*>& left,
+                     const std::pair<Symbol*, State*>& right) {
+            return State::next_before(left.first, right.first);
+        });
+        
+        out << state->kernel.size() << " " << nexts.size() << "\n";
+        for (auto& item : state->kernel) {
+            out << numbers[item.rule->id] << " " << item.mark << " ";
+            out << item.ahead.count();
+            for (size_t i = item.ahead.next(0); i != Bitset::npos;
+                 i = item.ahead.next(i + 1)) {
+                out << " " << i;
+            }
+            out << "\n";
+        }
+        for (auto& next : nexts) {
+            out << index(next.first) << " " << next.second->id << "\n";
+        }
+    }
+}
+
+/******************************************************************************/
+bool
+Previous::read(std::istream& in, const Grammar& grammar)
+{
+    states.clear();
+    clean.clear();
+    changed.clear();
+    
+    std::map<std::string, Symbol*> terms;
+    for (auto& term : grammar.terms) {
+        terms[term->name] = term.get();
+    }
+    std::map<std::string, Symbol*> nonterms;
+    for (auto& nonterm : grammar.nonterms) {
+        nonterms[nonterm->name] = nonterm.get();
+    }
+    Symbol* endmark = const_cast<Endmark*>(&grammar.endmark);
+    
+    std::map<std::pair<const Nonterm*, std::vector<Symbol*>>,
+             Nonterm::Rule*> found;
+    for (auto& nonterm : grammar.nonterms) {
+        for (auto& rule : nonterm->rules) {
+            found.emplace(std::make_pair(nonterm.get(), rule->product),
+                          rule.get());
+        }
+    }
+    
+    std::string word;
+    int number = 0;
+    if (!(in >> word >> number) || word != "previous" || number != version) {
+        return false;
+    }
+    
+    /** Match the symbols to the grammar by name, null if they are gone. */
+    size_t count = 0;
+    size_t count_terms = 0;
+    if (!(in >> word >> count_terms >> count) || word != "symbols") {
+        return false;
+    }
+    std::vector<Symbol*> symbols(count_terms + count, nullptr);
+    for (auto& sym : symbols) {
+        if (!read_symbol(in, terms, nonterms, endmark, &sym)) {
+            return false;
+        }
+    }
+    auto read_index = [&in](size_t size, size_t* index) {
+        return (in >> *index) && *index < size;
+    };
+    
+    /** Match the rules to the grammar, noting those that are gone. */
+    if (!(in >> word >> count) || word != "rules") {
+        return false;
+    }
+    std::vector<Nonterm::Rule*> rules(count, nullptr);
+    std::map<const Nonterm*, std::set<std::vector<Symbol*>>> products;
+    for (size_t i = 0; i < count; i++) {
+        size_t index = 0;
+        size_t size = 0;
+        if (!read_index(symbols.size(), &index) || index < count_terms ||
+            !(in >> size)) {
+            return false;
+        }
+        const Nonterm* nonterm = static_cast<const Nonterm*>(symbols[index]);
+        
+        bool known = true;
+        std::vector<Symbol*> product;
+        for (size_t j = 0; j < size; j++) {
+            if (!read_index(symbols.size(), &index)) {
+                return false;
+            }
+            known = known && symbols[index];
+            product.push_back(symbols[index]);
+        }
+        
+        if (!nonterm) {
+            continue;
+        } else if (!known) {
+            changed.insert(nonterm);
+            continue;
+        }
+        products[nonterm].insert(product);
+        auto rule = found.find(std::make_pair(nonterm, product));
+        if (rule != found.end()) {
+            rules[i] = rule->second;
+        }
+    }
+    
+    /**
+     * Read the kernels, clearing those with a rule or next symbol that is gone.
+     * A lookahead that is gone is only dropped, since the rules that had it
+     * changed, and the state can still keep its id by its core.
+     */
+    if (!(in >> word >> count) || word != "states") {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        states.push_back(std::make_unique<State>(i));
+    }
+    std::vector<bool> broken(count, false);
+    
+    for (auto& state : states) {
+        size_t items = 0;
+        size_t nexts = 0;
+        if (!(in >> items >> nexts)) {
+            return false;
+        }
+        
+        for (size_t i = 0; i < items; i++) {
+            size_t rule = 0;
+            size_t mark = 0;
+            size_t aheads = 0;
+            if (!read_index(rules.size(), &rule) || !(in >> mark >> aheads)) {
+                return false;
+            }
+            
+            Bitset ahead;
+            for (size_t j = 0; j < aheads; j++) {
+                size_t index = 0;
+                if (!read_index(count_terms, &index)) {
+                    return false;
+                }
+                if (symbols[index]) {
+                    ahead.insert(symbols[index]->id);
+                }
+            }
+            
+            if (!rules[rule] || mark > rules[rule]->product.size()) {
+                broken[state->id] = true;
+            } else {
+                state->kernel.emplace_back(rules[rule], mark, ahead);
+            }
+        }
+        
+        for (size_t i = 0; i < nexts; i++) {
+            size_t index = 0;
+            size_t target = 0;
+            if (!read_index(symbols.size(), &index) ||
+                !read_index(states.size(), &target)) {
+                return false;
+            }
+            if (!symbols[index]) {
+                broken[state->id] = true;
+            } else {
+                state->nexts[symbols[index]] = states[target].get();
+            }
+        }
+        
+        if (broken[state->id]) {
+            state->kernel.clear();
+        }
+        std::sort(state->kernel.begin(), state->kernel.end());
+    }
+    
+    solve_changed(grammar, products);
+    solve_clean();
+    return true;
+}
+
+/**
+ * A nonterminal's rules are changed if the set of their symbols is different.
+ * The nonterminals that derive a changed one are then found by following the
+ * rules backwards from each changed nonterminal.
+ */
+void
+Previous::solve_changed(const Grammar& grammar,
+                        const std::map<const Nonterm*,
+                            std::set<std::vector<Symbol*>>>& rules)
+{
+    std::vector<std::vector<const Nonterm*>> derived(grammar.nonterms.size());
+    std::vector<const Nonterm*> found(changed.begin(), changed.end());
+    
+    for (auto& nonterm : grammar.nonterms) {
+        std::set<std::vector<Symbol*>> products;
+        for (auto& rule : nonterm->rules) {
+            products.insert(rule->product);
+            for (auto sym : rule->product) {
+                if (!sym->terminal) {
+                    derived[sym->id].push_back(nonterm.get());
+                }
+            }
+        }
+        
+        auto before = rules.find(nonterm.get());
+        if (before == rules.end() || before->second != products) {
+            if (changed.insert(nonterm.get()).second) {
+                found.push_back(nonterm.get());
+            }
+        }
+    }
+    
+    while (found.size() > 0)
+    {
+        const Nonterm* nonterm = found.back();
+        found.pop_back();
+        
+        for (auto user : derived[nonterm->id]) {
+            if (changed.insert(user).second) {
+                found.push_back(user);
+            }
+        }
+    }
+}
+
+/**
+ * A state is clean if its items are followed only by terminals and unchanged
+ * nonterminals, and all of its next states are clean.  Since the next states
+ * of a clean state have the same items advanced, they are normally clean too,
+ * but states with symbols that are gone are checked from their next states
+ * backwards.
+ */
+void
+Previous::solve_clean()
+{
+    clean.assign(states.size(), true);
+    
+    std::vector<std::vector<size_t>> before(states.size());
+    std::vector<size_t> found;
+    
+    for (auto& state : states) {
+        for (auto& next : state->nexts) {
+            before[next.second->id].push_back(state->id);
+        }
+        
+        bool ok = state->kernel.size() > 0;
+        for (auto& item : state->kernel) {
+            const auto& product = item.rule->product;
+            for (size_t i = item.mark; ok && i < product.size(); i++) {
+                if (!product[i]->terminal &&
+                    changed.count(static_cast<const Nonterm*>(product[i]))) {
+                    ok = false;
+                }
+            }
+        }
+        if (!ok) {
+            clean[state->id] = false;
+            found.push_back(state->id);
+        }
+    }
+    
+    while (found.size() > 0)
+    {
+        size_t index = found.back();
+        found.pop_back();
+        
+        for (size_t prior : before[index]) {
+            if (clean[prior]) {
+                clean[prior] = false;
+                found.push_back(prior);
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Saves the kernels of the solved states, so the next run on an edited grammar
+ * can reuse the states the edit did not change and keep their ids.
+ */
+
+#ifndef previous_hpp
+#define previous_hpp
+
+#include "grammar.hpp"
+#include "state.hpp"
+
+#include <set>
+
+class Solver;
+
+/*******************************************************************************
+ * The states are saved with the rules of the grammar, where symbols are named
+ * rather than numbered, since an edit can add or remove symbols.  When read
+ * back, the items are matched to the rules of the edited grammar, and the
+ * nonterminals whose rules were added or removed are found.
+ *
+ * A nonterminal is changed by the edit if any rule of it, or of a nonterminal
+ * it derives, was changed.  The closure of a kernel whose items are followed
+ * only by terminals and unchanged nonterminals is the same as before, with
+ * the same firsts, so its next states are also the same.  These states are
+ * clean, and their next states can be reused without solving them again.
+ */
+class Previous
+{
+public:
+
+    /** Returns false if the file is not valid. */
+    bool read(std::istream& in, const Grammar& grammar);
+
+    static void write(const Grammar& grammar,
+                      const Solver& solver,
+                      std::ostream& out);
+
+    /**
+     * States of the previous run by their id, with their next states.  The
+     * kernel is empty for a state with an item of a removed rule.
+     */
+    std::vector<std::unique_ptr<State>> states;
+    std::vector<bool> clean;
+
+    /** Nonterminals whose rules changed, or that derive one that changed. */
+    std::set<const Nonterm*> changed;
+
+    /** Format version of the file. */
+    static const int version = 1;
+
+private:
+    void solve_changed(const Grammar& grammar,
+                       const std::map<const Nonterm*,
+                           std::set<std::vector<Symbol*>>>& rules);
+    void solve_clean();
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include "profile.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+
+/******************************************************************************/
+static bool counting = false;
+static std::atomic<size_t> total_allocations(0);
+static std::atomic<size_t> total_bytes(0);
+
+/**
+ * Replaces the global allocation functions to count each allocation.  The
+ * array and nothrow forms call these by default, so they are counted too.
+ * The flag is only written before any threads start, so reading it is not
+ * shared with the writes of the counts.
+ */
+void*
+operator new(size_t size)
+{
+    if (counting) {
+        total_allocations.fetch_add(1, std::memory_order_relaxed);
+        total_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    
+    void* memory = std::malloc(size > 0 ? size : 1);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void
+operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void
+operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+/******************************************************************************/
+void
+Profile::count_allocations()
+{
+    counting = true;
+}
+
+size_t
+Profile::allocations()
+{
+    return total_allocations.load(std::memory_order_relaxed);
+}
+
+size_t
+Profile::allocated()
+{
+    return total_bytes.load(std::memory_order_relaxed);
+}
+
+/** Linux reports the peak in kilobytes, while macOS reports it in bytes. */
+size_t
+Profile::peak_memory()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return (size_t)usage.ru_maxrss / 1024;
+#else
+    return (size_t)usage.ru_maxrss;
+#endif
+}
+
+/******************************************************************************/
+void
+Profile::begin(const std::string& name)
+{
+    this->name = name;
+    start_allocations = allocations();
+    start_bytes = allocated();
+    start = std::chrono::steady_clock::now();
+}
+
+void
+Profile::end()
+{
+    std::chrono::duration<double> seconds;
+    seconds = std::chrono::steady_clock::now() - start;
+    
+    Phase phase;
+    phase.name = name;
+    phase.seconds = seconds.count();
+    phase.allocations = allocations() - start_allocations;
+    phase.bytes = allocated() - start_bytes;
+    phase.peak = peak_memory();
+    phases.push_back(phase);
+}
+
+void
+Profile::count(const std::string& name, size_t value)
+{
+    counts.emplace_back(name, value);
+}
+
+/******************************************************************************/
+void
+Profile::print_text(std::ostream& out) const
+{
+    for (auto& phase : phases) {
+        out << phase.name << ": " << phase.seconds << "s, ";
+        out << phase.allocations << " allocations of ";
+        out << phase.bytes << " bytes, peak " << phase.peak << "KB\n";
+    }
+    for (auto& count : counts) {
+        out << count.first << ": " << count.second << "\n";
+    }
+}
+
+/** The names are written as keys with spaces replaced by underscores. */
+void
+Profile::print_json(std::ostream& out) const
+{
+    auto key = [](const std::string& name) {
+        std::string result = name;
+        for (auto& c : result) {
+            c = (c == ' ') ? '_' : c;
+        }
+        return "\"" + result + "\"";
+    };
+    
+    out << "{\n  \"phases\": [";
+    for (size_t i = 0; i < phases.size(); i++) {
+        const Phase& phase = phases[i];
+        out << (i > 0 ? ",\n" : "\n");
+        out << "    {\"name\": " << key(phase.name);
+        out << ", \"seconds\": " << phase.seconds;
+        out << ", \"allocations\": " << phase.allocations;
+        out << ", \"bytes\": " << phase.bytes;
+        out << ", \"peak_kb\": " << phase.peak << "}";
+    }
+    out << "\n  ],\n  \"counts\": {";
+    for (size_t i = 0; i < counts.size(); i++) {
+        out << (i > 0 ? ",\n" : "\n");
+        out << "    " << key(counts[i].first) << ": " << counts[i].second;
+    }
+    out << "\n  }\n}\n";
+}
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Measures the time and memory used by each phase of generating the tables,
+ * along with counts of what each phase found, for reporting as text or JSON.
+ */
+
+#ifndef profile_hpp
+#define profile_hpp
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Each phase records the wall time, and the number and bytes of allocations,
+ * between its begin and end.  Allocations are counted by replacing the global
+ * operator new, so they include every allocation of the program, but only once
+ * counting is turned on.  The peak resident memory is that of the whole
+ * process at the end of the phase.
+ */
+class Profile
+{
+public:
+    void begin(const std::string& name);
+    void end();
+    
+    /** Adds a named count to the report. */
+    void count(const std::string& name, size_t value);
+    
+    void print_text(std::ostream& out) const;
+    void print_json(std::ostream& out) const;
+    
+    /**
+     * Turns on counting allocations, before any threads are started, so that
+     * allocations cost nothing extra when not profiling.
+     */
+    static void count_allocations();
+    
+    /** Number and total bytes of allocations since counting was turned on. */
+    static size_t allocations();
+    static size_t allocated();
+    
+    /** Peak resident memory of the process in kilobytes. */
+    static size_t peak_memory();
+    
+private:
+    struct Phase {
+        std::string name;
+        double seconds;
+        size_t allocations;
+        size_t bytes;
+        size_t peak;
+    };
+    std::vector<Phase> phases;
+    std::vector<std::pair<std::string, size_t>> counts;
+    
+    /** Start of the current phase. */
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+    size_t start_allocations = 0;
+    size_t start_bytes = 0;
+};
+
+#endif
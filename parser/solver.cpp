@@ -1,6 +1,13 @@
 #include "solver.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+
 /******************************************************************************/
+thread_local size_t Solver::comparisons = 0;
+
 bool
 Solver::solve(Grammar& grammar)
 {
@@ -13,86 +20,110 @@ Solver::solve(Grammar& grammar)
     Nonterm::solve_first(grammar.nonterms);
     Nonterm::solve_follows(grammar.nonterms, &grammar.endmark);
     
+    solve_states(grammar);
+    
+    if (method == pager) {
+        remove_unreachable();
+        solve_lookaheads();
+    }
+    if (previous) {
+        keep_ids();
+    }
+    
+    return solve_actions(grammar);
+}
+
+void
+Solver::solve_canonical(Grammar& grammar)
+{
+    if (method == canonical) {
+        canonical_states = states.size();
+    } else {
+        Solver check;
+        check.threads = threads;
+        check.solve_states(grammar);
+        canonical_states = check.states.size();
+    }
+}
+
+/**
+ * Starting from the first rule of the grammar, keep solving for the next states
+ * of each state until no new states, or new lookaheads for merged states, are
+ * found.
+ */
+void
+Solver::solve_states(Grammar& grammar)
+{
+    find_saved();
+    if (threads > 1 && method != pager) {
+        solve_parallel(grammar);
+        renumber(grammar);
+        return;
+    }
+    
     Nonterm* nonterm = grammar.nonterms.front().get();
     Nonterm::Rule* rule = nonterm->rules.front().get();
     
-    Item item(rule, 0, &grammar.endmark);
+    Item item(rule, 0);
+    item.ahead.insert(grammar.endmark.id);
     
     auto state = std::make_unique<State>(states.size());
-    state->items.insert(item);
-    state->closure();
-    
-    std::vector<State*> checking;
-    checking.push_back(state.get());
-    
-    states.push_back(std::move(state));
+    state->kernel.push_back(item);
+    add_state(std::move(state));
     
     while (checking.size() > 0)
     {
         State* state = checking.back();
         checking.pop_back();
+        pending[state->id] = false;
         
-        for (auto& term : grammar.terms) {
-            Symbol* sym = term.get();
-            std::unique_ptr<State> next = state->solve_next(sym, states.size());
-            if (next) {
-                State* target = nullptr;
-                for (auto& s : states) {
-                    if (next->items == s->items) {
-                        target = s.get();
-                        break;
-                    }
-                }
-                if (!target) {
-                    target = next.get();
-                    states.push_back(std::move(next));
-                    checking.push_back(target);
-                }
-                state->nexts[sym] = target;
-            }
-        }
-        
-        for (auto& nonterm : grammar.nonterms) {
-            Symbol* sym = nonterm.get();
-            std::unique_ptr<State> next = state->solve_next(sym, states.size());
-            if (next) {
-                State* target = nullptr;
-                for (auto& s : states) {
-                    if (next->items == s->items) {
-                        target = s.get();
-                        break;
-                    }
-                }
-                if (!target) {
-                    target = next.get();
-                    states.push_back(std::move(next));
-                    checking.push_back(target);
-                }
-                state->nexts[sym] = target;
-            }
+        if (origins[state->id]) {
+            reuse_nexts(state, origins[state->id]);
+        } else {
+            solve_nexts(state);
         }
     }
+}
+
+bool
+Solver::solve_actions(Grammar& grammar)
+{
+    Item accept = accept_item(grammar);
     
-    Item accept(rule, rule->product.size(), &grammar.endmark);
+    bool conflicts = false;
+    
+    std::unordered_map<const State::Actions*, State::Actions*,
+                       ActionsHash, ActionsEqual> unique;
     
     for (auto& state : states) {
-        std::unique_ptr<State::Actions> acts = state->solve_actions(accept);
+        if (state->items.size() == 0) {
+            state->closure();
+        }
+        std::unique_ptr<State::Actions> acts =
+            state->solve_actions(accept, grammar.terminals);
+        if (!acts) {
+            conflicts = true;
+            continue;
+        }
         
         State::Actions* found = nullptr;
-        for (auto& a : actions) {
-            if (a->is_same(acts)) {
-                found = a.get();
-                break;
-            }
-        }
-        if (!found) {
+        auto exists = unique.find(acts.get());
+        if (exists != unique.end()) {
+            found = exists->second;
+        } else {
             found = acts.get();
+            unique[found] = found;
             actions.push_back(std::move(acts));
         }
         state->actions = found;
         state->solve_gotos();
     }
     
+    if (conflicts) {
+        print_conflicts(grammar);
+        return false;
+    }
+    
     for (auto itr  = states.rbegin();
          itr != states.rend(); ++itr) {
         (*itr)->actions->id = (*itr)->id;
@@ -100,3 +131,638 @@ Solver::solve(Grammar& grammar)
     
     return true;
 }
+
+Item
+Solver::accept_item(Grammar& grammar)
+{
+    Nonterm* nonterm = grammar.nonterms.front().get();
+    Nonterm::Rule* rule = nonterm->rules.front().get();
+    
+    Item accept(rule, rule->product.size());
+    accept.ahead.insert(grammar.endmark.id);
+    return accept;
+}
+
+/**
+ * Solves for the kernels of the next states and looks for existing states with
+ * the same kernel, or the same core when merging states.  Only newly found
+ * states need the closure of their items and are added to the states left to
+ * check.
+ */
+void
+Solver::solve_nexts(State* state)
+{
+    for (auto& next : state->solve_nexts()) {
+        State* target = nullptr;
+        if (method == canonical) {
+            target = find_kernel(std::move(next.second));
+        } else {
+            target = find_core(std::move(next.second));
+        }
+        state->nexts[next.first] = target;
+    }
+}
+
+State*
+Solver::find_kernel(std::unique_ptr<State> next)
+{
+    auto found = kernels.find(next.get());
+    if (found != kernels.end()) {
+        lookup_hits++;
+        return found->second;
+    }
+    lookup_misses++;
+    return add_state(std::move(next));
+}
+
+/**
+ * A kernel with the same core as an existing state adds its lookaheads to that
+ * state, if the states are compatible.  If new items were added, the state is
+ * checked again to propagate the new lookaheads to its next states.
+ */
+State*
+Solver::find_core(std::unique_ptr<State> next)
+{
+    State* target = nullptr;
+    
+    auto found = cores.find(next.get());
+    if (found != cores.end()) {
+        for (State* state : found->second) {
+            if (method == lalr || state->is_compatible(*next)) {
+                target = state;
+                break;
+            }
+        }
+    }
+    if (!target) {
+        lookup_misses++;
+        return add_state(std::move(next));
+    }
+    lookup_hits++;
+    
+    if (target->merge(*next)) {
+        merges++;
+        target->closure();
+        check_later(target);
+    }
+    return target;
+}
+
+/**
+ * A state that is clean in the previous run does not need its closure to find
+ * its next states, so its closure is only solved with its actions.
+ */
+State*
+Solver::add_state(std::unique_ptr<State> next)
+{
+    State* state = next.get();
+    state->id = states.size();
+    
+    State* origin = find_origin(state);
+    origins.push_back(origin);
+    if (!origin) {
+        state->closure();
+    }
+    
+    if (method == canonical) {
+        kernels[state] = state;
+    } else {
+        cores[state].push_back(state);
+    }
+    
+    states.push_back(std::move(next));
+    pending.push_back(false);
+    check_later(state);
+    return state;
+}
+
+void
+Solver::check_later(State* state)
+{
+    if (!pending[state->id]) {
+        pending[state->id] = true;
+        checking.push_back(state);
+    }
+}
+
+/**
+ * Only the canonical states can be reused, since merged states could have
+ * lookaheads from states the edit changed.  The saved states are only read
+ * while solving, so the threads can look them up without a lock.
+ */
+void
+Solver::find_saved()
+{
+    saved.clear();
+    origins.clear();
+    if (previous && method == canonical) {
+        for (size_t i = 0; i < previous->states.size(); i++) {
+            if (previous->clean[i]) {
+                State* state = previous->states[i].get();
+                saved[state] = state;
+            }
+        }
+    }
+}
+
+State*
+Solver::find_origin(State* state) const
+{
+    if (saved.size() > 0) {
+        auto found = saved.find(state);
+        if (found != saved.end()) {
+            return found->second;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * The next states of a clean state are the same as in the previous run, so
+ * their kernels are copied, in the order they would be solved, rather than
+ * found from the items.
+ */
+State::Nexts
+Solver::saved_nexts(State* origin) const
+{
+    std::vector<std::pair<Symbol*, State*>> nexts(origin->nexts.begin(),
+                                                  origin->nexts.end());
+    std::sort(nexts.begin(), nexts.end(),
+              [](const std::pair<Symbol*, State*>& left,
+                 const std::pair<Symbol*, State*>& right) {
+        return State::next_before(left.first, right.first);
+    });
+    
+    State::Nexts result;
+    for (auto& next : nexts) {
+        result.emplace_back(next.first, std::make_unique<State>(0));
+        result.back().second->kernel = next.second->kernel;
+    }
+    return result;
+}
+
+void
+Solver::reuse_nexts(State* state, State* origin)
+{
+    reused++;
+    for (auto& next : saved_nexts(origin)) {
+        state->nexts[next.first] = find_kernel(std::move(next.second));
+    }
+}
+
+/**
+ * Gives the states found in the previous run their previous ids, matching the
+ * kernel or, when states are merged, the core.  The first state stays first.
+ * A previous id past the new number of states cannot be kept, so those states
+ * take the ids left over in their previous order, which keeps the end of the
+ * table in the same order when states before it are removed.  New states take
+ * the rest in the order they were found.
+ */
+void
+Solver::keep_ids()
+{
+    std::unordered_map<const State*, size_t, KernelHash, KernelEqual> kernels_before;
+    std::unordered_map<const State*, size_t, CoreHash, CoreEqual> cores_before;
+    for (auto& state : previous->states) {
+        if (state->kernel.size() > 0) {
+            kernels_before.emplace(state.get(), state->id);
+            cores_before.emplace(state.get(), state->id);
+        }
+    }
+    
+    size_t size = states.size();
+    std::vector<size_t> ids(size, size);
+    std::vector<bool> taken(size, false);
+    std::vector<std::pair<size_t, size_t>> tail;
+    const size_t none = (size_t)-1;
+    
+    for (size_t i = 0; i < size; i++) {
+        size_t id = none;
+        auto kernel = kernels_before.find(states[i].get());
+        if (kernel != kernels_before.end()) {
+            id = kernel->second;
+        } else if (method != canonical) {
+            auto core = cores_before.find(states[i].get());
+            if (core != cores_before.end()) {
+                id = core->second;
+            }
+        }
+        if (i == 0) {
+            ids[i] = 0;
+            taken[0] = true;
+            kept += (id == 0) ? 1 : 0;
+        } else if (id < size && !taken[id]) {
+            ids[i] = id;
+            taken[id] = true;
+            kept++;
+        } else if (id != none && id >= size) {
+            tail.emplace_back(id, i);
+        }
+    }
+    
+    /** States past the end keep their order in the ids left, then new ones. */
+    std::sort(tail.begin(), tail.end());
+    size_t free = 0;
+    auto take = [&](size_t i) {
+        while (taken[free]) {
+            free++;
+        }
+        ids[i] = free;
+        taken[free] = true;
+    };
+    for (auto& old : tail) {
+        take(old.second);
+    }
+    for (size_t i = 0; i < size; i++) {
+        if (ids[i] == size) {
+            take(i);
+        }
+    }
+    
+    std::vector<std::unique_ptr<State>> sorted(size);
+    for (size_t i = 0; i < size; i++) {
+        states[i]->id = ids[i];
+        sorted[ids[i]] = std::move(states[i]);
+    }
+    states = std::move(sorted);
+}
+
+/******************************************************************************/
+/**
+ * Calls the function for each index up to the count, from the given number of
+ * threads.  Each thread takes the next index not yet taken, so threads that
+ * finish early keep taking work from the others.
+ */
+static void
+run_parallel(size_t threads, size_t count,
+             const std::function<void(size_t thread, size_t index)>& function)
+{
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> pool;
+    for (size_t t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            for (size_t i = next++; i < count; i = next++) {
+                function(t, i);
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+/**
+ * Solves the states in rounds, where every state checked in a round is either
+ * new or has new lookaheads from the previous round.  New states are added to
+ * the shared table as they are found, but lookaheads for existing states are
+ * kept until the end of the round.  The states with new lookaheads then have
+ * their closure solved again and are checked in the next round.
+ */
+void
+Solver::solve_parallel(Grammar& grammar)
+{
+    shards.clear();
+    for (size_t i = 0; i < threads * 4; i++) {
+        shards.push_back(std::make_unique<Shard>());
+    }
+    
+    Nonterm* nonterm = grammar.nonterms.front().get();
+    Nonterm::Rule* rule = nonterm->rules.front().get();
+    
+    Item item(rule, 0);
+    item.ahead.insert(grammar.endmark.id);
+    
+    auto first = std::make_unique<State>(0);
+    first->kernel.push_back(item);
+    
+    Worker start;
+    std::vector<State*> round { find_shared(std::move(first), &start) };
+    states.push_back(std::move(start.added.front()));
+    origins.push_back(start.origins.front());
+    
+    while (round.size() > 0)
+    {
+        std::vector<Worker> workers(threads);
+        run_parallel(threads, round.size(), [&](size_t t, size_t i) {
+            solve_nexts(round[i], &workers[t]);
+        });
+        
+        std::vector<State*> checked;
+        for (auto& worker : workers) {
+            lookup_hits += worker.lookup_hits;
+            lookup_misses += worker.lookup_misses;
+            reused += worker.reused;
+            State::closures += worker.closures;
+            comparisons += worker.comparisons;
+            for (size_t i = 0; i < worker.added.size(); i++) {
+                worker.added[i]->id = states.size();
+                checked.push_back(worker.added[i].get());
+                states.push_back(std::move(worker.added[i]));
+                origins.push_back(worker.origins[i]);
+            }
+        }
+        
+        std::vector<bool> queued(states.size(), false);
+        for (State* state : checked) {
+            queued[state->id] = true;
+        }
+        
+        std::vector<State*> merged;
+        for (auto& worker : workers) {
+            for (auto& merging : worker.merging) {
+                State* target = merging.first;
+                if (target->merge(*merging.second)) {
+                    merges++;
+                    if (!queued[target->id]) {
+                        queued[target->id] = true;
+                        checked.push_back(target);
+                    }
+                    merged.push_back(target);
+                }
+            }
+        }
+        
+        std::sort(merged.begin(), merged.end());
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+        run_parallel(threads, merged.size(), [&](size_t t, size_t i) {
+            merged[i]->closure();
+        });
+        State::closures += merged.size();
+        
+        round = std::move(checked);
+    }
+    shards.clear();
+}
+
+/** Clean states of the previous run copy their next states, as with one thread. */
+void
+Solver::solve_nexts(State* state, Worker* worker)
+{
+    size_t closures = State::closures;
+    size_t compared = comparisons;
+    
+    State* origin = origins[state->id];
+    if (origin) {
+        worker->reused++;
+    }
+    for (auto& next : origin ? saved_nexts(origin) : state->solve_nexts()) {
+        state->nexts[next.first] = find_shared(std::move(next.second), worker);
+    }
+    
+    worker->closures += State::closures - closures;
+    worker->comparisons += comparisons - compared;
+}
+
+/**
+ * Looks for the state in the shard of the table for its hash, adding it if not
+ * found.  The closure of a new state is solved after releasing the lock, since
+ * other threads finding the state only compare its kernel.
+ */
+State*
+Solver::find_shared(std::unique_ptr<State> next, Worker* worker)
+{
+    State* target = nullptr;
+    if (method == canonical) {
+        Shard& shard = *shards[KernelHash()(next.get()) % shards.size()];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        
+        auto found = shard.kernels.find(next.get());
+        if (found != shard.kernels.end()) {
+            target = found->second;
+        } else {
+            shard.kernels[next.get()] = next.get();
+        }
+    } else {
+        Shard& shard = *shards[CoreHash()(next.get()) % shards.size()];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        
+        auto found = shard.cores.find(next.get());
+        if (found != shard.cores.end()) {
+            target = found->second;
+        } else {
+            shard.cores[next.get()] = next.get();
+        }
+    }
+    
+    if (target) {
+        worker->lookup_hits++;
+        if (method != canonical) {
+            worker->merging.emplace_back(target, std::move(next));
+        }
+        return target;
+    }
+    worker->lookup_misses++;
+    
+    State* state = next.get();
+    State* origin = find_origin(state);
+    if (!origin) {
+        state->closure();
+    }
+    worker->added.push_back(std::move(next));
+    worker->origins.push_back(origin);
+    return state;
+}
+
+/**
+ * Follows the next states from the first state in the same order as solving
+ * with a single thread, where the states are checked from the end of the list
+ * and the next states of each are found for the terminals and then the
+ * nonterminals.
+ */
+void
+Solver::renumber(Grammar& grammar)
+{
+    std::vector<State*> order;
+    std::vector<bool> found(states.size(), false);
+    std::vector<State*> stack;
+    
+    auto visit = [&](State* state, Symbol* sym) {
+        auto next = state->nexts.find(sym);
+        if (next != state->nexts.end() && !found[next->second->id]) {
+            found[next->second->id] = true;
+            order.push_back(next->second);
+            stack.push_back(next->second);
+        }
+    };
+    
+    found[0] = true;
+    order.push_back(states.front().get());
+    stack.push_back(states.front().get());
+    
+    while (stack.size() > 0)
+    {
+        State* state = stack.back();
+        stack.pop_back();
+        
+        for (auto& term : grammar.terms) {
+            visit(state, term.get());
+        }
+        for (auto& nonterm : grammar.nonterms) {
+            visit(state, nonterm.get());
+        }
+    }
+    
+    std::vector<std::unique_ptr<State>> sorted(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        sorted[i] = std::move(states[order[i]->id]);
+    }
+    for (size_t i = 0; i < sorted.size(); i++) {
+        sorted[i]->id = i;
+    }
+    states = std::move(sorted);
+}
+
+/******************************************************************************/
+void
+Solver::remove_unreachable()
+{
+    std::vector<bool> reached(states.size(), false);
+    std::vector<State*> stack;
+    
+    reached[0] = true;
+    stack.push_back(states.front().get());
+    
+    while (stack.size() > 0) {
+        State* state = stack.back();
+        stack.pop_back();
+        for (auto& next : state->nexts) {
+            if (!reached[next.second->id]) {
+                reached[next.second->id] = true;
+                stack.push_back(next.second);
+            }
+        }
+    }
+    
+    std::vector<std::unique_ptr<State>> kept;
+    for (auto& state : states) {
+        if (reached[state->id]) {
+            state->id = kept.size();
+            kept.push_back(std::move(state));
+        }
+    }
+    
+    unreachable = states.size() - kept.size();
+    states = std::move(kept);
+    kernels.clear();
+    cores.clear();
+}
+
+/**
+ * Clears the lookaheads of every state other than the first and then follows
+ * the transitions, merging the next kernels into their target states, until
+ * no new lookaheads are found.
+ */
+void
+Solver::solve_lookaheads()
+{
+    for (size_t i = 1; i < states.size(); i++) {
+        for (auto& item : states[i]->kernel) {
+            item.ahead.clear();
+        }
+        states[i]->closure();
+    }
+    
+    checking.clear();
+    pending.assign(states.size(), false);
+    check_later(states.front().get());
+    
+    while (checking.size() > 0)
+    {
+        State* state = checking.back();
+        checking.pop_back();
+        pending[state->id] = false;
+        
+        for (auto& next : state->solve_nexts()) {
+            State* target = state->nexts[next.first];
+            if (target->merge(*next.second)) {
+                target->closure();
+                check_later(target);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+/**
+ * When merging states, a reduce/reduce conflict is only new if no state of the
+ * canonical LR(1) method with the same core has that conflict.  The canonical
+ * states are solved only after finding conflicts, to report which conflicts
+ * were introduced by the merge.
+ */
+void
+Solver::print_conflicts(Grammar& grammar)
+{
+    std::unordered_map<const State*, std::set<State::Conflict>,
+                       CoreHash, CoreEqual> inherent;
+    
+    Solver check;
+    check.threads = threads;
+    if (method != canonical) {
+        check.solve_states(grammar);
+        
+        Item accept = accept_item(grammar);
+        for (auto& state : check.states) {
+            state->solve_actions(accept, grammar.terminals);
+            for (auto& conflict : state->conflicts) {
+                inherent[state.get()].insert(conflict);
+            }
+        }
+    }
+    
+    for (auto& state : states) {
+        for (auto& conflict : state->conflicts) {
+            std::cerr << "Error: Reduce/reduce conflict in state ";
+            std::cerr << state->id << " on ";
+            conflict.ahead->print(std::cerr);
+            
+            if (method != canonical) {
+                auto found = inherent.find(state.get());
+                if (found == inherent.end() || found->second.count(conflict) == 0) {
+                    std::cerr << " from merging states with the same core";
+                }
+            }
+            std::cerr << ".\n";
+            
+            std::cerr << "  ";
+            conflict.first->print(std::cerr);
+            std::cerr << "\n  ";
+            conflict.second->print(std::cerr);
+            std::cerr << "\n";
+        }
+    }
+}
+
+/******************************************************************************/
+size_t
+Solver::KernelHash::operator()(const State* state) const {
+    return state->hash();
+}
+
+bool
+Solver::KernelEqual::operator()(const State* left, const State* right) const {
+    comparisons++;
+    return left->kernel == right->kernel;
+}
+
+size_t
+Solver::ActionsHash::operator()(const State::Actions* actions) const {
+    return actions->hash();
+}
+
+bool
+Solver::ActionsEqual::operator()(const State::Actions* left,
+                                 const State::Actions* right) const {
+    comparisons++;
+    return left->is_same(*right);
+}
+
+size_t
+Solver::CoreHash::operator()(const State* state) const {
+    return state->hash_core();
+}
+
+bool
+Solver::CoreEqual::operator()(const State* left, const State* right) const {
+    comparisons++;
+    return left->same_core(*right);
+}
@@ -7,6 +7,10 @@
 
 #include "grammar.hpp"
 #include "state.hpp"
+#include "previous.hpp"
+
+#include <unordered_map>
+#include <mutex>
 
 /*******************************************************************************
  * With all states known, actions such as shifting a symbol onto the stack or
@@ -16,14 +20,174 @@
 class Solver
 {
 public:
+    /**
+     * The canonical LR(1) method keeps every state with a unique kernel.  The
+     * LALR(1) method merges the states with the same core, resulting in much
+     * smaller tables, but possibly with new reduce/reduce conflicts.  Pager's
+     * method only merges states with the same core that are compatible, which
+     * gives tables close to the LALR(1) size without any new conflicts.
+     */
+    enum Method { canonical, lalr, pager };
+    Method method = canonical;
+    
+    /**
+     * Number of threads solving the next states of the canonical and LALR(1)
+     * methods.  Pager's method depends on the order states are merged, so it
+     * is always solved by a single thread.
+     */
+    size_t threads = 1;
+    
     /** After reading the grammar, solve for parse states. */
     bool solve(Grammar& grammar);
     
+    /**
+     * For comparing the merged states to the canonical ones, solves for the
+     * number of canonical LR(1) states of the grammar.
+     */
+    void solve_canonical(Grammar& grammar);
+    size_t canonical_states = 0;
+    
     /** Unique parse states of the grammar. */
     std::vector<std::unique_ptr<State>> states;
     
     /** Unique actions for the individual states to reference. */
     std::vector<std::unique_ptr<State::Actions>> actions;
+    
+    /** Number of next states that were found in, or added to, the index. */
+    size_t lookup_hits = 0;
+    size_t lookup_misses = 0;
+    
+    /**
+     * Number of kernels, cores and actions compared while looking them up in
+     * the indexes.  As with the closures, each thread counts its own.
+     */
+    static thread_local size_t comparisons;
+    
+    /** Number of found kernels that were merged into an existing state. */
+    size_t merges = 0;
+    
+    /** Number of merged states no longer reached from the first state. */
+    size_t unreachable = 0;
+    
+    /**
+     * States solved by a previous run on an earlier version of the grammar.
+     * With the canonical method, the next states of the states the edit did
+     * not change are copied instead of solved.  With any method, the states
+     * that are found again keep their previous ids, except for ids past the
+     * new number of states, which are compacted in their previous order.
+     */
+    const Previous* previous = nullptr;
+    size_t reused = 0;
+    size_t kept = 0;
+    
+private:
+    /**
+     * Index of the solved states by their kernel items.  The keys point to the
+     * kernel of the state they map to, which is owned by the states vector.
+     */
+    struct KernelHash {
+        size_t operator()(const State* state) const;
+    };
+    struct KernelEqual {
+        bool operator()(const State* left, const State* right) const;
+    };
+    std::unordered_map<const State*, State*, KernelHash, KernelEqual> kernels;
+    
+    /**
+     * Index of the solved states by their core, for merging states.  With
+     * Pager's method there can be more than one state with the same core.
+     */
+    struct CoreHash {
+        size_t operator()(const State* state) const;
+    };
+    struct CoreEqual {
+        bool operator()(const State* left, const State* right) const;
+    };
+    std::unordered_map<const State*, std::vector<State*>,
+                       CoreHash, CoreEqual> cores;
+    
+    /** Clean states of the previous run, and the one each state matches. */
+    std::unordered_map<const State*, State*, KernelHash, KernelEqual> saved;
+    std::vector<State*> origins;
+    void find_saved();
+    State* find_origin(State* state) const;
+    State::Nexts saved_nexts(State* origin) const;
+    void reuse_nexts(State* state, State* origin);
+    void keep_ids();
+    
+    /** States with new items whose next states still need to be solved. */
+    std::vector<State*> checking;
+    std::vector<bool> pending;
+    void check_later(State* state);
+    
+    /** Solves for all states, then for the actions of each state. */
+    void solve_states(Grammar& grammar);
+    bool solve_actions(Grammar& grammar);
+    
+    /** Index of the unique actions, which are shared by states. */
+    struct ActionsHash {
+        size_t operator()(const State::Actions* actions) const;
+    };
+    struct ActionsEqual {
+        bool operator()(const State::Actions* left,
+                        const State::Actions* right) const;
+    };
+    
+    /** The first rule of the grammar after reading the endmark. */
+    Item accept_item(Grammar& grammar);
+    
+    /** Finds or adds the next states of a state for each symbol. */
+    void solve_nexts(State* state);
+    State* find_kernel(std::unique_ptr<State> next);
+    State* find_core(std::unique_ptr<State> next);
+    State* add_state(std::unique_ptr<State> next);
+    
+    /**
+     * With more than one thread, the states are solved in rounds.  Each round
+     * the threads take states from the shared list of states left to check and
+     * look up their next states in a table split into separately locked
+     * shards.  Lookaheads found for existing states are only merged between
+     * rounds, when no thread is reading the items of the states.
+     */
+    struct Shard {
+        std::mutex lock;
+        std::unordered_map<const State*, State*, KernelHash, KernelEqual> kernels;
+        std::unordered_map<const State*, State*, CoreHash, CoreEqual> cores;
+    };
+    std::vector<std::unique_ptr<Shard>> shards;
+    
+    /** States and lookaheads found by one thread during a round. */
+    struct Worker {
+        std::vector<std::unique_ptr<State>> added;
+        std::vector<State*> origins;
+        std::vector<std::pair<State*, std::unique_ptr<State>>> merging;
+        size_t lookup_hits = 0;
+        size_t lookup_misses = 0;
+        size_t reused = 0;
+        size_t closures = 0;
+        size_t comparisons = 0;
+    };
+    
+    void solve_parallel(Grammar& grammar);
+    void solve_nexts(State* state, Worker* worker);
+    State* find_shared(std::unique_ptr<State> next, Worker* worker);
+    
+    /**
+     * Numbers the states in the order a single thread would have found them,
+     * so the output does not depend on the number of threads.
+     */
+    void renumber(Grammar& grammar);
+    
+    /**
+     * After merging with Pager's method, a state's next states can change as
+     * its lookaheads grow.  States no longer reached are removed, and the
+     * lookaheads are solved again from only the remaining transitions.
+     */
+    void remove_unreachable();
+    void solve_lookaheads();
+    
+    /** Reports the conflicts, noting those introduced by merging states. */
+    void print_conflicts(Grammar& grammar);
 };
 
 #endif
@@ -1,9 +1,13 @@
 #include "state.hpp"
 
+#include <algorithm>
+
 using std::vector;
 using std::ostream;
 
 /******************************************************************************/
+thread_local size_t State::closures = 0;
+
 State::State(size_t id):
 id(id),
 actions(nullptr){}
@@ -13,69 +17,221 @@ actions(nullptr){}
 //    items.insert(item);
 //}
 
+/**
+ * Starting from the kernel, adds an item for each rule of a nonterminal that
+ * is next in an item.  The lookaheads of the added item are the firsts of the
+ * symbols after the nonterminal, along with the lookaheads of the item if
+ * those symbols could be empty, both looked up from the rule of the item.
+ * Since each rule has only one item at the start of the rule, lookaheads
+ * found later are added to the existing item.
+ *
+ * The item at the start of each rule is found by the rule's id.  The index
+ * and the list of items to visit are kept for each thread and reused by the
+ * next closure, so only the items themselves are allocated.
+ */
 void
 State::closure()
 {
-    vector<Item> found;
-    std::copy(items.begin(), items.end(), std::back_inserter(found));
+    const size_t none = (size_t)-1;
+    static thread_local vector<size_t> starts;
+    static thread_local vector<size_t> found;
+    
+    closures++;
+    items = kernel;
+    found.clear();
+    
+    for (size_t i = 0; i < items.size(); i++) {
+        if (items[i].mark == 0) {
+            if (items[i].rule->id >= starts.size()) {
+                starts.resize(items[i].rule->id + 1, none);
+            }
+            starts[items[i].rule->id] = i;
+        }
+        found.push_back(i);
+    }
     
     while (found.size() > 0)
     {
-        Item item = found.back();
+        size_t index = found.back();
         found.pop_back();
         
-        Nonterm* nonterm = item.next_nonterm();
-        if (nonterm) {
-            vector<Symbol*> product = item.advance().rest();
-            product.push_back(item.ahead);
+        Nonterm* nonterm = items[index].next_nonterm();
+        if (!nonterm) {
+            continue;
+        }
+        
+        Nonterm::Rule* rule = items[index].rule;
+        size_t after = items[index].mark + 1;
+        
+        for (auto& next : nonterm->rules) {
+            size_t target = items.size();
+            bool added = false;
             
-            std::set<Symbol*> terms;
-            Nonterm::solve_firsts(product, &terms);
+            if (next->id >= starts.size()) {
+                starts.resize(next->id + 1, none);
+            }
+            if (starts[next->id] == none) {
+                starts[next->id] = target;
+                items.emplace_back(next.get(), 0);
+                added = true;
+            } else {
+                target = starts[next->id];
+            }
             
-            for (auto& rule : nonterm->rules) {
-                for (auto term : terms) {
-                    Item next = Item(rule.get(), 0, term);
-                    auto result = items.insert(next);
-                    if (result.second) {
-                        found.push_back(next);
-                    }
-                }
+            if (items[target].ahead.insert(rule->firsts[after])) {
+                added = true;
+            }
+            if (rule->empty[after] &&
+                items[target].ahead.insert(items[index].ahead)) {
+                added = true;
+            }
+            if (added) {
+                found.push_back(target);
             }
         }
     }
+    
+    for (auto& item : items) {
+        if (item.mark == 0) {
+            starts[item.rule->id] = none;
+        }
+    }
+}
+
+/** Terminals come before nonterminals, and each kind is in the order of ids. */
+bool
+State::next_before(const Symbol* left, const Symbol* right)
+{
+    if (left->terminal != right->terminal) {
+        return left->terminal;
+    }
+    return left->id < right->id;
 }
 
 /**
- * Solves for the next state for a given input symbol.  Since the goal is
- * to solve for only unique states, solve is called first and the result
- * is compared to previouly seen states.  After comparing to the previously
- * found, a pointer to a unique state is added to the current state for the
- * given symbol.
+ * Solves for the kernels of the next states for each input symbol.  Since the
+ * goal is to solve for only unique states, the kernels are compared to
+ * previously seen states before their closure is found.  The items are sorted
+ * by their next symbol, so only the next states that exist are built.
  */
+State::Nexts
+State::solve_nexts() const
+{
+    vector<std::pair<Symbol*, size_t>> found;
+    for (size_t i = 0; i < items.size(); i++) {
+        Symbol* sym = items[i].next();
+        if (sym) {
+            found.emplace_back(sym, i);
+        }
+    }
+    std::stable_sort(found.begin(), found.end(),
+                     [](const std::pair<Symbol*, size_t>& left,
+                        const std::pair<Symbol*, size_t>& right) {
+        return next_before(left.first, right.first);
+    });
+    
+    Nexts result;
+    for (auto& next : found) {
+        if (result.size() == 0 || result.back().first != next.first) {
+            result.emplace_back(next.first, std::make_unique<State>(0));
+        }
+        result.back().second->kernel.push_back(items[next.second].advance());
+    }
+    for (auto& next : result) {
+        std::sort(next.second->kernel.begin(), next.second->kernel.end());
+    }
+    return result;
+}
 
-std::unique_ptr<State>
-State::solve_next(Symbol* symbol, size_t id)
+size_t
+State::hash_core() const
 {
-    std::unique_ptr<State> state = std::make_unique<State>(id);
-    for (auto item : items) {
-        if (item.next() == symbol)
-            state->items.insert(item.advance());
+    size_t result = 0;
+    for (auto& item : kernel) {
+        hash_combine(result, item.rule->id);
+        hash_combine(result, item.mark);
     }
-    state->closure();
-    if (state->items.size() == 0) {
-        state.reset();
+    return result;
+}
+
+bool
+State::same_core(const State& other) const
+{
+    if (kernel.size() != other.kernel.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < kernel.size(); i++) {
+        if (!kernel[i].same_core(other.kernel[i])) {
+            return false;
+        }
     }
-    return state;
+    return true;
+}
+
+/**
+ * Since the kernels of states with the same core are in the same order, the
+ * lookaheads of each item are merged with the item at the same index.  The
+ * closure of the state must be solved again if any lookaheads were added.
+ */
+bool
+State::merge(const State& other)
+{
+    bool added = false;
+    for (size_t i = 0; i < kernel.size(); i++) {
+        if (kernel[i].ahead.insert(other.kernel[i].ahead)) {
+            added = true;
+        }
+    }
+    return added;
+}
+
+/**
+ * Two states are weakly compatible if, for every pair of core items, the
+ * lookaheads combined from the two states do not overlap, or they already
+ * overlap within one of the states.  If they overlap only after merging, then
+ * the merged state could have a new reduce/reduce conflict.
+ */
+bool
+State::is_compatible(const State& other) const
+{
+    const vector<Item>& left  = kernel;
+    const vector<Item>& right = other.kernel;
+    
+    for (size_t i = 0; i < left.size(); i++) {
+        for (size_t j = i + 1; j < left.size(); j++) {
+            if (!left[i].ahead.intersects(right[j].ahead) &&
+                !right[i].ahead.intersects(left[j].ahead)) {
+                continue;
+            }
+            if (left[i].ahead.intersects(left[j].ahead) ||
+                right[i].ahead.intersects(right[j].ahead)) {
+                continue;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t
+State::hash() const
+{
+    size_t result = kernel.size();
+    for (auto& item : kernel) {
+        hash_combine(result, item.hash());
+    }
+    return result;
 }
 
 std::unique_ptr<State::Actions>
-State::solve_actions(Item accept)
+State::solve_actions(const Item& accept, const vector<Symbol*>& terminals)
 {
     auto actions = std::make_unique<Actions>();
+    conflicts.clear();
     
-    for (auto item : items) {
-        Term* term = dynamic_cast<Term*>(item.next());
-        if (term) {
+    for (auto& item : items) {
+        Symbol* term = item.next();
+        if (term && term->terminal) {
             auto found = nexts.find(term);
             if (found != nexts.end()) {
                 if (actions->shift.count(term) == 0) {
@@ -87,52 +243,28 @@ State::solve_actions(Item accept)
             }
         }
         else if (!item.next()) {
-            if (item == accept) {
-                if (actions->accept.count(item.ahead) == 0) {
-                    actions->accept[item.ahead] = item.rule;
-                } else if (actions->accept[item.ahead] != item.rule) {
-                    std::cerr << "Error: Reduce action already exists.\n";
-                    std::cerr << "  ";
-                    item.rule->nonterm->print(std::cerr);
-                    std::cerr << ":";
-                    for (auto s : item.rule->product) {
-                        std::cerr << " ";
-                        s->print(std::cerr);
-                    }
-                    return nullptr;
+            for (size_t i = item.ahead.next(0); i != Bitset::npos;
+                 i = item.ahead.next(i + 1)) {
+                const Symbol* ahead = terminals[i];
+                
+                std::map<const Symbol*, Nonterm::Rule*>* reduce = &actions->reduce;
+                if (item.same_core(accept) && accept.ahead.contains(i)) {
+                    reduce = &actions->accept;
                 }
-            } else {
-                if (actions->reduce.count(item.ahead) == 0) {
-                    actions->reduce[item.ahead] = item.rule;
-                } else if (actions->reduce[item.ahead] != item.rule) {
-                    std::cerr << "Error: Reduce action already exists.\n";
-                    
-                    auto current = actions->reduce[item.ahead];
-                    
-                    std::cerr << "  ";
-                    current->nonterm->print(std::cerr);
-                    std::cerr << ":";
-                    for (auto s : current->product) {
-                        std::cerr << " ";
-                        s->print(std::cerr);
-                    }
-                    
-                    
-                    
-                    std::cerr << "  ";
-                    item.rule->nonterm->print(std::cerr);
-                    std::cerr << ":";
-                    for (auto s : item.rule->product) {
-                        std::cerr << " ";
-                        s->print(std::cerr);
-                    }
-                    
-                    return nullptr;
+                auto found = reduce->find(ahead);
+                if (found == reduce->end()) {
+                    (*reduce)[ahead] = item.rule;
+                } else if (found->second != item.rule) {
+                    conflicts.emplace_back(ahead, found->second, item.rule);
                 }
             }
         }
     }
     
+    if (conflicts.size() > 0) {
+        return nullptr;
+    }
+    
     actions->combine_reduce();
     return actions;
 }
@@ -141,9 +273,8 @@ void
 State::solve_gotos()
 {
     for (auto next : nexts) {
-        Nonterm* nonterm = dynamic_cast<Nonterm*>(next.first);
-        if (nonterm) {
-            gotos[nonterm] = next.second;
+        if (!next.first->terminal) {
+            gotos[next.first] = next.second;
         }
     }
 }
@@ -155,10 +286,10 @@ State::print(ostream& out) const {
 }
 
 void
-State::print_items(ostream& out) const
+State::print_items(ostream& out, const vector<Symbol*>& terminals) const
 {
     for (auto& item : items) {
-        item.print(out);
+        item.print(out, terminals);
         out << "\n";
     }
     for (auto next : nexts) {
@@ -168,13 +299,18 @@ State::print_items(ostream& out) const
 }
 
 /******************************************************************************/
-Item::Item(Nonterm::Rule* rule, size_t mark, Symbol* ahead):
+Item::Item(Nonterm::Rule* rule, size_t mark):
+rule    (rule),
+mark    (mark),
+ahead   (){}
+
+Item::Item(Nonterm::Rule* rule, size_t mark, const Bitset& ahead):
 rule    (rule),
 mark    (mark),
 ahead   (ahead){}
 
 Item
-Item::advance() {
+Item::advance() const {
     if (mark < rule->product.size()) {
         return Item(rule, mark + 1, ahead);
     } else {
@@ -182,17 +318,8 @@ Item::advance() {
     }
 }
 
-vector<Symbol*>
-Item::rest() {
-    vector<Symbol*> result;
-    result.insert(result.end(),
-                  rule->product.begin() + mark,
-                  rule->product.end());
-    return result;
-}
-
 Symbol*
-Item::next() {
+Item::next() const {
     if (mark < rule->product.size()) {
         return rule->product[mark];
     } else {
@@ -201,38 +328,50 @@ Item::next() {
 }
 
 Nonterm*
-Item::next_nonterm() {
-    if (mark < rule->product.size()) {
-        return dynamic_cast<Nonterm*>(rule->product[mark]);
+Item::next_nonterm() const {
+    if (mark < rule->product.size() && !rule->product[mark]->terminal) {
+        return static_cast<Nonterm*>(rule->product[mark]);
     } else {
         return nullptr;
     }
 }
 
+bool
+Item::same_core(const Item& other) const {
+    return rule == other.rule && mark == other.mark;
+}
+
 bool
 Item::operator==(const Item& other) const {
     if (rule != other.rule) {
         return false;
-    } else if (ahead != other.ahead) {
+    } else if (mark != other.mark) {
         return false;
     } else {
-        return mark == other.mark;
+        return ahead == other.ahead;
     }
 }
 
+size_t
+Item::hash() const {
+    size_t result = ahead.hash();
+    hash_combine(result, rule->id);
+    hash_combine(result, mark);
+    return result;
+}
+
+/** Kernels are sorted by rule and mark, which are unique within a state. */
 bool
 Item::operator<(const Item& other) const {
     if (rule != other.rule) {
-        return rule < other.rule;
-    } else if (ahead != other.ahead) {
-        return ahead < other.ahead;
+        return rule->id < other.rule->id;
     } else {
         return mark < other.mark;
     }
 }
 
 void
-Item::print(ostream& out) const
+Item::print(ostream& out, const vector<Symbol*>& terminals) const
 {
     rule->nonterm->print(out);
     out << ": ";
@@ -264,25 +403,71 @@ Item::print(ostream& out) const
         out << ".";
     }
     
-    out << " , ";
-    ahead->print(out);
+    out << " ,";
+    for (size_t i = ahead.next(0); i != Bitset::npos; i = ahead.next(i + 1)) {
+        out << " ";
+        terminals[i]->print(out);
+    }
 }
 
 /******************************************************************************/
 bool
-State::Actions::is_same(const std::unique_ptr<Actions>& other) const
+State::Actions::is_same(const Actions& other) const
 {
-    if (shift != other->shift)
+    if (shift != other.shift)
         return false;
-    if (accept != other->accept)
+    if (accept != other.accept)
         return false;
-    if (reduce != other->reduce)
+    if (reduce != other.reduce)
         return false;
-    if (any != other->any)
+    if (any != other.any)
         return false;
     return true;
 }
 
+/** Actions that are the same have the same hash, for finding shared rows. */
+size_t
+State::Actions::hash() const
+{
+    size_t result = shift.size();
+    for (auto& next : shift) {
+        hash_combine(result, next.first->id);
+        hash_combine(result, next.second->id);
+    }
+    hash_combine(result, accept.size());
+    for (auto& next : accept) {
+        hash_combine(result, next.first->id);
+        hash_combine(result, next.second->id);
+    }
+    hash_combine(result, reduce.size());
+    for (auto& next : reduce) {
+        hash_combine(result, next.first->id);
+        hash_combine(result, next.second->id);
+    }
+    if (any) {
+        hash_combine(result, any->id);
+    }
+    return result;
+}
+
+State::Conflict::Conflict(const Symbol* ahead,
+                          Nonterm::Rule* first,
+                          Nonterm::Rule* second):
+ahead   (ahead),
+first   (first->id < second->id ? first : second),
+second  (first->id < second->id ? second : first){}
+
+bool
+State::Conflict::operator<(const Conflict& other) const {
+    if (ahead != other.ahead) {
+        return ahead < other.ahead;
+    } else if (first != other.first) {
+        return first->id < other.first->id;
+    } else {
+        return second->id < other.second->id;
+    }
+}
+
 void
 State::Actions::combine_reduce()
 {
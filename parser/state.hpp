@@ -8,6 +8,7 @@
 #define state_hpp
 
 #include "symbols.hpp"
+#include "bitset.hpp"
 
 #include <map>
 
@@ -17,25 +18,34 @@
  * in the possible rule after reading some terminals.  Symbols to the left of
  * the mark have been seen, and symbols to the right could be seen later in the
  * input.
+ *
+ * Rather than one item for each terminal that could follow the rule, an item
+ * keeps the set of all of these lookaheads, by the id of the terminal.
  */
 class Item {
 public:
-    Item(Nonterm::Rule* rule, size_t mark, Symbol* ahead);
+    Item(Nonterm::Rule* rule, size_t mark);
+    Item(Nonterm::Rule* rule, size_t mark, const Bitset& ahead);
     
     Nonterm::Rule* rule;
     size_t mark;
-    Symbol* ahead;
+    Bitset ahead;
     
-    Item advance();
-    std::vector<Symbol*> rest();
+    Item advance() const;
     
-    Symbol* next();
-    Nonterm* next_nonterm();
+    Symbol* next() const;
+    Nonterm* next_nonterm() const;
+    
+    /** Items with the same rule and mark, regardless of their lookaheads. */
+    bool same_core(const Item& other) const;
     
     bool operator==(const Item& other) const;
     bool operator<(const Item& other) const;
     
-    void print(std::ostream& out) const;
+    /** Combines the rule, mark and lookaheads for indexing states. */
+    size_t hash() const;
+    
+    void print(std::ostream& out, const std::vector<Symbol*>& terminals) const;
 };
 
 /*******************************************************************************
@@ -50,12 +60,54 @@ class State
     State(size_t id);
     size_t id;
     
-    std::set<Item> items;
+    /**
+     * The kernel items are those found by advancing the mark over a symbol
+     * from the previous state.  Since the closure only adds items with the mark
+     * at the start of a rule, the kernel alone identifies a unique state.  The
+     * kernel is sorted by rule and mark, with one item for each pair.
+     */
+    std::vector<Item> kernel;
+    std::vector<Item> items;
     void closure();
     
+    /**
+     * Number of closures solved, for reporting.  Each thread counts its own,
+     * and the parallel solver adds the counts of its threads to the thread
+     * that started them.
+     */
+    static thread_local size_t closures;
+    
     std::map<Symbol*, State*> nexts;
     
-    std::unique_ptr<State> solve_next(Symbol* symbol, size_t id);
+    /**
+     * Solves for the kernels of all next states in one pass over the items,
+     * grouping them by the symbol after their mark.  The next states are in
+     * the order of the terminals and then the nonterminals.
+     */
+    typedef std::vector<std::pair<Symbol*, std::unique_ptr<State>>> Nexts;
+    Nexts solve_nexts() const;
+    
+    /** The order of the next states, for those that must be solved the same. */
+    static bool next_before(const Symbol* left, const Symbol* right);
+    
+    /** Hash of the kernel items for finding previously solved states. */
+    size_t hash() const;
+    
+    /**
+     * The core of a state is its kernel without the lookahead symbols.  States
+     * with the same core can be merged by combining their lookaheads, which
+     * returns true if any new items were added to this state.
+     */
+    size_t hash_core() const;
+    bool same_core(const State& other) const;
+    bool merge(const State& other);
+    
+    /**
+     * Pager's weak compatibility test for states with the same core.  Merging
+     * compatible states cannot introduce reduce/reduce conflicts that are not
+     * already in one of the states.
+     */
+    bool is_compatible(const State& other) const;
     
     /** Shift or reduce actions for a given state and next symbol. */
     class Actions {
@@ -66,7 +118,8 @@ class State
         std::map<const Symbol*, Nonterm::Rule*> reduce;
         Nonterm::Rule* any = nullptr;
         
-        bool is_same(const std::unique_ptr<Actions>& other) const;
+        bool is_same(const Actions& other) const;
+        size_t hash() const;
         
         /** Compress the action size by combining reduce actions. */
         void combine_reduce();
@@ -78,7 +131,26 @@ class State
      * refernce this unique set of found actions.
      */
     Actions* actions = nullptr;
-    std::unique_ptr<Actions> solve_actions(Item accept);
+    std::unique_ptr<Actions> solve_actions(const Item& accept,
+                                           const std::vector<Symbol*>& terminals);
+    
+    /**
+     * Two rules that could both be reduced with the same lookahead symbol.  The
+     * conflicts are recorded while solving the actions, which fails if any are
+     * found in the state.
+     */
+    class Conflict {
+      public:
+        Conflict(const Symbol* ahead, Nonterm::Rule* first, Nonterm::Rule* second);
+        
+        const Symbol* ahead;
+        Nonterm::Rule* first;
+        Nonterm::Rule* second;
+        
+        bool operator<(const Conflict& other) const;
+    };
+    
+    std::vector<Conflict> conflicts;
     
     /** Defines the next parse state after reduction of a rule. */
     std::map<Symbol*, State*> gotos;
@@ -86,7 +158,8 @@ class State
     void solve_gotos();
     
     void print(std::ostream& out) const;
-    void print_items(std::ostream& out) const;
+    void print_items(std::ostream& out,
+                     const std::vector<Symbol*>& terminals) const;
 };
 
 #endif
@@ -1,132 +1,18 @@
 #include "symbols.hpp"
 
+#include <algorithm>
+#include <map>
+
 Nonterm::Nonterm(const std::string& name):
 name    (name),
-id      (0),
 firsts  (),
-empty_first(false){}
-
-void Nonterm::print(std::ostream& out) const { out << name; }
-void Nonterm::write(std::ostream& out) const { out << "nonterm" << id; }
-
-/**
- * Methods called by solve for adding symbols to the set of firsts and
- * follows for each nonterminal.  To solve for the firsts and follows of the
- * grammar, the program will keep calling solve as long as a new symbols are
- * being found and inserted into the set.
- */
-void
-Nonterm::solve_first(bool *found)
-{
-    for (auto& rule : rules) {
-        insert_firsts(rule.get(), found);
-    }
-}
-
-void
-Nonterm::solve_firsts(const std::vector<Symbol*>& symbols,
-                      std::set<Symbol*>* firsts)
-{
-    for (Symbol* sym : symbols) {
-        Nonterm* nonterm = dynamic_cast<Nonterm*>(sym);
-        if (nonterm) {
-            firsts->insert(nonterm->firsts.begin(), nonterm->firsts.end());
-            if (!nonterm->empty_first) {
-                return;
-            }
-        } else {
-            firsts->insert(sym);
-            return;
-        }
-    }
-}
-
-void
-Nonterm::insert_firsts(Rule* rule, bool* found)
+empty_first(false)
 {
-    for (auto sym : rule->product) {
-        Nonterm* nonterm = dynamic_cast<Nonterm*>(sym);
-        if (nonterm) {
-            for (auto first : nonterm->firsts) {
-                auto inserted = firsts.insert(first);
-                if (inserted.second) {
-                    *found = true;
-                }
-            }
-            if (!nonterm->empty_first) {
-                return;
-            }
-        } else {
-            auto inserted = firsts.insert(sym);
-            if (inserted.second) {
-                *found = true;
-            }
-            return;
-        }
-    }
-    if (!empty_first) {
-        empty_first = true;
-        *found = true;
-    }
+    terminal = false;
 }
 
-void
-Nonterm::solve_follows(bool *found)
-{
-    for (auto& rule : rules) {
-        auto sym = rule->product.begin();
-        auto end = rule->product.end();
-        
-        for (; sym < end; sym++) {
-            Nonterm* nonterm = dynamic_cast<Nonterm*>(*sym);
-            if (nonterm) {
-                bool empty = false;
-                nonterm->insert_follows(sym + 1, end, &empty, found);
-                if (empty) {
-                    nonterm->insert_follows(rule->nonterm->follows, found);
-                }
-            }
-        }
-    }
-}
-
-void
-Nonterm::insert_follows(const std::set<Symbol*>& syms,
-                        bool* found)
-{
-    for (Symbol* sym : syms) {
-        auto in = follows.insert(sym);
-        if (in.second) {
-            *found = true;
-        }
-    }
-}
-
-void
-Nonterm::insert_follows(std::vector<Symbol*>::iterator sym,
-                        std::vector<Symbol*>::iterator end,
-                        bool* epsilon,
-                        bool* found)
-{
-    for (; sym < end; sym++) {
-        Nonterm* nonterm = dynamic_cast<Nonterm*>(*sym);
-        if (nonterm) {
-            insert_follows(nonterm->firsts, found);
-            if (!nonterm->empty_first) {
-                *epsilon = false;
-                return;
-            }
-        } else {
-            auto in = follows.insert(*sym);
-            if (in.second) {
-                *found = true;
-            }
-            *epsilon = false;
-            return;
-        }
-    }
-    *epsilon = true;
-}
+void Nonterm::print(std::ostream& out) const { out << name; }
+void Nonterm::write(std::ostream& out) const { out << "nonterm" << id; }
 
 void
 Nonterm::print_rules(std::ostream& out) const
@@ -154,20 +40,21 @@ Nonterm::print_rules(std::ostream& out) const
 }
 
 void
-Nonterm::print_firsts(std::ostream& out) const
+Nonterm::print_firsts(std::ostream& out,
+                      const std::vector<Symbol*>& terminals) const
 {
     out << "  ";
     print(out);
     out << ": ";
     
     bool space = false;
-    for (auto sym : firsts) {
+    for (size_t i = firsts.next(0); i != Bitset::npos; i = firsts.next(i + 1)) {
         if (space) {
             out << " ";
         } else {
             space = true;
         }
-        sym->print(out);
+        terminals[i]->print(out);
     }
     if (empty_first) {
         if (space) {
@@ -178,20 +65,21 @@ Nonterm::print_firsts(std::ostream& out) const
 }
 
 void
-Nonterm::print_follows(std::ostream& out) const
+Nonterm::print_follows(std::ostream& out,
+                       const std::vector<Symbol*>& terminals) const
 {
     out << "  ";
     print(out);
     out << ": ";
     
     bool space = false;
-    for (auto sym : follows) {
+    for (size_t i = follows.next(0); i != Bitset::npos; i = follows.next(i + 1)) {
         if (space) {
             out << " ";
         } else {
             space = true;
         }
-        sym->print(out);
+        terminals[i]->print(out);
     }
 }
 
@@ -228,35 +116,235 @@ Nonterm::Rule::write(std::ostream& out) const {
     out << "rule" << id;
 }
 
+/**
+ * Walks the rule backwards from the end, where the symbols left are empty, to
+ * solve the firsts after each mark from the firsts after the next one.
+ */
+void
+Nonterm::Rule::solve_firsts()
+{
+    firsts.assign(product.size() + 1, Bitset());
+    empty.assign(product.size() + 1, true);
+    
+    for (size_t i = product.size(); i > 0; i--) {
+        Symbol* sym = product[i - 1];
+        if (sym->terminal) {
+            firsts[i - 1].insert(sym->id);
+            empty[i - 1] = false;
+        } else {
+            Nonterm* nonterm = static_cast<Nonterm*>(sym);
+            firsts[i - 1] = nonterm->firsts;
+            if (nonterm->empty_first) {
+                firsts[i - 1].insert(firsts[i]);
+                empty[i - 1] = empty[i];
+            } else {
+                empty[i - 1] = false;
+            }
+        }
+    }
+}
+
+/**
+ * Solves for the union of sets over a relation, where each set is the union of
+ * its initial set and the sets of all nonterminals it is related to.  Visiting
+ * the relation depth first, the nonterminals in a strongly connected component
+ * are found together and all share the same set, so every edge is followed
+ * only once instead of repeating passes until nothing changes.
+ */
+static void
+digraph(const std::vector<std::vector<size_t>>& relation,
+        std::vector<Bitset>* sets)
+{
+    const size_t done = (size_t)-1;
+    
+    struct Visit {
+        size_t node;
+        size_t edge;
+        size_t depth;
+    };
+    
+    std::vector<size_t> depth(relation.size(), 0);
+    std::vector<size_t> stack;
+    std::vector<Visit> path;
+    
+    for (size_t start = 0; start < relation.size(); start++) {
+        if (depth[start] != 0) {
+            continue;
+        }
+        stack.push_back(start);
+        depth[start] = stack.size();
+        path.push_back({start, 0, stack.size()});
+        
+        while (path.size() > 0)
+        {
+            Visit& visit = path.back();
+            size_t x = visit.node;
+            
+            if (visit.edge < relation[x].size()) {
+                size_t y = relation[x][visit.edge++];
+                if (depth[y] == 0) {
+                    stack.push_back(y);
+                    depth[y] = stack.size();
+                    path.push_back({y, 0, stack.size()});
+                } else {
+                    depth[x] = std::min(depth[x], depth[y]);
+                    (*sets)[x].insert((*sets)[y]);
+                }
+                continue;
+            }
+            
+            /** The first node of a component keeps the set for the others. */
+            if (depth[x] == visit.depth) {
+                size_t top;
+                do {
+                    top = stack.back();
+                    stack.pop_back();
+                    depth[top] = done;
+                    if (top != x) {
+                        (*sets)[top] = (*sets)[x];
+                    }
+                } while (top != x);
+            }
+            path.pop_back();
+            
+            if (path.size() > 0) {
+                size_t parent = path.back().node;
+                depth[parent] = std::min(depth[parent], depth[x]);
+                (*sets)[parent].insert((*sets)[x]);
+            }
+        }
+    }
+}
+
+/**
+ * A nonterminal could be empty when all symbols of one of its rules could be
+ * empty.  Each rule counts its symbols not yet known to be empty, and as each
+ * nonterminal is found to be empty, the counts of the rules it appears in are
+ * reduced.  A rule reaching zero makes its own nonterminal empty.
+ */
+void
+Nonterm::solve_empty(std::vector<std::unique_ptr<Nonterm>>& nonterms)
+{
+    std::vector<std::vector<Rule*>> appears(nonterms.size());
+    std::map<Rule*, size_t> remaining;
+    std::vector<Nonterm*> found;
+    
+    for (auto& nonterm : nonterms) {
+        nonterm->empty_first = false;
+    }
+    for (auto& nonterm : nonterms) {
+        for (auto& rule : nonterm->rules) {
+            bool term = false;
+            for (auto sym : rule->product) {
+                if (sym->terminal) {
+                    term = true;
+                    break;
+                }
+            }
+            if (term) {
+                continue;
+            }
+            for (auto sym : rule->product) {
+                appears[sym->id].push_back(rule.get());
+            }
+            remaining[rule.get()] = rule->product.size();
+            if (rule->product.size() == 0 && !nonterm->empty_first) {
+                nonterm->empty_first = true;
+                found.push_back(nonterm.get());
+            }
+        }
+    }
+    
+    while (found.size() > 0)
+    {
+        Nonterm* nonterm = found.back();
+        found.pop_back();
+        
+        for (auto rule : appears[nonterm->id]) {
+            if (--remaining[rule] == 0 && !rule->nonterm->empty_first) {
+                rule->nonterm->empty_first = true;
+                found.push_back(rule->nonterm);
+            }
+        }
+    }
+}
+
+/**
+ * The firsts of a nonterminal are the terminals that start one of its rules
+ * after any symbols that could be empty, together with the firsts of every
+ * nonterminal in that position.
+ */
 void
 Nonterm::solve_first(std::vector<std::unique_ptr<Nonterm>>& nonterms)
 {
-    bool found = false;
-    do {
-        found = false;
-        for (auto& nonterm : nonterms) {
-            nonterm->solve_first(&found);
+    solve_empty(nonterms);
+    
+    std::vector<std::vector<size_t>> relation(nonterms.size());
+    std::vector<Bitset> sets(nonterms.size());
+    
+    for (auto& nonterm : nonterms) {
+        for (auto& rule : nonterm->rules) {
+            for (auto sym : rule->product) {
+                if (sym->terminal) {
+                    sets[nonterm->id].insert(sym->id);
+                    break;
+                }
+                relation[nonterm->id].push_back(sym->id);
+                if (!static_cast<Nonterm*>(sym)->empty_first) {
+                    break;
+                }
+            }
+        }
+    }
+    
+    digraph(relation, &sets);
+    for (auto& nonterm : nonterms) {
+        nonterm->firsts = sets[nonterm->id];
+    }
+    for (auto& nonterm : nonterms) {
+        for (auto& rule : nonterm->rules) {
+            rule->solve_firsts();
         }
-    } while (found);
+    }
 }
 
+/**
+ * The follows of a nonterminal are the firsts of the symbols after it in each
+ * rule, together with the follows of the rule's nonterminal if those symbols
+ * could be empty.  The start of the grammar is followed by the endmark.  The
+ * firsts after each mark of the rules must already be solved.
+ */
 void
-Nonterm::solve_follows(std::vector<std::unique_ptr<Nonterm>>& all, Symbol* endmark)
+Nonterm::solve_follows(std::vector<std::unique_ptr<Nonterm>>& nonterms,
+                       Symbol* endmark)
 {
-    if (all.size() == 0 || all.front()->rules.size() == 0) {
+    if (nonterms.size() == 0 || nonterms.front()->rules.size() == 0) {
         return;
     }
     
-    Nonterm::Rule* rule = all.front()->rules.front().get();
-    rule->nonterm->follows.insert(endmark);
+    std::vector<std::vector<size_t>> relation(nonterms.size());
+    std::vector<Bitset> sets(nonterms.size());
+    sets[nonterms.front()->id].insert(endmark->id);
     
-    bool found = false;
-    do {
-        found = false;
-        for (auto& nonterm : all) {
-            nonterm->solve_follows(&found);
+    for (auto& nonterm : nonterms) {
+        for (auto& rule : nonterm->rules) {
+            for (size_t i = 0; i < rule->product.size(); i++) {
+                Symbol* sym = rule->product[i];
+                if (sym->terminal) {
+                    continue;
+                }
+                sets[sym->id].insert(rule->firsts[i + 1]);
+                if (rule->empty[i + 1]) {
+                    relation[sym->id].push_back(nonterm->id);
+                }
+            }
         }
-    } while (found);
+    }
+    
+    digraph(relation, &sets);
+    for (auto& nonterm : nonterms) {
+        nonterm->follows = sets[nonterm->id];
+    }
 }
 
 void Endmark::print(std::ostream& out) const { out << "$"; }
@@ -10,6 +10,7 @@
 #define symbols_hpp
 
 #include "finite.hpp"
+#include "bitset.hpp"
 #include <string>
 #include <vector>
 #include <set>
@@ -25,7 +26,6 @@ class Nonterm : public Symbol
   public:
     Nonterm(const std::string& name);
     std::string name;
-    size_t id = 0;
     
     /**
      * All nonterminals have one or more production rules, vectors of symbols,
@@ -44,6 +44,15 @@ class Nonterm : public Symbol
         std::string action;
         size_t id = 0;
         
+        /**
+         * Terminals that could be first in the symbols from each mark to the
+         * end of the rule, and whether those symbols could all be empty.  The
+         * closure of a state looks these up for the symbols after the mark.
+         */
+        std::vector<Bitset> firsts;
+        std::vector<bool> empty;
+        void solve_firsts();
+        
         void print(std::ostream& out) const;
         void write(std::ostream& out) const;
     };
@@ -54,18 +63,16 @@ class Nonterm : public Symbol
      * To find all possible parse states, the first step is to solve for all
      * terminals that could be the first in the productions for each non-
      * terminal. A nonterminal can also have an empty production rule of no
-     * symbols.
+     * symbols.  The sets contain the ids of the terminals.
      */
-    std::set<Symbol*> firsts;
+    Bitset firsts;
     bool empty_first;
-    void solve_first(bool* found);
     
     /**
      * After finding the firsts, solve for all terminals that could follow each
      * nonterminal.
      */
-    std::set<Symbol*> follows;
-    void solve_follows(bool* found);
+    Bitset follows;
     
     /**
      * The first step to solving all parse states is finding all terminals that
@@ -83,24 +90,15 @@ class Nonterm : public Symbol
     virtual void write(std::ostream& out) const;
     
     void print_rules(std::ostream& out) const;
-    void print_firsts(std::ostream& out) const;
-    void print_follows(std::ostream& out) const;
-    
-    static void solve_firsts(const std::vector<Symbol*>& symbols,
-                             std::set<Symbol*>* firsts);
+    void print_firsts(std::ostream& out,
+                      const std::vector<Symbol*>& terminals) const;
+    void print_follows(std::ostream& out,
+                       const std::vector<Symbol*>& terminals) const;
     
 private:
-    /** Called by solve for finding the set of firsts and follows. */
-    void insert_firsts(Rule* rule,
-                       bool* found);
-    
-    void insert_follows(const std::set<Symbol*>& syms,
-                        bool* found);
-    
-    void insert_follows(std::vector<Symbol*>::iterator symbol,
-                        std::vector<Symbol*>::iterator end,
-                        bool* epsilon,
-                        bool* found);
+    /** Called by solve for finding the nonterminals with empty firsts. */
+    static void
+    solve_empty(std::vector<std::unique_ptr<Nonterm>>& nonterms);
 };
 
 /** Indicates the end of an input string. */
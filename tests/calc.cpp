@@ -0,0 +1,77 @@
+/**
+ * Actions of the calculator grammar, and the inputs it must accept or reject,
+ * including expressions nested deeper than the fixed part of the parse stack.
+ */
+
+#include "tests.hpp"
+
+/******************************************************************************/
+std::unique_ptr<Num>
+scan_num(Table*, const std::string& text) {
+    return std::unique_ptr<Num>(new Num(std::stol(text)));
+}
+
+std::unique_ptr<Num>
+reduce_total(Table*, std::unique_ptr<Num>& value) {
+    return std::move(value);
+}
+
+std::unique_ptr<Num>
+reduce_add(Table*, std::unique_ptr<Num>& left, std::unique_ptr<Num>& right) {
+    return std::unique_ptr<Num>(new Num(left->value + right->value));
+}
+
+std::unique_ptr<Num>
+reduce_sub(Table*, std::unique_ptr<Num>& left, std::unique_ptr<Num>& right) {
+    return std::unique_ptr<Num>(new Num(left->value - right->value));
+}
+
+std::unique_ptr<Num>
+reduce_mul(Table*, std::unique_ptr<Num>& left, std::unique_ptr<Num>& right) {
+    return std::unique_ptr<Num>(new Num(left->value * right->value));
+}
+
+std::unique_ptr<Num>
+reduce_div(Table*, std::unique_ptr<Num>& left, std::unique_ptr<Num>& right) {
+    return std::unique_ptr<Num>(new Num(left->value / right->value));
+}
+
+std::unique_ptr<Num>
+reduce_neg(Table*, std::unique_ptr<Num>& value) {
+    return std::unique_ptr<Num>(new Num(-value->value));
+}
+
+/******************************************************************************/
+int
+main()
+{
+    std::string deep = std::string(5000, '(') + "7" + std::string(5000, ')');
+    std::string negated = std::string(3000, '-') + "5";
+    std::string sum = "1";
+    for (int i = 0; i < 10000; i++) {
+        sum += " + 1";
+    }
+    
+    std::vector<Case> cases = {
+        {"1", true, 1},
+        {"1 + 2 * 3", true, 7},
+        {"(1 + 2) * 3", true, 9},
+        {"((4)) - (2 * (3))", true, -2},
+        {"10 - 4 - 3", true, 3},
+        {"100 / 10 / 5", true, 2},
+        {" -3 * -(2 + 1)\n", true, 9},
+        {"12345 *\t2", true, 24690},
+        {deep, true, 7},
+        {negated, true, 5},
+        {sum, true, 10001},
+        {"", false, 0},
+        {"1 +", false, 0},
+        {"(1 + 2", false, 0},
+        {"1 + 2)", false, 0},
+        {"1 2", false, 0},
+        {"2 $ 3", false, 0},
+        {"* 4", false, 0},
+        {deep + ")", false, 0},
+    };
+    return run_cases(cases) == 0 ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+#!/bin/sh
+#
+# Generates the code of each test grammar that has a driver, with each table
+# layout and lexer, and with each method and construction, then compiles it
+# with all warnings as errors and runs the driver, which parses inputs the
+# grammar must accept or reject.  Stops at the first failure.
+#
+# Usage: test.sh [parser] [output directory]
+
+PARSER=${1:-bin/parser}
+OUT=${2:-build/tests}
+TESTS=$(dirname "$0")
+CXX=${CXX:-g++}
+
+mkdir -p "$OUT"
+
+count=0
+for grammar in "$TESTS"/*.bnf; do
+    base=$(basename "$grammar" .bnf)
+    driver="$TESTS/$base.cpp"
+    if [ ! -f "$driver" ]; then
+        continue
+    fi
+    
+    for options in "-g lists -x functions" "-g lists -x direct" "-g lists -x table" \
+                   "-g dense -x functions" "-g dense -x direct" "-g dense -x table" \
+                   "-g comb -x functions" "-g comb -x direct" "-g comb -x table" \
+                   "-a lr1 -e position" "-a lalr -e thompson" "-a lalr -e position" \
+                   "-a pager -e thompson" "-a pager -e position"
+    do
+        name="$OUT/$base$(echo "$options" | tr -d ' -')"
+        if ! "$PARSER" $options -o "$name.cpp" "$grammar" 2> "$name.errors" ||
+           ! $CXX -std=c++14 -Wall -Werror -I "$TESTS" -o "$name" \
+                 "$name.cpp" "$driver" 2>> "$name.errors"; then
+            echo "Failed to build $base with $options, see $name.errors."
+            exit 1
+        fi
+        if ! "$name"; then
+            echo "Failed $base with $options."
+            exit 1
+        fi
+        count=$((count + 1))
+    done
+done
+echo "Passed $count tests."
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Types used by the code generated from the test grammars, and a function for
+ * the drivers of each grammar to check the result of parsing their inputs.
+ */
+
+#ifndef tests_hpp
+#define tests_hpp
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct State;
+
+class Table {};
+
+class Value {
+public:
+    virtual ~Value() = default;
+};
+
+class Num : public Value {
+public:
+    explicit Num(long value): value(value) {}
+    long value;
+};
+
+Value* parse(const char* input, size_t length, Table* table);
+
+/*******************************************************************************
+ * An input is either accepted with the given value, or not accepted at all.
+ */
+struct Case {
+    std::string input;
+    bool accepted;
+    long value;
+};
+
+/** Parses each input, printing those that fail, and returns the failures. */
+inline int
+run_cases(const std::vector<Case>& cases)
+{
+    int failures = 0;
+    Table table;
+    for (auto& test : cases) {
+        std::unique_ptr<Value> result(parse(test.input.data(),
+                                            test.input.size(), &table));
+        Num* num = dynamic_cast<Num*>(result.get());
+        
+        bool ok = false;
+        if (!test.accepted) {
+            ok = !result;
+        } else {
+            ok = num && num->value == test.value;
+        }
+        if (!ok) {
+            std::string shown = test.input.substr(0, 40);
+            std::cerr << "Failed on '" << shown << "': expected ";
+            if (test.accepted) {
+                std::cerr << test.value;
+            } else {
+                std::cerr << "an error";
+            }
+            std::cerr << ", found ";
+            if (num) {
+                std::cerr << num->value << "\n";
+            } else {
+                std::cerr << "an error\n";
+            }
+            failures++;
+        }
+    }
+    return failures;
+}
+
+#endif
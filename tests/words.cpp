@@ -0,0 +1,73 @@
+/**
+ * Actions of the statements grammar, and the inputs it must accept or reject,
+ * testing keywords against identifiers, unicode letters and empty rules.
+ */
+
+#include "tests.hpp"
+
+/******************************************************************************/
+std::unique_ptr<Num>
+scan_length(Table*, const std::string& text) {
+    return std::unique_ptr<Num>(new Num((long)text.size()));
+}
+
+std::unique_ptr<Num>
+scan_num(Table*, const std::string& text) {
+    return std::unique_ptr<Num>(new Num(std::stol(text)));
+}
+
+std::unique_ptr<Num>
+reduce_program(Table*, std::unique_ptr<Num>& value) {
+    return std::move(value);
+}
+
+std::unique_ptr<Num>
+reduce_none(Table*) {
+    return std::unique_ptr<Num>(new Num(0));
+}
+
+std::unique_ptr<Num>
+reduce_add(Table*, std::unique_ptr<Num>& left, std::unique_ptr<Num>& right) {
+    return std::unique_ptr<Num>(new Num(left->value + right->value));
+}
+
+std::unique_ptr<Num>
+reduce_let(Table*, std::unique_ptr<Num>&, std::unique_ptr<Num>& value) {
+    return std::move(value);
+}
+
+std::unique_ptr<Num>
+reduce_value(Table*, std::unique_ptr<Num>& value) {
+    return std::move(value);
+}
+
+/******************************************************************************/
+int
+main()
+{
+    std::string many;
+    for (int i = 0; i < 2000; i++) {
+        many += "let x = 1; y;\n";
+    }
+    
+    std::vector<Case> cases = {
+        {"", true, 0},
+        {"x;", true, 1},
+        {"let x = 42;", true, 42},
+        {"letter;", true, 6},
+        {"lets = 3;", false, 0},
+        {"let let = 1;", false, 0},
+        {"let ab = cde; 7;", true, 10},
+        {"\xce\xb1\xce\xb2\xce\xb3;", true, 6},
+        {"a\xcf\x89" "9;", true, 4},
+        {"many\n\t;", true, 4},
+        {many, true, 4000},
+        {"x", false, 0},
+        {"let x = ;", false, 0},
+        {"1 2;", false, 0},
+        {"X;", false, 0},
+        {"\xff;", false, 0},
+        {"\xce;", false, 0},
+    };
+    return run_cases(cases) == 0 ? 0 : 1;
+}